@@ -15,43 +15,95 @@
 #include <stdbool.h>
 
 
+/* ----- Enumerations ----- */
+
+/*
+Opcodes of a command stream for llglExecuteCommandStream.
+Each command starts with its 32-bit opcode followed by the arguments of the respective function in parameter order.
+Arguments are tightly packed without padding: object handles are pointer-sized, enumerations and integers have the size of their C type,
+and structures are stored by value. The data of LLGLCommandStreamOpcodeSetUniforms immediately follows its 32-bit data size.
+*/
+typedef enum LLGLCommandStreamOpcode
+{
+    LLGLCommandStreamOpcodeSetViewport              = 1,    /* LLGLViewport viewport */
+    LLGLCommandStreamOpcodeSetScissor               = 2,    /* LLGLScissor scissor */
+    LLGLCommandStreamOpcodeSetVertexBuffer          = 3,    /* LLGLBuffer buffer */
+    LLGLCommandStreamOpcodeSetVertexBufferArray     = 4,    /* LLGLBufferArray bufferArray */
+    LLGLCommandStreamOpcodeSetIndexBuffer           = 5,    /* LLGLBuffer buffer */
+    LLGLCommandStreamOpcodeSetIndexBufferExt        = 6,    /* LLGLBuffer buffer, LLGLFormat format, uint64_t offset */
+    LLGLCommandStreamOpcodeSetResourceHeap          = 7,    /* LLGLResourceHeap resourceHeap, uint32_t descriptorSet */
+    LLGLCommandStreamOpcodeSetResource              = 8,    /* uint32_t descriptor, LLGLResource resource */
+    LLGLCommandStreamOpcodeSetPipelineState         = 9,    /* LLGLPipelineState pipelineState */
+    LLGLCommandStreamOpcodeSetUniforms              = 10,   /* uint32_t first, uint32_t dataSize, uint8_t data[dataSize] */
+    LLGLCommandStreamOpcodeBeginRenderPass          = 11,   /* LLGLRenderTarget renderTarget */
+    LLGLCommandStreamOpcodeEndRenderPass            = 12,   /* no arguments */
+    LLGLCommandStreamOpcodeClear                    = 13,   /* uint32_t flags, LLGLClearValue clearValue */
+    LLGLCommandStreamOpcodeDraw                     = 14,   /* uint32_t numVertices, uint32_t firstVertex */
+    LLGLCommandStreamOpcodeDrawIndexed              = 15,   /* uint32_t numIndices, uint32_t firstIndex, int32_t vertexOffset */
+    LLGLCommandStreamOpcodeDrawInstanced            = 16,   /* uint32_t numVertices, uint32_t firstVertex, uint32_t numInstances, uint32_t firstInstance */
+    LLGLCommandStreamOpcodeDrawIndexedInstanced     = 17,   /* uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance */
+    LLGLCommandStreamOpcodeDispatch                 = 18,   /* uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ */
+}
+LLGLCommandStreamOpcode;
+
+
+/* ----- Functions ----- */
+
 LLGL_C_EXPORT void llglBegin(LLGLCommandBuffer commandBuffer);
 LLGL_C_EXPORT void llglEnd();
 LLGL_C_EXPORT void llglExecute(LLGLCommandBuffer secondaryCommandBuffer);
 LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint16_t dataSize);
 LLGL_C_EXPORT void llglCopyBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLBuffer srcBuffer, uint64_t srcOffset, uint64_t size);
+LLGL_C_EXPORT void llglCopyBufferRegions(LLGLBuffer dstBuffer, LLGLBuffer srcBuffer, uint32_t numRegions, const LLGLBufferCopyRegion* regions LLGL_ANNOTATE([numRegions]));
 LLGL_C_EXPORT void llglCopyBufferFromTexture(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglFillBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, uint32_t value, uint64_t fillSize);
+LLGL_C_EXPORT void llglClearBuffer(LLGLBuffer dstBuffer, LLGLFormat format, const LLGLClearValue* clearValue, uint64_t dstOffset, uint64_t clearSize);
 LLGL_C_EXPORT void llglCopyTexture(LLGLTexture dstTexture, const LLGLTextureLocation* dstLocation, LLGLTexture srcTexture, const LLGLTextureLocation* srcLocation, const LLGLExtent3D* extent);
+LLGL_C_EXPORT void llglCopyTextureRegions(LLGLTexture dstTexture, LLGLTexture srcTexture, uint32_t numRegions, const LLGLTextureCopyRegion* regions LLGL_ANNOTATE([numRegions]));
 LLGL_C_EXPORT void llglCopyTextureFromBuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLBuffer srcBuffer, uint64_t srcOffset, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglCopyTextureFromFramebuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, const LLGLOffset2D* srcOffset);
+LLGL_C_EXPORT void llglClearTexture(LLGLTexture texture, const LLGLTextureSubresource* subresource, const LLGLClearValue* clearValue);
+LLGL_C_EXPORT void llglDiscardResource(LLGLResource resource);
 LLGL_C_EXPORT void llglGenerateMips(LLGLTexture texture);
 LLGL_C_EXPORT void llglGenerateMipsRange(LLGLTexture texture, const LLGLTextureSubresource* subresource);
+LLGL_C_EXPORT void llglGenerateMipsBatch(uint32_t numTextures, LLGLTexture const * textures LLGL_ANNOTATE([numTextures]));
 LLGL_C_EXPORT void llglSetViewport(const LLGLViewport* viewport);
 LLGL_C_EXPORT void llglSetViewports(uint32_t numViewports, const LLGLViewport* viewports LLGL_ANNOTATE([numViewports]));
 LLGL_C_EXPORT void llglSetScissor(const LLGLScissor* scissor);
 LLGL_C_EXPORT void llglSetScissors(uint32_t numScissors, const LLGLScissor* scissors LLGL_ANNOTATE([numScissors]));
 LLGL_C_EXPORT void llglSetVertexBuffer(LLGLBuffer buffer);
+LLGL_C_EXPORT void llglSetVertexBufferExt(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglSetVertexBufferArray(LLGLBufferArray bufferArray);
+LLGL_C_EXPORT void llglSetVertexBufferArrayExt(LLGLBufferArray bufferArray, const uint64_t* offsets);
 LLGL_C_EXPORT void llglSetIndexBuffer(LLGLBuffer buffer);
 LLGL_C_EXPORT void llglSetIndexBufferExt(LLGLBuffer buffer, LLGLFormat format, uint64_t offset);
 LLGL_C_EXPORT void llglSetResourceHeap(LLGLResourceHeap resourceHeap, uint32_t descriptorSet);
 LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource);
+LLGL_C_EXPORT void llglSetResourceExt(uint32_t descriptor, LLGLBuffer buffer, uint64_t offset, uint64_t size);
 //LLGL_DEPRECATED("llglResetResourceSlots is deprecated since 0.04b; No need to reset resource slots manually anymore!")
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags);
 LLGL_C_EXPORT void llglBeginRenderPass(LLGLRenderTarget renderTarget);
 LLGL_C_EXPORT void llglBeginRenderPassWithClear(LLGLRenderTarget renderTarget, LLGLRenderPass renderPass, uint32_t numClearValues, const LLGLClearValue* clearValues LLGL_ANNOTATE([numClearValues]), uint32_t swapBufferIndex);
 LLGL_C_EXPORT void llglEndRenderPass();
+LLGL_C_EXPORT void llglNextSubpass();
 LLGL_C_EXPORT void llglClear(long flags, const LLGLClearValue* clearValue);
 LLGL_C_EXPORT void llglClearAttachments(uint32_t numAttachments, const LLGLAttachmentClear* attachments LLGL_ANNOTATE([numAttachments]));
 LLGL_C_EXPORT void llglSetPipelineState(LLGLPipelineState pipelineState);
 LLGL_C_EXPORT void llglSetBlendFactor(const float color[4]);
 LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace stencilFace);
+LLGL_C_EXPORT void llglSetCullMode(LLGLCullMode cullMode);
+LLGL_C_EXPORT void llglSetDepthState(const LLGLDepthDescriptor* depthDesc);
+LLGL_C_EXPORT void llglSetStencilState(const LLGLStencilDescriptor* stencilDesc);
+LLGL_C_EXPORT void llglSetPrimitiveTopology(LLGLPrimitiveTopology primitiveTopology);
+LLGL_C_EXPORT void llglSetDepthBias(const LLGLDepthBiasDescriptor* depthBiasDesc);
+LLGL_C_EXPORT void llglSetShadingRate(const LLGLShadingRateDescriptor* shadingRateDesc);
+LLGL_C_EXPORT void llglSetShadingRateImage(LLGLTexture texture);
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize);
 LLGL_C_EXPORT void llglBeginQuery(LLGLQueryHeap queryHeap, uint32_t query);
 LLGL_C_EXPORT void llglEndQuery(LLGLQueryHeap queryHeap, uint32_t query);
 LLGL_C_EXPORT void llglBeginRenderCondition(LLGLQueryHeap queryHeap, uint32_t query, LLGLRenderConditionMode mode);
 LLGL_C_EXPORT void llglEndRenderCondition();
+LLGL_C_EXPORT void llglResolveQueryData(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset);
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers LLGL_ANNOTATE([numBuffers]));
 LLGL_C_EXPORT void llglEndStreamOutput();
 LLGL_C_EXPORT void llglDraw(uint32_t numVertices, uint32_t firstVertex);
@@ -61,16 +113,22 @@ LLGL_C_EXPORT void llglDrawInstanced(uint32_t numVertices, uint32_t firstVertex,
 LLGL_C_EXPORT void llglDrawInstancedExt(uint32_t numVertices, uint32_t firstVertex, uint32_t numInstances, uint32_t firstInstance);
 LLGL_C_EXPORT void llglDrawIndexedInstanced(uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex);
 LLGL_C_EXPORT void llglDrawIndexedInstancedExt(uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+LLGL_C_EXPORT void llglMultiDrawIndexed(uint32_t numDraws, const LLGLDrawIndexedIndirectArguments* draws LLGL_ANNOTATE([numDraws]));
 LLGL_C_EXPORT void llglDrawIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDrawIndexedIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer argumentsBuffer, uint64_t argumentsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer argumentsBuffer, uint64_t argumentsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawMeshTasks(uint32_t numThreadGroupsX, uint32_t numThreadGroupsY, uint32_t numThreadGroupsZ);
+LLGL_C_EXPORT void llglDrawMeshTasksIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
 LLGL_C_EXPORT void llglDispatchIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglPushDebugGroup(const char* name);
 LLGL_C_EXPORT void llglPopDebugGroup();
 LLGL_C_EXPORT void llglDoNativeCommand(const void* nativeCommand, size_t nativeCommandSize);
 LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT size_t llglExecuteCommandStream(const void* stream, size_t streamSize);
 
 
 #endif
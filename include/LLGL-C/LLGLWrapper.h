@@ -61,6 +61,14 @@ typedef enum LLGLStencilFace
 }
 LLGLStencilFace;
 
+typedef enum LLGLCommandQueueType
+{
+    LLGLCommandQueueTypeGraphics,
+    LLGLCommandQueueTypeCompute,
+    LLGLCommandQueueTypeCopy,
+}
+LLGLCommandQueueType;
+
 typedef enum LLGLFormat
 {
     LLGLFormatUndefined,
@@ -546,6 +554,28 @@ typedef enum LLGLTessellationPartition
 }
 LLGLTessellationPartition;
 
+typedef enum LLGLShadingRate
+{
+    LLGLShadingRateRate1x1,
+    LLGLShadingRateRate1x2,
+    LLGLShadingRateRate2x1,
+    LLGLShadingRateRate2x2,
+    LLGLShadingRateRate2x4,
+    LLGLShadingRateRate4x2,
+    LLGLShadingRateRate4x4,
+}
+LLGLShadingRate;
+
+typedef enum LLGLShadingRateCombiner
+{
+    LLGLShadingRateCombinerPassthrough,
+    LLGLShadingRateCombinerOverride,
+    LLGLShadingRateCombinerMin,
+    LLGLShadingRateCombinerMax,
+    LLGLShadingRateCombinerSum,
+}
+LLGLShadingRateCombiner;
+
 typedef enum LLGLQueryType
 {
     LLGLQueryTypeSamplesPassed,
@@ -678,6 +708,16 @@ typedef enum LLGLResourceType
 }
 LLGLResourceType;
 
+typedef enum LLGLResidencyPriority
+{
+    LLGLResidencyPriorityMinimum,
+    LLGLResidencyPriorityLow,
+    LLGLResidencyPriorityNormal,
+    LLGLResidencyPriorityHigh,
+    LLGLResidencyPriorityMaximum,
+}
+LLGLResidencyPriority;
+
 typedef enum LLGLSamplerAddressMode
 {
     LLGLSamplerAddressModeRepeat,
@@ -704,6 +744,8 @@ typedef enum LLGLShaderType
     LLGLShaderTypeGeometry,
     LLGLShaderTypeFragment,
     LLGLShaderTypeCompute,
+    LLGLShaderTypeTask,
+    LLGLShaderTypeMesh,
 }
 LLGLShaderType;
 
@@ -752,6 +794,25 @@ typedef enum LLGLSystemValue
 }
 LLGLSystemValue;
 
+typedef enum LLGLPresentMode
+{
+    LLGLPresentModeDefault,
+    LLGLPresentModeImmediate,
+    LLGLPresentModeMailbox,
+    LLGLPresentModeFifo,
+    LLGLPresentModeFifoRelaxed,
+}
+LLGLPresentMode;
+
+typedef enum LLGLSurfaceTransform
+{
+    LLGLSurfaceTransformIdentity,
+    LLGLSurfaceTransformRotate90,
+    LLGLSurfaceTransformRotate180,
+    LLGLSurfaceTransformRotate270,
+}
+LLGLSurfaceTransform;
+
 typedef enum LLGLTextureType
 {
     LLGLTextureTypeTexture1D,
@@ -791,6 +852,7 @@ typedef enum LLGLCommandBufferFlags
     LLGLCommandBufferSecondary       = (1 << 0),
     LLGLCommandBufferMultiSubmit     = (1 << 1),
     LLGLCommandBufferImmediateSubmit = (1 << 2),
+    LLGLCommandBufferTransient       = (1 << 3),
 }
 LLGLCommandBufferFlags;
 
@@ -836,6 +898,12 @@ typedef enum LLGLBarrierFlags
 }
 LLGLBarrierFlags;
 
+typedef enum LLGLPipelineLayoutFlags
+{
+    LLGLPipelineLayoutRootDescriptors = (1 << 0),
+}
+LLGLPipelineLayoutFlags;
+
 typedef enum LLGLColorMaskFlags
 {
     LLGLColorMaskZero = 0,
@@ -847,12 +915,24 @@ typedef enum LLGLColorMaskFlags
 }
 LLGLColorMaskFlags;
 
+typedef enum LLGLDynamicStateFlags
+{
+    LLGLDynamicStateCullMode          = (1 << 0),
+    LLGLDynamicStateDepthState        = (1 << 1),
+    LLGLDynamicStateStencilState      = (1 << 2),
+    LLGLDynamicStatePrimitiveTopology = (1 << 3),
+    LLGLDynamicStateDepthBias         = (1 << 4),
+}
+LLGLDynamicStateFlags;
+
 typedef enum LLGLRenderSystemFlags
 {
-    LLGLRenderSystemDebugDevice  = (1 << 0),
-    LLGLRenderSystemPreferNVIDIA = (1 << 1),
-    LLGLRenderSystemPreferAMD    = (1 << 2),
-    LLGLRenderSystemPreferIntel  = (1 << 3),
+    LLGLRenderSystemDebugDevice     = (1 << 0),
+    LLGLRenderSystemPreferNVIDIA    = (1 << 1),
+    LLGLRenderSystemPreferAMD       = (1 << 2),
+    LLGLRenderSystemPreferIntel     = (1 << 3),
+    LLGLRenderSystemDeferredRelease = (1 << 4),
+    LLGLRenderSystemHeadless        = (1 << 5),
 }
 LLGLRenderSystemFlags;
 
@@ -870,6 +950,7 @@ typedef enum LLGLBindFlags
     LLGLBindCombinedSampler        = (1 << 9),
     LLGLBindCopySrc                = (1 << 10),
     LLGLBindCopyDst                = (1 << 11),
+    LLGLBindInputAttachment        = (1 << 12),
 }
 LLGLBindFlags;
 
@@ -882,12 +963,17 @@ LLGLCPUAccessFlags;
 
 typedef enum LLGLMiscFlags
 {
-    LLGLMiscDynamicUsage  = (1 << 0),
-    LLGLMiscFixedSamples  = (1 << 1),
-    LLGLMiscGenerateMips  = (1 << 2),
-    LLGLMiscNoInitialData = (1 << 3),
-    LLGLMiscAppend        = (1 << 4),
-    LLGLMiscCounter       = (1 << 5),
+    LLGLMiscDynamicUsage    = (1 << 0),
+    LLGLMiscFixedSamples    = (1 << 1),
+    LLGLMiscGenerateMips    = (1 << 2),
+    LLGLMiscNoInitialData   = (1 << 3),
+    LLGLMiscAppend          = (1 << 4),
+    LLGLMiscCounter         = (1 << 5),
+    LLGLMiscTransient       = (1 << 6),
+    LLGLMiscMemoryless      = (1 << 7),
+    LLGLMiscSparse          = (1 << 8),
+    LLGLMiscDirectUpload    = (1 << 9),
+    LLGLMiscDedicatedMemory = (1 << 10),
 }
 LLGLMiscFlags;
 
@@ -902,6 +988,7 @@ typedef enum LLGLShaderCompileFlags
     LLGLShaderCompilePatchClippingOrigin = (1 << 6),
     LLGLShaderCompileSeparateShader      = (1 << 7),
     LLGLShaderCompileDefaultLibrary      = (1 << 8),
+    LLGLShaderCompileStripDebugInfo      = (1 << 9),
 }
 LLGLShaderCompileFlags;
 
@@ -913,8 +1000,11 @@ typedef enum LLGLStageFlags
     LLGLStageGeometryStage       = (1 << 3),
     LLGLStageFragmentStage       = (1 << 4),
     LLGLStageComputeStage        = (1 << 5),
+    LLGLStageTaskStage           = (1 << 6),
+    LLGLStageMeshStage           = (1 << 7),
     LLGLStageAllTessStages       = (LLGLStageTessControlStage | LLGLStageTessEvaluationStage),
-    LLGLStageAllGraphicsStages   = (LLGLStageVertexStage | LLGLStageAllTessStages | LLGLStageGeometryStage | LLGLStageFragmentStage),
+    LLGLStageAllMeshStages       = (LLGLStageTaskStage | LLGLStageMeshStage),
+    LLGLStageAllGraphicsStages   = (LLGLStageVertexStage | LLGLStageAllTessStages | LLGLStageGeometryStage | LLGLStageAllMeshStages | LLGLStageFragmentStage),
     LLGLStageAllStages           = (LLGLStageAllGraphicsStages | LLGLStageComputeStage),
 }
 LLGLStageFlags;
@@ -959,11 +1049,12 @@ LLGLClearValue;
 
 typedef struct LLGLCommandBufferDescriptor
 {
-    const char*    debugName;          /* = NULL */
-    long           flags;              /* = 0 */
-    uint32_t       numNativeBuffers;   /* = 2 */
-    uint64_t       minStagingPoolSize; /* = (0xFFFF+1) */
-    LLGLRenderPass renderPass;         /* = LLGL_NULL_OBJECT */
+    const char*          debugName;          /* = NULL */
+    long                 flags;              /* = 0 */
+    uint32_t             numNativeBuffers;   /* = 2 */
+    uint64_t             minStagingPoolSize; /* = (0xFFFF+1) */
+    LLGLRenderPass       renderPass;         /* = LLGL_NULL_OBJECT */
+    LLGLCommandQueueType queueType;          /* = LLGLCommandQueueTypeGraphics */
 }
 LLGLCommandBufferDescriptor;
 
@@ -1001,6 +1092,12 @@ typedef struct LLGLDispatchIndirectArguments
 }
 LLGLDispatchIndirectArguments;
 
+typedef struct LLGLDrawMeshTasksIndirectArguments
+{
+    uint32_t numThreadGroups[3];
+}
+LLGLDrawMeshTasksIndirectArguments;
+
 typedef struct LLGLBindingSlot
 {
     uint32_t index; /* = 0 */
@@ -1036,6 +1133,14 @@ typedef struct LLGLDepthBiasDescriptor
 }
 LLGLDepthBiasDescriptor;
 
+typedef struct LLGLShadingRateDescriptor
+{
+    LLGLShadingRate         rate;              /* = LLGLShadingRateRate1x1 */
+    LLGLShadingRateCombiner primitiveCombiner; /* = LLGLShadingRateCombinerPassthrough */
+    LLGLShadingRateCombiner imageCombiner;     /* = LLGLShadingRateCombinerPassthrough */
+}
+LLGLShadingRateDescriptor;
+
 typedef struct LLGLComputePipelineDescriptor
 {
     const char*        debugName;      /* = NULL */
@@ -1062,8 +1167,11 @@ LLGLQueryPipelineStatistics;
 
 typedef struct LLGLProfileTimeRecord
 {
-    const char* annotation;  /* = "" */
-    uint64_t    elapsedTime; /* = 0 */
+    const char* annotation;      /* = "" */
+    uint64_t    elapsedTime;     /* = 0 */
+    uint64_t    cpuTicksStart;   /* = 0 */
+    uint64_t    cpuTicksEnd;     /* = 0 */
+    uint32_t    commandBufferID; /* = 0 */
 }
 LLGLProfileTimeRecord;
 
@@ -1152,6 +1260,19 @@ typedef struct LLGLRenderingFeatures
     bool hasPipelineCaching;           /* = false */
     bool hasPipelineStatistics;        /* = false */
     bool hasRenderCondition;           /* = false */
+    bool hasConcurrentPipelineStateCreation; /* = false */
+    bool hasIndirectDrawingCount;      /* = false */
+    bool hasConcurrentShaderCreation;  /* = false */
+    bool hasConcurrentResourceCreation; /* = false */
+    bool hasMeshShaders;               /* = false */
+    bool hasSparseTextures;            /* = false */
+    bool hasInputAttachments;          /* = false */
+    bool hasQueryResolve;              /* = false */
+    bool hasFileStreamDecompression;   /* = false */
+    bool hasTextureMinLODClamp;        /* = false */
+    bool hasVariableRateShading;       /* = false */
+    bool hasShadingRateImage;          /* = false */
+    bool hasMultiview;                 /* = false */
 }
 LLGLRenderingFeatures;
 
@@ -1181,6 +1302,10 @@ typedef struct LLGLRenderingLimits
     uint32_t maxDepthBufferSamples;            /* = 0 */
     uint32_t maxStencilBufferSamples;          /* = 0 */
     uint32_t maxNoAttachmentSamples;           /* = 0 */
+    uint32_t maxMeshShaderWorkGroups[3];       /* = {0,0,0} */
+    long     dynamicStates;                    /* = 0 */
+    uint32_t shadingRateImageTileSize;         /* = 0 */
+    uint32_t maxMultiviewViews;                /* = 0 */
 }
 LLGLRenderingLimits;
 
@@ -1258,6 +1383,14 @@ typedef struct LLGLBufferViewDescriptor
 }
 LLGLBufferViewDescriptor;
 
+typedef struct LLGLBufferCopyRegion
+{
+    uint64_t dstOffset; /* = 0 */
+    uint64_t srcOffset; /* = 0 */
+    uint64_t size;      /* = 0 */
+}
+LLGLBufferCopyRegion;
+
 typedef struct LLGLAttachmentClear
 {
     long           flags;           /* = 0 */
@@ -1424,6 +1557,7 @@ typedef struct LLGLRenderSystemDescriptor
     size_t                rendererConfigSize; /* = 0 */
     const void*           nativeHandle;       /* = NULL */
     size_t                nativeHandleSize;   /* = 0 */
+    const char*           pipelineCacheFilename; /* = NULL */
 #if defined LLGL_OS_ANDROID
     android_app*          androidApp;
 #endif /* defined LLGL_OS_ANDROID */
@@ -1480,14 +1614,20 @@ LLGLComputeShaderAttributes;
 
 typedef struct LLGLSwapChainDescriptor
 {
-    const char*  debugName;   /* = NULL */
-    LLGLExtent2D resolution;
-    int          colorBits;   /* = 32 */
-    int          depthBits;   /* = 24 */
-    int          stencilBits; /* = 8 */
-    uint32_t     samples;     /* = 1 */
-    uint32_t     swapBuffers; /* = 2 */
-    bool         fullscreen;  /* = false */
+    const char*     debugName;           /* = NULL */
+    LLGLExtent2D    resolution;
+    int             colorBits;           /* = 32 */
+    int             depthBits;           /* = 24 */
+    int             stencilBits;         /* = 8 */
+    uint32_t        samples;             /* = 1 */
+    uint32_t        swapBuffers;         /* = 2 */
+    uint32_t        framesInFlight;      /* = 0 */
+    LLGLPresentMode presentMode;         /* = LLGLPresentModeDefault */
+    bool            fullscreen;          /* = false */
+    bool            lowLatency;          /* = false */
+    bool            deferredAcquire;     /* = false */
+    bool            discardDepthStencil; /* = false */
+    bool            preRotation;         /* = false */
 }
 LLGLSwapChainDescriptor;
 
@@ -1516,6 +1656,14 @@ typedef struct LLGLTextureRegion
 }
 LLGLTextureRegion;
 
+typedef struct LLGLTextureCopyRegion
+{
+    LLGLTextureLocation dstLocation;
+    LLGLTextureLocation srcLocation;
+    LLGLExtent3D        extent;
+}
+LLGLTextureCopyRegion;
+
 typedef struct LLGLTextureDescriptor
 {
     const char*     debugName;      /* = NULL */
@@ -1529,6 +1677,7 @@ typedef struct LLGLTextureDescriptor
     uint32_t        mipLevels;      /* = 0 */
     uint32_t        samples;        /* = 1 */
     LLGLClearValue  clearValue;
+    uint32_t        aliasingGroup;  /* = 0 */
 }
 LLGLTextureDescriptor;
 
@@ -1601,6 +1750,13 @@ typedef struct LLGLBlendDescriptor
 }
 LLGLBlendDescriptor;
 
+typedef struct LLGLSubpassDescriptor
+{
+    uint32_t colorAttachmentMask; /* = ~0u */
+    uint32_t inputAttachmentMask; /* = 0 */
+}
+LLGLSubpassDescriptor;
+
 typedef struct LLGLRenderPassDescriptor
 {
     const char*                    debugName;           /* = NULL */
@@ -1608,6 +1764,9 @@ typedef struct LLGLRenderPassDescriptor
     LLGLAttachmentFormatDescriptor depthAttachment;
     LLGLAttachmentFormatDescriptor stencilAttachment;
     uint32_t                       samples;             /* = 1 */
+    size_t                         numSubpasses;        /* = 0 */
+    const LLGLSubpassDescriptor*   subpasses;           /* = NULL */
+    uint32_t                       viewMask;            /* = 0 */
 }
 LLGLRenderPassDescriptor;
 
@@ -1668,6 +1827,7 @@ typedef struct LLGLPipelineLayoutDescriptor
     size_t                             numUniforms;       /* = 0 */
     const LLGLUniformDescriptor*       uniforms;          /* = NULL */
     long                               barrierFlags;      /* = 0 */
+    long                               flags;             /* = 0 */
 }
 LLGLPipelineLayoutDescriptor;
 
@@ -1676,17 +1836,23 @@ typedef struct LLGLGraphicsPipelineDescriptor
     const char*                debugName;            /* = NULL */
     LLGLPipelineLayout         pipelineLayout;       /* = LLGL_NULL_OBJECT */
     LLGLRenderPass             renderPass;           /* = LLGL_NULL_OBJECT */
+    uint32_t                   subpass;              /* = 0 */
     LLGLShader                 vertexShader;         /* = LLGL_NULL_OBJECT */
     LLGLShader                 tessControlShader;    /* = LLGL_NULL_OBJECT */
     LLGLShader                 tessEvaluationShader; /* = LLGL_NULL_OBJECT */
     LLGLShader                 geometryShader;       /* = LLGL_NULL_OBJECT */
+    LLGLShader                 taskShader;           /* = LLGL_NULL_OBJECT */
+    LLGLShader                 meshShader;           /* = LLGL_NULL_OBJECT */
     LLGLShader                 fragmentShader;       /* = LLGL_NULL_OBJECT */
     LLGLFormat                 indexFormat;          /* = LLGLFormatUndefined */
     LLGLPrimitiveTopology      primitiveTopology;    /* = LLGLPrimitiveTopologyTriangleList */
+    long                       dynamicStates;        /* = 0 */
     size_t                     numViewports;         /* = 0 */
     const LLGLViewport*        viewports;            /* = NULL */
     size_t                     numScissors;          /* = 0 */
     const LLGLScissor*         scissors;             /* = NULL */
+    size_t                     numVertexStreams;     /* = 0 */
+    const LLGLBindingSlot*     vertexStreams;        /* = NULL */
     LLGLDepthDescriptor        depth;
     LLGLStencilDescriptor      stencil;
     LLGLRasterizerDescriptor   rasterizer;
@@ -28,6 +28,8 @@ LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallback(LLGL_PFN_ReportCallback call
 LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallbackReport(LLGLReport report);
 LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallbackStd();
 LLGL_C_EXPORT void llglUnregisterLogCallback(LLGLLogHandle handle);
+LLGL_C_EXPORT void llglSetLogAsyncMode(bool enable);
+LLGL_C_EXPORT void llglFlushLog();
 
 
 #endif
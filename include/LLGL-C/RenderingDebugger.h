@@ -19,6 +19,11 @@ LLGL_C_EXPORT LLGLRenderingDebugger llglAllocRenderingDebugger();
 LLGL_C_EXPORT void llglFreeRenderingDebugger(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglSetDebuggerTimeRecording(LLGLRenderingDebugger debugger, bool enabled);
 LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerValidation(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerValidation(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerBufferOverrunDetection(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerBufferOverrunDetection(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerCapture(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames);
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile);
 
 
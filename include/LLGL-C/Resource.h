@@ -14,6 +14,9 @@
 
 
 LLGL_C_EXPORT LLGLResourceType llglGetResourceType(LLGLResource resource);
+LLGL_C_EXPORT bool llglSetResidencyPriority(LLGLResource resource, LLGLResidencyPriority priority);
+LLGL_C_EXPORT bool llglEvictResource(LLGLResource resource);
+LLGL_C_EXPORT bool llglMakeResourceResident(LLGLResource resource);
 
 
 #endif
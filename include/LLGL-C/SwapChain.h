@@ -15,14 +15,19 @@
 
 
 LLGL_C_EXPORT void llglPresent(LLGLSwapChain swapChain);
+LLGL_C_EXPORT void llglPresentWithDamage(LLGLSwapChain swapChain, uint32_t numDamageRects, const LLGLScissor* damageRects);
 LLGL_C_EXPORT uint32_t llglGetCurrentSwapIndex(LLGLSwapChain swapChain);
 LLGL_C_EXPORT uint32_t llglGetNumSwapBuffers(LLGLSwapChain swapChain);
 LLGL_C_EXPORT LLGLFormat llglGetColorFormat(LLGLSwapChain swapChain);
 LLGL_C_EXPORT LLGLFormat llglGetDepthStencilFormat(LLGLSwapChain swapChain);
 LLGL_C_EXPORT bool llglResizeBuffers(LLGLSwapChain swapChain, const LLGLExtent2D* resolution, long flags);
 LLGL_C_EXPORT bool llglSetVsyncInterval(LLGLSwapChain swapChain, uint32_t vsyncInterval);
+LLGL_C_EXPORT bool llglWaitForNextFrame(LLGLSwapChain swapChain, uint64_t timeout);
+LLGL_C_EXPORT LLGLSurfaceTransform llglGetSurfaceTransform(LLGLSwapChain swapChain);
 LLGL_C_EXPORT bool llglSwitchFullscreen(LLGLSwapChain swapChain, bool enable);
 LLGL_C_EXPORT LLGLSurface llglGetSurface(LLGLSwapChain swapChain);
+LLGL_C_EXPORT void llglDetachSurface(LLGLSwapChain swapChain);
+LLGL_C_EXPORT bool llglAttachSurface(LLGLSwapChain swapChain);
 
 
 #endif
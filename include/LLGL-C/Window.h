@@ -64,6 +64,8 @@ LLGL_C_EXPORT void llglSetWindowUserData(LLGLWindow window, void* userData);
 LLGL_C_EXPORT void* llglGetWindowUserData(LLGLWindow window);
 LLGL_C_EXPORT int llglAddWindowEventListener(LLGLWindow window, const LLGLWindowEventListener* eventListener);
 LLGL_C_EXPORT void llglRemoveWindowEventListener(LLGLWindow window, int eventListenerID);
+LLGL_C_EXPORT void llglSetWindowGlobalMotionBuffer(LLGLWindow window, uint32_t capacity);
+LLGL_C_EXPORT uint32_t llglReadWindowGlobalMotion(LLGLWindow window, uint32_t maxCount, LLGLOffset2D* outMotions LLGL_ANNOTATE(NULL));
 LLGL_C_EXPORT void llglPostWindowQuit(LLGLWindow window);
 LLGL_C_EXPORT void llglPostWindowKeyDown(LLGLWindow window, LLGLKey keyCode);
 LLGL_C_EXPORT void llglPostWindowKeyUp(LLGLWindow window, LLGLKey keyCode);
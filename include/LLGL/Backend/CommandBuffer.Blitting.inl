@@ -22,6 +22,13 @@ virtual void CopyBuffer(
     std::uint64_t                   size
 ) override final;
 
+virtual void CopyBufferRegions(
+    LLGL::Buffer&                   dstBuffer,
+    LLGL::Buffer&                   srcBuffer,
+    std::uint32_t                   numRegions,
+    const LLGL::BufferCopyRegion*   regions
+) override final;
+
 virtual void CopyBufferFromTexture(
     LLGL::Buffer&                   dstBuffer,
     std::uint64_t                   dstOffset,
@@ -38,6 +45,14 @@ virtual void FillBuffer(
     std::uint64_t                   fillSize    = LLGL_WHOLE_SIZE
 ) override final;
 
+virtual void ClearBuffer(
+    LLGL::Buffer&                   dstBuffer,
+    const LLGL::Format              format,
+    const LLGL::ClearValue&         clearValue,
+    std::uint64_t                   dstOffset   = 0,
+    std::uint64_t                   clearSize   = LLGL_WHOLE_SIZE
+) override final;
+
 virtual void CopyTexture(
     LLGL::Texture&                  dstTexture,
     const LLGL::TextureLocation&    dstLocation,
@@ -46,6 +61,13 @@ virtual void CopyTexture(
     const LLGL::Extent3D&           extent
 ) override final;
 
+virtual void CopyTextureRegions(
+    LLGL::Texture&                  dstTexture,
+    LLGL::Texture&                  srcTexture,
+    std::uint32_t                   numRegions,
+    const LLGL::TextureCopyRegion*  regions
+) override final;
+
 virtual void CopyTextureFromBuffer(
     LLGL::Texture&                  dstTexture,
     const LLGL::TextureRegion&      dstRegion,
@@ -61,6 +83,16 @@ virtual void CopyTextureFromFramebuffer(
     const LLGL::Offset2D&           srcOffset
 ) override final;
 
+virtual void ClearTexture(
+    LLGL::Texture&                  texture,
+    const LLGL::TextureSubresource& subresource,
+    const LLGL::ClearValue&         clearValue  = {}
+) override final;
+
+virtual void DiscardResource(
+    LLGL::Resource&                 resource
+) override final;
+
 virtual void GenerateMips(
     LLGL::Texture&                  texture
 ) override final;
@@ -70,6 +102,11 @@ virtual void GenerateMips(
     const LLGL::TextureSubresource& subresource
 ) override final;
 
+virtual void GenerateMips(
+    std::uint32_t                   numTextures,
+    LLGL::Texture* const *          textures
+) override final;
+
 
 
 // ================================================================================
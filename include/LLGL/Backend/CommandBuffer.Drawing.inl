@@ -57,6 +57,11 @@ virtual void DrawIndexedInstanced(
     std::uint32_t   firstInstance
 ) override final;
 
+virtual void MultiDrawIndexed(
+    std::uint32_t                               numDraws,
+    const LLGL::DrawIndexedIndirectArguments*   draws
+) override final;
+
 virtual void DrawIndirect(
     LLGL::Buffer&   buffer,
     std::uint64_t   offset
@@ -81,6 +86,37 @@ virtual void DrawIndexedIndirect(
     std::uint32_t   stride
 ) override final;
 
+virtual void DrawIndirectCount(
+    LLGL::Buffer&   argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DrawIndexedIndirectCount(
+    LLGL::Buffer&   argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DrawMeshTasks(
+    std::uint32_t   numThreadGroupsX,
+    std::uint32_t   numThreadGroupsY,
+    std::uint32_t   numThreadGroupsZ
+) override final;
+
+virtual void DrawMeshTasksIndirect(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    std::uint32_t   numCommands,
+    std::uint32_t   stride
+) override final;
+
 
 
 // ================================================================================
@@ -8,11 +8,13 @@
 /* ----- Input Assembly ------ */
 
 virtual void SetVertexBuffer(
-    LLGL::Buffer&       buffer
+    LLGL::Buffer&        buffer,
+    std::uint64_t        offset = 0
 ) override final;
 
 virtual void SetVertexBufferArray(
-    LLGL::BufferArray&  bufferArray
+    LLGL::BufferArray&   bufferArray,
+    const std::uint64_t* offsets = nullptr
 ) override final;
 
 virtual void SetIndexBuffer(
@@ -20,6 +20,34 @@ virtual void SetStencilReference(
     const LLGL::StencilFace stencilFace = LLGL::StencilFace::FrontAndBack
 ) override final;
 
+virtual void SetCullMode(
+    const LLGL::CullMode    cullMode
+) override final;
+
+virtual void SetDepthState(
+    const LLGL::DepthDescriptor&    depthDesc
+) override final;
+
+virtual void SetStencilState(
+    const LLGL::StencilDescriptor&  stencilDesc
+) override final;
+
+virtual void SetPrimitiveTopology(
+    const LLGL::PrimitiveTopology   primitiveTopology
+) override final;
+
+virtual void SetDepthBias(
+    const LLGL::DepthBiasDescriptor&    depthBiasDesc
+) override final;
+
+virtual void SetShadingRate(
+    const LLGL::ShadingRateDescriptor&  shadingRateDesc
+) override final;
+
+virtual void SetShadingRateImage(
+    LLGL::Texture*                      texture
+) override final;
+
 virtual void SetUniforms(
     std::uint32_t           first,
     const void*             data,
@@ -27,6 +27,14 @@ virtual void EndRenderCondition(
     void
 ) override final;
 
+virtual void ResolveQueryData(
+    LLGL::QueryHeap&                queryHeap,
+    std::uint32_t                   firstQuery,
+    std::uint32_t                   numQueries,
+    LLGL::Buffer&                   dstBuffer,
+    std::uint64_t                   dstOffset
+) override final;
+
 
 
 // ================================================================================
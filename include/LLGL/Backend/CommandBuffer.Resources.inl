@@ -17,6 +17,13 @@ virtual void SetResource(
     LLGL::Resource&             resource
 ) override final;
 
+virtual void SetResource(
+    std::uint32_t               descriptor,
+    LLGL::Buffer&               buffer,
+    std::uint64_t               offset,
+    std::uint64_t               size
+) override final;
+
 
 
 // ================================================================================
@@ -0,0 +1,93 @@
+/*
+ * NativeHandle.h (Null)
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_NATIVE_HANDLE_H
+#define LLGL_NULL_NATIVE_HANDLE_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace Null
+{
+
+
+//! Maximum number of virtual command opcodes the Null renderer reports counters for.
+static constexpr std::uint32_t maxNumOpcodes = 32;
+
+/**
+\brief Counters of a single virtual command opcode in the Null renderer.
+\see Profile::opcodes
+*/
+struct OpcodeProfile
+{
+    //! Null-terminated name of the opcode or null if this opcode is unused.
+    const char*     name;
+
+    //! Number of commands that have been encoded with this opcode.
+    std::uint64_t   numEncoded;
+
+    //! Number of commands that have been replayed with this opcode.
+    std::uint64_t   numExecuted;
+
+    //! Accumulated time (in nanoseconds) spent replaying commands with this opcode.
+    std::uint64_t   executionTime;
+};
+
+/**
+\brief Snapshot of the Null renderer profiling counters.
+\remarks All counters are accumulated since the render system was created, i.e. to measure a single frame, the difference of two snapshots must be taken.
+\see RendererConfigurationNull::enableProfiling
+*/
+struct Profile
+{
+    //! Number of objects that have been created by the render system, i.e. all RenderSystem::Create* functions.
+    std::uint64_t   numObjectAllocations;
+
+    //! Number of command buffers that have been encoded, i.e. the number of CommandBuffer::End calls.
+    std::uint64_t   numCommandBuffersEncoded;
+
+    //! Accumulated time (in nanoseconds) spent between CommandBuffer::Begin and CommandBuffer::End.
+    std::uint64_t   encodingTime;
+
+    //! Number of command buffers that have been replayed.
+    std::uint64_t   numCommandBuffersExecuted;
+
+    //! Accumulated time (in nanoseconds) spent replaying command buffers.
+    std::uint64_t   executionTime;
+
+    //! Counters for each virtual command opcode.
+    OpcodeProfile   opcodes[maxNumOpcodes];
+};
+
+/**
+\brief Native handle structure for the Null render system.
+\see RenderSystem::GetNativeHandle
+*/
+struct RenderSystemNativeHandle
+{
+    /**
+    \brief Snapshot of the profiling counters.
+    \remarks All counters are zero unless the render system was created with RendererConfigurationNull::enableProfiling set to true.
+    */
+    Profile profile;
+};
+
+
+} // /namespace Null
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -108,6 +108,23 @@ class LLGL_EXPORT Blob : public NonCopyable
         */
         static Blob CreateFromFile(const std::string& filename);
 
+        /**
+        \brief Creates a new Blob instance that maps the specified binary file into memory instead of reading it.
+        \param[in] filename Specifies the file that is to be mapped.
+        \return New instance of Blob that owns the memory mapping of the specified file or null if the file could not be mapped.
+        \remarks The file content is not copied. Instead, it is paged into memory when it is accessed for the first time.
+        This is the preferred way to load large shader archives and pipeline caches.
+        The file must not be modified or deleted as long as the returned blob is alive.
+        \see CreateFromFile
+        */
+        static Blob CreateFromMappedFile(const char* filename);
+
+        /**
+        \brief Creates a new Blob instance that maps the specified binary file into memory instead of reading it.
+        \see CreateFromMappedFile(const char*)
+        */
+        static Blob CreateFromMappedFile(const std::string& filename);
+
     public:
 
         //! Returns a constant pointer to the internal buffer or null if this is a default initialized blob.
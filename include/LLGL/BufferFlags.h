@@ -153,6 +153,33 @@ struct BufferViewDescriptor
     std::uint64_t   size    = LLGL_WHOLE_SIZE;
 };
 
+/**
+\brief Buffer copy region structure.
+\remarks This is used to copy multiple buffer regions with a single command.
+\see CommandBuffer::CopyBufferRegions
+*/
+struct BufferCopyRegion
+{
+    BufferCopyRegion() = default;
+
+    //! Initializes all members of the buffer copy region.
+    inline BufferCopyRegion(std::uint64_t dstOffset, std::uint64_t srcOffset, std::uint64_t size) :
+        dstOffset { dstOffset },
+        srcOffset { srcOffset },
+        size      { size      }
+    {
+    }
+
+    //! Specifies the destination offset (in bytes) at which the destination buffer is to be updated. By default 0.
+    std::uint64_t   dstOffset   = 0;
+
+    //! Specifies the source offset (in bytes) at which the source buffer is to be read from. By default 0.
+    std::uint64_t   srcOffset   = 0;
+
+    //! Specifies the size (in bytes) of the buffer region to copy. By default 0.
+    std::uint64_t   size        = 0;
+};
+
 
 /* ----- Functions ----- */
 
@@ -0,0 +1,173 @@
+/*
+ * CPUProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CPU_PROFILER_H
+#define LLGL_CPU_PROFILER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Structure of a single CPU timing scope.
+\see CPUProfiler::CollectResults
+*/
+struct CPUProfileRegion
+{
+    //! Scope name that was passed to CPUProfiler::BeginScope. The pointer is not copied.
+    const char*     name            = "";
+
+    //! Identifier of the thread this scope was recorded on. Threads are enumerated in the order they recorded their first scope, starting with 1.
+    std::uint32_t   threadID        = 0;
+
+    //! Nesting depth of this scope within its thread. Top-level scopes have a depth of 0.
+    std::uint32_t   depth           = 0;
+
+    //! CPU timer tick (see Timer::Tick) when this scope began.
+    std::uint64_t   cpuTicksStart   = 0;
+
+    //! CPU timer tick (see Timer::Tick) when this scope ended.
+    std::uint64_t   cpuTicksEnd     = 0;
+};
+
+/**
+\brief Structure of a single CPU profiling counter.
+\see CPUProfiler::CollectResults
+*/
+struct CPUProfileCounter
+{
+    //! Counter name that was passed to CPUProfiler::AddCounter. The pointer is not copied.
+    const char*     name    = "";
+
+    //! Sum of all values that were added to this counter since the last call to CPUProfiler::CollectResults.
+    std::int64_t    value   = 0;
+};
+
+/**
+\brief Namespace with functions for lightweight CPU timing scopes and counters.
+\remarks LLGL records its own hot paths with this profiler, such as command buffer encoding, command queue submission,
+resource and PSO creation, and swap-chain presentation. Applications can record their own scopes into the same timeline.
+\remarks Each thread writes into its own buffer, so recording a scope never takes a lock.
+The CPU ticks are taken from Timer::Tick, which allows to correlate them with ProfileTimeRecord::cpuTicksStart and GPU timings.
+Here is an example usage:
+\code
+LLGL::CPUProfiler::SetEnabled(true);
+while (...) {
+    {
+        LLGL::CPUProfiler::Scope scope{ "Update Scene" };
+        ...
+    }
+    myCmdQueue->Submit(*myCmdBuffer);
+    mySwapChain->Present();
+
+    LLGL::DynamicVector<LLGL::CPUProfileRegion> regions;
+    LLGL::CPUProfiler::CollectResults(regions);
+    ...
+}
+\endcode
+\see GPUProfiler
+*/
+namespace CPUProfiler
+{
+
+
+/**
+\brief Enables or disables CPU profiling for all threads. This is disabled by default.
+\remarks While disabled, BeginScope and AddCounter return immediately after a single atomic load.
+*/
+LLGL_EXPORT void SetEnabled(bool enable);
+
+//! Returns true if CPU profiling is enabled.
+LLGL_EXPORT bool IsEnabled();
+
+/**
+\brief Begins a new timing scope on the calling thread.
+\param[in] name Pointer to a null-terminated string. Only the pointer is stored, so it must be valid until the results have been collected, e.g. a string literal.
+\return True if the scope has been started. In that case, EndScope must be called on the same thread. If profiling is disabled, the return value is false.
+\remarks Prefer the Scope helper class, which calls EndScope only if the scope has been started.
+*/
+LLGL_EXPORT bool BeginScope(const char* name);
+
+//! Ends the current timing scope on the calling thread.
+LLGL_EXPORT void EndScope();
+
+/**
+\brief Records a completed timing scope on the calling thread with explicit CPU ticks.
+\param[in] name Pointer to a null-terminated string with the same requirements as for BeginScope.
+\param[in] ticksStart Specifies the CPU tick (see Timer::Tick) when the scope began.
+\param[in] ticksEnd Specifies the CPU tick (see Timer::Tick) when the scope ended.
+\remarks This is intended for scopes that span multiple function calls, such as recording a command buffer between its Begin and End functions.
+The scope is nested inside the scopes that are currently open on the calling thread.
+*/
+LLGL_EXPORT void RecordScope(const char* name, std::uint64_t ticksStart, std::uint64_t ticksEnd);
+
+/**
+\brief Adds the specified value to the counter with the specified name.
+\param[in] name Pointer to a null-terminated string. Counters are identified by this pointer, so it must be a string with static storage duration, e.g. a string literal.
+\param[in] value Specifies the value that is to be added to the counter.
+*/
+LLGL_EXPORT void AddCounter(const char* name, std::int64_t value = 1);
+
+/**
+\brief Moves all scopes and counters that have been recorded since the last call out of the thread buffers.
+\param[out] outRegions Specifies the output container for all completed scopes. They are sorted by their start tick.
+\param[out] outCounters Optional pointer to the output container for all counters. By default null.
+\remarks This can be called on any thread and does not block the recording threads.
+*/
+LLGL_EXPORT void CollectResults(DynamicVector<CPUProfileRegion>& outRegions, DynamicVector<CPUProfileCounter>* outCounters = nullptr);
+
+/**
+\brief Returns the number of scopes and counter values that have been dropped because a thread buffer was full.
+\remarks Each thread can buffer a limited number of records between two calls to CollectResults.
+*/
+LLGL_EXPORT std::uint64_t GetNumDroppedRecords();
+
+//! Helper class to record a timing scope for the lifetime of this object. This class has no virtual destructor to keep it as lightweight as possible.
+class Scope
+{
+
+    public:
+
+        Scope(const Scope&) = delete;
+        Scope& operator = (const Scope&) = delete;
+
+        //! Begins a new scope with the specified name.
+        inline explicit Scope(const char* name) :
+            active_ { BeginScope(name) }
+        {
+        }
+
+        //! Ends the scope that was started with this object.
+        inline ~Scope()
+        {
+            if (active_)
+                EndScope();
+        }
+
+    private:
+
+        bool active_ = false;
+
+};
+
+
+} // /namespace CPUProfiler
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
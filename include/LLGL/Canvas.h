@@ -66,6 +66,21 @@ class LLGL_EXPORT Canvas : public Surface
                 //! Sent when a pan gesture has been recognized. Includes X and Y deltas for movement.
                 virtual void OnPanGesture(Canvas& sender, const Offset2D& position, std::uint32_t numTouches, float dx, float dy);
 
+                /**
+                \brief Sent when the native surface of the canvas is about to be destroyed, e.g. when the app is suspended.
+                \remarks All swap-chains of this canvas must be detached with SwapChain::DetachSurface before this callback returns.
+                The render system and all other resources remain valid, so they do not have to be recreated when the app is resumed.
+                \see SwapChain::DetachSurface
+                */
+                virtual void OnDestroySurface(Canvas& sender);
+
+                /**
+                \brief Sent when a new native surface has been created for the canvas, e.g. when the app is resumed.
+                \remarks Swap-chains that have been detached in OnDestroySurface can now be reattached with SwapChain::AttachSurface.
+                \see SwapChain::AttachSurface
+                */
+                virtual void OnInitSurface(Canvas& sender);
+
         };
 
     public:
@@ -156,6 +171,18 @@ class LLGL_EXPORT Canvas : public Surface
         */
         void PostPanGesture(const Offset2D& position, std::uint32_t numTouches, float dx, float dy);
 
+        /**
+        \brief Posts a surface destruction event to all event listeners.
+        \see EventListener::OnDestroySurface
+        */
+        void PostDestroySurface();
+
+        /**
+        \brief Posts a surface initialization event to all event listeners.
+        \see EventListener::OnInitSurface
+        */
+        void PostInitSurface();
+
     protected:
 
         //! Allocates the internal data.
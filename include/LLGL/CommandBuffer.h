@@ -33,6 +33,7 @@ namespace LLGL
 
 
 class SwapChain;
+struct DrawIndexedIndirectArguments;
 
 /**
 \brief Command buffer interface used for storing and encoding GPU commands.
@@ -140,6 +141,34 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint64_t   size
         ) = 0;
 
+        /**
+        \brief Encodes a buffer copy command for multiple regions between the same two buffers.
+
+        \param[in,out] dstBuffer Specifies the destination buffer whose data is to be updated.
+
+        \param[in] srcBuffer Specifies the source buffer whose data is to be read from.
+
+        \param[in] numRegions Specifies the number of buffer regions to copy.
+
+        \param[in] regions Pointer to an array of buffer copy regions. This must point to at least \c numRegions elements.
+        Each region must satisfy the same rules as the parameters of CopyBuffer.
+
+        \remarks This is equivalent to calling CopyBuffer for each region, but the resource barriers are only issued once for all regions
+        and the regions are passed to a single native copy command where available (e.g. \c vkCmdCopyBuffer).
+        This is preferable for sparse updates such as mesh pools that would otherwise issue many small copy commands.
+
+        \remarks For performance reasons, it is recommended to encode this command outside of a render pass.
+        Otherwise, render pass interruptions might be inserted by LLGL.
+
+        \see CopyBuffer
+        */
+        virtual void CopyBufferRegions(
+            Buffer&                 dstBuffer,
+            Buffer&                 srcBuffer,
+            std::uint32_t           numRegions,
+            const BufferCopyRegion* regions
+        ) = 0;
+
         /**
         \brief Encodes a buffer copy command that blits data from a source texture.
 
@@ -212,6 +241,40 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint64_t   fillSize    = LLGL_WHOLE_SIZE
         ) = 0;
 
+        /**
+        \brief Clears a range of the specified buffer with a typed clear value.
+
+        \param[in,out] dstBuffer Specifies the destination buffer whose data is to be cleared.
+        This buffer must have been created with the binding flag BindFlags::CopyDst.
+
+        \param[in] format Specifies the format of each buffer element the clear value is converted to.
+        This \b must be an uncompressed color format (e.g. Format::RGBA32Float or Format::R32UInt).
+        The color components of \c clearValue are converted into this format, i.e. normalized formats are scaled and integer formats are truncated.
+
+        \param[in] clearValue Specifies the clear value. Only the \c color attribute is used.
+
+        \param[in] dstOffset Specifies the destination offset (in bytes) at which the buffer is to be cleared. This \b must be a multiple of the size of \c format.
+
+        \param[in] clearSize Specifies the size (in bytes) of the buffer region. This \b must be a multiple of the size of \c format and a multiple of 4.
+        If this is equal to \c LLGL_WHOLE_SIZE, \c dstOffset is ignored and the entire buffer will be cleared.
+
+        \remarks This is the typed equivalent of FillBuffer, e.g. to reset accumulation buffers for compute shaders.
+        If the converted clear value consists of a repeated 32-bit pattern (e.g. all zeros), this is equivalent to FillBuffer.
+        Otherwise, the native typed clear functions are used where available (e.g. \c ClearUnorderedAccessViewFloat or \c glClearBufferSubData)
+        and the buffer is written with the repeated pattern otherwise.
+
+        \remarks This command must be encoded outside of a render pass.
+
+        \see FillBuffer
+        */
+        virtual void ClearBuffer(
+            Buffer&             dstBuffer,
+            const Format        format,
+            const ClearValue&   clearValue,
+            std::uint64_t       dstOffset   = 0,
+            std::uint64_t       clearSize   = LLGL_WHOLE_SIZE
+        ) = 0;
+
         /**
         \brief Encodes a texture copy command for the specified texture regions.
 
@@ -240,6 +303,34 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             const Extent3D&         extent
         ) = 0;
 
+        /**
+        \brief Encodes a texture copy command for multiple regions between the same two textures.
+
+        \param[in,out] dstTexture Specifies the destination texture whose data is to be updated.
+
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+
+        \param[in] numRegions Specifies the number of texture regions to copy.
+
+        \param[in] regions Pointer to an array of texture copy regions. This must point to at least \c numRegions elements.
+        Each region must satisfy the same rules as the parameters of CopyTexture.
+
+        \remarks This is equivalent to calling CopyTexture for each region, but the resource barriers are only issued once for all regions
+        and the regions are passed to a single native copy command where available (e.g. \c vkCmdCopyImage).
+        This is preferable for sparse updates such as texture atlases that would otherwise issue many small copy commands.
+
+        \remarks For performance reasons, it is recommended to encode this command outside of a render pass.
+        Otherwise, render pass interruptions might be inserted by LLGL.
+
+        \see CopyTexture
+        */
+        virtual void CopyTextureRegions(
+            Texture&                    dstTexture,
+            Texture&                    srcTexture,
+            std::uint32_t               numRegions,
+            const TextureCopyRegion*    regions
+        ) = 0;
+
         /**
         \brief Encodes a texture copy command that blits data from a source buffer.
 
@@ -320,6 +411,50 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             const Offset2D&         srcOffset
         ) = 0;
 
+        /**
+        \brief Clears a subresource of the specified texture without a render pass.
+
+        \param[in,out] texture Specifies the texture whose subresource is to be cleared.
+        This texture must have been created with at least one of the binding flags BindFlags::ColorAttachment, BindFlags::DepthStencilAttachment, or BindFlags::Storage.
+
+        \param[in] subresource Specifies the range of MIP-map levels and array layers that are to be cleared.
+        For 3D textures, the array layers are ignored and all depth slices of each MIP-map level are cleared.
+
+        \param[in] clearValue Specifies the clear value. For color formats, only the \c color attribute is used.
+        For depth-stencil formats, only the \c depth and \c stencil attributes are used.
+
+        \remarks This allows compute pipelines to reset storage textures (e.g. accumulation buffers) without creating intermediate render targets.
+        It uses the native clear functions of each backend,
+        i.e. \c vkCmdClearColorImage, \c ClearUnorderedAccessViewFloat or \c ClearRenderTargetView, \c glClearTexSubImage, and a clearing render pass with Metal.
+
+        \remarks This command must be encoded outside of a render pass. Compressed formats are not supported.
+
+        \see Clear
+        \see ClearBuffer
+        */
+        virtual void ClearTexture(
+            Texture&                    texture,
+            const TextureSubresource&   subresource,
+            const ClearValue&           clearValue  = {}
+        ) = 0;
+
+        /**
+        \brief Discards the contents of the specified buffer or texture.
+
+        \param[in,out] resource Specifies the buffer or texture whose contents are no longer needed.
+
+        \remarks This is a hint to the driver that the resource is about to be entirely overwritten, e.g. a transient render target that is reused across passes.
+        It allows the driver to skip preserving, loading, or decompressing the previous contents.
+        Reading the resource before it has been overwritten results in undefined contents.
+        It maps to \c DiscardResource with Direct3D, \c glInvalidateTexImage and \c glInvalidateBufferData with OpenGL,
+        and an image layout transition from \c VK_IMAGE_LAYOUT_UNDEFINED with Vulkan. Backends without such a function ignore this command.
+
+        \remarks This command must be encoded outside of a render pass.
+
+        \see AttachmentLoadOp::Undefined
+        */
+        virtual void DiscardResource(Resource& resource) = 0;
+
         /**
         \brief Generates all MIP-maps for the specified texture.
 
@@ -354,6 +489,25 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void GenerateMips(Texture& texture, const TextureSubresource& subresource) = 0;
 
+        /**
+        \brief Generates all MIP-maps for each texture in the specified array.
+
+        \param[in] numTextures Specifies the number of textures in the array \c textures.
+        \param[in] textures Pointer to an array of textures whose MIP-maps are to be generated.
+        Each texture must have been created with the binding flags BindFlags::Sampled and BindFlags::ColorAttachment.
+        Null pointers are not allowed in this array.
+
+        \remarks This is equivalent to calling GenerateMips(Texture&) for each texture, but the backend can group the textures by type and format
+        to bind each MIP-map generation pipeline only once and to batch all resource barriers, which is significantly faster for many textures,
+        e.g. when a level is loaded.
+
+        \remarks For performance reasons, it is recommended to encode this command outside of a render pass.
+        Otherwise, render pass interruptions might be inserted by LLGL.
+
+        \see GenerateMips(Texture&)
+        */
+        virtual void GenerateMips(std::uint32_t numTextures, Texture* const * textures) = 0;
+
         /* ----- Viewport and Scissor ----- */
 
         /**
@@ -399,19 +553,26 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         /**
         \brief Sets the specified vertex buffer for subsequent drawing operations.
         \param[in] buffer Specifies the vertex buffer to set. This buffer must have been created with the binding flag BindFlags::VertexBuffer and its content <b>must not</b> be uninitialized.
+        \param[in] offset Specifies an optional offset (in bytes) where to start reading the vertex buffer. By default 0.
+        This allows many meshes to be stored in a single buffer, e.g. with slices of a BufferSuballocator.
+        The offset must be a multiple of 4 and smaller than the buffer size.
+        \remarks Vertex buffer offsets are not supported with the OpenGL 2.x compatibility layer.
         \see RenderSystem::CreateBuffer
         \see RenderSystem::WriteBuffer
         \see SetVertexBufferArray
+        \see BufferSuballocator
         */
-        virtual void SetVertexBuffer(Buffer& buffer) = 0;
+        virtual void SetVertexBuffer(Buffer& buffer, std::uint64_t offset = 0) = 0;
 
         /**
         \brief Sets the specified array of vertex buffers for subsequent drawing operations.
         \param[in] bufferArray Specifies the vertex buffer array to set.
+        \param[in] offsets Optional pointer to an array of offsets (in bytes) where to start reading each vertex buffer. By default null.
+        If this is not null, it must point to as many offsets as there are buffers in the array. Each offset must be a multiple of 4 and smaller than the size of its buffer.
         \see RenderSystem::CreateBufferArray
         \see SetVertexBuffer
         */
-        virtual void SetVertexBufferArray(BufferArray& bufferArray) = 0;
+        virtual void SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets = nullptr) = 0;
 
         /**
         \brief Sets the active index buffer for subsequent drawing operations.
@@ -460,6 +621,23 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetResource(std::uint32_t descriptor, Resource& resource) = 0;
 
+        /**
+        \brief Binds a range of the specified buffer as root parameter to the respective pipeline.
+        \param[in] descriptor Specifies the zero-based index of the descriptor in the currently bound pipeline layout.
+        This \b must be in the half-open range <code>[0, PipelineLayout::GetNumBindings)</code>.
+        \param[in] buffer Specifies the buffer whose range is to be bound to the shader pipeline.
+        \param[in] offset Specifies the offset (in bytes) of the buffer range.
+        This \b must be a multiple of RenderingLimits::minConstantBufferAlignment for constant buffers
+        and a multiple of RenderingLimits::minStorageBufferAlignment for storage buffers.
+        \param[in] size Specifies the size (in bytes) of the buffer range. If this is \c LLGL_WHOLE_SIZE, the range extends to the end of the buffer.
+        \remarks This allows a single large buffer, e.g. with all per-object constants of a frame, to serve many draw calls with only a change of the offset in between.
+        \remarks Ranges are supported for constant buffers on all backends and for sampled and storage buffers on all backends except Direct3D 11.
+        Direct3D 11 binds constant buffer ranges in units of 256 bytes and requires Direct3D 11.1 for offsets other than zero.
+        \see SetResource(std::uint32_t, Resource&)
+        \see RenderingLimits::minConstantBufferAlignment
+        */
+        virtual void SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) = 0;
+
         //! \deprecated Since 0.04b; No need to reset resource slots manually anymore!
         LLGL_DEPRECATED("CommandBuffer::ResetResourceSlots is deprecated since 0.04b; No need to reset resource slots manually anymore!")
         virtual void ResetResourceSlots(
@@ -561,6 +739,16 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void EndRenderPass() = 0;
 
+        /**
+        \brief Advances to the next subpass of the current render pass.
+        \remarks This must be called between BeginRenderPass and EndRenderPass
+        and the number of calls must be less than the number of subpasses of the current render pass.
+        Graphics pipelines must be bound again after this call, since pipelines are created for a specific subpass.
+        \see RenderPassDescriptor::subpasses
+        \see GraphicsPipelineDescriptor::subpass
+        */
+        virtual void NextSubpass() = 0;
+
         /**
         \brief Clears the specified group of attachments of the active render target.
 
@@ -655,6 +843,76 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetStencilReference(std::uint32_t reference, const StencilFace stencilFace = StencilFace::FrontAndBack) = 0;
 
+        /**
+        \brief Sets the dynamic pipeline state for the cull mode.
+        \param[in] cullMode Specifies which polygon faces are culled.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::CullMode. Otherwise, the behavior is undefined.
+        \see GraphicsPipelineDescriptor::dynamicStates
+        \see RasterizerDescriptor::cullMode
+        */
+        virtual void SetCullMode(const CullMode cullMode) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the depth test, depth write mask, and depth compare operation.
+        \param[in] depthDesc Specifies the new depth states.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::DepthState. Otherwise, the behavior is undefined.
+        \see GraphicsPipelineDescriptor::dynamicStates
+        \see GraphicsPipelineDescriptor::depth
+        */
+        virtual void SetDepthState(const DepthDescriptor& depthDesc) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the stencil test, stencil operations, compare operations, and stencil masks.
+        \param[in] stencilDesc Specifies the new stencil states. The members \c referenceDynamic and \c reference are ignored, since stencil reference values are either static or set with SetStencilReference.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::StencilState. Otherwise, the behavior is undefined.
+        \see GraphicsPipelineDescriptor::dynamicStates
+        \see GraphicsPipelineDescriptor::stencil
+        */
+        virtual void SetStencilState(const StencilDescriptor& stencilDesc) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the primitive topology.
+        \param[in] primitiveTopology Specifies the new primitive topology.
+        This must be of the same primitive class (i.e. points, lines, triangles, or patches with the same number of control points)
+        as the primitive topology the currently bound graphics pipeline state was created with.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::PrimitiveTopology. Otherwise, the behavior is undefined.
+        \see GraphicsPipelineDescriptor::dynamicStates
+        \see GraphicsPipelineDescriptor::primitiveTopology
+        */
+        virtual void SetPrimitiveTopology(const PrimitiveTopology primitiveTopology) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the depth bias.
+        \param[in] depthBiasDesc Specifies the new depth bias.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::DepthBias. Otherwise, the behavior is undefined.
+        \see GraphicsPipelineDescriptor::dynamicStates
+        \see RasterizerDescriptor::depthBias
+        */
+        virtual void SetDepthBias(const DepthBiasDescriptor& depthBiasDesc) = 0;
+
+        /**
+        \brief Sets the shading rate and shading rate combiners for variable rate shading (VRS).
+        \param[in] shadingRateDesc Specifies the per-draw shading rate and how it is combined with the per-primitive shading rate and the shading-rate image.
+        \remarks The shading rate is independent of the bound pipeline state and remains until it is changed or the command buffer is ended.
+        At the beginning of each command buffer, the shading rate is ShadingRate::Rate1x1 with all combiners set to ShadingRateCombiner::Passthrough.
+        This has no effect if RenderingFeatures::hasVariableRateShading is false.
+        \see RenderingFeatures::hasVariableRateShading
+        */
+        virtual void SetShadingRate(const ShadingRateDescriptor& shadingRateDesc) = 0;
+
+        /**
+        \brief Sets the screen-space shading-rate image for variable rate shading (VRS).
+        \param[in] texture Pointer to a 2D texture of format Format::R8UInt or null to unbind the current shading-rate image.
+        Each texel specifies the shading rate for a tile of RenderingLimits::shadingRateImageTileSize pixels in each dimension.
+        The texel values are <code>(log2(W) << 2) | log2(H)</code>, where \c W and \c H are the width and height of the shading rate, e.g. \c 0x5 for 2x2.
+        \remarks The texture is only considered if ShadingRateDescriptor::imageCombiner is not ShadingRateCombiner::Passthrough.
+        It must not be bound as a render target or storage resource while it is used as shading-rate image.
+        This has no effect if RenderingFeatures::hasShadingRateImage is false.
+        \see RenderingFeatures::hasShadingRateImage
+        \see SetShadingRate
+        */
+        virtual void SetShadingRateImage(Texture* texture) = 0;
+
         /**
         \brief Sets the value of a certain number of shader uniforms (aka. push constant/ shader constants) in the currently bound PSO.
 
@@ -733,6 +991,39 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void EndRenderCondition() = 0;
 
+        /**
+        \brief Resolves the results of a range of queries into a buffer on the GPU timeline.
+
+        \param[in] queryHeap Specifies the query heap whose results are to be resolved.
+
+        \param[in] firstQuery Specifies the zero-based index of the first query within the heap.
+
+        \param[in] numQueries Specifies the number of queries to resolve.
+        The range <code>[firstQuery, firstQuery + numQueries)</code> must be within the half-open range <code>[0, QueryHeapDescriptor::numQueries)</code>.
+
+        \param[in] dstBuffer Specifies the destination buffer. This must have been created with the BindFlags::CopyDst binding flag.
+
+        \param[in] dstOffset Specifies the destination offset (in bytes). This must be a multiple of 8.
+
+        \remarks Unlike CommandQueue::QueryResult, this does not read the results back to the CPU.
+        The results can instead be consumed by subsequent GPU commands (such as indirect draw arguments or shaders),
+        or the destination buffer can be read back asynchronously once the command buffer has completed.
+        Each query result is written as unsigned 64-bit integers in native byte order:
+        - Occlusion and stream-output queries write a single value per query.
+        - QueryType::PipelineStatistics writes one QueryPipelineStatistics structure per query.
+        - QueryType::TimeElapsed writes a pair of begin and end timestamps per query, whose difference is the elapsed time in GPU timestamp ticks.
+        \remarks This must be called outside of a render pass and after the respective queries have ended.
+        \see RenderingFeatures::hasQueryResolve
+        \see CommandQueue::QueryResult
+        */
+        virtual void ResolveQueryData(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset
+        ) = 0;
+
         /* ----- Stream Output ------ */
 
         /**
@@ -838,6 +1129,27 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) = 0;
 
+        /**
+        \brief Draws a list of indexed and instanced primitives whose arguments are taken from CPU memory.
+
+        \param[in] numDraws Specifies the number of draw commands.
+        \param[in] draws Pointer to an array of draw command arguments. This must point to at least \c numDraws elements.
+
+        \remarks This is equivalent to the following loop, but the pipeline state and resource bindings are flushed only once for the entire list:
+        \code
+        for (std::uint32_t i = 0; i < numDraws; ++i)
+            DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+        \endcode
+        \remarks For the Vulkan backend, consecutive draws with the same number of instances and the same first instance
+        are recorded as a single native multi draw command if the extension \c VK_EXT_multi_draw is supported.
+        For deferred OpenGL command buffers, consecutive non-instanced draws (i.e. one instance and a first instance of zero) are merged into \c glMultiDrawElementsBaseVertex.
+
+        \see DrawIndexedIndirectArguments
+        \see DrawIndexedInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::int32_t, std::uint32_t)
+        \see RenderingFeatures::hasOffsetInstancing
+        */
+        virtual void MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws) = 0;
+
         /**
         \brief Draws an unknown amount of instances of primitives whose draw command arguments are taken from a buffer object.
         \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
@@ -902,6 +1214,75 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws multiple sets of primitives whose draw command arguments and number of draw commands are taken from buffer objects.
+
+        \param[in] argumentsBuffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] argumentsOffset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as a single 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The number of draw commands that are taken from \c countBuffer is clamped to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows the GPU to determine the number of draw commands, e.g. by a compute shader that performs culling, without reading it back to the CPU.
+        This is natively supported by Direct3D 12 (\c ExecuteIndirect), Vulkan (\c vkCmdDrawIndirectCount) and OpenGL (\c glMultiDrawArraysIndirectCount).
+
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawingCount
+        */
+        virtual void DrawIndirectCount(
+            Buffer&         argumentsBuffer,
+            std::uint64_t   argumentsOffset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws multiple sets of primitives whose indexed draw command arguments and number of draw commands are taken from buffer objects.
+        \remarks This is equivalent to DrawIndirectCount, except that the arguments are read as DrawIndexedIndirectArguments.
+        \see DrawIndirectCount
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawingCount
+        */
+        virtual void DrawIndexedIndirectCount(
+            Buffer&         argumentsBuffer,
+            std::uint64_t   argumentsOffset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws primitives that are generated by the task and mesh shaders of the current graphics pipeline.
+        \param[in] numThreadGroupsX Specifies the number of thread groups in the X-dimension.
+        \param[in] numThreadGroupsY Specifies the number of thread groups in the Y-dimension.
+        \param[in] numThreadGroupsZ Specifies the number of thread groups in the Z-dimension.
+        \remarks The thread groups are launched for the task shader or, if the pipeline has no task shader, directly for the mesh shader.
+        The bound graphics pipeline must have been created with a mesh shader and no vertex input.
+        \see GraphicsPipelineDescriptor::meshShader
+        \see RenderingFeatures::hasMeshShaders
+        \see RenderingLimits::maxMeshShaderWorkGroups
+        */
+        virtual void DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ) = 0;
+
+        /**
+        \brief Draws primitives that are generated by the task and mesh shaders with an unknown amount of thread groups.
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands that are to be taken from the argument buffer.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawMeshTasksIndirectArguments)</code>. This stride must be a multiple of 4.
+        \remarks Multiple draw commands are only natively supported by Vulkan and Direct3D 12. For Metal, they are emulated with a simple loop.
+        \see DrawMeshTasksIndirectArguments
+        \see RenderingFeatures::hasMeshShaders
+        */
+        virtual void DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
+
         /* ----- Compute ----- */
 
         /**
@@ -60,6 +60,30 @@ enum class StencilFace
     Back,
 };
 
+/**
+\brief Command queue type enumeration.
+\remarks Backends that only provide a single command queue return the same queue for all types.
+\see CommandBufferDescriptor::queueType
+\see RenderSystem::GetCommandQueue(CommandQueueType)
+*/
+enum class CommandQueueType
+{
+    //! Graphics queue that supports all commands. This is the default queue returned by RenderSystem::GetCommandQueue.
+    Graphics,
+
+    /**
+    \brief Compute queue that only supports compute and copy commands.
+    \note Only supported with: Direct3D 12, Metal, Vulkan (see RendererConfigurationVulkan::asyncComputeQueue). Other backends use the graphics queue.
+    */
+    Compute,
+
+    /**
+    \brief Copy queue that only supports copy commands.
+    \note Only supported with: Direct3D 12, Metal. Other backends use the graphics queue.
+    */
+    Copy,
+};
+
 
 /* ----- Flags ----- */
 
@@ -82,7 +106,7 @@ struct CommandBufferFlags
         Here is a list of commands that can be encoded with a secondary command buffer (\c Begin/\c End is implied):
         - Setting vertex- and index buffers (CommandBuffer::SetVertexBuffer, CommandBuffer::SetVertexBufferArray, and CommandBuffer::SetIndexBuffer)
         - Setting resources (CommandBuffer::SetResourceHeap and CommandBuffer::SetResource)
-        - Setting pipeline states (CommandBuffer::SetPipelineState, CommandBuffer::SetBlendFactor, CommandBuffer::SetStencilReference, and CommandBuffer::SetUniforms)
+        - Setting pipeline states (CommandBuffer::SetPipelineState, CommandBuffer::SetBlendFactor, CommandBuffer::SetStencilReference, CommandBuffer::SetUniforms, and the dynamic pipeline state setters such as CommandBuffer::SetCullMode)
         - Draw commands (CommandBuffer::Draw, CommandBuffer::DrawIndexed, CommandBuffer::DrawInstanced, CommandBuffer::DrawIndexedInstanced, CommandBuffer::DrawIndirect, and CommandBuffer::DrawIndexedIndirect)
         - Compute commands (CommandBuffer::Dispatch, CommandBuffer::DispatchIndirect)
         \see CommandBuffer::Execute
@@ -106,6 +130,19 @@ struct CommandBufferFlags
         \see CommandBuffer::End
         */
         ImmediateSubmit = (1 << 2),
+
+        /**
+        \brief Specifies that the command buffer is transient, i.e. it is encoded and submitted at most a few times within a single frame.
+        \remarks This is a hint for backends that allocate native command buffers from command pools, such as Vulkan.
+        For such backends, the native command buffer is acquired from a command pool of the encoding thread each time the command buffer is encoded,
+        and all command pools of a frame are recycled at once when the same frame is encoded again, after it has completed on the GPU.
+        This avoids creating and destroying native command buffers on the hot path, e.g. for secondary command buffers that are encoded per job and frame.
+        \remarks A transient command buffer must be encoded by a single thread between CommandBuffer::Begin and CommandBuffer::End
+        and it must be submitted before the next frame is presented via SwapChain::Present.
+        \note Only supported with: Vulkan.
+        \see SwapChain::Present
+        */
+        Transient       = (1 << 3),
     };
 };
 
@@ -297,7 +334,10 @@ struct CommandBufferDescriptor
     /**
     \brief Specifies the minimum size (in bytes) for the staging pool (if supported). By default 65536 (or <tt>0xFFFF + 1</tt>).
     \remarks This is only a hint to the framework, since not all rendering APIs support command buffers natively.
-    For the D3D12 backend for instance, this will specify the initial buffer size for the staging pool, i.e. for buffer updates during command encoding.
+    For the D3D12 backend for instance, this will specify the initial size of the upload ring buffer for buffer updates during command encoding,
+    which is shared by all native command buffers of this command buffer and only grows if the updates of all in-flight native command buffers exceed its size.
+    For the Vulkan backend, this specifies the chunk size of the persistently mapped staging pool of each native command buffer,
+    which is recycled once the GPU has finished executing that native command buffer.
     For command buffers that will make many and large buffer updates, increase this size to fine-tune performance.
     \see CommandBuffer::UpdateBuffer
     */
@@ -313,6 +353,16 @@ struct CommandBufferDescriptor
     \see CommandBufferFlags::Secondary
     */
     const RenderPass*   renderPass          = nullptr;
+
+    /**
+    \brief Specifies the type of command queue this command buffer will be submitted to. By default CommandQueueType::Graphics.
+    \remarks Command buffers for the compute or copy queue must only encode commands that are supported by that queue type,
+    and they must be submitted to the command queue returned by RenderSystem::GetCommandQueue(CommandQueueType) for the same type.
+    Dependencies between queues must be synchronized with a Fence via CommandQueue::Submit(Fence&) and CommandQueue::SubmitWait.
+    This is ignored by backends that only provide a single command queue.
+    \see RenderSystem::GetCommandQueue(CommandQueueType)
+    */
+    CommandQueueType    queueType           = CommandQueueType::Graphics;
 };
 
 
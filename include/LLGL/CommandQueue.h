@@ -96,11 +96,35 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
             std::size_t     dataSize
         ) = 0;
 
+        /**
+        \brief Samples a GPU timestamp of this command queue together with a CPU timer tick.
+        \param[out] outCalibration Specifies the output structure for the calibrated timestamps.
+        \return True if the timestamps have been sampled. Otherwise, calibrated timestamps are not supported and the output is left unchanged.
+        \remarks Use this to correlate GPU timestamps with CPU events, e.g. to place GPU work on the same timeline as command queue submissions.
+        The GPU and CPU clocks can drift apart over time, so this should be called again periodically, e.g. once per frame.
+        \remarks This is implemented with \c ID3D12CommandQueue::GetClockCalibration for Direct3D 12,
+        \c VK_EXT_calibrated_timestamps for Vulkan, <code>MTLDevice::sampleTimestamps:gpuTimestamp:</code> for Metal, and \c GL_TIMESTAMP for OpenGL.
+        \note Only supported with: OpenGL, Vulkan, Direct3D 12, Metal.
+        \see TimestampCalibration
+        */
+        virtual bool QueryTimestampCalibration(TimestampCalibration& outCalibration);
+
         /* ----- Fences ----- */
 
         //! Submits the specified fence to the command queue for CPU/GPU synchronization.
         virtual void Submit(Fence& fence) = 0;
 
+        /**
+        \brief Submits a GPU-side wait for the specified fence to the command queue.
+        \param[in] fence Specifies the fence that has previously been submitted to another command queue.
+        All work that is subsequently submitted to this command queue will not begin execution on the GPU until that fence has been signaled.
+        \remarks This does not block the CPU execution. Use this to synchronize work between command queues of different types.
+        Backends that only provide a single command queue ignore this call, since all work is already executed in order.
+        \see RenderSystem::GetCommandQueue(CommandQueueType)
+        \see WaitFence
+        */
+        virtual void SubmitWait(Fence& fence);
+
         /**
         \brief Blocks the CPU execution until the specified fence has been signaled.
         \param[in] fence Specifies the fence for which the CPU needs to wait to be signaled.
@@ -123,6 +147,23 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void WaitIdle() = 0;
 
+        /* ----- Sparse resources ----- */
+
+        /**
+        \brief Commits or releases device memory for tiles of the specified sparse texture.
+        \param[in] texture Specifies the texture whose tiles are to be mapped. This must have been created with MiscFlags::Sparse.
+        \param[in] numMappings Specifies the number of tile mappings.
+        \param[in] mappings Pointer to an array of \c numMappings tile mappings.
+        \return True if the tile mappings have been submitted to the command queue. Otherwise, the tile mappings are not supported.
+        \remarks Device memory for the tiles is allocated from a memory pool that is managed by the backend.
+        The tile mappings are executed in submission order with the command buffers of this command queue,
+        i.e. command buffers that are submitted after this call can access the newly committed tiles.
+        \remarks Releasing tiles that are still in use by the GPU results in undefined behavior.
+        \see Texture::GetSparseProperties
+        \see RenderingFeatures::hasSparseTextures
+        */
+        virtual bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings);
+
     protected:
 
         CommandQueue() = default;
@@ -28,6 +28,9 @@
 //! Maximum number of stream-output buffers.
 #define LLGL_MAX_NUM_SO_BUFFERS             ( 4u )
 
+//! Maximum number of memory heaps that can be reported by RenderSystem::QueryMemoryInfo. This matches \c VK_MAX_MEMORY_HEAPS.
+#define LLGL_MAX_NUM_MEMORY_HEAPS           ( 16u )
+
 /**
 \brief Indicates to use the maximum number of threads the host system supports.
 \remarks This value does not itself specifiy the maximum number, but tells the associated functions to use the maximum number.
@@ -14,6 +14,7 @@
 #include <LLGL/Container/AlignedArray.h>
 #include <memory>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 #include <algorithm>
@@ -122,6 +123,12 @@ class LLGL_EXPORT SmallVector
         static_assert(std::is_copy_assignable<T>::value, "SmallVector<T>: T must be copy assignable");
         static_assert(std::is_copy_constructible<T>::value, "SmallVector<T>: T must be copy constructible");
 
+        /*
+        Trivially copyable elements are relocated with memcpy/memmove instead of being copy constructed and destroyed one by one.
+        This is the common case for the backend bookkeeping containers that hold native descriptor and barrier structures.
+        */
+        static constexpr bool is_trivially_relocatable = std::is_trivially_copyable<T>::value;
+
     public:
 
         using value_type                = T;
@@ -390,6 +397,22 @@ class LLGL_EXPORT SmallVector
             ++size_;
         }
 
+        /**
+        \brief Appends the specified number of elements at the end of this vector without initializing them.
+        \param[in] count Specifies the number of new elements.
+        \return Iterator to the first new element. All new elements must be written before they are read.
+        \remarks This is only available for trivially copyable types. It allows filling many elements in place,
+        e.g. with a single \c memcpy, without a separate initialization pass or a capacity check per element.
+        */
+        constexpr iterator append_uninitialized(size_type count)
+        {
+            static_assert(is_trivially_relocatable, "SmallVector<T>::append_uninitialized: T must be trivially copyable");
+            reserve(size() + count);
+            iterator first = end();
+            size_ += count;
+            return first;
+        }
+
         constexpr void pop_back()
         {
             if (size_ > 0)
@@ -463,9 +486,9 @@ class LLGL_EXPORT SmallVector
                 {
                     /* Destroy range, move tail backwards, and reduce container size */
                     destroy_range(const_cast<iterator>(from), const_cast<iterator>(to));
-                    move_tail(const_cast<iterator>(from), to, end());
+                    move_tail(const_cast<iterator>(from), const_cast<iterator>(to), end());
                     size_ -= count;
-                    return const_cast<iterator>(to);
+                    return const_cast<iterator>(from);
                 }
             }
             return end();
@@ -660,9 +683,12 @@ class LLGL_EXPORT SmallVector
 
         constexpr void destroy_range(iterator from, iterator to)
         {
-            Allocator alloc;
-            for (; from != to; ++from)
-                std::allocator_traits<Allocator>::destroy(alloc, from);
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                Allocator alloc;
+                for (; from != to; ++from)
+                    std::allocator_traits<Allocator>::destroy(alloc, from);
+            }
         }
 
         template <typename... TArgs>
@@ -676,9 +702,18 @@ class LLGL_EXPORT SmallVector
         template <typename InputIter>
         constexpr void construct_range(iterator pos, InputIter from, InputIter to)
         {
-            Allocator alloc;
-            for (pointer p = pos; from != to; ++from, ++p)
-                std::allocator_traits<Allocator>::construct(alloc, p, *from);
+            if constexpr (is_trivially_relocatable && std::is_pointer<InputIter>::value && std::is_same<typename std::remove_cv<typename std::remove_pointer<InputIter>::type>::type, T>::value)
+            {
+                /* Copy contiguous range of trivially copyable elements at once */
+                if (from != to)
+                    std::memcpy(pos, from, sizeof(T) * static_cast<size_type>(to - from));
+            }
+            else
+            {
+                Allocator alloc;
+                for (pointer p = pos; from != to; ++from, ++p)
+                    std::allocator_traits<Allocator>::construct(alloc, p, *from);
+            }
         }
 
         template <typename InputIter>
@@ -778,7 +813,13 @@ class LLGL_EXPORT SmallVector
 
         constexpr void move_tail(iterator dst, iterator from, iterator to)
         {
-            if (dst < from)
+            if constexpr (is_trivially_relocatable)
+            {
+                /* Source and destination ranges may overlap */
+                if (dst != from && from != to)
+                    std::memmove(dst, from, sizeof(T) * static_cast<size_type>(std::distance(from, to)));
+            }
+            else if (dst < from)
                 move_tail_left(dst, from, to);
             else if (dst > from)
                 move_tail_right(dst, from, to);
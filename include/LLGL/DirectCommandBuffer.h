@@ -0,0 +1,89 @@
+/*
+ * DirectCommandBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DIRECT_COMMAND_BUFFER_H
+#define LLGL_DIRECT_COMMAND_BUFFER_H
+
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+
+#include <LLGL/CommandBuffer.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Namespace with non-virtual command buffer functions for the most frequently used commands.
+\remarks These functions are only available if LLGL was built with \c LLGL_BUILD_STATIC_LIB, \c LLGL_ENABLE_DIRECT_BACKEND_CALLS,
+and only one of the Null, Vulkan, Direct3D 11, or Direct3D 12 backends. The debug layer cannot be used in this configuration.
+\remarks Each function forwards its call to the final command buffer class of that backend without a virtual function call,
+so the compiler (or the linker with link-time optimization) can inline the backend implementation into the application.
+The behavior is the same as calling the respective CommandBuffer member function.
+\see CommandBuffer
+*/
+namespace Direct
+{
+
+
+//! \see CommandBuffer::SetViewport
+LLGL_EXPORT void SetViewport(CommandBuffer& cmdBuffer, const Viewport& viewport);
+
+//! \see CommandBuffer::SetScissor
+LLGL_EXPORT void SetScissor(CommandBuffer& cmdBuffer, const Scissor& scissor);
+
+//! \see CommandBuffer::SetVertexBuffer
+LLGL_EXPORT void SetVertexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer, std::uint64_t offset = 0);
+
+//! \see CommandBuffer::SetIndexBuffer(Buffer&)
+LLGL_EXPORT void SetIndexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer);
+
+//! \see CommandBuffer::SetIndexBuffer(Buffer&, const Format, std::uint64_t)
+LLGL_EXPORT void SetIndexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer, const Format format, std::uint64_t offset = 0);
+
+//! \see CommandBuffer::SetResourceHeap
+LLGL_EXPORT void SetResourceHeap(CommandBuffer& cmdBuffer, ResourceHeap& resourceHeap, std::uint32_t descriptorSet = 0);
+
+//! \see CommandBuffer::SetResource(std::uint32_t, Resource&)
+LLGL_EXPORT void SetResource(CommandBuffer& cmdBuffer, std::uint32_t descriptor, Resource& resource);
+
+//! \see CommandBuffer::SetPipelineState
+LLGL_EXPORT void SetPipelineState(CommandBuffer& cmdBuffer, PipelineState& pipelineState);
+
+//! \see CommandBuffer::SetUniforms
+LLGL_EXPORT void SetUniforms(CommandBuffer& cmdBuffer, std::uint32_t first, const void* data, std::uint16_t dataSize);
+
+//! \see CommandBuffer::Draw
+LLGL_EXPORT void Draw(CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex);
+
+//! \see CommandBuffer::DrawIndexed(std::uint32_t, std::uint32_t, std::int32_t)
+LLGL_EXPORT void DrawIndexed(CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset = 0);
+
+//! \see CommandBuffer::DrawInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t)
+LLGL_EXPORT void DrawInstanced(CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance = 0);
+
+//! \see CommandBuffer::DrawIndexedInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::int32_t, std::uint32_t)
+LLGL_EXPORT void DrawIndexedInstanced(CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset = 0, std::uint32_t firstInstance = 0);
+
+//! \see CommandBuffer::Dispatch
+LLGL_EXPORT void Dispatch(CommandBuffer& cmdBuffer, std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ);
+
+
+} // /namespace Direct
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#endif
+
+
+
+// ================================================================================
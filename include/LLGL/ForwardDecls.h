@@ -80,6 +80,8 @@ struct Scissor;
 struct ShaderDescriptor;
 struct ShaderReflection;
 struct ShaderResourceReflection;
+struct SparseTextureMapping;
+struct SparseTextureProperties;
 struct StaticSamplerDescriptor;
 struct StencilDescriptor;
 struct StencilFaceDescriptor;
@@ -87,6 +89,7 @@ struct SwapChainDescriptor;
 struct TextureDescriptor;
 struct TextureRegion;
 struct TextureViewDescriptor;
+struct TimestampCalibration;
 struct UniformDescriptor;
 struct VertexAttribute;
 struct VertexFormat;
@@ -0,0 +1,177 @@
+/*
+ * GPUProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GPU_PROFILER_H
+#define LLGL_GPU_PROFILER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief GPU profiler descriptor structure.
+\see GPUProfiler::GPUProfiler
+*/
+struct GPUProfilerDescriptor
+{
+    /**
+    \brief Number of frames the results are delayed by. By default 3.
+    \remarks The query results of a frame are resolved when the same frame slot is reused, i.e. \c numFramesInFlight frames later.
+    This must be large enough for the GPU to finish the frame, otherwise the results of that frame are dropped instead of stalling the CPU.
+    */
+    std::uint32_t numFramesInFlight     = 3;
+
+    /**
+    \brief Maximum number of regions that can be recorded per frame. By default 256.
+    \remarks Regions that exceed this limit are silently ignored.
+    */
+    std::uint32_t maxRegionsPerFrame    = 256;
+};
+
+/**
+\brief Structure of a single resolved region of the GPU profiler.
+\see GPUProfiler::GetResults
+*/
+struct GPUProfileRegion
+{
+    //! Region name that was passed to GPUProfiler::BeginRegion. The pointer is not copied.
+    const char*     name        = "";
+
+    //! Nesting depth of this region. Top-level regions have a depth of 0.
+    std::uint32_t   depth       = 0;
+
+    //! Index of the parent region within the same list of results or \c invalidIndex for top-level regions.
+    std::uint32_t   parent      = ~0u;
+
+    //! Elapsed GPU time (in nanoseconds) between the begin and end of this region.
+    std::uint64_t   elapsedTime = 0;
+};
+
+/**
+\brief Low-overhead GPU profiler for hierarchical timing regions.
+\remarks This profiler is independent of the debug layer and records timestamp queries (QueryType::TimeElapsed) directly into the command buffers.
+Results are collected \c numFramesInFlight frames later without waiting on the GPU, which makes it suitable for always-on telemetry in release builds.
+Here is an example usage:
+\code
+LLGL::GPUProfiler profiler{ *myRenderer };
+while (...) {
+    profiler.NextFrame();
+    myCmdBuffer->Begin();
+    {
+        LLGL::GPUProfiler::Scope scope{ profiler, *myCmdBuffer, "Shadow Pass" };
+        ...
+    }
+    myCmdBuffer->End();
+    myCmdQueue->Submit(*myCmdBuffer);
+    mySwapChain->Present();
+
+    LLGL::DynamicVector<LLGL::GPUProfileRegion> regions;
+    if (profiler.GetResults(regions)) {
+        ...
+    }
+}
+\endcode
+\note Backends without support for QueryType::TimeElapsed (e.g. Metal) leave the profiler inactive, see IsSupported.
+\see RenderingDebugger for the debug layer profiler.
+*/
+class LLGL_EXPORT GPUProfiler : public NonCopyable
+{
+
+    public:
+
+        //! Special value for GPUProfileRegion::parent if a region has no parent.
+        static constexpr std::uint32_t invalidIndex = ~0u;
+
+        //! Helper class to record a region for the lifetime of this object.
+        class Scope : public NonCopyable
+        {
+
+            public:
+
+                //! Begins a new region with the specified name.
+                inline Scope(GPUProfiler& profiler, CommandBuffer& commandBuffer, const char* name) :
+                    profiler_      { profiler      },
+                    commandBuffer_ { commandBuffer }
+                {
+                    profiler_.BeginRegion(commandBuffer_, name);
+                }
+
+                //! Ends the region that was started with this scope.
+                inline ~Scope()
+                {
+                    profiler_.EndRegion(commandBuffer_);
+                }
+
+            private:
+
+                GPUProfiler&    profiler_;
+                CommandBuffer&  commandBuffer_;
+
+        };
+
+    public:
+
+        //! Creates the query heaps for all frames in flight with the specified render system.
+        GPUProfiler(RenderSystem& renderSystem, const GPUProfilerDescriptor& profilerDesc = {});
+
+        //! Releases all query heaps.
+        ~GPUProfiler();
+
+        //! Returns true if the render system supports the timer queries this profiler depends on.
+        bool IsSupported() const;
+
+        /**
+        \brief Advances to the next frame slot.
+        \remarks This should be called once per frame before any region is recorded.
+        The oldest pending frame is resolved if all of its results are available, otherwise its results are dropped.
+        This never waits for the GPU.
+        */
+        void NextFrame();
+
+        /**
+        \brief Begins a new timing region in the specified command buffer.
+        \param[in] name Pointer to a null-terminated string. Only the pointer is stored, so it must be valid until the results have been queried.
+        \remarks Regions can be nested but must be ended in the same command buffer in which they were started.
+        */
+        void BeginRegion(CommandBuffer& commandBuffer, const char* name);
+
+        //! Ends the current timing region in the specified command buffer.
+        void EndRegion(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Returns the regions of the most recently resolved frame in the order they were started.
+        \return True if a frame has been resolved since the last call, otherwise the output is left unchanged.
+        */
+        bool GetResults(DynamicVector<GPUProfileRegion>& outRegions);
+
+        //! Returns the number of frames whose results have been dropped because they were not available in time.
+        std::uint64_t GetNumDroppedFrames() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -25,6 +25,52 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Image filter enumeration to generate MIP-maps on the CPU.
+\see GenerateMipChain
+*/
+enum class ImageFilter
+{
+    //! Box filter that averages all source pixels that are covered by a destination pixel. This is the fastest filter.
+    Box,
+
+    /**
+    \brief Kaiser-windowed sinc filter.
+    \remarks This filter has a wider footprint than the box filter and produces sharper MIP-maps with less aliasing.
+    */
+    Kaiser,
+};
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Flags for MIP-map generation on the CPU.
+\see GenerateMipChain
+*/
+struct MipChainFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the color components are encoded in sRGB color space.
+        \remarks The RGB components are converted into linear color space before they are filtered and converted back into sRGB color space afterwards.
+        The alpha component is always treated as linear.
+        */
+        SRGB                    = (1 << 0),
+
+        /**
+        \brief Specifies to preserve the alpha test coverage of the base level in each MIP-map.
+        \remarks The alpha component of each MIP-map is scaled such that the ratio of pixels with an alpha value greater than 0.5 matches the base level.
+        This prevents alpha-tested geometry such as foliage from fading out in the distance.
+        */
+        PreserveAlphaCoverage   = (1 << 1),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -145,6 +191,68 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Compresses the specified image buffer into a block compression format.
+\param[in] srcImageView Specifies the source image. If this is not in ImageFormat::RGBA format with DataType::UInt8, it is converted first.
+\param[in] extent Specifies the image extent. This does not need to be a multiple of the block size.
+\param[in] dstFormat Specifies the destination compression format. This must be one of ImageFormat::BC1 to ImageFormat::BC5.
+BC4 encodes the red channel and BC5 encodes the red and green channels, both as unsigned normalized values.
+\param[in] threadCount Specifies the number of threads to use for compression.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with the compressed image data or null if the format is not supported for compression.
+\remarks The encoder is optimized for speed to compress runtime generated textures, e.g. before passing them to RenderSystem::CreateTexture.
+\see DecompressImageBufferToRGBA8UNorm
+*/
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent2D&     extent,
+    ImageFormat         dstFormat,
+    unsigned            threadCount = 0
+);
+
+/**
+\brief Generates the MIP-map chain for the specified image on the CPU.
+\param[in] srcImageView Specifies the source image for the base MIP-map level. Only uncompressed color formats are supported.
+\param[in] extent Specifies the extent of the base MIP-map level. The Z component specifies the number of array layers, each of which is filtered independently.
+\param[in] numMipLevels Specifies the total number of MIP-map levels including the base level.
+If this is 0 or greater than the maximum number of MIP-maps for the specified extent, the full MIP-map chain is generated. By default 0.
+\param[in] filter Specifies the filter to downsample each MIP-map level. By default ImageFilter::Box.
+\param[in] flags Specifies optional flags for the filter. This can be a bitwise OR combination of the MipChainFlags entries. By default 0.
+\param[in] threadCount Specifies the number of threads to use for filtering.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with all MIP-map levels after the base level in the same format and data type as the source image,
+or null if the format is not supported or there is only a single MIP-map level.
+The MIP-map levels are tightly packed one after another, starting with MIP-map level 1, and each level stores its array layers one after another.
+\remarks Each MIP-map level is filtered from the previous one in linear floating-point precision.
+This can be used to bake MIP-maps offline or at load time instead of generating them on the GPU, e.g. for formats that do not support GPU MIP-map generation.
+Each level can then be uploaded with RenderSystem::WriteTexture into a texture that was created without the MiscFlags::GenerateMips flag:
+\code
+const LLGL::Extent3D extent{ 1024, 1024, 1 };
+LLGL::DynamicByteArray mipChain = LLGL::GenerateMipChain(baseImageView, extent, 0, LLGL::ImageFilter::Kaiser, LLGL::MipChainFlags::SRGB);
+std::size_t offset = 0;
+for (std::uint32_t mipLevel = 1; mipLevel < myTexture->GetDesc().mipLevels; ++mipLevel)
+{
+    const LLGL::Extent3D mipExtent = myTexture->GetMipExtent(mipLevel);
+    const std::size_t mipSize = LLGL::GetMemoryFootprint(baseImageView.format, baseImageView.dataType, mipExtent.x * mipExtent.y * mipExtent.z);
+    const LLGL::ImageView mipImageView{ baseImageView.format, baseImageView.dataType, mipChain.get() + offset, mipSize };
+    myRenderer->WriteTexture(*myTexture, LLGL::TextureRegion{ LLGL::TextureSubresource{ 0, mipLevel }, {}, mipExtent }, mipImageView);
+    offset += mipSize;
+}
+\endcode
+\see NumMipLevels
+\see MipChainFlags
+*/
+LLGL_EXPORT DynamicByteArray GenerateMipChain(
+    const ImageView&    srcImageView,
+    const Extent3D&     extent,
+    std::uint32_t       numMipLevels    = 0,
+    ImageFilter         filter          = ImageFilter::Box,
+    long                flags           = 0,
+    unsigned            threadCount     = 0
+);
+
 /**
 \brief Copies an image buffer region from the source buffer to the destination buffer.
 \param[out] dstImageView Specifies the destination image view.
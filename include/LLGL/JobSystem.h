@@ -0,0 +1,82 @@
+/*
+ * JobSystem.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_JOB_SYSTEM_H
+#define LLGL_JOB_SYSTEM_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Constants.h>
+#include <functional>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+/**
+\brief Namespace with functions to configure how LLGL distributes internal parallel work.
+\remarks LLGL uses parallel work for image conversion (see ConvertImageBuffer), texture decompression, and other CPU intensive tasks.
+By default, this work is dispatched to a persistent work-stealing thread pool that is owned by the library and created on first use.
+*/
+namespace JobSystem
+{
+
+
+/* ----- Types ----- */
+
+/**
+\brief Function signature of a single job.
+\param[in] jobIndex Specifies the zero-based index of the job within its batch.
+*/
+using JobFunction = std::function<void(std::size_t jobIndex)>;
+
+/**
+\brief Dispatch callback function signature to hook LLGL into a custom job system.
+\param[in] job Specifies the function that must be invoked once for each job index in the half-open range <code>[0, numJobs)</code>.
+\param[in] numJobs Specifies the number of jobs in this batch.
+\remarks The callback must not return before all jobs of the batch have finished.
+The jobs are independent of each other and can be executed in any order and on any thread, including the calling thread.
+\see SetDispatchCallback
+*/
+using DispatchCallback = std::function<void(const JobFunction& job, std::size_t numJobs)>;
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Sets the number of worker threads of the internal thread pool.
+\param[in] threadCount Specifies the number of worker threads. The thread that dispatches a batch of jobs always participates in its execution,
+so a value of zero runs all work on the calling thread. If this is \c LLGL_MAX_THREAD_COUNT, the number of worker threads is one less than the number of hardware threads.
+By default \c LLGL_MAX_THREAD_COUNT.
+\remarks This can be called while other threads dispatch parallel work. Batches that are already running finish on the previous thread pool,
+which is destroyed once the last of them has finished. The new thread pool is created lazily on the next dispatch.
+*/
+LLGL_EXPORT void SetThreadCount(unsigned threadCount);
+
+//! Returns the number of worker threads of the internal thread pool. This does not include the thread that dispatches work.
+LLGL_EXPORT unsigned GetThreadCount();
+
+/**
+\brief Sets the callback to dispatch all internal parallel work to a custom job system.
+\param[in] callback Specifies the new dispatch callback. If this is empty, the internal thread pool is used again.
+\remarks While a dispatch callback is set, the internal thread pool is not used.
+\remarks This can be called while other threads dispatch parallel work. Batches that are already running still complete with the previous callback.
+*/
+LLGL_EXPORT void SetDispatchCallback(const DispatchCallback& callback);
+
+
+} // /namespace JobSystem
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
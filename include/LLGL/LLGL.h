@@ -16,9 +16,14 @@
 #include <LLGL/Timer.h>
 #include <LLGL/TypeInfo.h>
 #include <LLGL/RenderSystem.h>
+#include <LLGL/GPUProfiler.h>
+#include <LLGL/CPUProfiler.h>
+#include <LLGL/DirectCommandBuffer.h>
 #include <LLGL/Log.h>
+#include <LLGL/JobSystem.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/ImageFlags.h>
+#include <LLGL/PipelineStateSignature.h>
 #include <LLGL/Utils/Input.h>
 #include <LLGL/Utils/ColorRGB.h>
 #include <LLGL/Utils/ColorRGBA.h>
@@ -123,6 +123,26 @@ LLGL_EXPORT LogHandle RegisterCallbackStd();
 */
 LLGL_EXPORT void UnregisterCallback(LogHandle handle);
 
+/**
+\brief Enables or disables asynchronous dispatching of log messages. This is disabled by default.
+\param[in] enable Specifies whether log messages are dispatched asynchronously.
+\remarks In asynchronous mode, Printf and Errorf format the message on the calling thread and write it into a lock-free ring buffer.
+A background thread then dispatches the messages to all registered callbacks in the order they were written.
+This avoids serializing worker threads that generate many log messages, e.g. with the debug layer enabled.
+\remarks Errorf waits until its message has been dispatched, so error messages are never lost if the application terminates afterwards.
+Disabling asynchronous mode dispatches all pending messages before this function returns. This is also done when the application shuts down.
+\remarks Callbacks are invoked on the background thread in this mode.
+\see Flush
+*/
+LLGL_EXPORT void SetAsyncMode(bool enable);
+
+/**
+\brief Blocks until all log messages that have been written so far are dispatched to the registered callbacks.
+\remarks This has no effect if asynchronous mode is disabled or if this is called inside a log callback function.
+\see SetAsyncMode
+*/
+LLGL_EXPORT void Flush();
+
 
 } // /namespace Log
 
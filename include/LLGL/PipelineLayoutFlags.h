@@ -58,6 +58,27 @@ struct BarrierFlags
     };
 };
 
+/**
+\brief Pipeline layout creation flags.
+\see PipelineLayoutDescriptor::flags
+*/
+struct PipelineLayoutFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that individual Buffer bindings with BindFlags::Sampled or BindFlags::Storage are bound as root descriptors.
+        \remarks By default, only individual constant buffers are bound as root descriptors and all other individual bindings are put into a descriptor table,
+        which requires the renderer to copy their descriptors into a shader-visible descriptor heap whenever they change.
+        With this flag, these buffer bindings are bound directly via their GPU virtual address.
+        \remarks Root descriptors can only refer to structured or byte-address buffers, i.e. typed buffers (Buffer objects created with a \c format) must not be used for these bindings.
+        \note Only supported with: Direct3D 12.
+        \see PipelineLayoutDescriptor::bindings
+        */
+        RootDescriptors = (1 << 0),
+    };
+};
+
 
 /* ----- Enumerations ----- */
 
@@ -123,42 +144,6 @@ enum class UniformType
 
 /* ----- Structures ----- */
 
-/**
-\brief Resource binding slot structure.
-\remarks This is used to unify the description of resource binding slots and sets.
-\see BindingDescriptor::slot
-*/
-struct BindingSlot
-{
-    BindingSlot() = default;
-    BindingSlot(const BindingSlot&) = default;
-
-    //! Constructs the binding slot with an index and an optional set (for Vulkan).
-    inline BindingSlot(std::uint32_t index, std::uint32_t set = 0) :
-        index { index },
-        set   { set   }
-    {
-    }
-
-    /**
-    \brief Specifies the zero-based binding index. By default 0.
-    \remarks For Vulkan, each binding must have a unique slot within the same pipeline layout unless they are in different descriptor sets.
-    \see set
-    */
-    std::uint32_t index = 0;
-
-    /**
-    \brief Specifies the zero-based descriptor set.
-    \remarks For Vulkan, each binding must have a unique slot within the same pipeline layout unless they are in different descriptor sets.
-    LLGL will also re-assign these descriptor set indices according to the internal binding layout for the Vulkan backend,
-    i.e. modify <code>OpDecorate ID DescriptorSet SET</code> SPIR-V instructions.
-    \remarks This field is silently ignored by backends that do not support binding sets, aka. register spaces.
-    \note Only supported with: Vulkan, Direct3D 12.
-    \see slot
-    */
-    std::uint32_t set   = 0;
-};
-
 /**
 \brief Layout structure for a single binding point of the pipeline layout descriptor.
 \see PipelineLayoutDescriptor::bindings
@@ -420,6 +405,13 @@ struct PipelineLayoutDescriptor
     \see BarrierFlags
     */
     long                                    barrierFlags    = 0;
+
+    /**
+    \brief Specifies optional pipeline layout creation flags. By default 0.
+    \remarks This can be a bitwise OR combination of the PipelineLayoutFlags bitmasks.
+    \see PipelineLayoutFlags
+    */
+    long                                    flags           = 0;
 };
 
 
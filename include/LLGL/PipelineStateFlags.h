@@ -13,6 +13,7 @@
 #include <LLGL/Types.h>
 #include <LLGL/Format.h>
 #include <LLGL/ForwardDecls.h>
+#include <LLGL/ResourceFlags.h>
 #include <LLGL/Constants.h>
 #include <vector>
 #include <cstdint>
@@ -268,6 +269,39 @@ enum class TessellationPartition
     FractionalEven,
 };
 
+/**
+\brief Fragment shading rate enumeration for variable rate shading (VRS).
+\remarks Each entry specifies the size (in pixels) of the area a single fragment shader invocation covers, i.e. <code>WidthxHeight</code>.
+Shading rates coarser than 2x2 are clamped to 2x2 on hardware that does not support them.
+\see ShadingRateDescriptor::rate
+*/
+enum class ShadingRate
+{
+    Rate1x1,    //!< One fragment shader invocation per pixel. This is the default shading rate.
+    Rate1x2,    //!< One fragment shader invocation per 1x2 pixels.
+    Rate2x1,    //!< One fragment shader invocation per 2x1 pixels.
+    Rate2x2,    //!< One fragment shader invocation per 2x2 pixels.
+    Rate2x4,    //!< One fragment shader invocation per 2x4 pixels.
+    Rate4x2,    //!< One fragment shader invocation per 4x2 pixels.
+    Rate4x4,    //!< One fragment shader invocation per 4x4 pixels.
+};
+
+/**
+\brief Shading rate combiner enumeration.
+\remarks A combiner determines how the result of the previous stage is combined with the next shading rate source.
+The shading rate sources are evaluated in the order: per-draw shading rate, per-primitive shading rate, shading-rate image.
+\see ShadingRateDescriptor::primitiveCombiner
+\see ShadingRateDescriptor::imageCombiner
+*/
+enum class ShadingRateCombiner
+{
+    Passthrough,    //!< Keeps the previous shading rate and ignores the next source.
+    Override,       //!< Replaces the previous shading rate with the next source.
+    Min,            //!< Selects the finer of both shading rates.
+    Max,            //!< Selects the coarser of both shading rates.
+    Sum,            //!< Adds both shading rates, i.e. the area of both shading rates is multiplied. This is clamped to the coarsest supported shading rate.
+};
+
 
 /* ----- Flags ----- */
 
@@ -288,6 +322,52 @@ struct ColorMaskFlags
     };
 };
 
+/**
+\brief Graphics pipeline dynamic state flags.
+\remarks Each of these flags excludes a group of static states from a graphics pipeline state object (PSO)
+so that a single PSO can be used for many state combinations. The excluded states must be set with the command buffer
+everytime the graphics pipeline is set, otherwise their values are undefined.
+\see GraphicsPipelineDescriptor::dynamicStates
+\see RenderingLimits::dynamicStates
+*/
+struct DynamicStateFlags
+{
+    enum
+    {
+        /**
+        \brief The cull mode is dynamic. RasterizerDescriptor::cullMode is ignored.
+        \see CommandBuffer::SetCullMode
+        */
+        CullMode            = (1 << 0),
+
+        /**
+        \brief The depth test, depth write mask, and depth compare operation are dynamic. All members of DepthDescriptor are ignored.
+        \see CommandBuffer::SetDepthState
+        */
+        DepthState          = (1 << 1),
+
+        /**
+        \brief The stencil test, stencil operations, compare operations, and masks are dynamic.
+        All members of StencilDescriptor are ignored except for \c referenceDynamic and the reference values.
+        \see CommandBuffer::SetStencilState
+        */
+        StencilState        = (1 << 2),
+
+        /**
+        \brief The primitive topology is dynamic within the same class of primitives (points, lines, triangles, or patches).
+        GraphicsPipelineDescriptor::primitiveTopology still determines the primitive class the PSO is created for.
+        \see CommandBuffer::SetPrimitiveTopology
+        */
+        PrimitiveTopology   = (1 << 3),
+
+        /**
+        \brief The depth bias is dynamic. RasterizerDescriptor::depthBias is ignored.
+        \see CommandBuffer::SetDepthBias
+        */
+        DepthBias           = (1 << 4),
+    };
+};
+
 
 /* ----- Structures ----- */
 
@@ -538,6 +618,29 @@ struct DepthBiasDescriptor
     float clamp             = 0.0f;
 };
 
+/**
+\brief Variable rate shading (VRS) descriptor structure.
+\see CommandBuffer::SetShadingRate
+*/
+struct ShadingRateDescriptor
+{
+    //! Specifies the per-draw shading rate. By default ShadingRate::Rate1x1.
+    ShadingRate         rate                = ShadingRate::Rate1x1;
+
+    /**
+    \brief Specifies how the per-primitive shading rate (e.g. \c SV_ShadingRate in HLSL) is combined with the per-draw shading rate. By default ShadingRateCombiner::Passthrough.
+    \remarks Only ShadingRateCombiner::Passthrough is supported if RenderingFeatures::hasShadingRateImage is false.
+    */
+    ShadingRateCombiner primitiveCombiner   = ShadingRateCombiner::Passthrough;
+
+    /**
+    \brief Specifies how the shading-rate image is combined with the result of the primitive combiner. By default ShadingRateCombiner::Passthrough.
+    \remarks Only ShadingRateCombiner::Passthrough is supported if RenderingFeatures::hasShadingRateImage is false.
+    \see CommandBuffer::SetShadingRateImage
+    */
+    ShadingRateCombiner imageCombiner       = ShadingRateCombiner::Passthrough;
+};
+
 /**
 \brief Rasterizer state descriptor structure.
 \see GraphicsPipelineDescriptor::rasterizer
@@ -778,10 +881,19 @@ struct GraphicsPipelineDescriptor
     */
     const RenderPass*       renderPass              = nullptr;
 
+    /**
+    \brief Specifies the zero-based index of the subpass within the render pass this graphics pipeline is used in. By default 0.
+    \remarks This must be less than the number of subpasses of the render pass.
+    \see RenderPassDescriptor::subpasses
+    \see CommandBuffer::NextSubpass
+    */
+    std::uint32_t           subpass                 = 0;
+
     /**
     \brief Specifies the vertex shader.
-    \remarks Each graphics pipeline must have at least a vertex shader. Therefore, this must never be null when a graphics PSO is created.
+    \remarks Each graphics pipeline must have either a vertex shader or a mesh shader. Therefore, this must only be null when a mesh shader is specified.
     With OpenGL, this shader may also have a stream output.
+    \see meshShader
     */
     Shader*                 vertexShader            = nullptr;
 
@@ -805,6 +917,24 @@ struct GraphicsPipelineDescriptor
     */
     Shader*                 geometryShader          = nullptr;
 
+    /**
+    \brief Specifies an optional task shader (also referred to as "Amplification Shader" or "Object Function").
+    \remarks If this is used, the counter part must also be specified, i.e. \c meshShader.
+    \see meshShader
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 taskShader              = nullptr;
+
+    /**
+    \brief Specifies the mesh shader (also referred to as "Mesh Function").
+    \remarks If this is used, the pipeline must not have a vertex, tessellation, or geometry shader and
+    primitives must be drawn with CommandBuffer::DrawMeshTasks or CommandBuffer::DrawMeshTasksIndirect.
+    The vertex input and primitive topology are then determined by the mesh shader.
+    \see taskShader
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 meshShader              = nullptr;
+
     /**
     \brief Specifies an optional fragment shader (also referred to as "Pixel Shader").
     \remarks If no fragment shader is specified, generated fragments are discarded by the output merger
@@ -833,6 +963,13 @@ struct GraphicsPipelineDescriptor
     */
     PrimitiveTopology       primitiveTopology       = PrimitiveTopology::TriangleList;
 
+    /**
+    \brief Specifies which pipeline states are set dynamically with the command buffer. This can be a bitwise OR combination of the DynamicStateFlags entries. By default 0.
+    \remarks Only the flags reported by RenderingLimits::dynamicStates are supported by the respective backend.
+    \see DynamicStateFlags
+    */
+    long                    dynamicStates           = 0;
+
     /**
     \brief Specifies an optional list of static viewports. If empty, the viewports must be set dynamically with the command buffer.
     \remarks This list must have the same number of entries as \c scissors, unless one of the lists is empty.
@@ -849,6 +986,20 @@ struct GraphicsPipelineDescriptor
     */
     std::vector<Scissor>    scissors;
 
+    /**
+    \brief Specifies an optional list of storage buffer bindings the vertex shader fetches its vertex attributes from (also referred to as "vertex pulling").
+    \remarks If this is non-empty, the graphics pipeline has no fixed-function vertex input: no input layout is created for the vertex shader,
+    its vertex input attributes are ignored, and vertex buffers no longer need to be bound with CommandBuffer::SetVertexBuffer.
+    Instead, each entry refers to the slot of a buffer binding in \c pipelineLayout that is visible to the vertex stage (i.e. StageFlags::VertexStage),
+    and the vertex shader loads its attributes by vertex and instance ID from these buffers.
+    This allows vertex data to be shared with compute passes and stored in compact formats that have no native vertex format equivalent.
+    \remarks The buffers themselves are bound like any other storage buffer, i.e. with a resource heap or CommandBuffer::SetResource.
+    \see BindingDescriptor::slot
+    \see PackRGB10A2UNorm
+    \see PackOctahedralNormal
+    */
+    std::vector<BindingSlot> vertexStreams;
+
     //! Specifies the depth state for the depth-stencil stage.
     DepthDescriptor         depth;
 
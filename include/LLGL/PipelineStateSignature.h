@@ -0,0 +1,132 @@
+/*
+ * PipelineStateSignature.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_STATE_SIGNATURE_H
+#define LLGL_PIPELINE_STATE_SIGNATURE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Container/SmallVector.h>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Canonical and compact representation of a pipeline state descriptor with a precomputed 64-bit hash.
+\remarks This can be used as key to deduplicate and cache pipeline states in constant time, e.g. with \c std::unordered_map.
+Two descriptors produce equal signatures if and only if they describe the same pipeline state.
+Render system objects (i.e. shaders, pipeline layouts, and render passes) are identified by their addresses and the debug name is ignored.
+States that have no effect are omitted, e.g. the stencil faces are only considered if the stencil test is enabled
+and only the first blend target is considered if independent blending is disabled.
+\see GraphicsPipelineDescriptor
+\see ComputePipelineDescriptor
+*/
+class LLGL_EXPORT PipelineStateSignature
+{
+
+    public:
+
+        //! Initializes an empty signature that is not equal to any signature of a pipeline state descriptor.
+        PipelineStateSignature() = default;
+
+        //! Initializes the signature for the specified graphics PSO descriptor. Equivalent of calling Build.
+        explicit PipelineStateSignature(const GraphicsPipelineDescriptor& desc);
+
+        //! Initializes the signature for the specified compute PSO descriptor. Equivalent of calling Build.
+        explicit PipelineStateSignature(const ComputePipelineDescriptor& desc);
+
+        //! Builds the signature for the specified graphics PSO descriptor.
+        void Build(const GraphicsPipelineDescriptor& desc);
+
+        //! Builds the signature for the specified compute PSO descriptor.
+        void Build(const ComputePipelineDescriptor& desc);
+
+    public:
+
+        /**
+        \brief Compares the two signatures in a strict-weak-order (SWO) fashion.
+        \return Negative value if \c lhs is ordered before \c rhs, positive value if \c lhs is ordered after \c rhs, and 0 on equality.
+        \remarks The order is only deterministic within the same application run, since it depends on the addresses of render system objects.
+        \ingroup group_compare_swo
+        */
+        static int CompareSWO(const PipelineStateSignature& lhs, const PipelineStateSignature& rhs);
+
+    public:
+
+        //! Returns the 64-bit hash of this signature.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
+        //! Returns a pointer to the serialized pipeline state.
+        inline const std::uint32_t* GetData() const
+        {
+            return data_.data();
+        }
+
+        //! Returns the number of 32-bit words of the serialized pipeline state.
+        inline std::size_t GetSize() const
+        {
+            return data_.size();
+        }
+
+    private:
+
+        void AppendObject(const void* obj);
+        void AppendFloat(float value);
+        void UpdateHash();
+
+    private:
+
+        SmallVector<std::uint32_t, 64>  data_;
+        std::uint64_t                   hash_   = 0;
+
+};
+
+
+/* ----- Operators ----- */
+
+//! Compares the two specified pipeline state signatures on equality.
+LLGL_EXPORT bool operator == (const PipelineStateSignature& lhs, const PipelineStateSignature& rhs);
+
+//! Compares the two specified pipeline state signatures on inequality.
+LLGL_EXPORT bool operator != (const PipelineStateSignature& lhs, const PipelineStateSignature& rhs);
+
+
+} // /namespace LLGL
+
+
+namespace std
+{
+
+
+//! Specialization of \c std::hash for LLGL::PipelineStateSignature, so it can be used as key in \c std::unordered_map.
+template <>
+struct hash<LLGL::PipelineStateSignature>
+{
+    inline std::size_t operator () (const LLGL::PipelineStateSignature& signature) const
+    {
+        return static_cast<std::size_t>(signature.GetHash());
+    }
+};
+
+
+} // /namespace std
+
+
+#endif
+
+
+
+// ================================================================================
@@ -42,6 +42,8 @@ see https://sourceforge.net/p/predef/wiki/Architectures/
 
 #if defined _M_ARM || defined __arm__
 #   define LLGL_ARCH_ARM
+#elif defined _M_ARM64 || defined __aarch64__
+#   define LLGL_ARCH_ARM64
 #elif defined _M_X64 || defined __amd64__
 #   define LLGL_ARCH_AMD64
 #elif defined _M_IX86 || defined _X86_ || defined __X86__ || defined __i386__
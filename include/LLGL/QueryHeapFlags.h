@@ -100,6 +100,37 @@ struct QueryPipelineStatistics
     std::uint64_t computeShaderInvocations          = 0;
 };
 
+/**
+\brief Pair of GPU and CPU timestamps that have been sampled at the same point in time.
+\remarks This can be used to place GPU timestamps on the same timeline as CPU timer ticks (see Timer::Tick):
+\code
+LLGL::TimestampCalibration calibration;
+if (myCmdQueue->QueryTimestampCalibration(calibration)) {
+    const double gpuSeconds = static_cast<double>(myGPUTimestamp - calibration.gpuTimestamp) / static_cast<double>(calibration.gpuFrequency);
+    const double cpuTicks   = static_cast<double>(calibration.cpuTicks) + gpuSeconds * static_cast<double>(LLGL::Timer::Frequency());
+}
+\endcode
+\see CommandQueue::QueryTimestampCalibration
+\see CommandBuffer::ResolveQueryData
+*/
+struct TimestampCalibration
+{
+    /**
+    \brief GPU timestamp in ticks of the \c gpuFrequency.
+    \remarks This is in the same time domain as the timestamps that CommandBuffer::ResolveQueryData writes for QueryType::TimeElapsed.
+    */
+    std::uint64_t   gpuTimestamp    = 0;
+
+    //! Frequency of the GPU timestamps (in ticks per second).
+    std::uint64_t   gpuFrequency    = 0;
+
+    //! CPU timer tick (see Timer::Tick) that was sampled at the same time as \c gpuTimestamp.
+    std::uint64_t   cpuTicks        = 0;
+
+    //! Maximum deviation (in nanoseconds) between the two timestamps. Zero if the backend does not report a deviation.
+    std::uint64_t   maxDeviation    = 0;
+};
+
 /**
 \brief Query heap descriptor structure.
 \see RenderSystem::CreateQueryHeap
@@ -11,6 +11,8 @@
 
 #include <LLGL/Format.h>
 #include <LLGL/Constants.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
 
 
 namespace LLGL
@@ -105,6 +107,35 @@ struct AttachmentFormatDescriptor
     AttachmentStoreOp       storeOp = AttachmentStoreOp::Undefined;
 };
 
+/**
+\brief Render pass subpass descriptor structure.
+\remarks Subpasses allow a render pass to read the outcome of previous subpasses as input attachments.
+On tile-based GPUs, this keeps the attachments in tile memory between subpasses, e.g. from a G-buffer subpass to a lighting subpass in deferred shading.
+Input attachments are identified by their color attachment index in the shader,
+i.e. \c input_attachment_index in GLSL for Vulkan, \c [[color(n)]] in Metal Shading Language, and \c gl_LastFragData[n] with the \c EXT_shader_framebuffer_fetch extension in GLSL.
+\see RenderPassDescriptor::subpasses
+\see CommandBuffer::NextSubpass
+\see RenderingFeatures::hasInputAttachments
+*/
+struct SubpassDescriptor
+{
+    /**
+    \brief Specifies the bitmask of color attachments this subpass renders into. By default all color attachments are enabled.
+    \remarks The least significant bit refers to the first color attachment, i.e. \c RenderPassDescriptor::colorAttachments[0].
+    Fragment shader output locations always refer to the same color attachment indices, regardless of which attachments are enabled in this subpass.
+    */
+    std::uint32_t colorAttachmentMask = ~0u;
+
+    /**
+    \brief Specifies the bitmask of color attachments this subpass reads as input attachments. By default 0.
+    \remarks The least significant bit refers to the first color attachment, i.e. \c RenderPassDescriptor::colorAttachments[0].
+    An attachment cannot be rendered into and read as input attachment within the same subpass, i.e. it is only read if it is enabled in both bitmasks.
+    Textures that are read as input attachments must have been created with the BindFlags::InputAttachment flag.
+    \see BindFlags::InputAttachment
+    */
+    std::uint32_t inputAttachmentMask = 0;
+};
+
 /**
 \brief Render pass descriptor structure.
 \remarks A render pass object can be used across multiple render targets.
@@ -159,6 +190,33 @@ struct RenderPassDescriptor
     \see RenderingLimits::maxNoAttachmentSamples
     */
     std::uint32_t               samples             = 1;
+
+    /**
+    \brief Specifies the subpasses of this render pass. By default empty.
+    \remarks If this is empty, the render pass has a single subpass that renders into all color attachments.
+    Otherwise, the first subpass begins with CommandBuffer::BeginRenderPass and each subsequent subpass begins with CommandBuffer::NextSubpass.
+    Graphics pipelines must be created for the subpass they are used in (see GraphicsPipelineDescriptor::subpass).
+    Render targets that are used with a render pass of more than one subpass must have been created with that render pass (see RenderTargetDescriptor::renderPass).
+    \note Input attachments are only supported if RenderingFeatures::hasInputAttachments is true.
+    Otherwise, all subpasses render into the same attachments one after another.
+    \see SubpassDescriptor
+    \see CommandBuffer::NextSubpass
+    */
+    ArrayView<SubpassDescriptor> subpasses;
+
+    /**
+    \brief Specifies the bitmask of views that are rendered simultaneously with a single draw call (multiview rendering). By default 0.
+    \remarks If this is non-zero, each bit \c i renders view \c i into the array layer <code>arrayLayer + i</code> of every attachment
+    (see AttachmentDescriptor::arrayLayer), e.g. 0x3 for stereo rendering or 0x3F for all six faces of a cube map.
+    Shaders select the view with \c SV_ViewID in HLSL, \c gl_ViewIndex in Vulkan GLSL, \c gl_ViewID_OVR in OpenGL GLSL,
+    and \c [[amplification_id]] in Metal. With Metal, the vertex shader must also write \c [[render_target_array_index]].
+    Render targets that are used with a multiview render pass must have been created with that render pass (see RenderTargetDescriptor::renderPass)
+    and all their attachments must refer to array or cube textures with enough array layers. With OpenGL, they must refer to 2D array textures.
+    \note Only supported if RenderingFeatures::hasMultiview is true. The number of views up to the highest bit must not exceed RenderingLimits::maxMultiviewViews
+    and multi-sampled render passes must not use multiview rendering, i.e. \c samples must be 1.
+    \see RenderingFeatures::hasMultiview
+    */
+    std::uint32_t               viewMask            = 0;
 };
 
 
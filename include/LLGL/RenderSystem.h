@@ -177,6 +177,33 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         static void Unload(RenderSystemPtr&& renderSystem);
 
+        /**
+        \brief Queries the adapters, renderer information, and rendering capabilities of the specified module without keeping a render system alive.
+        \param[in] renderSystemDesc Specifies the render system descriptor structure. Only the \c moduleName, \c flags, and \c rendererConfig members are considered.
+        \param[out] outProbe Specifies the output probe structure. This is only modified if the return value is true.
+        \param[in] cacheFilename Optional filename of the probe cache. If this is not null, the probe is loaded from this file if it contains an entry
+        for the same module name and flags, and otherwise the new probe is added to this file. Each entry is invalidated when LLGL is rebuilt,
+        when the size or modification time of the module file changes, or when the platform reports a change of the installed graphics adapters or driver versions.
+        \param[out] report Optional pointer to a report on potential failure of probing the specified module.
+        \return True if the module was probed successfully.
+        \remarks The Vulkan backend only creates an instance and enumerates the physical devices without creating a logical device.
+        All other backends create a headless render system (see RenderSystemFlags::Headless), i.e. without any swap-chain or window,
+        and release it immediately after its capabilities have been queried. With a probe cache, this cost is only paid on the first run.
+        \remarks This can be used to select a backend on start-up before any window is created:
+        \code
+        LLGL::RenderSystemProbe probe;
+        if (LLGL::RenderSystem::Probe("Vulkan", probe, "RenderSystemProbe.cache") && probe.caps.features.hasComputeShaders)
+            myRenderSystem = LLGL::RenderSystem::Load("Vulkan");
+        \endcode
+        \see RenderSystemProbe
+        */
+        static bool Probe(
+            const RenderSystemDescriptor&   renderSystemDesc,
+            RenderSystemProbe&              outProbe,
+            const char*                     cacheFilename   = nullptr,
+            Report*                         report          = nullptr
+        );
+
     public:
 
         /**
@@ -237,6 +264,21 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Returns the single instance of the command queue.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the command queue of the specified type.
+        \param[in] type Specifies the type of command queue. Command buffers for this queue must be created with the same CommandBufferDescriptor::queueType.
+        \remarks Backends that only provide a single command queue return the same object as GetCommandQueue() for all types.
+        Work on different queues can overlap on the GPU and must be synchronized with a Fence, for example:
+        \code
+        myComputeQueue->Submit(*myComputeCmdBuffer);
+        myComputeQueue->Submit(*myFence);
+        myGraphicsQueue->SubmitWait(*myFence);
+        myGraphicsQueue->Submit(*myGraphicsCmdBuffer);
+        \endcode
+        \see CommandQueue::SubmitWait
+        */
+        virtual CommandQueue* GetCommandQueue(const CommandQueueType type);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -265,6 +307,27 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Buffer* CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData = nullptr) = 0;
 
+        /**
+        \brief Creates multiple buffers at once and coalesces their initial data uploads if supported.
+        \param[in] numBuffers Specifies the number of buffers to create.
+        \param[in] bufferDescs Pointer to an array of \c numBuffers buffer descriptors.
+        \param[out] outBuffers Pointer to an array of \c numBuffers entries that receive the new buffers in the same order as their descriptors.
+        \param[in] initialData Optional pointer to an array of \c numBuffers raw pointers to the initial data of each buffer.
+        Each entry has the same meaning as the \c initialData parameter of CreateBuffer and may also be null. By default null.
+        \remarks This is intended to create a large number of buffers at once, e.g. during level load.
+        The Vulkan backend copies the initial data of all device local buffers into a shared staging buffer and uploads them with a single command buffer submission,
+        whereas the other backends create the buffers one after another.
+        Each buffer must still be released individually.
+        \remarks This function can be called from a loading thread as long as no other function of this render system is called concurrently.
+        \see CreateBuffer
+        */
+        virtual void CreateBuffers(
+            std::uint32_t           numBuffers,
+            const BufferDescriptor* bufferDescs,
+            Buffer**                outBuffers,
+            const void* const *     initialData = nullptr
+        );
+
         /**
         \brief Creates a new buffer array.
         \param[in] numBuffers Specifies the number of buffers in the array. This must be greater than 0.
@@ -361,6 +424,27 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage = nullptr) = 0;
 
+        /**
+        \brief Creates multiple textures at once and coalesces their initial image uploads if supported.
+        \param[in] numTextures Specifies the number of textures to create.
+        \param[in] textureDescs Pointer to an array of \c numTextures texture descriptors.
+        \param[out] outTextures Pointer to an array of \c numTextures entries that receive the new textures in the same order as their descriptors.
+        \param[in] initialImages Optional pointer to an array of \c numTextures pointers to the initial image of each texture.
+        Each entry has the same meaning as the \c initialImage parameter of CreateTexture and may also be null. By default null.
+        \remarks The Vulkan backend uploads the initial images and performs all layout transitions and MIP-map generations of the batch with a single command buffer submission,
+        whereas the other backends create the textures one after another.
+        Each texture must still be released individually.
+        \remarks This function can be called from a loading thread as long as no other function of this render system is called concurrently.
+        \see CreateTexture
+        \see CreateBuffers
+        */
+        virtual void CreateTextures(
+            std::uint32_t               numTextures,
+            const TextureDescriptor*    textureDescs,
+            Texture**                   outTextures,
+            const ImageView* const *    initialImages = nullptr
+        );
+
         //! Releases the specified texture object. After this call, the specified object must no longer be used.
         virtual void Release(Texture& texture) = 0;
 
@@ -370,6 +454,9 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] textureRegion Specifies the region where the texture is to be updated. The field TextureRegion::numMipLevels \b must be 1.
         \param[in] srcImageView Specifies the source image view. Its \c data member must not be null!
         \remarks This function can only be used for non-multi-sample textures, i.e. from types other than TextureType::Texture2DMS and TextureType::Texture2DMSArray.
+        \remarks If the source image format or data type does not match the texture format, the image is converted before it is written.
+        With Direct3D 11, large images are converted on the GPU instead of the CPU if the texture was created with BindFlags::Storage
+        and its format supports typed UAV stores.
         */
         virtual void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView) = 0;
 
@@ -494,6 +581,58 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Shader* CreateShader(const ShaderDescriptor& shaderDesc) = 0;
 
+        /**
+        \brief Creates multiple Shader objects at once and compiles them concurrently if supported.
+
+        \param[in] numShaders Specifies the number of shaders to create.
+        \param[in] shaderDescs Pointer to an array of \c numShaders shader descriptors.
+        \param[out] outShaders Pointer to an array of \c numShaders entries that receive the new shaders in the same order as their descriptors.
+        \param[in] threadCount Specifies the maximum number of threads to use for compilation.
+        If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+        the maximal count of threads the system supports will be used. By default \c LLGL_MAX_THREAD_COUNT.
+
+        \remarks This function blocks until all shaders have been created, which is intended to pre-compile a large number of shaders at once, e.g. during start up.
+        If RenderingFeatures::hasConcurrentShaderCreation is false, the shaders are created sequentially on the calling thread.
+        No other function of this render system must be called from another thread while this function is in progress.
+        Errors must be checked for each shader individually via Shader::GetReport.
+
+        \see CreateShader
+        \see RenderingFeatures::hasConcurrentShaderCreation
+        */
+        void CreateShaders(
+            std::uint32_t           numShaders,
+            const ShaderDescriptor* shaderDescs,
+            Shader**                outShaders,
+            unsigned                threadCount = LLGL_MAX_THREAD_COUNT
+        );
+
+        /**
+        \brief Creates multiple permutations of the same shader at once and compiles them concurrently if supported.
+
+        \param[in] shaderDesc Specifies the shader descriptor all permutations are created from.
+        The macros in ShaderDescriptor::defines are shared by all permutations and precede the macros of each permutation.
+        \param[in] numPermutations Specifies the number of permutations to create.
+        \param[in] permutationDefines Pointer to an array of \c numPermutations entries with the additional macros of each permutation.
+        Each entry must either be null or point to an array of ShaderMacro entries that is terminated by a zero-initialized ShaderMacro.
+        \param[out] outShaders Pointer to an array of \c numPermutations entries that receive the new shaders in the same order as their permutations.
+        \param[in] threadCount Specifies the maximum number of threads to use for compilation. By default \c LLGL_MAX_THREAD_COUNT.
+
+        \remarks If ShaderDescriptor::sourceType is ShaderSourceType::CodeFile, the file is only read once and all permutations are compiled from the loaded source.
+        In this case, ShaderDescriptor::debugName defaults to the filename, so the compiler still resolves relative include directives and reports errors with the filename.
+        \remarks Backends that cache native shader objects (such as Direct3D 11) share them between permutations that compile to identical byte code.
+        All other remarks of the CreateShaders function for multiple shader descriptors apply as well.
+
+        \see CreateShaders(std::uint32_t, const ShaderDescriptor*, Shader**, unsigned)
+        \see ShaderDescriptor::defines
+        */
+        void CreateShaders(
+            const ShaderDescriptor&     shaderDesc,
+            std::uint32_t               numPermutations,
+            const ShaderMacro* const *  permutationDefines,
+            Shader**                    outShaders,
+            unsigned                    threadCount = LLGL_MAX_THREAD_COUNT
+        );
+
         //! Releases the specified Shader object. After this call, the specified object must no longer be used.
         virtual void Release(Shader& shader) = 0;
 
@@ -563,6 +702,46 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual PipelineState* CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr) = 0;
 
+        /**
+        \brief Creates multiple graphics pipeline state objects (PSOs) at once and compiles them concurrently if supported.
+
+        \param[in] numPipelineStates Specifies the number of PSOs to create.
+        \param[in] pipelineStateDescs Pointer to an array of \c numPipelineStates graphics PSO descriptors.
+        \param[out] outPipelineStates Pointer to an array of \c numPipelineStates entries that receive the new PSOs in the same order as their descriptors.
+        \param[in] pipelineCache Optional pointer to a pipeline cache that is shared between all PSOs.
+        \param[in] threadCount Specifies the maximum number of threads to use for compilation.
+        If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+        the maximal count of threads the system supports will be used. By default \c LLGL_MAX_THREAD_COUNT.
+
+        \remarks This function blocks until all PSOs have been created, which is intended to pre-compile a large number of PSOs at once, e.g. during start up.
+        If RenderingFeatures::hasConcurrentPipelineStateCreation is false, the PSOs are created sequentially on the calling thread.
+        No other function of this render system must be called from another thread while this function is in progress.
+        Errors must be checked for each PSO individually via PipelineState::GetReport.
+
+        \see CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        \see RenderingFeatures::hasConcurrentPipelineStateCreation
+        */
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const GraphicsPipelineDescriptor*   pipelineStateDescs,
+            PipelineState**                     outPipelineStates,
+            PipelineCache*                      pipelineCache       = nullptr,
+            unsigned                            threadCount         = LLGL_MAX_THREAD_COUNT
+        );
+
+        /**
+        \brief Creates multiple compute pipeline state objects (PSOs) at once and compiles them concurrently if supported.
+        \remarks This behaves the same as the overloaded function for graphics PSOs.
+        \see CreatePipelineStates(std::uint32_t, const GraphicsPipelineDescriptor*, PipelineState**, PipelineCache*, unsigned)
+        */
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const ComputePipelineDescriptor*    pipelineStateDescs,
+            PipelineState**                     outPipelineStates,
+            PipelineCache*                      pipelineCache       = nullptr,
+            unsigned                            threadCount         = LLGL_MAX_THREAD_COUNT
+        );
+
         //! Releases the specified PipelineState object. After this call, the specified object must no longer be used.
         virtual void Release(PipelineState& pipelineState) = 0;
 
@@ -586,6 +765,39 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
+        /* ----- File streaming ----- */
+
+        /**
+        \brief Streams the specified file region into a buffer.
+        \param[in] buffer Specifies the destination buffer.
+        \param[in] offset Specifies the offset (in bytes) within the destination buffer.
+        \param[in] fileRegion Specifies the source file region. Its uncompressed size determines the size of the destination buffer range.
+        \param[in] fence Optional pointer to a fence that is signaled once the buffer range has been filled.
+        Command buffers that are submitted to the primary command queue afterwards are ordered after this request on the GPU,
+        so the fence is only required to determine on the CPU when the request has completed.
+        \return True if the request was submitted successfully. Otherwise, the file could not be read or the compression format is not supported.
+        \remarks On Direct3D 12, the file region is streamed with DirectStorage without an intermediate copy on the CPU,
+        if LLGL was built with \c LLGL_D3D12_ENABLE_DIRECTSTORAGE. Otherwise, the file region is mapped into memory and passed to WriteBuffer.
+        \see FileStreamRegion
+        \see RenderingFeatures::hasFileStreamDecompression
+        \see CommandQueue::WaitFence
+        */
+        virtual bool StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence = nullptr);
+
+        /**
+        \brief Streams the specified file region into a texture.
+        \param[in] texture Specifies the destination texture.
+        \param[in] textureRegion Specifies the destination texture region. The field TextureRegion::numMipLevels \b must be 1.
+        \param[in] fileRegion Specifies the source file region. Its uncompressed data must have the same format as the texture and its rows must be tightly packed.
+        \param[in] fence Optional pointer to a fence that is signaled once the texture region has been filled.
+        \return True if the request was submitted successfully. Otherwise, the file could not be read or the compression format is not supported.
+        \remarks On Direct3D 12 with DirectStorage, the texture region is streamed directly if the row pitch of the source data
+        is a multiple of \c D3D12_TEXTURE_DATA_PITCH_ALIGNMENT (256 bytes). Uncompressed regions with other row pitches are written with WriteTexture instead.
+        GDeflate compressed regions must cover a single array layer.
+        \see StreamBufferFromFile
+        */
+        virtual bool StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence = nullptr);
+
         /* ----- Extensions ----- */
 
         /**
@@ -626,6 +838,16 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) = 0;
 
+        /**
+        \brief Queries the current memory budget and usage of this render system.
+        \param[out] outInfo Specifies the output structure to receive the memory information.
+        \return True if the memory information was queried successfully. Otherwise, the backend does not support this function and \c outInfo is left unchanged.
+        \remarks This can be used to evict streamed resources before the driver starts paging memory, e.g. when MemoryHeapInfo::usage approaches MemoryHeapInfo::budget.
+        The per-category values are computed from all objects that are alive at the time of this call, so this function should not be called more often than once per frame.
+        \see MemoryInfo
+        */
+        virtual bool QueryMemoryInfo(MemoryInfo& outInfo);
+
     protected:
 
         //! Allocates the internal data.
@@ -180,6 +180,22 @@ enum class CPUAccess
     ReadWrite,
 };
 
+/**
+\brief Compression formats of file regions that are streamed into resources.
+\see FileStreamRegion::compression
+*/
+enum class FileStreamCompression
+{
+    //! The file region is not compressed.
+    Uncompressed,
+
+    /**
+    \brief The file region is compressed with GDeflate.
+    \remarks This requires the RenderingFeatures::hasFileStreamDecompression feature.
+    */
+    GDeflate,
+};
+
 
 /* ----- Flags ----- */
 
@@ -221,6 +237,31 @@ struct RenderSystemFlags
 
         //! \see PreferNVIDIA
         PreferIntel     = (1 << 3),
+
+        /**
+        \brief Specifies that releasing buffers and textures is deferred until the GPU has finished all work that was submitted before.
+        \remarks Without this flag, the client must ensure that a resource is no longer in use by the GPU before it is released, e.g. via CommandQueue::WaitIdle.
+        With this flag, RenderSystem::Release only removes the resource from the client's point of view and the native resource is destroyed
+        once the frame in which it has been released is complete. Completed frames are collected on each SwapChain::Present without blocking and
+        all remaining resources are destroyed on CommandQueue::WaitIdle.
+        \note Only supported with: Vulkan, Direct3D 12.
+        \see SwapChainDescriptor::framesInFlight
+        */
+        DeferredRelease = (1 << 4),
+
+        /**
+        \brief Specifies that the render system is used without any window or swap-chain, e.g. for server-side rendering on nodes without a display.
+        \remarks All rendering must go into render targets (see RenderSystem::CreateRenderTarget) and results can be read back via ReadbackRing or RenderSystem::ReadTexture.
+        Here is an overview of what impact this flag has to the respective renderer:
+        - OpenGL: The primary GL context is created immediately instead of with the first swap-chain.
+          On GNU/Linux, it is a surfaceless EGL context if LLGL was built with \c LLGL_GL_ENABLE_EGL_HEADLESS, so no X11 display is required.
+          Otherwise, the GL context still requires an invisible placeholder window.
+        - Vulkan: The surface extensions and \c VK_KHR_swapchain are not required, so devices without presentation support can be used.
+        - Direct3D 11, Direct3D 12, Metal: No effect, since these renderers never require a window to create their devices.
+        \remarks Swap-chains must not be created with a headless render system.
+        \see RenderSystem::CreateSwapChain
+        */
+        Headless        = (1 << 5),
     };
 };
 
@@ -401,6 +442,23 @@ struct RenderSystemDescriptor
     */
     std::size_t         nativeHandleSize    = 0;
 
+    /**
+    \brief Optional UTF-8 encoded filename of a persistent pipeline cache. By default null.
+    \remarks If this is not null, all PSOs that are created without an explicit PipelineCache are cached in this file across application runs.
+    Each PSO is identified by a hash of its descriptor and the code of its shaders. The entire file is discarded if it was written for a different renderer, device, or driver (see RendererInfo::pipelineCacheID).
+    The file is memory mapped when the render system is loaded and each cache entry is only read from disk when a PSO with the same hash is created.
+    New cache entries are written back to this file when the render system is unloaded.
+    \remarks If the backend does not support pipeline caching (see RenderingFeatures::hasPipelineCaching), this field is ignored.
+    \remarks Direct3D 11 and Direct3D 12 also store the byte code of shaders that are compiled from source in this file.
+    Each byte code is identified by a hash of its source, macro definitions, entry point, profile, and compiler flags.
+    Files that are included by the shader source are not part of this hash, i.e. changes to included files are not detected.
+    \remarks OpenGL also stores the program binaries of separable shaders (see ShaderCompileFlags::SeparateShader) in this file,
+    identified by a hash of their patched source, so these shaders are neither compiled nor linked when they are found in the cache.
+    \note Only supported with: Direct3D 11 (shader byte code only), Direct3D 12, Vulkan, OpenGL.
+    \see RenderSystem::CreatePipelineState
+    */
+    const char*         pipelineCacheFilename   = nullptr;
+
     #ifdef LLGL_OS_ANDROID
 
     /**
@@ -661,6 +719,117 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether pipeline state objects (PSOs) can be created concurrently on multiple threads.
+    \remarks If this is true, RenderSystem::CreatePipelineStates compiles its PSOs on multiple worker threads.
+    Otherwise, all PSOs are created sequentially on the calling thread.
+    \see RenderSystem::CreatePipelineStates
+    */
+    bool hasConcurrentPipelineStateCreation = false;
+
+    /**
+    \brief Specifies whether indirect draw commands can take the number of draw commands from a buffer object.
+    \see CommandBuffer::DrawIndirectCount
+    \see CommandBuffer::DrawIndexedIndirectCount
+    */
+    bool hasIndirectDrawingCount        = false;
+
+    /**
+    \brief Specifies whether shaders can be created concurrently on multiple threads.
+    \remarks If this is true, RenderSystem::CreateShaders compiles its shaders on multiple worker threads.
+    Otherwise, all shaders are created sequentially on the calling thread.
+    \see RenderSystem::CreateShaders
+    */
+    bool hasConcurrentShaderCreation    = false;
+
+    /**
+    \brief Specifies whether resources can be created and released concurrently on multiple threads.
+    \remarks If this is true, the RenderSystem functions to create and release buffers, buffer arrays, textures, samplers, resource heaps, shaders, pipeline layouts,
+    and pipeline states can be called from multiple threads at the same time, and while another thread encodes and submits command buffers.
+    Initial data of concurrently created resources is still uploaded one resource at a time, since all uploads share the internal command context of the render system.
+    Swap-chains, command buffers, render passes, render targets, query heaps, and fences must still be created and released on a single thread.
+    \remarks Backend specific guarantees:
+    - Vulkan, Direct3D 12, Metal, Null: Supported.
+    - OpenGL: Only supported if RendererConfigurationOpenGL::numWorkerContexts is non-zero, and then only for buffers without the BindFlags::VertexBuffer flag and textures.
+    - Direct3D 11: Not supported, since textures are initialized with the immediate device context, which is also used by the primary command buffers.
+    \note Reading, writing, and mapping resources, i.e. RenderSystem::ReadBuffer, RenderSystem::WriteBuffer etc., is not covered by this feature.
+    */
+    bool hasConcurrentResourceCreation  = false;
+
+    /**
+    \brief Specifies whether mesh and task shaders are supported.
+    \note Only supported with: Direct3D 12, Vulkan, Metal.
+    \see ShaderType::Task
+    \see ShaderType::Mesh
+    \see CommandBuffer::DrawMeshTasks
+    \see CommandBuffer::DrawMeshTasksIndirect
+    */
+    bool hasMeshShaders                 = false;
+
+    /**
+    \brief Specifies whether sparse textures are supported.
+    \note Only supported with: OpenGL (\c GL_ARB_sparse_texture), Direct3D 12, Vulkan, Metal.
+    \see MiscFlags::Sparse
+    \see CommandQueue::UpdateTileMappings
+    */
+    bool hasSparseTextures              = false;
+
+    /**
+    \brief Specifies whether render passes can read color attachments of previous subpasses as input attachments.
+    \note Only supported with: Vulkan, Metal (Apple GPUs), OpenGLES (\c GL_EXT_shader_framebuffer_fetch).
+    \see SubpassDescriptor::inputAttachmentMask
+    \see BindFlags::InputAttachment
+    \see CommandBuffer::NextSubpass
+    */
+    bool hasInputAttachments            = false;
+
+    /**
+    \brief Specifies whether query results can be resolved into buffers on the GPU timeline.
+    \note Only supported with: Vulkan, Direct3D 12, OpenGL 4.4 (or \c GL_ARB_query_buffer_object).
+    \see CommandBuffer::ResolveQueryData
+    */
+    bool hasQueryResolve                = false;
+
+    /**
+    \brief Specifies whether GDeflate compressed file regions can be streamed into buffers and textures.
+    \remarks On Direct3D 12, file regions are streamed with DirectStorage, which decompresses GDeflate on the GPU if the hardware supports it.
+    \note Only supported with: Direct3D 12 (if LLGL was built with \c LLGL_D3D12_ENABLE_DIRECTSTORAGE).
+    \see FileStreamCompression::GDeflate
+    \see RenderSystem::StreamBufferFromFile
+    \see RenderSystem::StreamTextureFromFile
+    */
+    bool hasFileStreamDecompression     = false;
+
+    /**
+    \brief Specifies whether the level-of-detail of textures can be clamped at runtime without recreating any resource views.
+    \note Only supported with: Direct3D 12, Direct3D 11, OpenGL.
+    \see Texture::SetMinLOD
+    */
+    bool hasTextureMinLODClamp          = false;
+
+    /**
+    \brief Specifies whether the per-draw shading rate of variable rate shading (VRS) is supported.
+    \note Only supported with: Direct3D 12 (VRS tier 1), Vulkan (if the extension \c VK_KHR_fragment_shading_rate is available).
+    \see CommandBuffer::SetShadingRate
+    */
+    bool hasVariableRateShading         = false;
+
+    /**
+    \brief Specifies whether screen-space shading-rate images and shading rate combiners are supported.
+    \note Only supported with: Direct3D 12 (VRS tier 2).
+    \see CommandBuffer::SetShadingRateImage
+    \see RenderingLimits::shadingRateImageTileSize
+    */
+    bool hasShadingRateImage            = false;
+
+    /**
+    \brief Specifies whether multiview render passes are supported, i.e. rendering multiple views with a single draw call.
+    \note Only supported with: Vulkan, Direct3D 12, OpenGL (with GL_OVR_multiview), Metal.
+    \see RenderPassDescriptor::viewMask
+    \see RenderingLimits::maxMultiviewViews
+    */
+    bool hasMultiview                   = false;
 };
 
 /**
@@ -840,6 +1009,33 @@ struct RenderingLimits
     \see RenderTargetDescriptor::samples
     */
     std::uint32_t   maxNoAttachmentSamples              = 0;
+
+    /**
+    \brief Specifies the maximum number of thread groups for a mesh shader draw command.
+    \see CommandBuffer::DrawMeshTasks
+    */
+    std::uint32_t   maxMeshShaderWorkGroups[3]          = { 0, 0, 0 };
+
+    /**
+    \brief Specifies the bitwise OR combination of DynamicStateFlags entries that are supported for graphics pipelines. By default 0.
+    \remarks For Vulkan, all dynamic states are supported if the extension \c VK_EXT_extended_dynamic_state is available.
+    \see GraphicsPipelineDescriptor::dynamicStates
+    */
+    long            dynamicStates                       = 0;
+
+    /**
+    \brief Specifies the width and height (in pixels) of the screen-space tiles each texel of a shading-rate image covers. By default 0.
+    \remarks This is 0 if RenderingFeatures::hasShadingRateImage is false. Otherwise, it is typically 8, 16, or 32.
+    \see CommandBuffer::SetShadingRateImage
+    */
+    std::uint32_t   shadingRateImageTileSize            = 0;
+
+    /**
+    \brief Specifies the maximum number of views of a multiview render pass. By default 0.
+    \remarks This is 0 if RenderingFeatures::hasMultiview is false. Otherwise, it is at least 2, e.g. 4 for Direct3D 12 and at most 32.
+    \see RenderPassDescriptor::viewMask
+    */
+    std::uint32_t   maxMultiviewViews                   = 0;
 };
 
 /**
@@ -885,6 +1081,131 @@ struct RenderingCapabilities
     RenderingLimits                 limits;
 };
 
+/**
+\brief Adapter information structure of a render system probe.
+\see RenderSystemProbe::adapters
+*/
+struct RenderSystemAdapterInfo
+{
+    //! Hardware adapter name (e.g. "NVIDIA GeForce RTX 3070").
+    std::string     name;
+
+    //! Vendor name of the hardware adapter (e.g. "NVIDIA Corporation").
+    std::string     vendorName;
+
+    //! Amount of dedicated video memory (in bytes). This is zero if the backend cannot query the video memory without a device.
+    std::uint64_t   videoMemory = 0;
+};
+
+/**
+\brief Result structure of a render system probe.
+\remarks This contains the same information as RenderSystem::GetRendererInfo and RenderSystem::GetRenderingCaps
+but can be queried without keeping a render system alive.
+\see RenderSystem::Probe
+*/
+struct RenderSystemProbe
+{
+    //! Name of the render system module that was probed (e.g. "Vulkan").
+    std::string                             moduleName;
+
+    //! Renderer ID of the probed module. \see RendererID
+    int                                     rendererID  = RendererID::Undefined;
+
+    /**
+    \brief List of all hardware adapters the probed module can render with.
+    \remarks Backends that can only query the adapter their device was created with return a single entry.
+    */
+    std::vector<RenderSystemAdapterInfo>    adapters;
+
+    //! Renderer information of the adapter that RenderSystem::Load would select with the same descriptor.
+    RendererInfo                            info;
+
+    //! Rendering capabilities of the adapter that RenderSystem::Load would select with the same descriptor.
+    RenderingCapabilities                   caps;
+
+    //! Specifies whether this probe was loaded from the probe cache file instead of querying the module.
+    bool                                    fromCache   = false;
+};
+
+/**
+\brief Memory heap structure with budget and current usage.
+\see MemoryInfo::heaps
+*/
+struct MemoryHeapInfo
+{
+    //! Specifies whether this heap is in device local memory, i.e. video memory. Otherwise, this heap is in system memory that is visible to the device.
+    bool            deviceLocal = false;
+
+    /**
+    \brief Memory budget (in bytes) of this heap for the current process.
+    \remarks This is an estimate of how much memory the process can allocate from this heap before the driver starts paging or allocations start to fail.
+    If the backend cannot query the budget, this is the total size of the heap or zero if that is unknown as well.
+    */
+    std::uint64_t   budget      = 0;
+
+    //! Memory (in bytes) that is currently allocated from this heap by the current process. This is zero if the backend cannot query the usage.
+    std::uint64_t   usage       = 0;
+};
+
+/**
+\brief Memory usage structure of the render system.
+\remarks The per-category values only include memory of objects that were created by the render system
+and are estimated from the object descriptors, i.e. they don't include driver specific alignment or padding.
+\see RenderSystem::QueryMemoryInfo
+*/
+struct MemoryInfo
+{
+    //! Estimated memory (in bytes) of all Buffer objects.
+    std::uint64_t   buffers                             = 0;
+
+    //! Estimated memory (in bytes) of all Texture objects including all MIP-maps, array layers, and samples.
+    std::uint64_t   textures                            = 0;
+
+    //! Estimated memory (in bytes) of all render target buffers that are not Texture objects, i.e. the color and depth-stencil buffers of all SwapChain objects.
+    std::uint64_t   renderTargets                       = 0;
+
+    //! Memory (in bytes) of internal staging and upload buffer pools. This is zero if the backend does not track its staging pools.
+    std::uint64_t   stagingPools                        = 0;
+
+    //! Number of entries in the \c heaps array. This is zero if the backend cannot query any memory heaps.
+    std::uint32_t   numHeaps                            = 0;
+
+    /**
+    \brief Budget and usage of each memory heap.
+    \remarks For Vulkan, these are the memory heaps of the physical device. The budget and usage are only available with the \c VK_EXT_memory_budget extension.
+    For Direct3D, the first heap is the local (video memory) segment group and the second heap is the non-local (system memory) segment group.
+    For Metal, the only heap is the device memory with its recommended maximum working set size as budget.
+    For OpenGL, the only heap is the video memory, which is only available with the \c GL_NVX_gpu_memory_info extension.
+    */
+    MemoryHeapInfo  heaps[LLGL_MAX_NUM_MEMORY_HEAPS];
+};
+
+/**
+\brief File region structure to stream buffer and texture data directly from a file.
+\see RenderSystem::StreamBufferFromFile
+\see RenderSystem::StreamTextureFromFile
+*/
+struct FileStreamRegion
+{
+    //! UTF-8 encoded filename. This must not be null.
+    const char*             filename            = nullptr;
+
+    //! Offset (in bytes) of the region within the file.
+    std::uint64_t           offset              = 0;
+
+    //! Size (in bytes) of the region within the file. For compressed regions, this is the compressed size.
+    std::uint32_t           size                = 0;
+
+    /**
+    \brief Size (in bytes) of the region after decompression. If this is 0, the region is assumed to be uncompressed and \c size is used.
+    \remarks This must match the size of the destination buffer range or texture region.
+    */
+    std::uint32_t           uncompressedSize    = 0;
+
+    //! Compression format of the file region. By default FileStreamCompression::Uncompressed.
+    FileStreamCompression   compression         = FileStreamCompression::Uncompressed;
+};
+
 
 /* ----- Functions ----- */
 
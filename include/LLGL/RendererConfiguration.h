@@ -38,6 +38,27 @@ enum class OpenGLContextProfile
     ESProfile,
 };
 
+/**
+\brief Vulkan device memory allocation strategy enumeration.
+\see RendererConfigurationVulkan::deviceMemoryStrategy
+*/
+enum class VulkanDeviceMemoryStrategy
+{
+    /**
+    \brief Default strategy with a sorted list of fragmented blocks per device memory chunk.
+    \remarks Releasing a block merges it with its neighbors which is in O(n) for n fragmented blocks.
+    \see RendererConfigurationVulkan::reduceDeviceMemoryFragmentation
+    */
+    Default,
+
+    /**
+    \brief Two-Level Segregated Fit (TLSF) strategy.
+    \remarks Allocating and releasing blocks is in O(1), independent of the number of fragmented blocks.
+    This is recommended for long running applications that frequently create and release resources, e.g. for texture streaming.
+    */
+    TLSF,
+};
+
 
 /* ----- Structures ----- */
 
@@ -97,6 +118,98 @@ struct RendererConfigurationVulkan
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     bool                        reduceDeviceMemoryFragmentation = false;
+
+    /**
+    \brief Specifies the allocation strategy for sub-regions within each device memory chunk. By default VulkanDeviceMemoryStrategy::Default.
+    \remarks If this is VulkanDeviceMemoryStrategy::TLSF, the \c reduceDeviceMemoryFragmentation member is ignored.
+    \see VulkanDeviceMemoryStrategy
+    */
+    VulkanDeviceMemoryStrategy  deviceMemoryStrategy            = VulkanDeviceMemoryStrategy::Default;
+
+    /**
+    \brief Specifies the maximum number of bytes that are relocated per frame to defragment device memory. By default 0, i.e. defragmentation is disabled.
+    \remarks If this is non-zero, each call to SwapChain::Present moves up to this many bytes of buffer allocations
+    out of sparsely used device memory chunks into denser ones, so empty chunks can be returned to the device.
+    Only buffers that are not referenced by descriptors (i.e. buffers without the BindFlags::ConstantBuffer, BindFlags::Sampled, and BindFlags::Storage flags)
+    and that are not part of a BufferArray are relocated. Textures are never relocated.
+    \note Command buffers that reference a relocatable buffer must not be recorded before a call to SwapChain::Present and submitted after it,
+    which includes command buffers created with CommandBufferFlags::MultiSubmit.
+    */
+    std::uint64_t               deviceMemoryDefragmentationBudget = 0;
+
+    /**
+    \brief Specifies whether texture and buffer uploads shall be performed on a dedicated transfer queue. By default false.
+    \remarks If this is true and the physical device provides a queue family that only supports transfer operations,
+    RenderSystem::WriteTexture and RenderSystem::WriteBuffer (for buffers without CPU access flags) no longer wait for the upload to complete.
+    Instead, the next submission to the command queue waits for all pending uploads on the GPU and acquires ownership of the uploaded resources.
+    To get notified when the uploads have completed, submit a fence via CommandQueue::Submit(Fence&) after the respective write operations.
+    Textures with undefined image layout, i.e. textures that have neither been initialized nor have any binding flags, are still uploaded synchronously.
+    \note This is ignored if a custom logical Vulkan device is provided via RenderSystemNativeHandle.
+    */
+    bool                        asyncTransferQueue              = false;
+
+    /**
+    \brief Specifies whether a dedicated compute queue shall be created for asynchronous compute. By default false.
+    \remarks If this is true and the physical device provides a queue family that supports compute but no graphics operations,
+    RenderSystem::GetCommandQueue(CommandQueueType::Compute) returns a separate command queue on that queue family,
+    and command buffers that are created with CommandQueueType::Compute are recorded for and must be submitted to that queue.
+    Work on the two queues is only ordered with fences, i.e. CommandQueue::Submit(Fence&) on one queue and CommandQueue::SubmitWait on the other.
+    This also applies to uploads on the asynchronous transfer queue, which are only synchronized with the graphics queue.
+    \remarks Buffers and textures are then shared between all queue families with concurrent sharing mode instead of queue family ownership transfers,
+    which may disable lossless compression of textures on some hardware. Textures that are only used as attachments (see RenderTarget) are not affected.
+    \remarks CommandQueue::SubmitWait only waits on the GPU if the device supports the \c VK_KHR_timeline_semaphore extension; otherwise, it blocks the CPU.
+    Command buffers for the compute queue ignore CommandBufferFlags::Transient.
+    \note This is ignored if a custom logical Vulkan device is provided via RenderSystemNativeHandle.
+    */
+    bool                        asyncComputeQueue               = false;
+
+    /**
+    \brief Specifies the maximum number of descriptor sets per resource heap in bindless mode. By default 0, i.e. bindless mode is disabled.
+    \remarks If this is non-zero and the physical device supports the \c VK_EXT_descriptor_indexing extension,
+    each heap binding of a pipeline layout is declared as a partially bound descriptor array with this many elements, all within a single update-after-bind descriptor set.
+    Each ResourceHeap then only allocates a single native descriptor set and the \c descriptorSet parameter of CommandBuffer::SetResourceHeap
+    no longer selects a native descriptor set but is passed to the shaders as a 32-bit unsigned integer at offset 0 of the push constant block.
+    Shaders must use this value to index each heap binding, for example:
+    \code
+    layout(push_constant) uniform Bindless { uint heapIndex; };
+    layout(binding = 0) uniform texture2D materialTextures[];
+    // ...
+    vec4 color = texture(sampler2D(materialTextures[heapIndex], linearSampler), texCoord);
+    \endcode
+    Uniforms of the pipeline layout (see PipelineLayoutDescriptor::uniforms) must therefore be declared after this index in the push constant block.
+    If the physical device supports update-after-bind and updates of unused descriptors while pending for all heap binding types,
+    RenderSystem::WriteResourceHeap no longer waits for the device to become idle, so descriptor sets that are in use by command buffers in flight must not be overwritten.
+    \remarks The number of descriptor sets of each resource heap (i.e. ResourceHeapDescriptor::numResourceViews divided by the number of heap bindings) must not exceed this value.
+    \note This is ignored if a custom logical Vulkan device is provided via RenderSystemNativeHandle.
+    */
+    std::uint32_t               bindlessResourceHeapCapacity    = 0;
+
+    /**
+    \brief Specifies the size (in bytes) of the ring of persistently mapped memory for buffers with MiscFlags::Transient. By default 4*1024*1024, i.e. 4 MB.
+    \remarks Transient buffers are bound at a bump offset into a single host visible device memory chunk, which bypasses the device memory manager entirely.
+    The memory of all transient buffers that are created between two calls to SwapChain::Present is recycled once the GPU has completed that frame.
+    The chunk is only allocated when the first transient buffer is created. If the ring is exhausted, transient buffers fall back to regular device memory.
+    If this is 0, MiscFlags::Transient is ignored for buffers.
+    */
+    std::uint64_t               transientBufferRingSize         = 4*1024*1024;
+};
+
+/**
+\brief Structure for a Direct3D 11 renderer specific configuration.
+\remarks The nomenclature here is "Renderer" instead of "RenderSystem" since the configuration is renderer specific
+and does not denote a configuration of the entire system.
+*/
+struct RendererConfigurationD3D11
+{
+    /**
+    \brief Specifies whether secondary command buffers shall be recorded into native D3D11 command lists. By default false.
+    \remarks If this is true and the driver reports support for \c DriverCommandLists (see \c D3D11_FEATURE_DATA_THREADING),
+    secondary command buffers are recorded on a deferred device context, so the translation into D3D11 API calls happens on the recording thread.
+    Otherwise, secondary command buffers are recorded into a virtual command buffer which is translated on the immediate context when it is executed.
+    \remarks Secondary command buffers that are created with a render pass (see CommandBufferDescriptor::renderPass) are always recorded into a virtual command buffer,
+    because a deferred device context cannot inherit the render targets of the primary command buffer.
+    */
+    bool nativeSecondaryCommandBuffers = false;
 };
 
 /**
@@ -126,8 +239,117 @@ struct RendererConfigurationOpenGL
     \brief Specifies whether to suppress failures when loading OpenGL extensions. By default false.
     \remarks If this is false, failed GL extensions will abort the current application and
     the repesctive extension and procedure name is printed to standard error output.
+    In this case, the procedures of GL extensions are only loaded on their first invocation to speed up the creation of the render system,
+    so a procedure that fails to load aborts the application when it is first called.
+    \remarks If this is true, all procedures are loaded immediately and an extension whose procedures fail to load is treated as unsupported.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies the shader storage buffer binding slot for bindless texture handles in resource heaps. By default -1, i.e. bindless textures are disabled.
+    \remarks If this is non-negative and the \c GL_ARB_bindless_texture extension is supported, resource heaps no longer bind their sampled textures and samplers to texture units.
+    Instead, each descriptor set stores one resident 64-bit texture handle per sampled texture binding (in ascending order of binding slots) in a shader storage buffer,
+    and CommandBuffer::SetResourceHeap binds the range of that descriptor set to this binding slot. Shaders must index these handles directly, for example:
+    \code
+    #extension GL_ARB_bindless_texture : require
+    layout(std430, binding = 7) readonly buffer BindlessTextures { sampler2D textures[]; };
+    // ...
+    vec4 color = texture(textures[0], texCoord);
+    \endcode
+    If a sampler binding has the same slot as a texture binding, the texture handle is created for that texture/sampler pair,
+    otherwise the handle uses the sampling parameters of the texture itself. Storage textures and buffers are still bound as usual.
+    \remarks Textures and samplers must not be released while they are referenced by a resource heap in this mode.
+    */
+    int                     bindlessTextureBufferSlot   = -1;
+
+    /**
+    \brief Specifies the first uniform buffer binding slot for uniforms that are set via CommandBuffer::SetUniforms. By default -1, i.e. uniforms are set with \c glUniform* commands.
+    \remarks If this is non-negative and the \c GL_ARB_uniform_buffer_object and \c GL_ARB_buffer_storage extensions are supported,
+    all top-level uniforms of a non-opaque type (e.g. \c vec4 or \c mat4, but not samplers) in the default uniform block of a GLSL shader are moved into a \c std140 uniform block, one for each shader stage.
+    CommandBuffer::SetUniforms then writes the uniform data into a CPU copy of these blocks, which is uploaded into a ring buffer before the next draw or compute command.
+    The uniform blocks of a shader program are bound to consecutive binding slots starting with this one, so these slots must not be used by any other uniform buffer.
+    \remarks This mode only applies to GLSL source code with version 140 or higher (or version 300 es) that is not compiled with ShaderCompileFlags::SeparateShader.
+    Uniforms that are declared with an initializer, a layout qualifier, or together with other uniforms in a single declaration remain in the default uniform block and are still set with \c glUniform* commands.
+    If any uniform is declared inside a preprocessor conditional, the respective shader is not modified at all.
+    \note Local variables and struct members must not share the name of a uniform that is moved into a uniform block.
+    \see CommandBuffer::SetUniforms
+    */
+    int                     uniformBufferSlot           = -1;
+
+    /**
+    \brief Specifies the number of GL contexts for worker threads that share their objects with the primary GL context. By default 0.
+    \remarks If this is non-zero, RenderSystem::CreateBuffer, RenderSystem::WriteBuffer, RenderSystem::CreateTexture, and RenderSystem::WriteTexture
+    can be called from threads other than the one where the first swap-chain was created. While such a call is in progress, it occupies one of these worker contexts,
+    so at most this many worker threads can create or write resources at the same time; other worker threads wait until a worker context is available.
+    Each call waits on a GL sync object before it returns, so the resource can be used on the primary GL context right away.
+    \remarks The worker contexts are created together with the first swap-chain. Buffers with the BindFlags::VertexBuffer flag must still be created on the primary thread,
+    since the vertex array objects they own are not shared between GL contexts. This is ignored if a custom native GL context is provided via RenderSystemDescriptor::nativeHandle.
+    */
+    std::uint32_t           numWorkerContexts           = 0;
+};
+
+/**
+\brief Structure for a Metal renderer specific configuration.
+\remarks The nomenclature here is "Renderer" instead of "RenderSystem" since the configuration is renderer specific
+and does not denote a configuration of the entire system.
+*/
+struct RendererConfigurationMetal
+{
+    /**
+    \brief Specifies the buffer binding slot for resource heaps encoded into argument buffers. By default -1, i.e. argument buffers are disabled.
+    \remarks If this is non-negative and the device supports \c MTLArgumentBuffersTier2, each descriptor set of a resource heap is encoded into an argument buffer
+    when it is written with RenderSystem::WriteResourceHeap (or initialized with RenderSystem::CreateResourceHeap).
+    CommandBuffer::SetResourceHeap then only binds that argument buffer to this buffer slot for each shader stage that has heap bindings
+    and makes the referenced resources resident, instead of binding each resource individually.
+    The n-th heap binding of the pipeline layout has the argument index n. Shaders must declare all heap bindings in this order, for example:
+    \code
+    struct ResourceHeap
+    {
+        constant Settings*  settings        [[id(0)]];
+        texture2d<float>    colorMap        [[id(1)]];
+        sampler             linearSampler   [[id(2)]];
+    };
+    fragment float4 PSMain(VertexOut inp [[stage_in]], constant ResourceHeap& heap [[buffer(30)]])
+    {
+        return heap.colorMap.sample(heap.linearSampler, inp.texCoord) * heap.settings->tint;
+    }
+    \endcode
+    This slot must not be used by any other buffer binding, including vertex buffers.
+    \remarks Samplers are created with support for argument buffers in this mode.
+    RenderSystem::WriteResourceHeap waits for the command queue to become idle before it overwrites an argument buffer.
+    */
+    int argumentBufferSlot = -1;
+
+    /**
+    \brief Specifies the size (in bytes) of the \c MTLHeap blocks that small buffers are sub-allocated from. By default 0, i.e. each buffer is allocated separately.
+    \remarks If this is non-zero and the device supports heaps with hazard tracking (macOS 10.15, iOS 13),
+    buffers in shared storage mode (i.e. all buffers on iOS and buffers with MiscFlags::DynamicUsage on macOS) are placed into shared heaps
+    if they are no larger than a quarter of this size and do not have the BindFlags::Storage flag.
+    This reduces allocation latency and the memory overhead of many small buffers such as constant buffers.
+    A heap is released once it is empty and another heap has to be created.
+    */
+    std::uint64_t bufferHeapSize = 0;
+};
+
+/**
+\brief Structure for a Null renderer specific configuration.
+\remarks The Null renderer can be used as a GPU-less harness to measure the CPU overhead of command encoding in the LLGL frontend.
+\see Null::RenderSystemNativeHandle
+*/
+struct RendererConfigurationNull
+{
+    /**
+    \brief Specifies whether recorded commands are replayed when a command buffer is submitted. By default true.
+    \remarks If this is false, commands are only encoded into the virtual command buffer, which isolates the encoding overhead from the replay overhead.
+    */
+    bool executeCommands = true;
+
+    /**
+    \brief Specifies whether the Null renderer shall collect timing and allocation counters. By default false.
+    \remarks The counters can be queried with RenderSystem::GetNativeHandle and the Null::RenderSystemNativeHandle structure.
+    Collecting the timings adds a clock query around each replayed command.
+    */
+    bool enableProfiling = false;
 };
 
 /**
@@ -59,6 +59,48 @@ class LLGL_EXPORT RenderingDebugger
         //! \retrun Returns whether time recording is enabled.
         bool GetTimeRecording() const;
 
+        /**
+        \brief Enables or disables validation of command buffers. By default enabled.
+        \remarks If validation is disabled, the debug layer only increments the counters of the frame profile, which is considerably cheaper
+        and can be used to collect draw call and binding statistics in shipping builds. This takes effect with the next call to CommandBuffer::Begin.
+        \see FrameProfile::commandBufferRecord
+        \see FlushProfile
+        */
+        void SetValidation(bool enabled);
+
+        //! Returns whether validation of command buffers is enabled.
+        bool GetValidation() const;
+
+        /**
+        \brief Enables or disables detection of out-of-bounds writes from shaders into storage buffers. By default disabled.
+        \remarks If enabled, each buffer with the BindFlags::Storage flag is allocated with a trailing canary zone that is filled with a known pattern.
+        At the end of each frame, i.e. on SwapChain::Present, the canary zones are read back and an error is reported for each buffer whose canary zone has been overwritten.
+        This only takes effect for buffers that are created after this function has been called.
+        \note This reads back a few bytes of every storage buffer each frame and synchronizes with the GPU. It is intended for debugging memory corruption only.
+        \see BindFlags::Storage
+        */
+        void SetBufferOverrunDetection(bool enabled);
+
+        //! Returns whether detection of out-of-bounds writes into storage buffers is enabled.
+        bool GetBufferOverrunDetection() const;
+
+        /**
+        \brief Enables command stream capturing into the specified file. By default disabled.
+        \param[in] filename Specifies the output filename. If this is null, capturing is disabled.
+        \param[in] numFrames Specifies the number of frames, i.e. SwapChain::Present calls, after which the capture file is closed. If this is 0, all frames are captured until the render system is unloaded.
+        \remarks The capture contains all resource creations, resource updates, and command buffer submissions, so it can be replayed on any backend with ReplayCapture.
+        This must be called before the render system is loaded with this debugger.
+        \note Query heaps, fences, stream outputs, secondary command buffers, and native commands are not captured.
+        \see ReplayCapture
+        */
+        void SetCapture(const char* filename, std::uint32_t numFrames = 0);
+
+        //! Returns the filename of the command stream capture or an empty string if capturing is disabled.
+        const char* GetCaptureFilename() const;
+
+        //! Returns the number of frames to capture.
+        std::uint32_t GetCaptureFrames() const;
+
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
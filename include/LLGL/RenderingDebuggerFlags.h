@@ -49,10 +49,23 @@ enum class WarningType
 struct ProfileTimeRecord
 {
     //! Time record annotation, e.g. function name that was recorded from the CommandBuffer.
-    const char*     annotation  = "";
+    const char*     annotation      = "";
 
     //! Elapsed time (in nanoseconds) to execute the respective command.
-    std::uint64_t   elapsedTime = 0;
+    std::uint64_t   elapsedTime     = 0;
+
+    //! CPU timer tick (see Timer::Tick) when the respective command started to be encoded or submitted. Zero if unknown.
+    std::uint64_t   cpuTicksStart   = 0;
+
+    //! CPU timer tick (see Timer::Tick) when the respective command finished to be encoded or submitted. Zero if unknown.
+    std::uint64_t   cpuTicksEnd     = 0;
+
+    /**
+    \brief Identifier of the timeline this record belongs to.
+    \remarks This is zero for command queue submissions and a unique number for each command buffer otherwise.
+    \see ToChromeTrace
+    */
+    std::uint32_t   commandBufferID = 0;
 };
 
 struct ProfileCommandQueueRecord
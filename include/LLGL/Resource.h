@@ -38,6 +38,37 @@ class LLGL_EXPORT Resource : public RenderSystemChild
         */
         virtual ResourceType GetResourceType() const = 0;
 
+        /**
+        \brief Sets the priority of this resource to remain in video memory when the device is under memory pressure.
+        \return True if the priority has been set. Otherwise, the backend does not support residency priorities for this resource.
+        \remarks This is only supported for buffers and textures by the Direct3D 12 and Vulkan backends.
+        With Vulkan, this requires the \c VK_EXT_pageable_device_local_memory extension and the priority applies to the entire
+        device memory chunk the resource has been allocated from, i.e. it also affects other resources that share the same chunk.
+        \remarks The default implementation has no effect and returns false.
+        \see ResidencyPriority
+        */
+        virtual bool SetResidencyPriority(ResidencyPriority priority);
+
+        /**
+        \brief Allows the operating system to page this resource out of video memory.
+        \return True if the resource has been evicted or was already evicted. Otherwise, the backend does not support explicit eviction.
+        \remarks The resource must not be used by any command until MakeResident has been called,
+        and all previously submitted commands that use this resource must have been completed on the GPU.
+        \remarks This is only supported by the Direct3D 12 backend for resources that are not placed in an aliasing heap.
+        \remarks The default implementation has no effect and returns false.
+        \see MakeResident
+        */
+        virtual bool Evict();
+
+        /**
+        \brief Makes this resource resident in video memory again after it has been evicted.
+        \return True if the resource is resident. Otherwise, the backend does not support explicit eviction or the device ran out of memory.
+        \remarks This blocks the calling thread until the resource has been paged in.
+        \remarks The default implementation has no effect and returns true if Evict is not supported.
+        \see Evict
+        */
+        virtual bool MakeResident();
+
 };
 
 
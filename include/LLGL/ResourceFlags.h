@@ -9,6 +9,9 @@
 #define LLGL_RESOURCE_FLAGS_H
 
 
+#include <cstdint>
+
+
 namespace LLGL
 {
 
@@ -49,6 +52,29 @@ enum class ResourceType
     Sampler,
 };
 
+/**
+\brief Residency priority enumeration for Buffer and Texture resources.
+\remarks Under memory pressure, the operating system pages out resources with a lower priority before those with a higher priority.
+\see Resource::SetResidencyPriority
+*/
+enum class ResidencyPriority
+{
+    //! Resource is paged out first, e.g. for cold streaming assets that have not been used for a while.
+    Minimum,
+
+    //! Resource is paged out before resources with normal priority.
+    Low,
+
+    //! Default priority for all resources.
+    Normal,
+
+    //! Resource is paged out after resources with normal priority.
+    High,
+
+    //! Resource is paged out last, e.g. for render targets that are used every frame.
+    Maximum,
+};
+
 
 /* ----- Flags ----- */
 
@@ -161,6 +187,16 @@ struct BindFlags
         \see CommandBuffer::FillBuffer
         */
         CopyDst                 = (1 << 11),
+
+        /**
+        \brief Texture can be read as input attachment within a subpass of a render pass.
+        \remarks This can only be used for Texture resources together with the BindFlags::ColorAttachment flag.
+        For pipeline layouts, this specifies a texture binding that is read as input attachment (e.g. \c subpassInput in GLSL for Vulkan).
+        \note Only supported with: Vulkan, Metal, OpenGLES (\c EXT_shader_framebuffer_fetch).
+        \see SubpassDescriptor::inputAttachmentMask
+        \see RenderingFeatures::hasInputAttachments
+        */
+        InputAttachment         = (1 << 12),
     };
 };
 
@@ -176,6 +212,10 @@ struct CPUAccessFlags
     {
         /**
         \brief Resource mapping with CPU read access is required.
+        \remarks A buffer with this flag and no other bind flags than BindFlags::CopySrc and BindFlags::CopyDst can be used for asynchronous readbacks:
+        Record CommandBuffer::CopyBuffer into this buffer, submit a Fence after the command buffer, poll it with CommandQueue::WaitFence and a timeout of zero,
+        and only map the buffer with RenderSystem::MapBuffer once the fence has been signaled. This avoids stalling the CPU on the GPU copy.
+        The ReadbackRing utility class implements this pattern with tickets for buffer and texture readbacks.
         \see CPUAccess::ReadOnly
         \see CPUAccess::ReadWrite
         */
@@ -259,10 +299,113 @@ struct MiscFlags
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
         Counter         = (1 << 5),
+
+        /**
+        \brief Specifies a transient texture whose memory can be aliased with other transient textures of the same aliasing group, or a transient buffer whose memory is recycled every frame.
+        \remarks This is intended for render target attachments whose lifetimes do not overlap within a frame, such as G-buffers, bloom chains, or SSAO targets.
+        The content of a transient texture is undefined whenever it is bound as attachment after another texture of the same aliasing group has been used,
+        i.e. the render pass must either clear the attachment or overwrite its entire content.
+        \remarks This can only be used with textures that also have the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment.
+        Backends that do not support memory aliasing ignore this flag.
+        \remarks For buffers, this specifies a buffer whose content is only used within the current frame, e.g. per-draw constants or dynamic geometry.
+        Such a buffer is placed in a ring of persistently mapped memory that is recycled once the GPU has completed the frame,
+        so it must not be used by any command buffer that is submitted after the next call to SwapChain::Present and should be released afterwards.
+        \note Only supported with: Direct3D 12, Metal (macOS 10.15 and iOS 13 or later); for buffers only supported with: Vulkan.
+        \see TextureDescriptor::aliasingGroup
+        \see RendererConfigurationVulkan::transientBufferRingSize
+        */
+        Transient       = (1 << 6),
+
+        /**
+        \brief Specifies a memoryless texture whose content only lives in on-chip tile memory for the duration of a render pass.
+        \remarks This is intended for intermediate attachments on tile-based GPUs that are never accessed outside the render pass they are rendered in,
+        such as depth buffers or G-buffers that are consumed within the same render pass.
+        The render pass must not load such an attachment (i.e. AttachmentLoadOp::Load) and its content is always discarded at the end of the render pass,
+        regardless of the attachment's store operation. Initial image data is ignored.
+        \remarks This can only be used with textures that have the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment and no other binding flags.
+        It cannot be combined with MiscFlags::Transient. Backends or devices without memoryless storage allocate regular device memory instead.
+        \note Only supported with: Metal (Apple GPUs), Vulkan (devices with lazily allocated memory).
+        \note With Metal, encoding blit or compute commands inside a render pass also discards the content of memoryless attachments.
+        \see AttachmentStoreOp::Undefined
+        */
+        Memoryless      = (1 << 7),
+
+        /**
+        \brief Specifies a sparse texture whose device memory is committed tile by tile instead of when the texture is created.
+        \remarks This is intended for virtual texturing where only the visible pages of a large texture are resident in video memory.
+        Tiles are committed and released with CommandQueue::UpdateTileMappings and the tile size can be queried with Texture::GetSparseProperties.
+        \remarks This can only be used with textures of type TextureType::Texture2D, TextureType::Texture2DArray, or TextureType::Texture3D
+        without multi-sampling and without initial image data. It cannot be combined with MiscFlags::Transient or MiscFlags::Memoryless.
+        \note Only supported with: OpenGL (\c GL_ARB_sparse_texture), Vulkan, Direct3D 12, Metal (Apple GPUs).
+        \see RenderingFeatures::hasSparseTextures
+        */
+        Sparse          = (1 << 8),
+
+        /**
+        \brief Hint to the renderer that the buffer is frequently written by the CPU and should be written directly into video memory.
+        \remarks If the hardware supports it (e.g. resizable BAR in Vulkan or GPU upload heaps in Direct3D 12), the buffer is placed in device local memory that is also visible to the host
+        and it is persistently mapped, so that RenderSystem::WriteBuffer and RenderSystem::MapBuffer write directly into the buffer without a staging copy.
+        The application must not overwrite ranges of such a buffer that are still in use by command buffers that have been submitted to the GPU.
+        \remarks If no such memory is available or the memory budget of the respective heap is exhausted, the buffer falls back to regular device local memory.
+        \note Only supported with: Vulkan, Direct3D 12.
+        \see RenderSystem::WriteBuffer
+        \see RenderSystem::MapBuffer
+        */
+        DirectUpload    = (1 << 9),
+
+        /**
+        \brief Hint to the renderer that the texture should be placed in its own device memory allocation instead of being sub-allocated.
+        \remarks This is intended for large render targets and very large textures, for which a dedicated allocation allows the driver
+        to apply framebuffer compression and to keep the texture resident with a higher priority.
+        \remarks Render targets for which the driver reports a preference for dedicated allocations and textures that are at least as large as
+        RendererConfigurationVulkan::minDeviceMemoryAllocationSize are allocated this way regardless of this flag.
+        \note Only supported with: Vulkan.
+        \see RendererConfigurationVulkan::minDeviceMemoryAllocationSize
+        */
+        DedicatedMemory = (1 << 10),
     };
 };
 
 
+/* ----- Structures ----- */
+
+/**
+\brief Resource binding slot structure.
+\remarks This is used to unify the description of resource binding slots and sets.
+\see BindingDescriptor::slot
+*/
+struct BindingSlot
+{
+    BindingSlot() = default;
+    BindingSlot(const BindingSlot&) = default;
+
+    //! Constructs the binding slot with an index and an optional set (for Vulkan).
+    inline BindingSlot(std::uint32_t index, std::uint32_t set = 0) :
+        index { index },
+        set   { set   }
+    {
+    }
+
+    /**
+    \brief Specifies the zero-based binding index. By default 0.
+    \remarks For Vulkan, each binding must have a unique slot within the same pipeline layout unless they are in different descriptor sets.
+    \see set
+    */
+    std::uint32_t index = 0;
+
+    /**
+    \brief Specifies the zero-based descriptor set.
+    \remarks For Vulkan, each binding must have a unique slot within the same pipeline layout unless they are in different descriptor sets.
+    LLGL will also re-assign these descriptor set indices according to the internal binding layout for the Vulkan backend,
+    i.e. modify <code>OpDecorate ID DescriptorSet SET</code> SPIR-V instructions.
+    \remarks This field is silently ignored by backends that do not support binding sets, aka. register spaces.
+    \note Only supported with: Vulkan, Direct3D 12.
+    \see slot
+    */
+    std::uint32_t set   = 0;
+};
+
+
 } // /namespace LLGL
 
 
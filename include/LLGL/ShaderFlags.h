@@ -37,6 +37,8 @@ enum class ShaderType
     Geometry,       //!< Geometry shader type.
     Fragment,       //!< Fragment shader type (also "Pixel Shader").
     Compute,        //!< Compute shader type.
+    Task,           //!< Task shader type (also "Amplification Shader" or "Object Function" with Metal). \see RenderingFeatures::hasMeshShaders
+    Mesh,           //!< Mesh shader type (also "Mesh Function" with Metal). \see RenderingFeatures::hasMeshShaders
 };
 
 /**
@@ -156,6 +158,14 @@ struct ShaderCompileFlags
         \note Only supported with: Metal.
         */
         DefaultLibrary          = (1 << 8),
+
+        /**
+        \brief Strips debug instructions, unused global variables, and unreachable functions from SPIR-V modules before the shader module is created.
+        \remarks This reduces the module size, the driver compile time, and the memory the backend keeps for the SPIR-V code.
+        Debug names are stripped as well, except for the members of push constant blocks, so ShaderReflection will not report the names of shader resources.
+        \note Only supported with: SPIR-V (if the Vulkan backend was built with \c LLGL_VK_ENABLE_SPIRV_REFLECT).
+        */
+        StripDebugInfo          = (1 << 9),
     };
 };
 
@@ -187,11 +197,20 @@ struct StageFlags
         //! Specifies the compute shader stage.
         ComputeStage        = (1 << 5),
 
+        //! Specifies the task shader stage (also referred to as "Amplification Shader" or "Object Function").
+        TaskStage           = (1 << 6),
+
+        //! Specifies the mesh shader stage.
+        MeshStage           = (1 << 7),
+
         //! Specifies all tessellation stages, i.e. tessellation-control-, tessellation-evaluation shader stages.
         AllTessStages       = (TessControlStage | TessEvaluationStage),
 
-        //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, and fragment shader stages.
-        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
+        //! Specifies all mesh pipeline stages, i.e. task- and mesh shader stages.
+        AllMeshStages       = (TaskStage | MeshStage),
+
+        //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, task-, mesh-, and fragment shader stages.
+        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | AllMeshStages | FragmentStage),
 
         //! Specifies all shader stages.
         AllStages           = (AllGraphicsStages | ComputeStage),
@@ -444,6 +463,7 @@ struct ShaderDescriptor
     /**
     \brief Compute shader specific attributes.
     \remarks This member is only used to specify the number of threads per threadgroup for the Metal backend.
+    This also applies to task and mesh shaders, i.e. object and mesh functions in Metal.
     \note Only supported with: Metal.
     */
     ComputeShaderAttributes     compute;
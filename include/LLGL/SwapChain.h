@@ -32,6 +32,7 @@ namespace LLGL
 
 
 class Display;
+struct Scissor;
 
 /**
 \brief Swap-chain interface.
@@ -82,6 +83,18 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual void Present() = 0;
 
+        /**
+        \brief Presents the current back buffer like Present, but only the specified damage rectangles have changed since the previous frame.
+        \param[in] numDamageRects Specifies the number of damage rectangles. If this is 0, the entire surface is presented.
+        \param[in] damageRects Pointer to the array of damage rectangles (in pixels) with the origin in the upper-left corner of the swap-chain.
+        \remarks This allows the presentation engine and compositor to only update the damaged regions, which saves power and bandwidth on mobile devices.
+        The content outside the damage rectangles must be identical to the previously presented frame.
+        \remarks OpenGL on EGL uses \c eglSwapBuffersWithDamageKHR, Vulkan uses \c VK_KHR_incremental_present, and Direct3D uses \c IDXGISwapChain1::Present1 with dirty rectangles.
+        Backends and platforms without support for damage regions present the entire surface, i.e. this is equivalent to calling Present.
+        \see Present
+        */
+        virtual void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects);
+
         /**
         \brief Returns the current swap-buffer index.
 
@@ -147,6 +160,27 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool SetVsyncInterval(std::uint32_t vsyncInterval) = 0;
 
+        /**
+        \brief Blocks until this swap-chain is ready to accept the next frame or the timeout has elapsed.
+        \param[in] timeout Specifies the timeout in nanoseconds. By default the function waits forever.
+        \return True if the swap-chain is ready for the next frame, otherwise the timeout has elapsed.
+        \remarks Call this at the beginning of each frame before input is sampled and the frame is recorded.
+        This keeps the time between input sampling and presentation as short as possible when SwapChainDescriptor::lowLatency is enabled.
+        \remarks If the swap-chain was not created with SwapChainDescriptor::lowLatency or the backend has no means to wait for the presentation engine,
+        this function returns true immediately, since Present already limits the number of frames in flight.
+        \see SwapChainDescriptor::lowLatency
+        \see SwapChainDescriptor::framesInFlight
+        */
+        virtual bool WaitForNextFrame(std::uint64_t timeout = ~0ull);
+
+        /**
+        \brief Returns the transform the presentation engine applies to the content of this swap-chain before it is displayed.
+        \remarks This is SurfaceTransform::Identity unless the swap-chain was created with SwapChainDescriptor::preRotation enabled.
+        Otherwise, the application must rotate its clip-space coordinates by this transform, so the content appears upright on the display.
+        \see SwapChainDescriptor::preRotation
+        */
+        virtual SurfaceTransform GetSurfaceTransform() const;
+
     public:
 
         /* ----- Surface & Display ----- */
@@ -171,6 +205,30 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         Surface& GetSurface() const;
 
+        /**
+        \brief Releases all native objects of this swap-chain that depend on its native surface, e.g. before the surface is destroyed when a mobile app is suspended.
+        \remarks The render system, the GPU device, and the GL context remain valid, so all other resources are kept alive.
+        While detached, this swap-chain must neither be presented nor be used as render target.
+        Call this within Canvas::EventListener::OnDestroySurface on mobile platforms.
+        \note Only required with: OpenGLES and Vulkan on Android. Other backends and platforms keep their surfaces when the app is suspended.
+        \see AttachSurface
+        \see Canvas::EventListener::OnDestroySurface
+        */
+        void DetachSurface();
+
+        /**
+        \brief Recreates the native objects of this swap-chain for the current native surface after it has been detached.
+        \return True on success. Otherwise, the surface is not available yet and this swap-chain remains detached.
+        \remarks The swap-chain takes the resolution of the new surface, i.e. this can also change the resolution.
+        Call this within Canvas::EventListener::OnInitSurface on mobile platforms.
+        \see DetachSurface
+        \see Canvas::EventListener::OnInitSurface
+        */
+        bool AttachSurface();
+
+        //! Returns true if this swap-chain is currently detached from its surface.
+        bool IsSurfaceDetached() const;
+
     protected:
 
         /**
@@ -179,6 +237,18 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool ResizeBuffersPrimary(const Extent2D& resolution) = 0;
 
+        /**
+        \brief Primary function to release all native objects that depend on the native surface. By default does nothing.
+        \see DetachSurface
+        */
+        virtual void DetachSurfacePrimary();
+
+        /**
+        \brief Primary function to recreate all native objects for the current native surface. By default calls ResizeBuffersPrimary.
+        \see AttachSurface
+        */
+        virtual bool AttachSurfacePrimary(const Extent2D& resolution);
+
     protected:
 
         //! Allocates the internal data.
@@ -17,6 +17,64 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Swap-chain presentation mode enumeration.
+\remarks If a presentation mode is not supported by the backend or the display, the swap-chain falls back to the default mode.
+\see SwapChainDescriptor::presentMode
+*/
+enum class PresentMode
+{
+    /**
+    \brief The presentation mode is derived from the v-sync interval. This is the default value.
+    \remarks If the v-sync interval is 0, the swap-chain presents immediately (allowing tearing if supported), otherwise it waits for the vertical blank.
+    \see SwapChain::SetVsyncInterval
+    */
+    Default,
+
+    /**
+    \brief Frames are presented immediately without waiting for the vertical blank, which may cause tearing.
+    \remarks This allows tearing on variable refresh rate (VRR) displays, so no additional frame of latency is added.
+    For Direct3D, this requires \c DXGI_FEATURE_PRESENT_ALLOW_TEARING to be supported.
+    */
+    Immediate,
+
+    /**
+    \brief Frames are presented at the next vertical blank, but the newest frame replaces a frame that is already waiting for presentation.
+    \remarks This neither tears nor blocks rendering, which makes it suitable to measure the true throughput of uncapped benchmarks.
+    For Direct3D, this corresponds to a flip-model swap-chain with a sync interval of 0 and tearing disabled.
+    */
+    Mailbox,
+
+    /**
+    \brief Frames are queued and presented at the vertical blank in order (first-in-first-out). This is classic v-sync.
+    \remarks The sync interval is at least 1 for this mode.
+    */
+    Fifo,
+
+    /**
+    \brief Like Fifo, but a frame that misses the vertical blank is presented immediately, which may cause tearing.
+    \note Only supported with: Vulkan. Other backends treat this as Fifo.
+    */
+    FifoRelaxed,
+};
+
+/**
+\brief Swap-chain surface transform enumeration.
+\remarks This specifies the rotation (clockwise) the presentation engine applies to the swap-chain content before it is displayed.
+\see SwapChain::GetSurfaceTransform
+\see SwapChainDescriptor::preRotation
+*/
+enum class SurfaceTransform
+{
+    Identity,   //!< No rotation. This is the default value.
+    Rotate90,   //!< Content is rotated 90 degrees clockwise.
+    Rotate180,  //!< Content is rotated 180 degrees.
+    Rotate270,  //!< Content is rotated 270 degrees clockwise.
+};
+
+
 /* ----- Flags ----- */
 
 /**
@@ -115,8 +173,69 @@ struct SwapChainDescriptor
     */
     std::uint32_t   swapBuffers     = 2;
 
+    /**
+    \brief Maximum number of frames the CPU can record ahead of the GPU before SwapChain::Present blocks. By default 0.
+    \remarks If this is 0, the backend chooses its default, which is 3 for Vulkan and the number of swap buffers for Direct3D 12.
+    Lower values reduce input latency, higher values reduce the chance of the CPU waiting on the GPU.
+    This is clamped to the range supported by the backend.
+    \note Only supported with: Vulkan, Direct3D 12.
+    \see RenderSystemFlags::DeferredRelease
+    \see lowLatency
+    */
+    std::uint32_t   framesInFlight  = 0;
+
+    /**
+    \brief Specifies the presentation mode. By default PresentMode::Default.
+    \note Only supported with: Vulkan, Direct3D 12, Direct3D 11.
+    \see PresentMode
+    */
+    PresentMode     presentMode     = PresentMode::Default;
+
     //! Specifies whether to enable fullscreen mode or windowed mode. By default windowed mode.
     bool            fullscreen      = false;
+
+    /**
+    \brief Specifies whether to enable the low-latency present mode. By default false.
+    \remarks If enabled, SwapChain::WaitForNextFrame blocks until the presentation engine is ready to accept the next frame,
+    so the application can sample input as late as possible. In this mode, \c framesInFlight specifies the maximum frame latency and 0 selects a latency of 1.
+    \remarks Direct3D uses a frame latency waitable swap-chain, Vulkan uses \c VK_KHR_present_wait if supported, and Metal limits the number of drawables.
+    \note Only supported with: Vulkan, Direct3D 12, Direct3D 11, Metal.
+    \see SwapChain::WaitForNextFrame
+    */
+    bool            lowLatency      = false;
+
+    /**
+    \brief Specifies whether to defer the acquisition of the next swap buffer until it is used. By default false.
+    \remarks If enabled, the next swap buffer is not acquired at the end of SwapChain::Present but at the latest possible point,
+    i.e. when the swap-chain is first used as render target, when its current swap index is queried, or when it is presented.
+    This allows the CPU to keep encoding the next frame while the compositor still holds on to the swap buffers.
+    \note Only supported with: Vulkan.
+    \see SwapChain::GetCurrentSwapIndex
+    */
+    bool            deferredAcquire = false;
+
+    /**
+    \brief Specifies whether the content of the swap-chain depth-stencil buffer can be discarded at the end of each render pass. By default false.
+    \remarks If enabled, the render pass returned by SwapChain::GetRenderPass uses AttachmentStoreOp::Undefined for the depth and stencil attachments.
+    This allows tile-based GPUs to avoid writing the depth-stencil buffer back to memory, but its content must not be read after a render pass has ended,
+    e.g. with CommandBuffer::CopyTextureFromFramebuffer.
+    \note Only supported with: Vulkan, OpenGL 4.3 (or \c GL_ARB_invalidate_subdata), OpenGLES 3.0.
+    \see SwapChain::GetRenderPass
+    \see AttachmentStoreOp::Undefined
+    */
+    bool            discardDepthStencil = false;
+
+    /**
+    \brief Specifies whether the swap-chain is created in the current orientation of the display. By default false.
+    \remarks If enabled, the swap-chain images are created with the transform of the display (e.g. rotated by 90 degrees on a mobile device in landscape mode),
+    so the compositor does not have to rotate each frame in an additional full-screen pass before it is displayed.
+    The resolution of the swap-chain as well as viewports and scissor rectangles remain in the orientation of the surface and are rotated by the backend,
+    but the application must rotate its clip-space coordinates by the angle returned by SwapChain::GetSurfaceTransform, e.g. in the projection matrix.
+    Call SwapChain::ResizeBuffers after the orientation of the display has changed to pick up the new transform.
+    \note Only supported with: Vulkan. Other backends always use SurfaceTransform::Identity.
+    \see SwapChain::GetSurfaceTransform
+    */
+    bool            preRotation     = false;
 };
 
 
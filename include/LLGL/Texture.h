@@ -101,6 +101,30 @@ class LLGL_EXPORT Texture : public Resource
         */
         virtual SubresourceFootprint GetSubresourceFootprint(std::uint32_t mipLevel) const = 0;
 
+        /**
+        \brief Queries the tile properties of this texture if it was created with MiscFlags::Sparse.
+        \param[out] outProperties Specifies the output parameter for the tile properties.
+        \return True if this texture is a sparse texture and the properties have been written. Otherwise, the output parameter is not modified.
+        \see CommandQueue::UpdateTileMappings
+        */
+        virtual bool GetSparseProperties(SparseTextureProperties& outProperties) const;
+
+        /**
+        \brief Clamps the level-of-detail (LOD) that shaders can sample from this texture, e.g. while more detailed MIP-map levels are still being streamed in.
+        \param[in] minLOD Specifies the minimum LOD, i.e. the most detailed MIP-map level that can be sampled.
+        This must be in the range [0, N-1] where N is the number of MIP-map levels of this texture. By default 0.
+        \return True if the clamp has been set. Otherwise, this feature is not supported (see RenderingFeatures::hasTextureMinLODClamp).
+        \remarks This is a state change of the texture itself, i.e. resource heaps that refer to this texture neither have to be recreated nor rewritten.
+        This is in contrast to SamplerDescriptor::minLOD, which is part of the sampler state.
+        \remarks Backend specific behavior:
+        - Direct3D 12: The clamp applies to resource views of the entire texture. Resource heaps update their descriptors the next time they are bound with CommandBuffer::SetResourceHeap.
+        - Direct3D 11: The clamp applies to all resource views of this texture (see \c ID3D11DeviceContext::SetResourceMinLOD).
+        - OpenGL: The clamp is rounded down to the next MIP-map level (see \c GL_TEXTURE_BASE_LEVEL). It must be reset to 0 before CommandBuffer::GenerateMips is called.
+        \see RenderingFeatures::hasTextureMinLODClamp
+        \see SparseTextureProperties
+        */
+        virtual bool SetMinLOD(float minLOD);
+
     protected:
 
         Texture(const TextureType type, long bindFlags);
@@ -259,6 +259,39 @@ struct TextureRegion
     Extent3D            extent;
 };
 
+/**
+\brief Texture copy region structure: Destination location, source location, and extent.
+\remarks This is used to copy multiple texture regions with a single command.
+\see CommandBuffer::CopyTextureRegions
+\see TextureLocation
+*/
+struct TextureCopyRegion
+{
+    TextureCopyRegion() = default;
+    TextureCopyRegion(const TextureCopyRegion&) = default;
+
+    //! Constructor to initialize all members.
+    inline TextureCopyRegion(const TextureLocation& dstLocation, const TextureLocation& srcLocation, const Extent3D& extent) :
+        dstLocation { dstLocation },
+        srcLocation { srcLocation },
+        extent      { extent      }
+    {
+    }
+
+    //! Specifies the destination location, including MIP-map level and offset.
+    TextureLocation dstLocation;
+
+    //! Specifies the source location, including MIP-map level and offset.
+    TextureLocation srcLocation;
+
+    /**
+    \brief Extent of the texture region to copy.
+    \remarks The same rules as for the \c extent parameter of CommandBuffer::CopyTexture apply.
+    \see CommandBuffer::CopyTexture
+    */
+    Extent3D        extent;
+};
+
 /**
 \brief Texture descriptor structure.
 \remarks Contains all information about type, format, and dimension to create a texture resource.
@@ -364,6 +397,15 @@ struct TextureDescriptor
     \see TextureDescriptor::miscFlags
     */
     ClearValue      clearValue;
+
+    /**
+    \brief Specifies the aliasing group for transient textures. By default 0.
+    \remarks All textures created with the MiscFlags::Transient bit and the same aliasing group share the same memory.
+    Textures that must be used at the same time, such as multiple attachments of the same render target, must therefore be in different aliasing groups.
+    \remarks This is ignored if the MiscFlags::Transient bit is not set in the \c miscFlags attribute.
+    \see MiscFlags::Transient
+    */
+    std::uint32_t   aliasingGroup   = 0;
 };
 
 /**
@@ -473,6 +515,49 @@ struct SubresourceFootprint
     std::uint32_t layerStride   = 0;
 };
 
+/**
+\brief Tile properties of a sparse texture.
+\see Texture::GetSparseProperties
+\see MiscFlags::Sparse
+*/
+struct SparseTextureProperties
+{
+    //! Extent (in texels) of a single tile. Regions of tile mappings must be aligned to this extent.
+    Extent3D        tileSize;
+
+    /**
+    \brief Number of MIP-map levels that can be mapped tile by tile.
+    \remarks All MIP-map levels from this index on are packed into the MIP tail, which can only be mapped as a whole per array layer.
+    If this is equal to the number of MIP-map levels of the texture, the texture has no MIP tail.
+    */
+    std::uint32_t   numStandardMips = 0;
+
+    //! Size (in bytes) of device memory that is committed for a single tile.
+    std::uint64_t   tileMemorySize  = 0;
+};
+
+/**
+\brief Tile mapping structure for sparse textures.
+\see CommandQueue::UpdateTileMappings
+*/
+struct SparseTextureMapping
+{
+    /**
+    \brief Texture region (in texels) whose tiles are to be mapped or unmapped.
+    \remarks The offset must be a multiple of the tile size and the extent must either be a multiple of the tile size or reach the edge of the MIP-map level.
+    \remarks If the MIP-map level is greater than or equal to SparseTextureProperties::numStandardMips,
+    the entire MIP tail of each array layer in this region is mapped and the offset and extent are ignored.
+    \see SparseTextureProperties::tileSize
+    */
+    TextureRegion   region;
+
+    /**
+    \brief Specifies whether device memory is committed to the tiles of this region or released from them. By default true.
+    \remarks The content of newly committed tiles is undefined. Sampling unmapped tiles returns undefined values on some devices and zero on others.
+    */
+    bool            commit  = true;
+};
+
 
 /* ----- Functions ----- */
 
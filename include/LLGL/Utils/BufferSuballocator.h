@@ -0,0 +1,146 @@
+/*
+ * BufferSuballocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BUFFER_SUBALLOCATOR_H
+#define LLGL_BUFFER_SUBALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/BufferFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Buffer;
+
+/**
+\brief Slice of a buffer that has been allocated by a BufferSuballocator.
+\see BufferSuballocator::Allocate
+*/
+struct BufferSlice
+{
+    //! Buffer this slice is located in. This is null if the allocation failed.
+    Buffer*         buffer  = nullptr;
+
+    //! Offset (in bytes) from the beginning of the buffer. This can be passed to CommandBuffer::SetVertexBuffer for instance.
+    std::uint64_t   offset  = 0;
+
+    //! Size (in bytes) of this slice.
+    std::uint64_t   size    = 0;
+
+    //! Returns true if this slice refers to a buffer.
+    inline bool IsValid() const
+    {
+        return (buffer != nullptr);
+    }
+};
+
+/**
+\brief Buffer suballocator statistics structure.
+\see BufferSuballocator::GetStatistics
+*/
+struct BufferSuballocatorStatistics
+{
+    //! Number of hardware buffers that are currently owned by the suballocator.
+    std::uint32_t numBlocks         = 0;
+
+    //! Number of slices that are currently allocated.
+    std::uint32_t numSlices         = 0;
+
+    //! Total size (in bytes) of all hardware buffers.
+    std::uint64_t totalSize         = 0;
+
+    //! Size (in bytes) of all slices that are currently allocated.
+    std::uint64_t allocatedSize     = 0;
+};
+
+/**
+\brief Utility class to allocate many small slices, e.g. for the vertices of small meshes, from a few large buffers.
+\remarks This reduces the number of hardware buffers and the number of buffer bindings between draw calls,
+since meshes that share the same buffer only differ in the binding offset or the base vertex of their draw commands.
+\remarks Buffers are created on demand with the descriptor this suballocator was initialized with.
+Free ranges within each buffer are allocated first-fit and adjacent free ranges are merged when a slice is freed.
+Slices that are larger than the block size get their own buffer.
+\remarks This class is not thread-safe.
+\see CommandBuffer::SetVertexBuffer
+\see RenderSystem::WriteBuffer
+*/
+class LLGL_EXPORT BufferSuballocator : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Default size (in bytes) of each hardware buffer. This is 4 MB.
+        static constexpr std::uint64_t defaultBlockSize = 4ull * 1024ull * 1024ull;
+
+        //! Minimum alignment (in bytes) of each slice. This matches the alignment requirement of vertex buffer binding offsets.
+        static constexpr std::uint64_t minAlignment = 4;
+
+    public:
+
+        /**
+        \brief Initializes the suballocator for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create the hardware buffers. This must outlive the suballocator.
+        \param[in] bufferDesc Specifies the descriptor for all hardware buffers. The \c size field is ignored.
+        The vertex attributes of this descriptor are copied, so they don't need to outlive this call.
+        \param[in] blockSize Specifies the size (in bytes) of each hardware buffer. By default defaultBlockSize.
+        */
+        BufferSuballocator(
+            RenderSystem&           renderSystem,
+            const BufferDescriptor& bufferDesc,
+            std::uint64_t           blockSize   = defaultBlockSize
+        );
+
+        //! Releases all hardware buffers of this suballocator. All slices become invalid.
+        ~BufferSuballocator();
+
+    public:
+
+        /**
+        \brief Allocates a new slice of the specified size.
+        \param[in] size Specifies the size (in bytes) of the slice. This must not be zero.
+        \param[in] alignment Specifies the alignment (in bytes) of the slice offset. This is rounded up to minAlignment.
+        For vertex data that is drawn with a base vertex instead of a binding offset, this should be the vertex stride.
+        \return Slice that was allocated or an invalid slice if the size is zero or the hardware buffer could not be created.
+        */
+        BufferSlice Allocate(std::uint64_t size, std::uint64_t alignment = minAlignment);
+
+        /**
+        \brief Returns the specified slice to this suballocator.
+        \remarks The slice must have been allocated by this suballocator and the GPU must no longer use it.
+        Invalid slices are ignored.
+        */
+        void Free(const BufferSlice& slice);
+
+        //! Releases all hardware buffers that have no allocated slices left. Returns the number of buffers that have been released.
+        std::uint32_t ReleaseUnusedBlocks();
+
+        //! Returns the current statistics of this suballocator.
+        BufferSuballocatorStatistics GetStatistics() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
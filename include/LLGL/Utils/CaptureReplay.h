@@ -0,0 +1,79 @@
+/*
+ * CaptureReplay.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CAPTURE_REPLAY_H
+#define LLGL_CAPTURE_REPLAY_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/ForwardDecls.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+//! Descriptor structure for the replay of a command stream capture.
+struct CaptureReplayDescriptor
+{
+    //! Number of times the entire capture is replayed. All objects are re-created for each loop. By default 1.
+    std::uint32_t   numLoops    = 1;
+
+    /**
+    \brief Specifies whether to wait for the command queue to become idle after each frame. By default true.
+    \remarks If enabled, the frame times include the GPU time of each frame. Otherwise, they only measure the CPU time of the replay.
+    */
+    bool            waitIdle    = true;
+
+    //! Specifies whether to show the windows that are created for the captured swap-chains. By default true.
+    bool            showWindows = true;
+};
+
+//! Result structure of the replay of a command stream capture.
+struct CaptureReplayResult
+{
+    //! Elapsed time (in seconds) of each replayed frame, i.e. from one SwapChain::Present call to the next, for all loops.
+    std::vector<double> frameTimes;
+
+    //! Number of commands that have been replayed.
+    std::uint64_t       numCommands         = 0;
+
+    //! Number of commands that have been skipped, because they are not supported by the capture or refer to objects that could not be created.
+    std::uint64_t       numSkippedCommands  = 0;
+};
+
+/**
+\brief Replays a command stream capture with the specified render system.
+\param[in] renderSystem Specifies the render system to replay the capture with. This can be a different backend than the one the capture was recorded with.
+\param[in] filename Specifies the capture file that was written by the debug layer.
+\param[in] replayDesc Specifies the replay settings.
+\param[out] outResult Receives the frame times and command statistics of the replay.
+\param[out] report Optional pointer to a report that receives all errors of the replay.
+\return True on success. Otherwise, the capture file could not be read or is corrupted.
+\remarks All resources, command buffer submissions, and SwapChain::Present calls are replayed in the order they have been captured.
+Command buffers are submitted to the primary command queue. Shaders can only be replayed on backends that accept the captured shader language or binary format.
+\see RenderingDebugger::SetCapture
+*/
+LLGL_EXPORT bool ReplayCapture(
+    RenderSystem&                   renderSystem,
+    const char*                     filename,
+    const CaptureReplayDescriptor&  replayDesc,
+    CaptureReplayResult&            outResult,
+    Report*                         report      = nullptr
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
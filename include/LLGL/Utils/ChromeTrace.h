@@ -0,0 +1,46 @@
+/*
+ * ChromeTrace.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CHROME_TRACE_H
+#define LLGL_CHROME_TRACE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Container/UTF8String.h>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Converts the time records of the specified frame profiles into the Chrome trace event format (JSON).
+\param[in] frameProfiles Specifies the frame profiles in chronological order, e.g. one per RenderingDebugger::FlushProfile call.
+\return JSON string that can be loaded into \c chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+\remarks The output contains three processes:
+- \b Frames: One span per frame profile that covers all of its CPU time records.
+- \b CPU: One track for the command queue (submissions) and one track per command buffer (encoded commands), see ProfileTimeRecord::commandBufferID.
+- \b GPU: One track with the GPU time of each recorded command.
+\remarks The debug layer only measures the elapsed GPU time of each command but not when it started on the GPU.
+The GPU spans are therefore placed back-to-back, but never before the end of the CPU span of the same command.
+\remarks Time records are only available if the render system was loaded with a RenderingDebugger that has time recording enabled.
+\see RenderingDebugger::SetTimeRecording
+\see FrameProfile::timeRecords
+*/
+LLGL_EXPORT UTF8String ToChromeTrace(const ArrayView<FrameProfile>& frameProfiles);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,259 @@
+/*
+ * ConstantBufferBuilder.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CONSTANT_BUFFER_BUILDER_H
+#define LLGL_CONSTANT_BUFFER_BUILDER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Container/StringView.h>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Memory layout rules for constant buffers.
+\see ConstantBufferBuilder
+*/
+enum class ConstantBufferPacking
+{
+    /**
+    \brief GLSL \c std140 layout for uniform blocks.
+    \remarks Arrays, matrix columns, and the total size are rounded up to 16 bytes. A \c vec3 is aligned like a \c vec4.
+    */
+    Std140,
+
+    /**
+    \brief GLSL \c std430 layout for shader storage blocks and Vulkan push constants.
+    \remarks Same as Std140 except that arrays and matrix columns are not rounded up to 16 bytes, e.g. a \c float[4] occupies 16 bytes.
+    */
+    Std430,
+
+    /**
+    \brief HLSL \c cbuffer packing rules (with column-major matrices).
+    \remarks Vectors must not straddle a 16-byte boundary. Array elements and matrix columns start at 16-byte boundaries.
+    The padding after the last element of an array can be occupied by the next field.
+    */
+    HLSL,
+
+    /**
+    \brief Layout of the data that is passed to CommandBuffer::SetUniforms.
+    \remarks Fields are tightly packed except that array elements are aligned to 16 bytes, which matches the size of each uniform that SetUniforms consumes.
+    */
+    Uniforms,
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Constant buffer field structure with the compiled layout of a single uniform.
+\see ConstantBufferBuilder::GetFields
+*/
+struct ConstantBufferField
+{
+    //! Name of the uniform. \see UniformDescriptor::name
+    std::string     name;
+
+    //! Type of the uniform. \see UniformDescriptor::type
+    UniformType     type            = UniformType::Undefined;
+
+    //! Number of array elements. This is 1 for non-array uniforms.
+    std::uint32_t   numElements     = 1;
+
+    //! Offset (in bytes) of this field within the constant buffer.
+    std::uint32_t   offset          = 0;
+
+    //! Size (in bytes) of this field within the constant buffer, including the padding between its array elements and matrix columns.
+    std::uint32_t   size            = 0;
+
+    //! Stride (in bytes) between two array elements.
+    std::uint32_t   elementStride   = 0;
+
+    //! Stride (in bytes) between two matrix columns. This is only used for matrix types.
+    std::uint32_t   columnStride    = 0;
+
+    //! Number of matrix columns. This is 1 for scalar and vector types.
+    std::uint32_t   numColumns      = 1;
+
+    //! Number of components per column, i.e. the number of matrix rows or vector components.
+    std::uint32_t   numRows         = 1;
+
+    //! Size (in bytes) of each component, i.e. 4 for \c float, \c int, \c uint, and \c bool and 8 for \c double.
+    std::uint32_t   componentSize   = 4;
+
+    //! Offset (in bytes) of this field within the packed CPU data that is passed to ConstantBufferBuilder::WriteAll.
+    std::uint32_t   packedOffset    = 0;
+
+    //! Returns the size (in bytes) of a single array element without padding. \see ConstantBufferBuilder::Write
+    inline std::uint32_t GetPackedElementSize() const
+    {
+        return (numColumns * numRows * componentSize);
+    }
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class to fill constant buffers from the uniform descriptions of a shader.
+\remarks The layout is compiled once from a list of uniforms, e.g. ShaderReflection::uniforms or the uniforms of a PipelineLayoutDescriptor,
+into a table of offsets and strides according to the specified packing rules.
+Afterwards, uniform values can be written with tightly packed CPU data and the builder inserts the padding for \c vec3 types, matrix columns, and array elements.
+\remarks The destination can be any CPU memory that is uploaded with RenderSystem::WriteBuffer or CommandBuffer::UpdateBuffer,
+a region of a mapped ring buffer that is bound with a dynamic offset, or the data that is passed to CommandBuffer::SetUniforms when the packing is ConstantBufferPacking::Uniforms.
+The builder never reads from the destination memory, so it can be used with write-combined memory that was mapped with CPUAccess::WriteDiscard.
+\remarks Matrices follow the GLSL naming convention, i.e. UniformType::Float4x3 has 4 columns with 3 rows each,
+and are stored column-major in the constant buffer. Sources in row-major order can be transposed while they are written.
+\remarks Uniforms of type UniformType::Sampler, UniformType::Image, and UniformType::AtomicCounter are ignored since they do not occupy constant buffer memory.
+\remarks This class is immutable after construction, so it can be used by multiple threads at once.
+\see ConstantBufferPacking
+*/
+class LLGL_EXPORT ConstantBufferBuilder : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Field index that is returned by FindField if a field could not be found.
+        static constexpr std::uint32_t invalidField = ~0u;
+
+    public:
+
+        /**
+        \brief Compiles the constant buffer layout for the specified list of uniforms.
+        \param[in] uniforms Specifies the uniforms in the order they are declared within the constant buffer.
+        \param[in] packing Specifies the layout rules. By default ConstantBufferPacking::Std140.
+        */
+        ConstantBufferBuilder(const ArrayView<UniformDescriptor>& uniforms, ConstantBufferPacking packing = ConstantBufferPacking::Std140);
+
+        ~ConstantBufferBuilder();
+
+    public:
+
+        //! Returns the size (in bytes) of the constant buffer, including the trailing padding that is required by the packing rules.
+        std::uint32_t GetSize() const;
+
+        //! Returns the size (in bytes) of the tightly packed CPU data that is passed to WriteAll.
+        std::uint32_t GetPackedSize() const;
+
+        //! Returns the packing rules this layout was compiled with.
+        ConstantBufferPacking GetPacking() const;
+
+        //! Returns the list of all compiled fields in declaration order.
+        ArrayView<ConstantBufferField> GetFields() const;
+
+        /**
+        \brief Returns the index of the field with the specified name or invalidField if there is no such field.
+        \remarks Field lookups should be done once at load time, since the returned index can be reused for every write.
+        */
+        std::uint32_t FindField(const StringView& name) const;
+
+    public:
+
+        /**
+        \brief Writes the values of the specified field into the constant buffer.
+        \param[out] dst Pointer to the beginning of the constant buffer. This must refer to at least GetSize() bytes.
+        \param[in] field Specifies the field index. \see FindField
+        \param[in] data Pointer to the tightly packed source data, i.e. \c count elements of ConstantBufferField::GetPackedElementSize bytes each.
+        Matrices must be stored column-major. Booleans must be stored as 32-bit integers.
+        \param[in] count Specifies the number of array elements that are written. This is clamped to the remaining number of elements. By default 1.
+        \param[in] firstElement Specifies the zero-based index of the first array element that is written. By default 0.
+        \return Number of array elements that have been written.
+        */
+        std::uint32_t Write(void* dst, std::uint32_t field, const void* data, std::uint32_t count = 1, std::uint32_t firstElement = 0) const;
+
+        /**
+        \brief Writes the values of the specified matrix field into the constant buffer.
+        \param[out] dst Pointer to the beginning of the constant buffer.
+        \param[in] field Specifies the field index of a single-precision matrix.
+        \param[in] data Pointer to the tightly packed source matrices.
+        \param[in] count Specifies the number of array elements that are written. By default 1.
+        \param[in] rowMajor Specifies whether the source matrices are stored row-major. If true, they are transposed while being written. By default false.
+        \return Number of array elements that have been written, or zero if the field is not a single-precision matrix.
+        \remarks 4x4 matrices are transposed with SIMD instructions where available.
+        */
+        std::uint32_t WriteMatrix(void* dst, std::uint32_t field, const float* data, std::uint32_t count = 1, bool rowMajor = false) const;
+
+        /**
+        \brief Writes all fields into the constant buffer with a single pass of precompiled copy operations.
+        \param[out] dst Pointer to the beginning of the constant buffer. This must refer to at least GetSize() bytes.
+        \param[in] packedData Pointer to the tightly packed CPU data of all fields in declaration order. This must refer to at least GetPackedSize() bytes.
+        \remarks Adjacent copies that are contiguous in both source and destination are merged when the layout is compiled,
+        so this degenerates to a single copy if the layout has no padding. Padding bytes in the destination are not written.
+        \see ConstantBufferField::packedOffset
+        */
+        void WriteAll(void* dst, const void* packedData) const;
+
+    public:
+
+        //! Writes a single \c float value. \see Write
+        inline void SetFloat(void* dst, std::uint32_t field, float value) const
+        {
+            Write(dst, field, &value);
+        }
+
+        //! Writes a single \c int value. \see Write
+        inline void SetInt(void* dst, std::uint32_t field, std::int32_t value) const
+        {
+            Write(dst, field, &value);
+        }
+
+        //! Writes a single \c uint value. \see Write
+        inline void SetUInt(void* dst, std::uint32_t field, std::uint32_t value) const
+        {
+            Write(dst, field, &value);
+        }
+
+        //! Writes a single \c bool value as 32-bit integer. \see Write
+        inline void SetBool(void* dst, std::uint32_t field, bool value) const
+        {
+            const std::uint32_t intValue = (value ? 1u : 0u);
+            Write(dst, field, &intValue);
+        }
+
+        /**
+        \brief Writes single-precision vectors or matrices from a plain array of floats.
+        \param[in] values Pointer to the tightly packed source values. Matrices must be stored column-major.
+        \param[in] numValues Specifies the number of values. Only whole array elements are written, so this should be a multiple of the number of components of the field type.
+        \return Number of array elements that have been written. \see Write
+        */
+        std::uint32_t SetFloats(void* dst, std::uint32_t field, const float* values, std::size_t numValues) const;
+
+        //! Writes a single-precision vector, matrix, or array from a static array of floats. \see SetFloats
+        template <std::size_t N>
+        inline std::uint32_t SetFloats(void* dst, std::uint32_t field, const float (&values)[N]) const
+        {
+            return SetFloats(dst, field, values, N);
+        }
+
+    private:
+
+        Pimpl* pimpl_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
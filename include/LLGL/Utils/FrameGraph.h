@@ -0,0 +1,243 @@
+/*
+ * FrameGraph.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_GRAPH_H
+#define LLGL_FRAME_GRAPH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Constants.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class RenderTarget;
+class Texture;
+class Buffer;
+
+/**
+\brief Handle to a resource that has been declared in a FrameGraph.
+\remarks Handles are only valid for the frame they have been declared in, i.e. until the next call to FrameGraph::Execute or FrameGraph::Reset.
+\see FrameGraph::CreateTexture
+\see FrameGraph::CreateBuffer
+\see FrameGraph::ImportTexture
+\see FrameGraph::ImportBuffer
+*/
+struct FrameGraphResource
+{
+    //! Internal index of the resource. By default invalid, i.e. <code>~0u</code>.
+    std::uint32_t id = ~0u;
+
+    //! Returns true if this handle refers to a resource.
+    inline bool IsValid() const
+    {
+        return (id != ~0u);
+    }
+};
+
+/**
+\brief Frame graph pass descriptor structure.
+\remarks A pass that renders into attachments must not specify a render target and vice versa.
+If neither attachments nor a render target are specified, the pass is recorded outside of a render pass, e.g. for compute or copy commands.
+\see FrameGraph::AddPass
+*/
+struct FrameGraphPassDescriptor
+{
+    //! Optional name of the pass. If this is not null, the pass is recorded inside a debug group of this name.
+    const char*                         name                                        = nullptr;
+
+    //! Resources that are read by this pass, e.g. sampled textures or constant buffers.
+    std::vector<FrameGraphResource>     reads;
+
+    //! Resources that are written by this pass outside of the render target attachments, e.g. storage buffers or copy destinations.
+    std::vector<FrameGraphResource>     writes;
+
+    //! Textures that are used as color attachments. Attachments must be specified consecutively beginning with the first one.
+    FrameGraphResource                  colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    //! Texture that is used as depth-stencil attachment.
+    FrameGraphResource                  depthStencilAttachment;
+
+    /**
+    \brief Optional external render target, e.g. a SwapChain. By default null.
+    \remarks Passes that render into an external render target are never culled.
+    */
+    RenderTarget*                       renderTarget                                = nullptr;
+
+    /**
+    \brief Attachments that are cleared at the beginning of the render pass.
+    \remarks The content of transient attachments is undefined when they are written for the first time in a frame,
+    so each such attachment must either be cleared here or be entirely overwritten by the pass.
+    \see CommandBuffer::ClearAttachments
+    */
+    std::vector<AttachmentClear>        clears;
+
+    /**
+    \brief Specifies whether this pass has side effects that are not expressed by its resources. By default false.
+    \remarks Passes with side effects are never culled, e.g. passes that write query results or read back data to the CPU.
+    */
+    bool                                sideEffects                                 = false;
+};
+
+/**
+\brief Frame graph statistics structure.
+\see FrameGraph::GetStatistics
+*/
+struct FrameGraphStatistics
+{
+    //! Number of passes that have been declared in the last executed frame.
+    std::uint32_t numPasses             = 0;
+
+    //! Number of passes that have been culled in the last executed frame, because none of their results were used.
+    std::uint32_t numCulledPasses       = 0;
+
+    //! Number of transient resources that have been declared in the last executed frame.
+    std::uint32_t numTransientResources = 0;
+
+    //! Number of hardware textures that are currently owned by the frame graph.
+    std::uint32_t numTextures           = 0;
+
+    //! Number of hardware buffers that are currently owned by the frame graph.
+    std::uint32_t numBuffers            = 0;
+
+    //! Number of aliasing groups that have been used for transient attachments in the last executed frame.
+    std::uint32_t numAliasingGroups     = 0;
+};
+
+/**
+\brief Callback to record the commands of a frame graph pass.
+\remarks Resources of the pass can be retrieved with FrameGraph::GetTexture and FrameGraph::GetBuffer within this callback.
+\see FrameGraph::AddPass
+*/
+using FrameGraphExecuteFunction = std::function<void(CommandBuffer& cmdBuffer)>;
+
+/**
+\brief Frame graph to schedule render passes and their transient resources.
+\remarks Each frame, passes are declared with the resources they read and write. When the frame graph is executed, it
+- culls all passes whose results are neither read by another pass nor written to an imported resource or an external render target,
+- determines the lifetime of each transient resource from the first to the last pass that uses it,
+- assigns hardware resources to transient resources, whereby resources with disjoint lifetimes share the same hardware resource or memory,
+- records all remaining passes in declaration order including their render pass sections.
+\remarks Transient attachment textures are created with MiscFlags::Transient and are distributed over aliasing groups, so attachments with disjoint lifetimes share their memory
+on backends that support memory aliasing (see TextureDescriptor::aliasingGroup). All other transient resources are recycled when they have the same descriptor.
+Hardware resources are cached across frames and only released after they have not been used for several frames.
+\remarks Resource state transitions and barriers between passes are handled by the backends when resources are bound.
+Resource heaps should not refer to transient resources, since their hardware resources may change between frames.
+\see RenderSystem::CreateTexture
+\see MiscFlags::Transient
+*/
+class LLGL_EXPORT FrameGraph : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Default number of frames hardware resources can remain unused before they are released.
+        static constexpr std::uint32_t defaultMaxUnusedFrames = 3;
+
+        //! Default first aliasing group for transient attachments. This should not collide with aliasing groups of textures the application creates itself.
+        static constexpr std::uint32_t defaultFirstAliasingGroup = 0x00010000u;
+
+    public:
+
+        /**
+        \brief Initializes the frame graph for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create the hardware resources. This must outlive the frame graph.
+        \param[in] maxUnusedFrames Specifies the number of frames a cached hardware resource can remain unused before it is released.
+        This must be greater than the number of frames that are in flight on the GPU.
+        \param[in] firstAliasingGroup Specifies the first aliasing group that is used for transient attachments.
+        */
+        FrameGraph(
+            RenderSystem&   renderSystem,
+            std::uint32_t   maxUnusedFrames     = defaultMaxUnusedFrames,
+            std::uint32_t   firstAliasingGroup  = defaultFirstAliasingGroup
+        );
+
+        //! Releases all hardware resources of this frame graph.
+        ~FrameGraph();
+
+    public:
+
+        /**
+        \brief Declares a transient texture for the current frame.
+        \remarks The hardware texture is only available during the execution of passes that use this resource.
+        The \c debugName of the descriptor is only used when a new hardware texture is created.
+        \see GetTexture
+        */
+        FrameGraphResource CreateTexture(const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Declares a transient buffer for the current frame.
+        \remarks Transient buffers are always created without initial data.
+        \see GetBuffer
+        */
+        FrameGraphResource CreateBuffer(const BufferDescriptor& bufferDesc);
+
+        //! Imports an external texture for the current frame. Passes that write to imported resources are never culled.
+        FrameGraphResource ImportTexture(Texture& texture);
+
+        //! Imports an external buffer for the current frame. Passes that write to imported resources are never culled.
+        FrameGraphResource ImportBuffer(Buffer& buffer);
+
+        /**
+        \brief Declares a pass for the current frame.
+        \param[in] passDesc Specifies the pass descriptor.
+        \param[in] execute Specifies the callback that records the commands of this pass. This is not called if the pass is culled.
+        */
+        void AddPass(const FrameGraphPassDescriptor& passDesc, const FrameGraphExecuteFunction& execute);
+
+        /**
+        \brief Compiles the frame graph and records all passes that have not been culled into the specified command buffer.
+        \remarks This must be called between CommandBuffer::Begin and CommandBuffer::End and outside of a render pass.
+        Afterwards, all declared passes and resources are discarded and the next frame can be declared.
+        */
+        void Execute(CommandBuffer& cmdBuffer);
+
+        //! Discards all declared passes and resources of the current frame without executing them.
+        void Reset();
+
+        //! Releases all cached hardware resources. This must not be called while the frame graph is being executed.
+        void ReleaseResources();
+
+    public:
+
+        //! Returns the hardware texture of the specified resource or null if the resource is not a texture or has no hardware texture assigned.
+        Texture* GetTexture(const FrameGraphResource& resource) const;
+
+        //! Returns the hardware buffer of the specified resource or null if the resource is not a buffer or has no hardware buffer assigned.
+        Buffer* GetBuffer(const FrameGraphResource& resource) const;
+
+        //! Returns the statistics of the last executed frame.
+        const FrameGraphStatistics& GetStatistics() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,206 @@
+/*
+ * GPUCulling.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GPU_CULLING_H
+#define LLGL_GPU_CULLING_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class Buffer;
+class Texture;
+class Shader;
+class Report;
+
+/**
+\brief Per-instance input structure for the GPU culling utility.
+\remarks The instance buffer that is passed to GPUCulling::Cull is an array of this structure,
+i.e. it must have been created with the binding flag BindFlags::Sampled and a stride of <code>sizeof(GPUCullingInstance)</code>.
+\see GPUCulling::Cull
+*/
+struct GPUCullingInstance
+{
+    //! Bounding sphere in world space: center in the first three components and radius in the fourth component.
+    float           boundingSphere[4];
+
+    //! Number of indices that are drawn for this instance if it is visible. \see DrawIndexedIndirectArguments::numIndices
+    std::uint32_t   numIndices;
+
+    //! Zero-based index of the first index. \see DrawIndexedIndirectArguments::firstIndex
+    std::uint32_t   firstIndex;
+
+    //! Base vertex offset. \see DrawIndexedIndirectArguments::vertexOffset
+    std::int32_t    vertexOffset;
+
+    /**
+    \brief Zero-based index of the first instance. This can be used to look up per-instance data in the vertex shader.
+    \see DrawIndexedIndirectArguments::firstInstance
+    */
+    std::uint32_t   firstInstance;
+};
+
+/**
+\brief GPU culling descriptor structure.
+\see GPUCulling::GPUCulling
+*/
+struct GPUCullingDescriptor
+{
+    /**
+    \brief Depth texture the Hi-Z pyramid is built from. This must have been created with the binding flag BindFlags::Sampled.
+    \remarks The Hi-Z pyramid has half the extent of this texture. The depth texture can be changed later with GPUCulling::SetDepthTexture.
+    */
+    Texture*        depthTexture    = nullptr;
+
+    //! Maximum number of instances that can be culled with a single call to GPUCulling::Cull. This determines the size of the draw arguments buffer.
+    std::uint32_t   maxInstances    = 0;
+
+    /**
+    \brief Specifies whether the depth buffer uses reverse depth, i.e. the far plane is at depth 0 and the near plane at depth 1. By default false.
+    \remarks This determines whether the Hi-Z pyramid stores the minimum or maximum depth values.
+    */
+    bool            reverseDepth    = false;
+
+    /**
+    \brief Optional compute shader for the Hi-Z build pass. If this is null, the built-in shader is compiled at runtime.
+    \remarks This is required if the render system supports neither HLSL, GLSL, nor Metal, e.g. for Vulkan with SPIR-V only.
+    \see GPUCulling::GetShaderSource
+    */
+    Shader*         buildHiZShader  = nullptr;
+
+    /**
+    \brief Optional compute shader for the culling pass. If this is null, the built-in shader is compiled at runtime.
+    \see buildHiZShader
+    */
+    Shader*         cullShader      = nullptr;
+};
+
+/**
+\brief Utility class for GPU driven frustum and Hi-Z occlusion culling.
+\remarks This builds a hierarchical depth (Hi-Z) pyramid from a depth texture and culls a buffer of GPUCullingInstance entries on the GPU.
+Each visible instance is appended as DrawIndexedIndirectArguments to the draw arguments buffer and the number of visible instances is written to the draw count buffer.
+Since the arguments are compacted on the GPU, they can be drawn with a single indirect draw command and without any readback to the CPU.
+\remarks A typical frame renders the occluders (or reuses the depth buffer of the previous frame), calls BuildHiZ and Cull outside of a render pass,
+and then calls DrawIndexedIndirect inside the render pass.
+\remarks The compute shaders are compiled from the built-in HLSL (\c cs_5_0), GLSL (\c 430), or Metal sources when this utility is constructed.
+\remarks This class is not thread-safe.
+\see CommandBuffer::DrawIndexedIndirectCount
+*/
+class LLGL_EXPORT GPUCulling : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Number of bytes between two entries in the draw arguments buffer. This is <code>sizeof(DrawIndexedIndirectArguments)</code>.
+        static constexpr std::uint32_t drawArgsStride = 20;
+
+    public:
+
+        /**
+        \brief Creates the Hi-Z pyramid, the draw arguments buffers, and the compute pipelines.
+        \param[in] renderSystem Specifies the render system that is used to create all resources. This must outlive the GPU culling utility.
+        \param[in] desc Specifies the GPU culling descriptor.
+        \param[out] report Optional pointer to a report that receives the errors of shader compilation or pipeline creation.
+        \remarks Use IsValid to determine whether the utility was created successfully.
+        */
+        GPUCulling(RenderSystem& renderSystem, const GPUCullingDescriptor& desc, Report* report = nullptr);
+
+        //! Releases all resources that were created by this utility.
+        ~GPUCulling();
+
+    public:
+
+        /**
+        \brief Returns the built-in compute shader source for the specified shading language or null if there is none.
+        \param[in] language Specifies the shading language. This can be ShadingLanguage::HLSL, ShadingLanguage::GLSL, or ShadingLanguage::Metal.
+        \remarks This can be used to compile the shaders offline, e.g. to SPIR-V. The following macros configure the shaders:
+        - \c GPU_CULLING_BUILD_HIZ selects the Hi-Z build pass in GLSL. HLSL and Metal use the entry points \c "BuildHiZ" and \c "Cull" instead.
+        - \c GPU_CULLING_REVERSE_DEPTH must be defined if GPUCullingDescriptor::reverseDepth is true.
+        - \c GPU_CULLING_DEPTH_MINUS_ONE_TO_ONE must be defined if RenderingCapabilities::clippingRange is ClippingRange::MinusOneToOne.
+        - \c GPU_CULLING_LOWER_LEFT_ORIGIN must be defined if RenderingCapabilities::screenOrigin is ScreenOrigin::LowerLeft.
+        */
+        static const char* GetShaderSource(const ShadingLanguage language);
+
+        //! Returns true if all resources and compute pipelines were created successfully.
+        bool IsValid() const;
+
+        /**
+        \brief Replaces the depth texture the Hi-Z pyramid is built from.
+        \remarks If the new texture has a different extent, the Hi-Z pyramid is recreated.
+        */
+        void SetDepthTexture(Texture& depthTexture);
+
+        /**
+        \brief Records the compute dispatches to build the Hi-Z pyramid from the depth texture into the specified command buffer.
+        \remarks This must be recorded outside of a render pass and after the depth texture has been written.
+        */
+        void BuildHiZ(CommandBuffer& cmdBuffer);
+
+        /**
+        \brief Records the compute dispatch to cull the specified instances into the specified command buffer.
+        \param[in] cmdBuffer Specifies the command buffer the culling pass is recorded into. This must be outside of a render pass.
+        \param[in] instanceBuffer Specifies the buffer of GPUCullingInstance entries.
+        \param[in] numInstances Specifies the number of instances. This is clamped to GPUCullingDescriptor::maxInstances.
+        \param[in] viewProjection Specifies the view-projection matrix as 16 floats in column-major order that transforms the bounding spheres into clip space.
+        \param[in] enableOcclusion Specifies whether the instances are tested against the Hi-Z pyramid. Otherwise, only frustum culling is performed.
+        This should be false if the Hi-Z pyramid has not been built yet.
+        \remarks The draw arguments and draw count buffers are cleared before the culling pass, so all unused draw arguments have zero indices.
+        */
+        void Cull(
+            CommandBuffer&  cmdBuffer,
+            Buffer&         instanceBuffer,
+            std::uint32_t   numInstances,
+            const float     viewProjection[16],
+            bool            enableOcclusion = true
+        );
+
+        /**
+        \brief Records the indirect draw command for all visible instances of the last culling pass into the specified command buffer.
+        \remarks This uses CommandBuffer::DrawIndexedIndirectCount if RenderingFeatures::hasIndirectDrawingCount is true.
+        Otherwise, all GPUCullingDescriptor::maxInstances draw arguments are drawn with CommandBuffer::DrawIndexedIndirect,
+        where the culled entries have zero indices.
+        \remarks The graphics pipeline, vertex buffers, and index buffer must be bound before this call.
+        */
+        void DrawIndexedIndirect(CommandBuffer& cmdBuffer);
+
+    public:
+
+        //! Returns the buffer of DrawIndexedIndirectArguments entries that is written by the culling pass.
+        Buffer& GetDrawArgsBuffer() const;
+
+        //! Returns the buffer with the number of visible instances (as 32-bit unsigned integer) that is written by the culling pass.
+        Buffer& GetDrawCountBuffer() const;
+
+        //! Returns the Hi-Z pyramid texture in Format::R32Float.
+        Texture& GetHiZTexture() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
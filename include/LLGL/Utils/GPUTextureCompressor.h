@@ -0,0 +1,140 @@
+/*
+ * GPUTextureCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GPU_TEXTURE_COMPRESSOR_H
+#define LLGL_GPU_TEXTURE_COMPRESSOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Format.h>
+#include <LLGL/Types.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class Buffer;
+class Texture;
+class Shader;
+class Report;
+
+/**
+\brief GPU texture compressor descriptor structure.
+\see GPUTextureCompressor::GPUTextureCompressor
+*/
+struct GPUTextureCompressorDescriptor
+{
+    /**
+    \brief Maximum extent (in texels) of the textures that can be compressed with a single call to GPUTextureCompressor::Compress.
+    This determines the size of the block buffer.
+    */
+    Extent2D    maxExtent;
+
+    /**
+    \brief Optional compute shader that encodes BC1 blocks. If this is null, the built-in shader is compiled at runtime.
+    \remarks This is required if the render system supports neither HLSL, GLSL, nor Metal, e.g. for Vulkan with SPIR-V only.
+    \see GPUTextureCompressor::GetShaderSource
+    */
+    Shader*     bc1Shader   = nullptr;
+
+    /**
+    \brief Optional compute shader that encodes BC3 blocks. If this is null, the built-in shader is compiled at runtime.
+    \see bc1Shader
+    */
+    Shader*     bc3Shader   = nullptr;
+};
+
+/**
+\brief Utility class to compress textures into block compression formats on the GPU.
+\remarks This is intended for textures that are generated at runtime and updated frequently (e.g. terrain splat maps or baked impostors),
+where compressing them on the CPU is too slow. Each 4x4 block is encoded by one compute thread into a block buffer,
+which is then copied into the compressed texture with CommandBuffer::CopyTextureFromBuffer.
+\remarks The encoders favor speed over quality: BC1 and the color part of BC3 interpolate between the inset bounding box of the block colors,
+and the alpha part of BC3 interpolates between the minimum and maximum alpha value of the block.
+\remarks The compute shaders are compiled from the built-in HLSL (\c cs_5_0), GLSL (\c 430), or Metal sources when this utility is constructed.
+\remarks This class is not thread-safe.
+\see CommandBuffer::CopyTextureFromBuffer
+*/
+class LLGL_EXPORT GPUTextureCompressor : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+    public:
+
+        /**
+        \brief Creates the block buffer and the compute pipelines.
+        \param[in] renderSystem Specifies the render system that is used to create all resources. This must outlive the texture compressor.
+        \param[in] desc Specifies the texture compressor descriptor.
+        \param[out] report Optional pointer to a report that receives the errors of shader compilation or pipeline creation.
+        \remarks Use IsValid to determine whether the utility was created successfully.
+        */
+        GPUTextureCompressor(RenderSystem& renderSystem, const GPUTextureCompressorDescriptor& desc, Report* report = nullptr);
+
+        //! Releases all resources that were created by this utility.
+        ~GPUTextureCompressor();
+
+    public:
+
+        /**
+        \brief Returns the built-in compute shader source for the specified shading language or null if there is none.
+        \param[in] language Specifies the shading language. This can be ShadingLanguage::HLSL, ShadingLanguage::GLSL, or ShadingLanguage::Metal.
+        \remarks This can be used to compile the shaders offline, e.g. to SPIR-V. HLSL and Metal use the entry point \c "CompressBlocks".
+        The following macros configure the shaders:
+        - \c GPU_TEXTURE_COMPRESSOR_BC3 selects the BC3 encoder. Otherwise, the shader encodes BC1 blocks.
+        */
+        static const char* GetShaderSource(const ShadingLanguage language);
+
+        //! Returns true if the specified format can be encoded by this utility, i.e. Format::BC1UNorm, Format::BC3UNorm, and their sRGB variants.
+        static bool IsFormatSupported(const Format format);
+
+        //! Returns true if the block buffer and all compute pipelines were created successfully.
+        bool IsValid() const;
+
+        /**
+        \brief Records the commands to compress a MIP-map of the source texture into the same MIP-map of the destination texture.
+        \param[in] cmdBuffer Specifies the command buffer the commands are recorded into. This must be outside of a render pass.
+        \param[in] srcTexture Specifies the uncompressed 2D source texture. This must have been created with the binding flag BindFlags::Sampled.
+        \param[in] dstTexture Specifies the compressed 2D destination texture. This must have been created with the binding flag BindFlags::CopyDst
+        and a format for which IsFormatSupported returns true.
+        \param[in] mipLevel Specifies the MIP-map that is compressed. By default 0.
+        \return True if the commands have been recorded. Otherwise, the textures are incompatible or the MIP-map exceeds GPUTextureCompressorDescriptor::maxExtent.
+        \remarks The MIP-map must have the same extent in both textures. Texels of the source texture are clamped to [0, 1].
+        If the source texture is in sRGB color space, the texels are converted back to sRGB before they are encoded into an sRGB destination texture.
+        \remarks BC1 blocks are always encoded in the opaque four-color mode, i.e. the alpha channel of the source texture is ignored.
+        \remarks All calls share the same block buffer, so the backend must synchronize the copy of one call with the compute pass of the next call.
+        */
+        bool Compress(CommandBuffer& cmdBuffer, Texture& srcTexture, Texture& dstTexture, std::uint32_t mipLevel = 0);
+
+    public:
+
+        //! Returns the buffer the compute pass encodes the blocks into before they are copied into the destination texture.
+        Buffer& GetBlockBuffer() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,223 @@
+/*
+ * MeshOptimizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MESH_OPTIMIZER_H
+#define LLGL_MESH_OPTIMIZER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Constants.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Mesh optimization flags enumeration.
+\see MeshOptimizerDescriptor::flags
+*/
+struct MeshOptimizerFlags
+{
+    enum
+    {
+        /**
+        \brief Reorders the triangles for the post-transform vertex cache.
+        \see OptimizeVertexCache
+        */
+        VertexCache = (1 << 0),
+
+        /**
+        \brief Reorders the vertices in the order they are first referenced by the indices and removes unreferenced vertices.
+        \remarks This is applied after the vertex cache optimization, so that vertex fetches follow the optimized triangle order.
+        \see OptimizeVertexFetch
+        */
+        VertexFetch = (1 << 1),
+
+        /**
+        \brief Builds meshlets with bounding spheres and normal cones for mesh shaders.
+        \remarks This requires MeshOptimizerMesh::positionOffset to refer to a vertex position of type Format::RGB32Float.
+        \see BuildMeshlets
+        */
+        Meshlets    = (1 << 2),
+
+        //! Applies all of the above optimizations.
+        All         = (VertexCache | VertexFetch | Meshlets),
+    };
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Meshlet structure for mesh shaders.
+\remarks A meshlet is a small cluster of triangles that is processed by one mesh shader work group.
+Its vertices and triangles are stored in separate arrays that are shared by all meshlets of a mesh.
+\see MeshOptimizerMesh::meshlets
+\see BuildMeshlets
+*/
+struct Meshlet
+{
+    //! Zero-based index of the first entry in MeshOptimizerMesh::meshletVertices.
+    std::uint32_t   vertexOffset    = 0;
+
+    //! Zero-based index of the first byte in MeshOptimizerMesh::meshletTriangles. Each triangle occupies three bytes.
+    std::uint32_t   triangleOffset  = 0;
+
+    //! Number of vertices of this meshlet.
+    std::uint32_t   numVertices     = 0;
+
+    //! Number of triangles of this meshlet.
+    std::uint32_t   numTriangles    = 0;
+
+    //! Bounding sphere in object space: center in the first three components and radius in the fourth component.
+    float           boundingSphere[4]   = {};
+
+    /**
+    \brief Normalized axis of the normal cone in object space.
+    \remarks The meshlet is back-facing and can be culled if the following condition holds (with \c center and \c radius from the bounding sphere):
+    <code>dot(center - cameraPosition, coneAxis) >= coneCutoff * length(center - cameraPosition) + radius</code>
+    \remarks Triangle normals are computed for counter-clockwise winding order. Negate this axis if front faces are in clockwise winding order.
+    \see coneCutoff
+    */
+    float           coneAxis[3]         = {};
+
+    //! Cutoff of the normal cone. This is 1 if the triangle normals diverge too much to cull the meshlet. \see coneAxis
+    float           coneCutoff          = 1.0f;
+};
+
+/**
+\brief Mesh optimizer descriptor structure.
+\see OptimizeMeshes
+*/
+struct MeshOptimizerDescriptor
+{
+    //! Specifies which optimizations are applied. This can be a bitwise OR combination of the MeshOptimizerFlags entries. By default MeshOptimizerFlags::All.
+    long            flags               = MeshOptimizerFlags::All;
+
+    /**
+    \brief Specifies the size of the simulated post-transform vertex cache. By default 32.
+    \remarks The exact value is not critical, since modern GPUs do not use a fixed-size FIFO cache, but values between 16 and 32 work well across vendors.
+    */
+    std::uint32_t   cacheSize           = 32;
+
+    /**
+    \brief Specifies the maximum number of vertices per meshlet. This must be in the range [3, 256]. By default 64.
+    \remarks This must not exceed the number of output vertices that is declared in the mesh shader.
+    */
+    std::uint32_t   maxMeshletVertices  = 64;
+
+    /**
+    \brief Specifies the maximum number of triangles per meshlet. This must be in the range [1, 256]. By default 124.
+    \remarks This must not exceed the number of output primitives that is declared in the mesh shader.
+    The default values of 64 vertices and 124 triangles are the recommended limits for most hardware.
+    */
+    std::uint32_t   maxMeshletTriangles = 124;
+};
+
+/**
+\brief Mesh input and output structure for the mesh optimizer.
+\remarks The indices and vertices are optimized in place, so they can be uploaded afterwards with IndexBufferDesc and VertexBufferDesc.
+\see OptimizeMeshes
+*/
+struct MeshOptimizerMesh
+{
+    //! Pointer to the triangle list indices. These are reordered in place.
+    std::uint32_t*              indices         = nullptr;
+
+    //! Number of indices. This must be a multiple of 3.
+    std::size_t                 numIndices      = 0;
+
+    //! Pointer to the interleaved vertex data. These are reordered in place if MeshOptimizerFlags::VertexFetch is specified.
+    void*                       vertices        = nullptr;
+
+    /**
+    \brief Number of vertices. All indices must be less than this value.
+    \remarks This is updated to the number of referenced vertices if MeshOptimizerFlags::VertexFetch is specified.
+    */
+    std::size_t                 numVertices     = 0;
+
+    //! Size (in bytes) of each vertex. \see VertexAttribute::stride
+    std::uint32_t               vertexStride    = 0;
+
+    //! Offset (in bytes) of the vertex position of type Format::RGB32Float within each vertex. This is only used to compute meshlet bounds.
+    std::uint32_t               positionOffset  = 0;
+
+    //! Output list of meshlets if MeshOptimizerFlags::Meshlets is specified.
+    std::vector<Meshlet>        meshlets;
+
+    //! Output list of vertex indices that are referenced by the meshlets. \see Meshlet::vertexOffset
+    std::vector<std::uint32_t>  meshletVertices;
+
+    /**
+    \brief Output list of meshlet local triangle indices, i.e. three bytes per triangle that index into the vertices of its meshlet.
+    \see Meshlet::triangleOffset
+    */
+    std::vector<std::uint8_t>   meshletTriangles;
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Reorders the triangles of a triangle list to improve the hit rate of the post-transform vertex cache.
+\param[in,out] indices Pointer to the triangle list indices that are reordered in place.
+\param[in] numIndices Specifies the number of indices. This must be a multiple of 3.
+\param[in] numVertices Specifies the number of vertices. All indices must be less than this value.
+\param[in] cacheSize Specifies the size of the simulated vertex cache. By default 32.
+\remarks This implements the linear-speed vertex cache optimization by Tom Forsyth,
+which greedily emits the triangle with the highest score according to the cache position and remaining valence of its vertices.
+\remarks Triangles are not additionally sorted to reduce overdraw.
+*/
+LLGL_EXPORT void OptimizeVertexCache(std::uint32_t* indices, std::size_t numIndices, std::size_t numVertices, std::uint32_t cacheSize = 32);
+
+/**
+\brief Reorders the vertices in the order they are first referenced by the indices and remaps the indices accordingly.
+\param[in,out] vertices Pointer to the interleaved vertex data that is reordered in place.
+\param[in] numVertices Specifies the number of vertices.
+\param[in] vertexStride Specifies the size (in bytes) of each vertex.
+\param[in,out] indices Pointer to the indices that are remapped in place.
+\param[in] numIndices Specifies the number of indices.
+\return Number of referenced vertices. Unreferenced vertices are moved to the end of the vertex data and can be discarded.
+\remarks This should be called after OptimizeVertexCache, so that vertex fetches follow the optimized triangle order.
+*/
+LLGL_EXPORT std::size_t OptimizeVertexFetch(void* vertices, std::size_t numVertices, std::uint32_t vertexStride, std::uint32_t* indices, std::size_t numIndices);
+
+/**
+\brief Builds the meshlets for the specified mesh and stores them in its output lists.
+\param[in,out] mesh Specifies the mesh whose indices and vertex positions are read. Its meshlet lists are overwritten.
+\param[in] maxVertices Specifies the maximum number of vertices per meshlet. \see MeshOptimizerDescriptor::maxMeshletVertices
+\param[in] maxTriangles Specifies the maximum number of triangles per meshlet. \see MeshOptimizerDescriptor::maxMeshletTriangles
+\remarks Triangles are added to meshlets in the order of the indices, so this should be called after OptimizeVertexCache for meshlets with good vertex reuse.
+*/
+LLGL_EXPORT void BuildMeshlets(MeshOptimizerMesh& mesh, std::uint32_t maxVertices = 64, std::uint32_t maxTriangles = 124);
+
+/**
+\brief Optimizes the specified meshes concurrently.
+\param[in,out] meshes Pointer to the array of meshes that are optimized in place.
+\param[in] numMeshes Specifies the number of meshes.
+\param[in] desc Specifies the mesh optimizer descriptor.
+\param[in] threadCount Specifies the maximum number of threads. Each mesh is processed by a single thread. By default LLGL_MAX_THREAD_COUNT.
+\remarks This is meant to be called at load time before the meshes are uploaded into vertex and index buffers.
+\see MeshOptimizerFlags
+*/
+LLGL_EXPORT void OptimizeMeshes(MeshOptimizerMesh* meshes, std::size_t numMeshes, const MeshOptimizerDescriptor& desc = {}, unsigned threadCount = LLGL_MAX_THREAD_COUNT);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -97,6 +97,8 @@ class LLGL_EXPORT ParseContext
             - \c geom for the geometry shader stage (i.e. StageFlags::GeometryStage).
             - \c frag for the fragment shader stage (i.e. StageFlags::FragmentStage).
             - \c comp for the compute shader stage (i.e. StageFlags::ComputeStage).
+            - \c task for the task shader stage (i.e. StageFlags::TaskStage).
+            - \c mesh for the mesh shader stage (i.e. StageFlags::MeshStage).
         - If no stage flag is specified, all shader stages will be used.
         - The following syntax can be used for uniform descriptors (see LLGL::UniformType for accepted type names):
             \code
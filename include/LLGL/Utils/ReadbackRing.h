@@ -0,0 +1,181 @@
+/*
+ * ReadbackRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_READBACK_RING_H
+#define LLGL_READBACK_RING_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/TextureFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class CommandQueue;
+class Buffer;
+class Texture;
+
+/**
+\brief Ticket for a readback that has been recorded by a ReadbackRing.
+\see ReadbackRing::ReadBuffer
+\see ReadbackRing::ReadTexture
+*/
+struct ReadbackTicket
+{
+    //! Internal index of the readback. By default invalid, i.e. <code>~0u</code>.
+    std::uint32_t id = ~0u;
+
+    //! Returns true if this ticket refers to a readback.
+    inline bool IsValid() const
+    {
+        return (id != ~0u);
+    }
+};
+
+/**
+\brief Readback ring statistics structure.
+\see ReadbackRing::GetStatistics
+*/
+struct ReadbackRingStatistics
+{
+    //! Number of readback buffers that are currently owned by the ring.
+    std::uint32_t numBlocks     = 0;
+
+    //! Number of tickets that have not been released yet.
+    std::uint32_t numTickets    = 0;
+
+    //! Total size (in bytes) of all readback buffers.
+    std::uint64_t totalSize     = 0;
+};
+
+/**
+\brief Utility class to read back buffer and texture data from the GPU without stalling the CPU.
+\remarks Readbacks are recorded as copy commands into readback buffers (see CPUAccessFlags::Read) and each readback returns a ticket.
+After the command buffer has been submitted, Submit must be called to submit a Fence for all readbacks recorded since the last call.
+The CPU can then poll each ticket with IsReady and read its data with Read once the fence has been signaled.
+\remarks Readbacks that are recorded between two calls to Submit share the same readback buffer, which is only recycled
+after all of its tickets have been released and its fence has been signaled. This way, the CPU never maps a buffer the GPU might still write to.
+\remarks This class is not thread-safe.
+\see CommandBuffer::CopyBuffer
+\see CommandBuffer::CopyBufferFromTexture
+\see CommandQueue::WaitFence
+*/
+class LLGL_EXPORT ReadbackRing : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Default size (in bytes) of each readback buffer. This is 1 MB.
+        static constexpr std::uint64_t defaultBlockSize = 1024ull * 1024ull;
+
+        //! Minimum alignment (in bytes) of each buffer readback within a readback buffer.
+        static constexpr std::uint64_t minAlignment = 4;
+
+        //! Alignment (in bytes) of each texture readback. This matches the strictest placement alignment of all backends (Direct3D 12).
+        static constexpr std::uint64_t textureAlignment = 512;
+
+    public:
+
+        /**
+        \brief Initializes the readback ring for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create the readback buffers and fences. This must outlive the readback ring.
+        \param[in] blockSize Specifies the size (in bytes) of each readback buffer. Readbacks that are larger than this get their own buffer. By default defaultBlockSize.
+        */
+        ReadbackRing(RenderSystem& renderSystem, std::uint64_t blockSize = defaultBlockSize);
+
+        //! Releases all readback buffers and fences. All tickets become invalid.
+        ~ReadbackRing();
+
+    public:
+
+        /**
+        \brief Records a readback of the specified buffer range into the specified command buffer.
+        \param[in] cmdBuffer Specifies the command buffer the copy command is recorded into.
+        \param[in] srcBuffer Specifies the source buffer. This must have been created with the binding flag BindFlags::CopySrc.
+        \param[in] srcOffset Specifies the offset (in bytes) of the range within the source buffer.
+        \param[in] size Specifies the size (in bytes) of the range. This must not be zero.
+        \return Ticket for this readback or an invalid ticket if the size is zero or the readback buffer could not be created.
+        */
+        ReadbackTicket ReadBuffer(CommandBuffer& cmdBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+
+        /**
+        \brief Records a readback of the specified texture region into the specified command buffer.
+        \param[in] cmdBuffer Specifies the command buffer the copy command is recorded into.
+        \param[in] srcTexture Specifies the source texture. This must have been created with the binding flag BindFlags::CopySrc.
+        \param[in] srcRegion Specifies the texture region. The texels are read back tightly packed in the texture's format.
+        \return Ticket for this readback or an invalid ticket if the region is empty or the readback buffer could not be created.
+        \see CommandBuffer::CopyBufferFromTexture
+        */
+        ReadbackTicket ReadTexture(CommandBuffer& cmdBuffer, Texture& srcTexture, const TextureRegion& srcRegion);
+
+        /**
+        \brief Submits a fence for all readbacks that have been recorded since the last call to this function.
+        \remarks This must be called after the command buffers that contain these readbacks have been submitted to the specified command queue.
+        \see CommandQueue::Submit(Fence&)
+        */
+        void Submit(CommandQueue& commandQueue);
+
+        /**
+        \brief Returns true if the data of the specified ticket is available, i.e. its fence has been signaled. This does not block.
+        \remarks This always returns false for tickets whose readback has not been submitted yet.
+        */
+        bool IsReady(const ReadbackTicket& ticket);
+
+        /**
+        \brief Blocks until the data of the specified ticket is available or the timeout has elapsed.
+        \param[in] timeout Specifies the timeout in nanoseconds. By default the function waits forever.
+        \return True if the data is available. This is false if the readback has not been submitted yet or the timeout has elapsed.
+        */
+        bool Wait(const ReadbackTicket& ticket, std::uint64_t timeout = ~0ull);
+
+        //! Returns the size (in bytes) of the data of the specified ticket or zero if the ticket is invalid.
+        std::uint64_t GetSize(const ReadbackTicket& ticket) const;
+
+        /**
+        \brief Copies the data of the specified ticket into the output buffer and releases the ticket.
+        \param[in] ticket Specifies the ticket whose data is to be read.
+        \param[out] data Specifies the output buffer.
+        \param[in] dataSize Specifies the size (in bytes) of the output buffer. At most GetSize bytes are copied.
+        \return True on success. If the data is not available yet (see IsReady), the ticket is not released and this function returns false.
+        */
+        bool Read(const ReadbackTicket& ticket, void* data, std::uint64_t dataSize);
+
+        /**
+        \brief Releases the specified ticket without reading its data. Invalid tickets are ignored.
+        \remarks The readback buffer of this ticket is only recycled after its fence has been signaled.
+        */
+        void Release(const ReadbackTicket& ticket);
+
+        //! Releases all readback buffers that have no tickets left and whose fences have been signaled. Returns the number of buffers that have been released.
+        std::uint32_t ReleaseUnusedBlocks();
+
+        //! Returns the current statistics of this readback ring.
+        ReadbackRingStatistics GetStatistics() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
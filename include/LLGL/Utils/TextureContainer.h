@@ -0,0 +1,236 @@
+/*
+ * TextureContainer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TEXTURE_CONTAINER_H
+#define LLGL_TEXTURE_CONTAINER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Blob.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Texture;
+struct RenderingCapabilities;
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Texture container file format enumeration.
+\see TextureContainer::GetContainerFormat
+*/
+enum class TextureContainerFormat
+{
+    Undefined,  //!< Undefined container format, i.e. no container is open.
+    DDS,        //!< DirectDraw Surface (DDS) with or without the DX10 header extension.
+    KTX2,       //!< Khronos Texture 2.0 (KTX2).
+};
+
+/**
+\brief KTX2 supercompression scheme enumeration.
+\see TextureContainerTranscodeInfo::supercompression
+*/
+enum class TextureContainerSupercompression
+{
+    None        = 0, //!< No supercompression. If the container requires transcoding, the data is in Basis Universal UASTC format.
+    BasisLZ     = 1, //!< Basis Universal ETC1S with BasisLZ supercompression. The supercompression global data is required for transcoding.
+    Zstandard   = 2, //!< Zstandard supercompression.
+    ZLIB        = 3, //!< ZLIB supercompression.
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Transcode information structure for a single MIP-map level of a texture container.
+\see TextureContainerTranscodeCallback
+*/
+struct TextureContainerTranscodeInfo
+{
+    //! Supercompression scheme of the source data.
+    TextureContainerSupercompression    supercompression    = TextureContainerSupercompression::None;
+
+    //! Pointer to the source data of the MIP-map level including all array layers and cube faces. This points directly into the file mapping.
+    const void*                         srcData             = nullptr;
+
+    //! Size (in bytes) of the source data.
+    std::size_t                         srcDataSize         = 0;
+
+    //! Pointer to the supercompression global data (e.g. the BasisLZ codebooks) or null if there is none.
+    const void*                         globalData          = nullptr;
+
+    //! Size (in bytes) of the supercompression global data.
+    std::size_t                         globalDataSize      = 0;
+
+    //! Zero-based MIP-map level that is to be transcoded.
+    std::uint32_t                       mipLevel            = 0;
+
+    //! Extent of the MIP-map level.
+    Extent3D                            extent;
+
+    //! Number of images within the MIP-map level, i.e. array layers times cube faces.
+    std::uint32_t                       numImages           = 1;
+
+    //! Destination format that was selected with TextureContainer::SelectTranscodeFormat.
+    Format                              dstFormat           = Format::Undefined;
+};
+
+/**
+\brief Callback interface to transcode a single MIP-map level of a texture container, e.g. with the Basis Universal transcoder.
+\param[in] info Specifies the source data and the destination format.
+\param[out] dstData Specifies the destination buffer for all images of the MIP-map level. The images must be tightly packed one after another.
+\param[in] dstDataSize Specifies the size (in bytes) of the destination buffer.
+\return True on success. Otherwise, this MIP-map level is not written to the texture.
+\remarks LLGL does not bundle a transcoder, since Basis Universal and Zstandard are external dependencies.
+\see TextureContainer::WriteTexture
+*/
+using TextureContainerTranscodeCallback = std::function<bool(const TextureContainerTranscodeInfo& info, void* dstData, std::size_t dstDataSize)>;
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Utility class to load textures from DDS and KTX2 container files with pre-baked MIP-maps.
+\remarks The container file is memory mapped (see Blob::CreateFromMappedFile) and each MIP-map level is passed to RenderSystem::WriteTexture
+with an ImageView that points directly into the file mapping, i.e. without an intermediate copy.
+Block-compressed formats (BC1 to BC5) are uploaded as they are.
+KTX2 files in Basis Universal format or with supercompression must be transcoded with a user provided TextureContainerTranscodeCallback.
+\see Blob::CreateFromMappedFile
+\see RenderSystem::WriteTexture
+*/
+class LLGL_EXPORT TextureContainer : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Constructs a texture container without a file.
+        TextureContainer();
+
+        //! Move constructor.
+        TextureContainer(TextureContainer&& rhs) noexcept;
+
+        //! Move operator.
+        TextureContainer& operator = (TextureContainer&& rhs) noexcept;
+
+        //! Closes the container file.
+        ~TextureContainer();
+
+    public:
+
+        /**
+        \brief Maps the specified DDS or KTX2 file into memory and parses its header.
+        \return True if the file was mapped and its header describes a texture format that is supported by LLGL.
+        Otherwise, the return value is false and this container remains closed.
+        \see Blob::CreateFromMappedFile
+        */
+        bool Open(const char* filename);
+
+        /**
+        \brief Opens a DDS or KTX2 container from the specified blob. The blob is moved into this container and must not be a weak reference to temporary memory.
+        \see Open(const char*)
+        */
+        bool Open(Blob&& blob);
+
+        //! Unmaps the container file and resets all attributes.
+        void Close();
+
+        //! Returns true if a container is currently open.
+        bool IsOpen() const;
+
+    public:
+
+        /**
+        \brief Returns true if the container data must be transcoded before it can be uploaded, i.e. for Basis Universal or supercompressed KTX2 files.
+        \see SelectTranscodeFormat
+        */
+        bool IsTranscodingRequired() const;
+
+        /**
+        \brief Selects the destination format to transcode the container data into.
+        \param[in] caps Specifies the rendering capabilities whose \c textureFormats are considered.
+        \return True if a suitable format was found. The formats are considered in the order BC3 (or BC1 without alpha channel), then RGBA8,
+        and they are in sRGB color space if the container data is in sRGB color space.
+        \remarks This has no effect if transcoding is not required. Otherwise, it must be called before CreateTexture or WriteTexture.
+        \see RenderingCapabilities::textureFormats
+        */
+        bool SelectTranscodeFormat(const RenderingCapabilities& caps);
+
+        /**
+        \brief Returns the image view of the specified MIP-map level and array layer, which points directly into the file mapping.
+        \param[in] mipLevel Specifies the zero-based MIP-map level.
+        \param[in] arrayLayer Specifies the zero-based array layer. For cube textures, this includes the cube faces, i.e. it is \c 6*layer+face.
+        \return Image view of all depth slices of the subresource or an empty image view if the subresource is out of range or transcoding is required.
+        */
+        ImageView GetImageView(std::uint32_t mipLevel, std::uint32_t arrayLayer = 0) const;
+
+        /**
+        \brief Writes all MIP-map levels and array layers of this container into the specified texture.
+        \param[in] renderSystem Specifies the render system that is used to write the texture.
+        \param[in] texture Specifies the destination texture. It must have been created with a descriptor that is compatible with GetTextureDesc.
+        \param[in] transcoder Optional callback to transcode the data if IsTranscodingRequired returns true.
+        \return True if all MIP-map levels were written.
+        \remarks Each RenderSystem::WriteTexture call covers as many array layers as are contiguous in the container file,
+        i.e. an entire MIP-map level for KTX2 files and a single array layer per MIP-map level for DDS files.
+        */
+        bool WriteTexture(
+            RenderSystem&                               renderSystem,
+            Texture&                                    texture,
+            const TextureContainerTranscodeCallback&    transcoder  = nullptr
+        ) const;
+
+        /**
+        \brief Creates a new texture with the descriptor of this container and writes all MIP-map levels into it.
+        \param[in] renderSystem Specifies the render system that is used to create and write the texture.
+        \param[in] bindFlags Specifies the binding flags for the new texture. By default BindFlags::Sampled.
+        \param[in] transcoder Optional callback to transcode the data if IsTranscodingRequired returns true.
+        \return Pointer to the new texture or null if the format is not supported by the render system or the data could not be transcoded.
+        \see GetTextureDesc
+        */
+        Texture* CreateTexture(
+            RenderSystem&                               renderSystem,
+            long                                        bindFlags   = BindFlags::Sampled,
+            const TextureContainerTranscodeCallback&    transcoder  = nullptr
+        ) const;
+
+    public:
+
+        //! Returns the format of the container file or TextureContainerFormat::Undefined if no container is open.
+        TextureContainerFormat GetContainerFormat() const;
+
+        /**
+        \brief Returns the texture descriptor that describes this container.
+        \remarks The format is Format::Undefined if transcoding is required and no transcode format has been selected yet.
+        The \c bindFlags are BindFlags::Sampled and \c miscFlags are 0, since the MIP-maps are provided by the container.
+        */
+        const TextureDescriptor& GetTextureDesc() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
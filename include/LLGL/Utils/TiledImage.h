@@ -0,0 +1,144 @@
+/*
+ * TiledImage.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TILED_IMAGE_H
+#define LLGL_TILED_IMAGE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Texture;
+
+/**
+\brief Utility class to stream image data from a memory mapped file that can be larger than the available memory.
+\remarks In contrast to the Image class, this class does not hold the image buffer in memory.
+The image file is mapped read-only and only the pages of the regions that are accessed are loaded into memory.
+This is meant for very large images such as terrain height maps or virtual textures that are uploaded to hardware textures region by region.
+\see Image
+*/
+class LLGL_EXPORT TiledImage : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Constructs a tiled image without a file.
+        TiledImage();
+
+        //! Move constructor.
+        TiledImage(TiledImage&& rhs) noexcept;
+
+        //! Move operator.
+        TiledImage& operator = (TiledImage&& rhs) noexcept;
+
+        //! Closes the image file.
+        ~TiledImage();
+
+    public:
+
+        /**
+        \brief Maps the specified raw image file into memory.
+        \param[in] filename Specifies the file that contains the raw pixel data. Pixels must be tightly packed row by row and slice by slice.
+        \param[in] extent Specifies the image extent.
+        \param[in] format Specifies the format of each pixel.
+        \param[in] dataType Specifies the data type of each pixel component.
+        \param[in] fileOffset Specifies the offset (in bytes) where the pixel data begins, e.g. to skip a file header. By default 0.
+        \return True if the file was mapped successfully and is large enough for the specified image attributes.
+        Otherwise, the return value is false and this image remains closed.
+        \remarks Compressed and depth-stencil formats are not supported.
+        */
+        bool Open(
+            const char*         filename,
+            const Extent3D&     extent,
+            const ImageFormat   format,
+            const DataType      dataType,
+            std::size_t         fileOffset  = 0
+        );
+
+        //! Unmaps the image file and resets all attributes.
+        void Close();
+
+        //! Returns true if an image file is currently mapped.
+        bool IsOpen() const;
+
+    public:
+
+        /**
+        \brief Reads a region of pixels from this image into the destination image buffer specified by \c imageView.
+        \param[in] offset Specifies the region offset within this image to read from.
+        \param[in] extent Specifies the region extent within this image to read from.
+        \param[in] imageView Specifies the destination image view to write the region to.
+        If the image view has a different format or data type than this image, the region is converted.
+        If the \c data member of this descriptor is null or if the region is not inside the image, this function has no effect.
+        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
+        \see Image::ReadPixels
+        */
+        void ReadPixels(const Offset3D& offset, const Extent3D& extent, const MutableImageView& imageView, unsigned threadCount = 0) const;
+
+        /**
+        \brief Writes a region of this image into the specified texture tile by tile.
+        \param[in] renderSystem Specifies the render system that is used to write the texture.
+        \param[in] texture Specifies the destination texture.
+        \param[in] textureRegion Specifies the destination region within the texture. Its extent also determines the extent of the source region.
+        \param[in] srcOffset Specifies the offset of the source region within this image.
+        \param[in] tileExtent Specifies the maximum extent of each tile that is passed to RenderSystem::WriteTexture. This limits the size of the intermediate buffer.
+        \remarks Rows of a tile that are contiguous in the mapped file are passed to the render system directly without an intermediate copy.
+        If this image has a different format than the texture, each tile is converted by the render system.
+        If the source region is not inside the image, this function has no effect.
+        \see RenderSystem::WriteTexture
+        */
+        void WriteTexture(
+            RenderSystem&           renderSystem,
+            Texture&                texture,
+            const TextureRegion&    textureRegion,
+            const Offset3D&         srcOffset   = {},
+            const Extent3D&         tileExtent  = { 1024, 1024, 1 }
+        ) const;
+
+    public:
+
+        //! Returns the extent of the image or zero if no file is mapped.
+        const Extent3D& GetExtent() const;
+
+        //! Returns the format for each pixel.
+        ImageFormat GetFormat() const;
+
+        //! Returns the data type for each pixel component.
+        DataType GetDataType() const;
+
+        //! Returns the size (in bytes) for each pixel.
+        std::uint32_t GetBytesPerPixel() const;
+
+        //! Returns true if the specified region is inside the image.
+        bool IsRegionInside(const Offset3D& offset, const Extent3D& extent) const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -130,6 +130,56 @@ struct VertexFormat
 };
 
 
+/* ----- Packed vertex attributes ----- */
+
+/**
+\brief Packs the specified 32-bit float into a 16-bit float for vertex attributes of type Format::R16Float, Format::RG16Float, or Format::RGBA16Float.
+\remarks The mantissa is truncated and values beyond the range of 16-bit floats become infinity. This is commonly used for texture coordinates.
+\see UnpackFloat16
+*/
+LLGL_EXPORT std::uint16_t PackFloat16(float value);
+
+//! Unpacks the specified 16-bit float into a 32-bit float. This is the inverse of PackFloat16.
+LLGL_EXPORT float UnpackFloat16(std::uint16_t value);
+
+/**
+\brief Packs the specified color into a vertex attribute of type Format::RGB10A2UNorm.
+\remarks All components are clamped to [0, 1] and use the bit pattern <code>A[31:30], B[29:20], G[19:10], R[9:0]</code>.
+This is commonly used for vertex colors and tangent frames that do not require more than 10 bits of precision.
+\see UnpackRGB10A2UNorm
+*/
+LLGL_EXPORT std::uint32_t PackRGB10A2UNorm(float r, float g, float b, float a = 1.0f);
+
+//! Unpacks the specified vertex attribute of type Format::RGB10A2UNorm into four floats in the range [0, 1]. This is the inverse of PackRGB10A2UNorm.
+LLGL_EXPORT void UnpackRGB10A2UNorm(std::uint32_t value, float (&outColor)[4]);
+
+/**
+\brief Packs the specified normal vector into a vertex attribute of type Format::RG16SNorm with octahedral encoding.
+\param[in] x Specifies the X component of the normal vector.
+\param[in] y Specifies the Y component of the normal vector.
+\param[in] z Specifies the Z component of the normal vector.
+\remarks The vector does not need to be normalized, but a zero vector is encoded as the normal <code>(0, 0, 1)</code>.
+The normal is projected onto the octahedron <code>|x| + |y| + |z| = 1</code> whose lower half is folded onto the upper half,
+so the X and Y components of the result are stored in the lower and upper 16 bits respectively.
+This halves the size of a normal compared to Format::RGB32Float with a negligible angular error.
+\remarks Shaders decode the normal as follows (in HLSL):
+\code
+float3 DecodeOctahedralNormal(float2 e)
+{
+    float3 n = float3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * (n.xy >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+\endcode
+\see UnpackOctahedralNormal
+*/
+LLGL_EXPORT std::uint32_t PackOctahedralNormal(float x, float y, float z);
+
+//! Unpacks the specified vertex attribute of type Format::RG16SNorm into a normalized vector. This is the inverse of PackOctahedralNormal.
+LLGL_EXPORT void UnpackOctahedralNormal(std::uint32_t value, float (&outNormal)[3]);
+
+
 } // /namespace LLGL
 
 
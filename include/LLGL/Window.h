@@ -186,6 +186,28 @@ class LLGL_EXPORT Window : public Surface
         //! Removes the specified event listener from this window.
         void RemoveEventListener(const EventListener* eventListener);
 
+        /**
+        \brief Enables or disables buffered delivery of global mouse motion.
+        \param[in] capacity Specifies the number of motion entries the ring buffer can hold.
+        If this is zero, buffering is disabled and each global motion is posted to the event listeners again. By default 0.
+        \remarks While buffering is enabled, PostGlobalMotion does not invoke EventListener::OnGlobalMotion but stores the motion in a ring buffer.
+        The application is meant to drain this buffer once per frame with ReadGlobalMotion. This avoids one virtual callback per motion event for mice with a high polling rate.
+        If the buffer is full, new motion is accumulated into the most recent entry, so no motion is lost.
+        \remarks Changing the capacity discards all motion entries that have not been read yet.
+        \see ReadGlobalMotion
+        */
+        void SetGlobalMotionBuffer(std::uint32_t capacity);
+
+        /**
+        \brief Reads and removes the oldest global motion entries from the ring buffer.
+        \param[out] outMotions Specifies the output array of motion entries. This must have at least \c maxCount elements.
+        If this is null, up to \c maxCount entries are discarded.
+        \param[in] maxCount Specifies the maximum number of entries to read.
+        \return Number of entries that have been read. This is zero if buffering is disabled.
+        \see SetGlobalMotionBuffer
+        */
+        std::uint32_t ReadGlobalMotion(Offset2D* outMotions, std::uint32_t maxCount);
+
         /**
         \brief Posts a 'Quit' event to all event listeners if the window is not yet in the 'Quit' state.
         \remarks If any of the event listener sets the \c veto flag to false within the \c OnQuit callback, the window will \e not be put into 'Quit' state.
@@ -215,7 +237,11 @@ class LLGL_EXPORT Window : public Surface
         //! \see PostKeyDown
         void PostLocalMotion(const Offset2D& position);
 
-        //! \see PostKeyDown
+        /**
+        \brief Posts a 'GlobalMotion' event to all event listeners or stores it in the global motion buffer if enabled.
+        \see EventListener::OnGlobalMotion
+        \see SetGlobalMotionBuffer
+        */
         void PostGlobalMotion(const Offset2D& motion);
 
         //! \see PostKeyDown
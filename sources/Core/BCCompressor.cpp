@@ -0,0 +1,286 @@
+/*
+ * BCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BCCompressor.h"
+#include "Threading.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Uncompressed 4x4 pixel block in RGBA8UNorm format.
+struct SourceBlock
+{
+    std::uint8_t pixels[16][4];
+};
+
+// Function signature to encode a single block.
+using EncodeBlockFunc = void (*)(const SourceBlock& src, std::uint8_t* dst);
+
+template <typename T>
+void WriteLittleEndian(std::uint8_t* dst, T value)
+{
+    for_range(i, sizeof(T))
+        dst[i] = static_cast<std::uint8_t>(value >> (i * 8));
+}
+
+static std::uint16_t CompressRGB565(const std::uint8_t* src)
+{
+    return static_cast<std::uint16_t>(((src[0] >> 3) << 11) | ((src[1] >> 2) << 5) | (src[2] >> 3));
+}
+
+// Expands a 5:6:5 color into 8-bit components the same way the decoder does.
+static void DecompressRGB565(std::uint8_t* dst, std::uint16_t src)
+{
+    const std::uint32_t r = (src >> 11) & 0x1F;
+    const std::uint32_t g = (src >>  5) & 0x3F;
+    const std::uint32_t b = (src      ) & 0x1F;
+    dst[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    dst[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    dst[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+}
+
+static int ColorDistanceSq(const std::uint8_t* a, const std::uint8_t* b)
+{
+    const int dr = static_cast<int>(a[0]) - static_cast<int>(b[0]);
+    const int dg = static_cast<int>(a[1]) - static_cast<int>(b[1]);
+    const int db = static_cast<int>(a[2]) - static_cast<int>(b[2]);
+    return dr*dr + dg*dg + db*db;
+}
+
+// Encodes the 64-bit color part of BC1, BC2, and BC3 blocks in 4-color mode.
+static void EncodeColorBlock(const SourceBlock& src, std::uint8_t* dst)
+{
+    /* Select endpoints from the bounding box of the block, inset by 1/16 to reduce the error of the interpolated colors */
+    std::uint8_t minColor[3] = { 0xFF, 0xFF, 0xFF };
+    std::uint8_t maxColor[3] = { 0x00, 0x00, 0x00 };
+
+    for_range(i, 16)
+    {
+        for_range(c, 3)
+        {
+            minColor[c] = std::min(minColor[c], src.pixels[i][c]);
+            maxColor[c] = std::max(maxColor[c], src.pixels[i][c]);
+        }
+    }
+
+    for_range(c, 3)
+    {
+        const int inset = (maxColor[c] - minColor[c]) >> 4;
+        minColor[c] = static_cast<std::uint8_t>(std::min(0xFF, minColor[c] + inset));
+        maxColor[c] = static_cast<std::uint8_t>(std::max(0x00, maxColor[c] - inset));
+    }
+
+    std::uint16_t color0 = CompressRGB565(maxColor);
+    std::uint16_t color1 = CompressRGB565(minColor);
+
+    /* Ensure 4-color mode (color0 > color1); if both endpoints are equal, all pixels use index 0 */
+    if (color0 < color1)
+        std::swap(color0, color1);
+
+    std::uint32_t indices = 0;
+
+    if (color0 != color1)
+    {
+        std::uint8_t palette[4][3];
+        DecompressRGB565(palette[0], color0);
+        DecompressRGB565(palette[1], color1);
+        for_range(c, 3)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+
+        for_range(i, 16)
+        {
+            std::uint32_t bestIndex = 0;
+            int bestDistance = ColorDistanceSq(src.pixels[i], palette[0]);
+            for_subrange(j, 1u, 4u)
+            {
+                const int distance = ColorDistanceSq(src.pixels[i], palette[j]);
+                if (distance < bestDistance)
+                {
+                    bestDistance    = distance;
+                    bestIndex       = j;
+                }
+            }
+            indices |= (bestIndex << (i * 2));
+        }
+    }
+
+    WriteLittleEndian<std::uint16_t>(dst,     color0);
+    WriteLittleEndian<std::uint16_t>(dst + 2, color1);
+    WriteLittleEndian<std::uint32_t>(dst + 4, indices);
+}
+
+// Encodes the specified component of each pixel into a BC4 channel block using the 8-value mode.
+static void EncodeChannelBlock(const SourceBlock& src, std::uint8_t* dst, std::size_t component)
+{
+    int minValue = 0xFF, maxValue = 0x00;
+    for_range(i, 16)
+    {
+        minValue = std::min(minValue, static_cast<int>(src.pixels[i][component]));
+        maxValue = std::max(maxValue, static_cast<int>(src.pixels[i][component]));
+    }
+
+    dst[0] = static_cast<std::uint8_t>(maxValue);
+    dst[1] = static_cast<std::uint8_t>(minValue);
+
+    std::uint64_t indices = 0;
+
+    if (maxValue > minValue)
+    {
+        int palette[8] = { maxValue, minValue };
+        for_subrange(i, 2, 8)
+            palette[i] = (maxValue * (8 - i) + minValue * (i - 1)) / 7;
+
+        for_range(i, 16)
+        {
+            const int value = src.pixels[i][component];
+            std::uint64_t bestIndex = 0;
+            int bestDistance = std::abs(value - palette[0]);
+            for_subrange(j, 1u, 8u)
+            {
+                const int distance = std::abs(value - palette[j]);
+                if (distance < bestDistance)
+                {
+                    bestDistance    = distance;
+                    bestIndex       = j;
+                }
+            }
+            indices |= (bestIndex << (i * 3));
+        }
+    }
+
+    for_range(i, 6)
+        dst[2 + i] = static_cast<std::uint8_t>(indices >> (i * 8));
+}
+
+static void EncodeBC1Block(const SourceBlock& src, std::uint8_t* dst)
+{
+    EncodeColorBlock(src, dst);
+}
+
+static void EncodeBC2Block(const SourceBlock& src, std::uint8_t* dst)
+{
+    /* Encode explicit 4-bit alpha values with rounding */
+    std::uint64_t alpha = 0;
+    for_range(i, 16)
+        alpha |= static_cast<std::uint64_t>((src.pixels[i][3] * 15 + 127) / 255) << (i * 4);
+
+    WriteLittleEndian<std::uint64_t>(dst, alpha);
+    EncodeColorBlock(src, dst + 8);
+}
+
+static void EncodeBC3Block(const SourceBlock& src, std::uint8_t* dst)
+{
+    EncodeChannelBlock(src, dst, 3);
+    EncodeColorBlock(src, dst + 8);
+}
+
+static void EncodeBC4Block(const SourceBlock& src, std::uint8_t* dst)
+{
+    EncodeChannelBlock(src, dst, 0);
+}
+
+static void EncodeBC5Block(const SourceBlock& src, std::uint8_t* dst)
+{
+    EncodeChannelBlock(src, dst,     0);
+    EncodeChannelBlock(src, dst + 8, 1);
+}
+
+static bool GetBlockEncoder(ImageFormat format, EncodeBlockFunc& outEncodeBlock, std::size_t& outBlockSize)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:
+            outEncodeBlock  = EncodeBC1Block;
+            outBlockSize    = 8;
+            return true;
+        case ImageFormat::BC2:
+            outEncodeBlock  = EncodeBC2Block;
+            outBlockSize    = 16;
+            return true;
+        case ImageFormat::BC3:
+            outEncodeBlock  = EncodeBC3Block;
+            outBlockSize    = 16;
+            return true;
+        case ImageFormat::BC4:
+            outEncodeBlock  = EncodeBC4Block;
+            outBlockSize    = 8;
+            return true;
+        case ImageFormat::BC5:
+            outEncodeBlock  = EncodeBC5Block;
+            outBlockSize    = 16;
+            return true;
+        default:
+            return false;
+    }
+}
+
+DynamicByteArray CompressRGBA8UNormToBC(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    ImageFormat     format,
+    unsigned        threadCount)
+{
+    EncodeBlockFunc encodeBlock = nullptr;
+    std::size_t     blockSize   = 0;
+
+    /* Return null on invalid arguments */
+    if (!GetBlockEncoder(format, encodeBlock, blockSize))
+        return nullptr;
+    if (data == nullptr || extent.x == 0 || extent.y == 0 || dataSize < static_cast<std::size_t>(extent.x) * extent.y * 4)
+        return nullptr;
+
+    const std::uint32_t numBlocksX = (extent.x + 3) / 4;
+    const std::uint32_t numBlocksY = (extent.y + 3) / 4;
+
+    DynamicByteArray dstImage{ static_cast<std::size_t>(numBlocksX) * numBlocksY * blockSize, UninitializeTag{} };
+
+    const std::uint8_t* input   = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint8_t*       output  = reinterpret_cast<std::uint8_t*>(dstImage.get());
+
+    DoConcurrentRange(
+        [=](std::size_t begin, std::size_t end)
+        {
+            SourceBlock block;
+            for_subrange(blockY, begin, end)
+            {
+                for_range(blockX, numBlocksX)
+                {
+                    /* Gather 4x4 block and replicate border pixels for partial blocks */
+                    for_range(i, 16u)
+                    {
+                        const std::uint32_t x = std::min(blockX * 4 + i % 4, extent.x - 1);
+                        const std::uint32_t y = std::min(static_cast<std::uint32_t>(blockY) * 4 + i / 4, extent.y - 1);
+                        std::memcpy(block.pixels[i], input + (static_cast<std::size_t>(y) * extent.x + x) * 4, 4);
+                    }
+                    encodeBlock(block, output + (blockY * numBlocksX + blockX) * blockSize);
+                }
+            }
+        },
+        numBlocksY,
+        threadCount
+    );
+
+    return dstImage;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
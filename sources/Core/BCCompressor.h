@@ -0,0 +1,45 @@
+/*
+ * BCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer in the specified block compression format (ImageFormat::BC1 to ImageFormat::BC5) for the RGBA8UNorm input image, or null on failure.
+The input image must contain extent.x * extent.y pixels. Partial blocks at the right and bottom border are padded by replicating the border pixels.
+Endpoints are selected from the bounding box of each block, which trades quality for speed.
+*/
+DynamicByteArray CompressRGBA8UNormToBC(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    ImageFormat     format,
+    unsigned        threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,8 +6,11 @@
  */
 
 #include "BCDecompressor.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 
 
@@ -15,110 +18,283 @@ namespace LLGL
 {
 
 
-static void DecompressRGBColor16Bit(std::uint8_t* dst, std::uint16_t src)
+// Decoded 4x4 pixel block in RGBA8UNorm format.
+struct DecodedBlock
 {
-    dst[0] = ((src >> 12) & 0x000F) * 0xFF / 0x0F;
-    dst[1] = ((src >>  6) & 0x001F) * 0xFF / 0x1F;
-    dst[2] = ((src >>  1) & 0x000F) * 0xFF / 0x0F;
-}
+    std::uint8_t pixels[16][4];
+};
+
+// Function signature to decode a single block.
+using DecodeBlockFunc = void (*)(const std::uint8_t* src, DecodedBlock& dst, bool isSigned);
 
-#if 0 //UNUSED
-static void DecompressRGBAColor16Bit(std::uint8_t* dst, std::uint16_t src)
+template <typename T>
+T ReadLittleEndian(const std::uint8_t* src)
 {
-    DecompressRGBColor16Bit(dst, src);
-    dst[3] = (src & 0x0001) * 0xFF;
+    T value = 0;
+    for_range(i, sizeof(T))
+        value |= static_cast<T>(static_cast<T>(src[i]) << (i * 8));
+    return value;
 }
 
-static std::uint8_t DecompressAlphaChannel4Bit(std::uint32_t& src)
+// Expands a 5:6:5 color into 8-bit components.
+static void DecompressRGB565(std::uint8_t* dst, std::uint16_t src)
 {
-    auto alpha = static_cast<std::uint8_t >((src & 0x0000000F) * 0xFF / 0x0F);
-    src >>= 4;
-    return alpha;
+    const std::uint32_t r = (src >> 11) & 0x1F;
+    const std::uint32_t g = (src >>  5) & 0x3F;
+    const std::uint32_t b = (src      ) & 0x1F;
+    dst[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    dst[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    dst[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    dst[3] = 0xFF;
 }
 
-static void Decompress16AlphaChannels4Bit(std::uint8_t* dst, std::uint32_t src0, std::uint32_t src1)
+// Decodes the 64-bit color part of BC1, BC2, and BC3 blocks. The 3-color mode with transparent black is only available for BC1.
+static void DecodeColorBlock(const std::uint8_t* src, DecodedBlock& dst, bool allowThreeColorMode)
 {
-    for (int i = 0; i < 8; ++i)
+    const std::uint16_t color0 = ReadLittleEndian<std::uint16_t>(src);
+    const std::uint16_t color1 = ReadLittleEndian<std::uint16_t>(src + 2);
+
+    std::uint8_t palette[4][4];
+    DecompressRGB565(palette[0], color0);
+    DecompressRGB565(palette[1], color1);
+
+    if (color0 > color1 || !allowThreeColorMode)
+    {
+        for_range(c, 3)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+        palette[2][3] = 0xFF;
+        palette[3][3] = 0xFF;
+    }
+    else
     {
-        dst[i    ] = DecompressAlphaChannel4Bit(src0);
-        dst[i + 8] = DecompressAlphaChannel4Bit(src1);
+        for_range(c, 3)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((palette[0][c] + palette[1][c]) / 2);
+            palette[3][c] = 0;
+        }
+        palette[2][3] = 0xFF;
+        palette[3][3] = 0;
+    }
+
+    std::uint32_t indices = ReadLittleEndian<std::uint32_t>(src + 4);
+    for_range(i, 16)
+    {
+        std::memcpy(dst.pixels[i], palette[indices & 0x3], 4);
+        indices >>= 2;
     }
 }
-#endif
 
-static std::uint8_t InterpolateColorComponent(std::uint16_t a, std::uint16_t b)
+// Decodes a BC4 channel block into the specified component of each pixel.
+static void DecodeChannelBlock(const std::uint8_t* src, DecodedBlock& dst, std::size_t component, bool isSigned)
 {
-    if (a > b)
-        return static_cast<std::uint8_t>((2 * a + b + 1) / 3);
+    std::uint8_t palette[8];
+
+    if (isSigned)
+    {
+        /* Decode in signed range [-127, 127] and remap to [0, 255]; -128 is treated as -127 */
+        const int c0 = std::max(-127, static_cast<int>(static_cast<std::int8_t>(src[0])));
+        const int c1 = std::max(-127, static_cast<int>(static_cast<std::int8_t>(src[1])));
+
+        int values[8] = { c0, c1 };
+        if (c0 > c1)
+        {
+            for_subrange(i, 2, 8)
+                values[i] = (c0 * (8 - i) + c1 * (i - 1)) / 7;
+        }
+        else
+        {
+            for_subrange(i, 2, 6)
+                values[i] = (c0 * (6 - i) + c1 * (i - 1)) / 5;
+            values[6] = -127;
+            values[7] = 127;
+        }
+
+        for_range(i, 8)
+            palette[i] = static_cast<std::uint8_t>(((values[i] + 127) * 255 + 127) / 254);
+    }
     else
-        return static_cast<std::uint8_t>((a + b) / 2);
+    {
+        const int c0 = src[0];
+        const int c1 = src[1];
+
+        palette[0] = static_cast<std::uint8_t>(c0);
+        palette[1] = static_cast<std::uint8_t>(c1);
+        if (c0 > c1)
+        {
+            for_subrange(i, 2, 8)
+                palette[i] = static_cast<std::uint8_t>((c0 * (8 - i) + c1 * (i - 1)) / 7);
+        }
+        else
+        {
+            for_subrange(i, 2, 6)
+                palette[i] = static_cast<std::uint8_t>((c0 * (6 - i) + c1 * (i - 1)) / 5);
+            palette[6] = 0x00;
+            palette[7] = 0xFF;
+        }
+    }
+
+    /* Read 48-bit index table with 3 bits per pixel */
+    std::uint64_t indices = 0;
+    for_range(i, 6)
+        indices |= static_cast<std::uint64_t>(src[2 + i]) << (i * 8);
+
+    for_range(i, 16)
+    {
+        dst.pixels[i][component] = palette[indices & 0x7];
+        indices >>= 3;
+    }
 }
 
-static void InterpolateColor(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1)
+static void DecodeBC1Block(const std::uint8_t* src, DecodedBlock& dst, bool /*isSigned*/)
 {
-    dst[0] = InterpolateColorComponent(src0[0], src1[0]);
-    dst[1] = InterpolateColorComponent(src0[1], src1[1]);
-    dst[2] = InterpolateColorComponent(src0[2], src1[2]);
+    DecodeColorBlock(src, dst, true);
 }
 
-DynamicByteArray DecompressBC1ToRGBA8UNorm(
+static void DecodeBC2Block(const std::uint8_t* src, DecodedBlock& dst, bool /*isSigned*/)
+{
+    DecodeColorBlock(src + 8, dst, false);
+
+    /* Decode explicit 4-bit alpha values */
+    std::uint64_t alpha = ReadLittleEndian<std::uint64_t>(src);
+    for_range(i, 16)
+    {
+        dst.pixels[i][3] = static_cast<std::uint8_t>((alpha & 0xF) * 0x11);
+        alpha >>= 4;
+    }
+}
+
+static void DecodeBC3Block(const std::uint8_t* src, DecodedBlock& dst, bool /*isSigned*/)
+{
+    DecodeColorBlock(src + 8, dst, false);
+    DecodeChannelBlock(src, dst, 3, false);
+}
+
+static void DecodeBC4Block(const std::uint8_t* src, DecodedBlock& dst, bool isSigned)
+{
+    for_range(i, 16)
+    {
+        dst.pixels[i][1] = 0x00;
+        dst.pixels[i][2] = 0x00;
+        dst.pixels[i][3] = 0xFF;
+    }
+    DecodeChannelBlock(src, dst, 0, isSigned);
+}
+
+static void DecodeBC5Block(const std::uint8_t* src, DecodedBlock& dst, bool isSigned)
+{
+    for_range(i, 16)
+    {
+        dst.pixels[i][2] = 0x00;
+        dst.pixels[i][3] = 0xFF;
+    }
+    DecodeChannelBlock(src,     dst, 0, isSigned);
+    DecodeChannelBlock(src + 8, dst, 1, isSigned);
+}
+
+// Decodes all blocks of the specified image; block rows are distributed across the worker threads.
+static DynamicByteArray DecompressBlocksToRGBA8UNorm(
     const Extent2D& extent,
     const char*     data,
     std::size_t     dataSize,
-    unsigned        /*threadCount*/)
+    std::size_t     blockSize,
+    DecodeBlockFunc decodeBlock,
+    bool            isSigned,
+    unsigned        threadCount)
 {
+    const std::uint32_t numBlocksX = (extent.x + 3) / 4;
+    const std::uint32_t numBlocksY = (extent.y + 3) / 4;
+
     /* Return null on invalid arguments */
-    if (extent.x % 4 != 0 || extent.y % 4 != 0 || data == nullptr || dataSize < extent.x * extent.y / 2)
+    if (data == nullptr || extent.x == 0 || extent.y == 0 || dataSize < static_cast<std::size_t>(numBlocksX) * numBlocksY * blockSize)
         return nullptr;
 
-    DynamicByteArray dstImage{ extent.x * extent.y * 4, UninitializeTag{} };
+    DynamicByteArray dstImage{ static_cast<std::size_t>(extent.x) * extent.y * 4, UninitializeTag{} };
 
-    std::uint8_t* output = reinterpret_cast<std::uint8_t*>(dstImage.get());
-    std::uint16_t compressedColor[2];
-    std::uint8_t decompressedColor[4][3];
+    const std::uint8_t* input   = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint8_t*       output  = reinterpret_cast<std::uint8_t*>(dstImage.get());
 
-    const std::size_t formatByteSize = 4;
-
-    for_range(y, extent.y / 4u)
-    {
-        for_range(x, extent.x / 4u)
+    DoConcurrentRange(
+        [=](std::size_t begin, std::size_t end)
         {
-            /* Decompress two 16 bit colors */
-            for_range(i, 2)
+            DecodedBlock block;
+            for_subrange(blockY, begin, end)
             {
-                compressedColor[i] = *reinterpret_cast<const std::uint16_t*>(data);
-                DecompressRGBColor16Bit(decompressedColor[i], compressedColor[i]);
-                data += 2;
-            }
+                const std::uint32_t y           = static_cast<std::uint32_t>(blockY) * 4;
+                const std::uint32_t blockHeight = std::min(4u, extent.y - y);
 
-            /* Generate two more colors by interpolating the previous two */
-            InterpolateColor(decompressedColor[2], decompressedColor[0], decompressedColor[1]);
-            InterpolateColor(decompressedColor[3], decompressedColor[1], decompressedColor[0]);
+                for_range(blockX, numBlocksX)
+                {
+                    const std::uint32_t x           = blockX * 4;
+                    const std::uint32_t blockWidth  = std::min(4u, extent.x - x);
 
-            /* Read palette bitfield */
-            std::uint32_t palette = *reinterpret_cast<const std::uint32_t*>(data);
-            data += 4;
+                    decodeBlock(input + (blockY * numBlocksX + blockX) * blockSize, block, isSigned);
 
-            /* Generate 4x4 pixel block from palette bitmask */
-            for_range(i, 16u)
-            {
-                /* Get palette index from last two bits */
-                const std::uint32_t paletteIndex = palette & 0x00000003;
-                palette >>= 2;
-
-                /* Write out image color */
-                const std::size_t outputOffset = (((y * 4 + i/4) * extent.x) + (x*4 + i%4)) * formatByteSize;
-                output[outputOffset + 0] = decompressedColor[paletteIndex][0];
-                output[outputOffset + 1] = decompressedColor[paletteIndex][1];
-                output[outputOffset + 2] = decompressedColor[paletteIndex][2];
-                output[outputOffset + 3] = 0xFF;
+                    /* Copy decoded rows into output image and clip partial blocks */
+                    for_range(row, blockHeight)
+                    {
+                        const std::size_t outputOffset = (static_cast<std::size_t>(y + row) * extent.x + x) * 4;
+                        std::memcpy(output + outputOffset, block.pixels[row * 4], blockWidth * 4);
+                    }
+                }
             }
-        }
-    }
+        },
+        numBlocksY,
+        threadCount
+    );
 
     return dstImage;
 }
 
+DynamicByteArray DecompressBC1ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, DecodeBC1Block, false, threadCount);
+}
+
+DynamicByteArray DecompressBC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC2Block, false, threadCount);
+}
+
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC3Block, false, threadCount);
+}
+
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, DecodeBC4Block, isSigned, threadCount);
+}
+
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC5Block, isSigned, threadCount);
+}
+
 
 } // /namespace LLGL
 
@@ -22,7 +22,7 @@ namespace LLGL
 
 /*
 Returns an image buffer in the Format::RGBA8UNorm format for the specified BC1 encoded data, or null on failure
-Width and height of the input image must be a multiple of 4.
+The image extent does not need to be a multiple of 4; partial blocks at the right and bottom border are clipped.
 */
 DynamicByteArray DecompressBC1ToRGBA8UNorm(
     const Extent2D& extent,
@@ -31,6 +31,46 @@ DynamicByteArray DecompressBC1ToRGBA8UNorm(
     unsigned        threadCount = 0
 );
 
+// Returns an image buffer in the Format::RGBA8UNorm format for the specified BC2 encoded data, or null on failure.
+DynamicByteArray DecompressBC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+// Returns an image buffer in the Format::RGBA8UNorm format for the specified BC3 encoded data, or null on failure.
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC4 encoded data, or null on failure.
+The red channel is decoded into R and the other channels are set to (0, 0, 1). Signed values are remapped from [-1, 1] to [0, 1].
+*/
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC5 encoded data, or null on failure.
+The red and green channels are decoded into R and G and the other channels are set to (0, 1). Signed values are remapped from [-1, 1] to [0, 1].
+*/
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
 
 } // /namespace LLGL
 
@@ -8,6 +8,7 @@
 #include <LLGL/Blob.h>
 #include <fstream>
 #include "CoreUtils.h"
+#include "../Platform/MappedFile.h"
 
 
 namespace LLGL
@@ -112,12 +113,32 @@ struct InternalUnmanagedBlob final : Blob::Pimpl
     std::size_t size;
 };
 
+struct InternalMappedFileBlob final : Blob::Pimpl
+{
+    InternalMappedFileBlob(std::unique_ptr<MappedFile>&& file) :
+        file { std::forward<std::unique_ptr<MappedFile>>(file) }
+    {
+    }
+
+    const void* GetData() const override
+    {
+        return file->GetData();
+    }
+
+    std::size_t GetSize() const override
+    {
+        return file->GetSize();
+    }
+
+    std::unique_ptr<MappedFile> file;
+};
+
 static Blob::Pimpl* MakeInternalBlob(const void* data, std::size_t size, bool isWeakRef)
 {
     if (isWeakRef)
-        return new InternalVectorBlob{ data, size };
-    else
         return new InternalUnmanagedBlob{ data, size };
+    else
+        return new InternalVectorBlob{ data, size };
 }
 
 static Blob::Pimpl* MakeInternalBlob(DynamicByteArray&& cont)
@@ -135,6 +156,11 @@ static Blob::Pimpl* MakeInternalBlob(std::string&& str)
     return new InternalStringBlob{ std::forward<std::string>(str) };
 }
 
+static Blob::Pimpl* MakeInternalBlob(std::unique_ptr<MappedFile>&& file)
+{
+    return new InternalMappedFileBlob{ std::forward<std::unique_ptr<MappedFile>>(file) };
+}
+
 
 /*
  * Blob class
@@ -238,6 +264,27 @@ Blob Blob::CreateFromFile(const std::string& filename)
     return CreateFromFile(filename.c_str());
 }
 
+Blob Blob::CreateFromMappedFile(const char* filename)
+{
+    if (filename == nullptr || *filename == '\0')
+        return Blob{};
+
+    /* Map file into memory; pages are only loaded when they are accessed */
+    std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+    if (!file)
+        return Blob{};
+
+    /* Return blob that owns the file mapping */
+    Blob blob;
+    blob.pimpl_ = MakeInternalBlob(std::move(file));
+    return blob;
+}
+
+Blob Blob::CreateFromMappedFile(const std::string& filename)
+{
+    return CreateFromMappedFile(filename.c_str());
+}
+
 const void* Blob::GetData() const
 {
     return (pimpl_ != nullptr ? pimpl_->GetData() : nullptr);
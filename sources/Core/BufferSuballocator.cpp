@@ -0,0 +1,267 @@
+/*
+ * BufferSuballocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/BufferSuballocator.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Buffer.h>
+#include "CoreUtils.h"
+#include "Assertion.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+struct BufferSuballocatorRange
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+struct BufferSuballocatorBlock
+{
+    Buffer*                                 buffer      = nullptr;
+    std::uint64_t                           size        = 0;
+    std::uint32_t                           numSlices   = 0;
+    std::vector<BufferSuballocatorRange>    freeRanges;             // Free ranges sorted by their offset
+};
+
+struct BufferSuballocator::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, const BufferDescriptor& bufferDesc, std::uint64_t blockSize) :
+        renderSystem { renderSystem                                               },
+        bufferDesc   { bufferDesc                                                 },
+        debugName    { bufferDesc.debugName != nullptr ? bufferDesc.debugName : "" },
+        vertexAttribs{ bufferDesc.vertexAttribs.begin(), bufferDesc.vertexAttribs.end() },
+        blockSize    { std::max<std::uint64_t>(blockSize, BufferSuballocator::minAlignment) }
+    {
+        /* Keep descriptor strings and arrays alive for all buffers that are created later */
+        this->bufferDesc.debugName      = (debugName.empty() ? nullptr : debugName.c_str());
+        this->bufferDesc.vertexAttribs  = vertexAttribs;
+    }
+
+    RenderSystem&                           renderSystem;
+    BufferDescriptor                        bufferDesc;
+    std::string                             debugName;
+    std::vector<VertexAttribute>            vertexAttribs;
+    std::uint64_t                           blockSize       = 0;
+    std::vector<BufferSuballocatorBlock>    blocks;
+};
+
+
+/*
+ * BufferSuballocator class
+ */
+
+BufferSuballocator::BufferSuballocator(RenderSystem& renderSystem, const BufferDescriptor& bufferDesc, std::uint64_t blockSize) :
+    pimpl_ { new Pimpl{ renderSystem, bufferDesc, blockSize } }
+{
+}
+
+BufferSuballocator::~BufferSuballocator()
+{
+    for (BufferSuballocatorBlock& block : pimpl_->blocks)
+        pimpl_->renderSystem.Release(*block.buffer);
+    delete pimpl_;
+}
+
+// Returns the least common multiple of the specified alignment and the minimum alignment, so slices are aligned to both.
+static std::uint64_t GetSliceAlignment(std::uint64_t alignment)
+{
+    if (alignment <= BufferSuballocator::minAlignment)
+        return BufferSuballocator::minAlignment;
+
+    std::uint64_t a = alignment, b = BufferSuballocator::minAlignment;
+    while (b != 0)
+    {
+        const std::uint64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return alignment / a * BufferSuballocator::minAlignment;
+}
+
+// Allocates the specified aligned range from the free ranges of the block. Returns false if no free range is large enough.
+static bool AllocFromBlock(BufferSuballocatorBlock& block, std::uint64_t size, std::uint64_t alignment, std::uint64_t& outOffset)
+{
+    for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it)
+    {
+        const std::uint64_t rangeEnd        = it->offset + it->size;
+        const std::uint64_t alignedOffset   = GetAlignedSize<std::uint64_t>(it->offset, alignment);
+        if (alignedOffset + size > rangeEnd)
+            continue;
+
+        /* Split free range into the padding before and the remainder after the slice */
+        const BufferSuballocatorRange prefix{ it->offset, alignedOffset - it->offset };
+        const BufferSuballocatorRange suffix{ alignedOffset + size, rangeEnd - (alignedOffset + size) };
+
+        if (prefix.size > 0 && suffix.size > 0)
+        {
+            *it = prefix;
+            block.freeRanges.insert(it + 1, suffix);
+        }
+        else if (prefix.size > 0)
+            *it = prefix;
+        else if (suffix.size > 0)
+            *it = suffix;
+        else
+            block.freeRanges.erase(it);
+
+        ++block.numSlices;
+        outOffset = alignedOffset;
+        return true;
+    }
+    return false;
+}
+
+BufferSlice BufferSuballocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+    BufferSlice slice;
+
+    if (size == 0)
+        return slice;
+
+    alignment = GetSliceAlignment(alignment);
+
+    /* Find first block with a free range that is large enough */
+    for (BufferSuballocatorBlock& block : pimpl_->blocks)
+    {
+        if (AllocFromBlock(block, size, alignment, slice.offset))
+        {
+            slice.buffer    = block.buffer;
+            slice.size      = size;
+            return slice;
+        }
+    }
+
+    /* Create new block; slices that are larger than the block size get their own buffer */
+    BufferDescriptor blockDesc = pimpl_->bufferDesc;
+    {
+        blockDesc.size = std::max(pimpl_->blockSize, GetAlignedSize<std::uint64_t>(size, minAlignment));
+    }
+    Buffer* buffer = pimpl_->renderSystem.CreateBuffer(blockDesc);
+    if (buffer == nullptr)
+        return slice;
+
+    BufferSuballocatorBlock newBlock;
+    {
+        newBlock.buffer = buffer;
+        newBlock.size   = blockDesc.size;
+        newBlock.freeRanges.push_back(BufferSuballocatorRange{ 0, blockDesc.size });
+    }
+    pimpl_->blocks.push_back(std::move(newBlock));
+
+    const bool allocated = AllocFromBlock(pimpl_->blocks.back(), size, alignment, slice.offset);
+    LLGL_ASSERT(allocated, "failed to allocate slice from new buffer block");
+    (void)allocated;
+
+    slice.buffer    = buffer;
+    slice.size      = size;
+
+    return slice;
+}
+
+void BufferSuballocator::Free(const BufferSlice& slice)
+{
+    if (!slice.IsValid())
+        return;
+
+    auto blockIt = std::find_if(
+        pimpl_->blocks.begin(),
+        pimpl_->blocks.end(),
+        [&slice](const BufferSuballocatorBlock& block) -> bool
+        {
+            return (block.buffer == slice.buffer);
+        }
+    );
+    LLGL_ASSERT(blockIt != pimpl_->blocks.end(), "buffer slice was not allocated by this suballocator");
+    LLGL_ASSERT(slice.offset + slice.size <= blockIt->size, "buffer slice out of bounds");
+    LLGL_ASSERT(blockIt->numSlices > 0);
+
+    std::vector<BufferSuballocatorRange>& freeRanges = blockIt->freeRanges;
+
+    /* Insert range sorted by offset and merge it with adjacent free ranges */
+    auto it = std::lower_bound(
+        freeRanges.begin(),
+        freeRanges.end(),
+        slice.offset,
+        [](const BufferSuballocatorRange& range, std::uint64_t offset) -> bool
+        {
+            return (range.offset < offset);
+        }
+    );
+    it = freeRanges.insert(it, BufferSuballocatorRange{ slice.offset, slice.size });
+
+    auto next = it + 1;
+    if (next != freeRanges.end() && it->offset + it->size == next->offset)
+    {
+        it->size += next->size;
+        it = freeRanges.erase(next) - 1;
+    }
+
+    if (it != freeRanges.begin())
+    {
+        auto prev = it - 1;
+        if (prev->offset + prev->size == it->offset)
+        {
+            prev->size += it->size;
+            freeRanges.erase(it);
+        }
+    }
+
+    --blockIt->numSlices;
+}
+
+std::uint32_t BufferSuballocator::ReleaseUnusedBlocks()
+{
+    std::uint32_t numReleased = 0;
+
+    for (auto it = pimpl_->blocks.begin(); it != pimpl_->blocks.end();)
+    {
+        if (it->numSlices == 0)
+        {
+            pimpl_->renderSystem.Release(*it->buffer);
+            it = pimpl_->blocks.erase(it);
+            ++numReleased;
+        }
+        else
+            ++it;
+    }
+
+    return numReleased;
+}
+
+BufferSuballocatorStatistics BufferSuballocator::GetStatistics() const
+{
+    BufferSuballocatorStatistics stats;
+
+    for (const BufferSuballocatorBlock& block : pimpl_->blocks)
+    {
+        stats.numBlocks++;
+        stats.numSlices += block.numSlices;
+        stats.totalSize += block.size;
+        stats.allocatedSize += block.size;
+        for (const BufferSuballocatorRange& range : block.freeRanges)
+            stats.allocatedSize -= range.size;
+    }
+
+    return stats;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
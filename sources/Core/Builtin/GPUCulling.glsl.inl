@@ -0,0 +1,217 @@
+/*
+ * GPUCulling.glsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+GLSL source of the GPU culling utility for GLSL 430.
+The Hi-Z build pass is selected with the GPU_CULLING_BUILD_HIZ macro, otherwise this is the culling pass.
+See GPUCulling.hlsl.inl for a description of both passes.
+*/
+static const char* g_GPUCulling_GLSL = R"(#version 430
+
+#ifdef GPU_CULLING_REVERSE_DEPTH
+#   define REDUCE_DEPTH min
+#else
+#   define REDUCE_DEPTH max
+#endif
+
+#ifdef GPU_CULLING_BUILD_HIZ
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(binding = 0) uniform sampler2D hiZSrc;
+layout(binding = 1, r32f) writeonly uniform image2D hiZDst;
+
+float LoadSrcDepth(ivec2 pos, ivec2 srcMax)
+{
+    return texelFetch(hiZSrc, min(pos, srcMax), 0).r;
+}
+
+void main()
+{
+    ivec2 dstSize = imageSize(hiZDst);
+    ivec2 srcSize = textureSize(hiZSrc, 0);
+    ivec2 dstPos = ivec2(gl_GlobalInvocationID.xy);
+
+    if (dstPos.x >= dstSize.x || dstPos.y >= dstSize.y)
+        return;
+
+    ivec2 srcPos = dstPos * 2;
+    ivec2 srcMax = srcSize - 1;
+
+    float depth = LoadSrcDepth(srcPos, srcMax);
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(1, 0), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(0, 1), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(1, 1), srcMax));
+
+    // Include extra row and column of odd source extents in the last texels
+    bool extraX = ((srcSize.x & 1) != 0 && dstPos.x + 1 == dstSize.x);
+    bool extraY = ((srcSize.y & 1) != 0 && dstPos.y + 1 == dstSize.y);
+
+    if (extraX)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(2, 0), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(2, 1), srcMax));
+    }
+    if (extraY)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(0, 2), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(1, 2), srcMax));
+    }
+    if (extraX && extraY)
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + ivec2(2, 2), srcMax));
+
+    imageStore(hiZDst, dstPos, vec4(depth));
+}
+
+#else
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct GPUCullingInstance
+{
+    vec4    boundingSphere;
+    uint    numIndices;
+    uint    firstIndex;
+    int     vertexOffset;
+    uint    firstInstance;
+};
+
+layout(std140, binding = 2) uniform GPUCullingConstants
+{
+    mat4    viewProj;
+    vec4    frustumPlanes[6];
+    uvec2   hiZExtent;
+    uint    numHiZMips;
+    uint    numInstances;
+    uint    enableOcclusion;
+    uint    pad0;
+    uint    pad1;
+    uint    pad2;
+};
+
+layout(binding = 0) uniform sampler2D hiZ;
+
+layout(std430, binding = 3) readonly buffer GPUCullingInstances
+{
+    GPUCullingInstance instances[];
+};
+
+layout(std430, binding = 4) writeonly buffer GPUCullingDrawArgs
+{
+    uint drawArgs[];
+};
+
+layout(std430, binding = 5) buffer GPUCullingDrawCount
+{
+    uint drawCount;
+};
+
+bool IsInsideFrustum(vec4 sphere)
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        if (dot(frustumPlanes[i].xyz, sphere.xyz) + frustumPlanes[i].w < -sphere.w)
+            return false;
+    }
+    return true;
+}
+
+vec2 NDCToUV(vec2 ndc)
+{
+    #ifdef GPU_CULLING_LOWER_LEFT_ORIGIN
+    return clamp(ndc * 0.5 + 0.5, 0.0, 1.0);
+    #else
+    return clamp(ndc * vec2(0.5, -0.5) + 0.5, 0.0, 1.0);
+    #endif
+}
+
+bool IsOccluded(vec4 sphere)
+{
+    // Project corners of the sphere's bounding box into NDC
+    vec3 ndcMin = vec3(1.0e30);
+    vec3 ndcMax = vec3(-1.0e30);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        vec3 corner = sphere.xyz + sphere.w * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+        vec4 clipPos = viewProj * vec4(corner, 1.0);
+
+        // Treat bounding boxes that intersect the near plane as visible
+        if (clipPos.w <= 0.0)
+            return false;
+
+        vec3 ndcPos = clipPos.xyz / clipPos.w;
+        ndcMin = min(ndcMin, ndcPos);
+        ndcMax = max(ndcMax, ndcPos);
+    }
+
+    // Get nearest depth of the bounding box in the range [0, 1]
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    float nearestDepth = ndcMax.z;
+    #else
+    float nearestDepth = ndcMin.z;
+    #endif
+
+    #ifdef GPU_CULLING_DEPTH_MINUS_ONE_TO_ONE
+    nearestDepth = nearestDepth * 0.5 + 0.5;
+    #endif
+
+    // Select MIP-map where the screen rectangle covers at most 2x2 texels
+    vec2 uv0 = NDCToUV(ndcMin.xy);
+    vec2 uv1 = NDCToUV(ndcMax.xy);
+    vec2 uvMin = min(uv0, uv1);
+    vec2 uvMax = max(uv0, uv1);
+
+    vec2 rectSize = (uvMax - uvMin) * vec2(hiZExtent);
+    int mipLevel = min(int(ceil(log2(max(max(rectSize.x, rectSize.y), 1.0)))), int(numHiZMips) - 1);
+
+    ivec2 mipMax = ivec2(max(hiZExtent >> uint(mipLevel), uvec2(1))) - 1;
+    ivec2 p0 = min(ivec2(uvMin * vec2(mipMax + 1)), mipMax);
+    ivec2 p1 = min(ivec2(uvMax * vec2(mipMax + 1)), mipMax);
+
+    float occluderDepth = REDUCE_DEPTH(
+        REDUCE_DEPTH(texelFetch(hiZ, ivec2(p0.x, p0.y), mipLevel).r, texelFetch(hiZ, ivec2(p1.x, p0.y), mipLevel).r),
+        REDUCE_DEPTH(texelFetch(hiZ, ivec2(p0.x, p1.y), mipLevel).r, texelFetch(hiZ, ivec2(p1.x, p1.y), mipLevel).r)
+    );
+
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    return (nearestDepth < occluderDepth);
+    #else
+    return (nearestDepth > occluderDepth);
+    #endif
+}
+
+void main()
+{
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= numInstances)
+        return;
+
+    GPUCullingInstance instance = instances[index];
+
+    if (!IsInsideFrustum(instance.boundingSphere))
+        return;
+    if (enableOcclusion != 0u && IsOccluded(instance.boundingSphere))
+        return;
+
+    // Append draw arguments of visible instance
+    uint offset = atomicAdd(drawCount, 1u) * 5u;
+
+    drawArgs[offset    ] = instance.numIndices;
+    drawArgs[offset + 1] = 1u;
+    drawArgs[offset + 2] = instance.firstIndex;
+    drawArgs[offset + 3] = uint(instance.vertexOffset);
+    drawArgs[offset + 4] = instance.firstInstance;
+}
+
+#endif // /GPU_CULLING_BUILD_HIZ
+
+)";
+
+
+
+// ================================================================================
@@ -0,0 +1,197 @@
+/*
+ * GPUCulling.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+HLSL source of the GPU culling utility for cs_5_0 with the entry points "BuildHiZ" and "Cull".
+BuildHiZ reduces 2x2 texels (plus the extra row and column of odd source extents) of one MIP-map into a single texel of the next MIP-map.
+Cull tests one bounding sphere per thread against the frustum planes and the Hi-Z pyramid and appends a DrawIndexedIndirectArguments entry for each visible instance.
+*/
+static const char* g_GPUCulling_HLSL = R"(
+
+#ifdef GPU_CULLING_REVERSE_DEPTH
+#   define REDUCE_DEPTH min
+#else
+#   define REDUCE_DEPTH max
+#endif
+
+struct GPUCullingInstance
+{
+    float4  boundingSphere;
+    uint    numIndices;
+    uint    firstIndex;
+    int     vertexOffset;
+    uint    firstInstance;
+};
+
+cbuffer GPUCullingConstants : register(b2)
+{
+    float4x4    viewProj;
+    float4      frustumPlanes[6];
+    uint2       hiZExtent;
+    uint        numHiZMips;
+    uint        numInstances;
+    uint        enableOcclusion;
+    uint        pad0;
+    uint        pad1;
+    uint        pad2;
+};
+
+Texture2D<float>                        hiZSrc              : register(t0);
+RWTexture2D<float>                      hiZDst              : register(u1);
+
+Texture2D<float>                        hiZ                 : register(t0);
+StructuredBuffer<GPUCullingInstance>    GPUCullingInstances : register(t3);
+RWByteAddressBuffer                     GPUCullingDrawArgs  : register(u4);
+RWByteAddressBuffer                     GPUCullingDrawCount : register(u5);
+
+float LoadSrcDepth(int2 pos, int2 srcMax)
+{
+    return hiZSrc.Load(int3(min(pos, srcMax), 0));
+}
+
+[numthreads(8, 8, 1)]
+void BuildHiZ(uint3 threadID : SV_DispatchThreadID)
+{
+    uint dstWidth, dstHeight, srcWidth, srcHeight;
+    hiZDst.GetDimensions(dstWidth, dstHeight);
+    hiZSrc.GetDimensions(srcWidth, srcHeight);
+
+    if (threadID.x >= dstWidth || threadID.y >= dstHeight)
+        return;
+
+    int2 srcPos = int2(threadID.xy * 2);
+    int2 srcMax = int2(srcWidth, srcHeight) - 1;
+
+    float depth = LoadSrcDepth(srcPos, srcMax);
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(1, 0), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(0, 1), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(1, 1), srcMax));
+
+    // Include extra row and column of odd source extents in the last texels
+    bool extraX = ((srcWidth  & 1) != 0 && threadID.x + 1 == dstWidth);
+    bool extraY = ((srcHeight & 1) != 0 && threadID.y + 1 == dstHeight);
+
+    if (extraX)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(2, 0), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(2, 1), srcMax));
+    }
+    if (extraY)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(0, 2), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(1, 2), srcMax));
+    }
+    if (extraX && extraY)
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(srcPos + int2(2, 2), srcMax));
+
+    hiZDst[threadID.xy] = depth;
+}
+
+bool IsInsideFrustum(float4 sphere)
+{
+    [unroll]
+    for (uint i = 0; i < 6; ++i)
+    {
+        if (dot(frustumPlanes[i].xyz, sphere.xyz) + frustumPlanes[i].w < -sphere.w)
+            return false;
+    }
+    return true;
+}
+
+float2 NDCToUV(float2 ndc)
+{
+    #ifdef GPU_CULLING_LOWER_LEFT_ORIGIN
+    return saturate(ndc * 0.5 + 0.5);
+    #else
+    return saturate(ndc * float2(0.5, -0.5) + 0.5);
+    #endif
+}
+
+bool IsOccluded(float4 sphere)
+{
+    // Project corners of the sphere's bounding box into NDC
+    float3 ndcMin = (float3)1.0e30;
+    float3 ndcMax = (float3)-1.0e30;
+
+    [unroll]
+    for (uint i = 0; i < 8; ++i)
+    {
+        float3 corner = sphere.xyz + sphere.w * float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+        float4 clipPos = mul(viewProj, float4(corner, 1.0));
+
+        // Treat bounding boxes that intersect the near plane as visible
+        if (clipPos.w <= 0.0)
+            return false;
+
+        float3 ndcPos = clipPos.xyz / clipPos.w;
+        ndcMin = min(ndcMin, ndcPos);
+        ndcMax = max(ndcMax, ndcPos);
+    }
+
+    // Get nearest depth of the bounding box in the range [0, 1]
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    float nearestDepth = ndcMax.z;
+    #else
+    float nearestDepth = ndcMin.z;
+    #endif
+
+    #ifdef GPU_CULLING_DEPTH_MINUS_ONE_TO_ONE
+    nearestDepth = nearestDepth * 0.5 + 0.5;
+    #endif
+
+    // Select MIP-map where the screen rectangle covers at most 2x2 texels
+    float2 uv0 = NDCToUV(ndcMin.xy);
+    float2 uv1 = NDCToUV(ndcMax.xy);
+    float2 uvMin = min(uv0, uv1);
+    float2 uvMax = max(uv0, uv1);
+
+    float2 rectSize = (uvMax - uvMin) * float2(hiZExtent);
+    uint mipLevel = min((uint)ceil(log2(max(max(rectSize.x, rectSize.y), 1.0))), numHiZMips - 1);
+
+    int2 mipMax = int2(max(hiZExtent >> mipLevel, 1)) - 1;
+    int2 p0 = min(int2(uvMin * float2(mipMax + 1)), mipMax);
+    int2 p1 = min(int2(uvMax * float2(mipMax + 1)), mipMax);
+
+    float occluderDepth = REDUCE_DEPTH(
+        REDUCE_DEPTH(hiZ.Load(int3(p0.x, p0.y, mipLevel)), hiZ.Load(int3(p1.x, p0.y, mipLevel))),
+        REDUCE_DEPTH(hiZ.Load(int3(p0.x, p1.y, mipLevel)), hiZ.Load(int3(p1.x, p1.y, mipLevel)))
+    );
+
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    return (nearestDepth < occluderDepth);
+    #else
+    return (nearestDepth > occluderDepth);
+    #endif
+}
+
+[numthreads(64, 1, 1)]
+void Cull(uint3 threadID : SV_DispatchThreadID)
+{
+    if (threadID.x >= numInstances)
+        return;
+
+    GPUCullingInstance instance = GPUCullingInstances[threadID.x];
+
+    if (!IsInsideFrustum(instance.boundingSphere))
+        return;
+    if (enableOcclusion != 0 && IsOccluded(instance.boundingSphere))
+        return;
+
+    // Append draw arguments of visible instance
+    uint drawIndex;
+    GPUCullingDrawCount.InterlockedAdd(0, 1, drawIndex);
+
+    uint offset = drawIndex * 20;
+    GPUCullingDrawArgs.Store4(offset, uint4(instance.numIndices, 1, instance.firstIndex, asuint(instance.vertexOffset)));
+    GPUCullingDrawArgs.Store(offset + 16, instance.firstInstance);
+}
+
+)";
+
+
+
+// ================================================================================
@@ -0,0 +1,213 @@
+/*
+ * GPUCulling.metal.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Metal source of the GPU culling utility with the kernels "BuildHiZFromDepth", "BuildHiZ", and "Cull".
+BuildHiZFromDepth is only used for the first Hi-Z MIP-map, since depth textures can only be read through depth2d in Metal.
+See GPUCulling.hlsl.inl for a description of both passes.
+*/
+static const char* g_GPUCulling_Metal = R"(
+
+#include <metal_stdlib>
+
+using namespace metal;
+
+#ifdef GPU_CULLING_REVERSE_DEPTH
+#   define REDUCE_DEPTH min
+#else
+#   define REDUCE_DEPTH max
+#endif
+
+struct GPUCullingInstance
+{
+    float4  boundingSphere;
+    uint    numIndices;
+    uint    firstIndex;
+    int     vertexOffset;
+    uint    firstInstance;
+};
+
+struct GPUCullingConstants
+{
+    float4x4    viewProj;
+    float4      frustumPlanes[6];
+    uint2       hiZExtent;
+    uint        numHiZMips;
+    uint        numInstances;
+    uint        enableOcclusion;
+    uint        pad0;
+    uint        pad1;
+    uint        pad2;
+};
+
+float LoadSrcDepth(depth2d<float, access::read> hiZSrc, int2 pos, int2 srcMax)
+{
+    return hiZSrc.read(uint2(min(pos, srcMax)));
+}
+
+float LoadSrcDepth(texture2d<float, access::read> hiZSrc, int2 pos, int2 srcMax)
+{
+    return hiZSrc.read(uint2(min(pos, srcMax))).r;
+}
+
+template <typename TSrcTexture>
+void ReduceHiZ(TSrcTexture hiZSrc, texture2d<float, access::write> hiZDst, uint2 threadID)
+{
+    uint2 dstSize = uint2(hiZDst.get_width(), hiZDst.get_height());
+    uint2 srcSize = uint2(hiZSrc.get_width(), hiZSrc.get_height());
+
+    if (threadID.x >= dstSize.x || threadID.y >= dstSize.y)
+        return;
+
+    int2 srcPos = int2(threadID * 2);
+    int2 srcMax = int2(srcSize) - 1;
+
+    float depth = LoadSrcDepth(hiZSrc, srcPos, srcMax);
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(1, 0), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(0, 1), srcMax));
+    depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(1, 1), srcMax));
+
+    // Include extra row and column of odd source extents in the last texels
+    bool extraX = ((srcSize.x & 1) != 0 && threadID.x + 1 == dstSize.x);
+    bool extraY = ((srcSize.y & 1) != 0 && threadID.y + 1 == dstSize.y);
+
+    if (extraX)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(2, 0), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(2, 1), srcMax));
+    }
+    if (extraY)
+    {
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(0, 2), srcMax));
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(1, 2), srcMax));
+    }
+    if (extraX && extraY)
+        depth = REDUCE_DEPTH(depth, LoadSrcDepth(hiZSrc, srcPos + int2(2, 2), srcMax));
+
+    hiZDst.write(float4(depth), threadID);
+}
+
+kernel void BuildHiZFromDepth(
+    depth2d<float, access::read>    hiZSrc      [[texture(0)]],
+    texture2d<float, access::write> hiZDst      [[texture(1)]],
+    uint2                           threadID    [[thread_position_in_grid]])
+{
+    ReduceHiZ(hiZSrc, hiZDst, threadID);
+}
+
+kernel void BuildHiZ(
+    texture2d<float, access::read>  hiZSrc      [[texture(0)]],
+    texture2d<float, access::write> hiZDst      [[texture(1)]],
+    uint2                           threadID    [[thread_position_in_grid]])
+{
+    ReduceHiZ(hiZSrc, hiZDst, threadID);
+}
+
+bool IsInsideFrustum(constant GPUCullingConstants& constants, float4 sphere)
+{
+    for (uint i = 0; i < 6; ++i)
+    {
+        if (dot(constants.frustumPlanes[i].xyz, sphere.xyz) + constants.frustumPlanes[i].w < -sphere.w)
+            return false;
+    }
+    return true;
+}
+
+float2 NDCToUV(float2 ndc)
+{
+    #ifdef GPU_CULLING_LOWER_LEFT_ORIGIN
+    return saturate(ndc * 0.5 + 0.5);
+    #else
+    return saturate(ndc * float2(0.5, -0.5) + 0.5);
+    #endif
+}
+
+bool IsOccluded(constant GPUCullingConstants& constants, texture2d<float, access::read> hiZ, float4 sphere)
+{
+    // Project corners of the sphere's bounding box into NDC
+    float3 ndcMin = float3(1.0e30);
+    float3 ndcMax = float3(-1.0e30);
+
+    for (uint i = 0; i < 8; ++i)
+    {
+        float3 corner = sphere.xyz + sphere.w * float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+        float4 clipPos = constants.viewProj * float4(corner, 1.0);
+
+        // Treat bounding boxes that intersect the near plane as visible
+        if (clipPos.w <= 0.0)
+            return false;
+
+        float3 ndcPos = clipPos.xyz / clipPos.w;
+        ndcMin = min(ndcMin, ndcPos);
+        ndcMax = max(ndcMax, ndcPos);
+    }
+
+    // Get nearest depth of the bounding box in the range [0, 1]
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    float nearestDepth = ndcMax.z;
+    #else
+    float nearestDepth = ndcMin.z;
+    #endif
+
+    // Select MIP-map where the screen rectangle covers at most 2x2 texels
+    float2 uv0 = NDCToUV(ndcMin.xy);
+    float2 uv1 = NDCToUV(ndcMax.xy);
+    float2 uvMin = min(uv0, uv1);
+    float2 uvMax = max(uv0, uv1);
+
+    float2 rectSize = (uvMax - uvMin) * float2(constants.hiZExtent);
+    uint mipLevel = min(uint(ceil(log2(max(max(rectSize.x, rectSize.y), 1.0)))), constants.numHiZMips - 1);
+
+    int2 mipMax = int2(max(constants.hiZExtent >> mipLevel, uint2(1))) - 1;
+    uint2 p0 = uint2(min(int2(uvMin * float2(mipMax + 1)), mipMax));
+    uint2 p1 = uint2(min(int2(uvMax * float2(mipMax + 1)), mipMax));
+
+    float occluderDepth = REDUCE_DEPTH(
+        REDUCE_DEPTH(hiZ.read(uint2(p0.x, p0.y), mipLevel).r, hiZ.read(uint2(p1.x, p0.y), mipLevel).r),
+        REDUCE_DEPTH(hiZ.read(uint2(p0.x, p1.y), mipLevel).r, hiZ.read(uint2(p1.x, p1.y), mipLevel).r)
+    );
+
+    #ifdef GPU_CULLING_REVERSE_DEPTH
+    return (nearestDepth < occluderDepth);
+    #else
+    return (nearestDepth > occluderDepth);
+    #endif
+}
+
+kernel void Cull(
+    texture2d<float, access::read>      hiZ                 [[texture(0)]],
+    constant GPUCullingConstants&       constants           [[buffer(2)]],
+    device const GPUCullingInstance*    GPUCullingInstances [[buffer(3)]],
+    device uint*                        GPUCullingDrawArgs  [[buffer(4)]],
+    device atomic_uint*                 GPUCullingDrawCount [[buffer(5)]],
+    uint                                threadID            [[thread_position_in_grid]])
+{
+    if (threadID >= constants.numInstances)
+        return;
+
+    GPUCullingInstance instance = GPUCullingInstances[threadID];
+
+    if (!IsInsideFrustum(constants, instance.boundingSphere))
+        return;
+    if (constants.enableOcclusion != 0 && IsOccluded(constants, hiZ, instance.boundingSphere))
+        return;
+
+    // Append draw arguments of visible instance
+    uint offset = atomic_fetch_add_explicit(GPUCullingDrawCount, 1u, memory_order_relaxed) * 5;
+
+    GPUCullingDrawArgs[offset    ] = instance.numIndices;
+    GPUCullingDrawArgs[offset + 1] = 1;
+    GPUCullingDrawArgs[offset + 2] = instance.firstIndex;
+    GPUCullingDrawArgs[offset + 3] = as_type<uint>(instance.vertexOffset);
+    GPUCullingDrawArgs[offset + 4] = instance.firstInstance;
+}
+
+)";
+
+
+
+// ================================================================================
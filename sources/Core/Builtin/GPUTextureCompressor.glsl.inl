@@ -0,0 +1,185 @@
+/*
+ * GPUTextureCompressor.glsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+GLSL source of the GPU texture compressor for GLSL 430.
+The BC3 encoder is selected with the GPU_TEXTURE_COMPRESSOR_BC3 macro, otherwise this encodes BC1 blocks.
+See GPUTextureCompressor.hlsl.inl for a description of the encoders.
+*/
+static const char* g_GPUTextureCompressor_GLSL = R"(#version 430
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(std140, binding = 1) uniform GPUTextureCompressorConstants
+{
+    uvec2   numBlocks;
+    uvec2   srcExtent;
+    uint    srcMipLevel;
+    uint    encodeSRGB;
+    uint    pad0;
+    uint    pad1;
+};
+
+layout(binding = 0) uniform sampler2D srcTexture;
+
+layout(std430, binding = 2) writeonly buffer GPUTextureCompressorBlocks
+{
+    uint blocks[];
+};
+
+vec3 LinearToSRGB(vec3 color)
+{
+    return mix(1.055 * pow(color, vec3(1.0/2.4)) - 0.055, color * 12.92, lessThanEqual(color, vec3(0.0031308)));
+}
+
+void LoadBlock(uvec2 blockPos, out vec4 texels[16])
+{
+    ivec2 srcMax = ivec2(srcExtent) - 1;
+
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        // Replicate edge texels for blocks that exceed the source extent
+        ivec2 pos = min(ivec2(blockPos * 4u + uvec2(i % 4u, i / 4u)), srcMax);
+        vec4 color = clamp(texelFetch(srcTexture, pos, int(srcMipLevel)), 0.0, 1.0);
+        if (encodeSRGB != 0u)
+            color.rgb = LinearToSRGB(color.rgb);
+        texels[i] = color;
+    }
+}
+
+uint PackRGB565(vec3 color)
+{
+    uvec3 c = uvec3(round(clamp(color, 0.0, 1.0) * vec3(31.0, 63.0, 31.0)));
+    return (c.r << 11) | (c.g << 5) | c.b;
+}
+
+vec3 UnpackRGB565(uint color)
+{
+    return vec3((color >> 11) & 31u, (color >> 5) & 63u, color & 31u) / vec3(31.0, 63.0, 31.0);
+}
+
+// Encodes the RGB components into a 64-bit color block in four-color mode
+uvec2 CompressColorBlock(vec4 texels[16])
+{
+    vec3 minColor = texels[0].rgb;
+    vec3 maxColor = texels[0].rgb;
+
+    for (uint i = 1u; i < 16u; ++i)
+    {
+        minColor = min(minColor, texels[i].rgb);
+        maxColor = max(maxColor, texels[i].rgb);
+    }
+
+    // Inset bounding box to reduce the error of the interpolated colors; packing is monotonic, so color0 >= color1
+    vec3 inset = (maxColor - minColor) / 16.0;
+    uint color0 = PackRGB565(maxColor - inset);
+    uint color1 = PackRGB565(minColor + inset);
+
+    uvec2 block = uvec2(color0 | (color1 << 16), 0u);
+    if (color0 == color1)
+        return block;
+
+    vec3 palette[4];
+    palette[0] = UnpackRGB565(color0);
+    palette[1] = UnpackRGB565(color1);
+    palette[2] = mix(palette[0], palette[1], 1.0/3.0);
+    palette[3] = mix(palette[0], palette[1], 2.0/3.0);
+
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        uint    bestIndex   = 0u;
+        float   bestDist    = 1.0e30;
+
+        for (uint j = 0u; j < 4u; ++j)
+        {
+            vec3 diff = texels[i].rgb - palette[j];
+            float dist = dot(diff, diff);
+            if (dist < bestDist)
+            {
+                bestIndex   = j;
+                bestDist    = dist;
+            }
+        }
+
+        block.y |= bestIndex << (i * 2u);
+    }
+
+    return block;
+}
+
+// Encodes the alpha components into a 64-bit alpha block in eight-alpha mode
+uvec2 CompressAlphaBlock(vec4 texels[16])
+{
+    float minAlpha = texels[0].a;
+    float maxAlpha = texels[0].a;
+
+    for (uint i = 1u; i < 16u; ++i)
+    {
+        minAlpha = min(minAlpha, texels[i].a);
+        maxAlpha = max(maxAlpha, texels[i].a);
+    }
+
+    uint alpha0 = uint(round(maxAlpha * 255.0));
+    uint alpha1 = uint(round(minAlpha * 255.0));
+
+    uvec2 block = uvec2(alpha0 | (alpha1 << 8), 0u);
+    if (alpha0 == alpha1)
+        return block;
+
+    // Indices 0 and 1 select the endpoints, indices 2 to 7 interpolate from alpha0 to alpha1
+    float scale = 7.0 / float(alpha0 - alpha1);
+
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        uint step   = uint(clamp(round((float(alpha0) - texels[i].a * 255.0) * scale), 0.0, 7.0));
+        uint index  = (step == 0u ? 0u : (step == 7u ? 1u : step + 1u));
+
+        // 3-bit indices start at bit 16 and the index of the sixth texel straddles both words
+        uint bitOffset = 16u + i * 3u;
+        if (bitOffset < 32u)
+        {
+            block.x |= index << bitOffset;
+            if (bitOffset + 3u > 32u)
+                block.y |= index >> (32u - bitOffset);
+        }
+        else
+            block.y |= index << (bitOffset - 32u);
+    }
+
+    return block;
+}
+
+void main()
+{
+    uvec2 blockPos = gl_GlobalInvocationID.xy;
+    if (blockPos.x >= numBlocks.x || blockPos.y >= numBlocks.y)
+        return;
+
+    vec4 texels[16];
+    LoadBlock(blockPos, texels);
+
+    uint blockIndex = blockPos.y * numBlocks.x + blockPos.x;
+
+    #ifdef GPU_TEXTURE_COMPRESSOR_BC3
+    uvec2 alphaBlock = CompressAlphaBlock(texels);
+    uvec2 colorBlock = CompressColorBlock(texels);
+    blocks[blockIndex * 4u     ] = alphaBlock.x;
+    blocks[blockIndex * 4u + 1u] = alphaBlock.y;
+    blocks[blockIndex * 4u + 2u] = colorBlock.x;
+    blocks[blockIndex * 4u + 3u] = colorBlock.y;
+    #else
+    uvec2 colorBlock = CompressColorBlock(texels);
+    blocks[blockIndex * 2u     ] = colorBlock.x;
+    blocks[blockIndex * 2u + 1u] = colorBlock.y;
+    #endif
+}
+
+)";
+
+
+
+// ================================================================================
@@ -0,0 +1,173 @@
+/*
+ * GPUTextureCompressor.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+HLSL source of the GPU texture compressor for cs_5_0 with the entry point "CompressBlocks".
+Each thread loads one 4x4 block of the source texture and stores the encoded BC1 (8 bytes) or BC3 (16 bytes) block
+into the block buffer in row-major order, i.e. the same layout CopyTextureFromBuffer expects for tightly packed compressed textures.
+Colors are interpolated between the inset bounding box of the block colors and alpha between the minimum and maximum alpha value.
+*/
+static const char* g_GPUTextureCompressor_HLSL = R"(
+
+cbuffer GPUTextureCompressorConstants : register(b1)
+{
+    uint2   numBlocks;
+    uint2   srcExtent;
+    uint    srcMipLevel;
+    uint    encodeSRGB;
+    uint    pad0;
+    uint    pad1;
+};
+
+Texture2D<float4>   srcTexture                  : register(t0);
+RWByteAddressBuffer GPUTextureCompressorBlocks  : register(u2);
+
+float3 LinearToSRGB(float3 color)
+{
+    return (color <= 0.0031308 ? color * 12.92 : 1.055 * pow(color, 1.0/2.4) - 0.055);
+}
+
+void LoadBlock(uint2 blockPos, out float4 texels[16])
+{
+    int2 srcMax = int2(srcExtent) - 1;
+
+    for (uint i = 0; i < 16; ++i)
+    {
+        // Replicate edge texels for blocks that exceed the source extent
+        int2 pos = min(int2(blockPos * 4 + uint2(i % 4, i / 4)), srcMax);
+        float4 color = saturate(srcTexture.Load(int3(pos, srcMipLevel)));
+        if (encodeSRGB != 0)
+            color.rgb = LinearToSRGB(color.rgb);
+        texels[i] = color;
+    }
+}
+
+uint PackRGB565(float3 color)
+{
+    uint3 c = uint3(round(saturate(color) * float3(31.0, 63.0, 31.0)));
+    return (c.r << 11) | (c.g << 5) | c.b;
+}
+
+float3 UnpackRGB565(uint color)
+{
+    return float3((color >> 11) & 31, (color >> 5) & 63, color & 31) / float3(31.0, 63.0, 31.0);
+}
+
+// Encodes the RGB components into a 64-bit color block in four-color mode
+uint2 CompressColorBlock(float4 texels[16])
+{
+    float3 minColor = texels[0].rgb;
+    float3 maxColor = texels[0].rgb;
+
+    for (uint i = 1; i < 16; ++i)
+    {
+        minColor = min(minColor, texels[i].rgb);
+        maxColor = max(maxColor, texels[i].rgb);
+    }
+
+    // Inset bounding box to reduce the error of the interpolated colors; packing is monotonic, so color0 >= color1
+    float3 inset = (maxColor - minColor) / 16.0;
+    uint color0 = PackRGB565(maxColor - inset);
+    uint color1 = PackRGB565(minColor + inset);
+
+    uint2 block = uint2(color0 | (color1 << 16), 0);
+    if (color0 == color1)
+        return block;
+
+    float3 palette[4];
+    palette[0] = UnpackRGB565(color0);
+    palette[1] = UnpackRGB565(color1);
+    palette[2] = lerp(palette[0], palette[1], 1.0/3.0);
+    palette[3] = lerp(palette[0], palette[1], 2.0/3.0);
+
+    for (uint i = 0; i < 16; ++i)
+    {
+        uint    bestIndex   = 0;
+        float   bestDist    = 1.0e30;
+
+        for (uint j = 0; j < 4; ++j)
+        {
+            float3 diff = texels[i].rgb - palette[j];
+            float dist = dot(diff, diff);
+            if (dist < bestDist)
+            {
+                bestIndex   = j;
+                bestDist    = dist;
+            }
+        }
+
+        block.y |= bestIndex << (i * 2);
+    }
+
+    return block;
+}
+
+// Encodes the alpha components into a 64-bit alpha block in eight-alpha mode
+uint2 CompressAlphaBlock(float4 texels[16])
+{
+    float minAlpha = texels[0].a;
+    float maxAlpha = texels[0].a;
+
+    for (uint i = 1; i < 16; ++i)
+    {
+        minAlpha = min(minAlpha, texels[i].a);
+        maxAlpha = max(maxAlpha, texels[i].a);
+    }
+
+    uint alpha0 = uint(round(maxAlpha * 255.0));
+    uint alpha1 = uint(round(minAlpha * 255.0));
+
+    uint2 block = uint2(alpha0 | (alpha1 << 8), 0);
+    if (alpha0 == alpha1)
+        return block;
+
+    // Indices 0 and 1 select the endpoints, indices 2 to 7 interpolate from alpha0 to alpha1
+    float scale = 7.0 / float(alpha0 - alpha1);
+
+    for (uint i = 0; i < 16; ++i)
+    {
+        uint step   = uint(clamp(round((float(alpha0) - texels[i].a * 255.0) * scale), 0.0, 7.0));
+        uint index  = (step == 0 ? 0 : (step == 7 ? 1 : step + 1));
+
+        // 3-bit indices start at bit 16 and the index of the sixth texel straddles both words
+        uint bitOffset = 16 + i * 3;
+        if (bitOffset < 32)
+        {
+            block.x |= index << bitOffset;
+            if (bitOffset + 3 > 32)
+                block.y |= index >> (32 - bitOffset);
+        }
+        else
+            block.y |= index << (bitOffset - 32);
+    }
+
+    return block;
+}
+
+[numthreads(8, 8, 1)]
+void CompressBlocks(uint3 threadID : SV_DispatchThreadID)
+{
+    if (threadID.x >= numBlocks.x || threadID.y >= numBlocks.y)
+        return;
+
+    float4 texels[16];
+    LoadBlock(threadID.xy, texels);
+
+    uint blockIndex = threadID.y * numBlocks.x + threadID.x;
+
+    #ifdef GPU_TEXTURE_COMPRESSOR_BC3
+    GPUTextureCompressorBlocks.Store4(blockIndex * 16, uint4(CompressAlphaBlock(texels), CompressColorBlock(texels)));
+    #else
+    GPUTextureCompressorBlocks.Store2(blockIndex * 8, CompressColorBlock(texels));
+    #endif
+}
+
+)";
+
+
+
+// ================================================================================
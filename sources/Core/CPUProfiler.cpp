@@ -0,0 +1,292 @@
+/*
+ * CPUProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CPUProfiler.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace LLGL
+{
+
+namespace CPUProfiler
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Maximum number of records each thread can buffer between two calls to CollectResults.
+static constexpr std::uint64_t g_threadBufferCapacity = 8192;
+
+// Maximum nesting depth of scopes that are recorded. Deeper scopes are ignored.
+static constexpr std::uint32_t g_maxScopeDepth = 64;
+
+struct CPUProfileRecord
+{
+    const char*     name;
+    std::uint64_t   ticksStart;
+    std::int64_t    ticksEndOrValue;    // End tick for scopes or value for counters
+    std::uint32_t   depth;
+    bool            isCounter;
+};
+
+/*
+Buffer of records for a single thread. Only the owning thread writes records and only CollectResults reads them,
+so the write and read positions are sufficient to hand over records without a lock.
+*/
+struct CPUProfileThreadBuffer
+{
+    std::uint32_t                       threadID        = 0;
+    std::unique_ptr<CPUProfileRecord[]> records         { new CPUProfileRecord[g_threadBufferCapacity] };
+    std::atomic<std::uint64_t>          writePos        { 0 };
+    std::atomic<std::uint64_t>          readPos         { 0 };
+    std::atomic<bool>                   retired         { false };  // Set when the owning thread has terminated
+
+    // Only accessed by the owning thread
+    std::uint32_t                       scopeDepth      = 0;
+    const char*                         scopeNames[g_maxScopeDepth];
+    std::uint64_t                       scopeTicks[g_maxScopeDepth];
+};
+
+using CPUProfileThreadBufferPtr = std::shared_ptr<CPUProfileThreadBuffer>;
+
+struct CPUProfilerState
+{
+    std::atomic<bool>                       enabled             { false };
+    std::atomic<std::uint64_t>              numDroppedRecords   { 0 };
+    std::mutex                              lock;                           // Guards the list of thread buffers
+    std::vector<CPUProfileThreadBufferPtr>  threadBuffers;
+    std::uint32_t                           nextThreadID        = 1;
+};
+
+// Marks the thread buffer as retired when its thread terminates, so CollectResults can release it once it has been drained.
+struct CPUProfileThreadBufferOwner
+{
+    ~CPUProfileThreadBufferOwner()
+    {
+        if (buffer)
+            buffer->retired.store(true, std::memory_order_release);
+    }
+
+    CPUProfileThreadBufferPtr buffer;
+};
+
+static CPUProfilerState                         g_cpuProfilerState;
+static thread_local CPUProfileThreadBufferOwner g_cpuProfileThreadBuffer;
+
+
+/*
+ * Internal functions
+ */
+
+static CPUProfileThreadBuffer& GetThreadBuffer()
+{
+    if (!g_cpuProfileThreadBuffer.buffer)
+    {
+        /* Register new buffer for the calling thread; this is the only time a recording thread takes the lock */
+        auto buffer = std::make_shared<CPUProfileThreadBuffer>();
+        std::lock_guard<std::mutex> guard{ g_cpuProfilerState.lock };
+        buffer->threadID = g_cpuProfilerState.nextThreadID++;
+        g_cpuProfilerState.threadBuffers.push_back(buffer);
+        g_cpuProfileThreadBuffer.buffer = std::move(buffer);
+    }
+    return *g_cpuProfileThreadBuffer.buffer;
+}
+
+static void WriteRecord(CPUProfileThreadBuffer& buffer, const CPUProfileRecord& record)
+{
+    const std::uint64_t writePos = buffer.writePos.load(std::memory_order_relaxed);
+    if (writePos - buffer.readPos.load(std::memory_order_acquire) >= g_threadBufferCapacity)
+    {
+        /* Drop record if the buffer is full, recording must never wait for the collector */
+        g_cpuProfilerState.numDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer.records[writePos % g_threadBufferCapacity] = record;
+    buffer.writePos.store(writePos + 1, std::memory_order_release);
+}
+
+static void AccumCounter(std::vector<CPUProfileCounter>& counters, const char* name, std::int64_t value)
+{
+    for (CPUProfileCounter& counter : counters)
+    {
+        if (counter.name == name)
+        {
+            counter.value += value;
+            return;
+        }
+    }
+    CPUProfileCounter counter;
+    {
+        counter.name    = name;
+        counter.value   = value;
+    }
+    counters.push_back(counter);
+}
+
+
+/*
+ * Functions
+ */
+
+LLGL_EXPORT void SetEnabled(bool enable)
+{
+    g_cpuProfilerState.enabled.store(enable, std::memory_order_relaxed);
+}
+
+LLGL_EXPORT bool IsEnabled()
+{
+    return g_cpuProfilerState.enabled.load(std::memory_order_relaxed);
+}
+
+LLGL_EXPORT bool BeginScope(const char* name)
+{
+    if (!g_cpuProfilerState.enabled.load(std::memory_order_relaxed))
+        return false;
+
+    CPUProfileThreadBuffer& buffer = GetThreadBuffer();
+    if (buffer.scopeDepth < g_maxScopeDepth)
+    {
+        buffer.scopeNames[buffer.scopeDepth] = name;
+        buffer.scopeTicks[buffer.scopeDepth] = Timer::Tick();
+    }
+    ++buffer.scopeDepth;
+
+    return true;
+}
+
+LLGL_EXPORT void EndScope()
+{
+    CPUProfileThreadBuffer& buffer = GetThreadBuffer();
+    if (buffer.scopeDepth == 0)
+        return;
+
+    const std::uint32_t depth = --buffer.scopeDepth;
+    if (depth < g_maxScopeDepth)
+    {
+        CPUProfileRecord record;
+        {
+            record.name             = buffer.scopeNames[depth];
+            record.ticksStart       = buffer.scopeTicks[depth];
+            record.ticksEndOrValue  = static_cast<std::int64_t>(Timer::Tick());
+            record.depth            = depth;
+            record.isCounter        = false;
+        }
+        WriteRecord(buffer, record);
+    }
+}
+
+LLGL_EXPORT void RecordScope(const char* name, std::uint64_t ticksStart, std::uint64_t ticksEnd)
+{
+    if (!g_cpuProfilerState.enabled.load(std::memory_order_relaxed))
+        return;
+
+    CPUProfileThreadBuffer& buffer = GetThreadBuffer();
+    CPUProfileRecord record;
+    {
+        record.name             = name;
+        record.ticksStart       = ticksStart;
+        record.ticksEndOrValue  = static_cast<std::int64_t>(ticksEnd);
+        record.depth            = buffer.scopeDepth;
+        record.isCounter        = false;
+    }
+    WriteRecord(buffer, record);
+}
+
+LLGL_EXPORT void AddCounter(const char* name, std::int64_t value)
+{
+    if (!g_cpuProfilerState.enabled.load(std::memory_order_relaxed))
+        return;
+
+    CPUProfileRecord record;
+    {
+        record.name             = name;
+        record.ticksStart       = 0;
+        record.ticksEndOrValue  = value;
+        record.depth            = 0;
+        record.isCounter        = true;
+    }
+    WriteRecord(GetThreadBuffer(), record);
+}
+
+LLGL_EXPORT void CollectResults(DynamicVector<CPUProfileRegion>& outRegions, DynamicVector<CPUProfileCounter>* outCounters)
+{
+    outRegions.clear();
+
+    std::vector<CPUProfileCounter> counters;
+
+    std::lock_guard<std::mutex> guard{ g_cpuProfilerState.lock };
+
+    for (auto it = g_cpuProfilerState.threadBuffers.begin(); it != g_cpuProfilerState.threadBuffers.end();)
+    {
+        CPUProfileThreadBuffer& buffer = **it;
+
+        /* Check retirement before reading the write position, so no record of a terminated thread is missed */
+        const bool          retired     = buffer.retired.load(std::memory_order_acquire);
+        const std::uint64_t writePos    = buffer.writePos.load(std::memory_order_acquire);
+        const std::uint64_t readPos     = buffer.readPos.load(std::memory_order_relaxed);
+
+        for (std::uint64_t pos = readPos; pos < writePos; ++pos)
+        {
+            const CPUProfileRecord& record = buffer.records[pos % g_threadBufferCapacity];
+            if (record.isCounter)
+                AccumCounter(counters, record.name, record.ticksEndOrValue);
+            else
+            {
+                CPUProfileRegion region;
+                {
+                    region.name             = record.name;
+                    region.threadID         = buffer.threadID;
+                    region.depth            = record.depth;
+                    region.cpuTicksStart    = record.ticksStart;
+                    region.cpuTicksEnd      = static_cast<std::uint64_t>(record.ticksEndOrValue);
+                }
+                outRegions.push_back(region);
+            }
+        }
+
+        /* Hand the records back to the owning thread */
+        buffer.readPos.store(writePos, std::memory_order_release);
+
+        if (retired)
+            it = g_cpuProfilerState.threadBuffers.erase(it);
+        else
+            ++it;
+    }
+
+    std::sort(
+        outRegions.begin(),
+        outRegions.end(),
+        [](const CPUProfileRegion& lhs, const CPUProfileRegion& rhs) -> bool
+        {
+            return (lhs.cpuTicksStart < rhs.cpuTicksStart);
+        }
+    );
+
+    if (outCounters != nullptr)
+        *outCounters = DynamicVector<CPUProfileCounter>{ counters.begin(), counters.end() };
+}
+
+LLGL_EXPORT std::uint64_t GetNumDroppedRecords()
+{
+    return g_cpuProfilerState.numDroppedRecords.load(std::memory_order_relaxed);
+}
+
+
+} // /namespace CPUProfiler
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,106 @@
+/*
+ * CPUProfilerUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CPU_PROFILER_UTILS_H
+#define LLGL_CPU_PROFILER_UTILS_H
+
+
+#include <LLGL/CPUProfiler.h>
+#include <LLGL/Timer.h>
+#include <LLGL/NonCopyable.h>
+#include <mutex>
+#include <cstdint>
+
+
+// Records a CPU profiling scope with the specified name until the end of the current block.
+#define LLGL_CPU_PROFILE_SCOPE(NAME) \
+    LLGL::CPUProfiler::Scope cpuProfileScope_{ NAME }
+
+/*
+Locks the specified mutex until the end of the current block like std::lock_guard.
+If the mutex is already locked by another thread, the CPU profiling counters "<NAME>.Contentions" and "<NAME>.WaitTicks" are incremented.
+NAME must be a string literal.
+*/
+#define LLGL_CPU_PROFILE_LOCK_GUARD(MUTEX, NAME) \
+    LLGL::CPUProfileLockGuard cpuProfileLockGuard_{ MUTEX, NAME ".Contentions", NAME ".WaitTicks" }
+
+
+namespace LLGL
+{
+
+
+// Helper class to record a CPU profiling scope that spans multiple function calls, e.g. command buffer encoding between Begin and End.
+class CPUProfileSpan
+{
+
+    public:
+
+        // Stores the current CPU tick if CPU profiling is enabled.
+        inline void Begin()
+        {
+            ticksStart_ = (CPUProfiler::IsEnabled() ? Timer::Tick() : 0);
+        }
+
+        // Records the scope with the specified name if it was started with CPU profiling enabled.
+        inline void End(const char* name)
+        {
+            if (ticksStart_ != 0)
+            {
+                CPUProfiler::RecordScope(name, ticksStart_, Timer::Tick());
+                ticksStart_ = 0;
+            }
+        }
+
+    private:
+
+        std::uint64_t ticksStart_ = 0;
+
+};
+
+// Lock guard that records contention in CPU profiling counters. The uncontended path only adds a single try_lock.
+class CPUProfileLockGuard : public NonCopyable
+{
+
+    public:
+
+        inline CPUProfileLockGuard(std::mutex& mutex, const char* contentionsName, const char* waitTicksName) :
+            mutex_ { mutex }
+        {
+            if (!mutex_.try_lock())
+            {
+                if (CPUProfiler::IsEnabled())
+                {
+                    const std::uint64_t ticksStart = Timer::Tick();
+                    mutex_.lock();
+                    CPUProfiler::AddCounter(contentionsName);
+                    CPUProfiler::AddCounter(waitTicksName, static_cast<std::int64_t>(Timer::Tick() - ticksStart));
+                }
+                else
+                    mutex_.lock();
+            }
+        }
+
+        inline ~CPUProfileLockGuard()
+        {
+            mutex_.unlock();
+        }
+
+    private:
+
+        std::mutex& mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,195 @@
+/*
+ * ChromeTrace.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ChromeTrace.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <string>
+#include <set>
+#include <cstdio>
+#include <cinttypes>
+
+
+namespace LLGL
+{
+
+
+enum ChromeTraceProcess
+{
+    ChromeTraceProcessFrames    = 0,
+    ChromeTraceProcessCPU       = 1,
+    ChromeTraceProcessGPU       = 2,
+};
+
+static void AppendJSONString(std::string& s, const char* str)
+{
+    s += '\"';
+    for (; str != nullptr && *str != '\0'; ++str)
+    {
+        const char c = *str;
+        if (c == '\"' || c == '\\')
+        {
+            s += '\\';
+            s += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            ::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            s += escaped;
+        }
+        else
+            s += c;
+    }
+    s += '\"';
+}
+
+static void AppendEventSeparator(std::string& s, bool& isFirstEvent)
+{
+    if (isFirstEvent)
+        isFirstEvent = false;
+    else
+        s += ",\n";
+}
+
+static void AppendCompleteEvent(
+    std::string&    s,
+    bool&           isFirstEvent,
+    const char*     name,
+    int             pid,
+    std::uint32_t   tid,
+    double          timestamp,
+    double          duration)
+{
+    AppendEventSeparator(s, isFirstEvent);
+
+    char buffer[128];
+    s += "{\"name\":";
+    AppendJSONString(s, name);
+    ::snprintf(buffer, sizeof(buffer), ",\"ph\":\"X\",\"pid\":%d,\"tid\":%" PRIu32 ",\"ts\":%.3f,\"dur\":%.3f}", pid, tid, timestamp, duration);
+    s += buffer;
+}
+
+static void AppendMetadataEvent(
+    std::string&    s,
+    bool&           isFirstEvent,
+    const char*     type,
+    int             pid,
+    std::uint32_t   tid,
+    const char*     name)
+{
+    AppendEventSeparator(s, isFirstEvent);
+
+    char buffer[64];
+    s += "{\"name\":";
+    AppendJSONString(s, type);
+    ::snprintf(buffer, sizeof(buffer), ",\"ph\":\"M\",\"pid\":%d,\"tid\":%" PRIu32 ",\"args\":{\"name\":", pid, tid);
+    s += buffer;
+    AppendJSONString(s, name);
+    s += "}}";
+}
+
+LLGL_EXPORT UTF8String ToChromeTrace(const ArrayView<FrameProfile>& frameProfiles)
+{
+    /* Find earliest CPU tick to start the trace at zero */
+    std::uint64_t baseTicks = UINT64_MAX;
+    for (const FrameProfile& profile : frameProfiles)
+    {
+        for (const ProfileTimeRecord& record : profile.timeRecords)
+        {
+            if (record.cpuTicksStart != 0)
+                baseTicks = std::min(baseTicks, record.cpuTicksStart);
+        }
+    }
+    if (baseTicks == UINT64_MAX)
+        baseTicks = 0;
+
+    /* Converts CPU ticks into microseconds relative to the start of the trace */
+    const double ticksToMicroseconds = 1.0e6 / static_cast<double>(std::max<std::uint64_t>(1, Timer::Frequency()));
+    auto TicksToTimestamp = [baseTicks, ticksToMicroseconds](std::uint64_t ticks) -> double
+    {
+        return static_cast<double>(ticks - std::min(ticks, baseTicks)) * ticksToMicroseconds;
+    };
+
+    std::string s;
+    s += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    bool                    isFirstEvent    = true;
+    double                  gpuCursor       = 0.0;
+    std::set<std::uint32_t> commandBufferIDs;
+    std::size_t             frameIndex      = 0;
+
+    for (const FrameProfile& profile : frameProfiles)
+    {
+        double frameBegin   = -1.0;
+        double frameEnd     = 0.0;
+
+        for (const ProfileTimeRecord& record : profile.timeRecords)
+        {
+            const bool hasCPUTime = (record.cpuTicksStart != 0 && record.cpuTicksEnd >= record.cpuTicksStart);
+            double cpuEnd = gpuCursor;
+
+            if (hasCPUTime)
+            {
+                /* Write CPU span on the command queue or command buffer timeline */
+                const double cpuBegin = TicksToTimestamp(record.cpuTicksStart);
+                cpuEnd = TicksToTimestamp(record.cpuTicksEnd);
+                AppendCompleteEvent(s, isFirstEvent, record.annotation, ChromeTraceProcessCPU, record.commandBufferID, cpuBegin, cpuEnd - cpuBegin);
+                commandBufferIDs.insert(record.commandBufferID);
+
+                frameBegin  = (frameBegin < 0.0 ? cpuBegin : std::min(frameBegin, cpuBegin));
+                frameEnd    = std::max(frameEnd, cpuEnd);
+            }
+
+            if (record.elapsedTime > 0)
+            {
+                /* Write GPU span back-to-back with the previous one, but not before the command was encoded */
+                const double gpuBegin       = std::max(gpuCursor, cpuEnd);
+                const double gpuDuration    = static_cast<double>(record.elapsedTime) / 1000.0;
+                AppendCompleteEvent(s, isFirstEvent, record.annotation, ChromeTraceProcessGPU, 0, gpuBegin, gpuDuration);
+                gpuCursor = gpuBegin + gpuDuration;
+            }
+        }
+
+        if (frameBegin >= 0.0)
+        {
+            /* Write span for the entire frame */
+            char frameName[32];
+            ::snprintf(frameName, sizeof(frameName), "Frame %zu", frameIndex);
+            AppendCompleteEvent(s, isFirstEvent, frameName, ChromeTraceProcessFrames, 0, frameBegin, frameEnd - frameBegin);
+        }
+
+        ++frameIndex;
+    }
+
+    /* Write names of processes and threads */
+    AppendMetadataEvent(s, isFirstEvent, "process_name", ChromeTraceProcessFrames, 0, "Frames");
+    AppendMetadataEvent(s, isFirstEvent, "process_name", ChromeTraceProcessCPU, 0, "CPU");
+    AppendMetadataEvent(s, isFirstEvent, "process_name", ChromeTraceProcessGPU, 0, "GPU");
+    AppendMetadataEvent(s, isFirstEvent, "thread_name", ChromeTraceProcessGPU, 0, "GPU Commands");
+
+    for (std::uint32_t id : commandBufferIDs)
+    {
+        char threadName[32];
+        if (id == 0)
+            ::snprintf(threadName, sizeof(threadName), "CommandQueue");
+        else
+            ::snprintf(threadName, sizeof(threadName), "CommandBuffer %" PRIu32, id);
+        AppendMetadataEvent(s, isFirstEvent, "thread_name", ChromeTraceProcessCPU, id, threadName);
+    }
+
+    s += "\n]}\n";
+
+    return UTF8String{ s };
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
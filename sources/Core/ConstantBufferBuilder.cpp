@@ -0,0 +1,470 @@
+/*
+ * ConstantBufferBuilder.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ConstantBufferBuilder.h>
+#include "CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <vector>
+#include <cstring>
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_CBUFFER_SSE2
+#   include <emmintrin.h>
+#elif (defined __ARM_NEON && defined __aarch64__) || defined _M_ARM64
+#   define LLGL_CBUFFER_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Single copy operation from the packed CPU data into the constant buffer
+struct ConstantBufferCopy
+{
+    std::uint32_t srcOffset;
+    std::uint32_t dstOffset;
+    std::uint32_t size;
+};
+
+struct ConstantBufferBuilder::Pimpl
+{
+    ConstantBufferPacking               packing     = ConstantBufferPacking::Std140;
+    std::uint32_t                       size        = 0;
+    std::uint32_t                       packedSize  = 0;
+    std::vector<ConstantBufferField>    fields;
+    std::vector<ConstantBufferCopy>     copies;
+};
+
+
+/*
+ * Internal functions
+ */
+
+// Returns the component size and the number of rows and columns of the specified uniform type, or false if it does not occupy constant buffer memory.
+static bool GetUniformTypeShape(UniformType type, std::uint32_t& componentSize, std::uint32_t& numRows, std::uint32_t& numColumns)
+{
+    switch (type)
+    {
+        case UniformType::Float1:       componentSize = 4; numRows = 1; numColumns = 1; return true;
+        case UniformType::Float2:       componentSize = 4; numRows = 2; numColumns = 1; return true;
+        case UniformType::Float3:       componentSize = 4; numRows = 3; numColumns = 1; return true;
+        case UniformType::Float4:       componentSize = 4; numRows = 4; numColumns = 1; return true;
+        case UniformType::Double1:      componentSize = 8; numRows = 1; numColumns = 1; return true;
+        case UniformType::Double2:      componentSize = 8; numRows = 2; numColumns = 1; return true;
+        case UniformType::Double3:      componentSize = 8; numRows = 3; numColumns = 1; return true;
+        case UniformType::Double4:      componentSize = 8; numRows = 4; numColumns = 1; return true;
+        case UniformType::Int1:         componentSize = 4; numRows = 1; numColumns = 1; return true;
+        case UniformType::Int2:         componentSize = 4; numRows = 2; numColumns = 1; return true;
+        case UniformType::Int3:         componentSize = 4; numRows = 3; numColumns = 1; return true;
+        case UniformType::Int4:         componentSize = 4; numRows = 4; numColumns = 1; return true;
+        case UniformType::UInt1:        componentSize = 4; numRows = 1; numColumns = 1; return true;
+        case UniformType::UInt2:        componentSize = 4; numRows = 2; numColumns = 1; return true;
+        case UniformType::UInt3:        componentSize = 4; numRows = 3; numColumns = 1; return true;
+        case UniformType::UInt4:        componentSize = 4; numRows = 4; numColumns = 1; return true;
+        case UniformType::Bool1:        componentSize = 4; numRows = 1; numColumns = 1; return true;
+        case UniformType::Bool2:        componentSize = 4; numRows = 2; numColumns = 1; return true;
+        case UniformType::Bool3:        componentSize = 4; numRows = 3; numColumns = 1; return true;
+        case UniformType::Bool4:        componentSize = 4; numRows = 4; numColumns = 1; return true;
+        case UniformType::Float2x2:     componentSize = 4; numRows = 2; numColumns = 2; return true;
+        case UniformType::Float2x3:     componentSize = 4; numRows = 3; numColumns = 2; return true;
+        case UniformType::Float2x4:     componentSize = 4; numRows = 4; numColumns = 2; return true;
+        case UniformType::Float3x2:     componentSize = 4; numRows = 2; numColumns = 3; return true;
+        case UniformType::Float3x3:     componentSize = 4; numRows = 3; numColumns = 3; return true;
+        case UniformType::Float3x4:     componentSize = 4; numRows = 4; numColumns = 3; return true;
+        case UniformType::Float4x2:     componentSize = 4; numRows = 2; numColumns = 4; return true;
+        case UniformType::Float4x3:     componentSize = 4; numRows = 3; numColumns = 4; return true;
+        case UniformType::Float4x4:     componentSize = 4; numRows = 4; numColumns = 4; return true;
+        case UniformType::Double2x2:    componentSize = 8; numRows = 2; numColumns = 2; return true;
+        case UniformType::Double2x3:    componentSize = 8; numRows = 3; numColumns = 2; return true;
+        case UniformType::Double2x4:    componentSize = 8; numRows = 4; numColumns = 2; return true;
+        case UniformType::Double3x2:    componentSize = 8; numRows = 2; numColumns = 3; return true;
+        case UniformType::Double3x3:    componentSize = 8; numRows = 3; numColumns = 3; return true;
+        case UniformType::Double3x4:    componentSize = 8; numRows = 4; numColumns = 3; return true;
+        case UniformType::Double4x2:    componentSize = 8; numRows = 2; numColumns = 4; return true;
+        case UniformType::Double4x3:    componentSize = 8; numRows = 3; numColumns = 4; return true;
+        case UniformType::Double4x4:    componentSize = 8; numRows = 4; numColumns = 4; return true;
+        default:                        return false;
+    }
+}
+
+static bool IsFloatMatrixType(UniformType type)
+{
+    return (type >= UniformType::Float2x2 && type <= UniformType::Float4x4);
+}
+
+static bool IsFloatType(UniformType type)
+{
+    return ((type >= UniformType::Float1 && type <= UniformType::Float4) || IsFloatMatrixType(type));
+}
+
+// Returns the base alignment of a vector with the specified number of components: N for scalars, 2N for 2-vectors, and 4N for 3- and 4-vectors.
+static std::uint32_t GetVectorAlignment(std::uint32_t componentSize, std::uint32_t numRows)
+{
+    return componentSize * (numRows == 1 ? 1 : (numRows == 2 ? 2 : 4));
+}
+
+// Compiles the strides of the specified field and returns its alignment within the constant buffer
+static std::uint32_t CompileFieldStrides(ConstantBufferField& field, ConstantBufferPacking packing, bool isArray)
+{
+    const std::uint32_t columnSize  = field.numRows * field.componentSize;
+    const bool          isMatrix    = (field.numColumns > 1);
+
+    switch (packing)
+    {
+        case ConstantBufferPacking::Std140:
+        case ConstantBufferPacking::Std430:
+        {
+            const bool          std140          = (packing == ConstantBufferPacking::Std140);
+            std::uint32_t       alignment       = GetVectorAlignment(field.componentSize, field.numRows);
+
+            /* Matrices are stored like arrays of column vectors */
+            if (isMatrix)
+            {
+                if (std140)
+                    alignment = GetAlignedSize(alignment, 16u);
+                field.columnStride = alignment;
+            }
+            else
+                field.columnStride = columnSize;
+
+            const std::uint32_t elementSize = (field.numColumns - 1) * field.columnStride + columnSize;
+
+            /* Array elements are rounded up to their alignment, which is rounded up to a vec4 in std140 */
+            if (isArray && std140)
+                alignment = GetAlignedSize(alignment, 16u);
+            field.elementStride = GetAlignedSize(elementSize, alignment);
+
+            field.size = (isArray || isMatrix ? field.elementStride * field.numElements : elementSize);
+            return alignment;
+        }
+
+        case ConstantBufferPacking::HLSL:
+        {
+            /* Each matrix column and array element starts a new 16-byte register; the padding after the last one is not part of the field */
+            field.columnStride  = (isMatrix ? GetAlignedSize(columnSize, 16u) : columnSize);
+            const std::uint32_t elementSize = (field.numColumns - 1) * field.columnStride + columnSize;
+            field.elementStride = GetAlignedSize(elementSize, 16u);
+            field.size          = (field.numElements - 1) * field.elementStride + elementSize;
+            return (isArray || isMatrix ? 16u : field.componentSize);
+        }
+
+        case ConstantBufferPacking::Uniforms:
+        {
+            /* Same layout as GetUniformTypeSize() in PipelineStateUtils.cpp */
+            field.columnStride  = columnSize;
+            const std::uint32_t elementSize = field.numColumns * columnSize;
+            field.elementStride = GetAlignedSize(elementSize, 16u);
+            field.size          = (field.numElements - 1) * field.elementStride + elementSize;
+            return 1u;
+        }
+    }
+
+    return 1u;
+}
+
+// Returns the offset for the specified field, i.e. the current offset rounded up to the field's alignment
+static std::uint32_t GetFieldOffset(const ConstantBufferField& field, ConstantBufferPacking packing, std::uint32_t offset, std::uint32_t alignment)
+{
+    offset = GetAlignedSize(offset, alignment);
+
+    /* HLSL fields must not straddle a 16-byte register */
+    if (packing == ConstantBufferPacking::HLSL && (offset % 16u) + field.size > 16u)
+        offset = GetAlignedSize(offset, 16u);
+
+    return offset;
+}
+
+// Appends a copy operation and merges it with the previous one if both are contiguous in source and destination memory
+static void AppendCopy(std::vector<ConstantBufferCopy>& copies, std::uint32_t srcOffset, std::uint32_t dstOffset, std::uint32_t size)
+{
+    if (!copies.empty())
+    {
+        ConstantBufferCopy& prev = copies.back();
+        if (prev.srcOffset + prev.size == srcOffset && prev.dstOffset + prev.size == dstOffset)
+        {
+            prev.size += size;
+            return;
+        }
+    }
+    copies.push_back(ConstantBufferCopy{ srcOffset, dstOffset, size });
+}
+
+// Copies the specified number of bytes with fixed-size copies for the common column sizes, so they compile into plain (vector) moves
+static inline void CopyColumn(char* dst, const char* src, std::uint32_t size)
+{
+    switch (size)
+    {
+        case 4:     std::memcpy(dst, src, 4);       break;
+        case 8:     std::memcpy(dst, src, 8);       break;
+        case 12:    std::memcpy(dst, src, 12);      break;
+        case 16:    std::memcpy(dst, src, 16);      break;
+        default:    std::memcpy(dst, src, size);    break;
+    }
+}
+
+// Writes the specified elements of a field from tightly packed, column-major source data
+static void WriteFieldElements(char* dst, const ConstantBufferField& field, const char* src, std::uint32_t firstElement, std::uint32_t count)
+{
+    const std::uint32_t columnSize  = field.numRows * field.componentSize;
+    const std::uint32_t elementSize = field.GetPackedElementSize();
+
+    dst += field.offset + firstElement * field.elementStride;
+
+    /* Copy all elements at once if the field has no padding */
+    if (field.columnStride == columnSize && field.elementStride == elementSize)
+    {
+        std::memcpy(dst, src, count * elementSize);
+        return;
+    }
+
+    for_range(i, count)
+    {
+        char* dstColumn = dst + i * field.elementStride;
+        for_range(j, field.numColumns)
+        {
+            CopyColumn(dstColumn, src, columnSize);
+            dstColumn   += field.columnStride;
+            src         += columnSize;
+        }
+    }
+}
+
+// Writes a single row-major 4x4 matrix as column-major matrix with the specified column stride
+static void WriteTransposedMatrix4x4(char* dst, const float* src, std::uint32_t columnStride)
+{
+    #if defined LLGL_CBUFFER_SSE2
+
+    __m128 row0 = _mm_loadu_ps(src);
+    __m128 row1 = _mm_loadu_ps(src + 4);
+    __m128 row2 = _mm_loadu_ps(src + 8);
+    __m128 row3 = _mm_loadu_ps(src + 12);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst                   ), row0);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + columnStride    ), row1);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + columnStride * 2), row2);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + columnStride * 3), row3);
+
+    #elif defined LLGL_CBUFFER_NEON
+
+    /* De-interleaving load returns the columns of a row-major matrix */
+    const float32x4x4_t columns = vld4q_f32(src);
+    vst1q_f32(reinterpret_cast<float*>(dst                   ), columns.val[0]);
+    vst1q_f32(reinterpret_cast<float*>(dst + columnStride    ), columns.val[1]);
+    vst1q_f32(reinterpret_cast<float*>(dst + columnStride * 2), columns.val[2]);
+    vst1q_f32(reinterpret_cast<float*>(dst + columnStride * 3), columns.val[3]);
+
+    #else
+
+    for_range(col, 4)
+    {
+        const float column[4] = { src[col], src[4 + col], src[8 + col], src[12 + col] };
+        std::memcpy(dst + col * columnStride, column, sizeof(column));
+    }
+
+    #endif // /LLGL_CBUFFER_SSE2
+}
+
+// Writes a single row-major matrix as column-major matrix
+static void WriteTransposedMatrix(char* dst, const ConstantBufferField& field, const float* src)
+{
+    if (field.numColumns == 4 && field.numRows == 4)
+        WriteTransposedMatrix4x4(dst, src, field.columnStride);
+    else
+    {
+        for_range(col, field.numColumns)
+        {
+            float column[4];
+            for_range(row, field.numRows)
+                column[row] = src[row * field.numColumns + col];
+            std::memcpy(dst + col * field.columnStride, column, field.numRows * sizeof(float));
+        }
+    }
+}
+
+
+/*
+ * ConstantBufferBuilder class
+ */
+
+ConstantBufferBuilder::ConstantBufferBuilder(const ArrayView<UniformDescriptor>& uniforms, ConstantBufferPacking packing) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->packing = packing;
+    pimpl_->fields.reserve(uniforms.size());
+
+    std::uint32_t offset        = 0;
+    std::uint32_t packedOffset  = 0;
+    std::uint32_t maxAlignment  = 1;
+
+    for (const UniformDescriptor& uniform : uniforms)
+    {
+        ConstantBufferField field;
+        if (!GetUniformTypeShape(uniform.type, field.componentSize, field.numRows, field.numColumns))
+            continue;
+
+        field.name          = uniform.name;
+        field.type          = uniform.type;
+        field.numElements   = std::max(1u, uniform.arraySize);
+
+        const std::uint32_t alignment = CompileFieldStrides(field, packing, uniform.arraySize > 0);
+
+        field.offset        = GetFieldOffset(field, packing, offset, alignment);
+        field.packedOffset  = packedOffset;
+
+        /* Compile copy operations for each column of each element */
+        const std::uint32_t columnSize = field.numRows * field.componentSize;
+        for_range(i, field.numElements)
+        {
+            for_range(j, field.numColumns)
+            {
+                AppendCopy(
+                    pimpl_->copies,
+                    packedOffset,
+                    field.offset + i * field.elementStride + j * field.columnStride,
+                    columnSize
+                );
+                packedOffset += columnSize;
+            }
+        }
+
+        offset          = field.offset + field.size;
+        maxAlignment    = std::max(maxAlignment, alignment);
+
+        pimpl_->fields.push_back(std::move(field));
+    }
+
+    /* Round up total size: std430 to the largest field alignment, std140 and HLSL to a full vec4 */
+    switch (packing)
+    {
+        case ConstantBufferPacking::Std140:
+        case ConstantBufferPacking::HLSL:
+            pimpl_->size = GetAlignedSize(offset, 16u);
+            break;
+        case ConstantBufferPacking::Std430:
+            pimpl_->size = GetAlignedSize(offset, maxAlignment);
+            break;
+        case ConstantBufferPacking::Uniforms:
+            pimpl_->size = offset;
+            break;
+    }
+
+    pimpl_->packedSize = packedOffset;
+}
+
+ConstantBufferBuilder::~ConstantBufferBuilder()
+{
+    delete pimpl_;
+}
+
+std::uint32_t ConstantBufferBuilder::GetSize() const
+{
+    return pimpl_->size;
+}
+
+std::uint32_t ConstantBufferBuilder::GetPackedSize() const
+{
+    return pimpl_->packedSize;
+}
+
+ConstantBufferPacking ConstantBufferBuilder::GetPacking() const
+{
+    return pimpl_->packing;
+}
+
+ArrayView<ConstantBufferField> ConstantBufferBuilder::GetFields() const
+{
+    return pimpl_->fields;
+}
+
+std::uint32_t ConstantBufferBuilder::FindField(const StringView& name) const
+{
+    for_range(i, pimpl_->fields.size())
+    {
+        if (name == StringView{ pimpl_->fields[i].name })
+            return static_cast<std::uint32_t>(i);
+    }
+    return ConstantBufferBuilder::invalidField;
+}
+
+std::uint32_t ConstantBufferBuilder::Write(void* dst, std::uint32_t field, const void* data, std::uint32_t count, std::uint32_t firstElement) const
+{
+    if (field >= pimpl_->fields.size())
+        return 0;
+
+    const ConstantBufferField& fieldRef = pimpl_->fields[field];
+    if (firstElement >= fieldRef.numElements)
+        return 0;
+
+    count = std::min(count, fieldRef.numElements - firstElement);
+    WriteFieldElements(static_cast<char*>(dst), fieldRef, static_cast<const char*>(data), firstElement, count);
+
+    return count;
+}
+
+std::uint32_t ConstantBufferBuilder::WriteMatrix(void* dst, std::uint32_t field, const float* data, std::uint32_t count, bool rowMajor) const
+{
+    if (field >= pimpl_->fields.size())
+        return 0;
+
+    const ConstantBufferField& fieldRef = pimpl_->fields[field];
+    if (!IsFloatMatrixType(fieldRef.type))
+        return 0;
+
+    count = std::min(count, fieldRef.numElements);
+
+    if (rowMajor)
+    {
+        char*               dstElement  = static_cast<char*>(dst) + fieldRef.offset;
+        const std::uint32_t srcStride   = fieldRef.numColumns * fieldRef.numRows;
+        for_range(i, count)
+        {
+            WriteTransposedMatrix(dstElement, fieldRef, data);
+            dstElement  += fieldRef.elementStride;
+            data        += srcStride;
+        }
+    }
+    else
+        WriteFieldElements(static_cast<char*>(dst), fieldRef, reinterpret_cast<const char*>(data), 0, count);
+
+    return count;
+}
+
+void ConstantBufferBuilder::WriteAll(void* dst, const void* packedData) const
+{
+    char*       dstBytes = static_cast<char*>(dst);
+    const char* srcBytes = static_cast<const char*>(packedData);
+
+    for (const ConstantBufferCopy& copy : pimpl_->copies)
+        CopyColumn(dstBytes + copy.dstOffset, srcBytes + copy.srcOffset, copy.size);
+}
+
+std::uint32_t ConstantBufferBuilder::SetFloats(void* dst, std::uint32_t field, const float* values, std::size_t numValues) const
+{
+    if (field >= pimpl_->fields.size())
+        return 0;
+
+    const ConstantBufferField& fieldRef = pimpl_->fields[field];
+    if (!IsFloatType(fieldRef.type))
+        return 0;
+
+    const std::size_t numElementValues = fieldRef.numColumns * fieldRef.numRows;
+    return Write(dst, field, values, static_cast<std::uint32_t>(numValues / numElementValues));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
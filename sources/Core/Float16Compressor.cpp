@@ -7,6 +7,14 @@
 
 #include "Float16Compressor.h"
 
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_FLOAT16_SSE2
+#   include <emmintrin.h>
+#elif (defined __ARM_NEON && defined __aarch64__) || defined _M_ARM64
+#   define LLGL_FLOAT16_NEON
+#   include <arm_neon.h>
+#endif
+
 
 namespace LLGL
 {
@@ -57,6 +65,150 @@ class Float16Compressor
             return v.f;
         }
 
+        /*
+        The array functions are vectorized ports of the scalar functions above.
+        Hardware conversions (F16C, NEON) are not used, because they round to nearest
+        whereas the scalar compressor truncates and both must produce the same results.
+        */
+        static void CompressArray(const float* src, std::uint16_t* dst, std::size_t count)
+        {
+            std::size_t i = 0;
+
+            #if defined LLGL_FLOAT16_SSE2
+
+            for (; i + 8 <= count; i += 8)
+            {
+                /* Results are within [0, 0xFFFF], so sign-extend them from 16 bits to pack with signed saturation */
+                const __m128i lo = _mm_srai_epi32(_mm_slli_epi32(Compress4(_mm_loadu_ps(src + i    )), 16), 16);
+                const __m128i hi = _mm_srai_epi32(_mm_slli_epi32(Compress4(_mm_loadu_ps(src + i + 4)), 16), 16);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+            }
+
+            #elif defined LLGL_FLOAT16_NEON
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x4_t lo = vmovn_u32(vreinterpretq_u32_s32(Compress4(vld1q_f32(src + i    ))));
+                const uint16x4_t hi = vmovn_u32(vreinterpretq_u32_s32(Compress4(vld1q_f32(src + i + 4))));
+                vst1q_u16(dst + i, vcombine_u16(lo, hi));
+            }
+
+            #endif
+
+            for (; i < count; ++i)
+                dst[i] = Compress(src[i]);
+        }
+
+        static void DecompressArray(const std::uint16_t* src, float* dst, std::size_t count)
+        {
+            std::size_t i = 0;
+
+            #if defined LLGL_FLOAT16_SSE2
+
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_ps(dst + i,     Decompress4(_mm_unpacklo_epi16(v, zero)));
+                _mm_storeu_ps(dst + i + 4, Decompress4(_mm_unpackhi_epi16(v, zero)));
+            }
+
+            #elif defined LLGL_FLOAT16_NEON
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x8_t v = vld1q_u16(src + i);
+                vst1q_f32(dst + i,     Decompress4(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v)))));
+                vst1q_f32(dst + i + 4, Decompress4(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v)))));
+            }
+
+            #endif
+
+            for (; i < count; ++i)
+                dst[i] = Decompress(src[i]);
+        }
+
+    private:
+
+        #if defined LLGL_FLOAT16_SSE2
+
+        // Returns (mask ? b : a) for each component.
+        static __m128i Select(__m128i a, __m128i b, __m128i mask)
+        {
+            return _mm_xor_si128(a, _mm_and_si128(_mm_xor_si128(a, b), mask));
+        }
+
+        // Returns four 16-bit floats in the lower half of each 32-bit component.
+        static __m128i Compress4(__m128 value)
+        {
+            __m128i v = _mm_castps_si128(value);
+            __m128i sign = _mm_and_si128(v, _mm_set1_epi32(signN));
+            v = _mm_xor_si128(v, sign);
+            sign = _mm_srli_epi32(sign, shiftSign);
+            const __m128i s = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(_mm_set1_epi32(mulN)), _mm_castsi128_ps(v)));
+            v = Select(v, s, _mm_cmpgt_epi32(_mm_set1_epi32(minN), v));
+            v = Select(v, _mm_set1_epi32(infN), _mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32(infN), v), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxN))));
+            v = Select(v, _mm_set1_epi32(nanN), _mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32(nanN), v), _mm_cmpgt_epi32(v, _mm_set1_epi32(infN))));
+            v = _mm_srli_epi32(v, shift);
+            v = Select(v, _mm_sub_epi32(v, _mm_set1_epi32(maxD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxC)));
+            v = Select(v, _mm_sub_epi32(v, _mm_set1_epi32(minD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(subC)));
+            return _mm_or_si128(v, sign);
+        }
+
+        // Decompresses four 16-bit floats stored in the lower half of each 32-bit component.
+        static __m128 Decompress4(__m128i value)
+        {
+            __m128i v = value;
+            __m128i sign = _mm_and_si128(v, _mm_set1_epi32(signC));
+            v = _mm_xor_si128(v, sign);
+            sign = _mm_slli_epi32(sign, shiftSign);
+            v = Select(v, _mm_add_epi32(v, _mm_set1_epi32(minD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(subC)));
+            v = Select(v, _mm_add_epi32(v, _mm_set1_epi32(maxD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxC)));
+            const __m128i s = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_mm_set1_epi32(mulC)), _mm_cvtepi32_ps(v)));
+            const __m128i mask = _mm_cmpgt_epi32(_mm_set1_epi32(norC), v);
+            v = _mm_slli_epi32(v, shift);
+            v = Select(v, s, mask);
+            return _mm_castsi128_ps(_mm_or_si128(v, sign));
+        }
+
+        #elif defined LLGL_FLOAT16_NEON
+
+        // Returns four 16-bit floats in the lower half of each 32-bit component.
+        static int32x4_t Compress4(float32x4_t value)
+        {
+            int32x4_t v = vreinterpretq_s32_f32(value);
+            int32x4_t sign = vandq_s32(v, vdupq_n_s32(signN));
+            v = veorq_s32(v, sign);
+            sign = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(sign), shiftSign));
+            const int32x4_t s = vcvtq_s32_f32(vmulq_f32(vreinterpretq_f32_s32(vdupq_n_s32(mulN)), vreinterpretq_f32_s32(v)));
+            v = vbslq_s32(vcgtq_s32(vdupq_n_s32(minN), v), s, v);
+            v = vbslq_s32(vandq_u32(vcgtq_s32(vdupq_n_s32(infN), v), vcgtq_s32(v, vdupq_n_s32(maxN))), vdupq_n_s32(infN), v);
+            v = vbslq_s32(vandq_u32(vcgtq_s32(vdupq_n_s32(nanN), v), vcgtq_s32(v, vdupq_n_s32(infN))), vdupq_n_s32(nanN), v);
+            v = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(v), shift));
+            v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(maxC)), vsubq_s32(v, vdupq_n_s32(maxD)), v);
+            v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(subC)), vsubq_s32(v, vdupq_n_s32(minD)), v);
+            return vorrq_s32(v, sign);
+        }
+
+        // Decompresses four 16-bit floats stored in the lower half of each 32-bit component.
+        static float32x4_t Decompress4(int32x4_t value)
+        {
+            int32x4_t v = value;
+            int32x4_t sign = vandq_s32(v, vdupq_n_s32(signC));
+            v = veorq_s32(v, sign);
+            sign = vshlq_n_s32(sign, shiftSign);
+            v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(subC)), vaddq_s32(v, vdupq_n_s32(minD)), v);
+            v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(maxC)), vaddq_s32(v, vdupq_n_s32(maxD)), v);
+            const int32x4_t s = vreinterpretq_s32_f32(vmulq_f32(vreinterpretq_f32_s32(vdupq_n_s32(mulC)), vcvtq_f32_s32(v)));
+            const uint32x4_t mask = vcgtq_s32(vdupq_n_s32(norC), v);
+            v = vshlq_n_s32(v, shift);
+            v = vbslq_s32(mask, s, v);
+            return vreinterpretq_f32_s32(vorrq_s32(v, sign));
+        }
+
+        #endif
+
     private:
 
         union Bits
@@ -102,6 +254,16 @@ LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
     return Float16Compressor::Decompress(value);
 }
 
+LLGL_EXPORT void CompressFloat16Array(const float* srcValues, std::uint16_t* dstValues, std::size_t count)
+{
+    Float16Compressor::CompressArray(srcValues, dstValues, count);
+}
+
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* srcValues, float* dstValues, std::size_t count)
+{
+    Float16Compressor::DecompressArray(srcValues, dstValues, count);
+}
+
 
 } // /namespace LLGL
 
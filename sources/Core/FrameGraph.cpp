@@ -0,0 +1,766 @@
+/*
+ * FrameGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/FrameGraph.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderTarget.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include "Assertion.h"
+#include <algorithm>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+static constexpr std::uint32_t g_invalidPassIndex = ~0u;
+
+struct FrameGraphResourceEntry
+{
+    bool                        isTexture   = false;
+    bool                        isImported  = false;
+    std::string                 debugName;
+    TextureDescriptor           textureDesc;
+    BufferDescriptor            bufferDesc;
+    Texture*                    texture     = nullptr;
+    Buffer*                     buffer      = nullptr;
+    std::vector<std::uint32_t>  producers;                          // Indices of passes that write to this resource
+    std::uint32_t               refCount    = 0;                    // Number of passes that read this resource
+    std::uint32_t               firstPass   = g_invalidPassIndex;   // Index of the first pass that uses this resource
+    std::uint32_t               lastPass    = 0;                    // Index of the last pass that uses this resource
+};
+
+struct FrameGraphPassEntry
+{
+    std::string                 name;
+    FrameGraphPassDescriptor    desc;
+    FrameGraphExecuteFunction   execute;
+    std::uint32_t               refCount    = 0;                    // Number of resources written by this pass that are still used
+    bool                        culled      = false;
+};
+
+struct FrameGraphCachedTexture
+{
+    TextureDescriptor   desc;
+    Texture*            texture         = nullptr;
+    std::uint64_t       lastUsedFrame   = 0;
+    std::uint32_t       busyUntilPass   = 0;
+};
+
+struct FrameGraphCachedBuffer
+{
+    BufferDescriptor    desc;
+    Buffer*             buffer          = nullptr;
+    std::uint64_t       lastUsedFrame   = 0;
+    std::uint32_t       busyUntilPass   = 0;
+};
+
+struct FrameGraphCachedRenderTarget
+{
+    Texture*            colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    Texture*            depthStencilAttachment;
+    RenderTarget*       renderTarget;
+    std::uint64_t       lastUsedFrame;
+};
+
+struct FrameGraphAliasingGroup
+{
+    std::uint64_t       lastUsedFrame   = 0;
+    std::uint32_t       busyUntilPass   = 0;
+};
+
+
+/*
+ * FrameGraph::Pimpl struct
+ */
+
+struct FrameGraph::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem) :
+        renderSystem { renderSystem }
+    {
+    }
+
+    RenderSystem&                               renderSystem;
+    std::uint32_t                               maxUnusedFrames     = 0;
+    std::uint32_t                               firstAliasingGroup  = 0;
+    std::uint64_t                               currentFrame        = 1;
+
+    std::vector<FrameGraphResourceEntry>        resources;
+    std::vector<FrameGraphPassEntry>            passes;
+
+    std::vector<FrameGraphCachedTexture>        cachedTextures;
+    std::vector<FrameGraphCachedBuffer>         cachedBuffers;
+    std::vector<FrameGraphCachedRenderTarget>   cachedRenderTargets;
+    std::vector<FrameGraphAliasingGroup>        aliasingGroups;
+
+    FrameGraphStatistics                        stats;
+};
+
+
+/*
+ * Internal functions
+ */
+
+static bool IsAttachmentTextureDesc(const TextureDescriptor& desc)
+{
+    return ((desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0);
+}
+
+// Returns true if the specified texture descriptor can be aliased with other transient textures via MiscFlags::Transient.
+static bool IsAliasableTextureDesc(const TextureDescriptor& desc)
+{
+    return (IsAttachmentTextureDesc(desc) && (desc.miscFlags & MiscFlags::Memoryless) == 0);
+}
+
+// Compares the two texture descriptors, ignoring all attributes the frame graph modifies or that don't affect the hardware texture.
+static bool AreTextureDescsCompatible(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    constexpr long ignoredMiscFlags = (MiscFlags::Transient | MiscFlags::NoInitialData);
+    return
+    (
+        lhs.type                            == rhs.type                             &&
+        lhs.bindFlags                       == rhs.bindFlags                        &&
+        lhs.cpuAccessFlags                  == rhs.cpuAccessFlags                   &&
+        (lhs.miscFlags & ~ignoredMiscFlags) == (rhs.miscFlags & ~ignoredMiscFlags)  &&
+        lhs.format                          == rhs.format                           &&
+        lhs.extent.x                        == rhs.extent.x                         &&
+        lhs.extent.y                        == rhs.extent.y                         &&
+        lhs.extent.z                        == rhs.extent.z                         &&
+        lhs.arrayLayers                     == rhs.arrayLayers                      &&
+        lhs.mipLevels                       == rhs.mipLevels                        &&
+        lhs.samples                         == rhs.samples
+    );
+}
+
+static bool AreBufferDescsCompatible(const BufferDescriptor& lhs, const BufferDescriptor& rhs)
+{
+    return
+    (
+        lhs.size            == rhs.size             &&
+        lhs.stride          == rhs.stride           &&
+        lhs.format          == rhs.format           &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags
+    );
+}
+
+static bool IsCachedResourceBusy(std::uint64_t lastUsedFrame, std::uint32_t busyUntilPass, std::uint64_t currentFrame, std::uint32_t firstPass)
+{
+    return (lastUsedFrame == currentFrame && busyUntilPass >= firstPass);
+}
+
+static bool HasPassAttachments(const FrameGraphPassDescriptor& desc)
+{
+    return (desc.colorAttachments[0].IsValid() || desc.depthStencilAttachment.IsValid());
+}
+
+// Calls the specified function for each resource the specified pass uses.
+template <typename TFunc>
+static void ForEachPassResource(const FrameGraphPassDescriptor& desc, TFunc func)
+{
+    for (const FrameGraphResource& resource : desc.reads)
+        func(resource);
+    for (const FrameGraphResource& resource : desc.writes)
+        func(resource);
+    for (const FrameGraphResource& resource : desc.colorAttachments)
+    {
+        if (resource.IsValid())
+            func(resource);
+    }
+    if (desc.depthStencilAttachment.IsValid())
+        func(desc.depthStencilAttachment);
+}
+
+// Calls the specified function for each resource the specified pass writes to.
+template <typename TFunc>
+static void ForEachPassOutput(const FrameGraphPassDescriptor& desc, TFunc func)
+{
+    for (const FrameGraphResource& resource : desc.writes)
+        func(resource);
+    for (const FrameGraphResource& resource : desc.colorAttachments)
+    {
+        if (resource.IsValid())
+            func(resource);
+    }
+    if (desc.depthStencilAttachment.IsValid())
+        func(desc.depthStencilAttachment);
+}
+
+// Culls all passes whose outputs are never used, beginning with the resources that are never read.
+static bool IsPassCullable(const FrameGraphPassEntry& pass)
+{
+    return (!pass.culled && !pass.desc.sideEffects && pass.desc.renderTarget == nullptr);
+}
+
+// Culls the specified pass and appends all resources it reads to the list of unreferenced resources once they are no longer read by any other pass.
+static void CullPass(FrameGraph::Pimpl& impl, FrameGraphPassEntry& pass, std::vector<std::uint32_t>& unreferencedResources)
+{
+    pass.culled = true;
+    for (const FrameGraphResource& input : pass.desc.reads)
+    {
+        FrameGraphResourceEntry& inputResource = impl.resources[input.id];
+        if (inputResource.refCount > 0 && --inputResource.refCount == 0)
+            unreferencedResources.push_back(input.id);
+    }
+}
+
+// Culls all passes whose outputs are never used, beginning with the resources that are never read.
+static void CullUnusedPasses(FrameGraph::Pimpl& impl)
+{
+    std::vector<std::uint32_t> unreferencedResources;
+
+    for_range(i, impl.resources.size())
+    {
+        FrameGraphResourceEntry& resource = impl.resources[i];
+        if (resource.isImported)
+        {
+            /* Imported resources are always used outside of the frame graph */
+            ++resource.refCount;
+        }
+        else if (resource.refCount == 0)
+            unreferencedResources.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    /* Cull passes without any outputs */
+    for (FrameGraphPassEntry& pass : impl.passes)
+    {
+        if (pass.refCount == 0 && IsPassCullable(pass))
+            CullPass(impl, pass, unreferencedResources);
+    }
+
+    /* Cull passes whose outputs are no longer read */
+    while (!unreferencedResources.empty())
+    {
+        const std::uint32_t resourceIndex = unreferencedResources.back();
+        unreferencedResources.pop_back();
+
+        for (std::uint32_t passIndex : impl.resources[resourceIndex].producers)
+        {
+            FrameGraphPassEntry& pass = impl.passes[passIndex];
+            if (IsPassCullable(pass) && --pass.refCount == 0)
+                CullPass(impl, pass, unreferencedResources);
+        }
+    }
+}
+
+static void ComputeResourceLifetimes(FrameGraph::Pimpl& impl)
+{
+    for_range(i, impl.passes.size())
+    {
+        const FrameGraphPassEntry& pass = impl.passes[i];
+        if (pass.culled)
+            continue;
+
+        const std::uint32_t passIndex = static_cast<std::uint32_t>(i);
+        ForEachPassResource(
+            pass.desc,
+            [&impl, passIndex](const FrameGraphResource& resource)
+            {
+                FrameGraphResourceEntry& entry = impl.resources[resource.id];
+                entry.firstPass = std::min(entry.firstPass, passIndex);
+                entry.lastPass  = std::max(entry.lastPass, passIndex);
+            }
+        );
+    }
+}
+
+// Returns the first aliasing group that is not used by any other transient texture within the specified lifetime.
+static std::uint32_t AllocAliasingGroup(FrameGraph::Pimpl& impl, std::uint32_t firstPass, std::uint32_t lastPass)
+{
+    std::uint32_t groupIndex = 0;
+    for (; groupIndex < impl.aliasingGroups.size(); ++groupIndex)
+    {
+        const FrameGraphAliasingGroup& group = impl.aliasingGroups[groupIndex];
+        if (!IsCachedResourceBusy(group.lastUsedFrame, group.busyUntilPass, impl.currentFrame, firstPass))
+            break;
+    }
+
+    if (groupIndex == impl.aliasingGroups.size())
+        impl.aliasingGroups.push_back(FrameGraphAliasingGroup{});
+
+    FrameGraphAliasingGroup& group = impl.aliasingGroups[groupIndex];
+    group.lastUsedFrame = impl.currentFrame;
+    group.busyUntilPass = lastPass;
+
+    return groupIndex;
+}
+
+static bool IsAliasingGroupAvailable(FrameGraph::Pimpl& impl, std::uint32_t aliasingGroup, std::uint32_t firstPass)
+{
+    const std::uint32_t groupIndex = aliasingGroup - impl.firstAliasingGroup;
+    if (groupIndex >= impl.aliasingGroups.size())
+        return true;
+    const FrameGraphAliasingGroup& group = impl.aliasingGroups[groupIndex];
+    return !IsCachedResourceBusy(group.lastUsedFrame, group.busyUntilPass, impl.currentFrame, firstPass);
+}
+
+static void AcquireTransientTexture(FrameGraph::Pimpl& impl, FrameGraphResourceEntry& resource)
+{
+    const bool isAliasable = IsAliasableTextureDesc(resource.textureDesc);
+
+    /* Try to reuse a cached texture whose lifetime and aliasing group do not overlap with this resource */
+    for (FrameGraphCachedTexture& cached : impl.cachedTextures)
+    {
+        if (IsCachedResourceBusy(cached.lastUsedFrame, cached.busyUntilPass, impl.currentFrame, resource.firstPass))
+            continue;
+        if (!AreTextureDescsCompatible(cached.desc, resource.textureDesc))
+            continue;
+
+        if ((cached.desc.miscFlags & MiscFlags::Transient) != 0)
+        {
+            if (!IsAliasingGroupAvailable(impl, cached.desc.aliasingGroup, resource.firstPass))
+                continue;
+            FrameGraphAliasingGroup& group = impl.aliasingGroups[cached.desc.aliasingGroup - impl.firstAliasingGroup];
+            group.lastUsedFrame = impl.currentFrame;
+            group.busyUntilPass = resource.lastPass;
+        }
+
+        cached.lastUsedFrame    = impl.currentFrame;
+        cached.busyUntilPass    = resource.lastPass;
+        resource.texture        = cached.texture;
+        return;
+    }
+
+    /* Create new texture; attachments share the memory of their aliasing group with all other attachments of disjoint lifetimes */
+    TextureDescriptor textureDesc = resource.textureDesc;
+    {
+        textureDesc.debugName   = (resource.debugName.empty() ? nullptr : resource.debugName.c_str());
+        textureDesc.miscFlags   |= MiscFlags::NoInitialData;
+        if (isAliasable)
+        {
+            textureDesc.miscFlags       |= MiscFlags::Transient;
+            textureDesc.aliasingGroup   = impl.firstAliasingGroup + AllocAliasingGroup(impl, resource.firstPass, resource.lastPass);
+        }
+    }
+    resource.texture = impl.renderSystem.CreateTexture(textureDesc);
+
+    FrameGraphCachedTexture cached;
+    {
+        cached.desc             = textureDesc;
+        cached.desc.debugName   = nullptr;
+        cached.texture          = resource.texture;
+        cached.lastUsedFrame    = impl.currentFrame;
+        cached.busyUntilPass    = resource.lastPass;
+    }
+    impl.cachedTextures.push_back(cached);
+}
+
+static void AcquireTransientBuffer(FrameGraph::Pimpl& impl, FrameGraphResourceEntry& resource)
+{
+    /* Try to reuse a cached buffer whose lifetime does not overlap with this resource */
+    for (FrameGraphCachedBuffer& cached : impl.cachedBuffers)
+    {
+        if (!IsCachedResourceBusy(cached.lastUsedFrame, cached.busyUntilPass, impl.currentFrame, resource.firstPass) &&
+            AreBufferDescsCompatible(cached.desc, resource.bufferDesc))
+        {
+            cached.lastUsedFrame    = impl.currentFrame;
+            cached.busyUntilPass    = resource.lastPass;
+            resource.buffer         = cached.buffer;
+            return;
+        }
+    }
+
+    /* Create new buffer */
+    BufferDescriptor bufferDesc = resource.bufferDesc;
+    bufferDesc.debugName = (resource.debugName.empty() ? nullptr : resource.debugName.c_str());
+    resource.buffer = impl.renderSystem.CreateBuffer(bufferDesc);
+
+    FrameGraphCachedBuffer cached;
+    {
+        cached.desc             = resource.bufferDesc;
+        cached.desc.debugName   = nullptr;
+        cached.buffer           = resource.buffer;
+        cached.lastUsedFrame    = impl.currentFrame;
+        cached.busyUntilPass    = resource.lastPass;
+    }
+    impl.cachedBuffers.push_back(cached);
+}
+
+// Assigns hardware resources to all transient resources in the order of their first use, so resources with disjoint lifetimes can share hardware resources.
+static void AssignTransientResources(FrameGraph::Pimpl& impl)
+{
+    std::vector<std::uint32_t> transientResources;
+    transientResources.reserve(impl.resources.size());
+
+    for_range(i, impl.resources.size())
+    {
+        const FrameGraphResourceEntry& resource = impl.resources[i];
+        if (!resource.isImported && resource.firstPass != g_invalidPassIndex)
+            transientResources.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    std::stable_sort(
+        transientResources.begin(),
+        transientResources.end(),
+        [&impl](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (impl.resources[lhs].firstPass < impl.resources[rhs].firstPass);
+        }
+    );
+
+    for (std::uint32_t resourceIndex : transientResources)
+    {
+        FrameGraphResourceEntry& resource = impl.resources[resourceIndex];
+        if (resource.isTexture)
+            AcquireTransientTexture(impl, resource);
+        else
+            AcquireTransientBuffer(impl, resource);
+    }
+}
+
+static RenderTarget* GetOrCreateRenderTarget(FrameGraph::Pimpl& impl, const FrameGraphPassEntry& pass)
+{
+    /* Gather attachment textures */
+    Texture* colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS] = {};
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        if (!pass.desc.colorAttachments[i].IsValid())
+            break;
+        colorAttachments[i] = impl.resources[pass.desc.colorAttachments[i].id].texture;
+    }
+
+    Texture* depthStencilAttachment = nullptr;
+    if (pass.desc.depthStencilAttachment.IsValid())
+        depthStencilAttachment = impl.resources[pass.desc.depthStencilAttachment.id].texture;
+
+    /* Find cached render target with the same attachments */
+    for (FrameGraphCachedRenderTarget& cached : impl.cachedRenderTargets)
+    {
+        if (cached.depthStencilAttachment == depthStencilAttachment &&
+            std::equal(std::begin(colorAttachments), std::end(colorAttachments), std::begin(cached.colorAttachments)))
+        {
+            cached.lastUsedFrame = impl.currentFrame;
+            return cached.renderTarget;
+        }
+    }
+
+    /* Create new render target with the resolution of its first attachment */
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName = (pass.name.empty() ? nullptr : pass.name.c_str());
+
+        Texture* firstAttachment = (colorAttachments[0] != nullptr ? colorAttachments[0] : depthStencilAttachment);
+        LLGL_ASSERT_PTR(firstAttachment);
+        const Extent3D extent = firstAttachment->GetMipExtent(0);
+        renderTargetDesc.resolution = Extent2D{ extent.x, extent.y };
+        renderTargetDesc.samples    = firstAttachment->GetDesc().samples;
+
+        for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        {
+            if (colorAttachments[i] == nullptr)
+                break;
+            renderTargetDesc.colorAttachments[i] = colorAttachments[i];
+        }
+        if (depthStencilAttachment != nullptr)
+            renderTargetDesc.depthStencilAttachment = depthStencilAttachment;
+    }
+
+    FrameGraphCachedRenderTarget cached;
+    {
+        std::copy(std::begin(colorAttachments), std::end(colorAttachments), std::begin(cached.colorAttachments));
+        cached.depthStencilAttachment   = depthStencilAttachment;
+        cached.renderTarget             = impl.renderSystem.CreateRenderTarget(renderTargetDesc);
+        cached.lastUsedFrame            = impl.currentFrame;
+    }
+    impl.cachedRenderTargets.push_back(cached);
+
+    return cached.renderTarget;
+}
+
+static void RecordPass(FrameGraph::Pimpl& impl, const FrameGraphPassEntry& pass, CommandBuffer& cmdBuffer)
+{
+    if (!pass.name.empty())
+        cmdBuffer.PushDebugGroup(pass.name.c_str());
+
+    RenderTarget* renderTarget = pass.desc.renderTarget;
+    if (renderTarget == nullptr && HasPassAttachments(pass.desc))
+        renderTarget = GetOrCreateRenderTarget(impl, pass);
+
+    if (renderTarget != nullptr)
+    {
+        cmdBuffer.BeginRenderPass(*renderTarget);
+        {
+            if (!pass.desc.clears.empty())
+                cmdBuffer.ClearAttachments(static_cast<std::uint32_t>(pass.desc.clears.size()), pass.desc.clears.data());
+            if (pass.execute)
+                pass.execute(cmdBuffer);
+        }
+        cmdBuffer.EndRenderPass();
+    }
+    else if (pass.execute)
+        pass.execute(cmdBuffer);
+
+    if (!pass.name.empty())
+        cmdBuffer.PopDebugGroup();
+}
+
+static bool IsTextureReferencedByRenderTarget(const FrameGraphCachedRenderTarget& cached, const Texture* texture)
+{
+    return
+    (
+        cached.depthStencilAttachment == texture ||
+        std::find(std::begin(cached.colorAttachments), std::end(cached.colorAttachments), texture) != std::end(cached.colorAttachments)
+    );
+}
+
+// Releases all cached hardware resources that have not been used for more than the specified number of frames.
+static void ReleaseUnusedResources(FrameGraph::Pimpl& impl, std::uint64_t maxUnusedFrames)
+{
+    auto IsExpired = [&impl, maxUnusedFrames](std::uint64_t lastUsedFrame) -> bool
+    {
+        return (lastUsedFrame + maxUnusedFrames < impl.currentFrame);
+    };
+
+    /* Mark expired textures and all render targets that refer to them, since render targets must be released before their attachments */
+    for (FrameGraphCachedTexture& cachedTexture : impl.cachedTextures)
+    {
+        if (IsExpired(cachedTexture.lastUsedFrame))
+        {
+            for (FrameGraphCachedRenderTarget& cached : impl.cachedRenderTargets)
+            {
+                if (IsTextureReferencedByRenderTarget(cached, cachedTexture.texture))
+                    cached.lastUsedFrame = 0;
+            }
+            cachedTexture.lastUsedFrame = 0;
+        }
+    }
+
+    for (auto it = impl.cachedRenderTargets.begin(); it != impl.cachedRenderTargets.end();)
+    {
+        if (it->lastUsedFrame == 0 || IsExpired(it->lastUsedFrame))
+        {
+            impl.renderSystem.Release(*(it->renderTarget));
+            it = impl.cachedRenderTargets.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = impl.cachedTextures.begin(); it != impl.cachedTextures.end();)
+    {
+        if (it->lastUsedFrame == 0)
+        {
+            impl.renderSystem.Release(*(it->texture));
+            it = impl.cachedTextures.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = impl.cachedBuffers.begin(); it != impl.cachedBuffers.end();)
+    {
+        if (IsExpired(it->lastUsedFrame))
+        {
+            impl.renderSystem.Release(*(it->buffer));
+            it = impl.cachedBuffers.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+
+/*
+ * FrameGraph class
+ */
+
+FrameGraph::FrameGraph(RenderSystem& renderSystem, std::uint32_t maxUnusedFrames, std::uint32_t firstAliasingGroup) :
+    pimpl_ { new Pimpl{ renderSystem } }
+{
+    pimpl_->maxUnusedFrames     = maxUnusedFrames;
+    pimpl_->firstAliasingGroup  = firstAliasingGroup;
+}
+
+FrameGraph::~FrameGraph()
+{
+    ReleaseResources();
+    delete pimpl_;
+}
+
+FrameGraphResource FrameGraph::CreateTexture(const TextureDescriptor& textureDesc)
+{
+    FrameGraphResourceEntry entry;
+    {
+        entry.isTexture             = true;
+        entry.textureDesc           = textureDesc;
+        entry.textureDesc.debugName = nullptr;
+        if (textureDesc.debugName != nullptr)
+            entry.debugName = textureDesc.debugName;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    return FrameGraphResource{ static_cast<std::uint32_t>(pimpl_->resources.size() - 1) };
+}
+
+FrameGraphResource FrameGraph::CreateBuffer(const BufferDescriptor& bufferDesc)
+{
+    FrameGraphResourceEntry entry;
+    {
+        entry.isTexture             = false;
+        entry.bufferDesc            = bufferDesc;
+        entry.bufferDesc.debugName  = nullptr;
+        if (bufferDesc.debugName != nullptr)
+            entry.debugName = bufferDesc.debugName;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    return FrameGraphResource{ static_cast<std::uint32_t>(pimpl_->resources.size() - 1) };
+}
+
+FrameGraphResource FrameGraph::ImportTexture(Texture& texture)
+{
+    FrameGraphResourceEntry entry;
+    {
+        entry.isTexture     = true;
+        entry.isImported    = true;
+        entry.texture       = &texture;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    return FrameGraphResource{ static_cast<std::uint32_t>(pimpl_->resources.size() - 1) };
+}
+
+FrameGraphResource FrameGraph::ImportBuffer(Buffer& buffer)
+{
+    FrameGraphResourceEntry entry;
+    {
+        entry.isTexture     = false;
+        entry.isImported    = true;
+        entry.buffer        = &buffer;
+    }
+    pimpl_->resources.push_back(std::move(entry));
+    return FrameGraphResource{ static_cast<std::uint32_t>(pimpl_->resources.size() - 1) };
+}
+
+void FrameGraph::AddPass(const FrameGraphPassDescriptor& passDesc, const FrameGraphExecuteFunction& execute)
+{
+    LLGL_ASSERT(passDesc.renderTarget == nullptr || !HasPassAttachments(passDesc), "frame graph pass must not specify both a render target and attachments");
+
+    const std::uint32_t passIndex = static_cast<std::uint32_t>(pimpl_->passes.size());
+
+    FrameGraphPassEntry entry;
+    {
+        if (passDesc.name != nullptr)
+            entry.name = passDesc.name;
+        entry.desc          = passDesc;
+        entry.desc.name     = nullptr;
+        entry.execute       = execute;
+    }
+
+    /* Register this pass as consumer and producer of its resources */
+    for (const FrameGraphResource& resource : passDesc.reads)
+    {
+        LLGL_ASSERT(resource.id < pimpl_->resources.size(), "invalid frame graph resource read by pass");
+        ++(pimpl_->resources[resource.id].refCount);
+    }
+
+    ForEachPassOutput(
+        passDesc,
+        [this, passIndex, &entry](const FrameGraphResource& resource)
+        {
+            LLGL_ASSERT(resource.id < pimpl_->resources.size(), "invalid frame graph resource written by pass");
+            pimpl_->resources[resource.id].producers.push_back(passIndex);
+            ++entry.refCount;
+        }
+    );
+
+    pimpl_->passes.push_back(std::move(entry));
+}
+
+void FrameGraph::Execute(CommandBuffer& cmdBuffer)
+{
+    /* Compile frame graph */
+    CullUnusedPasses(*pimpl_);
+    ComputeResourceLifetimes(*pimpl_);
+    AssignTransientResources(*pimpl_);
+
+    /* Record all remaining passes in declaration order */
+    FrameGraphStatistics& stats = pimpl_->stats;
+    stats = FrameGraphStatistics{};
+
+    for (const FrameGraphPassEntry& pass : pimpl_->passes)
+    {
+        if (pass.culled)
+            ++stats.numCulledPasses;
+        else
+            RecordPass(*pimpl_, pass, cmdBuffer);
+    }
+
+    stats.numPasses = static_cast<std::uint32_t>(pimpl_->passes.size());
+    for (const FrameGraphResourceEntry& resource : pimpl_->resources)
+    {
+        if (!resource.isImported)
+            ++stats.numTransientResources;
+    }
+    for (const FrameGraphAliasingGroup& group : pimpl_->aliasingGroups)
+    {
+        if (group.lastUsedFrame == pimpl_->currentFrame)
+            ++stats.numAliasingGroups;
+    }
+
+    /* Release hardware resources that are no longer used and begin next frame */
+    ReleaseUnusedResources(*pimpl_, pimpl_->maxUnusedFrames);
+    stats.numTextures   = static_cast<std::uint32_t>(pimpl_->cachedTextures.size());
+    stats.numBuffers    = static_cast<std::uint32_t>(pimpl_->cachedBuffers.size());
+
+    Reset();
+    ++(pimpl_->currentFrame);
+}
+
+void FrameGraph::Reset()
+{
+    pimpl_->resources.clear();
+    pimpl_->passes.clear();
+}
+
+void FrameGraph::ReleaseResources()
+{
+    for (const FrameGraphCachedRenderTarget& cached : pimpl_->cachedRenderTargets)
+        pimpl_->renderSystem.Release(*cached.renderTarget);
+    for (const FrameGraphCachedTexture& cached : pimpl_->cachedTextures)
+        pimpl_->renderSystem.Release(*cached.texture);
+    for (const FrameGraphCachedBuffer& cached : pimpl_->cachedBuffers)
+        pimpl_->renderSystem.Release(*cached.buffer);
+
+    pimpl_->cachedRenderTargets.clear();
+    pimpl_->cachedTextures.clear();
+    pimpl_->cachedBuffers.clear();
+    pimpl_->aliasingGroups.clear();
+}
+
+Texture* FrameGraph::GetTexture(const FrameGraphResource& resource) const
+{
+    if (resource.id < pimpl_->resources.size())
+        return pimpl_->resources[resource.id].texture;
+    return nullptr;
+}
+
+Buffer* FrameGraph::GetBuffer(const FrameGraphResource& resource) const
+{
+    if (resource.id < pimpl_->resources.size())
+        return pimpl_->resources[resource.id].buffer;
+    return nullptr;
+}
+
+const FrameGraphStatistics& FrameGraph::GetStatistics() const
+{
+    return pimpl_->stats;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
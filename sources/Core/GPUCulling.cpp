@@ -0,0 +1,591 @@
+/*
+ * GPUCulling.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/GPUCulling.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineState.h>
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/Shader.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/Report.h>
+#include "Builtin/GPUCulling.hlsl.inl"
+#include "Builtin/GPUCulling.glsl.inl"
+#include "Builtin/GPUCulling.metal.inl"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Work group sizes must match the built-in shaders
+static constexpr std::uint32_t g_hiZWorkGroupSize   = 8;
+static constexpr std::uint32_t g_cullWorkGroupSize  = 64;
+
+// Constant buffer layout of the culling pass; see GPUCullingConstants in the built-in shaders
+struct GPUCullingConstants
+{
+    float           viewProj[16];
+    float           frustumPlanes[6][4];
+    std::uint32_t   hiZExtent[2];
+    std::uint32_t   numHiZMips;
+    std::uint32_t   numInstances;
+    std::uint32_t   enableOcclusion;
+    std::uint32_t   pad0[3];
+};
+
+static_assert(sizeof(GPUCullingConstants) == 192, "GPUCullingConstants must be 192 bytes");
+static_assert(sizeof(GPUCullingInstance) == 32, "GPUCullingInstance must be 32 bytes");
+
+struct GPUCulling::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem) :
+        renderSystem { renderSystem }
+    {
+    }
+
+    RenderSystem&           renderSystem;
+    std::uint32_t           maxInstances            = 0;
+    bool                    hasIndirectDrawingCount = false;
+
+    Texture*                depthTexture            = nullptr;
+    Texture*                hiZTexture              = nullptr;
+    Extent2D                hiZExtent;
+    std::uint32_t           numHiZMips              = 0;
+    ResourceHeap*           hiZResourceHeap         = nullptr;
+
+    Buffer*                 constantBuffer          = nullptr;
+    Buffer*                 drawArgsBuffer          = nullptr;
+    Buffer*                 drawCountBuffer         = nullptr;
+
+    std::vector<Shader*>    builtinShaders;
+    PipelineLayout*         hiZLayout               = nullptr;
+    PipelineLayout*         cullLayout              = nullptr;
+    PipelineState*          hiZPipelines[2]         = {};       // [0] for the first MIP-map from the depth texture, [1] for all other MIP-maps
+    PipelineState*          cullPipeline            = nullptr;
+};
+
+
+/*
+ * Internal functions
+ */
+
+static bool IsShadingLanguageSupported(const RenderingCapabilities& caps, const ShadingLanguage language)
+{
+    return (std::find(caps.shadingLanguages.begin(), caps.shadingLanguages.end(), language) != caps.shadingLanguages.end());
+}
+
+// Returns the language of the built-in shaders that is supported by the render system or ShadingLanguage::VersionBitmask if there is none.
+static ShadingLanguage SelectBuiltinShadingLanguage(const RenderingCapabilities& caps)
+{
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::HLSL))
+        return ShadingLanguage::HLSL;
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::Metal))
+        return ShadingLanguage::Metal;
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::GLSL_430) && !IsShadingLanguageSupported(caps, ShadingLanguage::SPIRV))
+        return ShadingLanguage::GLSL;
+    return ShadingLanguage::VersionBitmask;
+}
+
+static void AppendShaderReport(Report* report, const char* name, const Report* shaderReport)
+{
+    if (report != nullptr && shaderReport != nullptr && shaderReport->HasErrors())
+        report->Errorf("failed to compile GPU culling shader '%s':\n%s", name, shaderReport->GetText());
+}
+
+static Shader* CreateBuiltinShader(
+    GPUCulling::Pimpl&  pimpl,
+    ShadingLanguage     language,
+    const char*         entryPoint,
+    std::uint32_t       workGroupSizeX,
+    std::uint32_t       workGroupSizeY,
+    const ShaderMacro*  defines,
+    Report*             report)
+{
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = entryPoint;
+        shaderDesc.type         = ShaderType::Compute;
+        shaderDesc.source       = GPUCulling::GetShaderSource(language);
+        shaderDesc.sourceType   = ShaderSourceType::CodeString;
+        shaderDesc.defines      = defines;
+        shaderDesc.compute.workGroupSize = Extent3D{ workGroupSizeX, workGroupSizeY, 1 };
+
+        if (language == ShadingLanguage::HLSL)
+        {
+            shaderDesc.entryPoint   = entryPoint;
+            shaderDesc.profile      = "cs_5_0";
+        }
+        else if (language == ShadingLanguage::Metal)
+        {
+            shaderDesc.entryPoint   = entryPoint;
+            shaderDesc.profile      = "2.0";
+        }
+    }
+    Shader* shader = pimpl.renderSystem.CreateShader(shaderDesc);
+    if (shader == nullptr)
+        return nullptr;
+
+    pimpl.builtinShaders.push_back(shader);
+
+    const Report* shaderReport = shader->GetReport();
+    if (shaderReport != nullptr && shaderReport->HasErrors())
+    {
+        AppendShaderReport(report, entryPoint, shaderReport);
+        return nullptr;
+    }
+
+    return shader;
+}
+
+static PipelineState* CreateComputePipeline(RenderSystem& renderSystem, const char* debugName, PipelineLayout* layout, Shader* shader, Report* report)
+{
+    if (shader == nullptr)
+        return nullptr;
+
+    ComputePipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.debugName      = debugName;
+        pipelineDesc.pipelineLayout = layout;
+        pipelineDesc.computeShader  = shader;
+    }
+    PipelineState* pipeline = renderSystem.CreatePipelineState(pipelineDesc);
+
+    if (pipeline != nullptr && report != nullptr)
+    {
+        const Report* pipelineReport = pipeline->GetReport();
+        if (pipelineReport != nullptr && pipelineReport->HasErrors())
+            report->Errorf("failed to create GPU culling pipeline '%s':\n%s", debugName, pipelineReport->GetText());
+    }
+
+    return pipeline;
+}
+
+static void CreateComputePipelines(GPUCulling::Pimpl& pimpl, const GPUCullingDescriptor& desc, Report* report)
+{
+    RenderSystem& renderSystem = pimpl.renderSystem;
+
+    pimpl.hiZLayout = renderSystem.CreatePipelineLayout(
+        Parse("heap{texture(hiZSrc@0):comp, rwtexture(hiZDst@1):comp}, barriers{rwtexture}")
+    );
+    pimpl.cullLayout = renderSystem.CreatePipelineLayout(
+        Parse(
+            "texture(hiZ@0):comp,"
+            "cbuffer(GPUCullingConstants@2):comp,"
+            "buffer(GPUCullingInstances@3):comp,"
+            "rwbuffer(GPUCullingDrawArgs@4, GPUCullingDrawCount@5):comp,"
+            "barriers{rwbuffer}"
+        )
+    );
+
+    Shader* hiZDepthShader  = desc.buildHiZShader;
+    Shader* hiZShader       = desc.buildHiZShader;
+    Shader* cullShader      = desc.cullShader;
+
+    if (hiZShader == nullptr || cullShader == nullptr)
+    {
+        const RenderingCapabilities& caps = renderSystem.GetRenderingCaps();
+        const ShadingLanguage language = SelectBuiltinShadingLanguage(caps);
+
+        if (language == ShadingLanguage::VersionBitmask)
+        {
+            if (report != nullptr)
+                report->Errorf("GPU culling requires HLSL, GLSL 430, or Metal for built-in shaders; use GPUCullingDescriptor::buildHiZShader and cullShader otherwise\n");
+            return;
+        }
+
+        /* Configure built-in shaders for the depth conventions of the render system */
+        std::vector<ShaderMacro> defines;
+        if (desc.reverseDepth)
+            defines.push_back(ShaderMacro{ "GPU_CULLING_REVERSE_DEPTH" });
+        if (caps.clippingRange == ClippingRange::MinusOneToOne)
+            defines.push_back(ShaderMacro{ "GPU_CULLING_DEPTH_MINUS_ONE_TO_ONE" });
+        if (caps.screenOrigin == ScreenOrigin::LowerLeft)
+            defines.push_back(ShaderMacro{ "GPU_CULLING_LOWER_LEFT_ORIGIN" });
+        defines.push_back(ShaderMacro{ nullptr });
+
+        if (cullShader == nullptr)
+            cullShader = CreateBuiltinShader(pimpl, language, "Cull", g_cullWorkGroupSize, 1, defines.data(), report);
+
+        if (hiZShader == nullptr)
+        {
+            if (language == ShadingLanguage::GLSL)
+                defines.insert(defines.end() - 1, ShaderMacro{ "GPU_CULLING_BUILD_HIZ" });
+
+            hiZShader = CreateBuiltinShader(pimpl, language, "BuildHiZ", g_hiZWorkGroupSize, g_hiZWorkGroupSize, defines.data(), report);
+
+            /* Metal can only read depth textures through depth2d, so the first MIP-map needs its own kernel */
+            if (language == ShadingLanguage::Metal)
+                hiZDepthShader = CreateBuiltinShader(pimpl, language, "BuildHiZFromDepth", g_hiZWorkGroupSize, g_hiZWorkGroupSize, defines.data(), report);
+            else
+                hiZDepthShader = hiZShader;
+        }
+    }
+
+    pimpl.hiZPipelines[1]   = CreateComputePipeline(renderSystem, "LLGL::GPUCulling.BuildHiZ", pimpl.hiZLayout, hiZShader, report);
+    pimpl.hiZPipelines[0]   = (hiZDepthShader != hiZShader
+        ? CreateComputePipeline(renderSystem, "LLGL::GPUCulling.BuildHiZFromDepth", pimpl.hiZLayout, hiZDepthShader, report)
+        : pimpl.hiZPipelines[1]);
+    pimpl.cullPipeline      = CreateComputePipeline(renderSystem, "LLGL::GPUCulling.Cull", pimpl.cullLayout, cullShader, report);
+}
+
+static void ReleaseHiZResources(GPUCulling::Pimpl& pimpl)
+{
+    if (pimpl.hiZResourceHeap != nullptr)
+    {
+        pimpl.renderSystem.Release(*pimpl.hiZResourceHeap);
+        pimpl.hiZResourceHeap = nullptr;
+    }
+    if (pimpl.hiZTexture != nullptr)
+    {
+        pimpl.renderSystem.Release(*pimpl.hiZTexture);
+        pimpl.hiZTexture = nullptr;
+    }
+}
+
+// Returns the resource view of the Hi-Z source for the specified MIP-map, i.e. the depth texture for the first MIP-map and the previous Hi-Z MIP-map otherwise.
+static ResourceViewDescriptor GetHiZSourceView(GPUCulling::Pimpl& pimpl, std::uint32_t mipLevel)
+{
+    if (mipLevel == 0)
+        return ResourceViewDescriptor{ pimpl.depthTexture };
+
+    TextureViewDescriptor textureViewDesc;
+    {
+        textureViewDesc.type        = TextureType::Texture2D;
+        textureViewDesc.format      = Format::R32Float;
+        textureViewDesc.subresource = TextureSubresource{ 0, 1, mipLevel - 1, 1 };
+    }
+    return ResourceViewDescriptor{ pimpl.hiZTexture, textureViewDesc };
+}
+
+static ResourceViewDescriptor GetHiZDestinationView(GPUCulling::Pimpl& pimpl, std::uint32_t mipLevel)
+{
+    TextureViewDescriptor textureViewDesc;
+    {
+        textureViewDesc.type        = TextureType::Texture2D;
+        textureViewDesc.format      = Format::R32Float;
+        textureViewDesc.subresource = TextureSubresource{ 0, 1, mipLevel, 1 };
+    }
+    return ResourceViewDescriptor{ pimpl.hiZTexture, textureViewDesc };
+}
+
+// Creates the Hi-Z pyramid with half the extent of the depth texture and one descriptor set per MIP-map.
+static bool CreateHiZResources(GPUCulling::Pimpl& pimpl)
+{
+    const Extent3D depthExtent = pimpl.depthTexture->GetMipExtent(0);
+
+    pimpl.hiZExtent.x   = std::max(1u, depthExtent.x / 2);
+    pimpl.hiZExtent.y   = std::max(1u, depthExtent.y / 2);
+    pimpl.numHiZMips    = NumMipLevels(pimpl.hiZExtent.x, pimpl.hiZExtent.y);
+
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.debugName   = "LLGL::GPUCulling.HiZ";
+        textureDesc.type        = TextureType::Texture2D;
+        textureDesc.bindFlags   = (BindFlags::Sampled | BindFlags::Storage);
+        textureDesc.miscFlags   = 0;
+        textureDesc.format      = Format::R32Float;
+        textureDesc.extent      = Extent3D{ pimpl.hiZExtent.x, pimpl.hiZExtent.y, 1 };
+        textureDesc.mipLevels   = pimpl.numHiZMips;
+    }
+    pimpl.hiZTexture = pimpl.renderSystem.CreateTexture(textureDesc);
+    if (pimpl.hiZTexture == nullptr)
+        return false;
+
+    std::vector<ResourceViewDescriptor> resourceViews;
+    resourceViews.reserve(pimpl.numHiZMips * 2);
+
+    for (std::uint32_t mipLevel = 0; mipLevel < pimpl.numHiZMips; ++mipLevel)
+    {
+        resourceViews.push_back(GetHiZSourceView(pimpl, mipLevel));
+        resourceViews.push_back(GetHiZDestinationView(pimpl, mipLevel));
+    }
+
+    ResourceHeapDescriptor resourceHeapDesc;
+    {
+        resourceHeapDesc.debugName          = "LLGL::GPUCulling.HiZ";
+        resourceHeapDesc.pipelineLayout     = pimpl.hiZLayout;
+        resourceHeapDesc.numResourceViews   = static_cast<std::uint32_t>(resourceViews.size());
+    }
+    pimpl.hiZResourceHeap = pimpl.renderSystem.CreateResourceHeap(resourceHeapDesc, resourceViews);
+
+    return (pimpl.hiZResourceHeap != nullptr);
+}
+
+static Buffer* CreateStorageBuffer(RenderSystem& renderSystem, const char* debugName, std::uint64_t size)
+{
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName    = debugName;
+        bufferDesc.size         = size;
+        bufferDesc.bindFlags    = (BindFlags::Storage | BindFlags::IndirectBuffer | BindFlags::CopyDst);
+    }
+    return renderSystem.CreateBuffer(bufferDesc);
+}
+
+static void NormalizePlane(float (&plane)[4])
+{
+    const float length = std::sqrt(plane[0]*plane[0] + plane[1]*plane[1] + plane[2]*plane[2]);
+    if (length > 0.0f)
+    {
+        for (float& component : plane)
+            component /= length;
+    }
+    else
+    {
+        /* Degenerate plane (e.g. infinite far plane) never culls anything */
+        plane[0] = 0.0f;
+        plane[1] = 0.0f;
+        plane[2] = 0.0f;
+        plane[3] = 1.0f;
+    }
+}
+
+// Extracts the frustum planes from the column-major view-projection matrix (Gribb-Hartmann method). All planes point inwards.
+static void ExtractFrustumPlanes(float (&outPlanes)[6][4], const float (&m)[16], const ClippingRange clippingRange)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        const float r0 = m[i*4 + 0];
+        const float r1 = m[i*4 + 1];
+        const float r2 = m[i*4 + 2];
+        const float r3 = m[i*4 + 3];
+
+        outPlanes[0][i] = r3 + r0; // Left
+        outPlanes[1][i] = r3 - r0; // Right
+        outPlanes[2][i] = r3 + r1; // Bottom
+        outPlanes[3][i] = r3 - r1; // Top
+        outPlanes[4][i] = (clippingRange == ClippingRange::MinusOneToOne ? r3 + r2 : r2); // Near
+        outPlanes[5][i] = r3 - r2; // Far
+    }
+
+    for (float (&plane)[4] : outPlanes)
+        NormalizePlane(plane);
+}
+
+
+/*
+ * GPUCulling class
+ */
+
+GPUCulling::GPUCulling(RenderSystem& renderSystem, const GPUCullingDescriptor& desc, Report* report) :
+    pimpl_ { new Pimpl{ renderSystem } }
+{
+    pimpl_->maxInstances            = std::max(1u, desc.maxInstances);
+    pimpl_->hasIndirectDrawingCount = renderSystem.GetRenderingCaps().features.hasIndirectDrawingCount;
+    pimpl_->depthTexture            = desc.depthTexture;
+
+    /* Create buffers for constants, draw arguments, and draw count */
+    BufferDescriptor constantBufferDesc;
+    {
+        constantBufferDesc.debugName    = "LLGL::GPUCulling.Constants";
+        constantBufferDesc.size         = sizeof(GPUCullingConstants);
+        constantBufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+    }
+    pimpl_->constantBuffer  = renderSystem.CreateBuffer(constantBufferDesc);
+    pimpl_->drawArgsBuffer  = CreateStorageBuffer(renderSystem, "LLGL::GPUCulling.DrawArgs", static_cast<std::uint64_t>(pimpl_->maxInstances) * drawArgsStride);
+    pimpl_->drawCountBuffer = CreateStorageBuffer(renderSystem, "LLGL::GPUCulling.DrawCount", sizeof(std::uint32_t));
+
+    /* Create compute pipelines and Hi-Z pyramid */
+    CreateComputePipelines(*pimpl_, desc, report);
+
+    if (pimpl_->depthTexture != nullptr)
+        CreateHiZResources(*pimpl_);
+    else if (report != nullptr)
+        report->Errorf("GPU culling requires a depth texture\n");
+}
+
+GPUCulling::~GPUCulling()
+{
+    RenderSystem& renderSystem = pimpl_->renderSystem;
+
+    ReleaseHiZResources(*pimpl_);
+
+    if (pimpl_->cullPipeline != nullptr)
+        renderSystem.Release(*pimpl_->cullPipeline);
+    if (pimpl_->hiZPipelines[0] != nullptr && pimpl_->hiZPipelines[0] != pimpl_->hiZPipelines[1])
+        renderSystem.Release(*pimpl_->hiZPipelines[0]);
+    if (pimpl_->hiZPipelines[1] != nullptr)
+        renderSystem.Release(*pimpl_->hiZPipelines[1]);
+
+    for (Shader* shader : pimpl_->builtinShaders)
+        renderSystem.Release(*shader);
+
+    if (pimpl_->cullLayout != nullptr)
+        renderSystem.Release(*pimpl_->cullLayout);
+    if (pimpl_->hiZLayout != nullptr)
+        renderSystem.Release(*pimpl_->hiZLayout);
+
+    if (pimpl_->drawCountBuffer != nullptr)
+        renderSystem.Release(*pimpl_->drawCountBuffer);
+    if (pimpl_->drawArgsBuffer != nullptr)
+        renderSystem.Release(*pimpl_->drawArgsBuffer);
+    if (pimpl_->constantBuffer != nullptr)
+        renderSystem.Release(*pimpl_->constantBuffer);
+
+    delete pimpl_;
+}
+
+const char* GPUCulling::GetShaderSource(const ShadingLanguage language)
+{
+    switch (language)
+    {
+        case ShadingLanguage::HLSL:     return g_GPUCulling_HLSL;
+        case ShadingLanguage::GLSL:     return g_GPUCulling_GLSL;
+        case ShadingLanguage::Metal:    return g_GPUCulling_Metal;
+        default:                        return nullptr;
+    }
+}
+
+bool GPUCulling::IsValid() const
+{
+    return
+    (
+        pimpl_->hiZResourceHeap != nullptr  &&
+        pimpl_->constantBuffer  != nullptr  &&
+        pimpl_->drawArgsBuffer  != nullptr  &&
+        pimpl_->drawCountBuffer != nullptr  &&
+        pimpl_->hiZPipelines[0] != nullptr  &&
+        pimpl_->hiZPipelines[1] != nullptr  &&
+        pimpl_->cullPipeline    != nullptr
+    );
+}
+
+void GPUCulling::SetDepthTexture(Texture& depthTexture)
+{
+    pimpl_->depthTexture = &depthTexture;
+
+    const Extent3D depthExtent = depthTexture.GetMipExtent(0);
+    const bool isSameExtent =
+    (
+        pimpl_->hiZTexture != nullptr &&
+        pimpl_->hiZExtent.x == std::max(1u, depthExtent.x / 2) &&
+        pimpl_->hiZExtent.y == std::max(1u, depthExtent.y / 2)
+    );
+
+    if (isSameExtent)
+    {
+        /* Only replace the source of the first MIP-map */
+        pimpl_->renderSystem.WriteResourceHeap(*pimpl_->hiZResourceHeap, 0, { GetHiZSourceView(*pimpl_, 0) });
+    }
+    else
+    {
+        ReleaseHiZResources(*pimpl_);
+        CreateHiZResources(*pimpl_);
+    }
+}
+
+static std::uint32_t DivideRoundUp(std::uint32_t x, std::uint32_t y)
+{
+    return (x + y - 1) / y;
+}
+
+void GPUCulling::BuildHiZ(CommandBuffer& cmdBuffer)
+{
+    if (!IsValid())
+        return;
+
+    for (std::uint32_t mipLevel = 0; mipLevel < pimpl_->numHiZMips; ++mipLevel)
+    {
+        const std::uint32_t mipWidth    = std::max(1u, pimpl_->hiZExtent.x >> mipLevel);
+        const std::uint32_t mipHeight   = std::max(1u, pimpl_->hiZExtent.y >> mipLevel);
+
+        /* Switch pipeline after the first MIP-map, which is reduced from the depth texture */
+        if (mipLevel <= 1)
+            cmdBuffer.SetPipelineState(*pimpl_->hiZPipelines[mipLevel]);
+
+        cmdBuffer.SetResourceHeap(*pimpl_->hiZResourceHeap, mipLevel);
+        cmdBuffer.Dispatch(DivideRoundUp(mipWidth, g_hiZWorkGroupSize), DivideRoundUp(mipHeight, g_hiZWorkGroupSize), 1);
+    }
+}
+
+void GPUCulling::Cull(
+    CommandBuffer&  cmdBuffer,
+    Buffer&         instanceBuffer,
+    std::uint32_t   numInstances,
+    const float     viewProjection[16],
+    bool            enableOcclusion)
+{
+    if (!IsValid())
+        return;
+
+    numInstances = std::min(numInstances, pimpl_->maxInstances);
+
+    /* Update constants for this culling pass */
+    GPUCullingConstants constants;
+    {
+        std::copy(viewProjection, viewProjection + 16, constants.viewProj);
+        ExtractFrustumPlanes(constants.frustumPlanes, constants.viewProj, pimpl_->renderSystem.GetRenderingCaps().clippingRange);
+        constants.hiZExtent[0]      = pimpl_->hiZExtent.x;
+        constants.hiZExtent[1]      = pimpl_->hiZExtent.y;
+        constants.numHiZMips        = pimpl_->numHiZMips;
+        constants.numInstances      = numInstances;
+        constants.enableOcclusion   = (enableOcclusion ? 1u : 0u);
+        constants.pad0[0]           = 0;
+        constants.pad0[1]           = 0;
+        constants.pad0[2]           = 0;
+    }
+    cmdBuffer.UpdateBuffer(*pimpl_->constantBuffer, 0, &constants, sizeof(constants));
+
+    /* Reset draw count and all draw arguments, so unused arguments draw nothing without DrawIndexedIndirectCount */
+    cmdBuffer.FillBuffer(*pimpl_->drawCountBuffer, 0, 0);
+    cmdBuffer.FillBuffer(*pimpl_->drawArgsBuffer, 0, 0);
+
+    if (numInstances == 0)
+        return;
+
+    cmdBuffer.SetPipelineState(*pimpl_->cullPipeline);
+    cmdBuffer.SetResource(0, *pimpl_->hiZTexture);
+    cmdBuffer.SetResource(1, *pimpl_->constantBuffer);
+    cmdBuffer.SetResource(2, instanceBuffer);
+    cmdBuffer.SetResource(3, *pimpl_->drawArgsBuffer);
+    cmdBuffer.SetResource(4, *pimpl_->drawCountBuffer);
+    cmdBuffer.Dispatch(DivideRoundUp(numInstances, g_cullWorkGroupSize), 1, 1);
+}
+
+void GPUCulling::DrawIndexedIndirect(CommandBuffer& cmdBuffer)
+{
+    if (!IsValid())
+        return;
+
+    if (pimpl_->hasIndirectDrawingCount)
+        cmdBuffer.DrawIndexedIndirectCount(*pimpl_->drawArgsBuffer, 0, *pimpl_->drawCountBuffer, 0, pimpl_->maxInstances, drawArgsStride);
+    else
+        cmdBuffer.DrawIndexedIndirect(*pimpl_->drawArgsBuffer, 0, pimpl_->maxInstances, drawArgsStride);
+}
+
+Buffer& GPUCulling::GetDrawArgsBuffer() const
+{
+    return *pimpl_->drawArgsBuffer;
+}
+
+Buffer& GPUCulling::GetDrawCountBuffer() const
+{
+    return *pimpl_->drawCountBuffer;
+}
+
+Texture& GPUCulling::GetHiZTexture() const
+{
+    return *pimpl_->hiZTexture;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
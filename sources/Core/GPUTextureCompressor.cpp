@@ -0,0 +1,381 @@
+/*
+ * GPUTextureCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/GPUTextureCompressor.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineState.h>
+#include <LLGL/Shader.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/Report.h>
+#include "Builtin/GPUTextureCompressor.hlsl.inl"
+#include "Builtin/GPUTextureCompressor.glsl.inl"
+#include "Builtin/GPUTextureCompressor.metal.inl"
+#include <algorithm>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Work group size must match the built-in shaders
+static constexpr std::uint32_t g_compressWorkGroupSize = 8;
+
+// Constant buffer layout of the compute pass; see GPUTextureCompressorConstants in the built-in shaders
+struct GPUTextureCompressorConstants
+{
+    std::uint32_t   numBlocks[2];
+    std::uint32_t   srcExtent[2];
+    std::uint32_t   srcMipLevel;
+    std::uint32_t   encodeSRGB;
+    std::uint32_t   pad0[2];
+};
+
+static_assert(sizeof(GPUTextureCompressorConstants) == 32, "GPUTextureCompressorConstants must be 32 bytes");
+
+// Index of the compute pipeline for each supported block compression
+enum GPUTextureCompressorEncoder
+{
+    GPUTextureCompressorEncoder_BC1 = 0,
+    GPUTextureCompressorEncoder_BC3,
+
+    GPUTextureCompressorEncoder_Num,
+};
+
+struct GPUTextureCompressor::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem) :
+        renderSystem { renderSystem }
+    {
+    }
+
+    RenderSystem&           renderSystem;
+    std::uint64_t           blockBufferSize = 0;
+
+    Buffer*                 constantBuffer  = nullptr;
+    Buffer*                 blockBuffer     = nullptr;
+
+    std::vector<Shader*>    builtinShaders;
+    PipelineLayout*         pipelineLayout  = nullptr;
+    PipelineState*          pipelines[GPUTextureCompressorEncoder_Num] = {};
+};
+
+
+/*
+ * Internal functions
+ */
+
+static bool IsShadingLanguageSupported(const RenderingCapabilities& caps, const ShadingLanguage language)
+{
+    return (std::find(caps.shadingLanguages.begin(), caps.shadingLanguages.end(), language) != caps.shadingLanguages.end());
+}
+
+// Returns the language of the built-in shaders that is supported by the render system or ShadingLanguage::VersionBitmask if there is none.
+static ShadingLanguage SelectBuiltinShadingLanguage(const RenderingCapabilities& caps)
+{
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::HLSL))
+        return ShadingLanguage::HLSL;
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::Metal))
+        return ShadingLanguage::Metal;
+    if (IsShadingLanguageSupported(caps, ShadingLanguage::GLSL_430) && !IsShadingLanguageSupported(caps, ShadingLanguage::SPIRV))
+        return ShadingLanguage::GLSL;
+    return ShadingLanguage::VersionBitmask;
+}
+
+// Returns the encoder for the specified compressed format or GPUTextureCompressorEncoder_Num if the format is not supported.
+static GPUTextureCompressorEncoder GetEncoderForFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::BC1UNorm:
+        case Format::BC1UNorm_sRGB:
+            return GPUTextureCompressorEncoder_BC1;
+        case Format::BC3UNorm:
+        case Format::BC3UNorm_sRGB:
+            return GPUTextureCompressorEncoder_BC3;
+        default:
+            return GPUTextureCompressorEncoder_Num;
+    }
+}
+
+static std::uint32_t GetBlockSize(const GPUTextureCompressorEncoder encoder)
+{
+    return (encoder == GPUTextureCompressorEncoder_BC1 ? 8 : 16);
+}
+
+static std::uint32_t DivideRoundUp(std::uint32_t x, std::uint32_t y)
+{
+    return (x + y - 1) / y;
+}
+
+// Compiles the BC1 and BC3 permutations of the built-in shader at once, since they share the same source.
+static void CreateBuiltinShaders(
+    GPUTextureCompressor::Pimpl&    pimpl,
+    ShadingLanguage                 language,
+    Shader*                         (&outShaders)[GPUTextureCompressorEncoder_Num],
+    Report*                         report)
+{
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = "CompressBlocks";
+        shaderDesc.type         = ShaderType::Compute;
+        shaderDesc.source       = GPUTextureCompressor::GetShaderSource(language);
+        shaderDesc.sourceType   = ShaderSourceType::CodeString;
+        shaderDesc.compute.workGroupSize = Extent3D{ g_compressWorkGroupSize, g_compressWorkGroupSize, 1 };
+
+        if (language == ShadingLanguage::HLSL)
+        {
+            shaderDesc.entryPoint   = "CompressBlocks";
+            shaderDesc.profile      = "cs_5_0";
+        }
+        else if (language == ShadingLanguage::Metal)
+        {
+            shaderDesc.entryPoint   = "CompressBlocks";
+            shaderDesc.profile      = "2.0";
+        }
+    }
+
+    const ShaderMacro bc3Defines[] = { ShaderMacro{ "GPU_TEXTURE_COMPRESSOR_BC3" }, ShaderMacro{ nullptr } };
+    const ShaderMacro* const permutationDefines[GPUTextureCompressorEncoder_Num] = { nullptr, bc3Defines };
+
+    Shader* shaders[GPUTextureCompressorEncoder_Num] = {};
+    pimpl.renderSystem.CreateShaders(shaderDesc, GPUTextureCompressorEncoder_Num, permutationDefines, shaders);
+
+    const char* encoderNames[GPUTextureCompressorEncoder_Num] = { "BC1", "BC3" };
+
+    for (int encoder = 0; encoder < GPUTextureCompressorEncoder_Num; ++encoder)
+    {
+        Shader* shader = shaders[encoder];
+        if (shader == nullptr)
+            continue;
+
+        pimpl.builtinShaders.push_back(shader);
+
+        const Report* shaderReport = shader->GetReport();
+        if (shaderReport != nullptr && shaderReport->HasErrors())
+        {
+            if (report != nullptr)
+                report->Errorf("failed to compile GPU texture compressor shader for %s:\n%s", encoderNames[encoder], shaderReport->GetText());
+            continue;
+        }
+
+        if (outShaders[encoder] == nullptr)
+            outShaders[encoder] = shader;
+    }
+}
+
+static PipelineState* CreateComputePipeline(RenderSystem& renderSystem, const char* debugName, PipelineLayout* layout, Shader* shader, Report* report)
+{
+    if (shader == nullptr)
+        return nullptr;
+
+    ComputePipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.debugName      = debugName;
+        pipelineDesc.pipelineLayout = layout;
+        pipelineDesc.computeShader  = shader;
+    }
+    PipelineState* pipeline = renderSystem.CreatePipelineState(pipelineDesc);
+
+    if (pipeline != nullptr && report != nullptr)
+    {
+        const Report* pipelineReport = pipeline->GetReport();
+        if (pipelineReport != nullptr && pipelineReport->HasErrors())
+            report->Errorf("failed to create GPU texture compressor pipeline '%s':\n%s", debugName, pipelineReport->GetText());
+    }
+
+    return pipeline;
+}
+
+static void CreateComputePipelines(GPUTextureCompressor::Pimpl& pimpl, const GPUTextureCompressorDescriptor& desc, Report* report)
+{
+    RenderSystem& renderSystem = pimpl.renderSystem;
+
+    pimpl.pipelineLayout = renderSystem.CreatePipelineLayout(
+        Parse(
+            "texture(srcTexture@0):comp,"
+            "cbuffer(GPUTextureCompressorConstants@1):comp,"
+            "rwbuffer(GPUTextureCompressorBlocks@2):comp"
+        )
+    );
+
+    Shader* shaders[GPUTextureCompressorEncoder_Num] = { desc.bc1Shader, desc.bc3Shader };
+
+    if (shaders[GPUTextureCompressorEncoder_BC1] == nullptr || shaders[GPUTextureCompressorEncoder_BC3] == nullptr)
+    {
+        const ShadingLanguage language = SelectBuiltinShadingLanguage(renderSystem.GetRenderingCaps());
+
+        if (language == ShadingLanguage::VersionBitmask)
+        {
+            if (report != nullptr)
+                report->Errorf("GPU texture compressor requires HLSL, GLSL 430, or Metal for built-in shaders; use GPUTextureCompressorDescriptor::bc1Shader and bc3Shader otherwise\n");
+            return;
+        }
+
+        CreateBuiltinShaders(pimpl, language, shaders, report);
+    }
+
+    pimpl.pipelines[GPUTextureCompressorEncoder_BC1] = CreateComputePipeline(renderSystem, "LLGL::GPUTextureCompressor.BC1", pimpl.pipelineLayout, shaders[GPUTextureCompressorEncoder_BC1], report);
+    pimpl.pipelines[GPUTextureCompressorEncoder_BC3] = CreateComputePipeline(renderSystem, "LLGL::GPUTextureCompressor.BC3", pimpl.pipelineLayout, shaders[GPUTextureCompressorEncoder_BC3], report);
+}
+
+
+/*
+ * GPUTextureCompressor class
+ */
+
+GPUTextureCompressor::GPUTextureCompressor(RenderSystem& renderSystem, const GPUTextureCompressorDescriptor& desc, Report* report) :
+    pimpl_ { new Pimpl{ renderSystem } }
+{
+    /* Allocate block buffer for the largest block size, i.e. 16 bytes per block for BC3 */
+    const std::uint64_t numBlocksX = DivideRoundUp(std::max(1u, desc.maxExtent.x), 4);
+    const std::uint64_t numBlocksY = DivideRoundUp(std::max(1u, desc.maxExtent.y), 4);
+    pimpl_->blockBufferSize = numBlocksX * numBlocksY * GetBlockSize(GPUTextureCompressorEncoder_BC3);
+
+    /* Create buffers for constants and encoded blocks */
+    BufferDescriptor constantBufferDesc;
+    {
+        constantBufferDesc.debugName    = "LLGL::GPUTextureCompressor.Constants";
+        constantBufferDesc.size         = sizeof(GPUTextureCompressorConstants);
+        constantBufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+    }
+    pimpl_->constantBuffer = renderSystem.CreateBuffer(constantBufferDesc);
+
+    BufferDescriptor blockBufferDesc;
+    {
+        blockBufferDesc.debugName   = "LLGL::GPUTextureCompressor.Blocks";
+        blockBufferDesc.size        = pimpl_->blockBufferSize;
+        blockBufferDesc.bindFlags   = (BindFlags::Storage | BindFlags::CopySrc);
+    }
+    pimpl_->blockBuffer = renderSystem.CreateBuffer(blockBufferDesc);
+
+    /* Create compute pipelines */
+    CreateComputePipelines(*pimpl_, desc, report);
+}
+
+GPUTextureCompressor::~GPUTextureCompressor()
+{
+    RenderSystem& renderSystem = pimpl_->renderSystem;
+
+    for (PipelineState* pipeline : pimpl_->pipelines)
+    {
+        if (pipeline != nullptr)
+            renderSystem.Release(*pipeline);
+    }
+
+    for (Shader* shader : pimpl_->builtinShaders)
+        renderSystem.Release(*shader);
+
+    if (pimpl_->pipelineLayout != nullptr)
+        renderSystem.Release(*pimpl_->pipelineLayout);
+
+    if (pimpl_->blockBuffer != nullptr)
+        renderSystem.Release(*pimpl_->blockBuffer);
+    if (pimpl_->constantBuffer != nullptr)
+        renderSystem.Release(*pimpl_->constantBuffer);
+
+    delete pimpl_;
+}
+
+const char* GPUTextureCompressor::GetShaderSource(const ShadingLanguage language)
+{
+    switch (language)
+    {
+        case ShadingLanguage::HLSL:     return g_GPUTextureCompressor_HLSL;
+        case ShadingLanguage::GLSL:     return g_GPUTextureCompressor_GLSL;
+        case ShadingLanguage::Metal:    return g_GPUTextureCompressor_Metal;
+        default:                        return nullptr;
+    }
+}
+
+bool GPUTextureCompressor::IsFormatSupported(const Format format)
+{
+    return (GetEncoderForFormat(format) != GPUTextureCompressorEncoder_Num);
+}
+
+bool GPUTextureCompressor::IsValid() const
+{
+    return
+    (
+        pimpl_->constantBuffer                              != nullptr  &&
+        pimpl_->blockBuffer                                 != nullptr  &&
+        pimpl_->pipelines[GPUTextureCompressorEncoder_BC1]  != nullptr  &&
+        pimpl_->pipelines[GPUTextureCompressorEncoder_BC3]  != nullptr
+    );
+}
+
+bool GPUTextureCompressor::Compress(CommandBuffer& cmdBuffer, Texture& srcTexture, Texture& dstTexture, std::uint32_t mipLevel)
+{
+    if (!IsValid())
+        return false;
+
+    const GPUTextureCompressorEncoder encoder = GetEncoderForFormat(dstTexture.GetFormat());
+    if (encoder == GPUTextureCompressorEncoder_Num)
+        return false;
+
+    /* Source and destination MIP-maps must have the same extent and all blocks must fit into the block buffer */
+    const Extent3D extent = srcTexture.GetMipExtent(mipLevel);
+    const Extent3D dstExtent = dstTexture.GetMipExtent(mipLevel);
+    if (extent.x == 0 || extent.y == 0 || extent.x != dstExtent.x || extent.y != dstExtent.y)
+        return false;
+
+    const std::uint32_t numBlocksX = DivideRoundUp(extent.x, 4);
+    const std::uint32_t numBlocksY = DivideRoundUp(extent.y, 4);
+    if (static_cast<std::uint64_t>(numBlocksX) * numBlocksY * GetBlockSize(encoder) > pimpl_->blockBufferSize)
+        return false;
+
+    /* Sampling an sRGB texture returns linear colors, which must be converted back if the blocks are interpreted in sRGB color space */
+    const bool isSrcSRGB = ((GetFormatAttribs(srcTexture.GetFormat()).flags & FormatFlags::IsColorSpace_sRGB) != 0);
+    const bool isDstSRGB = ((GetFormatAttribs(dstTexture.GetFormat()).flags & FormatFlags::IsColorSpace_sRGB) != 0);
+
+    /* Update constants for this compute pass */
+    GPUTextureCompressorConstants constants;
+    {
+        constants.numBlocks[0]  = numBlocksX;
+        constants.numBlocks[1]  = numBlocksY;
+        constants.srcExtent[0]  = extent.x;
+        constants.srcExtent[1]  = extent.y;
+        constants.srcMipLevel   = mipLevel;
+        constants.encodeSRGB    = (isSrcSRGB && isDstSRGB ? 1u : 0u);
+        constants.pad0[0]       = 0;
+        constants.pad0[1]       = 0;
+    }
+    cmdBuffer.UpdateBuffer(*pimpl_->constantBuffer, 0, &constants, sizeof(constants));
+
+    /* Encode one block per thread into the block buffer */
+    cmdBuffer.SetPipelineState(*pimpl_->pipelines[encoder]);
+    cmdBuffer.SetResource(0, srcTexture);
+    cmdBuffer.SetResource(1, *pimpl_->constantBuffer);
+    cmdBuffer.SetResource(2, *pimpl_->blockBuffer);
+    cmdBuffer.Dispatch(DivideRoundUp(numBlocksX, g_compressWorkGroupSize), DivideRoundUp(numBlocksY, g_compressWorkGroupSize), 1);
+
+    /* Copy tightly packed blocks into the compressed MIP-map */
+    const TextureRegion dstRegion{ TextureSubresource{ 0, mipLevel }, Offset3D{}, Extent3D{ extent.x, extent.y, 1 } };
+    cmdBuffer.CopyTextureFromBuffer(dstTexture, dstRegion, *pimpl_->blockBuffer, 0);
+
+    return true;
+}
+
+Buffer& GPUTextureCompressor::GetBlockBuffer() const
+{
+    return *pimpl_->blockBuffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,373 @@
+/*
+ * ImageConversionKernels.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ImageConversionKernels.h"
+#include "Float16Compressor.h"
+#include <LLGL/Utils/ForRange.h>
+#include <cstdint>
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_IMAGE_KERNELS_SSE2
+#   include <emmintrin.h>
+#elif (defined __ARM_NEON && defined __aarch64__) || defined _M_ARM64
+#   define LLGL_IMAGE_KERNELS_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+All kernels must produce the same results as the generic conversion in ImageFlags.cpp,
+i.e. normalized integers are converted with double precision and truncated towards zero.
+Out-of-range values are saturated by the SIMD paths, whereas the generic conversion leaves them undefined.
+*/
+
+/* ----- Data type kernels ----- */
+
+static void ConvertUInt8ToFloat32(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(srcBuffer);
+    float*              dst = static_cast<float*>(dstBuffer);
+
+    #if defined LLGL_IMAGE_KERNELS_SSE2
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(255.0f);
+
+    for (; begin + 16 <= end; begin += 16)
+    {
+        const __m128i v8    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + begin));
+        const __m128i v16lo = _mm_unpacklo_epi8(v8, zero);
+        const __m128i v16hi = _mm_unpackhi_epi8(v8, zero);
+        _mm_storeu_ps(dst + begin +  0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v16lo, zero)), scale));
+        _mm_storeu_ps(dst + begin +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v16lo, zero)), scale));
+        _mm_storeu_ps(dst + begin +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v16hi, zero)), scale));
+        _mm_storeu_ps(dst + begin + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v16hi, zero)), scale));
+    }
+
+    #elif defined LLGL_IMAGE_KERNELS_NEON
+
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+
+    for (; begin + 16 <= end; begin += 16)
+    {
+        const uint8x16_t v8     = vld1q_u8(src + begin);
+        const uint16x8_t v16lo  = vmovl_u8(vget_low_u8(v8));
+        const uint16x8_t v16hi  = vmovl_u8(vget_high_u8(v8));
+        vst1q_f32(dst + begin +  0, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v16lo))), scale));
+        vst1q_f32(dst + begin +  4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16lo))), scale));
+        vst1q_f32(dst + begin +  8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v16hi))), scale));
+        vst1q_f32(dst + begin + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16hi))), scale));
+    }
+
+    #endif
+
+    for_subrange(i, begin, end)
+        dst[i] = static_cast<float>(static_cast<double>(src[i]) / 255.0);
+}
+
+#ifdef LLGL_IMAGE_KERNELS_SSE2
+
+// Converts four floats to normalized integers with double precision, i.e. trunc(x * scale).
+static __m128i ConvertFloat32x4ToNormInt32x4(const float* src, const __m128d scale)
+{
+    const __m128  v     = _mm_loadu_ps(src);
+    const __m128i lo    = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(v), scale));
+    const __m128i hi    = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), scale));
+    return _mm_unpacklo_epi64(lo, hi);
+}
+
+#endif // /LLGL_IMAGE_KERNELS_SSE2
+
+static void ConvertFloat32ToUInt8(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const float*    src = static_cast<const float*>(srcBuffer);
+    std::uint8_t*   dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    #ifdef LLGL_IMAGE_KERNELS_SSE2
+
+    const __m128d scale = _mm_set1_pd(255.0);
+
+    for (; begin + 16 <= end; begin += 16)
+    {
+        const __m128i v0 = ConvertFloat32x4ToNormInt32x4(src + begin +  0, scale);
+        const __m128i v1 = ConvertFloat32x4ToNormInt32x4(src + begin +  4, scale);
+        const __m128i v2 = ConvertFloat32x4ToNormInt32x4(src + begin +  8, scale);
+        const __m128i v3 = ConvertFloat32x4ToNormInt32x4(src + begin + 12, scale);
+        const __m128i v8 = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + begin), v8);
+    }
+
+    #endif // /LLGL_IMAGE_KERNELS_SSE2
+
+    for_subrange(i, begin, end)
+        dst[i] = static_cast<std::uint8_t>(static_cast<double>(src[i]) * 255.0);
+}
+
+static void ConvertUInt16ToFloat32(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint16_t*    src = static_cast<const std::uint16_t*>(srcBuffer);
+    float*                  dst = static_cast<float*>(dstBuffer);
+
+    #if defined LLGL_IMAGE_KERNELS_SSE2
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(65535.0f);
+
+    for (; begin + 8 <= end; begin += 8)
+    {
+        const __m128i v16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + begin));
+        _mm_storeu_ps(dst + begin + 0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v16, zero)), scale));
+        _mm_storeu_ps(dst + begin + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v16, zero)), scale));
+    }
+
+    #elif defined LLGL_IMAGE_KERNELS_NEON
+
+    const float32x4_t scale = vdupq_n_f32(65535.0f);
+
+    for (; begin + 8 <= end; begin += 8)
+    {
+        const uint16x8_t v16 = vld1q_u16(src + begin);
+        vst1q_f32(dst + begin + 0, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v16))), scale));
+        vst1q_f32(dst + begin + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16))), scale));
+    }
+
+    #endif
+
+    for_subrange(i, begin, end)
+        dst[i] = static_cast<float>(static_cast<double>(src[i]) / 65535.0);
+}
+
+static void ConvertFloat32ToUInt16(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const float*    src = static_cast<const float*>(srcBuffer);
+    std::uint16_t*  dst = static_cast<std::uint16_t*>(dstBuffer);
+
+    #ifdef LLGL_IMAGE_KERNELS_SSE2
+
+    /* SSE2 has no unsigned 32-to-16 bit pack, so shift into the signed range and back */
+    const __m128d scale     = _mm_set1_pd(65535.0);
+    const __m128i bias32    = _mm_set1_epi32(32768);
+    const __m128i bias16    = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    for (; begin + 8 <= end; begin += 8)
+    {
+        const __m128i v0    = _mm_sub_epi32(ConvertFloat32x4ToNormInt32x4(src + begin + 0, scale), bias32);
+        const __m128i v1    = _mm_sub_epi32(ConvertFloat32x4ToNormInt32x4(src + begin + 4, scale), bias32);
+        const __m128i v16   = _mm_xor_si128(_mm_packs_epi32(v0, v1), bias16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + begin), v16);
+    }
+
+    #endif // /LLGL_IMAGE_KERNELS_SSE2
+
+    for_subrange(i, begin, end)
+        dst[i] = static_cast<std::uint16_t>(static_cast<double>(src[i]) * 65535.0);
+}
+
+// Returns the lookup table of all 256 normalized 8-bit values as 16-bit floats.
+static const std::uint16_t* GetUInt8ToFloat16Table()
+{
+    struct Table
+    {
+        Table()
+        {
+            for_range(i, 256u)
+                values[i] = CompressFloat16(static_cast<float>(static_cast<double>(i) / 255.0));
+        }
+        std::uint16_t values[256];
+    };
+    static const Table table;
+    return table.values;
+}
+
+static void ConvertUInt8ToFloat16(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint8_t* src     = static_cast<const std::uint8_t*>(srcBuffer);
+    std::uint16_t*      dst     = static_cast<std::uint16_t*>(dstBuffer);
+    const std::uint16_t* table  = GetUInt8ToFloat16Table();
+
+    for_subrange(i, begin, end)
+        dst[i] = table[src[i]];
+}
+
+static void ConvertFloat16ToUInt8(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint16_t*    src = static_cast<const std::uint16_t*>(srcBuffer);
+    std::uint8_t*           dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    for_subrange(i, begin, end)
+        dst[i] = static_cast<std::uint8_t>(static_cast<double>(DecompressFloat16(src[i])) * 255.0);
+}
+
+
+static void ConvertFloat32ToFloat16(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const float*    src = static_cast<const float*>(srcBuffer);
+    std::uint16_t*  dst = static_cast<std::uint16_t*>(dstBuffer);
+    CompressFloat16Array(src + begin, dst + begin, end - begin);
+}
+
+static void ConvertFloat16ToFloat32(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint16_t*    src = static_cast<const std::uint16_t*>(srcBuffer);
+    float*                  dst = static_cast<float*>(dstBuffer);
+    DecompressFloat16Array(src + begin, dst + begin, end - begin);
+}
+
+
+/* ----- Format kernels ----- */
+
+// Converts RGB to RGBA (or BGR to BGRA) and sets alpha to its maximum.
+template <typename T>
+void ConvertRGBToRGBA(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end, T alpha)
+{
+    const T*    src = static_cast<const T*>(srcBuffer);
+    T*          dst = static_cast<T*>(dstBuffer);
+
+    for_subrange(i, begin, end)
+    {
+        dst[i*4    ] = src[i*3    ];
+        dst[i*4 + 1] = src[i*3 + 1];
+        dst[i*4 + 2] = src[i*3 + 2];
+        dst[i*4 + 3] = alpha;
+    }
+}
+
+static void ConvertRGBToRGBA_UInt8(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    #ifdef LLGL_IMAGE_KERNELS_NEON
+
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(srcBuffer);
+    std::uint8_t*       dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    for (; begin + 16 <= end; begin += 16)
+    {
+        const uint8x16x3_t rgb = vld3q_u8(src + begin*3);
+        uint8x16x4_t rgba;
+        {
+            rgba.val[0] = rgb.val[0];
+            rgba.val[1] = rgb.val[1];
+            rgba.val[2] = rgb.val[2];
+            rgba.val[3] = vdupq_n_u8(0xFF);
+        }
+        vst4q_u8(dst + begin*4, rgba);
+    }
+
+    #endif // /LLGL_IMAGE_KERNELS_NEON
+
+    ConvertRGBToRGBA<std::uint8_t>(srcBuffer, dstBuffer, begin, end, 0xFF);
+}
+
+static void ConvertRGBToRGBA_Float32(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    ConvertRGBToRGBA<float>(srcBuffer, dstBuffer, begin, end, 1.0f);
+}
+
+// Swaps the red and blue channels, i.e. converts RGBA to BGRA and vice versa.
+static void SwizzleRGBAToBGRA_UInt8(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end)
+{
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(srcBuffer);
+    std::uint8_t*       dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    #if defined LLGL_IMAGE_KERNELS_SSE2
+
+    const __m128i maskGA = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i maskRB = _mm_set1_epi32(0x000000FF);
+
+    for (; begin + 4 <= end; begin += 4)
+    {
+        const __m128i v     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + begin*4));
+        const __m128i ga    = _mm_and_si128(v, maskGA);
+        const __m128i r     = _mm_slli_epi32(_mm_and_si128(v, maskRB), 16);
+        const __m128i b     = _mm_and_si128(_mm_srli_epi32(v, 16), maskRB);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + begin*4), _mm_or_si128(ga, _mm_or_si128(r, b)));
+    }
+
+    #elif defined LLGL_IMAGE_KERNELS_NEON
+
+    for (; begin + 16 <= end; begin += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + begin*4);
+        const uint8x16_t r = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = r;
+        vst4q_u8(dst + begin*4, v);
+    }
+
+    #endif
+
+    for_subrange(i, begin, end)
+    {
+        dst[i*4    ] = src[i*4 + 2];
+        dst[i*4 + 1] = src[i*4 + 1];
+        dst[i*4 + 2] = src[i*4    ];
+        dst[i*4 + 3] = src[i*4 + 3];
+    }
+}
+
+
+/* ----- Kernel selection ----- */
+
+ImageConversionKernel FindImageDataTypeKernel(DataType srcDataType, DataType dstDataType)
+{
+    if (srcDataType == DataType::UInt8 && dstDataType == DataType::Float32)
+        return ConvertUInt8ToFloat32;
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::UInt8)
+        return ConvertFloat32ToUInt8;
+    if (srcDataType == DataType::UInt16 && dstDataType == DataType::Float32)
+        return ConvertUInt16ToFloat32;
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::UInt16)
+        return ConvertFloat32ToUInt16;
+    if (srcDataType == DataType::UInt8 && dstDataType == DataType::Float16)
+        return ConvertUInt8ToFloat16;
+    if (srcDataType == DataType::Float16 && dstDataType == DataType::UInt8)
+        return ConvertFloat16ToUInt8;
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::Float16)
+        return ConvertFloat32ToFloat16;
+    if (srcDataType == DataType::Float16 && dstDataType == DataType::Float32)
+        return ConvertFloat16ToFloat32;
+    return nullptr;
+}
+
+ImageConversionKernel FindImageFormatKernel(ImageFormat srcFormat, ImageFormat dstFormat, DataType dataType)
+{
+    const bool isRGBToRGBA =
+    (
+        (srcFormat == ImageFormat::RGB && dstFormat == ImageFormat::RGBA) ||
+        (srcFormat == ImageFormat::BGR && dstFormat == ImageFormat::BGRA)
+    );
+    const bool isRGBASwizzle =
+    (
+        (srcFormat == ImageFormat::RGBA && dstFormat == ImageFormat::BGRA) ||
+        (srcFormat == ImageFormat::BGRA && dstFormat == ImageFormat::RGBA)
+    );
+
+    if (dataType == DataType::UInt8)
+    {
+        if (isRGBToRGBA)
+            return ConvertRGBToRGBA_UInt8;
+        if (isRGBASwizzle)
+            return SwizzleRGBAToBGRA_UInt8;
+    }
+    else if (dataType == DataType::Float32)
+    {
+        if (isRGBToRGBA)
+            return ConvertRGBToRGBA_Float32;
+    }
+
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
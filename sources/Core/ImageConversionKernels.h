@@ -0,0 +1,41 @@
+/*
+ * ImageConversionKernels.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_CONVERSION_KERNELS_H
+#define LLGL_IMAGE_CONVERSION_KERNELS_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Function signature of a specialized image conversion kernel.
+Converts the elements in the range [begin, end) from the source buffer into the destination buffer.
+For data type kernels, an element is a single color component; for format kernels, an element is a whole pixel.
+*/
+using ImageConversionKernel = void (*)(const void* srcBuffer, void* dstBuffer, std::size_t begin, std::size_t end);
+
+// Returns a specialized kernel to convert between the specified data types or null if the generic conversion must be used.
+ImageConversionKernel FindImageDataTypeKernel(DataType srcDataType, DataType dstDataType);
+
+// Returns a specialized kernel to convert between the specified image formats of the same data type or null if the generic conversion must be used.
+ImageConversionKernel FindImageFormatKernel(ImageFormat srcFormat, ImageFormat dstFormat, DataType dataType);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
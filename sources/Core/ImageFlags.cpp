@@ -18,6 +18,9 @@
 #include "../Core/Threading.h"
 #include "Float16Compressor.h"
 #include "BCDecompressor.h"
+#include "BCCompressor.h"
+#include "ImageConversionKernels.h"
+#include "MipChainGenerator.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -212,17 +215,26 @@ static void ConvertImageBufferDataType(
     if (dstBufferSize != requiredDstBufferSize)
         LLGL_TRAP("cannot convert image data type with destination buffer size mismatch");
 
+    /* Use specialized kernel for common data type pairs */
+    if (ImageConversionKernel kernel = FindImageDataTypeKernel(srcDataType, dstDataType))
+    {
+        ParallelForRange(
+            [kernel, srcBuffer, dstBuffer](std::size_t begin, std::size_t end)
+            {
+                kernel(srcBuffer, dstBuffer, begin, end);
+            },
+            imageSize,
+            threadCount
+        );
+        return;
+    }
+
     /* Get variant buffer for source and destination images */
-    DoConcurrentRange(
-        std::bind(
-            ConvertImageBufferDataTypeWorker,
-            srcDataType,
-            srcBuffer,
-            dstDataType,
-            dstBuffer,
-            std::placeholders::_1,
-            std::placeholders::_2
-        ),
+    ParallelForRange(
+        [srcDataType, srcBuffer, dstDataType, dstBuffer](std::size_t begin, std::size_t end)
+        {
+            ConvertImageBufferDataTypeWorker(srcDataType, srcBuffer, dstDataType, dstBuffer, begin, end);
+        },
         imageSize,
         threadCount
     );
@@ -534,19 +546,40 @@ static void ConvertImageBufferFormat(
     if (dstImageView.dataSize != requiredDstBufferSize)
         LLGL_TRAP("cannot convert image format with destination buffer size mismatch");
 
+    /* Use specialized kernel for common format pairs */
+    if (srcImageView.dataType == dstImageView.dataType)
+    {
+        if (ImageConversionKernel kernel = FindImageFormatKernel(srcImageView.format, dstImageView.format, srcImageView.dataType))
+        {
+            const void* srcBuffer = srcImageView.data;
+            void*       dstBuffer = dstImageView.data;
+            ParallelForRange(
+                [kernel, srcBuffer, dstBuffer](std::size_t begin, std::size_t end)
+                {
+                    kernel(srcBuffer, dstBuffer, begin, end);
+                },
+                imageSize,
+                threadCount
+            );
+            return;
+        }
+    }
+
     /* Get variant buffer for source and destination images */
-    DoConcurrentRange(
-        std::bind(
-            ConvertImageBufferFormatWorker,
-            srcImageView.format,
-            srcImageView.dataType,
-            srcImageView.data,
-            dstImageView.format,
-            dstImageView.dataType,
-            dstImageView.data,
-            std::placeholders::_1,
-            std::placeholders::_2
-        ),
+    ParallelForRange(
+        [&srcImageView, &dstImageView](std::size_t begin, std::size_t end)
+        {
+            ConvertImageBufferFormatWorker(
+                srcImageView.format,
+                srcImageView.dataType,
+                srcImageView.data,
+                dstImageView.format,
+                dstImageView.dataType,
+                dstImageView.data,
+                begin,
+                end
+            );
+        },
         imageSize,
         threadCount
     );
@@ -741,10 +774,121 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
         threadCount = std::thread::hardware_concurrency();
 
     /* Check for BC compression */
-    if (srcImageView.format == ImageFormat::BC1)
-        return DecompressBC1ToRGBA8UNorm(extent, reinterpret_cast<const char*>(srcImageView.data), srcImageView.dataSize, threadCount);
+    const char*     data        = reinterpret_cast<const char*>(srcImageView.data);
+    const bool      isSigned    = (srcImageView.dataType == DataType::Int8);
+
+    switch (srcImageView.format)
+    {
+        case ImageFormat::BC1:
+            return DecompressBC1ToRGBA8UNorm(extent, data, srcImageView.dataSize, threadCount);
+        case ImageFormat::BC2:
+            return DecompressBC2ToRGBA8UNorm(extent, data, srcImageView.dataSize, threadCount);
+        case ImageFormat::BC3:
+            return DecompressBC3ToRGBA8UNorm(extent, data, srcImageView.dataSize, threadCount);
+        case ImageFormat::BC4:
+            return DecompressBC4ToRGBA8UNorm(extent, data, srcImageView.dataSize, isSigned, threadCount);
+        case ImageFormat::BC5:
+            return DecompressBC5ToRGBA8UNorm(extent, data, srcImageView.dataSize, isSigned, threadCount);
+        default:
+            return nullptr;
+    }
+}
+
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent2D&     extent,
+    ImageFormat         dstFormat,
+    unsigned            threadCount)
+{
+    if (!IsCompressedFormat(dstFormat) || IsCompressedFormat(srcImageView.format) || IsDepthOrStencilFormat(srcImageView.format))
+        return nullptr;
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert source image to RGBA8UNorm first if necessary */
+    if (srcImageView.format != ImageFormat::RGBA || srcImageView.dataType != DataType::UInt8)
+    {
+        DynamicByteArray intermediateImage = ConvertImageBuffer(srcImageView, ImageFormat::RGBA, DataType::UInt8, threadCount);
+        return CompressRGBA8UNormToBC(extent, intermediateImage.get(), intermediateImage.size(), dstFormat, threadCount);
+    }
+
+    return CompressRGBA8UNormToBC(extent, reinterpret_cast<const char*>(srcImageView.data), srcImageView.dataSize, dstFormat, threadCount);
+}
+
+LLGL_EXPORT DynamicByteArray GenerateMipChain(
+    const ImageView&    srcImageView,
+    const Extent3D&     extent,
+    std::uint32_t       numMipLevels,
+    ImageFilter         filter,
+    long                flags,
+    unsigned            threadCount)
+{
+    if (IsCompressedFormat(srcImageView.format) || IsDepthOrStencilFormat(srcImageView.format) || srcImageView.data == nullptr)
+        return nullptr;
+
+    const std::size_t numPixels = static_cast<std::size_t>(extent.x) * extent.y * extent.z;
+    if (numPixels == 0 || srcImageView.dataSize < GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numPixels))
+        return nullptr;
+
+    const std::uint32_t maxNumMipLevels = NumMipLevels(extent.x, extent.y);
+    if (numMipLevels == 0 || numMipLevels > maxNumMipLevels)
+        numMipLevels = maxNumMipLevels;
+    if (numMipLevels < 2)
+        return nullptr;
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Allocate output buffer for all MIP-map levels after the base level */
+    std::size_t mipChainSize = 0;
+    for (std::uint32_t mipLevel = 1; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const std::size_t mipPixels = static_cast<std::size_t>(std::max(1u, extent.x >> mipLevel)) * std::max(1u, extent.y >> mipLevel) * extent.z;
+        mipChainSize += GetMemoryFootprint(srcImageView.format, srcImageView.dataType, mipPixels);
+    }
+
+    DynamicByteArray mipChain{ mipChainSize, UninitializeTag{} };
+
+    /* Convert base level into RGBA Float32 format for filtering if necessary */
+    const float*        baseLevel = reinterpret_cast<const float*>(srcImageView.data);
+    DynamicByteArray    intermediateImage;
+
+    if (srcImageView.format != ImageFormat::RGBA || srcImageView.dataType != DataType::Float32)
+    {
+        intermediateImage = ConvertImageBuffer(srcImageView, ImageFormat::RGBA, DataType::Float32, threadCount);
+        baseLevel = reinterpret_cast<const float*>(intermediateImage.get());
+    }
+
+    /* Integer formats are normalized, so filtered values must be clamped before they are converted back */
+    const bool saturate = !IsFloatDataType(srcImageView.dataType);
+
+    /* Generate MIP-map levels and convert them back into the source format */
+    char* dst = mipChain.get();
+
+    GenerateMipChainRGBA32Float(
+        baseLevel,
+        extent,
+        numMipLevels,
+        filter,
+        flags,
+        saturate,
+        threadCount,
+        [&](std::uint32_t /*mipLevel*/, const Extent3D& mipExtent, const float* data, std::size_t dataSize)
+        {
+            const std::size_t       mipPixels   = static_cast<std::size_t>(mipExtent.x) * mipExtent.y * mipExtent.z;
+            const std::size_t       mipSize     = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, mipPixels);
+            const ImageView         mipSrcView  { ImageFormat::RGBA, DataType::Float32, data, dataSize };
+            const MutableImageView  mipDstView  { srcImageView.format, srcImageView.dataType, dst, mipSize };
+
+            if (!ConvertImageBuffer(mipSrcView, mipDstView, threadCount))
+                ::memcpy(dst, data, mipSize);
+
+            dst += mipSize;
+        }
+    );
 
-    return nullptr;
+    return mipChain;
 }
 
 // Returns the 1D flattened buffer position for a 3D image coordinate ('bpp' denotes the bytes per pixel)
@@ -854,7 +998,7 @@ LLGL_EXPORT DynamicByteArray GenerateImageBuffer(
     DynamicByteArray    imageBuffer     = DynamicByteArray{ bytesPerPixel * imageSize, UninitializeTag{} };
 
     /* Initialize image buffer with fill color */
-    DoConcurrentRange(
+    ParallelForRange(
         [&imageBuffer, bytesPerPixel, &fillBuffer1](std::size_t begin, std::size_t end)
         {
             for_subrange(i, begin, end)
@@ -6,17 +6,82 @@
  */
 
 #include "ImageUtils.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
-#include <LLGL/Utils/ForRange.h>
 #include <cstdint>
 #include <algorithm>
 #include <string.h>
 
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_IMAGE_UTILS_SSE2
+#   include <emmintrin.h>
+#endif
+
 
 namespace LLGL
 {
 
 
+// Copies smaller than this are always done with memcpy, since non-temporal stores only pay off for larger blocks.
+static constexpr std::size_t g_minStreamCopySize = 1024;
+
+// Minimum number of bytes each worker thread copies; smaller regions are copied on the calling thread only.
+static constexpr std::size_t g_minBlitBytesPerThread = (1u << 20);
+
+// Size of each block a contiguous copy is split into to distribute it across multiple threads.
+static constexpr std::size_t g_blitBlockSize = (1u << 16);
+
+// Copies memory with non-temporal stores if supported. The caller must issue a store fence afterwards.
+static void StreamCopy(char* dst, const char* src, std::size_t size)
+{
+    #ifdef LLGL_IMAGE_UTILS_SSE2
+
+    if (size >= g_minStreamCopySize)
+    {
+        /* Copy unaligned head with memcpy so that the destination is aligned to 16 bytes for the streaming stores */
+        const std::size_t head = (16u - (reinterpret_cast<std::uintptr_t>(dst) & 15u)) & 15u;
+        ::memcpy(dst, src, head);
+        dst     += head;
+        src     += head;
+        size    -= head;
+
+        for (; size >= 64; size -= 64, dst += 64, src += 64)
+        {
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src +  0));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+            const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+            const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst +  0), v0);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), v1);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), v2);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), v3);
+        }
+
+        for (; size >= 16; size -= 16, dst += 16, src += 16)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+
+    #endif // /LLGL_IMAGE_UTILS_SSE2
+
+    ::memcpy(dst, src, size);
+}
+
+// Makes all previous non-temporal stores of the calling thread globally visible.
+static void StreamFence()
+{
+    #ifdef LLGL_IMAGE_UTILS_SSE2
+    _mm_sfence();
+    #endif
+}
+
+static void CopyBlock(char* dst, const char* src, std::size_t size, bool nonTemporal)
+{
+    if (nonTemporal)
+        StreamCopy(dst, src, size);
+    else
+        ::memcpy(dst, src, size);
+}
+
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -25,66 +90,79 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride)
+    std::uint32_t   srcLayerStride,
+    long            flags,
+    unsigned        threadCount)
 {
     const std::uint32_t rowLength   = bpp * extent.x;
     const std::uint32_t layerLength = rowLength * extent.y;
+    const bool          nonTemporal = ((flags & BitBlitFlags::WriteCombined) != 0);
 
-    /* Clamp strides to tightly packed lengths */
+    /* Clamp strides to tightly packed lengths; layer strides must cover all rows with their row stride */
     dstRowStride = std::max(dstRowStride, rowLength);
     srcRowStride = std::max(srcRowStride, rowLength);
 
-    dstLayerStride = std::max(dstLayerStride, layerLength);
-    srcLayerStride = std::max(srcLayerStride, layerLength);
+    dstLayerStride = std::max(dstLayerStride, dstRowStride * extent.y);
+    srcLayerStride = std::max(srcLayerStride, srcRowStride * extent.y);
 
-    if (srcRowStride == dstRowStride && rowLength == dstRowStride)
+    if (srcRowStride == dstRowStride && rowLength == dstRowStride &&
+        srcLayerStride == dstLayerStride && layerLength == dstLayerStride)
     {
-        if (srcLayerStride == dstLayerStride && layerLength == dstLayerStride)
-        {
-            /* Copy region directly into output data */
-            ::memcpy(dst, src, layerLength * extent.z);
-        }
-        else
-        {
-            /* Copy region directly into output data */
-            for_range(z, extent.z)
-            {
-                /* Copy current slice */
-                ::memcpy(dst, src, layerLength);
+        /* Copy entire region at once, split into blocks for multiple threads */
+        const std::size_t size      = static_cast<std::size_t>(layerLength) * extent.z;
+        const std::size_t numBlocks = (size + g_blitBlockSize - 1) / g_blitBlockSize;
 
-                /* Move pointers to next slice */
-                dst += dstLayerStride;
-                src += srcLayerStride;
-            }
-        }
+        DoConcurrentRange(
+            [dst, src, size, nonTemporal](std::size_t begin, std::size_t end)
+            {
+                const std::size_t offset = begin * g_blitBlockSize;
+                CopyBlock(dst + offset, src + offset, std::min(end * g_blitBlockSize, size) - offset, nonTemporal);
+                if (nonTemporal)
+                    StreamFence();
+            },
+            numBlocks,
+            threadCount,
+            static_cast<unsigned>(g_minBlitBytesPerThread / g_blitBlockSize)
+        );
     }
     else
     {
-        /* Adjust depth strides */
-        dstLayerStride -= dstRowStride * extent.y;
-        srcLayerStride -= srcRowStride * extent.y;
-
-        /* Copy region directly into output data */
-        for_range(z, extent.z)
-        {
-            /* Copy current slice */
-            for_range(y, extent.y)
+        /* Copy entire slices if rows are tightly packed, otherwise copy row by row */
+        const bool          copySlices  = (srcRowStride == dstRowStride && rowLength == dstRowStride);
+        const std::uint32_t blockSize   = (copySlices ? layerLength : rowLength);
+        const std::uint32_t numRows     = (copySlices ? 1u : extent.y);
+        const std::size_t   numBlocks   = static_cast<std::size_t>(numRows) * extent.z;
+
+        DoConcurrentRange(
+            [=](std::size_t begin, std::size_t end)
             {
-                /* Copy current row */
-                ::memcpy(dst, src, rowLength);
-
-                /* Move pointers to next row */
-                dst += dstRowStride;
-                src += srcRowStride;
-            }
-
-            /* Move pointers to next slice */
-            dst += dstLayerStride;
-            src += srcLayerStride;
-        }
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::size_t z = i / numRows;
+                    const std::size_t y = i % numRows;
+                    CopyBlock(
+                        dst + z * dstLayerStride + y * dstRowStride,
+                        src + z * srcLayerStride + y * srcRowStride,
+                        blockSize,
+                        nonTemporal
+                    );
+                }
+                if (nonTemporal)
+                    StreamFence();
+            },
+            numBlocks,
+            threadCount,
+            static_cast<unsigned>(std::max<std::size_t>(1, g_minBlitBytesPerThread / std::max(1u, blockSize)))
+        );
     }
 }
 
+LLGL_EXPORT void CopyToWriteCombinedMemory(void* dst, const void* src, std::size_t size)
+{
+    StreamCopy(static_cast<char*>(dst), static_cast<const char*>(src), size);
+    StreamFence();
+}
+
 
 } // /namespace LLGL
 
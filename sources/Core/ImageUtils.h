@@ -12,15 +12,36 @@
 #include <LLGL/Export.h>
 #include <LLGL/Types.h>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
 {
 
 
+/* ----- Flags ----- */
+
+// Flags for the BitBlit function.
+struct BitBlitFlags
+{
+    enum
+    {
+        /*
+        Destination is write-combined memory, such as a mapped upload buffer.
+        Data is written with non-temporal stores that bypass the cache, so the copy does not evict the working set of the CPU.
+        */
+        WriteCombined = (1 << 0),
+    };
+};
+
+
 /* ----- Functions ----- */
 
-// Copies the specified extent from the source image to the destination image buffer.
+/*
+Copies the specified extent from the source image to the destination image buffer.
+Row strides are clamped to the tightly packed row length and layer strides are clamped to the row stride times the number of rows. If both images are tightly packed, the region is copied with a single contiguous copy.
+Regions larger than 1 MB per thread are distributed across 'threadCount' threads (see DoConcurrentRange).
+*/
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -29,9 +50,17 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride
+    std::uint32_t   srcLayerStride,
+    long            flags       = 0,
+    unsigned        threadCount = 0
 );
 
+/*
+Copies the specified memory into write-combined memory such as a mapped upload buffer.
+Uses non-temporal stores if supported; otherwise, this is equivalent to memcpy.
+*/
+LLGL_EXPORT void CopyToWriteCombinedMemory(void* dst, const void* src, std::size_t size);
+
 
 } // /namespace LLGL
 
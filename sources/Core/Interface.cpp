@@ -27,6 +27,21 @@ void RenderSystemChild::SetDebugName(const char* /*name*/)
     // dummy
 }
 
+bool Resource::SetResidencyPriority(ResidencyPriority /*priority*/)
+{
+    return false; // dummy
+}
+
+bool Resource::Evict()
+{
+    return false; // dummy
+}
+
+bool Resource::MakeResident()
+{
+    return true; // dummy
+}
+
 // Implement bases functions of all sub classes of <Interface> here:
 
 LLGL_IMPLEMENT_INTERFACE( RenderSystem,             Interface         )
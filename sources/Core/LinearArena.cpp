@@ -0,0 +1,164 @@
+/*
+ * LinearArena.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinearArena.h"
+#include <algorithm>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+struct LinearArena::Block
+{
+    std::size_t capacity;
+    Block*      next;
+};
+
+static thread_local LinearArena* g_currentArena;
+
+// Size of the block header rounded up to the maximum fundamental alignment
+static constexpr std::size_t g_blockHeaderSize = (sizeof(std::size_t) + sizeof(void*) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+static char* GetBlockData(void* block)
+{
+    return static_cast<char*>(block) + g_blockHeaderSize;
+}
+
+static std::size_t AlignOffset(std::size_t offset, std::size_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Returns the offset within the specified block that is aligned in terms of its address, since block data is only aligned to std::max_align_t
+static std::size_t AlignBlockOffset(void* block, std::size_t offset, std::size_t alignment)
+{
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(GetBlockData(block)) + offset;
+    return offset + static_cast<std::size_t>(AlignOffset(addr, alignment) - addr);
+}
+
+LinearArena::LinearArena(std::size_t initialBlockSize) :
+    initialBlockSize_ { std::max<std::size_t>(initialBlockSize, 256u) }
+{
+}
+
+LinearArena::~LinearArena()
+{
+    if (g_currentArena == this)
+        g_currentArena = nullptr;
+    FreeBlocks(first_);
+}
+
+void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    /* Try to allocate from current block */
+    if (current_ != nullptr)
+    {
+        const std::size_t alignedOffset = AlignBlockOffset(current_, offset_, alignment);
+        if (alignedOffset + size <= current_->capacity)
+            return AllocateInBlock(current_, alignedOffset, size);
+
+        /* Move on to next block if it has already been allocated in a previous frame */
+        if (Block* next = current_->next)
+        {
+            const std::size_t nextOffset = AlignBlockOffset(next, 0, alignment);
+            if (nextOffset + size <= next->capacity)
+                return AllocateInBlock(next, nextOffset, size);
+        }
+    }
+
+    /* Allocate new block that is at least twice as large as the previous one and fits the allocation with its alignment */
+    const std::size_t prevCapacity  = (current_ != nullptr ? current_->capacity : initialBlockSize_ / 2);
+    const std::size_t alignPadding  = (alignment > alignof(std::max_align_t) ? alignment - 1 : 0);
+    const std::size_t capacity      = std::max(prevCapacity * 2, AlignOffset(size + alignPadding, alignof(std::max_align_t)));
+    Block* block = AllocBlock(capacity);
+
+    if (current_ != nullptr)
+    {
+        /* Insert new block after the current one, so any unused blocks remain reachable */
+        block->next     = current_->next;
+        current_->next  = block;
+    }
+    else
+        first_ = block;
+
+    return AllocateInBlock(block, AlignBlockOffset(block, 0, alignment), size);
+}
+
+void LinearArena::Reset()
+{
+    if (first_ != nullptr && first_->next != nullptr)
+    {
+        /* Consolidate all blocks into a single one that fits the high-water mark */
+        std::size_t capacity = 0;
+        for (Block* block = first_; block != nullptr; block = block->next)
+            capacity += block->capacity;
+        FreeBlocks(first_);
+        first_ = AllocBlock(capacity);
+    }
+    current_    = first_;
+    offset_     = 0;
+    size_       = 0;
+}
+
+LinearArena* LinearArena::BeginFrame()
+{
+    Reset();
+    LinearArena* prevArena = g_currentArena;
+    g_currentArena = this;
+    return prevArena;
+}
+
+void LinearArena::EndFrame(LinearArena* prevArena)
+{
+    if (g_currentArena == this)
+        g_currentArena = prevArena;
+}
+
+LinearArena* LinearArena::GetCurrent()
+{
+    return g_currentArena;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void* LinearArena::AllocateInBlock(Block* block, std::size_t alignedOffset, std::size_t size)
+{
+    current_    = block;
+    offset_     = alignedOffset + size;
+    size_       += size;
+    return GetBlockData(block) + alignedOffset;
+}
+
+LinearArena::Block* LinearArena::AllocBlock(std::size_t capacity)
+{
+    Block* block = static_cast<Block*>(::operator new(g_blockHeaderSize + capacity));
+    block->capacity = capacity;
+    block->next     = nullptr;
+    return block;
+}
+
+void LinearArena::FreeBlocks(Block* first)
+{
+    while (first != nullptr)
+    {
+        Block* next = first->next;
+        ::operator delete(first);
+        first = next;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
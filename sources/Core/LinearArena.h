@@ -0,0 +1,171 @@
+/*
+ * LinearArena.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINEAR_ARENA_H
+#define LLGL_LINEAR_ARENA_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <cstddef>
+#include <new>
+
+
+namespace LLGL
+{
+
+
+/*
+Linear memory arena for transient allocations, e.g. temporary containers while a command buffer is encoded.
+Allocations only move a pointer forward and memory is not released until the arena is reset.
+Each backend command buffer owns one arena, which is reset and made current on Begin() and released on End().
+*/
+class LLGL_EXPORT LinearArena final : public NonCopyable
+{
+
+    public:
+
+        // Default size (in bytes) of the first memory block.
+        static constexpr std::size_t defaultBlockSize = 16u * 1024u;
+
+    public:
+
+        LinearArena(std::size_t initialBlockSize = defaultBlockSize);
+        ~LinearArena();
+
+        // Allocates the specified number of bytes with the specified alignment, which must be a power of two. Never returns null.
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /*
+        Invalidates all previous allocations. If the previous allocations spanned multiple memory blocks,
+        they are replaced by a single block that fits the high-water mark, so the next frame does not allocate any more memory.
+        */
+        void Reset();
+
+        // Returns the total number of bytes that have been allocated since the last reset.
+        inline std::size_t GetSize() const
+        {
+            return size_;
+        }
+
+    public:
+
+        // Resets this arena and makes it the current arena of the calling thread. Returns the previous arena.
+        LinearArena* BeginFrame();
+
+        // Restores the specified previous arena as the current arena of the calling thread, if this is still the current arena.
+        void EndFrame(LinearArena* prevArena = nullptr);
+
+        // Returns the current arena of the calling thread or null if there is none.
+        static LinearArena* GetCurrent();
+
+    private:
+
+        struct Block;
+
+        // Makes the specified block current and allocates the specified number of bytes at the aligned offset.
+        void* AllocateInBlock(Block* block, std::size_t alignedOffset, std::size_t size);
+
+        Block* AllocBlock(std::size_t capacity);
+        void FreeBlocks(Block* first);
+
+    private:
+
+        Block*      first_              = nullptr;
+        Block*      current_            = nullptr;
+        std::size_t offset_             = 0;    // Offset within the current block
+        std::size_t size_               = 0;    // Sum of all allocations since the last reset
+        std::size_t initialBlockSize_   = defaultBlockSize;
+
+};
+
+/*
+Stateless allocator compatible with std::allocator that allocates from the current LinearArena of the calling thread.
+If the calling thread has no current arena, memory is allocated from the heap.
+Each allocation is tagged, so deallocation is safe even if the current arena has changed in between.
+Memory from an arena remains valid only until that arena is reset, so containers with this allocator must not outlive the encoding of the command buffer.
+*/
+template <typename T>
+class ArenaAllocator
+{
+
+    public:
+
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = ArenaAllocator<U>;
+        };
+
+    public:
+
+        ArenaAllocator() = default;
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>&)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            const std::size_t size = headerSize + sizeof(T) * n;
+            char* data = nullptr;
+            if (LinearArena* arena = LinearArena::GetCurrent())
+            {
+                data = static_cast<char*>(arena->Allocate(size, alignof(std::max_align_t)));
+                *reinterpret_cast<std::size_t*>(data) = arenaTag;
+            }
+            else
+            {
+                data = static_cast<char*>(::operator new(size));
+                *reinterpret_cast<std::size_t*>(data) = heapTag;
+            }
+            return reinterpret_cast<T*>(data + headerSize);
+        }
+
+        void deallocate(T* p, std::size_t /*n*/)
+        {
+            if (p != nullptr)
+            {
+                /* Arena memory is released when the arena is reset; only heap memory must be freed */
+                char* data = reinterpret_cast<char*>(p) - headerSize;
+                if (*reinterpret_cast<const std::size_t*>(data) == heapTag)
+                    ::operator delete(data);
+            }
+        }
+
+        template <typename U>
+        bool operator == (const ArenaAllocator<U>&) const
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator != (const ArenaAllocator<U>&) const
+        {
+            return false;
+        }
+
+    private:
+
+        static constexpr std::size_t headerSize = alignof(std::max_align_t);
+        static constexpr std::size_t heapTag    = 0;
+        static constexpr std::size_t arenaTag   = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,9 @@
 #include "../Renderer/ContainerTypes.h"
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <memory>
 #include <string>
 #include <stdio.h>
 #include <stdarg.h>
@@ -55,7 +58,7 @@ using LogListenerPtr = std::unique_ptr<LogListener>;
 struct LogState
 {
     std::mutex                              lock;
-    UnorderedUniquePtrVector<LogListener>   listeners;
+    SlotObjectContainer<LogListener>        listeners;
     LogListenerPtr                          listenerStd;
 };
 
@@ -88,9 +91,6 @@ class TrivialLock
 static LogState                 g_logState;
 static thread_local TrivialLock g_logRecursionLock;
 
-
-/* ----- Functions ----- */
-
 static void PostReport(ReportType type, const char* text)
 {
     std::lock_guard<std::mutex> guard{ g_logState.lock };
@@ -102,14 +102,294 @@ static void PostReport(ReportType type, const char* text)
         listener->Invoke(type, text);
 }
 
+
+/* ----- Asynchronous dispatching ----- */
+
+struct LogMessageSlot
+{
+    std::atomic<std::uint64_t>  sequence { 0 };
+    ReportType                  type        = ReportType::Default;
+    std::string                 text;
+};
+
+/*
+Bounded multi-producer/single-consumer ring buffer of log messages.
+Producers claim a slot by incrementing the enqueue position and publish it by updating the slot's sequence number,
+so writing a message never takes a lock. A single background thread dispatches the messages in order.
+*/
+class LogAsyncQueue
+{
+
+    public:
+
+        static constexpr std::uint64_t capacity = 1024;
+
+    public:
+
+        ~LogAsyncQueue()
+        {
+            Stop();
+        }
+
+        // Starts the background thread. Has no effect if it is already running.
+        void Start()
+        {
+            std::lock_guard<std::mutex> guard{ controlLock_ };
+            if (!thread_.joinable())
+            {
+                if (!slots_)
+                {
+                    slots_ = std::unique_ptr<LogMessageSlot[]>(new LogMessageSlot[capacity]);
+                    for (std::uint64_t i = 0; i < capacity; ++i)
+                        slots_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+                quit_           = false;
+                consumerExited_ = false;
+                thread_ = std::thread{ &LogAsyncQueue::Run, this };
+                running_.store(true);
+            }
+        }
+
+        // Stops the background thread after all pending messages have been dispatched.
+        void Stop()
+        {
+            std::lock_guard<std::mutex> guard{ controlLock_ };
+            if (thread_.joinable())
+            {
+                running_.store(false);
+                {
+                    std::lock_guard<std::mutex> waitGuard{ waitLock_ };
+                    quit_ = true;
+                }
+                messageAvailable_.notify_one();
+                thread_.join();
+
+                /* Wait for producers that have passed the running check in Push before it was reset */
+                while (numActiveProducers_.load() > 0)
+                    std::this_thread::yield();
+
+                /* Dispatch messages that were written while the background thread was shutting down */
+                std::lock_guard<TrivialLock> recursionGuard{ g_logRecursionLock };
+                DispatchPending();
+            }
+        }
+
+        // Returns true if messages are dispatched asynchronously.
+        inline bool IsRunning() const
+        {
+            return running_.load(std::memory_order_acquire);
+        }
+
+        /*
+        Writes a message into the ring buffer and returns its ticket for Flush in 'outTicket'. Waits for a free slot if the ring buffer is full.
+        Returns false if the queue has been stopped, in which case the caller must dispatch the message synchronously.
+        */
+        bool Push(ReportType type, const std::string& text, std::uint64_t& outTicket)
+        {
+            /* Announce this producer before re-checking the running state, so Stop either waits for this message or this thread sees the queue stopped */
+            numActiveProducers_.fetch_add(1);
+            if (!running_.load())
+            {
+                numActiveProducers_.fetch_sub(1);
+                return false;
+            }
+
+            std::uint64_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                LogMessageSlot& slot = slots_[pos % capacity];
+                const std::uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+                const std::int64_t diff = static_cast<std::int64_t>(seq - pos);
+                if (diff == 0)
+                {
+                    /* Try to claim this slot */
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.type = type;
+                        slot.text.assign(text);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    /* Ring buffer is full and the background thread might already have exited, so don't wait for a free slot after Stop */
+                    if (!running_.load())
+                    {
+                        numActiveProducers_.fetch_sub(1);
+                        return false;
+                    }
+
+                    /* Wake up consumer and wait for a free slot */
+                    WakeConsumer();
+                    std::this_thread::yield();
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+                else
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+            numActiveProducers_.fetch_sub(1);
+            WakeConsumer();
+            outTicket = pos + 1;
+            return true;
+        }
+
+        // Blocks until all messages up to the specified ticket have been dispatched.
+        void Flush(std::uint64_t ticket)
+        {
+            if (std::this_thread::get_id() == threadID_.load())
+                return;
+
+            numFlushWaiters_.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock{ waitLock_ };
+                messageAvailable_.notify_one();
+                messagesDispatched_.wait(
+                    lock,
+                    [this, ticket]() -> bool
+                    {
+                        return (dispatchPos_.load() >= ticket || consumerExited_);
+                    }
+                );
+            }
+            numFlushWaiters_.fetch_sub(1);
+        }
+
+        // Blocks until all messages that have been written so far are dispatched.
+        void FlushAll()
+        {
+            Flush(enqueuePos_.load());
+        }
+
+    private:
+
+        void WakeConsumer()
+        {
+            /* Pairs with the fence in Run, so either the consumer sees the new message or this thread sees the consumer waiting */
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (consumerWaiting_.load())
+            {
+                std::lock_guard<std::mutex> guard{ waitLock_ };
+                messageAvailable_.notify_one();
+            }
+        }
+
+        // Dispatches all messages that have been published. Returns false if the ring buffer was empty.
+        bool DispatchPending()
+        {
+            bool dispatched = false;
+            for (;;)
+            {
+                const std::uint64_t pos = dispatchPos_.load(std::memory_order_relaxed);
+                LogMessageSlot& slot = slots_[pos % capacity];
+                if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+                    break;
+
+                PostReport(slot.type, slot.text.c_str());
+
+                /* Keep the string's capacity, so the slot can be reused without allocation */
+                slot.text.clear();
+                slot.sequence.store(pos + capacity, std::memory_order_release);
+                dispatchPos_.store(pos + 1);
+                dispatched = true;
+            }
+
+            /* Notify threads that wait for their messages to be dispatched */
+            if (dispatched && numFlushWaiters_.load() > 0)
+            {
+                std::lock_guard<std::mutex> guard{ waitLock_ };
+                messagesDispatched_.notify_all();
+            }
+
+            return dispatched;
+        }
+
+        void Run()
+        {
+            threadID_.store(std::this_thread::get_id());
+
+            /* Don't let callbacks generate new log messages on this thread */
+            std::lock_guard<TrivialLock> recursionGuard{ g_logRecursionLock };
+
+            for (;;)
+            {
+                if (DispatchPending())
+                    continue;
+
+                std::unique_lock<std::mutex> lock{ waitLock_ };
+
+                /* Re-check for messages after announcing that this thread is about to wait, so no wake-up is lost */
+                consumerWaiting_.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const bool hasPendingMessage = (slots_[dispatchPos_.load() % capacity].sequence.load(std::memory_order_acquire) == dispatchPos_.load() + 1);
+                if (!hasPendingMessage)
+                {
+                    if (quit_)
+                    {
+                        consumerWaiting_.store(false);
+                        break;
+                    }
+                    messageAvailable_.wait(lock);
+                }
+                consumerWaiting_.store(false);
+            }
+
+            /* Release threads that are still waiting for their messages */
+            threadID_.store(std::thread::id{});
+            std::lock_guard<std::mutex> guard{ waitLock_ };
+            consumerExited_ = true;
+            messagesDispatched_.notify_all();
+        }
+
+    private:
+
+        std::unique_ptr<LogMessageSlot[]>   slots_;
+        std::atomic<std::uint64_t>          enqueuePos_         { 0 };
+        std::atomic<std::uint64_t>          dispatchPos_        { 0 };
+
+        std::atomic<bool>                   running_            { false };
+        std::atomic<bool>                   consumerWaiting_    { false };
+        std::atomic<std::uint32_t>          numFlushWaiters_    { 0 };
+        std::atomic<std::uint32_t>          numActiveProducers_ { 0 };
+        std::atomic<std::thread::id>        threadID_;
+
+        std::mutex                          controlLock_;           // Synchronizes Start and Stop
+        std::mutex                          waitLock_;
+        std::condition_variable             messageAvailable_;
+        std::condition_variable             messagesDispatched_;
+        bool                                quit_               = false;    // Guarded by waitLock_
+        bool                                consumerExited_     = false;    // Guarded by waitLock_
+        std::thread                         thread_;
+
+};
+
+// Must be declared after g_logState, so the background thread is stopped before the log listeners are destroyed.
+static LogAsyncQueue g_logAsyncQueue;
+
+static void PostOrQueueReport(ReportType type, const std::string& text)
+{
+    std::uint64_t ticket = 0;
+    if (g_logAsyncQueue.IsRunning() && g_logAsyncQueue.Push(type, text, ticket))
+    {
+        if (type == ReportType::Error)
+            g_logAsyncQueue.Flush(ticket);
+    }
+    else
+        PostReport(type, text.c_str());
+}
+
+
+/* ----- Functions ----- */
+
 LLGL_EXPORT void Printf(const char* format, ...)
 {
     if (!g_logRecursionLock)
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        thread_local std::string str;
+        str.clear();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Default, str.c_str());
+        PostOrQueueReport(ReportType::Default, str);
     }
 }
 
@@ -118,9 +398,10 @@ LLGL_EXPORT void Errorf(const char* format, ...)
     if (!g_logRecursionLock)
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        thread_local std::string str;
+        str.clear();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Error, str.c_str());
+        PostOrQueueReport(ReportType::Error, str);
     }
 }
 
@@ -187,6 +468,23 @@ LLGL_EXPORT void UnregisterCallback(LogHandle handle)
     }
 }
 
+LLGL_EXPORT void SetAsyncMode(bool enable)
+{
+    if (!g_logRecursionLock)
+    {
+        if (enable)
+            g_logAsyncQueue.Start();
+        else
+            g_logAsyncQueue.Stop();
+    }
+}
+
+LLGL_EXPORT void Flush()
+{
+    if (!g_logRecursionLock && g_logAsyncQueue.IsRunning())
+        g_logAsyncQueue.FlushAll();
+}
+
 
 } // /namespace Log
 
@@ -0,0 +1,433 @@
+/*
+ * MeshOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/MeshOptimizer.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/DynamicArray.h>
+#include "Threading.h"
+#include "CoreUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static constexpr std::uint32_t g_invalidIndex          = ~0u;
+static constexpr std::uint32_t g_maxCacheSize          = 64;
+static constexpr std::uint32_t g_maxMeshletVertices    = 256;
+static constexpr std::uint32_t g_maxMeshletTriangles   = 256;
+
+
+/* ----- Vertex cache optimization ----- */
+
+// Returns the score of a vertex with the specified position in the LRU cache (or -1 if not cached) and number of remaining triangles.
+static float GetVertexCacheScore(int cachePos, std::uint32_t numRemainingTriangles, std::uint32_t cacheSize)
+{
+    if (numRemainingTriangles == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePos >= 0)
+    {
+        /* Vertices of the last triangle get a fixed score, so the next triangle does not prefer reusing all three of them */
+        if (cachePos < 3)
+            score = 0.75f;
+        else
+            score = std::pow(1.0f - static_cast<float>(cachePos - 3) / static_cast<float>(cacheSize - 3), 1.5f);
+    }
+
+    /* Boost vertices with few remaining triangles to avoid leaving isolated triangles behind */
+    score += 2.0f / std::sqrt(static_cast<float>(numRemainingTriangles));
+
+    return score;
+}
+
+LLGL_EXPORT void OptimizeVertexCache(std::uint32_t* indices, std::size_t numIndices, std::size_t numVertices, std::uint32_t cacheSize)
+{
+    const std::size_t numTriangles = numIndices / 3;
+    if (indices == nullptr || numTriangles == 0 || numVertices == 0)
+        return;
+
+    cacheSize = Clamp(cacheSize, 4u, g_maxCacheSize);
+
+    /* Build vertex-to-triangle adjacency */
+    std::vector<std::uint32_t> numRemainingTriangles(numVertices, 0);
+    for_range(i, numTriangles * 3)
+        numRemainingTriangles[indices[i]]++;
+
+    std::vector<std::uint32_t> adjacencyOffsets(numVertices + 1, 0);
+    for_range(i, numVertices)
+        adjacencyOffsets[i + 1] = adjacencyOffsets[i] + numRemainingTriangles[i];
+
+    std::vector<std::uint32_t> adjacency(numTriangles * 3);
+    {
+        std::vector<std::uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for_range(i, numTriangles * 3)
+            adjacency[adjacencyFill[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+    }
+
+    /* Compute initial vertex and triangle scores */
+    std::vector<int> cachePositions(numVertices, -1);
+    std::vector<float> vertexScores(numVertices);
+    for_range(i, numVertices)
+        vertexScores[i] = GetVertexCacheScore(-1, numRemainingTriangles[i], cacheSize);
+
+    std::vector<float> triangleScores(numTriangles);
+    std::vector<bool> trianglesEmitted(numTriangles, false);
+    for_range(i, numTriangles)
+    {
+        const std::uint32_t* tri = &indices[i * 3];
+        triangleScores[i] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+    }
+
+    std::uint32_t bestTriangle = static_cast<std::uint32_t>(std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+    std::uint32_t scanCursor = 0;
+
+    std::vector<std::uint32_t> output(numTriangles * 3);
+    std::uint32_t cache[g_maxCacheSize + 3];
+    std::uint32_t newCache[g_maxCacheSize + 3];
+    std::uint32_t cacheCount = 0;
+
+    for_range(outputTriangle, numTriangles)
+    {
+        /* Fall back to the next triangle in input order if no cached vertex has remaining triangles */
+        if (bestTriangle == g_invalidIndex)
+        {
+            while (trianglesEmitted[scanCursor])
+                ++scanCursor;
+            bestTriangle = scanCursor;
+        }
+
+        /* Emit triangle and remove it from the adjacency of its vertices */
+        const std::uint32_t* tri = &indices[static_cast<std::size_t>(bestTriangle) * 3];
+        std::uint32_t newCacheCount = 0;
+
+        for_range(i, 3u)
+        {
+            const std::uint32_t vertex = tri[i];
+            output[outputTriangle * 3 + i] = vertex;
+
+            std::uint32_t* vertexAdjacency = &adjacency[adjacencyOffsets[vertex]];
+            std::uint32_t& numAdjacent = numRemainingTriangles[vertex];
+            for_range(j, numAdjacent)
+            {
+                if (vertexAdjacency[j] == bestTriangle)
+                {
+                    vertexAdjacency[j] = vertexAdjacency[numAdjacent - 1];
+                    --numAdjacent;
+                    break;
+                }
+            }
+
+            /* Degenerate triangles reference the same vertex more than once */
+            if (std::find(newCache, newCache + newCacheCount, vertex) == newCache + newCacheCount)
+                newCache[newCacheCount++] = vertex;
+        }
+
+        trianglesEmitted[bestTriangle] = true;
+        triangleScores[bestTriangle] = -1.0f;
+
+        /* Move the vertices of the emitted triangle to the front of the LRU cache */
+        for_range(i, cacheCount)
+        {
+            const std::uint32_t vertex = cache[i];
+            if (vertex != tri[0] && vertex != tri[1] && vertex != tri[2])
+                newCache[newCacheCount++] = vertex;
+        }
+
+        /* Update scores of all vertices that have been touched, including the ones that have just been evicted */
+        for_range(i, newCacheCount)
+        {
+            const std::uint32_t vertex = newCache[i];
+            cachePositions[vertex] = (i < cacheSize ? static_cast<int>(i) : -1);
+
+            const float newScore = GetVertexCacheScore(cachePositions[vertex], numRemainingTriangles[vertex], cacheSize);
+            const float scoreDelta = newScore - vertexScores[vertex];
+            vertexScores[vertex] = newScore;
+
+            const std::uint32_t* vertexAdjacency = &adjacency[adjacencyOffsets[vertex]];
+            for_range(j, numRemainingTriangles[vertex])
+                triangleScores[vertexAdjacency[j]] += scoreDelta;
+        }
+
+        cacheCount = std::min(newCacheCount, cacheSize);
+        std::copy(newCache, newCache + cacheCount, cache);
+
+        /* Select the next triangle among the ones that are adjacent to the cached vertices */
+        bestTriangle = g_invalidIndex;
+        float bestScore = -1.0f;
+        for_range(i, cacheCount)
+        {
+            const std::uint32_t vertex = cache[i];
+            const std::uint32_t* vertexAdjacency = &adjacency[adjacencyOffsets[vertex]];
+            for_range(j, numRemainingTriangles[vertex])
+            {
+                const std::uint32_t triangle = vertexAdjacency[j];
+                if (triangleScores[triangle] > bestScore)
+                {
+                    bestTriangle    = triangle;
+                    bestScore       = triangleScores[triangle];
+                }
+            }
+        }
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+
+/* ----- Vertex fetch optimization ----- */
+
+LLGL_EXPORT std::size_t OptimizeVertexFetch(void* vertices, std::size_t numVertices, std::uint32_t vertexStride, std::uint32_t* indices, std::size_t numIndices)
+{
+    if (vertices == nullptr || numVertices == 0 || vertexStride == 0)
+        return numVertices;
+
+    /* Assign new vertex indices in the order of their first reference */
+    std::vector<std::uint32_t> remap(numVertices, g_invalidIndex);
+    std::uint32_t numReferencedVertices = 0;
+
+    for_range(i, numIndices)
+    {
+        std::uint32_t& newIndex = remap[indices[i]];
+        if (newIndex == g_invalidIndex)
+            newIndex = numReferencedVertices++;
+        indices[i] = newIndex;
+    }
+
+    /* Move unreferenced vertices to the end */
+    std::uint32_t nextUnreferencedVertex = numReferencedVertices;
+    for (std::uint32_t& newIndex : remap)
+    {
+        if (newIndex == g_invalidIndex)
+            newIndex = nextUnreferencedVertex++;
+    }
+
+    /* Permute vertex data */
+    const std::size_t vertexDataSize = numVertices * vertexStride;
+    DynamicByteArray oldVertices{ vertexDataSize, UninitializeTag{} };
+    std::memcpy(oldVertices.get(), vertices, vertexDataSize);
+
+    char* dst = static_cast<char*>(vertices);
+    for_range(i, numVertices)
+        std::memcpy(dst + static_cast<std::size_t>(remap[i]) * vertexStride, oldVertices.get() + i * vertexStride, vertexStride);
+
+    return numReferencedVertices;
+}
+
+
+/* ----- Meshlet generation ----- */
+
+static void ReadVertexPosition(const MeshOptimizerMesh& mesh, std::uint32_t vertex, float (&outPosition)[3])
+{
+    const char* src = static_cast<const char*>(mesh.vertices) + static_cast<std::size_t>(vertex) * mesh.vertexStride + mesh.positionOffset;
+    std::memcpy(outPosition, src, sizeof(outPosition));
+}
+
+static void ComputeMeshletBounds(const MeshOptimizerMesh& mesh, Meshlet& meshlet)
+{
+    const std::uint32_t* meshletVertices = &mesh.meshletVertices[meshlet.vertexOffset];
+
+    /* Compute bounding sphere around the center of the bounding box */
+    float minPos[3], maxPos[3];
+    ReadVertexPosition(mesh, meshletVertices[0], minPos);
+    std::copy(minPos, minPos + 3, maxPos);
+
+    for_range(i, meshlet.numVertices)
+    {
+        float pos[3];
+        ReadVertexPosition(mesh, meshletVertices[i], pos);
+        for_range(j, 3)
+        {
+            minPos[j] = std::min(minPos[j], pos[j]);
+            maxPos[j] = std::max(maxPos[j], pos[j]);
+        }
+    }
+
+    float center[3];
+    for_range(i, 3)
+        center[i] = (minPos[i] + maxPos[i]) * 0.5f;
+
+    float radiusSq = 0.0f;
+    for_range(i, meshlet.numVertices)
+    {
+        float pos[3];
+        ReadVertexPosition(mesh, meshletVertices[i], pos);
+        const float d[3] = { pos[0] - center[0], pos[1] - center[1], pos[2] - center[2] };
+        radiusSq = std::max(radiusSq, d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+    }
+
+    meshlet.boundingSphere[0] = center[0];
+    meshlet.boundingSphere[1] = center[1];
+    meshlet.boundingSphere[2] = center[2];
+    meshlet.boundingSphere[3] = std::sqrt(radiusSq);
+
+    /* Compute normal cone from the normalized triangle normals */
+    float normals[g_maxMeshletTriangles][3];
+    std::uint32_t numNormals = 0;
+    float axis[3] = { 0.0f, 0.0f, 0.0f };
+
+    const std::uint8_t* meshletTriangles = &mesh.meshletTriangles[meshlet.triangleOffset];
+    for_range(i, meshlet.numTriangles)
+    {
+        float p0[3], p1[3], p2[3];
+        ReadVertexPosition(mesh, meshletVertices[meshletTriangles[i * 3    ]], p0);
+        ReadVertexPosition(mesh, meshletVertices[meshletTriangles[i * 3 + 1]], p1);
+        ReadVertexPosition(mesh, meshletVertices[meshletTriangles[i * 3 + 2]], p2);
+
+        const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+
+        float* normal = normals[numNormals];
+        normal[0] = e1[1]*e2[2] - e1[2]*e2[1];
+        normal[1] = e1[2]*e2[0] - e1[0]*e2[2];
+        normal[2] = e1[0]*e2[1] - e1[1]*e2[0];
+
+        /* Skip degenerate triangles */
+        const float length = std::sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+        if (length == 0.0f)
+            continue;
+
+        for_range(j, 3)
+        {
+            normal[j] /= length;
+            axis[j] += normal[j];
+        }
+        ++numNormals;
+    }
+
+    const float axisLength = std::sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+    if (numNormals == 0 || axisLength == 0.0f)
+        return;
+
+    for_range(i, 3)
+        meshlet.coneAxis[i] = axis[i] / axisLength;
+
+    float minDot = 1.0f;
+    for_range(i, numNormals)
+    {
+        const float* normal = normals[i];
+        minDot = std::min(minDot, normal[0]*meshlet.coneAxis[0] + normal[1]*meshlet.coneAxis[1] + normal[2]*meshlet.coneAxis[2]);
+    }
+
+    /* Cones with an aperture of almost 180 degrees or more cannot be culled */
+    meshlet.coneCutoff = (minDot > 0.1f ? std::sqrt(1.0f - minDot*minDot) : 1.0f);
+}
+
+LLGL_EXPORT void BuildMeshlets(MeshOptimizerMesh& mesh, std::uint32_t maxVertices, std::uint32_t maxTriangles)
+{
+    mesh.meshlets.clear();
+    mesh.meshletVertices.clear();
+    mesh.meshletTriangles.clear();
+
+    const std::size_t numTriangles = mesh.numIndices / 3;
+    if (mesh.indices == nullptr || numTriangles == 0 || mesh.numVertices == 0)
+        return;
+
+    maxVertices     = Clamp(maxVertices, 3u, g_maxMeshletVertices);
+    maxTriangles    = Clamp(maxTriangles, 1u, g_maxMeshletTriangles);
+
+    mesh.meshletVertices.reserve(mesh.numIndices);
+    mesh.meshletTriangles.reserve(mesh.numIndices);
+
+    /* Local vertex index of each mesh vertex within the current meshlet */
+    std::vector<std::uint32_t> localIndices(mesh.numVertices, g_invalidIndex);
+
+    Meshlet meshlet;
+
+    auto FlushMeshlet = [&mesh, &meshlet, &localIndices]()
+    {
+        if (meshlet.numTriangles == 0)
+            return;
+
+        if (mesh.vertices != nullptr)
+            ComputeMeshletBounds(mesh, meshlet);
+
+        for_range(i, meshlet.numVertices)
+            localIndices[mesh.meshletVertices[meshlet.vertexOffset + i]] = g_invalidIndex;
+
+        mesh.meshlets.push_back(meshlet);
+
+        meshlet = Meshlet{};
+        meshlet.vertexOffset    = static_cast<std::uint32_t>(mesh.meshletVertices.size());
+        meshlet.triangleOffset  = static_cast<std::uint32_t>(mesh.meshletTriangles.size());
+    };
+
+    for_range(i, numTriangles)
+    {
+        const std::uint32_t* tri = &mesh.indices[i * 3];
+
+        /* Start a new meshlet if the triangle does not fit into the current one */
+        const std::uint32_t numNewVertices =
+        (
+            (localIndices[tri[0]] == g_invalidIndex ? 1u : 0u) +
+            (localIndices[tri[1]] == g_invalidIndex && tri[1] != tri[0] ? 1u : 0u) +
+            (localIndices[tri[2]] == g_invalidIndex && tri[2] != tri[0] && tri[2] != tri[1] ? 1u : 0u)
+        );
+
+        if (meshlet.numVertices + numNewVertices > maxVertices || meshlet.numTriangles + 1 > maxTriangles)
+            FlushMeshlet();
+
+        for_range(j, 3u)
+        {
+            std::uint32_t& localIndex = localIndices[tri[j]];
+            if (localIndex == g_invalidIndex)
+            {
+                localIndex = meshlet.numVertices++;
+                mesh.meshletVertices.push_back(tri[j]);
+            }
+            mesh.meshletTriangles.push_back(static_cast<std::uint8_t>(localIndex));
+        }
+
+        ++meshlet.numTriangles;
+    }
+
+    FlushMeshlet();
+}
+
+
+/* ----- Batch optimization ----- */
+
+static void OptimizeMesh(MeshOptimizerMesh& mesh, const MeshOptimizerDescriptor& desc)
+{
+    if ((desc.flags & MeshOptimizerFlags::VertexCache) != 0)
+        OptimizeVertexCache(mesh.indices, mesh.numIndices, mesh.numVertices, desc.cacheSize);
+
+    if ((desc.flags & MeshOptimizerFlags::VertexFetch) != 0)
+        mesh.numVertices = OptimizeVertexFetch(mesh.vertices, mesh.numVertices, mesh.vertexStride, mesh.indices, mesh.numIndices);
+
+    if ((desc.flags & MeshOptimizerFlags::Meshlets) != 0)
+        BuildMeshlets(mesh, desc.maxMeshletVertices, desc.maxMeshletTriangles);
+}
+
+LLGL_EXPORT void OptimizeMeshes(MeshOptimizerMesh* meshes, std::size_t numMeshes, const MeshOptimizerDescriptor& desc, unsigned threadCount)
+{
+    if (meshes == nullptr || numMeshes == 0)
+        return;
+
+    /* Meshes can differ greatly in size, so distribute them one at a time */
+    ParallelFor(
+        [meshes, &desc](std::size_t i)
+        {
+            OptimizeMesh(meshes[i], desc);
+        },
+        numMeshes,
+        threadCount,
+        1,
+        ParallelForPartition::Guided
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,493 @@
+/*
+ * MipChainGenerator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MipChainGenerator.h"
+#include "Threading.h"
+#include <LLGL/TextureFlags.h>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <string.h>
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_MIP_CHAIN_SSE2
+#   include <emmintrin.h>
+#elif (defined __ARM_NEON && defined __aarch64__) || defined _M_ARM64
+#   define LLGL_MIP_CHAIN_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- RGBA vector operations ----- */
+
+#if defined LLGL_MIP_CHAIN_SSE2
+
+using Float4 = __m128;
+
+static inline Float4 Float4Zero()                                   { return _mm_setzero_ps(); }
+static inline Float4 Float4Load(const float* src)                   { return _mm_loadu_ps(src); }
+static inline void Float4Store(float* dst, Float4 v)                { _mm_storeu_ps(dst, v); }
+static inline Float4 Float4MulAdd(Float4 acc, Float4 v, float w)    { return _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(w))); }
+
+#elif defined LLGL_MIP_CHAIN_NEON
+
+using Float4 = float32x4_t;
+
+static inline Float4 Float4Zero()                                   { return vdupq_n_f32(0.0f); }
+static inline Float4 Float4Load(const float* src)                   { return vld1q_f32(src); }
+static inline void Float4Store(float* dst, Float4 v)                { vst1q_f32(dst, v); }
+static inline Float4 Float4MulAdd(Float4 acc, Float4 v, float w)    { return vmlaq_n_f32(acc, v, w); }
+
+#else
+
+struct Float4
+{
+    float v[4];
+};
+
+static inline Float4 Float4Zero()
+{
+    return Float4{ { 0.0f, 0.0f, 0.0f, 0.0f } };
+}
+
+static inline Float4 Float4Load(const float* src)
+{
+    return Float4{ { src[0], src[1], src[2], src[3] } };
+}
+
+static inline void Float4Store(float* dst, Float4 v)
+{
+    dst[0] = v.v[0];
+    dst[1] = v.v[1];
+    dst[2] = v.v[2];
+    dst[3] = v.v[3];
+}
+
+static inline Float4 Float4MulAdd(Float4 acc, Float4 v, float w)
+{
+    return Float4{ { acc.v[0] + v.v[0]*w, acc.v[1] + v.v[1]*w, acc.v[2] + v.v[2]*w, acc.v[3] + v.v[3]*w } };
+}
+
+#endif
+
+
+/* ----- Filter kernels ----- */
+
+static const double g_pi            = 3.14159265358979323846;
+static const double g_kaiserWidth   = 3.0; // Filter radius in destination pixels
+static const double g_kaiserAlpha   = 4.0;
+
+// Zero-order modified Bessel function of the first kind
+static double BesselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    const double halfX = x * 0.5;
+    for (int i = 1; i < 64 && term > sum * 1.0e-12; ++i)
+    {
+        const double t = halfX / i;
+        term *= t * t;
+        sum += term;
+    }
+    return sum;
+}
+
+static double Sinc(double x)
+{
+    if (std::abs(x) < 1.0e-6)
+        return 1.0;
+    x *= g_pi;
+    return std::sin(x) / x;
+}
+
+static double KaiserWindowedSinc(double x)
+{
+    const double r = x / g_kaiserWidth;
+    if (r <= -1.0 || r >= 1.0)
+        return 0.0;
+    return Sinc(x) * BesselI0(g_kaiserAlpha * std::sqrt(1.0 - r*r)) / BesselI0(g_kaiserAlpha);
+}
+
+struct FilterTap
+{
+    std::uint32_t   index;
+    float           weight;
+};
+
+// Filter taps for all destination pixels along one dimension; taps of pixel i are in range [offsets[i], offsets[i+1]).
+struct FilterTaps
+{
+    std::vector<std::uint32_t>  offsets;
+    std::vector<FilterTap>      taps;
+};
+
+static void BuildFilterTaps(FilterTaps& outTaps, std::uint32_t srcSize, std::uint32_t dstSize, ImageFilter filter)
+{
+    outTaps.offsets.clear();
+    outTaps.taps.clear();
+    outTaps.offsets.reserve(dstSize + 1);
+
+    const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+    for (std::uint32_t i = 0; i < dstSize; ++i)
+    {
+        const std::size_t first = outTaps.taps.size();
+        outTaps.offsets.push_back(static_cast<std::uint32_t>(first));
+
+        double weightSum = 0.0;
+
+        if (filter == ImageFilter::Kaiser)
+        {
+            /* Sample windowed sinc around pixel center; out-of-bounds taps are clamped to the edge */
+            const double center = (i + 0.5) * scale;
+            const double radius = g_kaiserWidth * scale;
+            const std::int64_t begin = static_cast<std::int64_t>(std::floor(center - radius));
+            const std::int64_t end = static_cast<std::int64_t>(std::ceil(center + radius));
+            for (std::int64_t j = begin; j < end; ++j)
+            {
+                const double weight = KaiserWindowedSinc((j + 0.5 - center) / scale);
+                if (weight != 0.0)
+                {
+                    const std::int64_t index = std::max<std::int64_t>(0, std::min<std::int64_t>(j, srcSize - 1));
+                    outTaps.taps.push_back(FilterTap{ static_cast<std::uint32_t>(index), static_cast<float>(weight) });
+                    weightSum += weight;
+                }
+            }
+        }
+        else
+        {
+            /* Weight each source pixel by its coverage of the destination pixel; this also handles odd source sizes */
+            const double lo = i * scale;
+            const double hi = (i + 1) * scale;
+            const std::uint32_t begin = static_cast<std::uint32_t>(std::floor(lo));
+            const std::uint32_t end = std::min(srcSize, static_cast<std::uint32_t>(std::ceil(hi)));
+            for (std::uint32_t j = begin; j < end; ++j)
+            {
+                const double weight = std::min<double>(j + 1, hi) - std::max<double>(j, lo);
+                if (weight > 0.0)
+                {
+                    outTaps.taps.push_back(FilterTap{ j, static_cast<float>(weight) });
+                    weightSum += weight;
+                }
+            }
+        }
+
+        /* Normalize weights */
+        if (weightSum != 0.0)
+        {
+            for (std::size_t j = first; j < outTaps.taps.size(); ++j)
+                outTaps.taps[j].weight = static_cast<float>(outTaps.taps[j].weight / weightSum);
+        }
+    }
+
+    outTaps.offsets.push_back(static_cast<std::uint32_t>(outTaps.taps.size()));
+}
+
+// Filters all rows horizontally from 'srcWidth' to 'dstWidth' pixels.
+static void FilterHorizontal(
+    const float*        src,
+    std::uint32_t       srcWidth,
+    float*              dst,
+    std::uint32_t       dstWidth,
+    std::uint32_t       numRows,
+    const FilterTaps&   taps,
+    unsigned            threadCount)
+{
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t row = begin; row < end; ++row)
+            {
+                const float*    srcRow = src + row * srcWidth * 4;
+                float*          dstRow = dst + row * dstWidth * 4;
+                for (std::uint32_t x = 0; x < dstWidth; ++x)
+                {
+                    Float4 acc = Float4Zero();
+                    for (std::uint32_t i = taps.offsets[x]; i < taps.offsets[x + 1]; ++i)
+                        acc = Float4MulAdd(acc, Float4Load(srcRow + taps.taps[i].index * 4), taps.taps[i].weight);
+                    Float4Store(dstRow + x * 4, acc);
+                }
+            }
+        },
+        numRows,
+        threadCount,
+        4
+    );
+}
+
+// Filters all columns vertically from 'srcHeight' to 'dstHeight' pixels for each array layer.
+static void FilterVertical(
+    const float*        src,
+    std::uint32_t       srcHeight,
+    float*              dst,
+    std::uint32_t       dstHeight,
+    std::uint32_t       width,
+    std::uint32_t       numLayers,
+    const FilterTaps&   taps,
+    unsigned            threadCount)
+{
+    const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t row = begin; row < end; ++row)
+            {
+                /* Accumulate weighted source rows into destination row */
+                const std::size_t   layer   = row / dstHeight;
+                const std::uint32_t y       = static_cast<std::uint32_t>(row % dstHeight);
+                const float*        srcRows = src + layer * srcHeight * rowSize;
+                float*              dstRow  = dst + row * rowSize;
+
+                ::memset(dstRow, 0, rowSize * sizeof(float));
+
+                for (std::uint32_t i = taps.offsets[y]; i < taps.offsets[y + 1]; ++i)
+                {
+                    const float*    srcRow = srcRows + taps.taps[i].index * rowSize;
+                    const float     weight = taps.taps[i].weight;
+                    for (std::size_t x = 0; x < rowSize; x += 4)
+                        Float4Store(dstRow + x, Float4MulAdd(Float4Load(dstRow + x), Float4Load(srcRow + x), weight));
+                }
+            }
+        },
+        static_cast<std::size_t>(dstHeight) * numLayers,
+        threadCount,
+        4
+    );
+}
+
+
+/* ----- Color space and alpha coverage ----- */
+
+static float SRGBToLinear(float c)
+{
+    return (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f));
+}
+
+static float LinearToSRGB(float c)
+{
+    c = std::max(0.0f, c);
+    return (c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+}
+
+static const float g_alphaCoverageRef = 0.5f;
+
+// Returns the ratio of pixels whose alpha component is greater than the specified reference value.
+static float ComputeAlphaCoverage(const float* data, std::size_t numPixels, float alphaRef)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < numPixels; ++i)
+    {
+        if (data[i * 4 + 3] > alphaRef)
+            ++count;
+    }
+    return static_cast<float>(count) / static_cast<float>(numPixels);
+}
+
+// Returns the scale for the alpha components so that the alpha coverage of the specified pixels matches the target coverage.
+static float FindAlphaCoverageScale(const float* data, std::size_t numPixels, float targetCoverage)
+{
+    /*
+    Binary search for the alpha reference value that yields the target coverage.
+    Coverage is a step function of the reference value, so keep the closest match instead of the last midpoint, which can end up on the wrong side of a step.
+    */
+    float lo = 0.0f, hi = 1.0f, alphaRef = g_alphaCoverageRef;
+    float bestAlphaRef = alphaRef, bestError = 2.0f;
+    for (int i = 0; i < 10; ++i)
+    {
+        const float coverage    = ComputeAlphaCoverage(data, numPixels, alphaRef);
+        const float error       = std::abs(coverage - targetCoverage);
+        if (error < bestError)
+        {
+            bestAlphaRef    = alphaRef;
+            bestError       = error;
+        }
+        if (coverage > targetCoverage)
+            lo = alphaRef;
+        else if (coverage < targetCoverage)
+            hi = alphaRef;
+        else
+            break;
+        alphaRef = (lo + hi) * 0.5f;
+    }
+    return g_alphaCoverageRef / std::max(bestAlphaRef, 1.0f / 1024.0f);
+}
+
+
+/* ----- Functions ----- */
+
+void GenerateMipChainRGBA32Float(
+    const float*            baseLevel,
+    const Extent3D&         extent,
+    std::uint32_t           numMipLevels,
+    ImageFilter             filter,
+    long                    flags,
+    bool                    saturate,
+    unsigned                threadCount,
+    const MipLevelCallback& callback)
+{
+    if (baseLevel == nullptr || extent.x == 0 || extent.y == 0 || extent.z == 0)
+        return;
+
+    const std::uint32_t maxNumMipLevels = NumMipLevels(extent.x, extent.y);
+    if (numMipLevels == 0 || numMipLevels > maxNumMipLevels)
+        numMipLevels = maxNumMipLevels;
+
+    const bool          isSRGB          = ((flags & MipChainFlags::SRGB) != 0);
+    const bool          preserveAlpha   = ((flags & MipChainFlags::PreserveAlphaCoverage) != 0);
+    const std::uint32_t numLayers       = extent.z;
+    const std::size_t   basePixels      = static_cast<std::size_t>(extent.x) * extent.y;
+
+    /* Convert base level into linear color space */
+    std::vector<float> linearBaseLevel;
+    if (isSRGB)
+    {
+        linearBaseLevel.resize(basePixels * numLayers * 4);
+        DoConcurrentRange(
+            [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    linearBaseLevel[i*4 + 0] = SRGBToLinear(baseLevel[i*4 + 0]);
+                    linearBaseLevel[i*4 + 1] = SRGBToLinear(baseLevel[i*4 + 1]);
+                    linearBaseLevel[i*4 + 2] = SRGBToLinear(baseLevel[i*4 + 2]);
+                    linearBaseLevel[i*4 + 3] = baseLevel[i*4 + 3];
+                }
+            },
+            basePixels * numLayers,
+            threadCount
+        );
+        baseLevel = linearBaseLevel.data();
+    }
+
+    /* Determine alpha coverage of base level for each array layer */
+    std::vector<float> baseAlphaCoverage;
+    if (preserveAlpha)
+    {
+        baseAlphaCoverage.resize(numLayers);
+        for (std::uint32_t z = 0; z < numLayers; ++z)
+            baseAlphaCoverage[z] = ComputeAlphaCoverage(baseLevel + z * basePixels * 4, basePixels, g_alphaCoverageRef);
+    }
+
+    /* Allocate intermediate buffers; MIP-map level 1 is the largest one to be generated */
+    const std::uint32_t level1Width     = std::max(1u, extent.x / 2);
+    const std::uint32_t level1Height    = std::max(1u, extent.y / 2);
+
+    std::vector<float> levelBuffers[2];
+    std::vector<float> horzBuffer;
+    std::vector<float> outputBuffer;
+
+    if (numMipLevels > 1)
+    {
+        levelBuffers[0].resize(static_cast<std::size_t>(level1Width) * level1Height * numLayers * 4);
+        levelBuffers[1].resize(static_cast<std::size_t>(std::max(1u, level1Width / 2)) * std::max(1u, level1Height / 2) * numLayers * 4);
+        if (level1Width != extent.x && level1Height != extent.y)
+            horzBuffer.resize(static_cast<std::size_t>(level1Width) * extent.y * numLayers * 4);
+        if (isSRGB || preserveAlpha || saturate)
+            outputBuffer.resize(levelBuffers[0].size());
+    }
+
+    FilterTaps tapsX, tapsY;
+
+    const float*    srcLevel    = baseLevel;
+    Extent3D        srcExtent   = extent;
+
+    for (std::uint32_t mipLevel = 1; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const Extent3D      dstExtent{ std::max(1u, srcExtent.x / 2), std::max(1u, srcExtent.y / 2), numLayers };
+        const std::size_t   dstPixels   = static_cast<std::size_t>(dstExtent.x) * dstExtent.y;
+        float*              dstLevel    = levelBuffers[(mipLevel - 1) % 2].data();
+
+        /* Filter previous level with separable filter */
+        if (dstExtent.x != srcExtent.x)
+            BuildFilterTaps(tapsX, srcExtent.x, dstExtent.x, filter);
+        if (dstExtent.y != srcExtent.y)
+            BuildFilterTaps(tapsY, srcExtent.y, dstExtent.y, filter);
+
+        if (dstExtent.y == srcExtent.y)
+            FilterHorizontal(srcLevel, srcExtent.x, dstLevel, dstExtent.x, srcExtent.y * numLayers, tapsX, threadCount);
+        else if (dstExtent.x == srcExtent.x)
+            FilterVertical(srcLevel, srcExtent.y, dstLevel, dstExtent.y, dstExtent.x, numLayers, tapsY, threadCount);
+        else
+        {
+            FilterHorizontal(srcLevel, srcExtent.x, horzBuffer.data(), dstExtent.x, srcExtent.y * numLayers, tapsX, threadCount);
+            FilterVertical(horzBuffer.data(), srcExtent.y, dstLevel, dstExtent.y, dstExtent.x, numLayers, tapsY, threadCount);
+        }
+
+        /* Apply output transformations without modifying the linear level that the next level is filtered from */
+        const float* outputLevel = dstLevel;
+
+        if (!outputBuffer.empty())
+        {
+            std::vector<float> layerAlphaScales;
+            if (preserveAlpha)
+            {
+                layerAlphaScales.resize(numLayers);
+                for (std::uint32_t z = 0; z < numLayers; ++z)
+                    layerAlphaScales[z] = FindAlphaCoverageScale(dstLevel + z * dstPixels * 4, dstPixels, baseAlphaCoverage[z]);
+            }
+
+            float* dst = outputBuffer.data();
+
+            DoConcurrentRange(
+                [&](std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        float r = dstLevel[i*4 + 0];
+                        float g = dstLevel[i*4 + 1];
+                        float b = dstLevel[i*4 + 2];
+                        float a = dstLevel[i*4 + 3];
+
+                        if (preserveAlpha)
+                            a = std::min(1.0f, a * layerAlphaScales[i / dstPixels]);
+
+                        if (isSRGB)
+                        {
+                            r = LinearToSRGB(r);
+                            g = LinearToSRGB(g);
+                            b = LinearToSRGB(b);
+                        }
+
+                        if (saturate)
+                        {
+                            r = std::max(0.0f, std::min(r, 1.0f));
+                            g = std::max(0.0f, std::min(g, 1.0f));
+                            b = std::max(0.0f, std::min(b, 1.0f));
+                            a = std::max(0.0f, std::min(a, 1.0f));
+                        }
+
+                        dst[i*4 + 0] = r;
+                        dst[i*4 + 1] = g;
+                        dst[i*4 + 2] = b;
+                        dst[i*4 + 3] = a;
+                    }
+                },
+                dstPixels * numLayers,
+                threadCount
+            );
+
+            outputLevel = dst;
+        }
+
+        callback(mipLevel, dstExtent, outputLevel, dstPixels * numLayers * 4 * sizeof(float));
+
+        /* Continue with next level */
+        srcLevel    = dstLevel;
+        srcExtent   = dstExtent;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
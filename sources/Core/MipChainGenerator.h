@@ -0,0 +1,49 @@
+/*
+ * MipChainGenerator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MIP_CHAIN_GENERATOR_H
+#define LLGL_MIP_CHAIN_GENERATOR_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Types.h>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Callback to receive a generated MIP-map level in RGBA Float32 format. The data is only valid during the callback.
+using MipLevelCallback = std::function<void(std::uint32_t mipLevel, const Extent3D& extent, const float* data, std::size_t dataSize)>;
+
+/*
+Generates MIP-map levels 1 to 'numMipLevels'-1 from the base level in RGBA Float32 format and passes each level to the callback.
+The Z component of 'extent' specifies the number of array layers. If 'saturate' is true, the output components are clamped to [0, 1].
+*/
+void GenerateMipChainRGBA32Float(
+    const float*            baseLevel,
+    const Extent3D&         extent,
+    std::uint32_t           numMipLevels,
+    ImageFilter             filter,
+    long                    flags,
+    bool                    saturate,
+    unsigned                threadCount,
+    const MipLevelCallback& callback
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -426,6 +426,8 @@ static long ParseLayoutSignatureStageFlag(Parser& parser, long& bitmask)
         { StageFlags::GeometryStage,        "geom" },
         { StageFlags::FragmentStage,        "frag" },
         { StageFlags::ComputeStage,         "comp" },
+        { StageFlags::TaskStage,            "task" },
+        { StageFlags::MeshStage,            "mesh" },
     };
 
     /* Parse identifier (find end of alphabetic characters) */
@@ -0,0 +1,375 @@
+/*
+ * ReadbackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ReadbackRing.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/Fence.h>
+#include <LLGL/Format.h>
+#include "CoreUtils.h"
+#include "Assertion.h"
+#include <algorithm>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+enum class ReadbackBlockState
+{
+    Recording,  // Readbacks have been recorded into this block, but its fence has not been submitted yet.
+    Submitted,  // Fence has been submitted, but not signaled yet.
+    Signaled,   // Fence has been signaled, so the block can be read.
+};
+
+struct ReadbackBlock
+{
+    Buffer*             buffer      = nullptr;
+    Fence*              fence       = nullptr;
+    CommandQueue*       queue       = nullptr;
+    std::uint64_t       size        = 0;
+    std::uint64_t       used        = 0;
+    std::uint32_t       numTickets  = 0;
+    ReadbackBlockState  state       = ReadbackBlockState::Recording;
+};
+
+struct ReadbackEntry
+{
+    std::uint32_t       block       = ~0u;  // Index of the block this entry was allocated from; ~0u for free entries
+    std::uint64_t       offset      = 0;
+    std::uint64_t       size        = 0;
+};
+
+struct ReadbackRing::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, std::uint64_t blockSize) :
+        renderSystem { renderSystem                                        },
+        blockSize    { std::max<std::uint64_t>(blockSize, textureAlignment) }
+    {
+    }
+
+    RenderSystem&               renderSystem;
+    std::uint64_t               blockSize       = 0;
+    std::vector<ReadbackBlock>  blocks;
+    std::vector<ReadbackEntry>  entries;
+    std::vector<std::uint32_t>  freeEntries;
+};
+
+
+/*
+ * ReadbackRing class
+ */
+
+ReadbackRing::ReadbackRing(RenderSystem& renderSystem, std::uint64_t blockSize) :
+    pimpl_ { new Pimpl{ renderSystem, blockSize } }
+{
+}
+
+ReadbackRing::~ReadbackRing()
+{
+    for (ReadbackBlock& block : pimpl_->blocks)
+    {
+        pimpl_->renderSystem.Release(*block.buffer);
+        pimpl_->renderSystem.Release(*block.fence);
+    }
+    delete pimpl_;
+}
+
+// Polls the fence of the specified block without blocking and returns true if the block can be read.
+static bool PollReadbackBlock(ReadbackBlock& block, std::uint64_t timeout = 0)
+{
+    if (block.state == ReadbackBlockState::Submitted && block.queue->WaitFence(*block.fence, timeout))
+        block.state = ReadbackBlockState::Signaled;
+    return (block.state == ReadbackBlockState::Signaled);
+}
+
+// Returns true if no readbacks of the specified block are in flight anymore, so it can be reset.
+static bool IsReadbackBlockReusable(ReadbackBlock& block)
+{
+    if (block.numTickets > 0)
+        return false;
+    if (block.state == ReadbackBlockState::Submitted)
+        PollReadbackBlock(block);
+    return (block.state == ReadbackBlockState::Signaled);
+}
+
+// Allocates a new range for a readback and returns the index of its entry or ~0u on failure.
+static std::uint32_t AllocReadbackEntry(ReadbackRing::Pimpl& pimpl, std::uint64_t size, std::uint64_t alignment)
+{
+    std::uint32_t blockIndex = ~0u;
+    std::uint64_t offset = 0;
+
+    /* Find block that is currently being recorded into and has enough space left */
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(pimpl.blocks.size()); ++i)
+    {
+        ReadbackBlock& block = pimpl.blocks[i];
+        if (block.state != ReadbackBlockState::Recording)
+            continue;
+
+        const std::uint64_t alignedOffset = GetAlignedSize<std::uint64_t>(block.used, alignment);
+        if (alignedOffset + size <= block.size)
+        {
+            blockIndex  = i;
+            offset      = alignedOffset;
+            break;
+        }
+    }
+
+    /* Otherwise, recycle a block that is large enough and has no readbacks in flight */
+    if (blockIndex == ~0u)
+    {
+        for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(pimpl.blocks.size()); ++i)
+        {
+            ReadbackBlock& block = pimpl.blocks[i];
+            if (block.state != ReadbackBlockState::Recording && block.size >= size && IsReadbackBlockReusable(block))
+            {
+                block.used  = 0;
+                block.state = ReadbackBlockState::Recording;
+                blockIndex  = i;
+                break;
+            }
+        }
+    }
+
+    /* Otherwise, create a new block; readbacks that are larger than the block size get their own buffer */
+    if (blockIndex == ~0u)
+    {
+        BufferDescriptor bufferDesc;
+        {
+            bufferDesc.debugName        = "LLGL::ReadbackRing";
+            bufferDesc.size             = std::max(pimpl.blockSize, GetAlignedSize<std::uint64_t>(size, ReadbackRing::minAlignment));
+            bufferDesc.bindFlags        = BindFlags::CopyDst;
+            bufferDesc.cpuAccessFlags   = CPUAccessFlags::Read;
+        }
+        Buffer* buffer = pimpl.renderSystem.CreateBuffer(bufferDesc);
+        if (buffer == nullptr)
+            return ~0u;
+
+        ReadbackBlock newBlock;
+        {
+            newBlock.buffer = buffer;
+            newBlock.fence  = pimpl.renderSystem.CreateFence();
+            newBlock.size   = bufferDesc.size;
+            newBlock.state  = ReadbackBlockState::Recording;
+        }
+        pimpl.blocks.push_back(newBlock);
+        blockIndex = static_cast<std::uint32_t>(pimpl.blocks.size() - 1);
+    }
+
+    ReadbackBlock& block = pimpl.blocks[blockIndex];
+    block.used = offset + size;
+    ++block.numTickets;
+
+    /* Store entry in a free slot or append a new one */
+    std::uint32_t entryIndex = 0;
+    if (!pimpl.freeEntries.empty())
+    {
+        entryIndex = pimpl.freeEntries.back();
+        pimpl.freeEntries.pop_back();
+    }
+    else
+    {
+        entryIndex = static_cast<std::uint32_t>(pimpl.entries.size());
+        pimpl.entries.emplace_back();
+    }
+
+    ReadbackEntry& entry = pimpl.entries[entryIndex];
+    {
+        entry.block     = blockIndex;
+        entry.offset    = offset;
+        entry.size      = size;
+    }
+    return entryIndex;
+}
+
+static ReadbackEntry* GetReadbackEntry(ReadbackRing::Pimpl& pimpl, const ReadbackTicket& ticket)
+{
+    if (!ticket.IsValid())
+        return nullptr;
+    LLGL_ASSERT(ticket.id < pimpl.entries.size(), "readback ticket was not issued by this readback ring");
+    ReadbackEntry& entry = pimpl.entries[ticket.id];
+    LLGL_ASSERT(entry.block != ~0u, "readback ticket has already been released");
+    return &entry;
+}
+
+ReadbackTicket ReadbackRing::ReadBuffer(CommandBuffer& cmdBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    ReadbackTicket ticket;
+
+    if (size == 0)
+        return ticket;
+
+    ticket.id = AllocReadbackEntry(*pimpl_, size, minAlignment);
+    if (ticket.IsValid())
+    {
+        const ReadbackEntry& entry = pimpl_->entries[ticket.id];
+        cmdBuffer.CopyBuffer(*pimpl_->blocks[entry.block].buffer, entry.offset, srcBuffer, srcOffset, size);
+    }
+
+    return ticket;
+}
+
+ReadbackTicket ReadbackRing::ReadTexture(CommandBuffer& cmdBuffer, Texture& srcTexture, const TextureRegion& srcRegion)
+{
+    ReadbackTicket ticket;
+
+    const std::size_t numTexels =
+    (
+        static_cast<std::size_t>(srcRegion.extent.x) *
+        static_cast<std::size_t>(srcRegion.extent.y) *
+        static_cast<std::size_t>(srcRegion.extent.z) *
+        static_cast<std::size_t>(srcRegion.subresource.numArrayLayers)
+    );
+    const std::uint64_t size = GetMemoryFootprint(srcTexture.GetFormat(), numTexels);
+
+    if (size == 0)
+        return ticket;
+
+    ticket.id = AllocReadbackEntry(*pimpl_, size, textureAlignment);
+    if (ticket.IsValid())
+    {
+        const ReadbackEntry& entry = pimpl_->entries[ticket.id];
+        cmdBuffer.CopyBufferFromTexture(*pimpl_->blocks[entry.block].buffer, entry.offset, srcTexture, srcRegion);
+    }
+
+    return ticket;
+}
+
+void ReadbackRing::Submit(CommandQueue& commandQueue)
+{
+    for (ReadbackBlock& block : pimpl_->blocks)
+    {
+        if (block.state == ReadbackBlockState::Recording)
+        {
+            commandQueue.Submit(*block.fence);
+            block.queue = &commandQueue;
+            block.state = ReadbackBlockState::Submitted;
+        }
+    }
+}
+
+bool ReadbackRing::IsReady(const ReadbackTicket& ticket)
+{
+    if (ReadbackEntry* entry = GetReadbackEntry(*pimpl_, ticket))
+        return PollReadbackBlock(pimpl_->blocks[entry->block]);
+    return false;
+}
+
+bool ReadbackRing::Wait(const ReadbackTicket& ticket, std::uint64_t timeout)
+{
+    if (ReadbackEntry* entry = GetReadbackEntry(*pimpl_, ticket))
+        return PollReadbackBlock(pimpl_->blocks[entry->block], timeout);
+    return false;
+}
+
+std::uint64_t ReadbackRing::GetSize(const ReadbackTicket& ticket) const
+{
+    if (ReadbackEntry* entry = GetReadbackEntry(*pimpl_, ticket))
+        return entry->size;
+    return 0;
+}
+
+bool ReadbackRing::Read(const ReadbackTicket& ticket, void* data, std::uint64_t dataSize)
+{
+    ReadbackEntry* entry = GetReadbackEntry(*pimpl_, ticket);
+    if (entry == nullptr)
+        return false;
+
+    ReadbackBlock& block = pimpl_->blocks[entry->block];
+    if (!PollReadbackBlock(block))
+        return false;
+
+    /* Map entire buffer, since mapped ranges are not consistently offset by all backends; the GPU no longer writes to this block */
+    const void* mappedData = pimpl_->renderSystem.MapBuffer(*block.buffer, CPUAccess::ReadOnly);
+    if (mappedData == nullptr)
+        return false;
+
+    ::memcpy(data, static_cast<const char*>(mappedData) + entry->offset, static_cast<std::size_t>(std::min(dataSize, entry->size)));
+    pimpl_->renderSystem.UnmapBuffer(*block.buffer);
+
+    Release(ticket);
+    return true;
+}
+
+void ReadbackRing::Release(const ReadbackTicket& ticket)
+{
+    ReadbackEntry* entry = GetReadbackEntry(*pimpl_, ticket);
+    if (entry == nullptr)
+        return;
+
+    ReadbackBlock& block = pimpl_->blocks[entry->block];
+    LLGL_ASSERT(block.numTickets > 0);
+    --block.numTickets;
+
+    entry->block = ~0u;
+    pimpl_->freeEntries.push_back(ticket.id);
+}
+
+std::uint32_t ReadbackRing::ReleaseUnusedBlocks()
+{
+    std::vector<ReadbackBlock>& blocks = pimpl_->blocks;
+
+    /* Map old block indices to new ones, since entries refer to blocks by index */
+    std::vector<std::uint32_t> remap(blocks.size(), ~0u);
+    std::uint32_t numKept = 0;
+
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(blocks.size()); ++i)
+    {
+        ReadbackBlock& block = blocks[i];
+        if (block.state != ReadbackBlockState::Recording && IsReadbackBlockReusable(block))
+        {
+            pimpl_->renderSystem.Release(*block.buffer);
+            pimpl_->renderSystem.Release(*block.fence);
+        }
+        else
+        {
+            remap[i] = numKept;
+            blocks[numKept++] = block;
+        }
+    }
+
+    const std::uint32_t numReleased = static_cast<std::uint32_t>(blocks.size()) - numKept;
+    blocks.resize(numKept);
+
+    for (ReadbackEntry& entry : pimpl_->entries)
+    {
+        if (entry.block != ~0u)
+            entry.block = remap[entry.block];
+    }
+
+    return numReleased;
+}
+
+ReadbackRingStatistics ReadbackRing::GetStatistics() const
+{
+    ReadbackRingStatistics stats;
+
+    for (const ReadbackBlock& block : pimpl_->blocks)
+    {
+        stats.numBlocks++;
+        stats.numTickets += block.numTickets;
+        stats.totalSize += block.size;
+    }
+
+    return stats;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * SlotAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SlotAllocator.h"
+#include "CoreUtils.h"
+#include "Assertion.h"
+#include <new>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+static constexpr std::size_t g_slotAllocatorMinChunkCapacity = 16;
+static constexpr std::size_t g_slotAllocatorMaxChunkCapacity = 1024;
+
+SlotAllocator::SlotAllocator(std::size_t slotSize, std::size_t slotAlignment) :
+    slotAlignment_      { std::max<std::size_t>(slotAlignment, alignof(void*)) },
+    nextChunkCapacity_  { g_slotAllocatorMinChunkCapacity                      }
+{
+    /* Each slot must be large enough to store the free-list pointer */
+    slotSize_ = GetAlignedSize<std::size_t>(std::max<std::size_t>(slotSize, sizeof(void*)), slotAlignment_);
+}
+
+SlotAllocator::~SlotAllocator()
+{
+    for (void* chunk : chunks_)
+        ::operator delete(chunk);
+}
+
+void* SlotAllocator::Allocate()
+{
+    if (freeList_ == nullptr)
+        AllocChunk();
+
+    /* Pop slot from the front of the free-list */
+    void* slot = freeList_;
+    freeList_ = *reinterpret_cast<void**>(slot);
+    ++numAllocatedSlots_;
+
+    return slot;
+}
+
+void SlotAllocator::Free(void* slot)
+{
+    if (slot != nullptr)
+    {
+        LLGL_ASSERT(numAllocatedSlots_ > 0);
+
+        /* Push slot to the front of the free-list, so it's recycled first while its memory is still hot in the cache */
+        *reinterpret_cast<void**>(slot) = freeList_;
+        freeList_ = slot;
+        --numAllocatedSlots_;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SlotAllocator::AllocChunk()
+{
+    /* Allocate chunk with enough padding to align the first slot */
+    const std::size_t capacity = nextChunkCapacity_;
+    void* chunk = ::operator new(capacity * slotSize_ + slotAlignment_ - 1);
+    chunks_.push_back(chunk);
+
+    const std::uintptr_t chunkAddr = reinterpret_cast<std::uintptr_t>(chunk);
+    char* slots = reinterpret_cast<char*>(GetAlignedSize<std::uintptr_t>(chunkAddr, slotAlignment_));
+
+    /* Link all slots of the new chunk in ascending order, so consecutive allocations are stored contiguously */
+    for (std::size_t i = capacity; i > 0; --i)
+    {
+        void* slot = slots + (i - 1) * slotSize_;
+        *reinterpret_cast<void**>(slot) = freeList_;
+        freeList_ = slot;
+    }
+
+    /* Double the capacity of the next chunk */
+    nextChunkCapacity_ = std::min(capacity * 2, g_slotAllocatorMaxChunkCapacity);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,84 @@
+/*
+ * SlotAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SLOT_ALLOCATOR_H
+#define LLGL_SLOT_ALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Allocator for memory slots of a fixed size with O(1) allocation and release.
+Slots are allocated in chunks of growing capacity, so objects of the same type are stored contiguously and their addresses remain stable until they are released.
+Released slots are recycled via an intrusive free-list; chunks are only freed when the allocator is destroyed.
+This class is not thread-safe.
+*/
+class LLGL_EXPORT SlotAllocator final : public NonCopyable
+{
+
+    public:
+
+        SlotAllocator(std::size_t slotSize, std::size_t slotAlignment);
+        ~SlotAllocator();
+
+        // Returns a new uninitialized slot. Never returns null.
+        void* Allocate();
+
+        // Returns the specified slot to this allocator. The slot must have been allocated by this allocator.
+        void Free(void* slot);
+
+        // Returns the size (in bytes) of each slot. This is at least the size of a pointer.
+        inline std::size_t GetSlotSize() const
+        {
+            return slotSize_;
+        }
+
+        // Returns the alignment (in bytes) of each slot.
+        inline std::size_t GetSlotAlignment() const
+        {
+            return slotAlignment_;
+        }
+
+        // Returns the number of slots that are currently allocated.
+        inline std::size_t GetNumAllocatedSlots() const
+        {
+            return numAllocatedSlots_;
+        }
+
+    private:
+
+        // Allocates a new chunk and puts all of its slots into the free-list.
+        void AllocChunk();
+
+    private:
+
+        std::size_t         slotSize_           = 0;
+        std::size_t         slotAlignment_      = 0;
+        std::size_t         nextChunkCapacity_  = 0;    // Number of slots of the next chunk
+        std::size_t         numAllocatedSlots_  = 0;
+        void*               freeList_           = nullptr;
+        std::vector<void*>  chunks_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
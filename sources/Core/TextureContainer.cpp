@@ -0,0 +1,924 @@
+/*
+ * TextureContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TextureContainer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Format.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// DDS_HEADER structure (after the "DDS " magic number).
+struct DDSHeader
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t height;
+    std::uint32_t width;
+    std::uint32_t pitchOrLinearSize;
+    std::uint32_t depth;
+    std::uint32_t mipMapCount;
+    std::uint32_t reserved1[11];
+    std::uint32_t pfSize;
+    std::uint32_t pfFlags;
+    std::uint32_t pfFourCC;
+    std::uint32_t pfRGBBitCount;
+    std::uint32_t pfRBitMask;
+    std::uint32_t pfGBitMask;
+    std::uint32_t pfBBitMask;
+    std::uint32_t pfABitMask;
+    std::uint32_t caps;
+    std::uint32_t caps2;
+    std::uint32_t caps3;
+    std::uint32_t caps4;
+    std::uint32_t reserved2;
+};
+
+static_assert(sizeof(DDSHeader) == 124, "sizeof(DDSHeader) must be 124 bytes");
+
+// DDS_HEADER_DXT10 structure.
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+static_assert(sizeof(DDSHeaderDX10) == 20, "sizeof(DDSHeaderDX10) must be 20 bytes");
+
+// KTX2 file header including the index section.
+struct KTX2Header
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   vkFormat;
+    std::uint32_t   typeSize;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   layerCount;
+    std::uint32_t   faceCount;
+    std::uint32_t   levelCount;
+    std::uint32_t   supercompressionScheme;
+    std::uint32_t   dfdByteOffset;
+    std::uint32_t   dfdByteLength;
+    std::uint32_t   kvdByteOffset;
+    std::uint32_t   kvdByteLength;
+    std::uint64_t   sgdByteOffset;
+    std::uint64_t   sgdByteLength;
+};
+
+static_assert(sizeof(KTX2Header) == 80, "sizeof(KTX2Header) must be 80 bytes");
+
+// KTX2 level index entry.
+struct KTX2LevelIndex
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+// Byte range of a single MIP-map level within the container.
+struct TextureContainerLevel
+{
+    std::size_t offset      = 0;
+    std::size_t size        = 0;
+    std::size_t imageSize   = 0;
+};
+
+static constexpr std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c3)) << 24)
+    );
+}
+
+static const std::uint8_t g_KTX2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+static constexpr std::uint32_t g_DDSMagic                   = MakeFourCC('D', 'D', 'S', ' ');
+static constexpr std::uint32_t g_DDSPixelFormatAlpha        = 0x00000002; // DDPF_ALPHA
+static constexpr std::uint32_t g_DDSPixelFormatFourCC       = 0x00000004; // DDPF_FOURCC
+static constexpr std::uint32_t g_DDSPixelFormatRGB          = 0x00000040; // DDPF_RGB
+static constexpr std::uint32_t g_DDSPixelFormatLuminance    = 0x00020000; // DDPF_LUMINANCE
+static constexpr std::uint32_t g_DDSCaps2Cubemap            = 0x00000200; // DDSCAPS2_CUBEMAP
+static constexpr std::uint32_t g_DDSCaps2CubemapAllFaces    = 0x0000FC00; // DDSCAPS2_CUBEMAP_POSITIVEX | ... | DDSCAPS2_CUBEMAP_NEGATIVEZ
+static constexpr std::uint32_t g_DDSCaps2Volume             = 0x00200000; // DDSCAPS2_VOLUME
+static constexpr std::uint32_t g_DDSDimensionTexture1D      = 2;          // D3D10_RESOURCE_DIMENSION_TEXTURE1D
+static constexpr std::uint32_t g_DDSDimensionTexture3D      = 4;          // D3D10_RESOURCE_DIMENSION_TEXTURE3D
+static constexpr std::uint32_t g_DDSMiscTextureCube         = 0x00000004; // D3D10_RESOURCE_MISC_TEXTURECUBE
+
+static constexpr std::uint8_t g_KDFModelETC1S               = 163; // KHR_DF_MODEL_ETC1S
+static constexpr std::uint8_t g_KDFModelUASTC               = 166; // KHR_DF_MODEL_UASTC
+static constexpr std::uint8_t g_KDFTransferSRGB             = 2;   // KHR_DF_TRANSFER_SRGB
+
+
+/*
+ * Internal functions
+ */
+
+template <typename T>
+static bool ReadStruct(const char* data, std::size_t dataSize, std::size_t offset, T& outValue)
+{
+    if (offset > dataSize || dataSize - offset < sizeof(T))
+        return false;
+    ::memcpy(&outValue, data + offset, sizeof(T));
+    return true;
+}
+
+// Maps DXGI_FORMAT values to LLGL formats. Packed and depth formats are not supported.
+static Format DXGIFormatToFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return Format::RGBA32Float;
+        case  3: return Format::RGBA32UInt;
+        case  4: return Format::RGBA32SInt;
+        case  6: return Format::RGB32Float;
+        case  7: return Format::RGB32UInt;
+        case  8: return Format::RGB32SInt;
+        case 10: return Format::RGBA16Float;
+        case 11: return Format::RGBA16UNorm;
+        case 12: return Format::RGBA16UInt;
+        case 13: return Format::RGBA16SNorm;
+        case 14: return Format::RGBA16SInt;
+        case 16: return Format::RG32Float;
+        case 17: return Format::RG32UInt;
+        case 18: return Format::RG32SInt;
+        case 28: return Format::RGBA8UNorm;
+        case 29: return Format::RGBA8UNorm_sRGB;
+        case 30: return Format::RGBA8UInt;
+        case 31: return Format::RGBA8SNorm;
+        case 32: return Format::RGBA8SInt;
+        case 34: return Format::RG16Float;
+        case 35: return Format::RG16UNorm;
+        case 36: return Format::RG16UInt;
+        case 37: return Format::RG16SNorm;
+        case 38: return Format::RG16SInt;
+        case 41: return Format::R32Float;
+        case 42: return Format::R32UInt;
+        case 43: return Format::R32SInt;
+        case 49: return Format::RG8UNorm;
+        case 50: return Format::RG8UInt;
+        case 51: return Format::RG8SNorm;
+        case 52: return Format::RG8SInt;
+        case 54: return Format::R16Float;
+        case 56: return Format::R16UNorm;
+        case 57: return Format::R16UInt;
+        case 58: return Format::R16SNorm;
+        case 59: return Format::R16SInt;
+        case 61: return Format::R8UNorm;
+        case 62: return Format::R8UInt;
+        case 63: return Format::R8SNorm;
+        case 64: return Format::R8SInt;
+        case 65: return Format::A8UNorm;
+        case 71: return Format::BC1UNorm;
+        case 72: return Format::BC1UNorm_sRGB;
+        case 74: return Format::BC2UNorm;
+        case 75: return Format::BC2UNorm_sRGB;
+        case 77: return Format::BC3UNorm;
+        case 78: return Format::BC3UNorm_sRGB;
+        case 80: return Format::BC4UNorm;
+        case 81: return Format::BC4SNorm;
+        case 83: return Format::BC5UNorm;
+        case 84: return Format::BC5SNorm;
+        case 87: return Format::BGRA8UNorm;
+        case 91: return Format::BGRA8UNorm_sRGB;
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the legacy DDS_PIXELFORMAT to LLGL formats.
+static Format DDSPixelFormatToFormat(const DDSHeader& header)
+{
+    if ((header.pfFlags & g_DDSPixelFormatFourCC) != 0)
+    {
+        switch (header.pfFourCC)
+        {
+            case MakeFourCC('D', 'X', 'T', '1'): return Format::BC1UNorm;
+            case MakeFourCC('D', 'X', 'T', '2'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '3'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '4'): return Format::BC3UNorm;
+            case MakeFourCC('D', 'X', 'T', '5'): return Format::BC3UNorm;
+            case MakeFourCC('A', 'T', 'I', '1'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'U'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'S'): return Format::BC4SNorm;
+            case MakeFourCC('A', 'T', 'I', '2'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'U'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'S'): return Format::BC5SNorm;
+            case  36: return Format::RGBA16UNorm;   // D3DFMT_A16B16G16R16
+            case 110: return Format::RGBA16SNorm;   // D3DFMT_Q16W16V16U16
+            case 111: return Format::R16Float;      // D3DFMT_R16F
+            case 112: return Format::RG16Float;     // D3DFMT_G16R16F
+            case 113: return Format::RGBA16Float;   // D3DFMT_A16B16G16R16F
+            case 114: return Format::R32Float;      // D3DFMT_R32F
+            case 115: return Format::RG32Float;     // D3DFMT_G32R32F
+            case 116: return Format::RGBA32Float;   // D3DFMT_A32B32G32R32F
+            default:  return Format::Undefined;
+        }
+    }
+
+    if ((header.pfFlags & g_DDSPixelFormatRGB) != 0)
+    {
+        if (header.pfRGBBitCount == 32)
+        {
+            if (header.pfRBitMask == 0x000000FF && header.pfGBitMask == 0x0000FF00 && header.pfBBitMask == 0x00FF0000 && header.pfABitMask == 0xFF000000)
+                return Format::RGBA8UNorm;
+            if (header.pfRBitMask == 0x00FF0000 && header.pfGBitMask == 0x0000FF00 && header.pfBBitMask == 0x000000FF && header.pfABitMask == 0xFF000000)
+                return Format::BGRA8UNorm;
+            if (header.pfRBitMask == 0x0000FFFF && header.pfGBitMask == 0xFFFF0000)
+                return Format::RG16UNorm;
+        }
+        return Format::Undefined;
+    }
+
+    if ((header.pfFlags & g_DDSPixelFormatLuminance) != 0)
+    {
+        if (header.pfRGBBitCount == 8)
+            return Format::R8UNorm;
+        if (header.pfRGBBitCount == 16)
+            return Format::R16UNorm;
+        return Format::Undefined;
+    }
+
+    if ((header.pfFlags & g_DDSPixelFormatAlpha) != 0 && header.pfRGBBitCount == 8)
+        return Format::A8UNorm;
+
+    return Format::Undefined;
+}
+
+// Maps VkFormat values to LLGL formats. Packed and depth formats are not supported.
+static Format VkFormatToFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case   9: return Format::R8UNorm;
+        case  10: return Format::R8SNorm;
+        case  13: return Format::R8UInt;
+        case  14: return Format::R8SInt;
+        case  16: return Format::RG8UNorm;
+        case  17: return Format::RG8SNorm;
+        case  20: return Format::RG8UInt;
+        case  21: return Format::RG8SInt;
+        case  23: return Format::RGB8UNorm;
+        case  24: return Format::RGB8SNorm;
+        case  27: return Format::RGB8UInt;
+        case  28: return Format::RGB8SInt;
+        case  29: return Format::RGB8UNorm_sRGB;
+        case  37: return Format::RGBA8UNorm;
+        case  38: return Format::RGBA8SNorm;
+        case  41: return Format::RGBA8UInt;
+        case  42: return Format::RGBA8SInt;
+        case  43: return Format::RGBA8UNorm_sRGB;
+        case  44: return Format::BGRA8UNorm;
+        case  50: return Format::BGRA8UNorm_sRGB;
+        case  70: return Format::R16UNorm;
+        case  71: return Format::R16SNorm;
+        case  74: return Format::R16UInt;
+        case  75: return Format::R16SInt;
+        case  76: return Format::R16Float;
+        case  77: return Format::RG16UNorm;
+        case  78: return Format::RG16SNorm;
+        case  81: return Format::RG16UInt;
+        case  82: return Format::RG16SInt;
+        case  83: return Format::RG16Float;
+        case  84: return Format::RGB16UNorm;
+        case  85: return Format::RGB16SNorm;
+        case  88: return Format::RGB16UInt;
+        case  89: return Format::RGB16SInt;
+        case  90: return Format::RGB16Float;
+        case  91: return Format::RGBA16UNorm;
+        case  92: return Format::RGBA16SNorm;
+        case  95: return Format::RGBA16UInt;
+        case  96: return Format::RGBA16SInt;
+        case  97: return Format::RGBA16Float;
+        case  98: return Format::R32UInt;
+        case  99: return Format::R32SInt;
+        case 100: return Format::R32Float;
+        case 101: return Format::RG32UInt;
+        case 102: return Format::RG32SInt;
+        case 103: return Format::RG32Float;
+        case 104: return Format::RGB32UInt;
+        case 105: return Format::RGB32SInt;
+        case 106: return Format::RGB32Float;
+        case 107: return Format::RGBA32UInt;
+        case 108: return Format::RGBA32SInt;
+        case 109: return Format::RGBA32Float;
+        case 131: return Format::BC1UNorm;      // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: return Format::BC1UNorm_sRGB; // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: return Format::BC1UNorm;      // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: return Format::BC1UNorm_sRGB; // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: return Format::BC2UNorm;
+        case 136: return Format::BC2UNorm_sRGB;
+        case 137: return Format::BC3UNorm;
+        case 138: return Format::BC3UNorm_sRGB;
+        case 139: return Format::BC4UNorm;
+        case 140: return Format::BC4SNorm;
+        case 141: return Format::BC5UNorm;
+        case 142: return Format::BC5SNorm;
+        default:  return Format::Undefined;
+    }
+}
+
+// Returns the extent of the specified MIP-map level without array layers. Levels beyond the full MIP chain are clamped to 1.
+static Extent3D GetContainerMipExtent(const TextureDescriptor& textureDesc, std::uint32_t mipLevel)
+{
+    if (mipLevel >= 32)
+        return Extent3D{ 1u, 1u, 1u };
+    return Extent3D
+    {
+        std::max(1u, textureDesc.extent.x  >> mipLevel),
+        std::max(1u, textureDesc.extent.y >> mipLevel),
+        std::max(1u, textureDesc.extent.z  >> mipLevel)
+    };
+}
+
+// Multiplies the two values and returns false if the product overflows.
+static bool MulContainerSize(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& outProduct)
+{
+    if (lhs != 0 && rhs > std::numeric_limits<std::uint64_t>::max() / lhs)
+        return false;
+    outProduct = lhs * rhs;
+    return true;
+}
+
+// Returns the size (in bytes) of a single image, i.e. all depth slices of one array layer, with the specified format and extent.
+// Returns 0 if the format is not supported or the size cannot be represented, so that malformed headers are rejected.
+static std::size_t GetContainerImageSize(const Format format, const Extent3D& extent)
+{
+    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    if (formatAttribs.blockWidth == 0 || formatAttribs.blockHeight == 0)
+        return 0;
+
+    const std::uint64_t numBlocksX = (static_cast<std::uint64_t>(extent.x) + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const std::uint64_t numBlocksY = (static_cast<std::uint64_t>(extent.y) + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+
+    std::uint64_t numBits = 0;
+    if (!MulContainerSize(numBlocksX * numBlocksY, extent.z, numBits) ||
+        !MulContainerSize(numBits, formatAttribs.bitSize, numBits))
+    {
+        return 0;
+    }
+
+    const std::uint64_t imageSize = numBits / 8;
+    if (imageSize > std::numeric_limits<std::size_t>::max())
+        return 0;
+
+    return static_cast<std::size_t>(imageSize);
+}
+
+// Returns the size (in bytes) of all images of one MIP-map level or 0 if the size cannot be represented.
+static std::size_t GetContainerLevelSize(std::size_t imageSize, std::uint32_t numImages)
+{
+    std::uint64_t levelSize = 0;
+    if (!MulContainerSize(imageSize, numImages, levelSize) || levelSize > std::numeric_limits<std::size_t>::max())
+        return 0;
+    return static_cast<std::size_t>(levelSize);
+}
+
+// Returns the texture type for the specified dimensions.
+static TextureType GetContainerTextureType(std::uint32_t numDimensions, bool isCube, bool isArray)
+{
+    if (numDimensions == 3)
+        return TextureType::Texture3D;
+    if (isCube)
+        return (isArray ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    if (numDimensions == 1)
+        return (isArray ? TextureType::Texture1DArray : TextureType::Texture1D);
+    return (isArray ? TextureType::Texture2DArray : TextureType::Texture2D);
+}
+
+
+/*
+ * TextureContainer::Pimpl struct
+ */
+
+struct TextureContainer::Pimpl
+{
+    Blob                                blob;
+    const char*                         data                = nullptr;
+    std::size_t                         dataSize            = 0;
+    TextureContainerFormat              containerFormat     = TextureContainerFormat::Undefined;
+    TextureDescriptor                   textureDesc;
+    TextureContainerSupercompression    supercompression    = TextureContainerSupercompression::None;
+    Format                              srcFormat           = Format::Undefined;    // Format of the container data or undefined for Basis Universal
+    bool                                transcodingRequired = false;
+    bool                                hasAlpha            = true;
+    bool                                isSRGB              = false;
+    const char*                         globalData          = nullptr;
+    std::size_t                         globalDataSize      = 0;
+    std::vector<TextureContainerLevel>  levels;
+    std::vector<std::size_t>            imageOffsets;                               // Offset of each image at [mipLevel * arrayLayers + arrayLayer]
+
+    bool ParseDDS();
+    bool ParseKTX2();
+    void ParseKTX2DataFormatDescriptor(const KTX2Header& header);
+};
+
+bool TextureContainer::Pimpl::ParseDDS()
+{
+    std::uint32_t magic = 0;
+    if (!ReadStruct(data, dataSize, 0, magic) || magic != g_DDSMagic)
+        return false;
+
+    DDSHeader header;
+    if (!ReadStruct(data, dataSize, sizeof(magic), header) || header.size != sizeof(DDSHeader))
+        return false;
+
+    std::size_t     offset          = sizeof(magic) + sizeof(DDSHeader);
+    std::uint32_t   numDimensions   = 2;
+    std::uint32_t   numLayers       = 1;
+    bool            isCube          = false;
+    bool            isArray         = false;
+
+    if ((header.pfFlags & g_DDSPixelFormatFourCC) != 0 && header.pfFourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        /* Read DX10 header extension */
+        DDSHeaderDX10 headerDX10;
+        if (!ReadStruct(data, dataSize, offset, headerDX10))
+            return false;
+        offset += sizeof(DDSHeaderDX10);
+
+        srcFormat   = DXGIFormatToFormat(headerDX10.dxgiFormat);
+        isCube      = ((headerDX10.miscFlag & g_DDSMiscTextureCube) != 0);
+        numLayers   = std::max(1u, headerDX10.arraySize);
+        isArray     = (numLayers > 1);
+
+        if (headerDX10.resourceDimension == g_DDSDimensionTexture1D)
+            numDimensions = 1;
+        else if (headerDX10.resourceDimension == g_DDSDimensionTexture3D)
+            numDimensions = 3;
+    }
+    else
+    {
+        /* Read legacy pixel format; partial cube maps are not supported */
+        srcFormat = DDSPixelFormatToFormat(header);
+        if ((header.caps2 & g_DDSCaps2Cubemap) != 0)
+        {
+            if ((header.caps2 & g_DDSCaps2CubemapAllFaces) != g_DDSCaps2CubemapAllFaces)
+                return false;
+            isCube = true;
+        }
+        else if ((header.caps2 & g_DDSCaps2Volume) != 0)
+            numDimensions = 3;
+    }
+
+    if (srcFormat == Format::Undefined || header.width == 0)
+        return false;
+
+    /* Initialize texture descriptor */
+    textureDesc.type            = GetContainerTextureType(numDimensions, isCube, isArray);
+    textureDesc.format          = srcFormat;
+    textureDesc.extent.x    = header.width;
+    textureDesc.extent.y   = (numDimensions >= 2 ? std::max(1u, header.height) : 1u);
+    textureDesc.extent.z    = (numDimensions == 3 ? std::max(1u, header.depth)  : 1u);
+    textureDesc.arrayLayers     = (isCube ? numLayers * 6 : numLayers);
+    textureDesc.mipLevels       = std::max(1u, std::min(header.mipMapCount, NumMipLevels(textureDesc.type, textureDesc.extent)));
+
+    /*
+    DDS stores all MIP-map levels of one array layer contiguously. The offset of each layer must advance over all stored levels,
+    even if the header specifies more levels than the extent allows and only the clamped number of levels is exposed.
+    */
+    const std::uint32_t numImages       = textureDesc.arrayLayers;
+    const std::uint32_t numStoredLevels = std::max(1u, header.mipMapCount);
+
+    levels.resize(textureDesc.mipLevels);
+    imageOffsets.resize(static_cast<std::size_t>(textureDesc.mipLevels) * numImages);
+
+    for_range(mipLevel, textureDesc.mipLevels)
+    {
+        levels[mipLevel].imageSize  = GetContainerImageSize(srcFormat, GetContainerMipExtent(textureDesc, mipLevel));
+        levels[mipLevel].size       = GetContainerLevelSize(levels[mipLevel].imageSize, numImages);
+        if (levels[mipLevel].size == 0)
+            return false;
+    }
+
+    for_range(image, numImages)
+    {
+        for_range(mipLevel, numStoredLevels)
+        {
+            const std::size_t imageSize =
+            (
+                mipLevel < textureDesc.mipLevels
+                    ? levels[mipLevel].imageSize
+                    : GetContainerImageSize(srcFormat, GetContainerMipExtent(textureDesc, mipLevel))
+            );
+            if (offset > dataSize || dataSize - offset < imageSize)
+                return false;
+            if (mipLevel < textureDesc.mipLevels)
+                imageOffsets[mipLevel * numImages + image] = offset;
+            offset += imageSize;
+        }
+    }
+
+    for_range(mipLevel, textureDesc.mipLevels)
+        levels[mipLevel].offset = imageOffsets[mipLevel * numImages];
+
+    containerFormat = TextureContainerFormat::DDS;
+    return true;
+}
+
+bool TextureContainer::Pimpl::ParseKTX2()
+{
+    KTX2Header header;
+    if (!ReadStruct(data, dataSize, 0, header) || ::memcmp(header.identifier, g_KTX2Identifier, sizeof(g_KTX2Identifier)) != 0)
+        return false;
+
+    if (header.pixelWidth == 0 || header.faceCount == 0 || header.supercompressionScheme > static_cast<std::uint32_t>(TextureContainerSupercompression::ZLIB))
+        return false;
+
+    const bool          isCube          = (header.faceCount == 6);
+    const bool          isArray         = (header.layerCount > 0);
+    const std::uint32_t numDimensions   = (header.pixelDepth > 0 ? 3 : header.pixelHeight > 0 ? 2 : 1);
+    const std::uint32_t numLayers       = std::max(1u, header.layerCount);
+
+    srcFormat           = VkFormatToFormat(header.vkFormat);
+    supercompression    = static_cast<TextureContainerSupercompression>(header.supercompressionScheme);
+    transcodingRequired = (header.vkFormat == 0 || supercompression != TextureContainerSupercompression::None);
+
+    if (header.vkFormat != 0 && srcFormat == Format::Undefined)
+        return false;
+
+    if (header.vkFormat == 0)
+        ParseKTX2DataFormatDescriptor(header);
+
+    /* Initialize texture descriptor */
+    textureDesc.type            = GetContainerTextureType(numDimensions, isCube, isArray);
+    textureDesc.format          = (transcodingRequired ? Format::Undefined : srcFormat);
+    textureDesc.extent.x    = header.pixelWidth;
+    textureDesc.extent.y   = std::max(1u, header.pixelHeight);
+    textureDesc.extent.z    = std::max(1u, header.pixelDepth);
+    textureDesc.arrayLayers     = numLayers * header.faceCount;
+    textureDesc.mipLevels       = std::max(1u, std::min(header.levelCount, NumMipLevels(textureDesc.type, textureDesc.extent)));
+
+    /* Read supercompression global data, e.g. BasisLZ codebooks */
+    if (header.sgdByteLength > 0)
+    {
+        if (header.sgdByteOffset > dataSize || dataSize - header.sgdByteOffset < header.sgdByteLength)
+            return false;
+        globalData      = data + static_cast<std::size_t>(header.sgdByteOffset);
+        globalDataSize  = static_cast<std::size_t>(header.sgdByteLength);
+    }
+
+    /* Read level index; KTX2 stores all array layers, cube faces, and depth slices of one MIP-map level contiguously */
+    const std::uint32_t numImages = textureDesc.arrayLayers;
+
+    levels.resize(textureDesc.mipLevels);
+
+    for_range(mipLevel, textureDesc.mipLevels)
+    {
+        KTX2LevelIndex levelIndex;
+        if (!ReadStruct(data, dataSize, sizeof(KTX2Header) + mipLevel * sizeof(KTX2LevelIndex), levelIndex))
+            return false;
+        if (levelIndex.byteOffset > dataSize || dataSize - levelIndex.byteOffset < levelIndex.byteLength)
+            return false;
+
+        levels[mipLevel].offset = static_cast<std::size_t>(levelIndex.byteOffset);
+        levels[mipLevel].size   = static_cast<std::size_t>(levelIndex.byteLength);
+    }
+
+    if (!transcodingRequired)
+    {
+        /* Images can only be addressed directly if the data is not supercompressed */
+        imageOffsets.resize(static_cast<std::size_t>(textureDesc.mipLevels) * numImages);
+
+        for_range(mipLevel, textureDesc.mipLevels)
+        {
+            TextureContainerLevel& level = levels[mipLevel];
+            level.imageSize = GetContainerImageSize(srcFormat, GetContainerMipExtent(textureDesc, mipLevel));
+            const std::size_t minLevelSize = GetContainerLevelSize(level.imageSize, numImages);
+            if (minLevelSize == 0 || level.size < minLevelSize)
+                return false;
+
+            for_range(image, numImages)
+                imageOffsets[mipLevel * numImages + image] = level.offset + level.imageSize * image;
+        }
+    }
+
+    containerFormat = TextureContainerFormat::KTX2;
+    return true;
+}
+
+void TextureContainer::Pimpl::ParseKTX2DataFormatDescriptor(const KTX2Header& header)
+{
+    /* Read basic data format descriptor block: totalSize, vendorId/descriptorType, versionNumber/descriptorBlockSize, colorModel, colorPrimaries, transferFunction */
+    const std::size_t dfdBlockOffset = static_cast<std::size_t>(header.dfdByteOffset) + 4;
+    const std::size_t dfdSampleOffset = dfdBlockOffset + 24;
+
+    std::uint8_t colorModelAttribs[4] = {};
+    std::uint32_t versionAndBlockSize = 0;
+    if (header.dfdByteLength < 28 ||
+        !ReadStruct(data, dataSize, dfdBlockOffset + 4, versionAndBlockSize) ||
+        !ReadStruct(data, dataSize, dfdBlockOffset + 8, colorModelAttribs))
+    {
+        return;
+    }
+
+    const std::uint8_t  colorModel          = colorModelAttribs[0];
+    const std::uint8_t  transferFunction    = colorModelAttribs[2];
+    const std::uint32_t blockSize           = (versionAndBlockSize >> 16);
+    const std::uint32_t numSamples          = (blockSize > 24 ? (blockSize - 24) / 16 : 0);
+
+    isSRGB = (transferFunction == g_KDFTransferSRGB);
+
+    if (colorModel == g_KDFModelETC1S)
+    {
+        /* ETC1S stores alpha in a second slice */
+        hasAlpha = (numSamples == 2);
+    }
+    else if (colorModel == g_KDFModelUASTC)
+    {
+        /* UASTC stores the channel layout in the first sample: RGB = 0, RGBA = 3, RRR = 4, RRRG = 5, RG = 6 */
+        std::uint8_t sampleAttribs[4] = {};
+        if (numSamples > 0 && ReadStruct(data, dataSize, dfdSampleOffset, sampleAttribs))
+        {
+            const std::uint8_t channelId = (sampleAttribs[3] & 0x0F);
+            hasAlpha = (channelId == 3 || channelId == 5);
+        }
+    }
+}
+
+
+/*
+ * TextureContainer class
+ */
+
+TextureContainer::TextureContainer() :
+    pimpl_ { new Pimpl{} }
+{
+}
+
+TextureContainer::TextureContainer(TextureContainer&& rhs) noexcept :
+    pimpl_ { rhs.pimpl_ }
+{
+    rhs.pimpl_ = nullptr;
+}
+
+TextureContainer& TextureContainer::operator = (TextureContainer&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        delete pimpl_;
+        pimpl_ = rhs.pimpl_;
+        rhs.pimpl_ = nullptr;
+    }
+    return *this;
+}
+
+TextureContainer::~TextureContainer()
+{
+    delete pimpl_;
+}
+
+bool TextureContainer::Open(const char* filename)
+{
+    return Open(Blob::CreateFromMappedFile(filename));
+}
+
+bool TextureContainer::Open(Blob&& blob)
+{
+    Close();
+
+    if (!blob)
+        return false;
+
+    if (pimpl_ == nullptr)
+        pimpl_ = new Pimpl{};
+
+    pimpl_->data        = static_cast<const char*>(blob.GetData());
+    pimpl_->dataSize    = blob.GetSize();
+
+    /* Try KTX2 first, since its identifier is more restrictive than the DDS magic number */
+    if (!pimpl_->ParseKTX2())
+    {
+        *pimpl_ = Pimpl{};
+        pimpl_->data        = static_cast<const char*>(blob.GetData());
+        pimpl_->dataSize    = blob.GetSize();
+
+        if (!pimpl_->ParseDDS())
+        {
+            Close();
+            return false;
+        }
+    }
+
+    /* Keep blob alive as long as the container refers into its data */
+    pimpl_->blob                    = std::move(blob);
+    pimpl_->textureDesc.bindFlags   = BindFlags::Sampled;
+    pimpl_->textureDesc.miscFlags   = 0;
+
+    return true;
+}
+
+void TextureContainer::Close()
+{
+    if (pimpl_ != nullptr)
+        *pimpl_ = Pimpl{};
+}
+
+bool TextureContainer::IsOpen() const
+{
+    return (pimpl_ != nullptr && pimpl_->containerFormat != TextureContainerFormat::Undefined);
+}
+
+bool TextureContainer::IsTranscodingRequired() const
+{
+    return (IsOpen() && pimpl_->transcodingRequired);
+}
+
+static bool IsTextureFormatSupported(const RenderingCapabilities& caps, const Format format)
+{
+    return (std::find(caps.textureFormats.begin(), caps.textureFormats.end(), format) != caps.textureFormats.end());
+}
+
+bool TextureContainer::SelectTranscodeFormat(const RenderingCapabilities& caps)
+{
+    if (!IsTranscodingRequired())
+        return IsOpen();
+
+    if (pimpl_->srcFormat != Format::Undefined)
+    {
+        /* Supercompressed data is only inflated, so the format must be supported as it is */
+        if (!IsTextureFormatSupported(caps, pimpl_->srcFormat))
+            return false;
+        pimpl_->textureDesc.format = pimpl_->srcFormat;
+        return true;
+    }
+
+    /* Select best format for Basis Universal data */
+    const Format candidateFormats[] =
+    {
+        (pimpl_->isSRGB ? (pimpl_->hasAlpha ? Format::BC3UNorm_sRGB : Format::BC1UNorm_sRGB) : (pimpl_->hasAlpha ? Format::BC3UNorm : Format::BC1UNorm)),
+        (pimpl_->isSRGB ? Format::RGBA8UNorm_sRGB : Format::RGBA8UNorm),
+    };
+
+    for (const Format format : candidateFormats)
+    {
+        if (IsTextureFormatSupported(caps, format))
+        {
+            pimpl_->textureDesc.format = format;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ImageView TextureContainer::GetImageView(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    if (!IsOpen() || pimpl_->transcodingRequired)
+        return ImageView{};
+
+    const TextureDescriptor& textureDesc = pimpl_->textureDesc;
+    if (mipLevel >= textureDesc.mipLevels || arrayLayer >= textureDesc.arrayLayers)
+        return ImageView{};
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(pimpl_->srcFormat);
+    return ImageView
+    {
+        formatAttribs.format,
+        formatAttribs.dataType,
+        pimpl_->data + pimpl_->imageOffsets[mipLevel * textureDesc.arrayLayers + arrayLayer],
+        pimpl_->levels[mipLevel].imageSize
+    };
+}
+
+bool TextureContainer::WriteTexture(RenderSystem& renderSystem, Texture& texture, const TextureContainerTranscodeCallback& transcoder) const
+{
+    if (!IsOpen())
+        return false;
+
+    const TextureDescriptor&    textureDesc = pimpl_->textureDesc;
+    const std::uint32_t         numImages   = textureDesc.arrayLayers;
+
+    if (pimpl_->transcodingRequired)
+    {
+        /* Transcode each MIP-map level into the format of the destination texture */
+        if (!transcoder)
+            return false;
+
+        const Format                dstFormat       = texture.GetFormat();
+        const FormatAttributes&     formatAttribs   = GetFormatAttribs(dstFormat);
+        std::vector<char>           dstData;
+        bool                        result          = true;
+
+        for_range(mipLevel, textureDesc.mipLevels)
+        {
+            const TextureContainerLevel& level = pimpl_->levels[mipLevel];
+
+            TextureContainerTranscodeInfo info;
+            {
+                info.supercompression   = pimpl_->supercompression;
+                info.srcData            = pimpl_->data + level.offset;
+                info.srcDataSize        = level.size;
+                info.globalData         = pimpl_->globalData;
+                info.globalDataSize     = pimpl_->globalDataSize;
+                info.mipLevel           = mipLevel;
+                info.extent             = GetContainerMipExtent(textureDesc, mipLevel);
+                info.numImages          = numImages;
+                info.dstFormat          = dstFormat;
+            }
+            const std::size_t dstDataSize = GetContainerLevelSize(GetContainerImageSize(dstFormat, info.extent), numImages);
+            if (dstDataSize == 0)
+                return false;
+
+            dstData.resize(dstDataSize);
+            if (!transcoder(info, dstData.data(), dstDataSize))
+            {
+                result = false;
+                continue;
+            }
+
+            const TextureRegion region{ TextureSubresource{ 0, numImages, mipLevel, 1 }, Offset3D{}, info.extent };
+            const ImageView imageView{ formatAttribs.format, formatAttribs.dataType, dstData.data(), dstDataSize };
+            renderSystem.WriteTexture(texture, region, imageView);
+        }
+
+        return result;
+    }
+
+    /* Write each MIP-map level with as few calls as possible, i.e. group all array layers that are contiguous in the file mapping */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(pimpl_->srcFormat);
+
+    for_range(mipLevel, textureDesc.mipLevels)
+    {
+        const TextureContainerLevel&    level       = pimpl_->levels[mipLevel];
+        const std::size_t*              offsets     = &(pimpl_->imageOffsets[mipLevel * numImages]);
+        const Extent3D                  mipExtent   = GetContainerMipExtent(textureDesc, mipLevel);
+
+        for (std::uint32_t baseLayer = 0; baseLayer < numImages;)
+        {
+            std::uint32_t numLayers = 1;
+            while (baseLayer + numLayers < numImages && offsets[baseLayer + numLayers] == offsets[baseLayer] + level.imageSize * numLayers)
+                ++numLayers;
+
+            const TextureRegion region{ TextureSubresource{ baseLayer, numLayers, mipLevel, 1 }, Offset3D{}, mipExtent };
+            const ImageView imageView{ formatAttribs.format, formatAttribs.dataType, pimpl_->data + offsets[baseLayer], level.imageSize * numLayers };
+            renderSystem.WriteTexture(texture, region, imageView);
+
+            baseLayer += numLayers;
+        }
+    }
+
+    return true;
+}
+
+Texture* TextureContainer::CreateTexture(RenderSystem& renderSystem, long bindFlags, const TextureContainerTranscodeCallback& transcoder) const
+{
+    if (!IsOpen())
+        return nullptr;
+
+    TextureDescriptor textureDesc = pimpl_->textureDesc;
+    textureDesc.bindFlags = bindFlags;
+
+    if (textureDesc.format == Format::Undefined || !IsTextureFormatSupported(renderSystem.GetRenderingCaps(), textureDesc.format))
+        return nullptr;
+
+    Texture* texture = renderSystem.CreateTexture(textureDesc);
+    if (texture != nullptr && !WriteTexture(renderSystem, *texture, transcoder))
+    {
+        renderSystem.Release(*texture);
+        return nullptr;
+    }
+
+    return texture;
+}
+
+TextureContainerFormat TextureContainer::GetContainerFormat() const
+{
+    return (pimpl_ != nullptr ? pimpl_->containerFormat : TextureContainerFormat::Undefined);
+}
+
+const TextureDescriptor& TextureContainer::GetTextureDesc() const
+{
+    static const TextureDescriptor g_emptyTextureDesc;
+    return (pimpl_ != nullptr ? pimpl_->textureDesc : g_emptyTextureDesc);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
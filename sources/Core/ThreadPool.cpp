@@ -0,0 +1,196 @@
+/*
+ * ThreadPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ThreadPool.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+// Initial number of jobs per queue; must be a power of two.
+static constexpr std::size_t g_initialJobQueueCapacity = 64;
+
+ThreadPool::ThreadPool(unsigned numWorkers)
+{
+    queues_.reserve(numWorkers);
+    for_range(i, numWorkers)
+        queues_.push_back(std::unique_ptr<JobQueue>{ new JobQueue{} });
+
+    workers_.reserve(numWorkers);
+    for_range(i, numWorkers)
+        workers_.emplace_back(&ThreadPool::WorkerMain, this, static_cast<std::size_t>(i));
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard{ wakeMutex_ };
+        stop_ = true;
+    }
+    wakeSignal_.notify_all();
+
+    for (std::thread& worker : workers_)
+        worker.join();
+}
+
+void ThreadPool::Run(const std::function<void(std::size_t index)>& task, std::size_t count)
+{
+    if (queues_.empty())
+    {
+        /* Run all jobs on the calling thread if there are no workers */
+        for_range(i, count)
+            task(i);
+        return;
+    }
+
+    Batch batch;
+    {
+        batch.task      = &task;
+        batch.remaining = count;
+    }
+
+    /* Count jobs before they become visible, so a worker that pops one early cannot decrement the counter below zero */
+    numQueuedJobs_.fetch_add(count);
+
+    /* Distribute jobs evenly across all worker queues */
+    for_range(i, count)
+    {
+        JobQueue& queue = *queues_[i % queues_.size()];
+        std::lock_guard<std::mutex> guard{ queue.mutex };
+        queue.PushBack(Job{ &batch, i });
+    }
+
+    /* Synchronize with workers that are about to sleep, so none of them misses the wake-up signal */
+    {
+        std::lock_guard<std::mutex> guard{ wakeMutex_ };
+    }
+    wakeSignal_.notify_all();
+
+    /* Help out until there is no more work to steal; this may include jobs from other batches */
+    Job job;
+    while (StealJob(queues_.size(), job))
+        RunJob(job);
+
+    /* Wait for the jobs that are still running on worker threads */
+    std::unique_lock<std::mutex> lock{ batch.mutex };
+    batch.finished.wait(lock, [&batch]() { return (batch.remaining == 0); });
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ThreadPool::WorkerMain(std::size_t workerIndex)
+{
+    for (;;)
+    {
+        Job job;
+        if (PopJob(workerIndex, job) || StealJob(workerIndex, job))
+        {
+            RunJob(job);
+            continue;
+        }
+
+        /* Sleep until new jobs are queued */
+        std::unique_lock<std::mutex> lock{ wakeMutex_ };
+        wakeSignal_.wait(lock, [this]() { return (stop_ || numQueuedJobs_.load() > 0); });
+        if (stop_)
+            return;
+    }
+}
+
+bool ThreadPool::PopJob(std::size_t queueIndex, Job& outJob)
+{
+    JobQueue& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> guard{ queue.mutex };
+    if (queue.Empty())
+        return false;
+
+    outJob = queue.PopFront();
+    numQueuedJobs_.fetch_sub(1);
+    return true;
+}
+
+bool ThreadPool::StealJob(std::size_t thiefIndex, Job& outJob)
+{
+    const std::size_t numQueues = queues_.size();
+    for_range(i, numQueues)
+    {
+        const std::size_t victimIndex = (thiefIndex + 1 + i) % numQueues;
+        if (victimIndex == thiefIndex)
+            continue;
+
+        JobQueue& queue = *queues_[victimIndex];
+        std::lock_guard<std::mutex> guard{ queue.mutex };
+        if (!queue.Empty())
+        {
+            outJob = queue.PopBack();
+            numQueuedJobs_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::RunJob(const Job& job)
+{
+    (*job.batch->task)(job.index);
+
+    /* Notify dispatching thread while holding the lock, since the batch is destroyed as soon as it returns */
+    std::lock_guard<std::mutex> guard{ job.batch->mutex };
+    if (--job.batch->remaining == 0)
+        job.batch->finished.notify_all();
+}
+
+
+/*
+ * JobQueue structure
+ */
+
+ThreadPool::JobQueue::JobQueue() :
+    ring ( g_initialJobQueueCapacity )
+{
+}
+
+void ThreadPool::JobQueue::PushBack(const Job& job)
+{
+    if (count == ring.size())
+    {
+        /* Double the capacity and move the jobs to the front of the new ring, so the capacity remains a power of two */
+        std::vector<Job> newRing(ring.size() * 2);
+        for_range(i, count)
+            newRing[i] = ring[(head + i) & (ring.size() - 1)];
+        ring.swap(newRing);
+        head = 0;
+    }
+    ring[(head + count) & (ring.size() - 1)] = job;
+    ++count;
+}
+
+ThreadPool::Job ThreadPool::JobQueue::PopFront()
+{
+    const Job job = ring[head];
+    head = (head + 1) & (ring.size() - 1);
+    --count;
+    return job;
+}
+
+ThreadPool::Job ThreadPool::JobQueue::PopBack()
+{
+    --count;
+    return ring[(head + count) & (ring.size() - 1)];
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
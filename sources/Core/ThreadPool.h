@@ -0,0 +1,116 @@
+/*
+ * ThreadPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_THREAD_POOL_H
+#define LLGL_THREAD_POOL_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Persistent thread pool with one job queue per worker.
+Workers take jobs from the front of their own queue and steal from the back of other queues when their own queue runs dry.
+The thread that dispatches a batch of jobs steals jobs as well until the batch is complete, so nested dispatches cannot deadlock.
+*/
+class ThreadPool final : public NonCopyable
+{
+
+    public:
+
+        ThreadPool(unsigned numWorkers);
+        ~ThreadPool();
+
+        // Runs task(i) for each index i in [0, count) and blocks until all of them have finished.
+        void Run(const std::function<void(std::size_t index)>& task, std::size_t count);
+
+        // Returns the number of worker threads. This does not include the dispatching thread.
+        inline unsigned GetNumWorkers() const
+        {
+            return static_cast<unsigned>(workers_.size());
+        }
+
+    private:
+
+        struct Batch
+        {
+            const std::function<void(std::size_t index)>*   task        = nullptr;
+            std::size_t                                     remaining   = 0;
+            std::mutex                                      mutex;
+            std::condition_variable                         finished;
+        };
+
+        struct Job
+        {
+            Batch*      batch;
+            std::size_t index;
+        };
+
+        // Ring buffer of jobs that is preallocated once and only grows when a batch exceeds its capacity, so dispatching does not allocate.
+        struct JobQueue
+        {
+            JobQueue();
+
+            inline bool Empty() const
+            {
+                return (count == 0);
+            }
+
+            void PushBack(const Job& job);
+            Job PopFront();
+            Job PopBack();
+
+            std::mutex          mutex;
+            std::vector<Job>    ring;
+            std::size_t         head    = 0;
+            std::size_t         count   = 0;
+        };
+
+    private:
+
+        void WorkerMain(std::size_t workerIndex);
+
+        // Pops a job from the front of the specified queue.
+        bool PopJob(std::size_t queueIndex, Job& outJob);
+
+        // Steals a job from the back of any queue other than the specified one.
+        bool StealJob(std::size_t thiefIndex, Job& outJob);
+
+        void RunJob(const Job& job);
+
+    private:
+
+        std::vector<std::unique_ptr<JobQueue>>  queues_;
+        std::vector<std::thread>                workers_;
+        std::atomic<std::size_t>                numQueuedJobs_  { 0 };
+        std::mutex                              wakeMutex_;
+        std::condition_variable                 wakeSignal_;
+        bool                                    stop_           = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
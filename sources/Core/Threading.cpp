@@ -6,9 +6,13 @@
  */
 
 #include "Threading.h"
+#include "ThreadPool.h"
+#include <LLGL/JobSystem.h>
 #include <LLGL/Utils/ForRange.h>
 #include <thread>
-#include <vector>
+#include <atomic>
+#include <mutex>
+#include <memory>
 #include <algorithm>
 
 
@@ -16,33 +20,59 @@ namespace LLGL
 {
 
 
-static constexpr unsigned g_maxThreadCountStaticArray = 64;
+struct JobSystemState
+{
+    std::mutex                      mutex;
+    std::shared_ptr<ThreadPool>     threadPool;
+    unsigned                        threadCount         = LLGL_MAX_THREAD_COUNT;
+    JobSystem::DispatchCallback     dispatchCallback;
+};
 
-static void DoConcurrentRangeInWorkerContainer(
-    const std::function<void(std::size_t begin, std::size_t end)>&  task,
-    std::size_t                                                     count,
-    std::size_t                                                     workerCount,
-    std::thread*                                                    workers)
+static JobSystemState& GetJobSystemState()
 {
-    /* Distribute work to threads */
-    const std::size_t workSize          = count / workerCount;
-    const std::size_t workSizeRemain    = count % workerCount;
+    static JobSystemState state;
+    return state;
+}
 
-    std::size_t offset = 0;
+static unsigned GetDefaultNumWorkers()
+{
+    const unsigned numHardwareThreads = std::thread::hardware_concurrency();
+    return (numHardwareThreads > 1 ? numHardwareThreads - 1 : 0);
+}
 
-    for_range(i, workerCount)
+// Returns the thread pool and creates it on first use. The state mutex must be locked by the caller.
+static const std::shared_ptr<ThreadPool>& GetOrCreateThreadPool(JobSystemState& state)
+{
+    if (!state.threadPool)
     {
-        workers[i] = std::thread(task, offset, offset + workSize);
-        offset += workSize;
+        const unsigned numWorkers = (state.threadCount == LLGL_MAX_THREAD_COUNT ? GetDefaultNumWorkers() : state.threadCount);
+        state.threadPool = std::make_shared<ThreadPool>(numWorkers);
     }
+    return state.threadPool;
+}
 
-    /* Execute task of remaining work on main thread */
-    if (workSizeRemain > 0)
-        task(offset, offset + workSizeRemain);
+static void DispatchJobs(const JobSystem::JobFunction& job, std::size_t numJobs)
+{
+    JobSystemState& state = GetJobSystemState();
+
+    /*
+    Copy the dispatch callback and share ownership of the thread pool under the lock,
+    so JobSystem::SetDispatchCallback and JobSystem::SetThreadCount can replace them while this batch is still running
+    */
+    JobSystem::DispatchCallback dispatchCallback;
+    std::shared_ptr<ThreadPool> threadPool;
+    {
+        std::lock_guard<std::mutex> guard{ state.mutex };
+        if (state.dispatchCallback)
+            dispatchCallback = state.dispatchCallback;
+        else
+            threadPool = GetOrCreateThreadPool(state);
+    }
 
-    /* Join worker threads */
-    for_range(i, workerCount)
-        workers[i].join();
+    if (dispatchCallback)
+        dispatchCallback(job, numJobs);
+    else
+        threadPool->Run(job, numJobs);
 }
 
 LLGL_EXPORT void DoConcurrentRange(
@@ -54,24 +84,28 @@ LLGL_EXPORT void DoConcurrentRange(
     if (threadCount == LLGL_MAX_THREAD_COUNT)
         threadCount = std::thread::hardware_concurrency();
 
-    threadCount = std::min(threadCount, static_cast<unsigned>(count / threadMinWorkSize));
+    threadCount = std::min(threadCount, static_cast<unsigned>(count / std::max(1u, threadMinWorkSize)));
 
     if (threadCount <= 1)
     {
         /* Run single-threaded */
         task(0, count);
     }
-    else if (threadCount <= g_maxThreadCountStaticArray)
+    else
     {
-        /* Launch worker threads in static array */
-        std::thread workers[g_maxThreadCountStaticArray];
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers);
-    }
-    else if (threadCount > 1)
-    {
-        /* Launch worker threads in dynamic array */
-        std::vector<std::thread> workers(threadCount);
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers.data());
+        /* Distribute work in equally sized ranges; the last range also takes the remainder */
+        const std::size_t numJobs   = threadCount;
+        const std::size_t workSize  = count / numJobs;
+
+        DispatchJobs(
+            [&task, count, numJobs, workSize](std::size_t jobIndex)
+            {
+                const std::size_t begin = jobIndex * workSize;
+                const std::size_t end   = (jobIndex + 1 == numJobs ? count : begin + workSize);
+                task(begin, end);
+            },
+            numJobs
+        );
     }
 }
 
@@ -93,6 +127,140 @@ LLGL_EXPORT void DoConcurrent(
     );
 }
 
+// Returns the number of chunks of at least 'grainSize' elements the range [0, count) is split into.
+static std::size_t GetParallelForNumJobs(std::size_t count, std::size_t grainSize, unsigned threadCount)
+{
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+    const std::size_t numGrains = (count + grainSize - 1) / grainSize;
+    return std::min(static_cast<std::size_t>(threadCount), numGrains);
+}
+
+// State of a parallel-for loop. Jobs only capture a reference to this, so the job function fits into the small buffer of std::function.
+struct ParallelForState
+{
+    ParallelForRangeProc        proc;
+    void*                       userData;
+    std::size_t                 count;
+    std::size_t                 numJobs;
+    std::size_t                 chunkSize;
+    std::atomic<std::size_t>    next;
+};
+
+LLGL_EXPORT void DispatchParallelForRange(
+    ParallelForRangeProc    proc,
+    void*                   userData,
+    std::size_t             count,
+    unsigned                threadCount,
+    std::size_t             grainSize,
+    ParallelForPartition    partition)
+{
+    grainSize = std::max<std::size_t>(1, grainSize);
+
+    const std::size_t numJobs = GetParallelForNumJobs(count, grainSize, threadCount);
+    if (numJobs <= 1)
+    {
+        /* Run single-threaded */
+        if (count > 0)
+            proc(userData, 0, count);
+        return;
+    }
+
+    ParallelForState state;
+    {
+        state.proc      = proc;
+        state.userData  = userData;
+        state.count     = count;
+        state.numJobs   = numJobs;
+        state.next      = 0;
+    }
+
+    if (partition == ParallelForPartition::Guided)
+    {
+        /* Each job grabs chunks of half its fair share of the remaining range until the range is exhausted */
+        state.chunkSize = grainSize;
+
+        DispatchJobs(
+            [&state](std::size_t /*jobIndex*/)
+            {
+                std::size_t begin = state.next.load();
+                while (begin < state.count)
+                {
+                    const std::size_t remaining = state.count - begin;
+                    const std::size_t chunkSize = std::min(remaining, std::max(state.chunkSize, remaining / (state.numJobs * 2)));
+                    if (state.next.compare_exchange_weak(begin, begin + chunkSize))
+                    {
+                        state.proc(state.userData, begin, begin + chunkSize);
+                        begin = state.next.load();
+                    }
+                }
+            },
+            numJobs
+        );
+    }
+    else
+    {
+        /* Distribute work in equally sized ranges, rounded up to the grain size; the last range takes what is left */
+        const std::size_t fairShare = (count + numJobs - 1) / numJobs;
+        state.chunkSize = ((fairShare + grainSize - 1) / grainSize) * grainSize;
+
+        DispatchJobs(
+            [&state](std::size_t jobIndex)
+            {
+                const std::size_t begin = std::min(state.count, jobIndex * state.chunkSize);
+                const std::size_t end   = std::min(state.count, begin + state.chunkSize);
+                if (begin < end)
+                    state.proc(state.userData, begin, end);
+            },
+            numJobs
+        );
+    }
+}
+
+/*
+ * JobSystem namespace
+ */
+
+namespace JobSystem
+{
+
+
+LLGL_EXPORT void SetThreadCount(unsigned threadCount)
+{
+    JobSystemState& state = GetJobSystemState();
+
+    /* Release the previous thread pool outside the lock, since its destructor joins all worker threads */
+    std::shared_ptr<ThreadPool> previousThreadPool;
+    {
+        std::lock_guard<std::mutex> guard{ state.mutex };
+        if (state.threadCount != threadCount)
+        {
+            state.threadCount = threadCount;
+            previousThreadPool = std::move(state.threadPool);
+        }
+    }
+}
+
+LLGL_EXPORT unsigned GetThreadCount()
+{
+    JobSystemState& state = GetJobSystemState();
+    std::lock_guard<std::mutex> guard{ state.mutex };
+    if (state.threadPool)
+        return state.threadPool->GetNumWorkers();
+    else
+        return (state.threadCount == LLGL_MAX_THREAD_COUNT ? GetDefaultNumWorkers() : state.threadCount);
+}
+
+LLGL_EXPORT void SetDispatchCallback(const DispatchCallback& callback)
+{
+    JobSystemState& state = GetJobSystemState();
+    std::lock_guard<std::mutex> guard{ state.mutex };
+    state.dispatchCallback = callback;
+}
+
+
+} // /namespace JobSystem
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,8 @@
 #include <LLGL/Export.h>
 #include <LLGL/Constants.h>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <cstddef>
 
 
@@ -33,6 +35,81 @@ LLGL_EXPORT void DoConcurrent(
     unsigned                                        threadMinWorkSize   = 64
 );
 
+// Partitioning strategy of a parallel-for loop.
+enum class ParallelForPartition
+{
+    // Splits the range into one contiguous chunk per thread. Best for uniform work per element.
+    Static,
+
+    // Threads grab chunks of decreasing size from a shared counter, but never smaller than the grain size. Best for non-uniform work per element.
+    Guided,
+};
+
+// Function pointer to run the subrange [begin, end) of a parallel-for loop, where 'userData' points to the loop body.
+using ParallelForRangeProc = void (*)(void* userData, std::size_t begin, std::size_t end);
+
+/*
+Dispatches the range [0, count) onto the persistent thread pool (see JobSystem) and blocks until all subranges have finished.
+No subrange is smaller than 'grainSize' elements, except for the remainder, and the loop runs single-threaded if the range is not larger than one grain.
+Use the ParallelForRange and ParallelFor templates instead of calling this directly.
+*/
+LLGL_EXPORT void DispatchParallelForRange(
+    ParallelForRangeProc    proc,
+    void*                   userData,
+    std::size_t             count,
+    unsigned                threadCount,
+    std::size_t             grainSize,
+    ParallelForPartition    partition
+);
+
+/*
+Runs task(begin, end) for disjoint subranges that cover [0, count), distributed across at most 'threadCount' threads.
+Unlike DoConcurrentRange, the task is not wrapped into an std::function, so it can be any callable and is neither copied nor heap-allocated.
+*/
+template <typename TFunc>
+void ParallelForRange(
+    TFunc&&                 task,
+    std::size_t             count,
+    unsigned                threadCount = LLGL_MAX_THREAD_COUNT,
+    std::size_t             grainSize   = 64,
+    ParallelForPartition    partition   = ParallelForPartition::Static)
+{
+    using TTask = typename std::remove_reference<TFunc>::type;
+    DispatchParallelForRange(
+        [](void* userData, std::size_t begin, std::size_t end)
+        {
+            (*static_cast<TTask*>(userData))(begin, end);
+        },
+        const_cast<void*>(static_cast<const void*>(std::addressof(task))),
+        count,
+        threadCount,
+        grainSize,
+        partition
+    );
+}
+
+// Runs task(index) for each index in [0, count), distributed across 'threadCount' threads. See ParallelForRange.
+template <typename TFunc>
+void ParallelFor(
+    TFunc&&                 task,
+    std::size_t             count,
+    unsigned                threadCount = LLGL_MAX_THREAD_COUNT,
+    std::size_t             grainSize   = 64,
+    ParallelForPartition    partition   = ParallelForPartition::Static)
+{
+    ParallelForRange(
+        [&task](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                task(i);
+        },
+        count,
+        threadCount,
+        grainSize,
+        partition
+    );
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,292 @@
+/*
+ * TiledImage.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TiledImage.h>
+#include <LLGL/Utils/Image.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Format.h>
+#include "ImageUtils.h"
+#include "../Platform/MappedFile.h"
+#include <algorithm>
+#include <memory>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * TiledImage::Pimpl struct
+ */
+
+struct TiledImage::Pimpl
+{
+    std::unique_ptr<MappedFile> file;
+    const char*                 data        = nullptr;
+    Extent3D                    extent;
+    ImageFormat                 format      = ImageFormat::RGBA;
+    DataType                    dataType    = DataType::UInt8;
+};
+
+
+/*
+ * TiledImage class
+ */
+
+TiledImage::TiledImage() :
+    pimpl_ { new Pimpl{} }
+{
+}
+
+TiledImage::TiledImage(TiledImage&& rhs) noexcept :
+    pimpl_ { rhs.pimpl_ }
+{
+    rhs.pimpl_ = nullptr;
+}
+
+TiledImage& TiledImage::operator = (TiledImage&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        delete pimpl_;
+        pimpl_ = rhs.pimpl_;
+        rhs.pimpl_ = nullptr;
+    }
+    return *this;
+}
+
+TiledImage::~TiledImage()
+{
+    delete pimpl_;
+}
+
+bool TiledImage::Open(
+    const char*         filename,
+    const Extent3D&     extent,
+    const ImageFormat   format,
+    const DataType      dataType,
+    std::size_t         fileOffset)
+{
+    Close();
+
+    if (filename == nullptr || IsCompressedFormat(format) || IsDepthOrStencilFormat(format))
+        return false;
+
+    std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+    if (!file)
+        return false;
+
+    /* Validate file size against image attributes */
+    const std::size_t numPixels = static_cast<std::size_t>(extent.x) * extent.y * extent.z;
+    const std::size_t imageSize = GetMemoryFootprint(format, dataType, numPixels);
+    if (imageSize == 0 || fileOffset > file->GetSize() || file->GetSize() - fileOffset < imageSize)
+        return false;
+
+    if (pimpl_ == nullptr)
+        pimpl_ = new Pimpl{};
+
+    pimpl_->data        = static_cast<const char*>(file->GetData()) + fileOffset;
+    pimpl_->file        = std::move(file);
+    pimpl_->extent      = extent;
+    pimpl_->format      = format;
+    pimpl_->dataType    = dataType;
+
+    return true;
+}
+
+void TiledImage::Close()
+{
+    if (pimpl_ != nullptr)
+        *pimpl_ = Pimpl{};
+}
+
+bool TiledImage::IsOpen() const
+{
+    return (pimpl_ != nullptr && pimpl_->data != nullptr);
+}
+
+void TiledImage::ReadPixels(const Offset3D& offset, const Extent3D& extent, const MutableImageView& imageView, unsigned threadCount) const
+{
+    if (!IsOpen() || imageView.data == nullptr || !IsRegionInside(offset, extent))
+        return;
+
+    /* Get source image parameters */
+    const std::uint32_t bpp             = GetBytesPerPixel();
+    const std::uint32_t srcRowStride    = bpp * pimpl_->extent.x;
+    const std::uint32_t srcDepthStride  = srcRowStride * pimpl_->extent.y;
+    const std::size_t   srcOffset       = bpp * (static_cast<std::size_t>(offset.x) + (static_cast<std::size_t>(offset.y) + static_cast<std::size_t>(offset.z) * pimpl_->extent.y) * pimpl_->extent.x);
+    const char*         src             = pimpl_->data + srcOffset;
+
+    if (pimpl_->format == imageView.format && pimpl_->dataType == imageView.dataType)
+    {
+        /* Validate required size */
+        const std::size_t requiredDataSize = static_cast<std::size_t>(bpp) * extent.x * extent.y * extent.z;
+        if (imageView.dataSize < requiredDataSize)
+            return;
+
+        /* Blit region into destination image */
+        BitBlit(
+            extent, bpp,
+            reinterpret_cast<char*>(imageView.data), bpp * extent.x, bpp * extent.x * extent.y,
+            src, srcRowStride, srcDepthStride
+        );
+    }
+    else
+    {
+        /* Copy region into temporary sub-image and convert it into the output image */
+        Image subImage{ extent, pimpl_->format, pimpl_->dataType };
+
+        BitBlit(
+            extent, bpp,
+            reinterpret_cast<char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
+            src, srcRowStride, srcDepthStride
+        );
+
+        subImage.ReadPixels({}, extent, imageView, threadCount);
+    }
+}
+
+// Returns the extent of the source region for the specified texture region; array layers of array textures map to slices of the source image.
+static Extent3D GetTextureRegionSourceExtent(const Texture& texture, const TextureRegion& textureRegion)
+{
+    const TextureType type = texture.GetType();
+    if (IsArrayTexture(type) || IsCubeTexture(type))
+        return Extent3D{ textureRegion.extent.x, textureRegion.extent.y, textureRegion.subresource.numArrayLayers };
+    else
+        return textureRegion.extent;
+}
+
+void TiledImage::WriteTexture(
+    RenderSystem&           renderSystem,
+    Texture&                texture,
+    const TextureRegion&    textureRegion,
+    const Offset3D&         srcOffset,
+    const Extent3D&         tileExtent) const
+{
+    const Extent3D srcExtent = GetTextureRegionSourceExtent(texture, textureRegion);
+
+    if (!IsOpen() || !IsRegionInside(srcOffset, srcExtent) || tileExtent.x == 0 || tileExtent.y == 0 || tileExtent.z == 0)
+        return;
+
+    const TextureType   type            = texture.GetType();
+    const bool          isLayered       = (IsArrayTexture(type) || IsCubeTexture(type));
+    const std::uint32_t bpp             = GetBytesPerPixel();
+    const std::uint32_t srcRowStride    = bpp * pimpl_->extent.x;
+    const std::uint32_t srcDepthStride  = srcRowStride * pimpl_->extent.y;
+
+    /* Allocate intermediate buffer for a single tile on demand; it is reused for all tiles */
+    DynamicByteArray tileBuffer;
+
+    for (std::uint32_t z = 0; z < srcExtent.z; z += tileExtent.z)
+    {
+        for (std::uint32_t y = 0; y < srcExtent.y; y += tileExtent.y)
+        {
+            for (std::uint32_t x = 0; x < srcExtent.x; x += tileExtent.x)
+            {
+                const Extent3D tile
+                {
+                    std::min(tileExtent.x, srcExtent.x - x),
+                    std::min(tileExtent.y, srcExtent.y - y),
+                    std::min(tileExtent.z, srcExtent.z - z)
+                };
+
+                const Offset3D tileSrcOffset
+                {
+                    srcOffset.x + static_cast<std::int32_t>(x),
+                    srcOffset.y + static_cast<std::int32_t>(y),
+                    srcOffset.z + static_cast<std::int32_t>(z)
+                };
+
+                const std::size_t   tileOffset  = bpp * (static_cast<std::size_t>(tileSrcOffset.x) + (static_cast<std::size_t>(tileSrcOffset.y) + static_cast<std::size_t>(tileSrcOffset.z) * pimpl_->extent.y) * pimpl_->extent.x);
+                const std::size_t   tileSize    = static_cast<std::size_t>(bpp) * tile.x * tile.y * tile.z;
+                const char*         tileData    = pimpl_->data + tileOffset;
+
+                /* Tile is contiguous in the mapped file if it covers entire rows and, for multiple slices, entire slices */
+                const bool isContiguous = (tile.x == pimpl_->extent.x && (tile.z == 1 || tile.y == pimpl_->extent.y));
+                if (!isContiguous)
+                {
+                    if (!tileBuffer)
+                        tileBuffer = DynamicByteArray{ static_cast<std::size_t>(bpp) * tileExtent.x * tileExtent.y * tileExtent.z, UninitializeTag{} };
+
+                    BitBlit(
+                        tile, bpp,
+                        tileBuffer.get(), bpp * tile.x, bpp * tile.x * tile.y,
+                        tileData, srcRowStride, srcDepthStride
+                    );
+                    tileData = tileBuffer.get();
+                }
+
+                /* Write tile into destination texture region */
+                TextureRegion tileRegion = textureRegion;
+                {
+                    tileRegion.offset.x += static_cast<std::int32_t>(x);
+                    tileRegion.offset.y += static_cast<std::int32_t>(y);
+                    tileRegion.extent.x = tile.x;
+                    tileRegion.extent.y = tile.y;
+                    if (isLayered)
+                    {
+                        tileRegion.subresource.baseArrayLayer  += z;
+                        tileRegion.subresource.numArrayLayers   = tile.z;
+                    }
+                    else
+                    {
+                        tileRegion.offset.z += static_cast<std::int32_t>(z);
+                        tileRegion.extent.z = tile.z;
+                    }
+                }
+                const ImageView tileView{ pimpl_->format, pimpl_->dataType, tileData, tileSize };
+                renderSystem.WriteTexture(texture, tileRegion, tileView);
+            }
+        }
+    }
+}
+
+const Extent3D& TiledImage::GetExtent() const
+{
+    static const Extent3D emptyExtent;
+    return (pimpl_ != nullptr ? pimpl_->extent : emptyExtent);
+}
+
+ImageFormat TiledImage::GetFormat() const
+{
+    return (pimpl_ != nullptr ? pimpl_->format : ImageFormat::RGBA);
+}
+
+DataType TiledImage::GetDataType() const
+{
+    return (pimpl_ != nullptr ? pimpl_->dataType : DataType::UInt8);
+}
+
+std::uint32_t TiledImage::GetBytesPerPixel() const
+{
+    return static_cast<std::uint32_t>(GetMemoryFootprint(GetFormat(), GetDataType(), 1));
+}
+
+static bool Is1DRegionValid(std::int32_t offset, std::uint32_t extent, std::uint32_t limit)
+{
+    return (offset >= 0 && static_cast<std::uint32_t>(offset) + extent <= limit);
+}
+
+bool TiledImage::IsRegionInside(const Offset3D& offset, const Extent3D& extent) const
+{
+    const Extent3D& limit = GetExtent();
+    return
+    (
+        Is1DRegionValid(offset.x, extent.x, limit.x) &&
+        Is1DRegionValid(offset.y, extent.y, limit.y) &&
+        Is1DRegionValid(offset.z, extent.z, limit.z)
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * VertexFormat.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/VertexFormat.h>
+#include "Float16Compressor.h"
+#include "CoreUtils.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT std::uint16_t PackFloat16(float value)
+{
+    return CompressFloat16(value);
+}
+
+LLGL_EXPORT float UnpackFloat16(std::uint16_t value)
+{
+    return DecompressFloat16(value);
+}
+
+// Packs the specified value from [0, 1] into an unsigned normalized integer with the specified maximum value.
+static std::uint32_t PackUNorm(float value, float maxValue)
+{
+    return static_cast<std::uint32_t>(std::lround(Clamp(value, 0.0f, 1.0f) * maxValue));
+}
+
+LLGL_EXPORT std::uint32_t PackRGB10A2UNorm(float r, float g, float b, float a)
+{
+    return
+    (
+        (PackUNorm(r, 1023.0f)      ) |
+        (PackUNorm(g, 1023.0f) << 10) |
+        (PackUNorm(b, 1023.0f) << 20) |
+        (PackUNorm(a,    3.0f) << 30)
+    );
+}
+
+LLGL_EXPORT void UnpackRGB10A2UNorm(std::uint32_t value, float (&outColor)[4])
+{
+    outColor[0] = static_cast<float>((value      ) & 0x3FF) / 1023.0f;
+    outColor[1] = static_cast<float>((value >> 10) & 0x3FF) / 1023.0f;
+    outColor[2] = static_cast<float>((value >> 20) & 0x3FF) / 1023.0f;
+    outColor[3] = static_cast<float>((value >> 30) & 0x3  ) /    3.0f;
+}
+
+// Returns the sign of the specified value, but 1 for zero, so that points on the octahedron's edges fold onto the correct side.
+static float SignNotZero(float value)
+{
+    return (value >= 0.0f ? 1.0f : -1.0f);
+}
+
+// Packs the specified value from [-1, 1] into a 16-bit signed normalized integer.
+static std::uint32_t PackSNorm16(float value)
+{
+    const long packed = std::lround(Clamp(value, -1.0f, 1.0f) * 32767.0f);
+    return (static_cast<std::uint32_t>(packed) & 0xFFFF);
+}
+
+// Unpacks the specified 16-bit signed normalized integer into [-1, 1]. Both -32768 and -32767 map to -1.
+static float UnpackSNorm16(std::uint32_t value)
+{
+    const std::int16_t packed = static_cast<std::int16_t>(value & 0xFFFF);
+    return std::max(-1.0f, static_cast<float>(packed) / 32767.0f);
+}
+
+LLGL_EXPORT std::uint32_t PackOctahedralNormal(float x, float y, float z)
+{
+    /* Project normal onto octahedron */
+    const float l1Norm = std::abs(x) + std::abs(y) + std::abs(z);
+    if (l1Norm == 0.0f)
+        return 0;
+
+    float u = x / l1Norm;
+    float v = y / l1Norm;
+
+    /* Fold lower hemisphere onto the upper one */
+    if (z < 0.0f)
+    {
+        const float foldedU = (1.0f - std::abs(v)) * SignNotZero(u);
+        const float foldedV = (1.0f - std::abs(u)) * SignNotZero(v);
+        u = foldedU;
+        v = foldedV;
+    }
+
+    return (PackSNorm16(u) | (PackSNorm16(v) << 16));
+}
+
+LLGL_EXPORT void UnpackOctahedralNormal(std::uint32_t value, float (&outNormal)[3])
+{
+    float x = UnpackSNorm16(value);
+    float y = UnpackSNorm16(value >> 16);
+    const float z = 1.0f - std::abs(x) - std::abs(y);
+
+    /* Unfold lower hemisphere */
+    if (z < 0.0f)
+    {
+        const float unfoldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+        const float unfoldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+        x = unfoldedX;
+        y = unfoldedY;
+    }
+
+    const float invLength = 1.0f / std::sqrt(x*x + y*y + z*z);
+    outNormal[0] = x * invLength;
+    outNormal[1] = y * invLength;
+    outNormal[2] = z * invLength;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -8,7 +8,8 @@
 #include "AMD64Assembler.h"
 #include "AMD64Opcode.h"
 #include "../../../Core/Assertion.h"
-#include <limits.h>
+#include "../../../Core/CoreUtils.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -52,6 +53,16 @@ static const Reg g_amd64TempReg     = Reg::RAX;
 static constexpr std::size_t g_amd64IntParamsCount = sizeof(g_amd64IntParams)/sizeof(g_amd64IntParams[0]);
 static constexpr std::size_t g_amd64FltParamsCount = sizeof(g_amd64FltParams)/sizeof(g_amd64FltParams[0]);
 
+// Size (in bytes) of the area the caller must reserve for the callee to spill its register parameters.
+#ifdef _WIN32
+static constexpr std::int8_t g_amd64ShadowSpaceSize = 32;
+#else
+static constexpr std::int8_t g_amd64ShadowSpaceSize = 0;
+#endif
+
+// Size (in bytes) of the area at the bottom of the local stack that is reserved for arguments of subsequent calls.
+static constexpr std::uint32_t g_amd64ArgStackSize = 128;
+
 
 /*
  * Internal functions
@@ -76,6 +87,25 @@ static std::uint8_t GetArgSize(const ArgType t)
 }
 
 
+/*
+Returns the register for the specified parameter, or the temporary register if the parameter is passed on the stack.
+Microsoft x64 calling convention assigns registers by parameter position; System V counts integer and floating-point registers separately.
+*/
+static Reg GetParamReg(bool isFloat, std::size_t paramIndex, std::size_t& numIntRegs, std::size_t& numFltRegs)
+{
+    #ifdef _WIN32
+    if (paramIndex < g_amd64IntParamsCount)
+        return (isFloat ? g_amd64FltParams[paramIndex] : g_amd64IntParams[paramIndex]);
+    #else
+    if (isFloat && numFltRegs < g_amd64FltParamsCount)
+        return g_amd64FltParams[numFltRegs++];
+    if (!isFloat && numIntRegs < g_amd64IntParamsCount)
+        return g_amd64IntParams[numIntRegs++];
+    #endif
+    return g_amd64TempReg;
+}
+
+
 /*
  * AMD64Assembler class
  */
@@ -90,9 +120,8 @@ void AMD64Assembler::Begin()
     XOrReg(Reg::RDI, Reg::RSI);
     #endif
 
-    /* Reset data about local stack */
-    localStackSize_ = 128;//0;
-    paramStackSize_ = 0;
+    /* Reset data about local stack; the bottom of the local stack is reserved for arguments of subsequent calls */
+    localStackSize_ = g_amd64ArgStackSize;
 
     /* Write entry point prologue */
     WritePrologue();
@@ -114,124 +143,27 @@ void AMD64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farC
 {
     const auto& args = GetArgs();
 
-    /* Move first couple of arguments into registers */
+    /* Move first couple of arguments into registers and all remaining arguments onto the stack in order of the parameter list */
     std::size_t numIntRegs = 0, numFltRegs = 0;
-    std::size_t lastInt, lastFlt;
-    std::size_t num = args.size();
-
-    lastInt = lastFlt = std::numeric_limits<std::size_t>::max();
+    std::int32_t stackDisp = g_amd64ShadowSpaceSize;
 
-    for (std::size_t i = 0; i < num; ++i)
+    for (std::size_t i = 0; i < args.size(); ++i)
     {
         const JIT::Arg& arg = args[i];
 
-        /* Determine destination register for argument */
-        Reg dstReg = g_amd64TempReg;
-        bool isFloat = IsFloat(arg.type);
-
-        if (isFloat && numFltRegs < g_amd64FltParamsCount)
-        {
-            dstReg  = g_amd64FltParams[numFltRegs++];
-            lastFlt = i;
-        }
-        else if (!isFloat && numIntRegs < g_amd64IntParamsCount)
-        {
-            dstReg  = g_amd64IntParams[numIntRegs++];
-            lastInt = i;
-        }
-        else
-            break;
-
-        if (arg.param < 0xF)
-        {
-            if (arg.param < varArgDisp_.size())
-            {
-                /* Move parameter from local stack into destination register */
-                if (IsFltReg(dstReg))
-                    MovDQURegMem(dstReg, Reg::RBP, varArgDisp_[arg.param]);
-                else
-                    MovRegMem(dstReg, Reg::RBP, varArgDisp_[arg.param]);
-            }
-        }
-        else if (dstReg >= Reg::R8 && dstReg <= Reg::R15)
-        {
-            /* R8-R15 registers are only supported for 64-bit operand size */
-            MovRegImm64(dstReg, arg.value.i64);
-        }
+        const Reg dstReg = GetParamReg(IsFloat(arg.type), i, numIntRegs, numFltRegs);
+        if (dstReg != g_amd64TempReg)
+            MovArgReg(dstReg, arg);
         else
         {
-            /* Move value into destination register */
-            switch (arg.type)
+            /* Each stack argument occupies 8 bytes and must fit into the reserved area at the bottom of the local stack */
+            if (stackDisp + 8 > static_cast<std::int32_t>(g_amd64ArgStackSize))
             {
-                case ArgType::Byte:
-                    MovRegImm32(dstReg, arg.value.i8);
-                    break;
-                case ArgType::Word:
-                    MovRegImm32(dstReg, arg.value.i16);
-                    break;
-                case ArgType::DWord:
-                    MovRegImm32(dstReg, arg.value.i32);
-                    break;
-                case ArgType::QWord:
-                    MovRegImm64(dstReg, arg.value.i64);
-                    break;
-                case ArgType::Ptr:
-                    MovRegImm64(dstReg, arg.value.i64);
-                    break;
-                case ArgType::StackPtr:
-                    MovReg(dstReg, Reg::RBP);
-                    SubImm32(dstReg, stackChunkOffsets_[arg.value.i8]);
-                    break;
-                case ArgType::Float:
-                    MovSSRegImm32(dstReg, arg.value.f32);
-                    break;
-                case ArgType::Double:
-                    MovSDRegImm64(dstReg, arg.value.f64);
-                    break;
+                Invalidate();
+                return;
             }
-        }
-    }
-
-    /* Push remaining arguments onto stack */
-    Displacement stackDisp;
-
-    for (std::size_t i = 0; i < num; ++i)
-    {
-        std::size_t iRev = num - i - 1u;
-        const JIT::Arg& arg = args[iRev];
-
-        /* Check if argument has already been moved into a register */
-        bool isFloat = IsFloat(arg.type);
-
-        if ( (  isFloat && iRev == lastFlt ) ||
-             ( !isFloat && iRev == lastInt ) )
-        {
-            break;
-        }
-
-        /* Push argument onto stack */
-        switch (arg.type)
-        {
-            case ArgType::Byte:
-            case ArgType::Word:
-            case ArgType::DWord:
-            case ArgType::Float:
-                MovMemImm32(Reg::RSP, arg.value.i32, stackDisp);
-                stackDisp.disp8 += 8;
-                break;
-            case ArgType::QWord:
-            case ArgType::Ptr:
-            case ArgType::Double:
-                MovRegImm64(g_amd64TempReg, arg.value.i64);
-                MovMemReg(Reg::RSP, g_amd64TempReg, stackDisp);
-                stackDisp.disp8 += 8;
-                break;
-            case ArgType::StackPtr:
-                MovReg(g_amd64TempReg, Reg::RBP);
-                SubImm32(g_amd64TempReg, stackChunkOffsets_[arg.value.i8]);
-                MovMemReg(Reg::RSP, g_amd64TempReg, stackDisp);
-                stackDisp.disp8 += 8;
-                break;
+            MovArgStack(arg, Disp32{ stackDisp });
+            stackDisp += 8;
         }
     }
 
@@ -297,7 +229,7 @@ void AMD64Assembler::WriteEpilogue()
 
     /* Restore base stack pointer (RBP) */
     PopReg(Reg::RBP);
-    RetNear(paramStackSize_);
+    RetNear();
 }
 
 void AMD64Assembler::WriteStackFrame(
@@ -309,47 +241,38 @@ void AMD64Assembler::WriteStackFrame(
     for (JIT::ArgType type : varArgTypes)
         varArgSize += (IsFloat(type) ? 16 : 8);
 
-    /* Determine required stack size for allocations */
+    /* Determine required stack size for allocations (8-byte aligned) */
     std::uint32_t stackChunksSize = 0;
     for (std::uint32_t chunk : stackChunks)
-        stackChunksSize += chunk;
+        stackChunksSize += GetAlignedSize(chunk, 8u);
 
-    /* Allocate local stack */
-    localStackSize_ += varArgSize;
+    /*
+    Allocate local stack below the preserved RBX register:
+    variadic arguments start at [RBP-16], followed by the stack chunks and the reserved area for arguments of subsequent calls.
+    */
+    std::uint32_t chunkStackOffset = 16 + varArgSize;
 
-    std::uint32_t chunkStackOffset = localStackSize_ + 8;
+    localStackSize_ += 8 + varArgSize + stackChunksSize;
 
-    localStackSize_ += stackChunksSize;
+    /* Keep RSP 16-byte aligned for subsequent calls (return address, RBP, and RBX are pushed before the local stack) */
+    localStackSize_ = GetAlignedSize(localStackSize_ + 8u, 16u) - 8u;
 
-    if (localStackSize_ > 0)
-        SubImm32(Reg::RSP, localStackSize_);
+    SubImm32(Reg::RSP, localStackSize_);
 
     /* Store parameters in local stack */
     std::size_t numIntRegs = 0, numFltRegs = 0;
-    std::int8_t paramStackOffset = 16; // first parameter at [EBP+16]
-    std::int8_t localStackOffset = -16; // local variables after preserved EBX
+    std::int8_t paramStackOffset = 16 + g_amd64ShadowSpaceSize; // first stack parameter at [RBP+16] after shadow space
+    std::int8_t localStackOffset = -16; // local variables after preserved RBX
 
-    for (auto type : varArgTypes)
+    for (std::size_t i = 0; i < varArgTypes.size(); ++i)
     {
-        bool isFloat = IsFloat(type);
-        Reg srcReg = g_amd64TempReg;
+        Reg srcReg = GetParamReg(IsFloat(varArgTypes[i]), i, numIntRegs, numFltRegs);
 
-        if (isFloat && numFltRegs < g_amd64FltParamsCount)
-        {
-            /* Get parameter from floating-point register */
-            srcReg = g_amd64FltParams[numFltRegs++];
-        }
-        else if (!isFloat && numIntRegs < g_amd64IntParamsCount)
-        {
-            /* Get parameter from integer register */
-            srcReg = g_amd64IntParams[numIntRegs++];
-        }
-        else
+        if (srcReg == g_amd64TempReg)
         {
             /* Load parameter from stack */
             MovRegMem(srcReg, Reg::RBP, Disp8{ paramStackOffset });
             paramStackOffset += 8;
-            paramStackSize_ += 8;
         }
 
         /* Store parameter in local stack */
@@ -368,18 +291,113 @@ void AMD64Assembler::WriteStackFrame(
         varArgDisp_.push_back(Disp8{ localStackOffset });
     }
 
-    /* Determine stack base for arguments of subsequent calls */
-    argStackBase_.disp8 = localStackOffset;
-
-    /* Determine stack base for allocated stack chunks */
+    /* Determine base pointer offsets for allocated stack chunks */
     stackChunkOffsets_.reserve(stackChunks.size());
-    for (auto chunk : stackChunks)
+    for (std::uint32_t chunk : stackChunks)
     {
-        chunkStackOffset += static_cast<std::int32_t>(chunk);
+        chunkStackOffset += GetAlignedSize(chunk, 8u);
         stackChunkOffsets_.push_back(chunkStackOffset);
     }
 }
 
+// Moves the specified argument into the destination register.
+void AMD64Assembler::MovArgReg(Reg dstReg, const Arg& arg)
+{
+    if (arg.param < 0xF)
+    {
+        if (arg.param < varArgDisp_.size())
+        {
+            /* Move parameter from local stack into destination register */
+            if (IsFltReg(dstReg))
+                MovDQURegMem(dstReg, Reg::RBP, varArgDisp_[arg.param]);
+            else if (dstReg >= Reg::R8)
+            {
+                /* Load R8-R15 via temporary register, since MOV r64, m64 does not encode the REX.R prefix */
+                MovRegMem(g_amd64TempReg, Reg::RBP, varArgDisp_[arg.param]);
+                MovReg(dstReg, g_amd64TempReg);
+            }
+            else
+                MovRegMem(dstReg, Reg::RBP, varArgDisp_[arg.param]);
+        }
+    }
+    else if (arg.type == ArgType::StackPtr)
+    {
+        /* Compute address of stack chunk relative to base pointer */
+        MovReg(dstReg, Reg::RBP);
+        SubImm32(dstReg, stackChunkOffsets_[arg.value.i8]);
+    }
+    else if (dstReg >= Reg::R8 && dstReg <= Reg::R15)
+    {
+        /* R8-R15 registers are only supported for 64-bit operand size */
+        MovRegImm64(dstReg, arg.value.i64);
+    }
+    else
+    {
+        /* Move value into destination register */
+        switch (arg.type)
+        {
+            case ArgType::Byte:
+                MovRegImm32(dstReg, arg.value.i8);
+                break;
+            case ArgType::Word:
+                MovRegImm32(dstReg, arg.value.i16);
+                break;
+            case ArgType::DWord:
+                MovRegImm32(dstReg, arg.value.i32);
+                break;
+            case ArgType::QWord:
+            case ArgType::Ptr:
+                MovRegImm64(dstReg, arg.value.i64);
+                break;
+            case ArgType::StackPtr:
+                break; // handled above
+            case ArgType::Float:
+                MovSSRegImm32(dstReg, arg.value.f32);
+                break;
+            case ArgType::Double:
+                MovSDRegImm64(dstReg, arg.value.f64);
+                break;
+        }
+    }
+}
+
+// Moves the specified argument onto the stack at the specified displacement relative to RSP.
+void AMD64Assembler::MovArgStack(const Arg& arg, const Displacement& disp)
+{
+    if (arg.param < 0xF)
+    {
+        if (arg.param < varArgDisp_.size())
+        {
+            /* Copy parameter from local stack; floating-point parameters are copied by their lower 64 bits */
+            MovRegMem(g_amd64TempReg, Reg::RBP, varArgDisp_[arg.param]);
+            MovMemReg(Reg::RSP, g_amd64TempReg, disp);
+        }
+    }
+    else
+    {
+        switch (arg.type)
+        {
+            case ArgType::Byte:
+            case ArgType::Word:
+            case ArgType::DWord:
+            case ArgType::Float:
+                MovMemImm32(Reg::RSP, arg.value.i32, disp);
+                break;
+            case ArgType::QWord:
+            case ArgType::Ptr:
+            case ArgType::Double:
+                MovRegImm64(g_amd64TempReg, arg.value.i64);
+                MovMemReg(Reg::RSP, g_amd64TempReg, disp);
+                break;
+            case ArgType::StackPtr:
+                MovReg(g_amd64TempReg, Reg::RBP);
+                SubImm32(g_amd64TempReg, stackChunkOffsets_[arg.value.i8]);
+                MovMemReg(Reg::RSP, g_amd64TempReg, disp);
+                break;
+        }
+    }
+}
+
 void AMD64Assembler::WriteOptREX(Reg reg, bool defaultsTo64Bit)
 {
     std::uint8_t prefix = 0;
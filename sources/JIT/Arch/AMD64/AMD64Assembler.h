@@ -51,6 +51,9 @@ class AMD64Assembler final : public JITCompiler
             const std::vector<std::uint32_t>&   stackChunks
         );
 
+        void MovArgReg(Reg dstReg, const Arg& arg);
+        void MovArgStack(const Arg& arg, const Displacement& disp);
+
         void WriteOptREX(Reg reg, bool defaultsTo64Bit = false);
         void WriteOptDisp(const Displacement& disp);
         void WriteOptSIB(Reg reg);
@@ -142,9 +145,7 @@ class AMD64Assembler final : public JITCompiler
 
     private:
 
-        std::uint32_t           	localStackSize_ = 0;
-        std::uint16_t               paramStackSize_ = 0;
-        Displacement                argStackBase_;
+        std::uint32_t               localStackSize_ = 0;
 
         // Supplement data that must be updated after encoding
         std::vector<Supplement>     supplements_;
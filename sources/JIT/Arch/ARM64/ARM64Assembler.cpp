@@ -0,0 +1,426 @@
+/*
+ * ARM64Assembler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ARM64Assembler.h"
+#include "ARM64Opcode.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+/*
+ * Internal members
+ */
+
+/*
+List of registers that are used for the first couple of arguments.
+Procedure Call Standard for the Arm 64-bit Architecture (AAPCS64); this is shared by Linux, Android, Windows, and Apple platforms.
+see https://github.com/ARM-software/abi-aa/blob/main/aapcs64/aapcs64.rst
+Preserved for caller: X19-X29, D8-D15
+*/
+static const Reg g_arm64IntParams[] = { Reg::X0, Reg::X1, Reg::X2, Reg::X3, Reg::X4, Reg::X5, Reg::X6, Reg::X7 };
+static const Reg g_arm64FltParams[] = { Reg::D0, Reg::D1, Reg::D2, Reg::D3, Reg::D4, Reg::D5, Reg::D6, Reg::D7 };
+static const Reg g_arm64TempReg     = Reg::X9;
+static const Reg g_arm64CallReg     = Reg::X16;
+
+static constexpr std::size_t g_arm64IntParamsCount = sizeof(g_arm64IntParams)/sizeof(g_arm64IntParams[0]);
+static constexpr std::size_t g_arm64FltParamsCount = sizeof(g_arm64FltParams)/sizeof(g_arm64FltParams[0]);
+
+// Size (in bytes) of the area at the bottom of the local stack that is reserved for arguments of subsequent calls.
+static constexpr std::uint32_t g_arm64ArgStackSize = 128;
+
+
+/*
+ * Internal functions
+ */
+
+// Size of byte (1), word (2), dword (4), qword (8), ptr (8), stack-ptr (8), float (4), double (8)
+static std::uint32_t GetArgSize(const ArgType t)
+{
+    switch (t)
+    {
+        case ArgType::Byte:     return 1;
+        case ArgType::Word:     return 2;
+        case ArgType::DWord:    return 4;
+        case ArgType::QWord:    return 8;
+        case ArgType::Ptr:      return 8;
+        case ArgType::StackPtr: return 8;
+        case ArgType::Float:    return 4;
+        case ArgType::Double:   return 8;
+    }
+    LLGL_UNREACHABLE();
+    return 0;
+}
+
+// Returns the size (in bytes) an argument of the specified type occupies on the stack.
+static std::uint32_t GetStackArgSize(const ArgType t)
+{
+    #ifdef __APPLE__
+    /* Apple's ARM64 ABI packs stack arguments with their natural size and alignment */
+    return GetArgSize(t);
+    #else
+    /* AAPCS64 rounds up each stack argument to 8 bytes */
+    return 8;
+    #endif
+}
+
+
+/*
+ * ARM64Assembler class
+ */
+
+void ARM64Assembler::Begin()
+{
+    /* Write entry point prologue */
+    WritePrologue();
+    WriteStackFrame(GetEntryVarArgs(), GetStackAllocs());
+}
+
+void ARM64Assembler::End()
+{
+    /* Write entry point epilogue; this also pops the local stack */
+    WriteEpilogue();
+}
+
+void ARM64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farCall)
+{
+    const auto& args = GetArgs();
+
+    /* Move first couple of arguments into registers and all remaining arguments onto the stack in order of the parameter list */
+    std::size_t numIntRegs = 0, numFltRegs = 0;
+    std::uint32_t stackOffset = 0;
+
+    for (const JIT::Arg& arg : args)
+    {
+        const bool isFloat = IsFloat(arg.type);
+
+        if (isFloat && numFltRegs < g_arm64FltParamsCount)
+            MovArgReg(g_arm64FltParams[numFltRegs++], arg);
+        else if (!isFloat && numIntRegs < g_arm64IntParamsCount)
+            MovArgReg(g_arm64IntParams[numIntRegs++], arg);
+        else
+        {
+            /* Stack arguments must fit into the reserved area at the bottom of the local stack */
+            const std::uint32_t argSize = GetStackArgSize(arg.type);
+            stackOffset = GetAlignedSize(stackOffset, argSize);
+            if (stackOffset + argSize > g_arm64ArgStackSize)
+            {
+                Invalidate();
+                return;
+            }
+
+            /* Store argument via temporary register; floating-point values are copied by their bit pattern */
+            MovArgReg(g_arm64TempReg, arg);
+            Str(g_arm64TempReg, Reg::SP, stackOffset, argSize);
+            stackOffset += argSize;
+        }
+    }
+
+    /* Write 'blr' instruction with intra-procedure-call register */
+    MovRegImm64(g_arm64CallReg, reinterpret_cast<std::uint64_t>(addr));
+    Blr(g_arm64CallReg);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool ARM64Assembler::IsLittleEndian() const
+{
+    return true;
+}
+
+void ARM64Assembler::WritePrologue()
+{
+    /* Store frame pointer (X29) and link register (X30), and set up new frame pointer */
+    StpPreIdx(Reg::X29, Reg::X30, Reg::SP, -16);
+    AddImm12(Reg::X29, Reg::SP, 0);
+}
+
+void ARM64Assembler::WriteEpilogue()
+{
+    /* Restore stack pointer from frame pointer, then restore frame pointer (X29) and link register (X30) */
+    AddImm12(Reg::SP, Reg::X29, 0);
+    LdpPostIdx(Reg::X29, Reg::X30, Reg::SP, 16);
+    Ret();
+}
+
+void ARM64Assembler::WriteStackFrame(
+    const std::vector<JIT::ArgType>&    varArgTypes,
+    const std::vector<std::uint32_t>&   stackChunks)
+{
+    /*
+    Determine stack layout relative to SP:
+    reserved area for arguments of subsequent calls, followed by the variadic arguments (8 bytes each) and the stack chunks (16-byte aligned).
+    */
+    std::uint32_t offset = g_arm64ArgStackSize;
+
+    varArgOffsets_.reserve(varArgTypes.size());
+    for (std::size_t i = 0; i < varArgTypes.size(); ++i)
+    {
+        varArgOffsets_.push_back(offset);
+        offset += 8;
+    }
+
+    offset = GetAlignedSize(offset, 16u);
+
+    stackChunkOffsets_.reserve(stackChunks.size());
+    for (std::uint32_t chunk : stackChunks)
+    {
+        stackChunkOffsets_.push_back(offset);
+        offset += GetAlignedSize(chunk, 16u);
+    }
+
+    /* Allocate local stack; SP must always be 16-byte aligned */
+    SubSPImm(GetAlignedSize(offset, 16u));
+
+    /* Store parameters in local stack */
+    std::size_t numIntRegs = 0, numFltRegs = 0;
+
+    for (std::size_t i = 0; i < varArgTypes.size(); ++i)
+    {
+        if (IsFloat(varArgTypes[i]))
+        {
+            if (numFltRegs < g_arm64FltParamsCount)
+                Str(g_arm64FltParams[numFltRegs++], Reg::SP, varArgOffsets_[i]);
+            else
+                Invalidate(); // Entry point parameters on the stack are not supported
+        }
+        else
+        {
+            if (numIntRegs < g_arm64IntParamsCount)
+                Str(g_arm64IntParams[numIntRegs++], Reg::SP, varArgOffsets_[i]);
+            else
+                Invalidate(); // Entry point parameters on the stack are not supported
+        }
+    }
+}
+
+// Moves the specified argument into the destination register.
+void ARM64Assembler::MovArgReg(Reg dstReg, const Arg& arg)
+{
+    if (arg.param < 0xF)
+    {
+        /* Load parameter from local stack into destination register */
+        if (arg.param < varArgOffsets_.size())
+            Ldr(dstReg, Reg::SP, varArgOffsets_[arg.param]);
+    }
+    else if (arg.type == ArgType::StackPtr)
+    {
+        /* Compute address of stack chunk relative to stack pointer */
+        MovRegSPOffset(dstReg, stackChunkOffsets_[arg.value.i8]);
+    }
+    else if (IsFltReg(dstReg))
+    {
+        /* Move bit pattern of floating-point value into SIMD&FP register via temporary register */
+        if (arg.type == ArgType::Float)
+        {
+            MovRegImm64(g_arm64TempReg, arg.value.i32);
+            FMov(dstReg, g_arm64TempReg, false);
+        }
+        else
+        {
+            MovRegImm64(g_arm64TempReg, arg.value.i64);
+            FMov(dstReg, g_arm64TempReg, true);
+        }
+    }
+    else
+    {
+        /* Move value into destination register (arguments of less than 64 bits are zero-extended) */
+        switch (arg.type)
+        {
+            case ArgType::Byte:
+                MovRegImm64(dstReg, arg.value.i8);
+                break;
+            case ArgType::Word:
+                MovRegImm64(dstReg, arg.value.i16);
+                break;
+            case ArgType::DWord:
+            case ArgType::Float:
+                MovRegImm64(dstReg, arg.value.i32);
+                break;
+            case ArgType::QWord:
+            case ArgType::Ptr:
+            case ArgType::Double:
+                MovRegImm64(dstReg, arg.value.i64);
+                break;
+            case ArgType::StackPtr:
+                break; // handled above
+        }
+    }
+}
+
+void ARM64Assembler::WriteInstr(std::uint32_t instr)
+{
+    WriteDWord(instr);
+}
+
+/* ----- MOV ----- */
+
+// Encodes a sequence of MOVZ/MOVK instructions for each non-zero 16-bit part of the immediate value.
+void ARM64Assembler::MovRegImm64(Reg dstReg, std::uint64_t qword)
+{
+    bool isFirst = true;
+
+    for (std::uint32_t hw = 0; hw < 4; ++hw)
+    {
+        const auto imm16 = static_cast<std::uint16_t>((qword >> (hw * 16)) & 0xFFFF);
+        if (imm16 != 0)
+        {
+            if (isFirst)
+                MovZ(dstReg, imm16, hw);
+            else
+                MovK(dstReg, imm16, hw);
+            isFirst = false;
+        }
+    }
+
+    if (isFirst)
+        MovZ(dstReg, 0, 0);
+}
+
+// Computes the address SP+offset for offsets of up to 24 bits.
+void ARM64Assembler::MovRegSPOffset(Reg dstReg, std::uint32_t offset)
+{
+    if (offset >= (1u << 24))
+    {
+        Invalidate();
+        return;
+    }
+
+    AddImm12(dstReg, Reg::SP, offset & 0xFFF);
+    if (offset > 0xFFF)
+        AddImm12(dstReg, dstReg, offset >> 12, true);
+}
+
+// Opcode: MOVZ Xd, #imm16, LSL #(hw*16)
+void ARM64Assembler::MovZ(Reg dstReg, std::uint16_t imm16, std::uint32_t hw)
+{
+    WriteInstr(Opcode_MovZ | (hw << 21) | (static_cast<std::uint32_t>(imm16) << 5) | RegIndex(dstReg));
+}
+
+// Opcode: MOVK Xd, #imm16, LSL #(hw*16)
+void ARM64Assembler::MovK(Reg dstReg, std::uint16_t imm16, std::uint32_t hw)
+{
+    WriteInstr(Opcode_MovK | (hw << 21) | (static_cast<std::uint32_t>(imm16) << 5) | RegIndex(dstReg));
+}
+
+// Opcode: FMOV Sd, Wn or FMOV Dd, Xn
+void ARM64Assembler::FMov(Reg dstReg, Reg srcReg, bool is64Bit)
+{
+    WriteInstr((is64Bit ? Opcode_FMovDX : Opcode_FMovSW) | (RegIndex(srcReg) << 5) | RegIndex(dstReg));
+}
+
+/* ----- ADD/SUB ----- */
+
+// Opcode: ADD Xd, Xn, #imm12{, LSL #12}; register number 31 denotes SP
+void ARM64Assembler::AddImm12(Reg dstReg, Reg srcReg, std::uint32_t imm12, bool lsl12)
+{
+    WriteInstr(Opcode_AddImm | (lsl12 ? Operand_LSL12 : 0u) | ((imm12 & 0xFFF) << 10) | (RegIndex(srcReg) << 5) | RegIndex(dstReg));
+}
+
+// Opcode: SUB Xd, Xn, #imm12{, LSL #12}; register number 31 denotes SP
+void ARM64Assembler::SubImm12(Reg dstReg, Reg srcReg, std::uint32_t imm12, bool lsl12)
+{
+    WriteInstr(Opcode_SubImm | (lsl12 ? Operand_LSL12 : 0u) | ((imm12 & 0xFFF) << 10) | (RegIndex(srcReg) << 5) | RegIndex(dstReg));
+}
+
+void ARM64Assembler::SubSPImm(std::uint32_t imm)
+{
+    if (imm >= (1u << 24))
+    {
+        Invalidate();
+        return;
+    }
+
+    if (imm > 0xFFF)
+        SubImm12(Reg::SP, Reg::SP, imm >> 12, true);
+    if ((imm & 0xFFF) != 0)
+        SubImm12(Reg::SP, Reg::SP, imm & 0xFFF);
+}
+
+/* ----- LDR/STR ----- */
+
+// Opcode: STRB/STRH/STR Wt, STR Xt, or STR Dt with unsigned offset scaled by the operand size
+void ARM64Assembler::Str(Reg srcReg, Reg dstMemReg, std::uint32_t offset, std::uint32_t size)
+{
+    if (offset % size != 0 || offset / size > 0xFFF)
+    {
+        Invalidate();
+        return;
+    }
+
+    std::uint32_t opcode = 0;
+    switch (size)
+    {
+        case 1: opcode = Opcode_StrB; break;
+        case 2: opcode = Opcode_StrH; break;
+        case 4: opcode = Opcode_StrW; break;
+        default: opcode = (IsFltReg(srcReg) ? Opcode_StrD : Opcode_StrX); break;
+    }
+
+    WriteInstr(opcode | ((offset / size) << 10) | (RegIndex(dstMemReg) << 5) | RegIndex(srcReg));
+}
+
+// Opcode: LDR Xt or LDR Dt with unsigned offset scaled by 8
+void ARM64Assembler::Ldr(Reg dstReg, Reg srcMemReg, std::uint32_t offset)
+{
+    if (offset % 8 != 0 || offset / 8 > 0xFFF)
+    {
+        Invalidate();
+        return;
+    }
+
+    const std::uint32_t opcode = (IsFltReg(dstReg) ? Opcode_LdrD : Opcode_LdrX);
+    WriteInstr(opcode | ((offset / 8) << 10) | (RegIndex(srcMemReg) << 5) | RegIndex(dstReg));
+}
+
+/* ----- LDP/STP ----- */
+
+// Opcode: STP Xt, Xt2, [Xn, #imm7*8]!
+void ARM64Assembler::StpPreIdx(Reg srcReg0, Reg srcReg1, Reg dstMemReg, std::int32_t offset)
+{
+    const auto imm7 = static_cast<std::uint32_t>(offset / 8) & 0x7F;
+    WriteInstr(Opcode_StpPreIdx | (imm7 << 15) | (RegIndex(srcReg1) << 10) | (RegIndex(dstMemReg) << 5) | RegIndex(srcReg0));
+}
+
+// Opcode: LDP Xt, Xt2, [Xn], #imm7*8
+void ARM64Assembler::LdpPostIdx(Reg dstReg0, Reg dstReg1, Reg srcMemReg, std::int32_t offset)
+{
+    const auto imm7 = static_cast<std::uint32_t>(offset / 8) & 0x7F;
+    WriteInstr(Opcode_LdpPostIdx | (imm7 << 15) | (RegIndex(dstReg1) << 10) | (RegIndex(srcMemReg) << 5) | RegIndex(dstReg0));
+}
+
+/* ----- BLR/RET ----- */
+
+// Opcode: BLR Xn
+void ARM64Assembler::Blr(Reg reg)
+{
+    WriteInstr(Opcode_Blr | (RegIndex(reg) << 5));
+}
+
+// Opcode: RET X30
+void ARM64Assembler::Ret()
+{
+    WriteInstr(Opcode_Ret | (RegIndex(Reg::X30) << 5));
+}
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
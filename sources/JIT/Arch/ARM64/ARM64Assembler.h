@@ -0,0 +1,96 @@
+/*
+ * ARM64Assembler.h
+ * 
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_ASSEMBLER_H
+#define LLGL_ARM64_ASSEMBLER_H
+
+
+#include "ARM64Register.h"
+#include "../../JITCompiler.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+// ARM64 (a.k.a. AArch64) assembly code generator.
+class ARM64Assembler final : public JITCompiler
+{
+
+    public:
+
+        void Begin() override;
+        void End() override;
+
+    private:
+
+        bool IsLittleEndian() const override;
+        void WriteFuncCall(const void* addr, JITCallConv conv, bool farCall) override;
+
+    private:
+
+        void WritePrologue();
+        void WriteEpilogue();
+
+        void WriteStackFrame(
+            const std::vector<JIT::ArgType>&    varArgTypes,
+            const std::vector<std::uint32_t>&   stackChunks
+        );
+
+        void MovArgReg(Reg dstReg, const Arg& arg);
+
+        void WriteInstr(std::uint32_t instr);
+
+    private:
+
+        void MovRegImm64(Reg dstReg, std::uint64_t qword);
+        void MovRegSPOffset(Reg dstReg, std::uint32_t offset);
+
+        void AddImm12(Reg dstReg, Reg srcReg, std::uint32_t imm12, bool lsl12 = false);
+        void SubImm12(Reg dstReg, Reg srcReg, std::uint32_t imm12, bool lsl12 = false);
+        void SubSPImm(std::uint32_t imm);
+
+        void MovZ(Reg dstReg, std::uint16_t imm16, std::uint32_t hw);
+        void MovK(Reg dstReg, std::uint16_t imm16, std::uint32_t hw);
+
+        void FMov(Reg dstReg, Reg srcReg, bool is64Bit);
+
+        void Str(Reg srcReg, Reg dstMemReg, std::uint32_t offset, std::uint32_t size = 8);
+        void Ldr(Reg dstReg, Reg srcMemReg, std::uint32_t offset);
+
+        void StpPreIdx(Reg srcReg0, Reg srcReg1, Reg dstMemReg, std::int32_t offset);
+        void LdpPostIdx(Reg dstReg0, Reg dstReg1, Reg srcMemReg, std::int32_t offset);
+
+        void Blr(Reg reg);
+        void Ret();
+
+    private:
+
+        // Stack pointer offsets of the variadic entry point arguments.
+        std::vector<std::uint32_t>  varArgOffsets_;
+
+        // Stack pointer offsets of stack allocations.
+        std::vector<std::uint32_t>  stackChunkOffsets_;
+
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
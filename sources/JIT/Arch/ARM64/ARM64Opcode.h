@@ -0,0 +1,63 @@
+/*
+ * ARM64Opcode.h
+ * 
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_OPCODE_H
+#define LLGL_ARM64_OPCODE_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+/*
+All ARM64 instructions are 32 bits wide.
+The opcodes below only contain the fixed bits of each instruction; register numbers and immediates are OR'ed into their respective fields:
+Rd/Rt at bits [4:0], Rn at bits [9:5], Rt2 at bits [14:10], imm12 at bits [21:10], imm7 at bits [21:15], imm16 at bits [20:5].
+*/
+
+enum Opcode : std::uint32_t
+{
+    Opcode_AddImm       = 0x91000000, // ADD Xd, Xn, #imm12{, LSL #12}
+    Opcode_SubImm       = 0xD1000000, // SUB Xd, Xn, #imm12{, LSL #12}
+    Opcode_MovZ         = 0xD2800000, // MOVZ Xd, #imm16{, LSL #(hw*16)}
+    Opcode_MovK         = 0xF2800000, // MOVK Xd, #imm16{, LSL #(hw*16)}
+    Opcode_StrB         = 0x39000000, // STRB Wt, [Xn, #imm12]
+    Opcode_StrH         = 0x79000000, // STRH Wt, [Xn, #imm12*2]
+    Opcode_StrW         = 0xB9000000, // STR Wt, [Xn, #imm12*4]
+    Opcode_StrX         = 0xF9000000, // STR Xt, [Xn, #imm12*8]
+    Opcode_LdrX         = 0xF9400000, // LDR Xt, [Xn, #imm12*8]
+    Opcode_StrD         = 0xFD000000, // STR Dt, [Xn, #imm12*8]
+    Opcode_LdrD         = 0xFD400000, // LDR Dt, [Xn, #imm12*8]
+    Opcode_StpPreIdx    = 0xA9800000, // STP Xt, Xt2, [Xn, #imm7*8]!
+    Opcode_LdpPostIdx   = 0xA8C00000, // LDP Xt, Xt2, [Xn], #imm7*8
+    Opcode_FMovSW       = 0x1E270000, // FMOV Sd, Wn
+    Opcode_FMovDX       = 0x9E670000, // FMOV Dd, Xn
+    Opcode_Blr          = 0xD63F0000, // BLR Xn
+    Opcode_Ret          = 0xD65F0000, // RET Xn
+};
+
+enum OperandBits : std::uint32_t
+{
+    Operand_LSL12       = 0x00400000, // Shift 12-bit immediate of ADD/SUB by 12 bits
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
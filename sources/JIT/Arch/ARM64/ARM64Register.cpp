@@ -0,0 +1,68 @@
+/*
+ * ARM64Register.cpp
+ * 
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ARM64Register.h"
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+std::uint32_t RegIndex(const Reg reg)
+{
+    switch (reg)
+    {
+        case Reg::X0:   return 0;
+        case Reg::X1:   return 1;
+        case Reg::X2:   return 2;
+        case Reg::X3:   return 3;
+        case Reg::X4:   return 4;
+        case Reg::X5:   return 5;
+        case Reg::X6:   return 6;
+        case Reg::X7:   return 7;
+        case Reg::X8:   return 8;
+        case Reg::X9:   return 9;
+        case Reg::X10:  return 10;
+        case Reg::X11:  return 11;
+        case Reg::X12:  return 12;
+        case Reg::X13:  return 13;
+        case Reg::X14:  return 14;
+        case Reg::X15:  return 15;
+        case Reg::X16:  return 16;
+        case Reg::X17:  return 17;
+        case Reg::X29:  return 29;
+        case Reg::X30:  return 30;
+        case Reg::SP:   return 31;
+
+        case Reg::D0:   return 0;
+        case Reg::D1:   return 1;
+        case Reg::D2:   return 2;
+        case Reg::D3:   return 3;
+        case Reg::D4:   return 4;
+        case Reg::D5:   return 5;
+        case Reg::D6:   return 6;
+        case Reg::D7:   return 7;
+    }
+    return 0xFF;
+}
+
+bool IsFltReg(const Reg reg)
+{
+    return (reg >= Reg::D0 && reg <= Reg::D7);
+}
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
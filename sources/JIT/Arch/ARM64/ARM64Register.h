@@ -0,0 +1,73 @@
+/*
+ * ARM64Register.h
+ * 
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_REGISTER_H
+#define LLGL_ARM64_REGISTER_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+// ARM64 (a.k.a. AArch64) register enumeration.
+enum class Reg
+{
+    X0,
+    X1,
+    X2,
+    X3,
+    X4,
+    X5,
+    X6,
+    X7,
+    X8,
+    X9,
+    X10,
+    X11,
+    X12,
+    X13,
+    X14,
+    X15,
+    X16, // IP0
+    X17, // IP1
+    X29, // FP
+    X30, // LR
+    SP,
+
+    D0,
+    D1,
+    D2,
+    D3,
+    D4,
+    D5,
+    D6,
+    D7,
+};
+
+// Returns the 5-bit register number of the specified register as it is encoded in ARM64 instructions.
+std::uint32_t RegIndex(const Reg reg);
+
+// Returns true, if 'reg' denotes a floating-point register (i.e. D0-D7).
+bool IsFltReg(const Reg reg);
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
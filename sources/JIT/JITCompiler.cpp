@@ -20,12 +20,10 @@
 #   include "Platform/POSIX/POSIXJITProgram.h"
 #endif
 
-#if defined LLGL_ARCH_ARM
-//#   include "Arch/ARM/ARMAssembler.h"
+#if defined LLGL_ARCH_ARM64
+#   include "Arch/ARM64/ARM64Assembler.h"
 #elif defined LLGL_ARCH_AMD64
 #   include "Arch/AMD64/AMD64Assembler.h"
-#elif defined LLGL_ARCH_IA32
-#   include "Arch/IA32/IA32Assembler.h"
 #endif
 
 
@@ -39,13 +37,14 @@ std::unique_ptr<JITCompiler> JITCompiler::Create()
 {
     std::unique_ptr<JITCompiler> compiler;
 
-    /* Create JIT compiler for current CPU architecture */
-    #if defined LLGL_ARCH_ARM
-    //TODO
+    /*
+    Create JIT compiler for current CPU architecture.
+    The IA-32 assembler is incomplete, so callers fall back to their emulated execution on all other architectures.
+    */
+    #if defined LLGL_ARCH_ARM64
+    compiler = MakeUnique<ARM64Assembler>();
     #elif defined LLGL_ARCH_AMD64
     compiler = MakeUnique<AMD64Assembler>();
-    #elif defined LLGL_ARCH_IA32
-    compiler = MakeUnique<IA32Assembler>();
     #endif
 
     /* Store meta data */
@@ -73,6 +72,13 @@ UTF8String JITCompiler::DumpAssembly(std::size_t bytesPerLine) const
 
 std::unique_ptr<JITProgram> JITCompiler::FlushProgram()
 {
+    if (invalid_)
+    {
+        /* Discard program that could not be encoded entirely */
+        assembly_.clear();
+        invalid_ = false;
+        return nullptr;
+    }
     if (!assembly_.empty())
     {
         auto program = JITProgram::Create(assembly_.data(), assembly_.size());
@@ -230,6 +236,11 @@ void JITCompiler::PushSSizeT(std::int64_t value)
  * ======= Protected: =======
  */
 
+void JITCompiler::Invalidate()
+{
+    invalid_ = true;
+}
+
 void JITCompiler::Write(const void* data, std::size_t size)
 {
     assembly_.reserve(assembly_.size() + size);
@@ -307,6 +318,8 @@ LLGL_EXPORT void TestJIT1()
     #endif
 
     auto comp = JITCompiler::Create();
+    if (!comp)
+        return;
 
     comp->EntryPointVarArgs({ JIT::ArgType::DWord, JIT::ArgType::Float, JIT::ArgType::Double });
 
@@ -351,8 +364,12 @@ LLGL_EXPORT void TestJIT1()
     comp->End();
 
     auto prog = comp->FlushProgram();
+    if (!prog)
+        return;
 
-    prog->GetEntryPoint()(28, 2.3f, 4.5);
+    /* Call entry point with its exact signature, since variadic arguments are passed differently on some ABIs */
+    auto entryPoint = reinterpret_cast<void(*)(int, float, double)>(prog->GetEntryPoint());
+    entryPoint(28, 2.3f, 4.5);
 }
 
 #endif // /LLGL_DEBUG
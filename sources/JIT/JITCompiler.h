@@ -58,14 +58,14 @@ inline const void* GetMemberFuncPtr(T pfn)
     return ptr.addr;
 }
 
-// IA-32 (a.k.a. x86) assembly code generator.
+// Base class for the architecture specific assembly code generators.
 class LLGL_EXPORT JITCompiler : public NonCopyable
 {
 
     public:
 
         /*
-        Instantiates a new JIT compiler for the current hardware architecture (i.e. x86, x64, ARM),
+        Instantiates a new JIT compiler for the current hardware architecture (i.e. x64, ARM64),
         or null if the architecture is not supported.
         */
         static std::unique_ptr<JITCompiler> Create();
@@ -73,7 +73,7 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
         // Dumps the current assembly code to the output stream.
         UTF8String DumpAssembly(std::size_t bytesPerLine = 8) const;
 
-        // Flushes the currently build program, or null if no program was build.
+        // Flushes the currently build program, or null if no program was build or the program could not be encoded entirely.
         std::unique_ptr<JITProgram> FlushProgram();
 
     public:
@@ -150,6 +150,9 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
         virtual bool IsLittleEndian() const = 0;
         virtual void WriteFuncCall(const void* addr, JITCallConv conv, bool farCall) = 0;
 
+        // Marks the current program as invalid, e.g. when a function call cannot be encoded. 'FlushProgram' will return null.
+        void Invalidate();
+
     protected:
 
         void Write(const void* data, std::size_t size);
@@ -216,6 +219,7 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
     private:
 
         bool                        littleEndian_   = false;
+        bool                        invalid_        = false;
         std::vector<std::uint8_t>   assembly_;
 
         std::vector<JIT::Arg>       args_;
@@ -29,7 +29,7 @@ class LLGL_EXPORT JITProgram : public NonCopyable
 
     public:
 
-        // Creates a new JIT program with the specified code.
+        // Creates a new JIT program with the specified code, or null if executable memory is not available on this system.
         static std::unique_ptr<JITProgram> Create(const void* code, std::size_t size);
 
         // Returns the main entry point of the native JIT program.
@@ -7,8 +7,7 @@
 
 #include "POSIXJITProgram.h"
 #include "../../../Core/CoreUtils.h"
-#include <cstdlib>
-#include <stdexcept>
+#include <string.h>
 #include <unistd.h> // sysconf
 #include <sys/mman.h> // mmap
 
@@ -19,35 +18,48 @@ namespace LLGL
 
 std::unique_ptr<JITProgram> JITProgram::Create(const void* code, std::size_t size)
 {
-    return MakeUnique<POSIXJITProgram>(code, size);
-}
+    const std::size_t alignedSize = GetAlignedSize(size, std::size_t(sysconf(_SC_PAGE_SIZE)));
 
-POSIXJITProgram::POSIXJITProgram(const void* code, std::size_t size) :
-    size_ { GetAlignedSize(size, std::size_t(sysconf(_SC_PAGE_SIZE))) }
-{
-    /* Map executable memory space */
-    addr_ = ::mmap(
+    /* Map writable virtual memory; it is made executable only after the code has been copied */
+    void* addr = ::mmap(
         nullptr,
-        size_,
-        (PROT_READ | PROT_WRITE | PROT_EXEC),
+        alignedSize,
+        (PROT_READ | PROT_WRITE),
         (MAP_PRIVATE | MAP_ANONYMOUS),
         -1, // must be -1 if MAP_ANONYMOUS is used
         0
     );
 
-    if (addr_ == MAP_FAILED)
-        throw std::runtime_error("failed to map executable virtual memory with read/write protection mode");
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    /* Copy code into mapped memory space */
+    ::memcpy(addr, code, size);
+
+    /* Make memory executable; this can fail if the system enforces W^X policies, in which case the caller falls back to emulation */
+    if (::mprotect(addr, alignedSize, (PROT_READ | PROT_EXEC)) != 0)
+    {
+        ::munmap(addr, alignedSize);
+        return nullptr;
+    }
 
-    /* Copy code into executable memory space */
-    ::memcpy(addr_, code, size);
+    /* Synchronize instruction cache with the new code (required on architectures without coherent instruction cache, e.g. ARM) */
+    __builtin___clear_cache(static_cast<char*>(addr), static_cast<char*>(addr) + size);
 
+    return MakeUnique<POSIXJITProgram>(addr, alignedSize);
+}
+
+POSIXJITProgram::POSIXJITProgram(void* addr, std::size_t size) :
+    addr_ { addr },
+    size_ { size }
+{
     /* Set function pointer to executable memory address */
     SetEntryPoint(addr_);
 }
 
-POSIXJITProgram::POSIXJITProgram()
+POSIXJITProgram::~POSIXJITProgram()
 {
-    munmap(addr_, size_);
+    ::munmap(addr_, size_);
 }
 
 
@@ -22,8 +22,9 @@ class LLGL_EXPORT POSIXJITProgram : public JITProgram
 
     public:
 
-        POSIXJITProgram(const void* code, std::size_t size);
-        POSIXJITProgram();
+        // Takes ownership of the specified executable memory that was mapped by 'JITProgram::Create'.
+        POSIXJITProgram(void* addr, std::size_t size);
+        ~POSIXJITProgram();
 
     private:
 
@@ -7,9 +7,7 @@
 
 #include "Win32JITProgram.h"
 #include "../../../Core/CoreUtils.h"
-#include <cstdlib>
-#include <stdexcept>
-#include <string>
+#include <string.h>
 
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -21,25 +19,32 @@ namespace LLGL
 
 std::unique_ptr<JITProgram> JITProgram::Create(const void* code, std::size_t size)
 {
-    return MakeUnique<Win32JITProgram>(code, size);
-}
+    /* Allocate chunk of writable memory; it is made executable only after the code has been copied */
+    void* addr = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (addr == NULL)
+        return nullptr;
 
-Win32JITProgram::Win32JITProgram(const void* code, std::size_t size) :
-    size_ { size }
-{
-    /* Allocate chunk of executable memory */
-    addr_ = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-    if (addr_ == 0)
-        throw std::runtime_error("failed to allocate " + std::to_string(size) + " byte(s) of executable memory");
+    /* Copy assembly code to allocated memory space */
+    ::memcpy(addr, code, size);
 
-    /* Copy assembly code to executable memory space */
-    ::memcpy(addr_, code, size);
-
-    /* Make assembly buffer executable */
+    /* Make assembly buffer executable; this can fail if dynamic code is prohibited for this process, in which case the caller falls back to emulation */
     DWORD oldProtect = 0;
-    if (VirtualProtect(addr_, size, PAGE_EXECUTE_READ, &oldProtect) == 0)
-        throw std::runtime_error("failed to change virtual memory protection");
+    if (VirtualProtect(addr, size, PAGE_EXECUTE_READ, &oldProtect) == 0)
+    {
+        VirtualFree(addr, 0, MEM_RELEASE);
+        return nullptr;
+    }
+
+    /* Synchronize instruction cache with the new code (required on ARM64) */
+    FlushInstructionCache(GetCurrentProcess(), addr, size);
 
+    return MakeUnique<Win32JITProgram>(addr, size);
+}
+
+Win32JITProgram::Win32JITProgram(void* addr, std::size_t size) :
+    addr_ { addr },
+    size_ { size }
+{
     /* Set function pointer to executable memory address */
     SetEntryPoint(addr_);
 }
@@ -24,7 +24,8 @@ class LLGL_EXPORT Win32JITProgram : public JITProgram
 
     public:
 
-        Win32JITProgram(const void* code, std::size_t size);
+        // Takes ownership of the specified executable memory that was allocated by 'JITProgram::Create'.
+        Win32JITProgram(void* addr, std::size_t size);
         ~Win32JITProgram();
 
     private:
@@ -19,10 +19,34 @@ namespace LLGL
  * Surface class
  */
 
+// Canvas that receives the surface events of the native window and the client's app command callback while events are processed.
+static AndroidCanvas*   g_activeCanvas                              = nullptr;
+static void             (*g_clientOnAppCmd)(android_app*, int32_t)  = nullptr;
+
+static void AndroidCanvasAppCmdCallback(android_app* app, int32_t cmd)
+{
+    /*
+    Notify canvas before the client receives APP_CMD_TERM_WINDOW, since the native window is still valid during this command,
+    and notify canvas after the client received APP_CMD_INIT_WINDOW, since the native window is already set during this command.
+    */
+    if (cmd == APP_CMD_TERM_WINDOW && g_activeCanvas != nullptr)
+        g_activeCanvas->PostDestroySurface();
+
+    if (g_clientOnAppCmd != nullptr)
+        g_clientOnAppCmd(app, cmd);
+
+    if (cmd == APP_CMD_INIT_WINDOW && g_activeCanvas != nullptr)
+        g_activeCanvas->PostInitSurface();
+}
+
 bool Surface::ProcessEvents()
 {
     if (android_app* app = AndroidApp::Get().GetState())
     {
+        /* Intercept app commands to post surface events to the active canvas */
+        g_clientOnAppCmd = app->onAppCmd;
+        app->onAppCmd = AndroidCanvasAppCmdCallback;
+
         /* Poll all Android app events */
         int ident = 0, events = 0;
         android_poll_source* source = nullptr;
@@ -41,9 +65,14 @@ bool Surface::ProcessEvents()
 
             /* Check if we are exiting */
             if (app->destroyRequested != 0)
-                return false;
+                break;
         }
-        return true;
+
+        /* Restore client callback */
+        app->onAppCmd = g_clientOnAppCmd;
+        g_clientOnAppCmd = nullptr;
+
+        return (app->destroyRequested == 0);
     }
     return false;
 }
@@ -77,21 +106,24 @@ static Extent2D GetAndroidContentRect()
  */
 
 AndroidCanvas::AndroidCanvas(const CanvasDescriptor& desc) :
-    desc_   { desc                                 },
-    window_ { AndroidApp::Get().GetState()->window }
+    desc_ { desc }
 {
+    g_activeCanvas = this;
 }
 
 AndroidCanvas::~AndroidCanvas()
 {
+    if (g_activeCanvas == this)
+        g_activeCanvas = nullptr;
 }
 
 bool AndroidCanvas::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
     if (nativeHandle != nullptr && nativeHandleSize == sizeof(NativeHandle))
     {
+        /* Always return the current native window, since it is recreated when the app is resumed */
         auto* handle = reinterpret_cast<NativeHandle*>(nativeHandle);
-        handle->window = window_;
+        handle->window = AndroidApp::Get().GetState()->window;
         return true;
     }
     return false;
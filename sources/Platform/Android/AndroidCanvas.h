@@ -37,7 +37,6 @@ class AndroidCanvas : public Canvas
     private:
 
         CanvasDescriptor    desc_;
-        ANativeWindow*      window_         = nullptr;
         Extent2D            contentSize_;
 
 };
@@ -0,0 +1,30 @@
+/*
+ * AndroidDriverStamp.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../DriverStamp.h"
+#include <sys/system_properties.h>
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT std::string GetGraphicsDriverStamp()
+{
+    /* Graphics drivers are updated with the system image, which is identified by its build fingerprint */
+    char fingerprint[PROP_VALUE_MAX] = {};
+    if (::__system_property_get("ro.build.fingerprint", fingerprint) > 0)
+        return fingerprint;
+    return "";
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
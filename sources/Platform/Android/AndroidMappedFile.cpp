@@ -0,0 +1,68 @@
+/*
+ * AndroidMappedFile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "AndroidMappedFile.h"
+#include "../../Core/CoreUtils.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    std::unique_ptr<AndroidMappedFile> file = MakeUnique<AndroidMappedFile>(filename);
+    return (file->IsValid() ? std::move(file) : nullptr);
+}
+
+AndroidMappedFile::AndroidMappedFile(const char* filename)
+{
+    int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return;
+
+    /* Map entire file; the mapping remains valid after the file descriptor has been closed */
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        void* data = ::mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            data_ = data;
+            size_ = static_cast<std::size_t>(fileStat.st_size);
+        }
+    }
+
+    ::close(fd);
+}
+
+AndroidMappedFile::~AndroidMappedFile()
+{
+    if (data_ != nullptr)
+        ::munmap(data_, size_);
+}
+
+const void* AndroidMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t AndroidMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -59,6 +59,16 @@ void Canvas::EventListener::OnPanGesture(Canvas& sender, const Offset2D& positio
     // dummy
 }
 
+void Canvas::EventListener::OnDestroySurface(Canvas& sender)
+{
+    // dummy
+}
+
+void Canvas::EventListener::OnInitSurface(Canvas& sender)
+{
+    // dummy
+}
+
 
 /* ----- Window class ----- */
 
@@ -146,6 +156,16 @@ void Canvas::PostPanGesture(const Offset2D& position, std::uint32_t numTouches,
     FOREACH_LISTENER_CALL( OnPanGesture(*this, position, numTouches, dx, dy) );
 }
 
+void Canvas::PostDestroySurface()
+{
+    FOREACH_LISTENER_CALL( OnDestroySurface(*this) );
+}
+
+void Canvas::PostInitSurface()
+{
+    FOREACH_LISTENER_CALL( OnInitSurface(*this) );
+}
+
 #undef FOREACH_LISTENER_CALL
 
 
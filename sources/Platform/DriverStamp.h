@@ -0,0 +1,34 @@
+/*
+ * DriverStamp.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DRIVER_STAMP_H
+#define LLGL_DRIVER_STAMP_H
+
+
+#include <LLGL/Export.h>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+Returns a string that identifies the installed graphics adapters and their driver versions as far as the platform can report them without loading a driver.
+This is used to invalidate cached capabilities after a driver update or a GPU swap. Returns an empty string if the platform has no such information.
+*/
+LLGL_EXPORT std::string GetGraphicsDriverStamp();
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,75 @@
+/*
+ * LinuxDriverStamp.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../DriverStamp.h"
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include <dirent.h>
+#include <sys/utsname.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Appends the first line of the specified file to the stamp if the file exists.
+static void AppendFileLine(std::string& stamp, const std::string& filename)
+{
+    std::ifstream file{ filename };
+    std::string line;
+    if (std::getline(file, line))
+    {
+        stamp += line;
+        stamp += ';';
+    }
+}
+
+LLGL_EXPORT std::string GetGraphicsDriverStamp()
+{
+    std::string stamp;
+
+    /* Kernel release identifies the version of in-kernel drivers such as amdgpu and i915 */
+    struct utsname systemName;
+    if (::uname(&systemName) == 0)
+    {
+        stamp += systemName.release;
+        stamp += ';';
+    }
+
+    /* Vendor and device IDs of all DRM cards identify the installed GPUs; connectors such as "card0-DP-1" are skipped */
+    if (DIR* dir = ::opendir("/sys/class/drm"))
+    {
+        std::vector<std::string> cards;
+        while (const dirent* entry = ::readdir(dir))
+        {
+            if (::strncmp(entry->d_name, "card", 4) == 0 && ::strchr(entry->d_name, '-') == nullptr)
+                cards.push_back(entry->d_name);
+        }
+        ::closedir(dir);
+
+        std::sort(cards.begin(), cards.end());
+        for (const std::string& card : cards)
+        {
+            AppendFileLine(stamp, "/sys/class/drm/" + card + "/device/vendor");
+            AppendFileLine(stamp, "/sys/class/drm/" + card + "/device/device");
+        }
+    }
+
+    /* Out-of-tree kernel modules report their own version */
+    AppendFileLine(stamp, "/sys/module/nvidia/version");
+
+    return stamp;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
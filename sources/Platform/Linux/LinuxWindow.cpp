@@ -13,6 +13,13 @@
 #include <exception>
 #include <X11/Xresource.h>
 
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+#   include <LLGL/Utils/ForRange.h>
+#   include <X11/extensions/XInput2.h>
+#   include <cmath>
+#   include <vector>
+#endif
+
 
 namespace LLGL
 {
@@ -88,6 +95,20 @@ bool Surface::ProcessEvents()
     while (XQLength(display))
     {
         XNextEvent(display, &event);
+
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+        /* Raw events are sent to the root window and are not associated with any LLGL window */
+        if (event.type == GenericEvent && event.xcookie.extension == LinuxWindow::GetXInput2Opcode())
+        {
+            if (XGetEventData(display, &event.xcookie))
+            {
+                LinuxWindow::ProcessRawMotionEvent(display, event.xcookie);
+                XFreeEventData(display, &event.xcookie);
+            }
+            continue;
+        }
+        #endif // /LLGL_LINUX_ENABLE_XINPUT2
+
         if (void* userData = LinuxX11Context::Find(display, event.xany.window))
         {
             LinuxWindow* wnd = reinterpret_cast<LinuxWindow*>(userData);
@@ -129,15 +150,30 @@ std::unique_ptr<Window> Window::Create(const WindowDescriptor& desc)
  * LinuxWindow class
  */
 
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+static int                          g_xi2Opcode             = -1;
+static std::vector<LinuxWindow*>    g_rawMotionWindows;
+static double                       g_rawMotionRemainder[2] = { 0.0, 0.0 }; // Sub-pixel motion that has not been posted yet
+
+#endif // /LLGL_LINUX_ENABLE_XINPUT2
+
 LinuxWindow::LinuxWindow(const WindowDescriptor& desc) :
     desc_ { desc }
 {
     OpenX11Window();
     LinuxX11Context::Save(display_, wnd_, this);
+    #ifdef LLGL_LINUX_ENABLE_XINPUT2
+    SelectRawMotionEvents();
+    #endif
 }
 
 LinuxWindow::~LinuxWindow()
 {
+    #ifdef LLGL_LINUX_ENABLE_XINPUT2
+    if (rawMotion_)
+        RemoveFromList(g_rawMotionWindows, this);
+    #endif
     LinuxX11Context::Remove(display_, wnd_);
     XDestroyWindow(display_, wnd_);
 }
@@ -238,6 +274,49 @@ WindowDescriptor LinuxWindow::GetDesc() const
     return desc_; //todo...
 }
 
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+int LinuxWindow::GetXInput2Opcode()
+{
+    return g_xi2Opcode;
+}
+
+void LinuxWindow::ProcessRawMotionEvent(::Display* display, XGenericEventCookie& cookie)
+{
+    if (cookie.evtype != XI_RawMotion)
+        return;
+
+    /* Raw values are only stored for the valuators that are set in the mask; valuators 0 and 1 are the X and Y axes */
+    const XIRawEvent* rawEvent = reinterpret_cast<const XIRawEvent*>(cookie.data);
+    const double* rawValues = rawEvent->raw_values;
+
+    for_range(axis, 2)
+    {
+        if (axis < rawEvent->valuators.mask_len * 8 && XIMaskIsSet(rawEvent->valuators.mask, axis))
+            g_rawMotionRemainder[axis] += *rawValues++;
+    }
+
+    /* Post integral part of motion and keep sub-pixel remainder for the next event */
+    const Offset2D motion
+    {
+        static_cast<std::int32_t>(std::trunc(g_rawMotionRemainder[0])),
+        static_cast<std::int32_t>(std::trunc(g_rawMotionRemainder[1])),
+    };
+
+    if (motion.x != 0 || motion.y != 0)
+    {
+        g_rawMotionRemainder[0] -= motion.x;
+        g_rawMotionRemainder[1] -= motion.y;
+        for (LinuxWindow* wnd : g_rawMotionWindows)
+        {
+            if (wnd->display_ == display)
+                wnd->PostGlobalMotion(motion);
+        }
+    }
+}
+
+#endif // /LLGL_LINUX_ENABLE_XINPUT2
+
 void LinuxWindow::ProcessEvent(XEvent& event)
 {
     switch (event.type)
@@ -427,7 +506,8 @@ void LinuxWindow::ProcessMotionEvent(XMotionEvent& event)
 {
     const Offset2D mousePos { event.x, event.y };
     PostLocalMotion(mousePos);
-    PostGlobalMotion({ mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y });
+    if (!rawMotion_)
+        PostGlobalMotion({ mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y });
     prevMousePos_ = mousePos;
 }
 
@@ -439,6 +519,38 @@ void LinuxWindow::PostMouseKeyEvent(Key key, bool down)
         PostKeyUp(key);
 }
 
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+void LinuxWindow::SelectRawMotionEvents()
+{
+    /* Raw events require XInput 2.0; otherwise, global motion falls back to regular motion events */
+    int xiOpcode = 0, xiEvent = 0, xiError = 0;
+    if (!XQueryExtension(display_, "XInputExtension", &xiOpcode, &xiEvent, &xiError))
+        return;
+
+    int majorVersion = 2, minorVersion = 0;
+    if (XIQueryVersion(display_, &majorVersion, &minorVersion) != Success)
+        return;
+
+    /* Select raw motion of all master devices; raw events are only delivered to the root window */
+    unsigned char maskBits[XIMaskLen(XI_LASTEVENT)] = {};
+    XISetMask(maskBits, XI_RawMotion);
+
+    XIEventMask eventMask;
+    {
+        eventMask.deviceid  = XIAllMasterDevices;
+        eventMask.mask_len  = sizeof(maskBits);
+        eventMask.mask      = maskBits;
+    }
+    XISelectEvents(display_, DefaultRootWindow(display_), &eventMask, 1);
+
+    g_xi2Opcode = xiOpcode;
+    g_rawMotionWindows.push_back(this);
+    rawMotion_ = true;
+}
+
+#endif // /LLGL_LINUX_ENABLE_XINPUT2
+
 
 } // /namespace LLGL
 
@@ -51,6 +51,16 @@ class LinuxWindow : public Window
 
         void ProcessEvent(XEvent& event);
 
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+        // Returns the major opcode of the XInput extension or -1 if raw motion events have not been selected.
+        static int GetXInput2Opcode();
+
+        // Posts an XInput2 raw motion event to all windows of the specified display that receive raw motion.
+        static void ProcessRawMotionEvent(::Display* display, XGenericEventCookie& cookie);
+
+        #endif // /LLGL_LINUX_ENABLE_XINPUT2
+
     private:
 
         void OpenX11Window();
@@ -62,6 +72,10 @@ class LinuxWindow : public Window
         void ProcessMotionEvent(XMotionEvent& event);
 
         void PostMouseKeyEvent(Key key, bool down);
+
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+        void SelectRawMotionEvents();
+        #endif
         
     private:
     
@@ -78,6 +92,7 @@ class LinuxWindow : public Window
         ::Atom                      closeWndAtom_;
         
         Offset2D                    prevMousePos_;
+        bool                        rawMotion_          = false; // True if global motion is taken from XInput2 raw events.
 
 };
 
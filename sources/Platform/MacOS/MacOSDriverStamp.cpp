@@ -0,0 +1,42 @@
+/*
+ * MacOSDriverStamp.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../DriverStamp.h"
+#include <sys/sysctl.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static void AppendSysctlString(std::string& stamp, const char* name)
+{
+    char value[256] = {};
+    std::size_t valueSize = sizeof(value) - 1;
+    if (::sysctlbyname(name, value, &valueSize, nullptr, 0) == 0)
+    {
+        stamp += value;
+        stamp += ';';
+    }
+}
+
+LLGL_EXPORT std::string GetGraphicsDriverStamp()
+{
+    /* Graphics drivers are only updated with the operating system, which is identified by its build version */
+    std::string stamp;
+    AppendSysctlString(stamp, "kern.osversion");
+    AppendSysctlString(stamp, "hw.model");
+    return stamp;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,49 @@
+/*
+ * MappedFile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <memory>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Read-only memory mapped file. The file content is only paged into memory when it is accessed.
+class LLGL_EXPORT MappedFile : public NonCopyable
+{
+
+    public:
+
+        // Maps the specified file into memory. Returns null if the file does not exist, is empty, or cannot be mapped.
+        static std::unique_ptr<MappedFile> Open(const char* filename);
+
+    public:
+
+        // Returns a pointer to the beginning of the mapped file content.
+        virtual const void* GetData() const = 0;
+
+        // Returns the size (in bytes) of the mapped file content.
+        virtual std::size_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,53 @@
+/*
+ * POSIXMappedFile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_POSIX_MAPPED_FILE_H
+#define LLGL_POSIX_MAPPED_FILE_H
+
+
+#include "../MappedFile.h"
+
+
+namespace LLGL
+{
+
+
+class POSIXMappedFile final : public MappedFile
+{
+
+    public:
+
+        POSIXMappedFile(const char* filename);
+        ~POSIXMappedFile() override;
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    public:
+
+        // Returns true if the file has been mapped successfully.
+        inline bool IsValid() const
+        {
+            return (data_ != nullptr);
+        }
+
+    private:
+
+        void*       data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
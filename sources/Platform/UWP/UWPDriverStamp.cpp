@@ -0,0 +1,26 @@
+/*
+ * UWPDriverStamp.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../DriverStamp.h"
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT std::string GetGraphicsDriverStamp()
+{
+    // UWP apps have no access to the driver keys in the system registry
+    return "";
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
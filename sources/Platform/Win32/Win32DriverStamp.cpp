@@ -0,0 +1,61 @@
+/*
+ * Win32DriverStamp.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../DriverStamp.h"
+#include "Win32LeanAndMean.h"
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+// Registry key of the device setup class for display adapters; each subkey is the driver key of one adapter.
+static const char* g_displayAdapterClassKey = "SYSTEM\\CurrentControlSet\\Control\\Class\\{4d36e968-e325-11ce-bfc1-08002be10318}";
+
+static bool AppendRegistryString(std::string& stamp, HKEY key, const char* subKey, const char* valueName)
+{
+    char value[256];
+    DWORD valueSize = sizeof(value);
+    if (::RegGetValueA(key, subKey, valueName, RRF_RT_REG_SZ, nullptr, value, &valueSize) != ERROR_SUCCESS)
+        return false;
+    stamp += value;
+    stamp += ';';
+    return true;
+}
+
+LLGL_EXPORT std::string GetGraphicsDriverStamp()
+{
+    std::string stamp;
+
+    HKEY classKey = nullptr;
+    if (::RegOpenKeyExA(HKEY_LOCAL_MACHINE, g_displayAdapterClassKey, 0, KEY_READ, &classKey) != ERROR_SUCCESS)
+        return stamp;
+
+    /* Append description and driver version of each display adapter; subkeys without these values (such as "Properties") are skipped */
+    for (DWORD i = 0;; ++i)
+    {
+        char subKey[256];
+        DWORD subKeySize = sizeof(subKey);
+        const LSTATUS status = ::RegEnumKeyExA(classKey, i, subKey, &subKeySize, nullptr, nullptr, nullptr, nullptr);
+        if (status == ERROR_NO_MORE_ITEMS)
+            break;
+        if (status == ERROR_SUCCESS && AppendRegistryString(stamp, classKey, subKey, "DriverDesc"))
+            AppendRegistryString(stamp, classKey, subKey, "DriverVersion");
+    }
+
+    ::RegCloseKey(classKey);
+
+    return stamp;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,70 @@
+/*
+ * Win32MappedFile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Win32MappedFile.h"
+#include "../../Core/CoreUtils.h"
+#include <LLGL/Container/UTF8String.h>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    std::unique_ptr<Win32MappedFile> file = MakeUnique<Win32MappedFile>(filename);
+    return (file->IsValid() ? std::move(file) : nullptr);
+}
+
+Win32MappedFile::Win32MappedFile(const char* filename)
+{
+    /* Open file with UTF-16 filename */
+    const SmallVector<wchar_t> filenameUTF16 = UTF8String{ filename }.to_utf16();
+    HANDLE file = CreateFileW(filenameUTF16.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    /* Map entire file; the view remains valid after the file and mapping handles have been closed */
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) != FALSE && fileSize.QuadPart > 0)
+    {
+        if (HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+        {
+            if (const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+            {
+                data_ = data;
+                size_ = static_cast<std::size_t>(fileSize.QuadPart);
+            }
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+}
+
+Win32MappedFile::~Win32MappedFile()
+{
+    if (data_ != nullptr)
+        UnmapViewOfFile(data_);
+}
+
+const void* Win32MappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t Win32MappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
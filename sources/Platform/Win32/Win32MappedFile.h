@@ -0,0 +1,54 @@
+/*
+ * Win32MappedFile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WIN32_MAPPED_FILE_H
+#define LLGL_WIN32_MAPPED_FILE_H
+
+
+#include "../MappedFile.h"
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+class Win32MappedFile final : public MappedFile
+{
+
+    public:
+
+        Win32MappedFile(const char* filename);
+        ~Win32MappedFile() override;
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    public:
+
+        // Returns true if the file has been mapped successfully.
+        inline bool IsValid() const
+        {
+            return (data_ != nullptr);
+        }
+
+    private:
+
+        const void* data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
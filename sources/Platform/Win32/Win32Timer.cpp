@@ -9,8 +9,7 @@
 #include "Win32LeanAndMean.h"
 #include <Windows.h>
 #include <algorithm>
-#include <atomic>
-#include <mutex>
+#include <cstdlib>
 
 
 namespace LLGL
@@ -54,13 +53,13 @@ LLGL_EXPORT std::uint64_t Tick()
 
     #ifdef LLGL_LEAP_FORWARD_ADJUSTMENT
 
-    /* Check for unexpected leaps */
-    static std::mutex tickMutex;
-    std::lock_guard<std::mutex> guard{ tickMutex };
-
-    static ULONGLONG lastLowResTick;
-    static LONGLONG lastHighResTick;
-    static LONGLONG lastHighResElapsedTime;
+    /*
+    Check for unexpected leaps.
+    The previous ticks are tracked per thread, so this function never takes a lock, e.g. when it is used by the CPUProfiler on multiple threads.
+    */
+    static thread_local ULONGLONG lastLowResTick;
+    static thread_local LONGLONG lastHighResTick;
+    static thread_local LONGLONG lastHighResElapsedTime;
 
     static const LONGLONG frequency = GetPerformanceFrequencyQuadPart();
 
@@ -9,6 +9,7 @@
 #include "Win32Window.h"
 #include "MapKey.h"
 #include <atomic>
+#include <vector>
 
 #include <windowsx.h>
 
@@ -142,6 +143,63 @@ static void PostLocalMouseMotion(HWND wnd, LPARAM lParam)
     }
 }
 
+static void PostRawMouseMotion(Win32Window& window, const RAWMOUSE& mouse)
+{
+    if (mouse.usFlags == MOUSE_MOVE_RELATIVE)
+    {
+        /* Post global mouse motion event */
+        int dx = mouse.lLastX;
+        int dy = mouse.lLastY;
+
+        window.PostGlobalMotion({ dx, dy });
+    }
+}
+
+#ifndef _WIN64
+
+// Returns true if this is a 32-bit process on a 64-bit system. The RAWINPUT header is 8 bytes larger in the buffers of GetRawInputBuffer in this case.
+static bool IsWow64Process32()
+{
+    static const bool isWow64 = []() -> bool
+    {
+        BOOL wow64 = FALSE;
+        return (IsWow64Process(GetCurrentProcess(), &wow64) != FALSE && wow64 != FALSE);
+    }();
+    return isWow64;
+}
+
+#endif // /_WIN64
+
+// Drains all raw input that is still queued for this thread, so high polling-rate mice don't generate one WM_INPUT message per motion.
+static void PostBufferedRawMouseMotion(Win32Window& window)
+{
+    static thread_local std::vector<RAWINPUT> rawBuffer(64);
+
+    for (;;)
+    {
+        UINT rawBufferSize = static_cast<UINT>(rawBuffer.size() * sizeof(RAWINPUT));
+        UINT numRawInputs = GetRawInputBuffer(rawBuffer.data(), &rawBufferSize, sizeof(RAWINPUTHEADER));
+        if (numRawInputs == 0 || numRawInputs == static_cast<UINT>(-1))
+            break;
+
+        const RAWINPUT* raw = rawBuffer.data();
+        for (UINT i = 0; i < numRawInputs; ++i)
+        {
+            if (raw->header.dwType == RIM_TYPEMOUSE)
+            {
+                #ifdef _WIN64
+                const RAWMOUSE& mouse = raw->data.mouse;
+                #else
+                const BYTE* rawData = reinterpret_cast<const BYTE*>(&raw->data) + (IsWow64Process32() ? 8 : 0);
+                const RAWMOUSE& mouse = *reinterpret_cast<const RAWMOUSE*>(rawData);
+                #endif
+                PostRawMouseMotion(window, mouse);
+            }
+            raw = NEXTRAWINPUTBLOCK(raw);
+        }
+    }
+}
+
 static void PostGlobalMouseMotion(HWND wnd, LPARAM lParam)
 {
     /* Get window object from window handle */
@@ -156,18 +214,10 @@ static void PostGlobalMouseMotion(HWND wnd, LPARAM lParam)
         );
 
         if (raw.header.dwType == RIM_TYPEMOUSE)
-        {
-            const RAWMOUSE& mouse = raw.data.mouse;
+            PostRawMouseMotion(*window, raw.data.mouse);
 
-            if (mouse.usFlags == MOUSE_MOVE_RELATIVE)
-            {
-                /* Post global mouse motion event */
-                int dx = mouse.lLastX;
-                int dy = mouse.lLastY;
-
-                window->PostGlobalMotion({ dx, dy });
-            }
-        }
+        /* Read remaining raw input in a single batch instead of waiting for their WM_INPUT messages */
+        PostBufferedRawMouseMotion(*window);
     }
 }
 
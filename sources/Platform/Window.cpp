@@ -6,7 +6,9 @@
  */
 
 #include <LLGL/Window.h>
+#include <LLGL/Utils/ForRange.h>
 #include "../Core/CoreUtils.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -88,6 +90,9 @@ struct Window::Pimpl
     bool                                        quit            = false;
     bool                                        focus           = false;
     void*                                       userData        = nullptr;
+    std::vector<Offset2D>                       motionRing;                 // Ring buffer for global motion; empty if disabled.
+    std::uint32_t                               motionRingStart = 0;
+    std::uint32_t                               motionRingSize  = 0;
 };
 
 
@@ -220,6 +225,34 @@ void Window::RemoveEventListener(const EventListener* eventListener)
     RemoveFromSharedList(pimpl_->eventListeners, eventListener);
 }
 
+void Window::SetGlobalMotionBuffer(std::uint32_t capacity)
+{
+    pimpl_->motionRing.clear();
+    pimpl_->motionRing.resize(capacity);
+    pimpl_->motionRingStart = 0;
+    pimpl_->motionRingSize  = 0;
+}
+
+std::uint32_t Window::ReadGlobalMotion(Offset2D* outMotions, std::uint32_t maxCount)
+{
+    const std::uint32_t capacity    = static_cast<std::uint32_t>(pimpl_->motionRing.size());
+    const std::uint32_t count       = std::min(maxCount, pimpl_->motionRingSize);
+
+    if (outMotions != nullptr)
+    {
+        for_range(i, count)
+            outMotions[i] = pimpl_->motionRing[(pimpl_->motionRingStart + i) % capacity];
+    }
+
+    if (count > 0)
+    {
+        pimpl_->motionRingStart = (pimpl_->motionRingStart + count) % capacity;
+        pimpl_->motionRingSize -= count;
+    }
+
+    return count;
+}
+
 void Window::PostQuit()
 {
     if (!HasQuit())
@@ -267,7 +300,25 @@ void Window::PostLocalMotion(const Offset2D& position)
 
 void Window::PostGlobalMotion(const Offset2D& motion)
 {
-    FOREACH_LISTENER_CALL( OnGlobalMotion(*this, motion) );
+    const std::uint32_t capacity = static_cast<std::uint32_t>(pimpl_->motionRing.size());
+    if (capacity > 0)
+    {
+        if (pimpl_->motionRingSize < capacity)
+        {
+            /* Append motion to ring buffer */
+            pimpl_->motionRing[(pimpl_->motionRingStart + pimpl_->motionRingSize) % capacity] = motion;
+            ++pimpl_->motionRingSize;
+        }
+        else
+        {
+            /* Accumulate motion into most recent entry if ring buffer is full */
+            Offset2D& lastMotion = pimpl_->motionRing[(pimpl_->motionRingStart + capacity - 1) % capacity];
+            lastMotion.x += motion.x;
+            lastMotion.y += motion.y;
+        }
+    }
+    else
+        FOREACH_LISTENER_CALL( OnGlobalMotion(*this, motion) );
 }
 
 void Window::PostResize(const Extent2D& clientAreaSize)
@@ -6,9 +6,15 @@
  */
 
 #include "BufferUtils.h"
+#include "../Core/Float16Compressor.h"
 #include <LLGL/Format.h>
 #include <LLGL/Buffer.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Container/SmallVector.h>
 #include <algorithm>
+#include <limits>
+#include <cstring>
+#include <cmath>
 
 
 namespace LLGL
@@ -33,6 +39,157 @@ LLGL_EXPORT long GetCombinedBindFlags(std::uint32_t numBuffers, Buffer* const *
     return bindFlags;
 }
 
+template <typename T>
+static void WriteClearComponent(std::uint8_t* dst, double value, bool normalized)
+{
+    constexpr double minValue = static_cast<double>(std::numeric_limits<T>::lowest());
+    constexpr double maxValue = static_cast<double>(std::numeric_limits<T>::max());
+    if (normalized)
+        value = std::round(std::max(std::numeric_limits<T>::is_signed ? -1.0 : 0.0, std::min(value, 1.0)) * maxValue);
+    const T typedValue = static_cast<T>(std::max(minValue, std::min(value, maxValue)));
+    std::memcpy(dst, &typedValue, sizeof(typedValue));
+}
+
+static bool WriteClearComponentTyped(std::uint8_t* dst, DataType dataType, float value, bool normalized)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:    WriteClearComponent<std::int8_t  >(dst, value, normalized); return true;
+        case DataType::UInt8:   WriteClearComponent<std::uint8_t >(dst, value, normalized); return true;
+        case DataType::Int16:   WriteClearComponent<std::int16_t >(dst, value, normalized); return true;
+        case DataType::UInt16:  WriteClearComponent<std::uint16_t>(dst, value, normalized); return true;
+        case DataType::Int32:   WriteClearComponent<std::int32_t >(dst, value, normalized); return true;
+        case DataType::UInt32:  WriteClearComponent<std::uint32_t>(dst, value, normalized); return true;
+
+        case DataType::Float16:
+        {
+            const std::uint16_t halfValue = CompressFloat16(value);
+            std::memcpy(dst, &halfValue, sizeof(halfValue));
+        }
+        return true;
+
+        case DataType::Float32:
+        {
+            std::memcpy(dst, &value, sizeof(value));
+        }
+        return true;
+
+        default:
+        return false;
+    }
+}
+
+// Returns the number of components and writes the indices of the RGBA color components in memory order.
+static std::uint32_t GetClearComponentOrder(ImageFormat format, std::uint32_t (&outOrder)[4])
+{
+    switch (format)
+    {
+        case ImageFormat::Alpha:    outOrder[0] = 3;                                                    return 1;
+        case ImageFormat::R:        outOrder[0] = 0;                                                    return 1;
+        case ImageFormat::RG:       outOrder[0] = 0; outOrder[1] = 1;                                   return 2;
+        case ImageFormat::RGB:      outOrder[0] = 0; outOrder[1] = 1; outOrder[2] = 2;                  return 3;
+        case ImageFormat::BGR:      outOrder[0] = 2; outOrder[1] = 1; outOrder[2] = 0;                  return 3;
+        case ImageFormat::RGBA:     outOrder[0] = 0; outOrder[1] = 1; outOrder[2] = 2; outOrder[3] = 3; return 4;
+        case ImageFormat::BGRA:     outOrder[0] = 2; outOrder[1] = 1; outOrder[2] = 0; outOrder[3] = 3; return 4;
+        case ImageFormat::ARGB:     outOrder[0] = 3; outOrder[1] = 0; outOrder[2] = 1; outOrder[3] = 2; return 4;
+        case ImageFormat::ABGR:     outOrder[0] = 3; outOrder[1] = 2; outOrder[2] = 1; outOrder[3] = 0; return 4;
+        default:                                                                                        return 0;
+    }
+}
+
+LLGL_EXPORT std::uint32_t EncodeClearColorElement(const Format format, const float (&color)[4], std::uint8_t (&outElement)[g_maxClearElementSize])
+{
+    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    if ((formatAttribs.flags & (FormatFlags::IsCompressed | FormatFlags::IsPacked | FormatFlags::HasDepth | FormatFlags::HasStencil)) != 0)
+        return 0;
+
+    std::uint32_t order[4] = {};
+    const std::uint32_t numComponents = GetClearComponentOrder(formatAttribs.format, order);
+    const std::uint32_t componentSize = DataTypeSize(formatAttribs.dataType);
+    if (numComponents == 0 || componentSize == 0 || numComponents * componentSize > g_maxClearElementSize)
+        return 0;
+
+    const bool normalized = ((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
+    for (std::uint32_t i = 0; i < numComponents; ++i)
+    {
+        if (!WriteClearComponentTyped(&outElement[i * componentSize], formatAttribs.dataType, color[order[i]], normalized))
+            return 0;
+    }
+
+    return numComponents * componentSize;
+}
+
+LLGL_EXPORT bool GetClearElementPattern32(const std::uint8_t* element, std::uint32_t elementSize, std::uint32_t& outPattern)
+{
+    switch (elementSize)
+    {
+        case 1:
+            outPattern = 0x01010101u * element[0];
+            return true;
+
+        case 2:
+        {
+            std::uint16_t value16 = 0;
+            std::memcpy(&value16, element, sizeof(value16));
+            outPattern = 0x00010001u * value16;
+        }
+        return true;
+
+        default:
+        {
+            if (elementSize == 0 || elementSize % 4 != 0)
+                return false;
+
+            /* Larger elements must consist of identical 32-bit words */
+            std::memcpy(&outPattern, element, sizeof(outPattern));
+            for (std::uint32_t offset = 4; offset < elementSize; offset += 4)
+            {
+                if (std::memcmp(&outPattern, element + offset, sizeof(outPattern)) != 0)
+                    return false;
+            }
+        }
+        return true;
+    }
+}
+
+LLGL_EXPORT void ClearBufferWithElement(
+    CommandBuffer&      commandBuffer,
+    Buffer&             dstBuffer,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize,
+    const std::uint8_t* element,
+    std::uint32_t       elementSize)
+{
+    /* Use native fill command if the element can be repeated as 32-bit pattern */
+    std::uint32_t pattern32 = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern32))
+    {
+        commandBuffer.FillBuffer(dstBuffer, dstOffset, pattern32, clearSize);
+        return;
+    }
+
+    /* Fill intermediate buffer with the repeated element; its size is a multiple of both the element size and 4 bytes as required by UpdateBuffer */
+    std::uint32_t patternSize = elementSize;
+    while (patternSize % 4 != 0)
+        patternSize += elementSize;
+
+    const std::uint32_t chunkSize = static_cast<std::uint32_t>(std::numeric_limits<std::uint16_t>::max()) / patternSize * patternSize;
+
+    SmallVector<std::uint8_t, 1024> chunk;
+    chunk.resize(static_cast<std::size_t>(std::min<std::uint64_t>(chunkSize, clearSize)));
+    for (std::size_t offset = 0; offset < chunk.size(); offset += elementSize)
+        std::memcpy(&chunk[offset], element, std::min<std::size_t>(elementSize, chunk.size() - offset));
+
+    /* Write buffer range with a sequence of update commands */
+    while (clearSize > 0)
+    {
+        const std::uint16_t dataSize = static_cast<std::uint16_t>(std::min<std::uint64_t>(chunk.size(), clearSize));
+        commandBuffer.UpdateBuffer(dstBuffer, dstOffset, chunk.data(), dataSize);
+        dstOffset += dataSize;
+        clearSize -= dataSize;
+    }
+}
+
 
 } // /namespace LLGL
 
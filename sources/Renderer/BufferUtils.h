@@ -10,6 +10,7 @@
 
 
 #include <LLGL/BufferFlags.h>
+#include <LLGL/Format.h>
 
 
 namespace LLGL
@@ -17,6 +18,12 @@ namespace LLGL
 
 
 class Buffer;
+class CommandBuffer;
+
+/* ----- Constants ----- */
+
+// Maximum size (in bytes) of a single buffer element that can be encoded with EncodeClearColorElement, i.e. the size of Format::RGBA32Float.
+static constexpr std::uint32_t g_maxClearElementSize = 16;
 
 /* ----- Functions ----- */
 
@@ -29,6 +36,61 @@ LLGL_EXPORT std::uint32_t GetStorageBufferStride(const BufferDescriptor& desc);
 // Returns the bitwise-OR combined binding flags of the specified array of buffers.
 LLGL_EXPORT long GetCombinedBindFlags(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
+/*
+Returns true if the specified buffer descriptor only describes a buffer to read back GPU data,
+i.e. it can be placed directly in CPU accessible memory (see CPUAccessFlags::Read).
+*/
+inline bool IsReadbackBuffer(const BufferDescriptor& desc)
+{
+    return
+    (
+        (desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 &&
+        (desc.bindFlags & ~(BindFlags::CopySrc | BindFlags::CopyDst)) == 0 &&
+        (desc.miscFlags & MiscFlags::DynamicUsage) == 0
+    );
+}
+
+/*
+Encodes the specified clear color into a single element of the specified format and returns its size (in bytes).
+Normalized formats are scaled and clamped, integer formats are truncated and clamped.
+Returns 0 if the format cannot be encoded, i.e. for compressed, packed, and depth-stencil formats.
+*/
+LLGL_EXPORT std::uint32_t EncodeClearColorElement(const Format format, const float (&color)[4], std::uint8_t (&outElement)[g_maxClearElementSize]);
+
+/*
+Returns true if the specified element can be written as a repeated 32-bit pattern, i.e. with CommandBuffer::FillBuffer.
+Elements of 1 and 2 bytes are replicated and larger elements must consist of identical 32-bit words, e.g. all zeros.
+*/
+LLGL_EXPORT bool GetClearElementPattern32(const std::uint8_t* element, std::uint32_t elementSize, std::uint32_t& outPattern);
+
+/*
+Resolves the destination range of CommandBuffer::ClearBuffer for a buffer of <bufferSize> bytes.
+If <clearSize> is LLGL_WHOLE_SIZE, the entire buffer is cleared and <dstOffset> is ignored (i.e. reset to 0) as documented.
+This must be resolved before the native fill functions or ClearBufferWithElement are invoked, since they all expect an explicit range.
+*/
+inline void ResolveClearBufferRange(std::uint64_t bufferSize, std::uint64_t& dstOffset, std::uint64_t& clearSize)
+{
+    if (clearSize == LLGL_WHOLE_SIZE)
+    {
+        dstOffset   = 0;
+        clearSize   = bufferSize;
+    }
+}
+
+/*
+Clears the buffer range with the specified element, either with CommandBuffer::FillBuffer if the element is a repeated 32-bit pattern,
+or with a sequence of CommandBuffer::UpdateBuffer commands otherwise. This is the default implementation of CommandBuffer::ClearBuffer
+for backends without native typed buffer clears. The range must already be resolved, i.e. <clearSize> must not be LLGL_WHOLE_SIZE.
+*/
+LLGL_EXPORT void ClearBufferWithElement(
+    CommandBuffer&      commandBuffer,
+    Buffer&             dstBuffer,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize,
+    const std::uint8_t* element,
+    std::uint32_t       elementSize
+);
+
 // Returns true if the buffer-view in the specified resource-view descriptor is enabled.
 inline bool IsBufferViewEnabled(const BufferViewDescriptor& bufferViewDesc)
 {
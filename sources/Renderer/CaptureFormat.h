@@ -0,0 +1,358 @@
+/*
+ * CaptureFormat.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CAPTURE_FORMAT_H
+#define LLGL_CAPTURE_FORMAT_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+
+namespace LLGL
+{
+
+
+/*
+Binary format of command stream captures that are written by the debug layer (see RenderingDebugger::SetCapture) and read by ReplayCapture().
+A capture starts with a CaptureHeader, followed by a sequence of records. Each record starts with a CaptureRecord type (1 byte) and its payload size (4 bytes).
+Objects are referred to by non-zero IDs that are assigned in the order of their creation; zero denotes a null reference.
+Plain structures are written as is, so captures can only be replayed by builds with the same ABI.
+*/
+
+static constexpr std::uint32_t g_captureMagic   = 0x4C474C43; // "CLGL"
+static constexpr std::uint32_t g_captureVersion = 4;
+
+// Special value for null strings, since empty strings are valid values.
+static constexpr std::uint32_t g_captureNullString = ~0u;
+
+struct CaptureHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+};
+
+enum CaptureRecord : std::uint8_t
+{
+    CaptureRecordCreateSwapChain = 1,
+    CaptureRecordCreateBuffer,
+    CaptureRecordCreateBufferArray,
+    CaptureRecordCreateTexture,
+    CaptureRecordCreateSampler,
+    CaptureRecordCreateResourceHeap,
+    CaptureRecordCreateRenderPass,
+    CaptureRecordCreateRenderTarget,
+    CaptureRecordCreateShader,
+    CaptureRecordCreatePipelineLayout,
+    CaptureRecordCreateGraphicsPipeline,
+    CaptureRecordCreateComputePipeline,
+    CaptureRecordRelease,
+    CaptureRecordWriteBuffer,
+    CaptureRecordWriteTexture,
+    CaptureRecordWriteResourceHeap,
+    CaptureRecordSubmit,
+    CaptureRecordPresent,
+};
+
+enum CaptureOpcode : std::uint8_t
+{
+    CaptureOpcodeUnsupported = 1,
+    CaptureOpcodeUpdateBuffer,
+    CaptureOpcodeCopyBuffer,
+    CaptureOpcodeCopyBufferFromTexture,
+    CaptureOpcodeFillBuffer,
+    CaptureOpcodeCopyTexture,
+    CaptureOpcodeCopyTextureFromBuffer,
+    CaptureOpcodeCopyTextureFromFramebuffer,
+    CaptureOpcodeGenerateMips,
+    CaptureOpcodeGenerateMipsRange,
+    CaptureOpcodeSetViewport,
+    CaptureOpcodeSetViewports,
+    CaptureOpcodeSetScissor,
+    CaptureOpcodeSetScissors,
+    CaptureOpcodeSetVertexBuffer,
+    CaptureOpcodeSetVertexBufferArray,
+    CaptureOpcodeSetIndexBuffer,
+    CaptureOpcodeSetIndexBufferExt,
+    CaptureOpcodeSetResourceHeap,
+    CaptureOpcodeSetResource,
+    CaptureOpcodeSetBufferRange,
+    CaptureOpcodeBeginRenderPass,
+    CaptureOpcodeEndRenderPass,
+    CaptureOpcodeNextSubpass,
+    CaptureOpcodeClear,
+    CaptureOpcodeClearAttachments,
+    CaptureOpcodeSetPipelineState,
+    CaptureOpcodeSetBlendFactor,
+    CaptureOpcodeSetStencilReference,
+    CaptureOpcodeSetCullMode,
+    CaptureOpcodeSetDepthState,
+    CaptureOpcodeSetStencilState,
+    CaptureOpcodeSetPrimitiveTopology,
+    CaptureOpcodeSetDepthBias,
+    CaptureOpcodeSetUniforms,
+    CaptureOpcodeDraw,
+    CaptureOpcodeDrawIndexed,
+    CaptureOpcodeDrawIndexedOffset,
+    CaptureOpcodeDrawInstanced,
+    CaptureOpcodeDrawInstancedOffset,
+    CaptureOpcodeDrawIndexedInstanced,
+    CaptureOpcodeDrawIndexedInstancedOffset,
+    CaptureOpcodeDrawIndexedInstancedOffsetFirst,
+    CaptureOpcodeMultiDrawIndexed,
+    CaptureOpcodeDrawIndirect,
+    CaptureOpcodeDrawIndirectN,
+    CaptureOpcodeDrawIndexedIndirect,
+    CaptureOpcodeDrawIndexedIndirectN,
+    CaptureOpcodeDrawIndirectCount,
+    CaptureOpcodeDrawIndexedIndirectCount,
+    CaptureOpcodeDrawMeshTasks,
+    CaptureOpcodeDrawMeshTasksIndirect,
+    CaptureOpcodeDispatch,
+    CaptureOpcodeDispatchIndirect,
+    CaptureOpcodePushDebugGroup,
+    CaptureOpcodePopDebugGroup,
+    CaptureOpcodeSetShadingRate,
+    CaptureOpcodeSetShadingRateImage,
+    CaptureOpcodeClearBuffer,
+    CaptureOpcodeClearTexture,
+    CaptureOpcodeDiscardResource,
+    CaptureOpcodeCopyBufferRegions,
+    CaptureOpcodeCopyTextureRegions,
+    CaptureOpcodeGenerateMipsBatch,
+};
+
+// Array of bytes that is written with its size as prefix.
+struct CaptureBytes
+{
+    const void*     data;
+    std::size_t     size;
+};
+
+// Growing byte stream to serialize capture records and command streams.
+class CaptureStream
+{
+
+    public:
+
+        inline void Clear()
+        {
+            data_.clear();
+        }
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureStream::Write<T>: T must be trivially copyable");
+            WriteRaw(&value, sizeof(T));
+        }
+
+        template <typename T>
+        void WriteArray(const T* values, std::uint32_t count)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureStream::WriteArray<T>: T must be trivially copyable");
+            Write(count);
+            WriteRaw(values, sizeof(T) * count);
+        }
+
+        void WriteBytes(const void* data, std::size_t size)
+        {
+            Write(static_cast<std::uint64_t>(size));
+            WriteRaw(data, size);
+        }
+
+        // Writes a string with its length as prefix and a null terminator, so the reader can refer to it in place.
+        void WriteString(const char* str)
+        {
+            if (str != nullptr)
+            {
+                const std::size_t len = std::strlen(str);
+                Write(static_cast<std::uint32_t>(len));
+                WriteRaw(str, len + 1);
+            }
+            else
+                Write(g_captureNullString);
+        }
+
+        // Appends an opcode with all of its arguments.
+        template <typename... TArgs>
+        void Record(CaptureOpcode opcode, const TArgs&... args)
+        {
+            Write(opcode);
+            const int unpack[] = { 0, (WriteArg(args), 0)... };
+            (void)unpack;
+        }
+
+        void WriteRaw(const void* data, std::size_t size)
+        {
+            if (size > 0)
+            {
+                const std::size_t offset = data_.size();
+                data_.resize(offset + size);
+                std::memcpy(data_.data() + offset, data, size);
+            }
+        }
+
+        inline const char* GetData() const
+        {
+            return data_.data();
+        }
+
+        inline std::size_t GetSize() const
+        {
+            return data_.size();
+        }
+
+        inline bool IsEmpty() const
+        {
+            return data_.empty();
+        }
+
+    private:
+
+        template <typename T>
+        void WriteArg(const T& value)
+        {
+            Write(value);
+        }
+
+        void WriteArg(const CaptureBytes& bytes)
+        {
+            WriteBytes(bytes.data, bytes.size);
+        }
+
+        void WriteArg(const char* str)
+        {
+            WriteString(str);
+        }
+
+    private:
+
+        std::vector<char> data_;
+
+};
+
+// Reads a byte stream that was serialized with CaptureStream. All out-of-bounds reads are caught and invalidate the reader.
+class CaptureReader
+{
+
+    public:
+
+        CaptureReader() = default;
+
+        inline CaptureReader(const void* data, std::size_t size) :
+            data_ { static_cast<const char*>(data) },
+            size_ { size                           }
+        {
+        }
+
+        template <typename T>
+        T Read()
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureReader::Read<T>: T must be trivially copyable");
+            T value{};
+            if (const void* src = ReadRaw(sizeof(T)))
+                std::memcpy(&value, src, sizeof(T));
+            return value;
+        }
+
+        template <typename T>
+        void Read(T& value)
+        {
+            value = Read<T>();
+        }
+
+        // Returns a pointer to the array inside the stream; the array might be unaligned, so it must only be accessed by copy.
+        template <typename T>
+        const void* ReadArray(std::uint32_t& outCount)
+        {
+            outCount = Read<std::uint32_t>();
+            const void* data = ReadRaw(sizeof(T) * outCount);
+            if (data == nullptr)
+                outCount = 0;
+            return data;
+        }
+
+        template <typename T>
+        void ReadArray(std::vector<T>& outValues)
+        {
+            std::uint32_t count = 0;
+            const void* data = ReadArray<T>(count);
+            outValues.resize(count);
+            if (count > 0)
+                std::memcpy(outValues.data(), data, sizeof(T) * count);
+        }
+
+        const void* ReadBytes(std::size_t& outSize)
+        {
+            outSize = static_cast<std::size_t>(Read<std::uint64_t>());
+            const void* data = ReadRaw(outSize);
+            if (data == nullptr)
+                outSize = 0;
+            return data;
+        }
+
+        // Returns a pointer to the null-terminated string inside the stream or null if a null string was written.
+        const char* ReadString()
+        {
+            const std::uint32_t len = Read<std::uint32_t>();
+            if (len == g_captureNullString)
+                return nullptr;
+            return static_cast<const char*>(ReadRaw(static_cast<std::size_t>(len) + 1));
+        }
+
+        const void* ReadRaw(std::size_t size)
+        {
+            if (!good_ || size > size_ - pos_)
+            {
+                good_ = false;
+                return nullptr;
+            }
+            const char* ptr = data_ + pos_;
+            pos_ += size;
+            return ptr;
+        }
+
+        // Returns true if all reads so far have been in bounds.
+        inline bool Good() const
+        {
+            return good_;
+        }
+
+        // Returns the number of bytes that have not been read yet.
+        inline std::size_t GetRemainingSize() const
+        {
+            return (good_ ? size_ - pos_ : 0);
+        }
+
+        // Returns true if the entire stream has been read.
+        inline bool IsEnd() const
+        {
+            return (!good_ || pos_ >= size_);
+        }
+
+    private:
+
+        const char*     data_   = nullptr;
+        std::size_t     size_   = 0;
+        std::size_t     pos_    = 0;
+        bool            good_   = true;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1484 @@
+/*
+ * CaptureReplay.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/CaptureReplay.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Report.h>
+#include <LLGL/Timer.h>
+#include <LLGL/Window.h>
+#include <LLGL/TypeInfo.h>
+#include <LLGL/IndirectArguments.h>
+#include <LLGL/Utils/ForRange.h>
+#include "CaptureFormat.h"
+#include "../Core/StringUtils.h"
+#include <map>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+Replays the records of a capture file that was written by the debug layer (see DbgCapture).
+Each record is deserialized in the same order as it was serialized by DbgCapture.
+*/
+class CaptureReplayer
+{
+
+    public:
+
+        CaptureReplayer(RenderSystem& renderSystem, const CaptureReplayDescriptor& replayDesc, CaptureReplayResult& result, Report* report);
+        ~CaptureReplayer();
+
+        // Replays all records of the specified capture once. Returns false if the capture is corrupted.
+        bool ReplayRecords(CaptureReader& reader);
+
+        // Releases all objects that have been created by the replay.
+        void ReleaseAll();
+
+        // Returns true if the windowing system has been shut down during the replay.
+        inline bool HasQuit() const
+        {
+            return quit_;
+        }
+
+    private:
+
+        struct ReplayObject
+        {
+            RenderSystemChild*  object;
+            CaptureRecord       type;   // Record type that created the object; CaptureRecordSubmit for command buffers.
+            bool                owned;  // False for implicit render passes of swap-chains and render targets.
+        };
+
+    private:
+
+        bool ReplayRecord(CaptureRecord type, CaptureReader& reader);
+
+        void ReplayCreateSwapChain(CaptureReader& reader);
+        void ReplayCreateBuffer(CaptureReader& reader);
+        void ReplayCreateBufferArray(CaptureReader& reader);
+        void ReplayCreateTexture(CaptureReader& reader);
+        void ReplayCreateSampler(CaptureReader& reader);
+        void ReplayCreateResourceHeap(CaptureReader& reader);
+        void ReplayCreateRenderPass(CaptureReader& reader);
+        void ReplayCreateRenderTarget(CaptureReader& reader);
+        void ReplayCreateShader(CaptureReader& reader);
+        void ReplayCreatePipelineLayout(CaptureReader& reader);
+        void ReplayCreateGraphicsPipeline(CaptureReader& reader);
+        void ReplayCreateComputePipeline(CaptureReader& reader);
+        void ReplayRelease(CaptureReader& reader);
+        void ReplayWriteBuffer(CaptureReader& reader);
+        void ReplayWriteTexture(CaptureReader& reader);
+        void ReplayWriteResourceHeap(CaptureReader& reader);
+        void ReplaySubmit(CaptureReader& reader);
+        void ReplayPresent(CaptureReader& reader);
+
+        // Decodes the command stream of a submission into the specified command buffer. Returns false if the command stream is corrupted.
+        bool ReplayCommands(CommandBuffer& cmdBuffer, CaptureReader& reader);
+        bool ReplayCommand(CommandBuffer& cmdBuffer, CaptureOpcode opcode, CaptureReader& reader);
+
+        void AddObject(std::uint32_t id, RenderSystemChild* object, CaptureRecord type, bool owned = true);
+        void ReleaseObject(const ReplayObject& entry);
+
+        template <typename T>
+        T* FindObject(std::uint32_t id) const;
+
+        template <typename T>
+        T* ReadObject(CaptureReader& reader) const;
+
+        void ReadVertexAttributes(CaptureReader& reader, std::vector<VertexAttribute>& outAttribs);
+        void ReadFragmentAttributes(CaptureReader& reader, std::vector<FragmentAttribute>& outAttribs);
+        void ReadBindingDescs(CaptureReader& reader, std::vector<BindingDescriptor>& outBindingDescs);
+        void ReadSamplerDesc(CaptureReader& reader, SamplerDescriptor& outSamplerDesc);
+        void ReadResourceViews(CaptureReader& reader, std::vector<ResourceViewDescriptor>& outResourceViews);
+        void ReadAttachmentDesc(CaptureReader& reader, AttachmentDescriptor& outAttachmentDesc);
+
+    private:
+
+        RenderSystem&                           renderSystem_;
+        const CaptureReplayDescriptor&          replayDesc_;
+        CaptureReplayResult&                    result_;
+        Report*                                 report_         = nullptr;
+
+        std::map<std::uint32_t, ReplayObject>   objects_;       // Ordered by ID, i.e. in the order of their creation.
+        std::uint64_t                           frameStartTick_ = 0;
+        bool                                    quit_           = false;
+
+};
+
+// Reads an array of plain structures that was written as bytes and copies it into aligned storage.
+template <typename T>
+static std::uint32_t ReadBytesArray(CaptureReader& reader, std::vector<T>& outValues)
+{
+    std::size_t size = 0;
+    const void* data = reader.ReadBytes(size);
+    outValues.resize(size / sizeof(T));
+    if (!outValues.empty())
+        std::memcpy(outValues.data(), data, outValues.size() * sizeof(T));
+    return static_cast<std::uint32_t>(outValues.size());
+}
+
+CaptureReplayer::CaptureReplayer(RenderSystem& renderSystem, const CaptureReplayDescriptor& replayDesc, CaptureReplayResult& result, Report* report) :
+    renderSystem_ { renderSystem },
+    replayDesc_   { replayDesc   },
+    result_       { result       },
+    report_       { report       }
+{
+}
+
+CaptureReplayer::~CaptureReplayer()
+{
+    ReleaseAll();
+}
+
+bool CaptureReplayer::ReplayRecords(CaptureReader& reader)
+{
+    frameStartTick_ = Timer::Tick();
+
+    while (!reader.IsEnd() && !quit_)
+    {
+        /* Read record header and replay its payload with a separate reader, so each record is bounds checked individually */
+        const CaptureRecord type        = reader.Read<CaptureRecord>();
+        const std::uint32_t payloadSize = reader.Read<std::uint32_t>();
+        const void*         payload     = reader.ReadRaw(payloadSize);
+
+        if (payload == nullptr)
+        {
+            if (report_ != nullptr)
+                report_->Errorf("capture file is truncated\n");
+            return false;
+        }
+
+        CaptureReader payloadReader{ payload, payloadSize };
+        if (!ReplayRecord(type, payloadReader) || !payloadReader.Good())
+        {
+            if (report_ != nullptr)
+                report_->Errorf("capture record of type %u is corrupted\n", static_cast<unsigned>(type));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CaptureReplayer::ReleaseAll()
+{
+    /* Release objects in reverse order of their creation */
+    for (auto it = objects_.rbegin(); it != objects_.rend(); ++it)
+        ReleaseObject(it->second);
+    objects_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool CaptureReplayer::ReplayRecord(CaptureRecord type, CaptureReader& reader)
+{
+    switch (type)
+    {
+        case CaptureRecordCreateSwapChain:          ReplayCreateSwapChain(reader);          break;
+        case CaptureRecordCreateBuffer:             ReplayCreateBuffer(reader);             break;
+        case CaptureRecordCreateBufferArray:        ReplayCreateBufferArray(reader);        break;
+        case CaptureRecordCreateTexture:            ReplayCreateTexture(reader);            break;
+        case CaptureRecordCreateSampler:            ReplayCreateSampler(reader);            break;
+        case CaptureRecordCreateResourceHeap:       ReplayCreateResourceHeap(reader);       break;
+        case CaptureRecordCreateRenderPass:         ReplayCreateRenderPass(reader);         break;
+        case CaptureRecordCreateRenderTarget:       ReplayCreateRenderTarget(reader);       break;
+        case CaptureRecordCreateShader:             ReplayCreateShader(reader);             break;
+        case CaptureRecordCreatePipelineLayout:     ReplayCreatePipelineLayout(reader);     break;
+        case CaptureRecordCreateGraphicsPipeline:   ReplayCreateGraphicsPipeline(reader);   break;
+        case CaptureRecordCreateComputePipeline:    ReplayCreateComputePipeline(reader);    break;
+        case CaptureRecordRelease:                  ReplayRelease(reader);                  break;
+        case CaptureRecordWriteBuffer:              ReplayWriteBuffer(reader);              break;
+        case CaptureRecordWriteTexture:             ReplayWriteTexture(reader);             break;
+        case CaptureRecordWriteResourceHeap:        ReplayWriteResourceHeap(reader);        break;
+        case CaptureRecordSubmit:                   ReplaySubmit(reader);                   break;
+        case CaptureRecordPresent:                  ReplayPresent(reader);                  break;
+        default:                                    return false;
+    }
+    return true;
+}
+
+void CaptureReplayer::ReplayCreateSwapChain(CaptureReader& reader)
+{
+    const std::uint32_t id              = reader.Read<std::uint32_t>();
+    const std::uint32_t renderPassID    = reader.Read<std::uint32_t>();
+    const char*         debugName       = reader.ReadString();
+
+    SwapChainDescriptor swapChainDesc = reader.Read<SwapChainDescriptor>();
+    swapChainDesc.debugName = debugName;
+
+    if (!reader.Good())
+        return;
+
+    SwapChain* swapChain = renderSystem_.CreateSwapChain(swapChainDesc);
+    AddObject(id, swapChain, CaptureRecordCreateSwapChain);
+
+    if (swapChain != nullptr)
+    {
+        AddObject(renderPassID, const_cast<RenderPass*>(swapChain->GetRenderPass()), CaptureRecordCreateRenderPass, /*owned:*/ false);
+
+        #ifndef LLGL_MOBILE_PLATFORM
+        if (replayDesc_.showWindows)
+        {
+            if (Window* window = CastTo<Window>(&(swapChain->GetSurface())))
+                window->Show();
+        }
+        #endif // /LLGL_MOBILE_PLATFORM
+    }
+}
+
+void CaptureReplayer::ReplayCreateBuffer(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    BufferDescriptor bufferDesc;
+    std::vector<VertexAttribute> vertexAttribs;
+    {
+        bufferDesc.debugName        = reader.ReadString();
+        bufferDesc.size             = reader.Read<std::uint64_t>();
+        bufferDesc.stride           = reader.Read<std::uint32_t>();
+        bufferDesc.format           = reader.Read<Format>();
+        bufferDesc.bindFlags        = reader.Read<long>();
+        bufferDesc.cpuAccessFlags   = reader.Read<long>();
+        bufferDesc.miscFlags        = reader.Read<long>();
+        ReadVertexAttributes(reader, vertexAttribs);
+        bufferDesc.vertexAttribs    = vertexAttribs;
+    }
+
+    std::size_t initialDataSize = 0;
+    const void* initialData = reader.ReadBytes(initialDataSize);
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreateBuffer(bufferDesc, (initialDataSize > 0 ? initialData : nullptr)), CaptureRecordCreateBuffer);
+}
+
+void CaptureReplayer::ReplayCreateBufferArray(CaptureReader& reader)
+{
+    const std::uint32_t id          = reader.Read<std::uint32_t>();
+    const std::uint32_t numBuffers  = reader.Read<std::uint32_t>();
+
+    /* Each buffer is referenced by its ID, so reject counts that exceed the record before reserving memory for them */
+    if (numBuffers > reader.GetRemainingSize() / sizeof(std::uint32_t))
+        return;
+
+    std::vector<Buffer*> buffers;
+    buffers.reserve(numBuffers);
+
+    for_range(i, numBuffers)
+    {
+        if (Buffer* buffer = ReadObject<Buffer>(reader))
+            buffers.push_back(buffer);
+        else
+            return;
+    }
+
+    if (!reader.Good() || buffers.empty())
+        return;
+
+    AddObject(id, renderSystem_.CreateBufferArray(numBuffers, buffers.data()), CaptureRecordCreateBufferArray);
+}
+
+void CaptureReplayer::ReplayCreateTexture(CaptureReader& reader)
+{
+    const std::uint32_t id          = reader.Read<std::uint32_t>();
+    const char*         debugName   = reader.ReadString();
+
+    TextureDescriptor textureDesc = reader.Read<TextureDescriptor>();
+    textureDesc.debugName = debugName;
+
+    ImageView initialImage;
+    const bool hasInitialImage = reader.Read<bool>();
+    if (hasInitialImage)
+    {
+        initialImage.format     = reader.Read<ImageFormat>();
+        initialImage.dataType   = reader.Read<DataType>();
+        initialImage.data       = reader.ReadBytes(initialImage.dataSize);
+    }
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreateTexture(textureDesc, (hasInitialImage ? &initialImage : nullptr)), CaptureRecordCreateTexture);
+}
+
+void CaptureReplayer::ReplayCreateSampler(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    SamplerDescriptor samplerDesc;
+    ReadSamplerDesc(reader, samplerDesc);
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreateSampler(samplerDesc), CaptureRecordCreateSampler);
+}
+
+void CaptureReplayer::ReplayCreateResourceHeap(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    ResourceHeapDescriptor resourceHeapDesc;
+    {
+        resourceHeapDesc.debugName          = reader.ReadString();
+        resourceHeapDesc.pipelineLayout     = ReadObject<PipelineLayout>(reader);
+        resourceHeapDesc.numResourceViews   = reader.Read<std::uint32_t>();
+    }
+
+    std::vector<ResourceViewDescriptor> initialResourceViews;
+    ReadResourceViews(reader, initialResourceViews);
+
+    if (!reader.Good() || resourceHeapDesc.pipelineLayout == nullptr)
+        return;
+
+    AddObject(id, renderSystem_.CreateResourceHeap(resourceHeapDesc, initialResourceViews), CaptureRecordCreateResourceHeap);
+}
+
+void CaptureReplayer::ReplayCreateRenderPass(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    RenderPassDescriptor renderPassDesc;
+    std::vector<SubpassDescriptor> subpasses;
+    {
+        renderPassDesc.debugName = reader.ReadString();
+        for (AttachmentFormatDescriptor& attachmentDesc : renderPassDesc.colorAttachments)
+            reader.Read(attachmentDesc);
+        reader.Read(renderPassDesc.depthAttachment);
+        reader.Read(renderPassDesc.stencilAttachment);
+        reader.Read(renderPassDesc.samples);
+        reader.ReadArray(subpasses);
+        renderPassDesc.subpasses = subpasses;
+        reader.Read(renderPassDesc.viewMask);
+    }
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreateRenderPass(renderPassDesc), CaptureRecordCreateRenderPass);
+}
+
+void CaptureReplayer::ReplayCreateRenderTarget(CaptureReader& reader)
+{
+    const std::uint32_t id              = reader.Read<std::uint32_t>();
+    const std::uint32_t renderPassID    = reader.Read<std::uint32_t>();
+
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName  = reader.ReadString();
+        renderTargetDesc.renderPass = ReadObject<RenderPass>(reader);
+        reader.Read(renderTargetDesc.resolution);
+        reader.Read(renderTargetDesc.samples);
+        for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+            ReadAttachmentDesc(reader, attachmentDesc);
+        for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+            ReadAttachmentDesc(reader, attachmentDesc);
+        ReadAttachmentDesc(reader, renderTargetDesc.depthStencilAttachment);
+    }
+
+    if (!reader.Good())
+        return;
+
+    RenderTarget* renderTarget = renderSystem_.CreateRenderTarget(renderTargetDesc);
+    AddObject(id, renderTarget, CaptureRecordCreateRenderTarget);
+
+    if (renderTarget != nullptr)
+        AddObject(renderPassID, const_cast<RenderPass*>(renderTarget->GetRenderPass()), CaptureRecordCreateRenderPass, /*owned:*/ false);
+}
+
+void CaptureReplayer::ReplayCreateShader(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    ShaderDescriptor shaderDesc;
+    std::vector<ShaderMacro> defines;
+    {
+        shaderDesc.debugName    = reader.ReadString();
+        shaderDesc.type         = reader.Read<ShaderType>();
+        shaderDesc.sourceType   = reader.Read<ShaderSourceType>();
+
+        /* Shader files have been embedded into the capture as code strings or binary buffers */
+        if (shaderDesc.sourceType == ShaderSourceType::BinaryBuffer)
+            shaderDesc.source = static_cast<const char*>(reader.ReadBytes(shaderDesc.sourceSize));
+        else
+            shaderDesc.source = reader.ReadString();
+
+        shaderDesc.entryPoint   = reader.ReadString();
+        shaderDesc.profile      = reader.ReadString();
+
+        const std::uint32_t numDefines = reader.Read<std::uint32_t>();
+        if (numDefines > 0 && numDefines <= reader.GetRemainingSize() / (sizeof(std::uint32_t) * 2))
+        {
+            defines.resize(numDefines + 1);
+            for_range(i, numDefines)
+            {
+                defines[i].name         = reader.ReadString();
+                defines[i].definition   = reader.ReadString();
+            }
+            shaderDesc.defines = defines.data();
+        }
+
+        shaderDesc.flags = reader.Read<long>();
+        ReadVertexAttributes(reader, shaderDesc.vertex.inputAttribs);
+        ReadVertexAttributes(reader, shaderDesc.vertex.outputAttribs);
+        ReadFragmentAttributes(reader, shaderDesc.fragment.outputAttribs);
+        reader.Read(shaderDesc.compute.workGroupSize);
+    }
+
+    if (!reader.Good() || shaderDesc.source == nullptr)
+        return;
+
+    Shader* shader = renderSystem_.CreateShader(shaderDesc);
+    if (shader != nullptr && report_ != nullptr)
+    {
+        if (const Report* shaderReport = shader->GetReport())
+        {
+            if (shaderReport->HasErrors())
+                report_->Errorf("%s", shaderReport->GetText());
+        }
+    }
+    AddObject(id, shader, CaptureRecordCreateShader);
+}
+
+void CaptureReplayer::ReplayCreatePipelineLayout(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    PipelineLayoutDescriptor pipelineLayoutDesc;
+    {
+        pipelineLayoutDesc.debugName = reader.ReadString();
+        ReadBindingDescs(reader, pipelineLayoutDesc.heapBindings);
+        ReadBindingDescs(reader, pipelineLayoutDesc.bindings);
+
+        const std::uint32_t numStaticSamplers = reader.Read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < numStaticSamplers && reader.Good(); ++i)
+        {
+            StaticSamplerDescriptor staticSamplerDesc;
+            {
+                const char* name = reader.ReadString();
+                staticSamplerDesc.name          = (name != nullptr ? name : "");
+                staticSamplerDesc.stageFlags    = reader.Read<long>();
+                staticSamplerDesc.slot          = reader.Read<BindingSlot>();
+                ReadSamplerDesc(reader, staticSamplerDesc.sampler);
+            }
+            pipelineLayoutDesc.staticSamplers.push_back(staticSamplerDesc);
+        }
+
+        const std::uint32_t numUniforms = reader.Read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < numUniforms && reader.Good(); ++i)
+        {
+            UniformDescriptor uniformDesc;
+            {
+                const char* name = reader.ReadString();
+                uniformDesc.name        = (name != nullptr ? name : "");
+                uniformDesc.type        = reader.Read<UniformType>();
+                uniformDesc.arraySize   = reader.Read<std::uint32_t>();
+            }
+            pipelineLayoutDesc.uniforms.push_back(uniformDesc);
+        }
+
+        pipelineLayoutDesc.barrierFlags = reader.Read<long>();
+        pipelineLayoutDesc.flags        = reader.Read<long>();
+    }
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreatePipelineLayout(pipelineLayoutDesc), CaptureRecordCreatePipelineLayout);
+}
+
+void CaptureReplayer::ReplayCreateGraphicsPipeline(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    GraphicsPipelineDescriptor pipelineStateDesc;
+    {
+        pipelineStateDesc.debugName             = reader.ReadString();
+        pipelineStateDesc.pipelineLayout        = ReadObject<PipelineLayout>(reader);
+        pipelineStateDesc.renderPass            = ReadObject<RenderPass>(reader);
+        pipelineStateDesc.subpass               = reader.Read<std::uint32_t>();
+        pipelineStateDesc.vertexShader          = ReadObject<Shader>(reader);
+        pipelineStateDesc.tessControlShader     = ReadObject<Shader>(reader);
+        pipelineStateDesc.tessEvaluationShader  = ReadObject<Shader>(reader);
+        pipelineStateDesc.geometryShader        = ReadObject<Shader>(reader);
+        pipelineStateDesc.taskShader            = ReadObject<Shader>(reader);
+        pipelineStateDesc.meshShader            = ReadObject<Shader>(reader);
+        pipelineStateDesc.fragmentShader        = ReadObject<Shader>(reader);
+        pipelineStateDesc.indexFormat           = reader.Read<Format>();
+        pipelineStateDesc.primitiveTopology     = reader.Read<PrimitiveTopology>();
+        pipelineStateDesc.dynamicStates         = reader.Read<long>();
+        reader.ReadArray(pipelineStateDesc.viewports);
+        reader.ReadArray(pipelineStateDesc.scissors);
+        reader.ReadArray(pipelineStateDesc.vertexStreams);
+        reader.Read(pipelineStateDesc.depth);
+        reader.Read(pipelineStateDesc.stencil);
+        reader.Read(pipelineStateDesc.rasterizer);
+        reader.Read(pipelineStateDesc.blend);
+        reader.Read(pipelineStateDesc.tessellation);
+    }
+
+    if (!reader.Good())
+        return;
+
+    AddObject(id, renderSystem_.CreatePipelineState(pipelineStateDesc), CaptureRecordCreateGraphicsPipeline);
+}
+
+void CaptureReplayer::ReplayCreateComputePipeline(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    ComputePipelineDescriptor pipelineStateDesc;
+    {
+        pipelineStateDesc.debugName         = reader.ReadString();
+        pipelineStateDesc.pipelineLayout    = ReadObject<PipelineLayout>(reader);
+        pipelineStateDesc.computeShader     = ReadObject<Shader>(reader);
+    }
+
+    if (!reader.Good() || pipelineStateDesc.computeShader == nullptr)
+        return;
+
+    AddObject(id, renderSystem_.CreatePipelineState(pipelineStateDesc), CaptureRecordCreateComputePipeline);
+}
+
+void CaptureReplayer::ReplayRelease(CaptureReader& reader)
+{
+    const std::uint32_t id = reader.Read<std::uint32_t>();
+
+    auto it = objects_.find(id);
+    if (it != objects_.end())
+    {
+        ReleaseObject(it->second);
+        objects_.erase(it);
+    }
+}
+
+void CaptureReplayer::ReplayWriteBuffer(CaptureReader& reader)
+{
+    Buffer*             buffer  = ReadObject<Buffer>(reader);
+    const std::uint64_t offset  = reader.Read<std::uint64_t>();
+
+    std::size_t dataSize = 0;
+    const void* data = reader.ReadBytes(dataSize);
+
+    if (buffer != nullptr && dataSize > 0)
+        renderSystem_.WriteBuffer(*buffer, offset, data, dataSize);
+}
+
+void CaptureReplayer::ReplayWriteTexture(CaptureReader& reader)
+{
+    Texture*            texture         = ReadObject<Texture>(reader);
+    const TextureRegion textureRegion   = reader.Read<TextureRegion>();
+
+    ImageView srcImageView;
+    {
+        srcImageView.format     = reader.Read<ImageFormat>();
+        srcImageView.dataType   = reader.Read<DataType>();
+        srcImageView.data       = reader.ReadBytes(srcImageView.dataSize);
+    }
+
+    if (texture != nullptr && srcImageView.dataSize > 0)
+        renderSystem_.WriteTexture(*texture, textureRegion, srcImageView);
+}
+
+void CaptureReplayer::ReplayWriteResourceHeap(CaptureReader& reader)
+{
+    ResourceHeap*       resourceHeap    = ReadObject<ResourceHeap>(reader);
+    const std::uint32_t firstDescriptor = reader.Read<std::uint32_t>();
+
+    std::vector<ResourceViewDescriptor> resourceViews;
+    ReadResourceViews(reader, resourceViews);
+
+    if (resourceHeap != nullptr && reader.Good())
+        renderSystem_.WriteResourceHeap(*resourceHeap, firstDescriptor, resourceViews);
+}
+
+void CaptureReplayer::ReplaySubmit(CaptureReader& reader)
+{
+    const std::uint32_t id      = reader.Read<std::uint32_t>();
+    const long          flags   = reader.Read<long>();
+
+    std::size_t streamSize = 0;
+    const void* stream = reader.ReadBytes(streamSize);
+
+    if (!reader.Good())
+        return;
+
+    /* Secondary command buffers are never submitted directly and not captured */
+    if ((flags & CommandBufferFlags::Secondary) != 0)
+        return;
+
+    /* Create command buffer on its first submission */
+    CommandBuffer* cmdBuffer = FindObject<CommandBuffer>(id);
+    if (cmdBuffer == nullptr)
+    {
+        CommandBufferDescriptor cmdBufferDesc;
+        cmdBufferDesc.flags = flags;
+        cmdBuffer = renderSystem_.CreateCommandBuffer(cmdBufferDesc);
+        if (cmdBuffer == nullptr)
+            return;
+        AddObject(id, cmdBuffer, CaptureRecordSubmit);
+    }
+
+    /* Encode command stream and submit command buffer; immediate command buffers are submitted by End() */
+    CaptureReader streamReader{ stream, streamSize };
+    cmdBuffer->Begin();
+    {
+        if (!ReplayCommands(*cmdBuffer, streamReader) && report_ != nullptr)
+            report_->Errorf("command stream of command buffer [%u] is corrupted\n", id);
+    }
+    cmdBuffer->End();
+
+    if ((flags & CommandBufferFlags::ImmediateSubmit) == 0)
+        renderSystem_.GetCommandQueue()->Submit(*cmdBuffer);
+}
+
+void CaptureReplayer::ReplayPresent(CaptureReader& reader)
+{
+    SwapChain* swapChain = ReadObject<SwapChain>(reader);
+    if (swapChain == nullptr)
+        return;
+
+    swapChain->Present();
+
+    if (replayDesc_.waitIdle)
+        renderSystem_.GetCommandQueue()->WaitIdle();
+
+    /* Measure elapsed time since the previous frame */
+    const std::uint64_t frameEndTick = Timer::Tick();
+    result_.frameTimes.push_back(static_cast<double>(frameEndTick - frameStartTick_) / static_cast<double>(Timer::Frequency()));
+
+    /* Keep windows responsive during replay */
+    if (!Surface::ProcessEvents())
+        quit_ = true;
+
+    frameStartTick_ = Timer::Tick();
+}
+
+bool CaptureReplayer::ReplayCommands(CommandBuffer& cmdBuffer, CaptureReader& reader)
+{
+    while (!reader.IsEnd())
+    {
+        const CaptureOpcode opcode = reader.Read<CaptureOpcode>();
+        if (!ReplayCommand(cmdBuffer, opcode, reader) || !reader.Good())
+            return false;
+    }
+    return true;
+}
+
+bool CaptureReplayer::ReplayCommand(CommandBuffer& cmdBuffer, CaptureOpcode opcode, CaptureReader& reader)
+{
+    /* Commands that refer to objects which could not be created are skipped */
+    bool replayed = true;
+
+    switch (opcode)
+    {
+        case CaptureOpcodeUnsupported:
+        {
+            reader.ReadString();
+            replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeUpdateBuffer:
+        {
+            Buffer*             dstBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t dstOffset   = reader.Read<std::uint64_t>();
+            std::size_t         dataSize    = 0;
+            const void*         data        = reader.ReadBytes(dataSize);
+            if (dstBuffer != nullptr)
+                cmdBuffer.UpdateBuffer(*dstBuffer, dstOffset, data, static_cast<std::uint16_t>(dataSize));
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyBuffer:
+        {
+            Buffer*             dstBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t dstOffset   = reader.Read<std::uint64_t>();
+            Buffer*             srcBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t srcOffset   = reader.Read<std::uint64_t>();
+            const std::uint64_t size        = reader.Read<std::uint64_t>();
+            if (dstBuffer != nullptr && srcBuffer != nullptr)
+                cmdBuffer.CopyBuffer(*dstBuffer, dstOffset, *srcBuffer, srcOffset, size);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyBufferFromTexture:
+        {
+            Buffer*             dstBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t dstOffset   = reader.Read<std::uint64_t>();
+            Texture*            srcTexture  = ReadObject<Texture>(reader);
+            const TextureRegion srcRegion   = reader.Read<TextureRegion>();
+            const std::uint32_t rowStride   = reader.Read<std::uint32_t>();
+            const std::uint32_t layerStride = reader.Read<std::uint32_t>();
+            if (dstBuffer != nullptr && srcTexture != nullptr)
+                cmdBuffer.CopyBufferFromTexture(*dstBuffer, dstOffset, *srcTexture, srcRegion, rowStride, layerStride);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeFillBuffer:
+        {
+            Buffer*             dstBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t dstOffset   = reader.Read<std::uint64_t>();
+            const std::uint32_t value       = reader.Read<std::uint32_t>();
+            const std::uint64_t fillSize    = reader.Read<std::uint64_t>();
+            if (dstBuffer != nullptr)
+                cmdBuffer.FillBuffer(*dstBuffer, dstOffset, value, fillSize);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeClearBuffer:
+        {
+            Buffer*             dstBuffer   = ReadObject<Buffer>(reader);
+            const Format        format      = reader.Read<Format>();
+            const ClearValue    clearValue  = reader.Read<ClearValue>();
+            const std::uint64_t dstOffset   = reader.Read<std::uint64_t>();
+            const std::uint64_t clearSize   = reader.Read<std::uint64_t>();
+            if (dstBuffer != nullptr)
+                cmdBuffer.ClearBuffer(*dstBuffer, format, clearValue, dstOffset, clearSize);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyTexture:
+        {
+            Texture*                dstTexture  = ReadObject<Texture>(reader);
+            const TextureLocation   dstLocation = reader.Read<TextureLocation>();
+            Texture*                srcTexture  = ReadObject<Texture>(reader);
+            const TextureLocation   srcLocation = reader.Read<TextureLocation>();
+            const Extent3D          extent      = reader.Read<Extent3D>();
+            if (dstTexture != nullptr && srcTexture != nullptr)
+                cmdBuffer.CopyTexture(*dstTexture, dstLocation, *srcTexture, srcLocation, extent);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyTextureFromBuffer:
+        {
+            Texture*            dstTexture  = ReadObject<Texture>(reader);
+            const TextureRegion dstRegion   = reader.Read<TextureRegion>();
+            Buffer*             srcBuffer   = ReadObject<Buffer>(reader);
+            const std::uint64_t srcOffset   = reader.Read<std::uint64_t>();
+            const std::uint32_t rowStride   = reader.Read<std::uint32_t>();
+            const std::uint32_t layerStride = reader.Read<std::uint32_t>();
+            if (dstTexture != nullptr && srcBuffer != nullptr)
+                cmdBuffer.CopyTextureFromBuffer(*dstTexture, dstRegion, *srcBuffer, srcOffset, rowStride, layerStride);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyTextureFromFramebuffer:
+        {
+            Texture*            dstTexture  = ReadObject<Texture>(reader);
+            const TextureRegion dstRegion   = reader.Read<TextureRegion>();
+            const Offset2D      srcOffset   = reader.Read<Offset2D>();
+            if (dstTexture != nullptr)
+                cmdBuffer.CopyTextureFromFramebuffer(*dstTexture, dstRegion, srcOffset);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeClearTexture:
+        {
+            Texture*                    texture     = ReadObject<Texture>(reader);
+            const TextureSubresource    subresource = reader.Read<TextureSubresource>();
+            const ClearValue            clearValue  = reader.Read<ClearValue>();
+            if (texture != nullptr)
+                cmdBuffer.ClearTexture(*texture, subresource, clearValue);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeDiscardResource:
+        {
+            Resource* resource = ReadObject<Resource>(reader);
+            if (resource != nullptr)
+                cmdBuffer.DiscardResource(*resource);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyBufferRegions:
+        {
+            Buffer* dstBuffer = ReadObject<Buffer>(reader);
+            Buffer* srcBuffer = ReadObject<Buffer>(reader);
+            std::vector<BufferCopyRegion> regions;
+            const std::uint32_t numRegions = ReadBytesArray(reader, regions);
+            if (dstBuffer != nullptr && srcBuffer != nullptr)
+                cmdBuffer.CopyBufferRegions(*dstBuffer, *srcBuffer, numRegions, regions.data());
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeCopyTextureRegions:
+        {
+            Texture* dstTexture = ReadObject<Texture>(reader);
+            Texture* srcTexture = ReadObject<Texture>(reader);
+            std::vector<TextureCopyRegion> regions;
+            const std::uint32_t numRegions = ReadBytesArray(reader, regions);
+            if (dstTexture != nullptr && srcTexture != nullptr)
+                cmdBuffer.CopyTextureRegions(*dstTexture, *srcTexture, numRegions, regions.data());
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeGenerateMips:
+        {
+            if (Texture* texture = ReadObject<Texture>(reader))
+                cmdBuffer.GenerateMips(*texture);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeGenerateMipsRange:
+        {
+            Texture*                    texture     = ReadObject<Texture>(reader);
+            const TextureSubresource    subresource = reader.Read<TextureSubresource>();
+            if (texture != nullptr)
+                cmdBuffer.GenerateMips(*texture, subresource);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeGenerateMipsBatch:
+        {
+            std::vector<std::uint32_t> textureIDs;
+            ReadBytesArray(reader, textureIDs);
+            std::vector<Texture*> textures;
+            textures.reserve(textureIDs.size());
+            for (std::uint32_t id : textureIDs)
+            {
+                if (Texture* texture = FindObject<Texture>(id))
+                    textures.push_back(texture);
+            }
+            if (textures.size() == textureIDs.size())
+                cmdBuffer.GenerateMips(static_cast<std::uint32_t>(textures.size()), textures.data());
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetViewport:
+        {
+            cmdBuffer.SetViewport(reader.Read<Viewport>());
+        }
+        break;
+
+        case CaptureOpcodeSetViewports:
+        {
+            std::vector<Viewport> viewports;
+            const std::uint32_t numViewports = ReadBytesArray(reader, viewports);
+            cmdBuffer.SetViewports(numViewports, viewports.data());
+        }
+        break;
+
+        case CaptureOpcodeSetScissor:
+        {
+            cmdBuffer.SetScissor(reader.Read<Scissor>());
+        }
+        break;
+
+        case CaptureOpcodeSetScissors:
+        {
+            std::vector<Scissor> scissors;
+            const std::uint32_t numScissors = ReadBytesArray(reader, scissors);
+            cmdBuffer.SetScissors(numScissors, scissors.data());
+        }
+        break;
+
+        case CaptureOpcodeSetVertexBuffer:
+        {
+            Buffer*             buffer = ReadObject<Buffer>(reader);
+            const std::uint64_t offset = reader.Read<std::uint64_t>();
+            if (buffer != nullptr)
+                cmdBuffer.SetVertexBuffer(*buffer, offset);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetVertexBufferArray:
+        {
+            BufferArray* bufferArray = ReadObject<BufferArray>(reader);
+            std::vector<std::uint64_t> offsets;
+            ReadBytesArray(reader, offsets);
+            if (bufferArray != nullptr)
+                cmdBuffer.SetVertexBufferArray(*bufferArray, (!offsets.empty() ? offsets.data() : nullptr));
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetIndexBuffer:
+        {
+            if (Buffer* buffer = ReadObject<Buffer>(reader))
+                cmdBuffer.SetIndexBuffer(*buffer);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetIndexBufferExt:
+        {
+            Buffer*             buffer = ReadObject<Buffer>(reader);
+            const Format        format = reader.Read<Format>();
+            const std::uint64_t offset = reader.Read<std::uint64_t>();
+            if (buffer != nullptr)
+                cmdBuffer.SetIndexBuffer(*buffer, format, offset);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetResourceHeap:
+        {
+            ResourceHeap*       resourceHeap    = ReadObject<ResourceHeap>(reader);
+            const std::uint32_t descriptorSet   = reader.Read<std::uint32_t>();
+            if (resourceHeap != nullptr)
+                cmdBuffer.SetResourceHeap(*resourceHeap, descriptorSet);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetResource:
+        {
+            const std::uint32_t descriptor  = reader.Read<std::uint32_t>();
+            Resource*           resource    = ReadObject<Resource>(reader);
+            if (resource != nullptr)
+                cmdBuffer.SetResource(descriptor, *resource);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetBufferRange:
+        {
+            const std::uint32_t descriptor  = reader.Read<std::uint32_t>();
+            Buffer*             buffer      = ReadObject<Buffer>(reader);
+            const std::uint64_t offset      = reader.Read<std::uint64_t>();
+            const std::uint64_t size        = reader.Read<std::uint64_t>();
+            if (buffer != nullptr)
+                cmdBuffer.SetResource(descriptor, *buffer, offset, size);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeBeginRenderPass:
+        {
+            RenderTarget*       renderTarget    = ReadObject<RenderTarget>(reader);
+            const RenderPass*   renderPass      = ReadObject<RenderPass>(reader);
+            std::vector<ClearValue> clearValues;
+            const std::uint32_t numClearValues  = ReadBytesArray(reader, clearValues);
+            const std::uint32_t swapBufferIndex = reader.Read<std::uint32_t>();
+            if (renderTarget != nullptr)
+                cmdBuffer.BeginRenderPass(*renderTarget, renderPass, numClearValues, clearValues.data(), swapBufferIndex);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeEndRenderPass:
+        {
+            cmdBuffer.EndRenderPass();
+        }
+        break;
+
+        case CaptureOpcodeNextSubpass:
+        {
+            cmdBuffer.NextSubpass();
+        }
+        break;
+
+        case CaptureOpcodeClear:
+        {
+            const long          flags       = reader.Read<long>();
+            const ClearValue    clearValue  = reader.Read<ClearValue>();
+            cmdBuffer.Clear(flags, clearValue);
+        }
+        break;
+
+        case CaptureOpcodeClearAttachments:
+        {
+            std::vector<AttachmentClear> attachments;
+            const std::uint32_t numAttachments = ReadBytesArray(reader, attachments);
+            cmdBuffer.ClearAttachments(numAttachments, attachments.data());
+        }
+        break;
+
+        case CaptureOpcodeSetPipelineState:
+        {
+            if (PipelineState* pipelineState = ReadObject<PipelineState>(reader))
+                cmdBuffer.SetPipelineState(*pipelineState);
+            else
+                replayed = false;
+        }
+        break;
+
+        case CaptureOpcodeSetBlendFactor:
+        {
+            float color[4];
+            for (float& component : color)
+                component = reader.Read<float>();
+            cmdBuffer.SetBlendFactor(color);
+        }
+        break;
+
+        case CaptureOpcodeSetStencilReference:
+        {
+            const std::uint32_t reference   = reader.Read<std::uint32_t>();
+            const StencilFace   stencilFace = reader.Read<StencilFace>();
+            cmdBuffer.SetStencilReference(reference, stencilFace);
+        }
+        break;
+
+        case CaptureOpcodeSetCullMode:
+        {
+            cmdBuffer.SetCullMode(reader.Read<CullMode>());
+        }
+        break;
+
+        case CaptureOpcodeSetDepthState:
+        {
+            cmdBuffer.SetDepthState(reader.Read<DepthDescriptor>());
+        }
+        break;
+
+        case CaptureOpcodeSetStencilState:
+        {
+            cmdBuffer.SetStencilState(reader.Read<StencilDescriptor>());
+        }
+        break;
+
+        case CaptureOpcodeSetPrimitiveTopology:
+        {
+            cmdBuffer.SetPrimitiveTopology(reader.Read<PrimitiveTopology>());
+        }
+        break;
+
+        case CaptureOpcodeSetDepthBias:
+        {
+            cmdBuffer.SetDepthBias(reader.Read<DepthBiasDescriptor>());
+        }
+        break;
+
+        case CaptureOpcodeSetShadingRate:
+        {
+            cmdBuffer.SetShadingRate(reader.Read<ShadingRateDescriptor>());
+        }
+        break;
+
+        case CaptureOpcodeSetShadingRateImage:
+        {
+            cmdBuffer.SetShadingRateImage(ReadObject<Texture>(reader));
+        }
+        break;
+
+        case CaptureOpcodeSetUniforms:
+        {
+            const std::uint32_t first       = reader.Read<std::uint32_t>();
+            std::size_t         dataSize    = 0;
+            const void*         data        = reader.ReadBytes(dataSize);
+            cmdBuffer.SetUniforms(first, data, static_cast<std::uint16_t>(dataSize));
+        }
+        break;
+
+        case CaptureOpcodeDraw:
+        {
+            const std::uint32_t numVertices = reader.Read<std::uint32_t>();
+            const std::uint32_t firstVertex = reader.Read<std::uint32_t>();
+            cmdBuffer.Draw(numVertices, firstVertex);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndexed:
+        {
+            const std::uint32_t numIndices  = reader.Read<std::uint32_t>();
+            const std::uint32_t firstIndex  = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndexedOffset:
+        {
+            const std::uint32_t numIndices      = reader.Read<std::uint32_t>();
+            const std::uint32_t firstIndex      = reader.Read<std::uint32_t>();
+            const std::int32_t  vertexOffset    = reader.Read<std::int32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureOpcodeDrawInstanced:
+        {
+            const std::uint32_t numVertices     = reader.Read<std::uint32_t>();
+            const std::uint32_t firstVertex     = reader.Read<std::uint32_t>();
+            const std::uint32_t numInstances    = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances);
+        }
+        break;
+
+        case CaptureOpcodeDrawInstancedOffset:
+        {
+            const std::uint32_t numVertices     = reader.Read<std::uint32_t>();
+            const std::uint32_t firstVertex     = reader.Read<std::uint32_t>();
+            const std::uint32_t numInstances    = reader.Read<std::uint32_t>();
+            const std::uint32_t firstInstance   = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndexedInstanced:
+        {
+            const std::uint32_t numIndices      = reader.Read<std::uint32_t>();
+            const std::uint32_t numInstances    = reader.Read<std::uint32_t>();
+            const std::uint32_t firstIndex      = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndexedInstancedOffset:
+        {
+            const std::uint32_t numIndices      = reader.Read<std::uint32_t>();
+            const std::uint32_t numInstances    = reader.Read<std::uint32_t>();
+            const std::uint32_t firstIndex      = reader.Read<std::uint32_t>();
+            const std::int32_t  vertexOffset    = reader.Read<std::int32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndexedInstancedOffsetFirst:
+        {
+            const std::uint32_t numIndices      = reader.Read<std::uint32_t>();
+            const std::uint32_t numInstances    = reader.Read<std::uint32_t>();
+            const std::uint32_t firstIndex      = reader.Read<std::uint32_t>();
+            const std::int32_t  vertexOffset    = reader.Read<std::int32_t>();
+            const std::uint32_t firstInstance   = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        }
+        break;
+
+        case CaptureOpcodeMultiDrawIndexed:
+        {
+            std::vector<DrawIndexedIndirectArguments> draws;
+            const std::uint32_t numDraws = ReadBytesArray(reader, draws);
+            cmdBuffer.MultiDrawIndexed(numDraws, draws.data());
+        }
+        break;
+
+        case CaptureOpcodeDrawIndirect:
+        case CaptureOpcodeDrawIndexedIndirect:
+        case CaptureOpcodeDispatchIndirect:
+        {
+            Buffer*             buffer = ReadObject<Buffer>(reader);
+            const std::uint64_t offset = reader.Read<std::uint64_t>();
+            if (buffer == nullptr)
+                replayed = false;
+            else if (opcode == CaptureOpcodeDrawIndirect)
+                cmdBuffer.DrawIndirect(*buffer, offset);
+            else if (opcode == CaptureOpcodeDrawIndexedIndirect)
+                cmdBuffer.DrawIndexedIndirect(*buffer, offset);
+            else
+                cmdBuffer.DispatchIndirect(*buffer, offset);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndirectN:
+        case CaptureOpcodeDrawIndexedIndirectN:
+        case CaptureOpcodeDrawMeshTasksIndirect:
+        {
+            Buffer*             buffer      = ReadObject<Buffer>(reader);
+            const std::uint64_t offset      = reader.Read<std::uint64_t>();
+            const std::uint32_t numCommands = reader.Read<std::uint32_t>();
+            const std::uint32_t stride      = reader.Read<std::uint32_t>();
+            if (buffer == nullptr)
+                replayed = false;
+            else if (opcode == CaptureOpcodeDrawIndirectN)
+                cmdBuffer.DrawIndirect(*buffer, offset, numCommands, stride);
+            else if (opcode == CaptureOpcodeDrawIndexedIndirectN)
+                cmdBuffer.DrawIndexedIndirect(*buffer, offset, numCommands, stride);
+            else
+                cmdBuffer.DrawMeshTasksIndirect(*buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CaptureOpcodeDrawIndirectCount:
+        case CaptureOpcodeDrawIndexedIndirectCount:
+        {
+            Buffer*             argumentsBuffer = ReadObject<Buffer>(reader);
+            const std::uint64_t argumentsOffset = reader.Read<std::uint64_t>();
+            Buffer*             countBuffer     = ReadObject<Buffer>(reader);
+            const std::uint64_t countOffset     = reader.Read<std::uint64_t>();
+            const std::uint32_t maxNumCommands  = reader.Read<std::uint32_t>();
+            const std::uint32_t stride          = reader.Read<std::uint32_t>();
+            if (argumentsBuffer == nullptr || countBuffer == nullptr)
+                replayed = false;
+            else if (opcode == CaptureOpcodeDrawIndirectCount)
+                cmdBuffer.DrawIndirectCount(*argumentsBuffer, argumentsOffset, *countBuffer, countOffset, maxNumCommands, stride);
+            else
+                cmdBuffer.DrawIndexedIndirectCount(*argumentsBuffer, argumentsOffset, *countBuffer, countOffset, maxNumCommands, stride);
+        }
+        break;
+
+        case CaptureOpcodeDrawMeshTasks:
+        {
+            const std::uint32_t numThreadGroupsX = reader.Read<std::uint32_t>();
+            const std::uint32_t numThreadGroupsY = reader.Read<std::uint32_t>();
+            const std::uint32_t numThreadGroupsZ = reader.Read<std::uint32_t>();
+            cmdBuffer.DrawMeshTasks(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+        }
+        break;
+
+        case CaptureOpcodeDispatch:
+        {
+            const std::uint32_t numWorkGroupsX = reader.Read<std::uint32_t>();
+            const std::uint32_t numWorkGroupsY = reader.Read<std::uint32_t>();
+            const std::uint32_t numWorkGroupsZ = reader.Read<std::uint32_t>();
+            cmdBuffer.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+        break;
+
+        case CaptureOpcodePushDebugGroup:
+        {
+            const char* name = reader.ReadString();
+            cmdBuffer.PushDebugGroup(name != nullptr ? name : "");
+        }
+        break;
+
+        case CaptureOpcodePopDebugGroup:
+        {
+            cmdBuffer.PopDebugGroup();
+        }
+        break;
+
+        default:
+            return false;
+    }
+
+    if (replayed)
+        result_.numCommands++;
+    else
+        result_.numSkippedCommands++;
+
+    return true;
+}
+
+void CaptureReplayer::AddObject(std::uint32_t id, RenderSystemChild* object, CaptureRecord type, bool owned)
+{
+    if (id != 0 && object != nullptr)
+        objects_[id] = ReplayObject{ object, type, owned };
+}
+
+void CaptureReplayer::ReleaseObject(const ReplayObject& entry)
+{
+    if (!entry.owned)
+        return;
+
+    switch (entry.type)
+    {
+        case CaptureRecordCreateSwapChain:          renderSystem_.Release(*static_cast<SwapChain*>(entry.object));      break;
+        case CaptureRecordCreateBuffer:             renderSystem_.Release(*static_cast<Buffer*>(entry.object));         break;
+        case CaptureRecordCreateBufferArray:        renderSystem_.Release(*static_cast<BufferArray*>(entry.object));    break;
+        case CaptureRecordCreateTexture:            renderSystem_.Release(*static_cast<Texture*>(entry.object));        break;
+        case CaptureRecordCreateSampler:            renderSystem_.Release(*static_cast<Sampler*>(entry.object));        break;
+        case CaptureRecordCreateResourceHeap:       renderSystem_.Release(*static_cast<ResourceHeap*>(entry.object));   break;
+        case CaptureRecordCreateRenderPass:         renderSystem_.Release(*static_cast<RenderPass*>(entry.object));     break;
+        case CaptureRecordCreateRenderTarget:       renderSystem_.Release(*static_cast<RenderTarget*>(entry.object));   break;
+        case CaptureRecordCreateShader:             renderSystem_.Release(*static_cast<Shader*>(entry.object));         break;
+        case CaptureRecordCreatePipelineLayout:     renderSystem_.Release(*static_cast<PipelineLayout*>(entry.object)); break;
+        case CaptureRecordCreateGraphicsPipeline:
+        case CaptureRecordCreateComputePipeline:    renderSystem_.Release(*static_cast<PipelineState*>(entry.object));  break;
+        case CaptureRecordSubmit:                   renderSystem_.Release(*static_cast<CommandBuffer*>(entry.object));  break;
+        default:                                                                                                        break;
+    }
+}
+
+template <typename T>
+T* CaptureReplayer::FindObject(std::uint32_t id) const
+{
+    auto it = objects_.find(id);
+    return (it != objects_.end() ? static_cast<T*>(it->second.object) : nullptr);
+}
+
+template <typename T>
+T* CaptureReplayer::ReadObject(CaptureReader& reader) const
+{
+    return FindObject<T>(reader.Read<std::uint32_t>());
+}
+
+void CaptureReplayer::ReadVertexAttributes(CaptureReader& reader, std::vector<VertexAttribute>& outAttribs)
+{
+    const std::uint32_t numAttribs = reader.Read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < numAttribs && reader.Good(); ++i)
+    {
+        VertexAttribute attrib;
+        {
+            const char* name = reader.ReadString();
+            attrib.name             = (name != nullptr ? name : "");
+            attrib.format           = reader.Read<Format>();
+            attrib.location         = reader.Read<std::uint32_t>();
+            attrib.semanticIndex    = reader.Read<std::uint32_t>();
+            attrib.systemValue      = reader.Read<SystemValue>();
+            attrib.slot             = reader.Read<std::uint32_t>();
+            attrib.offset           = reader.Read<std::uint32_t>();
+            attrib.stride           = reader.Read<std::uint32_t>();
+            attrib.instanceDivisor  = reader.Read<std::uint32_t>();
+        }
+        outAttribs.push_back(attrib);
+    }
+}
+
+void CaptureReplayer::ReadFragmentAttributes(CaptureReader& reader, std::vector<FragmentAttribute>& outAttribs)
+{
+    const std::uint32_t numAttribs = reader.Read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < numAttribs && reader.Good(); ++i)
+    {
+        FragmentAttribute attrib;
+        {
+            const char* name = reader.ReadString();
+            attrib.name         = (name != nullptr ? name : "");
+            attrib.format       = reader.Read<Format>();
+            attrib.location     = reader.Read<std::uint32_t>();
+            attrib.systemValue  = reader.Read<SystemValue>();
+        }
+        outAttribs.push_back(attrib);
+    }
+}
+
+void CaptureReplayer::ReadBindingDescs(CaptureReader& reader, std::vector<BindingDescriptor>& outBindingDescs)
+{
+    const std::uint32_t numBindings = reader.Read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < numBindings && reader.Good(); ++i)
+    {
+        BindingDescriptor bindingDesc;
+        {
+            const char* name = reader.ReadString();
+            bindingDesc.name        = (name != nullptr ? name : "");
+            bindingDesc.type        = reader.Read<ResourceType>();
+            bindingDesc.bindFlags   = reader.Read<long>();
+            bindingDesc.stageFlags  = reader.Read<long>();
+            bindingDesc.slot        = reader.Read<BindingSlot>();
+            bindingDesc.arraySize   = reader.Read<std::uint32_t>();
+        }
+        outBindingDescs.push_back(bindingDesc);
+    }
+}
+
+void CaptureReplayer::ReadSamplerDesc(CaptureReader& reader, SamplerDescriptor& outSamplerDesc)
+{
+    const char* debugName = reader.ReadString();
+    outSamplerDesc = reader.Read<SamplerDescriptor>();
+    outSamplerDesc.debugName = debugName;
+}
+
+void CaptureReplayer::ReadResourceViews(CaptureReader& reader, std::vector<ResourceViewDescriptor>& outResourceViews)
+{
+    const std::uint32_t numResourceViews = reader.Read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < numResourceViews && reader.Good(); ++i)
+    {
+        ResourceViewDescriptor resourceView;
+        {
+            resourceView.resource       = ReadObject<Resource>(reader);
+            resourceView.textureView    = reader.Read<TextureViewDescriptor>();
+            resourceView.bufferView     = reader.Read<BufferViewDescriptor>();
+            resourceView.initialCount   = reader.Read<std::uint32_t>();
+        }
+        outResourceViews.push_back(resourceView);
+    }
+}
+
+void CaptureReplayer::ReadAttachmentDesc(CaptureReader& reader, AttachmentDescriptor& outAttachmentDesc)
+{
+    outAttachmentDesc.format        = reader.Read<Format>();
+    outAttachmentDesc.texture       = ReadObject<Texture>(reader);
+    outAttachmentDesc.mipLevel      = reader.Read<std::uint32_t>();
+    outAttachmentDesc.arrayLayer    = reader.Read<std::uint32_t>();
+}
+
+
+/*
+ * ReplayCapture function
+ */
+
+LLGL_EXPORT bool ReplayCapture(
+    RenderSystem&                   renderSystem,
+    const char*                     filename,
+    const CaptureReplayDescriptor&  replayDesc,
+    CaptureReplayResult&            outResult,
+    Report*                         report)
+{
+    outResult = {};
+
+    /* Read entire capture file into memory, so strings and byte arrays can be referenced in place */
+    const std::vector<char> capture = ReadFileBuffer(filename);
+    if (capture.empty())
+    {
+        if (report != nullptr)
+            report->Errorf("failed to read capture file: %s\n", filename);
+        return false;
+    }
+
+    CaptureReader reader{ capture.data(), capture.size() };
+
+    const CaptureHeader header = reader.Read<CaptureHeader>();
+    if (!reader.Good() || header.magic != g_captureMagic)
+    {
+        if (report != nullptr)
+            report->Errorf("invalid capture file: %s\n", filename);
+        return false;
+    }
+    if (header.version != g_captureVersion)
+    {
+        if (report != nullptr)
+            report->Errorf("unsupported capture version %u (expected %u): %s\n", header.version, g_captureVersion, filename);
+        return false;
+    }
+
+    /* Replay all records for each loop and release all objects in between, so each loop starts with the same state */
+    CaptureReplayer replayer{ renderSystem, replayDesc, outResult, report };
+
+    for (std::uint32_t loop = 0; loop < replayDesc.numLoops && !replayer.HasQuit(); ++loop)
+    {
+        CaptureReader recordReader = reader;
+        if (!replayer.ReplayRecords(recordReader))
+            return false;
+        replayer.ReleaseAll();
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,35 @@
+/*
+ * CommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+bool CommandQueue::QueryTimestampCalibration(TimestampCalibration& /*outCalibration*/)
+{
+    return false; // dummy
+}
+
+void CommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    // dummy
+}
+
+bool CommandQueue::UpdateTileMappings(Texture& /*texture*/, std::uint32_t /*numMappings*/, const SparseTextureMapping* /*mappings*/)
+{
+    return false; // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
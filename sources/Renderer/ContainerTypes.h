@@ -11,11 +11,14 @@
 
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
+#include "../Core/SlotAllocator.h"
 #include "CheckedCast.h"
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <utility>
 #include <type_traits>
+#include <new>
 #include <unordered_set>
 #include <cstdint>
 
@@ -64,249 +67,230 @@ SubType* TakeOwnership(std::vector<std::unique_ptr<BaseType>>& objectSet, std::u
  * Global container class templates
  */
 
-// Alternative for std::unique_ptr<T> with an index into its owning container for fast removal.
-template <typename T, typename Payload, std::size_t Alignment = alignof(T)>
-class PayloadUniquePtr final
+/*
+Container class for an array of unordered objects that are stored in slots of fixed size. Used by RenderSystem implementations for all child objects.
+Objects are allocated from a SlotAllocator for each distinct size and alignment, so objects of the same type are stored contiguously,
+and each slot has a header with the object's index into the array of this container for O(1) removal.
+Each container has its own mutex, so the registry of each object type is a separate shard: emplace() and erase() can be called from multiple threads,
+and objects are constructed and destroyed outside of the lock. Iterating over the container is not synchronized.
+*/
+template <typename T>
+class SlotObjectContainer
 {
 
-        static_assert(std::is_standard_layout<Payload>::value, "PayloadUniquePtr<T, Payload, Alignment>: Payload must be a standard layout");
-        static_assert(Alignment > 0, "PayloadUniquePtr<T, Payload, Alignment>: Alignment must be greater than 0");
-
     public:
 
-        using pointer       = T*;
-        using reference     = T&;
-        using element_type  = T;
+        using container_type    = std::vector<T*>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
 
     public:
 
-        PayloadUniquePtr() = default;
+        SlotObjectContainer() = default;
 
-        PayloadUniquePtr(const PayloadUniquePtr&) = delete;
-        PayloadUniquePtr& operator = (const PayloadUniquePtr&) = delete;
+        SlotObjectContainer(const SlotObjectContainer&) = delete;
+        SlotObjectContainer& operator = (const SlotObjectContainer&) = delete;
 
-        template <typename TOther>
-        PayloadUniquePtr(PayloadUniquePtr<TOther, Payload>&& rhs) :
-            mem_ { rhs.release() }
+        ~SlotObjectContainer()
         {
+            clear();
         }
 
-        template <typename TOther>
-        PayloadUniquePtr& operator = (PayloadUniquePtr<TOther, Payload>&& rhs)
+        /*
+        Allocates a new object for this container and returns a non-owning raw pointer to that object.
+        The internal mutex is only locked to allocate the object's slot and to insert the object, so objects can be constructed concurrently.
+        */
+        template <typename TSub, typename... Args>
+        TSub* emplace(Args&&... args)
         {
-            if (this != &rhs)
-                reset(rhs.release());
-            return *this;
-        }
+            /* Allocate slot with lock, but construct object without lock */
+            SlotAllocator* allocator = nullptr;
+            void* slot = nullptr;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                allocator = &(GetOrCreateAllocator<TSub>());
+                slot = allocator->Allocate();
+            }
 
-        ~PayloadUniquePtr()
-        {
-            reset();
-        }
+            TSub* object = nullptr;
+            try
+            {
+                object = ::new (GetSlotObject(slot, allocator->GetSlotAlignment())) TSub(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                allocator->Free(slot);
+                throw;
+            }
 
-        char* release()
-        {
-            char* mem = mem_;
-            mem_ = nullptr;
-            return mem;
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            Insert(object, *allocator);
+            return object;
         }
 
-        void reset(char* mem = nullptr)
+        // Releases the memory for the specified object in that list. The object is destroyed outside of the internal mutex.
+        template <typename TBase>
+        void erase(TBase* object)
         {
-            if (mem_ != mem)
+            if (object != nullptr)
             {
-                if (mem_ != nullptr)
+                T* subTypedObject = ObjectCast<T*>(object);
                 {
-                    /* Call destructor and free memory including payload */
-                    get()->~T();
-                    ::delete [] mem_;
+                    std::lock_guard<std::mutex> guard{ mutex_ };
+
+                    /* Locate object in container with index from slot header */
+                    SlotHeader* header = GetSlotHeader(subTypedObject);
+                    LLGL_ASSERT(header->index < objects_.size());
+
+                    if (header->index + 1 < objects_.size())
+                    {
+                        /* Move last element to location of the input object in order to delete it */
+                        objects_[header->index] = objects_.back();
+
+                        /* Update header for moved object */
+                        GetSlotHeader(objects_[header->index])->index = header->index;
+                    }
+
+                    /* Remove last element in container; it's either input object or the one moved that object's location */
+                    objects_.pop_back();
                 }
-                mem_ = mem;
-            }
-        }
 
-        pointer get() const noexcept
-        {
-            return reinterpret_cast<pointer>(addr());
-        }
+                /* Destroy object without lock, then release its slot */
+                SlotAllocator* allocator = GetSlotHeader(subTypedObject)->allocator;
+                void* slot = DestroyInSlot(subTypedObject, *allocator);
 
-        void swap(PayloadUniquePtr& other) noexcept
-        {
-            std::swap(other.mem_, mem_);
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                allocator->Free(slot);
+            }
         }
 
-        Payload& payload() noexcept
+        void clear()
         {
-            return *reinterpret_cast<Payload*>(addr() - sizeof(Payload));
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            for (T* object : objects_)
+            {
+                SlotAllocator* allocator = GetSlotHeader(object)->allocator;
+                allocator->Free(DestroyInSlot(object, *allocator));
+            }
+            objects_.clear();
         }
 
-        const Payload& payload() const noexcept
+        bool empty() const
         {
-            return *reinterpret_cast<const Payload*>(addr() - sizeof(Payload));
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return objects_.empty();
         }
 
     public:
 
-        pointer operator -> () const noexcept
+        const_iterator cbegin() const
         {
-            return get();
+            return objects_.cbegin();
         }
 
-        reference operator * () const noexcept
+        const_iterator begin() const
         {
-            return *get();
+            return objects_.begin();
         }
 
-        operator bool () const noexcept
+        iterator begin()
         {
-            return (get() != nullptr);
+            return objects_.begin();
         }
 
-    public:
-
-        template <typename... Args>
-        static PayloadUniquePtr<T, Payload> Alloc(const Payload& payload, Args&&... args)
+        const_iterator cend() const
         {
-            /* Allocate memory for payload and object with enough padding to have pointer alignment of <T> */
-            constexpr auto payloadAndPaddingSize = sizeof(Payload) + Alignment - 1;
-            char* mem = ::new char[sizeof(T) + payloadAndPaddingSize];
-
-            /* Construct unique pointer with payload */
-            PayloadUniquePtr<T, Payload> ptr{ mem };
-            ptr.payload() = payload;
-            ::new (ptr.get()) T(std::forward<Args>(args)...);
-
-            return ptr;
+            return objects_.cend();
         }
 
-    private:
-
-        PayloadUniquePtr(char* mem) :
-            mem_ { mem }
+        const_iterator end() const
         {
+            return objects_.end();
         }
 
-        // Returns the aligned memory address that points to the object.
-        std::uintptr_t addr() const
+        iterator end()
         {
-            auto addr = reinterpret_cast<std::uintptr_t>(mem_);
-            return GetAlignedSize(addr + sizeof(Payload), Alignment);
+            return objects_.end();
         }
 
     private:
 
-        char* mem_ = nullptr;
-
-};
-
-// Payload structure for indexed unique pointers. See IndexedUniquePtr<T>.
-struct IndexPayload
-{
-    std::size_t index;
-};
-
-template <typename T>
-using IndexedUniquePtr = PayloadUniquePtr<T, IndexPayload>;
-
-// Container class for an array of unordered unique pointers. Used by RenderSystem implementations for all child objects.
-template <typename T>
-class UnorderedUniquePtrVector
-{
-
-    public:
-
-        using container_type    = std::vector<IndexedUniquePtr<T>>;
-        using iterator          = typename container_type::iterator;
-        using const_iterator    = typename container_type::const_iterator;
-
-    public:
-
-        // Allocates a new object for this container and returns a non-owning raw pointer to that object.
-        template <typename TSub, typename... Args>
-        TSub* emplace(Args&&... args)
+        // Header that is stored immediately before each object within its slot.
+        struct SlotHeader
         {
-            /* Allocate object and assign index from container in payload */
-            const IndexPayload payload{ container_.size() };
-            IndexedUniquePtr<TSub> object = IndexedUniquePtr<TSub>::Alloc(payload, std::forward<Args>(args)...);
-            TSub* ref = object.get();
-            container_.push_back(std::move(object));
-            return ref;
-        }
+            std::size_t     index;      // Index into the object array.
+            SlotAllocator*  allocator;  // Allocator of the slot.
+        };
 
-        // Releases the memory for the specified object in that list.
-        template <typename TBase>
-        void erase(TBase* object)
-        {
-            if (object != nullptr)
-            {
-                /* Locate object in container with index from payload */
-                T* subTypedObject = ObjectCast<T*>(object);
-                auto* payload = reinterpret_cast<IndexPayload*>(reinterpret_cast<char*>(subTypedObject) - sizeof(IndexPayload));
-                LLGL_ASSERT(payload->index < container_.size());
-
-                if (payload->index + 1 < container_.size())
-                {
-                    /* Move last element to location of the input object in order to delete it */
-                    std::swap(container_[payload->index], container_.back());
-
-                    /* Update payload for moved object */
-                    container_[payload->index].payload() = *payload;
-                }
-
-                /* Remove last element in container; it's either input object or the one moved that object's location */
-                container_.pop_back();
-            }
-        }
+    private:
 
-        void clear()
+        // Returns the offset (in bytes) from the beginning of a slot to its object.
+        static constexpr std::size_t GetObjectOffset(std::size_t alignment)
         {
-            container_.clear();
+            return GetAlignedSize<std::size_t>(sizeof(SlotHeader), alignment);
         }
 
-        bool empty() const
+        template <typename TSub>
+        static constexpr std::size_t GetSlotAlignment()
         {
-            return container_.empty();
+            return (alignof(TSub) > alignof(SlotHeader) ? alignof(TSub) : alignof(SlotHeader));
         }
 
-    public:
-
-        const_iterator cbegin() const
+        static void* GetSlotObject(void* slot, std::size_t alignment)
         {
-            return container_.cbegin();
+            return static_cast<char*>(slot) + GetObjectOffset(alignment);
         }
 
-        const_iterator begin() const
+        static SlotHeader* GetSlotHeader(T* object)
         {
-            return container_.begin();
+            return reinterpret_cast<SlotHeader*>(reinterpret_cast<char*>(object) - sizeof(SlotHeader));
         }
 
-        iterator begin()
+        // Returns the allocator for slots that fit the specified type. Allocators are shared by all types with equal slot size and alignment.
+        template <typename TSub>
+        SlotAllocator& GetOrCreateAllocator()
         {
-            return container_.begin();
-        }
+            constexpr std::size_t alignment = GetSlotAlignment<TSub>();
+            const std::size_t slotSize = GetAlignedSize<std::size_t>(GetObjectOffset(alignment) + sizeof(TSub), alignment);
 
-        const_iterator cend() const
-        {
-            return container_.cend();
+            for (const std::unique_ptr<SlotAllocator>& allocator : allocators_)
+            {
+                if (allocator->GetSlotSize() == slotSize && allocator->GetSlotAlignment() == alignment)
+                    return *allocator;
+            }
+
+            allocators_.push_back(MakeUnique<SlotAllocator>(slotSize, alignment));
+            return *allocators_.back();
         }
 
-        const_iterator end() const
+        void Insert(T* object, SlotAllocator& allocator)
         {
-            return container_.end();
+            SlotHeader* header = GetSlotHeader(object);
+            header->index       = objects_.size();
+            header->allocator   = &allocator;
+            objects_.push_back(object);
         }
 
-        iterator end()
+        // Destroys the specified object and returns its slot, which must be released by the caller.
+        static void* DestroyInSlot(T* object, SlotAllocator& allocator)
         {
-            return container_.end();
+            object->~T();
+            return static_cast<char*>(static_cast<void*>(object)) - GetObjectOffset(allocator.GetSlotAlignment());
         }
 
     private:
 
-        container_type container_;
+        std::vector<std::unique_ptr<SlotAllocator>> allocators_;
+        container_type                              objects_;
+        mutable std::mutex                          mutex_;
 
 };
 
-// Container class for a set of unordered unique pointers. Used by RenderSystem implementations for all child objects.
+/*
+Container class for a set of unordered unique pointers. Used by RenderSystem implementations for all child objects.
+Same thread-safety guarantees as SlotObjectContainer, except that objects are destroyed while the internal mutex is locked.
+*/
 template <typename T>
 class UnorderedUniquePtrSet
 {
@@ -319,27 +303,32 @@ class UnorderedUniquePtrSet
 
     public:
 
-        // Allocates a new object for this container and returns a non-owning raw pointer to that object.
+        // Allocates a new object outside of the internal mutex, which is only locked to insert the object. Allows objects to be constructed concurrently.
         template <typename TSub, typename... Args>
         TSub* emplace(Args&&... args)
         {
-            return TakeOwnership(container_, MakeUnique<TSub>(std::forward<Args>(args)...));
+            std::unique_ptr<TSub> object = MakeUnique<TSub>(std::forward<Args>(args)...);
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return TakeOwnership(container_, std::move(object));
         }
 
         // Releases the memory for the specified object in that list.
         template <typename TBase>
         void erase(TBase* object)
         {
+            std::lock_guard<std::mutex> guard{ mutex_ };
             RemoveFromUniqueSet(container_, object);
         }
 
         void clear()
         {
+            std::lock_guard<std::mutex> guard{ mutex_ };
             container_.clear();
         }
 
         bool empty() const
         {
+            std::lock_guard<std::mutex> guard{ mutex_ };
             return container_.empty();
         }
 
@@ -377,7 +366,8 @@ class UnorderedUniquePtrSet
 
     private:
 
-        container_type container_;
+        container_type      container_;
+        mutable std::mutex  mutex_;
 
 };
 
@@ -397,7 +387,7 @@ using HWObjectContainer = UnorderedUniquePtrSet<T>;
 #else
 
 template <typename T>
-using HWObjectContainer = UnorderedUniquePtrVector<T>;
+using HWObjectContainer = SlotObjectContainer<T>;
 
 #endif
 
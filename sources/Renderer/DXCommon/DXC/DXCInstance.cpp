@@ -8,23 +8,42 @@
 #include "DXCInstance.h"
 #include <LLGL/ShaderFlags.h>
 #include "../../../Platform/Module.h"
+#include "../../../Core/CoreUtils.h"
 #include <dxcapi.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 
 namespace LLGL
 {
 
 
+// Compiler interfaces for a single thread; these are not thread-safe, so each concurrent compilation takes its own instance from the pool.
+struct DXCCompiler
+{
+    ComPtr<IDxcCompiler3>       compiler;
+    ComPtr<IDxcUtils>           utils;
+    ComPtr<IDxcIncludeHandler>  includeHandler;
+};
+
+using DXCCompilerPtr = std::unique_ptr<DXCCompiler>;
+
 struct DXCInstance
 {
-    std::unique_ptr<Module> module;
-    DxcCreateInstanceProc   dxcCreateInstance   = nullptr;
+    std::mutex                                          mutex;
+    std::unique_ptr<Module>                             module;
+    DxcCreateInstanceProc                               dxcCreateInstance   = nullptr;
+    std::vector<DXCCompilerPtr>                         compilerPool;       // Compiler instances that are currently not in use
+    std::unordered_map<std::uint64_t, ComPtr<ID3DBlob>> dxilCache;          // DXIL byte codes by content hash
 };
 
 static DXCInstance g_DXCInstance;
 
 HRESULT DXLoadDxcompilerInterface()
 {
+    std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+
     /* Early exit if we already loaded the interface */
     if (g_DXCInstance.module)
         return S_OK;
@@ -45,6 +64,54 @@ HRESULT DXLoadDxcompilerInterface()
     return S_OK;
 }
 
+void DXClearDxcompilerCache()
+{
+    std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+    g_DXCInstance.compilerPool.clear();
+    g_DXCInstance.dxilCache.clear();
+}
+
+// Takes a compiler instance from the pool or creates a new one if all instances are in use.
+static HRESULT DXAcquireCompiler(DXCCompilerPtr& outCompiler)
+{
+    {
+        std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+        if (g_DXCInstance.dxcCreateInstance == nullptr)
+            return E_FAIL;
+        if (!g_DXCInstance.compilerPool.empty())
+        {
+            outCompiler = std::move(g_DXCInstance.compilerPool.back());
+            g_DXCInstance.compilerPool.pop_back();
+            return S_OK;
+        }
+    }
+
+    /* Create new compiler instance outside of the lock; the procedure is never reset while the module is loaded */
+    DXCCompilerPtr newCompiler = MakeUnique<DXCCompiler>();
+
+    HRESULT hr = g_DXCInstance.dxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&(newCompiler->compiler)));
+    if (FAILED(hr))
+        return hr;
+
+    hr = g_DXCInstance.dxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&(newCompiler->utils)));
+    if (FAILED(hr))
+        return hr;
+
+    hr = newCompiler->utils->CreateDefaultIncludeHandler(&(newCompiler->includeHandler));
+    if (FAILED(hr))
+        return hr;
+
+    outCompiler = std::move(newCompiler);
+    return S_OK;
+}
+
+// Returns the compiler instance to the pool.
+static void DXReleaseCompiler(DXCCompilerPtr&& compiler)
+{
+    std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+    g_DXCInstance.compilerPool.push_back(std::move(compiler));
+}
+
 std::vector<LPCWSTR> DXGetDxcCompilerArgs(int flags)
 {
     std::vector<LPCWSTR> dxArgs;
@@ -68,44 +135,48 @@ std::vector<LPCWSTR> DXGetDxcCompilerArgs(int flags)
 }
 
 HRESULT DXCompileShaderToDxil(
-    const char* source,
-    std::size_t sourceLength,
-    LPCWSTR*    args,
-    std::size_t numArgs,
-    ID3DBlob**  outByteCode,
-    ID3DBlob**  outErrors)
+    const char*     source,
+    std::size_t     sourceLength,
+    LPCWSTR*        args,
+    std::size_t     numArgs,
+    ID3DBlob**      outByteCode,
+    ID3DBlob**      outErrors,
+    std::uint64_t   contentHash)
 {
-    if (g_DXCInstance.dxcCreateInstance == nullptr)
-        return E_FAIL;
+    /* Return cached byte code if the same shader has already been compiled */
+    if (contentHash != 0)
+    {
+        std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+        auto it = g_DXCInstance.dxilCache.find(contentHash);
+        if (it != g_DXCInstance.dxilCache.end())
+        {
+            it->second.CopyTo(outByteCode);
+            return S_OK;
+        }
+    }
+
+    DXCCompilerPtr compiler;
+    HRESULT hr = DXAcquireCompiler(compiler);
+    if (FAILED(hr))
+        return hr;
 
     DxcBuffer sourceBuffer;
     sourceBuffer.Ptr        = source;
     sourceBuffer.Size       = sourceLength;
     sourceBuffer.Encoding   = DXC_CP_ACP;
 
-    ComPtr<IDxcCompiler3> compiler;
-    HRESULT hr = g_DXCInstance.dxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&compiler));
-    if (FAILED(hr))
-        return hr;
-
-    ComPtr<IDxcUtils> utils;
-    hr = g_DXCInstance.dxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&utils));
-    if (FAILED(hr))
-        return hr;
-
-    ComPtr<IDxcIncludeHandler> includeHandler;
-    hr = utils->CreateDefaultIncludeHandler(&includeHandler);
-    if (FAILED(hr))
-        return hr;
-
     ComPtr<IDxcResult> result;
-    hr = compiler->Compile(
+    hr = compiler->compiler->Compile(
         &sourceBuffer,
         args,
         static_cast<UINT32>(numArgs),
-        includeHandler.Get(),
+        compiler->includeHandler.Get(),
         IID_PPV_ARGS(&result)
     );
+
+    /* Compiler instance can be reused as soon as the result is available */
+    DXReleaseCompiler(std::move(compiler));
+
     if (FAILED(hr))
         return hr;
 
@@ -127,6 +198,13 @@ HRESULT DXCompileShaderToDxil(
     if (FAILED(hr))
         return hr;
 
+    /* Store byte code in cache for subsequent compilations of the same shader */
+    if (contentHash != 0 && SUCCEEDED(compileResult) && *outByteCode != nullptr)
+    {
+        std::lock_guard<std::mutex> guard{ g_DXCInstance.mutex };
+        g_DXCInstance.dxilCache[contentHash] = *outByteCode;
+    }
+
     return compileResult;
 }
 
@@ -134,13 +212,11 @@ HRESULT DXReflectDxilShader(
     ID3DBlob*                   byteCode,
     ID3D12ShaderReflection**    outReflection)
 {
-    if (g_DXCInstance.dxcCreateInstance == nullptr)
-        return E_FAIL;
     if (byteCode == nullptr)
         return E_INVALIDARG;
 
-    ComPtr<IDxcUtils> dxcUtils;
-    HRESULT hr = g_DXCInstance.dxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&dxcUtils));
+    DXCCompilerPtr compiler;
+    HRESULT hr = DXAcquireCompiler(compiler);
     if (FAILED(hr))
         return hr;
 
@@ -149,11 +225,10 @@ HRESULT DXReflectDxilShader(
     reflectionBuffer.Size       = byteCode->GetBufferSize();
     reflectionBuffer.Encoding   = DXC_CP_ACP;
 
-    hr = dxcUtils->CreateReflection(&reflectionBuffer, IID_PPV_ARGS(outReflection));
-    if (FAILED(hr))
-        return hr;
+    hr = compiler->utils->CreateReflection(&reflectionBuffer, IID_PPV_ARGS(outReflection));
+    DXReleaseCompiler(std::move(compiler));
 
-    return S_OK;
+    return hr;
 }
 
 
@@ -12,26 +12,35 @@
 #include "../ComPtr.h"
 #include <d3d12shader.h>
 #include <vector>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
-// Loads the DirectXShaderCompiler (DXC).
+// Loads the DirectXShaderCompiler (DXC). This function is thread-safe.
 HRESULT DXLoadDxcompilerInterface();
 
+// Releases all pooled DXC compiler instances and cached DXIL byte codes.
+void DXClearDxcompilerCache();
+
 // Returns the compiler arguments for the 'ShaderCompileFlags' enumeration values for the DirectXShaderCompiler (DXC).
 std::vector<LPCWSTR> DXGetDxcCompilerArgs(int flags);
 
-// Compiles the specified shader source to DXIL byte code with the DirectXShaderCompiler (DXC).
+/*
+Compiles the specified shader source to DXIL byte code with the DirectXShaderCompiler (DXC).
+This function is thread-safe and takes a compiler instance from a pool, so multiple shaders can be compiled concurrently.
+If 'contentHash' is non-zero, the byte code is cached under this hash for the lifetime of the process and returned for subsequent calls with the same hash.
+*/
 HRESULT DXCompileShaderToDxil(
-    const char* source,
-    std::size_t sourceLength,
-    LPCWSTR*    args,
-    std::size_t numArgs,
-    ID3DBlob**  outByteCode,
-    ID3DBlob**  outErrors
+    const char*     source,
+    std::size_t     sourceLength,
+    LPCWSTR*        args,
+    std::size_t     numArgs,
+    ID3DBlob**      outByteCode,
+    ID3DBlob**      outErrors,
+    std::uint64_t   contentHash = 0
 );
 
 // Reflects the specified DXIL shader byte code.
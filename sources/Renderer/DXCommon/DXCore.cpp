@@ -12,12 +12,16 @@
 #include "../../Core/StringUtils.h"
 #include "../../Core/MacroUtils.h"
 #include "../../Core/Vendor.h"
+#include "../PersistentPipelineCache.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/ShaderFlags.h>
 #include <LLGL/RenderSystemFlags.h>
 #include <stdexcept>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 #include <d3dcompiler.h>
+#include <dxgi1_5.h>
 
 
 #ifndef LLGL_BUILD_STATIC_LIB
@@ -321,6 +325,74 @@ UINT DXGetFxcCompilerFlags(int flags)
     return dxFlags;
 }
 
+std::uint64_t DXGetShaderCompilerCacheKey(
+    const char*             compilerName,
+    const char*             sourceCode,
+    std::size_t             sourceLength,
+    const D3D_SHADER_MACRO* defines,
+    const char*             entry,
+    const char*             target,
+    int                     flags)
+{
+    PersistentPipelineCacheKey key;
+    key.AppendString(compilerName);
+    key.Append(static_cast<std::uint64_t>(sourceLength));
+    key.AppendBytes(sourceCode, sourceLength);
+    if (defines != nullptr)
+    {
+        for (; defines->Name != nullptr; ++defines)
+        {
+            key.AppendString(defines->Name);
+            key.AppendString(defines->Definition);
+        }
+    }
+    key.AppendString(entry);
+    key.AppendString(target);
+    key.Append(flags);
+    return key.Get();
+}
+
+std::uint64_t DXGetShaderReflectionCacheKey(ID3DBlob* byteCode, ShaderType type)
+{
+    PersistentPipelineCacheKey key;
+    key.Append(type);
+    if (byteCode != nullptr)
+        key.AppendBytes(byteCode->GetBufferPointer(), byteCode->GetBufferSize());
+    return key.Get();
+}
+
+struct DXShaderReflectionCache
+{
+    std::mutex                                          mutex;
+    std::unordered_map<std::uint64_t, ShaderReflection> reflections;
+};
+
+static DXShaderReflectionCache g_shaderReflectionCache;
+
+bool DXFindCachedShaderReflection(std::uint64_t key, ShaderReflection& outReflection)
+{
+    std::lock_guard<std::mutex> guard{ g_shaderReflectionCache.mutex };
+    auto it = g_shaderReflectionCache.reflections.find(key);
+    if (it != g_shaderReflectionCache.reflections.end())
+    {
+        outReflection = it->second;
+        return true;
+    }
+    return false;
+}
+
+void DXCacheShaderReflection(std::uint64_t key, const ShaderReflection& reflection)
+{
+    std::lock_guard<std::mutex> guard{ g_shaderReflectionCache.mutex };
+    g_shaderReflectionCache.reflections[key] = reflection;
+}
+
+void DXClearShaderReflectionCache()
+{
+    std::lock_guard<std::mutex> guard{ g_shaderReflectionCache.mutex };
+    g_shaderReflectionCache.reflections.clear();
+}
+
 static std::vector<VideoAdapterOutputInfo> GetDXGIAdapterOutputInfos(IDXGIAdapter* adapter)
 {
     LLGL_ASSERT_PTR(adapter);
@@ -423,6 +495,32 @@ VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdap
     return VideoAdapterInfo{};
 }
 
+static void AppendDXGIMemorySegmentGroup(IDXGIAdapter3* adapter, DXGI_MEMORY_SEGMENT_GROUP segmentGroup, MemoryInfo& outInfo)
+{
+    DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo;
+    if (SUCCEEDED(adapter->QueryVideoMemoryInfo(0, segmentGroup, &videoMemoryInfo)) && outInfo.numHeaps < LLGL_MAX_NUM_MEMORY_HEAPS)
+    {
+        MemoryHeapInfo& heap = outInfo.heaps[outInfo.numHeaps++];
+        heap.deviceLocal    = (segmentGroup == DXGI_MEMORY_SEGMENT_GROUP_LOCAL);
+        heap.budget         = videoMemoryInfo.Budget;
+        heap.usage          = videoMemoryInfo.CurrentUsage;
+    }
+}
+
+void DXQueryVideoMemoryInfo(IDXGIAdapter* adapter, MemoryInfo& outInfo)
+{
+    if (adapter == nullptr)
+        return;
+
+    /* Memory budgets are only available since DXGI 1.4 */
+    ComPtr<IDXGIAdapter3> adapter3;
+    if (SUCCEEDED(adapter->QueryInterface(IID_PPV_ARGS(adapter3.GetAddressOf()))))
+    {
+        AppendDXGIMemorySegmentGroup(adapter3.Get(), DXGI_MEMORY_SEGMENT_GROUP_LOCAL, outInfo);
+        AppendDXGIMemorySegmentGroup(adapter3.Get(), DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, outInfo);
+    }
+}
+
 Format DXGetSignatureParameterType(D3D_REGISTER_COMPONENT_TYPE componentType, BYTE componentMask)
 {
     switch (componentType)
@@ -497,6 +595,61 @@ bool DXGetFullscreenState(IDXGISwapChain* swapChain)
     return (fullscreenState != FALSE);
 }
 
+void DXGetPresentParams(PresentMode presentMode, UINT vsyncInterval, bool tearingAllowed, UINT& outSyncInterval, UINT& outPresentFlags)
+{
+    switch (presentMode)
+    {
+        case PresentMode::Immediate:
+            outSyncInterval = 0;
+            outPresentFlags = (tearingAllowed ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+            break;
+
+        case PresentMode::Mailbox:
+            /* Flip-model swap-chains replace queued frames with a sync interval of 0 when tearing is not allowed */
+            outSyncInterval = 0;
+            outPresentFlags = 0;
+            break;
+
+        case PresentMode::Fifo:
+        case PresentMode::FifoRelaxed:
+            outSyncInterval = std::max(1u, vsyncInterval);
+            outPresentFlags = 0;
+            break;
+
+        default:
+            outSyncInterval = vsyncInterval;
+            outPresentFlags = (tearingAllowed && vsyncInterval == 0 ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+            break;
+    }
+}
+
+void DXConvertDirtyRects(std::uint32_t numDamageRects, const Scissor* damageRects, const Extent2D& resolution, std::vector<RECT>& outDirtyRects)
+{
+    outDirtyRects.clear();
+    outDirtyRects.reserve(numDamageRects);
+
+    for_range(i, numDamageRects)
+    {
+        const Scissor& rect = damageRects[i];
+        RECT dirtyRect;
+        {
+            dirtyRect.left      = std::max<LONG>(0, rect.x);
+            dirtyRect.top       = std::max<LONG>(0, rect.y);
+            dirtyRect.right     = std::min<LONG>(static_cast<LONG>(resolution.x), rect.x + rect.width);
+            dirtyRect.bottom    = std::min<LONG>(static_cast<LONG>(resolution.y), rect.y + rect.height);
+        }
+        if (dirtyRect.left < dirtyRect.right && dirtyRect.top < dirtyRect.bottom)
+            outDirtyRects.push_back(dirtyRect);
+    }
+}
+
+bool DXWaitForFrameLatencyObject(HANDLE waitableObject, UINT64 timeout)
+{
+    /* Convert timeout from nanoseconds into milliseconds (rounded up); only ~0 waits infinitely */
+    const DWORD timeoutMillisecs = (timeout == ~0ull ? INFINITE : static_cast<DWORD>(std::min<UINT64>((timeout + 999999) / 1000000, INFINITE - 1)));
+    return (::WaitForSingleObjectEx(waitableObject, timeoutMillisecs, TRUE) == WAIT_OBJECT_0);
+}
+
 
 } // /namespace LLGL
 
@@ -13,9 +13,13 @@
 #include <LLGL/RenderSystemFlags.h>
 #include "../VideoAdapter.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/SwapChainFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/ShaderReflection.h>
 #include "ComPtr.h"
 #include <dxgi.h>
 #include <string>
+#include <cstdint>
 #include <vector>
 #include <Windows.h>
 #include <d3dcommon.h>
@@ -71,12 +75,41 @@ void DXGetDefaultSupportedTextureFormats(Format* outFormats, std::size_t* outNum
 // Returns the compiler flags for the 'ShaderCompileFlags' enumeration values for the DirectX Effects Compiler (FXC).
 UINT DXGetFxcCompilerFlags(int flags);
 
+// Returns the persistent cache key for compiling the specified HLSL source with the specified compiler. Included files are not part of the key.
+std::uint64_t DXGetShaderCompilerCacheKey(
+    const char*             compilerName,
+    const char*             sourceCode,
+    std::size_t             sourceLength,
+    const D3D_SHADER_MACRO* defines,
+    const char*             entry,
+    const char*             target,
+    int                     flags
+);
+
+// Returns the key to identify the reflection of the specified shader byte code across shader objects.
+std::uint64_t DXGetShaderReflectionCacheKey(ID3DBlob* byteCode, ShaderType type);
+
+/*
+Copies the cached reflection for the specified key into 'outReflection' and returns true if there is such an entry.
+Reflections are only kept in memory, so identical byte code is only reflected once per process. This function is thread-safe.
+*/
+bool DXFindCachedShaderReflection(std::uint64_t key, ShaderReflection& outReflection);
+
+// Stores a copy of the specified reflection in the cache. This function is thread-safe.
+void DXCacheShaderReflection(std::uint64_t key, const ShaderReflection& reflection);
+
+// Releases all cached shader reflections.
+void DXClearShaderReflectionCache();
+
 // Converts the adapter descriptor to video adapter information.
 void DXConvertVideoAdapterInfo(IDXGIAdapter* adapter, const DXGI_ADAPTER_DESC& inDesc, VideoAdapterInfo& outInfo);
 
 // Returns the video adapter descriptor from the specified DXGI adapter.
 VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdapterFlags = 0, IDXGIAdapter** outPreferredAdatper = nullptr);
 
+// Appends the local and non-local memory segment groups of the specified adapter as heaps to the output memory info. Requires IDXGIAdapter3.
+void DXQueryVideoMemoryInfo(IDXGIAdapter* adapter, MemoryInfo& outInfo);
+
 // Returns the format for the specified signature parameter type (by its component type and mask).
 Format DXGetSignatureParameterType(D3D_REGISTER_COMPONENT_TYPE componentType, BYTE componentMask);
 
@@ -86,6 +119,15 @@ DXGI_FORMAT DXPickDepthStencilFormat(int depthBits, int stencilBits);
 // Returns true if the specified DXGI swap-chain is in fullscreen mode.
 bool DXGetFullscreenState(IDXGISwapChain* swapChain);
 
+// Returns the sync interval and present flags for IDXGISwapChain::Present. Tearing must only be allowed for flip-model swap-chains in windowed mode.
+void DXGetPresentParams(PresentMode presentMode, UINT vsyncInterval, bool tearingAllowed, UINT& outSyncInterval, UINT& outPresentFlags);
+
+// Converts the specified damage rectangles into dirty rectangles for IDXGISwapChain1::Present1 and clamps them to the specified resolution. Empty rectangles are skipped.
+void DXConvertDirtyRects(std::uint32_t numDamageRects, const Scissor* damageRects, const Extent2D& resolution, std::vector<RECT>& outDirtyRects);
+
+// Waits for the frame latency waitable object of a DXGI swap-chain. Returns false if the timeout (in nanoseconds) has elapsed.
+bool DXWaitForFrameLatencyObject(HANDLE waitableObject, UINT64 timeout);
+
 
 } // /namespace LLGL
 
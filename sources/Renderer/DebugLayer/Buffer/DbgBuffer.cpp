@@ -34,9 +34,33 @@ void DbgBuffer::SetDebugName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+bool DbgBuffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    return instance.SetResidencyPriority(priority);
+}
+
+bool DbgBuffer::Evict()
+{
+    if (!instance.Evict())
+        return false;
+    evicted = true;
+    return true;
+}
+
+bool DbgBuffer::MakeResident()
+{
+    if (!instance.MakeResident())
+        return false;
+    evicted = false;
+    return true;
+}
+
 BufferDescriptor DbgBuffer::GetDesc() const
 {
-    return instance.GetDesc();
+    /* Hide canary zone from the client */
+    BufferDescriptor instanceDesc = instance.GetDesc();
+    instanceDesc.size -= std::min(canarySize, instanceDesc.size);
+    return instanceDesc;
 }
 
 void DbgBuffer::OnMap(const CPUAccess access, std::uint64_t offset, std::uint64_t length)
@@ -27,6 +27,10 @@ class DbgBuffer final : public Buffer
 
         void SetDebugName(const char* name) override;
 
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+        bool Evict() override;
+        bool MakeResident() override;
+
         BufferDescriptor GetDesc() const override;
 
     public:
@@ -46,6 +50,8 @@ class DbgBuffer final : public Buffer
         std::string             label;
         std::uint64_t           elements    = 0;
         bool                    initialized = false;
+        std::uint64_t           canarySize  = 0; // Size of the canary zone behind the buffer content; See RenderingDebugger::SetBufferOverrunDetection().
+        bool                    evicted     = false;
 
     private:
 
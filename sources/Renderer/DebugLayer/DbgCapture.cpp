@@ -0,0 +1,584 @@
+/*
+ * DbgCapture.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgCapture.h"
+#include "../../Core/StringUtils.h"
+#include <LLGL/SwapChain.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderTarget.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/RenderTargetFlags.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+DbgCapture::DbgCapture(const char* filename, std::uint32_t numFrames) :
+    file_      { filename, std::ios::out | std::ios::binary | std::ios::trunc },
+    numFrames_ { numFrames                                                    }
+{
+    if (file_.good())
+    {
+        CaptureHeader header;
+        {
+            header.magic    = g_captureMagic;
+            header.version  = g_captureVersion;
+        }
+        file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    else
+        file_.close();
+}
+
+bool DbgCapture::IsRecording() const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return file_.is_open();
+}
+
+std::uint32_t DbgCapture::GetObjectID(const void* obj)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return FindObjectID(obj);
+}
+
+void DbgCapture::RecordCreateSwapChain(const SwapChain& swapChain, const SwapChainDescriptor& swapChainDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    SwapChainDescriptor plainDesc = swapChainDesc;
+    plainDesc.debugName = nullptr;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&swapChain));
+    s.Write(RegisterObject(swapChain.GetRenderPass()));
+    s.WriteString(swapChainDesc.debugName);
+    s.Write(plainDesc);
+    WriteRecord(CaptureRecordCreateSwapChain, s);
+}
+
+void DbgCapture::RecordCreateBuffer(const Buffer& buffer, const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&buffer));
+    s.WriteString(bufferDesc.debugName);
+    s.Write(bufferDesc.size);
+    s.Write(bufferDesc.stride);
+    s.Write(bufferDesc.format);
+    s.Write(bufferDesc.bindFlags);
+    s.Write(bufferDesc.cpuAccessFlags);
+    s.Write(bufferDesc.miscFlags);
+    WriteVertexAttributes(s, bufferDesc.vertexAttribs);
+    s.WriteBytes(initialData, (initialData != nullptr ? static_cast<std::size_t>(bufferDesc.size) : 0));
+    WriteRecord(CaptureRecordCreateBuffer, s);
+}
+
+void DbgCapture::RecordCreateBufferArray(const BufferArray& bufferArray, std::uint32_t numBuffers, Buffer* const * buffers)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&bufferArray));
+    s.Write(numBuffers);
+    for_range(i, numBuffers)
+        s.Write(FindObjectID(buffers[i]));
+    WriteRecord(CaptureRecordCreateBufferArray, s);
+}
+
+void DbgCapture::RecordCreateTexture(const Texture& texture, const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    TextureDescriptor plainDesc = textureDesc;
+    plainDesc.debugName = nullptr;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&texture));
+    s.WriteString(textureDesc.debugName);
+    s.Write(plainDesc);
+    s.Write(initialImage != nullptr);
+    if (initialImage != nullptr)
+    {
+        s.Write(initialImage->format);
+        s.Write(initialImage->dataType);
+        s.WriteBytes(initialImage->data, initialImage->dataSize);
+    }
+    WriteRecord(CaptureRecordCreateTexture, s);
+}
+
+void DbgCapture::RecordCreateSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&sampler));
+    WriteSamplerDesc(s, samplerDesc);
+    WriteRecord(CaptureRecordCreateSampler, s);
+}
+
+void DbgCapture::RecordCreateResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&resourceHeap));
+    s.WriteString(resourceHeapDesc.debugName);
+    s.Write(FindObjectID(resourceHeapDesc.pipelineLayout));
+    s.Write(resourceHeapDesc.numResourceViews);
+    WriteResourceViews(s, initialResourceViews);
+    WriteRecord(CaptureRecordCreateResourceHeap, s);
+}
+
+void DbgCapture::RecordCreateRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& renderPassDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&renderPass));
+    s.WriteString(renderPassDesc.debugName);
+    for (const AttachmentFormatDescriptor& attachmentDesc : renderPassDesc.colorAttachments)
+        s.Write(attachmentDesc);
+    s.Write(renderPassDesc.depthAttachment);
+    s.Write(renderPassDesc.stencilAttachment);
+    s.Write(renderPassDesc.samples);
+    s.WriteArray(renderPassDesc.subpasses.data(), static_cast<std::uint32_t>(renderPassDesc.subpasses.size()));
+    s.Write(renderPassDesc.viewMask);
+    WriteRecord(CaptureRecordCreateRenderPass, s);
+}
+
+void DbgCapture::RecordCreateRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& renderTargetDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&renderTarget));
+    s.Write(RegisterObject(renderTarget.GetRenderPass()));
+    s.WriteString(renderTargetDesc.debugName);
+    s.Write(FindObjectID(renderTargetDesc.renderPass));
+    s.Write(renderTargetDesc.resolution);
+    s.Write(renderTargetDesc.samples);
+    for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+        WriteAttachmentDesc(s, attachmentDesc);
+    for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+        WriteAttachmentDesc(s, attachmentDesc);
+    WriteAttachmentDesc(s, renderTargetDesc.depthStencilAttachment);
+    WriteRecord(CaptureRecordCreateRenderTarget, s);
+}
+
+void DbgCapture::RecordCreateShader(const Shader& shader, const ShaderDescriptor& shaderDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&shader));
+    s.WriteString(shaderDesc.debugName);
+    s.Write(shaderDesc.type);
+
+    /* Embed shader files into the capture, so it does not depend on the working directory of the application */
+    switch (shaderDesc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            const std::size_t len = (shaderDesc.sourceSize > 0 ? shaderDesc.sourceSize : std::strlen(shaderDesc.source));
+            s.Write(ShaderSourceType::CodeString);
+            s.WriteString(std::string(shaderDesc.source, len).c_str());
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            s.Write(ShaderSourceType::CodeString);
+            s.WriteString(ReadFileString(shaderDesc.source).c_str());
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            s.Write(ShaderSourceType::BinaryBuffer);
+            s.WriteBytes(shaderDesc.source, shaderDesc.sourceSize);
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            const std::vector<char> binary = ReadFileBuffer(shaderDesc.source);
+            s.Write(ShaderSourceType::BinaryBuffer);
+            s.WriteBytes(binary.data(), binary.size());
+        }
+        break;
+    }
+
+    s.WriteString(shaderDesc.entryPoint);
+    s.WriteString(shaderDesc.profile);
+
+    /* Write macro definitions until the null terminated entry */
+    std::uint32_t numDefines = 0;
+    for (const ShaderMacro* macro = shaderDesc.defines; macro != nullptr && macro->name != nullptr; ++macro)
+        ++numDefines;
+
+    s.Write(numDefines);
+    for_range(i, numDefines)
+    {
+        s.WriteString(shaderDesc.defines[i].name);
+        s.WriteString(shaderDesc.defines[i].definition);
+    }
+
+    s.Write(shaderDesc.flags);
+    WriteVertexAttributes(s, shaderDesc.vertex.inputAttribs);
+    WriteVertexAttributes(s, shaderDesc.vertex.outputAttribs);
+    WriteFragmentAttributes(s, shaderDesc.fragment.outputAttribs);
+    s.Write(shaderDesc.compute.workGroupSize);
+    WriteRecord(CaptureRecordCreateShader, s);
+}
+
+void DbgCapture::RecordCreatePipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&pipelineLayout));
+    s.WriteString(pipelineLayoutDesc.debugName);
+    WriteBindingDescs(s, pipelineLayoutDesc.heapBindings);
+    WriteBindingDescs(s, pipelineLayoutDesc.bindings);
+
+    s.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.staticSamplers.size()));
+    for (const StaticSamplerDescriptor& staticSamplerDesc : pipelineLayoutDesc.staticSamplers)
+    {
+        s.WriteString(staticSamplerDesc.name.c_str());
+        s.Write(staticSamplerDesc.stageFlags);
+        s.Write(staticSamplerDesc.slot);
+        WriteSamplerDesc(s, staticSamplerDesc.sampler);
+    }
+
+    s.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.uniforms.size()));
+    for (const UniformDescriptor& uniformDesc : pipelineLayoutDesc.uniforms)
+    {
+        s.WriteString(uniformDesc.name.c_str());
+        s.Write(uniformDesc.type);
+        s.Write(uniformDesc.arraySize);
+    }
+
+    s.Write(pipelineLayoutDesc.barrierFlags);
+    s.Write(pipelineLayoutDesc.flags);
+    WriteRecord(CaptureRecordCreatePipelineLayout, s);
+}
+
+void DbgCapture::RecordCreatePipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&pipelineState));
+    s.WriteString(pipelineStateDesc.debugName);
+    s.Write(FindObjectID(pipelineStateDesc.pipelineLayout));
+    s.Write(FindObjectID(pipelineStateDesc.renderPass));
+    s.Write(pipelineStateDesc.subpass);
+    s.Write(FindObjectID(pipelineStateDesc.vertexShader));
+    s.Write(FindObjectID(pipelineStateDesc.tessControlShader));
+    s.Write(FindObjectID(pipelineStateDesc.tessEvaluationShader));
+    s.Write(FindObjectID(pipelineStateDesc.geometryShader));
+    s.Write(FindObjectID(pipelineStateDesc.taskShader));
+    s.Write(FindObjectID(pipelineStateDesc.meshShader));
+    s.Write(FindObjectID(pipelineStateDesc.fragmentShader));
+    s.Write(pipelineStateDesc.indexFormat);
+    s.Write(pipelineStateDesc.primitiveTopology);
+    s.Write(pipelineStateDesc.dynamicStates);
+    s.WriteArray(pipelineStateDesc.viewports.data(), static_cast<std::uint32_t>(pipelineStateDesc.viewports.size()));
+    s.WriteArray(pipelineStateDesc.scissors.data(), static_cast<std::uint32_t>(pipelineStateDesc.scissors.size()));
+    s.WriteArray(pipelineStateDesc.vertexStreams.data(), static_cast<std::uint32_t>(pipelineStateDesc.vertexStreams.size()));
+    s.Write(pipelineStateDesc.depth);
+    s.Write(pipelineStateDesc.stencil);
+    s.Write(pipelineStateDesc.rasterizer);
+    s.Write(pipelineStateDesc.blend);
+    s.Write(pipelineStateDesc.tessellation);
+    WriteRecord(CaptureRecordCreateGraphicsPipeline, s);
+}
+
+void DbgCapture::RecordCreatePipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& pipelineStateDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(RegisterObject(&pipelineState));
+    s.WriteString(pipelineStateDesc.debugName);
+    s.Write(FindObjectID(pipelineStateDesc.pipelineLayout));
+    s.Write(FindObjectID(pipelineStateDesc.computeShader));
+    WriteRecord(CaptureRecordCreateComputePipeline, s);
+}
+
+void DbgCapture::RecordRelease(const void* obj)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    auto it = objectIDs_.find(obj);
+    if (it == objectIDs_.end())
+        return;
+
+    /* Invalidate ID even after the capture has finished, since the address might be reused for a new object */
+    const std::uint32_t id = it->second;
+    objectIDs_.erase(it);
+    mappedBuffers_.erase(obj);
+
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(id);
+    WriteRecord(CaptureRecordRelease, s);
+}
+
+void DbgCapture::RecordWriteBuffer(const Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(FindObjectID(&buffer));
+    s.Write(offset);
+    s.WriteBytes(data, static_cast<std::size_t>(dataSize));
+    WriteRecord(CaptureRecordWriteBuffer, s);
+}
+
+void DbgCapture::RecordWriteTexture(const Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(FindObjectID(&texture));
+    s.Write(textureRegion);
+    s.Write(srcImageView.format);
+    s.Write(srcImageView.dataType);
+    s.WriteBytes(srcImageView.data, srcImageView.dataSize);
+    WriteRecord(CaptureRecordWriteTexture, s);
+}
+
+void DbgCapture::RecordWriteResourceHeap(const ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(FindObjectID(&resourceHeap));
+    s.Write(firstDescriptor);
+    WriteResourceViews(s, resourceViews);
+    WriteRecord(CaptureRecordWriteResourceHeap, s);
+}
+
+void DbgCapture::RecordMapBuffer(const Buffer& buffer, CPUAccess access, std::uint64_t offset, std::uint64_t length, const void* mappedData)
+{
+    /* Only mappings with write access modify the buffer content */
+    if (access == CPUAccess::ReadOnly)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (file_.is_open())
+        mappedBuffers_[&buffer] = MappedRange{ offset, length, mappedData };
+}
+
+void DbgCapture::RecordUnmapBuffer(const Buffer& buffer)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    auto it = mappedBuffers_.find(&buffer);
+    if (it == mappedBuffers_.end())
+        return;
+
+    const MappedRange range = it->second;
+    mappedBuffers_.erase(it);
+
+    if (!file_.is_open())
+        return;
+
+    /* Record mapped content as buffer write */
+    CaptureStream s;
+    s.Write(FindObjectID(&buffer));
+    s.Write(range.offset);
+    s.WriteBytes(range.data, static_cast<std::size_t>(range.length));
+    WriteRecord(CaptureRecordWriteBuffer, s);
+}
+
+void DbgCapture::RecordSubmit(const CommandBuffer& commandBuffer, long commandBufferFlags, const CaptureStream& commandStream)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    /* Command buffers are created lazily by the replayer, so they are registered on their first submission */
+    std::uint32_t id = FindObjectID(&commandBuffer);
+    if (id == 0)
+        id = RegisterObject(&commandBuffer);
+
+    CaptureStream s;
+    s.Write(id);
+    s.Write(commandBufferFlags);
+    s.WriteBytes(commandStream.GetData(), commandStream.GetSize());
+    WriteRecord(CaptureRecordSubmit, s);
+}
+
+void DbgCapture::RecordPresent(const SwapChain& swapChain)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    if (!file_.is_open())
+        return;
+
+    CaptureStream s;
+    s.Write(FindObjectID(&swapChain));
+    WriteRecord(CaptureRecordPresent, s);
+
+    /* Close capture file once the requested number of frames has been recorded */
+    ++frameCounter_;
+    if (numFrames_ > 0 && frameCounter_ >= numFrames_)
+        file_.close();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t DbgCapture::RegisterObject(const void* obj)
+{
+    if (obj == nullptr)
+        return 0;
+    const std::uint32_t id = nextObjectID_++;
+    objectIDs_[obj] = id;
+    return id;
+}
+
+std::uint32_t DbgCapture::FindObjectID(const void* obj) const
+{
+    auto it = objectIDs_.find(obj);
+    return (it != objectIDs_.end() ? it->second : 0);
+}
+
+void DbgCapture::WriteRecord(CaptureRecord type, const CaptureStream& payload)
+{
+    const std::uint32_t payloadSize = static_cast<std::uint32_t>(payload.GetSize());
+    file_.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    file_.write(reinterpret_cast<const char*>(&payloadSize), sizeof(payloadSize));
+    file_.write(payload.GetData(), payload.GetSize());
+}
+
+void DbgCapture::WriteVertexAttributes(CaptureStream& s, const ArrayView<VertexAttribute>& attribs)
+{
+    s.Write(static_cast<std::uint32_t>(attribs.size()));
+    for (const VertexAttribute& attrib : attribs)
+    {
+        s.WriteString(attrib.name.c_str());
+        s.Write(attrib.format);
+        s.Write(attrib.location);
+        s.Write(attrib.semanticIndex);
+        s.Write(attrib.systemValue);
+        s.Write(attrib.slot);
+        s.Write(attrib.offset);
+        s.Write(attrib.stride);
+        s.Write(attrib.instanceDivisor);
+    }
+}
+
+void DbgCapture::WriteFragmentAttributes(CaptureStream& s, const ArrayView<FragmentAttribute>& attribs)
+{
+    s.Write(static_cast<std::uint32_t>(attribs.size()));
+    for (const FragmentAttribute& attrib : attribs)
+    {
+        s.WriteString(attrib.name.c_str());
+        s.Write(attrib.format);
+        s.Write(attrib.location);
+        s.Write(attrib.systemValue);
+    }
+}
+
+void DbgCapture::WriteBindingDescs(CaptureStream& s, const ArrayView<BindingDescriptor>& bindingDescs)
+{
+    s.Write(static_cast<std::uint32_t>(bindingDescs.size()));
+    for (const BindingDescriptor& bindingDesc : bindingDescs)
+    {
+        s.WriteString(bindingDesc.name.c_str());
+        s.Write(bindingDesc.type);
+        s.Write(bindingDesc.bindFlags);
+        s.Write(bindingDesc.stageFlags);
+        s.Write(bindingDesc.slot);
+        s.Write(bindingDesc.arraySize);
+    }
+}
+
+void DbgCapture::WriteSamplerDesc(CaptureStream& s, const SamplerDescriptor& samplerDesc)
+{
+    SamplerDescriptor plainDesc = samplerDesc;
+    plainDesc.debugName = nullptr;
+
+    s.WriteString(samplerDesc.debugName);
+    s.Write(plainDesc);
+}
+
+void DbgCapture::WriteResourceViews(CaptureStream& s, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    s.Write(static_cast<std::uint32_t>(resourceViews.size()));
+    for (const ResourceViewDescriptor& resourceView : resourceViews)
+    {
+        s.Write(FindObjectID(resourceView.resource));
+        s.Write(resourceView.textureView);
+        s.Write(resourceView.bufferView);
+        s.Write(resourceView.initialCount);
+    }
+}
+
+void DbgCapture::WriteAttachmentDesc(CaptureStream& s, const AttachmentDescriptor& attachmentDesc)
+{
+    s.Write(attachmentDesc.format);
+    s.Write(FindObjectID(attachmentDesc.texture));
+    s.Write(attachmentDesc.mipLevel);
+    s.Write(attachmentDesc.arrayLayer);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,121 @@
+/*
+ * DbgCapture.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_CAPTURE_H
+#define LLGL_DBG_CAPTURE_H
+
+
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include "../CaptureFormat.h"
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+/*
+Writes all resource creations, command buffer submissions, and presentations of the debug layer into a capture file.
+Objects are identified by the address of their debug layer wrapper (or native instance for objects without wrapper, e.g. samplers).
+See CaptureFormat.h for the file format and ReplayCapture() for the replayer.
+*/
+class DbgCapture
+{
+
+    public:
+
+        DbgCapture(const char* filename, std::uint32_t numFrames);
+
+        DbgCapture(const DbgCapture&) = delete;
+        DbgCapture& operator = (const DbgCapture&) = delete;
+
+        // Returns true if the capture file is still open, i.e. the specified number of frames has not been reached yet.
+        bool IsRecording() const;
+
+        // Returns the capture ID of the specified object or 0 if the object is null or has not been recorded.
+        std::uint32_t GetObjectID(const void* obj);
+
+    public:
+
+        void RecordCreateSwapChain(const SwapChain& swapChain, const SwapChainDescriptor& swapChainDesc);
+        void RecordCreateBuffer(const Buffer& buffer, const BufferDescriptor& bufferDesc, const void* initialData);
+        void RecordCreateBufferArray(const BufferArray& bufferArray, std::uint32_t numBuffers, Buffer* const * buffers);
+        void RecordCreateTexture(const Texture& texture, const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void RecordCreateSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc);
+        void RecordCreateResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
+        void RecordCreateRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& renderPassDesc);
+        void RecordCreateRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& renderTargetDesc);
+        void RecordCreateShader(const Shader& shader, const ShaderDescriptor& shaderDesc);
+        void RecordCreatePipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& pipelineLayoutDesc);
+        void RecordCreatePipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& pipelineStateDesc);
+        void RecordCreatePipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& pipelineStateDesc);
+
+        // Records the release of the specified object and invalidates its capture ID.
+        void RecordRelease(const void* obj);
+
+        void RecordWriteBuffer(const Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize);
+        void RecordWriteTexture(const Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView);
+        void RecordWriteResourceHeap(const ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
+        // Stores the mapped range of a buffer to record its content as buffer write when it is unmapped.
+        void RecordMapBuffer(const Buffer& buffer, CPUAccess access, std::uint64_t offset, std::uint64_t length, const void* mappedData);
+        void RecordUnmapBuffer(const Buffer& buffer);
+
+        // Records the submission of a command buffer with its encoded command stream.
+        void RecordSubmit(const CommandBuffer& commandBuffer, long commandBufferFlags, const CaptureStream& commandStream);
+
+        // Records the end of a frame and closes the capture file once the number of frames has been reached.
+        void RecordPresent(const SwapChain& swapChain);
+
+    private:
+
+        struct MappedRange
+        {
+            std::uint64_t   offset;
+            std::uint64_t   length;
+            const void*     data;
+        };
+
+    private:
+
+        std::uint32_t RegisterObject(const void* obj);
+        std::uint32_t FindObjectID(const void* obj) const;
+
+        void WriteRecord(CaptureRecord type, const CaptureStream& payload);
+
+        void WriteVertexAttributes(CaptureStream& s, const ArrayView<VertexAttribute>& attribs);
+        void WriteFragmentAttributes(CaptureStream& s, const ArrayView<FragmentAttribute>& attribs);
+        void WriteBindingDescs(CaptureStream& s, const ArrayView<BindingDescriptor>& bindingDescs);
+        void WriteSamplerDesc(CaptureStream& s, const SamplerDescriptor& samplerDesc);
+        void WriteResourceViews(CaptureStream& s, const ArrayView<ResourceViewDescriptor>& resourceViews);
+        void WriteAttachmentDesc(CaptureStream& s, const AttachmentDescriptor& attachmentDesc);
+
+    private:
+
+        mutable std::mutex                                  mutex_;
+        std::ofstream                                       file_;
+        std::uint32_t                                       numFrames_      = 0; // Maximum number of frames to record or 0 for unlimited.
+        std::uint32_t                                       frameCounter_   = 0;
+        std::uint32_t                                       nextObjectID_   = 1;
+        std::unordered_map<const void*, std::uint32_t>      objectIDs_;
+        std::unordered_map<const void*, MappedRange>        mappedBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,8 +8,11 @@
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
 #include "DbgReportUtils.h"
+#include "DbgCapture.h"
 #include "../CheckedCast.h"
 #include "../ResourceUtils.h"
+#include "../BufferUtils.h"
+#include "../TextureUtils.h"
 #include "../PipelineStateUtils.h"
 #include "../../Core/StringUtils.h"
 #include "../../Core/Assertion.h"
@@ -31,6 +34,7 @@
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 
 
@@ -50,6 +54,10 @@ namespace LLGL
         CMD;                        \
     }
 
+#define LLGL_DBG_CAPTURE(...)           \
+    if (captureEnabled_)                \
+        captureStream_.Record(__VA_ARGS__)
+
 #define LLGL_DBG_ASSERT_PTR(NAME) \
     AssertNullPointer(NAME, #NAME)
 
@@ -66,6 +74,13 @@ static const char* GetLabelOrDefault(const char* label, const char* defaultLabel
     return (label != nullptr ? label : defaultLabel);
 }
 
+// Returns a unique non-zero identifier for each command buffer to separate their time records into individual timelines.
+static std::uint32_t GenerateCommandBufferID()
+{
+    static std::atomic_uint32_t idCounter{ 0 };
+    return ++idCounter;
+}
+
 DbgCommandBuffer::DbgCommandBuffer(
     RenderSystem&                   renderSystemInstance,
     CommandQueue&                   commandQueueInstance,
@@ -73,7 +88,8 @@ DbgCommandBuffer::DbgCommandBuffer(
     FrameProfile&                   commonProfile,
     RenderingDebugger*              debugger,
     const CommandBufferDescriptor&  desc,
-    const RenderingCapabilities&    caps)
+    const RenderingCapabilities&    caps,
+    DbgCapture*                     capture)
 :
     instance        { commandBufferInstance                                             },
     desc            { desc                                                              },
@@ -82,7 +98,8 @@ DbgCommandBuffer::DbgCommandBuffer(
     commonProfile_  { commonProfile                                                     },
     features_       { caps.features                                                     },
     limits_         { caps.limits                                                       },
-    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
+    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance, GenerateCommandBufferID() },
+    capture_        { capture                                                           }
 {
 }
 
@@ -99,13 +116,20 @@ void DbgCommandBuffer::Begin()
     ResetStates();
     ResetRecords();
 
+    /* Enable validation unless the debugger only collects counters */
+    validationEnabled_ = (debugger_ != nullptr && debugger_->GetValidation());
+
     /* Enable performance timer if it was scheduled */
     perfProfilerEnabled_ = (debugger_ != nullptr && debugger_->GetTimeRecording());
     if (perfProfilerEnabled_)
         queryTimerPool_.Reset();
 
+    /* Encode commands into capture stream while the capture file is open */
+    captureEnabled_ = (capture_ != nullptr && capture_->IsRecording());
+    captureStream_.Clear();
+
     /* Begin with command recording  */
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateBeginOfRecording();
@@ -119,7 +143,7 @@ void DbgCommandBuffer::Begin()
 void DbgCommandBuffer::End()
 {
     /* End with command recording */
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateEndOfRecording();
@@ -138,6 +162,8 @@ void DbgCommandBuffer::End()
 
         RenderingDebugger::MergeProfiles(commonProfile_, profile);
         commonProfile_.commandQueueRecord.commandBufferSubmittions++;
+
+        RecordCaptureSubmit();
     }
 }
 
@@ -145,7 +171,7 @@ void DbgCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     auto& commandBufferDbg = LLGL_DBG_CAST(DbgCommandBuffer&, secondaryCommandBuffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
 
@@ -164,6 +190,7 @@ void DbgCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
     }
 
     LLGL_DBG_COMMAND( "Execute", instance.Execute(commandBufferDbg.instance) );
+    CaptureUnsupported("Execute");
 }
 
 /* ----- Blitting ----- */
@@ -176,7 +203,7 @@ void DbgCommandBuffer::UpdateBuffer(
 {
     auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -185,6 +212,7 @@ void DbgCommandBuffer::UpdateBuffer(
     }
 
     LLGL_DBG_COMMAND( "UpdateBuffer", instance.UpdateBuffer(dstBufferDbg.instance, dstOffset, data, dataSize) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeUpdateBuffer, CaptureID(&dstBuffer), dstOffset, CaptureBytes{ data, dataSize } );
 
     profile_.commandBufferRecord.bufferUpdates++;
 }
@@ -199,7 +227,7 @@ void DbgCommandBuffer::CopyBuffer(
     auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
     auto& srcBufferDbg = LLGL_DBG_CAST(DbgBuffer&, srcBuffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -211,6 +239,45 @@ void DbgCommandBuffer::CopyBuffer(
     }
 
     LLGL_DBG_COMMAND( "CopyBuffer", instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyBuffer, CaptureID(&dstBuffer), dstOffset, CaptureID(&srcBuffer), srcOffset, size );
+
+    profile_.commandBufferRecord.bufferCopies++;
+}
+
+void DbgCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+    auto& srcBufferDbg = LLGL_DBG_CAST(DbgBuffer&, srcBuffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        LLGL_DBG_ASSERT_PTR(regions);
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+        ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
+
+        /* Validate all regions in array */
+        if (regions)
+        {
+            for_range(i, numRegions)
+            {
+                ValidateBufferRange(dstBufferDbg, regions[i].dstOffset, regions[i].size, "destination range");
+                ValidateBufferRange(srcBufferDbg, regions[i].srcOffset, regions[i].size, "source range");
+            }
+        }
+
+        if (numRegions == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no buffer regions are specified");
+    }
+
+    LLGL_DBG_COMMAND( "CopyBufferRegions", instance.CopyBufferRegions(dstBufferDbg.instance, srcBufferDbg.instance, numRegions, regions) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyBufferRegions, CaptureID(&dstBuffer), CaptureID(&srcBuffer), CaptureBytes{ regions, sizeof(BufferCopyRegion) * numRegions } );
 
     profile_.commandBufferRecord.bufferCopies++;
 }
@@ -233,7 +300,7 @@ void DbgCommandBuffer::CopyBufferFromTexture(
     auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
     auto& srcTextureDbg = LLGL_DBG_CAST(DbgTexture&, srcTexture);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -246,6 +313,7 @@ void DbgCommandBuffer::CopyBufferFromTexture(
     }
 
     LLGL_DBG_COMMAND( "CopyBufferFromTexture", instance.CopyBufferFromTexture(dstBufferDbg.instance, dstOffset, srcTextureDbg.instance, srcRegion, rowStride, layerStride) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyBufferFromTexture, CaptureID(&dstBuffer), dstOffset, CaptureID(&srcTexture), srcRegion, rowStride, layerStride );
 
     profile_.commandBufferRecord.bufferCopies++;
 }
@@ -258,7 +326,7 @@ void DbgCommandBuffer::FillBuffer(
 {
     auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -278,7 +346,74 @@ void DbgCommandBuffer::FillBuffer(
         }
     }
 
+    /* Exclude canary zone from filling the whole buffer */
+    if (fillSize == LLGL_WHOLE_SIZE && dstBufferDbg.canarySize > 0)
+    {
+        dstOffset   = 0;
+        fillSize    = dstBufferDbg.desc.size;
+    }
+
     LLGL_DBG_COMMAND( "FillBuffer", instance.FillBuffer(dstBufferDbg.instance, dstOffset, value, fillSize) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeFillBuffer, CaptureID(&dstBuffer), dstOffset, value, fillSize );
+
+    profile_.commandBufferRecord.bufferFills++;
+}
+
+void DbgCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot clear buffer inside a render pass");
+
+        std::uint8_t element[g_maxClearElementSize];
+        const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+        if (elementSize == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot clear buffer with format LLGL::Format::%s", ToString(format));
+
+        if (clearSize == LLGL_WHOLE_SIZE)
+        {
+            if (dstOffset != 0)
+                LLGL_DBG_WARN(WarningType::ImproperArgument, "non-zero argument for 'dstOffset' is ignored because 'clearSize' is set to LLGL::wholeSize");
+            if (elementSize > 0 && dstBufferDbg.desc.size % elementSize != 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer size is not a multiple of the clear format size (%u)", elementSize);
+        }
+        else
+        {
+            if (clearSize % 4 != 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer clear size is not a multiple of 4");
+            if (elementSize > 0)
+            {
+                if (dstOffset % elementSize != 0)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer clear offset is not a multiple of the clear format size (%u)", elementSize);
+                if (clearSize % elementSize != 0)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer clear size is not a multiple of the clear format size (%u)", elementSize);
+            }
+            ValidateBufferRange(dstBufferDbg, dstOffset, clearSize);
+        }
+    }
+
+    /* Exclude canary zone from clearing the whole buffer */
+    if (clearSize == LLGL_WHOLE_SIZE && dstBufferDbg.canarySize > 0)
+    {
+        dstOffset   = 0;
+        clearSize   = dstBufferDbg.desc.size;
+    }
+
+    LLGL_DBG_COMMAND( "ClearBuffer", instance.ClearBuffer(dstBufferDbg.instance, format, clearValue, dstOffset, clearSize) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeClearBuffer, CaptureID(&dstBuffer), format, clearValue, dstOffset, clearSize );
 
     profile_.commandBufferRecord.bufferFills++;
 }
@@ -293,7 +428,7 @@ void DbgCommandBuffer::CopyTexture(
     auto& dstTextureDbg = LLGL_DBG_CAST(DbgTexture&, dstTexture);
     auto& srcTextureDbg = LLGL_DBG_CAST(DbgTexture&, srcTexture);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -303,6 +438,45 @@ void DbgCommandBuffer::CopyTexture(
     }
 
     LLGL_DBG_COMMAND( "CopyTexture", instance.CopyTexture(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcLocation, extent) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyTexture, CaptureID(&dstTexture), dstLocation, CaptureID(&srcTexture), srcLocation, extent );
+
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void DbgCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    auto& dstTextureDbg = LLGL_DBG_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_DBG_CAST(DbgTexture&, srcTexture);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        LLGL_DBG_ASSERT_PTR(regions);
+        ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
+        ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc);
+
+        /* Validate all regions in array */
+        if (regions)
+        {
+            for_range(i, numRegions)
+            {
+                ValidateTextureLocation(dstTextureDbg, regions[i].dstLocation, regions[i].extent, "destination region");
+                ValidateTextureLocation(srcTextureDbg, regions[i].srcLocation, regions[i].extent, "source region");
+            }
+        }
+
+        if (numRegions == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no texture regions are specified");
+    }
+
+    LLGL_DBG_COMMAND( "CopyTextureRegions", instance.CopyTextureRegions(dstTextureDbg.instance, srcTextureDbg.instance, numRegions, regions) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyTextureRegions, CaptureID(&dstTexture), CaptureID(&srcTexture), CaptureBytes{ regions, sizeof(TextureCopyRegion) * numRegions } );
 
     profile_.commandBufferRecord.textureCopies++;
 }
@@ -318,7 +492,7 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
     auto& dstTextureDbg = LLGL_DBG_CAST(DbgTexture&, dstTexture);
     auto& srcBufferDbg = LLGL_DBG_CAST(DbgBuffer&, srcBuffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -331,6 +505,7 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
     }
 
     LLGL_DBG_COMMAND( "CopyTextureFromBuffer", instance.CopyTextureFromBuffer(dstTextureDbg.instance, dstRegion, srcBufferDbg.instance, srcOffset, rowStride, layerStride) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyTextureFromBuffer, CaptureID(&dstTexture), dstRegion, CaptureID(&srcBuffer), srcOffset, rowStride, layerStride );
 
     profile_.commandBufferRecord.textureCopies++;
 }
@@ -342,7 +517,7 @@ void DbgCommandBuffer::CopyTextureFromFramebuffer(
 {
     auto& dstTextureDbg = LLGL_DBG_CAST(DbgTexture&, dstTexture);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -363,15 +538,74 @@ void DbgCommandBuffer::CopyTextureFromFramebuffer(
     }
 
     LLGL_DBG_COMMAND( "CopyTextureFromFramebuffer", instance.CopyTextureFromFramebuffer(dstTextureDbg.instance, dstRegion, srcOffset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeCopyTextureFromFramebuffer, CaptureID(&dstTexture), dstRegion, srcOffset );
 
     profile_.commandBufferRecord.textureCopies++;
 }
 
+void DbgCommandBuffer::ClearTexture(Texture& texture, const TextureSubresource& subresource, const ClearValue& clearValue)
+{
+    auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, texture);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateClearTexture(textureDbg, subresource);
+    }
+
+    LLGL_DBG_COMMAND( "ClearTexture", instance.ClearTexture(textureDbg.instance, subresource, clearValue) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeClearTexture, CaptureID(&texture), subresource, clearValue );
+}
+
+void DbgCommandBuffer::DiscardResource(Resource& resource)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot discard resource inside a render pass");
+    }
+
+    LLGL_DBG_CAPTURE( CaptureOpcodeDiscardResource, CaptureID(&resource) );
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
+            if (validationEnabled_)
+                ValidateResidency(bufferDbg.evicted, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
+            LLGL_DBG_COMMAND( "DiscardResource", instance.DiscardResource(bufferDbg.instance) );
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
+            if (validationEnabled_)
+                ValidateResidency(textureDbg.evicted, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
+            LLGL_DBG_COMMAND( "DiscardResource", instance.DiscardResource(textureDbg.instance) );
+        }
+        break;
+
+        default:
+        {
+            if (validationEnabled_)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot discard resource other than buffer or texture");
+        }
+        break;
+    }
+}
+
 void DbgCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, texture);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -380,6 +614,7 @@ void DbgCommandBuffer::GenerateMips(Texture& texture)
     }
 
     LLGL_DBG_COMMAND( "GenerateMips", instance.GenerateMips(textureDbg.instance) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeGenerateMips, CaptureID(&texture) );
 
     profile_.commandBufferRecord.mipMapsGenerations++;
 }
@@ -388,7 +623,7 @@ void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
 {
     auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, texture);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -397,15 +632,55 @@ void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
     }
 
     LLGL_DBG_COMMAND( "GenerateMips", instance.GenerateMips(textureDbg.instance, subresource) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeGenerateMipsRange, CaptureID(&texture), subresource );
 
     profile_.commandBufferRecord.mipMapsGenerations++;
 }
 
+void DbgCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    std::vector<Texture*> textureInstances;
+    std::vector<std::uint32_t> textureIDs;
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        LLGL_DBG_ASSERT_PTR(textures);
+    }
+
+    if (textures != nullptr)
+    {
+        textureInstances.reserve(numTextures);
+        for_range(i, numTextures)
+        {
+            if (auto textureDbg = LLGL_CAST(DbgTexture*, textures[i]))
+            {
+                if (validationEnabled_)
+                    ValidateGenerateMips(*textureDbg);
+                textureInstances.push_back(&(textureDbg->instance));
+                if (captureEnabled_)
+                    textureIDs.push_back(CaptureID(textures[i]));
+            }
+            else if (validationEnabled_)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer in array of textures for MIP-map generation");
+        }
+    }
+
+    const std::uint32_t numTextureInstances = static_cast<std::uint32_t>(textureInstances.size());
+
+    LLGL_DBG_COMMAND( "GenerateMips", instance.GenerateMips(numTextureInstances, textureInstances.data()) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeGenerateMipsBatch, CaptureBytes{ textureIDs.data(), sizeof(std::uint32_t) * textureIDs.size() } );
+
+    profile_.commandBufferRecord.mipMapsGenerations += numTextureInstances;
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void DbgCommandBuffer::SetViewport(const Viewport& viewport)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -417,11 +692,12 @@ void DbgCommandBuffer::SetViewport(const Viewport& viewport)
     }
 
     LLGL_DBG_COMMAND( "SetViewport", instance.SetViewport(viewport) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetViewport, viewport );
 }
 
 void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
 
@@ -453,13 +729,14 @@ void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport*
     }
 
     LLGL_DBG_COMMAND( "SetViewports", instance.SetViewports(numViewports, viewports) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetViewports, CaptureBytes{ viewports, sizeof(Viewport) * numViewports } );
 }
 
 void DbgCommandBuffer::SetScissor(const Scissor& scissor)
 {
     LLGL_DBG_ASSERT_REF(scissor);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -468,11 +745,12 @@ void DbgCommandBuffer::SetScissor(const Scissor& scissor)
     }
 
     LLGL_DBG_COMMAND( "SetScissor", instance.SetScissor(scissor) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetScissor, scissor );
 }
 
 void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -484,45 +762,59 @@ void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sci
     }
 
     LLGL_DBG_COMMAND( "SetScissors", instance.SetScissors(numScissors, scissors) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetScissors, CaptureBytes{ scissors, sizeof(Scissor) * numScissors } );
 }
 
 /* ----- Buffers ------ */
 
-void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindBufferFlags(bufferDbg, BindFlags::VertexBuffer);
+        ValidateVertexBufferOffset(bufferDbg, offset);
 
         bindings_.vertexBufferStore[0]  = (&bufferDbg);
         bindings_.vertexBuffers         = bindings_.vertexBufferStore;
         bindings_.numVertexBuffers      = 1;
+        bindings_.vertexBufferOffset    = offset;
+        bindings_.vertexLayoutValidated = false;
     }
 
-    LLGL_DBG_COMMAND( "SetVertexBuffer", instance.SetVertexBuffer(bufferDbg.instance) );
+    LLGL_DBG_COMMAND( "SetVertexBuffer", instance.SetVertexBuffer(bufferDbg.instance, offset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetVertexBuffer, CaptureID(&buffer), offset );
 
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
 
-void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayDbg = LLGL_DBG_CAST(DbgBufferArray&, bufferArray);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
         ValidateBindFlags(bufferArrayDbg.GetBindFlags(), BindFlags::VertexBuffer, BindFlags::VertexBuffer, "LLGL::BufferArray");
 
-        bindings_.vertexBuffers     = bufferArrayDbg.buffers.data();
-        bindings_.numVertexBuffers  = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
+        if (offsets != nullptr)
+        {
+            for_range(i, bufferArrayDbg.buffers.size())
+                ValidateVertexBufferOffset(*bufferArrayDbg.buffers[i], offsets[i]);
+        }
+
+        bindings_.vertexBuffers         = bufferArrayDbg.buffers.data();
+        bindings_.numVertexBuffers      = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
+        bindings_.vertexBufferOffset    = (offsets != nullptr && !bufferArrayDbg.buffers.empty() ? offsets[0] : 0);
+        bindings_.vertexLayoutValidated = false;
     }
 
-    LLGL_DBG_COMMAND( "SetVertexBufferArray", instance.SetVertexBufferArray(bufferArrayDbg.instance) );
+    LLGL_DBG_COMMAND( "SetVertexBufferArray", instance.SetVertexBufferArray(bufferArrayDbg.instance, offsets) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetVertexBufferArray, CaptureID(&bufferArray), CaptureBytes{ offsets, (offsets != nullptr ? sizeof(std::uint64_t) * bufferArrayDbg.buffers.size() : 0) } );
 
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
@@ -531,7 +823,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -545,6 +837,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
     }
 
     LLGL_DBG_COMMAND( "SetIndexBuffer", instance.SetIndexBuffer(bufferDbg.instance) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetIndexBuffer, CaptureID(&buffer) );
 
     profile_.commandBufferRecord.indexBufferBindings++;
 }
@@ -554,7 +847,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -577,6 +870,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::
     }
 
     LLGL_DBG_COMMAND( "SetIndexBuffer", instance.SetIndexBuffer(bufferDbg.instance, format, offset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetIndexBufferExt, CaptureID(&buffer), format, offset );
 
     profile_.commandBufferRecord.indexBufferBindings++;
 }
@@ -588,7 +882,7 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
 {
     auto& resourceHeapDbg = LLGL_DBG_CAST(DbgResourceHeap&, resourceHeap);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -597,6 +891,7 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
     }
 
     LLGL_DBG_COMMAND( "SetResourceHeap", instance.SetResourceHeap(resourceHeapDbg.instance, descriptorSet) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetResourceHeap, CaptureID(&resourceHeap), descriptorSet );
 
     profile_.commandBufferRecord.resourceHeapBindings++;
 }
@@ -605,7 +900,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
     const BindingDescriptor* bindingDesc = nullptr;
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -622,6 +917,8 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
             bindings_.bindingTable.resources[descriptor] = &resource;
     }
 
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetResource, descriptor, CaptureID(&resource) );
+
     switch (resource.GetResourceType())
     {
         case ResourceType::Undefined:
@@ -640,6 +937,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                     (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
                     GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
                 );
+                ValidateResidency(bufferDbg.evicted, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
             }
 
             LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, bufferDbg.instance) );
@@ -670,6 +968,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                     (BindFlags::Sampled | BindFlags::Storage | BindFlags::CombinedSampler),
                     GetLabelOrDefault(textureDbg.label, "LLGL::Buffer")
                 );
+                ValidateResidency(textureDbg.evicted, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
             }
 
             LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, textureDbg.instance) );
@@ -702,6 +1001,55 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     }
 }
 
+void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+    const BindingDescriptor* bindingDesc = nullptr;
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+
+        if (auto* pso = bindings_.pipelineState)
+        {
+            if (auto* psoLayout = pso->pipelineLayout)
+                bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, buffer);
+        }
+        else
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
+
+        if (descriptor < bindings_.bindingTable.resources.size())
+            bindings_.bindingTable.resources[descriptor] = &buffer;
+
+        if (bindingDesc != nullptr)
+        {
+            ValidateBindFlags(
+                bufferDbg.desc.bindFlags,
+                bindingDesc->bindFlags,
+                (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
+                GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
+            );
+            ValidateResidency(bufferDbg.evicted, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
+            ValidateResourceBufferRange(bufferDbg, offset, size, bindingDesc->bindFlags);
+        }
+    }
+
+    LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, bufferDbg.instance, offset, size) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetBufferRange, descriptor, CaptureID(&buffer), offset, size );
+
+    /* Record binding for profiling */
+    if (bindingDesc != nullptr)
+    {
+        if ((bindingDesc->bindFlags & BindFlags::ConstantBuffer) != 0)
+            profile_.commandBufferRecord.constantBufferBindings++;
+        if ((bindingDesc->bindFlags & BindFlags::Sampled) != 0)
+            profile_.commandBufferRecord.sampledBufferBindings++;
+        if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
+            profile_.commandBufferRecord.storageBufferBindings++;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void DbgCommandBuffer::BeginRenderPass(
@@ -711,7 +1059,7 @@ void DbgCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       swapBufferIndex)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -739,6 +1087,8 @@ void DbgCommandBuffer::BeginRenderPass(
 
     const RenderPass* renderPassInstance = DbgGetInstance<DbgRenderPass>(renderPass);
 
+    LLGL_DBG_CAPTURE( CaptureOpcodeBeginRenderPass, CaptureID(&renderTarget), CaptureID(renderPass), CaptureBytes{ clearValues, sizeof(ClearValue) * numClearValues }, swapBufferIndex );
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         auto& swapChainDbg = LLGL_DBG_CAST(DbgSwapChain&, renderTarget);
@@ -749,7 +1099,7 @@ void DbgCommandBuffer::BeginRenderPass(
         bindings_.renderTarget  = nullptr;
 
         /* Record swap-chain frame to validate when submitting the command buffer */
-        if (debugger_)
+        if (validationEnabled_)
         {
             const std::uint32_t actualSwapBufferIndex = (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX ? swapChainDbg.GetCurrentSwapIndex() : swapBufferIndex);
             records_.swapChainFrames.push_back({ bindings_.swapChain, actualSwapBufferIndex });
@@ -768,12 +1118,20 @@ void DbgCommandBuffer::BeginRenderPass(
         instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
     }
 
+    /* Track subpasses of either the specified render pass or the one the render target was created with */
+    const DbgRenderPass* renderPassDbg = DbgGetWrapper<DbgRenderPass>(renderPass);
+    if (renderPassDbg == nullptr && bindings_.renderTarget != nullptr)
+        renderPassDbg = DbgGetWrapper<DbgRenderPass>(bindings_.renderTarget->desc.renderPass);
+
+    bindings_.subpass       = 0;
+    bindings_.numSubpasses  = (renderPassDbg != nullptr ? renderPassDbg->NumSubpasses() : 1u);
+
     profile_.commandBufferRecord.renderPassSections++;
 }
 
 void DbgCommandBuffer::EndRenderPass()
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -784,11 +1142,31 @@ void DbgCommandBuffer::EndRenderPass()
     }
 
     instance.EndRenderPass();
+    LLGL_DBG_CAPTURE( CaptureOpcodeEndRenderPass );
+}
+
+void DbgCommandBuffer::NextSubpass()
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        if (!states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot advance to next subpass while no render pass is currently active");
+        else if (bindings_.subpass + 1 >= bindings_.numSubpasses)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot advance to next subpass beyond the last subpass of render pass (%u)", bindings_.numSubpasses);
+    }
+
+    bindings_.subpass++;
+
+    instance.NextSubpass();
+    LLGL_DBG_CAPTURE( CaptureOpcodeNextSubpass );
 }
 
 void DbgCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -797,13 +1175,14 @@ void DbgCommandBuffer::Clear(long flags, const ClearValue& clearValue)
     }
 
     LLGL_DBG_COMMAND( "Clear", instance.Clear(flags, clearValue) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeClear, flags, clearValue );
 
     profile_.commandBufferRecord.attachmentClears++;
 }
 
 void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -814,6 +1193,7 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
     }
 
     LLGL_DBG_COMMAND( "ClearAttachments", instance.ClearAttachments(numAttachments, attachments) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeClearAttachments, CaptureBytes{ attachments, sizeof(AttachmentClear) * numAttachments } );
 
     profile_.commandBufferRecord.attachmentClears++;
 }
@@ -824,7 +1204,7 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
     auto& pipelineStateDbg = LLGL_DBG_CAST(DbgPipelineState&, pipelineState);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -832,6 +1212,7 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
         /* Bind graphics pipeline and unbind compute pipeline */
         bindings_.pipelineState         = (&pipelineStateDbg);
         bindings_.anyShaderAttributes   = false;
+        bindings_.vertexLayoutValidated = false;
 
         if (pipelineStateDbg.isGraphicsPSO)
         {
@@ -845,6 +1226,7 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
             /* Store dynamic states */
             bindings_.blendFactorSet = !pipelineStateDbg.HasDynamicBlendFactor();
             bindings_.stencilRefSet = !pipelineStateDbg.HasDynamicStencilRef();
+            bindings_.dynamicStatesSet = 0;
 
             /* If the PSO was created with static viewports, this PSO dictates the number of bound viewports */
             if (!pipelineStateDbg.graphicsDesc.viewports.empty())
@@ -870,6 +1252,7 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 
     /* Call wrapped function */
     LLGL_DBG_COMMAND( "SetPipelineState", instance.SetPipelineState(pipelineStateDbg.instance) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetPipelineState, CaptureID(&pipelineState) );
 
     if (pipelineStateDbg.isGraphicsPSO)
         profile_.commandBufferRecord.graphicsPipelineBindings++;
@@ -879,7 +1262,7 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 
 void DbgCommandBuffer::SetBlendFactor(const float color[4])
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
@@ -892,11 +1275,12 @@ void DbgCommandBuffer::SetBlendFactor(const float color[4])
     }
 
     LLGL_DBG_COMMAND( "SetBlendFactor", instance.SetBlendFactor(color) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetBlendFactor, color[0], color[1], color[2], color[3] );
 }
 
 void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
@@ -909,11 +1293,151 @@ void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const Stenci
     }
 
     LLGL_DBG_COMMAND( "SetStencilReference", instance.SetStencilReference(reference, stencilFace) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetStencilReference, reference, stencilFace );
+}
+
+// Returns an identifier for the class of primitives the specified topology belongs to: points, lines, triangles, or patches of a certain size.
+static std::uint32_t GetPrimitiveTopologyClass(const PrimitiveTopology primitiveTopology)
+{
+    switch (primitiveTopology)
+    {
+        case PrimitiveTopology::PointList:
+            return 0;
+        case PrimitiveTopology::LineList:
+        case PrimitiveTopology::LineStrip:
+        case PrimitiveTopology::LineListAdjacency:
+        case PrimitiveTopology::LineStripAdjacency:
+            return 1;
+        case PrimitiveTopology::TriangleList:
+        case PrimitiveTopology::TriangleStrip:
+        case PrimitiveTopology::TriangleListAdjacency:
+        case PrimitiveTopology::TriangleStripAdjacency:
+            return 2;
+        default:
+            return 2 + GetPrimitiveTopologyPatchSize(primitiveTopology);
+    }
+}
+
+void DbgCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDynamicStateFlag(DynamicStateFlags::CullMode, "CullMode");
+    }
+
+    LLGL_DBG_COMMAND( "SetCullMode", instance.SetCullMode(cullMode) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetCullMode, cullMode );
+}
+
+void DbgCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDynamicStateFlag(DynamicStateFlags::DepthState, "DepthState");
+    }
+
+    LLGL_DBG_COMMAND( "SetDepthState", instance.SetDepthState(depthDesc) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetDepthState, depthDesc );
+}
+
+void DbgCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDynamicStateFlag(DynamicStateFlags::StencilState, "StencilState");
+    }
+
+    LLGL_DBG_COMMAND( "SetStencilState", instance.SetStencilState(stencilDesc) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetStencilState, stencilDesc );
+}
+
+void DbgCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDynamicStateFlag(DynamicStateFlags::PrimitiveTopology, "PrimitiveTopology");
+        if (auto pipelineStateDbg = bindings_.pipelineState)
+        {
+            if (GetPrimitiveTopologyClass(primitiveTopology) != GetPrimitiveTopologyClass(pipelineStateDbg->graphicsDesc.primitiveTopology))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "dynamic primitive topology must be of the same primitive class (points, lines, triangles, or patch size) as the graphics pipeline"
+                );
+            }
+        }
+    }
+
+    LLGL_DBG_COMMAND( "SetPrimitiveTopology", instance.SetPrimitiveTopology(primitiveTopology) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetPrimitiveTopology, primitiveTopology );
+}
+
+void DbgCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDynamicStateFlag(DynamicStateFlags::DepthBias, "DepthBias");
+    }
+
+    LLGL_DBG_COMMAND( "SetDepthBias", instance.SetDepthBias(depthBiasDesc) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetDepthBias, depthBiasDesc );
+}
+
+void DbgCommandBuffer::SetShadingRate(const ShadingRateDescriptor& shadingRateDesc)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        if (!features_.hasVariableRateShading)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("variable rate shading");
+        else if (!features_.hasShadingRateImage &&
+                 (shadingRateDesc.primitiveCombiner != ShadingRateCombiner::Passthrough ||
+                  shadingRateDesc.imageCombiner     != ShadingRateCombiner::Passthrough))
+        {
+            LLGL_DBG_ERROR_NOT_SUPPORTED("shading rate combiners other than ShadingRateCombiner::Passthrough");
+        }
+    }
+
+    LLGL_DBG_COMMAND( "SetShadingRate", instance.SetShadingRate(shadingRateDesc) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetShadingRate, shadingRateDesc );
+}
+
+void DbgCommandBuffer::SetShadingRateImage(Texture* texture)
+{
+    auto* textureDbg = LLGL_CAST(DbgTexture*, texture);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        if (!features_.hasShadingRateImage)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("shading-rate images");
+        else if (textureDbg != nullptr)
+        {
+            if (textureDbg->desc.type != TextureType::Texture2D || textureDbg->desc.format != Format::R8UInt)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "shading-rate image must be a 2D texture of format R8UInt, but got %s texture of format %s",
+                    ToString(textureDbg->desc.type), ToString(textureDbg->desc.format)
+                );
+            }
+        }
+    }
+
+    LLGL_DBG_COMMAND( "SetShadingRateImage", instance.SetShadingRateImage(textureDbg != nullptr ? &(textureDbg->instance) : nullptr) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetShadingRateImage, CaptureID(texture) );
 }
 
 void DbgCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -928,6 +1452,7 @@ void DbgCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::u
     }
 
     LLGL_DBG_COMMAND( "SetUniforms", instance.SetUniforms(first, data, dataSize) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeSetUniforms, first, CaptureBytes{ data, dataSize } );
 }
 
 /* ----- Queries ----- */
@@ -936,7 +1461,7 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -950,6 +1475,7 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
     }
 
     instance.BeginQuery(queryHeapDbg.instance, query);
+    CaptureUnsupported("BeginQuery");
 
     profile_.commandBufferRecord.querySections++;
 }
@@ -958,7 +1484,7 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -972,13 +1498,14 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     }
 
     instance.EndQuery(queryHeapDbg.instance, query);
+    CaptureUnsupported("EndQuery");
 }
 
 void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -987,19 +1514,43 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
     }
 
     instance.BeginRenderCondition(queryHeapDbg.instance, query, mode);
+    CaptureUnsupported("BeginRenderCondition");
 
     profile_.commandBufferRecord.renderConditionSections++;
 }
 
 void DbgCommandBuffer::EndRenderCondition()
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
         AssertPrimaryCommandBuffer();
     }
     instance.EndRenderCondition();
+    CaptureUnsupported("EndRenderCondition");
+}
+
+void DbgCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateQueryResolve(queryHeapDbg, firstQuery, numQueries, dstBufferDbg, dstOffset);
+    }
+
+    LLGL_DBG_COMMAND( "ResolveQueryData", instance.ResolveQueryData(queryHeapDbg.instance, firstQuery, numQueries, dstBufferDbg.instance, dstOffset) );
+    CaptureUnsupported("ResolveQueryData");
 }
 
 /* ----- Stream Output ------ */
@@ -1009,7 +1560,7 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
     Buffer* bufferInstances[LLGL_MAX_NUM_SO_BUFFERS];
     bool validationFailed = false;
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -1058,13 +1609,14 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 
     if (!validationFailed)
         instance.BeginStreamOutput(numBuffers, bufferInstances);
+    CaptureUnsupported("BeginStreamOutput");
 
     profile_.commandBufferRecord.streamOutputSections++;
 }
 
 void DbgCommandBuffer::EndStreamOutput()
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
@@ -1079,52 +1631,56 @@ void DbgCommandBuffer::EndStreamOutput()
     }
 
     instance.EndStreamOutput();
+    CaptureUnsupported("EndStreamOutput");
 }
 
 /* ----- Drawing ----- */
 
 void DbgCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateDrawCmd(numVertices, firstVertex, 1, 0);
     }
 
     LLGL_DBG_COMMAND( "Draw", instance.Draw(numVertices, firstVertex) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDraw, numVertices, firstVertex );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateDrawIndexedCmd(numIndices, 1, firstIndex, 0, 0);
     }
 
     LLGL_DBG_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexed, numIndices, firstIndex );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateDrawIndexedCmd(numIndices, 1, firstIndex, vertexOffset, 0);
     }
 
     LLGL_DBG_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex, vertexOffset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedOffset, numIndices, firstIndex, vertexOffset );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertInstancingSupported();
@@ -1132,13 +1688,14 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
     }
 
     LLGL_DBG_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawInstanced, numVertices, firstVertex, numInstances );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertInstancingSupported();
@@ -1147,13 +1704,14 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
     }
 
     LLGL_DBG_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawInstancedOffset, numVertices, firstVertex, numInstances, firstInstance );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertInstancingSupported();
@@ -1161,13 +1719,14 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedInstanced, numIndices, numInstances, firstIndex );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertInstancingSupported();
@@ -1175,13 +1734,14 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedInstancedOffset, numIndices, numInstances, firstIndex, vertexOffset );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
 void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertInstancingSupported();
@@ -1190,15 +1750,38 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedInstancedOffsetFirst, numIndices, numInstances, firstIndex, vertexOffset, firstInstance );
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
+void DbgCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertInstancingSupported();
+        AssertOffsetInstancingSupported();
+        if (numDraws > 0 && draws == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot draw %u commands with null pointer to draw arguments", numDraws);
+        else
+        {
+            for_range(i, numDraws)
+                ValidateDrawIndexedCmd(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+        }
+    }
+
+    LLGL_DBG_COMMAND( "MultiDrawIndexed", instance.MultiDrawIndexed(numDraws, draws) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeMultiDrawIndexed, CaptureBytes{ draws, sizeof(DrawIndexedIndirectArguments) * numDraws } );
+
+    profile_.commandBufferRecord.drawCommands += numDraws;
+}
+
 void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertIndirectDrawingSupported();
@@ -1208,6 +1791,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
     }
 
     LLGL_DBG_COMMAND( "DrawIndirect", instance.DrawIndirect(bufferDbg.instance, offset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndirect, CaptureID(&buffer), offset );
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1216,7 +1800,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertIndirectDrawingSupported();
@@ -1227,6 +1811,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
     }
 
     LLGL_DBG_COMMAND( "DrawIndirect", instance.DrawIndirect(bufferDbg.instance, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndirectN, CaptureID(&buffer), offset, numCommands, stride );
 
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
@@ -1235,7 +1820,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertIndirectDrawingSupported();
@@ -1245,6 +1830,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(bufferDbg.instance, offset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedIndirect, CaptureID(&buffer), offset );
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1253,7 +1839,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         AssertIndirectDrawingSupported();
@@ -1264,6 +1850,105 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     }
 
     LLGL_DBG_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedIndirectN, CaptureID(&buffer), offset, numCommands, stride );
+
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
+void DbgCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferDbg    = LLGL_DBG_CAST(DbgBuffer&, argumentsBuffer);
+    auto& countBufferDbg        = LLGL_DBG_CAST(DbgBuffer&, countBuffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertIndirectDrawingCountSupported();
+        ValidateIndirectCountBuffers(argumentsBufferDbg, argumentsOffset, countBufferDbg, countOffset, maxNumCommands, stride);
+    }
+
+    LLGL_DBG_COMMAND(
+        "DrawIndirectCount",
+        instance.DrawIndirectCount(argumentsBufferDbg.instance, argumentsOffset, countBufferDbg.instance, countOffset, maxNumCommands, stride)
+    );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndirectCount, CaptureID(&argumentsBuffer), argumentsOffset, CaptureID(&countBuffer), countOffset, maxNumCommands, stride );
+
+    /* Number of draw commands is unknown on the CPU, so only a single command is recorded */
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferDbg    = LLGL_DBG_CAST(DbgBuffer&, argumentsBuffer);
+    auto& countBufferDbg        = LLGL_DBG_CAST(DbgBuffer&, countBuffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertIndirectDrawingCountSupported();
+        ValidateIndirectCountBuffers(argumentsBufferDbg, argumentsOffset, countBufferDbg, countOffset, maxNumCommands, stride);
+    }
+
+    LLGL_DBG_COMMAND(
+        "DrawIndexedIndirectCount",
+        instance.DrawIndexedIndirectCount(argumentsBufferDbg.instance, argumentsOffset, countBufferDbg.instance, countOffset, maxNumCommands, stride)
+    );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawIndexedIndirectCount, CaptureID(&argumentsBuffer), argumentsOffset, CaptureID(&countBuffer), countOffset, maxNumCommands, stride );
+
+    /* Number of draw commands is unknown on the CPU, so only a single command is recorded */
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+
+        if (numThreadGroupsX * numThreadGroupsY * numThreadGroupsZ == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
+
+        ValidateDrawMeshTasksCmd();
+        ValidateThreadGroupLimit(numThreadGroupsX, limits_.maxMeshShaderWorkGroups[0]);
+        ValidateThreadGroupLimit(numThreadGroupsY, limits_.maxMeshShaderWorkGroups[1]);
+        ValidateThreadGroupLimit(numThreadGroupsZ, limits_.maxMeshShaderWorkGroups[2]);
+    }
+
+    LLGL_DBG_COMMAND( "DrawMeshTasks", instance.DrawMeshTasks(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawMeshTasks, numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ );
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
+
+    if (validationEnabled_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDrawMeshTasksCmd();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        if (numCommands > 0)
+            ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(stride)*(numCommands - 1) + sizeof(DrawMeshTasksIndirectArguments));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND( "DrawMeshTasksIndirect", instance.DrawMeshTasksIndirect(bufferDbg.instance, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDrawMeshTasksIndirect, CaptureID(&buffer), offset, numCommands, stride );
 
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
@@ -1272,7 +1957,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
 
@@ -1287,6 +1972,7 @@ void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numW
     }
 
     LLGL_DBG_COMMAND( "Dispatch", instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDispatch, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ );
 
     profile_.commandBufferRecord.dispatchCommands++;
 }
@@ -1295,7 +1981,7 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
@@ -1305,6 +1991,7 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
     }
 
     LLGL_DBG_COMMAND( "DispatchIndirect", instance.DispatchIndirect(bufferDbg.instance, offset) );
+    LLGL_DBG_CAPTURE( CaptureOpcodeDispatchIndirect, CaptureID(&buffer), offset );
 
     profile_.commandBufferRecord.dispatchCommands++;
 }
@@ -1313,7 +2000,7 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 
 void DbgCommandBuffer::PushDebugGroup(const char* name)
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         LLGL_DBG_SOURCE();
         LLGL_DBG_ASSERT_PTR(name);
@@ -1325,14 +2012,16 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     debugGroups_.push(name);
     instance.PushDebugGroup(name);
+    LLGL_DBG_CAPTURE( CaptureOpcodePushDebugGroup, name );
 }
 
 void DbgCommandBuffer::PopDebugGroup()
 {
     instance.PopDebugGroup();
+    LLGL_DBG_CAPTURE( CaptureOpcodePopDebugGroup );
     debugGroups_.pop();
 
-    if (debugger_)
+    if (validationEnabled_)
     {
         if (debugGroups_.empty())
             debugger_->SetDebugGroup(nullptr);
@@ -1346,6 +2035,7 @@ void DbgCommandBuffer::PopDebugGroup()
 void DbgCommandBuffer::DoNativeCommand(const void* nativeCommand, std::size_t nativeCommandSize)
 {
     LLGL_DBG_COMMAND( "DoNativeCommand", instance.DoNativeCommand(nativeCommand, nativeCommandSize) );
+    CaptureUnsupported("DoNativeCommand");
 }
 
 bool DbgCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -1377,7 +2067,14 @@ void DbgCommandBuffer::ValidateSubmit()
     }
 }
 
+void DbgCommandBuffer::RecordCaptureSubmit()
+{
+    if (captureEnabled_)
+        capture_->RecordSubmit(*this, desc.flags, captureStream_);
+}
+
 #undef LLGL_DBG_COMMAND
+#undef LLGL_DBG_CAPTURE
 
 
 /*
@@ -1386,7 +2083,7 @@ void DbgCommandBuffer::ValidateSubmit()
 
 void DbgCommandBuffer::ValidateBeginOfRecording()
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         if (states_.recording)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot begin nested recording of command buffer");
@@ -1396,7 +2093,7 @@ void DbgCommandBuffer::ValidateBeginOfRecording()
 
 void DbgCommandBuffer::ValidateEndOfRecording()
 {
-    if (debugger_)
+    if (validationEnabled_)
     {
         if (!states_.recording)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end recording of command buffer while no recording is currently active");
@@ -1486,6 +2183,54 @@ void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const Textur
     }
 }
 
+void DbgCommandBuffer::ValidateClearTexture(DbgTexture& textureDbg, const TextureSubresource& subresource)
+{
+    const char* textureName = GetLabelOrDefault(textureDbg.label, "LLGL::Texture");
+
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot clear texture inside a render pass");
+
+    constexpr long clearableBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment | BindFlags::Storage);
+    if ((textureDbg.desc.bindFlags & clearableBindFlags) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidState,
+            "cannot clear %s that was created without any of the binding flags 'LLGL::BindFlags::ColorAttachment', 'LLGL::BindFlags::DepthStencilAttachment', or 'LLGL::BindFlags::Storage'",
+            textureName
+        );
+    }
+
+    if (IsCompressedFormat(textureDbg.desc.format))
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot clear %s with compressed format LLGL::Format::%s", textureName, ToString(textureDbg.desc.format));
+
+    ValidateResidency(textureDbg.evicted, textureName);
+
+    if (subresource.numMipLevels == 0 || subresource.numArrayLayers == 0)
+    {
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "clearing a texture subresource with a total number of 0 MIP-maps or array layers has no effect");
+    }
+    else
+    {
+        if (subresource.baseMipLevel + subresource.numMipLevels > textureDbg.mipLevels)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot clear texture with subresource being out of bounds: MIP-map range is [0, %u), but [%u, %u) was specified",
+                textureDbg.mipLevels, subresource.baseMipLevel, (subresource.baseMipLevel + subresource.numMipLevels)
+            );
+        }
+        if (textureDbg.desc.type != TextureType::Texture3D &&
+            subresource.baseArrayLayer + subresource.numArrayLayers > textureDbg.desc.arrayLayers)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot clear texture with subresource being out of bounds: array layer range is [0, %u), but [%u, %u) was specified",
+                textureDbg.desc.arrayLayers, subresource.baseArrayLayer, (subresource.baseArrayLayer + subresource.numArrayLayers)
+            );
+        }
+    }
+}
+
 void DbgCommandBuffer::ValidateViewport(const Viewport& viewport)
 {
     if (viewport.width < 0.0f || viewport.height < 0.0f)
@@ -1542,25 +2287,31 @@ void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment
 
 void DbgCommandBuffer::ValidateVertexLayout()
 {
+    /* Skip validation if the vertex layout has already been validated for the current PSO and vertex buffers */
+    if (bindings_.vertexLayoutValidated)
+        return;
+
     if (auto pso = bindings_.pipelineState)
     {
-        if (pso->isGraphicsPSO && bindings_.numVertexBuffers > 0)
+        if (pso->isGraphicsPSO && bindings_.numVertexBuffers > 0 && pso->graphicsDesc.vertexStreams.empty())
         {
             if (auto vertexShader = pso->graphicsDesc.vertexShader)
             {
                 auto vertexShaderDbg = LLGL_CAST(const DbgShader*, vertexShader);
                 const auto& inputAttribs = vertexShaderDbg->desc.vertex.inputAttribs;
-                if (!inputAttribs.empty())
-                    ValidateVertexLayoutAttributes(inputAttribs, bindings_.vertexBuffers, bindings_.numVertexBuffers);
+                if (!inputAttribs.empty() && !ValidateVertexLayoutAttributes(inputAttribs, bindings_.vertexBuffers, bindings_.numVertexBuffers))
+                    return;
             }
+            bindings_.vertexLayoutValidated = true;
         }
     }
 }
 
-void DbgCommandBuffer::ValidateVertexLayoutAttributes(const ArrayView<VertexAttribute>& shaderVertexAttribs, DbgBuffer* const * vertexBuffers, std::uint32_t numVertexBuffers)
+bool DbgCommandBuffer::ValidateVertexLayoutAttributes(const ArrayView<VertexAttribute>& shaderVertexAttribs, DbgBuffer* const * vertexBuffers, std::uint32_t numVertexBuffers)
 {
     /* Check if all vertex attributes are served by active vertex buffer(s) */
     std::size_t attribIndex = 0;
+    bool        result      = true;
 
     for (std::uint32_t bufferIndex = 0; attribIndex < shaderVertexAttribs.size() && bufferIndex < numVertexBuffers; ++bufferIndex)
     {
@@ -1574,12 +2325,20 @@ void DbgCommandBuffer::ValidateVertexLayoutAttributes(const ArrayView<VertexAttr
             const auto& attribRhs = bufferVertexAttribs[i];
 
             if (attribLhs != attribRhs)
+            {
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "vertex layout mismatch between shader program and vertex buffer(s)");
+                result = false;
+            }
         }
     }
 
     if (attribIndex < shaderVertexAttribs.size())
+    {
         LLGL_DBG_ERROR(ErrorType::InvalidState, "not all vertex attributes in the shader pipeline are covered by the bound vertex buffer(s)");
+        result = false;
+    }
+
+    return result;
 }
 
 void DbgCommandBuffer::ValidateNumVertices(std::uint32_t numVertices)
@@ -1688,6 +2447,15 @@ void DbgCommandBuffer::ValidateInstanceID(std::uint32_t firstInstance)
     }
 }
 
+// Returns the number of elements in the specified vertex buffer that are accessible after the specified offset.
+static std::uint32_t GetNumVertexBufferElements(const DbgBuffer& bufferDbg, std::uint64_t offset)
+{
+    if (bufferDbg.elements == 0 || offset >= bufferDbg.desc.size)
+        return 0;
+    const std::uint64_t elementSize = bufferDbg.desc.size / bufferDbg.elements;
+    return static_cast<std::uint32_t>((bufferDbg.desc.size - offset) / elementSize);
+}
+
 void DbgCommandBuffer::ValidateDrawCmd(
     std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
@@ -1705,7 +2473,7 @@ void DbgCommandBuffer::ValidateDrawCmd(
     ValidateBindingTable();
 
     if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
-        ValidateVertexLimit(numVertices + firstVertex, static_cast<std::uint32_t>(bindings_.vertexBuffers[0]->elements));
+        ValidateVertexLimit(numVertices + firstVertex, GetNumVertexBufferElements(*bindings_.vertexBuffers[0], bindings_.vertexBufferOffset));
 }
 
 void DbgCommandBuffer::ValidateDrawIndexedCmd(
@@ -1743,6 +2511,21 @@ void DbgCommandBuffer::ValidateDrawIndexedCmd(
     }
 }
 
+void DbgCommandBuffer::ValidateDrawMeshTasksCmd()
+{
+    AssertRecording();
+    AssertInsideRenderPass();
+    AssertMeshShadersSupported();
+    if (DbgPipelineState* pipelineStateDbg = AssertAndGetGraphicsPSO())
+    {
+        if (pipelineStateDbg->graphicsDesc.meshShader == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "graphics pipeline without mesh shader is bound but mesh shader pipeline is required");
+    }
+    AssertViewportBound();
+    ValidateDynamicStates();
+    ValidateBindingTable();
+}
+
 void DbgCommandBuffer::ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit)
 {
     if (vertexCount > vertexLimit)
@@ -1888,11 +2671,25 @@ void DbgCommandBuffer::ValidateBindFlags(long resourceFlags, long bindFlags, lon
 void DbgCommandBuffer::ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags)
 {
     ValidateBindFlags(bufferDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
+    ValidateResidency(bufferDbg.evicted, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
 }
 
 void DbgCommandBuffer::ValidateBindTextureFlags(DbgTexture& textureDbg, long bindFlags)
 {
     ValidateBindFlags(textureDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
+    ValidateResidency(textureDbg.evicted, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
+}
+
+void DbgCommandBuffer::ValidateResidency(bool evicted, const char* resourceName)
+{
+    if (evicted)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidState,
+            "cannot use %s while it is evicted; call MakeResident() first",
+            resourceName
+        );
+    }
 }
 
 void DbgCommandBuffer::ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region)
@@ -1990,6 +2787,43 @@ void DbgCommandBuffer::ValidateTextureRegion(DbgTexture& textureDbg, const Textu
     }
 }
 
+void DbgCommandBuffer::ValidateTextureLocation(DbgTexture& textureDbg, const TextureLocation& location, const Extent3D& extent, const char* locationName)
+{
+    /* Validate MIP-map level */
+    if (location.mipLevel >= textureDbg.mipLevels)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "%s with MIP-map level %u out of bounds for texture with %u MIP-maps",
+            locationName, location.mipLevel, textureDbg.mipLevels
+        );
+        return;
+    }
+
+    /* Validate offset and extent against the subresource extent; array layers are stored in the Y or Z component for array textures */
+    const Offset3D offset       = CalcTextureOffset(textureDbg.GetType(), location.offset, location.arrayLayer);
+    const Extent3D mipExtent    = textureDbg.GetMipExtent(location.mipLevel);
+
+    if (offset.x < 0 || offset.y < 0 || offset.z < 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "%s with negative offset (%d, %d, %d)",
+            locationName, offset.x, offset.y, offset.z
+        );
+    }
+    else if (static_cast<std::uint32_t>(offset.x) + extent.x > mipExtent.x ||
+             static_cast<std::uint32_t>(offset.y) + extent.y > mipExtent.y ||
+             static_cast<std::uint32_t>(offset.z) + extent.z > mipExtent.z)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "%s with offset (%d, %d, %d) and extent (%u, %u, %u) out of bounds (%u, %u, %u) for MIP-level %u",
+            locationName, offset.x, offset.y, offset.z, extent.x, extent.y, extent.z, mipExtent.x, mipExtent.y, mipExtent.z, location.mipLevel
+        );
+    }
+}
+
 void DbgCommandBuffer::ValidateIndexType(const Format format)
 {
     if (format != Format::R16UInt && format != Format::R32UInt)
@@ -2001,6 +2835,51 @@ void DbgCommandBuffer::ValidateIndexType(const Format format)
     }
 }
 
+void DbgCommandBuffer::ValidateVertexBufferOffset(DbgBuffer& bufferDbg, std::uint64_t offset)
+{
+    if (offset > 0 && offset >= bufferDbg.desc.size)
+    {
+        const std::string bufferLabel = (bufferDbg.label.empty() ? "" : " for \"" + bufferDbg.label + "\"");
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "vertex buffer offset out of bounds%s: %" PRIu64 " specified but limit is %" PRIu64,
+            bufferLabel.c_str(), offset, bufferDbg.desc.size
+        );
+    }
+    ValidateAddressAlignment(offset, 4, "vertex buffer offset");
+}
+
+void DbgCommandBuffer::ValidateResourceBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size, long bindFlags)
+{
+    const std::string bufferLabel = (bufferDbg.label.empty() ? "" : " for \"" + bufferDbg.label + "\"");
+
+    if (!(offset < bufferDbg.desc.size))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "buffer binding offset out of bounds%s: %" PRIu64 " specified but limit is %" PRIu64,
+            bufferLabel.c_str(), offset, bufferDbg.desc.size
+        );
+    }
+    else if (size != LLGL_WHOLE_SIZE && size > bufferDbg.desc.size - offset)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "buffer binding range out of bounds%s: %" PRIu64 " specified but limit is %" PRIu64,
+            bufferLabel.c_str(), (offset + size), bufferDbg.desc.size
+        );
+    }
+    else if (size == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer binding range must not be empty%s", bufferLabel.c_str());
+
+    if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+        ValidateAddressAlignment(offset, limits_.minConstantBufferAlignment, "constant buffer binding offset");
+    else if ((bindFlags & BindFlags::Storage) != 0)
+        ValidateAddressAlignment(offset, limits_.minStorageBufferAlignment, "storage buffer binding offset");
+    else if ((bindFlags & BindFlags::Sampled) != 0)
+        ValidateAddressAlignment(offset, limits_.minSampledBufferAlignment, "sampled buffer binding offset");
+}
+
 void DbgCommandBuffer::ValidateTextureBufferCopyStrides(DbgTexture& textureDbg, std::uint32_t rowStride, std::uint32_t layerStride, const Extent3D& extent)
 {
     if (rowStride != 0)
@@ -2074,6 +2953,26 @@ void DbgCommandBuffer::ValidateAddressAlignment(std::uint64_t address, std::uint
     }
 }
 
+void DbgCommandBuffer::ValidateIndirectCountBuffers(
+    DbgBuffer&      argumentsBufferDbg,
+    std::uint64_t   argumentsOffset,
+    DbgBuffer&      countBufferDbg,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    /* Validate argument buffer for the maximum number of draw commands */
+    ValidateBindBufferFlags(argumentsBufferDbg, BindFlags::IndirectBuffer);
+    ValidateBufferRange(argumentsBufferDbg, argumentsOffset, static_cast<std::uint64_t>(stride) * maxNumCommands);
+    ValidateAddressAlignment(argumentsOffset, 4, "<argumentsOffset> parameter");
+    ValidateAddressAlignment(stride, 4, "<stride> parameter");
+
+    /* Validate count buffer for a single 32-bit unsigned integer */
+    ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+    ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t), "draw count");
+    ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+}
+
 bool DbgCommandBuffer::ValidateQueryIndex(DbgQueryHeap& queryHeapDbg, std::uint32_t query)
 {
     if (query >= queryHeapDbg.states.size())
@@ -2104,6 +3003,57 @@ void DbgCommandBuffer::ValidateRenderCondition(DbgQueryHeap& queryHeapDbg, std::
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use query heap for conditional rendering that was not created with 'renderCondition' enabled");
 }
 
+// Returns the size (in bytes) each query occupies when it is resolved into a buffer.
+static std::uint64_t GetQueryResolveStride(const QueryType type)
+{
+    switch (type)
+    {
+        case QueryType::TimeElapsed:        return sizeof(std::uint64_t) * 2;
+        case QueryType::PipelineStatistics: return sizeof(QueryPipelineStatistics);
+        default:                            return sizeof(std::uint64_t);
+    }
+}
+
+void DbgCommandBuffer::ValidateQueryResolve(
+    DbgQueryHeap&   queryHeapDbg,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    DbgBuffer&      dstBufferDbg,
+    std::uint64_t   dstOffset)
+{
+    if (!features_.hasQueryResolve)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("query resolve");
+
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query data inside a render pass");
+
+    if (numQueries == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no queries specified to resolve");
+    else if (ValidateQueryIndex(queryHeapDbg, firstQuery) && ValidateQueryIndex(queryHeapDbg, firstQuery + numQueries - 1))
+    {
+        for_range(i, numQueries)
+        {
+            if (queryHeapDbg.states[firstQuery + i] != DbgQueryHeap::State::Ready)
+            {
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query [%u] that has not ended", firstQuery + i);
+                break;
+            }
+        }
+    }
+
+    if (dstOffset % sizeof(std::uint64_t) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "destination offset for query resolve must be a multiple of 8, but %" PRIu64 " was specified",
+            dstOffset
+        );
+    }
+
+    ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+    ValidateBufferRange(dstBufferDbg, dstOffset, GetQueryResolveStride(queryHeapDbg.desc.type) * numQueries, "destination range");
+}
+
 void DbgCommandBuffer::ValidateRenderTargetRange(DbgRenderTarget& renderTargetDbg, const Offset2D& offset, const Extent2D& extent)
 {
     /* Validate extent and offset */
@@ -2270,6 +3220,14 @@ void DbgCommandBuffer::ValidateDynamicStates()
     if (DbgPipelineState* piplineStateDbg = bindings_.pipelineState)
     {
         const GraphicsPipelineDescriptor& graphicsPSODesc = piplineStateDbg->graphicsDesc;
+        if (const long missingDynamicStates = (graphicsPSODesc.dynamicStates & ~bindings_.dynamicStatesSet))
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "dynamic pipeline states are not set (0x%08X); missing calls to <LLGL::CommandBuffer::Set*> functions for LLGL::DynamicStateFlags",
+                static_cast<unsigned>(missingDynamicStates)
+            );
+        }
         if (graphicsPSODesc.rasterizer.scissorTestEnabled && graphicsPSODesc.scissors.empty() && bindings_.numScissorRects == 0)
         {
             LLGL_DBG_WARN(
@@ -2280,16 +3238,28 @@ void DbgCommandBuffer::ValidateDynamicStates()
     }
 }
 
+void DbgCommandBuffer::ValidateDynamicStateFlag(long dynamicState, const char* stateName)
+{
+    if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
+    {
+        if ((pipelineStateDbg->graphicsDesc.dynamicStates & dynamicState) != 0)
+            bindings_.dynamicStatesSet |= dynamicState;
+        else
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "graphics pipeline was not created with 'LLGL::DynamicStateFlags::%s' enabled", stateName);
+    }
+}
+
 void DbgCommandBuffer::ValidateBindingTable()
 {
-    auto ValidateBindingTableWithLayout = [this](const DbgPipelineState& pso, const BindingTable& table, const PipelineLayoutDescriptor& layoutDesc)
+    auto ValidateBindingTableWithLayout = [this](const DbgPipelineState& pso, const BindingTable& table, const PipelineLayoutDescriptor& layoutDesc) -> bool
     {
-        const std::string psoLabel = (!pso.label.empty() ? " \'" + pso.label + '\'' : "");
+        bool result = true;
         LLGL_ASSERT(table.resources.size() == layoutDesc.bindings.size());
         for_range(i, table.resources.size())
         {
             if (table.resources[i] == nullptr)
             {
+                const std::string psoLabel = (!pso.label.empty() ? " \'" + pso.label + '\'' : "");
                 const BindingDescriptor& binding = layoutDesc.bindings[i];
                 const std::string bindingSetLabel = (binding.slot.set != 0 ? ", set " + std::to_string(binding.slot.set) : "");
                 const std::string bindingNameLabel = (!binding.name.empty() ? ", name '" + binding.name + '\'' : "");
@@ -2298,14 +3268,25 @@ void DbgCommandBuffer::ValidateBindingTable()
                     "missing descriptor [%zu] in pipeline state%s for binding (slot %u%s%s)",
                     i, psoLabel.c_str(), binding.slot.index, bindingSetLabel.c_str(), bindingNameLabel.c_str()
                );
+                result = false;
             }
         }
+        return result;
     };
 
+    /*
+    Skip validation if all descriptors have already been bound for the current PSO.
+    Resources can only be replaced but not unbound until the next PSO is bound, so the result remains valid.
+    */
+    if (bindings_.bindingTable.validated)
+        return;
+
     if (auto pso = bindings_.pipelineState)
     {
         if (auto pipelineLayout = pso->pipelineLayout)
-            ValidateBindingTableWithLayout(*pso, bindings_.bindingTable, pipelineLayout->desc);
+            bindings_.bindingTable.validated = ValidateBindingTableWithLayout(*pso, bindings_.bindingTable, pipelineLayout->desc);
+        else
+            bindings_.bindingTable.validated = true;
     }
 }
 
@@ -2428,6 +3409,18 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertIndirectDrawingCountSupported()
+{
+    if (!features_.hasIndirectDrawingCount)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing with count buffer");
+}
+
+void DbgCommandBuffer::AssertMeshShadersSupported()
+{
+    if (!features_.hasMeshShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -2471,6 +3464,7 @@ void DbgCommandBuffer::ResetBindingTable(const DbgPipelineLayout* pipelineLayout
         table.resources.resize(layoutDesc.bindings.size(), nullptr);
         table.uniforms.clear();
         table.uniforms.resize(layoutDesc.uniforms.size(), 0);
+        table.validated = false;
     };
 
     auto ResetBindingTableZero = [](BindingTable& table)
@@ -2478,6 +3472,7 @@ void DbgCommandBuffer::ResetBindingTable(const DbgPipelineLayout* pipelineLayout
         table.resourceHeap = nullptr;
         table.resources.clear();
         table.uniforms.clear();
+        table.validated = false;
     };
 
     if (pipelineLayoutDbg != nullptr)
@@ -2534,6 +3529,17 @@ void DbgCommandBuffer::SetAndValidateScissorRects(std::uint32_t numScissors, con
     bindings_.numScissorRects = numScissors;
 }
 
+std::uint32_t DbgCommandBuffer::CaptureID(const void* obj)
+{
+    return capture_->GetObjectID(obj);
+}
+
+void DbgCommandBuffer::CaptureUnsupported(const char* name)
+{
+    if (captureEnabled_)
+        captureStream_.Record(CaptureOpcodeUnsupported, name);
+}
+
 
 } // /namespace LLGL
 
@@ -15,6 +15,7 @@
 #include <LLGL/Container/ArrayView.h>
 #include "RenderState/DbgQueryHeap.h"
 #include "DbgQueryTimerPool.h"
+#include "../CaptureFormat.h"
 #include <cstdint>
 #include <string>
 #include <stack>
@@ -31,6 +32,7 @@ class DbgRenderTarget;
 class DbgPipelineState;
 class DbgPipelineLayout;
 class DbgShader;
+class DbgCapture;
 
 class DbgCommandBuffer final : public CommandBuffer
 {
@@ -52,7 +54,8 @@ class DbgCommandBuffer final : public CommandBuffer
             FrameProfile&                   commonProfile,
             RenderingDebugger*              debugger,
             const CommandBufferDescriptor&  desc,
-            const RenderingCapabilities&    caps
+            const RenderingCapabilities&    caps,
+            DbgCapture*                     capture         = nullptr
         );
 
     public:
@@ -61,6 +64,9 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateSubmit();
 
+        // Writes the command stream of the last encoding into the capture file if capturing is enabled.
+        void RecordCaptureSubmit();
+
     public:
 
         CommandBuffer&                  instance;
@@ -74,6 +80,7 @@ class DbgCommandBuffer final : public CommandBuffer
             ResourceHeap*           resourceHeap = nullptr;
             std::vector<Resource*>  resources;
             std::vector<char>       uniforms;
+            bool                    validated    = false; // Cached result of ValidateBindingTable(); Reset when the PSO changes.
         };
 
         struct Bindings
@@ -82,12 +89,16 @@ class DbgCommandBuffer final : public CommandBuffer
             DbgSwapChain*       swapChain                                           = nullptr;
             DbgRenderTarget*    renderTarget                                        = nullptr;
             std::uint32_t       numViewports                                        = 0;
+            std::uint32_t       subpass                                             = 0;
+            std::uint32_t       numSubpasses                                        = 1;
 
             // Stream inputs/outputs
             DbgBuffer*          vertexBufferStore[1]                                = {};
             DbgBuffer* const *  vertexBuffers                                       = nullptr;
             std::uint32_t       numVertexBuffers                                    = 0;
+            std::uint64_t       vertexBufferOffset                                  = 0; // Offset of the first vertex buffer
             bool                anyShaderAttributes                                 = false;
+            bool                vertexLayoutValidated                               = false; // Cached result of ValidateVertexLayout()
             DbgBuffer*          indexBuffer                                         = nullptr;
             std::uint64_t       indexBufferFormatSize                               = 0;
             std::uint64_t       indexBufferOffset                                   = 0;
@@ -99,6 +110,7 @@ class DbgCommandBuffer final : public CommandBuffer
             const DbgShader*    vertexShader                                        = nullptr;
             bool                blendFactorSet                                      = false;
             bool                stencilRefSet                                       = false;
+            long                dynamicStatesSet                                    = 0; // Bitmask of DynamicStateFlags set since the last PSO
             Scissor             scissorRects[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
             std::uint32_t       numScissorRects                                     = 0;
             BindingTable        bindingTable;
@@ -130,11 +142,12 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateCommandBufferForExecute(const States& cmdBufferStates, const char* cmdBufferName = nullptr);
 
         void ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource = nullptr);
+        void ValidateClearTexture(DbgTexture& textureDbg, const TextureSubresource& subresource);
         void ValidateViewport(const Viewport& viewport);
         void ValidateAttachmentClear(const AttachmentClear& attachment);
 
         void ValidateVertexLayout();
-        void ValidateVertexLayoutAttributes(const ArrayView<VertexAttribute>& shaderVertexAttribs, DbgBuffer* const * vertexBuffers, std::uint32_t numVertexBuffers);
+        bool ValidateVertexLayoutAttributes(const ArrayView<VertexAttribute>& shaderVertexAttribs, DbgBuffer* const * vertexBuffers, std::uint32_t numVertexBuffers);
 
         void ValidateNumVertices(std::uint32_t numVertices);
         void ValidateNumInstances(std::uint32_t numInstances);
@@ -143,6 +156,7 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateDrawCmd(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance);
         void ValidateDrawIndexedCmd(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance);
+        void ValidateDrawMeshTasksCmd();
 
         void ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit);
         void ValidateThreadGroupLimit(std::uint32_t size, std::uint32_t limit);
@@ -152,16 +166,30 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateBindFlags(long resourceFlags, long bindFlags, long validFlags, const char* resourceName = nullptr);
         void ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags);
         void ValidateBindTextureFlags(DbgTexture& textureDbg, long bindFlags);
+        void ValidateResidency(bool evicted, const char* resourceName);
         void ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region);
+        void ValidateTextureLocation(DbgTexture& textureDbg, const TextureLocation& location, const Extent3D& extent, const char* locationName);
         void ValidateIndexType(const Format format);
+        void ValidateVertexBufferOffset(DbgBuffer& bufferDbg, std::uint64_t offset);
+        void ValidateResourceBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size, long bindFlags);
         void ValidateTextureBufferCopyStrides(DbgTexture& textureDbg, std::uint32_t rowStride, std::uint32_t layerStride, const Extent3D& extent);
 
         void ValidateStageFlags(long stageFlags, long validFlags);
         void ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size, const char* rangeName = nullptr);
         void ValidateAddressAlignment(std::uint64_t address, std::uint64_t alignment, const char* addressName);
 
+        void ValidateIndirectCountBuffers(
+            DbgBuffer&      argumentsBufferDbg,
+            std::uint64_t   argumentsOffset,
+            DbgBuffer&      countBufferDbg,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        );
+
         bool ValidateQueryIndex(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
         DbgQueryHeap::State* GetAndValidateQueryState(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
+        void ValidateQueryResolve(DbgQueryHeap& queryHeapDbg, std::uint32_t firstQuery, std::uint32_t numQueries, DbgBuffer& dstBufferDbg, std::uint64_t dstOffset);
         void ValidateRenderCondition(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
 
         void ValidateRenderTargetRange(DbgRenderTarget& renderTargetDbg, const Offset2D& offset, const Extent2D& extent);
@@ -175,6 +203,7 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateUniforms(const DbgPipelineLayout& pipelineLayoutDbg, std::uint32_t first, std::uint16_t dataSize);
 
         void ValidateDynamicStates();
+        void ValidateDynamicStateFlag(long dynamicState, const char* stateName);
         void ValidateBindingTable();
 
         DbgPipelineState* AssertAndGetGraphicsPSO();
@@ -192,6 +221,8 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertIndirectDrawingCountSupported();
+        void AssertMeshShadersSupported();
 
         void AssertNullPointer(const void* ptr, const char* name);
 
@@ -209,6 +240,12 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void SetAndValidateScissorRects(std::uint32_t numScissors, const Scissor* scissors);
 
+        // Returns the capture ID of the specified object.
+        std::uint32_t CaptureID(const void* obj);
+
+        // Records a command that cannot be replayed, so the replayer can report it.
+        void CaptureUnsupported(const char* name);
+
     private:
 
         /* ----- Common objects ----- */
@@ -223,6 +260,11 @@ class DbgCommandBuffer final : public CommandBuffer
 
         DbgQueryTimerPool           queryTimerPool_;
         bool                        perfProfilerEnabled_    = false;
+        bool                        validationEnabled_      = false;
+
+        DbgCapture*                 capture_                = nullptr;
+        CaptureStream               captureStream_;
+        bool                        captureEnabled_         = false;
 
         /* ----- Render states ----- */
 
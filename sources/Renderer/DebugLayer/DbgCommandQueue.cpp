@@ -8,8 +8,10 @@
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
+#include "Texture/DbgTexture.h"
 #include "../CheckedCast.h"
 #include <LLGL/RenderingDebugger.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -30,18 +32,35 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
 
-    if (debugger_)
+    if (debugger_ != nullptr && debugger_->GetValidation())
     {
         LLGL_DBG_SOURCE();
         commandBufferDbg.ValidateSubmit();
     }
 
+    const bool isTimeRecording = (debugger_ != nullptr && debugger_->GetTimeRecording());
+    const std::uint64_t submitTicksStart = (isTimeRecording ? Timer::Tick() : 0);
+
     instance.Submit(commandBufferDbg.instance);
+    commandBufferDbg.RecordCaptureSubmit();
 
     /* Merge frame profile values into rendering profiler */
     FrameProfile profile;
     commandBufferDbg.FlushProfile(profile);
 
+    if (isTimeRecording)
+    {
+        /* Record submission on the command queue timeline */
+        ProfileTimeRecord record;
+        {
+            record.annotation       = "Submit";
+            record.cpuTicksStart    = submitTicksStart;
+            record.cpuTicksEnd      = Timer::Tick();
+            record.commandBufferID  = 0;
+        }
+        profile.timeRecords.push_back(record);
+    }
+
     RenderingDebugger::MergeProfiles(profile_, profile);
     profile_.commandQueueRecord.commandBufferSubmittions++;
 }
@@ -52,7 +71,7 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
 {
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
 
-    if (debugger_)
+    if (debugger_ != nullptr && debugger_->GetValidation())
     {
         LLGL_DBG_SOURCE();
         ValidateQueryResult(queryHeapDbg, firstQuery, numQueries, data, dataSize);
@@ -61,6 +80,11 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
     return instance.QueryResult(queryHeapDbg.instance, firstQuery, numQueries, data, dataSize);
 }
 
+bool DbgCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    return instance.QueryTimestampCalibration(outCalibration);
+}
+
 /* ----- Fences ----- */
 
 void DbgCommandQueue::Submit(Fence& fence)
@@ -69,6 +93,11 @@ void DbgCommandQueue::Submit(Fence& fence)
     profile_.commandQueueRecord.fenceSubmissions++;
 }
 
+void DbgCommandQueue::SubmitWait(Fence& fence)
+{
+    instance.SubmitWait(fence);
+}
+
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     return instance.WaitFence(fence, timeout);
@@ -79,6 +108,21 @@ void DbgCommandQueue::WaitIdle()
     instance.WaitIdle();
 }
 
+/* ----- Sparse resources ----- */
+
+bool DbgCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_ != nullptr && debugger_->GetValidation())
+    {
+        LLGL_DBG_SOURCE();
+        ValidateTileMappings(textureDbg, numMappings, mappings);
+    }
+
+    return instance.UpdateTileMappings(textureDbg.instance, numMappings, mappings);
+}
+
 
 /*
  * ======= Private: =======
@@ -125,6 +169,79 @@ void DbgCommandQueue::ValidateQueryResult(
     }
 }
 
+// Returns true if the specified offset is aligned to the tile size and the end of the range is either aligned or reaches the edge of the MIP-map level.
+static bool IsTileRangeAligned(std::int32_t offset, std::uint32_t extent, std::uint32_t tileSize, std::uint32_t mipExtent)
+{
+    if (tileSize == 0 || offset < 0)
+        return false;
+    const std::uint32_t end = static_cast<std::uint32_t>(offset) + extent;
+    return (static_cast<std::uint32_t>(offset) % tileSize == 0 && (end % tileSize == 0 || end == mipExtent));
+}
+
+void DbgCommandQueue::ValidateTileMappings(
+    DbgTexture&                 texture,
+    std::uint32_t               numMappings,
+    const SparseTextureMapping* mappings)
+{
+    if ((texture.desc.miscFlags & MiscFlags::Sparse) == 0)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update tile mappings of texture that was not created with MiscFlags::Sparse");
+        return;
+    }
+
+    if (numMappings > 0 && mappings == nullptr)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update tile mappings with <mappings> parameter being a null pointer");
+        return;
+    }
+
+    SparseTextureProperties sparseProps;
+    const bool hasSparseProps = texture.instance.GetSparseProperties(sparseProps);
+
+    for_range(i, numMappings)
+    {
+        const TextureRegion&        region      = mappings[i].region;
+        const TextureSubresource&   subresource = region.subresource;
+
+        if (subresource.baseMipLevel >= texture.mipLevels)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "MIP-map level out of bounds in tile mapping [%u]: %u specified, but texture has only %u level(s)",
+                i, subresource.baseMipLevel, texture.mipLevels
+            );
+            continue;
+        }
+
+        if (texture.desc.type == TextureType::Texture2DArray &&
+            subresource.baseArrayLayer + subresource.numArrayLayers > texture.desc.arrayLayers)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "array layer range out of bounds in tile mapping [%u]: [%u, %u) specified, but texture has only %u layer(s)",
+                i, subresource.baseArrayLayer, (subresource.baseArrayLayer + subresource.numArrayLayers), texture.desc.arrayLayers
+            );
+        }
+
+        /* Regions in the MIP tail are always mapped as a whole, so their offset and extent are ignored */
+        if (hasSparseProps && subresource.baseMipLevel < sparseProps.numStandardMips)
+        {
+            const Extent3D mipExtent = texture.instance.GetMipExtent(subresource.baseMipLevel);
+            const bool is3DTexture = (texture.desc.type == TextureType::Texture3D);
+            if (!IsTileRangeAligned(region.offset.x, region.extent.x, sparseProps.tileSize.x, mipExtent.x) ||
+                !IsTileRangeAligned(region.offset.y, region.extent.y, sparseProps.tileSize.y, mipExtent.y) ||
+                (is3DTexture && !IsTileRangeAligned(region.offset.z, region.extent.z, sparseProps.tileSize.z, mipExtent.z)))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "region of tile mapping [%u] is not aligned to tile size (%u, %u, %u)",
+                    i, sparseProps.tileSize.x, sparseProps.tileSize.y, sparseProps.tileSize.z
+                );
+            }
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -18,6 +18,7 @@ namespace LLGL
 
 
 class DbgQueryHeap;
+class DbgTexture;
 
 class DbgCommandQueue final : public CommandQueue
 {
@@ -26,6 +27,14 @@ class DbgCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        bool QueryTimestampCalibration(TimestampCalibration& outCalibration) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings) override;
+
     public:
 
         DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
@@ -44,6 +53,12 @@ class DbgCommandQueue final : public CommandQueue
             std::size_t     dataSize
         );
 
+        void ValidateTileMappings(
+            DbgTexture&                     texture,
+            std::uint32_t                   numMappings,
+            const SparseTextureMapping*     mappings
+        );
+
     private:
 
         RenderingDebugger*  debugger_ = nullptr;
@@ -10,6 +10,7 @@
 #include <LLGL/RenderSystem.h>
 #include <LLGL/CommandQueue.h>
 #include <LLGL/QueryHeap.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
 #include <thread>
 
@@ -23,11 +24,13 @@ static constexpr std::uint32_t g_queryTimerHeapSize = 64;
 DbgQueryTimerPool::DbgQueryTimerPool(
     RenderSystem&   renderSystemInstance,
     CommandQueue&   commandQueueInstance,
-    CommandBuffer&  commandBufferInstance)
+    CommandBuffer&  commandBufferInstance,
+    std::uint32_t   commandBufferID)
 :
-    renderSystem_  { renderSystemInstance  },
-    commandQueue_  { commandQueueInstance  },
-    commandBuffer_ { commandBufferInstance }
+    renderSystem_    { renderSystemInstance  },
+    commandQueue_    { commandQueueInstance  },
+    commandBuffer_   { commandBufferInstance },
+    commandBufferID_ { commandBufferID       }
 {
 }
 
@@ -43,8 +46,10 @@ void DbgQueryTimerPool::Start(const char* annotation)
     /* Store annotation only first */
     ProfileTimeRecord record;
     {
-        record.annotation   = annotation;
-        record.elapsedTime  = 0;
+        record.annotation       = annotation;
+        record.elapsedTime      = 0;
+        record.cpuTicksStart    = Timer::Tick();
+        record.commandBufferID  = commandBufferID_;
     }
     records_.push_back(record);
 
@@ -74,6 +79,7 @@ void DbgQueryTimerPool::Stop()
 {
     /* Stop timer query */
     commandBuffer_.EndQuery(*queryHeaps_[currentQueryHeap_], currentQuery_);
+    records_.back().cpuTicksEnd = Timer::Tick();
 
     /* Increase query index */
     ++currentQuery_;
@@ -26,7 +26,8 @@ class DbgQueryTimerPool
         DbgQueryTimerPool(
             RenderSystem&   renderSystemInstance,
             CommandQueue&   commandQueueInstance,
-            CommandBuffer&  commandBufferInstance
+            CommandBuffer&  commandBufferInstance,
+            std::uint32_t   commandBufferID
         );
 
         // Resets all records in this timer manager.
@@ -51,6 +52,7 @@ class DbgQueryTimerPool
         RenderSystem&                       renderSystem_;
         CommandQueue&                       commandQueue_;
         CommandBuffer&                      commandBuffer_;
+        const std::uint32_t                 commandBufferID_    = 0;
 
         std::vector<QueryHeap*>             queryHeaps_;
         std::uint32_t                       currentQuery_       = 0;
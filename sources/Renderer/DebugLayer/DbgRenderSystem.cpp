@@ -12,12 +12,15 @@
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
 #include "../RenderTargetUtils.h"
+#include "../RenderPassUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/StringUtils.h"
 #include <LLGL/ImageFlags.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -42,15 +45,36 @@ DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger*
 {
     /* Initialize rendering capabilities from wrapped instance */
     UpdateRenderingCaps();
+
+    /* Open command stream capture if requested by the debugger */
+    if (debugger_ != nullptr && *debugger_->GetCaptureFilename() != '\0')
+    {
+        capture_ = MakeUnique<DbgCapture>(debugger_->GetCaptureFilename(), debugger_->GetCaptureFrames());
+        if (!capture_->IsRecording())
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "failed to open capture file: %s", debugger_->GetCaptureFilename());
+            capture_.reset();
+        }
+    }
 }
 
 void DbgRenderSystem::FlushProfile()
 {
     if (debugger_ != nullptr)
+    {
+        ValidateBufferCanaries();
         debugger_->RecordProfile(profile_);
+    }
     profile_ = {};
 }
 
+void DbgRenderSystem::OnPresent(DbgSwapChain& swapChainDbg)
+{
+    if (capture_)
+        capture_->RecordPresent(swapChainDbg);
+    FlushProfile();
+}
+
 /* ----- Swap-chain ----- */
 
 SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
@@ -66,11 +90,19 @@ SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChain
     }
 
     /* Flush frame profile on SwapChain::Present() calls */
-    return swapChains_.emplace<DbgSwapChain>(*swapChainInstance, swapChainDesc, std::bind(&DbgRenderSystem::FlushProfile, this));
+    auto* swapChainDbg = swapChains_.emplace<DbgSwapChain>(*swapChainInstance, swapChainDesc, std::bind(&DbgRenderSystem::OnPresent, this, std::placeholders::_1));
+
+    if (capture_)
+        capture_->RecordCreateSwapChain(*swapChainDbg, swapChainDesc);
+
+    return swapChainDbg;
 }
 
 void DbgRenderSystem::Release(SwapChain& swapChain)
 {
+    validatedGraphicsPSOs_.clear();
+    if (capture_)
+        capture_->RecordRelease(swapChain.GetRenderPass());
     ReleaseDbg(swapChains_, swapChain);
 }
 
@@ -81,6 +113,20 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* DbgRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    /* Only wrap dedicated queues; backends with a single command queue return the primary queue for all types */
+    CommandQueue* queueInstance = instance_->GetCommandQueue(type);
+    if (commandQueue_ && queueInstance == &(commandQueue_->instance))
+        return commandQueue_.get();
+
+    HWObjectInstance<DbgCommandQueue>& queueDbg = (type == CommandQueueType::Copy ? copyCommandQueue_ : computeCommandQueue_);
+    if (!queueDbg)
+        queueDbg = MakeUnique<DbgCommandQueue>(*queueInstance, profile_, debugger_);
+
+    return queueDbg.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -94,15 +140,17 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
         instanceCommandBufferDesc.renderPass            = (commandBufferDesc.renderPass != nullptr
                                                         ? &(LLGL_CAST(const DbgRenderPass*, commandBufferDesc.renderPass)->instance)
                                                         : nullptr);
+        instanceCommandBufferDesc.queueType             = commandBufferDesc.queueType;
     }
     return commandBuffers_.emplace<DbgCommandBuffer>(
         *instance_,
-        commandQueue_->instance,
+        *instance_->GetCommandQueue(commandBufferDesc.queueType),
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
         profile_,
         debugger_,
         commandBufferDesc,
-        GetRenderingCaps()
+        GetRenderingCaps(),
+        capture_.get()
     );
 }
 
@@ -113,6 +161,74 @@ void DbgRenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
+// Byte pattern of buffer canary zones; same as MSVC's debug heap "no man's land" pattern.
+static constexpr std::uint8_t g_bufferCanaryPattern = 0xFD;
+
+static void FillBufferCanary(char* data, std::uint64_t size)
+{
+    ::memset(data, g_bufferCanaryPattern, static_cast<std::size_t>(size));
+}
+
+// Returns the index of the first byte that does not match the canary pattern or 'size' if the canary is intact.
+static std::uint64_t FindBufferCanaryMismatch(const char* data, std::uint64_t size)
+{
+    for_range(i, size)
+    {
+        if (static_cast<std::uint8_t>(data[i]) != g_bufferCanaryPattern)
+            return i;
+    }
+    return size;
+}
+
+std::uint64_t DbgRenderSystem::GetBufferCanarySize(const BufferDescriptor& bufferDesc) const
+{
+    /* Only storage buffers can be written to by shaders */
+    if (debugger_ == nullptr || !debugger_->GetBufferOverrunDetection() || (bufferDesc.bindFlags & BindFlags::Storage) == 0)
+        return 0;
+
+    /* Keep canary size a multiple of the structure stride, so the padded buffer still holds whole elements */
+    constexpr std::uint64_t minCanarySize = 256;
+    const std::uint64_t stride = std::max<std::uint64_t>(1, (bufferDesc.stride > 0 ? bufferDesc.stride : GetFormatAttribs(bufferDesc.format).bitSize / 8));
+    return GetAlignedSize(minCanarySize, stride);
+}
+
+void DbgRenderSystem::ResetBufferCanary(DbgBuffer& bufferDbg)
+{
+    std::vector<char> canary(static_cast<std::size_t>(bufferDbg.canarySize));
+    FillBufferCanary(canary.data(), bufferDbg.canarySize);
+    instance_->WriteBuffer(bufferDbg.instance, bufferDbg.desc.size, canary.data(), bufferDbg.canarySize);
+}
+
+void DbgRenderSystem::ValidateBufferCanaries()
+{
+    std::vector<char> canary;
+
+    for (const auto& bufferDbg : buffers_)
+    {
+        if (bufferDbg->canarySize == 0)
+            continue;
+
+        /* Read back canary zone; this waits for the GPU to finish all writes into the buffer */
+        canary.resize(static_cast<std::size_t>(bufferDbg->canarySize));
+        instance_->ReadBuffer(bufferDbg->instance, bufferDbg->desc.size, canary.data(), bufferDbg->canarySize);
+
+        const std::uint64_t mismatch = FindBufferCanaryMismatch(canary.data(), bufferDbg->canarySize);
+        if (mismatch < bufferDbg->canarySize)
+        {
+            LLGL_DBG_SOURCE();
+            const std::string bufferLabel = (!bufferDbg->label.empty() ? " '" + bufferDbg->label + '\'' : "");
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "buffer overrun detected in buffer%s: shader wrote beyond buffer size of %" PRIu64 " byte(s) at offset %" PRIu64,
+                bufferLabel.c_str(), bufferDbg->desc.size, bufferDbg->desc.size + mismatch
+            );
+
+            /* Restore canary zone to detect subsequent overruns */
+            ResetBufferCanary(*bufferDbg);
+        }
+    }
+}
+
 Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     /* Validate and store format size (if supported) */
@@ -124,12 +240,47 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const
         ValidateBufferDesc(bufferDesc, &formatSize);
     }
 
+    /* Append canary zone to storage buffers to detect out-of-bounds writes from shaders */
+    const std::uint64_t canarySize = GetBufferCanarySize(bufferDesc);
+    if (canarySize > 0)
+    {
+        BufferDescriptor instanceDesc = bufferDesc;
+        instanceDesc.size += canarySize;
+
+        std::vector<char> instanceData;
+        if (initialData != nullptr)
+        {
+            instanceData.resize(static_cast<std::size_t>(instanceDesc.size));
+            ::memcpy(instanceData.data(), initialData, static_cast<std::size_t>(bufferDesc.size));
+            FillBufferCanary(instanceData.data() + bufferDesc.size, canarySize);
+        }
+
+        auto* bufferDbg = buffers_.emplace<DbgBuffer>(*instance_->CreateBuffer(instanceDesc, (initialData != nullptr ? instanceData.data() : nullptr)), bufferDesc);
+        {
+            bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
+            bufferDbg->initialized  = (initialData != nullptr);
+            bufferDbg->canarySize   = canarySize;
+        }
+
+        if (initialData == nullptr)
+            ResetBufferCanary(*bufferDbg);
+
+        if (capture_)
+            capture_->RecordCreateBuffer(*bufferDbg, bufferDesc, initialData);
+
+        return bufferDbg;
+    }
+
     /* Create buffer object */
     auto* bufferDbg = buffers_.emplace<DbgBuffer>(*instance_->CreateBuffer(bufferDesc, initialData), bufferDesc);
     {
         bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
         bufferDbg->initialized  = (initialData != nullptr);
     }
+
+    if (capture_)
+        capture_->RecordCreateBuffer(*bufferDbg, bufferDesc, initialData);
+
     return bufferDbg;
 }
 
@@ -150,7 +301,12 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
 
     /* Create native buffer and debug buffer */
     auto* bufferArrayInstance = instance_->CreateBufferArray(numBuffers, bufferInstanceArray.data());
-    return bufferArrays_.emplace<DbgBufferArray>(*bufferArrayInstance, GetCombinedBindFlags(numBuffers, bufferArray), std::move(bufferDbgArray));
+    auto* bufferArrayDbg = bufferArrays_.emplace<DbgBufferArray>(*bufferArrayInstance, GetCombinedBindFlags(numBuffers, bufferArray), std::move(bufferDbgArray));
+
+    if (capture_)
+        capture_->RecordCreateBufferArray(*bufferArrayDbg, numBuffers, bufferArray);
+
+    return bufferArrayDbg;
 }
 
 void DbgRenderSystem::Release(Buffer& buffer)
@@ -185,6 +341,9 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const vo
 
     instance_->WriteBuffer(bufferDbg.instance, offset, data, dataSize);
 
+    if (capture_)
+        capture_->RecordWriteBuffer(buffer, offset, data, dataSize);
+
     profile_.commandQueueRecord.bufferWrites++;
 }
 
@@ -223,7 +382,11 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     auto result = instance_->MapBuffer(bufferDbg.instance, access);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, 0, bufferDbg.desc.size);
+        if (capture_)
+            capture_->RecordMapBuffer(buffer, access, 0, bufferDbg.desc.size, result);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -245,7 +408,11 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::ui
     auto result = instance_->MapBuffer(bufferDbg.instance, access, offset, length);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, offset, length);
+        if (capture_)
+            capture_->RecordMapBuffer(buffer, access, offset, length, result);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -262,6 +429,10 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
         ValidateBufferMapping(bufferDbg, false);
     }
 
+    /* Record mapped content before the mapped memory becomes invalid */
+    if (capture_)
+        capture_->RecordUnmapBuffer(buffer);
+
     instance_->UnmapBuffer(bufferDbg.instance);
 
     bufferDbg.OnUnmap();
@@ -276,7 +447,12 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
         LLGL_DBG_SOURCE();
         ValidateTextureDesc(textureDesc, initialImage);
     }
-    return textures_.emplace<DbgTexture>(*instance_->CreateTexture(textureDesc, initialImage), textureDesc);
+    auto* textureDbg = textures_.emplace<DbgTexture>(*instance_->CreateTexture(textureDesc, initialImage), textureDesc);
+
+    if (capture_)
+        capture_->RecordCreateTexture(*textureDbg, textureDesc, initialImage);
+
+    return textureDbg;
 }
 
 void DbgRenderSystem::Release(Texture& texture)
@@ -297,6 +473,9 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
 
     instance_->WriteTexture(textureDbg.instance, textureRegion, srcImageView);
 
+    if (capture_)
+        capture_->RecordWriteTexture(texture, textureRegion, srcImageView);
+
     profile_.commandQueueRecord.textureWrites++;
 }
 
@@ -320,12 +499,19 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return instance_->CreateSampler(samplerDesc);
+    Sampler* sampler = instance_->CreateSampler(samplerDesc);
+
+    if (capture_)
+        capture_->RecordCreateSampler(*sampler, samplerDesc);
+
+    return sampler;
     //return samplers_.emplace<DbgSampler>();
 }
 
 void DbgRenderSystem::Release(Sampler& sampler)
 {
+    if (capture_)
+        capture_->RecordRelease(&sampler);
     instance_->Release(sampler);
     //ReleaseDbg(samplers_, sampler);
 }
@@ -401,10 +587,15 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
         auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, resourceHeapDesc.pipelineLayout);
         instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
     }
-    return resourceHeaps_.emplace<DbgResourceHeap>(
+    auto* resourceHeapDbg = resourceHeaps_.emplace<DbgResourceHeap>(
         *instance_->CreateResourceHeap(instanceDesc, instanceResourceViews),
         resourceHeapDesc
     );
+
+    if (capture_)
+        capture_->RecordCreateResourceHeap(*resourceHeapDbg, resourceHeapDesc, initialResourceViews);
+
+    return resourceHeapDbg;
 }
 
 void DbgRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -422,6 +613,9 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
         ValidateResourceHeapRange(resourceHeapDbg, firstDescriptor, resourceViews);
     }
 
+    if (capture_)
+        capture_->RecordWriteResourceHeap(resourceHeap, firstDescriptor, resourceViews);
+
     auto instanceResourceViews = GetResourceViewInstanceCopy(resourceViews);
     return instance_->WriteResourceHeap(resourceHeapDbg.instance, firstDescriptor, instanceResourceViews);
 }
@@ -430,7 +624,17 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
-    return renderPasses_.emplace<DbgRenderPass>(*instance_->CreateRenderPass(renderPassDesc), renderPassDesc);
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateRenderPassDesc(renderPassDesc);
+    }
+    auto* renderPassDbg = renderPasses_.emplace<DbgRenderPass>(*instance_->CreateRenderPass(renderPassDesc), renderPassDesc);
+
+    if (capture_)
+        capture_->RecordCreateRenderPass(*renderPassDbg, renderPassDesc);
+
+    return renderPassDbg;
 }
 
 void DbgRenderSystem::Release(RenderPass& renderPass)
@@ -439,6 +643,9 @@ void DbgRenderSystem::Release(RenderPass& renderPass)
     auto& renderPassDbg = LLGL_CAST(DbgRenderPass&, renderPass);
     if (RenderPass* instance = renderPassDbg.mutableInstance)
     {
+        validatedGraphicsPSOs_.clear();
+        if (capture_)
+            capture_->RecordRelease(&renderPass);
         instance_->Release(*instance);
         renderPasses_.erase(&renderPass);
     }
@@ -454,12 +661,20 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
     {
         instanceDesc.renderPass = DbgGetInstance<DbgRenderPass>(renderTargetDesc.renderPass);
 
-        auto TransferDbgAttachment = [this](AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment)
+        /* Number of views is 0 if the render target is not used with a multiview render pass */
+        std::uint32_t numViews = 0;
+        if (auto* renderPassDbg = LLGL_CAST(const DbgRenderPass*, renderTargetDesc.renderPass))
+        {
+            if (renderPassDbg->desc.viewMask != 0)
+                numViews = NumRenderPassViews(renderPassDbg->desc.viewMask);
+        }
+
+        auto TransferDbgAttachment = [this, numViews](AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment)
         {
             if (IsAttachmentEnabled(attachmentDesc))
             {
                 if (debugger_)
-                    ValidateAttachmentDesc(attachmentDesc, colorTarget, isResolveAttachment, isDepthStencilAttachment);
+                    ValidateAttachmentDesc(attachmentDesc, colorTarget, isResolveAttachment, isDepthStencilAttachment, numViews);
                 attachmentDesc.texture = DbgGetInstance<DbgTexture>(attachmentDesc.texture);
             }
         };
@@ -471,11 +686,19 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
         }
         TransferDbgAttachment(instanceDesc.depthStencilAttachment, 0, /*isResolveAttachment:*/ false, /*isDepthStencilAttachment:*/ true);
     }
-    return renderTargets_.emplace<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), renderTargetDesc);
+    auto* renderTargetDbg = renderTargets_.emplace<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), renderTargetDesc);
+
+    if (capture_)
+        capture_->RecordCreateRenderTarget(*renderTargetDbg, renderTargetDesc);
+
+    return renderTargetDbg;
 }
 
 void DbgRenderSystem::Release(RenderTarget& renderTarget)
 {
+    validatedGraphicsPSOs_.clear();
+    if (capture_)
+        capture_->RecordRelease(renderTarget.GetRenderPass());
     ReleaseDbg(renderTargets_, renderTarget);
 }
 
@@ -483,11 +706,17 @@ void DbgRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
-    return shaders_.emplace<DbgShader>(*instance_->CreateShader(shaderDesc), shaderDesc);
+    auto* shaderDbg = shaders_.emplace<DbgShader>(*instance_->CreateShader(shaderDesc), shaderDesc);
+
+    if (capture_)
+        capture_->RecordCreateShader(*shaderDbg, shaderDesc);
+
+    return shaderDbg;
 }
 
 void DbgRenderSystem::Release(Shader& shader)
 {
+    validatedGraphicsPSOs_.clear();
     ReleaseDbg(shaders_, shader);
 }
 
@@ -495,7 +724,12 @@ void DbgRenderSystem::Release(Shader& shader)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<DbgPipelineLayout>(*instance_->CreatePipelineLayout(pipelineLayoutDesc), pipelineLayoutDesc);
+    auto* pipelineLayoutDbg = pipelineLayouts_.emplace<DbgPipelineLayout>(*instance_->CreatePipelineLayout(pipelineLayoutDesc), pipelineLayoutDesc);
+
+    if (capture_)
+        capture_->RecordCreatePipelineLayout(*pipelineLayoutDbg, pipelineLayoutDesc);
+
+    return pipelineLayoutDbg;
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -517,11 +751,65 @@ void DbgRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
+template <typename T>
+static void AppendValidationKey(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Returns a binary key of all descriptor fields that are read by ValidateGraphicsPipelineDesc().
+static std::string GetGraphicsPipelineValidationKey(const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    std::string key;
+    AppendValidationKey(key, pipelineStateDesc.renderPass);
+    AppendValidationKey(key, pipelineStateDesc.vertexShader);
+    AppendValidationKey(key, pipelineStateDesc.tessControlShader);
+    AppendValidationKey(key, pipelineStateDesc.tessEvaluationShader);
+    AppendValidationKey(key, pipelineStateDesc.geometryShader);
+    AppendValidationKey(key, pipelineStateDesc.taskShader);
+    AppendValidationKey(key, pipelineStateDesc.meshShader);
+    AppendValidationKey(key, pipelineStateDesc.fragmentShader);
+    AppendValidationKey(key, pipelineStateDesc.indexFormat);
+    AppendValidationKey(key, pipelineStateDesc.rasterizer.conservativeRasterization);
+    AppendValidationKey(key, pipelineStateDesc.dynamicStates);
+    AppendValidationKey(key, pipelineStateDesc.blend.independentBlendEnabled);
+    AppendValidationKey(key, pipelineStateDesc.blend.logicOp);
+    for (const BlendTargetDescriptor& target : pipelineStateDesc.blend.targets)
+    {
+        AppendValidationKey(key, target.blendEnabled);
+        AppendValidationKey(key, target.srcColor);
+        AppendValidationKey(key, target.dstColor);
+        AppendValidationKey(key, target.srcAlpha);
+        AppendValidationKey(key, target.dstAlpha);
+        AppendValidationKey(key, target.colorMask);
+    }
+    if (!pipelineStateDesc.vertexStreams.empty())
+    {
+        AppendValidationKey(key, pipelineStateDesc.pipelineLayout);
+        for (const BindingSlot& slot : pipelineStateDesc.vertexStreams)
+        {
+            AppendValidationKey(key, slot.index);
+            AppendValidationKey(key, slot.set);
+        }
+    }
+    return key;
+}
+
+/*
+Returns true if an equivalent graphics PSO descriptor has already been validated, e.g. when PSO permutations are re-created.
+Validation errors are only reported once per message anyway, so re-validating an identical descriptor has no effect
+other than reflecting the fragment shader again.
+*/
+bool DbgRenderSystem::IsGraphicsPipelineDescValidated(const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    return !validatedGraphicsPSOs_.insert(GetGraphicsPipelineValidationKey(pipelineStateDesc)).second;
+}
+
 PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
     LLGL_DBG_SOURCE();
 
-    if (debugger_)
+    if (debugger_ && !IsGraphicsPipelineDescValidated(pipelineStateDesc))
         ValidateGraphicsPipelineDesc(pipelineStateDesc);
 
     GraphicsPipelineDescriptor instanceDesc = pipelineStateDesc;
@@ -534,9 +822,16 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescri
         instanceDesc.tessControlShader      = DbgGetInstance<DbgShader>(pipelineStateDesc.tessControlShader);
         instanceDesc.tessEvaluationShader   = DbgGetInstance<DbgShader>(pipelineStateDesc.tessEvaluationShader);
         instanceDesc.geometryShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.geometryShader);
+        instanceDesc.taskShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.taskShader);
+        instanceDesc.meshShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.meshShader);
         instanceDesc.fragmentShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.fragmentShader);
     }
-    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+
+    if (capture_)
+        capture_->RecordCreatePipelineState(*pipelineStateDbg, pipelineStateDesc);
+
+    return pipelineStateDbg;
 }
 
 PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
@@ -553,7 +848,12 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
 
         instanceDesc.computeShader = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
     }
-    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+
+    if (capture_)
+        capture_->RecordCreatePipelineState(*pipelineStateDbg, pipelineStateDesc);
+
+    return pipelineStateDbg;
 }
 
 void DbgRenderSystem::Release(PipelineState& pipelineState)
@@ -592,6 +892,69 @@ bool DbgRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
     return instance_->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+bool DbgRenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    return instance_->QueryMemoryInfo(outInfo);
+}
+
+bool DbgRenderSystem::StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    /* Stream through WriteBuffer while capturing, so the buffer content is recorded */
+    if (capture_)
+        return RenderSystem::StreamBufferFromFile(buffer, offset, fileRegion, fence);
+
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+
+        const std::uint64_t dataSize = (fileRegion.uncompressedSize != 0 ? fileRegion.uncompressedSize : fileRegion.size);
+        if (dataSize > 0)
+            bufferDbg.initialized = true;
+
+        ValidateBufferBoundary(bufferDbg.desc.size, offset, dataSize);
+
+        if (!fileRegion.filename)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'fileRegion.filename' parameter");
+        if (fileRegion.compression != FileStreamCompression::Uncompressed && !GetRenderingCaps().features.hasFileStreamDecompression)
+            LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "compressed file regions not supported; missing 'hasFileStreamDecompression' feature");
+    }
+
+    profile_.commandQueueRecord.bufferWrites++;
+
+    return instance_->StreamBufferFromFile(bufferDbg.instance, offset, fileRegion, fence);
+}
+
+bool DbgRenderSystem::StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    /* Stream through WriteTexture while capturing, so the texture content is recorded */
+    if (capture_)
+        return RenderSystem::StreamTextureFromFile(texture, textureRegion, fileRegion, fence);
+
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+
+        const FormatAttributes& formatAttribs = GetFormatAttribs(textureDbg.GetFormat());
+        const std::uint32_t dataSize = (fileRegion.uncompressedSize != 0 ? fileRegion.uncompressedSize : fileRegion.size);
+
+        ValidateTextureRegion(textureDbg, textureRegion);
+        ValidateImageDataSize(textureDbg, textureRegion, formatAttribs.format, formatAttribs.dataType, dataSize);
+
+        if (!fileRegion.filename)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'fileRegion.filename' parameter");
+        if (fileRegion.compression != FileStreamCompression::Uncompressed && !GetRenderingCaps().features.hasFileStreamDecompression)
+            LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "compressed file regions not supported; missing 'hasFileStreamDecompression' feature");
+    }
+
+    profile_.commandQueueRecord.textureWrites++;
+
+    return instance_->StreamTextureFromFile(textureDbg.instance, textureRegion, fileRegion, fence);
+}
+
 
 /*
  * ======= Private: =======
@@ -611,7 +974,8 @@ void DbgRenderSystem::ValidateBindFlags(long flags)
     constexpr long textureOnlyFlags =
     (
         BindFlags::ColorAttachment          |
-        BindFlags::DepthStencilAttachment
+        BindFlags::DepthStencilAttachment   |
+        BindFlags::InputAttachment
     );
 
     constexpr long validFlags =
@@ -653,6 +1017,13 @@ void DbgRenderSystem::ValidateBindFlags(long flags)
             "resources cannot have color attachment and depth-stencil attachment binding flags at the same time"
         );
     }
+    if ((flags & BindFlags::InputAttachment) != 0 && (flags & BindFlags::ColorAttachment) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot have input attachment binding flag without color attachment binding flag"
+        );
+    }
     if ((flags & BindFlags::ConstantBuffer) != 0 && (flags & cbufferExcludedFlags) != 0)
     {
         LLGL_DBG_ERROR(
@@ -720,6 +1091,10 @@ void DbgRenderSystem::ValidateCommandBufferDesc(const CommandBufferDescriptor& c
             LLGL_DBG_WARN(WarningType::ImproperArgument, "render pass is ignored for primary command buffers at creation time");
     }
 
+    /* Validate queue type */
+    if (commandBufferDesc.queueType != CommandQueueType::Graphics && (commandBufferDesc.flags & CommandBufferFlags::Secondary) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create secondary command buffer for compute or copy queue");
+
     /* Validate number of native buffers */
     if (commandBufferDesc.numNativeBuffers == 0)
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create command buffer with zero native buffers");
@@ -730,7 +1105,7 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std
     /* Validate flags */
     ValidateBindFlags(bufferDesc.bindFlags);
     ValidateCPUAccessFlags(bufferDesc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "buffer");
-    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData), "buffer");
+    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData | MiscFlags::DirectUpload | MiscFlags::Transient), "buffer");
 
     /* Validate (constant-) buffer size */
     if ((bufferDesc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -963,7 +1338,83 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
     ValidateTextureDescMipLevels(textureDesc);
     ValidateArrayTextureLayers(textureDesc.type, textureDesc.arrayLayers);
     ValidateBindFlags(textureDesc.bindFlags);
-    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::Transient | MiscFlags::Memoryless | MiscFlags::Sparse | MiscFlags::DedicatedMemory), "texture");
+
+    /* Check if memoryless texture is only used as attachment */
+    if ((textureDesc.miscFlags & MiscFlags::Memoryless) != 0)
+    {
+        constexpr long attachmentBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment);
+        if ((textureDesc.bindFlags & attachmentBindFlags) == 0 || (textureDesc.bindFlags & ~attachmentBindFlags) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create memoryless texture with binding flags other than 'LLGL::BindFlags::ColorAttachment' or 'LLGL::BindFlags::DepthStencilAttachment'"
+            );
+        }
+        if ((textureDesc.miscFlags & (MiscFlags::Transient | MiscFlags::GenerateMips)) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "'LLGL::MiscFlags::Memoryless' cannot be combined with 'LLGL::MiscFlags::Transient' or 'LLGL::MiscFlags::GenerateMips'"
+            );
+        }
+        if (initialImage != nullptr)
+        {
+            LLGL_DBG_WARN(
+                WarningType::ImproperArgument,
+                "initial image data is ignored for memoryless texture"
+            );
+        }
+    }
+
+    /* Check if transient texture can be aliased */
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        if ((textureDesc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) == 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create transient texture without attachment binding: 'LLGL::MiscFlags::Transient' specified but neither 'LLGL::BindFlags::ColorAttachment' nor 'LLGL::BindFlags::DepthStencilAttachment'"
+            );
+        }
+        if (initialImage != nullptr)
+        {
+            LLGL_DBG_WARN(
+                WarningType::ImproperArgument,
+                "initial image data of transient texture may be overwritten by other textures of aliasing group %u",
+                textureDesc.aliasingGroup
+            );
+        }
+    }
+
+    /* Check if sparse texture can be created without memory */
+    if ((textureDesc.miscFlags & MiscFlags::Sparse) != 0)
+    {
+        if (!features_.hasSparseTextures)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("sparse textures");
+        if (textureDesc.type != TextureType::Texture2D && textureDesc.type != TextureType::Texture2DArray && textureDesc.type != TextureType::Texture3D)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot create sparse texture of type %s; only 2D, 2D-array, and 3D textures are supported",
+                ToString(textureDesc.type)
+            );
+        }
+        if ((textureDesc.miscFlags & (MiscFlags::Transient | MiscFlags::Memoryless)) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "'LLGL::MiscFlags::Sparse' cannot be combined with 'LLGL::MiscFlags::Transient' or 'LLGL::MiscFlags::Memoryless'"
+            );
+        }
+        if (initialImage != nullptr)
+        {
+            LLGL_DBG_WARN(
+                WarningType::ImproperArgument,
+                "initial image data is ignored for sparse texture; tiles must be committed with 'LLGL::CommandQueue::UpdateTileMappings' first"
+            );
+        }
+    }
 
     /* Check if MIP-map generation is requested  */
     if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
@@ -1355,7 +1806,7 @@ void DbgRenderSystem::ValidateTextureViewType(const TextureType sharedTextureTyp
     }
 }
 
-void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment)
+void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment, std::uint32_t numViews)
 {
     if (Texture* texture = attachmentDesc.texture)
     {
@@ -1427,9 +1878,37 @@ void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachm
                 attachmentDesc.arrayLayer, textureDbg->desc.arrayLayers
             );
         }
+
+        /* Validate array layers for all views of a multiview render pass */
+        if (numViews > 0)
+        {
+            if (!IsArrayTexture(textureDbg->desc.type) && !IsCubeTexture(textureDbg->desc.type))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "cannot use texture of type LLGL::TextureType::%s for render-target attachment of multiview render pass; array or cube texture required",
+                    ToString(textureDbg->desc.type)
+                );
+            }
+            else if (attachmentDesc.arrayLayer + numViews > textureDbg->desc.arrayLayers)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "render-target attachment exceeded number of array layers for multiview render pass: %u views from layer %u specified but upper bound is %u",
+                    numViews, attachmentDesc.arrayLayer, textureDbg->desc.arrayLayers
+                );
+            }
+        }
     }
     else
     {
+        if (numViews > 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot have render-target attachment without texture for multiview render pass"
+            );
+        }
         if (attachmentDesc.format == Format::Undefined)
         {
             LLGL_DBG_ERROR(
@@ -1440,6 +1919,54 @@ void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachm
     }
 }
 
+void DbgRenderSystem::ValidateRenderPassDesc(const RenderPassDescriptor& renderPassDesc)
+{
+    const std::uint32_t numColorAttachments = NumEnabledColorAttachments(renderPassDesc);
+    const std::uint32_t enabledColorAttachmentMask = ((1u << numColorAttachments) - 1u);
+
+    for_range(i, renderPassDesc.subpasses.size())
+    {
+        const SubpassDescriptor& subpassDesc = renderPassDesc.subpasses[i];
+        if (subpassDesc.inputAttachmentMask != 0)
+        {
+            if (!features_.hasInputAttachments)
+                LLGL_DBG_ERROR_NOT_SUPPORTED("input attachments");
+            if ((subpassDesc.inputAttachmentMask & ~enabledColorAttachmentMask) != 0)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "input attachments of subpass [%u] (0x%08X) exceed enabled color attachments of render pass (%u)",
+                    static_cast<unsigned>(i), subpassDesc.inputAttachmentMask, numColorAttachments
+                );
+            }
+        }
+    }
+
+    if (renderPassDesc.viewMask != 0)
+    {
+        if (!features_.hasMultiview)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("multiview rendering");
+
+        const std::uint32_t numViews = NumRenderPassViews(renderPassDesc.viewMask);
+        if (numViews > limits_.maxMultiviewViews)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "view mask of render pass (0x%08X) exceeds limit of %u views",
+                renderPassDesc.viewMask, limits_.maxMultiviewViews
+            );
+        }
+        if (renderPassDesc.samples > 1)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot use multi-sampling with multiview render pass (%u samples specified)",
+                renderPassDesc.samples
+            );
+        }
+    }
+}
+
 void DbgRenderSystem::ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
     if (resourceHeapDesc.pipelineLayout != nullptr)
@@ -1657,6 +2184,50 @@ void DbgRenderSystem::ValidateInputAssemblyDescriptor(const GraphicsPipelineDesc
     }
 }
 
+void DbgRenderSystem::ValidateVertexStreams(const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    if (pipelineStateDesc.meshShader != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with vertex streams and mesh shader");
+
+    auto* pipelineLayoutDbg = LLGL_CAST(const DbgPipelineLayout*, pipelineStateDesc.pipelineLayout);
+    if (pipelineLayoutDbg == nullptr)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with vertex streams but no pipeline layout");
+        return;
+    }
+
+    auto IsVertexStreamBinding = [](const BindingDescriptor& binding, const BindingSlot& slot) -> bool
+    {
+        return
+        (
+            binding.type        == ResourceType::Buffer     &&
+            binding.slot.index  == slot.index               &&
+            binding.slot.set    == slot.set                 &&
+            (binding.bindFlags  & BindFlags::Storage)       != 0 &&
+            (binding.stageFlags & StageFlags::VertexStage)  != 0
+        );
+    };
+
+    const PipelineLayoutDescriptor& layoutDesc = pipelineLayoutDbg->desc;
+    for_range(i, pipelineStateDesc.vertexStreams.size())
+    {
+        const BindingSlot& slot = pipelineStateDesc.vertexStreams[i];
+        const bool hasBinding =
+        (
+            std::any_of(layoutDesc.bindings.begin(), layoutDesc.bindings.end(), [&](const BindingDescriptor& binding) { return IsVertexStreamBinding(binding, slot); }) ||
+            std::any_of(layoutDesc.heapBindings.begin(), layoutDesc.heapBindings.end(), [&](const BindingDescriptor& binding) { return IsVertexStreamBinding(binding, slot); })
+        );
+        if (!hasBinding)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "vertex stream [%zu] refers to slot %u (set %u), but pipeline layout has no storage buffer binding at that slot for the vertex stage",
+                i, slot.index, slot.set
+            );
+        }
+    }
+}
+
 void DbgRenderSystem::ValidateBlendDescriptor(const BlendDescriptor& blendDesc, bool hasFragmentShader, bool hasDualSourceBlend)
 {
     /* Validate proper use of logic pixel operations */
@@ -1753,18 +2324,55 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
     if (pipelineStateDesc.rasterizer.conservativeRasterization && !features_.hasConservativeRasterization)
         LLGL_DBG_ERROR_NOT_SUPPORTED("conservative rasterization");
 
+    /* Validate subpass index against render pass */
+    const DbgRenderPass* renderPassDbg = DbgGetWrapper<DbgRenderPass>(pipelineStateDesc.renderPass);
+    const std::uint32_t numSubpasses = (renderPassDbg != nullptr ? renderPassDbg->NumSubpasses() : 1u);
+    if (pipelineStateDesc.subpass >= numSubpasses)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "subpass index of graphics PSO (%u) out of range; render pass has %u subpass(es)",
+            pipelineStateDesc.subpass, numSubpasses
+        );
+    }
+
+    if (const long unsupportedDynamicStates = (pipelineStateDesc.dynamicStates & ~limits_.dynamicStates))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::UnsupportedFeature,
+            "dynamic pipeline states not supported by renderer (0x%08X); see LLGL::RenderingLimits::dynamicStates",
+            static_cast<unsigned>(unsupportedDynamicStates)
+        );
+    }
+
     /* Validate shader pipeline stages */
     bool hasSeparableShaders = false;
-    if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
+    if (DbgShader* meshShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.meshShader))
+    {
+        if (!features_.hasMeshShaders)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+        hasSeparableShaders = ((meshShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
+        if (pipelineStateDesc.vertexShader         != nullptr ||
+            pipelineStateDesc.tessControlShader    != nullptr ||
+            pipelineStateDesc.tessEvaluationShader != nullptr ||
+            pipelineStateDesc.geometryShader       != nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with mesh shader and vertex, tessellation, or geometry shaders");
+        }
+    }
+    else if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
         hasSeparableShaders = ((vertexShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
     else
-        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO without vertex shader");
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO without vertex or mesh shader");
 
     const bool hasFragmentShader = (pipelineStateDesc.fragmentShader != nullptr);
 
     if ((pipelineStateDesc.tessControlShader != nullptr) != (pipelineStateDesc.tessEvaluationShader != nullptr))
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with incomplete tessellation shader stages");
 
+    if (pipelineStateDesc.taskShader != nullptr && pipelineStateDesc.meshShader == nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with task shader but no mesh shader");
+
     struct ShaderTypePair
     {
         Shader*     shader;
@@ -1775,6 +2383,8 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
                                  ShaderTypePair{ pipelineStateDesc.tessControlShader,    ShaderType::TessControl    },
                                  ShaderTypePair{ pipelineStateDesc.tessEvaluationShader, ShaderType::TessEvaluation },
                                  ShaderTypePair{ pipelineStateDesc.geometryShader,       ShaderType::Geometry       },
+                                 ShaderTypePair{ pipelineStateDesc.taskShader,           ShaderType::Task           },
+                                 ShaderTypePair{ pipelineStateDesc.meshShader,           ShaderType::Mesh           },
                                  ShaderTypePair{ pipelineStateDesc.fragmentShader,       ShaderType::Fragment       } })
     {
         if (Shader* shader = pair.shader)
@@ -1814,6 +2424,8 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
         ValidateFragmentShaderOutput(*fragmentShaderDbg, pipelineStateDesc.renderPass, hasDualSourceBlend);
 
     ValidateInputAssemblyDescriptor(pipelineStateDesc);
+    if (!pipelineStateDesc.vertexStreams.empty())
+        ValidateVertexStreams(pipelineStateDesc);
     ValidateBlendDescriptor(pipelineStateDesc.blend, hasFragmentShader, hasDualSourceBlend);
 }
 
@@ -1944,8 +2556,9 @@ void DbgRenderSystem::ValidateFragmentShaderOutputWithRenderPass(DbgShader& frag
             );
         }
     }
-    else
+    else if (renderPass.NumSubpasses() == 1)
     {
+        /* Fragment shader outputs of individual subpasses may only cover a subset of all color attachments */
         if (numColorAttachments != numColorOutputAttribs)
         {
             LLGL_DBG_ERROR(
@@ -2018,6 +2631,8 @@ template <typename T, typename TBase>
 void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
+    if (capture_)
+        capture_->RecordRelease(&entry);
     instance_->Release(entryDbg.instance);
     cont.erase(&entry);
 }
@@ -2026,7 +2641,13 @@ void DbgRenderSystem::UpdateRenderingCaps()
 {
     /* Store meta data about render system */
     SetRendererInfo(instance_->GetRendererInfo());
-    SetRenderingCaps(instance_->GetRenderingCaps());
+
+    /* Debug layer objects and validation state are not thread-safe, so batch creation must fall back to the calling thread */
+    RenderingCapabilities caps = instance_->GetRenderingCaps();
+    caps.features.hasConcurrentPipelineStateCreation    = false;
+    caps.features.hasConcurrentShaderCreation           = false;
+    caps.features.hasConcurrentResourceCreation         = false;
+    SetRenderingCaps(caps);
 }
 
 
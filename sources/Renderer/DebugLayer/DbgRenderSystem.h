@@ -15,6 +15,7 @@
 #include "DbgSwapChain.h"
 #include "DbgCommandBuffer.h"
 #include "DbgCommandQueue.h"
+#include "DbgCapture.h"
 
 #include "Buffer/DbgBuffer.h"
 #include "Buffer/DbgBufferArray.h"
@@ -28,6 +29,9 @@
 #include "Texture/DbgRenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include <unordered_set>
+#include <string>
+#include <memory>
 
 
 namespace LLGL
@@ -42,10 +46,19 @@ class DbgRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
     public:
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
 
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
+        bool StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence = nullptr) override;
+        bool StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence = nullptr) override;
+
         void FlushProfile();
 
     private:
@@ -83,7 +96,8 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureViewType(const TextureType sharedTextureType, const TextureType textureViewType, const std::initializer_list<TextureType>& validTypes);
         void ValidateImageDataSize(const DbgTexture& textureDbg, const TextureRegion& textureRegion, ImageFormat imageFormat, DataType dataType, std::size_t dataSize);
 
-        void ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment);
+        void ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment, std::uint32_t numViews);
+        void ValidateRenderPassDesc(const RenderPassDescriptor& renderPassDesc);
 
         void ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
         void ValidateResourceHeapRange(const DbgResourceHeap& resourceHeapDbg, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
@@ -92,6 +106,7 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureForBinding(const DbgTexture& textureDbg, const BindingDescriptor& bindingDesc);
 
         void ValidateInputAssemblyDescriptor(const GraphicsPipelineDescriptor& pipelineStateDesc);
+        void ValidateVertexStreams(const GraphicsPipelineDescriptor& pipelineStateDesc);
         void ValidateBlendTargetDescriptor(const BlendTargetDescriptor& blendTargetDesc, std::size_t idx);
         void ValidateBlendDescriptor(const BlendDescriptor& blendDesc, bool hasFragmentShader, bool hasDualSourceBlend);
         void ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc);
@@ -111,8 +126,17 @@ class DbgRenderSystem final : public RenderSystem
 
         std::vector<ResourceViewDescriptor> GetResourceViewInstanceCopy(const ArrayView<ResourceViewDescriptor>& resourceViews);
 
+        bool IsGraphicsPipelineDescValidated(const GraphicsPipelineDescriptor& pipelineStateDesc);
+
+        std::uint64_t GetBufferCanarySize(const BufferDescriptor& bufferDesc) const;
+        void ResetBufferCanary(DbgBuffer& bufferDbg);
+        void ValidateBufferCanaries();
+
         void UpdateRenderingCaps();
 
+        // Flushes the frame profile and records the end of a frame for the command stream capture.
+        void OnPresent(DbgSwapChain& swapChainDbg);
+
     private:
 
         /* ----- Common objects ----- */
@@ -126,10 +150,14 @@ class DbgRenderSystem final : public RenderSystem
         const RenderingFeatures&                features_;
         const RenderingLimits&                  limits_;
 
+        std::unique_ptr<DbgCapture>             capture_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<DbgSwapChain>         swapChains_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectInstance<DbgCommandQueue>       computeCommandQueue_;
+        HWObjectInstance<DbgCommandQueue>       copyCommandQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
@@ -143,6 +171,11 @@ class DbgRenderSystem final : public RenderSystem
         //HWObjectContainer<DbgSampler>           samplers_;
         HWObjectContainer<DbgQueryHeap>         queryHeaps_;
 
+        /* ----- Validation cache ----- */
+
+        // Keys of graphics PSO descriptors that have already been validated. Cleared whenever a referenced object type is released.
+        std::unordered_set<std::string>         validatedGraphicsPSOs_;
+
 };
 
 
@@ -56,7 +56,15 @@ void DbgSwapChain::Present()
 {
     instance.Present();
     if (presentCallback_)
-        presentCallback_();
+        presentCallback_(*this);
+    NotifyFramebufferUsed();
+}
+
+void DbgSwapChain::PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    instance.PresentWithDamage(numDamageRects, damageRects);
+    if (presentCallback_)
+        presentCallback_(*this);
     NotifyFramebufferUsed();
 }
 
@@ -90,6 +98,16 @@ bool DbgSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return instance.SetVsyncInterval(vsyncInterval);
 }
 
+bool DbgSwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    return instance.WaitForNextFrame(timeout);
+}
+
+SurfaceTransform DbgSwapChain::GetSurfaceTransform() const
+{
+    return instance.GetSurfaceTransform();
+}
+
 const RenderPass* DbgSwapChain::GetRenderPass() const
 {
     return renderPass_.get();
@@ -100,6 +118,16 @@ bool DbgSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
     return instance.ResizeBuffers(resolution);
 }
 
+void DbgSwapChain::DetachSurfacePrimary()
+{
+    instance.DetachSurface();
+}
+
+bool DbgSwapChain::AttachSurfacePrimary(const Extent2D& /*resolution*/)
+{
+    return instance.AttachSurface();
+}
+
 void DbgSwapChain::NotifyNextRenderPass(RenderingDebugger* debugger, const RenderPass* renderPass)
 {
     if (!usedSinceRenderPass_ && debugger != nullptr)
@@ -28,13 +28,14 @@ class DbgSwapChain final : public SwapChain
 
     public:
 
-        using PresentCallback = std::function<void()>;
+        using PresentCallback = std::function<void(DbgSwapChain&)>;
 
     public:
 
         void SetDebugName(const char* name) override;
 
         void Present() override;
+        void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
 
         std::uint32_t GetCurrentSwapIndex() const override;
         std::uint32_t GetNumSwapBuffers() const override;
@@ -44,6 +45,8 @@ class DbgSwapChain final : public SwapChain
         Format GetDepthStencilFormat() const override;
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+        SurfaceTransform GetSurfaceTransform() const override;
 
         const RenderPass* GetRenderPass() const override;
 
@@ -66,6 +69,8 @@ class DbgSwapChain final : public SwapChain
     private:
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
+        void DetachSurfacePrimary() override;
+        bool AttachSurfacePrimary(const Extent2D& resolution) override;
 
     private:
 
@@ -9,6 +9,7 @@
 #include "../DbgCore.h"
 #include "../DbgSwapChain.h"
 #include "../../RenderPassUtils.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -19,6 +20,7 @@ DbgRenderPass::DbgRenderPass(RenderPass& instance, const RenderPassDescriptor& d
     instance        { instance             },
     mutableInstance { &instance            },
     desc            { desc                 },
+    subpasses       { desc.subpasses.begin(), desc.subpasses.end() },
     label           { LLGL_DBG_LABEL(desc) }
 {
 }
@@ -27,6 +29,7 @@ DbgRenderPass::DbgRenderPass(const RenderPass& instance, const RenderPassDescrip
     instance        { instance             },
     mutableInstance { nullptr              },
     desc            { desc                 },
+    subpasses       { desc.subpasses.begin(), desc.subpasses.end() },
     label           { LLGL_DBG_LABEL(desc) }
 {
 }
@@ -52,6 +55,11 @@ std::uint32_t DbgRenderPass::NumEnabledColorAttachments() const
     return LLGL::NumEnabledColorAttachments(desc);
 }
 
+std::uint32_t DbgRenderPass::NumSubpasses() const
+{
+    return std::max(1u, static_cast<std::uint32_t>(subpasses.size()));
+}
+
 bool DbgRenderPass::AnySwapChainAttachmentsLoaded(const DbgSwapChain& swapChain) const
 {
     const Format colorFormat = swapChain.GetColorFormat();
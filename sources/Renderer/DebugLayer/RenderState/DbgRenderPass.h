@@ -12,6 +12,7 @@
 #include <LLGL/RenderPass.h>
 #include <LLGL/RenderPassFlags.h>
 #include <string>
+#include <vector>
 
 
 namespace LLGL
@@ -34,15 +35,19 @@ class DbgRenderPass final : public RenderPass
 
         std::uint32_t NumEnabledColorAttachments() const;
 
+        // Returns the number of subpasses of this render pass. This is at least 1.
+        std::uint32_t NumSubpasses() const;
+
         // Returns true if any of the swap-chain attachments will be loaded with this render pass.
         bool AnySwapChainAttachmentsLoaded(const DbgSwapChain& swapChain) const;
 
     public:
 
-        const RenderPass&           instance;
-        RenderPass* const           mutableInstance;
-        const RenderPassDescriptor  desc;
-        std::string                 label;
+        const RenderPass&                       instance;
+        RenderPass* const                       mutableInstance;
+        const RenderPassDescriptor              desc;
+        const std::vector<SubpassDescriptor>    subpasses;  // Copy of desc.subpasses, since the array view does not outlive the descriptor.
+        std::string                             label;
 
 };
 
@@ -51,6 +51,37 @@ void DbgTexture::SetDebugName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+bool DbgTexture::SetResidencyPriority(ResidencyPriority priority)
+{
+    return instance.SetResidencyPriority(priority);
+}
+
+bool DbgTexture::Evict()
+{
+    if (!instance.Evict())
+        return false;
+    evicted = true;
+    return true;
+}
+
+bool DbgTexture::MakeResident()
+{
+    if (!instance.MakeResident())
+        return false;
+    evicted = false;
+    return true;
+}
+
+bool DbgTexture::GetSparseProperties(SparseTextureProperties& outProperties) const
+{
+    return instance.GetSparseProperties(outProperties);
+}
+
+bool DbgTexture::SetMinLOD(float minLOD)
+{
+    return instance.SetMinLOD(minLOD);
+}
+
 TextureDescriptor DbgTexture::GetDesc() const
 {
     return instance.GetDesc();
@@ -29,6 +29,14 @@ class DbgTexture final : public Texture
 
         void SetDebugName(const char* name) override;
 
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+        bool Evict() override;
+        bool MakeResident() override;
+
+        bool GetSparseProperties(SparseTextureProperties& outProperties) const override;
+
+        bool SetMinLOD(float minLOD) override;
+
     public:
 
         DbgTexture(Texture& instance, const TextureDescriptor& desc);
@@ -43,6 +51,7 @@ class DbgTexture final : public Texture
         std::uint32_t           mipLevels           = 1;        // Actual number of MIP-map levels.
         std::string             label;
         const bool              isTextureView       = false;
+        bool                    evicted             = false;
 
     private:
 
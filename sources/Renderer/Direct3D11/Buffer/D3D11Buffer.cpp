@@ -6,10 +6,12 @@
  */
 
 #include "D3D11Buffer.h"
+#include "D3D11StagingBufferPool.h"
 #include "../D3D11Types.h"
 #include "../D3D11ResourceFlags.h"
 #include "../D3D11ObjectUtils.h"
 #include "../../ResourceUtils.h"
+#include "../../BufferUtils.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
@@ -22,7 +24,7 @@ namespace LLGL
 // Returns true if the specified buffer descriptors requires an intermediate buffer for CPU-access.
 static bool NeedsIntermediateCpuAccessBuffer(const BufferDescriptor& desc)
 {
-    return (desc.cpuAccessFlags != 0);
+    return (desc.cpuAccessFlags != 0 && !IsReadbackBuffer(desc));
 }
 
 D3D11Buffer::D3D11Buffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData) :
@@ -65,6 +67,14 @@ BufferDescriptor D3D11Buffer::GetDesc() const
         if ((cpuAccessDesc.CPUAccessFlags & D3D11_CPU_ACCESS_WRITE) != 0)
             bufferDesc.cpuAccessFlags |= CPUAccessFlags::Write;
     }
+    else if (nativeDesc.Usage == D3D11_USAGE_STAGING)
+    {
+        /* Convert CPU access flags from native staging buffer */
+        if ((nativeDesc.CPUAccessFlags & D3D11_CPU_ACCESS_READ) != 0)
+            bufferDesc.cpuAccessFlags |= CPUAccessFlags::Read;
+        if ((nativeDesc.CPUAccessFlags & D3D11_CPU_ACCESS_WRITE) != 0)
+            bufferDesc.cpuAccessFlags |= CPUAccessFlags::Write;
+    }
 
     if (nativeDesc.Usage == D3D11_USAGE_DYNAMIC)
         bufferDesc.miscFlags |= MiscFlags::DynamicUsage;
@@ -80,7 +90,17 @@ void D3D11Buffer::WriteSubresource(ID3D11DeviceContext* context, const void* dat
     /* Discard previous content if the entire resource will be updated */
     const bool isWholeBufferUpdated = (offset == 0 && dataSize == GetSize());
 
-    if (GetDXUsage() == D3D11_USAGE_DYNAMIC)
+    if (GetDXUsage() == D3D11_USAGE_STAGING)
+    {
+        /* Write data directly into mapped staging buffer */
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        if (SUCCEEDED(context->Map(GetNative(), 0, D3D11_MAP_WRITE, 0, &mappedSubresource)))
+        {
+            ::memcpy(reinterpret_cast<char*>(mappedSubresource.pData) + offset, data, dataSize);
+            context->Unmap(GetNative(), 0);
+        }
+    }
+    else if (GetDXUsage() == D3D11_USAGE_DYNAMIC)
     {
         if (isWholeBufferUpdated)
         {
@@ -120,23 +140,26 @@ void D3D11Buffer::WriteSubresource(ID3D11DeviceContext* context, const void* dat
     }
 }
 
-void D3D11Buffer::ReadSubresource(ID3D11DeviceContext* context, void* data, UINT dataSize, UINT offset)
+void D3D11Buffer::ReadSubresource(ID3D11DeviceContext* context, void* data, UINT dataSize, UINT offset, D3D11StagingBufferPool& readbackPool)
 {
-    //NOTE:
-    //  At the moment, the internal CPU access buffer is always created with D3D11_USAGE_DEFAULT, so don't need to check for D3D11_USAGE_STAGING.
-    #if 0
-    if (cpuAccessBuffer_)
+    /* Validate parameters */
+    LLGL_ASSERT_RANGE(dataSize + offset, GetSize());
+
+    if (GetDXUsage() == D3D11_USAGE_STAGING)
     {
-        D3D11_BUFFER_DESC cpuAccessBufferDesc;
-        cpuAccessBuffer_->GetDesc(&cpuAccessBufferDesc);
-        if (cpuAccessBufferDesc.Usage == D3D11_USAGE_STAGING && (cpuAccessBufferDesc.CPUAccessFlags & D3D11_CPU_ACCESS_READ) != 0)
-            ReadFromStagingBuffer(context, cpuAccessBuffer_.Get(), offset, data, dataSize, offset);
-        else
-            ReadFromSubresourceCopyWithCpuAccess(context, data, dataSize, offset);
+        /* Read data directly from mapped staging buffer */
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        if (SUCCEEDED(context->Map(GetNative(), 0, D3D11_MAP_READ, 0, &mappedSubresource)))
+        {
+            ::memcpy(data, reinterpret_cast<const char*>(mappedSubresource.pData) + offset, dataSize);
+            context->Unmap(GetNative(), 0);
+        }
     }
     else
-    #endif
-        ReadFromSubresourceCopyWithCpuAccess(context, data, dataSize, offset);
+    {
+        /* Read data through a pooled staging buffer instead of creating a new one for each read */
+        readbackPool.Read(GetNative(), offset, data, dataSize);
+    }
 }
 
 static D3D11_MAP GetCPUAccessTypeForUsage(D3D11_USAGE usage, CPUAccess access)
@@ -243,6 +266,15 @@ void D3D11Buffer::CreateGpuBuffer(ID3D11Device* device, const BufferDescriptor&
         descD3D.StructureByteStride = desc.stride;
     }
 
+    if (IsReadbackBuffer(desc))
+    {
+        /* Readback buffers are native staging buffers, so copy commands write directly into CPU accessible memory */
+        descD3D.Usage               = D3D11_USAGE_STAGING;
+        descD3D.BindFlags           = 0;
+        descD3D.CPUAccessFlags      = DXGetCPUAccessFlags(desc.cpuAccessFlags);
+        descD3D.MiscFlags           = 0;
+    }
+
     if (initialData)
     {
         /* Create native D3D11 buffer with initial subresource data */
@@ -285,57 +317,6 @@ void D3D11Buffer::CreateCpuAccessBuffer(ID3D11Device* device, UINT cpuAccessFlag
     DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for CPU-access buffer");
 }
 
-void D3D11Buffer::ReadFromStagingBuffer(
-    ID3D11DeviceContext*    context,
-    ID3D11Buffer*           stagingBuffer,
-    UINT                    stagingBufferOffset,
-    void*                   data,
-    UINT                    dataSize,
-    UINT                    srcOffset)
-{
-    /* Copy memory range from GPU buffer to CPU-access buffer */
-    const D3D11_BOX srcRange{ srcOffset, 0, 0, srcOffset + dataSize, 1, 1 };
-    context->CopySubresourceRegion(stagingBuffer, 0, stagingBufferOffset, 0, 0, GetNative(), 0, &srcRange);
-
-    /* Map CPU-access buffer to read data */
-    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
-    if (SUCCEEDED(context->Map(stagingBuffer, 0, D3D11_MAP_READ, 0, &mappedSubresource)))
-    {
-        /* Copy mapped memory to output data */
-        const char* mappedSubresourceWithOffset = reinterpret_cast<const char*>(mappedSubresource.pData) + stagingBufferOffset;
-        ::memcpy(data, mappedSubresourceWithOffset, dataSize);
-        context->Unmap(stagingBuffer, 0);
-    }
-}
-
-void D3D11Buffer::ReadFromSubresourceCopyWithCpuAccess(
-    ID3D11DeviceContext*    context,
-    void*                   data,
-    UINT                    dataSize,
-    UINT                    srcOffset)
-{
-    /* Get device this D3D buffer was created with */
-    ComPtr<ID3D11Device> device;
-    GetNative()->GetDevice(device.GetAddressOf());
-
-    /* Create intermediate staging buffer */
-    D3D11_BUFFER_DESC stagingBufferDesc;
-    {
-        stagingBufferDesc.ByteWidth           = dataSize;
-        stagingBufferDesc.Usage               = D3D11_USAGE_STAGING;
-        stagingBufferDesc.BindFlags           = 0;
-        stagingBufferDesc.CPUAccessFlags      = D3D11_CPU_ACCESS_READ;
-        stagingBufferDesc.MiscFlags           = 0;
-        stagingBufferDesc.StructureByteStride = 0;
-    }
-    ComPtr<ID3D11Buffer> stagingBuffer;
-    HRESULT hr = device->CreateBuffer(&stagingBufferDesc, nullptr, stagingBuffer.GetAddressOf());
-    DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for intermediate staging buffer");
-
-    /* Read data from intermediate stating buffer with CPU access */
-    ReadFromStagingBuffer(context, stagingBuffer.Get(), 0, data, dataSize, srcOffset);
-}
-
 void D3D11Buffer::WriteWithStagingBuffer(
     ID3D11DeviceContext*    context,
     ID3D11Buffer*           stagingBuffer,
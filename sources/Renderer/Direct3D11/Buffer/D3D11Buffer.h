@@ -19,6 +19,8 @@ namespace LLGL
 {
 
 
+class D3D11StagingBufferPool;
+
 class D3D11Buffer : public Buffer
 {
 
@@ -33,7 +35,7 @@ class D3D11Buffer : public Buffer
         D3D11Buffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData = nullptr);
 
         void WriteSubresource(ID3D11DeviceContext* context, const void* data, UINT dataSize, UINT offset);
-        void ReadSubresource(ID3D11DeviceContext* context, void* data, UINT dataSize, UINT offset);
+        void ReadSubresource(ID3D11DeviceContext* context, void* data, UINT dataSize, UINT offset, D3D11StagingBufferPool& readbackPool);
 
         void* Map(ID3D11DeviceContext* context, const CPUAccess access, UINT offset, UINT length);
         void Unmap(ID3D11DeviceContext* context);
@@ -79,22 +81,6 @@ class D3D11Buffer : public Buffer
         void CreateGpuBuffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData);
         void CreateCpuAccessBuffer(ID3D11Device* device, UINT cpuAccessFlags, UINT stride);
 
-        void ReadFromStagingBuffer(
-            ID3D11DeviceContext*    context,
-            ID3D11Buffer*           stagingBuffer,
-            UINT                    stagingBufferOffset,
-            void*                   data,
-            UINT                    dataSize,
-            UINT                    srcOffset
-        );
-
-        void ReadFromSubresourceCopyWithCpuAccess(
-            ID3D11DeviceContext*    context,
-            void*                   data,
-            UINT                    dataSize,
-            UINT                    srcOffset
-        );
-
         void WriteWithStagingBuffer(
             ID3D11DeviceContext*    context,
             ID3D11Buffer*           stagingBuffer,
@@ -0,0 +1,92 @@
+/*
+ * D3D11ConstantRingBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D11ConstantRingBuffer.h"
+#include "../Direct3D11.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Constant buffer ranges must start at a multiple of 16 constants of 16 bytes each
+static constexpr UINT g_cbufferRangeAlignment = 16*16;
+
+D3D11ConstantRingBuffer::D3D11ConstantRingBuffer(ID3D11Device* device, UINT size) :
+    size_ { GetAlignedSize(size, g_cbufferRangeAlignment) }
+{
+    D3D11_BUFFER_DESC descD3D;
+    {
+        descD3D.ByteWidth           = size_;
+        descD3D.Usage               = D3D11_USAGE_DYNAMIC;
+        descD3D.BindFlags           = D3D11_BIND_CONSTANT_BUFFER;
+        descD3D.CPUAccessFlags      = D3D11_CPU_ACCESS_WRITE;
+        descD3D.MiscFlags           = 0;
+        descD3D.StructureByteStride = 0;
+    }
+    HRESULT hr = device->CreateBuffer(&descD3D, nullptr, native_.GetAddressOf());
+    DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for constant ring buffer");
+}
+
+void D3D11ConstantRingBuffer::Reset()
+{
+    /* Deferred contexts require the first map of a command list to discard the buffer */
+    offset_         = 0;
+    discardNext_    = true;
+}
+
+D3D11BufferRange D3D11ConstantRingBuffer::Write(ID3D11DeviceContext* context, const void* data, UINT dataSize)
+{
+    const UINT alignedSize = GetAlignedSize(dataSize, g_cbufferRangeAlignment);
+    LLGL_ASSERT(alignedSize <= size_, "constant buffer size (%u) exceeds constant ring buffer size (%u)", alignedSize, size_);
+
+    /* Wrap around and discard previous content when the end of the ring buffer is reached */
+    if (offset_ + alignedSize > size_)
+    {
+        offset_         = 0;
+        discardNext_    = true;
+    }
+
+    /* Only discard on the first write, all further writes go into unused ranges of the same buffer */
+    const D3D11_MAP mapType = (discardNext_ ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE);
+    discardNext_ = false;
+
+    D3D11BufferRange range = { native_.Get(), offset_, alignedSize };
+
+    D3D11_MAPPED_SUBRESOURCE subresource;
+    if (SUCCEEDED(context->Map(native_.Get(), 0, mapType, 0, &subresource)))
+    {
+        ::memcpy(reinterpret_cast<char*>(subresource.pData) + offset_, data, dataSize);
+        context->Unmap(native_.Get(), 0);
+    }
+
+    offset_ += alignedSize;
+
+    return range;
+}
+
+bool D3D11ConstantRingBuffer::IsSupported(ID3D11Device* device)
+{
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+    return (SUCCEEDED(hr) && options.ConstantBufferOffsetting != FALSE && options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
+    #else
+    return false;
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
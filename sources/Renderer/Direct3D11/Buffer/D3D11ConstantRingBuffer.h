@@ -0,0 +1,68 @@
+/*
+ * D3D11ConstantRingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_CONSTANT_RING_BUFFER_H
+#define LLGL_D3D11_CONSTANT_RING_BUFFER_H
+
+
+#include "D3D11StagingBufferPool.h"
+#include "../../DXCommon/ComPtr.h"
+#include <d3d11.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Single dynamic constant buffer that is sub-allocated in a ring with D3D11_MAP_WRITE_NO_OVERWRITE.
+The buffer is only mapped with D3D11_MAP_WRITE_DISCARD when it wraps around or after a reset.
+Requires Direct3D 11.1 to bind the sub-allocated ranges via *SetConstantBuffers1.
+*/
+class D3D11ConstantRingBuffer
+{
+
+    public:
+
+        D3D11ConstantRingBuffer(ID3D11Device* device, UINT size);
+
+        D3D11ConstantRingBuffer(const D3D11ConstantRingBuffer&) = delete;
+        D3D11ConstantRingBuffer& operator = (const D3D11ConstantRingBuffer&) = delete;
+
+        // Resets the writing offset. The next write will discard the previous buffer content.
+        void Reset();
+
+        // Writes the specified data into the next free range of the ring buffer. The range is aligned to 256 bytes, i.e. 16 constants.
+        D3D11BufferRange Write(ID3D11DeviceContext* context, const void* data, UINT dataSize);
+
+        // Returns the size (in bytes) of this ring buffer.
+        inline UINT GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns true if the specified device supports D3D11_MAP_WRITE_NO_OVERWRITE for dynamic constant buffers.
+        static bool IsSupported(ID3D11Device* device);
+
+    private:
+
+        ComPtr<ID3D11Buffer>    native_;
+        UINT                    size_           = 0;
+        UINT                    offset_         = 0;
+        bool                    discardNext_    = true;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "D3D11StagingBufferPool.h"
 #include "../../../Core/CoreUtils.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -74,6 +75,37 @@ D3D11BufferRange D3D11StagingBufferPool::Write(const void* data, UINT dataSize,
     return range;
 }
 
+UINT64 D3D11StagingBufferPool::GetTotalSize() const
+{
+    UINT64 totalSize = 0;
+    for (const D3D11StagingBuffer& chunk : chunks_)
+        totalSize += chunk.GetSize();
+    return totalSize;
+}
+
+void D3D11StagingBufferPool::Read(ID3D11Buffer* srcBuffer, UINT srcOffset, void* data, UINT dataSize)
+{
+    /* Find first chunk that is large enough or allocate a new one */
+    chunkIdx_ = 0;
+    while (chunkIdx_ < chunks_.size() && chunks_[chunkIdx_].GetSize() < dataSize)
+        ++chunkIdx_;
+    if (chunkIdx_ == chunks_.size())
+        AllocChunk(dataSize);
+
+    /* Copy memory range from GPU buffer into staging chunk */
+    ID3D11Buffer* chunk = chunks_[chunkIdx_].GetNative();
+    const D3D11_BOX srcRange{ srcOffset, 0, 0, srcOffset + dataSize, 1, 1 };
+    context_->CopySubresourceRegion(chunk, 0, 0, 0, 0, srcBuffer, 0, &srcRange);
+
+    /* Map staging chunk to read data */
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    if (SUCCEEDED(context_->Map(chunk, 0, D3D11_MAP_READ, 0, &mappedSubresource)))
+    {
+        ::memcpy(data, mappedSubresource.pData, dataSize);
+        context_->Unmap(chunk, 0);
+    }
+}
+
 
 /*
  * ======= Private: =======
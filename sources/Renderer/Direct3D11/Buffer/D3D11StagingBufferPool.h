@@ -43,9 +43,19 @@ class D3D11StagingBufferPool
         // Resets all chunks in the pool.
         void Reset();
 
+        // Returns the total size (in bytes) of all chunks in this pool.
+        UINT64 GetTotalSize() const;
+
         // Writes the specified data to the destination buffer using the staging pool.
         D3D11BufferRange Write(const void* data, UINT dataSize, UINT alignment = 0);
 
+        /*
+        Copies the specified range of the source buffer into a staging chunk and reads it back into the output data.
+        This blocks until the GPU has finished the copy, so the chunk can be reused immediately afterwards.
+        Only for pools with D3D11_USAGE_STAGING and D3D11_CPU_ACCESS_READ.
+        */
+        void Read(ID3D11Buffer* srcBuffer, UINT srcOffset, void* data, UINT dataSize);
+
     private:
 
         // Allocates a new chunk with the specified minimal size.
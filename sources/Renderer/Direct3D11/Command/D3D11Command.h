@@ -26,12 +26,15 @@ class D3D11PipelineState;
 
 struct D3D11CmdSetVertexBuffer
 {
-    D3D11Buffer* buffer;
+    D3D11Buffer*    buffer;
+    UINT            offset;
 };
 
 struct D3D11CmdSetVertexBufferArray
 {
-    D3D11BufferArray* bufferArray;
+    D3D11BufferArray*   bufferArray;
+    UINT                numOffsets;
+//  UINT                offsets[numOffsets];
 };
 
 struct D3D11CmdSetIndexBuffer
@@ -53,6 +56,14 @@ struct D3D11CmdSetResource
     Resource*       resource;
 };
 
+struct D3D11CmdSetBufferRange
+{
+    std::uint32_t   descriptor;
+    D3D11Buffer*    buffer;
+    UINT            offset;
+    UINT            size;
+};
+
 struct D3D11CmdSetPipelineState
 {
     D3D11PipelineState* pipelineState;
@@ -68,6 +79,11 @@ struct D3D11CmdSetStencilRef
     UINT stencilRef;
 };
 
+struct D3D11CmdSetPrimitiveTopology
+{
+    D3D11_PRIMITIVE_TOPOLOGY primitiveTopology;
+};
+
 struct D3D11CmdSetUniforms
 {
     std::uint32_t   first;
@@ -113,6 +129,12 @@ struct D3D11CmdDrawInstancedIndirect
     UINT            stride;
 };
 
+struct D3D11CmdDrawIndexedInstancedN
+{
+    UINT                            numDraws;
+//  DrawIndexedIndirectArguments    draws[numDraws];
+};
+
 //D3D11CmdDrawIndexedInstancedIndirect = D3D11CmdDrawInstancedIndirect
 
 struct D3D11CmdDispatch
@@ -0,0 +1,375 @@
+/*
+ * D3D11CommandAssembler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+#include "D3D11CommandAssembler.h"
+#include "D3D11Command.h"
+#include "D3D11CommandOpcode.h"
+#include "D3D11CommandContext.h"
+#include "D3D11SecondaryCommandBuffer.h"
+#include "../RenderState/D3D11StateManager.h"
+#include "../../../JIT/JITCompiler.h"
+
+
+namespace LLGL
+{
+
+
+/* Declare index of variadic argument of entry point for the command context */
+static const JITVarArg g_contextArg{ 0 };
+
+/*
+ * Command thunks: Each D3D11 command is assembled into a direct call to one of these functions.
+ * The command arguments are encoded as immediate values so the JIT program neither decodes opcodes nor reads the command buffer.
+ */
+
+static void D3D11SetVertexBuffer(D3D11CommandContext* context, D3D11Buffer* buffer, UINT offset)
+{
+    context->SetVertexBuffer(*buffer, offset);
+}
+
+static void D3D11SetVertexBufferArray(D3D11CommandContext* context, D3D11BufferArray* bufferArray, const UINT* offsets)
+{
+    context->SetVertexBufferArray(*bufferArray, offsets);
+}
+
+static void D3D11SetIndexBuffer(D3D11CommandContext* context, D3D11Buffer* buffer, DXGI_FORMAT format, UINT offset)
+{
+    context->SetIndexBuffer(*buffer, format, offset);
+}
+
+static void D3D11SetPipelineState(D3D11CommandContext* context, D3D11PipelineState* pipelineState)
+{
+    context->SetPipelineState(pipelineState);
+}
+
+static void D3D11SetResourceHeap(D3D11CommandContext* context, D3D11ResourceHeap* resourceHeap, std::uint32_t descriptorSet)
+{
+    context->SetResourceHeap(*resourceHeap, descriptorSet);
+}
+
+static void D3D11SetResource(D3D11CommandContext* context, std::uint32_t descriptor, Resource* resource)
+{
+    context->SetResource(descriptor, *resource);
+}
+
+static void D3D11SetBufferRange(D3D11CommandContext* context, std::uint32_t descriptor, D3D11Buffer* buffer, UINT offset, UINT size)
+{
+    context->SetBufferRange(descriptor, *buffer, offset, size);
+}
+
+static void D3D11SetBlendFactor(D3D11CommandContext* context, const FLOAT* color)
+{
+    context->GetStateManager().SetBlendFactor(color);
+}
+
+static void D3D11SetStencilRef(D3D11CommandContext* context, UINT stencilRef)
+{
+    context->GetStateManager().SetStencilRef(stencilRef);
+}
+
+static void D3D11SetPrimitiveTopology(D3D11CommandContext* context, D3D11_PRIMITIVE_TOPOLOGY primitiveTopology)
+{
+    context->GetStateManager().SetPrimitiveTopology(primitiveTopology);
+}
+
+static void D3D11SetUniforms(D3D11CommandContext* context, std::uint32_t first, const void* data, std::uint32_t dataSize)
+{
+    context->SetUniforms(first, data, static_cast<std::uint16_t>(dataSize));
+}
+
+static void D3D11Draw(D3D11CommandContext* context, UINT vertexCount, UINT startVertexLocation)
+{
+    context->Draw(vertexCount, startVertexLocation);
+}
+
+static void D3D11DrawIndexed(D3D11CommandContext* context, UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+{
+    context->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+}
+
+static void D3D11DrawInstanced(D3D11CommandContext* context, UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT startInstanceLocation)
+{
+    context->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+static void D3D11DrawIndexedInstanced(D3D11CommandContext* context, UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation)
+{
+    context->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+}
+
+static void D3D11DrawIndexedInstancedN(D3D11CommandContext* context, const DrawIndexedIndirectArguments* args, UINT numDraws)
+{
+    context->DrawIndexedInstancedN(args, numDraws);
+}
+
+static void D3D11DrawInstancedIndirect(D3D11CommandContext* context, ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs)
+{
+    context->DrawInstancedIndirect(bufferForArgs, alignedByteOffsetForArgs);
+}
+
+static void D3D11DrawInstancedIndirectN(D3D11CommandContext* context, ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs, UINT numCommands, UINT stride)
+{
+    context->DrawInstancedIndirectN(bufferForArgs, alignedByteOffsetForArgs, numCommands, stride);
+}
+
+static void D3D11DrawIndexedInstancedIndirect(D3D11CommandContext* context, ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs)
+{
+    context->DrawIndexedInstancedIndirect(bufferForArgs, alignedByteOffsetForArgs);
+}
+
+static void D3D11DrawIndexedInstancedIndirectN(D3D11CommandContext* context, ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs, UINT numCommands, UINT stride)
+{
+    context->DrawIndexedInstancedIndirectN(bufferForArgs, alignedByteOffsetForArgs, numCommands, stride);
+}
+
+static void D3D11Dispatch(D3D11CommandContext* context, UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ)
+{
+    context->Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+static void D3D11DispatchIndirect(D3D11CommandContext* context, ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs)
+{
+    context->DispatchIndirect(bufferForArgs, alignedByteOffsetForArgs);
+}
+
+static void D3D11SetVertexAndIndexBuffer(D3D11CommandContext* context, D3D11Buffer* vertexBuffer, UINT vertexOffset, D3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset)
+{
+    context->SetVertexBuffer(*vertexBuffer, vertexOffset);
+    context->SetIndexBuffer(*indexBuffer, format, offset);
+}
+
+static void D3D11SetUniformsDraw(D3D11CommandContext* context, const D3D11CmdSetUniforms* uniforms, UINT vertexCount, UINT startVertexLocation)
+{
+    context->SetUniforms(uniforms->first, uniforms + 1, uniforms->dataSize);
+    context->Draw(vertexCount, startVertexLocation);
+}
+
+static void D3D11SetUniformsDrawIndexed(D3D11CommandContext* context, const D3D11CmdSetUniforms* uniforms, UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+{
+    context->SetUniforms(uniforms->first, uniforms + 1, uniforms->dataSize);
+    context->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+}
+
+// Generates native CPU opcodes for the specified D3D11Opcode and returns the size (in bytes) of the command arguments; must match 'ExecuteD3D11Command'.
+static std::size_t AssembleD3D11Command(const D3D11Opcode opcode, const void* pc, JITCompiler& compiler)
+{
+    switch (opcode)
+    {
+        case D3D11OpcodeSetVertexBuffer:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
+            compiler.Call(D3D11SetVertexBuffer, g_contextArg, cmd->buffer, cmd->offset);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetVertexBufferArray:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetVertexBufferArray*>(pc);
+            compiler.Call(D3D11SetVertexBufferArray, g_contextArg, cmd->bufferArray, (cmd->numOffsets > 0 ? reinterpret_cast<const UINT*>(cmd + 1) : nullptr));
+            return (sizeof(*cmd) + sizeof(UINT)*cmd->numOffsets);
+        }
+        case D3D11OpcodeSetIndexBuffer:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetIndexBuffer*>(pc);
+            compiler.Call(D3D11SetIndexBuffer, g_contextArg, cmd->buffer, cmd->format, cmd->offset);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetPipelineState:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetPipelineState*>(pc);
+            compiler.Call(D3D11SetPipelineState, g_contextArg, cmd->pipelineState);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetResourceHeap:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetResourceHeap*>(pc);
+            compiler.Call(D3D11SetResourceHeap, g_contextArg, cmd->resourceHeap, cmd->descriptorSet);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetResource:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetResource*>(pc);
+            compiler.Call(D3D11SetResource, g_contextArg, cmd->descriptor, cmd->resource);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetBufferRange:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetBufferRange*>(pc);
+            compiler.Call(D3D11SetBufferRange, g_contextArg, cmd->descriptor, cmd->buffer, cmd->offset, cmd->size);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetBlendFactor:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetBlendFactor*>(pc);
+            compiler.Call(D3D11SetBlendFactor, g_contextArg, &(cmd->color[0]));
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetStencilRef:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetStencilRef*>(pc);
+            compiler.Call(D3D11SetStencilRef, g_contextArg, cmd->stencilRef);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetPrimitiveTopology:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetPrimitiveTopology*>(pc);
+            compiler.Call(D3D11SetPrimitiveTopology, g_contextArg, cmd->primitiveTopology);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetUniforms:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
+            compiler.Call(D3D11SetUniforms, g_contextArg, cmd->first, reinterpret_cast<const void*>(cmd + 1), static_cast<std::uint32_t>(cmd->dataSize));
+            return (sizeof(*cmd) + cmd->dataSize);
+        }
+        case D3D11OpcodeDraw:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDraw*>(pc);
+            compiler.Call(D3D11Draw, g_contextArg, cmd->vertexCount, cmd->startVertexLocation);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawIndexed:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawIndexed*>(pc);
+            compiler.Call(D3D11DrawIndexed, g_contextArg, cmd->indexCount, cmd->startIndexLocation, cmd->baseVertexLocation);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawInstanced:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawInstanced*>(pc);
+            compiler.Call(D3D11DrawInstanced, g_contextArg, cmd->vertexCountPerInstance, cmd->instanceCount, cmd->startVertexLocation, cmd->startInstanceLocation);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawIndexedInstanced:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawIndexedInstanced*>(pc);
+            compiler.Call(D3D11DrawIndexedInstanced, g_contextArg, cmd->indexCountPerInstance, cmd->instanceCount, cmd->startIndexLocation, cmd->baseVertexLocation, cmd->startInstanceLocation);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawIndexedInstancedN:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawIndexedInstancedN*>(pc);
+            compiler.Call(D3D11DrawIndexedInstancedN, g_contextArg, reinterpret_cast<const DrawIndexedIndirectArguments*>(cmd + 1), cmd->numDraws);
+            return (sizeof(*cmd) + sizeof(DrawIndexedIndirectArguments) * cmd->numDraws);
+        }
+        case D3D11OpcodeDrawInstancedIndirect:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawInstancedIndirect*>(pc);
+            compiler.Call(D3D11DrawInstancedIndirect, g_contextArg, cmd->bufferForArgs, cmd->alignedByteOffsetForArgs);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawInstancedIndirectN:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawInstancedIndirect*>(pc);
+            compiler.Call(D3D11DrawInstancedIndirectN, g_contextArg, cmd->bufferForArgs, cmd->alignedByteOffsetForArgs, cmd->numCommands, cmd->stride);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawIndexedInstancedIndirect:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawInstancedIndirect*>(pc);
+            compiler.Call(D3D11DrawIndexedInstancedIndirect, g_contextArg, cmd->bufferForArgs, cmd->alignedByteOffsetForArgs);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDrawIndexedInstancedIndirectN:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawInstancedIndirect*>(pc);
+            compiler.Call(D3D11DrawIndexedInstancedIndirectN, g_contextArg, cmd->bufferForArgs, cmd->alignedByteOffsetForArgs, cmd->numCommands, cmd->stride);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDispatch:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDispatch*>(pc);
+            compiler.Call(D3D11Dispatch, g_contextArg, cmd->threadGroupCountX, cmd->threadGroupCountY, cmd->threadGroupCountZ);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeDispatchIndirect:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDispatchIndirect*>(pc);
+            compiler.Call(D3D11DispatchIndirect, g_contextArg, cmd->bufferForArgs, cmd->alignedByteOffsetForArgs);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetVertexAndIndexBuffer:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdSetIndexBuffer*>(cmd0 + 1);
+            compiler.Call(D3D11SetVertexAndIndexBuffer, g_contextArg, cmd0->buffer, cmd0->offset, cmd1->buffer, cmd1->format, cmd1->offset);
+            return (sizeof(*cmd0) + sizeof(*cmd1));
+        }
+        case D3D11OpcodeDrawIndexedWithBuffers:
+        {
+            /* Native program has no dispatch overhead, so superinstructions can be split up again to avoid another thunk */
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdSetIndexBuffer*>(cmd0 + 1);
+            auto cmd2 = reinterpret_cast<const D3D11CmdDrawIndexed*>(cmd1 + 1);
+            compiler.Call(D3D11SetVertexAndIndexBuffer, g_contextArg, cmd0->buffer, cmd0->offset, cmd1->buffer, cmd1->format, cmd1->offset);
+            compiler.Call(D3D11DrawIndexed, g_contextArg, cmd2->indexCount, cmd2->startIndexLocation, cmd2->baseVertexLocation);
+            return (sizeof(*cmd0) + sizeof(*cmd1) + sizeof(*cmd2));
+        }
+        case D3D11OpcodeSetUniformsDraw:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdDraw*>(reinterpret_cast<const char*>(cmd0 + 1) + cmd0->dataSize);
+            compiler.Call(D3D11SetUniformsDraw, g_contextArg, cmd0, cmd1->vertexCount, cmd1->startVertexLocation);
+            return (sizeof(*cmd0) + cmd0->dataSize + sizeof(*cmd1));
+        }
+        case D3D11OpcodeSetUniformsDrawIndexed:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdDrawIndexed*>(reinterpret_cast<const char*>(cmd0 + 1) + cmd0->dataSize);
+            compiler.Call(D3D11SetUniformsDrawIndexed, g_contextArg, cmd0, cmd1->indexCount, cmd1->startIndexLocation, cmd1->baseVertexLocation);
+            return (sizeof(*cmd0) + cmd0->dataSize + sizeof(*cmd1));
+        }
+        default:
+            return 0;
+    }
+}
+
+std::unique_ptr<JITProgram> AssembleD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdBuffer)
+{
+    /* Try to create a JIT-compiler for the active architecture (if supported) */
+    if (auto compiler = JITCompiler::Create())
+    {
+        /* Declare variadic arguments for entry point of JIT program */
+        compiler->EntryPointVarArgs({ JIT::ArgType::Ptr });
+
+        /* Assemble D3D11 commands into JIT program */
+        compiler->Begin();
+
+        for (const auto& chunk : cmdBuffer.GetVirtualCommandBuffer())
+        {
+            auto pc     = chunk.data;
+            auto pcEnd  = chunk.data + chunk.size;
+
+            while (pc < pcEnd)
+            {
+                /* Read opcode */
+                const D3D11Opcode opcode = *reinterpret_cast<const D3D11Opcode*>(pc);
+                pc += sizeof(D3D11Opcode);
+
+                /* Assemble command and increment program counter */
+                pc += AssembleD3D11Command(opcode, pc, *compiler);
+            }
+        }
+
+        compiler->End();
+
+        /* Build final program; this is null if the program could not be encoded or executable memory is not available */
+        return compiler->FlushProgram();
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
+
+
+// ================================================================================
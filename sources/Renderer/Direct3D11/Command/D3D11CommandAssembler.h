@@ -0,0 +1,40 @@
+/*
+ * D3D11CommandAssembler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_COMMAND_ASSEMBLER_H
+#define LLGL_D3D11_COMMAND_ASSEMBLER_H
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class JITProgram;
+class D3D11SecondaryCommandBuffer;
+
+/*
+Generates a native program that executes all commands of the specified secondary command buffer as straight-line function calls.
+The entry point takes a pointer to the D3D11CommandContext as its only argument. Returns null if no program could be generated.
+*/
+std::unique_ptr<JITProgram> AssembleD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdBuffer);
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
+#endif
+
+
+
+// ================================================================================
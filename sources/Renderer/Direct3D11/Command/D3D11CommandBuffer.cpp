@@ -12,8 +12,9 @@ namespace LLGL
 {
 
 
-D3D11CommandBuffer::D3D11CommandBuffer(bool isSecondaryCmdBuffer) :
-    isSecondaryCmdBuffer_ { isSecondaryCmdBuffer }
+D3D11CommandBuffer::D3D11CommandBuffer(bool isSecondaryCmdBuffer, bool isVirtualCmdBuffer) :
+    isSecondaryCmdBuffer_ { isSecondaryCmdBuffer },
+    isVirtualCmdBuffer_   { isVirtualCmdBuffer   }
 {
 }
 
@@ -38,7 +38,7 @@ class D3D11CommandBuffer : public CommandBuffer
 
     public:
 
-        D3D11CommandBuffer(bool isSecondaryCmdBuffer);
+        D3D11CommandBuffer(bool isSecondaryCmdBuffer, bool isVirtualCmdBuffer);
 
     public:
 
@@ -48,9 +48,16 @@ class D3D11CommandBuffer : public CommandBuffer
             return isSecondaryCmdBuffer_;
         }
 
+        // Returns true if this command buffer records into a virtual command buffer (D3D11SecondaryCommandBuffer) instead of a device context.
+        inline bool IsVirtualCmdBuffer() const
+        {
+            return isVirtualCmdBuffer_;
+        }
+
     private:
 
-        const bool isSecondaryCmdBuffer_ = false;
+        const bool isSecondaryCmdBuffer_    = false;
+        const bool isVirtualCmdBuffer_      = false;
 
 };
 
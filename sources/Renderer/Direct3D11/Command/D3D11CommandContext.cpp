@@ -193,25 +193,25 @@ void D3D11CommandContext::ClearFramebufferViewsOrdered(
 
 /* ----- Input Assembly ------ */
 
-void D3D11CommandContext::SetVertexBuffer(D3D11Buffer& bufferD3D)
+void D3D11CommandContext::SetVertexBuffer(D3D11Buffer& bufferD3D, UINT offset)
 {
     bindingTable_->SetVertexBuffer(
         0,
         bufferD3D.GetNative(),
         bufferD3D.GetStride(),
-        0,
+        offset,
         bufferD3D.GetBindingLocator()
     );
 }
 
-void D3D11CommandContext::SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D)
+void D3D11CommandContext::SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D, const UINT* offsets)
 {
     bindingTable_->SetVertexBuffers(
         0,
         bufferArrayD3D.GetCount(),
         bufferArrayD3D.GetBuffers(),
         bufferArrayD3D.GetStrides(),
-        bufferArrayD3D.GetOffsets(),
+        (offsets != nullptr ? offsets : bufferArrayD3D.GetOffsets()),
         bufferArrayD3D.GetBindingLocators()
     );
 }
@@ -325,6 +325,35 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
     return S_OK;
 }
 
+HRESULT D3D11CommandContext::SetBufferRange(std::uint32_t descriptor, D3D11Buffer& bufferD3D, UINT offset, UINT size)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return E_POINTER;
+
+    const auto& bindingList = boundPipelineLayout_->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return E_INVALIDARG;
+
+    const D3D11PipelineResourceBinding& binding = bindingList[descriptor];
+
+    /* Buffer views cannot be moved after creation, so only constant buffers can be bound with a range */
+    if (binding.type != D3DResourceType_CBV)
+        return SetResource(descriptor, bufferD3D);
+
+    if (!(offset < bufferD3D.GetSize()))
+        return E_INVALIDARG;
+
+    /* Constant buffer ranges are specified in shader constants of 16 bytes, and the number of constants must be a multiple of 16 */
+    const UINT rangeSize = std::min(size, bufferD3D.GetSize() - offset);
+
+    ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
+    const UINT firstConstants[] = { offset / 16u };
+    const UINT numConstants[] = { GetAlignedSize<UINT>(DivideRoundUp<UINT>(rangeSize, 16u), 16u) };
+    stateMngr_->SetConstantBuffersRange(binding.slot, 1, cbv, firstConstants, numConstants, binding.stageFlags);
+
+    return S_OK;
+}
+
 /* ----- Pipeline States ----- */
 
 void D3D11CommandContext::SetPipelineState(D3D11PipelineState* pipelineStateD3D)
@@ -373,6 +402,13 @@ void D3D11CommandContext::DrawIndexedInstanced(UINT indexCountPerInstance, UINT
     context_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
 }
 
+void D3D11CommandContext::DrawIndexedInstancedN(const DrawIndexedIndirectArguments* args, UINT numDraws)
+{
+    FlushGraphicsResourceBindingCache();
+    for (const DrawIndexedIndirectArguments* argsEnd = args + numDraws; args != argsEnd; ++args)
+        context_->DrawIndexedInstanced(args->numIndices, args->numInstances, args->firstIndex, args->vertexOffset, args->firstInstance);
+}
+
 void D3D11CommandContext::DrawInstancedIndirect(ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs)
 {
     FlushGraphicsResourceBindingCache();
@@ -419,6 +455,16 @@ void D3D11CommandContext::DispatchIndirect(ID3D11Buffer* bufferForArgs, UINT ali
     context_->DispatchIndirect(bufferForArgs, alignedByteOffsetForArgs);
 }
 
+/* ----- Miscellaneous ----- */
+
+void D3D11CommandContext::DiscardResource(ID3D11Resource* resource)
+{
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    if (context1_.Get() != nullptr)
+        context1_->DiscardResource(resource);
+    #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+}
+
 
 /*
  * ======= Private: =======
@@ -495,13 +541,18 @@ void D3D11CommandContext::FlushGraphicsResourceBindingCache()
     if (boundConstantsCache_ != nullptr)
         boundConstantsCache_->Flush(*stateMngr_);
     if (bindingTable_ != nullptr)
+    {
+        bindingTable_->FlushShaderResourceViews(StageFlags::AllGraphicsStages);
         bindingTable_->FlushOutputMergerUAVs();
+    }
 }
 
 void D3D11CommandContext::FlushComputeResourceBindingCache()
 {
     if (boundConstantsCache_ != nullptr)
         boundConstantsCache_->Flush(*stateMngr_);
+    if (bindingTable_ != nullptr)
+        bindingTable_->FlushShaderResourceViews(StageFlags::ComputeStage);
 }
 
 
@@ -12,6 +12,7 @@
 #include "../Direct3D11.h"
 #include "../RenderState/D3D11StateManager.h"
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/IndirectArguments.h>
 
 
 namespace LLGL
@@ -57,13 +58,14 @@ class D3D11CommandContext
             UINT                depthStencilClearFlags
         );
 
-        void SetVertexBuffer(D3D11Buffer& bufferD3D);
-        void SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D);
+        void SetVertexBuffer(D3D11Buffer& bufferD3D, UINT offset = 0);
+        void SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D, const UINT* offsets = nullptr);
 
         void SetIndexBuffer(D3D11Buffer& bufferD3D, DXGI_FORMAT format, UINT offset);
 
         HRESULT SetResourceHeap(D3D11ResourceHeap& resourceHeapD3D, std::uint32_t descriptorSet);
         HRESULT SetResource(std::uint32_t descriptor, Resource& resource);
+        HRESULT SetBufferRange(std::uint32_t descriptor, D3D11Buffer& bufferD3D, UINT offset, UINT size);
 
         void SetPipelineState(D3D11PipelineState* pipelineStateD3D);
 
@@ -73,6 +75,7 @@ class D3D11CommandContext
         void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation);
         void DrawInstanced(UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT startInstanceLocation);
         void DrawIndexedInstanced(UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation);
+        void DrawIndexedInstancedN(const DrawIndexedIndirectArguments* args, UINT numDraws);
 
         void DrawInstancedIndirect(ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs);
         void DrawInstancedIndirectN(ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs, UINT numCommands, UINT stride);
@@ -83,6 +86,9 @@ class D3D11CommandContext
         void Dispatch(UINT numWorkGroupsX, UINT numWorkGroupsY, UINT numWorkGroupsZ);
         void DispatchIndirect(ID3D11Buffer* bufferForArgs, UINT alignedByteOffsetForArgs);
 
+        // Discards the contents of the specified resource. This has no effect if the Direct3D 11.1 context is not available.
+        void DiscardResource(ID3D11Resource* resource);
+
     public:
 
         // Returns the native D3D11 device context.
@@ -17,6 +17,10 @@
 #include <algorithm>
 #include <string.h>
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "../../../JIT/JITProgram.h"
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 
 namespace LLGL
 {
@@ -29,14 +33,14 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
         case D3D11OpcodeSetVertexBuffer:
         {
             auto cmd = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
-            context.SetVertexBuffer(*(cmd->buffer));
+            context.SetVertexBuffer(*(cmd->buffer), cmd->offset);
             return sizeof(*cmd);
         }
         case D3D11OpcodeSetVertexBufferArray:
         {
             auto cmd = reinterpret_cast<const D3D11CmdSetVertexBufferArray*>(pc);
-            context.SetVertexBufferArray(*(cmd->bufferArray));
-            return sizeof(*cmd);
+            context.SetVertexBufferArray(*(cmd->bufferArray), (cmd->numOffsets > 0 ? reinterpret_cast<const UINT*>(cmd + 1) : nullptr));
+            return (sizeof(*cmd) + sizeof(UINT)*cmd->numOffsets);
         }
         case D3D11OpcodeSetIndexBuffer:
         {
@@ -62,6 +66,12 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.SetResource(cmd->descriptor, *(cmd->resource));
             return sizeof(*cmd);
         }
+        case D3D11OpcodeSetBufferRange:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetBufferRange*>(pc);
+            context.SetBufferRange(cmd->descriptor, *(cmd->buffer), cmd->offset, cmd->size);
+            return sizeof(*cmd);
+        }
         case D3D11OpcodeSetBlendFactor:
         {
             auto cmd = reinterpret_cast<const D3D11CmdSetBlendFactor*>(pc);
@@ -74,6 +84,12 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.GetStateManager().SetStencilRef(cmd->stencilRef);
             return sizeof(*cmd);
         }
+        case D3D11OpcodeSetPrimitiveTopology:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdSetPrimitiveTopology*>(pc);
+            context.GetStateManager().SetPrimitiveTopology(cmd->primitiveTopology);
+            return sizeof(*cmd);
+        }
         case D3D11OpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
@@ -104,6 +120,12 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.DrawIndexedInstanced(cmd->indexCountPerInstance, cmd->instanceCount, cmd->startIndexLocation, cmd->baseVertexLocation, cmd->startInstanceLocation);
             return sizeof(*cmd);
         }
+        case D3D11OpcodeDrawIndexedInstancedN:
+        {
+            auto cmd = reinterpret_cast<const D3D11CmdDrawIndexedInstancedN*>(pc);
+            context.DrawIndexedInstancedN(reinterpret_cast<const DrawIndexedIndirectArguments*>(cmd + 1), cmd->numDraws);
+            return (sizeof(*cmd) + sizeof(DrawIndexedIndirectArguments) * cmd->numDraws);
+        }
         case D3D11OpcodeDrawInstancedIndirect:
         {
             auto cmd = reinterpret_cast<const D3D11CmdDrawInstancedIndirect*>(pc);
@@ -140,6 +162,40 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.DispatchIndirect(cmd->bufferForArgs, cmd->alignedByteOffsetForArgs);
             return sizeof(*cmd);
         }
+        case D3D11OpcodeSetVertexAndIndexBuffer:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdSetIndexBuffer*>(cmd0 + 1);
+            context.SetVertexBuffer(*(cmd0->buffer), cmd0->offset);
+            context.SetIndexBuffer(*(cmd1->buffer), cmd1->format, cmd1->offset);
+            return (sizeof(*cmd0) + sizeof(*cmd1));
+        }
+        case D3D11OpcodeDrawIndexedWithBuffers:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetVertexBuffer*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdSetIndexBuffer*>(cmd0 + 1);
+            auto cmd2 = reinterpret_cast<const D3D11CmdDrawIndexed*>(cmd1 + 1);
+            context.SetVertexBuffer(*(cmd0->buffer), cmd0->offset);
+            context.SetIndexBuffer(*(cmd1->buffer), cmd1->format, cmd1->offset);
+            context.DrawIndexed(cmd2->indexCount, cmd2->startIndexLocation, cmd2->baseVertexLocation);
+            return (sizeof(*cmd0) + sizeof(*cmd1) + sizeof(*cmd2));
+        }
+        case D3D11OpcodeSetUniformsDraw:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdDraw*>(reinterpret_cast<const char*>(cmd0 + 1) + cmd0->dataSize);
+            context.SetUniforms(cmd0->first, cmd0 + 1, cmd0->dataSize);
+            context.Draw(cmd1->vertexCount, cmd1->startVertexLocation);
+            return (sizeof(*cmd0) + cmd0->dataSize + sizeof(*cmd1));
+        }
+        case D3D11OpcodeSetUniformsDrawIndexed:
+        {
+            auto cmd0 = reinterpret_cast<const D3D11CmdSetUniforms*>(pc);
+            auto cmd1 = reinterpret_cast<const D3D11CmdDrawIndexed*>(reinterpret_cast<const char*>(cmd0 + 1) + cmd0->dataSize);
+            context.SetUniforms(cmd0->first, cmd0 + 1, cmd0->dataSize);
+            context.DrawIndexed(cmd1->indexCount, cmd1->startIndexLocation, cmd1->baseVertexLocation);
+            return (sizeof(*cmd0) + cmd0->dataSize + sizeof(*cmd1));
+        }
         default:
             return 0;
     }
@@ -165,16 +221,37 @@ static void ExecuteD3D11CommandsEmulated(const D3D11VirtualCommandBuffer& virtua
     }
 }
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+static void ExecuteD3D11CommandsNatively(const JITProgram& exec, D3D11CommandContext& context)
+{
+    /* Execute native program and pass pointer to command context; entry point must not be called as variadic function on ARM64 */
+    auto entryPoint = reinterpret_cast<void(*)(D3D11CommandContext*)>(exec.GetEntryPoint());
+    entryPoint(&context);
+}
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 void ExecuteD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdBuffer, D3D11CommandContext& context)
 {
-    /* Emulate execution of GL commands */
-    ExecuteD3D11CommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), context);
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+    if (auto exec = cmdBuffer.GetExecutable().get())
+    {
+        /* Execute D3D11 commands with native executable */
+        ExecuteD3D11CommandsNatively(*exec, context);
+    }
+    else
+    #endif // /LLGL_ENABLE_JIT_COMPILER
+    {
+        /* Emulate execution of D3D11 commands */
+        ExecuteD3D11CommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), context);
+    }
 }
 
 void ExecuteD3D11CommandBuffer(const D3D11CommandBuffer& cmdBuffer, D3D11CommandContext& context)
 {
-    /* Is this a secondary command buffer? */
-    if (cmdBuffer.IsSecondaryCmdBuffer())
+    /* Is this a virtual secondary command buffer? */
+    if (cmdBuffer.IsVirtualCmdBuffer())
     {
         /* Execute secondary command buffer */
         auto& secondaryCmdBufferD3D = LLGL_CAST(const D3D11SecondaryCommandBuffer&, cmdBuffer);
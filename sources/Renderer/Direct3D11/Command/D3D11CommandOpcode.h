@@ -24,19 +24,28 @@ enum D3D11Opcode : std::uint8_t
     D3D11OpcodeSetPipelineState,
     D3D11OpcodeSetResourceHeap,
     D3D11OpcodeSetResource,
+    D3D11OpcodeSetBufferRange,
     D3D11OpcodeSetBlendFactor,
     D3D11OpcodeSetStencilRef,
+    D3D11OpcodeSetPrimitiveTopology,
     D3D11OpcodeSetUniforms,
     D3D11OpcodeDraw,
     D3D11OpcodeDrawIndexed,
     D3D11OpcodeDrawInstanced,
     D3D11OpcodeDrawIndexedInstanced,
+    D3D11OpcodeDrawIndexedInstancedN,
     D3D11OpcodeDrawInstancedIndirect,
     D3D11OpcodeDrawInstancedIndirectN,
     D3D11OpcodeDrawIndexedInstancedIndirect,
     D3D11OpcodeDrawIndexedInstancedIndirectN,
     D3D11OpcodeDispatch,
     D3D11OpcodeDispatchIndirect,
+
+    /* Superinstructions that are fused from a sequence of commands during encoding */
+    D3D11OpcodeSetVertexAndIndexBuffer,     // D3D11CmdSetVertexBuffer + D3D11CmdSetIndexBuffer
+    D3D11OpcodeDrawIndexedWithBuffers,      // D3D11CmdSetVertexBuffer + D3D11CmdSetIndexBuffer + D3D11CmdDrawIndexed
+    D3D11OpcodeSetUniformsDraw,             // D3D11CmdSetUniforms + data + D3D11CmdDraw
+    D3D11OpcodeSetUniformsDrawIndexed,      // D3D11CmdSetUniforms + data + D3D11CmdDrawIndexed
 };
 
 
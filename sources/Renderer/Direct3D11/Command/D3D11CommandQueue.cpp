@@ -10,6 +10,7 @@
 #include "../RenderState/D3D11Fence.h"
 #include "../RenderState/D3D11QueryHeap.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -27,6 +28,8 @@ D3D11CommandQueue::D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceCo
 
 void D3D11CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_CPU_PROFILE_SCOPE("CommandQueue::Submit");
+
     auto& cmdBufferD3D = LLGL_CAST(D3D11CommandBuffer&, commandBuffer);
     if (!cmdBufferD3D.IsSecondaryCmdBuffer())
     {
@@ -102,38 +105,8 @@ bool D3D11CommandQueue::QueryResultSingleUInt64(
         /* Query result from special case query type: TimeElapsed */
         case D3D11_QUERY_TIMESTAMP_DISJOINT:
         {
-            query *= queryHeapD3D.GetGroupSize();
-
-            UINT64 startTime = 0;
-            if (context_->GetData(queryHeapD3D.GetNative(query + 1), &startTime, sizeof(startTime), 0) == S_OK)
-            {
-                UINT64 endTime = 0;
-                if (context_->GetData(queryHeapD3D.GetNative(query + 2), &endTime, sizeof(endTime), 0) == S_OK)
-                {
-                    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-                    if (context_->GetData(queryHeapD3D.GetNative(query), &disjointData, sizeof(disjointData), 0) == S_OK)
-                    {
-                        if (disjointData.Disjoint == FALSE)
-                        {
-                            /* Normalize elapsed time to nanoseconds */
-                            static const UINT64 nanosecondFrequency = 1000000000;
-
-                            const auto deltaTime = (endTime - startTime);
-                            if (disjointData.Frequency != nanosecondFrequency)
-                            {
-                                const auto scale        = (static_cast<double>(nanosecondFrequency) / static_cast<double>(disjointData.Frequency));
-                                const auto elapsedTime  = (static_cast<double>(deltaTime) * scale);
-                                data = static_cast<std::uint64_t>(elapsedTime + 0.5);
-                            }
-                            else
-                                data = deltaTime;
-                        }
-                        else
-                            data = 0;
-                        return true;
-                    }
-                }
-            }
+            if (queryHeapD3D.QueryTimerResult(context_.Get(), query, data))
+                return true;
         }
         break;
 
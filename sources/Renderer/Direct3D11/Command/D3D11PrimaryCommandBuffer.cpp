@@ -14,14 +14,18 @@
 #include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
 #include "../../ResourceUtils.h"
+#include "../../BufferUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Container/SmallVector.h>
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include "../../TextureUtils.h"
 #include <algorithm>
+#include <climits>
 
 #include "../RenderState/D3D11StateManager.h"
 #include "../RenderState/D3D11PipelineState.h"
@@ -54,10 +58,11 @@ D3D11PrimaryCommandBuffer::D3D11PrimaryCommandBuffer(
     const std::shared_ptr<D3D11StateManager>&   stateMngr,
     const CommandBufferDescriptor&              desc)
 :
-    D3D11CommandBuffer  { /*isSecondaryCmdBuffer:*/ false                           },
-    device_             { device                                                    },
-    context_            { context, stateMngr                                        },
-    hasDeferredContext_ { ((desc.flags & CommandBufferFlags::ImmediateSubmit) == 0) }
+    D3D11CommandBuffer  { /*isSecondaryCmdBuffer:*/ ((desc.flags & CommandBufferFlags::Secondary) != 0), /*isVirtualCmdBuffer:*/ false },
+    device_                 { device                                                    },
+    context_                { context, stateMngr                                        },
+    hasDeferredContext_     { ((desc.flags & CommandBufferFlags::ImmediateSubmit) == 0) },
+    timestampDisjointPool_  { device                                                    }
 {
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
     context->QueryInterface(IID_PPV_ARGS(&annotation_));
@@ -68,23 +73,40 @@ D3D11PrimaryCommandBuffer::D3D11PrimaryCommandBuffer(
 
 void D3D11PrimaryCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     GetStateManager().ResetStagingBufferPools();
 }
 
 void D3D11PrimaryCommandBuffer::End()
 {
+    EndTimestampDisjoint();
+
     if (hasDeferredContext_)
     {
         /* Encode commands from deferred context into command list */
         GetNative()->FinishCommandList(TRUE, commandList_.ReleaseAndGetAddressOf());
     }
     context_.ResetBindingStates();
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void D3D11PrimaryCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     auto& cmdBufferD3D = LLGL_CAST(D3D11CommandBuffer&, secondaryCommandBuffer);
-    ExecuteD3D11CommandBuffer(cmdBufferD3D, context_);
+    if (cmdBufferD3D.IsVirtualCmdBuffer())
+    {
+        /* Translate virtual commands on this context */
+        ExecuteD3D11CommandBuffer(cmdBufferD3D, context_);
+    }
+    else
+    {
+        /* Execute native command list and restore the previous context state, so the state manager of this command buffer remains valid */
+        auto& nativeCmdBufferD3D = LLGL_CAST(D3D11PrimaryCommandBuffer&, secondaryCommandBuffer);
+        if (ID3D11CommandList* commandList = nativeCmdBufferD3D.GetDeferredCommandList())
+            GetNative()->ExecuteCommandList(commandList, TRUE);
+    }
 }
 
 /* ----- Blitting ----- */
@@ -127,6 +149,17 @@ void D3D11PrimaryCommandBuffer::CopyBuffer(
     );
 }
 
+void D3D11PrimaryCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    /* D3D11 tracks resource hazards internally, so there are no barriers to batch across regions */
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 // private
 void D3D11PrimaryCommandBuffer::ClearWithIntermediateUAV(ID3D11Buffer* buffer, UINT offset, UINT size, const UINT (&valuesVec4)[4])
 {
@@ -448,6 +481,106 @@ void D3D11PrimaryCommandBuffer::FillBuffer(
     }
 }
 
+void D3D11PrimaryCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(dstBufferD3D.GetSize(), dstOffset, clearSize);
+
+    /* Use native fill operation if the element is a repeated 32-bit pattern, otherwise write the element repeatedly */
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+        FillBuffer(dstBuffer, dstOffset, pattern, clearSize);
+    else
+        ClearBufferWithElement(*this, dstBuffer, dstOffset, clearSize, element, elementSize);
+}
+
+void D3D11PrimaryCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+
+    const Format            format          = textureD3D.GetFormat();
+    const FormatAttributes& formatAttribs   = GetFormatAttribs(format);
+    const long              bindFlags       = textureD3D.GetBindFlags();
+    const bool              isTexture3D     = (textureD3D.GetType() == TextureType::Texture3D);
+
+    for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+    {
+        /* Array layers are ignored for 3D textures, so select all depth slices of the current MIP-map instead */
+        const UINT baseLayer = (isTexture3D ? 0u : subresource.baseArrayLayer);
+        const UINT numLayers = (isTexture3D ? textureD3D.GetMipExtent(mipLevel).z : subresource.numArrayLayers);
+
+        if ((bindFlags & BindFlags::DepthStencilAttachment) != 0)
+        {
+            ComPtr<ID3D11DepthStencilView> dsv;
+            D3D11RenderTarget::CreateSubresourceDSV(
+                device_, textureD3D.GetNative(), dsv.GetAddressOf(), textureD3D.GetType(), textureD3D.GetBaseDXFormat(), mipLevel, baseLayer, numLayers
+            );
+            const UINT clearFlags = (IsStencilFormat(format) ? D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL : D3D11_CLEAR_DEPTH);
+            GetNative()->ClearDepthStencilView(dsv.Get(), clearFlags, clearValue.depth, static_cast<UINT8>(clearValue.stencil & 0xFF));
+        }
+        else if ((bindFlags & BindFlags::ColorAttachment) != 0)
+        {
+            ComPtr<ID3D11RenderTargetView> rtv;
+            D3D11RenderTarget::CreateSubresourceRTV(
+                device_, textureD3D.GetNative(), rtv.GetAddressOf(), textureD3D.GetType(), textureD3D.GetBaseDXFormat(), mipLevel, baseLayer, numLayers
+            );
+            GetNative()->ClearRenderTargetView(rtv.Get(), clearValue.color);
+        }
+        else if ((bindFlags & BindFlags::Storage) != 0)
+        {
+            ComPtr<ID3D11UnorderedAccessView> uav;
+            textureD3D.CreateSubresourceUAV(
+                device_, uav.GetAddressOf(), textureD3D.GetType(), textureD3D.GetBaseDXFormat(), mipLevel, baseLayer, numLayers
+            );
+            if ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0)
+            {
+                /* Integer formats are cleared with the truncated clear color */
+                UINT valuesVec4[4];
+                for_range(i, 4)
+                {
+                    if ((formatAttribs.flags & FormatFlags::IsUnsigned) != 0)
+                        valuesVec4[i] = static_cast<UINT>(std::max(0.0f, clearValue.color[i]));
+                    else
+                        valuesVec4[i] = static_cast<UINT>(static_cast<INT>(clearValue.color[i]));
+                }
+                GetNative()->ClearUnorderedAccessViewUint(uav.Get(), valuesVec4);
+            }
+            else
+                GetNative()->ClearUnorderedAccessViewFloat(uav.Get(), clearValue.color);
+        }
+    }
+}
+
+void D3D11PrimaryCommandBuffer::DiscardResource(Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            context_.DiscardResource(LLGL_CAST(D3D11Buffer&, resource).GetNative());
+            break;
+        case ResourceType::Texture:
+            context_.DiscardResource(LLGL_CAST(D3D11Texture&, resource).GetNative());
+            break;
+        default:
+            break;
+    }
+}
+
 void D3D11PrimaryCommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -473,6 +606,17 @@ void D3D11PrimaryCommandBuffer::CopyTexture(
     );
 }
 
+void D3D11PrimaryCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    /* D3D11 tracks resource hazards internally, so there are no barriers to batch across regions */
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
 /*
 D3D11 does not support copying data between buffers and textures natively,
 so this function dispatches a builtin compute shader to achieve the desired effect.
@@ -718,6 +862,11 @@ void D3D11PrimaryCommandBuffer::GenerateMips(Texture& texture, const TextureSubr
     );
 }
 
+void D3D11PrimaryCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    D3D11MipGenerator::Get().GenerateMipsForTextures(GetNative(), numTextures, textures);
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void D3D11PrimaryCommandBuffer::SetViewport(const Viewport& viewport)
@@ -742,16 +891,26 @@ void D3D11PrimaryCommandBuffer::SetScissors(std::uint32_t numScissors, const Sci
 
 /* ----- Input Assembly ------ */
 
-void D3D11PrimaryCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void D3D11PrimaryCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
-    context_.SetVertexBuffer(bufferD3D);
+    context_.SetVertexBuffer(bufferD3D, static_cast<UINT>(offset));
 }
 
-void D3D11PrimaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void D3D11PrimaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayD3D = LLGL_CAST(D3D11BufferArray&, bufferArray);
-    context_.SetVertexBufferArray(bufferArrayD3D);
+    if (offsets != nullptr)
+    {
+        /* Convert offsets to native type */
+        SmallVector<UINT, 8> offsetsD3D;
+        offsetsD3D.resize(bufferArrayD3D.GetCount());
+        for_range(i, offsetsD3D.size())
+            offsetsD3D[i] = static_cast<UINT>(offsets[i]);
+        context_.SetVertexBufferArray(bufferArrayD3D, offsetsD3D.data());
+    }
+    else
+        context_.SetVertexBufferArray(bufferArrayD3D);
 }
 
 void D3D11PrimaryCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -779,6 +938,12 @@ void D3D11PrimaryCommandBuffer::SetResource(std::uint32_t descriptor, Resource&
     (void)context_.SetResource(descriptor, resource);
 }
 
+void D3D11PrimaryCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    (void)context_.SetBufferRange(descriptor, bufferD3D, static_cast<UINT>(offset), static_cast<UINT>(std::min<std::uint64_t>(size, UINT_MAX)));
+}
+
 /* ----- Render Passes ----- */
 
 void D3D11PrimaryCommandBuffer::BeginRenderPass(
@@ -819,6 +984,11 @@ void D3D11PrimaryCommandBuffer::EndRenderPass()
     context_.ResolveAndUnbindRenderTargets();
 }
 
+void D3D11PrimaryCommandBuffer::NextSubpass()
+{
+    // dummy - all subpasses render into the same render target views
+}
+
 void D3D11PrimaryCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
     context_.ClearFramebufferViewsSimple(flags, clearValue);
@@ -847,6 +1017,41 @@ void D3D11PrimaryCommandBuffer::SetStencilReference(std::uint32_t reference, con
     GetStateManager().SetStencilRef(reference);
 }
 
+void D3D11PrimaryCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    GetStateManager().SetPrimitiveTopology(DXTypes::ToD3DPrimitiveTopology(primitiveTopology));
+}
+
+void D3D11PrimaryCommandBuffer::SetDepthBias(const DepthBiasDescriptor& /*depthBiasDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
 void D3D11PrimaryCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     context_.SetUniforms(first, data, dataSize);
@@ -858,13 +1063,15 @@ void D3D11PrimaryCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t q
 {
     auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
 
-    query *= queryHeapD3D.GetGroupSize();
-
     if (queryHeapD3D.GetNativeType() == D3D11_QUERY_TIMESTAMP_DISJOINT)
     {
-        /* Begin disjoint query first, and insert the beginning timestamp query */
-        GetNative()->Begin(queryHeapD3D.GetNative(query));
-        GetNative()->End(queryHeapD3D.GetNative(query + 1));
+        /* Begin disjoint query that is shared between all timer queries of this command buffer, and insert the beginning timestamp query */
+        if (!timestampDisjoint_)
+        {
+            timestampDisjoint_ = timestampDisjointPool_.Acquire();
+            GetNative()->Begin(timestampDisjoint_->query.Get());
+        }
+        queryHeapD3D.BeginTimerQuery(GetNative(), query, timestampDisjoint_);
     }
     else
     {
@@ -877,13 +1084,10 @@ void D3D11PrimaryCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t que
 {
     auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
 
-    query *= queryHeapD3D.GetGroupSize();
-
     if (queryHeapD3D.GetNativeType() == D3D11_QUERY_TIMESTAMP_DISJOINT)
     {
-        /* Insert the ending timestamp query, and end the disjoint query */
-        GetNative()->End(queryHeapD3D.GetNative(query + 2));
-        GetNative()->End(queryHeapD3D.GetNative(query));
+        /* Insert the ending timestamp query; the disjoint query is ended with the command buffer */
+        queryHeapD3D.EndTimerQuery(GetNative(), query);
     }
     else
     {
@@ -896,7 +1100,7 @@ void D3D11PrimaryCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::
 {
     auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
     GetNative()->SetPredication(
-        queryHeapD3D.GetPredicate(query * queryHeapD3D.GetGroupSize()),
+        queryHeapD3D.GetPredicate(query),
         (mode >= RenderConditionMode::WaitInverted)
     );
 }
@@ -906,6 +1110,16 @@ void D3D11PrimaryCommandBuffer::EndRenderCondition()
     GetNative()->SetPredication(nullptr, FALSE);
 }
 
+void D3D11PrimaryCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    // dummy - D3D11 query results cannot be written into buffers on the GPU timeline
+}
+
 /* ----- Stream Output ------ */
 
 void D3D11PrimaryCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -974,6 +1188,11 @@ void D3D11PrimaryCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, s
     context_.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void D3D11PrimaryCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    context_.DrawIndexedInstancedN(draws, numDraws);
+}
+
 void D3D11PrimaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
@@ -998,6 +1217,38 @@ void D3D11PrimaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_
     context_.DrawIndexedInstancedIndirectN(bufferD3D.GetNative(), static_cast<UINT>(offset), numCommands, stride);
 }
 
+void D3D11PrimaryCommandBuffer::DrawIndirectCount(
+    Buffer&         /*argumentsBuffer*/,
+    std::uint64_t   /*argumentsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*argumentsBuffer*/,
+    std::uint64_t   /*argumentsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::DrawMeshTasks(std::uint32_t /*numThreadGroupsX*/, std::uint32_t /*numThreadGroupsY*/, std::uint32_t /*numThreadGroupsZ*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11PrimaryCommandBuffer::DrawMeshTasksIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
 /* ----- Compute ----- */
 
 void D3D11PrimaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1061,6 +1312,7 @@ void D3D11PrimaryCommandBuffer::ClearStateAndResetDeferredCommandList()
     if (hasDeferredContext_)
     {
         /* Clear state of deferred device context and discard partially built command list */
+        timestampDisjoint_.reset();
         if (commandList_)
         {
             GetNative()->FinishCommandList(TRUE, commandList_.ReleaseAndGetAddressOf());
@@ -1069,6 +1321,15 @@ void D3D11PrimaryCommandBuffer::ClearStateAndResetDeferredCommandList()
     }
 }
 
+void D3D11PrimaryCommandBuffer::EndTimestampDisjoint()
+{
+    if (timestampDisjoint_)
+    {
+        GetNative()->End(timestampDisjoint_->query.Get());
+        timestampDisjoint_.reset();
+    }
+}
+
 /*
 Creates a buffer copy for the HLSL type ByteAddressBuffer.
 The format must be DXGI_FORMAT_R32_TYPELESS for raw-views.
@@ -11,6 +11,8 @@
 
 #include "D3D11CommandBuffer.h"
 #include "D3D11CommandContext.h"
+#include "../RenderState/D3D11QueryHeap.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 
 namespace LLGL
@@ -46,6 +48,9 @@ class D3D11PrimaryCommandBuffer final : public D3D11CommandBuffer
 
     private:
 
+        // Ends the timestamp disjoint query that has been started by the first timer query of this command buffer.
+        void EndTimestampDisjoint();
+
         void ClearWithIntermediateUAV(ID3D11Buffer* buffer, UINT offset, UINT size, const UINT (&valuesVec4)[4]);
 
         // Creates a copy of this buffer as ByteAddressBuffer; 'size' must be a multiple of 4.
@@ -89,6 +94,11 @@ class D3D11PrimaryCommandBuffer final : public D3D11CommandBuffer
         ComPtr<ID3DUserDefinedAnnotation>   annotation_;
         #endif
 
+        CPUProfileSpan                      encodeSpan_;
+
+        D3D11TimestampDisjointPool          timestampDisjointPool_;
+        D3D11TimestampDisjointPtr           timestampDisjoint_;     // Disjoint query of all timer queries within the current encoding.
+
 };
 
 
@@ -12,10 +12,19 @@
 #include "../Buffer/D3D11Buffer.h"
 #include "../Buffer/D3D11BufferArray.h"
 #include "../D3D11Types.h"
+#include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/IndirectArguments.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <climits>
 #include <cstring>
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "D3D11CommandAssembler.h"
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 
 namespace LLGL
 {
@@ -23,10 +32,11 @@ namespace LLGL
 
 static constexpr std::size_t g_initialSizeForD3DVirtualCmdBuffer = 4096;
 
-D3D11SecondaryCommandBuffer::D3D11SecondaryCommandBuffer(const CommandBufferDescriptor& /*desc*/)
+D3D11SecondaryCommandBuffer::D3D11SecondaryCommandBuffer(const CommandBufferDescriptor& desc)
 :
-    D3D11CommandBuffer { /*isSecondaryCmdBuffer:*/ true      },
-    buffer_            { g_initialSizeForD3DVirtualCmdBuffer }
+    D3D11CommandBuffer { /*isSecondaryCmdBuffer:*/ true, /*isVirtualCmdBuffer:*/ true },
+    buffer_            { g_initialSizeForD3DVirtualCmdBuffer },
+    flags_             { desc.flags                          }
 {
 }
 
@@ -34,12 +44,35 @@ D3D11SecondaryCommandBuffer::D3D11SecondaryCommandBuffer(const CommandBufferDesc
 
 void D3D11SecondaryCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     buffer_.Clear();
+    InvalidateBoundBuffers();
+    boundPipelineState_ = nullptr;
+
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+    executable_.reset();
+    #endif // /LLGL_ENABLE_JIT_COMPILER
 }
 
 void D3D11SecondaryCommandBuffer::End()
 {
-    // dummy
+    if ((flags_ & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        /* Pack virtual command buffer if it has to be traversed multiple times */
+        buffer_.Pack();
+
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+        /*
+        Generate native assembly only if command buffer will be submitted multiple times.
+        The program references the packed command buffer, so it must be assembled after packing.
+        If no program can be generated, the command buffer is emulated.
+        */
+        executable_ = AssembleD3D11SecondaryCommandBuffer(*this);
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+    }
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void D3D11SecondaryCommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
@@ -68,6 +101,15 @@ void D3D11SecondaryCommandBuffer::CopyBuffer(
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::CopyBufferRegions(
+    Buffer&                 /*dstBuffer*/,
+    Buffer&                 /*srcBuffer*/,
+    std::uint32_t           /*numRegions*/,
+    const BufferCopyRegion* /*regions*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 void D3D11SecondaryCommandBuffer::CopyBufferFromTexture(
     Buffer&                 /*dstBuffer*/,
     std::uint64_t           /*dstOffset*/,
@@ -88,6 +130,29 @@ void D3D11SecondaryCommandBuffer::FillBuffer(
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::ClearBuffer(
+    Buffer&             /*dstBuffer*/,
+    const Format        /*format*/,
+    const ClearValue&   /*clearValue*/,
+    std::uint64_t       /*dstOffset*/,
+    std::uint64_t       /*clearSize*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
+void D3D11SecondaryCommandBuffer::ClearTexture(
+    Texture&                    /*texture*/,
+    const TextureSubresource&   /*subresource*/,
+    const ClearValue&           /*clearValue*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
+void D3D11SecondaryCommandBuffer::DiscardResource(Resource& /*resource*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 void D3D11SecondaryCommandBuffer::CopyTexture(
     Texture&                /*dstTexture*/,
     const TextureLocation&  /*dstLocation*/,
@@ -98,6 +163,15 @@ void D3D11SecondaryCommandBuffer::CopyTexture(
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::CopyTextureRegions(
+    Texture&                    /*dstTexture*/,
+    Texture&                    /*srcTexture*/,
+    std::uint32_t               /*numRegions*/,
+    const TextureCopyRegion*    regions)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 void D3D11SecondaryCommandBuffer::CopyTextureFromBuffer(
     Texture&                /*dstTexture*/,
     const TextureRegion&    /*dstRegion*/,
@@ -127,6 +201,11 @@ void D3D11SecondaryCommandBuffer::GenerateMips(Texture& /*texture*/, const Textu
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::GenerateMips(std::uint32_t /*numTextures*/, Texture* const * /*textures*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void D3D11SecondaryCommandBuffer::SetViewport(const Viewport& /*viewport*/)
@@ -151,44 +230,65 @@ void D3D11SecondaryCommandBuffer::SetScissors(std::uint32_t /*numScissors*/, con
 
 /* ----- Buffers ------ */
 
-void D3D11SecondaryCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void D3D11SecondaryCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
-    auto cmd = AllocCommand<D3D11CmdSetVertexBuffer>(D3D11OpcodeSetVertexBuffer);
+    const UINT offsetD3D = static_cast<UINT>(offset);
+
+    /* Ignore redundant vertex buffer bindings */
+    if (boundVertexBuffer_ == bufferD3D && boundVertexOffset_ == offsetD3D)
+        return;
+
+    boundVertexBuffer_ = bufferD3D;
+    boundVertexOffset_ = offsetD3D;
+
+    /* Replace previous command if it binds another vertex buffer, otherwise allocate new command */
+    auto cmd = buffer_.LastCommand<D3D11CmdSetVertexBuffer>(D3D11OpcodeSetVertexBuffer);
+    if (cmd == nullptr)
+        cmd = AllocCommand<D3D11CmdSetVertexBuffer>(D3D11OpcodeSetVertexBuffer);
     {
         cmd->buffer = bufferD3D;
+        cmd->offset = offsetD3D;
     }
 }
 
-void D3D11SecondaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void D3D11SecondaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto* bufferArrayD3D = LLGL_CAST(D3D11BufferArray*, &bufferArray);
-    auto cmd = AllocCommand<D3D11CmdSetVertexBufferArray>(D3D11OpcodeSetVertexBufferArray);
+
+    /* Ignore redundant vertex buffer bindings; bindings with offsets are not tracked */
+    if (offsets == nullptr && boundVertexBuffer_ == bufferArrayD3D && boundVertexOffset_ == 0)
+        return;
+
+    boundVertexBuffer_ = (offsets == nullptr ? bufferArrayD3D : nullptr);
+    boundVertexOffset_ = 0;
+
+    /* Replace previous command if it binds another vertex buffer array with the same number of offsets, otherwise allocate new command */
+    const UINT          numOffsets  = (offsets != nullptr ? bufferArrayD3D->GetCount() : 0);
+    const std::size_t   payloadSize = sizeof(UINT) * numOffsets;
+
+    auto cmd = buffer_.LastCommand<D3D11CmdSetVertexBufferArray>(D3D11OpcodeSetVertexBufferArray, payloadSize);
+    if (cmd == nullptr)
+        cmd = AllocCommand<D3D11CmdSetVertexBufferArray>(D3D11OpcodeSetVertexBufferArray, payloadSize);
     {
-        cmd->bufferArray = bufferArrayD3D;
+        cmd->bufferArray    = bufferArrayD3D;
+        cmd->numOffsets     = numOffsets;
+        auto offsetsD3D = reinterpret_cast<UINT*>(cmd + 1);
+        for_range(i, numOffsets)
+            offsetsD3D[i] = static_cast<UINT>(offsets[i]);
     }
 }
 
 void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
-    auto cmd = AllocCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
-    {
-        cmd->buffer = bufferD3D;
-        cmd->format = bufferD3D->GetDXFormat();
-        cmd->offset = 0;
-    }
+    EncodeSetIndexBuffer(bufferD3D, bufferD3D->GetDXFormat(), 0);
 }
 
 void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
-    auto cmd = AllocCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
-    {
-        cmd->buffer = bufferD3D;
-        cmd->format = DXTypes::ToDXGIFormat(format);
-        cmd->offset = static_cast<UINT>(offset);
-    }
+    EncodeSetIndexBuffer(bufferD3D, DXTypes::ToDXGIFormat(format), static_cast<UINT>(offset));
 }
 
 /* ----- Resources ----- */
@@ -196,6 +296,7 @@ void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format fo
 void D3D11SecondaryCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
     auto* resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap*, &resourceHeap);
+    InvalidateBoundBuffers();
     auto cmd = AllocCommand<D3D11CmdSetResourceHeap>(D3D11OpcodeSetResourceHeap);
     {
         cmd->resourceHeap   = resourceHeapD3D;
@@ -205,6 +306,7 @@ void D3D11SecondaryCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, st
 
 void D3D11SecondaryCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
+    InvalidateBoundBuffers();
     auto cmd = AllocCommand<D3D11CmdSetResource>(D3D11OpcodeSetResource);
     {
         cmd->descriptor = descriptor;
@@ -212,6 +314,18 @@ void D3D11SecondaryCommandBuffer::SetResource(std::uint32_t descriptor, Resource
     }
 }
 
+void D3D11SecondaryCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    InvalidateBoundBuffers();
+    auto cmd = AllocCommand<D3D11CmdSetBufferRange>(D3D11OpcodeSetBufferRange);
+    {
+        cmd->descriptor = descriptor;
+        cmd->buffer     = LLGL_CAST(D3D11Buffer*, &buffer);
+        cmd->offset     = static_cast<UINT>(offset);
+        cmd->size       = static_cast<UINT>(std::min<std::uint64_t>(size, UINT_MAX));
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void D3D11SecondaryCommandBuffer::BeginRenderPass(
@@ -229,6 +343,11 @@ void D3D11SecondaryCommandBuffer::EndRenderPass()
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::NextSubpass()
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 void D3D11SecondaryCommandBuffer::Clear(long /*flags*/, const ClearValue& /*clearValue*/)
 {
     // dummy - command not allowed in secondary command buffer
@@ -244,6 +363,13 @@ void D3D11SecondaryCommandBuffer::ClearAttachments(std::uint32_t /*numAttachment
 void D3D11SecondaryCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
     auto* pipelineStateD3D = LLGL_CAST(D3D11PipelineState*, &pipelineState);
+
+    /* Ignore redundant pipeline state bindings; D3D11CommandContext also ignores them, so this only saves the dispatch */
+    if (boundPipelineState_ == pipelineStateD3D)
+        return;
+
+    boundPipelineState_ = pipelineStateD3D;
+
     auto cmd = AllocCommand<D3D11CmdSetPipelineState>(D3D11OpcodeSetPipelineState);
     {
         cmd->pipelineState = pipelineStateD3D;
@@ -252,7 +378,10 @@ void D3D11SecondaryCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 
 void D3D11SecondaryCommandBuffer::SetBlendFactor(const float color[4])
 {
-    auto cmd = AllocCommand<D3D11CmdSetBlendFactor>(D3D11OpcodeSetBlendFactor);
+    /* Replace previous command if it sets another blend factor, otherwise allocate new command */
+    auto cmd = buffer_.LastCommand<D3D11CmdSetBlendFactor>(D3D11OpcodeSetBlendFactor);
+    if (cmd == nullptr)
+        cmd = AllocCommand<D3D11CmdSetBlendFactor>(D3D11OpcodeSetBlendFactor);
     {
         cmd->color[0] = color[0];
         cmd->color[1] = color[1];
@@ -263,12 +392,53 @@ void D3D11SecondaryCommandBuffer::SetBlendFactor(const float color[4])
 
 void D3D11SecondaryCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace /*stencilFace*/)
 {
-    auto cmd = AllocCommand<D3D11CmdSetStencilRef>(D3D11OpcodeSetStencilRef);
+    /* Replace previous command if it sets another stencil reference, otherwise allocate new command */
+    auto cmd = buffer_.LastCommand<D3D11CmdSetStencilRef>(D3D11OpcodeSetStencilRef);
+    if (cmd == nullptr)
+        cmd = AllocCommand<D3D11CmdSetStencilRef>(D3D11OpcodeSetStencilRef);
     {
         cmd->stencilRef = reference;
     }
 }
 
+void D3D11SecondaryCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    auto cmd = AllocCommand<D3D11CmdSetPrimitiveTopology>(D3D11OpcodeSetPrimitiveTopology);
+    {
+        cmd->primitiveTopology = DXTypes::ToD3DPrimitiveTopology(primitiveTopology);
+    }
+}
+
+void D3D11SecondaryCommandBuffer::SetDepthBias(const DepthBiasDescriptor& /*depthBiasDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
 void D3D11SecondaryCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     auto cmd = AllocCommand<D3D11CmdSetUniforms>(D3D11OpcodeSetUniforms, dataSize);
@@ -301,6 +471,16 @@ void D3D11SecondaryCommandBuffer::EndRenderCondition()
     // dummy - command not allowed in secondary command buffer
 }
 
+void D3D11SecondaryCommandBuffer::ResolveQueryData(
+    QueryHeap&      /*queryHeap*/,
+    std::uint32_t   /*firstQuery*/,
+    std::uint32_t   /*numQueries*/,
+    Buffer&         /*dstBuffer*/,
+    std::uint64_t   /*dstOffset*/)
+{
+    // dummy - command not allowed in secondary command buffer
+}
+
 /* ----- Stream Output ------ */
 
 void D3D11SecondaryCommandBuffer::BeginStreamOutput(std::uint32_t /*numBuffers*/, Buffer* const * /*buffers*/)
@@ -317,7 +497,11 @@ void D3D11SecondaryCommandBuffer::EndStreamOutput()
 
 void D3D11SecondaryCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    auto cmd = AllocCommand<D3D11CmdDraw>(D3D11OpcodeDraw);
+    /* Fuse with preceding uniform update into superinstruction */
+    auto cmd = (buffer_.LastOpcode() == D3D11OpcodeSetUniforms
+        ? buffer_.ExtendLastCommand<D3D11CmdDraw>(D3D11OpcodeSetUniformsDraw)
+        : AllocCommand<D3D11CmdDraw>(D3D11OpcodeDraw)
+    );
     {
         cmd->vertexCount            = numVertices;
         cmd->startVertexLocation    = firstVertex;
@@ -326,22 +510,12 @@ void D3D11SecondaryCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t
 
 void D3D11SecondaryCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    auto cmd = AllocCommand<D3D11CmdDrawIndexed>(D3D11OpcodeDrawIndexed);
-    {
-        cmd->indexCount         = numIndices;
-        cmd->startIndexLocation = firstIndex;
-        cmd->baseVertexLocation = 0;
-    }
+    EncodeDrawIndexed(numIndices, firstIndex, 0);
 }
 
 void D3D11SecondaryCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
-    auto cmd = AllocCommand<D3D11CmdDrawIndexed>(D3D11OpcodeDrawIndexed);
-    {
-        cmd->indexCount         = numIndices;
-        cmd->startIndexLocation = firstIndex;
-        cmd->baseVertexLocation = vertexOffset;
-    }
+    EncodeDrawIndexed(numIndices, firstIndex, vertexOffset);
 }
 
 void D3D11SecondaryCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
@@ -366,6 +540,19 @@ void D3D11SecondaryCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::
     }
 }
 
+void D3D11SecondaryCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    if (numDraws == 0)
+        return;
+
+    const std::size_t drawsSize = sizeof(DrawIndexedIndirectArguments) * numDraws;
+    auto cmd = AllocCommand<D3D11CmdDrawIndexedInstancedN>(D3D11OpcodeDrawIndexedInstancedN, drawsSize);
+    {
+        cmd->numDraws = numDraws;
+        std::memcpy(cmd + 1, draws, drawsSize);
+    }
+}
+
 void D3D11SecondaryCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
     auto cmd = AllocCommand<D3D11CmdDrawIndexedInstanced>(D3D11OpcodeDrawIndexedInstanced);
@@ -450,6 +637,38 @@ void D3D11SecondaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint6
     }
 }
 
+void D3D11SecondaryCommandBuffer::DrawIndirectCount(
+    Buffer&         /*argumentsBuffer*/,
+    std::uint64_t   /*argumentsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*argumentsBuffer*/,
+    std::uint64_t   /*argumentsOffset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::DrawMeshTasks(std::uint32_t /*numThreadGroupsX*/, std::uint32_t /*numThreadGroupsY*/, std::uint32_t /*numThreadGroupsZ*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
+void D3D11SecondaryCommandBuffer::DrawMeshTasksIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // dummy - not supported by Direct3D 11
+}
+
 /* ----- Compute ----- */
 
 void D3D11SecondaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -501,6 +720,64 @@ bool D3D11SecondaryCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_
  * ======= Private: =======
  */
 
+void D3D11SecondaryCommandBuffer::EncodeSetIndexBuffer(D3D11Buffer* bufferD3D, DXGI_FORMAT format, UINT offset)
+{
+    /* Ignore redundant index buffer bindings */
+    if (boundIndexBuffer_ == bufferD3D && boundIndexFormat_ == format && boundIndexOffset_ == offset)
+        return;
+
+    boundIndexBuffer_   = bufferD3D;
+    boundIndexFormat_   = format;
+    boundIndexOffset_   = offset;
+
+    /* Replace previous command if it binds another index buffer or fuse it with a preceding vertex buffer binding */
+    auto cmd = buffer_.LastCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
+    if (cmd == nullptr)
+    {
+        if (buffer_.LastOpcode() == D3D11OpcodeSetVertexBuffer)
+            cmd = buffer_.ExtendLastCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetVertexAndIndexBuffer);
+        else
+            cmd = AllocCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
+    }
+    {
+        cmd->buffer = bufferD3D;
+        cmd->format = format;
+        cmd->offset = offset;
+    }
+}
+
+void D3D11SecondaryCommandBuffer::EncodeDrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+{
+    /* Fuse with preceding buffer bindings or uniform update into superinstruction */
+    D3D11CmdDrawIndexed* cmd = nullptr;
+    switch (buffer_.LastOpcode())
+    {
+        case D3D11OpcodeSetVertexAndIndexBuffer:
+            cmd = buffer_.ExtendLastCommand<D3D11CmdDrawIndexed>(D3D11OpcodeDrawIndexedWithBuffers);
+            break;
+        case D3D11OpcodeSetUniforms:
+            cmd = buffer_.ExtendLastCommand<D3D11CmdDrawIndexed>(D3D11OpcodeSetUniformsDrawIndexed);
+            break;
+        default:
+            cmd = AllocCommand<D3D11CmdDrawIndexed>(D3D11OpcodeDrawIndexed);
+            break;
+    }
+    {
+        cmd->indexCount         = indexCount;
+        cmd->startIndexLocation = startIndexLocation;
+        cmd->baseVertexLocation = baseVertexLocation;
+    }
+}
+
+void D3D11SecondaryCommandBuffer::InvalidateBoundBuffers()
+{
+    boundVertexBuffer_  = nullptr;
+    boundVertexOffset_  = 0;
+    boundIndexBuffer_   = nullptr;
+    boundIndexFormat_   = DXGI_FORMAT_UNKNOWN;
+    boundIndexOffset_   = 0;
+}
+
 void D3D11SecondaryCommandBuffer::AllocOpcode(const D3D11Opcode opcode)
 {
     buffer_.AllocOpcode(opcode);
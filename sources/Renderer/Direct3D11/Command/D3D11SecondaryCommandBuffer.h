@@ -12,6 +12,12 @@
 #include "D3D11CommandBuffer.h"
 #include "D3D11CommandOpcode.h"
 #include "../../VirtualCommandBuffer.h"
+#include "../../../Core/CPUProfilerUtils.h"
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "../../../JIT/JITProgram.h"
+#   include <memory>
+#endif
 
 
 namespace LLGL
@@ -37,8 +43,27 @@ class D3D11SecondaryCommandBuffer final : public D3D11CommandBuffer
             return buffer_;
         }
 
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+
+        // Returns the just-in-time compiled command buffer that can be executed natively, or null if not available.
+        inline const std::unique_ptr<JITProgram>& GetExecutable() const
+        {
+            return executable_;
+        }
+
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+
     private:
 
+        // Encodes the index buffer command or fuses it with a preceding vertex buffer command.
+        void EncodeSetIndexBuffer(D3D11Buffer* bufferD3D, DXGI_FORMAT format, UINT offset);
+
+        // Encodes the indexed draw command or fuses it with preceding buffer or uniform commands.
+        void EncodeDrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation);
+
+        // Resets the tracked vertex and index buffer bindings, e.g. when binding resources might unbind them.
+        void InvalidateBoundBuffers();
+
         // Allocates only an opcode for empty commands.
         void AllocOpcode(const D3D11Opcode opcode);
 
@@ -48,7 +73,22 @@ class D3D11SecondaryCommandBuffer final : public D3D11CommandBuffer
 
     private:
 
-        D3D11VirtualCommandBuffer buffer_;
+        D3D11VirtualCommandBuffer   buffer_;
+        const long                  flags_                  = 0;
+
+        /* Tracked bindings to eliminate redundant state changes during encoding */
+        const void*                 boundVertexBuffer_      = nullptr; // D3D11Buffer or D3D11BufferArray
+        UINT                        boundVertexOffset_      = 0;
+        D3D11Buffer*                boundIndexBuffer_       = nullptr;
+        DXGI_FORMAT                 boundIndexFormat_       = DXGI_FORMAT_UNKNOWN;
+        UINT                        boundIndexOffset_       = 0;
+        D3D11PipelineState*         boundPipelineState_     = nullptr;
+
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+        std::unique_ptr<JITProgram> executable_;
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+
+        CPUProfileSpan              encodeSpan_;
 
 };
 
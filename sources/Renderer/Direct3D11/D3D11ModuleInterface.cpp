@@ -39,6 +39,23 @@ namespace ModuleDirect3D11
 
 } // /namespace LLGL
 
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#include "../DirectCommandBufferImpl.h"
+#include "Command/D3D11PrimaryCommandBuffer.h"
+#include "Command/D3D11SecondaryCommandBuffer.h"
+
+// D3D11 has two final command buffer classes, but the non-virtual flag IsVirtualCmdBuffer() distinguishes them
+#define LLGL_D3D11_DIRECT_DISPATCH(CMDBUFFER, CALL)                                 \
+    if (LLGL_CAST(D3D11CommandBuffer&, CMDBUFFER).IsVirtualCmdBuffer())             \
+        LLGL_DIRECT_DISPATCH_FINAL(D3D11SecondaryCommandBuffer, CMDBUFFER, CALL);   \
+    else                                                                            \
+        LLGL_DIRECT_DISPATCH_FINAL(D3D11PrimaryCommandBuffer, CMDBUFFER, CALL)
+
+LLGL_IMPLEMENT_DIRECT_COMMAND_BUFFER(LLGL_D3D11_DIRECT_DISPATCH)
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
 #ifndef LLGL_BUILD_STATIC_LIB
 
 extern "C"
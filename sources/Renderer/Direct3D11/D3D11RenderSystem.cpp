@@ -9,15 +9,19 @@
 #include "D3D11Types.h"
 #include "D3D11ResourceFlags.h"
 #include "Texture/D3D11MipGenerator.h"
+#include "Texture/D3D11ImageConverter.h"
 #include "Shader/D3D11BuiltinShaderFactory.h"
+#include "Shader/D3D11ShaderObjectCache.h"
 #include "../DXCommon/DXCore.h"
 #include "../CheckedCast.h"
 #include "../TextureUtils.h"
 #include "../RenderSystemUtils.h"
+#include "../MemoryInfoUtils.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/StringUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include <sstream>
 #include <iomanip>
 #include <limits.h>
@@ -41,19 +45,17 @@ namespace LLGL
 {
 
 
-#if 0 //WIP
 /*
 Returns true if the D3D runtime supports command lists natively.
 Otherwise, they will be emulated by the D3D runtime.
 See https://docs.microsoft.com/en-us/windows/win32/api/d3d11_1/nf-d3d11_1-id3d11devicecontext1-vssetconstantbuffers1#remarks
 */
-static bool D3DSupportsDriverCommandLists(ID3D11Device* device, ID3D11DeviceContext* context)
+static bool D3DSupportsDriverCommandLists(ID3D11Device* device)
 {
     D3D11_FEATURE_DATA_THREADING threadingCaps = { FALSE, FALSE };
     HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingCaps, sizeof(threadingCaps));
     return (SUCCEEDED(hr) && threadingCaps.DriverCommandLists != FALSE);
 }
-#endif
 
 D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 {
@@ -87,18 +89,31 @@ D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemD
     QueryRendererInfo();
     QueryRenderingCaps();
 
-    /* Initialize MIP-map generator singleton */
+    /* Initialize MIP-map generator and image converter singletons */
     D3D11MipGenerator::Get().InitializeDevice(device_);
+    D3D11ImageConverter::Get().InitializeDevice(device_);
     D3D11BuiltinShaderFactory::Get().CreateBuiltinShaders(device_.Get());
 
-    //D3DSupportsDriverCommandLists(device_.Get(), context_.Get());
+    /* Record secondary command buffers natively only if requested and the driver does not emulate command lists */
+    if (auto* rendererConfigD3D = GetRendererConfiguration<RendererConfigurationD3D11>(renderSystemDesc))
+    {
+        if (rendererConfigD3D->nativeSecondaryCommandBuffers)
+            driverCommandLists_ = D3DSupportsDriverCommandLists(device_.Get());
+    }
+
+    /* Map persistent cache file for compiled shader byte code if specified */
+    if (renderSystemDesc.pipelineCacheFilename != nullptr)
+        persistentBytecodeCache_ = MakeUnique<PersistentPipelineCache>(renderSystemDesc.pipelineCacheFilename, GetRendererInfo());
 }
 
 D3D11RenderSystem::~D3D11RenderSystem()
 {
     /* Release resource of singletons first */
     D3D11MipGenerator::Get().Clear();
+    D3D11ImageConverter::Get().Clear();
     D3D11BuiltinShaderFactory::Get().Clear();
+    D3D11ShaderObjectCache::Get().Clear();
+    DXClearShaderReflectionCache();
 }
 
 /* ----- Swap-chain ----- */
@@ -129,7 +144,7 @@ CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescrip
         /* Create command buffer with immediate context */
         return commandBuffers_.emplace<D3D11PrimaryCommandBuffer>(device_.Get(), context_, stateMngr_, commandBufferDesc);
     }
-    else if ((commandBufferDesc.flags & (CommandBufferFlags::Secondary)) != 0)
+    else if ((commandBufferDesc.flags & (CommandBufferFlags::Secondary)) != 0 && !CanRecordNativeSecondaryCommandBuffer(commandBufferDesc))
     {
         /* Create secondary command buffer with virtual buffer */
         return commandBuffers_.emplace<D3D11SecondaryCommandBuffer>(commandBufferDesc);
@@ -158,6 +173,8 @@ void D3D11RenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* D3D11RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateBuffer");
+
     RenderSystem::AssertCreateBuffer(bufferDesc, UINT_MAX);
     if (DXBindFlagsNeedBufferWithRV(bufferDesc.bindFlags))
         return buffers_.emplace<D3D11BufferWithRV>(device_.Get(), bufferDesc, initialData);
@@ -190,7 +207,7 @@ void D3D11RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const
 void D3D11RenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
-    bufferD3D.ReadSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(offset));
+    bufferD3D.ReadSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(offset), stateMngr_->GetReadbackBufferPool());
 }
 
 void* D3D11RenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
@@ -215,6 +232,8 @@ void D3D11RenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* D3D11RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateTexture");
+
     /* Create texture object */
     auto* textureD3D = textures_.emplace<D3D11Texture>(device_.Get(), textureDesc);
 
@@ -403,12 +422,13 @@ void D3D11RenderSystem::Release(RenderTarget& renderTarget)
 Shader* D3D11RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<D3D11Shader>(device_.Get(), shaderDesc);
+    return shaders_.emplace<D3D11Shader>(device_.Get(), shaderDesc, persistentBytecodeCache_.get());
 }
 
 void D3D11RenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
+    D3D11ShaderObjectCache::Get().ReleaseUnusedObjects();
 }
 
 /* ----- Pipeline Layouts ----- */
@@ -439,6 +459,8 @@ void D3D11RenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
     if (device3_)
     {
@@ -469,6 +491,8 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDesc
 
 PipelineState* D3D11RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
     return pipelineStates_.emplace<D3D11ComputePSO>(pipelineStateDesc);
 }
 
@@ -517,6 +541,24 @@ bool D3D11RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
     return false;
 }
 
+bool D3D11RenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    outInfo = {};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+    outInfo.stagingPools = stateMngr_->GetStagingBufferPoolsSize();
+
+    /* Query memory budget from the adapter this device was created with */
+    ComPtr<IDXGIDevice> dxgiDevice;
+    if (SUCCEEDED(device_->QueryInterface(IID_PPV_ARGS(dxgiDevice.GetAddressOf()))))
+    {
+        ComPtr<IDXGIAdapter> dxgiAdapter;
+        if (SUCCEEDED(dxgiDevice->GetAdapter(dxgiAdapter.GetAddressOf())))
+            DXQueryVideoMemoryInfo(dxgiAdapter.Get(), outInfo);
+    }
+
+    return true;
+}
+
 
 /*
  * ======= Internal: =======
@@ -554,7 +596,7 @@ void D3D11RenderSystem::ClearStateForAllContexts()
     stateMngr_->ClearState();
     for (const auto& cmdBuffer : commandBuffers_)
     {
-        if (!cmdBuffer->IsSecondaryCmdBuffer())
+        if (!cmdBuffer->IsVirtualCmdBuffer())
         {
             auto& primaryCmdBufferD3D = LLGL_CAST(D3D11PrimaryCommandBuffer&, *cmdBuffer);
             primaryCmdBufferD3D.ClearStateAndResetDeferredCommandList();
@@ -567,6 +609,16 @@ void D3D11RenderSystem::ClearStateForAllContexts()
  * ======= Private: =======
  */
 
+/*
+Secondary command buffers can only be recorded into a native command list if they are not inlined into a render pass,
+because a deferred context cannot inherit the render targets of the primary command buffer.
+This matches the Vulkan backend, which only records secondary command buffers with a render pass as render pass continuation.
+*/
+bool D3D11RenderSystem::CanRecordNativeSecondaryCommandBuffer(const CommandBufferDescriptor& commandBufferDesc) const
+{
+    return (driverCommandLists_ && commandBufferDesc.renderPass == nullptr);
+}
+
 void D3D11RenderSystem::CreateFactory()
 {
     /* Create DXGI factory */
@@ -884,6 +936,8 @@ void D3D11RenderSystem::QueryRenderingCaps()
         caps.features.hasLogicOp                        = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
         caps.features.hasPipelineStatistics             = true;
         caps.features.hasRenderCondition                = true;
+        caps.features.hasConcurrentShaderCreation       = true;
+        caps.features.hasTextureMinLODClamp             = (featureLevel >= D3D_FEATURE_LEVEL_11_0);
 
         /* Query limits */
         caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -916,6 +970,7 @@ void D3D11RenderSystem::QueryRenderingCaps()
         caps.limits.maxDepthBufferSamples               = FindSuitableSampleDesc(device_.Get(), DXGI_FORMAT_D32_FLOAT).Count;
         caps.limits.maxStencilBufferSamples             = FindSuitableSampleDesc(device_.Get(), DXGI_FORMAT_D32_FLOAT_S8X24_UINT).Count;
         caps.limits.maxNoAttachmentSamples              = D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT;
+        caps.limits.dynamicStates                       = DynamicStateFlags::PrimitiveTopology;
     }
     SetRenderingCaps(caps);
 }
@@ -37,7 +37,10 @@
 #include "../ContainerTypes.h"
 #include "../DXCommon/ComPtr.h"
 #include "../ProxyPipelineCache.h"
+#include "../PersistentPipelineCache.h"
 
+#include <memory>
+#include <mutex>
 #include <dxgi.h>
 #include "Direct3D11.h"
 
@@ -71,6 +74,8 @@ class D3D11RenderSystem final : public RenderSystem
         D3D11RenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~D3D11RenderSystem();
 
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
     public:
 
         // Returns a sample descriptor for the specified format.
@@ -102,6 +107,9 @@ class D3D11RenderSystem final : public RenderSystem
 
     private:
 
+        // Returns true if the specified secondary command buffer can be recorded with a deferred context into a native command list.
+        bool CanRecordNativeSecondaryCommandBuffer(const CommandBufferDescriptor& commandBufferDesc) const;
+
         void CreateFactory();
         void QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper);
         HRESULT CreateDevice(IDXGIAdapter* adapter, bool debugDevice = false);
@@ -158,8 +166,10 @@ class D3D11RenderSystem final : public RenderSystem
 
         D3D_FEATURE_LEVEL                       featureLevel_           = D3D_FEATURE_LEVEL_9_1;
         bool                                    tearingSupported_       = false;
+        bool                                    driverCommandLists_     = false;
 
         std::shared_ptr<D3D11StateManager>      stateMngr_;
+        std::unique_ptr<PersistentPipelineCache> persistentBytecodeCache_;
 
         /* ----- Hardware object containers ----- */
 
@@ -22,6 +22,7 @@ LLGL_ASSERT_POD_TYPE( D3D11CmdSetResource );
 LLGL_ASSERT_POD_TYPE( D3D11CmdSetPipelineState );
 LLGL_ASSERT_POD_TYPE( D3D11CmdSetBlendFactor );
 LLGL_ASSERT_POD_TYPE( D3D11CmdSetStencilRef );
+LLGL_ASSERT_POD_TYPE( D3D11CmdSetPrimitiveTopology );
 LLGL_ASSERT_POD_TYPE( D3D11CmdSetUniforms );
 LLGL_ASSERT_POD_TYPE( D3D11CmdDraw );
 LLGL_ASSERT_POD_TYPE( D3D11CmdDrawIndexed );
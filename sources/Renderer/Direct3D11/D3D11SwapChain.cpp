@@ -10,6 +10,7 @@
 #include "D3D11ObjectUtils.h"
 #include "../DXCommon/DXTypes.h"
 #include "../../Core/CoreUtils.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Log.h>
 
@@ -29,6 +30,8 @@ D3D11SwapChain::D3D11SwapChain(
     device_              { device                                                     },
     renderSystem_        { renderSystem                                               },
     depthStencilFormat_  { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits) },
+    maxFrameLatency_     { (desc.lowLatency ? Clamp(desc.framesInFlight, 1u, 16u) : 0u) },
+    presentMode_         { desc.presentMode                                           },
     renderTargetHandles_ { 1u, (depthStencilFormat_ != DXGI_FORMAT_UNKNOWN)           },
     tearingSupported_    { renderSystem.IsTearingSupported()                          },
     colorBufferLocator_  { ResourceType::Texture, BindFlags::ColorAttachment          },
@@ -45,6 +48,12 @@ D3D11SwapChain::D3D11SwapChain(
         SetDebugName(desc.debugName);
 }
 
+D3D11SwapChain::~D3D11SwapChain()
+{
+    if (frameLatencyWaitableObject_ != nullptr)
+        ::CloseHandle(frameLatencyWaitableObject_);
+}
+
 void D3D11SwapChain::SetDebugName(const char* name)
 {
     if (name != nullptr)
@@ -77,9 +86,37 @@ void D3D11SwapChain::SetDebugName(const char* name)
 
 void D3D11SwapChain::Present()
 {
-    const bool tearingEnabled   = (tearingSupported_ && windowedMode_ && swapChainInterval_ == 0);
-    const UINT presentFlags     = (tearingEnabled ? DXGI_PRESENT_ALLOW_TEARING : 0u);
-    swapChain_->Present(swapChainInterval_, presentFlags);
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+    UINT syncInterval = 0, presentFlags = 0;
+    DXGetPresentParams(presentMode_, swapChainInterval_, (tearingSupported_ && swapEffectFlip_ && windowedMode_), syncInterval, presentFlags);
+    swapChain_->Present(syncInterval, presentFlags);
+}
+
+void D3D11SwapChain::PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || defined LLGL_OS_UWP
+    if (swapChain1_ && numDamageRects > 0 && damageRects != nullptr)
+    {
+        LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+        UINT syncInterval = 0, presentFlags = 0;
+        DXGetPresentParams(presentMode_, swapChainInterval_, (tearingSupported_ && windowedMode_), syncInterval, presentFlags);
+
+        /* Present only dirty rectangles; flip-model swap-chains only copy these regions into the next back buffer */
+        DXConvertDirtyRects(numDamageRects, damageRects, GetResolution(), dirtyRects_);
+        DXGI_PRESENT_PARAMETERS presentParams = {};
+        {
+            presentParams.DirtyRectsCount   = static_cast<UINT>(dirtyRects_.size());
+            presentParams.pDirtyRects       = dirtyRects_.data();
+        }
+        swapChain1_->Present1(syncInterval, presentFlags, &presentParams);
+    }
+    else
+    #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || LLGL_OS_UWP
+    {
+        Present();
+    }
 }
 
 std::uint32_t D3D11SwapChain::GetCurrentSwapIndex() const
@@ -117,6 +154,14 @@ bool D3D11SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return SetPresentSyncInterval(vsyncInterval);
 }
 
+bool D3D11SwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    /* Wait until DXGI has fewer than the maximum frame latency of presents queued */
+    if (frameLatencyWaitableObject_ != nullptr)
+        return DXWaitForFrameLatencyObject(frameLatencyWaitableObject_, timeout);
+    return true;
+}
+
 static bool IsD3D11BoxCoveringWholeResource(UINT width, UINT height, const D3D11_BOX& box)
 {
     return
@@ -370,6 +415,14 @@ void D3D11SwapChain::CreateDXGISwapChain(IDXGIFactory* factory, const NativeHand
     HRESULT hr = factory->CreateSwapChain(device_.Get(), &swapChainDesc, swapChain_.ReleaseAndGetAddressOf());
     DXThrowIfFailed(hr, "failed to create DXGI swap chain");
 
+    /* Legacy swap effects have no waitable object, so only limit the frame latency of the entire device for low-latency mode */
+    if (maxFrameLatency_ > 0)
+    {
+        ComPtr<IDXGIDevice1> deviceDXGI;
+        if (SUCCEEDED(device_.As(&deviceDXGI)))
+            deviceDXGI->SetMaximumFrameLatency(maxFrameLatency_);
+    }
+
     swapEffectFlip_ = false;
 }
 
@@ -393,6 +446,8 @@ void D3D11SwapChain::CreateDXGISwapChain1(IDXGIFactory2* factory2, const NativeH
         swapChainDesc.BufferCount           = swapBuffers;
         swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD; // FLIP effect requires BufferCount >= 2 && SampleDesc.Count == 1
         swapChainDesc.Flags                 = (tearingSupported_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u);
+        if (maxFrameLatency_ > 0)
+            swapChainDesc.Flags            |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
     }
 
     ComPtr<IDXGISwapChain1> swapChain;
@@ -403,6 +458,17 @@ void D3D11SwapChain::CreateDXGISwapChain1(IDXGIFactory2* factory2, const NativeH
     #endif
     DXThrowIfFailed(hr, "failed to create DXGI swap chain");
     DXThrowIfFailed(swapChain.As(&swapChain_), "failed to downcast swap chain");
+    swapChain1_ = swapChain;
+
+    /* Limit queued presents and retrieve waitable object for low-latency mode; this object remains valid when the buffers are resized */
+    if (maxFrameLatency_ > 0)
+    {
+        ComPtr<IDXGISwapChain2> swapChain2;
+        DXThrowIfFailed(swapChain.As(&swapChain2), "failed to downcast swap chain for low-latency mode");
+        hr = swapChain2->SetMaximumFrameLatency(maxFrameLatency_);
+        DXThrowIfFailed(hr, "failed to set maximum frame latency of DXGI swap chain");
+        frameLatencyWaitableObject_ = swapChain2->GetFrameLatencyWaitableObject();
+    }
 
     swapEffectFlip_ = true;
 }
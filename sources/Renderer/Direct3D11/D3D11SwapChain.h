@@ -13,9 +13,11 @@
 #include <LLGL/SwapChain.h>
 #include <d3d11.h>
 #include <dxgi.h>
+#include <vector>
 
 #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || defined LLGL_OS_UWP
 #   include <dxgi1_2.h>
+#   include <dxgi1_3.h>
 #endif
 
 
@@ -39,9 +41,12 @@ class D3D11SwapChain final : public SwapChain
             const std::shared_ptr<Surface>&     surface
         );
 
+        ~D3D11SwapChain();
+
         void SetDebugName(const char* name) override;
 
         void Present() override;
+        void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
 
         std::uint32_t GetCurrentSwapIndex() const override;
         std::uint32_t GetNumSwapBuffers() const override;
@@ -54,6 +59,8 @@ class D3D11SwapChain final : public SwapChain
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
     public:
 
         // Copyies a subresource region from the backbuffer (color or depth-stencil) into the destination resource.
@@ -101,11 +108,19 @@ class D3D11SwapChain final : public SwapChain
         D3D11RenderSystem&              renderSystem_;
 
         ComPtr<IDXGISwapChain>          swapChain_;
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || defined LLGL_OS_UWP
+        ComPtr<IDXGISwapChain1>         swapChain1_;                        // Only for flip-model swap-chains to present dirty rectangles.
+        std::vector<RECT>               dirtyRects_;
+        #endif
         UINT                            swapChainInterval_      = 0;
         DXGI_SAMPLE_DESC                swapChainSampleDesc_    = { 1, 0 };
         DXGI_FORMAT                     colorFormat_            = DXGI_FORMAT_UNKNOWN;
         DXGI_FORMAT                     depthStencilFormat_     = DXGI_FORMAT_UNKNOWN;
 
+        UINT                            maxFrameLatency_        = 0;        // Maximum frame latency for low-latency mode; 0 if disabled.
+        HANDLE                          frameLatencyWaitableObject_ = nullptr;
+        PresentMode                     presentMode_            = PresentMode::Default;
+
         ComPtr<ID3D11Texture2D>         colorBuffer_;
         ComPtr<ID3D11Texture2D>         colorBufferMS_;
         D3D11BindingLocator             colorBufferLocator_;
@@ -147,12 +147,13 @@ void D3D11BindingTable::SetShaderResourceViews(
         }
     }
 
-    if (LLGL_VS_STAGE(stageFlags)) { context_->VSSetShaderResources(startSlot, count, views); }
-    if (LLGL_HS_STAGE(stageFlags)) { context_->HSSetShaderResources(startSlot, count, views); }
-    if (LLGL_DS_STAGE(stageFlags)) { context_->DSSetShaderResources(startSlot, count, views); }
-    if (LLGL_GS_STAGE(stageFlags)) { context_->GSSetShaderResources(startSlot, count, views); }
-    if (LLGL_PS_STAGE(stageFlags)) { context_->PSSetShaderResources(startSlot, count, views); }
-    if (LLGL_CS_STAGE(stageFlags)) { context_->CSSetShaderResources(startSlot, count, views); }
+    /* Cache SRVs and bind them with the next draw or dispatch command to coalesce the slot ranges of all changed SRVs */
+    if (LLGL_VS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_VS, startSlot, count, views); }
+    if (LLGL_HS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_HS, startSlot, count, views); }
+    if (LLGL_DS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_DS, startSlot, count, views); }
+    if (LLGL_GS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_GS, startSlot, count, views); }
+    if (LLGL_PS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_PS, startSlot, count, views); }
+    if (LLGL_CS_STAGE(stageFlags)) { CacheShaderResourceViews(D3DStage_CS, startSlot, count, views); }
 }
 
 void D3D11BindingTable::SetUnorderedAccessViews(
@@ -253,6 +254,9 @@ void D3D11BindingTable::ClearState()
     ClearBindingLocators(uavPS_);
     ClearBindingLocators(uavCS_);
 
+    for (ShaderResourceViewCache& srvCache : srvCaches_)
+        srvCache.clear();
+
     /* Reset all resource counters */
     vbCount_        = 0;
     soCount_        = 0;
@@ -271,6 +275,21 @@ void D3D11BindingTable::FlushOutputMergerUAVs()
     }
 }
 
+void D3D11BindingTable::FlushShaderResourceViews(long stageFlags)
+{
+    if (LLGL_VS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_VS); }
+    if (LLGL_HS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_HS); }
+    if (LLGL_DS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_DS); }
+    if (LLGL_GS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_GS); }
+    if (LLGL_PS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_PS); }
+    if (LLGL_CS_STAGE(stageFlags)) { BindCachedShaderResourceViews(D3DStage_CS); }
+}
+
+void D3D11BindingTable::ResetStatistics()
+{
+    statistics_ = Statistics{};
+}
+
 
 /*
  * ======= Private: =======
@@ -595,8 +614,6 @@ void D3D11BindingTable::EvictMultipleSubresourceOutputBindings(D3D11BindingLocat
 void D3D11BindingTable::EvictSingleInputBinding(D3D11BindingLocator* locator)
 {
     const UINT slot = locator->inRangeBegin;
-    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
-
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0 && HasLocatorAt(vb_, slot, locator))
     {
         /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
@@ -612,42 +629,42 @@ void D3D11BindingTable::EvictSingleInputBinding(D3D11BindingLocator* locator)
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0 && HasLocatorAt(srvVS_, slot, locator))
     {
-        context_->VSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_VS, slot);
         if (RemoveSubresourceInput(srvVS_.locators, D3D11BindingLocator::D3DInput_SRV_VS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_HS)) != 0 && HasLocatorAt(srvHS_, slot, locator))
     {
-        context_->HSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_HS, slot);
         if (RemoveSubresourceInput(srvHS_.locators, D3D11BindingLocator::D3DInput_SRV_HS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_DS)) != 0 && HasLocatorAt(srvDS_, slot, locator))
     {
-        context_->DSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_DS, slot);
         if (RemoveSubresourceInput(srvDS_.locators, D3D11BindingLocator::D3DInput_SRV_DS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_GS)) != 0 && HasLocatorAt(srvGS_, slot, locator))
     {
-        context_->GSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_GS, slot);
         if (RemoveSubresourceInput(srvGS_.locators, D3D11BindingLocator::D3DInput_SRV_GS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_PS)) != 0 && HasLocatorAt(srvPS_, slot, locator))
     {
-        context_->PSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_PS, slot);
         if (RemoveSubresourceInput(srvPS_.locators, D3D11BindingLocator::D3DInput_SRV_PS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_CS)) != 0 && HasLocatorAt(srvCS_, slot, locator))
     {
-        context_->CSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_CS, slot);
         if (RemoveSubresourceInput(srvCS_.locators, D3D11BindingLocator::D3DInput_SRV_CS, slot))
             return;
     }
@@ -656,8 +673,6 @@ void D3D11BindingTable::EvictSingleInputBinding(D3D11BindingLocator* locator)
 void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange)
 {
     const UINT slot = locator->inRangeBegin;
-    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
-
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0 && HasLocatorAt(vb_, slot, locator))
     {
         /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
@@ -675,7 +690,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0 && HasLocatorAndRangesOverlapAt(srvVS_, slot, locator, subresourceRange))
     {
-        context_->VSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_VS, slot);
         if (RemoveSubresourceInput(srvVS_.locators, D3D11BindingLocator::D3DInput_SRV_VS, slot))
             return;
     }
@@ -683,7 +698,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_HS)) != 0 && HasLocatorAndRangesOverlapAt(srvHS_, slot, locator, subresourceRange))
     {
         LLGL_ASSERT(slot < srvHS_.size());
-        context_->HSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_HS, slot);
         if (RemoveSubresourceInput(srvHS_.locators, D3D11BindingLocator::D3DInput_SRV_HS, slot))
             return;
     }
@@ -691,7 +706,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_DS)) != 0 && HasLocatorAndRangesOverlapAt(srvDS_, slot, locator, subresourceRange))
     {
         LLGL_ASSERT(slot < srvDS_.size());
-        context_->DSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_DS, slot);
         if (RemoveSubresourceInput(srvDS_.locators, D3D11BindingLocator::D3DInput_SRV_DS, slot))
             return;
     }
@@ -699,7 +714,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_GS)) != 0 && HasLocatorAndRangesOverlapAt(srvGS_, slot, locator, subresourceRange))
     {
         LLGL_ASSERT(slot < srvGS_.size());
-        context_->GSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_GS, slot);
         if (RemoveSubresourceInput(srvGS_.locators, D3D11BindingLocator::D3DInput_SRV_GS, slot))
             return;
     }
@@ -707,7 +722,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_PS)) != 0 && HasLocatorAndRangesOverlapAt(srvPS_, slot, locator, subresourceRange))
     {
         LLGL_ASSERT(slot < srvPS_.size());
-        context_->PSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_PS, slot);
         if (RemoveSubresourceInput(srvPS_.locators, D3D11BindingLocator::D3DInput_SRV_PS, slot))
             return;
     }
@@ -715,7 +730,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_CS)) != 0 && HasLocatorAndRangesOverlapAt(srvCS_, slot, locator, subresourceRange))
     {
         LLGL_ASSERT(slot < srvCS_.size());
-        context_->CSSetShaderResources(slot, 1, nullSRVs);
+        UnbindShaderResourceView(D3DStage_CS, slot);
         if (RemoveSubresourceInput(srvCS_.locators, D3D11BindingLocator::D3DInput_SRV_CS, slot))
             return;
     }
@@ -723,7 +738,6 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
 
 void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
 {
-    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0)
     {
@@ -757,7 +771,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvVS_.locators[slot] == locator)
             {
-                context_->VSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_VS, slot);
                 srvVS_.locators[slot] = nullptr;
             }
         }
@@ -771,7 +785,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvHS_.locators[slot] == locator)
             {
-                context_->HSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_HS, slot);
                 srvHS_.locators[slot] = nullptr;
             }
         }
@@ -785,7 +799,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvDS_.locators[slot] == locator)
             {
-                context_->DSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_DS, slot);
                 srvDS_.locators[slot] = nullptr;
             }
         }
@@ -799,7 +813,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvGS_.locators[slot] == locator)
             {
-                context_->GSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_GS, slot);
                 srvGS_.locators[slot] = nullptr;
             }
         }
@@ -813,7 +827,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvPS_.locators[slot] == locator)
             {
-                context_->PSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_PS, slot);
                 srvPS_.locators[slot] = nullptr;
             }
         }
@@ -827,7 +841,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         {
             if (srvCS_.locators[slot] == locator)
             {
-                context_->CSSetShaderResources(slot, 1, nullSRVs);
+                UnbindShaderResourceView(D3DStage_CS, slot);
                 srvCS_.locators[slot] = nullptr;
             }
         }
@@ -838,7 +852,6 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
 
 void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange)
 {
-    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0)
     {
@@ -875,7 +888,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvVS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->VSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_VS, slot);
                     srvVS_.locators[slot] = nullptr;
                 }
                 else
@@ -898,7 +911,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvHS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->HSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_HS, slot);
                     srvHS_.locators[slot] = nullptr;
                 }
                 else
@@ -921,7 +934,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvDS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->DSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_DS, slot);
                     srvDS_.locators[slot] = nullptr;
                 }
                 else
@@ -944,7 +957,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvGS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->GSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_GS, slot);
                     srvGS_.locators[slot] = nullptr;
                 }
                 else
@@ -967,7 +980,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvPS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->PSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_PS, slot);
                     srvPS_.locators[slot] = nullptr;
                 }
                 else
@@ -990,7 +1003,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
             {
                 if (D3D11SubresourceRange::Overlap(srvCS_.subresourceRanges[slot], subresourceRange))
                 {
-                    context_->CSSetShaderResources(slot, 1, nullSRVs);
+                    UnbindShaderResourceView(D3DStage_CS, slot);
                     srvCS_.locators[slot] = nullptr;
                 }
                 else
@@ -1086,6 +1099,69 @@ void D3D11BindingTable::BindCachedOutputMergerUAVs()
     );
 }
 
+void D3D11BindingTable::CacheShaderResourceViews(D3DShaderStage stage, UINT startSlot, UINT count, ID3D11ShaderResourceView* const * views)
+{
+    ShaderResourceViewCache& srvCache = srvCaches_[stage];
+    for_range(i, count)
+    {
+        const UINT slot = startSlot + i;
+        if (srvCache.views[slot] != views[i])
+        {
+            srvCache.views[slot] = views[i];
+            srvCache.invalidate(slot, slot + 1);
+        }
+        else
+            ++statistics_.numSRVBindsSkipped;
+    }
+}
+
+void D3D11BindingTable::BindCachedShaderResourceViews(D3DShaderStage stage)
+{
+    ShaderResourceViewCache& srvCache = srvCaches_[stage];
+    if (srvCache.dirtyBegin < srvCache.dirtyEnd)
+    {
+        const UINT startSlot    = srvCache.dirtyBegin;
+        const UINT numViews     = srvCache.dirtyEnd - srvCache.dirtyBegin;
+        ID3D11ShaderResourceView* const * views = &(srvCache.views[startSlot]);
+
+        switch (stage)
+        {
+            case D3DStage_VS: context_->VSSetShaderResources(startSlot, numViews, views); break;
+            case D3DStage_HS: context_->HSSetShaderResources(startSlot, numViews, views); break;
+            case D3DStage_DS: context_->DSSetShaderResources(startSlot, numViews, views); break;
+            case D3DStage_GS: context_->GSSetShaderResources(startSlot, numViews, views); break;
+            case D3DStage_PS: context_->PSSetShaderResources(startSlot, numViews, views); break;
+            case D3DStage_CS: context_->CSSetShaderResources(startSlot, numViews, views); break;
+            default:                                                                          break;
+        }
+        ++statistics_.numSRVBindsIssued;
+
+        srvCache.dirtyBegin = D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT;
+        srvCache.dirtyEnd   = 0;
+    }
+}
+
+void D3D11BindingTable::UnbindShaderResourceView(D3DShaderStage stage, UINT slot)
+{
+    /*
+    Evicted SRVs must be unbound immediately, because the resource is about to be bound as output.
+    The cached SRV is also cleared, so a pending range that contains this slot will not bind the evicted SRV again.
+    */
+    srvCaches_[stage].views[slot] = nullptr;
+    ID3D11ShaderResourceView* nullSRVs[1] = { nullptr };
+    switch (stage)
+    {
+        case D3DStage_VS: context_->VSSetShaderResources(slot, 1, nullSRVs); break;
+        case D3DStage_HS: context_->HSSetShaderResources(slot, 1, nullSRVs); break;
+        case D3DStage_DS: context_->DSSetShaderResources(slot, 1, nullSRVs); break;
+        case D3DStage_GS: context_->GSSetShaderResources(slot, 1, nullSRVs); break;
+        case D3DStage_PS: context_->PSSetShaderResources(slot, 1, nullSRVs); break;
+        case D3DStage_CS: context_->CSSetShaderResources(slot, 1, nullSRVs); break;
+        default:                                                             break;
+    }
+    ++statistics_.numSRVBindsIssued;
+}
+
 
 } // /namespace LLGL
 
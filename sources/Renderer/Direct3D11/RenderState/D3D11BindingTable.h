@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
+#include <algorithm>
 
 
 namespace LLGL
@@ -104,6 +105,27 @@ class D3D11BindingTable
         // Binds all pending output merger UAVs to the device context if they have previosuly changed.
         void FlushOutputMergerUAVs();
 
+        // Binds all pending SRVs of the specified shader stages to the device context with a single call per stage for the range of changed slots.
+        void FlushShaderResourceViews(long stageFlags);
+
+    public:
+
+        // Counters for the redundant binding elimination of SRVs.
+        struct Statistics
+        {
+            std::uint64_t numSRVBindsIssued     = 0; // Number of *SetShaderResources calls issued to the device context.
+            std::uint64_t numSRVBindsSkipped    = 0; // Number of SRV slots that were skipped because they were already bound.
+        };
+
+        // Returns the binding statistics since construction or the last call to ResetStatistics().
+        inline const Statistics& GetStatistics() const
+        {
+            return statistics_;
+        }
+
+        // Resets the binding statistics.
+        void ResetStatistics();
+
     private:
 
         using D3D11BindingLocatorIterator = SparseForwardIterator<D3D11BindingLocator*>;
@@ -162,6 +184,40 @@ class D3D11BindingTable
             D3D11SubresourceRange   subresourceRanges[Size] = {}; // Ranges to determine overlaps between SRV and UAV subresources of the same parent resource
         };
 
+        // Shader stages that have their own SRV slots.
+        enum D3DShaderStage
+        {
+            D3DStage_VS = 0,
+            D3DStage_HS,
+            D3DStage_DS,
+            D3DStage_GS,
+            D3DStage_PS,
+            D3DStage_CS,
+
+            D3DStage_Count,
+        };
+
+        // Pending SRVs of a shader stage and the range of slots that have changed since the last flush.
+        struct ShaderResourceViewCache
+        {
+            void clear()
+            {
+                std::memset(views, 0, sizeof(views));
+                dirtyBegin  = D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT;
+                dirtyEnd    = 0;
+            }
+
+            void invalidate(UINT begin, UINT end)
+            {
+                dirtyBegin  = (std::min)(dirtyBegin, begin);
+                dirtyEnd    = (std::max)(dirtyEnd, end);
+            }
+
+            ID3D11ShaderResourceView*   views[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {};
+            UINT                        dirtyBegin                                          = D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT;
+            UINT                        dirtyEnd                                            = 0;
+        };
+
     private:
 
         void InsertInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot, D3D11BindingLocator* locator);
@@ -207,6 +263,10 @@ class D3D11BindingTable
 
         void BindCachedOutputMergerUAVs();
 
+        void CacheShaderResourceViews(D3DShaderStage stage, UINT startSlot, UINT count, ID3D11ShaderResourceView* const * views);
+        void BindCachedShaderResourceViews(D3DShaderStage stage);
+        void UnbindShaderResourceView(D3DShaderStage stage, UINT slot);
+
         template <typename TContainer>
         void ClearBindingLocators(TContainer& container)
         {
@@ -255,6 +315,10 @@ class D3D11BindingTable
         UINT                                                                        soCount_                                    = 0;
         UINT                                                                        rtvCount_                                   = 0;
 
+        ShaderResourceViewCache                                                     srvCaches_[D3DStage_Count];
+
+        Statistics                                                                  statistics_;
+
         UINT                                                                        omUAVStartSlot_ : 15;
         UINT                                                                        omNumUAVs_      : 16; // Number of UAVs for the output-merger stage
         UINT                                                                        omUAVDirtyBit_  : 1;
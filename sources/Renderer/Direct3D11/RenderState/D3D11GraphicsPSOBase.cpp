@@ -57,7 +57,11 @@ D3D11GraphicsPSOBase::D3D11GraphicsPSOBase(const GraphicsPipelineDescriptor& des
 {
     /* Validate pointers and get D3D shader objects */
     if (auto* vertexShaderD3D = LLGL_CAST(const D3D11Shader*, desc.vertexShader))
-        inputLayout_ = vertexShaderD3D->GetInputLayout();
+    {
+        /* Vertex pulling fetches all attributes from storage buffers, so no input layout is bound */
+        if (desc.vertexStreams.empty())
+            inputLayout_ = vertexShaderD3D->GetInputLayout();
+    }
     else
         ResetReport("cannot create D3D graphics PSO without vertex shader", true);
 
@@ -9,6 +9,8 @@
 #include "../D3D11Types.h"
 #include "../D3D11ObjectUtils.h"
 #include "../../DXCommon/DXCore.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -35,58 +37,92 @@ static ComPtr<ID3D11Predicate> DXCreatePredicate(ID3D11Device* device, const D3D
     return predicate;
 }
 
-static std::uint32_t GetDXQueryGroupSize(D3D11_QUERY queryType)
+static ComPtr<ID3D11Query> DXCreateQueryWithType(ID3D11Device* device, D3D11_QUERY queryType)
 {
-    /* For timestamp, use group size of 3: one primary and two secondary <ID3D11Query> objects */
-    if (queryType == D3D11_QUERY_TIMESTAMP_DISJOINT)
-        return 3u;
-    else
-        return 1u;
+    D3D11_QUERY_DESC queryDesc;
+    {
+        queryDesc.Query     = queryType;
+        queryDesc.MiscFlags = 0;
+    }
+    return DXCreateQuery(device, queryDesc);
 }
 
-D3D11QueryHeap::D3D11QueryHeap(ID3D11Device* device, const QueryHeapDescriptor& desc) :
-    QueryHeap   { desc.type                        },
-    nativeType_ { D3D11Types::Map(desc.type)       },
-    groupSize_  { GetDXQueryGroupSize(nativeType_) }
+
+/*
+ * D3D11TimestampDisjointPool class
+ */
+
+D3D11TimestampDisjointPool::D3D11TimestampDisjointPool(ID3D11Device* device) :
+    device_ { device }
 {
-    /* Allocate native queries and initialize descriptor for primary query */
-    const std::uint32_t numNativeQueries = groupSize_ * desc.numQueries;
-    nativeQueries_.reserve(numNativeQueries);
+}
 
-    D3D11_QUERY_DESC queryDesc;
+D3D11TimestampDisjointPtr D3D11TimestampDisjointPool::Acquire()
+{
+    /* Reuse disjoint query that is only referenced by this pool */
+    for (const D3D11TimestampDisjointPtr& disjoint : disjoints_)
     {
-        queryDesc.Query     = nativeType_;
-        queryDesc.MiscFlags = (desc.renderCondition ? D3D11_QUERY_MISC_PREDICATEHINT : 0);
+        if (disjoint.use_count() == 1)
+        {
+            disjoint->hasResult = false;
+            return disjoint;
+        }
     }
 
-    if (nativeType_ == D3D11_QUERY_OCCLUSION_PREDICATE || nativeType_ == D3D11_QUERY_SO_OVERFLOW_PREDICATE)
+    /* Create new disjoint query */
+    auto disjoint = std::make_shared<D3D11TimestampDisjoint>();
+    disjoint->query = DXCreateQueryWithType(device_, D3D11_QUERY_TIMESTAMP_DISJOINT);
+    disjoints_.push_back(disjoint);
+    return disjoint;
+}
+
+
+/*
+ * D3D11QueryHeap class
+ */
+
+D3D11QueryHeap::D3D11QueryHeap(ID3D11Device* device, const QueryHeapDescriptor& desc) :
+    QueryHeap   { desc.type                  },
+    nativeType_ { D3D11Types::Map(desc.type) }
+{
+    if (nativeType_ == D3D11_QUERY_TIMESTAMP_DISJOINT)
     {
-        /* Create predicate queries */
-        for (std::uint32_t i = 0; i < numNativeQueries; i += groupSize_)
-            nativeQueries_.push_back(DXCreatePredicate(device, queryDesc));
+        /*
+        Create timestamp pairs for all frames of each timer query.
+        The disjoint queries are shared between all timer queries of a command buffer, see D3D11TimestampDisjointPool.
+        */
+        timerQueries_.resize(desc.numQueries);
+        for (TimerQuery& timerQuery : timerQueries_)
+        {
+            for (TimerQueryFrame& frame : timerQuery.frames)
+            {
+                frame.beginTimestamp    = DXCreateQueryWithType(device, D3D11_QUERY_TIMESTAMP);
+                frame.endTimestamp      = DXCreateQueryWithType(device, D3D11_QUERY_TIMESTAMP);
+            }
+        }
     }
-    else if (nativeType_ == D3D11_QUERY_TIMESTAMP_DISJOINT)
+    else
     {
-        D3D11_QUERY_DESC timerQueryDesc;
+        /* Allocate native queries and initialize descriptor for primary query */
+        nativeQueries_.reserve(desc.numQueries);
+
+        D3D11_QUERY_DESC queryDesc;
         {
-            timerQueryDesc.Query        = D3D11_QUERY_TIMESTAMP;
-            timerQueryDesc.MiscFlags    = 0;
+            queryDesc.Query     = nativeType_;
+            queryDesc.MiscFlags = (desc.renderCondition ? D3D11_QUERY_MISC_PREDICATEHINT : 0);
         }
 
-        for (std::uint32_t i = 0; i < numNativeQueries; i += groupSize_)
+        if (nativeType_ == D3D11_QUERY_OCCLUSION_PREDICATE || nativeType_ == D3D11_QUERY_SO_OVERFLOW_PREDICATE)
         {
-            /* Create primary query object */
-            nativeQueries_.push_back(DXCreateQuery(device, queryDesc));
-
-            /* Create secondary query objects */
-            nativeQueries_.push_back(DXCreateQuery(device, timerQueryDesc));
-            nativeQueries_.push_back(DXCreateQuery(device, timerQueryDesc));
+            /* Create predicate queries */
+            for_range(i, desc.numQueries)
+                nativeQueries_.push_back(DXCreatePredicate(device, queryDesc));
+        }
+        else
+        {
+            for_range(i, desc.numQueries)
+                nativeQueries_.push_back(DXCreateQuery(device, queryDesc));
         }
-    }
-    else
-    {
-        for (std::uint32_t i = 0; i < numNativeQueries; i += groupSize_)
-            nativeQueries_.push_back(DXCreateQuery(device, queryDesc));
     }
 
     if (desc.debugName != nullptr)
@@ -95,7 +131,20 @@ D3D11QueryHeap::D3D11QueryHeap(ID3D11Device* device, const QueryHeapDescriptor&
 
 void D3D11QueryHeap::SetDebugName(const char* name)
 {
-    if (nativeQueries_.size() == 1)
+    if (!timerQueries_.empty())
+    {
+        /* Set label for each timestamp query object */
+        std::uint32_t index = 0;
+        for (TimerQuery& timerQuery : timerQueries_)
+        {
+            for (TimerQueryFrame& frame : timerQuery.frames)
+            {
+                D3D11SetObjectNameIndexed(frame.beginTimestamp.Get(), name, index++);
+                D3D11SetObjectNameIndexed(frame.endTimestamp.Get(), name, index++);
+            }
+        }
+    }
+    else if (nativeQueries_.size() == 1)
     {
         /* Set label for a single native query object */
         D3D11SetObjectName(GetNative(0), name);
@@ -108,6 +157,96 @@ void D3D11QueryHeap::SetDebugName(const char* name)
     }
 }
 
+void D3D11QueryHeap::BeginTimerQuery(ID3D11DeviceContext* context, std::uint32_t query, const D3D11TimestampDisjointPtr& disjoint)
+{
+    TimerQuery& timerQuery = timerQueries_[query];
+    TimerQueryFrame& frame = timerQuery.frames[timerQuery.numFramesIssued % numTimerQueryFrames];
+    ++timerQuery.numFramesIssued;
+
+    /* Overwrite oldest frame, whose result is dropped if it has not been queried yet */
+    frame.disjoint = disjoint;
+    context->End(frame.beginTimestamp.Get());
+}
+
+void D3D11QueryHeap::EndTimerQuery(ID3D11DeviceContext* context, std::uint32_t query)
+{
+    const TimerQuery& timerQuery = timerQueries_[query];
+    if (timerQuery.numFramesIssued > 0)
+    {
+        const TimerQueryFrame& frame = timerQuery.frames[(timerQuery.numFramesIssued - 1) % numTimerQueryFrames];
+        context->End(frame.endTimestamp.Get());
+    }
+}
+
+bool D3D11QueryHeap::QueryTimerResult(ID3D11DeviceContext* context, std::uint32_t query, std::uint64_t& outElapsedTime)
+{
+    const TimerQuery& timerQuery = timerQueries_[query];
+    const std::uint64_t numFrames = std::min<std::uint64_t>(timerQuery.numFramesIssued, numTimerQueryFrames);
+
+    /* Search frames from newest to oldest; only the newest frame may flush the command buffer, all older frames have been submitted already */
+    for (std::uint64_t i = 0; i < numFrames; ++i)
+    {
+        const TimerQueryFrame& frame = timerQuery.frames[(timerQuery.numFramesIssued - 1 - i) % numTimerQueryFrames];
+        const UINT getDataFlags = (i == 0 ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (GetTimerQueryFrameResult(context, frame, getDataFlags, outElapsedTime))
+            return true;
+    }
+
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D11QueryHeap::GetTimerQueryFrameResult(
+    ID3D11DeviceContext*    context,
+    const TimerQueryFrame&  frame,
+    UINT                    getDataFlags,
+    std::uint64_t&          outElapsedTime)
+{
+    if (!frame.disjoint)
+        return false;
+
+    UINT64 startTime = 0;
+    if (context->GetData(frame.beginTimestamp.Get(), &startTime, sizeof(startTime), getDataFlags) != S_OK)
+        return false;
+
+    UINT64 endTime = 0;
+    if (context->GetData(frame.endTimestamp.Get(), &endTime, sizeof(endTime), getDataFlags) != S_OK)
+        return false;
+
+    /* Query disjoint data only once, since it is shared between all timer queries of the same command buffer */
+    D3D11TimestampDisjoint& disjoint = *frame.disjoint;
+    if (!disjoint.hasResult)
+    {
+        if (context->GetData(disjoint.query.Get(), &disjoint.result, sizeof(disjoint.result), getDataFlags) != S_OK)
+            return false;
+        disjoint.hasResult = true;
+    }
+
+    if (disjoint.result.Disjoint == FALSE)
+    {
+        /* Normalize elapsed time to nanoseconds */
+        static const UINT64 nanosecondFrequency = 1000000000;
+
+        const auto deltaTime = (endTime - startTime);
+        if (disjoint.result.Frequency != nanosecondFrequency)
+        {
+            const auto scale        = (static_cast<double>(nanosecondFrequency) / static_cast<double>(disjoint.result.Frequency));
+            const auto elapsedTime  = (static_cast<double>(deltaTime) * scale);
+            outElapsedTime = static_cast<std::uint64_t>(elapsedTime + 0.5);
+        }
+        else
+            outElapsedTime = deltaTime;
+    }
+    else
+        outElapsedTime = 0;
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
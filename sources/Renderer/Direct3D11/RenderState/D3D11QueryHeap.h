@@ -13,6 +13,7 @@
 #include "../../DXCommon/ComPtr.h"
 #include <d3d11.h>
 #include <vector>
+#include <memory>
 #include <cstdint>
 
 
@@ -46,9 +47,45 @@ union D3D11NativeQuery
     ComPtr<ID3D11Predicate> predicate;
 };
 
+// Timestamp disjoint query that is shared between all timer queries that are encoded within the same command buffer.
+struct D3D11TimestampDisjoint
+{
+    ComPtr<ID3D11Query>                 query;
+    bool                                hasResult   = false;
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT result      = {};
+};
+
+using D3D11TimestampDisjointPtr = std::shared_ptr<D3D11TimestampDisjoint>;
+
+// Pool of timestamp disjoint queries. A disjoint query is reused once no timer query refers to it anymore.
+class D3D11TimestampDisjointPool
+{
+
+    public:
+
+        D3D11TimestampDisjointPool(ID3D11Device* device);
+
+        // Returns an unreferenced disjoint query or creates a new one. The previous result of a reused query is discarded.
+        D3D11TimestampDisjointPtr Acquire();
+
+    private:
+
+        ID3D11Device*                           device_     = nullptr;
+        std::vector<D3D11TimestampDisjointPtr>  disjoints_;
+
+};
+
 class D3D11QueryHeap final : public QueryHeap
 {
 
+    public:
+
+        /*
+        Number of frames each timer query can be in flight.
+        Every BeginQuery advances a timer query to its next timestamp pair, so it can be issued again before the previous results are available.
+        */
+        static constexpr std::uint32_t numTimerQueryFrames = 3;
+
     public:
 
         void SetDebugName(const char* name) override;
@@ -75,17 +112,42 @@ class D3D11QueryHeap final : public QueryHeap
             return nativeQueries_[query].predicate.Get();
         }
 
-        // Returns the number of queries within a group.
-        inline std::uint32_t GetGroupSize() const
+        // Advances the specified timer query to its next frame and inserts the beginning timestamp.
+        void BeginTimerQuery(ID3D11DeviceContext* context, std::uint32_t query, const D3D11TimestampDisjointPtr& disjoint);
+
+        // Inserts the ending timestamp of the current frame of the specified timer query.
+        void EndTimerQuery(ID3D11DeviceContext* context, std::uint32_t query);
+
+        /*
+        Returns the elapsed time (in nanoseconds) of the most recent frame of the specified timer query whose results are available.
+        This never waits for the GPU, i.e. it returns false if none of the frames in flight are available yet.
+        */
+        bool QueryTimerResult(ID3D11DeviceContext* context, std::uint32_t query, std::uint64_t& outElapsedTime);
+
+    private:
+
+        struct TimerQueryFrame
         {
-            return groupSize_;
-        }
+            ComPtr<ID3D11Query>         beginTimestamp;
+            ComPtr<ID3D11Query>         endTimestamp;
+            D3D11TimestampDisjointPtr   disjoint;
+        };
+
+        struct TimerQuery
+        {
+            TimerQueryFrame             frames[numTimerQueryFrames];
+            std::uint64_t               numFramesIssued = 0;
+        };
+
+    private:
+
+        bool GetTimerQueryFrameResult(ID3D11DeviceContext* context, const TimerQueryFrame& frame, UINT getDataFlags, std::uint64_t& outElapsedTime);
 
     private:
 
         D3D11_QUERY                     nativeType_     = D3D11_QUERY_EVENT;
-        std::uint32_t                   groupSize_      = 1;
         std::vector<D3D11NativeQuery>   nativeQueries_;
+        std::vector<TimerQuery>         timerQueries_;  // Only used for D3D11_QUERY_TIMESTAMP_DISJOINT
 
 };
 
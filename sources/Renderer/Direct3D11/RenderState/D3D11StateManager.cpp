@@ -9,6 +9,7 @@
 #include "../Texture/D3D11Sampler.h"
 #include "../../../Core/MacroUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <cstddef>
@@ -19,6 +20,8 @@ namespace LLGL
 
 
 static constexpr UINT g_cbufferChunkSize = 4096u;
+static constexpr UINT g_cbufferRingSize  = 1024u*1024u;
+static constexpr UINT g_readbackChunkSize = 64u*1024u;
 
 D3D11StateManager::D3D11StateManager(ID3D11Device* device, const ComPtr<ID3D11DeviceContext>& context) :
     context_ { context },
@@ -31,10 +34,22 @@ D3D11StateManager::D3D11StateManager(ID3D11Device* device, const ComPtr<ID3D11De
         D3D11_CPU_ACCESS_WRITE,
         D3D11_BIND_CONSTANT_BUFFER
     },
+    readbackBufferPool_
+    {
+        device,
+        context.Get(),
+        g_readbackChunkSize,
+        D3D11_USAGE_STAGING,
+        D3D11_CPU_ACCESS_READ
+    },
     bindingTable_ { context }
 {
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
     context_->QueryInterface(IID_PPV_ARGS(&context1_));
+
+    /* Sub-allocate all intermediate constant buffers from a single ring buffer if buffer ranges can be mapped without overwrite */
+    if (context1_ != nullptr && D3D11ConstantRingBuffer::IsSupported(device))
+        cbufferRing_ = MakeUnique<D3D11ConstantRingBuffer>(device, g_cbufferRingSize);
     #endif
 }
 
@@ -357,7 +372,12 @@ void D3D11StateManager::SetConstants(UINT slot, const void* data, UINT dataSize,
 {
     /* Write data to intermediate constant buffer */
     constexpr UINT cbufferUpdateAlignment = 16*16;
-    auto bufferRange = stagingCbufferPool_.Write(data, dataSize, cbufferUpdateAlignment);
+    const D3D11BufferRange bufferRange =
+    (
+        cbufferRing_
+            ? cbufferRing_->Write(context_.Get(), data, dataSize)
+            : stagingCbufferPool_.Write(data, dataSize, cbufferUpdateAlignment)
+    );
 
     /* Bind intermediate buffer to buffer range */
     ID3D11Buffer* buffers[]        = { bufferRange.native };
@@ -378,6 +398,16 @@ void D3D11StateManager::DispatchBuiltin(const D3D11BuiltinShader builtinShader,
 void D3D11StateManager::ResetStagingBufferPools()
 {
     stagingCbufferPool_.Reset();
+    if (cbufferRing_)
+        cbufferRing_->Reset();
+}
+
+UINT64 D3D11StateManager::GetStagingBufferPoolsSize() const
+{
+    UINT64 totalSize = stagingCbufferPool_.GetTotalSize() + readbackBufferPool_.GetTotalSize();
+    if (cbufferRing_)
+        totalSize += cbufferRing_->GetSize();
+    return totalSize;
 }
 
 void D3D11StateManager::ClearState()
@@ -13,9 +13,11 @@
 #include "../Direct3D11.h"
 #include "../Shader/D3D11BuiltinShaderFactory.h"
 #include "../Buffer/D3D11StagingBufferPool.h"
+#include "../Buffer/D3D11ConstantRingBuffer.h"
 #include "../../DXCommon/ComPtr.h"
 #include <LLGL/PipelineStateFlags.h>
 #include <vector>
+#include <memory>
 #include <cstdint>
 
 
@@ -90,6 +92,15 @@ class D3D11StateManager
         // Must be called in D3D11CommandBuffer::Begin().
         void ResetStagingBufferPools();
 
+        // Returns the total size (in bytes) of all staging buffer pools.
+        UINT64 GetStagingBufferPoolsSize() const;
+
+        // Returns the pool of staging buffers with CPU read access that is used to read back buffer content.
+        inline D3D11StagingBufferPool& GetReadbackBufferPool()
+        {
+            return readbackBufferPool_;
+        }
+
         // Invokes ClearState() on the device context and invalidates all caches.
         void ClearState();
 
@@ -142,6 +153,8 @@ class D3D11StateManager
         #endif
 
         D3D11StagingBufferPool          stagingCbufferPool_;
+        std::unique_ptr<D3D11ConstantRingBuffer> cbufferRing_;
+        D3D11StagingBufferPool          readbackBufferPool_;
 
         D3DInputAssemblyState           inputAssemblyState_;
         D3DShaderState                  shaderState_;
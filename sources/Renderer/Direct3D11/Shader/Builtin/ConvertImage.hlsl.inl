@@ -0,0 +1,97 @@
+/*
+ * ConvertImage.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+HLSL source of the image conversion kernel for cs_5_0.
+This is compiled on first use by D3D11ImageConverter to convert image data from a raw buffer into a texture with a different format.
+Each thread reads one source pixel, normalizes its components to float4, and writes it to the destination texture via typed UAV store.
+*/
+static const char* g_ConvertImage_HLSL = R"(
+
+#define DATATYPE_UNORM8     0
+#define DATATYPE_UNORM16    1
+#define DATATYPE_FLOAT16    2
+#define DATATYPE_FLOAT32    3
+
+#define SWIZZLE_RGBA        0
+#define SWIZZLE_BGRA        1
+#define SWIZZLE_ARGB        2
+#define SWIZZLE_ABGR        3
+
+cbuffer ConvertDescriptor : register(b0)
+{
+    uint3   dstOffset;      // Destination offset (x, y, array layer)
+    uint    srcComponents;  // Number of source components: 1 to 4
+    uint3   extent;         // Extent of the region to convert (x, y, array layers)
+    uint    srcDataType;    // Source data type: DATATYPE_*
+    uint    srcSwizzle;     // Source component order: SWIZZLE_*
+    uint3   pad0;
+};
+
+ByteAddressBuffer           srcBuffer   : register(t0);
+RWTexture2DArray<float4>    dstTexture  : register(u0);
+
+uint GetDataTypeSize()
+{
+    switch (srcDataType)
+    {
+        case DATATYPE_UNORM8:   return 1;
+        case DATATYPE_UNORM16:  return 2;
+        case DATATYPE_FLOAT16:  return 2;
+        default:                return 4;
+    }
+}
+
+float ReadComponent(uint addr)
+{
+    /* Read DWORD that contains the component; components never straddle DWORD boundaries */
+    uint value = srcBuffer.Load(addr & ~3u) >> ((addr & 3u) * 8u);
+
+    switch (srcDataType)
+    {
+        case DATATYPE_UNORM8:   return float(value & 0xFFu) / 255.0;
+        case DATATYPE_UNORM16:  return float(value & 0xFFFFu) / 65535.0;
+        case DATATYPE_FLOAT16:  return f16tof32(value & 0xFFFFu);
+        default:                return asfloat(value);
+    }
+}
+
+[numthreads(8, 8, 1)]
+void ConvertImage(uint3 threadID : SV_DispatchThreadID)
+{
+    if (any(threadID >= extent))
+        return;
+
+    /* Read source components; missing components default to (0, 0, 0, 1) */
+    uint    size    = GetDataTypeSize();
+    uint    addr    = ((threadID.z * extent.y + threadID.y) * extent.x + threadID.x) * srcComponents * size;
+    float4  src     = float4(0.0, 0.0, 0.0, 1.0);
+
+    [unroll]
+    for (uint i = 0; i < 4; ++i)
+    {
+        if (i < srcComponents)
+            src[i] = ReadComponent(addr + i * size);
+    }
+
+    /* Reorder source components into RGBA */
+    float4 color = src;
+    switch (srcSwizzle)
+    {
+        case SWIZZLE_BGRA: color = src.bgra; break;
+        case SWIZZLE_ARGB: color = src.gbar; break;
+        case SWIZZLE_ABGR: color = src.abgr; break;
+    }
+
+    dstTexture[dstOffset + threadID] = color;
+}
+
+)";
+
+
+
+// ================================================================================
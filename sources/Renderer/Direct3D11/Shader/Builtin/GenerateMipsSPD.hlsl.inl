@@ -0,0 +1,181 @@
+/*
+ * GenerateMipsSPD.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+HLSL source of the single-pass MIP-map downsampler (SPD) for cs_5_0.
+This is compiled on first use by D3D11MipGenerator, since it is only used for textures with UAV support on feature level 11.1.
+Each work group reduces a 64x64 tile of the source MIP-map to a single texel, i.e. it writes the next 6 MIP-maps of its tile.
+The last work group of each array layer (determined by a global atomic counter) reduces the remaining 6 MIP-maps.
+*/
+static const char* g_GenerateMipsSPD_HLSL = R"(
+
+#define SPD_MAX_MIPS 12
+
+cbuffer SPDDescriptor : register(b0)
+{
+    uint2   srcExtent;      // Extent of the source MIP-map
+    uint    numMips;        // Number of destination MIP-maps: 1 to SPD_MAX_MIPS
+    uint    numWorkGroups;  // Number of work groups per array layer
+    uint    numWorkGroupsX; // Number of work groups in X direction
+    uint3   pad0;
+};
+
+Texture2DArray<float4>                      srcMip                  : register(t0);
+RWTexture2DArray<float4>                    dstMips[SPD_MAX_MIPS]   : register(u0);
+globallycoherent RWStructuredBuffer<float4> midMip                  : register(u12); // MIP-map 6 texels, one per work group
+globallycoherent RWByteAddressBuffer        counters                : register(u13); // Work group counter per array layer
+
+groupshared float4  tile[16][16];
+groupshared bool    isLastWorkGroup;
+
+uint2 GetMipExtent(uint level)
+{
+    return max(uint2(1, 1), srcExtent >> level);
+}
+
+void StoreMip(uint level, uint3 pos, float4 value)
+{
+    switch (level)
+    {
+        case  1: dstMips[ 0][pos] = value; break;
+        case  2: dstMips[ 1][pos] = value; break;
+        case  3: dstMips[ 2][pos] = value; break;
+        case  4: dstMips[ 3][pos] = value; break;
+        case  5: dstMips[ 4][pos] = value; break;
+        case  6: dstMips[ 5][pos] = value; break;
+        case  7: dstMips[ 6][pos] = value; break;
+        case  8: dstMips[ 7][pos] = value; break;
+        case  9: dstMips[ 8][pos] = value; break;
+        case 10: dstMips[ 9][pos] = value; break;
+        case 11: dstMips[10][pos] = value; break;
+        case 12: dstMips[11][pos] = value; break;
+    }
+}
+
+float4 LoadTexel(uint level, uint2 pos, uint layer)
+{
+    pos = min(pos, GetMipExtent(level) - 1);
+    if (level == 0)
+        return srcMip.Load(int4(pos, layer, 0));
+    else
+        return midMip[layer * numWorkGroups + pos.y * numWorkGroupsX + pos.x];
+}
+
+// Returns the average of the 2x2 texels of the previous MIP-map for the texel at 'pos' of MIP-map 'srcLevel + 1'
+float4 ReduceTexel(uint srcLevel, uint2 pos, uint layer)
+{
+    pos = min(pos, GetMipExtent(srcLevel + 1) - 1) * 2;
+    return
+    (
+        LoadTexel(srcLevel, pos + uint2(0, 0), layer) +
+        LoadTexel(srcLevel, pos + uint2(1, 0), layer) +
+        LoadTexel(srcLevel, pos + uint2(0, 1), layer) +
+        LoadTexel(srcLevel, pos + uint2(1, 1), layer)
+    ) * 0.25;
+}
+
+// Returns the average of the 2x2 texels in the group-shared tile for the texel at 'pos' of MIP-map 'level'
+float4 ReduceTileTexel(uint level, uint2 pos, uint2 tileOrigin)
+{
+    uint2 prevExtent = GetMipExtent(level - 1);
+    uint2 p0 = min(pos * 2,     prevExtent - 1) - tileOrigin;
+    uint2 p1 = min(pos * 2 + 1, prevExtent - 1) - tileOrigin;
+    return (tile[p0.y][p0.x] + tile[p0.y][p1.x] + tile[p1.y][p0.x] + tile[p1.y][p1.x]) * 0.25;
+}
+
+// Reduces the 64x64 tile 'tileId' of MIP-map 'srcLevel' down to MIP-map 'srcLevel + 6'
+void ReduceTile(uint srcLevel, uint2 tileId, uint layer, uint localIndex)
+{
+    uint2 localPos = uint2(localIndex % 16, localIndex / 16);
+
+    /* Reduce 2x2 texels of MIP-map 'srcLevel + 1' and store their average for MIP-map 'srcLevel + 2' in group-shared memory */
+    uint2   pos1    = (tileId * 16 + localPos) * 2;
+    uint2   extent1 = GetMipExtent(srcLevel + 1);
+    float4  sum     = 0;
+
+    [unroll]
+    for (uint i = 0; i < 4; ++i)
+    {
+        uint2   pos     = pos1 + uint2(i % 2, i / 2);
+        float4  value   = ReduceTexel(srcLevel, pos, layer);
+        if (srcLevel + 1 <= numMips && all(pos < extent1))
+            StoreMip(srcLevel + 1, uint3(pos, layer), value);
+        sum += value;
+    }
+
+    if (srcLevel + 2 > numMips)
+        return;
+
+    uint2 pos2 = tileId * 16 + localPos;
+    tile[localPos.y][localPos.x] = sum * 0.25;
+    if (all(pos2 < GetMipExtent(srcLevel + 2)))
+        StoreMip(srcLevel + 2, uint3(pos2, layer), sum * 0.25);
+
+    /* Reduce remaining MIP-maps in group-shared memory */
+    [unroll]
+    for (uint mip = 3; mip <= 6; ++mip)
+    {
+        uint    tileSize    = 64 >> mip;
+        uint    level       = srcLevel + mip;
+        uint2   pos         = tileId * tileSize + uint2(localIndex % tileSize, localIndex / tileSize);
+        bool    isInTile    = (localIndex < tileSize * tileSize);
+        bool    isInMip     = isInTile && all(pos < GetMipExtent(level));
+        float4  value       = 0;
+
+        if (level > numMips)
+            return;
+
+        GroupMemoryBarrierWithGroupSync();
+
+        if (isInMip)
+            value = ReduceTileTexel(level, pos, tileId * tileSize * 2);
+
+        GroupMemoryBarrierWithGroupSync();
+
+        if (isInTile)
+            tile[localIndex / tileSize][localIndex % tileSize] = value;
+        if (isInMip)
+            StoreMip(level, uint3(pos, layer), value);
+    }
+
+    /* Store MIP-map 6 texel of this work group for the last work group */
+    if (srcLevel == 0 && localIndex == 0)
+        midMip[layer * numWorkGroups + tileId.y * numWorkGroupsX + tileId.x] = tile[0][0];
+}
+
+[numthreads(256, 1, 1)]
+void GenerateMipsSPD(uint3 groupId : SV_GroupID, uint localIndex : SV_GroupIndex)
+{
+    uint layer = groupId.z;
+
+    ReduceTile(0, groupId.xy, layer, localIndex);
+
+    if (numMips <= 6)
+        return;
+
+    /* Determine whether this is the last work group of this array layer and reset the counter for the next dispatch */
+    if (localIndex == 0)
+    {
+        DeviceMemoryBarrier();
+        uint prevCount = 0;
+        counters.InterlockedAdd(layer * 4, 1, prevCount);
+        isLastWorkGroup = (prevCount == numWorkGroups - 1);
+        if (isLastWorkGroup)
+            counters.Store(layer * 4, 0);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    if (isLastWorkGroup)
+        ReduceTile(6, uint2(0, 0), layer, localIndex);
+}
+
+)";
+
+
+
+// ================================================================================
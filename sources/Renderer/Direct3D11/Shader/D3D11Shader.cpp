@@ -6,10 +6,12 @@
  */
 
 #include "D3D11Shader.h"
+#include "D3D11ShaderObjectCache.h"
 #include "../D3D11Types.h"
 #include "../D3D11ObjectUtils.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
+#include "../../PersistentPipelineCache.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/ReportUtils.h"
@@ -24,10 +26,10 @@ namespace LLGL
 {
 
 
-D3D11Shader::D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc) :
+D3D11Shader::D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc, PersistentPipelineCache* bytecodeCache) :
     Shader { desc.type }
 {
-    if (BuildShader(device, desc))
+    if (BuildShader(device, desc, bytecodeCache))
     {
         if (GetType() == ShaderType::Vertex)
         {
@@ -52,10 +54,21 @@ const Report* D3D11Shader::GetReport() const
 
 bool D3D11Shader::Reflect(ShaderReflection& reflection) const
 {
-    if (byteCode_)
-        return SUCCEEDED(ReflectShaderByteCode(reflection));
-    else
+    if (!byteCode_)
+        return false;
+
+    /* Reflect identical byte code only once, since precompiled shaders are often created multiple times */
+    const std::uint64_t cacheKey = DXGetShaderReflectionCacheKey(byteCode_.Get(), GetType());
+    if (DXFindCachedShaderReflection(cacheKey, reflection))
+        return true;
+
+    ShaderReflection newReflection;
+    if (FAILED(ReflectShaderByteCode(newReflection)))
         return false;
+
+    DXCacheShaderReflection(cacheKey, newReflection);
+    reflection = std::move(newReflection);
+    return true;
 }
 
 HRESULT D3D11Shader::ReflectAndCacheConstantBuffers(const std::vector<D3D11ConstantBufferReflection>** outConstantBuffers)
@@ -81,10 +94,10 @@ HRESULT D3D11Shader::ReflectAndCacheConstantBuffers(const std::vector<D3D11Const
  * ======= Private: =======
  */
 
-bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, PersistentPipelineCache* bytecodeCache)
 {
     if (IsShaderSourceCode(shaderDesc.sourceType))
-        return CompileSource(device, shaderDesc);
+        return CompileSource(device, shaderDesc, bytecodeCache);
     else
         return LoadBinary(device, shaderDesc);
 }
@@ -152,7 +165,7 @@ void D3D11Shader::BuildInputLayout(ID3D11Device* device, UINT numVertexAttribs,
 }
 
 // see https://msdn.microsoft.com/en-us/library/windows/desktop/dd607324(v=vs.85).aspx
-bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, PersistentPipelineCache* bytecodeCache)
 {
     /* Get source code */
     std::string fileContent;
@@ -180,6 +193,19 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     auto        defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     auto        flags   = shaderDesc.flags;
 
+    /* Try to load byte code from persistent cache before invoking the compiler */
+    std::uint64_t cacheKey = 0;
+    if (bytecodeCache != nullptr)
+    {
+        cacheKey = DXGetShaderCompilerCacheKey("FXC", sourceCode, sourceLength, defines, entry, target, flags);
+        if (Blob cachedByteCode = bytecodeCache->Find(cacheKey))
+        {
+            byteCode_ = DXCreateBlob(cachedByteCode.GetData(), cachedByteCode.GetSize());
+            CreateNativeShader(device, shaderDesc.vertex.outputAttribs.size(), shaderDesc.vertex.outputAttribs.data());
+            return true;
+        }
+    }
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = D3DCompile(
@@ -203,6 +229,11 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     /* Store if compilation was successful */
     const bool hasErrors = FAILED(hr);
     ResetReportWithNewline(report_, DXGetBlobString(errors.Get()), hasErrors);
+
+    /* Store byte code in persistent cache */
+    if (bytecodeCache != nullptr && !hasErrors && byteCode_)
+        bytecodeCache->Store(cacheKey, Blob::CreateCopy(byteCode_->GetBufferPointer(), byteCode_->GetBufferSize()));
+
     return !hasErrors;
 }
 
@@ -322,6 +353,9 @@ ComPtr<ID3D11DeviceChild> D3D11Shader::CreateNativeShaderFromBlob(
             return computeShader;
         }
         break;
+
+        default:
+        break;
     }
 
     return {};
@@ -333,6 +367,13 @@ void D3D11Shader::CreateNativeShader(
     const VertexAttribute*  streamOutputAttribs,
     ID3D11ClassLinkage*     classLinkage)
 {
+    /* Share native shader objects with identical byte code, unless they are specialized with stream-output or class linkage */
+    if (numStreamOutputAttribs == 0 && classLinkage == nullptr)
+    {
+        native_ = D3D11ShaderObjectCache::Get().CreateShader(device, GetType(), byteCode_);
+        return;
+    }
+
     native_ = D3D11Shader::CreateNativeShaderFromBlob(
         device,
         GetType(),
@@ -24,6 +24,8 @@ namespace LLGL
 {
 
 
+class PersistentPipelineCache;
+
 struct D3D11ConstantReflection
 {
     std::string name;   // Name of the constant buffer field.
@@ -51,7 +53,7 @@ class D3D11Shader final : public Shader
 
     public:
 
-        D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc);
+        D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc, PersistentPipelineCache* bytecodeCache = nullptr);
 
         // Returns a list of all reflected constant buffers including their fields.
         HRESULT ReflectAndCacheConstantBuffers(const std::vector<D3D11ConstantBufferReflection>** outConstantBuffers);
@@ -88,10 +90,10 @@ class D3D11Shader final : public Shader
 
     private:
 
-        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, PersistentPipelineCache* bytecodeCache);
         void BuildInputLayout(ID3D11Device* device, UINT numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, PersistentPipelineCache* bytecodeCache);
         bool LoadBinary(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
 
         void CreateNativeShader(
@@ -0,0 +1,111 @@
+/*
+ * D3D11ShaderObjectCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D11ShaderObjectCache.h"
+#include "D3D11Shader.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Returns the key for the specified shader type and byte code.
+static std::string GetShaderObjectCacheKey(const ShaderType type, ID3DBlob* byteCode)
+{
+    const char*         data = static_cast<const char*>(byteCode->GetBufferPointer());
+    const std::size_t   size = static_cast<std::size_t>(byteCode->GetBufferSize());
+
+    std::string key;
+    key.push_back(static_cast<char>(type));
+
+    const std::uint64_t size64 = static_cast<std::uint64_t>(size);
+    key.append(reinterpret_cast<const char*>(&size64), sizeof(size64));
+
+    /* DXBC containers start with a 4-byte FourCC followed by a 16-byte checksum of the entire container */
+    constexpr std::size_t containerHeaderSize = 20;
+    if (size >= containerHeaderSize && ::memcmp(data, "DXBC", 4) == 0)
+        key.append(data, containerHeaderSize);
+    else
+        key.append(data, size);
+
+    return key;
+}
+
+// Returns the number of references to the specified COM object.
+static ULONG GetRefCount(IUnknown* object)
+{
+    object->AddRef();
+    return object->Release();
+}
+
+
+/*
+ * D3D11ShaderObjectCache class
+ */
+
+D3D11ShaderObjectCache& D3D11ShaderObjectCache::Get()
+{
+    static D3D11ShaderObjectCache instance;
+    return instance;
+}
+
+void D3D11ShaderObjectCache::Clear()
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D11ShaderObjectCache");
+    shaders_.clear();
+}
+
+void D3D11ShaderObjectCache::ReleaseUnusedObjects()
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D11ShaderObjectCache");
+    for (auto it = shaders_.begin(); it != shaders_.end();)
+    {
+        if (it->second.native.Get() == nullptr || GetRefCount(it->second.native.Get()) == 1)
+            it = shaders_.erase(it);
+        else
+            ++it;
+    }
+}
+
+ComPtr<ID3D11DeviceChild> D3D11ShaderObjectCache::CreateShader(ID3D11Device* device, const ShaderType type, ComPtr<ID3DBlob>& byteCode)
+{
+    const std::string key = GetShaderObjectCacheKey(type, byteCode.Get());
+
+    /* Return cached shader if identical byte code has been created before */
+    {
+        LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D11ShaderObjectCache");
+        auto it = shaders_.find(key);
+        if (it != shaders_.end())
+        {
+            byteCode = it->second.byteCode;
+            return it->second.native;
+        }
+    }
+
+    /* Create new shader outside of the lock; if another thread created the same one in the meantime, use the first one */
+    ComPtr<ID3D11DeviceChild> native = D3D11Shader::CreateNativeShaderFromBlob(device, type, byteCode.Get());
+    if (!native)
+        return nullptr;
+
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D11ShaderObjectCache");
+    const ShaderEntry& entry = shaders_.emplace(key, ShaderEntry{ byteCode, std::move(native) }).first->second;
+    byteCode = entry.byteCode;
+    return entry.native;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,81 @@
+/*
+ * D3D11ShaderObjectCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_SHADER_OBJECT_CACHE_H
+#define LLGL_D3D11_SHADER_OBJECT_CACHE_H
+
+
+#include <LLGL/ShaderFlags.h>
+#include "../../DXCommon/ComPtr.h"
+#include <d3d11.h>
+#include <d3dcommon.h>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Render system wide cache of native shader objects keyed by their byte code.
+Shader permutations frequently compile to identical DXBC, e.g. when a macro does not affect the entry point,
+so shaders with identical byte code share the same blob and native shader object instead of creating duplicates.
+Shaders with stream-output or class linkage are not cached. All functions are thread-safe, since shaders can be created concurrently.
+*/
+class D3D11ShaderObjectCache
+{
+
+    public:
+
+        D3D11ShaderObjectCache(const D3D11ShaderObjectCache&) = delete;
+        D3D11ShaderObjectCache& operator = (const D3D11ShaderObjectCache&) = delete;
+
+        // Returns the instance of this singleton.
+        static D3D11ShaderObjectCache& Get();
+
+        // Releases all cached objects.
+        void Clear();
+
+        // Releases all cached objects that are no longer referenced outside of this cache.
+        void ReleaseUnusedObjects();
+
+        /*
+        Returns the cached native shader for the specified byte code or creates a new one.
+        If there is a cached entry, 'byteCode' is replaced by the cached blob, so identical byte code is only held once in memory.
+        */
+        ComPtr<ID3D11DeviceChild> CreateShader(ID3D11Device* device, const ShaderType type, ComPtr<ID3DBlob>& byteCode);
+
+    private:
+
+        struct ShaderEntry
+        {
+            ComPtr<ID3DBlob>            byteCode;
+            ComPtr<ID3D11DeviceChild>   native;
+        };
+
+    private:
+
+        D3D11ShaderObjectCache() = default;
+
+    private:
+
+        std::mutex                                      mutex_;
+        std::unordered_map<std::string, ShaderEntry>    shaders_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,328 @@
+/*
+ * D3D11ImageConverter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D11ImageConverter.h"
+#include "D3D11Texture.h"
+#include "../Shader/D3D11Shader.h"
+#include "../Shader/Builtin/ConvertImage.hlsl.inl"
+#include "../../DXCommon/DXCore.h"
+#include <LLGL/Format.h>
+#include <climits>
+#include <string.h>
+#include <d3dcompiler.h>
+
+
+namespace LLGL
+{
+
+
+D3D11ImageConverter& D3D11ImageConverter::Get()
+{
+    static D3D11ImageConverter instance;
+    return instance;
+}
+
+// Minimum number of texels for which the conversion is done on the GPU; smaller images are converted faster on the CPU than the dispatch overhead.
+static constexpr UINT g_minNumTexelsForGPUConversion = 256 * 256;
+
+// Number of threads per work group in each dimension (see ConvertImage.hlsl.inl).
+static constexpr UINT g_workGroupSize = 8;
+
+struct ConvertImageCbuffer
+{
+    UINT dstOffset[3];
+    UINT srcComponents;
+    UINT extent[3];
+    UINT srcDataType;
+    UINT srcSwizzle;
+    UINT pad0[3];
+};
+
+// Source data types and component orders of the conversion shader (see ConvertImage.hlsl.inl).
+enum ConvertImageDataType : UINT
+{
+    ConvertImageDataType_UNorm8 = 0,
+    ConvertImageDataType_UNorm16,
+    ConvertImageDataType_Float16,
+    ConvertImageDataType_Float32,
+};
+
+enum ConvertImageSwizzle : UINT
+{
+    ConvertImageSwizzle_RGBA = 0,
+    ConvertImageSwizzle_BGRA,
+    ConvertImageSwizzle_ARGB,
+    ConvertImageSwizzle_ABGR,
+};
+
+static bool GetConvertImageDataType(DataType dataType, UINT& outDataType)
+{
+    switch (dataType)
+    {
+        case DataType::UInt8:   outDataType = ConvertImageDataType_UNorm8;  return true;
+        case DataType::UInt16:  outDataType = ConvertImageDataType_UNorm16; return true;
+        case DataType::Float16: outDataType = ConvertImageDataType_Float16; return true;
+        case DataType::Float32: outDataType = ConvertImageDataType_Float32; return true;
+        default:                return false;
+    }
+}
+
+static bool GetConvertImageSwizzle(ImageFormat format, UINT& outSwizzle)
+{
+    switch (format)
+    {
+        case ImageFormat::R:
+        case ImageFormat::RG:
+        case ImageFormat::RGB:
+        case ImageFormat::RGBA: outSwizzle = ConvertImageSwizzle_RGBA; return true;
+        case ImageFormat::BGR:
+        case ImageFormat::BGRA: outSwizzle = ConvertImageSwizzle_BGRA; return true;
+        case ImageFormat::ARGB: outSwizzle = ConvertImageSwizzle_ARGB; return true;
+        case ImageFormat::ABGR: outSwizzle = ConvertImageSwizzle_ABGR; return true;
+        default:                return false;
+    }
+}
+
+void D3D11ImageConverter::InitializeDevice(const ComPtr<ID3D11Device>& device)
+{
+    device_ = device;
+
+    /* Compute shaders with typed UAV stores to 2D texture arrays require feature level 11.0 */
+    supported_ = (device->GetFeatureLevel() >= D3D_FEATURE_LEVEL_11_0);
+}
+
+void D3D11ImageConverter::Clear()
+{
+    device_.Reset();
+    supported_      = false;
+    shaderLoaded_   = false;
+    shader_.Reset();
+    constantBuffer_.Reset();
+    srcBuffer_.Reset();
+    srcBufferSRV_.Reset();
+    srcBufferSize_  = 0;
+}
+
+bool D3D11ImageConverter::WriteImage(
+    ID3D11DeviceContext*    context,
+    D3D11Texture&           textureD3D,
+    UINT                    mipLevel,
+    UINT                    baseArrayLayer,
+    UINT                    numArrayLayers,
+    const D3D11_BOX&        dstBox,
+    const ImageView&        imageView)
+{
+    if (!supported_)
+        return false;
+
+    /* Only convert large images on the GPU */
+    const UINT extent[3] = { dstBox.right - dstBox.left, dstBox.bottom - dstBox.top, numArrayLayers };
+    const UINT numTexels = extent[0] * extent[1] * extent[2];
+    if (numTexels < g_minNumTexelsForGPUConversion)
+        return false;
+
+    /* Source image must be an uncompressed color format with normalized or floating-point components */
+    UINT srcDataType = 0, srcSwizzle = 0;
+    if (!GetConvertImageDataType(imageView.dataType, srcDataType) || !GetConvertImageSwizzle(imageView.format, srcSwizzle))
+        return false;
+
+    const std::size_t srcImageSize = GetMemoryFootprint(imageView.format, imageView.dataType, numTexels);
+    if (imageView.data == nullptr || imageView.dataSize < srcImageSize || srcImageSize > UINT_MAX - 3)
+        return false;
+
+    if (!IsTextureSupported(textureD3D) || !LoadShader())
+        return false;
+
+    /* Upload source image into raw buffer */
+    ReserveSourceBuffer(static_cast<UINT>(srcImageSize));
+
+    const D3D11_BOX srcBox = { 0, 0, 0, static_cast<UINT>(srcImageSize), 1, 1 };
+    context->UpdateSubresource(srcBuffer_.Get(), 0, &srcBox, imageView.data, 0, 0);
+
+    /* Update shader parameters */
+    ConvertImageCbuffer cbufferData;
+    {
+        cbufferData.dstOffset[0]    = dstBox.left;
+        cbufferData.dstOffset[1]    = dstBox.top;
+        cbufferData.dstOffset[2]    = 0;
+        cbufferData.srcComponents   = ImageFormatSize(imageView.format);
+        cbufferData.extent[0]       = extent[0];
+        cbufferData.extent[1]       = extent[1];
+        cbufferData.extent[2]       = extent[2];
+        cbufferData.srcDataType     = srcDataType;
+        cbufferData.srcSwizzle      = srcSwizzle;
+    }
+    context->UpdateSubresource(constantBuffer_.Get(), 0, nullptr, &cbufferData, 0, 0);
+
+    /* Create UAV for destination subresource */
+    ComPtr<ID3D11UnorderedAccessView> dstUAV;
+    textureD3D.CreateSubresourceUAV(
+        device_.Get(),
+        dstUAV.GetAddressOf(),
+        TextureType::Texture2DArray,
+        textureD3D.GetDXFormat(),
+        mipLevel,
+        baseArrayLayer,
+        numArrayLayers
+    );
+
+    /* Store currently bound compute states */
+    ComPtr<ID3D11ComputeShader>         prevShader;
+    ComPtr<ID3D11Buffer>                prevCbuffer;
+    ComPtr<ID3D11ShaderResourceView>    prevSRV;
+    ComPtr<ID3D11UnorderedAccessView>   prevUAV;
+
+    context->CSGetShader(prevShader.GetAddressOf(), nullptr, nullptr);
+    context->CSGetConstantBuffers(0, 1, prevCbuffer.GetAddressOf());
+    context->CSGetShaderResources(0, 1, prevSRV.GetAddressOf());
+    context->CSGetUnorderedAccessViews(0, 1, prevUAV.GetAddressOf());
+
+    /* Convert image into destination texture */
+    context->CSSetShader(shader_.Get(), nullptr, 0);
+    context->CSSetConstantBuffers(0, 1, constantBuffer_.GetAddressOf());
+    context->CSSetShaderResources(0, 1, srcBufferSRV_.GetAddressOf());
+    context->CSSetUnorderedAccessViews(0, 1, dstUAV.GetAddressOf(), nullptr);
+
+    context->Dispatch(
+        (extent[0] + g_workGroupSize - 1) / g_workGroupSize,
+        (extent[1] + g_workGroupSize - 1) / g_workGroupSize,
+        extent[2]
+    );
+
+    /* Restore previous compute states */
+    context->CSSetShader(prevShader.Get(), nullptr, 0);
+    context->CSSetConstantBuffers(0, 1, prevCbuffer.GetAddressOf());
+    context->CSSetUnorderedAccessViews(0, 1, prevUAV.GetAddressOf(), nullptr);
+    context->CSSetShaderResources(0, 1, prevSRV.GetAddressOf());
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D11ImageConverter::IsTextureSupported(D3D11Texture& textureD3D)
+{
+    /* Texture must be a 2D texture (or array thereof) that was created with a UAV */
+    switch (textureD3D.GetType())
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            break;
+        default:
+            return false;
+    }
+
+    if ((textureD3D.GetBindFlags() & BindFlags::Storage) == 0)
+        return false;
+
+    /* Format must be normalized or floating-point, since the shader writes float4 values */
+    const Format format = textureD3D.GetBaseFormat();
+    if (IsCompressedFormat(format) || IsDepthOrStencilFormat(format) || !(IsNormalizedFormat(format) || IsFloatFormat(format)))
+        return false;
+
+    /* Format must support typed UAV stores, which excludes sRGB formats */
+    UINT formatSupport = 0;
+    if (FAILED(device_->CheckFormatSupport(textureD3D.GetDXFormat(), &formatSupport)))
+        return false;
+
+    return ((formatSupport & D3D11_FORMAT_SUPPORT_TYPED_UNORDERED_ACCESS_VIEW) != 0);
+}
+
+bool D3D11ImageConverter::LoadShader()
+{
+    std::lock_guard<std::mutex> guard{ shaderMutex_ };
+
+    if (!shaderLoaded_)
+    {
+        shaderLoaded_ = true;
+
+        /* Compile conversion shader from builtin HLSL source */
+        ComPtr<ID3DBlob> byteCode;
+        HRESULT hr = D3DCompile(
+            g_ConvertImage_HLSL,
+            ::strlen(g_ConvertImage_HLSL),
+            "ConvertImage",
+            nullptr,
+            nullptr,
+            "ConvertImage",
+            "cs_5_0",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3,
+            0,
+            byteCode.GetAddressOf(),
+            nullptr
+        );
+        if (FAILED(hr))
+        {
+            /* Disable GPU conversion and fall back to CPU conversion */
+            supported_ = false;
+            return false;
+        }
+
+        D3D11Shader::CreateNativeShaderFromBlob(device_.Get(), ShaderType::Compute, byteCode.Get()).As(&shader_);
+
+        /* Create constant buffer for shader parameters */
+        D3D11_BUFFER_DESC cbufferDesc;
+        {
+            cbufferDesc.ByteWidth           = sizeof(ConvertImageCbuffer);
+            cbufferDesc.Usage               = D3D11_USAGE_DEFAULT;
+            cbufferDesc.BindFlags           = D3D11_BIND_CONSTANT_BUFFER;
+            cbufferDesc.CPUAccessFlags      = 0;
+            cbufferDesc.MiscFlags           = 0;
+            cbufferDesc.StructureByteStride = 0;
+        }
+        hr = device_->CreateBuffer(&cbufferDesc, nullptr, constantBuffer_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for image conversion constants");
+    }
+
+    return (shader_.Get() != nullptr);
+}
+
+void D3D11ImageConverter::ReserveSourceBuffer(UINT size)
+{
+    /* Raw buffer views require a multiple of 4 bytes */
+    const UINT alignedSize = (size + 3) & ~3u;
+
+    if (alignedSize > srcBufferSize_)
+    {
+        D3D11_BUFFER_DESC bufferDesc;
+        {
+            bufferDesc.ByteWidth            = alignedSize;
+            bufferDesc.Usage                = D3D11_USAGE_DEFAULT;
+            bufferDesc.BindFlags            = D3D11_BIND_SHADER_RESOURCE;
+            bufferDesc.CPUAccessFlags       = 0;
+            bufferDesc.MiscFlags            = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+            bufferDesc.StructureByteStride  = 0;
+        }
+        HRESULT hr = device_->CreateBuffer(&bufferDesc, nullptr, srcBuffer_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for image conversion source");
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+        {
+            srvDesc.Format                  = DXGI_FORMAT_R32_TYPELESS;
+            srvDesc.ViewDimension           = D3D11_SRV_DIMENSION_BUFFEREX;
+            srvDesc.BufferEx.FirstElement   = 0;
+            srvDesc.BufferEx.NumElements    = alignedSize / 4;
+            srvDesc.BufferEx.Flags          = D3D11_BUFFEREX_SRV_FLAG_RAW;
+        }
+        hr = device_->CreateShaderResourceView(srcBuffer_.Get(), &srvDesc, srcBufferSRV_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11ShaderResourceView", "for image conversion source");
+
+        srcBufferSize_ = alignedSize;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,98 @@
+/*
+ * D3D11ImageConverter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_IMAGE_CONVERTER_H
+#define LLGL_D3D11_IMAGE_CONVERTER_H
+
+
+#include <LLGL/ImageFlags.h>
+#include "../../DXCommon/ComPtr.h"
+#include "../Direct3D11.h"
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class D3D11Texture;
+
+/*
+Direct3D 11 image converter singleton.
+Converts image data on the GPU when it is written to a texture with a different format,
+which avoids the CPU conversion and the larger intermediate buffer for large images.
+*/
+class D3D11ImageConverter
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static D3D11ImageConverter& Get();
+
+    public:
+
+        D3D11ImageConverter(const D3D11ImageConverter&) = delete;
+        D3D11ImageConverter& operator = (const D3D11ImageConverter&) = delete;
+
+        D3D11ImageConverter(D3D11ImageConverter&&) = delete;
+        D3D11ImageConverter& operator = (D3D11ImageConverter&&) = delete;
+
+        void InitializeDevice(const ComPtr<ID3D11Device>& device);
+        void Clear();
+
+        /*
+        Converts the source image into the specified region of the texture with a compute shader.
+        Returns false if the conversion is not supported on the GPU for this texture or image, in which case the caller must convert the image on the CPU.
+        */
+        bool WriteImage(
+            ID3D11DeviceContext*    context,
+            D3D11Texture&           textureD3D,
+            UINT                    mipLevel,
+            UINT                    baseArrayLayer,
+            UINT                    numArrayLayers,
+            const D3D11_BOX&        dstBox,
+            const ImageView&        imageView
+        );
+
+    private:
+
+        D3D11ImageConverter() = default;
+
+        // Returns true if the texture can be written with the conversion shader.
+        bool IsTextureSupported(D3D11Texture& textureD3D);
+
+        // Compiles the conversion compute shader on first use. Returns false if it is unavailable.
+        bool LoadShader();
+
+        // Ensures the raw source buffer is large enough for the specified number of bytes.
+        void ReserveSourceBuffer(UINT size);
+
+    private:
+
+        ComPtr<ID3D11Device>                device_;
+
+        bool                                supported_          = false;
+        bool                                shaderLoaded_       = false;
+        std::mutex                          shaderMutex_;
+        ComPtr<ID3D11ComputeShader>         shader_;
+        ComPtr<ID3D11Buffer>                constantBuffer_;
+        ComPtr<ID3D11Buffer>                srcBuffer_;
+        ComPtr<ID3D11ShaderResourceView>    srcBufferSRV_;
+        UINT                                srcBufferSize_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
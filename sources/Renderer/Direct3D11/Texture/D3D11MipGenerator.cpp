@@ -6,8 +6,15 @@
  */
 
 #include "D3D11MipGenerator.h"
+#include "../Shader/D3D11Shader.h"
+#include "../Shader/Builtin/GenerateMipsSPD.hlsl.inl"
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <vector>
+#include <string.h>
+#include <d3dcompiler.h>
 
 
 namespace LLGL
@@ -20,20 +27,97 @@ D3D11MipGenerator& D3D11MipGenerator::Get()
     return instance;
 }
 
+// Maximum number of MIP-maps the single-pass downsampler can generate with a single dispatch (see GenerateMipsSPD.hlsl.inl).
+static constexpr std::uint32_t g_spdMaxMips         = 12;
+
+// Maximum extent of the source MIP-map for which all 12 MIP-maps can be generated in a single dispatch, since the last work group only reduces a 64x64 tile.
+static constexpr UINT          g_spdMaxFullExtent   = 4096;
+
+// Number of texels each work group of the single-pass downsampler reduces in each dimension.
+static constexpr UINT          g_spdTileSize        = 64;
+
+struct SPDCbuffer
+{
+    UINT srcExtent[2];
+    UINT numMips;
+    UINT numWorkGroups;
+    UINT numWorkGroupsX;
+    UINT pad0[3];
+};
+
+// Number of UAVs the single-pass downsampler binds: all destination MIP-maps, the intermediate MIP-map, and the work group counters.
+static constexpr UINT g_spdNumUAVs = g_spdMaxMips + 2;
+
+// Stores the compute states that are overridden by the single-pass downsampler and restores them when it goes out of scope.
+class D3D11SPDStateGuard
+{
+
+    public:
+
+        D3D11SPDStateGuard(ID3D11DeviceContext* context) :
+            context_ { context }
+        {
+            context_->CSGetShader(prevShader_.GetAddressOf(), nullptr, nullptr);
+            context_->CSGetConstantBuffers(0, 1, prevCbuffer_.GetAddressOf());
+            context_->CSGetShaderResources(0, 1, prevSRV_.GetAddressOf());
+            context_->CSGetUnorderedAccessViews(0, g_spdNumUAVs, prevUAVs_);
+        }
+
+        ~D3D11SPDStateGuard()
+        {
+            context_->CSSetShader(prevShader_.Get(), nullptr, 0);
+            context_->CSSetConstantBuffers(0, 1, prevCbuffer_.GetAddressOf());
+            context_->CSSetUnorderedAccessViews(0, g_spdNumUAVs, prevUAVs_, nullptr);
+            context_->CSSetShaderResources(0, 1, prevSRV_.GetAddressOf());
+
+            for (ID3D11UnorderedAccessView* uav : prevUAVs_)
+            {
+                if (uav != nullptr)
+                    uav->Release();
+            }
+        }
+
+    private:
+
+        ID3D11DeviceContext*                context_                    = nullptr;
+        ComPtr<ID3D11ComputeShader>         prevShader_;
+        ComPtr<ID3D11Buffer>                prevCbuffer_;
+        ComPtr<ID3D11ShaderResourceView>    prevSRV_;
+        ID3D11UnorderedAccessView*          prevUAVs_[g_spdNumUAVs]     = {};
+
+};
+
 void D3D11MipGenerator::InitializeDevice(const ComPtr<ID3D11Device>& device)
 {
     device_ = device;
+
+    /* Single-pass downsampler requires 14 UAVs in the compute stage, which are only available since feature level 11.1 */
+    spdSupported_ = (device->GetFeatureLevel() >= D3D_FEATURE_LEVEL_11_1);
 }
 
 void D3D11MipGenerator::Clear()
 {
     device_.Reset();
+    spdSupported_       = false;
+    spdShaderLoaded_    = false;
+    spdShader_.Reset();
+    spdConstantBuffer_.Reset();
+    spdMidBuffer_.Reset();
+    spdMidUAV_.Reset();
+    spdMidBufferSize_   = 0;
+    spdCounterBuffer_.Reset();
+    spdCounterUAV_.Reset();
+    spdCounterSize_     = 0;
 }
 
 void D3D11MipGenerator::GenerateMips(ID3D11DeviceContext* context, D3D11Texture& textureD3D)
 {
-    /* Generate MIP-maps for the default SRV */
-    if (auto srv = textureD3D.GetSRV())
+    if (CanGenerateMipsWithSPD(textureD3D, textureD3D.GetNumMipLevels()))
+    {
+        /* Generate MIP-maps with single-pass downsampler */
+        GenerateMipsWithSPD(context, textureD3D, 0, textureD3D.GetNumMipLevels(), 0, textureD3D.GetNumArrayLayers());
+    }
+    else if (auto srv = textureD3D.GetSRV())
     {
         /* Generate MIP-maps for default SRV */
         context->GenerateMips(srv);
@@ -45,6 +129,42 @@ void D3D11MipGenerator::GenerateMips(ID3D11DeviceContext* context, D3D11Texture&
     }
 }
 
+void D3D11MipGenerator::GenerateMipsForTextures(ID3D11DeviceContext* context, std::uint32_t numTextures, Texture* const * textures)
+{
+    /* Partition textures by whether they are supported by the single-pass downsampler */
+    std::vector<D3D11Texture*> texturesSPD, texturesNonSPD;
+    texturesSPD.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        auto* textureD3D = LLGL_CAST(D3D11Texture*, textures[i]);
+        if (CanGenerateMipsWithSPD(*textureD3D, textureD3D->GetNumMipLevels()))
+            texturesSPD.push_back(textureD3D);
+        else
+            texturesNonSPD.push_back(textureD3D);
+    }
+
+    if (!texturesSPD.empty())
+    {
+        /* Bind single-pass downsampler only once and restore compute states after all textures have been processed */
+        D3D11SPDStateGuard stateGuard{ context };
+
+        context->CSSetShader(spdShader_.Get(), nullptr, 0);
+        context->CSSetConstantBuffers(0, 1, spdConstantBuffer_.GetAddressOf());
+
+        for (D3D11Texture* textureD3D : texturesSPD)
+            DispatchSPD(context, *textureD3D, 0, textureD3D->GetNumMipLevels(), 0, textureD3D->GetNumArrayLayers());
+    }
+
+    for (D3D11Texture* textureD3D : texturesNonSPD)
+    {
+        if (auto srv = textureD3D->GetSRV())
+            context->GenerateMips(srv);
+        else
+            GenerateMipsWithSubresourceSRV(context, *textureD3D, 0, textureD3D->GetNumMipLevels(), 0, textureD3D->GetNumArrayLayers());
+    }
+}
+
 void D3D11MipGenerator::GenerateMipsRange(
     ID3D11DeviceContext*    context,
     D3D11Texture&           textureD3D,
@@ -53,7 +173,12 @@ void D3D11MipGenerator::GenerateMipsRange(
     std::uint32_t           baseArrayLayer,
     std::uint32_t           numArrayLayers)
 {
-    if ( baseMipLevel        == 0                              &&
+    if (CanGenerateMipsWithSPD(textureD3D, numMipLevels))
+    {
+        /* Generate MIP-maps with single-pass downsampler */
+        GenerateMipsWithSPD(context, textureD3D, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+    }
+    else if ( baseMipLevel        == 0                              &&
          numMipLevels        == textureD3D.GetNumMipLevels()   &&
          baseArrayLayer      == 0                              &&
          numArrayLayers      == textureD3D.GetNumArrayLayers() &&
@@ -74,6 +199,245 @@ void D3D11MipGenerator::GenerateMipsRange(
  * ======= Private: =======
  */
 
+static bool IsTextureTypeSupportedBySPD(const TextureType type)
+{
+    switch (type)
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool D3D11MipGenerator::CanGenerateMipsWithSPD(D3D11Texture& textureD3D, std::uint32_t numMipLevels)
+{
+    if (!spdSupported_ || numMipLevels < 2)
+        return false;
+
+    /* Texture must be a 2D texture (or array thereof) that was created with a UAV */
+    if (!IsTextureTypeSupportedBySPD(textureD3D.GetType()) || (textureD3D.GetBindFlags() & BindFlags::Storage) == 0)
+        return false;
+
+    /* Format must support typed UAV stores and automatic MIP-map generation, which excludes sRGB and integer formats */
+    UINT formatSupport = 0;
+    if (FAILED(device_->CheckFormatSupport(textureD3D.GetDXFormat(), &formatSupport)))
+        return false;
+
+    constexpr UINT requiredFormatSupport = (D3D11_FORMAT_SUPPORT_TYPED_UNORDERED_ACCESS_VIEW | D3D11_FORMAT_SUPPORT_MIP_AUTOGEN);
+    if ((formatSupport & requiredFormatSupport) != requiredFormatSupport)
+        return false;
+
+    return LoadSPDShader();
+}
+
+bool D3D11MipGenerator::LoadSPDShader()
+{
+    std::lock_guard<std::mutex> guard{ spdMutex_ };
+
+    if (!spdShaderLoaded_)
+    {
+        spdShaderLoaded_ = true;
+
+        /* Compile single-pass downsampler from builtin HLSL source */
+        ComPtr<ID3DBlob> byteCode;
+        HRESULT hr = D3DCompile(
+            g_GenerateMipsSPD_HLSL,
+            ::strlen(g_GenerateMipsSPD_HLSL),
+            "GenerateMipsSPD",
+            nullptr,
+            nullptr,
+            "GenerateMipsSPD",
+            "cs_5_0",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3,
+            0,
+            byteCode.GetAddressOf(),
+            nullptr
+        );
+        if (FAILED(hr))
+        {
+            /* Disable single-pass downsampler and fall back to ID3D11DeviceContext::GenerateMips */
+            spdSupported_ = false;
+            return false;
+        }
+
+        D3D11Shader::CreateNativeShaderFromBlob(device_.Get(), ShaderType::Compute, byteCode.Get()).As(&spdShader_);
+
+        /* Create constant buffer for shader parameters */
+        D3D11_BUFFER_DESC cbufferDesc;
+        {
+            cbufferDesc.ByteWidth           = sizeof(SPDCbuffer);
+            cbufferDesc.Usage               = D3D11_USAGE_DEFAULT;
+            cbufferDesc.BindFlags           = D3D11_BIND_CONSTANT_BUFFER;
+            cbufferDesc.CPUAccessFlags      = 0;
+            cbufferDesc.MiscFlags           = 0;
+            cbufferDesc.StructureByteStride = 0;
+        }
+        hr = device_->CreateBuffer(&cbufferDesc, nullptr, spdConstantBuffer_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for single-pass downsampler constants");
+    }
+
+    return (spdShader_.Get() != nullptr);
+}
+
+void D3D11MipGenerator::ReserveSPDBuffers(UINT numMidTexels, UINT numCounters)
+{
+    if (numMidTexels > spdMidBufferSize_)
+    {
+        /* Create structured buffer for MIP-map 6 texels of all work groups; each texel is a float4 */
+        D3D11_BUFFER_DESC bufferDesc;
+        {
+            bufferDesc.ByteWidth            = numMidTexels * sizeof(float) * 4;
+            bufferDesc.Usage                = D3D11_USAGE_DEFAULT;
+            bufferDesc.BindFlags            = D3D11_BIND_UNORDERED_ACCESS;
+            bufferDesc.CPUAccessFlags       = 0;
+            bufferDesc.MiscFlags            = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+            bufferDesc.StructureByteStride  = sizeof(float) * 4;
+        }
+        HRESULT hr = device_->CreateBuffer(&bufferDesc, nullptr, spdMidBuffer_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for single-pass downsampler intermediate MIP-map");
+
+        hr = device_->CreateUnorderedAccessView(spdMidBuffer_.Get(), nullptr, spdMidUAV_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11UnorderedAccessView", "for single-pass downsampler intermediate MIP-map");
+
+        spdMidBufferSize_ = numMidTexels;
+    }
+
+    if (numCounters > spdCounterSize_)
+    {
+        /* Create byte-address buffer for work group counters; all counters must be initialized with zero and are reset by the shader */
+        const std::vector<UINT> initialCounters(numCounters, 0u);
+
+        D3D11_BUFFER_DESC bufferDesc;
+        {
+            bufferDesc.ByteWidth            = numCounters * sizeof(UINT);
+            bufferDesc.Usage                = D3D11_USAGE_DEFAULT;
+            bufferDesc.BindFlags            = D3D11_BIND_UNORDERED_ACCESS;
+            bufferDesc.CPUAccessFlags       = 0;
+            bufferDesc.MiscFlags            = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+            bufferDesc.StructureByteStride  = 0;
+        }
+        D3D11_SUBRESOURCE_DATA initialData;
+        {
+            initialData.pSysMem             = initialCounters.data();
+            initialData.SysMemPitch         = 0;
+            initialData.SysMemSlicePitch    = 0;
+        }
+        HRESULT hr = device_->CreateBuffer(&bufferDesc, &initialData, spdCounterBuffer_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for single-pass downsampler counters");
+
+        D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+        {
+            uavDesc.Format                  = DXGI_FORMAT_R32_TYPELESS;
+            uavDesc.ViewDimension           = D3D11_UAV_DIMENSION_BUFFER;
+            uavDesc.Buffer.FirstElement     = 0;
+            uavDesc.Buffer.NumElements      = numCounters;
+            uavDesc.Buffer.Flags            = D3D11_BUFFER_UAV_FLAG_RAW;
+        }
+        hr = device_->CreateUnorderedAccessView(spdCounterBuffer_.Get(), &uavDesc, spdCounterUAV_.ReleaseAndGetAddressOf());
+        DXThrowIfCreateFailed(hr, "ID3D11UnorderedAccessView", "for single-pass downsampler counters");
+
+        spdCounterSize_ = numCounters;
+    }
+}
+
+void D3D11MipGenerator::GenerateMipsWithSPD(
+    ID3D11DeviceContext*    context,
+    D3D11Texture&           textureD3D,
+    std::uint32_t           baseMipLevel,
+    std::uint32_t           numMipLevels,
+    std::uint32_t           baseArrayLayer,
+    std::uint32_t           numArrayLayers)
+{
+    D3D11SPDStateGuard stateGuard{ context };
+
+    context->CSSetShader(spdShader_.Get(), nullptr, 0);
+    context->CSSetConstantBuffers(0, 1, spdConstantBuffer_.GetAddressOf());
+
+    DispatchSPD(context, textureD3D, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+}
+
+void D3D11MipGenerator::DispatchSPD(
+    ID3D11DeviceContext*    context,
+    D3D11Texture&           textureD3D,
+    std::uint32_t           baseMipLevel,
+    std::uint32_t           numMipLevels,
+    std::uint32_t           baseArrayLayer,
+    std::uint32_t           numArrayLayers)
+{
+    /* Generate up to 12 MIP-maps per dispatch, since each dispatch reads from a single source MIP-map */
+    for (std::uint32_t srcMipLevel = baseMipLevel, lastMipLevel = baseMipLevel + numMipLevels - 1; srcMipLevel < lastMipLevel;)
+    {
+        const Extent3D srcExtent = textureD3D.GetMipExtent(srcMipLevel);
+
+        /* Last work group can only reduce MIP-map 6 if it fits into a single tile */
+        const std::uint32_t maxMips         = ((std::max)(srcExtent.x, srcExtent.y) <= g_spdMaxFullExtent ? g_spdMaxMips : g_spdMaxMips/2);
+        const std::uint32_t numMips         = (std::min)(lastMipLevel - srcMipLevel, maxMips);
+        const UINT          numWorkGroupsX  = (srcExtent.x + g_spdTileSize - 1) / g_spdTileSize;
+        const UINT          numWorkGroupsY  = (srcExtent.y + g_spdTileSize - 1) / g_spdTileSize;
+
+        ReserveSPDBuffers(numWorkGroupsX * numWorkGroupsY * numArrayLayers, numArrayLayers);
+
+        /* Update shader parameters */
+        SPDCbuffer cbufferData;
+        {
+            cbufferData.srcExtent[0]    = srcExtent.x;
+            cbufferData.srcExtent[1]    = srcExtent.y;
+            cbufferData.numMips         = numMips;
+            cbufferData.numWorkGroups   = numWorkGroupsX * numWorkGroupsY;
+            cbufferData.numWorkGroupsX  = numWorkGroupsX;
+        }
+        context->UpdateSubresource(spdConstantBuffer_.Get(), 0, nullptr, &cbufferData, 0, 0);
+
+        /* Create subresource views for source and all destination MIP-maps */
+        ComPtr<ID3D11ShaderResourceView> srcSRV;
+        textureD3D.CreateSubresourceSRV(
+            device_.Get(),
+            srcSRV.GetAddressOf(),
+            TextureType::Texture2DArray,
+            textureD3D.GetDXFormat(),
+            srcMipLevel,
+            1,
+            baseArrayLayer,
+            numArrayLayers
+        );
+
+        ComPtr<ID3D11UnorderedAccessView> dstUAVs[g_spdMaxMips];
+        ID3D11UnorderedAccessView* uavs[g_spdNumUAVs] = {};
+
+        for_range(mip, numMips)
+        {
+            textureD3D.CreateSubresourceUAV(
+                device_.Get(),
+                dstUAVs[mip].GetAddressOf(),
+                TextureType::Texture2DArray,
+                textureD3D.GetDXFormat(),
+                srcMipLevel + 1 + mip,
+                baseArrayLayer,
+                numArrayLayers
+            );
+            uavs[mip] = dstUAVs[mip].Get();
+        }
+        uavs[g_spdMaxMips    ] = spdMidUAV_.Get();
+        uavs[g_spdMaxMips + 1] = spdCounterUAV_.Get();
+
+        /* Bind destination MIP-maps before source MIP-map, since the source was a destination of the previous dispatch */
+        context->CSSetUnorderedAccessViews(0, g_spdNumUAVs, uavs, nullptr);
+        context->CSSetShaderResources(0, 1, srcSRV.GetAddressOf());
+
+        context->Dispatch(numWorkGroupsX, numWorkGroupsY, numArrayLayers);
+
+        /* Unbind source SRV so it can be written as UAV by the next dispatch */
+        ID3D11ShaderResourceView* nullSRV = nullptr;
+        context->CSSetShaderResources(0, 1, &nullSRV);
+
+        srcMipLevel += numMips;
+    }
+}
+
 void D3D11MipGenerator::GenerateMipsWithSubresourceSRV(
     ID3D11DeviceContext*    context,
     D3D11Texture&           textureD3D,
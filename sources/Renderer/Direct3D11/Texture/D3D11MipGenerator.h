@@ -12,6 +12,7 @@
 #include "D3D11Texture.h"
 #include "../../DXCommon/ComPtr.h"
 #include "../Direct3D11.h"
+#include <mutex>
 
 
 namespace LLGL
@@ -51,10 +52,44 @@ class D3D11MipGenerator
             std::uint32_t           numArrayLayers = 1
         );
 
+        /*
+        Generates the entire MIP-map chain for each texture in the specified array.
+        Textures that are supported by the single-pass downsampler share a single shader binding, all others are generated by the device context.
+        */
+        void GenerateMipsForTextures(ID3D11DeviceContext* context, std::uint32_t numTextures, Texture* const * textures);
+
     private:
 
         D3D11MipGenerator() = default;
 
+        // Returns true if the specified MIP-map range can be generated with the single-pass downsampler.
+        bool CanGenerateMipsWithSPD(D3D11Texture& textureD3D, std::uint32_t numMipLevels);
+
+        // Compiles the single-pass downsampler compute shader on first use. Returns false if it is unavailable.
+        bool LoadSPDShader();
+
+        // Ensures the intermediate buffers for the single-pass downsampler are large enough.
+        void ReserveSPDBuffers(UINT numMidTexels, UINT numCounters);
+
+        void GenerateMipsWithSPD(
+            ID3D11DeviceContext*    context,
+            D3D11Texture&           textureD3D,
+            std::uint32_t           baseMipLevel,
+            std::uint32_t           numMipLevels,
+            std::uint32_t           baseArrayLayer,
+            std::uint32_t           numArrayLayers
+        );
+
+        // Dispatches the single-pass downsampler for the specified MIP-map range. The shader and constant buffer must already be bound.
+        void DispatchSPD(
+            ID3D11DeviceContext*    context,
+            D3D11Texture&           textureD3D,
+            std::uint32_t           baseMipLevel,
+            std::uint32_t           numMipLevels,
+            std::uint32_t           baseArrayLayer,
+            std::uint32_t           numArrayLayers
+        );
+
         void GenerateMipsWithSubresourceSRV(
             ID3D11DeviceContext*    context,
             D3D11Texture&           textureD3D,
@@ -66,7 +101,20 @@ class D3D11MipGenerator
 
     private:
 
-        ComPtr<ID3D11Device> device_;
+        ComPtr<ID3D11Device>                device_;
+
+        /* Single-pass downsampler (SPD) objects */
+        bool                                spdSupported_       = false;
+        bool                                spdShaderLoaded_    = false;
+        std::mutex                          spdMutex_;
+        ComPtr<ID3D11ComputeShader>         spdShader_;
+        ComPtr<ID3D11Buffer>                spdConstantBuffer_;
+        ComPtr<ID3D11Buffer>                spdMidBuffer_;
+        ComPtr<ID3D11UnorderedAccessView>   spdMidUAV_;
+        UINT                                spdMidBufferSize_   = 0;
+        ComPtr<ID3D11Buffer>                spdCounterBuffer_;
+        ComPtr<ID3D11UnorderedAccessView>   spdCounterUAV_;
+        UINT                                spdCounterSize_     = 0;
 
 };
 
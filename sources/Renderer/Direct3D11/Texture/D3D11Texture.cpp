@@ -6,6 +6,7 @@
  */
 
 #include "D3D11Texture.h"
+#include "D3D11ImageConverter.h"
 #include "../D3D11Types.h"
 #include "../D3D11ObjectUtils.h"
 #include "../D3D11ResourceFlags.h"
@@ -58,6 +59,22 @@ void D3D11Texture::SetDebugName(const char* name)
         D3D11SetObjectNameSubscript(uav_.Get(), name, ".UAV");
 }
 
+bool D3D11Texture::SetMinLOD(float minLOD)
+{
+    if (!native_)
+        return false;
+
+    /* Min-LOD clamp is a state of the resource in the immediate context, which applies to all of its views */
+    ComPtr<ID3D11Device> device;
+    native_->GetDevice(device.GetAddressOf());
+
+    ComPtr<ID3D11DeviceContext> context;
+    device->GetImmediateContext(context.GetAddressOf());
+
+    context->SetResourceMinLOD(native_.Get(), minLOD);
+    return true;
+}
+
 Extent3D D3D11Texture::GetMipExtent(std::uint32_t mipLevel) const
 {
     Extent3D size;
@@ -286,6 +303,10 @@ HRESULT D3D11Texture::UpdateSubresource(
     if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
         (formatAttribs.format != imageView.format || formatAttribs.dataType != imageView.dataType))
     {
+        /* Convert large images on the GPU if the texture supports it */
+        if (D3D11ImageConverter::Get().WriteImage(context, *this, mipLevel, baseArrayLayer, numArrayLayers, dstBox, imageView))
+            return S_OK;
+
         /* Convert image data (e.g. from RGB to RGBA), and redirect initial data to new buffer */
         intermediateData    = ConvertImageBuffer(imageView, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
         srcData             = intermediateData.get();
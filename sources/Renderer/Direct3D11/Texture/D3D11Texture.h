@@ -33,6 +33,8 @@ class D3D11Texture final : public Texture
 
         void SetDebugName(const char* name) override;
 
+        bool SetMinLOD(float minLOD) override;
+
     public:
 
         D3D11Texture(ID3D11Device* device, const TextureDescriptor& desc);
@@ -32,7 +32,7 @@ static DXGI_FORMAT GetDXFormatForBuffer(const BufferDescriptor& desc)
     return (IsStructuredBuffer(desc) ? DXGI_FORMAT_UNKNOWN : DXTypes::ToDXGIFormat(desc.format));
 }
 
-D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
+D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc, bool useGpuUploadHeap) :
     Buffer  { desc.bindFlags             },
     format_ { GetDXFormatForBuffer(desc) }
 {
@@ -41,10 +41,10 @@ D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
         alignment_ = g_cBufferAlignment;
 
     /* Create native buffer resource */
-    CreateGpuBuffer(device, desc);
+    CreateGpuBuffer(device, desc, useGpuUploadHeap);
 
-    /* Create CPU access buffer */
-    if (desc.cpuAccessFlags != 0)
+    /* Create CPU access buffer; buffers in GPU upload and readback heaps are mapped directly instead */
+    if (desc.cpuAccessFlags != 0 && !IsDirectlyMapped())
         CreateCpuAccessBuffer(device, desc.cpuAccessFlags);
 
     /* Create sub-resource views */
@@ -64,6 +64,21 @@ void D3D12Buffer::SetDebugName(const char* name)
     D3D12SetObjectName(resource_.Get(), name);
 }
 
+bool D3D12Buffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    return D3D12SetResidencyPriority(resource_, D3D12Types::Map(priority));
+}
+
+bool D3D12Buffer::Evict()
+{
+    return D3D12EvictResource(resource_);
+}
+
+bool D3D12Buffer::MakeResident()
+{
+    return D3D12MakeResourceResident(resource_);
+}
+
 BufferDescriptor D3D12Buffer::GetDesc() const
 {
     /* Get native resource descriptor and convert */
@@ -283,6 +298,12 @@ HRESULT D3D12Buffer::Map(
     void**                  mappedData,
     const CPUAccess         access)
 {
+    if (IsDirectlyMapped())
+    {
+        /* Buffers in GPU upload and readback heaps are persistently mapped, so no copies are needed */
+        *mappedData = mappedData_;
+        return S_OK;
+    }
     if (cpuAccessBuffer_.Get() != nullptr)
     {
         /* Store mapped state */
@@ -390,7 +411,7 @@ static D3D12_RESOURCE_STATES GetD3DUsageState(long bindFlags)
 }
 
 // see https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/nf-d3d12-id3d12device-createcommittedresource
-void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc)
+void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, bool useGpuUploadHeap)
 {
     /* Store buffer attributes */
     bufferSize_ = GetAlignedSize<UINT64>(desc.size, alignment_);
@@ -401,9 +422,57 @@ void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor&
     if ((desc.bindFlags & BindFlags::StreamOutputBuffer) != 0)
         internalSize_ += g_soBufferFillSizeLen;
 
+    const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetInternalBufferSize(), GetD3DResourceFlags(desc));
+
+    if (IsReadbackBuffer(desc) && (desc.bindFlags & BindFlags::CopySrc) == 0)
+    {
+        /* Create readback buffers directly in a readback heap, so copy commands write into CPU accessible memory; such resources must remain in the copy destination state */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_READBACK };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COPY_DEST),
+            nullptr,
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 readback buffer");
+
+        /* Map buffer for its entire lifetime */
+        void* mappedData = nullptr;
+        hr = resource_.Get()->Map(0, nullptr, &mappedData);
+        DXThrowIfFailed(hr, "failed to map D3D12 readback buffer");
+        mappedData_ = static_cast<char*>(mappedData);
+        return;
+    }
+
+    #ifdef LLGL_D3D12_GPU_UPLOAD_HEAPS
+    if (useGpuUploadHeap)
+    {
+        /* Create buffer resource in video memory that is visible to the CPU; resources in GPU upload heaps start in the common state */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_GPU_UPLOAD };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COMMON, GetD3DUsageState(desc.bindFlags)),
+            nullptr,
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 GPU upload buffer");
+
+        /* Map buffer for its entire lifetime without read range */
+        const D3D12_RANGE nullRange{ 0, 0 };
+        void* mappedData = nullptr;
+        hr = resource_.Get()->Map(0, &nullRange, &mappedData);
+        DXThrowIfFailed(hr, "failed to map D3D12 GPU upload buffer");
+        mappedData_ = static_cast<char*>(mappedData);
+        return;
+    }
+    #endif // /LLGL_D3D12_GPU_UPLOAD_HEAPS
+
     /* Create generic buffer resource */
     const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
-    const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetInternalBufferSize(), GetD3DResourceFlags(desc));
     HRESULT hr = device->CreateCommittedResource(
         &heapProperties,
         D3D12_HEAP_FLAG_NONE,
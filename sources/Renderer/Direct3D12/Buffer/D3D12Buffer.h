@@ -16,6 +16,12 @@
 #include <d3d12.h>
 
 
+// GPU upload heaps require ID3D12Device14 from Windows SDK 10.0.26100 (or the Agility SDK 1.613).
+#if defined __ID3D12Device14_INTERFACE_DEFINED__
+#   define LLGL_D3D12_GPU_UPLOAD_HEAPS
+#endif
+
+
 namespace LLGL
 {
 
@@ -31,11 +37,16 @@ class D3D12Buffer : public Buffer
 
         void SetDebugName(const char* name) override;
 
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+        bool Evict() override;
+        bool MakeResident() override;
+
         BufferDescriptor GetDesc() const override;
 
     public:
 
-        D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc);
+        // Creates the buffer in a GPU upload heap and maps it persistently if 'useGpuUploadHeap' is true (for MiscFlags::DirectUpload).
+        D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc, bool useGpuUploadHeap = false);
 
         // Creates a resource views within the native buffer object:
         void CreateConstantBufferView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
@@ -129,6 +140,18 @@ class D3D12Buffer : public Buffer
             return alignment_;
         }
 
+        // Returns the persistently mapped memory of a buffer in a GPU upload or readback heap or null if this buffer is not directly mapped.
+        inline char* GetMappedData() const
+        {
+            return mappedData_;
+        }
+
+        // Returns true if this buffer is persistently mapped in a GPU upload or readback heap.
+        inline bool IsDirectlyMapped() const
+        {
+            return (mappedData_ != nullptr);
+        }
+
         // Returns the native format of the buffer or DXGI_FORMAT_UNKNOWN; only used for storage buffers.
         inline DXGI_FORMAT GetDXFormat() const
         {
@@ -137,7 +160,7 @@ class D3D12Buffer : public Buffer
 
     private:
 
-        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc);
+        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, bool useGpuUploadHeap);
         void CreateCpuAccessBuffer(ID3D12Device* device, long cpuAccessFlags);
 
         void CreateIntermediateUAVDescriptorHeap(ID3D12Resource* resource, DXGI_FORMAT format, UINT formatStride);
@@ -210,6 +233,7 @@ class D3D12Buffer : public Buffer
 
         D3D12_RANGE                     mappedRange_                = {};
         CPUAccess                       mappedCPUaccess_            = CPUAccess::ReadOnly;
+        char*                           mappedData_                 = nullptr; // Only for buffers in D3D12_HEAP_TYPE_GPU_UPLOAD or D3D12_HEAP_TYPE_READBACK
 
 };
 
@@ -32,7 +32,6 @@ struct D3D12BufferConstantsView
 
 class D3D12CommandContext;
 class D3D12CommandQueue;
-class D3D12StagingBufferPool;
 
 // Pool manager for special buffer constants, e.g. zero initialized buffer ange.
 class D3D12BufferConstantsPool
@@ -50,8 +49,7 @@ class D3D12BufferConstantsPool
         void InitializeDevice(
             ID3D12Device*           device,
             D3D12CommandContext&    commandContext,
-            D3D12CommandQueue&      commandQueue,
-            D3D12StagingBufferPool& stagingBufferPool
+            D3D12CommandQueue&      commandQueue
         );
 
         // Clears all internal resources of this buffer pool.
@@ -83,7 +81,6 @@ class D3D12BufferConstantsPool
             ID3D12Device*               device,
             D3D12CommandContext&        commandContext,
             D3D12CommandQueue&          commandQueue,
-            D3D12StagingBufferPool&     stagingBufferPool,
             std::vector<std::uint64_t>& data
         );
 
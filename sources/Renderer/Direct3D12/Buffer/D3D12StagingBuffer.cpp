@@ -8,6 +8,7 @@
 #include "D3D12StagingBuffer.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/ImageUtils.h"
 #include "../D3DX12/d3dx12.h"
 #include <string.h>
 
@@ -26,19 +27,23 @@ D3D12StagingBuffer::D3D12StagingBuffer(
 }
 
 D3D12StagingBuffer::D3D12StagingBuffer(D3D12StagingBuffer&& rhs) noexcept :
-    native_ { std::move(rhs.native_) },
-    size_   { rhs.size_              },
-    offset_ { rhs.offset_            }
+    native_     { std::move(rhs.native_) },
+    mappedData_ { rhs.mappedData_        },
+    size_       { rhs.size_              },
+    offset_     { rhs.offset_            }
 {
+    rhs.mappedData_ = nullptr;
 }
 
 D3D12StagingBuffer& D3D12StagingBuffer::operator = (D3D12StagingBuffer&& rhs) noexcept
 {
     if (this != &rhs)
     {
-        native_ = std::move(rhs.native_);
-        size_   = rhs.size_;
-        offset_ = rhs.offset_;
+        native_         = std::move(rhs.native_);
+        mappedData_     = rhs.mappedData_;
+        size_           = rhs.size_;
+        offset_         = rhs.offset_;
+        rhs.mappedData_ = nullptr;
     }
     return *this;
 }
@@ -67,6 +72,15 @@ void D3D12StagingBuffer::Create(
     /* Set name for debugging/diagnostics */
     native_->SetName(L"LLGL::D3D12StagingBuffer");
 
+    /* Keep upload buffers persistently mapped to avoid Map/Unmap calls for every write */
+    mappedData_ = nullptr;
+    if (heapType == D3D12_HEAP_TYPE_UPLOAD)
+    {
+        const D3D12_RANGE readRange{ 0, 0 };
+        hr = native_->Map(0, &readRange, reinterpret_cast<void**>(&mappedData_));
+        DXThrowIfFailed(hr, "failed to map D3D12 staging buffer");
+    }
+
     /* Store new size and reset write offset */
     size_   = size;
     offset_ = 0;
@@ -89,27 +103,25 @@ HRESULT D3D12StagingBuffer::Write(
     const void*                 data,
     UINT64                      dataSize)
 {
-    /* Map GPU host memory to CPU memory space CPU-memory to upload buffer */
-    char* mappedData = nullptr;
-    const D3D12_RANGE readRange{ 0, 0 };
-
-    HRESULT hr = native_->Map(0, &readRange, reinterpret_cast<void**>(&mappedData));
-    if (FAILED(hr))
-        return hr;
+    return WriteAt(commandList, dstBuffer, dstOffset, data, dataSize, offset_);
+}
 
-    /* Copy input data to staging buffer */
-    ::memcpy(mappedData + offset_, data, static_cast<std::size_t>(dataSize));
+HRESULT D3D12StagingBuffer::WriteAt(
+    ID3D12GraphicsCommandList*  commandList,
+    ID3D12Resource*             dstBuffer,
+    UINT64                      dstOffset,
+    const void*                 data,
+    UINT64                      dataSize,
+    UINT64                      srcOffset)
+{
+    if (mappedData_ == nullptr)
+        return E_FAIL;
 
-    /* Unmap buffer with range of written data */
-    const D3D12_RANGE writtenRange
-    {
-        static_cast<SIZE_T>(offset_),
-        static_cast<SIZE_T>(offset_ + dataSize)
-    };
-    native_->Unmap(0, &writtenRange);
+    /* Copy input data to persistently mapped staging buffer; upload heaps are write-combined */
+    CopyToWriteCombinedMemory(mappedData_ + srcOffset, data, static_cast<std::size_t>(dataSize));
 
     /* Encode copy buffer command */
-    commandList->CopyBufferRegion(dstBuffer, dstOffset, native_.Get(), offset_, dataSize);
+    commandList->CopyBufferRegion(dstBuffer, dstOffset, native_.Get(), srcOffset, dataSize);
 
     return S_OK;
 }
@@ -18,8 +18,9 @@ namespace LLGL
 
 
 /*
-Instances of this class represent a single chunk in the staging buffer pool
+Instances of this class represent a single buffer in the staging buffer pool
 to handle dynamic buffer updates during command buffer recording.
+Upload buffers are persistently mapped for their entire lifetime.
 */
 class D3D12StagingBuffer
 {
@@ -65,6 +66,16 @@ class D3D12StagingBuffer
             UINT64                      dataSize
         );
 
+        // Writes the specified data to the native D3D upload buffer at the specified source offset.
+        HRESULT WriteAt(
+            ID3D12GraphicsCommandList*  commandList,
+            ID3D12Resource*             dstBuffer,
+            UINT64                      dstOffset,
+            const void*                 data,
+            UINT64                      dataSize,
+            UINT64                      srcOffset
+        );
+
         // Writes the specified data to the native D3D upload buffer and increments the write offset.
         HRESULT WriteAndIncrementOffset(
             ID3D12GraphicsCommandList*  commandList,
@@ -95,8 +106,9 @@ class D3D12StagingBuffer
     private:
 
         ComPtr<ID3D12Resource>  native_;
-        UINT64                  size_   = 0;
-        UINT64                  offset_ = 0;
+        char*                   mappedData_ = nullptr;
+        UINT64                  size_       = 0;
+        UINT64                  offset_     = 0;
 
 };
 
@@ -9,6 +9,7 @@
 #include "../Command/D3D12CommandContext.h"
 #include "../D3D12Resource.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
 #include <algorithm>
 
 
@@ -16,51 +17,45 @@ namespace LLGL
 {
 
 
-D3D12StagingBufferPool::D3D12StagingBufferPool(ID3D12Device* device, UINT64 chunkSize) :
-    device_    { device    },
-    chunkSize_ { chunkSize }
-{
-}
+// Ring buffers are allocated in multiples of the default D3D12 resource placement alignment.
+static constexpr UINT64 g_ringSizeGranularity = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
 
-void D3D12StagingBufferPool::InitializeDevice(ID3D12Device* device, UINT64 chunkSize)
+D3D12StagingBufferPool::D3D12StagingBufferPool(ID3D12Device* device, UINT64 ringSize)
 {
-    device_    = device;
-    chunkSize_ = chunkSize;
+    InitializeDevice(device, ringSize);
 }
 
-void D3D12StagingBufferPool::Reset()
+void D3D12StagingBufferPool::InitializeDevice(ID3D12Device* device, UINT64 ringSize)
 {
-    for (D3D12StagingBuffer& chunk : chunks_)
-        chunk.Reset();
-    chunkIdx_ = 0;
+    device_             = device;
+    ringInitialSize_    = GetAlignedSize(std::max<UINT64>(ringSize, 1u), g_ringSizeGranularity);
 }
 
-HRESULT D3D12StagingBufferPool::WriteStaged(
-    D3D12CommandContext&    commandContext,
-    D3D12Resource&          dstBuffer,
-    UINT64                  dstOffset,
-    const void*             data,
-    UINT64                  dataSize)
+void D3D12StagingBufferPool::NextFrame(UINT frameIndex)
 {
-    /* Find a chunk that fits the requested data size or allocate a new chunk */
-    while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(dataSize))
-        ++chunkIdx_;
+    LLGL_ASSERT(frameIndex < D3D12StagingBufferPool::maxNumFrames);
 
-    if (chunkIdx_ == chunks_.size())
-        AllocChunk(dataSize);
+    /* Store end of current frame and reclaim everything up to the end of the previous use of the next frame */
+    frameEnds_[currentFrame_] = ringHead_;
+    currentFrame_ = frameIndex;
+    ringTail_ = std::max(ringTail_, frameEnds_[frameIndex]);
 
-    /* Write data to current chunk */
-    HRESULT hr;
-    commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
+    /* Release ring buffers that were replaced during the previous use of this frame */
+    retiredRingBuffers_[frameIndex].clear();
+}
+
+UINT64 D3D12StagingBufferPool::GetTotalSize() const
+{
+    UINT64 totalSize = ringBuffer_.GetSize() + globalReadbackBuffer_.GetSize();
+    for (const std::vector<D3D12StagingBuffer>& retiredRingBuffers : retiredRingBuffers_)
     {
-        D3D12StagingBuffer& chunk = chunks_[chunkIdx_];
-        hr = chunk.WriteAndIncrementOffset(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
+        for (const D3D12StagingBuffer& stagingBuffer : retiredRingBuffers)
+            totalSize += stagingBuffer.GetSize();
     }
-    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
-    return hr;
+    return totalSize;
 }
 
-HRESULT D3D12StagingBufferPool::WriteImmediate(
+HRESULT D3D12StagingBufferPool::WriteStaged(
     D3D12CommandContext&    commandContext,
     D3D12Resource&          dstBuffer,
     UINT64                  dstOffset,
@@ -68,11 +63,14 @@ HRESULT D3D12StagingBufferPool::WriteImmediate(
     UINT64                  dataSize,
     UINT64                  alignment)
 {
-    /* Write data to global upload buffer and copy region to destination buffer */
+    /* Allocate region in ring buffer for current frame */
+    const UINT64 srcOffset = AllocRingRegion(dataSize, alignment);
+
+    /* Write data to ring buffer and copy region to destination buffer */
     HRESULT hr;
     commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
     {
-        hr = GetUploadBufferAndGrow(dataSize, alignment).Write(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
+        hr = ringBuffer_.WriteAt(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize, srcOffset);
     }
     commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
     return hr;
@@ -120,10 +118,45 @@ HRESULT D3D12StagingBufferPool::ReadSubresourceRegion(
  * ======= Private: =======
  */
 
-void D3D12StagingBufferPool::AllocChunk(UINT64 minChunkSize)
+UINT64 D3D12StagingBufferPool::AllocRingRegion(UINT64 size, UINT64 alignment)
 {
-    chunks_.emplace_back(device_, std::max(chunkSize_, minChunkSize));
-    chunkIdx_ = chunks_.size() - 1;
+    if (ringBuffer_.GetNative() == nullptr)
+        GrowRing(size);
+
+    /* Skip the remaining space at the end of the ring if the region does not fit in there; regions never wrap around */
+    const UINT64 ringSize = ringBuffer_.GetSize();
+    UINT64 offset = GetAlignedSize(ringHead_, alignment);
+    if (offset % ringSize + size > ringSize)
+        offset = GetAlignedSize(offset, ringSize);
+
+    /* Grow ring buffer if the new region would overlap with frames that are still in flight */
+    if (offset + size - ringTail_ > ringSize)
+    {
+        GrowRing(size);
+        offset = 0;
+    }
+
+    ringHead_ = offset + size;
+    return offset % ringBuffer_.GetSize();
+}
+
+void D3D12StagingBufferPool::GrowRing(UINT64 minSize)
+{
+    /* Keep old ring buffer alive until the current frame has been reclaimed, which implies all previous frames to be completed */
+    UINT64 newSize = std::max(ringInitialSize_, GetAlignedSize(minSize, g_ringSizeGranularity));
+    if (ringBuffer_.GetNative() != nullptr)
+    {
+        newSize = std::max(newSize, ringBuffer_.GetSize() * 2);
+        retiredRingBuffers_[currentFrame_].push_back(std::move(ringBuffer_));
+    }
+
+    ringBuffer_.Create(device_, newSize, 256u, D3D12_HEAP_TYPE_UPLOAD);
+
+    /* New ring buffer is empty; previous frames only refer to the retired ring buffers */
+    ringHead_ = 0;
+    ringTail_ = 0;
+    for (UINT64& frameEnd : frameEnds_)
+        frameEnd = 0;
 }
 
 void D3D12StagingBufferPool::ResizeBuffer(
@@ -142,12 +175,6 @@ void D3D12StagingBufferPool::ResizeBuffer(
     }
 }
 
-D3D12StagingBuffer& D3D12StagingBufferPool::GetUploadBufferAndGrow(UINT64 size, UINT64 alignment)
-{
-    ResizeBuffer(globalUploadBuffer_, D3D12_HEAP_TYPE_UPLOAD, size, alignment);
-    return globalUploadBuffer_;
-}
-
 D3D12StagingBuffer& D3D12StagingBufferPool::GetReadbackBufferAndGrow(UINT64 size, UINT64 alignment)
 {
     ResizeBuffer(globalReadbackBuffer_, D3D12_HEAP_TYPE_READBACK, size, alignment);
@@ -22,37 +22,44 @@ struct D3D12Resource;
 class D3D12CommandContext;
 class D3D12CommandQueue;
 
+/*
+Ring allocator over a single persistently mapped upload buffer for buffer updates during command encoding.
+Each frame (i.e. command allocator of a command context) occupies a contiguous region of the ring,
+which is reclaimed once the fence of that command allocator has been signaled (see NextFrame).
+The ring only grows if all in-flight frames together exceed its size; the old ring is then released with the current frame.
+*/
 class D3D12StagingBufferPool
 {
 
+    public:
+
+        static constexpr UINT maxNumFrames = 8;
+
     public:
 
         D3D12StagingBufferPool() = default;
-        D3D12StagingBufferPool(ID3D12Device* device, UINT64 chunkSize);
+        D3D12StagingBufferPool(ID3D12Device* device, UINT64 ringSize);
 
-        // Initializes the device object and chunk size.
-        void InitializeDevice(ID3D12Device* device, UINT64 chunkSize);
+        // Initializes the device object and initial ring buffer size. The ring buffer is created on first use.
+        void InitializeDevice(ID3D12Device* device, UINT64 ringSize);
 
-        // Resets all chunks in the pool.
-        void Reset();
+        /*
+        Switches to the specified frame and reclaims all ring memory that was allocated during the previous use of that frame.
+        The GPU must have finished executing all commands that were encoded with that frame.
+        */
+        void NextFrame(UINT frameIndex);
 
-        // Writes the specified data to the destination buffer using the staging pool.
-        HRESULT WriteStaged(
-            D3D12CommandContext&    commandContext,
-            D3D12Resource&          dstBuffer,
-            UINT64                  dstOffset,
-            const void*             data,
-            UINT64                  dataSize
-        );
+        // Returns the total size (in bytes) of all staging buffers in this pool, including retired ring buffers that are still in flight.
+        UINT64 GetTotalSize() const;
 
-        // Writes the specified data to the destination buffer using the global upload buffer.
-        HRESULT WriteImmediate(
+        // Writes the specified data to the destination buffer using the current frame of the upload ring buffer.
+        HRESULT WriteStaged(
             D3D12CommandContext&    commandContext,
             D3D12Resource&          dstBuffer,
             UINT64                  dstOffset,
             const void*             data,
             UINT64                  dataSize,
-            UINT64                  alignment   = 256u
+            UINT64                  alignment   = 16u
         );
 
         // Copies the specified subresource region into the global readback buffer and writes it into the output data.
@@ -68,8 +75,11 @@ class D3D12StagingBufferPool
 
     private:
 
-        // Allocates a new chunk with the specified minimal size.
-        void AllocChunk(UINT64 minChunkSize);
+        // Allocates a region in the ring buffer and returns its offset within the native buffer.
+        UINT64 AllocRingRegion(UINT64 size, UINT64 alignment);
+
+        // Replaces the ring buffer by a larger one. The old ring buffer is released with the current frame.
+        void GrowRing(UINT64 minSize);
 
         // Resizes the specified staging buffer, but only grows its size.
         void ResizeBuffer(
@@ -79,18 +89,20 @@ class D3D12StagingBufferPool
             UINT64              alignment
         );
 
-        D3D12StagingBuffer& GetUploadBufferAndGrow(UINT64 size, UINT64 alignment);
         D3D12StagingBuffer& GetReadbackBufferAndGrow(UINT64 size, UINT64 alignment);
 
     private:
 
-        ID3D12Device*                   device_             = nullptr;
+        ID3D12Device*                   device_                             = nullptr;
 
-        std::vector<D3D12StagingBuffer> chunks_;
-        std::size_t                     chunkIdx_           = 0;
-        UINT64                          chunkSize_          = 0;
+        D3D12StagingBuffer              ringBuffer_;
+        UINT64                          ringInitialSize_                    = 0;
+        UINT64                          ringHead_                           = 0; // Monotonically increasing; modulo ring size is the offset in the buffer.
+        UINT64                          ringTail_                           = 0; // End of the oldest frame that may still be in flight.
+        UINT64                          frameEnds_[maxNumFrames]            = {};
+        UINT                            currentFrame_                       = 0;
+        std::vector<D3D12StagingBuffer> retiredRingBuffers_[maxNumFrames];
 
-        D3D12StagingBuffer              globalUploadBuffer_;
         D3D12StagingBuffer              globalReadbackBuffer_;
 
 };
@@ -12,10 +12,12 @@
 #include "../D3D12RenderSystem.h"
 #include "../D3D12Types.h"
 #include "../../TextureUtils.h"
+#include "../../BufferUtils.h"
 #include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/CompilerExtensions.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 #include "../Buffer/D3D12Buffer.h"
 #include "../Buffer/D3D12BufferArray.h"
@@ -33,6 +35,7 @@
 
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
 #include "../D3DX12/d3dx12.h"
@@ -46,9 +49,9 @@ namespace LLGL
 
 
 D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc) :
-    cmdSignatureFactory_ { &(renderSystem.GetSignatureFactory())                         },
-    immediateSubmit_     { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)     },
-    commandQueue_        { LLGL_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue()) }
+    cmdSignatureFactory_ { &(renderSystem.GetSignatureFactory())                                       },
+    immediateSubmit_     { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)                   },
+    commandQueue_        { LLGL_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue(desc.queueType)) }
 {
     CreateCommandContext(renderSystem, desc);
     if (desc.debugName != nullptr)
@@ -64,6 +67,8 @@ void D3D12CommandBuffer::SetDebugName(const char* name)
 
 void D3D12CommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     /* Reset command list using the next command allocator */
     commandContext_.Reset(*commandQueue_);
 }
@@ -79,6 +84,8 @@ void D3D12CommandBuffer::End()
     /* Execute command list right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
         commandContext_.ExecuteAndSignal(*commandQueue_);
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void D3D12CommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -118,6 +125,26 @@ void D3D12CommandBuffer::CopyBuffer(
     commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState, true);
 }
 
+void D3D12CommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+
+    /* Transition both buffers only once for all regions */
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    {
+        for_range(i, numRegions)
+            GetNative()->CopyBufferRegion(dstBufferD3D.GetNative(), regions[i].dstOffset, srcBufferD3D.GetNative(), regions[i].srcOffset, regions[i].size);
+    }
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState, true);
+}
+
 void D3D12CommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -221,6 +248,133 @@ void D3D12CommandBuffer::FillBuffer(
     dstBufferD3D.ClearSubresourceUInt(commandContext_, DXGI_FORMAT_R32_UINT, sizeof(UINT), dstOffset, fillSize, valuesVec4);
 }
 
+void D3D12CommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(dstBufferD3D.GetBufferSize(), dstOffset, clearSize);
+
+    /* Use native fill operation if the element is a repeated 32-bit pattern, otherwise write the element repeatedly */
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+        FillBuffer(dstBuffer, dstOffset, pattern, clearSize);
+    else
+        ClearBufferWithElement(*this, dstBuffer, dstOffset, clearSize, element, elementSize);
+}
+
+void D3D12CommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+
+    ID3D12Device*           device          = commandContext_.GetDevice();
+    const Format            format          = textureD3D.GetFormat();
+    const FormatAttributes& formatAttribs   = GetFormatAttribs(format);
+    const long              bindFlags       = textureD3D.GetBindFlags();
+    const bool              isTexture3D     = (textureD3D.GetType() == TextureType::Texture3D);
+
+    /* Select the native clear operation by the binding flags with the fastest path first */
+    D3D12_RESOURCE_STATES clearState = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    if ((bindFlags & BindFlags::DepthStencilAttachment) != 0)
+        clearState = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+    else if ((bindFlags & BindFlags::ColorAttachment) != 0)
+        clearState = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+    commandContext_.TransitionResource(textureD3D.GetResource(), clearState, true);
+
+    for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+    {
+        /* Array layers are ignored for 3D textures, so select all depth slices of the current MIP-map instead */
+        const UINT baseLayer = (isTexture3D ? 0u : subresource.baseArrayLayer);
+        const UINT numLayers = (isTexture3D ? textureD3D.GetMipExtent(mipLevel).z : subresource.numArrayLayers);
+
+        if (clearState == D3D12_RESOURCE_STATE_DEPTH_WRITE)
+        {
+            const D3D12_CPU_DESCRIPTOR_HANDLE dsvDescHandle = clearDSVDescHeap_.GetCpuHandleStart();
+            textureD3D.CreateDepthStencilView(device, dsvDescHandle, mipLevel, baseLayer, numLayers);
+            const D3D12_CLEAR_FLAGS clearFlags = (IsStencilFormat(format) ? D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL : D3D12_CLEAR_FLAG_DEPTH);
+            GetNative()->ClearDepthStencilView(dsvDescHandle, clearFlags, clearValue.depth, static_cast<UINT8>(clearValue.stencil & 0xFF), 0, nullptr);
+        }
+        else if (clearState == D3D12_RESOURCE_STATE_RENDER_TARGET)
+        {
+            const D3D12_CPU_DESCRIPTOR_HANDLE rtvDescHandle = clearRTVDescHeap_.GetCpuHandleStart();
+            textureD3D.CreateRenderTargetView(device, rtvDescHandle, mipLevel, baseLayer, numLayers);
+            GetNative()->ClearRenderTargetView(rtvDescHandle, clearValue.color, 0, nullptr);
+        }
+        else
+        {
+            /* UAV clears require both a non-shader-visible CPU descriptor and a shader-visible GPU descriptor */
+            TextureViewDescriptor uavDesc;
+            {
+                uavDesc.type                        = textureD3D.GetType();
+                uavDesc.format                      = format;
+                uavDesc.subresource.baseMipLevel    = mipLevel;
+                uavDesc.subresource.numMipLevels    = 1;
+                uavDesc.subresource.baseArrayLayer  = baseLayer;
+                uavDesc.subresource.numArrayLayers  = numLayers;
+            }
+            const D3D12_CPU_DESCRIPTOR_HANDLE uavDescHandle = clearUAVDescHeap_.GetCpuHandleStart();
+            textureD3D.CreateUnorderedAccessView(device, uavDescHandle, uavDesc);
+            const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext_.CopyDescriptorsForStaging(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, uavDescHandle, 0, 1);
+
+            if ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0)
+            {
+                /* Integer formats are cleared with the truncated clear color */
+                UINT valuesVec4[4];
+                for_range(i, 4)
+                {
+                    if ((formatAttribs.flags & FormatFlags::IsUnsigned) != 0)
+                        valuesVec4[i] = static_cast<UINT>(std::max(0.0f, clearValue.color[i]));
+                    else
+                        valuesVec4[i] = static_cast<UINT>(static_cast<INT>(clearValue.color[i]));
+                }
+                GetNative()->ClearUnorderedAccessViewUint(gpuDescHandle, uavDescHandle, textureD3D.GetNative(), valuesVec4, 0, nullptr);
+            }
+            else
+                GetNative()->ClearUnorderedAccessViewFloat(gpuDescHandle, uavDescHandle, textureD3D.GetNative(), clearValue.color, 0, nullptr);
+        }
+    }
+
+    commandContext_.TransitionResource(textureD3D.GetResource(), textureD3D.GetResource().usageState, true);
+}
+
+void D3D12CommandBuffer::DiscardResource(Resource& resource)
+{
+    /* D3D12 only supports discarding textures that are in a render target, depth-stencil, or unordered access state */
+    if (resource.GetResourceType() != ResourceType::Texture)
+        return;
+
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
+
+    const long bindFlags = textureD3D.GetBindFlags();
+    D3D12_RESOURCE_STATES discardState;
+    if ((bindFlags & BindFlags::DepthStencilAttachment) != 0)
+        discardState = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+    else if ((bindFlags & BindFlags::ColorAttachment) != 0)
+        discardState = D3D12_RESOURCE_STATE_RENDER_TARGET;
+    else if ((bindFlags & BindFlags::Storage) != 0)
+        discardState = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    else
+        return;
+
+    commandContext_.TransitionResource(textureD3D.GetResource(), discardState, true);
+    GetNative()->DiscardResource(textureD3D.GetNative(), nullptr);
+    commandContext_.TransitionResource(textureD3D.GetResource(), textureD3D.GetResource().usageState, true);
+}
+
 void D3D12CommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -252,6 +406,42 @@ void D3D12CommandBuffer::CopyTexture(
     commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState, true);
 }
 
+void D3D12CommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+
+    /* Transition both textures only once for all regions */
+    commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    {
+        for_range(i, numRegions)
+        {
+            const TextureCopyRegion& region = regions[i];
+
+            const D3D12_TEXTURE_COPY_LOCATION dstLocationD3D = dstTextureD3D.CalcCopyLocation(region.dstLocation);
+            const D3D12_TEXTURE_COPY_LOCATION srcLocationD3D = srcTextureD3D.CalcCopyLocation(region.srcLocation);
+
+            const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(region.srcLocation.offset, region.extent);
+
+            GetNative()->CopyTextureRegion(
+                &dstLocationD3D,                                    // pDst
+                static_cast<UINT>(region.dstLocation.offset.x),     // DstX
+                static_cast<UINT>(region.dstLocation.offset.y),     // DstY
+                static_cast<UINT>(region.dstLocation.offset.z),     // DstZ
+                &srcLocationD3D,                                    // pSrc
+                &srcBox                                             // pSrcBox
+            );
+        }
+    }
+    commandContext_.TransitionResource(dstTextureD3D.GetResource(), dstTextureD3D.GetResource().usageState);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState, true);
+}
+
 void D3D12CommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -384,6 +574,11 @@ void D3D12CommandBuffer::GenerateMips(Texture& texture, const TextureSubresource
     D3D12MipGenerator::Get().GenerateMips(commandContext_, textureD3D, subresource);
 }
 
+void D3D12CommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    D3D12MipGenerator::Get().GenerateMipsBatch(commandContext_, numTextures, textures);
+}
+
 /* ----- Viewport and Scissor ----- */
 
 // Check if D3D12_VIEWPORT and Viewport structures can be safely reinterpret-casted
@@ -507,20 +702,56 @@ void D3D12CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
 
 /* ----- Buffers ------ */
 
-void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer)
+// Moves the start of the specified vertex buffer view by the specified offset. Returns false if the offset is out of bounds.
+static bool OffsetVertexBufferView(D3D12_VERTEX_BUFFER_VIEW& vertexBufferView, std::uint64_t offset)
+{
+    if (offset >= vertexBufferView.SizeInBytes)
+        return false;
+    vertexBufferView.BufferLocation += offset;
+    vertexBufferView.SizeInBytes    -= static_cast<UINT>(offset);
+    return true;
+}
+
+void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    GetNative()->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
+    if (offset == 0)
+        GetNative()->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
+    else
+    {
+        D3D12_VERTEX_BUFFER_VIEW vertexBufferView = bufferD3D.GetVertexBufferView();
+        if (OffsetVertexBufferView(vertexBufferView, offset))
+            GetNative()->IASetVertexBuffers(0, 1, &vertexBufferView);
+    }
 }
 
-void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayD3D = LLGL_CAST(D3D12BufferArray&, bufferArray);
-    GetNative()->IASetVertexBuffers(
-        0,
-        static_cast<UINT>(bufferArrayD3D.GetVertexBufferViews().size()),
-        bufferArrayD3D.GetVertexBufferViews().data()
-    );
+    const auto& vertexBufferViews = bufferArrayD3D.GetVertexBufferViews();
+    if (offsets == nullptr)
+    {
+        GetNative()->IASetVertexBuffers(
+            0,
+            static_cast<UINT>(vertexBufferViews.size()),
+            vertexBufferViews.data()
+        );
+    }
+    else
+    {
+        /* Copy vertex buffer views and move their start by the respective offsets */
+        SmallVector<D3D12_VERTEX_BUFFER_VIEW, 8> offsetVertexBufferViews(vertexBufferViews.begin(), vertexBufferViews.end());
+        for_range(i, offsetVertexBufferViews.size())
+        {
+            if (!OffsetVertexBufferView(offsetVertexBufferViews[i], offsets[i]))
+                return;
+        }
+        GetNative()->IASetVertexBuffers(
+            0,
+            static_cast<UINT>(offsetVertexBufferViews.size()),
+            offsetVertexBufferViews.data()
+        );
+    }
 }
 
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -552,18 +783,22 @@ void D3D12CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32
 
     auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
 
+    /* Refresh default texture SRVs if any min-LOD clamp has changed, before the descriptors are copied */
+    resourceHeapD3D.UpdateMinLODDescriptors();
+
     /* Copy descriptors for specified set into shader-visible descriptor heap */
     for_range(i, 2)
     {
         const auto heapType = static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(i);
         if (resourceHeapD3D.GetDescriptorHeap(heapType) != nullptr)
         {
-            /* Copies the entire set of descriptors from the non-shader-visible heap to the global shader-visible heap */
+            /* Copies the entire set of descriptors from the non-shader-visible heap to the global shader-visible heap, unless it has already been copied in this frame */
             D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext_.CopyDescriptorsForStaging(
                 heapType,
                 resourceHeapD3D.GetCPUDescriptorHandleForHeapStart(heapType, descriptorSet),
                 0,
-                resourceHeapD3D.GetNumDescriptorsPerSet(heapType)
+                resourceHeapD3D.GetNumDescriptorsPerSet(heapType),
+                resourceHeapD3D.GetContentVersion()
             );
 
             /* Bind descriptor table to root parameter */
@@ -623,6 +858,44 @@ void D3D12CommandBuffer::SetResource(std::uint32_t descriptor, Resource& resourc
     }
 }
 
+void D3D12CommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return /*E_POINTER*/;
+
+    if (!(descriptor < boundPipelineLayout_->GetNumBindings()))
+        return /*E_INVALIDARG*/;
+
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    if (!(offset < bufferD3D.GetBufferSize()))
+        return /*E_INVALIDARG*/;
+
+    const D3D12DescriptorLocation& rootParameterLocation = boundPipelineLayout_->GetRootParameterMap()[descriptor];
+    if (rootParameterLocation.type != D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+    {
+        /* Root descriptors have no size, so only move the GPU virtual address by the offset */
+        const D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr = bufferD3D.GetNative()->GetGPUVirtualAddress() + offset;
+        if (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO())
+            commandContext_.SetGraphicsRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+        else
+            commandContext_.SetComputeRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+    }
+    else
+    {
+        /* Bind buffer view with staging descriptor heap; constant buffer views must be a multiple of 256 bytes, which the buffer size is aligned to */
+        const D3D12DescriptorHeapLocation& descriptorLocation = boundPipelineLayout_->GetDescriptorMap()[descriptor];
+
+        BufferViewDescriptor bufferViewDesc;
+        {
+            bufferViewDesc.offset   = offset;
+            bufferViewDesc.size     = std::min(size, bufferD3D.GetBufferSize() - offset);
+            if (descriptorLocation.type == D3D12_DESCRIPTOR_RANGE_TYPE_CBV)
+                bufferViewDesc.size = GetAlignedSize<std::uint64_t>(bufferViewDesc.size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        }
+        commandContext_.EmplaceBufferViewDescriptorForStaging(bufferD3D, bufferViewDesc, descriptorLocation.index, descriptorLocation.type);
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -646,6 +919,20 @@ void D3D12CommandBuffer::BeginRenderPass(
         boundSwapChain_     = nullptr;
         boundRenderTarget_  = LLGL_CAST(D3D12RenderTarget*, &renderTarget);
 
+        #ifdef LLGL_D3D12_VIEW_INSTANCING
+        /* Enable the view instances of a multiview render target; the mask is not inherited from previous command lists */
+        if (boundRenderTarget_->GetViewMask() != 0)
+            commandContext_.SetViewInstanceMask(boundRenderTarget_->GetViewMask());
+        #endif
+
+        /* Let the driver handle load and store operations if native render passes are supported */
+        if (renderPass != nullptr && commandContext_.SupportsNativeRenderPasses())
+        {
+            auto* renderPassD3D = LLGL_CAST(const D3D12RenderPass*, renderPass);
+            BindRenderTargetWithNativeRenderPass(*boundRenderTarget_, *renderPassD3D, numClearValues, clearValues);
+            return;
+        }
+
         BindRenderTarget(*boundRenderTarget_);
     }
 
@@ -660,12 +947,22 @@ void D3D12CommandBuffer::BeginRenderPass(
 void D3D12CommandBuffer::EndRenderPass()
 {
     /* Resolve multi-sampled subresources of previously bound render target */
-    if (boundSwapChain_ != nullptr)
+    if (isNativeRenderPass_)
+    {
+        boundRenderTarget_->EndNativeRenderPass(commandContext_);
+        isNativeRenderPass_ = false;
+    }
+    else if (boundSwapChain_ != nullptr)
         boundSwapChain_->ResolveSubresources(commandContext_, currentColorBuffer_);
     else if (boundRenderTarget_ != nullptr)
         boundRenderTarget_->ResolveSubresources(commandContext_);
 }
 
+void D3D12CommandBuffer::NextSubpass()
+{
+    // dummy - all subpasses render into the same render target views
+}
+
 /* ----- Pipeline States ----- */
 
 void D3D12CommandBuffer::SetPipelineState(PipelineState& pipelineState)
@@ -723,6 +1020,59 @@ void D3D12CommandBuffer::SetStencilReference(std::uint32_t reference, const Sten
     GetNative()->OMSetStencilRef(reference);
 }
 
+void D3D12CommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // dummy - not supported by Direct3D 12
+}
+
+void D3D12CommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // dummy - not supported by Direct3D 12
+}
+
+void D3D12CommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // dummy - not supported by Direct3D 12
+}
+
+void D3D12CommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    GetNative()->IASetPrimitiveTopology(DXTypes::ToD3DPrimitiveTopology(primitiveTopology));
+}
+
+void D3D12CommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+    commandContext_.SetDepthBias(depthBiasDesc.constantFactor, depthBiasDesc.clamp, depthBiasDesc.slopeFactor);
+    #endif
+}
+
+void D3D12CommandBuffer::SetShadingRate(const ShadingRateDescriptor& shadingRateDesc)
+{
+    #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+    const D3D12_SHADING_RATE_COMBINER combiners[2] =
+    {
+        D3D12Types::Map(shadingRateDesc.primitiveCombiner),
+        D3D12Types::Map(shadingRateDesc.imageCombiner),
+    };
+    commandContext_.SetShadingRate(D3D12Types::Map(shadingRateDesc.rate), combiners);
+    #endif
+}
+
+void D3D12CommandBuffer::SetShadingRateImage(Texture* texture)
+{
+    #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+    if (texture != nullptr)
+    {
+        auto* textureD3D = LLGL_CAST(D3D12Texture*, texture);
+        commandContext_.TransitionResource(textureD3D->GetResource(), D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE, true);
+        commandContext_.SetShadingRateImage(textureD3D->GetNative());
+    }
+    else
+        commandContext_.SetShadingRateImage(nullptr);
+    #endif
+}
+
 void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -737,23 +1087,21 @@ void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std:
     const std::uint32_t                             maxNumUniforms  = boundPipelineLayout_->GetNumUniforms();
     const std::vector<D3D12RootConstantLocation>&   rootConstantMap = boundPipelineState_->GetRootConstantMap();
 
-    for (auto words = reinterpret_cast<const UINT*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
+    const bool                                      isGraphicsPSO   = boundPipelineState_->IsGraphicsPSO();
+
+    for (auto words = reinterpret_cast<const UINT*>(data), wordsEnd = words + dataSizeInWords; words < wordsEnd; ++first)
     {
         if (first >= maxNumUniforms)
             return /*E_INVALIDARG*/;
 
+        /* Write all 32-bit values of this uniform with a single root constants command; clamp to the remaining input data */
         const D3D12RootConstantLocation& rootConstantLocation = rootConstantMap[first];
-        UINT wordOffset = rootConstantLocation.wordOffset;
-        for_range(i, rootConstantLocation.num32BitValues)
-        {
-            const D3D12Constant value{ words[i] };
-            if (boundPipelineState_->IsGraphicsPSO())
-                commandContext_.SetGraphicsConstant(rootConstantLocation.index, value, wordOffset);
-            else
-                commandContext_.SetComputeConstant(rootConstantLocation.index, value, wordOffset);
-            ++wordOffset;
-        }
-        words += rootConstantLocation.num32BitValues;
+        const UINT num32BitValues = std::min<UINT>(rootConstantLocation.num32BitValues, static_cast<UINT>(wordsEnd - words));
+        if (isGraphicsPSO)
+            commandContext_.SetGraphicsConstants(rootConstantLocation.index, words, num32BitValues, rootConstantLocation.wordOffset);
+        else
+            commandContext_.SetComputeConstants(rootConstantLocation.index, words, num32BitValues, rootConstantLocation.wordOffset);
+        words += num32BitValues;
     }
 }
 
@@ -800,6 +1148,23 @@ void D3D12CommandBuffer::EndRenderCondition()
     GetNative()->SetPredication(nullptr, 0, D3D12_PREDICATION_OP_EQUAL_ZERO);
 }
 
+void D3D12CommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST, true);
+    {
+        queryHeapD3D.ResolveDataInto(GetNative(), firstQuery, numQueries, dstBufferD3D.GetNative(), dstOffset);
+    }
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState, true);
+}
+
 /* ----- Stream Output ------ */
 
 void D3D12CommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -895,6 +1260,11 @@ void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uin
     commandContext_.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void D3D12CommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    commandContext_.DrawIndexedInstancedN(draws, numDraws);
+}
+
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
@@ -947,6 +1317,62 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D12CommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferD3D    = LLGL_CAST(D3D12Buffer&, argumentsBuffer);
+    auto& countBufferD3D        = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetSignatureDrawIndirect(stride),
+        maxNumCommands,
+        argumentsBufferD3D.GetNative(),
+        argumentsOffset,
+        countBufferD3D.GetNative(),
+        countOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferD3D    = LLGL_CAST(D3D12Buffer&, argumentsBuffer);
+    auto& countBufferD3D        = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(stride),
+        maxNumCommands,
+        argumentsBufferD3D.GetNative(),
+        argumentsOffset,
+        countBufferD3D.GetNative(),
+        countOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    #ifdef LLGL_D3D12_MESH_SHADERS
+    commandContext_.DispatchMesh(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+    #endif
+}
+
+void D3D12CommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    #ifdef LLGL_D3D12_MESH_SHADERS
+    /* Mesh dispatches use the graphics root signature, so they are encoded like indirect draw commands */
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDispatchMeshIndirect(stride), numCommands, bufferD3D.GetNative(), offset);
+    #endif
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1000,8 +1426,13 @@ static D3D12_COMMAND_LIST_TYPE GetD3DCommandListType(const CommandBufferDescript
 {
     if ((desc.flags & CommandBufferFlags::Secondary) != 0)
         return D3D12_COMMAND_LIST_TYPE_BUNDLE;
-    else
-        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    switch (desc.queueType)
+    {
+        case CommandQueueType::Compute: return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+        case CommandQueueType::Copy:    return D3D12_COMMAND_LIST_TYPE_COPY;
+        default:                        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+    }
 }
 
 void D3D12CommandBuffer::CreateCommandContext(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc)
@@ -1014,6 +1445,11 @@ void D3D12CommandBuffer::CreateCommandContext(D3D12RenderSystem& renderSystem, c
     /* Store increment size for descriptor heaps */
     rtvDescSize_ = device.GetNative()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
     dsvDescSize_ = device.GetNative()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+
+    /* Create descriptor heaps for ClearTexture; clear commands consume their descriptors when they are recorded, so one descriptor per type is sufficient */
+    clearRTVDescHeap_.Create(device.GetNative(), D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1);
+    clearDSVDescHeap_.Create(device.GetNative(), D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 1);
+    clearUAVDescHeap_.Create(device.GetNative(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
 }
 
 void D3D12CommandBuffer::SetAndConvertViewports(std::uint32_t numViewports, const Viewport* viewports)
@@ -1117,6 +1553,23 @@ void D3D12CommandBuffer::BindRenderTarget(D3D12RenderTarget& renderTargetD3D)
         GetNative()->OMSetRenderTargets(numColorBuffers_, &rtvDescHandle_, TRUE, nullptr);
 }
 
+void D3D12CommandBuffer::BindRenderTargetWithNativeRenderPass(
+    D3D12RenderTarget&      renderTargetD3D,
+    const D3D12RenderPass&  renderPassD3D,
+    std::uint32_t           numClearValues,
+    const ClearValue*       clearValues)
+{
+    /* Store current RTV and optional DSV for clear commands within the render pass */
+    numColorBuffers_ = renderTargetD3D.GetNumColorAttachments();
+
+    rtvDescHandle_ = renderTargetD3D.GetCPUDescriptorHandleForRTV();
+    dsvDescHandle_ = renderTargetD3D.GetCPUDescriptorHandleForDSV();
+
+    /* Begin native render pass, which also replaces OMSetRenderTargets and the clear commands of the load operations */
+    renderTargetD3D.BeginNativeRenderPass(commandContext_, renderPassD3D, numClearValues, clearValues);
+    isNativeRenderPass_ = true;
+}
+
 void D3D12CommandBuffer::BindSwapChain(D3D12SwapChain& swapChainD3D, std::uint32_t swapBufferIndex)
 {
     /* Translate swap-index into actual D3D color buffer index */
@@ -1249,6 +1702,7 @@ void D3D12CommandBuffer::ResetBindingStates()
 {
     numDefaultScissorRects_ = 0;
     numSOBuffers_           = 0;
+    isNativeRenderPass_     = false;
     boundRenderTarget_      = nullptr;
     boundSwapChain_         = nullptr;
     boundPipelineLayout_    = nullptr;
@@ -13,8 +13,10 @@
 #include <LLGL/Constants.h>
 #include <cstddef>
 #include "D3D12CommandContext.h"
+#include "../RenderState/D3D12DescriptorHeap.h"
 #include "../../DXCommon/ComPtr.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -79,6 +81,12 @@ class D3D12CommandBuffer final : public CommandBuffer
         void SetDefaultScissorRects(UINT numScissorRects);
 
         void BindRenderTarget(D3D12RenderTarget& renderTargetD3D);
+        void BindRenderTargetWithNativeRenderPass(
+            D3D12RenderTarget&      renderTargetD3D,
+            const D3D12RenderPass&  renderPassD3D,
+            std::uint32_t           numClearValues,
+            const ClearValue*       clearValues
+        );
         void BindSwapChain(D3D12SwapChain& swapChainD3D, std::uint32_t swapBufferIndex = LLGL_CURRENT_SWAP_INDEX);
 
         std::uint32_t ClearAttachmentsWithRenderPass(
@@ -122,7 +130,12 @@ class D3D12CommandBuffer final : public CommandBuffer
         D3D12_CPU_DESCRIPTOR_HANDLE     dsvDescHandle_                              = {};
         UINT                            dsvDescSize_                                = 0;
 
+        D3D12DescriptorHeap             clearRTVDescHeap_;                                  // Single RTV for ClearTexture
+        D3D12DescriptorHeap             clearDSVDescHeap_;                                  // Single DSV for ClearTexture
+        D3D12DescriptorHeap             clearUAVDescHeap_;                                  // Single non-shader-visible UAV for ClearTexture
+
         bool                            scissorEnabled_                             = false;
+        bool                            isNativeRenderPass_                         = false;
         UINT                            numDefaultScissorRects_                     = 0;
         UINT                            numColorBuffers_                            = 0;
         UINT                            currentColorBuffer_                         = 0;
@@ -134,6 +147,8 @@ class D3D12CommandBuffer final : public CommandBuffer
         D3D12PipelineState*             boundPipelineState_                         = nullptr;
         D3D12Buffer*                    boundSOBuffers_[LLGL_MAX_NUM_SO_BUFFERS]    = {};
 
+        CPUProfileSpan                  encodeSpan_;
+
 };
 
 
@@ -12,6 +12,7 @@
 #include "../RenderState/D3D12Fence.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../../Core/Assertion.h"
+#include <LLGL/TextureFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <limits.h>
@@ -37,6 +38,27 @@ D3D12CommandContext::D3D12CommandContext(D3D12Device& device)
     Create(device);
 }
 
+static D3D12_RESOURCE_STATES GetSupportedResourceStatesForListType(D3D12_COMMAND_LIST_TYPE commandListType)
+{
+    switch (commandListType)
+    {
+        case D3D12_COMMAND_LIST_TYPE_COMPUTE:
+            return
+            (
+                D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER |
+                D3D12_RESOURCE_STATE_UNORDERED_ACCESS           |
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE  |
+                D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT          |
+                D3D12_RESOURCE_STATE_COPY_DEST                  |
+                D3D12_RESOURCE_STATE_COPY_SOURCE
+            );
+        case D3D12_COMMAND_LIST_TYPE_COPY:
+            return (D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_COPY_SOURCE);
+        default:
+            return static_cast<D3D12_RESOURCE_STATES>(~0);
+    }
+}
+
 void D3D12CommandContext::Create(
     D3D12Device&            device,
     D3D12_COMMAND_LIST_TYPE commandListType,
@@ -45,31 +67,119 @@ void D3D12CommandContext::Create(
     bool                    initialClose)
 {
     /* Store reference to device and command queue */
-    device_ = device.GetNative();
+    device_             = device.GetNative();
+    commandListType_    = commandListType;
 
     /* Create fence for command allocators */
     allocatorFence_.Create(device.GetNative());
 
-    /* Determine number of command allocators */
-    numAllocators_ = std::max(1u, std::min(numAllocators, D3D12CommandContext::maxNumAllocators));
+    /* Determine initial number of command allocators; more are created on demand while all of them are in flight */
+    numAllocators_ = std::max(1u, std::min(numAllocators, D3D12CommandContext::maxNumInitialAllocators));
 
     /* Create command allocators and descriptor heap pools */
     constexpr UINT64 minStagingChunkSize = 256;
     initialStagingChunkSize = std::max(minStagingChunkSize, initialStagingChunkSize);
 
+    stagingBufferPool_.InitializeDevice(device.GetNative(), initialStagingChunkSize);
+
+    for_range(i, D3D12CommandContext::maxNumDescriptorHeaps)
+        stagingDescriptorPools_[i].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[i]);
+
     for_range(i, numAllocators_)
     {
-        commandAllocators_[i] = device.CreateDXCommandAllocator(commandListType);
-        for_range(j, D3D12CommandContext::maxNumDescriptorHeaps)
-            stagingDescriptorPools_[i][j].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[j]);
-        descriptorCaches_[i].Create(device.GetNative());
-        stagingBufferPools_[i].InitializeDevice(device.GetNative(), initialStagingChunkSize);
-        intermediateBufferPools_[i].InitializeDevice(device.GetNative());
+        const UINT allocatorIndex = CreateCommandAllocator();
+        if (allocatorIndex > 0)
+            allocatorQueue_[allocatorQueueSize_++] = allocatorIndex;
     }
 
     /* Create graphics command list and close it (they are created in recording mode) */
     commandList_ = device.CreateDXCommandList(commandListType, GetCommandAllocator());
 
+    /* Compute and copy command lists only support a subset of resource states */
+    supportedResourceStates_ = GetSupportedResourceStatesForListType(commandListType);
+
+    #ifdef LLGL_D3D12_ENHANCED_BARRIERS
+
+    /* Submit resource barriers as enhanced barriers if supported by the device (bundles cannot record barriers) */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS12 options12 = {};
+    if (commandListType != D3D12_COMMAND_LIST_TYPE_BUNDLE &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS12, &options12, sizeof(options12))) &&
+        options12.EnhancedBarriersSupported)
+    {
+        commandList_.As(&commandList7_);
+    }
+
+    #endif // /LLGL_D3D12_ENHANCED_BARRIERS
+
+    /* Record native render passes if the driver implements them beyond software emulation (render passes are not allowed in bundles) */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS5 options5 = {};
+    if (commandListType == D3D12_COMMAND_LIST_TYPE_DIRECT &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS5, &options5, sizeof(options5))) &&
+        options5.RenderPassesTier >= D3D12_RENDER_PASS_TIER_1)
+    {
+        commandList_.As(&commandList4_);
+    }
+
+    #ifdef LLGL_D3D12_MESH_SHADERS
+
+    /* Record mesh shader dispatches if the device supports at least mesh shader tier 1 */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    if (commandListType != D3D12_COMMAND_LIST_TYPE_COMPUTE &&
+        commandListType != D3D12_COMMAND_LIST_TYPE_COPY &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7))) &&
+        options7.MeshShaderTier >= D3D12_MESH_SHADER_TIER_1)
+    {
+        commandList_.As(&commandList6_);
+    }
+
+    #endif // /LLGL_D3D12_MESH_SHADERS
+
+    #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+    /* Record dynamic depth bias if supported by the device */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS16 options16 = {};
+    if (commandListType != D3D12_COMMAND_LIST_TYPE_COMPUTE &&
+        commandListType != D3D12_COMMAND_LIST_TYPE_COPY &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &options16, sizeof(options16))) &&
+        options16.DynamicDepthBiasSupported)
+    {
+        commandList_.As(&commandList9_);
+    }
+
+    #endif // /LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+    #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+
+    /* Record variable rate shading if the device supports at least VRS tier 1 */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (commandListType != D3D12_COMMAND_LIST_TYPE_COMPUTE &&
+        commandListType != D3D12_COMMAND_LIST_TYPE_COPY &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))) &&
+        options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1)
+    {
+        if (SUCCEEDED(commandList_.As(&commandList5_)))
+        {
+            shadingRateTier_        = options6.VariableShadingRateTier;
+            additionalShadingRates_ = (options6.AdditionalShadingRatesSupported != FALSE);
+        }
+    }
+
+    #endif // /LLGL_D3D12_VARIABLE_RATE_SHADING
+
+    #ifdef LLGL_D3D12_VIEW_INSTANCING
+
+    /* Record view instance masks if the device supports at least view instancing tier 1 */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS3 options3 = {};
+    if (commandListType != D3D12_COMMAND_LIST_TYPE_COMPUTE &&
+        commandListType != D3D12_COMMAND_LIST_TYPE_COPY &&
+        SUCCEEDED(device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &options3, sizeof(options3))) &&
+        options3.ViewInstancingTier >= D3D12_VIEW_INSTANCING_TIER_1)
+    {
+        commandList_.As(&commandList1_);
+    }
+
+    #endif // /LLGL_D3D12_VIEW_INSTANCING
+
     if (initialClose)
         commandList_->Close();
 
@@ -79,7 +189,8 @@ void D3D12CommandContext::Create(
 
 void D3D12CommandContext::Close()
 {
-    /* Flush pending resource barriers */
+    /* End pending split barriers and flush pending resource barriers */
+    EndSplitBarriers();
     FlushResourceBarrieres();
 
     /* Close native command list */
@@ -101,11 +212,7 @@ void D3D12CommandContext::ExecuteAndSignal(D3D12CommandQueue& commandQueue)
 
 void D3D12CommandContext::Signal(D3D12CommandQueue& commandQueue)
 {
-    const UINT64 currentFenceValue = allocatorFence_.GetCompletedValue();
-    const UINT64 nextFenceValue = allocatorFenceValues_[currentAllocatorIndex_];
-    if (currentFenceValue < nextFenceValue)
-        commandQueue.SignalFence(allocatorFence_.Get(), nextFenceValue);
-    allocatorFenceValueDirty_[currentAllocatorIndex_] = false;
+    SignalCommandAllocator(commandQueue, currentAllocatorIndex_);
 }
 
 void D3D12CommandContext::Reset(D3D12CommandQueue& commandQueue)
@@ -119,6 +226,9 @@ void D3D12CommandContext::Reset(D3D12CommandQueue& commandQueue)
 
     /* Invalidate state cache */
     ClearCache();
+
+    /* Resources of aliasing heaps might have been changed by other command lists */
+    activeAliasedResources_.clear();
 }
 
 void D3D12CommandContext::ExecuteBundle(D3D12CommandContext& otherContext)
@@ -132,6 +242,9 @@ void D3D12CommandContext::ExecuteBundle(D3D12CommandContext& otherContext)
     */
     SetDescriptorHeapsOfOtherContext(otherContext);
 
+    /* Split barriers must be ended before the bundle accesses any resources */
+    EndSplitBarriers(true);
+
     /* Encode command to execute command list of other context as bundle */
     commandList_->ExecuteBundle(otherContext.GetCommandList());
 }
@@ -149,15 +262,16 @@ void D3D12CommandContext::FinishAndSync(D3D12CommandQueue& commandQueue)
 
 void D3D12CommandContext::TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, bool flushImmediate)
 {
-    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+    newState = GetSupportedResourceState(newState);
+    oldState = GetSupportedResourceState(oldState);
+    if (newState == oldState)
+    {
+        if (flushImmediate)
+            FlushResourceBarrieres();
+        return;
+    }
 
-    /* Initialize resource barrier for resource transition */
-    barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-    barrier.Transition.pResource    = resource;
-    barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    barrier.Transition.StateBefore  = oldState;
-    barrier.Transition.StateAfter   = newState;
+    AppendTransitionBarrier(resource, D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, oldState, newState);
 
     /* Flush resource barrieres if required */
     if (flushImmediate)
@@ -166,17 +280,28 @@ void D3D12CommandContext::TransitionResource(ID3D12Resource* resource, D3D12_RES
 
 void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate)
 {
-    if (resource.currentState != newState)
+    newState = GetSupportedResourceState(newState);
+
+    /* Split barriers of this resource must be ended before it can be transitioned again */
+    if (resource.numSplitBarriers > 0)
+        EndSplitBarriersOfResource(resource);
+
+    if (!resource.subresourceStates.empty())
     {
-        D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+        /* Transition each subresource individually that is not in the new state yet */
+        for_range(i, static_cast<UINT>(resource.subresourceStates.size()))
+        {
+            if (resource.subresourceStates[i] != newState)
+                AppendTransitionBarrier(resource.Get(), i, resource.subresourceStates[i], newState);
+        }
 
-        /* Initialize resource barrier for resource transition */
-        barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-        barrier.Transition.pResource    = resource.Get();
-        barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        barrier.Transition.StateBefore  = resource.currentState;
-        barrier.Transition.StateAfter   = newState;
+        /* Store new uniform transition state */
+        resource.subresourceStates.clear();
+        resource.currentState = newState;
+    }
+    else if (resource.currentState != newState)
+    {
+        AppendTransitionBarrier(resource.Get(), D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, resource.currentState, newState);
 
         /* Store new transition state */
         resource.currentState = newState;
@@ -187,8 +312,136 @@ void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESO
         FlushResourceBarrieres();
 }
 
+void D3D12CommandContext::TransitionSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState, bool flushImmediate)
+{
+    newState = GetSupportedResourceState(newState);
+
+    /* Transition entire resource if this subresource is not tracked individually */
+    if (!resource.IsSubresourceTracked(subresource))
+    {
+        TransitionResource(resource, newState, flushImmediate);
+        return;
+    }
+
+    if (resource.numSplitBarriers > 0)
+        EndSplitBarriersOfResource(resource);
+
+    TransitionTrackedSubresource(resource, subresource, newState);
+    MergeSubresourceStates(resource);
+
+    /* Flush resource barrieres if required */
+    if (flushImmediate)
+        FlushResourceBarrieres();
+}
+
+void D3D12CommandContext::TransitionSubresources(D3D12Resource& resource, const TextureSubresource& subresource, D3D12_RESOURCE_STATES newState, bool flushImmediate)
+{
+    newState = GetSupportedResourceState(newState);
+
+    if (resource.numMipLevels == 0)
+    {
+        TransitionResource(resource, newState, flushImmediate);
+        return;
+    }
+
+    /* Clamp subresource range to the tracked MIP-map levels and array layers */
+    const UINT numMipLevels     = resource.numMipLevels;
+    const UINT numArrayLayers   = resource.numSubresources / numMipLevels;
+
+    const UINT mipBegin         = std::min(subresource.baseMipLevel, numMipLevels);
+    const UINT mipEnd           = mipBegin + std::min(subresource.numMipLevels, numMipLevels - mipBegin);
+    const UINT layerBegin       = std::min(subresource.baseArrayLayer, numArrayLayers);
+    const UINT layerEnd         = layerBegin + std::min(subresource.numArrayLayers, numArrayLayers - layerBegin);
+
+    /* Transition entire resource if the range covers all subresources */
+    if (mipBegin == 0 && mipEnd == numMipLevels && layerBegin == 0 && layerEnd == numArrayLayers)
+    {
+        TransitionResource(resource, newState, flushImmediate);
+        return;
+    }
+
+    if (resource.numSplitBarriers > 0)
+        EndSplitBarriersOfResource(resource);
+
+    for (UINT arrayLayer = layerBegin; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (UINT mipLevel = mipBegin; mipLevel < mipEnd; ++mipLevel)
+            TransitionTrackedSubresource(resource, mipLevel + arrayLayer * numMipLevels, newState);
+    }
+
+    MergeSubresourceStates(resource);
+
+    /* Flush resource barrieres if required */
+    if (flushImmediate)
+        FlushResourceBarrieres();
+}
+
+void D3D12CommandContext::BeginTransitionSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState)
+{
+    newState = GetSupportedResourceState(newState);
+
+    /* Split barriers of this resource must be ended before it can be transitioned again */
+    if (resource.numSplitBarriers > 0)
+        EndSplitBarriersOfResource(resource);
+
+    /* Fall back to a regular transition if there is no more room for split barriers or the entire resource is not in a uniform state */
+    const bool isTracked = resource.IsSubresourceTracked(subresource);
+    if (numSplitBarriers_ == D3D12CommandContext::maxNumSplitBarriers || (!isTracked && !resource.subresourceStates.empty()))
+    {
+        TransitionSubresource(resource, subresource, newState);
+        return;
+    }
+
+    const D3D12_RESOURCE_STATES oldState = (isTracked ? resource.GetSubresourceState(subresource) : resource.currentState);
+    if (oldState == newState)
+        return;
+
+    /* Begin split barrier and remember where it is stored, so it can be turned into a regular barrier if it has not been flushed yet */
+    const UINT barrierSubresource = (isTracked ? subresource : D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+    const UINT barrierIndex = AppendTransitionBarrier(resource.Get(), barrierSubresource, oldState, newState, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY);
+
+    SplitBarrier& splitBarrier = splitBarriers_[numSplitBarriers_++];
+    {
+        splitBarrier.resource       = &resource;
+        splitBarrier.subresource    = barrierSubresource;
+        splitBarrier.stateBefore    = oldState;
+        splitBarrier.stateAfter     = newState;
+        splitBarrier.barrierIndex   = barrierIndex;
+        splitBarrier.flushIndex     = numResourceBarrierFlushes_;
+    }
+    ++resource.numSplitBarriers;
+
+    /* Store new transition state */
+    if (isTracked)
+    {
+        if (resource.subresourceStates.empty())
+            resource.subresourceStates.assign(resource.numSubresources, resource.currentState);
+        resource.subresourceStates[subresource] = newState;
+        MergeSubresourceStates(resource);
+    }
+    else
+        resource.currentState = newState;
+}
+
+void D3D12CommandContext::EndSplitBarriers(bool flushImmediate)
+{
+    if (numSplitBarriers_ > 0)
+    {
+        for_range(i, numSplitBarriers_)
+            EndSplitBarrier(splitBarriers_[i]);
+        numSplitBarriers_ = 0;
+
+        /* Flush resource barrieres if required */
+        if (flushImmediate)
+            FlushResourceBarrieres();
+    }
+}
+
 void D3D12CommandContext::InsertUAVBarrier(D3D12Resource& resource, bool flushImmediate)
 {
+    if (resource.numSplitBarriers > 0)
+        EndSplitBarriersOfResource(resource);
+
     D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
 
     barrier.Type            = D3D12_RESOURCE_BARRIER_TYPE_UAV;
@@ -199,15 +452,89 @@ void D3D12CommandContext::InsertUAVBarrier(D3D12Resource& resource, bool flushIm
         FlushResourceBarrieres();
 }
 
+bool D3D12CommandContext::AliasResource(D3D12Resource& resource)
+{
+    LLGL_ASSERT_PTR(resource.aliasingHeap);
+
+    /* Find active resource of the same heap */
+    auto it = std::find_if(
+        activeAliasedResources_.begin(),
+        activeAliasedResources_.end(),
+        [&resource](const AliasedResource& entry) -> bool
+        {
+            return (entry.heap == resource.aliasingHeap);
+        }
+    );
+
+    if (it != activeAliasedResources_.end())
+    {
+        if (it->resource == resource.Get())
+            return false;
+        it->resource = resource.Get();
+    }
+    else
+        activeAliasedResources_.push_back(AliasedResource{ resource.aliasingHeap, resource.Get() });
+
+    /* Any other resource placed in the same heap may have been used before, either in this or a previous command list */
+    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+
+    barrier.Type                        = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags                       = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore    = nullptr;
+    barrier.Aliasing.pResourceAfter     = resource.Get();
+
+    return true;
+}
+
+void D3D12CommandContext::DiscardSubresource(D3D12Resource& resource, UINT subresource)
+{
+    if (subresource == D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+        commandList_->DiscardResource(resource.Get(), nullptr);
+    else
+    {
+        const D3D12_DISCARD_REGION region{ 0, nullptr, subresource, 1 };
+        commandList_->DiscardResource(resource.Get(), &region);
+    }
+}
+
 void D3D12CommandContext::FlushResourceBarrieres()
 {
     if (numResourceBarriers_ > 0)
     {
+        #ifdef LLGL_D3D12_ENHANCED_BARRIERS
+        if (commandList7_)
+            FlushEnhancedBarriers();
+        else
+        #endif // /LLGL_D3D12_ENHANCED_BARRIERS
         commandList_->ResourceBarrier(numResourceBarriers_, resourceBarriers_);
         numResourceBarriers_ = 0;
+        ++numResourceBarrierFlushes_;
     }
 }
 
+void D3D12CommandContext::BeginRenderPass(
+    UINT                                        numRenderTargets,
+    const D3D12_RENDER_PASS_RENDER_TARGET_DESC* renderTargets,
+    const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* depthStencil)
+{
+    LLGL_ASSERT_PTR(commandList4_.Get());
+
+    /*
+    Barriers for render pass attachments must be submitted before the render pass begins.
+    Pending split barriers would otherwise be ended by the first draw command inside the render pass.
+    */
+    EndSplitBarriers();
+    FlushResourceBarrieres();
+
+    commandList4_->BeginRenderPass(numRenderTargets, renderTargets, depthStencil, D3D12_RENDER_PASS_FLAG_NONE);
+}
+
+void D3D12CommandContext::EndRenderPass()
+{
+    LLGL_ASSERT_PTR(commandList4_.Get());
+    commandList4_->EndRenderPass();
+}
+
 void D3D12CommandContext::ResolveSubresource(
     D3D12Resource&  dstResource,
     UINT            dstSubresource,
@@ -215,12 +542,12 @@ void D3D12CommandContext::ResolveSubresource(
     UINT            srcSubresource,
     DXGI_FORMAT     format)
 {
-    /* Transition both resources */
-    const D3D12_RESOURCE_STATES dstResourceOldState = dstResource.currentState;
-    const D3D12_RESOURCE_STATES srcResourceOldState = srcResource.currentState;
+    /* Transition both subresources */
+    const D3D12_RESOURCE_STATES dstResourceOldState = dstResource.GetSubresourceState(dstSubresource);
+    const D3D12_RESOURCE_STATES srcResourceOldState = srcResource.GetSubresourceState(srcSubresource);
 
-    TransitionResource(dstResource, D3D12_RESOURCE_STATE_RESOLVE_DEST);
-    TransitionResource(srcResource, D3D12_RESOURCE_STATE_RESOLVE_SOURCE, true);
+    TransitionSubresource(dstResource, dstSubresource, D3D12_RESOURCE_STATE_RESOLVE_DEST);
+    TransitionSubresource(srcResource, srcSubresource, D3D12_RESOURCE_STATE_RESOLVE_SOURCE, true);
 
     /* Resolve multi-sampled render targets */
     commandList_->ResolveSubresource(
@@ -231,9 +558,9 @@ void D3D12CommandContext::ResolveSubresource(
         format
     );
 
-    /* Transition both resources */
-    TransitionResource(dstResource, dstResourceOldState);
-    TransitionResource(srcResource, srcResourceOldState, true);
+    /* Transition both subresources */
+    TransitionSubresource(dstResource, dstSubresource, dstResourceOldState);
+    TransitionSubresource(srcResource, srcSubresource, srcResourceOldState, true);
 }
 
 void D3D12CommandContext::CopyTextureRegion(
@@ -246,12 +573,12 @@ void D3D12CommandContext::CopyTextureRegion(
     UINT                srcSubresource,
     const D3D12_BOX*    srcBox)
 {
-    /* Transition both resources */
-    const D3D12_RESOURCE_STATES dstResourceOldState = dstResource.currentState;
-    const D3D12_RESOURCE_STATES srcResourceOldState = srcResource.currentState;
+    /* Transition both subresources */
+    const D3D12_RESOURCE_STATES dstResourceOldState = dstResource.GetSubresourceState(dstSubresource);
+    const D3D12_RESOURCE_STATES srcResourceOldState = srcResource.GetSubresourceState(srcSubresource);
 
-    TransitionResource(dstResource, D3D12_RESOURCE_STATE_COPY_DEST);
-    TransitionResource(srcResource, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    TransitionSubresource(dstResource, dstSubresource, D3D12_RESOURCE_STATE_COPY_DEST);
+    TransitionSubresource(srcResource, srcSubresource, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
 
     /* Copy texture region subresources */
     D3D12_TEXTURE_COPY_LOCATION dstLocation;
@@ -268,9 +595,9 @@ void D3D12CommandContext::CopyTextureRegion(
     }
     commandList_->CopyTextureRegion(&dstLocation, dstX, dstY, dstZ, &srcLocation, srcBox);
 
-    /* Transition both resources */
-    TransitionResource(dstResource, dstResourceOldState);
-    TransitionResource(srcResource, srcResourceOldState, true);
+    /* Transition both subresources */
+    TransitionSubresource(dstResource, dstSubresource, dstResourceOldState);
+    TransitionSubresource(srcResource, srcSubresource, srcResourceOldState, true);
 }
 
 void D3D12CommandContext::UpdateSubresource(
@@ -279,7 +606,7 @@ void D3D12CommandContext::UpdateSubresource(
     const void*     data,
     UINT64          dataSize)
 {
-    stagingBufferPools_[currentAllocatorIndex_].WriteStaged(*this, dstResource, dstOffset, data, dataSize);
+    stagingBufferPool_.WriteStaged(*this, dstResource, dstOffset, data, dataSize);
 }
 
 ID3D12Resource* D3D12CommandContext::AllocIntermediateBuffer(UINT64 size, UINT alignment)
@@ -369,12 +696,7 @@ void D3D12CommandContext::PrepareStagingDescriptorHeaps(
     stagingDescriptorIndices_   = indices;
 
     /* Bind shader-visible descriptor heaps */
-    ID3D12DescriptorHeap* const stagingDescriptorHeaps[2] =
-    {
-        stagingDescriptorPools_[currentAllocatorIndex_][0].GetDescriptorHeap(),
-        stagingDescriptorPools_[currentAllocatorIndex_][1].GetDescriptorHeap()
-    };
-    SetDescriptorHeaps(2, stagingDescriptorHeaps);
+    SetStagingDescriptorHeaps();
 
     /* Reset descriptor cache for dynamic descriptors */
     descriptorCaches_[currentAllocatorIndex_].Reset(
@@ -393,6 +715,16 @@ void D3D12CommandContext::SetComputeConstant(UINT parameterIndex, D3D12Constant
     commandList_->SetComputeRoot32BitConstant(parameterIndex, value.bits32, offset);
 }
 
+void D3D12CommandContext::SetGraphicsConstants(UINT parameterIndex, const void* values, UINT num32BitValues, UINT offset)
+{
+    commandList_->SetGraphicsRoot32BitConstants(parameterIndex, num32BitValues, values, offset);
+}
+
+void D3D12CommandContext::SetComputeConstants(UINT parameterIndex, const void* values, UINT num32BitValues, UINT offset)
+{
+    commandList_->SetComputeRoot32BitConstants(parameterIndex, num32BitValues, values, offset);
+}
+
 void D3D12CommandContext::SetGraphicsRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr)
 {
     switch (parameterType)
@@ -437,10 +769,10 @@ void D3D12CommandContext::SetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& indexBuf
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12CommandContext::GetCPUDescriptorHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptor) const
 {
-    /* Get current descriptor heap pool via allocator- and type index */
+    /* Get descriptor heap pool via type index */
     const UINT typeIndex = static_cast<UINT>(type);
     LLGL_ASSERT(typeIndex < D3D12CommandContext::maxNumDescriptorHeaps);
-    const D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[currentAllocatorIndex_][typeIndex];
+    const D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[typeIndex];
 
     /* Return CPU descriptor handle for the specified descriptor in the pool */
     return descriptorHeapPool.GetCpuHandleWithOffset(descriptor);
@@ -450,15 +782,18 @@ D3D12_GPU_DESCRIPTOR_HANDLE D3D12CommandContext::CopyDescriptorsForStaging(
     D3D12_DESCRIPTOR_HEAP_TYPE  type,
     D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
     UINT                        firstDescriptor,
-    UINT                        numDescriptors)
+    UINT                        numDescriptors,
+    std::uint64_t               contentVersion)
 {
-    /* Get current descriptor heap pool via allocator- and type index */
+    /* Get descriptor heap pool via type index */
     const UINT typeIndex = static_cast<UINT>(type);
     LLGL_ASSERT(typeIndex < D3D12CommandContext::maxNumDescriptorHeaps);
-    D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[currentAllocatorIndex_][typeIndex];
+    D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[typeIndex];
 
-    /* Copy descriptors into shader-visible descriptor heap */
-    return descriptorHeapPool.CopyDescriptors(srcDescHandle, firstDescriptor, numDescriptors);
+    /* Copy descriptors into shader-visible descriptor heap and re-bind the heaps in case the ring has grown */
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorHeapPool.CopyDescriptors(srcDescHandle, firstDescriptor, numDescriptors, contentVersion);
+    SetStagingDescriptorHeaps();
+    return gpuDescHandle;
 }
 
 void D3D12CommandContext::EmplaceDescriptorForStaging(
@@ -469,12 +804,22 @@ void D3D12CommandContext::EmplaceDescriptorForStaging(
     descriptorCaches_[currentAllocatorIndex_].EmplaceDescriptor(resource, location, descRangeType);
 }
 
+void D3D12CommandContext::EmplaceBufferViewDescriptorForStaging(
+    D3D12Buffer&                bufferD3D,
+    const BufferViewDescriptor& bufferViewDesc,
+    UINT                        location,
+    D3D12_DESCRIPTOR_RANGE_TYPE descRangeType)
+{
+    descriptorCaches_[currentAllocatorIndex_].EmplaceBufferViewDescriptor(bufferD3D, bufferViewDesc, location, descRangeType);
+}
+
 void D3D12CommandContext::DrawInstanced(
     UINT vertexCountPerInstance,
     UINT instanceCount,
     UINT startVertexLocation,
     UINT startInstanceLocation)
 {
+    EndSplitBarriers(true);
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
     commandList_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
@@ -487,11 +832,23 @@ void D3D12CommandContext::DrawIndexedInstanced(
     INT     baseVertexLocation,
     UINT    startInstanceLocation)
 {
+    EndSplitBarriers(true);
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
     commandList_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
 }
 
+void D3D12CommandContext::DrawIndexedInstancedN(
+    const DrawIndexedIndirectArguments* args,
+    UINT                                numDraws)
+{
+    EndSplitBarriers(true);
+    FlushDeferredPipelineState();
+    FlushGraphicsStagingDescriptorTables();
+    for (const DrawIndexedIndirectArguments* argsEnd = args + numDraws; args != argsEnd; ++args)
+        commandList_->DrawIndexedInstanced(args->numIndices, args->numInstances, args->firstIndex, args->vertexOffset, args->firstInstance);
+}
+
 void D3D12CommandContext::DrawIndirect(
     ID3D12CommandSignature* commandSignature,
     UINT                    maxCommandCount,
@@ -500,6 +857,7 @@ void D3D12CommandContext::DrawIndirect(
     ID3D12Resource*         countBuffer,
     UINT64                  countBufferOffset)
 {
+    EndSplitBarriers(true);
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
@@ -510,6 +868,7 @@ void D3D12CommandContext::Dispatch(
     UINT threadGroupCountY,
     UINT threadGroupCountZ)
 {
+    EndSplitBarriers(true);
     FlushComputeStagingDescriptorTables();
     commandList_->Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
 }
@@ -522,10 +881,76 @@ void D3D12CommandContext::DispatchIndirect(
     ID3D12Resource*         countBuffer,
     UINT64                  countBufferOffset)
 {
+    EndSplitBarriers(true);
     FlushComputeStagingDescriptorTables();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
 }
 
+#ifdef LLGL_D3D12_MESH_SHADERS
+
+void D3D12CommandContext::DispatchMesh(
+    UINT threadGroupCountX,
+    UINT threadGroupCountY,
+    UINT threadGroupCountZ)
+{
+    LLGL_ASSERT_PTR(commandList6_.Get());
+    EndSplitBarriers(true);
+    FlushDeferredPipelineState();
+    FlushGraphicsStagingDescriptorTables();
+    commandList6_->DispatchMesh(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+#endif // /LLGL_D3D12_MESH_SHADERS
+
+#ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+void D3D12CommandContext::SetDepthBias(FLOAT depthBias, FLOAT depthBiasClamp, FLOAT slopeScaledDepthBias)
+{
+    if (commandList9_)
+        commandList9_->RSSetDepthBias(depthBias, depthBiasClamp, slopeScaledDepthBias);
+}
+
+#endif // /LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+#ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+
+void D3D12CommandContext::SetShadingRate(D3D12_SHADING_RATE baseShadingRate, const D3D12_SHADING_RATE_COMBINER combiners[2])
+{
+    if (!commandList5_)
+        return;
+
+    /* Clamp shading rates coarser than 2x2 if they are not supported */
+    if (!additionalShadingRates_ &&
+        (baseShadingRate == D3D12_SHADING_RATE_2X4 || baseShadingRate == D3D12_SHADING_RATE_4X2 || baseShadingRate == D3D12_SHADING_RATE_4X4))
+    {
+        baseShadingRate = D3D12_SHADING_RATE_2X2;
+    }
+
+    /* Combiners are only supported with VRS tier 2 */
+    if (shadingRateTier_ >= D3D12_VARIABLE_SHADING_RATE_TIER_2)
+        commandList5_->RSSetShadingRate(baseShadingRate, combiners);
+    else
+        commandList5_->RSSetShadingRate(baseShadingRate, nullptr);
+}
+
+void D3D12CommandContext::SetShadingRateImage(ID3D12Resource* shadingRateImage)
+{
+    if (commandList5_ && shadingRateTier_ >= D3D12_VARIABLE_SHADING_RATE_TIER_2)
+        commandList5_->RSSetShadingRateImage(shadingRateImage);
+}
+
+#endif // /LLGL_D3D12_VARIABLE_RATE_SHADING
+
+#ifdef LLGL_D3D12_VIEW_INSTANCING
+
+void D3D12CommandContext::SetViewInstanceMask(UINT mask)
+{
+    if (commandList1_)
+        commandList1_->SetViewInstanceMask(mask);
+}
+
+#endif // /LLGL_D3D12_VIEW_INSTANCING
+
 
 /*
  * ======= Private: =======
@@ -544,6 +969,309 @@ void D3D12CommandContext::ClearCache()
     stateCache_.stateBits.is16BitIndexFormat    = 0;
 }
 
+UINT D3D12CommandContext::AppendTransitionBarrier(
+    ID3D12Resource*                 resource,
+    UINT                            subresource,
+    D3D12_RESOURCE_STATES           stateBefore,
+    D3D12_RESOURCE_STATES           stateAfter,
+    D3D12_RESOURCE_BARRIER_FLAGS    flags)
+{
+    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+
+    /* Initialize resource barrier for resource transition */
+    barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags                   = flags;
+    barrier.Transition.pResource    = resource;
+    barrier.Transition.Subresource  = subresource;
+    barrier.Transition.StateBefore  = stateBefore;
+    barrier.Transition.StateAfter   = stateAfter;
+
+    return (numResourceBarriers_ - 1);
+}
+
+void D3D12CommandContext::TransitionTrackedSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState)
+{
+    const D3D12_RESOURCE_STATES oldState = resource.GetSubresourceState(subresource);
+    if (oldState != newState)
+    {
+        AppendTransitionBarrier(resource.Get(), subresource, oldState, newState);
+
+        /* Expand uniform state into individual subresource states on first divergence */
+        if (resource.subresourceStates.empty())
+            resource.subresourceStates.assign(resource.numSubresources, resource.currentState);
+        resource.subresourceStates[subresource] = newState;
+    }
+}
+
+D3D12_RESOURCE_STATES D3D12CommandContext::GetSupportedResourceState(D3D12_RESOURCE_STATES state) const
+{
+    /* Fall back to common state if none of the requested states are supported by this command list type; COMMON is 0 */
+    return static_cast<D3D12_RESOURCE_STATES>(state & supportedResourceStates_);
+}
+
+void D3D12CommandContext::MergeSubresourceStates(D3D12Resource& resource)
+{
+    if (!resource.subresourceStates.empty())
+    {
+        const D3D12_RESOURCE_STATES firstState = resource.subresourceStates.front();
+        for (D3D12_RESOURCE_STATES state : resource.subresourceStates)
+        {
+            if (state != firstState)
+                return;
+        }
+
+        /* All subresources are in the same state, so track the resource as a whole again */
+        resource.currentState = firstState;
+        resource.subresourceStates.clear();
+    }
+}
+
+void D3D12CommandContext::EndSplitBarriersOfResource(D3D12Resource& resource)
+{
+    for (UINT i = 0; i < numSplitBarriers_ && resource.numSplitBarriers > 0;)
+    {
+        if (splitBarriers_[i].resource == &resource)
+        {
+            /* End split barrier and move last one into its place */
+            EndSplitBarrier(splitBarriers_[i]);
+            splitBarriers_[i] = splitBarriers_[--numSplitBarriers_];
+        }
+        else
+            ++i;
+    }
+}
+
+void D3D12CommandContext::EndSplitBarrier(const SplitBarrier& splitBarrier)
+{
+    if (splitBarrier.flushIndex == numResourceBarrierFlushes_)
+    {
+        /* Beginning barrier is still in the cache, so turn it into a regular barrier */
+        resourceBarriers_[splitBarrier.barrierIndex].Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    }
+    else
+    {
+        AppendTransitionBarrier(
+            splitBarrier.resource->Get(),
+            splitBarrier.subresource,
+            splitBarrier.stateBefore,
+            splitBarrier.stateAfter,
+            D3D12_RESOURCE_BARRIER_FLAG_END_ONLY
+        );
+    }
+    --(splitBarrier.resource->numSplitBarriers);
+}
+
+#ifdef LLGL_D3D12_ENHANCED_BARRIERS
+
+static D3D12_BARRIER_LAYOUT GetD3D12BarrierLayout(D3D12_RESOURCE_STATES state)
+{
+    switch (state)
+    {
+        case D3D12_RESOURCE_STATE_COMMON:           return D3D12_BARRIER_LAYOUT_COMMON;
+        case D3D12_RESOURCE_STATE_RENDER_TARGET:    return D3D12_BARRIER_LAYOUT_RENDER_TARGET;
+        case D3D12_RESOURCE_STATE_UNORDERED_ACCESS: return D3D12_BARRIER_LAYOUT_UNORDERED_ACCESS;
+        case D3D12_RESOURCE_STATE_DEPTH_WRITE:      return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_WRITE;
+        case D3D12_RESOURCE_STATE_COPY_DEST:        return D3D12_BARRIER_LAYOUT_COPY_DEST;
+        case D3D12_RESOURCE_STATE_COPY_SOURCE:      return D3D12_BARRIER_LAYOUT_COPY_SOURCE;
+        case D3D12_RESOURCE_STATE_RESOLVE_DEST:     return D3D12_BARRIER_LAYOUT_RESOLVE_DEST;
+        case D3D12_RESOURCE_STATE_RESOLVE_SOURCE:   return D3D12_BARRIER_LAYOUT_RESOLVE_SOURCE;
+        default:                                    break;
+    }
+    if ((state & D3D12_RESOURCE_STATE_DEPTH_READ) != 0)
+        return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ;
+    if ((state & ~D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE) == 0)
+        return D3D12_BARRIER_LAYOUT_SHADER_RESOURCE;
+    return D3D12_BARRIER_LAYOUT_GENERIC_READ;
+}
+
+static D3D12_BARRIER_ACCESS GetD3D12BarrierAccess(D3D12_RESOURCE_STATES state)
+{
+    if (state == D3D12_RESOURCE_STATE_COMMON)
+        return D3D12_BARRIER_ACCESS_COMMON;
+
+    D3D12_BARRIER_ACCESS access = D3D12_BARRIER_ACCESS_COMMON;
+    {
+        if ((state & D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER) != 0)
+            access |= (D3D12_BARRIER_ACCESS_VERTEX_BUFFER | D3D12_BARRIER_ACCESS_CONSTANT_BUFFER);
+        if ((state & D3D12_RESOURCE_STATE_INDEX_BUFFER) != 0)
+            access |= D3D12_BARRIER_ACCESS_INDEX_BUFFER;
+        if ((state & D3D12_RESOURCE_STATE_RENDER_TARGET) != 0)
+            access |= D3D12_BARRIER_ACCESS_RENDER_TARGET;
+        if ((state & D3D12_RESOURCE_STATE_UNORDERED_ACCESS) != 0)
+            access |= D3D12_BARRIER_ACCESS_UNORDERED_ACCESS;
+        if ((state & D3D12_RESOURCE_STATE_DEPTH_WRITE) != 0)
+            access |= D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE;
+        if ((state & D3D12_RESOURCE_STATE_DEPTH_READ) != 0)
+            access |= D3D12_BARRIER_ACCESS_DEPTH_STENCIL_READ;
+        if ((state & D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE) != 0)
+            access |= D3D12_BARRIER_ACCESS_SHADER_RESOURCE;
+        if ((state & D3D12_RESOURCE_STATE_STREAM_OUT) != 0)
+            access |= D3D12_BARRIER_ACCESS_STREAM_OUTPUT;
+        if ((state & D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT) != 0)
+            access |= D3D12_BARRIER_ACCESS_INDIRECT_ARGUMENT;
+        if ((state & D3D12_RESOURCE_STATE_COPY_DEST) != 0)
+            access |= D3D12_BARRIER_ACCESS_COPY_DEST;
+        if ((state & D3D12_RESOURCE_STATE_COPY_SOURCE) != 0)
+            access |= D3D12_BARRIER_ACCESS_COPY_SOURCE;
+        if ((state & D3D12_RESOURCE_STATE_RESOLVE_DEST) != 0)
+            access |= D3D12_BARRIER_ACCESS_RESOLVE_DEST;
+        if ((state & D3D12_RESOURCE_STATE_RESOLVE_SOURCE) != 0)
+            access |= D3D12_BARRIER_ACCESS_RESOLVE_SOURCE;
+    }
+    return access;
+}
+
+static D3D12_BARRIER_SYNC GetD3D12BarrierSync(D3D12_RESOURCE_STATES state)
+{
+    if (state == D3D12_RESOURCE_STATE_COMMON)
+        return D3D12_BARRIER_SYNC_ALL;
+
+    D3D12_BARRIER_SYNC sync = D3D12_BARRIER_SYNC_NONE;
+    {
+        if ((state & D3D12_RESOURCE_STATE_INDEX_BUFFER) != 0)
+            sync |= D3D12_BARRIER_SYNC_INDEX_INPUT;
+        if ((state & (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_UNORDERED_ACCESS | D3D12_RESOURCE_STATE_STREAM_OUT)) != 0)
+            sync |= D3D12_BARRIER_SYNC_ALL_SHADING;
+        if ((state & D3D12_RESOURCE_STATE_RENDER_TARGET) != 0)
+            sync |= D3D12_BARRIER_SYNC_RENDER_TARGET;
+        if ((state & (D3D12_RESOURCE_STATE_DEPTH_WRITE | D3D12_RESOURCE_STATE_DEPTH_READ)) != 0)
+            sync |= D3D12_BARRIER_SYNC_DEPTH_STENCIL;
+        if ((state & D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE) != 0)
+            sync |= D3D12_BARRIER_SYNC_NON_PIXEL_SHADING;
+        if ((state & D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) != 0)
+            sync |= D3D12_BARRIER_SYNC_PIXEL_SHADING;
+        if ((state & D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT) != 0)
+            sync |= D3D12_BARRIER_SYNC_EXECUTE_INDIRECT;
+        if ((state & (D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_COPY_SOURCE)) != 0)
+            sync |= D3D12_BARRIER_SYNC_COPY;
+        if ((state & (D3D12_RESOURCE_STATE_RESOLVE_DEST | D3D12_RESOURCE_STATE_RESOLVE_SOURCE)) != 0)
+            sync |= D3D12_BARRIER_SYNC_RESOLVE;
+    }
+    return sync;
+}
+
+void D3D12CommandContext::FlushEnhancedBarriers()
+{
+    D3D12_GLOBAL_BARRIER    globalBarriers[maxNumResourceBarrieres];
+    D3D12_BUFFER_BARRIER    bufferBarriers[maxNumResourceBarrieres];
+    D3D12_TEXTURE_BARRIER   textureBarriers[maxNumResourceBarrieres];
+    UINT                    numGlobalBarriers   = 0;
+    UINT                    numBufferBarriers   = 0;
+    UINT                    numTextureBarriers  = 0;
+
+    /* Translate legacy resource barriers into enhanced barriers */
+    for_range(i, numResourceBarriers_)
+    {
+        const D3D12_RESOURCE_BARRIER& barrier = resourceBarriers_[i];
+        if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_UAV)
+        {
+            D3D12_GLOBAL_BARRIER& globalBarrier = globalBarriers[numGlobalBarriers++];
+            {
+                globalBarrier.SyncBefore    = D3D12_BARRIER_SYNC_ALL_SHADING;
+                globalBarrier.SyncAfter     = D3D12_BARRIER_SYNC_ALL_SHADING;
+                globalBarrier.AccessBefore  = D3D12_BARRIER_ACCESS_UNORDERED_ACCESS;
+                globalBarrier.AccessAfter   = D3D12_BARRIER_ACCESS_UNORDERED_ACCESS;
+            }
+        }
+        else if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING)
+        {
+            /* Aliasing barriers must wait for all previous accesses of the heap memory to complete */
+            D3D12_GLOBAL_BARRIER& globalBarrier = globalBarriers[numGlobalBarriers++];
+            {
+                globalBarrier.SyncBefore    = D3D12_BARRIER_SYNC_ALL;
+                globalBarrier.SyncAfter     = D3D12_BARRIER_SYNC_ALL;
+                globalBarrier.AccessBefore  = (D3D12_BARRIER_ACCESS_RENDER_TARGET | D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE);
+                globalBarrier.AccessAfter   = (D3D12_BARRIER_ACCESS_RENDER_TARGET | D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE);
+            }
+        }
+        else if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+        {
+            const D3D12_RESOURCE_TRANSITION_BARRIER& transition = barrier.Transition;
+
+            /* Split barriers synchronize with the opposite end via SYNC_SPLIT */
+            D3D12_BARRIER_SYNC syncBefore   = GetD3D12BarrierSync(transition.StateBefore);
+            D3D12_BARRIER_SYNC syncAfter    = GetD3D12BarrierSync(transition.StateAfter);
+            if (barrier.Flags == D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY)
+                syncAfter = D3D12_BARRIER_SYNC_SPLIT;
+            else if (barrier.Flags == D3D12_RESOURCE_BARRIER_FLAG_END_ONLY)
+                syncBefore = D3D12_BARRIER_SYNC_SPLIT;
+
+            if (transition.pResource->GetDesc().Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+            {
+                D3D12_BUFFER_BARRIER& bufferBarrier = bufferBarriers[numBufferBarriers++];
+                {
+                    bufferBarrier.SyncBefore    = syncBefore;
+                    bufferBarrier.SyncAfter     = syncAfter;
+                    bufferBarrier.AccessBefore  = GetD3D12BarrierAccess(transition.StateBefore);
+                    bufferBarrier.AccessAfter   = GetD3D12BarrierAccess(transition.StateAfter);
+                    bufferBarrier.pResource     = transition.pResource;
+                    bufferBarrier.Offset        = 0;
+                    bufferBarrier.Size          = UINT64_MAX;
+                }
+            }
+            else
+            {
+                /* Textures cannot be accessed as vertex, constant, or index buffers */
+                constexpr D3D12_BARRIER_ACCESS bufferOnlyAccess =
+                (
+                    D3D12_BARRIER_ACCESS_VERTEX_BUFFER      |
+                    D3D12_BARRIER_ACCESS_CONSTANT_BUFFER    |
+                    D3D12_BARRIER_ACCESS_INDEX_BUFFER       |
+                    D3D12_BARRIER_ACCESS_STREAM_OUTPUT      |
+                    D3D12_BARRIER_ACCESS_INDIRECT_ARGUMENT
+                );
+                D3D12_TEXTURE_BARRIER& textureBarrier = textureBarriers[numTextureBarriers++];
+                {
+                    textureBarrier.SyncBefore                           = syncBefore;
+                    textureBarrier.SyncAfter                            = syncAfter;
+                    textureBarrier.AccessBefore                         = (GetD3D12BarrierAccess(transition.StateBefore) & ~bufferOnlyAccess);
+                    textureBarrier.AccessAfter                          = (GetD3D12BarrierAccess(transition.StateAfter) & ~bufferOnlyAccess);
+                    textureBarrier.LayoutBefore                         = GetD3D12BarrierLayout(transition.StateBefore);
+                    textureBarrier.LayoutAfter                          = GetD3D12BarrierLayout(transition.StateAfter);
+                    textureBarrier.pResource                            = transition.pResource;
+                    textureBarrier.Subresources.IndexOrFirstMipLevel    = transition.Subresource;
+                    textureBarrier.Subresources.NumMipLevels            = 0;
+                    textureBarrier.Subresources.FirstArraySlice         = 0;
+                    textureBarrier.Subresources.NumArraySlices          = 0;
+                    textureBarrier.Subresources.FirstPlane              = 0;
+                    textureBarrier.Subresources.NumPlanes               = 0;
+                    textureBarrier.Flags                                = D3D12_TEXTURE_BARRIER_FLAG_NONE;
+                }
+            }
+        }
+    }
+
+    /* Submit all barrier groups at once */
+    D3D12_BARRIER_GROUP barrierGroups[3];
+    UINT numBarrierGroups = 0;
+
+    if (numGlobalBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_GLOBAL;
+        group.NumBarriers       = numGlobalBarriers;
+        group.pGlobalBarriers   = globalBarriers;
+    }
+    if (numBufferBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_BUFFER;
+        group.NumBarriers       = numBufferBarriers;
+        group.pBufferBarriers   = bufferBarriers;
+    }
+    if (numTextureBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_TEXTURE;
+        group.NumBarriers       = numTextureBarriers;
+        group.pTextureBarriers  = textureBarriers;
+    }
+
+    commandList7_->Barrier(numBarrierGroups, barrierGroups);
+}
+
+#endif // /LLGL_D3D12_ENHANCED_BARRIERS
+
 D3D12_RESOURCE_BARRIER& D3D12CommandContext::NextResourceBarrier()
 {
     if (numResourceBarriers_ == D3D12CommandContext::maxNumResourceBarrieres)
@@ -553,16 +1281,31 @@ D3D12_RESOURCE_BARRIER& D3D12CommandContext::NextResourceBarrier()
 
 void D3D12CommandContext::NextCommandAllocator(D3D12CommandQueue& commandQueue)
 {
-    /* Get next command allocator */
+    /* Enqueue current command allocator behind all other allocators that are still in flight */
     const UINT64 currentFenceValue = allocatorFenceValues_[currentAllocatorIndex_];
-    currentAllocatorIndex_ = ((currentAllocatorIndex_ + 1) % numAllocators_);
+    allocatorQueue_[allocatorQueueSize_++] = currentAllocatorIndex_;
+
+    /* If fence of the oldest allocator was not signaled since last encoding, we must signal it now */
+    const UINT oldestAllocatorIndex = allocatorQueue_[0];
+    if (allocatorFenceValueDirty_[oldestAllocatorIndex])
+        SignalCommandAllocator(commandQueue, oldestAllocatorIndex);
+
+    if (IsCommandAllocatorCompleted(oldestAllocatorIndex) || numActiveAllocators_ == D3D12CommandContext::maxNumAllocators)
+    {
+        /* Re-use oldest command allocator; only wait for the GPU if the pool cannot grow any further */
+        currentAllocatorIndex_ = PopCommandAllocatorQueue();
+        allocatorFence_.WaitForHigherSignal(allocatorFenceValues_[currentAllocatorIndex_]);
 
-    /* If fence was not signaled since last encoding, we must signal it now and wait for a full queue flush */
-    if (allocatorFenceValueDirty_[currentAllocatorIndex_])
-        Signal(commandQueue);
+        /* Shrink pool back to its initial size after a burst of submissions by releasing one idle allocator at a time */
+        if (numActiveAllocators_ > numAllocators_ && IsCommandAllocatorCompleted(allocatorQueue_[0]))
+            ReleaseCommandAllocator(PopCommandAllocatorQueue());
+    }
+    else
+    {
+        /* Grow pool by another command allocator instead of blocking until the GPU has finished with the oldest one */
+        currentAllocatorIndex_ = CreateCommandAllocator();
+    }
 
-    /* Wait until fence value of next allocator has been signaled */
-    allocatorFence_.WaitForHigherSignal(allocatorFenceValues_[currentAllocatorIndex_]);
     allocatorFenceValues_[currentAllocatorIndex_] = currentFenceValue + 1;
     allocatorFenceValueDirty_[currentAllocatorIndex_] = true;
 
@@ -570,16 +1313,85 @@ void D3D12CommandContext::NextCommandAllocator(D3D12CommandQueue& commandQueue)
     HRESULT hr = GetCommandAllocator()->Reset();
     DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
 
-    /* Reset descriptor heap pools before they are re-used */
+    /*
+    Reclaim descriptor heap ring regions of this allocator.
+    Allocators are always recycled in submission order, so the ring regions are still reclaimed in order.
+    */
     for_range(i, D3D12CommandContext::maxNumDescriptorHeaps)
-        stagingDescriptorPools_[currentAllocatorIndex_][i].Reset();
+        stagingDescriptorPools_[i].NextFrame(currentAllocatorIndex_);
 
-    /* Clear descriptor cache and reset staging buffer pool */
+    /* Clear descriptor cache and reclaim upload ring buffer region of this allocator */
     descriptorCaches_[currentAllocatorIndex_].Clear();
-    stagingBufferPools_[currentAllocatorIndex_].Reset();
+    stagingBufferPool_.NextFrame(currentAllocatorIndex_);
     intermediateBufferPools_[currentAllocatorIndex_].Reset();
 }
 
+void D3D12CommandContext::SignalCommandAllocator(D3D12CommandQueue& commandQueue, UINT allocatorIndex)
+{
+    const UINT64 currentFenceValue = allocatorFence_.GetCompletedValue();
+    const UINT64 nextFenceValue = allocatorFenceValues_[allocatorIndex];
+    if (currentFenceValue < nextFenceValue)
+        commandQueue.SignalFence(allocatorFence_.Get(), nextFenceValue);
+    allocatorFenceValueDirty_[allocatorIndex] = false;
+}
+
+UINT D3D12CommandContext::CreateCommandAllocator()
+{
+    /* Find first unused allocator slot */
+    UINT allocatorIndex = 0;
+    while (allocatorIndex < D3D12CommandContext::maxNumAllocators && commandAllocators_[allocatorIndex].Get() != nullptr)
+        ++allocatorIndex;
+
+    LLGL_ASSERT(allocatorIndex < D3D12CommandContext::maxNumAllocators);
+
+    HRESULT hr = device_->CreateCommandAllocator(commandListType_, IID_PPV_ARGS(commandAllocators_[allocatorIndex].ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12CommandAllocator");
+
+    /* Descriptor cache and intermediate buffer pool of a slot outlive its command allocator */
+    if (!allocatorSlotInitialized_[allocatorIndex])
+    {
+        descriptorCaches_[allocatorIndex].Create(device_);
+        intermediateBufferPools_[allocatorIndex].InitializeDevice(device_);
+        allocatorSlotInitialized_[allocatorIndex] = true;
+    }
+
+    ++numActiveAllocators_;
+    return allocatorIndex;
+}
+
+void D3D12CommandContext::ReleaseCommandAllocator(UINT allocatorIndex)
+{
+    commandAllocators_[allocatorIndex].Reset();
+    allocatorFenceValueDirty_[allocatorIndex] = false;
+    descriptorCaches_[allocatorIndex].Clear();
+    intermediateBufferPools_[allocatorIndex].Reset();
+    --numActiveAllocators_;
+}
+
+UINT D3D12CommandContext::PopCommandAllocatorQueue()
+{
+    LLGL_ASSERT(allocatorQueueSize_ > 0);
+    const UINT allocatorIndex = allocatorQueue_[0];
+    std::move(allocatorQueue_ + 1, allocatorQueue_ + allocatorQueueSize_, allocatorQueue_);
+    --allocatorQueueSize_;
+    return allocatorIndex;
+}
+
+bool D3D12CommandContext::IsCommandAllocatorCompleted(UINT allocatorIndex) const
+{
+    return (allocatorFence_.GetCompletedValue() >= allocatorFenceValues_[allocatorIndex]);
+}
+
+void D3D12CommandContext::SetStagingDescriptorHeaps()
+{
+    ID3D12DescriptorHeap* const stagingDescriptorHeaps[2] =
+    {
+        stagingDescriptorPools_[0].GetDescriptorHeap(),
+        stagingDescriptorPools_[1].GetDescriptorHeap()
+    };
+    SetDescriptorHeaps(2, stagingDescriptorHeaps);
+}
+
 void D3D12CommandContext::SetPipelineStateCached(ID3D12PipelineState* pipelineState)
 {
     if (stateCache_.dirtyBits.pipelineState != 0 || stateCache_.pipelineState != pipelineState)
@@ -602,18 +1414,19 @@ void D3D12CommandContext::FlushGraphicsStagingDescriptorTables()
     D3D12DescriptorCache& descriptorCache = descriptorCaches_[currentAllocatorIndex_];
     if (descriptorCache.IsInvalidated())
     {
-        auto& currentPoolSet = stagingDescriptorPools_[currentAllocatorIndex_];
+        D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandles[2] = {};
         if (stagingDescriptorSetLayout_.numResourceViews > 0)
-        {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(currentPoolSet[0]);
-            if (gpuDescHandle.ptr != 0)
-                commandList_->SetGraphicsRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[0], gpuDescHandle);
-        }
+            gpuDescHandles[0] = descriptorCache.FlushCbvSrvUavDescriptors(stagingDescriptorPools_[0]);
         if (stagingDescriptorSetLayout_.numSamplers > 0)
+            gpuDescHandles[1] = descriptorCache.FlushSamplerDescriptors(stagingDescriptorPools_[1]);
+
+        /* Re-bind descriptor heaps in case a ring has grown before any descriptor table is set */
+        SetStagingDescriptorHeaps();
+
+        for_range(i, 2)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(currentPoolSet[1]);
-            if (gpuDescHandle.ptr != 0)
-                commandList_->SetGraphicsRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[1], gpuDescHandle);
+            if (gpuDescHandles[i].ptr != 0)
+                commandList_->SetGraphicsRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[i], gpuDescHandles[i]);
         }
     }
 }
@@ -623,18 +1436,19 @@ void D3D12CommandContext::FlushComputeStagingDescriptorTables()
     D3D12DescriptorCache& descriptorCache = descriptorCaches_[currentAllocatorIndex_];
     if (descriptorCache.IsInvalidated())
     {
-        auto& currentPoolSet = stagingDescriptorPools_[currentAllocatorIndex_];
+        D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandles[2] = {};
         if (stagingDescriptorSetLayout_.numResourceViews > 0)
-        {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(currentPoolSet[0]);
-            if (gpuDescHandle.ptr != 0)
-                commandList_->SetComputeRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[0], gpuDescHandle);
-        }
+            gpuDescHandles[0] = descriptorCache.FlushCbvSrvUavDescriptors(stagingDescriptorPools_[0]);
         if (stagingDescriptorSetLayout_.numSamplers > 0)
+            gpuDescHandles[1] = descriptorCache.FlushSamplerDescriptors(stagingDescriptorPools_[1]);
+
+        /* Re-bind descriptor heaps in case a ring has grown before any descriptor table is set */
+        SetStagingDescriptorHeaps();
+
+        for_range(i, 2)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(currentPoolSet[1]);
-            if (gpuDescHandle.ptr != 0)
-                commandList_->SetComputeRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[1], gpuDescHandle);
+            if (gpuDescHandles[i].ptr != 0)
+                commandList_->SetComputeRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[i], gpuDescHandles[i]);
         }
     }
 }
@@ -16,9 +16,37 @@
 #include "../RenderState/D3D12DescriptorCache.h"
 #include "../Buffer/D3D12StagingBufferPool.h"
 #include "../Buffer/D3D12IntermediateBufferPool.h"
+#include <LLGL/IndirectArguments.h>
 #include <d3d12.h>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
+
+
+// Enhanced barriers require ID3D12GraphicsCommandList7 from Windows SDK 10.0.22621 (or the D3D12 Agility SDK).
+#if defined __ID3D12GraphicsCommandList7_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENHANCED_BARRIERS
+#endif
+
+// Mesh shaders require ID3D12GraphicsCommandList6 from Windows SDK 10.0.19041 and the Direct3D 12.2 feature level option.
+#if LLGL_D3D12_ENABLE_FEATURELEVEL >= 2 && defined __ID3D12GraphicsCommandList6_INTERFACE_DEFINED__
+#   define LLGL_D3D12_MESH_SHADERS
+#endif
+
+// Dynamic depth bias requires ID3D12GraphicsCommandList9 from Windows SDK 10.0.26100 (or the D3D12 Agility SDK).
+#if defined __ID3D12GraphicsCommandList9_INTERFACE_DEFINED__
+#   define LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+#endif
+
+// Variable rate shading requires ID3D12GraphicsCommandList5 from Windows SDK 10.0.18362.
+#if defined __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+#   define LLGL_D3D12_VARIABLE_RATE_SHADING
+#endif
+
+// View instancing requires ID3D12GraphicsCommandList1 and ID3D12Device2 (for pipeline state streams) from Windows SDK 10.0.16299.
+#if defined __ID3D12GraphicsCommandList1_INTERFACE_DEFINED__ && defined __ID3D12Device2_INTERFACE_DEFINED__
+#   define LLGL_D3D12_VIEW_INSTANCING
+#endif
 
 
 namespace LLGL
@@ -26,6 +54,7 @@ namespace LLGL
 
 
 struct D3D12Resource;
+struct TextureSubresource;
 class D3D12Device;
 class D3D12CommandQueue;
 
@@ -53,6 +82,7 @@ class D3D12CommandContext
         D3D12CommandContext(D3D12Device& device);
 
         // Creats the command list and internal command allocators.
+        // The pool starts with 'numAllocators' (at most 3) command allocators and grows on demand while all of them are still in flight.
         void Create(
             D3D12Device&            device,
             D3D12_COMMAND_LIST_TYPE commandListType         = D3D12_COMMAND_LIST_TYPE_DIRECT,
@@ -79,16 +109,61 @@ class D3D12CommandContext
             return commandList_.Get();
         }
 
-        // Transition all subresources to the specified new state.
+        // Returns true if this context records native render passes via ID3D12GraphicsCommandList4, i.e. the render pass tier is at least D3D12_RENDER_PASS_TIER_1.
+        inline bool SupportsNativeRenderPasses() const
+        {
+            return (commandList4_.Get() != nullptr);
+        }
+
+        /*
+        Transition all subresources to the specified new state.
+        For compute and copy command lists, the new state is reduced to the states supported by that queue type, or D3D12_RESOURCE_STATE_COMMON.
+        Resources that are shared with compute or copy queues must therefore not be left in graphics-only states when they are handed over.
+        */
         void TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, bool flushImmediate = false);
         void TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
 
+        // Transitions a single subresource to the specified new state. Transitions the entire resource if the subresource is not tracked individually.
+        void TransitionSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
+
+        // Transitions the specified range of MIP-map levels and array layers of a texture resource to the specified new state.
+        void TransitionSubresources(D3D12Resource& resource, const TextureSubresource& subresource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
+
+        /*
+        Begins a split barrier to transition the specified subresource, so the GPU can overlap the transition with subsequent commands.
+        The barrier is ended by the next transition of this resource, before the next draw, dispatch, or bundle command, or when the command list is closed.
+        */
+        void BeginTransitionSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState);
+
+        // Ends all split barriers that have begun with BeginTransitionSubresource. Does nothing if there are no pending split barriers.
+        void EndSplitBarriers(bool flushImmediate = false);
+
         // Insert a resource barrier for an unordered access view (UAV).
         void InsertUAVBarrier(D3D12Resource& resource, bool flushImmediate = false);
 
+        /*
+        Activates the specified placed resource within its aliasing heap (see D3D12Resource::aliasingHeap).
+        Inserts an aliasing barrier and returns true if another resource of the same heap may have been used before,
+        in which case the content of the resource is undefined and must be initialized with a clear, discard, or copy operation.
+        */
+        bool AliasResource(D3D12Resource& resource);
+
+        // Discards the content of the specified subresource, or the entire resource if 'subresource' is D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES.
+        void DiscardSubresource(D3D12Resource& resource, UINT subresource);
+
         // Flush all accumulated resource barriers.
         void FlushResourceBarrieres();
 
+        // Flushes all accumulated resource barriers and begins a native render pass. Only allowed if SupportsNativeRenderPasses() returns true.
+        void BeginRenderPass(
+            UINT                                        numRenderTargets,
+            const D3D12_RENDER_PASS_RENDER_TARGET_DESC* renderTargets,
+            const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* depthStencil
+        );
+
+        // Ends the current native render pass.
+        void EndRenderPass();
+
         void ResolveSubresource(
             D3D12Resource&  dstResource,
             UINT            dstSubresource,
@@ -135,6 +210,10 @@ class D3D12CommandContext
         void SetGraphicsConstant(UINT parameterIndex, D3D12Constant value, UINT offset);
         void SetComputeConstant(UINT parameterIndex, D3D12Constant value, UINT offset);
 
+        // Sets a contiguous range of 32-bit root constants with a single command.
+        void SetGraphicsConstants(UINT parameterIndex, const void* values, UINT num32BitValues, UINT offset);
+        void SetComputeConstants(UINT parameterIndex, const void* values, UINT num32BitValues, UINT offset);
+
         void SetGraphicsRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr);
         void SetComputeRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr);
 
@@ -146,7 +225,8 @@ class D3D12CommandContext
             D3D12_DESCRIPTOR_HEAP_TYPE  type,
             D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
             UINT                        firstDescriptor,
-            UINT                        numDescriptors
+            UINT                        numDescriptors,
+            std::uint64_t               contentVersion  = 0
         );
 
         void EmplaceDescriptorForStaging(
@@ -155,6 +235,13 @@ class D3D12CommandContext
             D3D12_DESCRIPTOR_RANGE_TYPE descRangeType
         );
 
+        void EmplaceBufferViewDescriptorForStaging(
+            D3D12Buffer&                bufferD3D,
+            const BufferViewDescriptor& bufferViewDesc,
+            UINT                        location,
+            D3D12_DESCRIPTOR_RANGE_TYPE descRangeType
+        );
+
         void DrawInstanced(
             UINT vertexCountPerInstance,
             UINT instanceCount,
@@ -170,6 +257,11 @@ class D3D12CommandContext
             UINT    startInstanceLocation
         );
 
+        void DrawIndexedInstancedN(
+            const DrawIndexedIndirectArguments* args,
+            UINT                                numDraws
+        );
+
         void DrawIndirect(
             ID3D12CommandSignature* commandSignature,
             UINT                    maxCommandCount,
@@ -194,6 +286,40 @@ class D3D12CommandContext
             UINT64                  countBufferOffset       = 0
         );
 
+        #ifdef LLGL_D3D12_MESH_SHADERS
+
+        void DispatchMesh(
+            UINT threadGroupCountX,
+            UINT threadGroupCountY,
+            UINT threadGroupCountZ
+        );
+
+        #endif // /LLGL_D3D12_MESH_SHADERS
+
+        #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+        // Sets the dynamic depth bias. Only has an effect if dynamic depth bias is supported.
+        void SetDepthBias(FLOAT depthBias, FLOAT depthBiasClamp, FLOAT slopeScaledDepthBias);
+
+        #endif // /LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+
+        #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+
+        // Sets the per-draw shading rate and combiners. Only has an effect if VRS tier 1 is supported. Combiners are ignored below VRS tier 2.
+        void SetShadingRate(D3D12_SHADING_RATE baseShadingRate, const D3D12_SHADING_RATE_COMBINER combiners[2]);
+
+        // Sets the shading-rate image. Only has an effect if VRS tier 2 is supported.
+        void SetShadingRateImage(ID3D12Resource* shadingRateImage);
+
+        #endif // /LLGL_D3D12_VARIABLE_RATE_SHADING
+
+        #ifdef LLGL_D3D12_VIEW_INSTANCING
+
+        // Sets the mask of active view instances. Only has an effect if view instancing is supported.
+        void SetViewInstanceMask(UINT mask);
+
+        #endif // /LLGL_D3D12_VIEW_INSTANCING
+
     public:
 
         // Returns the native D3D12 device this command context was created with.
@@ -202,12 +328,23 @@ class D3D12CommandContext
             return device_;
         }
 
+        // Returns the upload ring buffer and readback buffer pool of this command context.
+        inline D3D12StagingBufferPool& GetStagingBufferPool()
+        {
+            return stagingBufferPool_;
+        }
+
     private:
 
-        static constexpr UINT maxNumAllocators          = 3;
+        static constexpr UINT maxNumInitialAllocators   = 3;
+        static constexpr UINT maxNumAllocators          = 8;
         static constexpr UINT maxNumResourceBarrieres   = 16;
+        static constexpr UINT maxNumSplitBarriers       = 16;
         static constexpr UINT maxNumDescriptorHeaps     = 2;
 
+        static_assert(maxNumAllocators <= D3D12StagingBufferPool::maxNumFrames, "staging buffer pool must have one frame per command allocator");
+        static_assert(maxNumAllocators <= D3D12StagingDescriptorHeapPool::maxNumFrames, "staging descriptor heap pool must have one frame per command allocator");
+
     private:
 
         struct StateCache
@@ -236,17 +373,80 @@ class D3D12CommandContext
             ID3D12DescriptorHeap*   descriptorHeaps[maxNumDescriptorHeaps]  = {};
         };
 
+        struct AliasedResource
+        {
+            ID3D12Heap*     heap;
+            ID3D12Resource* resource;
+        };
+
+        struct SplitBarrier
+        {
+            D3D12Resource*          resource;
+            UINT                    subresource;
+            D3D12_RESOURCE_STATES   stateBefore;
+            D3D12_RESOURCE_STATES   stateAfter;
+            UINT                    barrierIndex;   // Index into the resource barrier cache of the beginning barrier.
+            UINT64                  flushIndex;     // Number of barrier flushes when the split barrier began.
+        };
+
     private:
 
         // Clears the internal cached states.
         void ClearCache();
 
+        // Appends a transition barrier to the resource barrier cache and returns its index.
+        UINT AppendTransitionBarrier(
+            ID3D12Resource*                 resource,
+            UINT                            subresource,
+            D3D12_RESOURCE_STATES           stateBefore,
+            D3D12_RESOURCE_STATES           stateAfter,
+            D3D12_RESOURCE_BARRIER_FLAGS    flags       = D3D12_RESOURCE_BARRIER_FLAG_NONE
+        );
+
+        // Transitions a single tracked subresource without ending split barriers or merging the subresource states.
+        void TransitionTrackedSubresource(D3D12Resource& resource, UINT subresource, D3D12_RESOURCE_STATES newState);
+
+        // Returns the specified resource state reduced to the states that are supported by the type of this command list.
+        D3D12_RESOURCE_STATES GetSupportedResourceState(D3D12_RESOURCE_STATES state) const;
+
+        // Merges the individual subresource states if they are all equal.
+        void MergeSubresourceStates(D3D12Resource& resource);
+
+        // Ends all split barriers of the specified resource.
+        void EndSplitBarriersOfResource(D3D12Resource& resource);
+
+        // Ends the specified split barrier. If the beginning barrier has not been flushed yet, it is converted into a regular barrier.
+        void EndSplitBarrier(const SplitBarrier& splitBarrier);
+
+        #ifdef LLGL_D3D12_ENHANCED_BARRIERS
+        // Translates all accumulated resource barriers into enhanced barriers and submits them via ID3D12GraphicsCommandList7::Barrier.
+        void FlushEnhancedBarriers();
+        #endif
+
         // Returns the next resource barrier and flushes previous barriers if the cache is full.
         D3D12_RESOURCE_BARRIER& NextResourceBarrier();
 
         // Switches to the next command allocator and resets it.
         void NextCommandAllocator(D3D12CommandQueue& commandQueue);
 
+        // Signals the allocator fence with the value of the specified command allocator.
+        void SignalCommandAllocator(D3D12CommandQueue& commandQueue, UINT allocatorIndex);
+
+        // Creates a new command allocator in the first unused slot and returns its index.
+        UINT CreateCommandAllocator();
+
+        // Releases the native command allocator of the specified slot.
+        void ReleaseCommandAllocator(UINT allocatorIndex);
+
+        // Removes and returns the oldest command allocator from the in-flight queue.
+        UINT PopCommandAllocatorQueue();
+
+        // Returns true if the GPU has finished all work that was recorded with the specified command allocator.
+        bool IsCommandAllocatorCompleted(UINT allocatorIndex) const;
+
+        // Binds the shader-visible descriptor heaps of the staging descriptor heap pools.
+        void SetStagingDescriptorHeaps();
+
         void SetPipelineStateCached(ID3D12PipelineState* pipelineState);
 
         void FlushDeferredPipelineState();
@@ -266,23 +466,54 @@ class D3D12CommandContext
 
         ComPtr<ID3D12CommandAllocator>      commandAllocators_[maxNumAllocators];
         UINT                                currentAllocatorIndex_                      = 0;
-        UINT                                numAllocators_                              = maxNumAllocators;
+        UINT                                numAllocators_                              = maxNumInitialAllocators;  // Number of allocators the pool shrinks back to.
+        UINT                                numActiveAllocators_                        = 0;
+        D3D12_COMMAND_LIST_TYPE             commandListType_                            = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+        UINT                                allocatorQueue_[maxNumAllocators]           = {};                       // Allocators in submission order, excluding the current one.
+        UINT                                allocatorQueueSize_                         = 0;
+        bool                                allocatorSlotInitialized_[maxNumAllocators] = {};
 
         UINT64                              allocatorFenceValues_[maxNumAllocators]     = {};
         bool                                allocatorFenceValueDirty_[maxNumAllocators] = {};
         D3D12NativeFence                    allocatorFence_;
 
         ComPtr<ID3D12GraphicsCommandList>   commandList_;
+        D3D12_RESOURCE_STATES               supportedResourceStates_                    = static_cast<D3D12_RESOURCE_STATES>(~0);
+        ComPtr<ID3D12GraphicsCommandList4>  commandList4_;                                  // Only set if native render passes are supported.
+        #ifdef LLGL_D3D12_ENHANCED_BARRIERS
+        ComPtr<ID3D12GraphicsCommandList7>  commandList7_;                                  // Only set if enhanced barriers are supported.
+        #endif
+        #ifdef LLGL_D3D12_MESH_SHADERS
+        ComPtr<ID3D12GraphicsCommandList6>  commandList6_;                                  // Only set if mesh shaders are supported.
+        #endif
+        #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+        ComPtr<ID3D12GraphicsCommandList9>  commandList9_;                                  // Only set if dynamic depth bias is supported.
+        #endif
+        #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+        ComPtr<ID3D12GraphicsCommandList5>  commandList5_;                                  // Only set if variable rate shading is supported.
+        D3D12_VARIABLE_SHADING_RATE_TIER    shadingRateTier_                            = D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+        bool                                additionalShadingRates_                     = false;
+        #endif
+        #ifdef LLGL_D3D12_VIEW_INSTANCING
+        ComPtr<ID3D12GraphicsCommandList1>  commandList1_;                                  // Only set if view instancing is supported.
+        #endif
 
         D3D12_RESOURCE_BARRIER              resourceBarriers_[maxNumResourceBarrieres];
         UINT                                numResourceBarriers_                        = 0;
+        UINT64                              numResourceBarrierFlushes_                  = 0;
+
+        SplitBarrier                        splitBarriers_[maxNumSplitBarriers];
+        UINT                                numSplitBarriers_                           = 0;
+
+        std::vector<AliasedResource>        activeAliasedResources_;                        // Active placed resource of each aliasing heap used in the current command list.
 
-        D3D12StagingDescriptorHeapPool      stagingDescriptorPools_[maxNumAllocators][maxNumDescriptorHeaps];
+        D3D12StagingDescriptorHeapPool      stagingDescriptorPools_[maxNumDescriptorHeaps];
         D3D12DescriptorHeapSetLayout        stagingDescriptorSetLayout_;
         D3D12RootParameterIndices           stagingDescriptorIndices_;
         D3D12DescriptorCache                descriptorCaches_[maxNumAllocators];
 
-        D3D12StagingBufferPool              stagingBufferPools_[maxNumAllocators];
+        D3D12StagingBufferPool              stagingBufferPool_;
         D3D12IntermediateBufferPool         intermediateBufferPools_[maxNumAllocators];
 
         StateCache                          stateCache_;
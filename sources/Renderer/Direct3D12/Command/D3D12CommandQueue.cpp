@@ -7,12 +7,16 @@
 
 #include "D3D12CommandQueue.h"
 #include "D3D12CommandBuffer.h"
+#include "D3D12DeferredReleaseQueue.h"
 #include "../D3D12ObjectUtils.h"
 #include "../D3D12RenderSystem.h"
 #include "../RenderState/D3D12Fence.h"
 #include "../RenderState/D3D12QueryHeap.h"
+#include "../Texture/D3D12Texture.h"
 #include "../../CheckedCast.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -21,13 +25,17 @@ namespace LLGL
 
 D3D12CommandQueue::D3D12CommandQueue(
     D3D12Device&            device,
-    D3D12_COMMAND_LIST_TYPE type)
+    D3D12_COMMAND_LIST_TYPE     type,
+    D3D12TileHeapPool*          tileHeapPool,
+    D3D12DeferredReleaseQueue*  deferredReleaseQueue)
 :
-    native_     { device.CreateDXCommandQueue(type) },
-    queueFence_ { device.GetNative()                }
+    native_                 { device.CreateDXCommandQueue(type) },
+    queueFence_             { device.GetNative()                },
+    tileHeapPool_           { tileHeapPool                      },
+    deferredReleaseQueue_   { deferredReleaseQueue              }
 {
-    commandContext_.Create(device);
-    DetermineTimestampFrequency();
+    commandContext_.Create(device, type);
+    DetermineTimestampFrequency(type);
 }
 
 void D3D12CommandQueue::SetDebugName(const char* name)
@@ -39,6 +47,8 @@ void D3D12CommandQueue::SetDebugName(const char* name)
 
 void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_CPU_PROFILE_SCOPE("CommandQueue::Submit");
+
     /* Execute command list */
     auto& commandBufferD3D = LLGL_CAST(D3D12CommandBuffer&, commandBuffer);
     if (!commandBufferD3D.IsImmediateCmdBuffer())
@@ -94,6 +104,25 @@ bool D3D12CommandQueue::QueryResult(
     return result;
 }
 
+bool D3D12CommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    /* Copy queues only support timestamps on some devices, so don't throw on failure here */
+    UINT64 timestampFrequency = 0;
+    if (FAILED(native_->GetTimestampFrequency(&timestampFrequency)))
+        return false;
+
+    /* CPU timestamp is sampled with QueryPerformanceCounter, which is the same clock as Timer::Tick on Windows */
+    UINT64 gpuTimestamp = 0, cpuTimestamp = 0;
+    if (FAILED(native_->GetClockCalibration(&gpuTimestamp, &cpuTimestamp)))
+        return false;
+
+    outCalibration.gpuTimestamp = gpuTimestamp;
+    outCalibration.gpuFrequency = timestampFrequency;
+    outCalibration.cpuTicks     = cpuTimestamp;
+    outCalibration.maxDeviation = 0;
+    return true;
+}
+
 /* ----- Fences ----- */
 
 void D3D12CommandQueue::Submit(Fence& fence)
@@ -103,6 +132,14 @@ void D3D12CommandQueue::Submit(Fence& fence)
     SignalFence(fenceD3D.GetNative(), fenceD3D.Signal());
 }
 
+void D3D12CommandQueue::SubmitWait(Fence& fence)
+{
+    /* Schedule GPU-side wait for the last value the fence has been signaled with on another queue */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    HRESULT hr = native_->Wait(fenceD3D.GetNative(), fenceD3D.GetSignaledValue());
+    DXThrowIfInvocationFailed(hr, "ID3D12CommandQueue::Wait");
+}
+
 bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
@@ -111,14 +148,39 @@ bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void D3D12CommandQueue::WaitIdle()
 {
-    /* Submit intermediate fence and wait for it to be signaled */
-    if (busy_)
+    std::lock_guard<std::mutex> guard{ waitIdleMutex_ };
+
+    /* Take deferred releases before the fence is signaled, since other threads might submit work concurrently */
+    std::vector<std::function<void()>> releaseCallbacks;
+    if (deferredReleaseQueue_ != nullptr)
+        releaseCallbacks = deferredReleaseQueue_->TakeAll();
+
+    /* Submit intermediate fence and wait for it to be signaled; reset busy state first to not lose concurrent submissions */
+    if (busy_.exchange(false))
     {
         ++queueFenceValue_;
-        SignalFence(queueFence_.Get(), queueFenceValue_);
+        HRESULT hr = native_->Signal(queueFence_.Get(), queueFenceValue_);
+        DXThrowIfFailed(hr, "failed to signal D3D12 fence with command queue");
         queueFence_.WaitForHigherSignal(queueFenceValue_);
-        busy_ = false;
     }
+
+    /* All deferred releases that were taken are safe once the queue is idle */
+    for (const auto& callback : releaseCallbacks)
+        callback();
+}
+
+/* ----- Sparse resources ----- */
+
+bool D3D12CommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings)
+{
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    if (tileHeapPool_ == nullptr || !textureD3D.IsSparse())
+        return false;
+
+    for_range(i, numMappings)
+        textureD3D.UpdateTileMappings(native_.Get(), *tileHeapPool_, mappings[i]);
+
+    return true;
 }
 
 /* ----- Internal ----- */
@@ -147,11 +209,13 @@ void D3D12CommandQueue::ExecuteCommandList(ID3D12CommandList* commandList)
  * ======= Private: =======
  */
 
-void D3D12CommandQueue::DetermineTimestampFrequency()
+void D3D12CommandQueue::DetermineTimestampFrequency(D3D12_COMMAND_LIST_TYPE type)
 {
-    /* Get timestamp frequency for command queue */
+    /* Get timestamp frequency for command queue; copy queues only support timestamps on some devices */
     UINT64 timestampFrequency = 0;
     HRESULT hr = native_->GetTimestampFrequency(&timestampFrequency);
+    if (FAILED(hr) && type == D3D12_COMMAND_LIST_TYPE_COPY)
+        return;
     DXThrowIfInvocationFailed(hr, "ID3D12CommandQueue::GetTimestampFrequency");
 
     /* Determine if a conversion from timestamps to nanoseconds is necessary */
@@ -15,6 +15,8 @@
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <cstddef>
+#include <atomic>
+#include <mutex>
 
 
 namespace LLGL
@@ -22,6 +24,8 @@ namespace LLGL
 
 
 class D3D12Device;
+class D3D12TileHeapPool;
+class D3D12DeferredReleaseQueue;
 
 class D3D12CommandQueue final : public CommandQueue
 {
@@ -34,11 +38,19 @@ class D3D12CommandQueue final : public CommandQueue
 
         D3D12CommandQueue(
             D3D12Device&            device,
-            D3D12_COMMAND_LIST_TYPE type = D3D12_COMMAND_LIST_TYPE_DIRECT
+            D3D12_COMMAND_LIST_TYPE     type                    = D3D12_COMMAND_LIST_TYPE_DIRECT,
+            D3D12TileHeapPool*          tileHeapPool            = nullptr,
+            D3D12DeferredReleaseQueue*  deferredReleaseQueue    = nullptr
         );
 
         void SetDebugName(const char* name) override;
 
+        bool QueryTimestampCalibration(TimestampCalibration& outCalibration) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings) override;
+
     public:
 
         // Submits the specified fence with a custom value.
@@ -62,7 +74,7 @@ class D3D12CommandQueue final : public CommandQueue
 
     private:
 
-        void DetermineTimestampFrequency();
+        void DetermineTimestampFrequency(D3D12_COMMAND_LIST_TYPE type);
 
         void QueryResultSingleUInt64(
             D3D12_QUERY_TYPE    queryType,
@@ -100,10 +112,13 @@ class D3D12CommandQueue final : public CommandQueue
         ComPtr<ID3D12CommandQueue>  native_;
         D3D12CommandContext         commandContext_;
         D3D12NativeFence            queueFence_;
+        D3D12TileHeapPool*          tileHeapPool_           = nullptr;
+        D3D12DeferredReleaseQueue*  deferredReleaseQueue_   = nullptr;
         UINT64                      queueFenceValue_        = 0;
         double                      timestampScale_         = 1.0;  // Frequency to nanoseconds scale
         bool                        isTimestampNanosecs_    = true; // True, if timestamps are in nanoseconds unit
-        bool                        busy_                   = false;
+        std::atomic<bool>           busy_                   { false };
+        std::mutex                  waitIdleMutex_;                 // Serializes WaitIdle, which can be called by concurrent resource releases
 
 };
 
@@ -0,0 +1,87 @@
+/*
+ * D3D12DeferredReleaseQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12DeferredReleaseQueue.h"
+#include "D3D12CommandQueue.h"
+
+
+namespace LLGL
+{
+
+
+D3D12DeferredReleaseQueue::D3D12DeferredReleaseQueue(ID3D12Device* device) :
+    fence_ { device }
+{
+}
+
+void D3D12DeferredReleaseQueue::Defer(std::function<void()>&& releaseCallback)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    currentCallbacks_.push_back(std::move(releaseCallback));
+}
+
+void D3D12DeferredReleaseQueue::NextFrame(D3D12CommandQueue& commandQueue)
+{
+    std::vector<std::function<void()>> completedCallbacks;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+
+        if (!currentCallbacks_.empty())
+        {
+            /* Fence all work that has been submitted so far, since command queues complete their work in order */
+            commandQueue.SignalFence(fence_.Get(), ++fenceValue_);
+
+            FrameBatch batch;
+            {
+                batch.fenceValue        = fenceValue_;
+                batch.releaseCallbacks  = std::move(currentCallbacks_);
+            }
+            currentCallbacks_.clear();
+            inFlightBatches_.push_back(std::move(batch));
+        }
+
+        /* Take callbacks of all leading batches that have completed */
+        const UINT64 completedValue = fence_.GetCompletedValue();
+
+        std::size_t numCompleted = 0;
+        for (; numCompleted < inFlightBatches_.size() && inFlightBatches_[numCompleted].fenceValue <= completedValue; ++numCompleted)
+        {
+            for (auto& callback : inFlightBatches_[numCompleted].releaseCallbacks)
+                completedCallbacks.push_back(std::move(callback));
+        }
+        inFlightBatches_.erase(inFlightBatches_.begin(), inFlightBatches_.begin() + numCompleted);
+    }
+
+    /* Invoke callbacks without lock, since they release objects that might defer further releases */
+    for (const auto& callback : completedCallbacks)
+        callback();
+}
+
+std::vector<std::function<void()>> D3D12DeferredReleaseQueue::TakeAll()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    std::vector<std::function<void()>> callbacks;
+    for (FrameBatch& batch : inFlightBatches_)
+    {
+        for (auto& callback : batch.releaseCallbacks)
+            callbacks.push_back(std::move(callback));
+    }
+    inFlightBatches_.clear();
+
+    for (auto& callback : currentCallbacks_)
+        callbacks.push_back(std::move(callback));
+    currentCallbacks_.clear();
+
+    return callbacks;
+}
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
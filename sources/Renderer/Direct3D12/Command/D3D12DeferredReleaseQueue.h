@@ -0,0 +1,77 @@
+/*
+ * D3D12DeferredReleaseQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_DEFERRED_RELEASE_QUEUE_H
+#define LLGL_D3D12_DEFERRED_RELEASE_QUEUE_H
+
+
+#include "../RenderState/D3D12Fence.h"
+#include <d3d12.h>
+#include <functional>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class D3D12CommandQueue;
+
+/*
+Queue of release callbacks that are deferred until the GPU has finished all work that was submitted before they were queued.
+All callbacks that are queued between two frames are grouped into one batch, which is fenced with the next value of
+a fence that is signaled by the command queue when the next frame begins. Completed batches are only polled and never waited on, except for TakeAll.
+This class is thread-safe, so resources can be released from any thread. Callbacks are invoked outside of the internal mutex.
+*/
+class D3D12DeferredReleaseQueue
+{
+
+    public:
+
+        D3D12DeferredReleaseQueue(ID3D12Device* device);
+
+        D3D12DeferredReleaseQueue(const D3D12DeferredReleaseQueue&) = delete;
+        D3D12DeferredReleaseQueue& operator = (const D3D12DeferredReleaseQueue&) = delete;
+
+        // Queues the specified release callback for the current frame.
+        void Defer(std::function<void()>&& releaseCallback);
+
+        // Fences all callbacks of the current frame with the specified command queue and invokes the callbacks of all previous frames that have completed on the GPU.
+        void NextFrame(D3D12CommandQueue& commandQueue);
+
+        // Removes all remaining callbacks and returns them. They must only be invoked once the GPU has finished all work that was submitted before this call.
+        std::vector<std::function<void()>> TakeAll();
+
+    private:
+
+        struct FrameBatch
+        {
+            UINT64                              fenceValue;
+            std::vector<std::function<void()>>  releaseCallbacks;
+        };
+
+    private:
+
+        D3D12NativeFence                    fence_;
+        UINT64                              fenceValue_         = 0;
+
+        std::vector<std::function<void()>>  currentCallbacks_;
+        std::vector<FrameBatch>             inFlightBatches_;   // Batches in submission order
+        std::mutex                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,7 +6,9 @@
  */
 
 #include "D3D12SignatureFactory.h"
+#include "D3D12CommandContext.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 
 namespace LLGL
@@ -33,11 +35,64 @@ static void DXCreateCommandSignature(ID3D12Device* device, ComPtr<ID3D12CommandS
 
 void D3D12SignatureFactory::CreateDefaultSignatures(ID3D12Device* device)
 {
+    device_ = device;
     DXCreateCommandSignature(device, signatureDrawIndirect_,        D3D12_INDIRECT_ARGUMENT_TYPE_DRAW,         sizeof(D3D12_DRAW_ARGUMENTS        ));
     DXCreateCommandSignature(device, signatureDrawIndexedIndirect_, D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, sizeof(D3D12_DRAW_INDEXED_ARGUMENTS));
     DXCreateCommandSignature(device, signatureDispatchIndirect_,    D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH,     sizeof(D3D12_DISPATCH_ARGUMENTS    ));
 }
 
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDrawIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_ARGUMENTS))
+        return GetSignatureDrawIndirect();
+    else
+        return GetOrCreateCustomSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride);
+}
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDrawIndexedIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+        return GetSignatureDrawIndexedIndirect();
+    else
+        return GetOrCreateCustomSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride);
+}
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDispatchMeshIndirect(UINT stride) const
+{
+    #ifdef LLGL_D3D12_MESH_SHADERS
+    return GetOrCreateCustomSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH, stride);
+    #else
+    return nullptr;
+    #endif
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetOrCreateCustomSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(customSignaturesMutex_, "D3D12SignatureFactory");
+
+    /* Only a few custom strides are expected, so a linear search is sufficient */
+    for (const CustomSignature& entry : customSignatures_)
+    {
+        if (entry.argumentType == argumentType && entry.stride == stride)
+            return entry.signature.Get();
+    }
+
+    CustomSignature entry;
+    {
+        entry.argumentType  = argumentType;
+        entry.stride        = stride;
+        DXCreateCommandSignature(device_, entry.signature, argumentType, stride);
+    }
+    customSignatures_.push_back(std::move(entry));
+
+    return customSignatures_.back().signature.Get();
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,8 @@
 
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
@@ -39,11 +41,39 @@ class D3D12SignatureFactory
             return signatureDispatchIndirect_.Get();
         }
 
+        // Returns the command signature for indirect draw commands with the specified stride. Signatures for custom strides are created on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndirect(UINT stride) const;
+
+        // Returns the command signature for indexed indirect draw commands with the specified stride. Signatures for custom strides are created on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndexedIndirect(UINT stride) const;
+
+        // Returns the command signature for indirect mesh shader dispatches with the specified stride. Signatures are created on demand, since not all devices support mesh shaders.
+        ID3D12CommandSignature* GetSignatureDispatchMeshIndirect(UINT stride) const;
+
+    private:
+
+        struct CustomSignature
+        {
+            D3D12_INDIRECT_ARGUMENT_TYPE    argumentType;
+            UINT                            stride;
+            ComPtr<ID3D12CommandSignature>  signature;
+        };
+
+    private:
+
+        ID3D12CommandSignature* GetOrCreateCustomSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const;
+
     private:
 
-        ComPtr<ID3D12CommandSignature> signatureDrawIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDrawIndexedIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDispatchIndirect_;
+        ID3D12Device*                           device_                         = nullptr;
+
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndexedIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDispatchIndirect_;
+
+        // Signatures for custom strides are created lazily while command buffers are encoded, possibly on multiple threads.
+        mutable std::vector<CustomSignature>    customSignatures_;
+        mutable std::mutex                      customSignaturesMutex_;
 
 };
 
@@ -39,6 +39,18 @@ namespace ModuleDirect3D12
 
 } // /namespace LLGL
 
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#include "../DirectCommandBufferImpl.h"
+#include "Command/D3D12CommandBuffer.h"
+
+#define LLGL_D3D12_DIRECT_DISPATCH(CMDBUFFER, CALL) \
+    LLGL_DIRECT_DISPATCH_FINAL(D3D12CommandBuffer, CMDBUFFER, CALL)
+
+LLGL_IMPLEMENT_DIRECT_COMMAND_BUFFER(LLGL_D3D12_DIRECT_DISPATCH)
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
 #ifndef LLGL_BUILD_STATIC_LIB
 
 extern "C"
@@ -12,14 +12,20 @@
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
 #include "../RenderSystemUtils.h"
+#include "../MemoryInfoUtils.h"
+#include "../PipelineStateUtils.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/ImageUtils.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include "D3DX12/d3dx12.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Log.h>
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <limits.h>
+#include <string.h>
 
 #include "Buffer/D3D12Buffer.h"
 #include "Buffer/D3D12BufferArray.h"
@@ -29,14 +35,33 @@
 
 #include "RenderState/D3D12GraphicsPSO.h"
 #include "RenderState/D3D12ComputePSO.h"
+#include "RenderState/D3D12ObjectCache.h"
 
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
+#ifdef LLGL_D3D12_ENABLE_DXCOMPILER
+#   include "../DXCommon/DXC/DXCInstance.h"
+#endif
+
 
 namespace LLGL
 {
 
 
+static bool IsGpuUploadHeapSupported(ID3D12Device* device)
+{
+    #ifdef LLGL_D3D12_GPU_UPLOAD_HEAPS
+    D3D12_FEATURE_DATA_D3D12_OPTIONS16 options16 = {};
+    return
+    (
+        SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &options16, sizeof(options16))) &&
+        options16.GPUUploadHeapSupported != FALSE
+    );
+    #else
+    return false;
+    #endif
+}
+
 D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 {
     const bool debugDevice = ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0);
@@ -63,22 +88,37 @@ D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemD
 
     /* Query and cache DXGI factory feature support */
     tearingSupported_ = CheckFactoryFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING);
+    gpuUploadHeapSupported_ = IsGpuUploadHeapSupported(device_.GetNative());
+
+    /* Create queue for deferred resource releases if enabled */
+    if ((renderSystemDesc.flags & RenderSystemFlags::DeferredRelease) != 0)
+        deferredReleaseQueue_ = MakeUnique<D3D12DeferredReleaseQueue>(device_.GetNative());
 
     /* Create command queue interface */
-    commandQueue_   = MakeUnique<D3D12CommandQueue>(device_);
+    commandQueue_   = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_DIRECT, &tileHeapPool_, deferredReleaseQueue_.get());
     commandContext_ = &(commandQueue_->GetContext());
 
     /* Create default pipeline layout and command signature pool */
     defaultPipelineLayout_.CreateRootSignature(device_.GetNative(), {});
     cmdSignatureFactory_.CreateDefaultSignatures(device_.GetNative());
+    transientHeapPool_.InitializeDevice(device_.GetNative());
+    tileHeapPool_.InitializeDevice(device_.GetNative());
 
-    stagingBufferPool_.InitializeDevice(device_.GetNative(), 0);
     D3D12MipGenerator::Get().InitializeDevice(device_.GetNative());
-    D3D12BufferConstantsPool::Get().InitializeDevice(device_.GetNative(), *commandContext_, *commandQueue_, stagingBufferPool_);
+    D3D12BufferConstantsPool::Get().InitializeDevice(device_.GetNative(), *commandContext_, *commandQueue_);
+
+    #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+    /* Create DirectStorage queue to stream resources from files; this is optional, since dstorage.dll is redistributed with the application */
+    directStorageQueue_ = D3D12DirectStorageQueue::Create(device_.GetNative());
+    #endif
 
     /* Initialize renderer information */
     QueryRendererInfo();
     QueryRenderingCaps();
+
+    /* Map persistent pipeline cache file if specified */
+    if (renderSystemDesc.pipelineCacheFilename != nullptr)
+        persistentPipelineCache_ = MakeUnique<PersistentPipelineCache>(renderSystemDesc.pipelineCacheFilename, GetRendererInfo());
 }
 
 D3D12RenderSystem::~D3D12RenderSystem()
@@ -95,8 +135,13 @@ D3D12RenderSystem::~D3D12RenderSystem()
     shaders_.clear();
 
     /* Clear resources of singletons */
+    #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
+    DXClearDxcompilerCache();
+    #endif
     D3D12MipGenerator::Get().Clear();
     D3D12BufferConstantsPool::Get().Clear();
+    D3D12ObjectCache::Get().Clear();
+    DXClearShaderReflectionCache();
 }
 
 /* ----- Swap-chain ----- */
@@ -118,6 +163,25 @@ CommandQueue* D3D12RenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* D3D12RenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (!computeCommandQueue_)
+                computeCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COMPUTE, &tileHeapPool_);
+            return computeCommandQueue_.get();
+
+        case CommandQueueType::Copy:
+            if (!copyCommandQueue_)
+                copyCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COPY, &tileHeapPool_);
+            return copyCommandQueue_.get();
+
+        default:
+            return commandQueue_.get();
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* D3D12RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -135,10 +199,26 @@ void D3D12RenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* D3D12RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateBuffer");
+
     RenderSystem::AssertCreateBuffer(bufferDesc, ULLONG_MAX);
-    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc);
+
+    /* Place buffer in GPU upload heap if supported and the budget permits it; otherwise, fall back to default heap */
+    const bool useGpuUploadHeap =
+    (
+        (bufferDesc.miscFlags & MiscFlags::DirectUpload) != 0 &&
+        gpuUploadHeapSupported_ &&
+        HasGpuUploadHeapBudget(bufferDesc.size)
+    );
+
+    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc, useGpuUploadHeap);
     if (initialData != nullptr)
-        UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size, bufferD3D->GetAlignment());
+    {
+        if (bufferD3D->IsDirectlyMapped())
+            CopyToWriteCombinedMemory(bufferD3D->GetMappedData(), initialData, static_cast<std::size_t>(bufferDesc.size));
+        else
+            UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size, bufferD3D->GetAlignment());
+    }
     return bufferD3D;
 }
 
@@ -150,6 +230,13 @@ BufferArray* D3D12RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buff
 
 void D3D12RenderSystem::Release(Buffer& buffer)
 {
+    /* Defer release until the GPU has finished the current frame instead of waiting for it */
+    if (deferredReleaseQueue_)
+    {
+        deferredReleaseQueue_->Defer([this, &buffer]() { buffers_.erase(&buffer); });
+        return;
+    }
+
     SyncGPU();
     buffers_.erase(&buffer);
 }
@@ -163,13 +250,22 @@ void D3D12RenderSystem::Release(BufferArray& bufferArray)
 void D3D12RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    UpdateBufferAndSync(bufferD3D, offset, data, dataSize);
+    if (bufferD3D.IsDirectlyMapped())
+        CopyToWriteCombinedMemory(bufferD3D.GetMappedData() + offset, data, static_cast<std::size_t>(dataSize));
+    else
+        UpdateBufferAndSync(bufferD3D, offset, data, dataSize);
 }
 
 void D3D12RenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    stagingBufferPool_.ReadSubresourceRegion(*commandContext_, *commandQueue_, bufferD3D.GetResource(), offset, data, dataSize);
+    if (bufferD3D.IsDirectlyMapped())
+    {
+        ::memcpy(data, bufferD3D.GetMappedData() + offset, static_cast<std::size_t>(dataSize));
+        return;
+    }
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
+    commandContext_->GetStagingBufferPool().ReadSubresourceRegion(*commandContext_, *commandQueue_, bufferD3D.GetResource(), offset, data, dataSize);
     /* No ExecuteCommandListAndSync() here as it has already been flushed by the staging buffer pool */
 }
 
@@ -188,6 +284,7 @@ void* D3D12RenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::
 void D3D12RenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
     bufferD3D.Unmap(*commandContext_, *commandQueue_);
 }
 
@@ -195,9 +292,12 @@ void D3D12RenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc);
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateTexture");
 
-    if (initialImage != nullptr)
+    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc, &transientHeapPool_);
+
+    /* Sparse textures have no memory committed until their tiles are mapped */
+    if (initialImage != nullptr && !textureD3D->IsSparse())
     {
         /* Update base MIP-map */
         TextureRegion region;
@@ -205,6 +305,7 @@ Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
             region.subresource.numArrayLayers   = textureDesc.arrayLayers;
             region.extent                       = textureDesc.extent;
         }
+        std::lock_guard<std::mutex> guard{ commandContextMutex_ };
         D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
         UpdateTextureSubresourceFromImage(*textureD3D, region, *initialImage, subresourceContext);
 
@@ -218,8 +319,17 @@ Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
 
 void D3D12RenderSystem::Release(Texture& texture)
 {
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+
+    /* Defer release until the GPU has finished the current frame instead of waiting for it */
+    if (deferredReleaseQueue_)
+    {
+        deferredReleaseQueue_->Defer([this, &textureD3D]() { ReleaseTexture(textureD3D); });
+        return;
+    }
+
     SyncGPU();
-    textures_.erase(&texture);
+    ReleaseTexture(textureD3D);
 }
 
 void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
@@ -227,6 +337,7 @@ void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
 
     /* Execute upload commands and wait for GPU to finish execution */
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
     D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
     UpdateTextureSubresourceFromImage(textureD3D, textureRegion, srcImageView, subresourceContext);
 }
@@ -244,6 +355,7 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
     ComPtr<ID3D12Resource> readbackBuffer;
     UINT rowStride = 0, layerSize = 0, layerStride = 0;
     {
+        std::lock_guard<std::mutex> guard{ commandContextMutex_ };
         D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
         textureD3D.CreateSubresourceCopyAsReadbackBuffer(subresourceContext, textureRegion, texturePlane, rowStride, layerSize, layerStride);
         readbackBuffer = subresourceContext.TakeResource();
@@ -293,7 +405,7 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
 
 Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<D3D12Sampler>(samplerDesc);
+    return samplers_.emplace<D3D12Sampler>(samplerPool_, samplerDesc);
 }
 
 void D3D12RenderSystem::Release(Sampler& sampler)
@@ -371,6 +483,7 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
     SyncGPU();
     pipelineLayouts_.erase(&pipelineLayout);
+    D3D12ObjectCache::Get().ReleaseUnusedObjects();
 }
 
 /* ----- Pipeline Caches ----- */
@@ -388,13 +501,87 @@ void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
+static void AppendShaderByteCodes(PersistentPipelineCacheKey& key, const ArrayView<Shader*>& shaders)
+{
+    for (Shader* shader : shaders)
+    {
+        const D3D12_SHADER_BYTECODE byteCode = LLGL_CAST(D3D12Shader*, shader)->GetByteCode();
+        key.Append(shader->GetType());
+        key.Append(static_cast<std::uint64_t>(byteCode.BytecodeLength));
+        key.AppendBytes(byteCode.pShaderBytecode, byteCode.BytecodeLength);
+    }
+}
+
+static bool HasPipelineStateErrors(const PipelineState* pipelineState)
+{
+    const Report* report = pipelineState->GetReport();
+    return (report != nullptr && report->HasErrors());
+}
+
+/*
+Creates a PSO with the persistent cache entry of the specified key. If the cached blob is rejected by the driver (e.g. after a driver update),
+the PSO is created again without cached blob and the cache entry is replaced.
+*/
+template <typename TPipelineDescriptor>
+static PipelineState* CreatePipelineStateWithPersistentCache(
+    RenderSystem&               renderSystem,
+    PersistentPipelineCache&    persistentCache,
+    std::uint64_t               key,
+    const TPipelineDescriptor&  pipelineStateDesc)
+{
+    if (Blob cachedBlob = persistentCache.Find(key))
+    {
+        D3D12PipelineCache initialCache{ cachedBlob };
+        PipelineState* pipelineState = renderSystem.CreatePipelineState(pipelineStateDesc, &initialCache);
+        if (!HasPipelineStateErrors(pipelineState))
+            return pipelineState;
+        renderSystem.Release(*pipelineState);
+    }
+
+    D3D12PipelineCache transientCache;
+    PipelineState* pipelineState = renderSystem.CreatePipelineState(pipelineStateDesc, &transientCache);
+    if (!HasPipelineStateErrors(pipelineState))
+        persistentCache.Store(key, transientCache.GetBlob());
+    return pipelineState;
+}
+
 PipelineState* D3D12RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+    {
+        PersistentPipelineCacheKey key;
+        key.AppendDescriptor(pipelineStateDesc);
+        AppendShaderByteCodes(key, GetShadersAsArray(pipelineStateDesc));
+
+        /* Append render target formats, since the cached blob is rejected for a different render pass */
+        const D3D12RenderPass* renderPass = (pipelineStateDesc.renderPass != nullptr ? LLGL_CAST(const D3D12RenderPass*, pipelineStateDesc.renderPass) : GetDefaultRenderPass());
+        if (renderPass != nullptr)
+        {
+            key.Append(renderPass->GetNumColorAttachments());
+            key.AppendBytes(renderPass->GetRTVFormats(), sizeof(DXGI_FORMAT) * renderPass->GetNumColorAttachments());
+            key.Append(renderPass->GetDSVFormat());
+            key.Append(renderPass->GetSampleDesc().Count);
+        }
+
+        return CreatePipelineStateWithPersistentCache(*this, *persistentPipelineCache_, key.Get(), pipelineStateDesc);
+    }
+
     return pipelineStates_.emplace<D3D12GraphicsPSO>(device_.GetNative(), defaultPipelineLayout_, pipelineStateDesc, GetDefaultRenderPass(), pipelineCache);
 }
 
 PipelineState* D3D12RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+    {
+        PersistentPipelineCacheKey key;
+        AppendShaderByteCodes(key, GetShadersAsArray(pipelineStateDesc));
+        return CreatePipelineStateWithPersistentCache(*this, *persistentPipelineCache_, key.Get(), pipelineStateDesc);
+    }
+
     return pipelineStates_.emplace<D3D12ComputePSO>(device_.GetNative(), defaultPipelineLayout_, pipelineStateDesc, pipelineCache);
 }
 
@@ -402,6 +589,7 @@ void D3D12RenderSystem::Release(PipelineState& pipelineState)
 {
     SyncGPU();
     pipelineStates_.erase(&pipelineState);
+    D3D12ObjectCache::Get().ReleaseUnusedObjects();
 }
 
 /* ----- Queries ----- */
@@ -446,6 +634,123 @@ bool D3D12RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
     return false;
 }
 
+bool D3D12RenderSystem::HasGpuUploadHeapBudget(std::uint64_t size) const
+{
+    /* Query budget of local video memory segment, which GPU upload heaps are allocated from */
+    ComPtr<IDXGIAdapter> dxgiAdapter;
+    if (FAILED(factory_->EnumAdapterByLuid(device_.GetNative()->GetAdapterLuid(), IID_PPV_ARGS(dxgiAdapter.GetAddressOf()))))
+        return false;
+
+    MemoryInfo memoryInfo;
+    DXQueryVideoMemoryInfo(dxgiAdapter.Get(), memoryInfo);
+
+    for_range(i, memoryInfo.numHeaps)
+    {
+        const MemoryHeapInfo& heap = memoryInfo.heaps[i];
+        if (heap.deviceLocal)
+            return (heap.usage + size <= heap.budget);
+    }
+
+    return false;
+}
+
+bool D3D12RenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    outInfo = {};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+    outInfo.stagingPools = commandContext_->GetStagingBufferPool().GetTotalSize();
+
+    /* Query memory budget from the adapter this device was created with */
+    ComPtr<IDXGIAdapter> dxgiAdapter;
+    if (SUCCEEDED(factory_->EnumAdapterByLuid(device_.GetNative()->GetAdapterLuid(), IID_PPV_ARGS(dxgiAdapter.GetAddressOf()))))
+        DXQueryVideoMemoryInfo(dxgiAdapter.Get(), outInfo);
+
+    return true;
+}
+
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+bool D3D12RenderSystem::StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+
+    /* Fall back to mapped file if DirectStorage is unavailable or the buffer is written by the CPU anyway */
+    if (!directStorageQueue_ || bufferD3D.IsDirectlyMapped())
+        return RenderSystem::StreamBufferFromFile(buffer, offset, fileRegion, fence);
+
+    TransitionForDirectStorage(bufferD3D.GetResource());
+
+    if (!directStorageQueue_->EnqueueBufferRequest(bufferD3D.GetNative(), offset, fileRegion))
+        return false;
+
+    SubmitDirectStorageRequests(fence);
+    return true;
+}
+
+bool D3D12RenderSystem::StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    if (!directStorageQueue_)
+        return RenderSystem::StreamTextureFromFile(texture, textureRegion, fileRegion, fence);
+
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+
+    /* Determine tightly packed layout of the source data for each array layer */
+    const D3D12_BOX         region          = textureD3D.CalcRegion(textureRegion.offset, textureRegion.extent);
+    const FormatAttributes& formatAttribs   = GetFormatAttribs(textureD3D.GetFormat());
+    const UINT              numBlocksX      = (region.right  - region.left + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const UINT              numBlocksY      = (region.bottom - region.top  + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+    const UINT              rowPitch        = numBlocksX * formatAttribs.bitSize / 8;
+    const UINT              layerSize       = rowPitch * numBlocksY * (region.back - region.front);
+
+    /* DirectStorage expects rows with the same alignment as texture copies; uncompressed data with other row pitches can still be written by the CPU */
+    const TextureSubresource& subresource = textureRegion.subresource;
+    const bool isCompressed = (fileRegion.compression != FileStreamCompression::Uncompressed);
+
+    if (rowPitch % D3D12_TEXTURE_DATA_PITCH_ALIGNMENT != 0)
+    {
+        if (!isCompressed)
+            return RenderSystem::StreamTextureFromFile(texture, textureRegion, fileRegion, fence);
+        Log::Errorf("cannot stream compressed texture region with row pitch of %u bytes; must be a multiple of %u\n", rowPitch, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+        return false;
+    }
+
+    if (isCompressed && subresource.numArrayLayers != 1)
+    {
+        Log::Errorf("cannot stream compressed texture region into %u array layers; must be a single array layer\n", subresource.numArrayLayers);
+        return false;
+    }
+
+    const UINT uncompressedSize = (fileRegion.uncompressedSize != 0 ? fileRegion.uncompressedSize : fileRegion.size);
+    if (uncompressedSize != layerSize * subresource.numArrayLayers)
+    {
+        Log::Errorf("size mismatch of file region for texture: %u specified, but %u expected\n", uncompressedSize, layerSize * subresource.numArrayLayers);
+        return false;
+    }
+
+    TransitionForDirectStorage(textureD3D.GetResource());
+
+    /* Enqueue one request per array layer, since each DirectStorage request covers a single subresource */
+    FileStreamRegion layerRegion = fileRegion;
+    if (!isCompressed)
+    {
+        layerRegion.size                = layerSize;
+        layerRegion.uncompressedSize    = 0;
+    }
+
+    for_range(arrayLayer, subresource.numArrayLayers)
+    {
+        const UINT subresourceIndex = textureD3D.CalcSubresource(subresource.baseMipLevel, subresource.baseArrayLayer + arrayLayer);
+        if (!directStorageQueue_->EnqueueTextureRequest(textureD3D.GetNative(), subresourceIndex, region, layerRegion))
+            return false;
+        layerRegion.offset += layerSize;
+    }
+
+    SubmitDirectStorageRequests(fence);
+    return true;
+}
+
+#endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
 
 /*
  * ======= Internal: =======
@@ -473,6 +778,10 @@ ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(
 
 void D3D12RenderSystem::SyncGPU()
 {
+    if (computeCommandQueue_)
+        computeCommandQueue_->WaitIdle();
+    if (copyCommandQueue_)
+        copyCommandQueue_->WaitIdle();
     commandQueue_->WaitIdle();
 }
 
@@ -726,6 +1035,78 @@ static std::uint32_t GetMaxRenderTargets(D3D_FEATURE_LEVEL featureLevel)
     else                                        return 1;
 }
 
+static bool IsMeshShaderSupported(ID3D12Device* device)
+{
+    #ifdef LLGL_D3D12_MESH_SHADERS
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    return
+    (
+        SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7))) &&
+        options7.MeshShaderTier >= D3D12_MESH_SHADER_TIER_1
+    );
+    #else
+    return false;
+    #endif
+}
+
+static bool IsDynamicDepthBiasSupported(ID3D12Device* device)
+{
+    #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+    D3D12_FEATURE_DATA_D3D12_OPTIONS16 options16 = {};
+    return
+    (
+        SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &options16, sizeof(options16))) &&
+        options16.DynamicDepthBiasSupported != FALSE
+    );
+    #else
+    return false;
+    #endif
+}
+
+// Returns the variable rate shading tier (0 if unsupported) and the screen-space tile size of shading-rate images.
+static int GetVariableShadingRateTier(ID3D12Device* device, std::uint32_t& outShadingRateImageTileSize)
+{
+    outShadingRateImageTileSize = 0;
+    #ifdef LLGL_D3D12_VARIABLE_RATE_SHADING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))))
+    {
+        if (options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2)
+        {
+            outShadingRateImageTileSize = options6.ShadingRateImageTileSize;
+            return 2;
+        }
+        if (options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1)
+            return 1;
+    }
+    #endif
+    return 0;
+}
+
+static bool IsViewInstancingSupported(ID3D12Device* device)
+{
+    #ifdef LLGL_D3D12_VIEW_INSTANCING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS3 options3 = {};
+    return
+    (
+        SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &options3, sizeof(options3))) &&
+        options3.ViewInstancingTier >= D3D12_VIEW_INSTANCING_TIER_1
+    );
+    #else
+    return false;
+    #endif
+}
+
+static bool IsTiledResourceSupported(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    return
+    (
+        SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))) &&
+        options.TiledResourcesTier != D3D12_TILED_RESOURCES_TIER_NOT_SUPPORTED
+    );
+}
+
 void D3D12RenderSystem::QueryRenderingCaps()
 {
     RenderingCapabilities caps;
@@ -734,6 +1115,12 @@ void D3D12RenderSystem::QueryRenderingCaps()
         //const int minorVersion = GetMinorVersion();
 
         const std::uint32_t maxThreadGroups = 65535u;
+        const bool hasMeshShaders = IsMeshShaderSupported(device_.GetNative());
+        const bool hasSparseTextures = IsTiledResourceSupported(device_.GetNative());
+        const bool hasMultiview = IsViewInstancingSupported(device_.GetNative());
+
+        std::uint32_t shadingRateImageTileSize = 0;
+        const int shadingRateTier = GetVariableShadingRateTier(device_.GetNative(), shadingRateImageTileSize);
 
         /* Query common attributes */
         caps.screenOrigin                               = ScreenOrigin::UpperLeft;
@@ -767,6 +1154,18 @@ void D3D12RenderSystem::QueryRenderingCaps()
         caps.features.hasPipelineCaching                = true;
         caps.features.hasPipelineStatistics             = true;
         caps.features.hasRenderCondition                = true;
+        caps.features.hasIndirectDrawingCount           = true;
+        caps.features.hasMeshShaders                    = hasMeshShaders;
+        caps.features.hasSparseTextures                 = hasSparseTextures;
+        caps.features.hasQueryResolve                   = true;
+        caps.features.hasConcurrentResourceCreation     = true;
+        caps.features.hasTextureMinLODClamp             = true;
+        caps.features.hasVariableRateShading            = (shadingRateTier >= 1);
+        caps.features.hasShadingRateImage               = (shadingRateTier >= 2);
+        caps.features.hasMultiview                      = hasMultiview;
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        caps.features.hasFileStreamDecompression        = (directStorageQueue_ != nullptr);
+        #endif
 
         /* Query limits */
         caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -799,6 +1198,16 @@ void D3D12RenderSystem::QueryRenderingCaps()
         caps.limits.maxDepthBufferSamples               = device_.FindSuitableSampleDesc(DXGI_FORMAT_D32_FLOAT).Count;
         caps.limits.maxStencilBufferSamples             = device_.FindSuitableSampleDesc(DXGI_FORMAT_D32_FLOAT_S8X24_UINT).Count;
         caps.limits.maxNoAttachmentSamples              = D3D12_MAX_MULTISAMPLE_SAMPLE_COUNT;
+        caps.limits.maxMeshShaderWorkGroups[0]          = (hasMeshShaders ? maxThreadGroups : 0u);
+        caps.limits.maxMeshShaderWorkGroups[1]          = (hasMeshShaders ? maxThreadGroups : 0u);
+        caps.limits.maxMeshShaderWorkGroups[2]          = (hasMeshShaders ? maxThreadGroups : 0u);
+        caps.limits.dynamicStates                       = DynamicStateFlags::PrimitiveTopology;
+
+        caps.limits.shadingRateImageTileSize            = shadingRateImageTileSize;
+        caps.limits.maxMultiviewViews                   = (hasMultiview ? D3D12_MAX_VIEW_INSTANCE_COUNT : 0u);
+
+        if (IsDynamicDepthBiasSupported(device_.GetNative()))
+            caps.limits.dynamicStates |= DynamicStateFlags::DepthBias;
     }
     SetRenderingCaps(caps);
 }
@@ -808,6 +1217,28 @@ void D3D12RenderSystem::ExecuteCommandListAndSync()
     commandContext_->FinishAndSync(*commandQueue_);
 }
 
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+void D3D12RenderSystem::TransitionForDirectStorage(D3D12Resource& resource)
+{
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
+    commandContext_->TransitionResource(resource, D3D12_RESOURCE_STATE_COMMON, true);
+    ExecuteCommandListAndSync();
+}
+
+void D3D12RenderSystem::SubmitDirectStorageRequests(Fence* fence)
+{
+    if (fence != nullptr)
+    {
+        auto& fenceD3D = LLGL_CAST(D3D12Fence&, *fence);
+        directStorageQueue_->Submit(commandQueue_->GetNative(), fenceD3D.GetNative(), fenceD3D.Signal());
+    }
+    else
+        directStorageQueue_->Submit(commandQueue_->GetNative());
+}
+
+#endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
 void D3D12RenderSystem::UpdateBufferAndSync(
     D3D12Buffer&    bufferD3D,
     std::uint64_t   offset,
@@ -815,15 +1246,27 @@ void D3D12RenderSystem::UpdateBufferAndSync(
     std::uint64_t   dataSize,
     std::uint64_t   alignment)
 {
-    stagingBufferPool_.WriteImmediate(*commandContext_, bufferD3D.GetResource(), offset, data, dataSize, alignment);
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
+    commandContext_->GetStagingBufferPool().WriteStaged(*commandContext_, bufferD3D.GetResource(), offset, data, dataSize, alignment);
     ExecuteCommandListAndSync();
 }
 
+void D3D12RenderSystem::ReleaseTexture(D3D12Texture& textureD3D)
+{
+    if (textureD3D.IsTransient())
+        transientHeapPool_.ReleaseHeap(textureD3D.GetAliasingGroup());
+    if (textureD3D.IsSparse())
+        textureD3D.ReleaseTiles(tileHeapPool_);
+    textures_.erase(&textureD3D);
+}
+
 void* D3D12RenderSystem::MapBufferRange(D3D12Buffer& bufferD3D, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     void* mappedData = nullptr;
     const D3D12_RANGE range{ static_cast<SIZE_T>(offset), static_cast<SIZE_T>(offset + length) };
 
+    std::lock_guard<std::mutex> guard{ commandContextMutex_ };
+
     if (SUCCEEDED(bufferD3D.Map(*commandContext_, *commandQueue_, range, &mappedData, access)))
         return mappedData;
 
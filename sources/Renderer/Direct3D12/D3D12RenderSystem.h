@@ -14,17 +14,19 @@
 #include "D3D12Device.h"
 #include "D3D12SwapChain.h"
 #include "Command/D3D12CommandQueue.h"
+#include "Command/D3D12DeferredReleaseQueue.h"
 #include "Command/D3D12CommandBuffer.h"
 #include "Command/D3D12CommandContext.h"
 #include "Command/D3D12SignatureFactory.h"
 
 #include "Buffer/D3D12Buffer.h"
 #include "Buffer/D3D12BufferArray.h"
-#include "Buffer/D3D12StagingBufferPool.h"
 
 #include "Texture/D3D12Texture.h"
 #include "Texture/D3D12Sampler.h"
 #include "Texture/D3D12RenderTarget.h"
+#include "Texture/D3D12TransientHeapPool.h"
+#include "Texture/D3D12TileHeapPool.h"
 
 #include "RenderState/D3D12Fence.h"
 #include "RenderState/D3D12PipelineCache.h"
@@ -36,11 +38,17 @@
 
 #include "Shader/D3D12Shader.h"
 
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+#   include "DirectStorage/D3D12DirectStorageQueue.h"
+#endif
+
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
+#include "../PersistentPipelineCache.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_5.h>
+#include <mutex>
 
 
 namespace LLGL
@@ -67,6 +75,15 @@ class D3D12RenderSystem final : public RenderSystem
         D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~D3D12RenderSystem();
 
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        bool StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence = nullptr) override;
+        bool StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence = nullptr) override;
+        #endif
+
     public:
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(
@@ -119,6 +136,18 @@ class D3D12RenderSystem final : public RenderSystem
             return tearingSupported_;
         }
 
+        // Returns the queue for deferred resource releases or null if RenderSystemFlags::DeferredRelease was not specified.
+        inline D3D12DeferredReleaseQueue* GetDeferredReleaseQueue() const
+        {
+            return deferredReleaseQueue_.get();
+        }
+
+        // Returns the persistent pipeline cache or null if RenderSystemDescriptor::pipelineCacheFilename was not specified.
+        inline PersistentPipelineCache* GetPersistentPipelineCache() const
+        {
+            return persistentPipelineCache_.get();
+        }
+
     private:
 
         void EnableDebugLayer();
@@ -146,6 +175,9 @@ class D3D12RenderSystem final : public RenderSystem
             std::uint64_t   alignment   = 256u
         );
 
+        // Releases the specified texture and its heap memory immediately.
+        void ReleaseTexture(D3D12Texture& textureD3D);
+
         // Maps the range of the specified D3D buffer between GPU and CPU memory space.
         void* MapBufferRange(D3D12Buffer& bufferD3D, const CPUAccess access, std::uint64_t offset, std::uint64_t length);
 
@@ -161,6 +193,17 @@ class D3D12RenderSystem final : public RenderSystem
 
         bool CheckFactoryFeatureSupport(DXGI_FEATURE feature) const;
 
+        // Returns true if a buffer of the specified size can be placed in a GPU upload heap without exceeding the local video memory budget.
+        bool HasGpuUploadHeapBudget(std::uint64_t size) const;
+
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        // Transitions the specified resource into the common state that DirectStorage requires for its destinations and waits for the GPU.
+        void TransitionForDirectStorage(D3D12Resource& resource);
+
+        // Submits all DirectStorage requests and orders the primary command queue after them.
+        void SubmitDirectStorageRequests(Fence* fence);
+        #endif
+
     private:
 
         /* ----- Common objects ----- */
@@ -168,15 +211,26 @@ class D3D12RenderSystem final : public RenderSystem
         ComPtr<IDXGIFactory4>                   factory_;
         D3D12Device                             device_;
         D3D12CommandContext*                    commandContext_         = nullptr;
+        std::mutex                              commandContextMutex_;   // Serializes all uploads and readbacks with the internal command context
         D3D12PipelineLayout                     defaultPipelineLayout_;
         D3D12SignatureFactory                   cmdSignatureFactory_;
-        D3D12StagingBufferPool                  stagingBufferPool_;
+        D3D12TransientHeapPool                  transientHeapPool_;
+        D3D12TileHeapPool                       tileHeapPool_;
+        D3D12SamplerPool                        samplerPool_;
         bool                                    tearingSupported_       = false;
+        bool                                    gpuUploadHeapSupported_ = false;
+        std::unique_ptr<PersistentPipelineCache> persistentPipelineCache_;
+        std::unique_ptr<D3D12DeferredReleaseQueue> deferredReleaseQueue_;   // Only created with RenderSystemFlags::DeferredRelease
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        std::unique_ptr<D3D12DirectStorageQueue> directStorageQueue_;       // Null if the DirectStorage runtime is not available
+        #endif
 
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<D3D12SwapChain>       swapChains_;
         HWObjectInstance<D3D12CommandQueue>     commandQueue_;
+        HWObjectInstance<D3D12CommandQueue>     computeCommandQueue_;   // Created on demand.
+        HWObjectInstance<D3D12CommandQueue>     copyCommandQueue_;      // Created on demand.
         HWObjectContainer<D3D12CommandBuffer>   commandBuffers_;
         HWObjectContainer<D3D12Buffer>          buffers_;
         HWObjectContainer<D3D12BufferArray>     bufferArrays_;
@@ -0,0 +1,71 @@
+/*
+ * D3D12Resource.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12Resource.h"
+
+
+namespace LLGL
+{
+
+
+bool D3D12SetResidencyPriority(D3D12Resource& resource, D3D12_RESIDENCY_PRIORITY priority)
+{
+    if (resource.Get() == nullptr || resource.aliasingHeap != nullptr)
+        return false;
+
+    /* ID3D12Device1 is required for residency priorities (since Windows 10 Fall Creators Update) */
+    ComPtr<ID3D12Device1> device1;
+    if (FAILED(resource.Get()->GetDevice(IID_PPV_ARGS(device1.GetAddressOf()))))
+        return false;
+
+    ID3D12Pageable* pageable = resource.Get();
+    return SUCCEEDED(device1->SetResidencyPriority(1, &pageable, &priority));
+}
+
+bool D3D12EvictResource(D3D12Resource& resource)
+{
+    if (resource.Get() == nullptr || resource.aliasingHeap != nullptr)
+        return false;
+
+    /* Eviction is reference counted in D3D12, so only evict the resource once */
+    if (!resource.evicted)
+    {
+        ComPtr<ID3D12Device> device;
+        resource.Get()->GetDevice(IID_PPV_ARGS(device.GetAddressOf()));
+
+        ID3D12Pageable* pageable = resource.Get();
+        if (FAILED(device->Evict(1, &pageable)))
+            return false;
+
+        resource.evicted = true;
+    }
+
+    return true;
+}
+
+bool D3D12MakeResourceResident(D3D12Resource& resource)
+{
+    if (resource.evicted)
+    {
+        ComPtr<ID3D12Device> device;
+        resource.Get()->GetDevice(IID_PPV_ARGS(device.GetAddressOf()));
+
+        ID3D12Pageable* pageable = resource.Get();
+        if (FAILED(device->MakeResident(1, &pageable)))
+            return false;
+
+        resource.evicted = false;
+    }
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -12,13 +12,17 @@
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <utility>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
-// Helper struct to store a D3D12 resource with its usage state and transition state.
+/*
+Helper struct to store a D3D12 resource with its usage state and transition state.
+Subresources of textures can be transitioned individually once EnableSubresourceTracking has been called (see D3D12CommandContext::TransitionSubresource).
+*/
 struct D3D12Resource
 {
     D3D12Resource() = default;
@@ -35,6 +39,7 @@ struct D3D12Resource
     {
         usageState      = initialState;
         currentState    = initialState;
+        subresourceStates.clear();
     }
 
     // Sets the resource state for common usage and the initial state individually and returns the initial state.
@@ -42,21 +47,57 @@ struct D3D12Resource
     {
         usageState    = usage;
         currentState  = initial;
+        subresourceStates.clear();
         return initial;
     }
 
+    // Enables individual state tracking for all subresources of a single-planar texture with the specified number of MIP-map levels and array layers.
+    inline void EnableSubresourceTracking(UINT mipLevels, UINT arrayLayers)
+    {
+        numMipLevels    = mipLevels;
+        numSubresources = mipLevels * arrayLayers;
+    }
+
+    // Returns true if the specified subresource index can be transitioned individually.
+    inline bool IsSubresourceTracked(UINT subresource) const
+    {
+        return (subresource < numSubresources);
+    }
+
+    // Returns the current state of the specified subresource or the state of the entire resource if the subresource is not tracked individually.
+    inline D3D12_RESOURCE_STATES GetSubresourceState(UINT subresource) const
+    {
+        return (IsSubresourceTracked(subresource) && !subresourceStates.empty() ? subresourceStates[subresource] : currentState);
+    }
+
     // Returns the native resource object.
     inline ID3D12Resource* Get() const
     {
         return native.Get();
     }
 
-    ComPtr<ID3D12Resource>  native;
-    D3D12_RESOURCE_STATES   usageState      = D3D12_RESOURCE_STATE_COMMON;
-    D3D12_RESOURCE_STATES   currentState    = D3D12_RESOURCE_STATE_COMMON;
+    ComPtr<ID3D12Resource>              native;
+    D3D12_RESOURCE_STATES               usageState          = D3D12_RESOURCE_STATE_COMMON;
+    D3D12_RESOURCE_STATES               currentState        = D3D12_RESOURCE_STATE_COMMON;  // State of all subresources; Only valid if 'subresourceStates' is empty.
+    UINT                                numMipLevels        = 0;
+    UINT                                numSubresources     = 0;                            // Number of individually tracked subresources; 0 if only the entire resource is tracked.
+    std::vector<D3D12_RESOURCE_STATES>  subresourceStates;                                  // Individual subresource states; Empty if all subresources are in 'currentState'.
+    UINT                                numSplitBarriers    = 0;                            // Number of split barriers that have begun but not ended yet.
+    ID3D12Heap*                         aliasingHeap        = nullptr;                      // Heap this resource is placed in and aliased with other resources; Null for committed resources.
+    bool                                evicted             = false;                        // True if this resource has been evicted with ID3D12Device::Evict.
 };
 
 
+// Sets the residency priority of the specified committed resource. Returns false if ID3D12Device1 is not available.
+bool D3D12SetResidencyPriority(D3D12Resource& resource, D3D12_RESIDENCY_PRIORITY priority);
+
+// Evicts the specified committed resource. Returns false for placed resources, since their residency is managed by their heap.
+bool D3D12EvictResource(D3D12Resource& resource);
+
+// Makes the specified resource resident again if it has been evicted. Blocks until the resource has been paged in.
+bool D3D12MakeResourceResident(D3D12Resource& resource);
+
+
 } // /namespace LLGL
 
 
@@ -15,6 +15,7 @@
 #include "RenderState/D3D12DescriptorHeap.h"
 #include "../CheckedCast.h"
 #include "../../Core/CoreUtils.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include "../DXCommon/DXTypes.h"
 
 #include <LLGL/Platform/NativeHandle.h>
@@ -38,6 +39,9 @@ D3D12SwapChain::D3D12SwapChain(
     depthStencilFormat_ { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits)      },
     frameFence_         { renderSystem.GetDXDevice()                                      },
     numColorBuffers_    { Clamp(desc.swapBuffers, 1u, D3D12SwapChain::maxNumColorBuffers) },
+    numFramesInFlight_  { (desc.framesInFlight > 0 ? std::min(desc.framesInFlight, numColorBuffers_) : numColorBuffers_) },
+    maxFrameLatency_    { (desc.lowLatency ? (desc.framesInFlight > 0 ? numFramesInFlight_ : 1u) : 0u) },
+    presentMode_        { desc.presentMode                                                },
     tearingSupported_   { renderSystem.IsTearingSupported()                               }
 {
     /* Store reference to command queue */
@@ -61,6 +65,9 @@ D3D12SwapChain::~D3D12SwapChain()
 {
     /* Ensure the GPU is no longer referencing resources that are about to be released */
     MoveToNextFrame();
+
+    if (frameLatencyWaitableObject_ != nullptr)
+        ::CloseHandle(frameLatencyWaitableObject_);
 }
 
 void D3D12SwapChain::SetDebugName(const char* name)
@@ -103,15 +110,40 @@ void D3D12SwapChain::SetDebugName(const char* name)
 
 void D3D12SwapChain::Present()
 {
-    /* Present swap-chain with vsync interval */
-    const bool tearingEnabled   = (tearingSupported_ && windowedMode_ && syncInterval_ == 0);
-    const UINT presentFlags     = (tearingEnabled ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+    PresentWithDamage(0, nullptr);
+}
+
+void D3D12SwapChain::PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+    /* Present swap-chain with vsync interval and present mode */
+    UINT syncInterval = 0, presentFlags = 0;
+    DXGetPresentParams(presentMode_, syncInterval_, (tearingSupported_ && windowedMode_), syncInterval, presentFlags);
+
+    HRESULT hr = S_OK;
+    if (numDamageRects > 0 && damageRects != nullptr)
+    {
+        /* Present only dirty rectangles; flip-model swap-chains only copy these regions into the next back buffer */
+        DXConvertDirtyRects(numDamageRects, damageRects, GetResolution(), dirtyRects_);
+        DXGI_PRESENT_PARAMETERS presentParams = {};
+        {
+            presentParams.DirtyRectsCount   = static_cast<UINT>(dirtyRects_.size());
+            presentParams.pDirtyRects       = dirtyRects_.data();
+        }
+        hr = swapChainDXGI_->Present1(syncInterval, presentFlags, &presentParams);
+    }
+    else
+        hr = swapChainDXGI_->Present(syncInterval, presentFlags);
 
-    HRESULT hr = swapChainDXGI_->Present(syncInterval_, presentFlags);
     DXThrowIfFailed(hr, "failed to present DXGI swap chain");
 
     /* Advance frame counter */
     MoveToNextFrame();
+
+    /* Destroy resources whose release has been deferred until all frames that might use them have completed */
+    if (D3D12DeferredReleaseQueue* deferredReleaseQueue = renderSystem_.GetDeferredReleaseQueue())
+        deferredReleaseQueue->NextFrame(*commandQueue_);
 }
 
 std::uint32_t D3D12SwapChain::GetCurrentSwapIndex() const
@@ -149,6 +181,14 @@ bool D3D12SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return SetPresentSyncInterval(vsyncInterval);
 }
 
+bool D3D12SwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    /* Wait until DXGI has fewer than the maximum frame latency of presents queued */
+    if (frameLatencyWaitableObject_ != nullptr)
+        return DXWaitForFrameLatencyObject(frameLatencyWaitableObject_, timeout);
+    return true;
+}
+
 /* --- Extended functions --- */
 
 UINT D3D12SwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex) const
@@ -449,10 +489,20 @@ HRESULT D3D12SwapChain::CreateResolutionDependentResources(const Extent2D& resol
             swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
             swapChainDesc.AlphaMode             = DXGI_ALPHA_MODE_IGNORE;
             swapChainDesc.Flags                 = (tearingSupported_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u);
+            if (maxFrameLatency_ > 0)
+                swapChainDesc.Flags            |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
         }
         auto swapChain = renderSystem_.CreateDXSwapChain(swapChainDesc, &wndHandle, sizeof(wndHandle));
 
         swapChain.As(&swapChainDXGI_);
+
+        /* Limit queued presents and retrieve waitable object for low-latency mode; this object remains valid when the buffers are resized */
+        if (maxFrameLatency_ > 0)
+        {
+            HRESULT hr = swapChainDXGI_->SetMaximumFrameLatency(maxFrameLatency_);
+            DXThrowIfFailed(hr, "failed to set maximum frame latency of DXGI swap chain");
+            frameLatencyWaitableObject_ = swapChainDXGI_->GetFrameLatencyWaitableObject();
+        }
     }
 
     /* Store windowed mode for tearing support */
@@ -572,6 +622,10 @@ void D3D12SwapChain::MoveToNextFrame()
     /* Wait until the fence value of the next frame is signaled, so we know the next frame is ready to start */
     frameFence_.WaitForHigherSignal(frameFenceValues_[currentColorBuffer_]);
     frameFenceValues_[currentColorBuffer_] = currentFenceValue + 1;
+
+    /* Fence values increase by one per frame, so wait for an earlier frame if fewer frames in flight than swap buffers are requested */
+    if (numFramesInFlight_ < numColorBuffers_ && currentFenceValue + 1 > numFramesInFlight_)
+        frameFence_.WaitForHigherSignal(currentFenceValue + 1 - numFramesInFlight_);
 }
 
 void D3D12SwapChain::StoreDebugNames(std::string (&debugNames)[D3D12SwapChain::numDebugNames])
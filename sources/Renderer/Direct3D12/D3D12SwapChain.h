@@ -20,6 +20,7 @@
 
 #include <d3d12.h>
 #include <dxgi1_4.h>
+#include <vector>
 
 
 namespace LLGL
@@ -39,6 +40,7 @@ class D3D12SwapChain final : public SwapChain
         void SetDebugName(const char* name) override;
 
         void Present() override;
+        void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
 
         std::uint32_t GetCurrentSwapIndex() const override;
         std::uint32_t GetNumSwapBuffers() const override;
@@ -51,6 +53,8 @@ class D3D12SwapChain final : public SwapChain
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
     public:
 
         D3D12SwapChain(
@@ -114,6 +118,7 @@ class D3D12SwapChain final : public SwapChain
         D3D12RenderPass                 defaultRenderPass_;
 
         ComPtr<IDXGISwapChain3>         swapChainDXGI_;
+        std::vector<RECT>               dirtyRects_;                                    // Dirty rectangles for IDXGISwapChain1::Present1; kept to avoid reallocation.
         DXGI_SAMPLE_DESC                sampleDesc_                             = { 1, 0 };
         UINT                            syncInterval_                           = 0;
 
@@ -132,8 +137,13 @@ class D3D12SwapChain final : public SwapChain
         D3D12NativeFence                frameFence_;
 
         UINT                            numColorBuffers_                        = 0;
+        UINT                            numFramesInFlight_                      = 0;
         UINT                            currentColorBuffer_                     = 0;
 
+        UINT                            maxFrameLatency_                        = 0;        // Maximum frame latency for low-latency mode; 0 if disabled.
+        HANDLE                          frameLatencyWaitableObject_             = nullptr;
+        PresentMode                     presentMode_                            = PresentMode::Default;
+
         bool                            hasDebugName_                           = false;
         bool                            tearingSupported_                       = false;
         bool                            windowedMode_                           = false;
@@ -239,6 +239,72 @@ UINT Map(const TextureSwizzleRGBA& textureSwizzle)
     );
 }
 
+D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE Map(const AttachmentLoadOp loadOp)
+{
+    switch (loadOp)
+    {
+        case AttachmentLoadOp::Undefined:   return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD;
+        case AttachmentLoadOp::Load:        return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+        case AttachmentLoadOp::Clear:       return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR;
+    }
+    DXTypes::MapFailed("AttachmentLoadOp", "D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE");
+}
+
+D3D12_RENDER_PASS_ENDING_ACCESS_TYPE Map(const AttachmentStoreOp storeOp)
+{
+    switch (storeOp)
+    {
+        case AttachmentStoreOp::Undefined:  return D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD;
+        case AttachmentStoreOp::Store:      return D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+    }
+    DXTypes::MapFailed("AttachmentStoreOp", "D3D12_RENDER_PASS_ENDING_ACCESS_TYPE");
+}
+
+D3D12_RESIDENCY_PRIORITY Map(const ResidencyPriority priority)
+{
+    switch (priority)
+    {
+        case ResidencyPriority::Minimum:    return D3D12_RESIDENCY_PRIORITY_MINIMUM;
+        case ResidencyPriority::Low:        return D3D12_RESIDENCY_PRIORITY_LOW;
+        case ResidencyPriority::Normal:     return D3D12_RESIDENCY_PRIORITY_NORMAL;
+        case ResidencyPriority::High:       return D3D12_RESIDENCY_PRIORITY_HIGH;
+        case ResidencyPriority::Maximum:    return D3D12_RESIDENCY_PRIORITY_MAXIMUM;
+    }
+    DXTypes::MapFailed("ResidencyPriority", "D3D12_RESIDENCY_PRIORITY");
+}
+
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+
+D3D12_SHADING_RATE Map(const ShadingRate shadingRate)
+{
+    switch (shadingRate)
+    {
+        case ShadingRate::Rate1x1:  return D3D12_SHADING_RATE_1X1;
+        case ShadingRate::Rate1x2:  return D3D12_SHADING_RATE_1X2;
+        case ShadingRate::Rate2x1:  return D3D12_SHADING_RATE_2X1;
+        case ShadingRate::Rate2x2:  return D3D12_SHADING_RATE_2X2;
+        case ShadingRate::Rate2x4:  return D3D12_SHADING_RATE_2X4;
+        case ShadingRate::Rate4x2:  return D3D12_SHADING_RATE_4X2;
+        case ShadingRate::Rate4x4:  return D3D12_SHADING_RATE_4X4;
+    }
+    DXTypes::MapFailed("ShadingRate", "D3D12_SHADING_RATE");
+}
+
+D3D12_SHADING_RATE_COMBINER Map(const ShadingRateCombiner combiner)
+{
+    switch (combiner)
+    {
+        case ShadingRateCombiner::Passthrough:  return D3D12_SHADING_RATE_COMBINER_PASSTHROUGH;
+        case ShadingRateCombiner::Override:     return D3D12_SHADING_RATE_COMBINER_OVERRIDE;
+        case ShadingRateCombiner::Min:          return D3D12_SHADING_RATE_COMBINER_MIN;
+        case ShadingRateCombiner::Max:          return D3D12_SHADING_RATE_COMBINER_MAX;
+        case ShadingRateCombiner::Sum:          return D3D12_SHADING_RATE_COMBINER_SUM;
+    }
+    DXTypes::MapFailed("ShadingRateCombiner", "D3D12_SHADING_RATE_COMBINER");
+}
+
+#endif // /__ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+
 D3D12_SRV_DIMENSION MapSrvDimension(const TextureType textureType)
 {
     switch (textureType)
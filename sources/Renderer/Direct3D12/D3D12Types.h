@@ -15,6 +15,8 @@
 #include <LLGL/TextureFlags.h>
 #include <LLGL/SamplerFlags.h>
 #include <LLGL/QueryHeapFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/ResourceFlags.h>
 #include <d3d12.h>
 #include "../DXCommon/DXTypes.h"
 
@@ -38,6 +40,16 @@ D3D12_LOGIC_OP                  Map( const LogicOp              logicOp
 D3D12_SHADER_COMPONENT_MAPPING  Map( const TextureSwizzle       textureSwizzle  );
 UINT                            Map( const TextureSwizzleRGBA&  textureSwizzle  );
 
+D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE Map( const AttachmentLoadOp     loadOp  );
+D3D12_RENDER_PASS_ENDING_ACCESS_TYPE    Map( const AttachmentStoreOp    storeOp );
+
+D3D12_RESIDENCY_PRIORITY        Map( const ResidencyPriority    priority        );
+
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+D3D12_SHADING_RATE              Map( const ShadingRate          shadingRate     );
+D3D12_SHADING_RATE_COMBINER     Map( const ShadingRateCombiner  combiner        );
+#endif
+
 D3D12_SRV_DIMENSION             MapSrvDimension     ( const TextureType textureType );
 D3D12_UAV_DIMENSION             MapUavDimension     ( const TextureType textureType );
 D3D12_RESOURCE_DIMENSION        MapResourceDimension( const TextureType textureType );
@@ -0,0 +1,186 @@
+/*
+ * D3D12DirectStorageQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12DirectStorageQueue.h"
+#include "../../../Platform/Module.h"
+#include "../../DXCommon/DXCore.h"
+#include <LLGL/Container/UTF8String.h>
+#include <LLGL/Log.h>
+
+
+namespace LLGL
+{
+
+
+// Function signature of DStorageGetFactory in dstorage.dll
+typedef HRESULT (WINAPI *PFN_DSTORAGE_GET_FACTORY)(REFIID riid, void** ppv);
+
+D3D12DirectStorageQueue::D3D12DirectStorageQueue(
+    ID3D12Device*               device,
+    std::unique_ptr<Module>&&   module,
+    ComPtr<IDStorageFactory>&&  factory,
+    ComPtr<IDStorageQueue>&&    queue)
+:
+    module_  { std::move(module)  },
+    factory_ { std::move(factory) },
+    queue_   { std::move(queue)   },
+    fence_   { device             }
+{
+}
+
+D3D12DirectStorageQueue::~D3D12DirectStorageQueue()
+{
+    WaitIdle();
+}
+
+std::unique_ptr<D3D12DirectStorageQueue> D3D12DirectStorageQueue::Create(ID3D12Device* device)
+{
+    /* Load DirectStorage runtime; it is redistributed with the application and not part of the OS */
+    std::unique_ptr<Module> module = Module::Load("dstorage.dll");
+    if (!module)
+        return nullptr;
+
+    auto dstorageGetFactory = reinterpret_cast<PFN_DSTORAGE_GET_FACTORY>(module->LoadProcedure("DStorageGetFactory"));
+    if (dstorageGetFactory == nullptr)
+        return nullptr;
+
+    ComPtr<IDStorageFactory> factory;
+    HRESULT hr = dstorageGetFactory(IID_PPV_ARGS(factory.GetAddressOf()));
+    if (FAILED(hr))
+        return nullptr;
+
+    /* Create queue for file sources with maximum capacity */
+    DSTORAGE_QUEUE_DESC queueDesc = {};
+    {
+        queueDesc.SourceType    = DSTORAGE_REQUEST_SOURCE_FILE;
+        queueDesc.Capacity      = DSTORAGE_MAX_QUEUE_CAPACITY;
+        queueDesc.Priority      = DSTORAGE_PRIORITY_NORMAL;
+        queueDesc.Name          = "LLGL.DirectStorageQueue";
+        queueDesc.Device        = device;
+    }
+    ComPtr<IDStorageQueue> queue;
+    hr = factory->CreateQueue(&queueDesc, IID_PPV_ARGS(queue.GetAddressOf()));
+    if (FAILED(hr))
+        return nullptr;
+
+    return std::unique_ptr<D3D12DirectStorageQueue>(
+        new D3D12DirectStorageQueue{ device, std::move(module), std::move(factory), std::move(queue) }
+    );
+}
+
+bool D3D12DirectStorageQueue::EnqueueBufferRequest(ID3D12Resource* resource, UINT64 offset, const FileStreamRegion& fileRegion)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    DSTORAGE_REQUEST request = {};
+    if (!InitFileSource(request, fileRegion))
+        return false;
+
+    request.Options.DestinationType     = DSTORAGE_REQUEST_DESTINATION_BUFFER;
+    request.Destination.Buffer.Resource = resource;
+    request.Destination.Buffer.Offset   = offset;
+    request.Destination.Buffer.Size     = request.UncompressedSize;
+
+    queue_->EnqueueRequest(&request);
+    return true;
+}
+
+bool D3D12DirectStorageQueue::EnqueueTextureRequest(ID3D12Resource* resource, UINT subresource, const D3D12_BOX& region, const FileStreamRegion& fileRegion)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    DSTORAGE_REQUEST request = {};
+    if (!InitFileSource(request, fileRegion))
+        return false;
+
+    request.Options.DestinationType                 = DSTORAGE_REQUEST_DESTINATION_TEXTURE_REGION;
+    request.Destination.Texture.Resource            = resource;
+    request.Destination.Texture.SubresourceIndex    = subresource;
+    request.Destination.Texture.Region              = region;
+
+    queue_->EnqueueRequest(&request);
+    return true;
+}
+
+void D3D12DirectStorageQueue::Submit(ID3D12CommandQueue* waitingQueue, ID3D12Fence* fence, UINT64 fenceValue)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Signal optional user fence before the internal fence, so waiting on the internal fence implies the user fence, then submit all requests at once */
+    if (fence != nullptr)
+        queue_->EnqueueSignal(fence, fenceValue);
+    ++fenceValue_;
+    queue_->EnqueueSignal(fence_.Get(), fenceValue_);
+    queue_->Submit();
+
+    /* Order all subsequent submissions of the waiting queue after these requests without blocking the CPU */
+    if (waitingQueue != nullptr)
+        waitingQueue->Wait(fence_.Get(), fenceValue_);
+}
+
+void D3D12DirectStorageQueue::WaitIdle()
+{
+    UINT64 fenceValue = 0;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        fenceValue = fenceValue_;
+    }
+    fence_.WaitForHigherSignal(fenceValue);
+
+    /* Report the first failure, since DirectStorage requests complete asynchronously and have no individual result */
+    DSTORAGE_ERROR_RECORD errorRecord = {};
+    queue_->RetrieveErrorRecord(&errorRecord);
+    if (errorRecord.FailureCount > 0)
+        Log::Errorf("%u DirectStorage request(s) failed; first failure: HRESULT = 0x%08X\n", errorRecord.FailureCount, static_cast<unsigned>(errorRecord.FirstFailure.HResult));
+}
+
+IDStorageFile* D3D12DirectStorageQueue::GetOrOpenFile(const char* filename)
+{
+    auto it = files_.find(filename);
+    if (it != files_.end())
+        return it->second.Get();
+
+    const SmallVector<wchar_t> filenameUTF16 = UTF8String{ filename }.to_utf16();
+
+    ComPtr<IDStorageFile> file;
+    HRESULT hr = factory_->OpenFile(filenameUTF16.data(), IID_PPV_ARGS(file.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        Log::Errorf("failed to open file for DirectStorage: %s\n", filename);
+        return nullptr;
+    }
+
+    IDStorageFile* fileRef = file.Get();
+    files_[filename] = std::move(file);
+    return fileRef;
+}
+
+bool D3D12DirectStorageQueue::InitFileSource(DSTORAGE_REQUEST& request, const FileStreamRegion& fileRegion)
+{
+    if (fileRegion.filename == nullptr)
+        return false;
+
+    IDStorageFile* file = GetOrOpenFile(fileRegion.filename);
+    if (file == nullptr)
+        return false;
+
+    request.Options.SourceType          = DSTORAGE_REQUEST_SOURCE_FILE;
+    request.Options.CompressionFormat   = (fileRegion.compression == FileStreamCompression::GDeflate ? DSTORAGE_COMPRESSION_FORMAT_GDEFLATE : DSTORAGE_COMPRESSION_FORMAT_NONE);
+    request.Source.File.Source          = file;
+    request.Source.File.Offset          = fileRegion.offset;
+    request.Source.File.Size            = fileRegion.size;
+    request.UncompressedSize            = (fileRegion.uncompressedSize != 0 ? fileRegion.uncompressedSize : fileRegion.size);
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,98 @@
+/*
+ * D3D12DirectStorageQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_DIRECT_STORAGE_QUEUE_H
+#define LLGL_D3D12_DIRECT_STORAGE_QUEUE_H
+
+
+#include <LLGL/RenderSystemFlags.h>
+#include "../RenderState/D3D12Fence.h"
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <dstorage.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class Module;
+
+/*
+Wrapper for a DirectStorage queue that streams file regions into D3D12 resources.
+GDeflate compressed regions are decompressed by DirectStorage, i.e. on the GPU if supported or on the CPU otherwise.
+Opened files are cached by filename until this queue is destroyed. This class is thread-safe.
+*/
+class D3D12DirectStorageQueue
+{
+
+    public:
+
+        D3D12DirectStorageQueue(const D3D12DirectStorageQueue&) = delete;
+        D3D12DirectStorageQueue& operator = (const D3D12DirectStorageQueue&) = delete;
+
+        // Waits for all pending requests and closes all files.
+        ~D3D12DirectStorageQueue();
+
+        // Loads dstorage.dll and creates a DirectStorage queue for the specified device. Returns null if the DirectStorage runtime is not available.
+        static std::unique_ptr<D3D12DirectStorageQueue> Create(ID3D12Device* device);
+
+        // Enqueues a request to read the specified file region into the buffer resource at the specified offset.
+        bool EnqueueBufferRequest(ID3D12Resource* resource, UINT64 offset, const FileStreamRegion& fileRegion);
+
+        // Enqueues a request to read the specified file region into the region of a single texture subresource.
+        bool EnqueueTextureRequest(ID3D12Resource* resource, UINT subresource, const D3D12_BOX& region, const FileStreamRegion& fileRegion);
+
+        /*
+        Submits all enqueued requests and makes the specified command queue wait on the GPU until they have completed.
+        The optional fence is signaled with the specified value once all requests have completed.
+        */
+        void Submit(ID3D12CommandQueue* waitingQueue, ID3D12Fence* fence = nullptr, UINT64 fenceValue = 0);
+
+        // Blocks the calling thread until all submitted requests have completed.
+        void WaitIdle();
+
+    private:
+
+        D3D12DirectStorageQueue(
+            ID3D12Device*               device,
+            std::unique_ptr<Module>&&   module,
+            ComPtr<IDStorageFactory>&&  factory,
+            ComPtr<IDStorageQueue>&&    queue
+        );
+
+        // Returns the cached file for the specified filename or opens it. Returns null if the file could not be opened.
+        IDStorageFile* GetOrOpenFile(const char* filename);
+
+        // Initializes the file source and compression options of the specified request.
+        bool InitFileSource(DSTORAGE_REQUEST& request, const FileStreamRegion& fileRegion);
+
+    private:
+
+        std::unique_ptr<Module>                                 module_;    // Module of dstorage.dll; must outlive all DirectStorage objects
+        ComPtr<IDStorageFactory>                                factory_;
+        ComPtr<IDStorageQueue>                                  queue_;
+        D3D12NativeFence                                        fence_;
+        UINT64                                                  fenceValue_ = 0;
+        std::unordered_map<std::string, ComPtr<IDStorageFile>>  files_;
+        std::mutex                                              mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
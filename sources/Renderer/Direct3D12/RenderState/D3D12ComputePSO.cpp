@@ -7,6 +7,7 @@
 
 #include "D3D12ComputePSO.h"
 #include "D3D12PipelineCache.h"
+#include "D3D12ObjectCache.h"
 #include "D3D12PipelineLayout.h"
 #include "../D3D12Device.h"
 #include "../Shader/D3D12Shader.h"
@@ -77,7 +78,7 @@ void D3D12ComputePSO::CreateNativePSO(
 ComPtr<ID3D12PipelineState> D3D12ComputePSO::CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const char* debugName)
 {
     ComPtr<ID3D12PipelineState> pipelineState;
-    HRESULT hr = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    HRESULT hr = D3D12ObjectCache::Get().CreateComputePipelineState(device, desc, pipelineState);
     if (FAILED(hr))
     {
         GetMutableReport().Errorf("Failed to create D3D12 compute pipelines state [%s] (HRESULT = %s)\n", debugName, DXErrorToStrOrHex(hr));
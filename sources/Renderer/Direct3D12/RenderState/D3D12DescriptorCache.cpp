@@ -38,6 +38,7 @@ void D3D12DescriptorCache::Create(
     device_ = device;
     descriptorHeaps_[g_dhIndexCbvSrvUav].Create(device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, std::max(g_dhMinCacheSizes[g_dhIndexCbvSrvUav], initialNumResources));
     descriptorHeaps_[g_dhIndexSampler  ].Create(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,     std::max(g_dhMinCacheSizes[g_dhIndexSampler  ], initialNumSamplers ));
+    samplerIDs_.assign(descriptorHeaps_[g_dhIndexSampler].GetSize(), 0);
 }
 
 void D3D12DescriptorCache::Reset(UINT numResources, UINT numSamplers)
@@ -54,6 +55,8 @@ void D3D12DescriptorCache::Reset(UINT numResources, UINT numSamplers)
     if (descriptorHeaps_[g_dhIndexSampler].GetSize() < numSamplers)
     {
         descriptorHeaps_[g_dhIndexSampler].Reset(numSamplers);
+        samplerIDs_.assign(numSamplers, 0);
+        ++samplerContentVersion_;
         dirtyBits_.descHeapSampler = 1;
     }
 }
@@ -81,9 +84,51 @@ void D3D12DescriptorCache::EmplaceDescriptor(Resource& resource, UINT location,
             break;
 
         case ResourceType::Sampler:
+        {
             LLGL_ASSERT(location < currentStrides_[g_dhIndexSampler]);
-            if (EmplaceSamplerDescriptor(LLGL_CAST(D3D12Sampler&, resource), descriptorHeaps_[g_dhIndexSampler].GetCpuHandleWithOffset(location), descRangeType))
+            auto& samplerD3D = LLGL_CAST(D3D12Sampler&, resource);
+            if (samplerIDs_[location] == samplerD3D.GetSharedID())
+            {
+                /* Identical sampler is already in place, but its descriptor table must be bound again */
                 dirtyBits_.descHeapSampler = 1;
+            }
+            else if (EmplaceSamplerDescriptor(samplerD3D, descriptorHeaps_[g_dhIndexSampler].GetCpuHandleWithOffset(location), descRangeType))
+            {
+                samplerIDs_[location] = samplerD3D.GetSharedID();
+                ++samplerContentVersion_;
+                dirtyBits_.descHeapSampler = 1;
+            }
+        }
+        break;
+
+        default:
+            break;
+    }
+}
+
+void D3D12DescriptorCache::EmplaceBufferViewDescriptor(
+    D3D12Buffer&                bufferD3D,
+    const BufferViewDescriptor& bufferViewDesc,
+    UINT                        location,
+    D3D12_DESCRIPTOR_RANGE_TYPE descRangeType)
+{
+    LLGL_ASSERT(location < currentStrides_[g_dhIndexCbvSrvUav]);
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = descriptorHeaps_[g_dhIndexCbvSrvUav].GetCpuHandleWithOffset(location);
+    switch (descRangeType)
+    {
+        case D3D12_DESCRIPTOR_RANGE_TYPE_SRV:
+            bufferD3D.CreateShaderResourceView(device_, cpuDescHandle, bufferViewDesc);
+            dirtyBits_.descHeapCbvSrvUav = 1;
+            break;
+
+        case D3D12_DESCRIPTOR_RANGE_TYPE_UAV:
+            bufferD3D.CreateUnorderedAccessView(device_, cpuDescHandle, bufferViewDesc);
+            dirtyBits_.descHeapCbvSrvUav = 1;
+            break;
+
+        case D3D12_DESCRIPTOR_RANGE_TYPE_CBV:
+            bufferD3D.CreateConstantBufferView(device_, cpuDescHandle, bufferViewDesc);
+            dirtyBits_.descHeapCbvSrvUav = 1;
             break;
 
         default:
@@ -106,7 +151,7 @@ D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushSamplerDescriptors(D3D12S
     if (dirtyBits_.descHeapSampler)
     {
         dirtyBits_.descHeapSampler = 0;
-        return descHeapPool.CopyDescriptors(descriptorHeaps_[g_dhIndexSampler].GetCpuHandleStart(), 0, currentStrides_[g_dhIndexSampler]);
+        return descHeapPool.CopyDescriptors(descriptorHeaps_[g_dhIndexSampler].GetCpuHandleStart(), 0, currentStrides_[g_dhIndexSampler], samplerContentVersion_);
     }
     return {};
 }
@@ -10,6 +10,9 @@
 
 
 #include "D3D12DescriptorHeap.h"
+#include <LLGL/BufferFlags.h>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
@@ -47,10 +50,16 @@ class D3D12DescriptorCache
         // Emplaces a descriptor into the cache for the specified resource.
         void EmplaceDescriptor(Resource& resource, UINT location, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
 
+        // Emplaces a descriptor into the cache for the specified buffer view.
+        void EmplaceBufferViewDescriptor(D3D12Buffer& bufferD3D, const BufferViewDescriptor& bufferViewDesc, UINT location, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
+
         // Flushes any invalidated CBV/SRV/UAV descriptors into the specified descriptor heap pools.
         D3D12_GPU_DESCRIPTOR_HANDLE FlushCbvSrvUavDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool);
 
-        // Flushes any invalidated sampler descriptors into the specified descriptor heap pools.
+        /*
+        Flushes any invalidated sampler descriptors into the specified descriptor heap pools.
+        Identical sampler tables are only copied once per frame, since samplers are tracked by their shared ID.
+        */
         D3D12_GPU_DESCRIPTOR_HANDLE FlushSamplerDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool);
 
         // Returns true if any cache entries are invalidated and need to be flushed again.
@@ -71,9 +80,12 @@ class D3D12DescriptorCache
 
     private:
 
-        ID3D12Device*       device_             = nullptr;
-        D3D12DescriptorHeap descriptorHeaps_[2];
-        UINT                currentStrides_[2]  = {};
+        ID3D12Device*               device_                 = nullptr;
+        D3D12DescriptorHeap         descriptorHeaps_[2];
+        UINT                        currentStrides_[2]      = {};
+
+        std::vector<std::uint64_t>  samplerIDs_;                    // Shared IDs of the samplers in the sampler descriptor heap.
+        std::uint64_t               samplerContentVersion_  = 1;    // Changes whenever a sampler descriptor is modified.
 
         struct
         {
@@ -12,11 +12,13 @@
 #include "../Shader/D3D12Shader.h"
 #include "D3D12RenderPass.h"
 #include "D3D12PipelineCache.h"
+#include "D3D12ObjectCache.h"
 #include "D3D12PipelineLayout.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/ByteBufferIterator.h"
@@ -42,8 +44,8 @@ D3D12GraphicsPSO::D3D12GraphicsPSO(
     D3D12PipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout }
 {
     /* Validate pointers and get D3D shader program */
-    if (desc.vertexShader == nullptr)
-        throw std::invalid_argument("cannot create D3D graphics pipeline without vertex shader");
+    if (desc.vertexShader == nullptr && desc.meshShader == nullptr)
+        throw std::invalid_argument("cannot create D3D graphics pipeline without vertex or mesh shader");
 
     /* Use either default render pass or from descriptor */
     const D3D12RenderPass* renderPassD3D = nullptr;
@@ -351,10 +353,12 @@ static D3D12_PRIMITIVE_TOPOLOGY_TYPE GetPrimitiveToplogyType(const PrimitiveTopo
     return D3D12_PRIMITIVE_TOPOLOGY_TYPE_UNDEFINED;
 }
 
-static D3D12_INPUT_LAYOUT_DESC GetD3DInputLayoutDesc(const Shader* vs)
+static D3D12_INPUT_LAYOUT_DESC GetD3DInputLayoutDesc(const GraphicsPipelineDescriptor& pipelineDesc)
 {
     D3D12_INPUT_LAYOUT_DESC desc = {};
-    LLGL_CAST(const D3D12Shader*, vs)->GetInputLayoutDesc(desc);
+    /* Vertex pulling fetches all attributes from storage buffers, so the input layout remains empty */
+    if (pipelineDesc.vertexStreams.empty())
+        LLGL_CAST(const D3D12Shader*, pipelineDesc.vertexShader)->GetInputLayoutDesc(desc);
     return desc;
 }
 
@@ -414,7 +418,7 @@ void D3D12GraphicsPSO::CreateNativePSO(
 
     /* Convert other states */
     const bool isStripTopology = IsPrimitiveTopologyStrip(desc.primitiveTopology);
-    stateDesc.InputLayout           = GetD3DInputLayoutDesc(desc.vertexShader);
+    stateDesc.InputLayout           = GetD3DInputLayoutDesc(desc);
     stateDesc.StreamOutput          = GetD3DStreamOutputDesc(desc.vertexShader, desc.geometryShader);
     stateDesc.IBStripCutValue       = (isStripTopology ? GetIndexFormatStripCutValue(desc.indexFormat) : D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_DISABLED);
     stateDesc.PrimitiveTopologyType = GetPrimitiveToplogyType(desc.primitiveTopology);
@@ -423,33 +427,54 @@ void D3D12GraphicsPSO::CreateNativePSO(
     stateDesc.SampleDesc.Count      = (renderPass != nullptr ? renderPass->GetSampleDesc().Count : 1);
     stateDesc.SampleDesc.Quality    = 0;
 
+    #ifdef LLGL_D3D12_DYNAMIC_DEPTH_BIAS
+    /* Exclude depth bias from the static states, so it can be set with ID3D12GraphicsCommandList9::RSSetDepthBias */
+    if ((desc.dynamicStates & DynamicStateFlags::DepthBias) != 0)
+        stateDesc.Flags |= D3D12_PIPELINE_STATE_FLAG_DYNAMIC_DEPTH_BIAS;
+    #endif
+
     /* Set PSO cache if specified */
     if (pipelineCache != nullptr)
         stateDesc.CachedPSO = pipelineCache->GetCachedPSO();
 
+    /* Multiview render passes require view instancing, which can only be specified with pipeline state streams */
+    const UINT viewMask = (renderPass != nullptr ? renderPass->GetViewMask() : 0);
+
     /* Create native PSO */
     ComPtr<ID3D12PipelineState> primaryPSO;
 
-    if (isStripTopology && desc.indexFormat == Format::Undefined)
+    if (desc.meshShader != nullptr)
+    {
+        /* Create mesh shader PSO; mesh pipelines have no index buffer, so no secondary PSO is needed */
+        primaryPSO = CreateNativeMeshPSOWithDesc(device, stateDesc, desc, viewMask);
+    }
+    else if (isStripTopology && desc.indexFormat == Format::Undefined)
     {
         /* Create primary PSO with 32-bit index cut off value */
-        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName, viewMask);
 
         /* Create secondary PSO with 16-bit index cut off value */
         stateDesc.IBStripCutValue   = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
         stateDesc.CachedPSO         = {};
-        secondaryPSO_ = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        secondaryPSO_ = CreateNativePSOWithDesc(device, stateDesc, desc.debugName, viewMask);
     }
     else
-        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName, viewMask);
 
     SetNativeAndUpdateCache(std::move(primaryPSO), pipelineCache);
 }
 
-ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const char* debugName)
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const char*                                 debugName,
+    UINT                                        viewMask)
 {
+    if (viewMask != 0)
+        return CreateNativeViewInstancingPSOWithDesc(device, desc, debugName, viewMask);
+
     ComPtr<ID3D12PipelineState> pipelineState;
-    HRESULT hr = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    HRESULT hr = D3D12ObjectCache::Get().CreateGraphicsPipelineState(device, desc, pipelineState);
     if (FAILED(hr))
     {
         GetMutableReport().Errorf("Failed to create D3D12 graphics pipeline state [%s] (HRESULT = %s)\n", GetOptionalDebugName(debugName), DXErrorToStrOrHex(hr));
@@ -458,6 +483,234 @@ ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(ID3D12Devi
     return pipelineState;
 }
 
+#if defined LLGL_D3D12_MESH_SHADERS || defined LLGL_D3D12_VIEW_INSTANCING
+
+// Pipeline state stream subobject; each subobject must be aligned to the size of a pointer.
+template <D3D12_PIPELINE_STATE_SUBOBJECT_TYPE TType, typename T>
+struct alignas(void*) D3D12PipelineStateSubobject
+{
+    D3D12_PIPELINE_STATE_SUBOBJECT_TYPE type    = TType;
+    T                                   value   = {};
+};
+
+#endif // /LLGL_D3D12_MESH_SHADERS || LLGL_D3D12_VIEW_INSTANCING
+
+#ifdef LLGL_D3D12_VIEW_INSTANCING
+
+// View instancing descriptor with storage for its view instance locations.
+struct D3D12ViewInstancingDesc
+{
+    D3D12_VIEW_INSTANCING_DESC  desc                                        = {};
+    D3D12_VIEW_INSTANCE_LOCATION locations[D3D12_MAX_VIEW_INSTANCE_COUNT]   = {};
+};
+
+/*
+Initializes the view instancing descriptor for the specified view mask.
+View instance i renders into the render-target array slice i relative to the first array slice of the RTV and DSV.
+Masking is only enabled for sparse view masks, since the view instance mask is applied in addition to the view instance count.
+*/
+static void ConvertViewInstancingDesc(D3D12ViewInstancingDesc& dst, UINT viewMask)
+{
+    const UINT numViews = std::min(NumRenderPassViews(viewMask), static_cast<std::uint32_t>(D3D12_MAX_VIEW_INSTANCE_COUNT));
+    for_range(i, numViews)
+    {
+        dst.locations[i].ViewportArrayIndex     = 0;
+        dst.locations[i].RenderTargetArrayIndex = i;
+    }
+    const bool isSparseMask = ((viewMask & (viewMask + 1u)) != 0);
+    dst.desc.ViewInstanceCount          = numViews;
+    dst.desc.pViewInstanceLocations     = dst.locations;
+    dst.desc.Flags                      = (isSparseMask ? D3D12_VIEW_INSTANCING_FLAG_ENABLE_VIEW_INSTANCE_MASKING : D3D12_VIEW_INSTANCING_FLAG_NONE);
+}
+
+// Pipeline state stream for graphics PSOs with view instancing.
+struct D3D12ViewInstancingPipelineStateStream
+{
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,        ID3D12RootSignature*                > rootSignature;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VS,                    D3D12_SHADER_BYTECODE               > VS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_HS,                    D3D12_SHADER_BYTECODE               > HS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DS,                    D3D12_SHADER_BYTECODE               > DS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_GS,                    D3D12_SHADER_BYTECODE               > GS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,                    D3D12_SHADER_BYTECODE               > PS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_STREAM_OUTPUT,         D3D12_STREAM_OUTPUT_DESC            > streamOutput;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,                 D3D12_BLEND_DESC                    > blendState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,           UINT                                > sampleMask;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,            D3D12_RASTERIZER_DESC               > rasterizerState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,         D3D12_DEPTH_STENCIL_DESC            > depthStencilState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_INPUT_LAYOUT,          D3D12_INPUT_LAYOUT_DESC             > inputLayout;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_IB_STRIP_CUT_VALUE,    D3D12_INDEX_BUFFER_STRIP_CUT_VALUE  > stripCutValue;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY,    D3D12_PRIMITIVE_TOPOLOGY_TYPE       > primitiveTopologyType;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS, D3D12_RT_FORMAT_ARRAY               > renderTargetFormats;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,  DXGI_FORMAT                         > depthStencilFormat;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,           DXGI_SAMPLE_DESC                    > sampleDesc;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_CACHED_PSO,            D3D12_CACHED_PIPELINE_STATE         > cachedPSO;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_FLAGS,                 D3D12_PIPELINE_STATE_FLAGS          > flags;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING,       D3D12_VIEW_INSTANCING_DESC          > viewInstancing;
+};
+
+#endif // /LLGL_D3D12_VIEW_INSTANCING
+
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativeViewInstancingPSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const char*                                 debugName,
+    UINT                                        viewMask)
+{
+    #ifdef LLGL_D3D12_VIEW_INSTANCING
+
+    ComPtr<ID3D12Device2> device2;
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(device2.GetAddressOf()))))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 graphics pipeline state [%s]: ID3D12Device2 not supported for view instancing\n", GetOptionalDebugName(debugName));
+        return nullptr;
+    }
+
+    D3D12ViewInstancingDesc viewInstancingDesc;
+    ConvertViewInstancingDesc(viewInstancingDesc, viewMask);
+
+    /* Copy all states of the graphics PSO descriptor into the pipeline state stream */
+    D3D12ViewInstancingPipelineStateStream stream;
+    {
+        stream.rootSignature.value          = desc.pRootSignature;
+        stream.VS.value                     = desc.VS;
+        stream.HS.value                     = desc.HS;
+        stream.DS.value                     = desc.DS;
+        stream.GS.value                     = desc.GS;
+        stream.PS.value                     = desc.PS;
+        stream.streamOutput.value           = desc.StreamOutput;
+        stream.blendState.value             = desc.BlendState;
+        stream.sampleMask.value             = desc.SampleMask;
+        stream.rasterizerState.value        = desc.RasterizerState;
+        stream.depthStencilState.value      = desc.DepthStencilState;
+        stream.inputLayout.value            = desc.InputLayout;
+        stream.stripCutValue.value          = desc.IBStripCutValue;
+        stream.primitiveTopologyType.value  = desc.PrimitiveTopologyType;
+        stream.renderTargetFormats.value.NumRenderTargets = desc.NumRenderTargets;
+        for_range(i, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT)
+            stream.renderTargetFormats.value.RTFormats[i] = desc.RTVFormats[i];
+        stream.depthStencilFormat.value     = desc.DSVFormat;
+        stream.sampleDesc.value             = desc.SampleDesc;
+        stream.cachedPSO.value              = desc.CachedPSO;
+        stream.flags.value                  = desc.Flags;
+        stream.viewInstancing.value         = viewInstancingDesc.desc;
+    }
+
+    D3D12_PIPELINE_STATE_STREAM_DESC streamDesc;
+    {
+        streamDesc.SizeInBytes                      = sizeof(stream);
+        streamDesc.pPipelineStateSubobjectStream    = &stream;
+    }
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    HRESULT hr = device2->CreatePipelineState(&streamDesc, IID_PPV_ARGS(pipelineState.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 graphics pipeline state with view instancing [%s] (HRESULT = %s)\n", GetOptionalDebugName(debugName), DXErrorToStrOrHex(hr));
+        return nullptr;
+    }
+    return pipelineState;
+
+    #else // LLGL_D3D12_VIEW_INSTANCING
+
+    GetMutableReport().Errorf("Failed to create D3D12 graphics pipeline state [%s]: view instancing not supported by this build\n", GetOptionalDebugName(debugName));
+    return nullptr;
+
+    #endif // /LLGL_D3D12_VIEW_INSTANCING
+}
+
+#ifdef LLGL_D3D12_MESH_SHADERS
+
+// Pipeline state stream for mesh shader PSOs.
+struct D3D12MeshPipelineStateStream
+{
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,        ID3D12RootSignature*            > rootSignature;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_AS,                    D3D12_SHADER_BYTECODE           > AS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_MS,                    D3D12_SHADER_BYTECODE           > MS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,                    D3D12_SHADER_BYTECODE           > PS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,                 D3D12_BLEND_DESC                > blendState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,           UINT                            > sampleMask;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,            D3D12_RASTERIZER_DESC           > rasterizerState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,         D3D12_DEPTH_STENCIL_DESC        > depthStencilState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY,    D3D12_PRIMITIVE_TOPOLOGY_TYPE   > primitiveTopologyType;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS, D3D12_RT_FORMAT_ARRAY           > renderTargetFormats;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,  DXGI_FORMAT                     > depthStencilFormat;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,           DXGI_SAMPLE_DESC                > sampleDesc;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_CACHED_PSO,            D3D12_CACHED_PIPELINE_STATE     > cachedPSO;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_FLAGS,                 D3D12_PIPELINE_STATE_FLAGS      > flags;
+    #ifdef LLGL_D3D12_VIEW_INSTANCING
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING,       D3D12_VIEW_INSTANCING_DESC      > viewInstancing;
+    #endif
+};
+
+#endif // /LLGL_D3D12_MESH_SHADERS
+
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativeMeshPSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const GraphicsPipelineDescriptor&           meshDesc,
+    UINT                                        viewMask)
+{
+    #ifdef LLGL_D3D12_MESH_SHADERS
+
+    ComPtr<ID3D12Device2> device2;
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(device2.GetAddressOf()))))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 mesh pipeline state [%s]: ID3D12Device2 not supported\n", GetOptionalDebugName(meshDesc.debugName));
+        return nullptr;
+    }
+
+    /* Copy all states that are shared with regular graphics PSOs into the pipeline state stream */
+    D3D12MeshPipelineStateStream stream;
+    {
+        stream.rootSignature.value          = desc.pRootSignature;
+        stream.AS.value                     = GetD3DShaderByteCode(meshDesc.taskShader);
+        stream.MS.value                     = GetD3DShaderByteCode(meshDesc.meshShader);
+        stream.PS.value                     = desc.PS;
+        stream.blendState.value             = desc.BlendState;
+        stream.sampleMask.value             = desc.SampleMask;
+        stream.rasterizerState.value        = desc.RasterizerState;
+        stream.depthStencilState.value      = desc.DepthStencilState;
+        stream.primitiveTopologyType.value  = desc.PrimitiveTopologyType;
+        stream.renderTargetFormats.value.NumRenderTargets = desc.NumRenderTargets;
+        for_range(i, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT)
+            stream.renderTargetFormats.value.RTFormats[i] = desc.RTVFormats[i];
+        stream.depthStencilFormat.value     = desc.DSVFormat;
+        stream.sampleDesc.value             = desc.SampleDesc;
+        stream.cachedPSO.value              = desc.CachedPSO;
+        stream.flags.value                  = desc.Flags;
+    }
+
+    /* View instancing is disabled with a view instance count of zero */
+    #ifdef LLGL_D3D12_VIEW_INSTANCING
+    D3D12ViewInstancingDesc viewInstancingDesc;
+    if (viewMask != 0)
+        ConvertViewInstancingDesc(viewInstancingDesc, viewMask);
+    stream.viewInstancing.value = viewInstancingDesc.desc;
+    #endif
+
+    D3D12_PIPELINE_STATE_STREAM_DESC streamDesc;
+    {
+        streamDesc.SizeInBytes                      = sizeof(stream);
+        streamDesc.pPipelineStateSubobjectStream    = &stream;
+    }
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    HRESULT hr = device2->CreatePipelineState(&streamDesc, IID_PPV_ARGS(pipelineState.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 mesh pipeline state [%s] (HRESULT = %s)\n", GetOptionalDebugName(meshDesc.debugName), DXErrorToStrOrHex(hr));
+        return nullptr;
+    }
+    return pipelineState;
+
+    #else // LLGL_D3D12_MESH_SHADERS
+
+    GetMutableReport().Errorf("Failed to create D3D12 mesh pipeline state [%s]: mesh shaders not supported by this build\n", GetOptionalDebugName(meshDesc.debugName));
+    return nullptr;
+
+    #endif // /LLGL_D3D12_MESH_SHADERS
+}
+
 // Returns the size (in bytes) for the static-state buffer with the specified number of viewports and scissor rectangles
 static std::size_t GetStaticStateBufferSize(std::size_t numViewports, std::size_t numScissors)
 {
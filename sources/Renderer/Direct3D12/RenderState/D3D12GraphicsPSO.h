@@ -61,7 +61,28 @@ class D3D12GraphicsPSO final : public D3D12PipelineState
             D3D12PipelineCache*                 pipelineCache   = nullptr
         );
 
-        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const char* debugName);
+        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const char*                                 debugName,
+            UINT                                        viewMask    = 0
+        );
+
+        // Creates a graphics PSO with view instancing for multiview render passes via a pipeline state stream.
+        ComPtr<ID3D12PipelineState> CreateNativeViewInstancingPSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const char*                                 debugName,
+            UINT                                        viewMask
+        );
+
+        // Creates a mesh shader PSO via a pipeline state stream. The input assembler and vertex stages of the specified descriptor are ignored.
+        ComPtr<ID3D12PipelineState> CreateNativeMeshPSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const GraphicsPipelineDescriptor&           meshDesc,
+            UINT                                        viewMask    = 0
+        );
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
         void BuildStaticViewports(std::size_t numViewports, const Viewport* viewports, ByteBufferIterator& byteBufferIter);
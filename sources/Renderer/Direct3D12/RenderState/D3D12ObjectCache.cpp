@@ -0,0 +1,328 @@
+/*
+ * D3D12ObjectCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12ObjectCache.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Helper class to serialize native descriptors into a key string. Structures with padding bytes must be appended field by field.
+class D3D12ObjectCacheKey
+{
+
+    public:
+
+        inline void AppendBytes(const void* data, std::size_t size)
+        {
+            key_.append(static_cast<const char*>(data), size);
+        }
+
+        template <typename T>
+        inline void Append(const T& value)
+        {
+            AppendBytes(&value, sizeof(value));
+        }
+
+        // Appends the string including its null terminator. Null pointers are treated as empty strings.
+        inline void AppendString(const char* str)
+        {
+            if (str != nullptr)
+                AppendBytes(str, ::strlen(str) + 1);
+            else
+                Append('\0');
+        }
+
+        void AppendShaderByteCode(const D3D12_SHADER_BYTECODE& byteCode);
+        void AppendStreamOutput(const D3D12_STREAM_OUTPUT_DESC& desc);
+        void AppendBlendState(const D3D12_BLEND_DESC& desc);
+        void AppendDepthStencilState(const D3D12_DEPTH_STENCIL_DESC& desc);
+        void AppendInputLayout(const D3D12_INPUT_LAYOUT_DESC& desc);
+
+        inline const std::string& Get() const
+        {
+            return key_;
+        }
+
+    private:
+
+        std::string key_;
+
+};
+
+void D3D12ObjectCacheKey::AppendShaderByteCode(const D3D12_SHADER_BYTECODE& byteCode)
+{
+    Append(static_cast<std::uint64_t>(byteCode.BytecodeLength));
+
+    /* DXBC and DXIL containers start with a 4-byte FourCC followed by a 16-byte checksum of the entire container */
+    constexpr std::size_t containerHeaderSize = 20;
+    const char* data = static_cast<const char*>(byteCode.pShaderBytecode);
+
+    if (byteCode.BytecodeLength >= containerHeaderSize && ::memcmp(data, "DXBC", 4) == 0)
+        AppendBytes(data, containerHeaderSize);
+    else if (byteCode.BytecodeLength > 0)
+        AppendBytes(data, byteCode.BytecodeLength);
+}
+
+void D3D12ObjectCacheKey::AppendStreamOutput(const D3D12_STREAM_OUTPUT_DESC& desc)
+{
+    Append(desc.NumEntries);
+    for_range(i, desc.NumEntries)
+    {
+        const D3D12_SO_DECLARATION_ENTRY& entry = desc.pSODeclaration[i];
+        Append(entry.Stream);
+        AppendString(entry.SemanticName);
+        Append(entry.SemanticIndex);
+        Append(entry.StartComponent);
+        Append(entry.ComponentCount);
+        Append(entry.OutputSlot);
+    }
+
+    Append(desc.NumStrides);
+    if (desc.NumStrides > 0)
+        AppendBytes(desc.pBufferStrides, sizeof(UINT) * desc.NumStrides);
+
+    Append(desc.RasterizedStream);
+}
+
+void D3D12ObjectCacheKey::AppendBlendState(const D3D12_BLEND_DESC& desc)
+{
+    Append(desc.AlphaToCoverageEnable);
+    Append(desc.IndependentBlendEnable);
+    for (const D3D12_RENDER_TARGET_BLEND_DESC& target : desc.RenderTarget)
+    {
+        Append(target.BlendEnable);
+        Append(target.LogicOpEnable);
+        Append(target.SrcBlend);
+        Append(target.DestBlend);
+        Append(target.BlendOp);
+        Append(target.SrcBlendAlpha);
+        Append(target.DestBlendAlpha);
+        Append(target.BlendOpAlpha);
+        Append(target.LogicOp);
+        Append(target.RenderTargetWriteMask);
+    }
+}
+
+void D3D12ObjectCacheKey::AppendDepthStencilState(const D3D12_DEPTH_STENCIL_DESC& desc)
+{
+    Append(desc.DepthEnable);
+    Append(desc.DepthWriteMask);
+    Append(desc.DepthFunc);
+    Append(desc.StencilEnable);
+    Append(desc.StencilReadMask);
+    Append(desc.StencilWriteMask);
+    Append(desc.FrontFace);
+    Append(desc.BackFace);
+}
+
+void D3D12ObjectCacheKey::AppendInputLayout(const D3D12_INPUT_LAYOUT_DESC& desc)
+{
+    Append(desc.NumElements);
+    for_range(i, desc.NumElements)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& element = desc.pInputElementDescs[i];
+        AppendString(element.SemanticName);
+        Append(element.SemanticIndex);
+        Append(element.Format);
+        Append(element.InputSlot);
+        Append(element.AlignedByteOffset);
+        Append(element.InputSlotClass);
+        Append(element.InstanceDataStepRate);
+    }
+}
+
+// Returns the number of references to the specified COM object.
+static ULONG GetRefCount(IUnknown* object)
+{
+    object->AddRef();
+    return object->Release();
+}
+
+// Erases all entries of the specified map whose objects are only referenced by the map itself.
+template <typename TMap, typename TGetObject>
+static void EraseUnreferencedEntries(TMap& map, TGetObject getObject)
+{
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (GetRefCount(getObject(it->second)) == 1)
+            it = map.erase(it);
+        else
+            ++it;
+    }
+}
+
+
+/*
+ * D3D12ObjectCache class
+ */
+
+D3D12ObjectCache& D3D12ObjectCache::Get()
+{
+    static D3D12ObjectCache instance;
+    return instance;
+}
+
+void D3D12ObjectCache::Clear()
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+    pipelineStates_.clear();
+    rootSignatures_.clear();
+}
+
+void D3D12ObjectCache::ReleaseUnusedObjects()
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+
+    /* Release PSOs first, since they hold references to their root signatures */
+    EraseUnreferencedEntries(pipelineStates_, [](const PipelineStateEntry& entry) { return entry.pipelineState.Get(); });
+    EraseUnreferencedEntries(rootSignatures_, [](const ComPtr<ID3D12RootSignature>& entry) { return entry.Get(); });
+}
+
+HRESULT D3D12ObjectCache::CreateRootSignature(
+    ID3D12Device*                   device,
+    const void*                     blobData,
+    SIZE_T                          blobSize,
+    ComPtr<ID3D12RootSignature>&    outRootSignature)
+{
+    const std::string key{ static_cast<const char*>(blobData), static_cast<std::size_t>(blobSize) };
+
+    /* Return cached root signature if this blob has been created before */
+    {
+        LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+        auto it = rootSignatures_.find(key);
+        if (it != rootSignatures_.end())
+        {
+            outRootSignature = it->second;
+            return S_OK;
+        }
+    }
+
+    /* Create new root signature outside of the lock; if another thread created the same one in the meantime, use the first one */
+    ComPtr<ID3D12RootSignature> rootSignature;
+    HRESULT hr = device->CreateRootSignature(0, blobData, blobSize, IID_PPV_ARGS(rootSignature.ReleaseAndGetAddressOf()));
+    if (FAILED(hr))
+        return hr;
+
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+    outRootSignature = rootSignatures_.emplace(key, std::move(rootSignature)).first->second;
+    return S_OK;
+}
+
+HRESULT D3D12ObjectCache::CreateGraphicsPipelineState(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    ComPtr<ID3D12PipelineState>&                outPipelineState)
+{
+    D3D12ObjectCacheKey key;
+    {
+        key.Append('G');
+        key.Append(desc.pRootSignature);
+        key.AppendShaderByteCode(desc.VS);
+        key.AppendShaderByteCode(desc.PS);
+        key.AppendShaderByteCode(desc.DS);
+        key.AppendShaderByteCode(desc.HS);
+        key.AppendShaderByteCode(desc.GS);
+        key.AppendStreamOutput(desc.StreamOutput);
+        key.AppendBlendState(desc.BlendState);
+        key.Append(desc.SampleMask);
+        key.Append(desc.RasterizerState);
+        key.AppendDepthStencilState(desc.DepthStencilState);
+        key.AppendInputLayout(desc.InputLayout);
+        key.Append(desc.IBStripCutValue);
+        key.Append(desc.PrimitiveTopologyType);
+        key.Append(desc.NumRenderTargets);
+        key.Append(desc.RTVFormats);
+        key.Append(desc.DSVFormat);
+        key.Append(desc.SampleDesc);
+        key.Append(desc.NodeMask);
+        key.Append(desc.Flags);
+    }
+    return FindOrCreatePipelineState(
+        key.Get(),
+        desc.pRootSignature,
+        [device, &desc](ID3D12PipelineState** outNative) -> HRESULT
+        {
+            return device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(outNative));
+        },
+        outPipelineState
+    );
+}
+
+HRESULT D3D12ObjectCache::CreateComputePipelineState(
+    ID3D12Device*                               device,
+    const D3D12_COMPUTE_PIPELINE_STATE_DESC&    desc,
+    ComPtr<ID3D12PipelineState>&                outPipelineState)
+{
+    D3D12ObjectCacheKey key;
+    {
+        key.Append('C');
+        key.Append(desc.pRootSignature);
+        key.AppendShaderByteCode(desc.CS);
+        key.Append(desc.NodeMask);
+        key.Append(desc.Flags);
+    }
+    return FindOrCreatePipelineState(
+        key.Get(),
+        desc.pRootSignature,
+        [device, &desc](ID3D12PipelineState** outNative) -> HRESULT
+        {
+            return device->CreateComputePipelineState(&desc, IID_PPV_ARGS(outNative));
+        },
+        outPipelineState
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename TCreatePipelineState>
+HRESULT D3D12ObjectCache::FindOrCreatePipelineState(
+    const std::string&              key,
+    ID3D12RootSignature*            rootSignature,
+    TCreatePipelineState            createPipelineState,
+    ComPtr<ID3D12PipelineState>&    outPipelineState)
+{
+    /* Return cached PSO if the same state description has been created before */
+    {
+        LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+        auto it = pipelineStates_.find(key);
+        if (it != pipelineStates_.end())
+        {
+            outPipelineState = it->second.pipelineState;
+            return S_OK;
+        }
+    }
+
+    /* Create new PSO outside of the lock, so PSOs can still be compiled concurrently */
+    ComPtr<ID3D12PipelineState> pipelineState;
+    HRESULT hr = createPipelineState(pipelineState.ReleaseAndGetAddressOf());
+    if (FAILED(hr))
+        return hr;
+
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "D3D12ObjectCache");
+    PipelineStateEntry& entry = pipelineStates_.emplace(key, PipelineStateEntry{ std::move(pipelineState), rootSignature }).first->second;
+    outPipelineState = entry.pipelineState;
+    return S_OK;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,104 @@
+/*
+ * D3D12ObjectCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_OBJECT_CACHE_H
+#define LLGL_D3D12_OBJECT_CACHE_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Render system wide cache of native root signatures and PSOs.
+Root signatures are keyed by their serialized blob and PSOs by their entire state description,
+so identical descriptors share the same native object instead of creating duplicates.
+All functions are thread-safe, since PSOs can be created concurrently.
+*/
+class D3D12ObjectCache
+{
+
+    public:
+
+        D3D12ObjectCache(const D3D12ObjectCache&) = delete;
+        D3D12ObjectCache& operator = (const D3D12ObjectCache&) = delete;
+
+        // Returns the instance of this singleton.
+        static D3D12ObjectCache& Get();
+
+        // Releases all cached objects.
+        void Clear();
+
+        // Releases all cached objects that are no longer referenced outside of this cache.
+        void ReleaseUnusedObjects();
+
+        // Returns the cached root signature for the specified serialized blob or creates a new one.
+        HRESULT CreateRootSignature(
+            ID3D12Device*                   device,
+            const void*                     blobData,
+            SIZE_T                          blobSize,
+            ComPtr<ID3D12RootSignature>&    outRootSignature
+        );
+
+        // Returns the cached graphics PSO for the specified descriptor or creates a new one. D3D12_GRAPHICS_PIPELINE_STATE_DESC::CachedPSO is not part of the key.
+        HRESULT CreateGraphicsPipelineState(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            ComPtr<ID3D12PipelineState>&                outPipelineState
+        );
+
+        // Returns the cached compute PSO for the specified descriptor or creates a new one. D3D12_COMPUTE_PIPELINE_STATE_DESC::CachedPSO is not part of the key.
+        HRESULT CreateComputePipelineState(
+            ID3D12Device*                               device,
+            const D3D12_COMPUTE_PIPELINE_STATE_DESC&    desc,
+            ComPtr<ID3D12PipelineState>&                outPipelineState
+        );
+
+    private:
+
+        struct PipelineStateEntry
+        {
+            ComPtr<ID3D12PipelineState> pipelineState;
+            ComPtr<ID3D12RootSignature> rootSignature;  // Keeps the root signature alive, since its address is part of the key.
+        };
+
+    private:
+
+        D3D12ObjectCache() = default;
+
+        template <typename TCreatePipelineState>
+        HRESULT FindOrCreatePipelineState(
+            const std::string&              key,
+            ID3D12RootSignature*            rootSignature,
+            TCreatePipelineState            createPipelineState,
+            ComPtr<ID3D12PipelineState>&    outPipelineState
+        );
+
+    private:
+
+        std::mutex                                                      mutex_;
+        std::unordered_map<std::string, ComPtr<ID3D12RootSignature>>    rootSignatures_;
+        std::unordered_map<std::string, PipelineStateEntry>             pipelineStates_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
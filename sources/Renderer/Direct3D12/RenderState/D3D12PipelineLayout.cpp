@@ -260,10 +260,8 @@ void D3D12PipelineLayout::BuildRootSignature(
     /* Build root parameter for each standalone descriptor */
     rootParameterMap_.resize(desc.bindings.size());
     BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_CBV, desc, ResourceType::Buffer, BindFlags::ConstantBuffer);
-
-    //TODO: re-enable until LLGL can translate restrictions on root parameters; see CanResourceHaveRootParameter()
-    //BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc, ResourceType::Buffer, BindFlags::Sampled);
-    //BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_UAV, desc, ResourceType::Buffer, BindFlags::Storage);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc, ResourceType::Buffer, BindFlags::Sampled);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_UAV, desc, ResourceType::Buffer, BindFlags::Storage);
 
     /* Build static samplers */
     BuildStaticSamplers(rootSignature, desc, numStaticSamplers_);
@@ -340,10 +338,19 @@ void D3D12PipelineLayout::BuildHeapRootParameterTableEntry(
     descriptorHeapLayout_.GetDescriptorLocation(descRangeType, outLocation);
 }
 
-static bool CanResourceHaveRootParameter(const ResourceType resourceType, long bindFlags)
+static bool CanResourceHaveRootParameter(const ResourceType resourceType, long bindFlags, long layoutFlags)
 {
-    /* Only raw or structured buffers can be used as SRV and UAV, so only allow CBV until LLGL can translate those restrictions */
-    return (resourceType == ResourceType::Buffer && (bindFlags & BindFlags::ConstantBuffer) != 0);
+    if (resourceType == ResourceType::Buffer)
+    {
+        /* Constant buffers can always be root descriptors */
+        if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+            return true;
+
+        /* Only raw or structured buffers can be used as root SRV and UAV, so the client must opt in to guarantee this restriction */
+        if ((layoutFlags & PipelineLayoutFlags::RootDescriptors) != 0)
+            return ((bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0);
+    }
+    return false;
 }
 
 void D3D12PipelineLayout::BuildRootParameterTables(
@@ -360,7 +367,7 @@ void D3D12PipelineLayout::BuildRootParameterTables(
         if (IsFilteredBinding(binding, resourceType, bindFlags))
         {
             /* If resource binding cannot have its own root parameter, it must be put into a descriptor table */
-            if (!CanResourceHaveRootParameter(resourceType, bindFlags))
+            if (!CanResourceHaveRootParameter(resourceType, bindFlags, layoutDesc.flags))
             {
                 BuildRootParameterTableEntry(
                     /*rootSignature:*/  rootSignature,
@@ -431,7 +438,7 @@ void D3D12PipelineLayout::BuildRootParameters(
         if (IsFilteredBinding(binding, resourceType, bindFlags))
         {
             /* If resource binding cannot have its own root parameter, it must be put into a descriptor table */
-            if (CanResourceHaveRootParameter(resourceType, bindFlags))
+            if (CanResourceHaveRootParameter(resourceType, bindFlags, layoutDesc.flags))
             {
                 BuildRootParameter(
                     /*rootSignature:*/  rootSignature,
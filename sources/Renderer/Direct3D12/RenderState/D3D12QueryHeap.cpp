@@ -119,6 +119,23 @@ void D3D12QueryHeap::End(ID3D12GraphicsCommandList* commandList, UINT query)
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_);
 }
 
+void D3D12QueryHeap::ResolveDataInto(
+    ID3D12GraphicsCommandList*  commandList,
+    UINT                        firstQuery,
+    UINT                        numQueries,
+    ID3D12Resource*             dstResource,
+    UINT64                      dstOffset)
+{
+    commandList->ResolveQueryData(
+        native_.Get(),
+        nativeType_,
+        firstQuery * queryPerType_,
+        numQueries * queryPerType_,
+        dstResource,
+        dstOffset
+    );
+}
+
 void D3D12QueryHeap::FlushDirtyRange(ID3D12GraphicsCommandList* commandList)
 {
     if (HasDirtyRange())
@@ -43,6 +43,15 @@ class D3D12QueryHeap final : public QueryHeap
         // Returns true if the specified range of queries overlaps with the dirty range.
         bool InsideDirtyRange(UINT firstQuery, UINT numQueries) const;
 
+        // Resolves the specified range of queries into the destination resource, which must be in the D3D12_RESOURCE_STATE_COPY_DEST state.
+        void ResolveDataInto(
+            ID3D12GraphicsCommandList*  commandList,
+            UINT                        firstQuery,
+            UINT                        numQueries,
+            ID3D12Resource*             dstResource,
+            UINT64                      dstOffset
+        );
+
         // Maps the query result buffer to CPU local memory.
         void* Map(UINT firstQuery, UINT numQueries);
         void Unmap();
@@ -37,6 +37,7 @@ void D3D12RenderPass::BuildAttachments(
     /* Check which color attachment must be cleared */
     numColorAttachments_    = NumEnabledColorAttachments(desc);
     clearFlagsDSV_          = 0;
+    viewMask_               = desc.viewMask;
 
     FillClearColorAttachmentIndices(LLGL_MAX_NUM_COLOR_ATTACHMENTS, clearColorAttachments_, desc);
 
@@ -77,13 +78,37 @@ void D3D12RenderPass::BuildAttachments(
 
     /* Store sample descriptor */
     sampleDesc_ = device.FindSuitableSampleDesc(numColorAttachments_, rtvFormats_, GetClampedSamples(desc.samples));
+
+    /* Store native access types for render passes via ID3D12GraphicsCommandList4 */
+    ResetNativeAccessTypes();
+
+    for_range(i, numColorAttachments_)
+    {
+        colorBeginningAccess_[i]    = D3D12Types::Map(desc.colorAttachments[i].loadOp);
+        colorEndingAccess_[i]       = D3D12Types::Map(desc.colorAttachments[i].storeOp);
+    }
+
+    const Format depthStencilFormat = (desc.depthAttachment.format != Format::Undefined ? desc.depthAttachment.format : desc.stencilAttachment.format);
+
+    if (IsDepthFormat(depthStencilFormat))
+    {
+        depthBeginningAccess_   = D3D12Types::Map(desc.depthAttachment.loadOp);
+        depthEndingAccess_      = D3D12Types::Map(desc.depthAttachment.storeOp);
+    }
+
+    if (IsStencilFormat(depthStencilFormat))
+    {
+        stencilBeginningAccess_ = D3D12Types::Map(desc.stencilAttachment.loadOp);
+        stencilEndingAccess_    = D3D12Types::Map(desc.stencilAttachment.storeOp);
+    }
 }
 
 void D3D12RenderPass::BuildAttachments(
     UINT                    numColorFormats,
     const DXGI_FORMAT*      colorFormats,
     const DXGI_FORMAT       depthStencilFormat,
-    const DXGI_SAMPLE_DESC& sampleDesc)
+    const DXGI_SAMPLE_DESC& sampleDesc,
+    UINT                    viewMask)
 {
     /* Reset clear flags */
     clearFlagsDSV_ = 0;
@@ -97,8 +122,26 @@ void D3D12RenderPass::BuildAttachments(
     /* Store depth-stencil attachment format */
     SetDSVFormat(depthStencilFormat);
 
-    /* Store sample descriptor */
+    /* Store sample descriptor and view mask */
     sampleDesc_ = sampleDesc;
+    viewMask_   = viewMask;
+
+    /* Preserve all attachments, since this render pass has no load or store operations */
+    ResetNativeAccessTypes();
+
+    for_range(i, numColorFormats)
+    {
+        colorBeginningAccess_[i]    = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+        colorEndingAccess_[i]       = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+    }
+
+    if (depthStencilFormat != DXGI_FORMAT_UNKNOWN)
+    {
+        depthBeginningAccess_   = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+        depthEndingAccess_      = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+        stencilBeginningAccess_ = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+        stencilEndingAccess_    = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+    }
 }
 
 
@@ -116,6 +159,19 @@ void D3D12RenderPass::SetRTVFormat(DXGI_FORMAT format, UINT colorAttachment)
     rtvFormats_[colorAttachment] = DXTypes::ToDXGIFormatRTV(format);
 }
 
+void D3D12RenderPass::ResetNativeAccessTypes()
+{
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        colorBeginningAccess_[i]    = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+        colorEndingAccess_[i]       = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
+    }
+    depthBeginningAccess_   = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+    depthEndingAccess_      = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
+    stencilBeginningAccess_ = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+    stencilEndingAccess_    = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
+}
+
 
 } // /namespace LLGL
 
@@ -47,7 +47,8 @@ class D3D12RenderPass final : public RenderPass
             UINT                    numColorFormats,
             const DXGI_FORMAT*      colorFormats,
             const DXGI_FORMAT       depthStencilFormat,
-            const DXGI_SAMPLE_DESC& sampleDesc
+            const DXGI_SAMPLE_DESC& sampleDesc,
+            UINT                    viewMask            = 0
         );
 
         // Returns the number of color attachments used for this render pass.
@@ -92,11 +93,55 @@ class D3D12RenderPass final : public RenderPass
             return sampleDesc_;
         }
 
+        // Returns the bitmask of view instances for multiview rendering. This is 0 if view instancing is disabled.
+        inline UINT GetViewMask() const
+        {
+            return viewMask_;
+        }
+
+        // Returns the native render pass beginning access type for the specified color attachment.
+        inline D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE GetColorBeginningAccess(UINT colorAttachment) const
+        {
+            return colorBeginningAccess_[colorAttachment];
+        }
+
+        // Returns the native render pass ending access type for the specified color attachment.
+        inline D3D12_RENDER_PASS_ENDING_ACCESS_TYPE GetColorEndingAccess(UINT colorAttachment) const
+        {
+            return colorEndingAccess_[colorAttachment];
+        }
+
+        // Returns the native render pass beginning access type for the depth attachment.
+        inline D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE GetDepthBeginningAccess() const
+        {
+            return depthBeginningAccess_;
+        }
+
+        // Returns the native render pass ending access type for the depth attachment.
+        inline D3D12_RENDER_PASS_ENDING_ACCESS_TYPE GetDepthEndingAccess() const
+        {
+            return depthEndingAccess_;
+        }
+
+        // Returns the native render pass beginning access type for the stencil attachment.
+        inline D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE GetStencilBeginningAccess() const
+        {
+            return stencilBeginningAccess_;
+        }
+
+        // Returns the native render pass ending access type for the stencil attachment.
+        inline D3D12_RENDER_PASS_ENDING_ACCESS_TYPE GetStencilEndingAccess() const
+        {
+            return stencilEndingAccess_;
+        }
+
     private:
 
         void SetDSVFormat(DXGI_FORMAT format);
         void SetRTVFormat(DXGI_FORMAT format, UINT colorAttachment);
 
+        void ResetNativeAccessTypes();
+
     private:
 
         UINT                numColorAttachments_                                    = 0;
@@ -109,6 +154,14 @@ class D3D12RenderPass final : public RenderPass
         DXGI_FORMAT         dsvFormat_                                              = DXGI_FORMAT_UNKNOWN;
 
         DXGI_SAMPLE_DESC    sampleDesc_                                             = { 1, 0 };
+        UINT                viewMask_                                               = 0;
+
+        D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE colorBeginningAccess_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]   = {};
+        D3D12_RENDER_PASS_ENDING_ACCESS_TYPE    colorEndingAccess_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]      = {};
+        D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE depthBeginningAccess_                                   = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+        D3D12_RENDER_PASS_ENDING_ACCESS_TYPE    depthEndingAccess_                                      = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
+        D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE stencilBeginningAccess_                                 = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+        D3D12_RENDER_PASS_ENDING_ACCESS_TYPE    stencilEndingAccess_                                    = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
 
 };
 
@@ -23,16 +23,27 @@
 #include <LLGL/Utils/ForRange.h>
 #include <functional>
 #include <algorithm>
+#include <atomic>
 
 
 namespace LLGL
 {
 
 
+// Returns a new content version that is unique across all resource heaps. Zero is reserved for descriptors that are not versioned.
+static std::uint64_t NextContentVersion()
+{
+    static std::atomic<std::uint64_t> g_contentVersionCounter{ 0 };
+    return ++g_contentVersionCounter;
+}
+
 D3D12ResourceHeap::D3D12ResourceHeap(
     ID3D12Device*                               device,
     const ResourceHeapDescriptor&               desc,
     const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+:
+    device_           { device                                 },
+    minLODGeneration_ { D3D12Texture::GetMinLODGeneration()    }
 {
     /* Get pipeline layout object */
     auto pipelineLayoutD3D = LLGL_CAST(const D3D12PipelineLayout*, desc.pipelineLayout);
@@ -44,6 +55,7 @@ D3D12ResourceHeap::D3D12ResourceHeap(
     const auto numResourceViews = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
 
     numDescriptorSets_ = numResourceViews / numBindings;
+    contentVersion_    = NextContentVersion();
 
     /* Store meta data which pipelines will be used by this resource heap */
     auto convolutedStageFlags = pipelineLayoutD3D->GetConvolutedStageFlags();
@@ -169,9 +181,42 @@ std::uint32_t D3D12ResourceHeap::CreateResourceViewHandles(
     for_subrange(i, uavChangeSetRange[0], uavChangeSetRange[1])
         UpdateBarriers(i);
 
+    /* Invalidate descriptor tables that have been copied from this heap before */
+    if (numWritten > 0)
+        contentVersion_ = NextContentVersion();
+
     return numWritten;
 }
 
+void D3D12ResourceHeap::UpdateMinLODDescriptors()
+{
+    /* Early exit if no min-LOD clamp has changed since the last update; this is the common case for every SetResourceHeap command */
+    const std::uint64_t generation = D3D12Texture::GetMinLODGeneration();
+    if (minLODDescriptors_.empty() || minLODGeneration_.load() == generation)
+        return;
+
+    std::lock_guard<std::mutex> guard{ minLODMutex_ };
+
+    /* Descriptors are copied into the shader-visible heap on binding, so they can be rewritten while previous copies are still in use */
+    bool hasChanged = false;
+    for (auto& entry : minLODDescriptors_)
+    {
+        MinLODDescriptor& descriptor = entry.second;
+        const float minLOD = descriptor.texture->GetMinLOD();
+        if (descriptor.minLOD != minLOD)
+        {
+            descriptor.texture->CreateShaderResourceView(device_, D3D12_CPU_DESCRIPTOR_HANDLE{ entry.first });
+            descriptor.minLOD = minLOD;
+            hasChanged = true;
+        }
+    }
+
+    if (hasChanged)
+        contentVersion_ = NextContentVersion();
+
+    minLODGeneration_ = generation;
+}
+
 void D3D12ResourceHeap::InsertResourceBarriers(ID3D12GraphicsCommandList* commandList, std::uint32_t descriptorSet)
 {
     if (descriptorSet < numDescriptorSets_ && HasBarriers())
@@ -271,6 +316,7 @@ bool D3D12ResourceHeap::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU
                 bufferD3D.CreateShaderResourceView(device, cpuDescHandle, desc.bufferView);
             else
                 bufferD3D.CreateShaderResourceView(device, cpuDescHandle);
+            TrackMinLODDescriptor(cpuDescHandle, nullptr);
             return true;
         }
     }
@@ -279,11 +325,17 @@ bool D3D12ResourceHeap::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU
         auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
         if ((textureD3D.GetBindFlags() & BindFlags::Sampled) != 0)
         {
-            /* Create shader resource view (SRV) for D3D texture */
+            /* Create shader resource view (SRV) for D3D texture; only the default SRV is clamped to the texture's min-LOD */
             if (IsTextureViewEnabled(desc.textureView))
-                textureD3D.CreateShaderResourceView(device, cpuDescHandle, desc.textureView);
+            {
+                textureD3D.CopyCachedShaderResourceView(device, cpuDescHandle, desc.textureView);
+                TrackMinLODDescriptor(cpuDescHandle, nullptr);
+            }
             else
+            {
                 textureD3D.CreateShaderResourceView(device, cpuDescHandle);
+                TrackMinLODDescriptor(cpuDescHandle, &textureD3D);
+            }
             return true;
         }
     }
@@ -314,7 +366,7 @@ bool D3D12ResourceHeap::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CP
         {
             /* Create unordered access view (UAV) for D3D texture */
             if (IsTextureViewEnabled(desc.textureView))
-                textureD3D.CreateUnorderedAccessView(device, cpuDescHandle, desc.textureView);
+                textureD3D.CopyCachedUnorderedAccessView(device, cpuDescHandle, desc.textureView);
             else
                 textureD3D.CreateUnorderedAccessView(device, cpuDescHandle);
             return true;
@@ -357,6 +409,15 @@ bool D3D12ResourceHeap::CreateSampler(ID3D12Device* device, D3D12_CPU_DESCRIPTOR
     return false;
 }
 
+void D3D12ResourceHeap::TrackMinLODDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12Texture* texture)
+{
+    std::lock_guard<std::mutex> guard{ minLODMutex_ };
+    if (texture != nullptr)
+        minLODDescriptors_[cpuDescHandle.ptr] = MinLODDescriptor{ texture, texture->GetMinLOD() };
+    else
+        minLODDescriptors_.erase(cpuDescHandle.ptr);
+}
+
 static bool IsUAVResourceBarrierRequired(long bindFlags)
 {
     return ((bindFlags & BindFlags::Storage) != 0);
@@ -16,6 +16,9 @@
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <vector>
+#include <map>
+#include <atomic>
+#include <mutex>
 #include <cstddef>
 
 
@@ -24,6 +27,7 @@ namespace LLGL
 
 
 struct ResourceHeapDescriptor;
+class D3D12Texture;
 
 class D3D12ResourceHeap final : public ResourceHeap
 {
@@ -49,6 +53,9 @@ class D3D12ResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
+        // Recreates the default SRVs of all textures whose min-LOD clamp has changed since their descriptors were written. See D3D12Texture::SetMinLOD().
+        void UpdateMinLODDescriptors();
+
         // Inserts the resource barriers for the specified descritpor set into the command list.
         void InsertResourceBarriers(ID3D12GraphicsCommandList* commandList, std::uint32_t descriptorSet);
 
@@ -61,6 +68,12 @@ class D3D12ResourceHeap final : public ResourceHeap
         // Returns the native D3D descriptor heap for the specified heap type.
         ID3D12DescriptorHeap* GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE heapType) const;
 
+        // Returns the version of the descriptors in this heap. This is unique across all resource heaps and changes whenever descriptors are written.
+        inline std::uint64_t GetContentVersion() const
+        {
+            return contentVersion_;
+        }
+
     private:
 
         struct BindingHandleLocation
@@ -69,6 +82,13 @@ class D3D12ResourceHeap final : public ResourceHeap
             UINT handleOffset   : 31;
         };
 
+        // Default SRV of a texture and the min-LOD clamp it was created with.
+        struct MinLODDescriptor
+        {
+            D3D12Texture*   texture;
+            float           minLOD;
+        };
+
     private:
 
         void CreateDescriptorHeap(
@@ -82,6 +102,9 @@ class D3D12ResourceHeap final : public ResourceHeap
         bool CreateConstantBufferView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const ResourceViewDescriptor& desc);
         bool CreateSampler(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const ResourceViewDescriptor& desc);
 
+        // Stores the specified texture for its default SRV at the CPU descriptor handle, or removes the entry if the texture is null.
+        void TrackMinLODDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12Texture* texture);
+
         void ExchangeUAVResource(
             const D3D12DescriptorHeapLocation&  descriptorLocation,
             std::uint32_t                       descriptorSet,
@@ -111,6 +134,7 @@ class D3D12ResourceHeap final : public ResourceHeap
         UINT                                        descriptorSetStrides_[2]    = {};
         UINT                                        numDescriptorsPerSet_[2]    = {};
         UINT                                        numDescriptorSets_          = 0;    // Only used for 'GetNumDescriptorSets'
+        std::uint64_t                               contentVersion_             = 0;
 
         SmallVector<D3D12DescriptorHeapLocation>    descriptorMap_;
 
@@ -120,6 +144,11 @@ class D3D12ResourceHeap final : public ResourceHeap
         std::vector<char>                           barriers_;                          // Packed buffer for dyanmic struct { UINT N; D3D12_RESOURCE_BARRIER[N]; }
         UINT                                        barrierStride_              = 0;
 
+        ID3D12Device*                               device_                     = nullptr;
+        std::map<SIZE_T, MinLODDescriptor>          minLODDescriptors_;                 // Default texture SRVs by CPU descriptor handle
+        std::atomic<std::uint64_t>                  minLODGeneration_           { 0 };  // See D3D12Texture::GetMinLODGeneration()
+        std::mutex                                  minLODMutex_;
+
 };
 
 
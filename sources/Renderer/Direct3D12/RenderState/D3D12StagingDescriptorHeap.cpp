@@ -16,18 +16,14 @@ namespace LLGL
 
 
 D3D12StagingDescriptorHeap::D3D12StagingDescriptorHeap(D3D12StagingDescriptorHeap&& rhs) noexcept :
-    D3D12DescriptorHeap { std::forward<D3D12DescriptorHeap&&>(rhs) },
-    offset_             { rhs.offset_                              }
+    D3D12DescriptorHeap { std::forward<D3D12DescriptorHeap&&>(rhs) }
 {
 }
 
 D3D12StagingDescriptorHeap& D3D12StagingDescriptorHeap::operator = (D3D12StagingDescriptorHeap&& rhs) noexcept
 {
     if (this != &rhs)
-    {
         D3D12DescriptorHeap::operator = (std::forward<D3D12DescriptorHeap&&>(rhs));
-        offset_ = rhs.offset_;
-    }
     return *this;
 }
 
@@ -46,46 +42,29 @@ void D3D12StagingDescriptorHeap::Create(
     UINT                        size)
 {
     D3D12DescriptorHeap::Create(device, type, size, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
-    ResetOffset();
-}
-
-void D3D12StagingDescriptorHeap::ResetOffset()
-{
-    offset_ = 0;
-}
-
-bool D3D12StagingDescriptorHeap::Capacity(UINT count) const
-{
-    return (offset_ + count <= GetSize());
 }
 
 void D3D12StagingDescriptorHeap::CopyDescriptors(
     ID3D12Device*               device,
+    UINT                        dstOffset,
     D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
-    UINT                        firstDescriptor,
     UINT                        numDescriptors)
 {
-    /* Get source descriptor CPU handle address */
-    D3D12_CPU_DESCRIPTOR_HANDLE dstDescHandle = GetNative()->GetCPUDescriptorHandleForHeapStart();
-    dstDescHandle.ptr += (offset_ + firstDescriptor) * GetStride();
+    /* Get destination descriptor CPU handle address */
+    D3D12_CPU_DESCRIPTOR_HANDLE dstDescHandle = GetCpuHandleWithOffset(dstOffset);
 
     /* Copy descriptors from source to destination descriptor heap */
     device->CopyDescriptorsSimple(numDescriptors, dstDescHandle, srcDescHandle, GetType());
 }
 
-D3D12_GPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeap::GetGpuHandleWithOffset() const
-{
-    return D3D12DescriptorHeap::GetGpuHandleWithOffset(offset_);
-}
-
-D3D12_CPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeap::GetCpuHandleWithOffset(UINT descriptor) const
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeap::GetGpuHandleWithOffset(UINT offset) const
 {
-    return D3D12DescriptorHeap::GetCpuHandleWithOffset(offset_ + descriptor);
+    return D3D12DescriptorHeap::GetGpuHandleWithOffset(offset);
 }
 
-void D3D12StagingDescriptorHeap::IncrementOffset(UINT stride)
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeap::GetCpuHandleWithOffset(UINT offset) const
 {
-    offset_ += stride;
+    return D3D12DescriptorHeap::GetCpuHandleWithOffset(offset);
 }
 
 
@@ -36,32 +36,26 @@ class D3D12StagingDescriptorHeap final : private D3D12DescriptorHeap
             UINT                        size
         );
 
-        // Creates a new descriptor heap and resets the writing offset. This is always a shader-visible descriptor heap.
+        // Creates a new descriptor heap. This is always a shader-visible descriptor heap.
         void Create(
             ID3D12Device*               device,
             D3D12_DESCRIPTOR_HEAP_TYPE  type,
             UINT                        size
         );
 
-        // Resets the writing offset.
-        void ResetOffset();
-
-        // Increments the offset for the next range of descriptor handles.
-        void IncrementOffset(UINT stride);
-
-        // Returns true if the remaining heap size can fit the specified number of descriptors.
-        bool Capacity(UINT count) const;
-
-        // Copies the specified source descriptors into the native D3D descriptor heap.
+        // Copies the specified source descriptors into the native D3D descriptor heap at the specified offset.
         void CopyDescriptors(
             ID3D12Device*               device,
+            UINT                        dstOffset,
             D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
-            UINT                        firstDescriptor,
             UINT                        numDescriptors
         );
 
-        D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandleWithOffset() const;
-        D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandleWithOffset(UINT descriptor) const;
+        // Returns the GPU descriptor handle at the specified offset.
+        D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandleWithOffset(UINT offset) const;
+
+        // Returns the CPU descriptor handle at the specified offset.
+        D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandleWithOffset(UINT offset) const;
 
         // Returns the native D3D descriptor heap.
         inline ID3D12DescriptorHeap* GetNative() const
@@ -87,16 +81,6 @@ class D3D12StagingDescriptorHeap final : private D3D12DescriptorHeap
             return D3D12DescriptorHeap::GetStride();
         }
 
-        // Returns the current writing offset for the next descriptor.
-        inline UINT GetOffset() const
-        {
-            return offset_;
-        }
-
-    private:
-
-        UINT offset_ = 0;
-
 };
 
 
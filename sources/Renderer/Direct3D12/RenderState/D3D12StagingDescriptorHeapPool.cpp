@@ -10,6 +10,7 @@
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
 #include <algorithm>
+#include <functional>
 
 
 namespace LLGL
@@ -21,21 +22,37 @@ static UINT GetMaxDescriptorHeapSize(D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
     switch (type)
     {
-        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return 2048;
-        default:                                    return UINT_MAX;
+        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+        default:                                    return D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_1;
     }
 }
 
-// Returns the initial descriptor heap size for the specified type
+// Returns the initial descriptor heap size for the specified type. This should be large enough for all frames in flight.
 static UINT GetInitialDescriptorHeapSize(D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
     switch (type)
     {
-        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return 128;
-        default:                                    return 4096;
+        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+        default:                                    return 65536;
     }
 }
 
+template <typename T>
+static void CombineHash(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9E3779B9u + (seed << 6) + (seed >> 2);
+}
+
+std::size_t D3D12StagingDescriptorHeapPool::TableKeyHash::operator () (const TableKey& key) const
+{
+    std::size_t seed = 0;
+    CombineHash(seed, key.srcDescHandle);
+    CombineHash(seed, key.firstDescriptor);
+    CombineHash(seed, key.numDescriptors);
+    CombineHash(seed, key.contentVersion);
+    return seed;
+}
+
 D3D12StagingDescriptorHeapPool::D3D12StagingDescriptorHeapPool(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
     InitializeDevice(device, type);
@@ -43,80 +60,79 @@ D3D12StagingDescriptorHeapPool::D3D12StagingDescriptorHeapPool(ID3D12Device* dev
 
 void D3D12StagingDescriptorHeapPool::InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
-    chunks_.clear();
-    device_     = device;
-    type_       = type;
-    chunkSize_  = GetInitialDescriptorHeapSize(type);
-    AllocChunk(chunkSize_);
+    device_ = device;
+    type_   = type;
+    ringHeap_.Create(device, type, GetInitialDescriptorHeapSize(type));
+    ringHead_ = 0;
+    ringTail_ = 0;
+    for (UINT64& frameEnd : frameEnds_)
+        frameEnd = 0;
+    tableCache_.clear();
 }
 
-void D3D12StagingDescriptorHeapPool::Reset()
+void D3D12StagingDescriptorHeapPool::NextFrame(UINT frameIndex)
 {
-    pendingOffset_ = 0;
+    LLGL_ASSERT(frameIndex < D3D12StagingDescriptorHeapPool::maxNumFrames);
 
-    if (chunks_.size() > 1)
-    {
-        /* Try to consolidate chunks into a single one */
-        UINT accumulatedSize = 0;
-        for (const auto& chunk : chunks_)
-            accumulatedSize += chunk.GetSize();
+    /* Store end of current frame and reclaim everything up to the end of the previous use of the next frame */
+    frameEnds_[currentFrame_] = ringHead_;
+    currentFrame_ = frameIndex;
+    ringTail_ = std::max(ringTail_, frameEnds_[frameIndex]);
 
-        if (accumulatedSize <= GetMaxDescriptorHeapSize(type_))
-        {
-            /* Create single chunk with accumulated size */
-            chunks_.clear();
-            AllocChunk(accumulatedSize);
-        }
-        else
-            ResetChunks();
-    }
-    else
-        ResetChunks();
+    /* Release descriptor heaps that were replaced during the previous use of this frame */
+    retiredRingHeaps_[frameIndex].clear();
+
+    /* Descriptor tables can only be reused within the same frame */
+    tableCache_.clear();
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeapPool::CopyDescriptors(
     D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
     UINT                        firstDescriptor,
-    UINT                        numDescriptors)
+    UINT                        numDescriptors,
+    std::uint64_t               contentVersion)
 {
     LLGL_ASSERT_PTR(device_);
 
-    /* Apply pending offset */
-    IncrementOffset(pendingOffset_);
-
-    /* Find a chunk that fits the requested data size or allocate a new chunk */
-    while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(firstDescriptor + numDescriptors))
-        ++chunkIdx_;
-
-    if (chunkIdx_ == chunks_.size())
-        AllocChunk(numDescriptors);
+    /* Reuse descriptor table if the same source descriptors have already been copied during this frame */
+    const TableKey key{ srcDescHandle.ptr, firstDescriptor, numDescriptors, contentVersion };
+    if (contentVersion != 0)
+    {
+        auto it = tableCache_.find(key);
+        if (it != tableCache_.end())
+        {
+            lastTableOffset_ = it->second;
+            return GetGpuHandleWithOffset();
+        }
+    }
 
-    /* Copy descriptors into current chunk */
-    chunks_[chunkIdx_].CopyDescriptors(device_, srcDescHandle, firstDescriptor, numDescriptors);
+    /* Allocate new descriptor table in the ring and copy descriptors into it */
+    lastTableOffset_ = AllocRingRegion(firstDescriptor + numDescriptors);
+    ringHeap_.CopyDescriptors(device_, lastTableOffset_ + firstDescriptor, srcDescHandle, numDescriptors);
 
-    /* Store pending offset to be applied with the next copy operation */
-    pendingOffset_ = numDescriptors;
+    if (contentVersion != 0)
+        tableCache_[key] = lastTableOffset_;
 
     return GetGpuHandleWithOffset();
 }
 
 ID3D12DescriptorHeap* D3D12StagingDescriptorHeapPool::GetDescriptorHeap() const
 {
-    return (chunkIdx_ < chunks_.size() ? chunks_.back().GetNative() : nullptr);
+    return ringHeap_.GetNative();
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeapPool::GetGpuHandleWithOffset() const
 {
-    if (chunkIdx_ < chunks_.size())
-        return chunks_[chunkIdx_].GetGpuHandleWithOffset();
+    if (ringHeap_.GetNative() != nullptr)
+        return ringHeap_.GetGpuHandleWithOffset(lastTableOffset_);
     else
         return {};
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeapPool::GetCpuHandleWithOffset(UINT descriptor) const
 {
-    if (chunkIdx_ < chunks_.size())
-        return chunks_[chunkIdx_].GetCpuHandleWithOffset(descriptor);
+    if (ringHeap_.GetNative() != nullptr)
+        return ringHeap_.GetCpuHandleWithOffset(lastTableOffset_ + descriptor);
     else
         return {};
 }
@@ -126,25 +142,42 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeapPool::GetCpuHandleWithOffs
  * ======= Private: =======
  */
 
-void D3D12StagingDescriptorHeapPool::AllocChunk(UINT minNumDescriptors)
+UINT D3D12StagingDescriptorHeapPool::AllocRingRegion(UINT numDescriptors)
 {
-    chunkSize_ = std::max(chunkSize_, minNumDescriptors);
-    chunks_.emplace_back(device_, type_, chunkSize_);
-    chunkIdx_ = chunks_.size() - 1;
-}
+    /* Skip the remaining descriptors at the end of the ring if the region does not fit in there; regions never wrap around */
+    UINT64 ringSize = ringHeap_.GetSize();
+    UINT64 offset = ringHead_;
+    if (offset % ringSize + numDescriptors > ringSize)
+        offset = GetAlignedSize(offset, ringSize);
+
+    /* Grow ring if the new region would overlap with frames that are still in flight */
+    if (offset + numDescriptors - ringTail_ > ringSize)
+    {
+        GrowRing(numDescriptors);
+        ringSize = ringHeap_.GetSize();
+        offset = 0;
+    }
 
-void D3D12StagingDescriptorHeapPool::ResetChunks()
-{
-    /* Reset offsets of existing chunks */
-    for (auto& chunk : chunks_)
-        chunk.ResetOffset();
-    chunkIdx_ = 0;
+    ringHead_ = offset + numDescriptors;
+    return static_cast<UINT>(offset % ringSize);
 }
 
-void D3D12StagingDescriptorHeapPool::IncrementOffset(UINT stride)
+void D3D12StagingDescriptorHeapPool::GrowRing(UINT minNumDescriptors)
 {
-    if (chunkIdx_ < chunks_.size())
-        chunks_[chunkIdx_].IncrementOffset(stride);
+    /* Keep old descriptor heap alive until the current frame has been reclaimed, which implies all previous frames to be completed */
+    const UINT maxSize = GetMaxDescriptorHeapSize(type_);
+    const UINT newSize = std::min(maxSize, std::max(minNumDescriptors, ringHeap_.GetSize() * 2));
+    LLGL_ASSERT(minNumDescriptors <= newSize, "exceeded maximum size of shader-visible D3D12 descriptor heap");
+
+    retiredRingHeaps_[currentFrame_].push_back(std::move(ringHeap_));
+    ringHeap_.Create(device_, type_, newSize);
+
+    /* New descriptor heap is empty; previous frames and cached descriptor tables only refer to the retired heaps */
+    ringHead_ = 0;
+    ringTail_ = 0;
+    for (UINT64& frameEnd : frameEnds_)
+        frameEnd = 0;
+    tableCache_.clear();
 }
 
 
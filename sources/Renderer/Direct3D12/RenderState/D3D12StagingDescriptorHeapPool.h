@@ -11,6 +11,8 @@
 
 #include "D3D12StagingDescriptorHeap.h"
 #include <d3d12.h>
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 
@@ -19,60 +21,104 @@ namespace LLGL
 
 
 /*
-Pool of D3D12 staging descriptor heaps.
-The number of chunks in this pools is preferrably always 1, so the initial chunk should be allocated with a decent size.
+Ring allocator over a single shader-visible descriptor heap for descriptor tables during command encoding.
+Each frame (i.e. command allocator of a command context) occupies a contiguous region of the ring,
+which is reclaimed once the fence of that command allocator has been signaled (see NextFrame).
+Identical descriptor tables are only copied once per frame, so the ring rarely grows and the descriptor heap
+never has to be switched in the middle of a frame. If it grows nonetheless, the new descriptor heap must be bound again
+and all previously bound descriptor tables of this type are invalidated.
 */
 class D3D12StagingDescriptorHeapPool
 {
 
+    public:
+
+        static constexpr UINT maxNumFrames = 8;
+
     public:
 
         D3D12StagingDescriptorHeapPool() = default;
         D3D12StagingDescriptorHeapPool(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
 
-        // Initializes the device object and chunk size.
+        // Initializes the device object and creates the ring descriptor heap with the initial size for the specified type.
         void InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
 
-        // Resets all chunks in the pool.
-        void Reset();
-
-        // Copies the specified source descriptors into the native D3D descriptor heap.
+        /*
+        Switches to the specified frame and reclaims all ring descriptors that were allocated during the previous use of that frame.
+        The GPU must have finished executing all commands that were encoded with that frame.
+        */
+        void NextFrame(UINT frameIndex);
+
+        /*
+        Copies the specified source descriptors into the native D3D descriptor heap and returns the GPU handle of the new descriptor table.
+        If 'contentVersion' is non-zero, a descriptor table that has already been copied from the same source with the same version
+        during the current frame is reused. The version must change whenever the source descriptors are modified.
+        */
         D3D12_GPU_DESCRIPTOR_HANDLE CopyDescriptors(
             D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
             UINT                        firstDescriptor,
-            UINT                        numDescriptors
+            UINT                        numDescriptors,
+            std::uint64_t               contentVersion  = 0
         );
 
-        // Returns the current descriptor heap that was used for the last CopyDescriptors operation.
+        // Returns the native D3D descriptor heap of the ring. This changes only when the ring grows.
         ID3D12DescriptorHeap* GetDescriptorHeap() const;
 
-        // Returns the GPU descriptor handle at the current offset.
+        // Returns the GPU descriptor handle of the last descriptor table.
         D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandleWithOffset() const;
 
-        // Returns the CPU descriptor handle at the current offset plus the specified descriptor index.
+        // Returns the CPU descriptor handle of the last descriptor table plus the specified descriptor index.
         D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandleWithOffset(UINT descriptor) const;
 
     private:
 
-        // Allocates a new chunk with the specified minimal size.
-        void AllocChunk(UINT minNumDescriptors);
+        // Allocates a region in the ring descriptor heap and returns its offset within the native heap.
+        UINT AllocRingRegion(UINT numDescriptors);
+
+        // Replaces the ring descriptor heap by a larger one. The old descriptor heap is released with the current frame.
+        void GrowRing(UINT minNumDescriptors);
 
-        // Restes all previously allocated chunks.
-        void ResetChunks();
+    private:
 
-        // Increments the offset for the next range of descriptor handles.
-        void IncrementOffset(UINT stride);
+        // Identifies a descriptor table by its source descriptors.
+        struct TableKey
+        {
+            SIZE_T          srcDescHandle;
+            UINT            firstDescriptor;
+            UINT            numDescriptors;
+            std::uint64_t   contentVersion;
+
+            inline bool operator == (const TableKey& rhs) const
+            {
+                return
+                (
+                    srcDescHandle   == rhs.srcDescHandle    &&
+                    firstDescriptor == rhs.firstDescriptor  &&
+                    numDescriptors  == rhs.numDescriptors   &&
+                    contentVersion  == rhs.contentVersion
+                );
+            }
+        };
+
+        struct TableKeyHash
+        {
+            std::size_t operator () (const TableKey& key) const;
+        };
 
     private:
 
-        ID3D12Device*                           device_         = nullptr;
-        D3D12_DESCRIPTOR_HEAP_TYPE              type_           = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
+        ID3D12Device*                                       device_                     = nullptr;
+        D3D12_DESCRIPTOR_HEAP_TYPE                          type_                       = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
 
-        std::vector<D3D12StagingDescriptorHeap> chunks_;
-        std::size_t                             chunkIdx_       = 0;
-        UINT                                    chunkSize_      = 0;
+        D3D12StagingDescriptorHeap                          ringHeap_;
+        UINT64                                              ringHead_                   = 0; // Monotonically increasing; modulo ring size is the offset in the heap.
+        UINT64                                              ringTail_                   = 0; // End of the oldest frame that may still be in flight.
+        UINT64                                              frameEnds_[maxNumFrames]    = {};
+        UINT                                                currentFrame_               = 0;
+        std::vector<D3D12StagingDescriptorHeap>             retiredRingHeaps_[maxNumFrames];
+        UINT                                                lastTableOffset_            = 0;
 
-        UINT                                    pendingOffset_  = 0;
+        std::unordered_map<TableKey, UINT, TableKeyHash>    tableCache_;                     // Descriptor tables of the current frame.
 
 };
 
@@ -6,6 +6,7 @@
  */
 
 #include "D3D12RootSignature.h"
+#include "../RenderState/D3D12ObjectCache.h"
 #include "../../DXCommon/DXCore.h"
 #include <LLGL/Utils/ForRange.h>
 #include <stdint.h>
@@ -171,13 +172,13 @@ static ComPtr<ID3D12RootSignature> DXCreateRootSignature(
     }
     auto signature = DXSerializeRootSignature(signatureDesc, D3D_ROOT_SIGNATURE_VERSION_1);
 
-    /* Create actual root signature */
+    /* Create actual root signature or share an existing one with the same serialized blob */
     ComPtr<ID3D12RootSignature> rootSignature;
-    HRESULT hr = device->CreateRootSignature(
-        0,
+    HRESULT hr = D3D12ObjectCache::Get().CreateRootSignature(
+        device,
         signature->GetBufferPointer(),
         signature->GetBufferSize(),
-        IID_PPV_ARGS(rootSignature.ReleaseAndGetAddressOf())
+        rootSignature
     );
     DXThrowIfFailed(hr, "failed to create D3D12 root signature");
 
@@ -51,10 +51,21 @@ const Report* D3D12Shader::GetReport() const
 
 bool D3D12Shader::Reflect(ShaderReflection& reflection) const
 {
-    if (byteCode_)
-        return SUCCEEDED(ReflectShaderByteCode(reflection));
-    else
+    if (!byteCode_)
         return false;
+
+    /* Reflect identical byte code only once, since precompiled shaders are often created multiple times */
+    const std::uint64_t cacheKey = DXGetShaderReflectionCacheKey(byteCode_.Get(), GetType());
+    if (DXFindCachedShaderReflection(cacheKey, reflection))
+        return true;
+
+    ShaderReflection newReflection;
+    if (FAILED(ReflectShaderByteCode(newReflection)))
+        return false;
+
+    DXCacheShaderReflection(cacheKey, newReflection);
+    reflection = std::move(newReflection);
+    return true;
 }
 
 D3D12_SHADER_BYTECODE D3D12Shader::GetByteCode() const
@@ -281,12 +292,33 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
     const D3D_SHADER_MACRO* defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     int                     flags   = static_cast<int>(shaderDesc.flags);
 
+    #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
+    const bool              useDxc  = IsProfileDxcAppropriate(target);
+    #else
+    const bool              useDxc  = false;
+    #endif
+
+    /* Try to load byte code from persistent cache before invoking the compiler */
+    PersistentPipelineCache* bytecodeCache = renderSystem_.GetPersistentPipelineCache();
+    std::uint64_t cacheKey = 0;
+    if (bytecodeCache != nullptr || useDxc)
+        cacheKey = DXGetShaderCompilerCacheKey((useDxc ? "DXC" : "FXC"), sourceCode, sourceLength, defines, entry, target, flags);
+
+    if (bytecodeCache != nullptr)
+    {
+        if (Blob cachedByteCode = bytecodeCache->Find(cacheKey))
+        {
+            byteCode_ = DXCreateBlob(cachedByteCode.GetData(), cachedByteCode.GetSize());
+            return true;
+        }
+    }
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = S_OK;
 
     #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
-    if (IsProfileDxcAppropriate(target))
+    if (useDxc)
     {
         /* Load DXC compiler */
         if (FAILED(DXLoadDxcompilerInterface()))
@@ -333,7 +365,8 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
             compilerArgs.data(),
             compilerArgs.size(),
             byteCode_.ReleaseAndGetAddressOf(),
-            errors.ReleaseAndGetAddressOf()
+            errors.ReleaseAndGetAddressOf(),
+            cacheKey
         );
     }
     else
@@ -358,6 +391,11 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
     /* Return true if compilation was successful */
     const bool hasErrors = FAILED(hr);
     ResetReportWithNewline(report_, DXGetBlobString(errors.Get()), hasErrors);
+
+    /* Store byte code in persistent cache */
+    if (bytecodeCache != nullptr && !hasErrors && byteCode_)
+        bytecodeCache->Store(cacheKey, Blob::CreateCopy(byteCode_->GetBufferPointer(), byteCode_->GetBufferSize()));
+
     return !hasErrors;
 }
 
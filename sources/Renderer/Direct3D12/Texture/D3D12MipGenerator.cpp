@@ -12,6 +12,11 @@
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -57,6 +62,82 @@ HRESULT D3D12MipGenerator::GenerateMips(
     D3D12CommandContext&        commandContext,
     D3D12Texture&               texture,
     const TextureSubresource&   subresource)
+{
+    return GenerateMipsPrimary(commandContext, texture, subresource, true);
+}
+
+// Returns the sort key for MIP-map generation, so textures with the same root signature and pipeline class are adjacent.
+static int GetMipGenerationSortKey(const D3D12Texture& texture)
+{
+    const int formatClass = (DXTypes::IsDXGIFormatSRGB(texture.GetDXFormat()) ? 1 : 0);
+    switch (texture.GetType())
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            return formatClass;
+        case TextureType::Texture3D:
+            return 4 + formatClass;
+        default:
+            return 2 + formatClass;
+    }
+}
+
+void D3D12MipGenerator::GenerateMipsBatch(
+    D3D12CommandContext&    commandContext,
+    std::uint32_t           numTextures,
+    Texture* const *        textures)
+{
+    /* Gather all textures that have a MIP-map chain to generate */
+    SmallVector<D3D12Texture*, 16> texturesD3D;
+    texturesD3D.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        auto* textureD3D = LLGL_CAST(D3D12Texture*, textures[i]);
+        if (textureD3D->SupportsGenerateMips() && textureD3D->GetNumMipLevels() > 1 && textureD3D->GetMipDescHeap() != nullptr)
+            texturesD3D.push_back(textureD3D);
+    }
+
+    if (texturesD3D.empty())
+        return;
+
+    /* Sort textures by root signature and sRGB pipeline class, so each state is bound as rarely as possible */
+    std::stable_sort(
+        texturesD3D.begin(),
+        texturesD3D.end(),
+        [](const D3D12Texture* lhs, const D3D12Texture* rhs) -> bool
+        {
+            return (GetMipGenerationSortKey(*lhs) < GetMipGenerationSortKey(*rhs));
+        }
+    );
+
+    /* Transition all textures into UAV state with a single barrier batch */
+    for (D3D12Texture* textureD3D : texturesD3D)
+        commandContext.TransitionSubresources(textureD3D->GetResource(), textureD3D->GetWholeSubresource(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    commandContext.FlushResourceBarrieres();
+
+    for (D3D12Texture* textureD3D : texturesD3D)
+        GenerateMipsPrimary(commandContext, *textureD3D, textureD3D->GetWholeSubresource(), false);
+
+    /* Transition all textures back into their usage state with a single barrier batch */
+    for (D3D12Texture* textureD3D : texturesD3D)
+    {
+        D3D12Resource& resource = textureD3D->GetResource();
+        commandContext.TransitionSubresources(resource, textureD3D->GetWholeSubresource(), resource.usageState);
+    }
+    commandContext.FlushResourceBarrieres();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+HRESULT D3D12MipGenerator::GenerateMipsPrimary(
+    D3D12CommandContext&        commandContext,
+    D3D12Texture&               texture,
+    const TextureSubresource&   subresource,
+    bool                        transitionResource)
 {
     if (!texture.SupportsGenerateMips())
     {
@@ -88,18 +169,18 @@ HRESULT D3D12MipGenerator::GenerateMips(
     {
         case TextureType::Texture1D:
         case TextureType::Texture1DArray:
-            GenerateMips1D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource);
+            GenerateMips1D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource, transitionResource);
             return S_OK;
 
         case TextureType::Texture2D:
         case TextureType::TextureCube:
         case TextureType::Texture2DArray:
         case TextureType::TextureCubeArray:
-            GenerateMips2D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource);
+            GenerateMips2D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource, transitionResource);
             return S_OK;
 
         case TextureType::Texture3D:
-            GenerateMips3D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource);
+            GenerateMips3D(commandContext, texture.GetResource(), mipDescHeap, texture.GetDXFormat(), subresource, transitionResource);
             return S_OK;
 
         case TextureType::Texture2DMS:
@@ -113,10 +194,6 @@ HRESULT D3D12MipGenerator::GenerateMips(
 }
 
 
-/*
- * ======= Private: =======
- */
-
 ComPtr<ID3D12PipelineState> D3D12MipGenerator::CreateComputePSO(
     ID3D12Device*           device,
     ID3D12RootSignature*    rootSignature,
@@ -228,13 +305,15 @@ void D3D12MipGenerator::GenerateMips1D(
     D3D12Resource&              resource,
     ID3D12DescriptorHeap*       mipDescHeap,
     DXGI_FORMAT                 format,
-    const TextureSubresource&   subresource)
+    const TextureSubresource&   subresource,
+    bool                        transitionResource)
 {
     const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(format);
 
     ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
 
-    commandContext.TransitionResource(resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
 
     /* Set root signature and descriptor heap */
     commandContext.SetComputeRootSignature(rootSignature1D_.Get());
@@ -270,10 +349,14 @@ void D3D12MipGenerator::GenerateMips1D(
         UINT numMips = (mipLevel + 8 >= mipLevelEnd ? mipLevelEnd - mipLevel : 8);
 
         /* Run compute shader to generate next four MIP-maps */
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
-        commandContext.SetComputeConstant(0, mipLevel, 1);
-        commandContext.SetComputeConstant(0, numMips, 2);
-        commandContext.SetComputeConstant(0, subresource.baseArrayLayer, 3);
+        const D3D12Constant constants[] =
+        {
+            1.0f / static_cast<float>(dstWidth),
+            mipLevel,
+            numMips,
+            subresource.baseArrayLayer,
+        };
+        commandContext.SetComputeConstants(0, constants, static_cast<UINT>(LLGL_ARRAY_LENGTH(constants)), 0);
 
         commandList->SetComputeRootDescriptorTable(2, gpuDescHandle);
         gpuDescHandle.ptr += descHandleSize_ * numMips;
@@ -290,7 +373,8 @@ void D3D12MipGenerator::GenerateMips1D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, resource.usageState, true);
 }
 
 void D3D12MipGenerator::GenerateMips2D(
@@ -298,13 +382,15 @@ void D3D12MipGenerator::GenerateMips2D(
     D3D12Resource&              resource,
     ID3D12DescriptorHeap*       mipDescHeap,
     DXGI_FORMAT                 format,
-    const TextureSubresource&   subresource)
+    const TextureSubresource&   subresource,
+    bool                        transitionResource)
 {
     const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(format);
 
     ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
 
-    commandContext.TransitionResource(resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
 
     /* Set root signature and descriptor heap */
     commandContext.SetComputeRootSignature(rootSignature2D_.Get());
@@ -342,11 +428,15 @@ void D3D12MipGenerator::GenerateMips2D(
         UINT numMips = (mipLevel + 4 >= mipLevelEnd ? mipLevelEnd - mipLevel : 4);
 
         /* Run compute shader to generate next four MIP-maps */
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstHeight), 1);
-        commandContext.SetComputeConstant(0, mipLevel, 2);
-        commandContext.SetComputeConstant(0, numMips, 3);
-        commandContext.SetComputeConstant(0, subresource.baseArrayLayer, 4);
+        const D3D12Constant constants[] =
+        {
+            1.0f / static_cast<float>(dstWidth),
+            1.0f / static_cast<float>(dstHeight),
+            mipLevel,
+            numMips,
+            subresource.baseArrayLayer,
+        };
+        commandContext.SetComputeConstants(0, constants, static_cast<UINT>(LLGL_ARRAY_LENGTH(constants)), 0);
 
         commandList->SetComputeRootDescriptorTable(2, gpuDescHandle);
         gpuDescHandle.ptr += descHandleSize_ * numMips;
@@ -363,7 +453,8 @@ void D3D12MipGenerator::GenerateMips2D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, resource.usageState, true);
 }
 
 void D3D12MipGenerator::GenerateMips3D(
@@ -371,13 +462,15 @@ void D3D12MipGenerator::GenerateMips3D(
     D3D12Resource&              resource,
     ID3D12DescriptorHeap*       mipDescHeap,
     DXGI_FORMAT                 format,
-    const TextureSubresource&   subresource)
+    const TextureSubresource&   subresource,
+    bool                        transitionResource)
 {
     const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(format);
 
     ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
 
-    commandContext.TransitionResource(resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
 
     /* Set root signature and descriptor heap */
     commandContext.SetComputeRootSignature(rootSignature3D_.Get());
@@ -417,11 +510,15 @@ void D3D12MipGenerator::GenerateMips3D(
         UINT numMips = (mipLevel + 3 >= mipLevelEnd ? mipLevelEnd - mipLevel : 3);
 
         /* Run compute shader to generate next four MIP-maps */
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstHeight), 1);
-        commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstDepth), 2);
-        commandContext.SetComputeConstant(0, mipLevel, 3);
-        commandContext.SetComputeConstant(0, numMips, 4);
+        const D3D12Constant constants[] =
+        {
+            1.0f / static_cast<float>(dstWidth),
+            1.0f / static_cast<float>(dstHeight),
+            1.0f / static_cast<float>(dstDepth),
+            mipLevel,
+            numMips,
+        };
+        commandContext.SetComputeConstants(0, constants, static_cast<UINT>(LLGL_ARRAY_LENGTH(constants)), 0);
 
         commandList->SetComputeRootDescriptorTable(2, gpuDescHandle);
         gpuDescHandle.ptr += descHandleSize_ * numMips;
@@ -438,7 +535,8 @@ void D3D12MipGenerator::GenerateMips3D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    if (transitionResource)
+        commandContext.TransitionSubresources(resource, subresource, resource.usageState, true);
 }
 
 
@@ -51,10 +51,28 @@ class D3D12MipGenerator
             const TextureSubresource&   subresource
         );
 
+        /*
+        Generates the entire MIP-map chain for each texture in the specified array.
+        All textures are transitioned with a single barrier batch and sorted by root signature and pipeline class.
+        */
+        void GenerateMipsBatch(
+            D3D12CommandContext&        commandContext,
+            std::uint32_t               numTextures,
+            Texture* const *            textures
+        );
+
     private:
 
         D3D12MipGenerator() = default;
 
+        // Generates the specified MIP-maps and transitions the texture into UAV state and back only if 'transitionResource' is true.
+        HRESULT GenerateMipsPrimary(
+            D3D12CommandContext&        commandContext,
+            D3D12Texture&               texture,
+            const TextureSubresource&   subresource,
+            bool                        transitionResource
+        );
+
         ComPtr<ID3D12PipelineState> CreateComputePSO(
             ID3D12Device*           device,
             ID3D12RootSignature*    rootSignature,
@@ -71,7 +89,8 @@ class D3D12MipGenerator
             D3D12Resource&              resource,
             ID3D12DescriptorHeap*       mipDescHeap,
             DXGI_FORMAT                 format,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            bool                        transitionResource
         );
 
         void GenerateMips2D(
@@ -79,7 +98,8 @@ class D3D12MipGenerator
             D3D12Resource&              resource,
             ID3D12DescriptorHeap*       mipDescHeap,
             DXGI_FORMAT                 format,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            bool                        transitionResource
         );
 
         void GenerateMips3D(
@@ -87,7 +107,8 @@ class D3D12MipGenerator
             D3D12Resource&              resource,
             ID3D12DescriptorHeap*       mipDescHeap,
             DXGI_FORMAT                 format,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            bool                        transitionResource
         );
 
     private:
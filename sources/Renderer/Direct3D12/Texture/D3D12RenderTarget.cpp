@@ -17,10 +17,12 @@
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/Exception.h"
 #include "../D3DX12/d3dx12.h"
 #include <LLGL/Utils/ForRange.h>
+#include <string.h>
 
 
 namespace LLGL
@@ -35,7 +37,7 @@ D3D12RenderTarget::D3D12RenderTarget(D3D12Device& device, const RenderTargetDesc
 
     CreateDescriptorHeaps(device.GetNative(), numColorFormats);
     CreateAttachments(device.GetNative(), desc, colorFormats);
-    defaultRenderPass_.BuildAttachments(numColorFormats, colorFormats.data(), depthStencilFormat_, sampleDesc_);
+    defaultRenderPass_.BuildAttachments(numColorFormats, colorFormats.data(), depthStencilFormat_, sampleDesc_, viewMask_);
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -79,13 +81,36 @@ const RenderPass* D3D12RenderTarget::GetRenderPass() const
 
 void D3D12RenderTarget::TransitionToOutputMerger(D3D12CommandContext& commandContext)
 {
-    for (auto& resource : colorBuffers_)
-        commandContext.TransitionResource(*resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    /* Activate transient attachments within their aliasing heaps before they are transitioned */
+    std::uint32_t discardColorBufferBits = 0;
+    bool discardDepthStencil = false;
+
+    for_range(i, colorBuffers_.size())
+    {
+        if (colorBuffers_[i]->aliasingHeap != nullptr && commandContext.AliasResource(*colorBuffers_[i]))
+            discardColorBufferBits |= (1u << i);
+    }
+
+    if (depthStencil_ != nullptr && depthStencil_->aliasingHeap != nullptr)
+        discardDepthStencil = commandContext.AliasResource(*depthStencil_);
+
+    for_range(i, colorBuffers_.size())
+        commandContext.TransitionSubresource(*colorBuffers_[i], colorSubresources_[i], D3D12_RESOURCE_STATE_RENDER_TARGET);
 
     if (depthStencil_ != nullptr)
-        commandContext.TransitionResource(*depthStencil_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+        commandContext.TransitionSubresource(*depthStencil_, depthStencilSubresource_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
 
     commandContext.FlushResourceBarrieres();
+
+    /* Initialize newly activated transient attachments; their previous content has been overwritten by other aliased textures */
+    for_range(i, colorBuffers_.size())
+    {
+        if ((discardColorBufferBits & (1u << i)) != 0)
+            commandContext.DiscardSubresource(*colorBuffers_[i], colorSubresources_[i]);
+    }
+
+    if (discardDepthStencil)
+        commandContext.DiscardSubresource(*depthStencil_, depthStencilSubresource_);
 }
 
 void D3D12RenderTarget::ResolveSubresources(D3D12CommandContext& commandContext)
@@ -105,12 +130,134 @@ void D3D12RenderTarget::ResolveSubresources(D3D12CommandContext& commandContext)
     }
     else
     {
-        for (auto& resource : colorBuffers_)
-            commandContext.TransitionResource(*resource, resource->usageState);
+        /* Begin split barriers, so the transitions can overlap with the commands until the attachments are used next */
+        for_range(i, colorBuffers_.size())
+            commandContext.BeginTransitionSubresource(*colorBuffers_[i], colorSubresources_[i], colorBuffers_[i]->usageState);
+    }
+
+    if (depthStencil_ != nullptr)
+        commandContext.BeginTransitionSubresource(*depthStencil_, depthStencilSubresource_, depthStencil_->usageState);
+
+    commandContext.FlushResourceBarrieres();
+}
+
+void D3D12RenderTarget::BeginNativeRenderPass(
+    D3D12CommandContext&    commandContext,
+    const D3D12RenderPass&  renderPass,
+    std::uint32_t           numClearValues,
+    const ClearValue*       clearValues)
+{
+    TransitionToOutputMerger(commandContext);
+
+    /* Resolve destinations must be in resolve-dest state when the render pass ends */
+    for (const ResolveTarget& target : resolveTargets_)
+        commandContext.TransitionSubresource(*target.resolveDstTexture, target.resolveDstSubresource, D3D12_RESOURCE_STATE_RESOLVE_DEST);
+
+    /* Clear values are consumed in the same order as for D3D12CommandBuffer::ClearAttachmentsWithRenderPass */
+    std::uint32_t clearValueIndex = 0;
+
+    const UINT          numColorTargets = static_cast<UINT>(colorBuffers_.size());
+    const DXGI_FORMAT*  rtvFormats      = defaultRenderPass_.GetRTVFormats();
+
+    D3D12_RENDER_PASS_RENDER_TARGET_DESC                            renderTargetDescs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS  resolveParams[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvDescHandle = GetCPUDescriptorHandleForRTV();
+
+    for_range(i, numColorTargets)
+    {
+        D3D12_RENDER_PASS_RENDER_TARGET_DESC& renderTargetDesc = renderTargetDescs[i];
+
+        renderTargetDesc.cpuDescriptor = rtvDescHandle;
+        rtvDescHandle.ptr += rtvDescSize_;
+
+        /* Convert beginning access */
+        renderTargetDesc.BeginningAccess.Type = renderPass.GetColorBeginningAccess(i);
+        if (renderTargetDesc.BeginningAccess.Type == D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR)
+        {
+            D3D12_CLEAR_VALUE& clearValue = renderTargetDesc.BeginningAccess.Clear.ClearValue;
+            clearValue.Format = rtvFormats[i];
+            if (clearValueIndex < numClearValues)
+                ::memcpy(clearValue.Color, clearValues[clearValueIndex].color, sizeof(clearValue.Color));
+            else
+                ::memset(clearValue.Color, 0, sizeof(clearValue.Color));
+            ++clearValueIndex;
+        }
+
+        /* Convert ending access */
+        renderTargetDesc.EndingAccess.Type = renderPass.GetColorEndingAccess(i);
+    }
+
+    /* Replace ending access of multi-sampled attachments with native resolve operations */
+    for (const ResolveTarget& target : resolveTargets_)
+    {
+        D3D12_RENDER_PASS_ENDING_ACCESS& endingAccess = renderTargetDescs[target.colorAttachment].EndingAccess;
+        D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS& subresourceParams = resolveParams[target.colorAttachment];
+        {
+            subresourceParams.SrcSubresource    = 0;
+            subresourceParams.DstSubresource    = target.resolveDstSubresource;
+            subresourceParams.DstX              = 0;
+            subresourceParams.DstY              = 0;
+            subresourceParams.SrcRect           = CD3DX12_RECT(0, 0, static_cast<LONG>(resolution_.width), static_cast<LONG>(resolution_.height));
+        }
+        const bool preserveResolveSource = (endingAccess.Type == D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE);
+        endingAccess.Type = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE;
+        {
+            endingAccess.Resolve.pSrcResource           = target.multiSampledSrcTexture->native.Get();
+            endingAccess.Resolve.pDstResource           = target.resolveDstTexture->native.Get();
+            endingAccess.Resolve.SubresourceCount       = 1;
+            endingAccess.Resolve.pSubresourceParameters = &subresourceParams;
+            endingAccess.Resolve.Format                 = target.format;
+            endingAccess.Resolve.ResolveMode            = D3D12_RESOLVE_MODE_AVERAGE;
+            endingAccess.Resolve.PreserveResolveSource  = (preserveResolveSource ? TRUE : FALSE);
+        }
+    }
+
+    /* Convert depth-stencil access */
+    D3D12_RENDER_PASS_DEPTH_STENCIL_DESC depthStencilDesc;
+    if (depthStencil_ != nullptr)
+    {
+        D3D12_CLEAR_VALUE clearValue;
+        {
+            clearValue.Format               = defaultRenderPass_.GetDSVFormat();
+            clearValue.DepthStencil.Depth   = 1.0f;
+            clearValue.DepthStencil.Stencil = 0;
+            if (clearValueIndex < numClearValues)
+            {
+                clearValue.DepthStencil.Depth   = clearValues[clearValueIndex].depth;
+                clearValue.DepthStencil.Stencil = static_cast<UINT8>(clearValues[clearValueIndex].stencil & 0xff);
+            }
+        }
+
+        depthStencilDesc.cpuDescriptor                              = GetCPUDescriptorHandleForDSV();
+        depthStencilDesc.DepthBeginningAccess.Type                  = renderPass.GetDepthBeginningAccess();
+        depthStencilDesc.DepthBeginningAccess.Clear.ClearValue      = clearValue;
+        depthStencilDesc.StencilBeginningAccess.Type                = renderPass.GetStencilBeginningAccess();
+        depthStencilDesc.StencilBeginningAccess.Clear.ClearValue    = clearValue;
+        depthStencilDesc.DepthEndingAccess.Type                     = renderPass.GetDepthEndingAccess();
+        depthStencilDesc.StencilEndingAccess.Type                   = renderPass.GetStencilEndingAccess();
+    }
+
+    commandContext.BeginRenderPass(numColorTargets, renderTargetDescs, (depthStencil_ != nullptr ? &depthStencilDesc : nullptr));
+}
+
+void D3D12RenderTarget::EndNativeRenderPass(D3D12CommandContext& commandContext)
+{
+    commandContext.EndRenderPass();
+
+    /* Transition resolve destinations back to their usage state */
+    for (const ResolveTarget& target : resolveTargets_)
+        commandContext.TransitionSubresource(*target.resolveDstTexture, target.resolveDstSubresource, target.resolveDstTexture->usageState);
+
+    /* Begin split barriers, so the transitions can overlap with the commands until the attachments are used next */
+    if (!HasMultiSampling())
+    {
+        for_range(i, colorBuffers_.size())
+            commandContext.BeginTransitionSubresource(*colorBuffers_[i], colorSubresources_[i], colorBuffers_[i]->usageState);
     }
 
     if (depthStencil_ != nullptr)
-        commandContext.TransitionResource(*depthStencil_, depthStencil_->usageState);
+        commandContext.BeginTransitionSubresource(*depthStencil_, depthStencilSubresource_, depthStencil_->usageState);
 
     commandContext.FlushResourceBarrieres();
 }
@@ -191,6 +338,7 @@ UINT D3D12RenderTarget::GatherAttachmentFormats(D3D12Device& device, const Rende
 
     /* Pre-allocate containers to avoid dangling pointers after std::vector::push_back() */
     colorBuffers_.reserve(outColorFormats.size());
+    colorSubresources_.reserve(outColorFormats.size());
     internalTextures_.reserve(NumInternalTexturesForAttachments(desc));
 
     return static_cast<UINT>(outColorFormats.size());
@@ -235,14 +383,18 @@ void D3D12RenderTarget::CreateAttachments(
     const RenderTargetDescriptor&   desc,
     const ColorFormatVector&        colorFormats)
 {
+    /* Attachments of a multiview render pass cover one array layer per view */
+    if (auto* renderPassD3D = GetD3DRenderPass(desc.renderPass))
+        viewMask_ = renderPassD3D->GetViewMask();
+
     if (rtvDescHeap_)
     {
         D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = rtvDescHeap_->GetCPUDescriptorHandleForHeapStart();
-        const UINT rtvDescSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+        rtvDescSize_ = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
         for_range(i, colorFormats.size())
         {
             CreateColorAttachment(device, desc.colorAttachments[i], desc.resolveAttachments[i], colorFormats[i], cpuDescHandle);
-            cpuDescHandle.ptr += rtvDescSize;
+            cpuDescHandle.ptr += rtvDescSize_;
         }
     }
     if (dsvDescHeap_)
@@ -261,6 +413,7 @@ void D3D12RenderTarget::CreateColorAttachment(
     D3D12_CPU_DESCRIPTOR_HANDLE     cpuDescHandle)
 {
     D3D12Resource* colorBuffer = nullptr;
+    UINT colorSubresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
 
     /* Create color attachment */
     if (Texture* texture = colorAttachment.texture)
@@ -268,6 +421,8 @@ void D3D12RenderTarget::CreateColorAttachment(
         ValidateMipResolution(*texture, colorAttachment.mipLevel);
         auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
         colorBuffer = &(textureD3D.GetResource());
+        if (viewMask_ == 0)
+            colorSubresource = textureD3D.CalcSubresource(TextureLocation{ Offset3D{}, colorAttachment.arrayLayer, colorAttachment.mipLevel });
         CreateRenderTargetView(
             device,
             *colorBuffer,
@@ -296,6 +451,7 @@ void D3D12RenderTarget::CreateColorAttachment(
     LLGL_ASSERT_PTR(colorBuffer);
     LLGL_ASSERT_PTR(colorBuffer->native.Get());
     colorBuffers_.push_back(colorBuffer);
+    colorSubresources_.push_back(colorSubresource);
 }
 
 void D3D12RenderTarget::CreateDepthStencilAttachment(
@@ -310,6 +466,8 @@ void D3D12RenderTarget::CreateDepthStencilAttachment(
         ValidateMipResolution(*texture, depthStenciAttachment.mipLevel);
         auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
         depthStencil_ = &(textureD3D.GetResource());
+        if (viewMask_ == 0)
+            depthStencilSubresource_ = textureD3D.CalcSubresource(TextureLocation{ Offset3D{}, depthStenciAttachment.arrayLayer, depthStenciAttachment.mipLevel });
         CreateDepthStencilView(
             device,
             *depthStencil_,
@@ -381,7 +539,8 @@ void D3D12RenderTarget::CreateRenderTargetView(
     UINT                        arrayLayer,
     D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
-    /* Initialize D3D12 RTV descriptor */
+    /* Initialize D3D12 RTV descriptor; multiview render passes select the array layer with SV_ViewID */
+    const UINT numViews = NumRenderPassViews(viewMask_);
     D3D12_RENDER_TARGET_VIEW_DESC rtvDesc;
     rtvDesc.Format = DXTypes::ToDXGIFormatRTV(format);
 
@@ -411,7 +570,7 @@ void D3D12RenderTarget::CreateRenderTargetView(
             rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
             rtvDesc.Texture2DArray.MipSlice             = mipLevel;
             rtvDesc.Texture2DArray.FirstArraySlice      = arrayLayer;
-            rtvDesc.Texture2DArray.ArraySize            = 1;
+            rtvDesc.Texture2DArray.ArraySize            = numViews;
             rtvDesc.Texture2DArray.PlaneSlice           = 0;
             break;
 
@@ -429,7 +588,7 @@ void D3D12RenderTarget::CreateRenderTargetView(
         case TextureType::Texture2DMSArray:
             rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY;
             rtvDesc.Texture2DMSArray.FirstArraySlice    = arrayLayer;
-            rtvDesc.Texture2DMSArray.ArraySize          = 1;
+            rtvDesc.Texture2DMSArray.ArraySize          = numViews;
             break;
 
     }
@@ -447,7 +606,8 @@ void D3D12RenderTarget::CreateDepthStencilView(
     UINT                arrayLayer,
     D3D12_DSV_FLAGS     dsvFlags)
 {
-    /* Initialize D3D12 RTV descriptor */
+    /* Initialize D3D12 RTV descriptor; multiview render passes select the array layer with SV_ViewID */
+    const UINT numViews = NumRenderPassViews(viewMask_);
     D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc;
     dsvDesc.Format  = DXTypes::ToDXGIFormatDSV(format);
     dsvDesc.Flags   = dsvFlags;
@@ -471,7 +631,7 @@ void D3D12RenderTarget::CreateDepthStencilView(
             dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DARRAY;
             dsvDesc.Texture2DArray.MipSlice             = mipLevel;
             dsvDesc.Texture2DArray.FirstArraySlice      = arrayLayer;
-            dsvDesc.Texture2DArray.ArraySize            = 1;
+            dsvDesc.Texture2DArray.ArraySize            = numViews;
             break;
 
         case TextureType::Texture1DArray:
@@ -488,7 +648,7 @@ void D3D12RenderTarget::CreateDepthStencilView(
         case TextureType::Texture2DMSArray:
             dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY;
             dsvDesc.Texture2DMSArray.FirstArraySlice    = arrayLayer;
-            dsvDesc.Texture2DMSArray.ArraySize          = 1;
+            dsvDesc.Texture2DMSArray.ArraySize          = numViews;
             break;
     }
 
@@ -512,6 +672,7 @@ void D3D12RenderTarget::CreateResolveTarget(
         resolveTarget.resolveDstSubresource     = textureD3D.CalcSubresource(resolveAttachment.mipLevel, resolveAttachment.arrayLayer);
         resolveTarget.multiSampledSrcTexture    = multiSampledSrcTexture;
         resolveTarget.format                    = format;
+        resolveTarget.colorAttachment           = static_cast<UINT>(colorBuffers_.size());
     }
     resolveTargets_.push_back(resolveTarget);
 }
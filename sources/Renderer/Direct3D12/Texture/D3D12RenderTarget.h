@@ -10,6 +10,7 @@
 
 
 #include <LLGL/RenderTarget.h>
+#include <LLGL/CommandBufferFlags.h>
 #include <LLGL/Container/SmallVector.h>
 #include "../D3D12Resource.h"
 #include "../RenderState/D3D12RenderPass.h"
@@ -43,6 +44,17 @@ class D3D12RenderTarget final : public RenderTarget
         void TransitionToOutputMerger(D3D12CommandContext& commandContext);
         void ResolveSubresources(D3D12CommandContext& commandContext);
 
+        // Transitions all attachments and begins a native render pass with the load and store operations of the specified render pass.
+        void BeginNativeRenderPass(
+            D3D12CommandContext&    commandContext,
+            const D3D12RenderPass&  renderPass,
+            std::uint32_t           numClearValues,
+            const ClearValue*       clearValues
+        );
+
+        // Ends the native render pass. Multi-sampled attachments have already been resolved by the render pass itself.
+        void EndNativeRenderPass(D3D12CommandContext& commandContext);
+
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForRTV() const;
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForDSV() const;
 
@@ -52,6 +64,12 @@ class D3D12RenderTarget final : public RenderTarget
             return (sampleDesc_.Count > 1);
         }
 
+        // Returns the bitmask of view instances of the multiview render pass this render target was created with, or 0 if view instancing is disabled.
+        inline UINT GetViewMask() const
+        {
+            return viewMask_;
+        }
+
     private:
 
         using ColorFormatVector = SmallVector<DXGI_FORMAT, LLGL_MAX_NUM_COLOR_ATTACHMENTS>;
@@ -124,12 +142,15 @@ class D3D12RenderTarget final : public RenderTarget
             UINT            resolveDstSubresource;
             D3D12Resource*  multiSampledSrcTexture;
             DXGI_FORMAT     format;
+            UINT            colorAttachment;
         };
 
     private:
 
         Extent2D                        resolution_;
         DXGI_SAMPLE_DESC                sampleDesc_         = { 1, 0 };
+        UINT                            viewMask_           = 0;
+        UINT                            rtvDescSize_        = 0;
 
         // Objects:
         ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
@@ -140,8 +161,10 @@ class D3D12RenderTarget final : public RenderTarget
         // Containers and references:
         std::vector<D3D12Resource>      internalTextures_;
         std::vector<D3D12Resource*>     colorBuffers_;
+        std::vector<UINT>               colorSubresources_;
         std::vector<ResolveTarget>      resolveTargets_;
-        D3D12Resource*                  depthStencil_       = nullptr;
+        D3D12Resource*                  depthStencil_               = nullptr;
+        UINT                            depthStencilSubresource_    = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
 
 };
 
@@ -9,15 +9,47 @@
 #include "../Shader/D3D12RootParameter.h"
 #include "../D3D12Types.h"
 #include "../../ResourceUtils.h"
+#include <atomic>
 
 
 namespace LLGL
 {
 
 
-D3D12Sampler::D3D12Sampler(const SamplerDescriptor& desc)
+/*
+ * D3D12SamplerID class
+ */
+
+D3D12SamplerID::D3D12SamplerID()
+{
+    static std::atomic<std::uint64_t> g_samplerIDCounter{ 0 };
+    id_ = ++g_samplerIDCounter;
+}
+
+
+/*
+ * D3D12Sampler class
+ */
+
+D3D12Sampler::D3D12Sampler(D3D12SamplerPool& samplerPool, const SamplerDescriptor& desc) :
+    samplerPool_ { samplerPool }
 {
+    /* Zero-initialize descriptor including its padding bytes, since the pool compares descriptors bytewise */
+    nativeDesc_ = {};
     D3D12Sampler::ConvertDesc(nativeDesc_, desc);
+
+    sharedID_ = samplerPool.Acquire(
+        nativeDesc_,
+        [](const D3D12_SAMPLER_DESC& /*nativeDesc*/) -> D3D12SamplerID
+        {
+            return D3D12SamplerID{};
+        }
+    );
+}
+
+D3D12Sampler::~D3D12Sampler()
+{
+    samplerPool_.Release(sharedID_);
 }
 
 void D3D12Sampler::CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle)
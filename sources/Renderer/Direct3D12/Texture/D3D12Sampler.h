@@ -11,22 +11,60 @@
 
 #include <LLGL/Sampler.h>
 #include <LLGL/PipelineLayoutFlags.h>
+#include "../../SharedStatePool.h"
 #include <d3d12.h>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+/*
+Unique ID of a native D3D12 sampler descriptor. IDs are never reused, so they remain unique even after all samplers of an ID have been released.
+This is the object type of D3D12SamplerPool, i.e. it provides the Get() accessor.
+*/
+class D3D12SamplerID
+{
+
+    public:
+
+        // Allocates a new non-zero ID.
+        D3D12SamplerID();
+
+        inline std::uint64_t Get() const
+        {
+            return id_;
+        }
+
+    private:
+
+        std::uint64_t id_ = 0;
+
+};
+
+/*
+Pool of sampler IDs that are shared between all samplers with identical native descriptors.
+The descriptor cache compares samplers by this ID, so identical samplers don't occupy separate sampler descriptors.
+*/
+using D3D12SamplerPool = SharedStatePool<D3D12_SAMPLER_DESC, D3D12SamplerID>;
+
 class D3D12Sampler final : public Sampler
 {
 
     public:
 
-        D3D12Sampler(const SamplerDescriptor& desc);
+        D3D12Sampler(D3D12SamplerPool& samplerPool, const SamplerDescriptor& desc);
+        ~D3D12Sampler();
 
         void CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle);
 
+        // Returns the ID that is shared between all samplers with identical native descriptors.
+        inline std::uint64_t GetSharedID() const
+        {
+            return sharedID_;
+        }
+
     public:
 
         // Converts the input sampler into a native D3D12 sampler descriptor.
@@ -37,7 +75,9 @@ class D3D12Sampler final : public Sampler
 
     private:
 
-        D3D12_SAMPLER_DESC nativeDesc_;
+        D3D12SamplerPool&   samplerPool_;
+        D3D12_SAMPLER_DESC  nativeDesc_;
+        std::uint64_t       sharedID_       = 0;
 
 };
 
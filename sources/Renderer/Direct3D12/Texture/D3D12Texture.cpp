@@ -6,6 +6,7 @@
  */
 
 #include "D3D12Texture.h"
+#include "D3D12TransientHeapPool.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../D3D12SubresourceContext.h"
 #include "../D3D12ObjectUtils.h"
@@ -15,16 +16,23 @@
 #include "../../DXCommon/DXCore.h"
 #include "../../TextureUtils.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/ImageUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
+#include <atomic>
+#include <string.h>
 
 
 namespace LLGL
 {
 
 
-D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc) :
+// Incremented whenever the min-LOD clamp of any texture changes, so resource heaps can skip their descriptor refresh in the common case.
+static std::atomic<std::uint64_t> g_minLODGeneration{ 0 };
+
+D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc, D3D12TransientHeapPool* transientHeapPool) :
     Texture         { desc.type, desc.bindFlags          },
     baseFormat_     { desc.format                        },
     format_         { DXTypes::ToDXGIFormat(desc.format) },
@@ -32,7 +40,7 @@ D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc)
     numArrayLayers_ { std::max(1u, desc.arrayLayers)     },
     extent_         { desc.extent                        }
 {
-    CreateNativeTexture(device, desc);
+    CreateNativeTexture(device, desc, transientHeapPool);
 
     if (SupportsGenerateMips())
         CreateMipDescHeap(device);
@@ -46,6 +54,50 @@ void D3D12Texture::SetDebugName(const char* name)
     D3D12SetObjectName(resource_.Get(), name);
 }
 
+bool D3D12Texture::SetResidencyPriority(ResidencyPriority priority)
+{
+    return D3D12SetResidencyPriority(resource_, D3D12Types::Map(priority));
+}
+
+bool D3D12Texture::Evict()
+{
+    return D3D12EvictResource(resource_);
+}
+
+bool D3D12Texture::MakeResident()
+{
+    return D3D12MakeResourceResident(resource_);
+}
+
+bool D3D12Texture::GetSparseProperties(SparseTextureProperties& outProperties) const
+{
+    if (!isSparse_)
+        return false;
+
+    outProperties.tileSize          = Extent3D{ tileShape_.WidthInTexels, tileShape_.HeightInTexels, tileShape_.DepthInTexels };
+    outProperties.numStandardMips   = packedMipInfo_.NumStandardMips;
+    outProperties.tileMemorySize    = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    return true;
+}
+
+bool D3D12Texture::SetMinLOD(float minLOD)
+{
+    /* Multi-sampled textures have no MIP-maps and their SRVs have no min-LOD clamp */
+    if (IsMultiSampleTexture(GetType()))
+        return false;
+
+    /* Descriptors are only updated lazily, i.e. the next time they are created or a resource heap that refers to this texture is bound */
+    if (minLOD_.exchange(minLOD) != minLOD)
+        ++g_minLODGeneration;
+
+    return true;
+}
+
+std::uint64_t D3D12Texture::GetMinLODGeneration()
+{
+    return g_minLODGeneration.load();
+}
+
 Extent3D D3D12Texture::GetMipExtent(std::uint32_t mipLevel) const
 {
     Extent3D size;
@@ -103,7 +155,7 @@ TextureDescriptor D3D12Texture::GetDesc() const
 
     texDesc.type        = GetType();
     texDesc.bindFlags   = GetBindFlags();
-    texDesc.miscFlags   = 0;
+    texDesc.miscFlags   = (IsTransient() ? MiscFlags::Transient : 0);
     texDesc.format      = GetBaseFormat();
     texDesc.mipLevels   = desc.MipLevels;
 
@@ -223,44 +275,95 @@ static void ConvertD3DTextureExtent(D3D12_RESOURCE_DESC& outDesc, TextureType ty
     }
 }
 
+// Copies all rows of the specified subresource data into the mapped upload buffer, distributed across multiple threads for large textures.
+static void CopySubresourceRowsToUploadBuffer(
+    char*                                       dstData,
+    UINT64                                      dstLayerStride,
+    const D3D12_PLACED_SUBRESOURCE_FOOTPRINT&   dstFootprint,
+    UINT                                        numRows,
+    UINT64                                      rowSize,
+    const D3D12_SUBRESOURCE_DATA&               subresourceData,
+    UINT                                        numArrayLayers)
+{
+    /*
+    Array layers and depth slices are both tightly packed with the source slice pitch, since 3D textures have only a single layer.
+    The upload buffer is write-combined memory, so rows are written with non-temporal stores.
+    */
+    const UINT      numSlices   = dstFootprint.Footprint.Depth;
+    const bool      isVolume    = (numSlices > 1);
+    const UINT64    dstRowPitch = dstFootprint.Footprint.RowPitch;
+
+    BitBlit(
+        Extent3D{ static_cast<std::uint32_t>(rowSize), numRows, (isVolume ? numSlices : numArrayLayers) },
+        1,
+        dstData,
+        static_cast<std::uint32_t>(dstRowPitch),
+        static_cast<std::uint32_t>(isVolume ? dstRowPitch * numRows : dstLayerStride),
+        static_cast<const char*>(subresourceData.pData),
+        static_cast<std::uint32_t>(subresourceData.RowPitch),
+        static_cast<std::uint32_t>(subresourceData.SlicePitch),
+        BitBlitFlags::WriteCombined,
+        LLGL_MAX_THREAD_COUNT
+    );
+}
+
 static void UpdateD3DTextureSubresource(
-    ID3D12Resource*             dstTexture,
-    D3D12SubresourceContext&    context,
-    D3D12_SUBRESOURCE_DATA      subresourceData,
-    UINT                        mipLevel,
-    UINT                        firstArrayLayer,
-    UINT                        numArrayLayers,
-    UINT                        maxNumMipLevels,
-    UINT                        maxNumArrayLayers)
+    ID3D12Resource*                 dstTexture,
+    D3D12SubresourceContext&        context,
+    const D3D12_SUBRESOURCE_DATA&   subresourceData,
+    UINT                            mipLevel,
+    UINT                            firstArrayLayer,
+    UINT                            numArrayLayers,
+    UINT                            maxNumMipLevels,
+    UINT                            maxNumArrayLayers)
 {
     /* Clamp arguments */
     firstArrayLayer = std::min(firstArrayLayer, maxNumArrayLayers - 1u);
     numArrayLayers  = std::min(numArrayLayers, maxNumArrayLayers - firstArrayLayer);
 
-    /* Create the GPU upload buffer */
-    UINT64          srcBufferOffset             = 0;
-    UINT64          srcBufferSubresourceSize    = GetAlignedSize<UINT64>(GetRequiredIntermediateSize(dstTexture, 0, 1), D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
-    ID3D12Resource* srcBuffer                   = context.CreateUploadBuffer(srcBufferSubresourceSize * numArrayLayers);
-
-    /* Upload subresource for each array layer */
-    for_subrange(arrayLayer, firstArrayLayer, firstArrayLayer + numArrayLayers)
-    {
-        /* Update subresource for current array layer */
-        const UINT dstSubresource = D3D12CalcSubresource(mipLevel, arrayLayer, /*planeSlice:*/ 0, maxNumMipLevels, maxNumArrayLayers);
-
-        UpdateSubresources<1>(
-            /*pCmdList:*/               context.GetCommandList(),
-            /*pDestinationResource:*/   dstTexture,
-            /*pIntermediate:*/          srcBuffer,
-            /*IntermediateOffset:*/     srcBufferOffset,
-            /*FirstSubresource:*/       dstSubresource,
-            /*NumSubresources:*/        1,
-            /*pSrcData:*/               &subresourceData
+    /* All array layers of the same MIP-map share the same footprint, so query it only once */
+    const D3D12_RESOURCE_DESC dstDesc = dstTexture->GetDesc();
+    const UINT firstSubresource = D3D12CalcSubresource(mipLevel, firstArrayLayer, /*planeSlice:*/ 0, maxNumMipLevels, maxNumArrayLayers);
+
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT  footprint       = {};
+    UINT                                numRows         = 0;
+    UINT64                              rowSize         = 0;
+    UINT64                              subresourceSize = 0;
+    context.GetDevice()->GetCopyableFootprints(&dstDesc, firstSubresource, 1, 0, &footprint, &numRows, &rowSize, &subresourceSize);
+
+    /* Create the GPU upload buffer for all array layers */
+    const UINT64    srcBufferLayerStride    = GetAlignedSize<UINT64>(subresourceSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    ID3D12Resource* srcBuffer               = context.CreateUploadBuffer(srcBufferLayerStride * numArrayLayers);
+
+    /* Copy rows of all array layers into the upload buffer with a single map/unmap pair */
+    const D3D12_RANGE readRange{ 0, 0 };
+    void* mappedData = nullptr;
+    HRESULT hr = srcBuffer->Map(0, &readRange, &mappedData);
+    DXThrowIfFailed(hr, "failed to map D3D12 upload buffer for texture subresource");
+    {
+        CopySubresourceRowsToUploadBuffer(
+            static_cast<char*>(mappedData),
+            srcBufferLayerStride,
+            footprint,
+            numRows,
+            rowSize,
+            subresourceData,
+            numArrayLayers
         );
+    }
+    srcBuffer->Unmap(0, nullptr);
+
+    /* Record copy command for each array layer */
+    for_range(i, numArrayLayers)
+    {
+        const UINT dstSubresource = D3D12CalcSubresource(mipLevel, firstArrayLayer + i, /*planeSlice:*/ 0, maxNumMipLevels, maxNumArrayLayers);
 
-        /* Move to next buffer region */
-        subresourceData.pData = (reinterpret_cast<const char*>(subresourceData.pData) + subresourceData.SlicePitch);
-        srcBufferOffset += srcBufferSubresourceSize;
+        D3D12_PLACED_SUBRESOURCE_FOOTPRINT srcFootprint = footprint;
+        srcFootprint.Offset = srcBufferLayerStride * i;
+
+        const CD3DX12_TEXTURE_COPY_LOCATION dstLocationD3D(dstTexture, dstSubresource);
+        const CD3DX12_TEXTURE_COPY_LOCATION srcLocationD3D(srcBuffer, srcFootprint);
+        context.GetCommandList()->CopyTextureRegion(&dstLocationD3D, 0, 0, 0, &srcLocationD3D, nullptr);
     }
 }
 
@@ -438,7 +541,8 @@ void D3D12Texture::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESC
         format_,
         D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
         TextureSubresource{ 0, numArrayLayers_, 0, numMipLevels_ },
-        cpuDescHandle
+        cpuDescHandle,
+        GetMinLOD()
     );
 }
 
@@ -461,7 +565,8 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
     DXGI_FORMAT                 format,
     UINT                        componentMapping,
     const TextureSubresource&   subresource,
-    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
+    FLOAT                       minLODClamp)
 {
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 
@@ -474,7 +579,7 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
         case D3D12_SRV_DIMENSION_TEXTURE1D:
             srvDesc.Texture1D.MostDetailedMip               = subresource.baseMipLevel;
             srvDesc.Texture1D.MipLevels                     = subresource.numMipLevels;
-            srvDesc.Texture1D.ResourceMinLODClamp           = 0.0f;
+            srvDesc.Texture1D.ResourceMinLODClamp           = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
@@ -482,14 +587,14 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
             srvDesc.Texture1DArray.MipLevels                = subresource.numMipLevels;
             srvDesc.Texture1DArray.FirstArraySlice          = subresource.baseArrayLayer;
             srvDesc.Texture1DArray.ArraySize                = subresource.numArrayLayers;
-            srvDesc.Texture1DArray.ResourceMinLODClamp      = 0.0f;
+            srvDesc.Texture1DArray.ResourceMinLODClamp      = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURE2D:
             srvDesc.Texture2D.MostDetailedMip               = subresource.baseMipLevel;
             srvDesc.Texture2D.MipLevels                     = subresource.numMipLevels;
             srvDesc.Texture2D.PlaneSlice                    = 0;
-            srvDesc.Texture2D.ResourceMinLODClamp           = 0.0f;
+            srvDesc.Texture2D.ResourceMinLODClamp           = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
@@ -498,7 +603,7 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
             srvDesc.Texture2DArray.FirstArraySlice          = subresource.baseArrayLayer;
             srvDesc.Texture2DArray.ArraySize                = subresource.numArrayLayers;
             srvDesc.Texture2DArray.PlaneSlice               = 0;
-            srvDesc.Texture2DArray.ResourceMinLODClamp      = 0.0f;
+            srvDesc.Texture2DArray.ResourceMinLODClamp      = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURE2DMS:
@@ -512,13 +617,13 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
         case D3D12_SRV_DIMENSION_TEXTURE3D:
             srvDesc.Texture3D.MostDetailedMip               = subresource.baseMipLevel;
             srvDesc.Texture3D.MipLevels                     = subresource.numMipLevels;
-            srvDesc.Texture3D.ResourceMinLODClamp           = 0.0f;
+            srvDesc.Texture3D.ResourceMinLODClamp           = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURECUBE:
             srvDesc.TextureCube.MostDetailedMip             = subresource.baseMipLevel;
             srvDesc.TextureCube.MipLevels                   = subresource.numMipLevels;
-            srvDesc.TextureCube.ResourceMinLODClamp         = 0.0f;
+            srvDesc.TextureCube.ResourceMinLODClamp         = minLODClamp;
             break;
 
         case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
@@ -526,7 +631,7 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
             srvDesc.TextureCubeArray.MipLevels              = subresource.numMipLevels;
             srvDesc.TextureCubeArray.First2DArrayFace       = subresource.baseArrayLayer;
             srvDesc.TextureCubeArray.NumCubes               = subresource.numArrayLayers / 6;
-            srvDesc.TextureCubeArray.ResourceMinLODClamp    = 0.0f;
+            srvDesc.TextureCubeArray.ResourceMinLODClamp    = minLODClamp;
             break;
 
         default:
@@ -558,6 +663,133 @@ void D3D12Texture::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DES
     );
 }
 
+void D3D12Texture::CreateRenderTargetView(
+    ID3D12Device*               device,
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
+    UINT                        mipLevel,
+    UINT                        baseArrayLayer,
+    UINT                        numArrayLayers)
+{
+    D3D12_RENDER_TARGET_VIEW_DESC rtvDesc;
+    rtvDesc.Format = DXTypes::ToDXGIFormatRTV(GetBaseDXFormat());
+
+    switch (GetType())
+    {
+        case TextureType::Texture1D:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE1D;
+            rtvDesc.Texture1D.MipSlice                  = mipLevel;
+            break;
+
+        case TextureType::Texture2D:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2D;
+            rtvDesc.Texture2D.MipSlice                  = mipLevel;
+            rtvDesc.Texture2D.PlaneSlice                = 0;
+            break;
+
+        case TextureType::Texture3D:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE3D;
+            rtvDesc.Texture3D.MipSlice                  = mipLevel;
+            rtvDesc.Texture3D.FirstWSlice               = baseArrayLayer;
+            rtvDesc.Texture3D.WSize                     = numArrayLayers;
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
+            rtvDesc.Texture2DArray.MipSlice             = mipLevel;
+            rtvDesc.Texture2DArray.FirstArraySlice      = baseArrayLayer;
+            rtvDesc.Texture2DArray.ArraySize            = numArrayLayers;
+            rtvDesc.Texture2DArray.PlaneSlice           = 0;
+            break;
+
+        case TextureType::Texture1DArray:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE1DARRAY;
+            rtvDesc.Texture1DArray.MipSlice             = mipLevel;
+            rtvDesc.Texture1DArray.FirstArraySlice      = baseArrayLayer;
+            rtvDesc.Texture1DArray.ArraySize            = numArrayLayers;
+            break;
+
+        case TextureType::Texture2DMS:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DMS;
+            break;
+
+        case TextureType::Texture2DMSArray:
+            rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY;
+            rtvDesc.Texture2DMSArray.FirstArraySlice    = baseArrayLayer;
+            rtvDesc.Texture2DMSArray.ArraySize          = numArrayLayers;
+            break;
+    }
+
+    device->CreateRenderTargetView(GetNative(), &rtvDesc, cpuDescHandle);
+}
+
+void D3D12Texture::CreateDepthStencilView(
+    ID3D12Device*               device,
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
+    UINT                        mipLevel,
+    UINT                        baseArrayLayer,
+    UINT                        numArrayLayers)
+{
+    D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc;
+    dsvDesc.Format  = DXTypes::ToDXGIFormatDSV(GetBaseDXFormat());
+    dsvDesc.Flags   = D3D12_DSV_FLAG_NONE;
+
+    switch (GetType())
+    {
+        case TextureType::Texture1D:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE1D;
+            dsvDesc.Texture1D.MipSlice                  = mipLevel;
+            break;
+
+        case TextureType::Texture2D:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2D;
+            dsvDesc.Texture2D.MipSlice                  = mipLevel;
+            break;
+
+        case TextureType::Texture3D:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DArray:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DARRAY;
+            dsvDesc.Texture2DArray.MipSlice             = mipLevel;
+            dsvDesc.Texture2DArray.FirstArraySlice      = baseArrayLayer;
+            dsvDesc.Texture2DArray.ArraySize            = numArrayLayers;
+            break;
+
+        case TextureType::Texture1DArray:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE1DARRAY;
+            dsvDesc.Texture1DArray.MipSlice             = mipLevel;
+            dsvDesc.Texture1DArray.FirstArraySlice      = baseArrayLayer;
+            dsvDesc.Texture1DArray.ArraySize            = numArrayLayers;
+            break;
+
+        case TextureType::Texture2DMS:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DMS;
+            break;
+
+        case TextureType::Texture2DMSArray:
+            dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY;
+            dsvDesc.Texture2DMSArray.FirstArraySlice    = baseArrayLayer;
+            dsvDesc.Texture2DMSArray.ArraySize          = numArrayLayers;
+            break;
+    }
+
+    device->CreateDepthStencilView(GetNative(), &dsvDesc, cpuDescHandle);
+}
+
+void D3D12Texture::CopyCachedShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc)
+{
+    std::lock_guard<std::mutex> guard{ cachedViewsMutex_ };
+    device->CopyDescriptorsSimple(1, cpuDescHandle, GetOrCreateCachedView(device, desc, false), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+void D3D12Texture::CopyCachedUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc)
+{
+    std::lock_guard<std::mutex> guard{ cachedViewsMutex_ };
+    device->CopyDescriptorsSimple(1, cpuDescHandle, GetOrCreateCachedView(device, desc, true), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
 //private
 void D3D12Texture::CreateUnorderedAccessViewPrimary(
     ID3D12Device*               device,
@@ -692,6 +924,165 @@ bool D3D12Texture::SupportsGenerateMips() const
     return DXTextureSupportsGenerateMips(GetBindFlags(), GetNumMipLevels());
 }
 
+// Returns the key of the specified tile coordinate to identify the tiles that are mapped to a reserved resource.
+static UINT64 GetD3D12SparseTileKey(const D3D12_TILED_RESOURCE_COORDINATE& coord)
+{
+    return
+    (
+        (static_cast<UINT64>(coord.Subresource) << 48) |
+        (static_cast<UINT64>(coord.Z          ) << 32) |
+        (static_cast<UINT64>(coord.Y          ) << 16) |
+        (static_cast<UINT64>(coord.X          )      )
+    );
+}
+
+// Maps the specified tile coordinates to their allocated tiles. Consecutive tiles within the same heap are mapped with a single call.
+static void MapD3D12TilesToHeaps(
+    ID3D12CommandQueue*                                 commandQueue,
+    ID3D12Resource*                                     resource,
+    const std::vector<D3D12_TILED_RESOURCE_COORDINATE>& coords,
+    const std::vector<D3D12TileAllocation>&             tiles)
+{
+    std::vector<UINT> heapTileOffsets;
+    std::vector<UINT> rangeTileCounts;
+
+    for (std::size_t first = 0, last = 0; first < coords.size(); first = last)
+    {
+        ID3D12Heap* heap = tiles[first].heap;
+        for (last = first + 1; last < coords.size() && tiles[last].heap == heap; ++last)
+            /* Find end of tiles within the same heap */;
+
+        const UINT numTiles = static_cast<UINT>(last - first);
+        heapTileOffsets.resize(numTiles);
+        rangeTileCounts.assign(numTiles, 1u);
+        for_range(i, numTiles)
+            heapTileOffsets[i] = tiles[first + i].tileOffset;
+
+        commandQueue->UpdateTileMappings(
+            resource,
+            numTiles,
+            &(coords[first]),
+            nullptr,
+            heap,
+            numTiles,
+            nullptr,
+            heapTileOffsets.data(),
+            rangeTileCounts.data(),
+            D3D12_TILE_MAPPING_FLAG_NONE
+        );
+    }
+}
+
+void D3D12Texture::UpdateTileMappings(ID3D12CommandQueue* commandQueue, D3D12TileHeapPool& tileHeapPool, const SparseTextureMapping& mapping)
+{
+    if (!isSparse_)
+        return;
+
+    const TextureRegion&        region          = mapping.region;
+    const TextureSubresource&   subresource     = region.subresource;
+    const bool                  is3DTexture     = (GetType() == TextureType::Texture3D);
+    const UINT                  baseArrayLayer  = (is3DTexture ? 0u : subresource.baseArrayLayer);
+    const UINT                  numArrayLayers  = (is3DTexture ? 1u : std::max(1u, subresource.numArrayLayers));
+
+    /* Gather tile coordinates of the specified region */
+    std::vector<D3D12_TILED_RESOURCE_COORDINATE> coords;
+
+    if (subresource.baseMipLevel >= packedMipInfo_.NumStandardMips)
+    {
+        /* Packed MIP-maps are addressed by their tile index in X-coordinate of the first packed MIP-map level */
+        for_subrange(arrayLayer, baseArrayLayer, baseArrayLayer + numArrayLayers)
+        {
+            const UINT packedSubresource = CalcSubresource(packedMipInfo_.NumStandardMips, arrayLayer);
+            for_range(tile, packedMipInfo_.NumTilesForPackedMips)
+                coords.push_back(D3D12_TILED_RESOURCE_COORDINATE{ tile, 0, 0, packedSubresource });
+        }
+    }
+    else
+    {
+        const UINT beginX   = static_cast<UINT>(region.offset.x) / tileShape_.WidthInTexels;
+        const UINT beginY   = static_cast<UINT>(region.offset.y) / tileShape_.HeightInTexels;
+        const UINT beginZ   = (is3DTexture ? static_cast<UINT>(region.offset.z) / tileShape_.DepthInTexels : 0u);
+        const UINT endX     = DivideRoundUp<UINT>(static_cast<UINT>(region.offset.x) + region.extent.x, tileShape_.WidthInTexels);
+        const UINT endY     = DivideRoundUp<UINT>(static_cast<UINT>(region.offset.y) + region.extent.y, tileShape_.HeightInTexels);
+        const UINT endZ     = (is3DTexture ? DivideRoundUp<UINT>(static_cast<UINT>(region.offset.z) + region.extent.z, tileShape_.DepthInTexels) : 1u);
+
+        for_subrange(arrayLayer, baseArrayLayer, baseArrayLayer + numArrayLayers)
+        {
+            const UINT mipSubresource = CalcSubresource(subresource.baseMipLevel, arrayLayer);
+            for_subrange(z, beginZ, endZ)
+            {
+                for_subrange(y, beginY, endY)
+                {
+                    for_subrange(x, beginX, endX)
+                        coords.push_back(D3D12_TILED_RESOURCE_COORDINATE{ x, y, z, mipSubresource });
+                }
+            }
+        }
+    }
+
+    if (mapping.commit)
+    {
+        /* Allocate tiles for all coordinates that are not mapped yet */
+        std::vector<D3D12_TILED_RESOURCE_COORDINATE> newCoords;
+        std::vector<D3D12TileAllocation> newTiles;
+
+        for (const D3D12_TILED_RESOURCE_COORDINATE& coord : coords)
+        {
+            const UINT64 key = GetD3D12SparseTileKey(coord);
+            if (sparseTiles_.find(key) == sparseTiles_.end())
+            {
+                const D3D12TileAllocation tile = tileHeapPool.AllocTile(tileHeapFlags_);
+                sparseTiles_[key] = tile;
+                newCoords.push_back(coord);
+                newTiles.push_back(tile);
+            }
+        }
+
+        MapD3D12TilesToHeaps(commandQueue, GetNative(), newCoords, newTiles);
+    }
+    else
+    {
+        /* Release tiles of all coordinates that are currently mapped */
+        std::vector<D3D12_TILED_RESOURCE_COORDINATE> unmappedCoords;
+
+        for (const D3D12_TILED_RESOURCE_COORDINATE& coord : coords)
+        {
+            auto it = sparseTiles_.find(GetD3D12SparseTileKey(coord));
+            if (it != sparseTiles_.end())
+            {
+                tileHeapPool.ReleaseTile(it->second);
+                sparseTiles_.erase(it);
+                unmappedCoords.push_back(coord);
+            }
+        }
+
+        if (!unmappedCoords.empty())
+        {
+            /* Map all released tiles to NULL, so the heap tiles can be reused by other resources */
+            const D3D12_TILE_RANGE_FLAGS nullRangeFlag = D3D12_TILE_RANGE_FLAG_NULL;
+            commandQueue->UpdateTileMappings(
+                GetNative(),
+                static_cast<UINT>(unmappedCoords.size()),
+                unmappedCoords.data(),
+                nullptr,
+                nullptr,
+                1,
+                &nullRangeFlag,
+                nullptr,
+                nullptr,
+                D3D12_TILE_MAPPING_FLAG_NONE
+            );
+        }
+    }
+}
+
+void D3D12Texture::ReleaseTiles(D3D12TileHeapPool& tileHeapPool)
+{
+    for (const auto& entry : sparseTiles_)
+        tileHeapPool.ReleaseTile(entry.second);
+    sparseTiles_.clear();
+}
+
 
 /*
  * ======= Private: =======
@@ -756,7 +1147,27 @@ static D3D12_RESOURCE_STATES GetInitialD3D12ResourceState(const TextureDescripto
     return flags;
 }
 
-void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc)
+// Returns true if the specified texture descriptor can be created as reserved resource whose tiles are mapped on demand.
+static bool IsSparseTextureDesc(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Sparse) != 0 &&
+        (desc.type == TextureType::Texture2D || desc.type == TextureType::Texture2DArray || desc.type == TextureType::Texture3D)
+    );
+}
+
+// Returns true if the specified texture descriptor can be created as placed resource in a transient heap.
+static bool IsTransientTextureDesc(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Transient) != 0 &&
+        (desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0
+    );
+}
+
+void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, D3D12TransientHeapPool* transientHeapPool)
 {
     /* Setup resource descriptor by texture descriptor and create hardware resource */
     D3D12_RESOURCE_DESC descD3D;
@@ -781,17 +1192,68 @@ void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescri
         optClearValue.DepthStencil.Stencil  = static_cast<UINT8>(desc.clearValue.stencil);
     }
 
-    /* Create hardware resource for the texture */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &descD3D,
-        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
-        (useClearValue ? &optClearValue : nullptr),
-        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
-    );
-    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    if (IsSparseTextureDesc(desc))
+    {
+        /* Create reserved resource without any memory; tiles are mapped with D3D12Texture::UpdateTileMappings */
+        descD3D.Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+        HRESULT hr = device->CreateReservedResource(
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for sparse D3D12 hardware texture");
+
+        /* Query tile shape and packed MIP-maps of the reserved resource */
+        UINT numTiles = 0;
+        device->GetResourceTiling(resource_.native.Get(), &numTiles, &packedMipInfo_, &tileShape_, nullptr, 0, nullptr);
+
+        isSparse_       = true;
+        tileHeapFlags_  =
+        (
+            useClearValue
+                ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES
+                : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES
+        );
+    }
+    else if (transientHeapPool != nullptr && IsTransientTextureDesc(desc))
+    {
+        /* Create placed resource at the beginning of the heap that is shared by all textures of the same aliasing group */
+        const D3D12_RESOURCE_ALLOCATION_INFO allocInfo = device->GetResourceAllocationInfo(0, 1, &descD3D);
+        aliasingGroup_  = desc.aliasingGroup;
+        aliasingHeap_   = transientHeapPool->AllocHeap(aliasingGroup_, allocInfo);
+
+        HRESULT hr = device->CreatePlacedResource(
+            aliasingHeap_.Get(),
+            0,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for transient D3D12 hardware texture");
+
+        resource_.aliasingHeap = aliasingHeap_.Get();
+    }
+    else
+    {
+        /* Create hardware resource for the texture */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    }
+
+    /* Track subresource states individually, so MIP-maps and array layers can be transitioned without affecting the rest of the texture */
+    if (!IsStencilFormat(desc.format))
+        resource_.EnableSubresourceTracking(numMipLevels_, numArrayLayers_);
 }
 
 // Determine SRV dimension for descriptor heaps used in D3D12MipGenerator: either 1D array, 2D array, or 3D
@@ -896,6 +1358,53 @@ void D3D12Texture::CreateMipDescHeap(ID3D12Device* device)
     }
 }
 
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12Texture::GetOrCreateCachedView(ID3D12Device* device, const TextureViewDescriptor& desc, bool isUAV)
+{
+    /* Compress texture view descriptor for faster comparison and sorting */
+    D3D12CachedView cachedView;
+    {
+        cachedView.isUAV        = isUAV;
+        cachedView.descriptor   = static_cast<UINT>(cachedViews_.size());
+    }
+    CompressTextureViewDesc(cachedView.view, desc);
+
+    /* Try to find view with same parameters */
+    std::size_t insertionIndex = 0;
+    const D3D12CachedView* sharedView = FindInSortedArray<D3D12CachedView>(
+        cachedViews_.data(),
+        cachedViews_.size(),
+        [&cachedView](const D3D12CachedView& rhs) -> int
+        {
+            LLGL_COMPARE_SEPARATE_BOOL_MEMBER_SWO(cachedView.isUAV, rhs.isUAV);
+            return CompareCompressedTexViewSWO(cachedView.view, rhs.view);
+        },
+        &insertionIndex
+    );
+
+    if (sharedView != nullptr)
+        return cachedViewDescHeap_.GetCpuHandleWithOffset(sharedView->descriptor);
+
+    /* Grow descriptor heap and copy all previously cached views into it; descriptors are always appended to the heap */
+    const UINT numDescriptors = static_cast<UINT>(cachedViews_.size());
+    if (numDescriptors >= cachedViewDescHeap_.GetSize())
+    {
+        D3D12DescriptorHeap newDescHeap{ device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, std::max(4u, numDescriptors * 2u) };
+        if (numDescriptors > 0)
+            device->CopyDescriptorsSimple(numDescriptors, newDescHeap.GetCpuHandleStart(), cachedViewDescHeap_.GetCpuHandleStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        cachedViewDescHeap_ = std::move(newDescHeap);
+    }
+
+    /* Create new view and store it with insertion sort */
+    const D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = cachedViewDescHeap_.GetCpuHandleWithOffset(cachedView.descriptor);
+    if (isUAV)
+        CreateUnorderedAccessView(device, cpuDescHandle, desc);
+    else
+        CreateShaderResourceView(device, cpuDescHandle, desc);
+
+    cachedViews_.insert(cachedViews_.begin() + insertionIndex, cachedView);
+    return cpuDescHandle;
+}
+
 
 } // /namespace LLGL
 
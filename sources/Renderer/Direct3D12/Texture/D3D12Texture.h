@@ -11,7 +11,13 @@
 
 #include <LLGL/Texture.h>
 #include "../D3D12Resource.h"
+#include "D3D12TileHeapPool.h"
+#include "../RenderState/D3D12DescriptorHeap.h"
+#include "../../TextureUtils.h"
+#include <map>
 #include <vector>
+#include <atomic>
+#include <mutex>
 
 
 namespace LLGL
@@ -21,6 +27,7 @@ namespace LLGL
 class D3D12Buffer;
 class D3D12CommandContext;
 class D3D12SubresourceContext;
+class D3D12TransientHeapPool;
 
 class D3D12Texture final : public Texture
 {
@@ -33,9 +40,18 @@ class D3D12Texture final : public Texture
 
         void SetDebugName(const char* name) override;
 
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+        bool Evict() override;
+        bool MakeResident() override;
+
+        bool GetSparseProperties(SparseTextureProperties& outProperties) const override;
+
+        bool SetMinLOD(float minLOD) override;
+
     public:
 
-        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc);
+        // Creates a placed resource in the transient heap pool if MiscFlags::Transient is specified and the pool is not null; otherwise, creates a committed resource.
+        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc, D3D12TransientHeapPool* transientHeapPool = nullptr);
 
         // Updates the specified subresource, i.e. a single MIP-map level but one or more array layers.
         void UpdateSubresource(
@@ -61,7 +77,7 @@ class D3D12Texture final : public Texture
             UINT&                       outLayerStride
         );
 
-        // Creates either the default SRV for the entire resource or a subresource.
+        // Creates either the default SRV for the entire resource or a subresource. Only the default SRV is clamped to the min-LOD of this texture.
         void CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
         void CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc);
 
@@ -69,6 +85,18 @@ class D3D12Texture final : public Texture
         void CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
         void CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc);
 
+        // Creates an RTV or DSV for a single MIP-map level and a range of array layers (or depth slices for 3D textures) of this texture.
+        void CreateRenderTargetView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, UINT mipLevel, UINT baseArrayLayer, UINT numArrayLayers);
+        void CreateDepthStencilView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, UINT mipLevel, UINT baseArrayLayer, UINT numArrayLayers);
+
+        /*
+        Copies the SRV or UAV for the specified subresource view into the destination descriptor.
+        The views are created in a CPU descriptor heap of this texture on first use, so repeated writes of the same view only copy a descriptor.
+        This function is thread-safe.
+        */
+        void CopyCachedShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc);
+        void CopyCachedUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc);
+
         // Returns the subresource index for the specified MIP-map level and array layer.
         UINT CalcSubresource(UINT mipLevel, UINT arrayLayer, UINT plane = 0) const;
 
@@ -90,6 +118,12 @@ class D3D12Texture final : public Texture
         // Returns true if MIP-maps can be generated for this texture .
         bool SupportsGenerateMips() const;
 
+        // Maps or unmaps the tiles of the specified region with tiles from the pool. Only used for reserved resources (see MiscFlags::Sparse).
+        void UpdateTileMappings(ID3D12CommandQueue* commandQueue, D3D12TileHeapPool& tileHeapPool, const SparseTextureMapping& mapping);
+
+        // Returns all tiles that are mapped to this texture back to the pool.
+        void ReleaseTiles(D3D12TileHeapPool& tileHeapPool);
+
         // Returns the resource wrapper.
         inline D3D12Resource& GetResource()
         {
@@ -144,6 +178,33 @@ class D3D12Texture final : public Texture
             return TextureSubresource{ 0, GetNumArrayLayers(), 0, GetNumMipLevels() };
         }
 
+        // Returns true if this texture is a placed resource that is aliased with other transient textures.
+        inline bool IsTransient() const
+        {
+            return (resource_.aliasingHeap != nullptr);
+        }
+
+        // Returns true if this texture is a reserved resource whose tiles are mapped on demand.
+        inline bool IsSparse() const
+        {
+            return isSparse_;
+        }
+
+        // Returns the aliasing group this texture was created with. Only used for transient textures.
+        inline std::uint32_t GetAliasingGroup() const
+        {
+            return aliasingGroup_;
+        }
+
+        // Returns the min-LOD clamp for the default SRV. See SetMinLOD().
+        inline float GetMinLOD() const
+        {
+            return minLOD_.load();
+        }
+
+        // Returns a counter that is incremented whenever the min-LOD clamp of any texture changes.
+        static std::uint64_t GetMinLODGeneration();
+
         // Returns the descriptor heap for the MIP-map chain. Descriptor 0 is SRV of entire MIP-map chain, 1 to N descriptors are for UAVs for MIP-maps 1 to N.
         inline ID3D12DescriptorHeap* GetMipDescHeap() const
         {
@@ -152,7 +213,7 @@ class D3D12Texture final : public Texture
 
     private:
 
-        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc);
+        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, D3D12TransientHeapPool* transientHeapPool);
 
         void CreateShaderResourceViewPrimary(
             ID3D12Device*               device,
@@ -160,7 +221,8 @@ class D3D12Texture final : public Texture
             DXGI_FORMAT                 format,
             UINT                        componentMapping,
             const TextureSubresource&   subresource,
-            D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle
+            D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
+            FLOAT                       minLODClamp     = 0.0f
         );
 
         void CreateUnorderedAccessViewPrimary(
@@ -173,8 +235,22 @@ class D3D12Texture final : public Texture
 
         void CreateMipDescHeap(ID3D12Device* device);
 
+        // Returns the CPU descriptor handle of the cached SRV or UAV for the specified subresource view; creates it on first use.
+        D3D12_CPU_DESCRIPTOR_HANDLE GetOrCreateCachedView(ID3D12Device* device, const TextureViewDescriptor& desc, bool isUAV);
+
     private:
 
+        // Subresource view that is cached in the CPU descriptor heap of this texture; see GetOrCreateCachedView.
+        struct D3D12CachedView
+        {
+            CompressedTexView   view;
+            bool                isUAV;
+            UINT                descriptor; // Index into the cached view descriptor heap
+        };
+
+    private:
+
+        ComPtr<ID3D12Heap>              aliasingHeap_;  // Must be released after the placed resource.
         D3D12Resource                   resource_;
 
         Format                          baseFormat_     = Format::Undefined;
@@ -182,8 +258,20 @@ class D3D12Texture final : public Texture
         UINT                            numMipLevels_   = 0;
         UINT                            numArrayLayers_ = 0;
         Extent3D                        extent_;
+        std::uint32_t                   aliasingGroup_  = 0;
 
         ComPtr<ID3D12DescriptorHeap>    mipDescHeap_;
+        std::atomic<float>              minLOD_         { 0.0f };
+
+        bool                                    isSparse_       = false;
+        D3D12_HEAP_FLAGS                        tileHeapFlags_  = D3D12_HEAP_FLAG_NONE;
+        D3D12_PACKED_MIP_INFO                   packedMipInfo_  = {};
+        D3D12_TILE_SHAPE                        tileShape_      = {};
+        std::map<UINT64, D3D12TileAllocation>   sparseTiles_;
+
+        std::vector<D3D12CachedView>            cachedViews_;           // Sorted by UAV flag and compressed texture view descriptor
+        D3D12DescriptorHeap                     cachedViewDescHeap_;    // Non-shader-visible heap of all cached views
+        std::mutex                              cachedViewsMutex_;
 
 };
 
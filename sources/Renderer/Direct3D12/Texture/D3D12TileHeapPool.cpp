@@ -0,0 +1,102 @@
+/*
+ * D3D12TileHeapPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TileHeapPool.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+void D3D12TileHeapPool::InitializeDevice(ID3D12Device* device)
+{
+    device_ = device;
+}
+
+D3D12TileAllocation D3D12TileHeapPool::AllocTile(D3D12_HEAP_FLAGS heapFlags)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Find first heap with the same flags that has a free tile left */
+    TileHeap* tileHeap = nullptr;
+    for (TileHeap& entry : heaps_)
+    {
+        if (entry.flags == heapFlags && !entry.freeTiles.empty())
+        {
+            tileHeap = &entry;
+            break;
+        }
+    }
+
+    if (tileHeap == nullptr)
+        tileHeap = &(CreateHeap(heapFlags));
+
+    D3D12TileAllocation tile;
+    {
+        tile.heap       = tileHeap->heap.Get();
+        tile.tileOffset = tileHeap->freeTiles.back();
+    }
+    tileHeap->freeTiles.pop_back();
+
+    return tile;
+}
+
+void D3D12TileHeapPool::ReleaseTile(const D3D12TileAllocation& tile)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (TileHeap& entry : heaps_)
+    {
+        if (entry.heap.Get() == tile.heap)
+        {
+            LLGL_ASSERT(entry.freeTiles.size() < numTilesPerHeap);
+            entry.freeTiles.push_back(tile.tileOffset);
+            return;
+        }
+    }
+    LLGL_TRAP("tile was not allocated by this D3D12 tile heap pool");
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+D3D12TileHeapPool::TileHeap& D3D12TileHeapPool::CreateHeap(D3D12_HEAP_FLAGS heapFlags)
+{
+    D3D12_HEAP_DESC heapDesc = {};
+    {
+        heapDesc.SizeInBytes                        = static_cast<UINT64>(numTilesPerHeap) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+        heapDesc.Properties.Type                    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Properties.CPUPageProperty         = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference    = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Alignment                          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags                              = heapFlags;
+    }
+
+    TileHeap tileHeap;
+    HRESULT hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(tileHeap.heap.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for tiles of reserved D3D12 resources");
+
+    /* Free tiles are taken from the back, so fill the list in reverse order to allocate tiles in ascending order */
+    tileHeap.flags = heapFlags;
+    tileHeap.freeTiles.reserve(numTilesPerHeap);
+    for_range_reverse(i, numTilesPerHeap)
+        tileHeap.freeTiles.push_back(i);
+
+    heaps_.push_back(std::move(tileHeap));
+    return heaps_.back();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
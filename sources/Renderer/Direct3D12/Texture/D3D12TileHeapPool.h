@@ -0,0 +1,90 @@
+/*
+ * D3D12TileHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TILE_HEAP_POOL_H
+#define LLGL_D3D12_TILE_HEAP_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+// Single 64 KB tile within a heap of the D3D12TileHeapPool.
+struct D3D12TileAllocation
+{
+    ID3D12Heap* heap        = nullptr;
+    UINT        tileOffset  = 0;
+};
+
+/*
+Pool of D3D12 heaps for the tiles of reserved resources (see MiscFlags::Sparse).
+Each heap provides a fixed number of tiles and new heaps are created on demand when all tiles of the previous heaps are in use.
+Heaps are kept until the pool is destroyed, since the GPU might still access a heap when its last tile has been unmapped.
+Tiles of textures that are used as attachments are allocated from separate heaps to support resource heap tier 1.
+This class is thread-safe, so sparse textures can be released while tiles are mapped on a command queue.
+*/
+class D3D12TileHeapPool
+{
+
+    public:
+
+        // Number of tiles per heap, i.e. 16 MB heaps.
+        static constexpr UINT numTilesPerHeap = 256;
+
+    public:
+
+        D3D12TileHeapPool() = default;
+
+        D3D12TileHeapPool(const D3D12TileHeapPool&) = delete;
+        D3D12TileHeapPool& operator = (const D3D12TileHeapPool&) = delete;
+
+        // Initializes the device object.
+        void InitializeDevice(ID3D12Device* device);
+
+        // Allocates a single tile from a heap with the specified flags.
+        D3D12TileAllocation AllocTile(D3D12_HEAP_FLAGS heapFlags);
+
+        // Returns the specified tile to its heap.
+        void ReleaseTile(const D3D12TileAllocation& tile);
+
+    private:
+
+        struct TileHeap
+        {
+            ComPtr<ID3D12Heap>  heap;
+            D3D12_HEAP_FLAGS    flags;
+            std::vector<UINT>   freeTiles;
+        };
+
+    private:
+
+        TileHeap& CreateHeap(D3D12_HEAP_FLAGS heapFlags);
+
+    private:
+
+        ID3D12Device*           device_ = nullptr;
+        std::vector<TileHeap>   heaps_;
+        std::mutex              mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
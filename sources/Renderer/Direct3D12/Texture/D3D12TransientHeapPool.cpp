@@ -0,0 +1,96 @@
+/*
+ * D3D12TransientHeapPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TransientHeapPool.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+void D3D12TransientHeapPool::InitializeDevice(ID3D12Device* device)
+{
+    device_ = device;
+}
+
+ComPtr<ID3D12Heap> D3D12TransientHeapPool::AllocHeap(std::uint32_t aliasingGroup, const D3D12_RESOURCE_ALLOCATION_INFO& allocInfo)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    AliasingGroup* group = FindAliasingGroup(aliasingGroup);
+    if (group == nullptr)
+    {
+        groups_.push_back(AliasingGroup{ aliasingGroup, nullptr, 0, 0, 0 });
+        group = &(groups_.back());
+    }
+
+    /* Replace heap of this group if the new resource does not fit; previous resources keep their own reference to the old heap */
+    if (group->heap.Get() == nullptr || group->size < allocInfo.SizeInBytes || group->alignment < allocInfo.Alignment)
+        CreateHeap(*group, std::max(group->size, allocInfo.SizeInBytes), std::max(group->alignment, allocInfo.Alignment));
+
+    ++group->numResources;
+    return group->heap;
+}
+
+void D3D12TransientHeapPool::ReleaseHeap(std::uint32_t aliasingGroup)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (auto it = groups_.begin(); it != groups_.end(); ++it)
+    {
+        if (it->id == aliasingGroup)
+        {
+            LLGL_ASSERT(it->numResources > 0);
+            if (--it->numResources == 0)
+                groups_.erase(it);
+            return;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+D3D12TransientHeapPool::AliasingGroup* D3D12TransientHeapPool::FindAliasingGroup(std::uint32_t aliasingGroup)
+{
+    for (AliasingGroup& group : groups_)
+    {
+        if (group.id == aliasingGroup)
+            return &group;
+    }
+    return nullptr;
+}
+
+void D3D12TransientHeapPool::CreateHeap(AliasingGroup& group, UINT64 size, UINT64 alignment)
+{
+    /* Heaps that only contain render targets and depth-stencil textures are supported on all resource heap tiers */
+    D3D12_HEAP_DESC heapDesc = {};
+    {
+        heapDesc.SizeInBytes                        = size;
+        heapDesc.Properties.Type                    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Properties.CPUPageProperty         = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference    = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Alignment                          = alignment;
+        heapDesc.Flags                              = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    }
+    HRESULT hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(group.heap.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for transient D3D12 textures");
+
+    group.size      = size;
+    group.alignment = alignment;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
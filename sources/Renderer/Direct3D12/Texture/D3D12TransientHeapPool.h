@@ -0,0 +1,82 @@
+/*
+ * D3D12TransientHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TRANSIENT_HEAP_POOL_H
+#define LLGL_D3D12_TRANSIENT_HEAP_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Pool of D3D12 heaps for transient render target attachments (see MiscFlags::Transient).
+All placed resources of the same aliasing group are placed at the beginning of the same heap, so their memory is aliased.
+If a new resource does not fit into the current heap of its group, a larger heap is created for the group.
+Placed resources keep a reference to their heap, so previous heaps remain valid until all of their resources have been released.
+This class is thread-safe, so transient textures can be created and released concurrently.
+*/
+class D3D12TransientHeapPool
+{
+
+    public:
+
+        D3D12TransientHeapPool() = default;
+
+        D3D12TransientHeapPool(const D3D12TransientHeapPool&) = delete;
+        D3D12TransientHeapPool& operator = (const D3D12TransientHeapPool&) = delete;
+
+        // Initializes the device object.
+        void InitializeDevice(ID3D12Device* device);
+
+        // Returns the heap of the specified aliasing group that is large enough for the specified resource allocation.
+        ComPtr<ID3D12Heap> AllocHeap(std::uint32_t aliasingGroup, const D3D12_RESOURCE_ALLOCATION_INFO& allocInfo);
+
+        // Releases a resource of the specified aliasing group. The group releases its heap once all of its resources have been released.
+        void ReleaseHeap(std::uint32_t aliasingGroup);
+
+    private:
+
+        struct AliasingGroup
+        {
+            std::uint32_t       id;
+            ComPtr<ID3D12Heap>  heap;
+            UINT64              size;
+            UINT64              alignment;
+            std::uint32_t       numResources;
+        };
+
+    private:
+
+        AliasingGroup* FindAliasingGroup(std::uint32_t aliasingGroup);
+
+        void CreateHeap(AliasingGroup& group, UINT64 size, UINT64 alignment);
+
+    private:
+
+        ID3D12Device*               device_ = nullptr;
+        std::vector<AliasingGroup>  groups_;
+        std::mutex                  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
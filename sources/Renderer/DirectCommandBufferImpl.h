@@ -0,0 +1,101 @@
+/*
+ * DirectCommandBufferImpl.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DIRECT_COMMAND_BUFFER_IMPL_H
+#define LLGL_DIRECT_COMMAND_BUFFER_IMPL_H
+
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+
+#include <LLGL/DirectCommandBuffer.h>
+#include "CheckedCast.h"
+
+
+/*
+Implements all functions of the LLGL::Direct namespace for the only backend of a static library.
+DISPATCH(CMDBUFFER, CALL) must expand to an expression that invokes the member function CALL on CMDBUFFER cast to a final command buffer class.
+This must be used in exactly one translation unit of the backend and outside of any namespace.
+*/
+#define LLGL_IMPLEMENT_DIRECT_COMMAND_BUFFER(DISPATCH)                                                                                                      \
+    namespace LLGL                                                                                                                                          \
+    {                                                                                                                                                       \
+    namespace Direct                                                                                                                                        \
+    {                                                                                                                                                       \
+        LLGL_EXPORT void SetViewport(CommandBuffer& cmdBuffer, const Viewport& viewport)                                                                    \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetViewport(viewport));                                                                                                     \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetScissor(CommandBuffer& cmdBuffer, const Scissor& scissor)                                                                       \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetScissor(scissor));                                                                                                       \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetVertexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer, std::uint64_t offset)                                                    \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetVertexBuffer(buffer, offset));                                                                                           \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetIndexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer)                                                                           \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetIndexBuffer(buffer));                                                                                                    \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetIndexBuffer(CommandBuffer& cmdBuffer, Buffer& buffer, const Format format, std::uint64_t offset)                                \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetIndexBuffer(buffer, format, offset));                                                                                    \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetResourceHeap(CommandBuffer& cmdBuffer, ResourceHeap& resourceHeap, std::uint32_t descriptorSet)                                 \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetResourceHeap(resourceHeap, descriptorSet));                                                                              \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetResource(CommandBuffer& cmdBuffer, std::uint32_t descriptor, Resource& resource)                                                \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetResource(descriptor, resource));                                                                                         \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetPipelineState(CommandBuffer& cmdBuffer, PipelineState& pipelineState)                                                           \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetPipelineState(pipelineState));                                                                                           \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void SetUniforms(CommandBuffer& cmdBuffer, std::uint32_t first, const void* data, std::uint16_t dataSize)                               \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, SetUniforms(first, data, dataSize));                                                                                        \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void Draw(CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex)                                               \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, Draw(numVertices, firstVertex));                                                                                            \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void DrawIndexed(CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)               \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, DrawIndexed(numIndices, firstIndex, vertexOffset));                                                                         \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void DrawInstanced(                                                                                                                     \
+            CommandBuffer& cmdBuffer, std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)         \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, DrawInstanced(numVertices, firstVertex, numInstances, firstInstance));                                                      \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void DrawIndexedInstanced(                                                                                                              \
+            CommandBuffer& cmdBuffer, std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset,            \
+            std::uint32_t firstInstance)                                                                                                                    \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance));                                   \
+        }                                                                                                                                                   \
+        LLGL_EXPORT void Dispatch(CommandBuffer& cmdBuffer, std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)       \
+        {                                                                                                                                                   \
+            DISPATCH(cmdBuffer, Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ));                                                                  \
+        }                                                                                                                                                   \
+    }                                                                                                                                                       \
+    }
+
+// Dispatches a call to a backend with a single final command buffer class.
+#define LLGL_DIRECT_DISPATCH_FINAL(TYPE, CMDBUFFER, CALL) \
+    LLGL_CAST(TYPE&, CMDBUFFER).CALL
+
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#endif
+
+
+
+// ================================================================================
@@ -45,6 +45,17 @@ LLGL_EXPORT void* LLGL_RenderSystem_Alloc(const void* renderSystemDesc, int rend
 */
 LLGL_EXPORT void LLGL_RenderSystem_Free(void* renderSystem);
 
+/**
+\brief Queries the adapters and capabilities of this render system module without allocating a render system.
+\param[in] renderSystemDesc Specifies the descriptor for this render system. This must be re-interpret casted to RenderSystemDescriptor.
+\param[in] renderSystemDescSize Specifies the size of the descriptor. This must be equal to <tt>sizeof(RenderSystemDescriptor)</tt>.
+\param[out] probe Specifies the output probe. This must be re-interpret casted to RenderSystemProbe.
+\param[in] probeSize Specifies the size of the probe. This must be equal to <tt>sizeof(RenderSystemProbe)</tt>.
+\return Non-zero if the probe was successful.
+\remarks This function is optional and a headless render system will be allocated and released instead if this function is not present in a render system module.
+*/
+LLGL_EXPORT int LLGL_RenderSystem_Probe(const void* renderSystemDesc, int renderSystemDescSize, void* probe, int probeSize);
+
 #ifdef __cplusplus
 } // /extern "C"
 #endif
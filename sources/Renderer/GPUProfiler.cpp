@@ -0,0 +1,204 @@
+/*
+ * GPUProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/GPUProfiler.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/QueryHeap.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Core/Assertion.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+constexpr std::uint32_t GPUProfiler::invalidIndex;
+
+struct GPUProfilerFrame
+{
+    QueryHeap*                      queryHeap   = nullptr;
+    DynamicVector<GPUProfileRegion> regions;
+};
+
+struct GPUProfiler::Pimpl
+{
+    RenderSystem*                   renderSystem        = nullptr;
+    CommandQueue*                   commandQueue        = nullptr;
+    std::vector<GPUProfilerFrame>   frames;
+    std::uint32_t                   currentFrame        = 0;
+    std::uint32_t                   maxRegionsPerFrame  = 0;
+    std::vector<std::uint32_t>      regionStack;
+    std::vector<std::uint64_t>      queryResults;
+    DynamicVector<GPUProfileRegion> resolvedRegions;
+    bool                            hasNewResults       = false;
+    bool                            isSupported         = false;
+    std::uint64_t                   numDroppedFrames    = 0;
+};
+
+// OpenGLES has no timer queries, so QueryType::TimeElapsed cannot be used there.
+static bool IsTimerQuerySupported(const RenderSystem& renderSystem)
+{
+    switch (renderSystem.GetRendererID())
+    {
+        case RendererID::OpenGLES1:
+        case RendererID::OpenGLES2:
+        case RendererID::OpenGLES3:
+            return false;
+        default:
+            return true;
+    }
+}
+
+GPUProfiler::GPUProfiler(RenderSystem& renderSystem, const GPUProfilerDescriptor& profilerDesc) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->renderSystem        = &renderSystem;
+    pimpl_->commandQueue        = renderSystem.GetCommandQueue();
+    pimpl_->maxRegionsPerFrame  = profilerDesc.maxRegionsPerFrame;
+
+    if (!IsTimerQuerySupported(renderSystem) || profilerDesc.numFramesInFlight == 0 || profilerDesc.maxRegionsPerFrame == 0)
+        return;
+
+    /* Create one query heap per frame in flight, so no query is reused before its results have been read back */
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.debugName     = "LLGL.GPUProfiler";
+        queryHeapDesc.type          = QueryType::TimeElapsed;
+        queryHeapDesc.numQueries    = profilerDesc.maxRegionsPerFrame;
+    }
+
+    pimpl_->frames.resize(profilerDesc.numFramesInFlight);
+    pimpl_->isSupported = true;
+
+    for (GPUProfilerFrame& frame : pimpl_->frames)
+    {
+        frame.queryHeap = renderSystem.CreateQueryHeap(queryHeapDesc);
+        if (frame.queryHeap == nullptr)
+            pimpl_->isSupported = false;
+        frame.regions.reserve(profilerDesc.maxRegionsPerFrame);
+    }
+
+    pimpl_->queryResults.resize(profilerDesc.maxRegionsPerFrame);
+}
+
+GPUProfiler::~GPUProfiler()
+{
+    for (GPUProfilerFrame& frame : pimpl_->frames)
+    {
+        if (frame.queryHeap != nullptr)
+            pimpl_->renderSystem->Release(*frame.queryHeap);
+    }
+    delete pimpl_;
+}
+
+bool GPUProfiler::IsSupported() const
+{
+    return pimpl_->isSupported;
+}
+
+void GPUProfiler::NextFrame()
+{
+    if (!pimpl_->isSupported)
+        return;
+
+    LLGL_ASSERT(pimpl_->regionStack.empty(), "GPUProfiler::NextFrame() called with unfinished regions");
+
+    /* Advance to the next frame slot, which holds the oldest pending frame */
+    pimpl_->currentFrame = (pimpl_->currentFrame + 1) % static_cast<std::uint32_t>(pimpl_->frames.size());
+    GPUProfilerFrame& frame = pimpl_->frames[pimpl_->currentFrame];
+
+    if (!frame.regions.empty())
+    {
+        /* Read back results without waiting; drop this frame if the GPU has not finished it yet */
+        const std::uint32_t numRegions = static_cast<std::uint32_t>(frame.regions.size());
+        if (pimpl_->commandQueue->QueryResult(*frame.queryHeap, 0, numRegions, pimpl_->queryResults.data(), numRegions * sizeof(std::uint64_t)))
+        {
+            for_range(i, numRegions)
+                frame.regions[i].elapsedTime = pimpl_->queryResults[i];
+            pimpl_->resolvedRegions = frame.regions;
+            pimpl_->hasNewResults = true;
+        }
+        else
+            ++pimpl_->numDroppedFrames;
+
+        frame.regions.clear();
+    }
+}
+
+void GPUProfiler::BeginRegion(CommandBuffer& commandBuffer, const char* name)
+{
+    if (!pimpl_->isSupported)
+        return;
+
+    GPUProfilerFrame& frame = pimpl_->frames[pimpl_->currentFrame];
+
+    const std::uint32_t parent = (pimpl_->regionStack.empty() ? GPUProfiler::invalidIndex : pimpl_->regionStack.back());
+    const std::uint32_t depth  = static_cast<std::uint32_t>(pimpl_->regionStack.size());
+
+    if (frame.regions.size() < pimpl_->maxRegionsPerFrame)
+    {
+        /* Record new region and begin its query */
+        const std::uint32_t query = static_cast<std::uint32_t>(frame.regions.size());
+
+        GPUProfileRegion region;
+        {
+            region.name     = (name != nullptr ? name : "");
+            region.depth    = depth;
+            region.parent   = parent;
+        }
+        frame.regions.push_back(region);
+
+        commandBuffer.BeginQuery(*frame.queryHeap, query);
+        pimpl_->regionStack.push_back(query);
+    }
+    else
+    {
+        /* Region limit exceeded; keep stack balanced but don't record anything */
+        pimpl_->regionStack.push_back(GPUProfiler::invalidIndex);
+    }
+}
+
+void GPUProfiler::EndRegion(CommandBuffer& commandBuffer)
+{
+    if (!pimpl_->isSupported)
+        return;
+
+    LLGL_ASSERT(!pimpl_->regionStack.empty(), "GPUProfiler::EndRegion() called without matching GPUProfiler::BeginRegion()");
+
+    const std::uint32_t query = pimpl_->regionStack.back();
+    pimpl_->regionStack.pop_back();
+
+    if (query != GPUProfiler::invalidIndex)
+    {
+        GPUProfilerFrame& frame = pimpl_->frames[pimpl_->currentFrame];
+        commandBuffer.EndQuery(*frame.queryHeap, query);
+    }
+}
+
+bool GPUProfiler::GetResults(DynamicVector<GPUProfileRegion>& outRegions)
+{
+    if (!pimpl_->hasNewResults)
+        return false;
+    outRegions = pimpl_->resolvedRegions;
+    pimpl_->hasNewResults = false;
+    return true;
+}
+
+std::uint64_t GPUProfiler::GetNumDroppedFrames() const
+{
+    return pimpl_->numDroppedFrames;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
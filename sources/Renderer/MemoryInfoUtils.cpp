@@ -0,0 +1,55 @@
+/*
+ * MemoryInfoUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MemoryInfoUtils.h"
+#include <LLGL/Format.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT std::uint64_t GetTextureMemoryFootprint(const Texture& texture)
+{
+    const TextureDescriptor textureDesc = texture.GetDesc();
+    const TextureSubresource subresource{ 0, textureDesc.arrayLayers, 0, NumMipLevels(textureDesc) };
+    const std::uint64_t numSamples = (IsMultiSampleTexture(textureDesc.type) ? std::max(1u, textureDesc.samples) : 1u);
+    return static_cast<std::uint64_t>(GetMemoryFootprint(textureDesc.type, textureDesc.format, textureDesc.extent, subresource)) * numSamples;
+}
+
+LLGL_EXPORT std::uint64_t GetSwapChainMemoryFootprint(const SwapChain& swapChain)
+{
+    const Extent2D      resolution  = swapChain.GetResolution();
+    const std::size_t   numPixels   = static_cast<std::size_t>(resolution.x) * resolution.y * std::max(1u, swapChain.GetSamples());
+
+    std::uint64_t footprint = static_cast<std::uint64_t>(GetMemoryFootprint(swapChain.GetColorFormat(), numPixels)) * swapChain.GetNumSwapBuffers();
+    if (swapChain.GetDepthStencilFormat() != Format::Undefined)
+        footprint += GetMemoryFootprint(swapChain.GetDepthStencilFormat(), numPixels);
+
+    return footprint;
+}
+
+LLGL_EXPORT bool AppendMemoryHeapInfo(MemoryInfo& outInfo, bool deviceLocal, std::uint64_t budget, std::uint64_t usage)
+{
+    if (outInfo.numHeaps < LLGL_MAX_NUM_MEMORY_HEAPS)
+    {
+        MemoryHeapInfo& heap = outInfo.heaps[outInfo.numHeaps++];
+        heap.deviceLocal    = deviceLocal;
+        heap.budget         = budget;
+        heap.usage          = usage;
+        return true;
+    }
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,56 @@
+/*
+ * MemoryInfoUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MEMORY_INFO_UTILS_H
+#define LLGL_MEMORY_INFO_UTILS_H
+
+
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/SwapChain.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Returns the estimated memory footprint (in bytes) of the specified texture including all MIP-maps, array layers, and samples.
+LLGL_EXPORT std::uint64_t GetTextureMemoryFootprint(const Texture& texture);
+
+// Returns the estimated memory footprint (in bytes) of all color and depth-stencil buffers of the specified swap-chain.
+LLGL_EXPORT std::uint64_t GetSwapChainMemoryFootprint(const SwapChain& swapChain);
+
+// Accumulates the per-category memory of the specified buffers, textures, and swap-chains into the output memory info.
+template <typename TBufferContainer, typename TTextureContainer, typename TSwapChainContainer>
+void AccumulateMemoryInfo(
+    MemoryInfo&                 outInfo,
+    const TBufferContainer&     buffers,
+    const TTextureContainer&    textures,
+    const TSwapChainContainer&  swapChains)
+{
+    for (const auto& buffer : buffers)
+        outInfo.buffers += buffer->GetDesc().size;
+    for (const auto& texture : textures)
+        outInfo.textures += GetTextureMemoryFootprint(*texture);
+    for (const auto& swapChain : swapChains)
+        outInfo.renderTargets += GetSwapChainMemoryFootprint(*swapChain);
+}
+
+// Adds a memory heap with the specified attributes to the output memory info. Returns false if the maximum number of heaps has been reached.
+LLGL_EXPORT bool AppendMemoryHeapInfo(MemoryInfo& outInfo, bool deviceLocal, std::uint64_t budget, std::uint64_t usage);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
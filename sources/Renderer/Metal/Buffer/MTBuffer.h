@@ -19,6 +19,8 @@ namespace LLGL
 {
 
 
+class MTBufferHeapPool;
+
 class MTBuffer final : public Buffer
 {
 
@@ -28,7 +30,8 @@ class MTBuffer final : public Buffer
 
     public:
 
-        MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData);
+        // Sub-allocates the buffer from the heap pool if it is not null and the buffer is small enough; otherwise, allocates it from the device.
+        MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData, MTBufferHeapPool* bufferHeapPool = nullptr);
         ~MTBuffer();
 
         void Write(NSUInteger offset, const void* data, NSUInteger dataSize);
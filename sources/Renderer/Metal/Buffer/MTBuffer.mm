@@ -6,6 +6,8 @@
  */
 
 #include "MTBuffer.h"
+#include "MTBufferHeapPool.h"
+#include "../MTDevice.h"
 #include "../../ResourceUtils.h"
 #include <string.h>
 
@@ -14,12 +16,13 @@ namespace LLGL
 {
 
 
-static MTLResourceOptions GetMTLResourceOptions(const BufferDescriptor& desc)
+static MTLResourceOptions GetMTLResourceOptions(id<MTLDevice> device, const BufferDescriptor& desc)
 {
     #ifdef LLGL_OS_IOS
     return MTLResourceStorageModeShared;
     #else
-    if ((desc.miscFlags & MiscFlags::DynamicUsage) != 0)
+    /* With unified memory, shared buffers are written directly without notifying Metal via didModifyRange */
+    if ((desc.miscFlags & MiscFlags::DynamicUsage) != 0 || MTDevice::HasUnifiedMemory(device))
         return MTLResourceStorageModeShared;
     //else if ((desc.bindFlags & BindFlags::Storage) != 0)
     //    return MTLResourceStorageModePrivate;
@@ -28,16 +31,28 @@ static MTLResourceOptions GetMTLResourceOptions(const BufferDescriptor& desc)
     #endif
 }
 
-MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData) :
+MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData, MTBufferHeapPool* bufferHeapPool) :
     Buffer           { desc.bindFlags                   },
     indexType16Bits_ { (desc.format == Format::R16UInt) }
 {
-    auto opt = GetMTLResourceOptions(desc);
+    auto opt = GetMTLResourceOptions(device, desc);
 
     #ifndef LLGL_OS_IOS
     isManaged_ = ((opt & MTLResourceStorageModeManaged) != 0);
     #endif
 
+    /* Sub-allocate small buffers that are not written by shaders, since hazards are tracked for an entire heap */
+    if (bufferHeapPool != nullptr && (desc.bindFlags & BindFlags::Storage) == 0)
+    {
+        native_ = bufferHeapPool->NewBuffer((NSUInteger)desc.size, opt);
+        if (native_ != nil)
+        {
+            if (initialData)
+                ::memcpy([native_ contents], initialData, (NSUInteger)desc.size);
+            return;
+        }
+    }
+
     if (initialData)
         native_ = [device newBufferWithBytes:initialData length:(NSUInteger)desc.size options:opt];
     else
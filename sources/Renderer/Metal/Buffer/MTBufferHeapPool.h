@@ -0,0 +1,65 @@
+/*
+ * MTBufferHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_BUFFER_HEAP_POOL_H
+#define LLGL_MT_BUFFER_HEAP_POOL_H
+
+
+#import <Metal/Metal.h>
+
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Pool of shared Metal heaps that small buffers are sub-allocated from (see RendererConfigurationMetal::bufferHeapSize).
+Metal returns the memory of a buffer to its heap when the buffer is released, so heaps are only replaced once they are empty.
+This class is thread-safe, so buffers can be created concurrently.
+*/
+class MTBufferHeapPool
+{
+
+    public:
+
+        MTBufferHeapPool(id<MTLDevice> device, NSUInteger heapSize);
+        ~MTBufferHeapPool();
+
+        MTBufferHeapPool(const MTBufferHeapPool&) = delete;
+        MTBufferHeapPool& operator = (const MTBufferHeapPool&) = delete;
+
+        // Returns true if the running OS supports heaps with hazard tracking.
+        static bool IsSupported();
+
+        // Returns a new buffer from one of the heaps, or nil if the buffer is too large or does not use shared storage mode.
+        id<MTLBuffer> NewBuffer(NSUInteger length, MTLResourceOptions options);
+
+    private:
+
+        id<MTLHeap> CreateHeap();
+
+    private:
+
+        id<MTLDevice>               device_     = nil;
+        NSUInteger                  heapSize_   = 0;
+        std::vector<id<MTLHeap>>    heaps_;
+        std::mutex                  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,106 @@
+/*
+ * MTBufferHeapPool.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTBufferHeapPool.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+MTBufferHeapPool::MTBufferHeapPool(id<MTLDevice> device, NSUInteger heapSize) :
+    device_   { device   },
+    heapSize_ { heapSize }
+{
+}
+
+MTBufferHeapPool::~MTBufferHeapPool()
+{
+    for (id<MTLHeap> heap : heaps_)
+        [heap release];
+}
+
+bool MTBufferHeapPool::IsSupported()
+{
+    /* Heaps with tracked hazards require macOS 10.15 and iOS 13 */
+    if (@available(macOS 10.15, iOS 13.0, *))
+        return true;
+    return false;
+}
+
+id<MTLBuffer> MTBufferHeapPool::NewBuffer(NSUInteger length, MTLResourceOptions options)
+{
+    /* Only sub-allocate small buffers and only in the storage mode of the heaps */
+    if (length == 0 || length > heapSize_/4 || (options & MTLResourceStorageModeMask) != MTLResourceStorageModeShared)
+        return nil;
+
+    const MTLSizeAndAlign sizeAndAlign = [device_ heapBufferSizeAndAlignWithLength:length options:options];
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Find first heap with enough space */
+    for (id<MTLHeap> heap : heaps_)
+    {
+        if ([heap maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size)
+            return [heap newBufferWithLength:length options:options];
+    }
+
+    /* Release empty heaps before a new heap is created */
+    heaps_.erase(
+        std::remove_if(
+            heaps_.begin(),
+            heaps_.end(),
+            [](id<MTLHeap> heap) -> bool
+            {
+                if ([heap usedSize] == 0)
+                {
+                    [heap release];
+                    return true;
+                }
+                return false;
+            }
+        ),
+        heaps_.end()
+    );
+
+    id<MTLHeap> heap = CreateHeap();
+    if (heap == nil)
+        return nil;
+
+    heaps_.push_back(heap);
+    return [heap newBufferWithLength:length options:options];
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+id<MTLHeap> MTBufferHeapPool::CreateHeap()
+{
+    MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+    {
+        heapDesc.size           = heapSize_;
+        heapDesc.storageMode    = MTLStorageModeShared;
+        if (@available(macOS 10.15, iOS 13.0, *))
+        {
+            /* Heaps do not track hazards by default, which would require explicit fences between encoders */
+            heapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+        }
+    }
+    id<MTLHeap> heap = [device_ newHeapWithDescriptor:heapDesc];
+    [heapDesc release];
+    return heap;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
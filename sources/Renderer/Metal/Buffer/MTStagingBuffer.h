@@ -35,11 +35,11 @@ class MTStagingBuffer
         // Resets the writing offset.
         void Reset();
 
-        // Returns true if the remaining buffer size can fit the specified data size.
-        bool Capacity(NSUInteger dataSize) const;
+        // Returns true if the remaining buffer size can fit the specified data size after the writing offset has been aligned.
+        bool Capacity(NSUInteger dataSize, NSUInteger alignment = 1) const;
 
-        // Writes the specified data to the native Metal buffer.
-        void Write(const void* data, NSUInteger dataSize);
+        // Writes the specified data to the native Metal buffer at the next aligned offset and returns that offset.
+        NSUInteger Write(const void* data, NSUInteger dataSize, NSUInteger alignment = 1);
 
         // Returns the native MTLBuffer object.
         inline id<MTLBuffer> GetNative() const
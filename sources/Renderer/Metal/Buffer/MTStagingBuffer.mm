@@ -57,17 +57,24 @@ void MTStagingBuffer::Reset()
     offset_ = 0;
 }
 
-bool MTStagingBuffer::Capacity(NSUInteger dataSize) const
+static NSUInteger AlignOffset(NSUInteger offset, NSUInteger alignment)
 {
-    return (offset_ + dataSize <= size_);
+    return ((offset + alignment - 1) / alignment) * alignment;
 }
 
-void MTStagingBuffer::Write(const void* data, NSUInteger dataSize)
+bool MTStagingBuffer::Capacity(NSUInteger dataSize, NSUInteger alignment) const
+{
+    return (AlignOffset(offset_, alignment) + dataSize <= size_);
+}
+
+NSUInteger MTStagingBuffer::Write(const void* data, NSUInteger dataSize, NSUInteger alignment)
 {
     /* Copy data to CPU buffer region and increase offset for next data */
+    const NSUInteger writeOffset = AlignOffset(offset_, alignment);
     auto byteAlignedBuffer = reinterpret_cast<std::int8_t*>([native_ contents]);
-    ::memcpy(byteAlignedBuffer + offset_, data, dataSize);
-    offset_ += dataSize;
+    ::memcpy(byteAlignedBuffer + writeOffset, data, dataSize);
+    offset_ = writeOffset + dataSize;
+    return writeOffset;
 }
 
 
@@ -32,7 +32,8 @@ class MTStagingBufferPool
             const void*     data,
             NSUInteger      dataSize,
             id<MTLBuffer>&  srcBuffer,
-            NSUInteger&     srcOffset
+            NSUInteger&     srcOffset,
+            NSUInteger      alignment   = 1
         );
 
     private:
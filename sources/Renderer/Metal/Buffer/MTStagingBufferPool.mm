@@ -30,12 +30,13 @@ void MTStagingBufferPool::Write(
     const void*     data,
     NSUInteger      dataSize,
     id<MTLBuffer>&  srcBuffer,
-    NSUInteger&     srcOffset)
+    NSUInteger&     srcOffset,
+    NSUInteger      alignment)
 {
     /* Check if a new chunk must be allocated */
     if (chunkIdx_ == chunks_.size())
         AllocChunk(dataSize);
-    else if (!chunks_[chunkIdx_].Capacity(dataSize))
+    else if (!chunks_[chunkIdx_].Capacity(dataSize, alignment))
     {
         ++chunkIdx_;
         if (chunkIdx_ == chunks_.size())
@@ -44,9 +45,8 @@ void MTStagingBufferPool::Write(
 
     /* Write data to current chunk */
     auto& chunk = chunks_[chunkIdx_];
-    srcOffset = chunk.GetOffset();
     srcBuffer = chunk.GetNative();
-    chunk.Write(data, dataSize);
+    srcOffset = chunk.Write(data, dataSize, alignment);
 }
 
 
@@ -0,0 +1,86 @@
+/*
+ * MTStagingRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_STAGING_RING_H
+#define LLGL_MT_STAGING_RING_H
+
+
+#import <Metal/Metal.h>
+
+#include "MTStagingBufferPool.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Frame-fenced ring of shared-storage staging pools for transient data such as UpdateBuffer payloads and large uniform blocks.
+Each command buffer writes into its own frame, which is only recycled once that command buffer has completed.
+The ring starts triple-buffered and grows by another frame instead of blocking when all frames are still in flight.
+*/
+class MTStagingRing
+{
+
+    public:
+
+        MTStagingRing(id<MTLDevice> device, NSUInteger chunkSize = USHRT_MAX);
+        ~MTStagingRing();
+
+        MTStagingRing(const MTStagingRing&) = delete;
+        MTStagingRing& operator = (const MTStagingRing&) = delete;
+
+        // Begins a new frame for the specified command buffer. Must be called before the command buffer is committed.
+        void BeginFrame(id<MTLCommandBuffer> cmdBuffer);
+
+        // Writes the specified data into the current frame and returns the source buffer and offset.
+        void Write(
+            const void*     data,
+            NSUInteger      dataSize,
+            id<MTLBuffer>&  outSrcBuffer,
+            NSUInteger&     outSrcOffset,
+            NSUInteger      alignment   = 1
+        );
+
+    private:
+
+        struct Frame
+        {
+            Frame(id<MTLDevice> device, NSUInteger chunkSize);
+
+            MTStagingBufferPool                 pool;
+            std::shared_ptr<std::atomic_bool>   inFlight;
+        };
+
+    private:
+
+        // Marks the current frame as in-flight until its command buffer has completed.
+        void FenceCurrentFrame();
+
+    private:
+
+        id<MTLDevice>                       device_         = nil;
+        NSUInteger                          chunkSize_      = 0;
+        std::vector<std::unique_ptr<Frame>> frames_;
+        Frame*                              currentFrame_   = nullptr;
+        id<MTLCommandBuffer>                cmdBuffer_      = nil;
+        bool                                isFenced_       = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
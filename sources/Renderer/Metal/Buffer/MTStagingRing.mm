@@ -0,0 +1,108 @@
+/*
+ * MTStagingRing.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTStagingRing.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+static constexpr std::size_t g_numInitialFrames = 3;
+
+MTStagingRing::Frame::Frame(id<MTLDevice> device, NSUInteger chunkSize) :
+    pool     { device, chunkSize                       },
+    inFlight { std::make_shared<std::atomic_bool>(false) }
+{
+}
+
+MTStagingRing::MTStagingRing(id<MTLDevice> device, NSUInteger chunkSize) :
+    device_    { device    },
+    chunkSize_ { chunkSize }
+{
+    frames_.reserve(g_numInitialFrames);
+    for (std::size_t i = 0; i < g_numInitialFrames; ++i)
+        frames_.push_back(MakeUnique<Frame>(device, chunkSize));
+}
+
+MTStagingRing::~MTStagingRing()
+{
+    if (cmdBuffer_ != nil)
+        [cmdBuffer_ release];
+}
+
+void MTStagingRing::BeginFrame(id<MTLCommandBuffer> cmdBuffer)
+{
+    /* Completion handlers never run for a command buffer that was discarded without being committed */
+    if (cmdBuffer_ != nil)
+    {
+        if (isFenced_ && [cmdBuffer_ status] == MTLCommandBufferStatusNotEnqueued)
+            currentFrame_->inFlight->store(false, std::memory_order_release);
+        [cmdBuffer_ release];
+    }
+
+    /* Find the first frame whose command buffer has completed; the current frame can be reused right away if nothing was written to it */
+    currentFrame_ = nullptr;
+    for (const std::unique_ptr<Frame>& frame : frames_)
+    {
+        if (!frame->inFlight->load(std::memory_order_acquire))
+        {
+            currentFrame_ = frame.get();
+            break;
+        }
+    }
+
+    /* Grow ring instead of waiting for the GPU if all frames are still in flight */
+    if (currentFrame_ == nullptr)
+    {
+        frames_.push_back(MakeUnique<Frame>(device_, chunkSize_));
+        currentFrame_ = frames_.back().get();
+    }
+
+    currentFrame_->pool.Reset();
+    cmdBuffer_  = [cmdBuffer retain];
+    isFenced_   = false;
+}
+
+void MTStagingRing::Write(
+    const void*     data,
+    NSUInteger      dataSize,
+    id<MTLBuffer>&  outSrcBuffer,
+    NSUInteger&     outSrcOffset,
+    NSUInteger      alignment)
+{
+    if (!isFenced_)
+        FenceCurrentFrame();
+    currentFrame_->pool.Write(data, dataSize, outSrcBuffer, outSrcOffset, alignment);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void MTStagingRing::FenceCurrentFrame()
+{
+    /* Only fence frames that are actually written to, so unused frames never wait for a completion handler */
+    std::shared_ptr<std::atomic_bool> inFlight = currentFrame_->inFlight;
+    inFlight->store(true, std::memory_order_release);
+    [cmdBuffer_
+        addCompletedHandler:^(id<MTLCommandBuffer> cmdBuffer)
+        {
+            inFlight->store(false, std::memory_order_release);
+        }
+    ];
+    isFenced_ = true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #import <MetalKit/MetalKit.h>
 
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
 #include <cstdint>
 
 
@@ -24,6 +25,8 @@ class MTGraphicsPSO;
 class MTComputePSO;
 class MTRenderPass;
 class RenderTarget;
+class MTBuffer;
+class MTTexture;
 
 struct MTCmdExecute
 {
@@ -98,6 +101,13 @@ struct MTCmdGenerateMipmaps
     id<MTLTexture> texture;
 };
 
+struct MTCmdClearTexture
+{
+    MTTexture*          texture;
+    TextureSubresource  subresource;
+    ClearValue          clearValue;
+};
+
 struct MTCmdSetGraphicsPSO
 {
     MTGraphicsPSO* graphicsPSO;
@@ -131,6 +141,23 @@ struct MTCmdSetStencilRef
     StencilFace     face;
 };
 
+struct MTCmdSetCullMode
+{
+    MTLCullMode cullMode;
+};
+
+struct MTCmdSetDepthBias
+{
+    float depthBias;
+    float depthSlope;
+    float depthClamp;
+};
+
+struct MTCmdSetPrimitiveType
+{
+    MTLPrimitiveType primitiveType;
+};
+
 struct MTCmdSetUniforms
 {
     std::uint32_t   first;
@@ -164,6 +191,13 @@ struct MTCmdSetResource
     Resource*       resource;
 };
 
+struct MTCmdSetBufferRange
+{
+    std::uint32_t   descriptor;
+    MTBuffer*       buffer;
+    NSUInteger      offset;
+};
+
 struct MTCmdBeginRenderPass
 {
     RenderTarget*       renderTarget;
@@ -200,6 +234,29 @@ struct MTCmdDrawIndexed
     NSUInteger baseInstance;
 };
 
+struct MTCmdDrawIndirectCount
+{
+    id<MTLBuffer>   argumentsBuffer;
+    NSUInteger      argumentsOffset;
+    id<MTLBuffer>   countBuffer;
+    NSUInteger      countOffset;
+    NSUInteger      maxNumCommands;
+    NSUInteger      stride;
+};
+
+struct MTCmdDrawMeshThreadgroups
+{
+    MTLSize threadgroups;
+};
+
+struct MTCmdDrawMeshThreadgroupsIndirect
+{
+    id<MTLBuffer>   indirectBuffer;
+    NSUInteger      indirectBufferOffset;
+    NSUInteger      numCommands;
+    NSUInteger      stride;
+};
+
 struct MTCmdDispatchThreads
 {
     MTLSize threadgroups;
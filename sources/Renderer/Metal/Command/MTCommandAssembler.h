@@ -0,0 +1,40 @@
+/*
+ * MTCommandAssembler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_COMMAND_ASSEMBLER_H
+#define LLGL_MT_COMMAND_ASSEMBLER_H
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class JITProgram;
+class MTMultiSubmitCommandBuffer;
+
+/*
+Generates a native program that executes all commands of the specified multi-submit command buffer as straight-line function calls.
+The entry point takes a pointer to the MTCommandContext as its only argument. Returns null if no program could be generated.
+*/
+std::unique_ptr<JITProgram> AssembleMTMultiSubmitCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer);
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,288 @@
+/*
+ * MTCommandAssembler.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+#import <MetalKit/MetalKit.h>
+
+#include "MTCommandAssembler.h"
+#include "MTCommandExecutor.h"
+#include "MTCommand.h"
+#include "MTMultiSubmitCommandBuffer.h"
+#include "../../../JIT/JITCompiler.h"
+
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+
+
+namespace LLGL
+{
+
+
+/* Declare index of variadic argument of entry point for the command context */
+static const JITVarArg g_contextArg{ 0 };
+
+// Executes a single Metal command from the JIT program.
+static void ExecuteMTCommandWithContext(MTCommandContext* context, const void* pc, std::uint32_t opcode)
+{
+    ExecuteMTCommand(static_cast<MTOpcode>(opcode), pc, *context);
+}
+
+// Generates a call to the command executor with the opcode and command arguments as immediate values.
+static void AssembleMTCommandExecutorCall(JITCompiler& compiler, const MTOpcode opcode, const void* pc)
+{
+    compiler.Call(ExecuteMTCommandWithContext, g_contextArg, pc, static_cast<std::uint32_t>(opcode));
+}
+
+// Generates native CPU opcodes for the specified MTOpcode and returns the size (in bytes) of the command arguments; must match 'ExecuteMTCommand'.
+static std::size_t AssembleMTCommand(const MTOpcode opcode, const void* pc, JITCompiler& compiler)
+{
+    switch (opcode)
+    {
+        case MTOpcodeExecute:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdExecute);
+        }
+        case MTOpcodeCopyBuffer:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdCopyBuffer);
+        }
+        case MTOpcodeCopyBufferFromTexture:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdCopyBufferFromTexture);
+        }
+        case MTOpcodeCopyTexture:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdCopyTexture);
+        }
+        case MTOpcodeCopyTextureFromBuffer:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdCopyTextureFromBuffer);
+        }
+        case MTOpcodeCopyTextureFromFramebuffer:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdCopyTextureFromFramebuffer);
+        }
+        case MTOpcodeGenerateMipmaps:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdGenerateMipmaps);
+        }
+        case MTOpcodeClearTexture:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdClearTexture);
+        }
+        case MTOpcodeSetGraphicsPSO:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetGraphicsPSO);
+        }
+        case MTOpcodeSetComputePSO:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetComputePSO);
+        }
+        case MTOpcodeSetViewports:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetViewports*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(Viewport)*cmd->count);
+        }
+        case MTOpcodeSetScissorRects:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetScissorRects*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(Scissor)*cmd->count);
+        }
+        case MTOpcodeSetBlendColor:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetBlendColor);
+        }
+        case MTOpcodeSetStencilRef:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetStencilRef);
+        }
+        case MTOpcodeSetCullMode:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetCullMode);
+        }
+        case MTOpcodeSetDepthBias:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetDepthBias);
+        }
+        case MTOpcodeSetPrimitiveType:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetPrimitiveType);
+        }
+        case MTOpcodeSetUniforms:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetUniforms*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + cmd->dataSize);
+        }
+        case MTOpcodeSetVertexBuffers:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetVertexBuffers*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + (sizeof(id) + sizeof(NSUInteger))*cmd->count);
+        }
+        case MTOpcodeSetIndexBuffer:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetIndexBuffer);
+        }
+        case MTOpcodeSetResourceHeap:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetResourceHeap);
+        }
+        case MTOpcodeSetResource:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetResource);
+        }
+        case MTOpcodeSetBufferRange:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdSetBufferRange);
+        }
+        case MTOpcodeBeginRenderPass:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdBeginRenderPass*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case MTOpcodeEndRenderPass:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return 0;
+        }
+        case MTOpcodeClearRenderPass:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdClearRenderPass*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + (sizeof(std::uint32_t) + sizeof(MTLClearColor))*cmd->numAttachments);
+        }
+        case MTOpcodeDraw:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDraw);
+        }
+        case MTOpcodeDrawIndexed:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDrawIndexed);
+        }
+        case MTOpcodeDrawIndirectCount:
+        case MTOpcodeDrawIndexedIndirectCount:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDrawIndirectCount);
+        }
+        case MTOpcodeDrawMeshThreadgroups:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDrawMeshThreadgroups);
+        }
+        case MTOpcodeDrawMeshThreadgroupsIndirect:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDrawMeshThreadgroupsIndirect);
+        }
+        case MTOpcodeDispatchThreadgroups:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDispatchThreads);
+        }
+        case MTOpcodeDispatchThreadgroupsIndirect:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(MTCmdDispatchThreadsIndirect);
+        }
+        case MTOpcodePushDebugGroup:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdPushDebugGroup*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case MTOpcodePopDebugGroup:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return 0;
+        }
+        case MTOpcodePresentDrawables:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdPresentDrawables*>(pc);
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(id)*cmd->count);
+        }
+        case MTOpcodeFlush:
+        {
+            AssembleMTCommandExecutorCall(compiler, opcode, pc);
+            return 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+std::unique_ptr<JITProgram> AssembleMTMultiSubmitCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer)
+{
+    /* Try to create a JIT-compiler for the active architecture (if supported) */
+    if (auto compiler = JITCompiler::Create())
+    {
+        /* Declare variadic arguments for entry point of JIT program */
+        compiler->EntryPointVarArgs({ JIT::ArgType::Ptr });
+
+        /* Assemble Metal commands into JIT program */
+        compiler->Begin();
+
+        for (const MTVirtualCommandBuffer::ChunkPayloadView& chunk : cmdBuffer.GetVirtualCommandBuffer())
+        {
+            const char* pc      = chunk.data;
+            const char* pcEnd   = chunk.data + chunk.size;
+
+            while (pc < pcEnd)
+            {
+                /* Read opcode */
+                const MTOpcode opcode = *reinterpret_cast<const MTOpcode*>(pc);
+                pc += sizeof(MTOpcode);
+
+                /* Assemble command and increment program counter */
+                pc += AssembleMTCommand(opcode, pc, *compiler);
+            }
+        }
+
+        compiler->End();
+
+        /* Build final program; this is null if the program could not be encoded or executable memory is not available */
+        return compiler->FlushProgram();
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
+
+
+// ================================================================================
@@ -65,7 +65,6 @@ class MTCommandBuffer : public CommandBuffer
         MTCommandBuffer(id<MTLDevice> device, long flags);
 
         void ResetRenderStates();
-        void ResetStagingPool();
 
         void WriteStagingBuffer(
             const void*     data,
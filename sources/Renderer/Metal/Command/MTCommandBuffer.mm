@@ -43,11 +43,6 @@ void MTCommandBuffer::ResetRenderStates()
     currentStagingPool_ = (currentStagingPool_ + 1) % MTCommandBuffer::maxNumCommandBuffersInFlight;
 }
 
-void MTCommandBuffer::ResetStagingPool()
-{
-    stagingBufferPools_[currentStagingPool_].Reset();
-}
-
 void MTCommandBuffer::WriteStagingBuffer(
     const void*     data,
     NSUInteger      dataSize,
@@ -12,11 +12,16 @@
 #import <MetalKit/MetalKit.h>
 
 #include "../Buffer/MTIntermediateBuffer.h"
+#include "../Buffer/MTStagingRing.h"
+#include "MTIndirectDrawEncoder.h"
 #include "../RenderState/MTDescriptorCache.h"
 #include "../RenderState/MTConstantsCache.h"
 #include <LLGL/Constants.h>
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -33,6 +38,8 @@ class MTComputePSO;
 class MTPipelineState;
 class MTSwapChain;
 class MTRenderPass;
+class MTTexture;
+class MTMultiSubmitCommandBuffer;
 
 struct MTInternalBindingTable
 {
@@ -60,9 +67,17 @@ class MTCommandContext
         // Resets all internal states.
         void Reset();
 
-        // Resets the encoder scheduler with the new command buffer.
+        // Resets the encoder scheduler with the new command buffer and begins a new frame in the staging ring.
         void Reset(id<MTLCommandBuffer> cmdBuffer);
 
+        // Writes the specified data into the staging ring of the current command buffer and returns the source buffer and offset.
+        void WriteStagingBuffer(
+            const void*     data,
+            NSUInteger      dataSize,
+            id<MTLBuffer>&  outSrcBuffer,
+            NSUInteger&     outSrcOffset
+        );
+
         // Ends the currently bound command encoder.
         void Flush();
 
@@ -97,6 +112,30 @@ class MTCommandContext
         // Dispatches the current tessellation compute shader and returns the respective render encoder.
         id<MTLRenderCommandEncoder> DispatchTessellationAndGetRenderEncoder(NSUInteger numPatches, NSUInteger numInstances = 1);
 
+        /*
+        Queues the specified secondary command buffer to be encoded inside the current render pass.
+        Adjacent queued command buffers are encoded in parallel into sub-encoders of an <MTLParallelRenderCommandEncoder>
+        as soon as any other command encoder is requested or FlushParallelCommandBuffers() is called.
+        */
+        void QueueParallelCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer);
+
+        // Encodes all queued secondary command buffers. This is called implicitly when a command encoder is bound.
+        void FlushParallelCommandBuffers();
+
+        // Clears the texture subresource with a render pass for render targets, or by copying the encoded texel from an intermediate buffer otherwise.
+        void ClearTexture(MTTexture& textureMT, const TextureSubresource& subresource, const ClearValue& clearValue);
+
+        // Encodes the draw commands into an indirect command buffer (ICB) on the GPU and executes them with the render encoder.
+        void DrawIndirectCount(
+            id<MTLBuffer>   argumentsBuffer,
+            NSUInteger      argumentsOffset,
+            id<MTLBuffer>   countBuffer,
+            NSUInteger      countOffset,
+            NSUInteger      maxNumCommands,
+            NSUInteger      stride,
+            bool            indexed
+        );
+
     public:
 
         // Converts, binds, and stores the respective state in the internal render encoder state.
@@ -108,6 +147,9 @@ class MTCommandContext
         void SetGraphicsResourceHeap(MTResourceHeap* resourceHeap, std::uint32_t descriptorSet);
         void SetBlendColor(const float blendColor[4]);
         void SetStencilRef(std::uint32_t ref, const StencilFace face);
+        void SetCullMode(MTLCullMode cullMode);
+        void SetDepthBias(float depthBias, float depthSlope, float depthClamp);
+        void SetPrimitiveType(MTLPrimitiveType primitiveType);
 
         // Converts, binds, and stores the respective state in the internal compute encoder state.
         void SetComputePSO(MTComputePSO* pipelineState);
@@ -157,6 +199,12 @@ class MTCommandContext
             descriptorCache_.SetResource(descriptor, resource);
         }
 
+        // Sets the specified buffer with an offset in the descriptor cache. Metal buffer bindings have no size, so only the offset is used.
+        inline void SetBufferRange(std::uint32_t descriptor, MTBuffer& bufferMT, NSUInteger offset)
+        {
+            descriptorCache_.SetBufferRange(descriptor, bufferMT, offset);
+        }
+
         // Sets the specified uniforms in the constants cache.
         inline void SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
         {
@@ -207,6 +255,18 @@ class MTCommandContext
             return contextState_.threadsPerThreadgroup;
         }
 
+        // Returns the number of threads per object threadgroup of the bound mesh PSO.
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return contextState_.threadsPerObjectThreadgroup;
+        }
+
+        // Returns the number of threads per mesh threadgroup of the bound mesh PSO.
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return contextState_.threadsPerMeshThreadgroup;
+        }
+
         inline MTPipelineState* GetBoundPipelineState() const
         {
             return contextState_.boundPipelineState;
@@ -221,9 +281,14 @@ class MTCommandContext
 
         void BeginRenderPassWithDescriptor(MTLRenderPassDescriptor* renderPassDesc, MTSwapChain* swapChainMT);
         void BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor* renderPassDesc);
+        void SetVertexAmplification(std::uint32_t viewMask);
         void PauseRenderEncoder();
         void ResumeRenderEncoder();
 
+        // Binds the specified sub-encoder of a parallel render command encoder and ends it again.
+        void BeginSubRenderEncoder(id<MTLCommandBuffer> cmdBuffer, id<MTLRenderCommandEncoder> renderEncoder);
+        void EndSubRenderEncoder();
+
         void SubmitRenderEncoderState();
         void ResetRenderEncoderState();
 
@@ -249,6 +314,8 @@ class MTCommandContext
             DirtyBit_GraphicsResourceHeap   = (1 << 4),
             DirtyBit_BlendColor             = (1 << 5),
             DirtyBit_StencilRef             = (1 << 6),
+            DirtyBit_CullMode               = (1 << 7),
+            DirtyBit_DepthBias              = (1 << 8),
 
             // Compute encoder
             DirtyBit_ComputePSO             = (1 << 0),
@@ -276,6 +343,12 @@ class MTCommandContext
             std::uint32_t   stencilFrontRef                             = 0;
             std::uint32_t   stencilBackRef                              = 0;
             bool            stencilRefDynamic                           = false;
+
+            MTLCullMode     cullMode                                    = MTLCullModeNone;
+            float           depthBias                                   = 0.0f;
+            float           depthSlope                                  = 0.0f;
+            float           depthClamp                                  = 0.0f;
+            long            dynamicStates                               = 0;
         };
 
         struct MTComputeEncoderState
@@ -304,10 +377,14 @@ class MTCommandContext
             NSUInteger                  numPatchControlPoints   = 0;
             NSUInteger                  tessFactorSize          = 0;
             id<MTLComputePipelineState> tessPipelineState       = nil;
+
+            MTLSize                     threadsPerObjectThreadgroup = MTLSizeMake(1, 1, 1);
+            MTLSize                     threadsPerMeshThreadgroup   = MTLSizeMake(1, 1, 1);
         };
 
     private:
 
+        id<MTLDevice>                   device_                 = nil;
         id<MTLCommandBuffer>            cmdBuffer_              = nil;
 
         id<MTLRenderCommandEncoder>     renderEncoder_  	    = nil;
@@ -315,6 +392,7 @@ class MTCommandContext
         id<MTLBlitCommandEncoder>       blitEncoder_            = nil;
 
         MTLRenderPassDescriptor*        renderPassDesc_         = nullptr;
+        std::uint32_t                   viewMask_               = 0; // View mask of the current multiview render pass
         MTRenderEncoderState            renderEncoderState_;
         MTComputeEncoderState           computeEncoderState_;
         MTContextState                  contextState_;
@@ -323,13 +401,18 @@ class MTCommandContext
         MTDescriptorCache               descriptorCache_;
         MTConstantsCache                constantsCache_;
         MTIntermediateBuffer            tessFactorBuffer_;
+        MTStagingRing                   stagingRing_;
+        MTIndirectDrawEncoder           indirectDrawEncoder_;
         const NSUInteger                maxThreadgroupSizeX_    = 1;
 
-        std::uint8_t                    renderDirtyBits_        = 0;
+        std::uint16_t                   renderDirtyBits_        = 0;
         std::uint8_t                    computeDirtyBits_       = 0;
 
         MTSwapChain*                    boundSwapChain_         = nullptr;
 
+        std::vector<const MTMultiSubmitCommandBuffer*>  parallelCmdBuffers_;
+        std::vector<std::unique_ptr<MTCommandContext>>  parallelContexts_;
+
 };
 
 
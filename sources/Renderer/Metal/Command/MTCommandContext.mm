@@ -6,6 +6,8 @@
  */
 
 #include "MTCommandContext.h"
+#include "MTCommandExecutor.h"
+#include "MTMultiSubmitCommandBuffer.h"
 #include "../RenderState/MTDescriptorCache.h"
 #include "../RenderState/MTConstantsCache.h"
 #include "../RenderState/MTResourceHeap.h"
@@ -15,9 +17,15 @@
 #include "../Shader/MTShader.h"
 #include "../MTSwapChain.h"
 #include "../Texture/MTRenderTarget.h"
+#include "../Texture/MTTexture.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Threading.h"
+#include "../../../Core/LinearArena.h"
 #include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
 #include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Container/SmallVector.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/TypeInfo.h>
@@ -32,9 +40,12 @@ namespace LLGL
 static constexpr NSUInteger g_tessFactorBufferAlignment = (sizeof(MTLQuadTessellationFactorsHalf) * 256);
 
 MTCommandContext::MTCommandContext(id<MTLDevice> device) :
+    device_              { device                                },
     tessFactorBuffer_    { device,
                            MTLResourceStorageModePrivate,
                            g_tessFactorBufferAlignment           },
+    stagingRing_         { device                                },
+    indirectDrawEncoder_ { device                                },
     maxThreadgroupSizeX_ { device.maxThreadsPerThreadgroup.width }
 {
 }
@@ -46,6 +57,7 @@ void MTCommandContext::Reset()
     computeDirtyBits_       = ~0;
     isRenderEncoderPaused_  = false;
     boundSwapChain_         = nullptr;
+    parallelCmdBuffers_.clear();
     ResetRenderEncoderState();
     ResetComputeEncoderState();
     ResetContextState();
@@ -55,10 +67,23 @@ void MTCommandContext::Reset(id<MTLCommandBuffer> cmdBuffer)
 {
     Reset();
     cmdBuffer_ = cmdBuffer;
+    stagingRing_.BeginFrame(cmdBuffer);
+    indirectDrawEncoder_.Reset();
+}
+
+void MTCommandContext::WriteStagingBuffer(
+    const void*     data,
+    NSUInteger      dataSize,
+    id<MTLBuffer>&  outSrcBuffer,
+    NSUInteger&     outSrcOffset)
+{
+    stagingRing_.Write(data, dataSize, outSrcBuffer, outSrcOffset);
 }
 
 void MTCommandContext::Flush()
 {
+    FlushParallelCommandBuffers();
+
     if (renderEncoder_ != nil)
     {
         [renderEncoder_ endEncoding];
@@ -96,6 +121,7 @@ void MTCommandContext::BeginRenderPass(
     {
         /* Get render pass descriptor from render target */
         auto* renderTargetMT = LLGL_CAST(MTRenderTarget*, renderTarget);
+        viewMask_ = renderTargetMT->GetViewMask();
         if (renderPassMT != nullptr)
             BeginRenderPassWithDescriptor(renderTargetMT->GetAndUpdateNativeRenderPass(*renderPassMT, numClearValues, clearValues), nullptr);
         else
@@ -116,12 +142,15 @@ void MTCommandContext::EndRenderPass()
     {
         Flush();
         contextState_.isInsideRenderPass = false;
+        viewMask_ = 0;
         [renderPassDesc_ release];
     }
 }
 
 id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder()
 {
+    FlushParallelCommandBuffers();
+
     /* Resume render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState != MTEncoderState::Render)
         ResumeRenderEncoder();
@@ -134,6 +163,8 @@ id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder()
 
 id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
 {
+    FlushParallelCommandBuffers();
+
     /* Pause render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState == MTEncoderState::Render)
         PauseRenderEncoder();
@@ -161,6 +192,8 @@ id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
 
 id<MTLBlitCommandEncoder> MTCommandContext::BindBlitEncoder()
 {
+    FlushParallelCommandBuffers();
+
     /* Pause render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState == MTEncoderState::Render)
         PauseRenderEncoder();
@@ -187,7 +220,7 @@ id<MTLRenderCommandEncoder> MTCommandContext::FlushAndGetRenderEncoder()
     if (!descriptorCache_.IsEmpty())
         descriptorCache_.FlushGraphicsResources(GetRenderEncoder());
     if (!constantsCache_.IsEmpty())
-        constantsCache_.FlushGraphicsResources(GetRenderEncoder());
+        constantsCache_.FlushGraphicsResources(GetRenderEncoder(), stagingRing_);
 
     return GetRenderEncoder();
 }
@@ -202,7 +235,7 @@ id<MTLComputeCommandEncoder> MTCommandContext::FlushAndGetComputeEncoder()
     if (!descriptorCache_.IsEmpty())
         descriptorCache_.FlushComputeResources(GetComputeEncoder());
     if (!constantsCache_.IsEmpty())
-        constantsCache_.FlushComputeResources(GetComputeEncoder());
+        constantsCache_.FlushComputeResources(GetComputeEncoder(), stagingRing_);
 
     return GetComputeEncoder();
 }
@@ -288,6 +321,216 @@ id<MTLRenderCommandEncoder> MTCommandContext::DispatchTessellationAndGetRenderEn
     return renderEncoder;
 }
 
+void MTCommandContext::QueueParallelCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer)
+{
+    LLGL_ASSERT(contextState_.isInsideRenderPass, "parallel command buffers can only be encoded inside a render pass");
+    parallelCmdBuffers_.push_back(&cmdBuffer);
+}
+
+void MTCommandContext::FlushParallelCommandBuffers()
+{
+    if (parallelCmdBuffers_.empty())
+        return;
+
+    /*
+    Take queued command buffers first, since encoding them re-enters this function.
+    Copy them into the frame arena, so the member container keeps its capacity for the next flush.
+    */
+    SmallVector<const MTMultiSubmitCommandBuffer*, 8, ArenaAllocator<const MTMultiSubmitCommandBuffer*>> cmdBuffers(
+        parallelCmdBuffers_.begin(),
+        parallelCmdBuffers_.end()
+    );
+    parallelCmdBuffers_.clear();
+
+    /* A single command buffer is not worth the overhead of a parallel render command encoder */
+    const std::size_t numCmdBuffers = cmdBuffers.size();
+    if (numCmdBuffers == 1)
+    {
+        ExecuteMTMultiSubmitCommandBuffer(*cmdBuffers.front(), *this);
+        return;
+    }
+
+    /* End current render encoder and preserve its content for the parallel encoder */
+    PauseRenderEncoder();
+    ResumeRenderEncoder();
+    Flush();
+
+    id<MTLParallelRenderCommandEncoder> parallelEncoder = [cmdBuffer_ parallelRenderCommandEncoderWithDescriptor:renderPassDesc_];
+
+    /* Sub-encoders are executed in the order they were created, so create all of them before encoding in parallel */
+    while (parallelContexts_.size() < numCmdBuffers)
+        parallelContexts_.push_back(MakeUnique<MTCommandContext>(device_));
+
+    for_range(i, numCmdBuffers)
+        parallelContexts_[i]->BeginSubRenderEncoder(cmdBuffer_, [parallelEncoder renderCommandEncoder]);
+
+    DoConcurrent(
+        [this, &cmdBuffers](std::size_t i)
+        {
+            @autoreleasepool
+            {
+                ExecuteMTMultiSubmitCommandBuffer(*cmdBuffers[i], *parallelContexts_[i]);
+                parallelContexts_[i]->EndSubRenderEncoder();
+            }
+        },
+        numCmdBuffers,
+        LLGL_MAX_THREAD_COUNT,
+        1
+    );
+
+    [parallelEncoder endEncoding];
+
+    /* Subsequent render commands continue this render pass with a new render command encoder */
+    isRenderEncoderPaused_ = true;
+    ResumeRenderEncoder();
+    contextState_.encoderState = MTEncoderState::None;
+}
+
+void MTCommandContext::ClearTexture(MTTexture& textureMT, const TextureSubresource& subresource, const ClearValue& clearValue)
+{
+    const Format    format      = textureMT.GetFormat();
+    const bool      isTexture3D = (textureMT.GetType() == TextureType::Texture3D);
+
+    /* End current encoder, since each clear operation is encoded with its own render pass or blit encoder */
+    Flush();
+
+    if (([textureMT.GetNative() usage] & MTLTextureUsageRenderTarget) != 0)
+    {
+        /* Clear each MIP-map level and array layer (or depth plane) with the load action of an empty render pass */
+        MTLRenderPassDescriptor* renderPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+
+        for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+        {
+            const std::uint32_t baseLayer = (isTexture3D ? 0u : subresource.baseArrayLayer);
+            const std::uint32_t numLayers = (isTexture3D ? textureMT.GetMipExtent(mipLevel).z : subresource.numArrayLayers);
+
+            for_subrange(arrayLayer, baseLayer, baseLayer + numLayers)
+            {
+                auto InitAttachment = [&](MTLRenderPassAttachmentDescriptor* attachment)
+                {
+                    attachment.texture      = textureMT.GetNative();
+                    attachment.level        = mipLevel;
+                    attachment.slice        = (isTexture3D ? 0 : arrayLayer);
+                    attachment.depthPlane   = (isTexture3D ? arrayLayer : 0);
+                    attachment.loadAction   = MTLLoadActionClear;
+                    attachment.storeAction  = MTLStoreActionStore;
+                };
+
+                if (IsDepthOrStencilFormat(format))
+                {
+                    if (IsDepthFormat(format))
+                    {
+                        InitAttachment(renderPassDesc.depthAttachment);
+                        renderPassDesc.depthAttachment.clearDepth = static_cast<double>(clearValue.depth);
+                    }
+                    if (IsStencilFormat(format))
+                    {
+                        InitAttachment(renderPassDesc.stencilAttachment);
+                        renderPassDesc.stencilAttachment.clearStencil = clearValue.stencil;
+                    }
+                }
+                else
+                {
+                    InitAttachment(renderPassDesc.colorAttachments[0]);
+                    renderPassDesc.colorAttachments[0].clearColor = MTLClearColorMake(
+                        static_cast<double>(clearValue.color[0]),
+                        static_cast<double>(clearValue.color[1]),
+                        static_cast<double>(clearValue.color[2]),
+                        static_cast<double>(clearValue.color[3])
+                    );
+                }
+
+                id<MTLRenderCommandEncoder> renderEncoder = [cmdBuffer_ renderCommandEncoderWithDescriptor:renderPassDesc];
+                [renderEncoder endEncoding];
+            }
+        }
+    }
+    else
+    {
+        /* Copy the encoded texel from an intermediate buffer, since storage textures cannot be cleared with a render pass */
+        std::uint8_t element[g_maxClearElementSize];
+        const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+        if (elementSize == 0)
+            return;
+
+        const Extent3D      baseExtent  = textureMT.GetMipExtent(subresource.baseMipLevel);
+        const NSUInteger    bufferSize  = static_cast<NSUInteger>(elementSize) * baseExtent.x * baseExtent.y * baseExtent.z;
+
+        id<MTLBuffer> intermediateBuffer = [[cmdBuffer_ device] newBufferWithLength:bufferSize options:MTLResourceStorageModeShared];
+        std::uint8_t* contents = reinterpret_cast<std::uint8_t*>([intermediateBuffer contents]);
+        for (NSUInteger i = 0; i < bufferSize; i += elementSize)
+            ::memcpy(contents + i, element, elementSize);
+
+        auto blitEncoder = BindBlitEncoder();
+
+        for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+        {
+            const Extent3D      mipExtent   = textureMT.GetMipExtent(mipLevel);
+            const std::uint32_t baseLayer   = (isTexture3D ? 0u : subresource.baseArrayLayer);
+            const std::uint32_t numLayers   = (isTexture3D ? 1u : subresource.numArrayLayers);
+            const MTLSize       size        = MTLSizeMake(mipExtent.x, (textureMT.GetType() == TextureType::Texture1DArray ? 1 : mipExtent.y), (isTexture3D ? mipExtent.z : 1));
+
+            for_subrange(arrayLayer, baseLayer, baseLayer + numLayers)
+            {
+                [blitEncoder
+                    copyFromBuffer:         intermediateBuffer
+                    sourceOffset:           0
+                    sourceBytesPerRow:      elementSize * size.width
+                    sourceBytesPerImage:    elementSize * size.width * size.height
+                    sourceSize:             size
+                    toTexture:              textureMT.GetNative()
+                    destinationSlice:       arrayLayer
+                    destinationLevel:       mipLevel
+                    destinationOrigin:      MTLOriginMake(0, 0, 0)
+                ];
+            }
+        }
+
+        [intermediateBuffer release];
+    }
+}
+
+void MTCommandContext::DrawIndirectCount(
+    id<MTLBuffer>   argumentsBuffer,
+    NSUInteger      argumentsOffset,
+    id<MTLBuffer>   countBuffer,
+    NSUInteger      countOffset,
+    NSUInteger      maxNumCommands,
+    NSUInteger      stride,
+    bool            indexed)
+{
+    if (maxNumCommands == 0)
+        return;
+
+    /* Encode draw commands into ICB with builtin compute kernel */
+    id<MTLComputeCommandEncoder> computeEncoder = BindComputeEncoder();
+
+    const NSRange commandRange = indirectDrawEncoder_.EncodeDraws(
+        computeEncoder,
+        contextState_.primitiveType,
+        argumentsBuffer,
+        argumentsOffset,
+        countBuffer,
+        countOffset,
+        maxNumCommands,
+        stride,
+        (indexed ? contextState_.indexBuffer : nil),
+        contextState_.indexBufferOffset,
+        contextState_.indexType
+    );
+
+    /* Compute kernel has overridden the compute PSO and its buffer slots */
+    computeDirtyBits_ = ~0;
+
+    /* Execute encoded draw commands with the render encoder; the index buffer is only referenced indirectly by the ICB */
+    id<MTLRenderCommandEncoder> renderEncoder = FlushAndGetRenderEncoder();
+
+    if (indexed)
+        [renderEncoder useResource:contextState_.indexBuffer usage:MTLResourceUsageRead];
+
+    [renderEncoder executeCommandsInBuffer:indirectDrawEncoder_.GetNative() withRange:commandRange];
+}
+
 static void ConvertMTLViewport(MTLViewport& dst, const Viewport& src)
 {
     const double scaling = 1.0;//2.0 for retina display
@@ -364,6 +607,7 @@ void MTCommandContext::SetGraphicsPSO(MTGraphicsPSO* pipelineState)
         renderEncoderState_.blendColorDynamic       = pipelineState->IsBlendColorDynamic();
         renderEncoderState_.stencilRefDynamic       = pipelineState->IsStencilRefDynamic();
         renderEncoderState_.isScissorTestEnabled    = pipelineState->HasScissorTest();
+        renderEncoderState_.dynamicStates           = pipelineState->GetDynamicStates();
 
         const bool hasStaticViewportAndScissor = pipelineState->GetStaticState(
             renderEncoderState_.viewports,
@@ -383,6 +627,9 @@ void MTCommandContext::SetGraphicsPSO(MTGraphicsPSO* pipelineState)
         contextState_.numPatchControlPoints = pipelineState->GetNumPatchControlPoints();
         contextState_.tessPipelineState     = pipelineState->GetTessPipelineState();
         contextState_.tessFactorSize        = GetTessFactorSizeForPatchType(pipelineState->GetPatchType());
+
+        contextState_.threadsPerObjectThreadgroup   = pipelineState->GetThreadsPerObjectThreadgroup();
+        contextState_.threadsPerMeshThreadgroup     = pipelineState->GetThreadsPerMeshThreadgroup();
     }
 }
 
@@ -420,6 +667,26 @@ void MTCommandContext::SetStencilRef(std::uint32_t ref, const StencilFace face)
     renderDirtyBits_ |= DirtyBit_StencilRef;
 }
 
+void MTCommandContext::SetCullMode(MTLCullMode cullMode)
+{
+    renderEncoderState_.cullMode = cullMode;
+    renderDirtyBits_ |= DirtyBit_CullMode;
+}
+
+void MTCommandContext::SetDepthBias(float depthBias, float depthSlope, float depthClamp)
+{
+    renderEncoderState_.depthBias   = depthBias;
+    renderEncoderState_.depthSlope  = depthSlope;
+    renderEncoderState_.depthClamp  = depthClamp;
+    renderDirtyBits_ |= DirtyBit_DepthBias;
+}
+
+void MTCommandContext::SetPrimitiveType(MTLPrimitiveType primitiveType)
+{
+    /* Primitive type is passed to each draw command, so no encoder state must be flushed here */
+    contextState_.primitiveType = primitiveType;
+}
+
 void MTCommandContext::SetComputePSO(MTComputePSO* pipelineState)
 {
     if (pipelineState != nullptr && computeEncoderState_.computePSO != pipelineState)
@@ -455,7 +722,7 @@ void MTCommandContext::RebindResourceHeap(id<MTLComputeCommandEncoder> computeEn
     if (!descriptorCache_.IsEmpty())
         descriptorCache_.FlushComputeResourcesForced(computeEncoder);
     if (!constantsCache_.IsEmpty())
-        constantsCache_.FlushComputeResourcesForced(computeEncoder);
+        constantsCache_.FlushComputeResourcesForced(computeEncoder, stagingRing_);
 }
 
 void MTCommandContext::SetIndexStream(id<MTLBuffer> indexBuffer, NSUInteger offset, bool indexType16Bits)
@@ -507,6 +774,10 @@ void MTCommandContext::BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor*
     Flush();
     renderEncoder_ = [cmdBuffer_ renderCommandEncoderWithDescriptor:renderPassDesc];
 
+    /* Vertex amplification is encoder state, so it must be set for each new render command encoder */
+    if (viewMask_ != 0)
+        SetVertexAmplification(viewMask_);
+
     /* A new render command encoder forces all pipeline states to be reset */
     renderDirtyBits_ = ~0;
 
@@ -520,6 +791,26 @@ void MTCommandContext::BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor*
     contextState_.encoderState = MTEncoderState::Render;
 }
 
+void MTCommandContext::SetVertexAmplification(std::uint32_t viewMask)
+{
+    if (@available(macOS 10.15.4, iOS 13.0, *))
+    {
+        /* Map each amplification to the layer of its view bit; render targets bind only the rendered layers starting at slice 0 */
+        MTLVertexAmplificationViewMapping viewMappings[32];
+        NSUInteger numViews = 0;
+        for_range(i, 32u)
+        {
+            if ((viewMask & (1u << i)) != 0)
+            {
+                viewMappings[numViews].viewportArrayIndexOffset     = 0;
+                viewMappings[numViews].renderTargetArrayIndexOffset = i;
+                ++numViews;
+            }
+        }
+        [renderEncoder_ setVertexAmplificationCount:numViews viewMappings:viewMappings];
+    }
+}
+
 void MTCommandContext::PauseRenderEncoder()
 {
     if (renderEncoder_ != nil && !isRenderEncoderPaused_)
@@ -530,25 +821,49 @@ void MTCommandContext::ResumeRenderEncoder()
 {
     if (isRenderEncoderPaused_)
     {
-        /* Bind new render command encoder with previous render pass */
+        /* Bind new render command encoder with previous render pass; memoryless attachments cannot be reloaded */
         for_range(i, 8u)
         {
             if (renderPassDesc_.colorAttachments[i].texture != nil)
             {
-                renderPassDesc_.colorAttachments[i].loadAction = MTLLoadActionLoad;
+                if (!MTTexture::IsMemoryless(renderPassDesc_.colorAttachments[i].texture))
+                    renderPassDesc_.colorAttachments[i].loadAction = MTLLoadActionLoad;
                 //renderPassDesc_.colorAttachments[i].storeAction = MTLStoreActionStore;
             }
             else
                 break;
         }
-        if (renderPassDesc_.depthAttachment.texture != nil)
+        if (renderPassDesc_.depthAttachment.texture != nil && !MTTexture::IsMemoryless(renderPassDesc_.depthAttachment.texture))
             renderPassDesc_.depthAttachment.loadAction = MTLLoadActionLoad;
-        if (renderPassDesc_.stencilAttachment != nil)
+        if (renderPassDesc_.stencilAttachment != nil && !MTTexture::IsMemoryless(renderPassDesc_.stencilAttachment.texture))
             renderPassDesc_.stencilAttachment.loadAction = MTLLoadActionLoad;
         isRenderEncoderPaused_ = false;
     }
 }
 
+void MTCommandContext::BeginSubRenderEncoder(id<MTLCommandBuffer> cmdBuffer, id<MTLRenderCommandEncoder> renderEncoder)
+{
+    Reset(cmdBuffer);
+    renderEncoder_ = renderEncoder;
+
+    /* Invalidate descriptor and constant caches */
+    if (!descriptorCache_.IsEmpty())
+        descriptorCache_.Reset();
+    if (!constantsCache_.IsEmpty())
+        constantsCache_.Reset();
+
+    /* Sub-encoders cannot be replaced, so pretend this context is inside a render pass without a descriptor */
+    contextState_.isInsideRenderPass    = true;
+    contextState_.encoderState          = MTEncoderState::Render;
+}
+
+void MTCommandContext::EndSubRenderEncoder()
+{
+    [renderEncoder_ endEncoding];
+    renderEncoder_ = nil;
+    contextState_.isInsideRenderPass = false;
+}
+
 void MTCommandContext::SubmitRenderEncoderState()
 {
     if (renderEncoder_ == nil)
@@ -625,6 +940,20 @@ void MTCommandContext::SubmitRenderEncoderState()
         else
             [renderEncoder_ setStencilReferenceValue:renderEncoderState_.stencilFrontRef];
     }
+    if ((renderEncoderState_.dynamicStates & DynamicStateFlags::CullMode) != 0 && (renderDirtyBits_ & (DirtyBit_CullMode | DirtyBit_GraphicsPSO)) != 0)
+    {
+        /* Set dynamic cull mode (re-applied after the PSO since it overrides this state) */
+        [renderEncoder_ setCullMode:renderEncoderState_.cullMode];
+    }
+    if ((renderEncoderState_.dynamicStates & DynamicStateFlags::DepthBias) != 0 && (renderDirtyBits_ & (DirtyBit_DepthBias | DirtyBit_GraphicsPSO)) != 0)
+    {
+        /* Set dynamic depth bias */
+        [renderEncoder_
+            setDepthBias:   renderEncoderState_.depthBias
+            slopeScale:     renderEncoderState_.depthSlope
+            clamp:          renderEncoderState_.depthClamp
+        ];
+    }
 
     /* Reset all dirty bits */
     renderDirtyBits_ = 0;
@@ -9,6 +9,10 @@
 #define LLGL_MT_COMMAND_EXECUTOR_H
 
 
+#include "MTCommandOpcode.h"
+#include <cstddef>
+
+
 namespace LLGL
 {
 
@@ -19,6 +23,9 @@ class MTCommandContext;
 class MTCommandBuffer;
 class MTMultiSubmitCommandBuffer;
 
+// Executes a single Metal command and returns the size (in bytes) of the command arguments.
+std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCommandContext& context);
+
 /*
 Executes all Metal commands that have been recorded in the specified command buffer.
 Metal render states are tracked with the specified command context.
@@ -26,6 +33,13 @@ Metal render states are tracked with the specified command context.
 void ExecuteMTMultiSubmitCommandBuffer(const MTMultiSubmitCommandBuffer& cmdbuffer, MTCommandContext& context);
 void ExecuteMTCommandBuffer(const MTCommandBuffer& cmdbuffer, MTCommandContext& context);
 
+/*
+Executes the specified secondary command buffer within a primary command buffer.
+Inside a render pass, secondary command buffers that only record render commands are queued in the command context
+so adjacent ones can be encoded in parallel (see MTCommandContext::QueueParallelCommandBuffer).
+*/
+void ExecuteMTSecondaryCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer, MTCommandContext& context);
+
 // Executes the specified native Metal command.
 void ExecuteNativeMTCommand(const Metal::NativeCommand& cmd, MTCommandContext& context);
 
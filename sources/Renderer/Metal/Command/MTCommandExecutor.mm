@@ -20,24 +20,29 @@
 #include "../MTTypes.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
 
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/Metal/NativeCommand.h>
 #include <LLGL/TypeInfo.h>
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "../../../JIT/JITProgram.h"
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 
 namespace LLGL
 {
 
 
-static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCommandContext& context)
+std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCommandContext& context)
 {
     switch (opcode)
     {
         case MTOpcodeExecute:
         {
             auto* cmd = reinterpret_cast<const MTCmdExecute*>(pc);
-            ExecuteMTMultiSubmitCommandBuffer(*(cmd->commandBuffer), context);
+            ExecuteMTSecondaryCommandBuffer(*(cmd->commandBuffer), context);
             return sizeof(*cmd);
         }
         case MTOpcodeCopyBuffer:
@@ -150,6 +155,12 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             [blitEncoder generateMipmapsForTexture:cmd->texture];
             return sizeof(*cmd);
         }
+        case MTOpcodeClearTexture:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdClearTexture*>(pc);
+            context.ClearTexture(*cmd->texture, cmd->subresource, cmd->clearValue);
+            return sizeof(*cmd);
+        }
         case MTOpcodeSetGraphicsPSO:
         {
             auto* cmd = reinterpret_cast<const MTCmdSetGraphicsPSO*>(pc);
@@ -186,6 +197,24 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             context.SetStencilRef(cmd->ref, cmd->face);
             return sizeof(*cmd);
         }
+        case MTOpcodeSetCullMode:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetCullMode*>(pc);
+            context.SetCullMode(cmd->cullMode);
+            return sizeof(*cmd);
+        }
+        case MTOpcodeSetDepthBias:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetDepthBias*>(pc);
+            context.SetDepthBias(cmd->depthBias, cmd->depthSlope, cmd->depthClamp);
+            return sizeof(*cmd);
+        }
+        case MTOpcodeSetPrimitiveType:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetPrimitiveType*>(pc);
+            context.SetPrimitiveType(cmd->primitiveType);
+            return sizeof(*cmd);
+        }
         case MTOpcodeSetUniforms:
         {
             auto* cmd = reinterpret_cast<const MTCmdSetUniforms*>(pc);
@@ -230,6 +259,12 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             context.SetResource(cmd->descriptor, *(cmd->resource));
             return sizeof(*cmd);
         }
+        case MTOpcodeSetBufferRange:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetBufferRange*>(pc);
+            context.SetBufferRange(cmd->descriptor, *(cmd->buffer), cmd->offset);
+            return sizeof(*cmd);
+        }
         case MTOpcodeBeginRenderPass:
         {
             auto* cmd = reinterpret_cast<const MTCmdBeginRenderPass*>(pc);
@@ -352,6 +387,55 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             }
             return sizeof(*cmd);
         }
+        case MTOpcodeDrawIndirectCount:
+        case MTOpcodeDrawIndexedIndirectCount:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdDrawIndirectCount*>(pc);
+            if (context.GetNumPatchControlPoints() > 0)
+                LLGL_TRAP("tessellation with indirect arguments not supported in Metal backend yet");
+            context.DrawIndirectCount(
+                cmd->argumentsBuffer,
+                cmd->argumentsOffset,
+                cmd->countBuffer,
+                cmd->countOffset,
+                cmd->maxNumCommands,
+                cmd->stride,
+                (opcode == MTOpcodeDrawIndexedIndirectCount)
+            );
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawMeshThreadgroups:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdDrawMeshThreadgroups*>(pc);
+            if (@available(macOS 13.0, iOS 16.0, *))
+            {
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                [renderEncoder
+                    drawMeshThreadgroups:           cmd->threadgroups
+                    threadsPerObjectThreadgroup:    context.GetThreadsPerObjectThreadgroup() // current PSO parameter
+                    threadsPerMeshThreadgroup:      context.GetThreadsPerMeshThreadgroup() // current PSO parameter
+                ];
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawMeshThreadgroupsIndirect:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdDrawMeshThreadgroupsIndirect*>(pc);
+            if (@available(macOS 13.0, iOS 16.0, *))
+            {
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                for_range(i, cmd->numCommands)
+                {
+                    [renderEncoder
+                        drawMeshThreadgroupsWithIndirectBuffer: cmd->indirectBuffer
+                        indirectBufferOffset:                   cmd->indirectBufferOffset + cmd->stride * i
+                        threadsPerObjectThreadgroup:            context.GetThreadsPerObjectThreadgroup() // current PSO parameter
+                        threadsPerMeshThreadgroup:              context.GetThreadsPerMeshThreadgroup() // current PSO parameter
+                    ];
+                }
+            }
+            return sizeof(*cmd);
+        }
         case MTOpcodeDispatchThreadgroups:
         {
             auto* cmd = reinterpret_cast<const MTCmdDispatchThreads*>(pc);
@@ -377,6 +461,7 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
         {
             auto* cmd = reinterpret_cast<const MTCmdPushDebugGroup*>(pc);
             #ifdef LLGL_GLEXT_DEBUG
+            context.FlushParallelCommandBuffers();
             [context.GetCommandBuffer() pushDebugGroup:[NSString stringWithUTF8String:reinterpret_cast<const char*>(cmd + 1)]];
             #endif
             return (sizeof(*cmd) + cmd->length + 1);
@@ -384,6 +469,7 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
         case MTOpcodePopDebugGroup:
         {
             #ifdef LLGL_GLEXT_DEBUG
+            context.FlushParallelCommandBuffers();
             [context.GetCommandBuffer() popDebugGroup];
             #endif
             return 0;
@@ -426,10 +512,39 @@ static void ExecuteMTCommandsEmulated(const MTVirtualCommandBuffer& virtualCmdBu
     }
 }
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+static void ExecuteMTCommandsNatively(const JITProgram& exec, MTCommandContext& context)
+{
+    /* Execute native program and pass pointer to command context; entry point must not be called as variadic function on ARM64 */
+    auto entryPoint = reinterpret_cast<void(*)(MTCommandContext*)>(exec.GetEntryPoint());
+    entryPoint(&context);
+}
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 void ExecuteMTMultiSubmitCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer, MTCommandContext& context)
 {
-    /* Emulate execution of Metal commands */
-    ExecuteMTCommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), context);
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+    if (const JITProgram* exec = cmdBuffer.GetExecutable().get())
+    {
+        /* Execute Metal commands with native executable */
+        ExecuteMTCommandsNatively(*exec, context);
+    }
+    else
+    #endif // /LLGL_ENABLE_JIT_COMPILER
+    {
+        /* Emulate execution of Metal commands */
+        ExecuteMTCommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), context);
+    }
+}
+
+void ExecuteMTSecondaryCommandBuffer(const MTMultiSubmitCommandBuffer& cmdBuffer, MTCommandContext& context)
+{
+    if (context.IsInsideRenderPass() && cmdBuffer.IsRenderEncoderOnly())
+        context.QueueParallelCommandBuffer(cmdBuffer);
+    else
+        ExecuteMTMultiSubmitCommandBuffer(cmdBuffer, context);
 }
 
 void ExecuteMTCommandBuffer(const MTCommandBuffer& cmdBuffer, MTCommandContext& context)
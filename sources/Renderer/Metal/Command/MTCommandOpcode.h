@@ -26,22 +26,31 @@ enum MTOpcode : std::uint8_t
     MTOpcodeCopyTextureFromBuffer,
     MTOpcodeCopyTextureFromFramebuffer,
     MTOpcodeGenerateMipmaps,
+    MTOpcodeClearTexture,
     MTOpcodeSetGraphicsPSO,
     MTOpcodeSetComputePSO,
     MTOpcodeSetViewports,
     MTOpcodeSetScissorRects,
     MTOpcodeSetBlendColor,
     MTOpcodeSetStencilRef,
+    MTOpcodeSetCullMode,
+    MTOpcodeSetDepthBias,
+    MTOpcodeSetPrimitiveType,
     MTOpcodeSetUniforms,
     MTOpcodeSetVertexBuffers,
     MTOpcodeSetIndexBuffer,
     MTOpcodeSetResourceHeap,
     MTOpcodeSetResource,
+    MTOpcodeSetBufferRange,
     MTOpcodeBeginRenderPass,
     MTOpcodeEndRenderPass,
     MTOpcodeClearRenderPass,
     MTOpcodeDraw,
     MTOpcodeDrawIndexed,
+    MTOpcodeDrawIndirectCount,
+    MTOpcodeDrawIndexedIndirectCount,
+    MTOpcodeDrawMeshThreadgroups,
+    MTOpcodeDrawMeshThreadgroupsIndirect,
     MTOpcodeDispatchThreadgroups,
     MTOpcodeDispatchThreadgroupsIndirect,
     MTOpcodePushDebugGroup,
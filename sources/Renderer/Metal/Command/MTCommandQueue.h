@@ -31,6 +31,12 @@ class MTCommandQueue final : public CommandQueue
         MTCommandQueue(id<MTLDevice> device);
         ~MTCommandQueue();
 
+        bool QueryTimestampCalibration(TimestampCalibration& outCalibration) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings) override;
+
     public:
 
         // Returns the native MTLCommandQueue object.
@@ -48,6 +54,9 @@ class MTCommandQueue final : public CommandQueue
         id<MTLCommandBuffer>    lastSubmittedCmdBuffer_ = nil;
         MTCommandContext        context_;
 
+        std::uint64_t           firstCPUTimestamp_      = 0; // First sample to estimate the GPU timestamp frequency
+        std::uint64_t           firstGPUTimestamp_      = 0;
+
 };
 
 
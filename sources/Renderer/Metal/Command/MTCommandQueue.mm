@@ -9,7 +9,11 @@
 #include "MTDirectCommandBuffer.h"
 #include "MTMultiSubmitCommandBuffer.h"
 #include "MTCommandExecutor.h"
+#include "../Texture/MTTexture.h"
+#include "../RenderState/MTFence.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -33,6 +37,8 @@ MTCommandQueue::~MTCommandQueue()
 
 void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_CPU_PROFILE_SCOPE("CommandQueue::Submit");
+
     auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, commandBuffer);
     if (commandBufferMT.IsMultiSubmitCmdBuffer())
     {
@@ -64,16 +70,67 @@ bool MTCommandQueue::QueryResult(
     return false; //todo
 }
 
+bool MTCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    if (@available(macOS 10.15, iOS 14.0, *))
+    {
+        /* CPU timestamp is in nanoseconds of the same clock as mach_absolute_time, i.e. the same as Timer::Tick */
+        MTLTimestamp cpuTimestamp = 0, gpuTimestamp = 0;
+        [[native_ device] sampleTimestamps:&cpuTimestamp gpuTimestamp:&gpuTimestamp];
+
+        /* Metal does not report the GPU timestamp frequency, so estimate it from the first sample and assume nanoseconds until 1ms has passed */
+        if (firstCPUTimestamp_ == 0)
+        {
+            firstCPUTimestamp_ = cpuTimestamp;
+            firstGPUTimestamp_ = gpuTimestamp;
+        }
+
+        std::uint64_t gpuFrequency = 1000000000ull;
+        const std::uint64_t cpuElapsedTime = cpuTimestamp - firstCPUTimestamp_;
+        if (cpuElapsedTime >= 1000000ull && gpuTimestamp > firstGPUTimestamp_)
+            gpuFrequency = static_cast<std::uint64_t>(static_cast<double>(gpuTimestamp - firstGPUTimestamp_) * 1.0e9 / static_cast<double>(cpuElapsedTime) + 0.5);
+
+        outCalibration.gpuTimestamp = gpuTimestamp;
+        outCalibration.gpuFrequency = gpuFrequency;
+        outCalibration.cpuTicks     = cpuTimestamp;
+        outCalibration.maxDeviation = 0;
+        return true;
+    }
+    return false;
+}
+
 /* ----- Fences ----- */
 
 void MTCommandQueue::Submit(Fence& fence)
 {
-    //todo
+    /* Encode signal into its own command buffer, so it is executed after all previously submitted command buffers */
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+    fenceMT.EncodeSignal(cmdBuffer);
+    SubmitCommandBuffer(cmdBuffer);
+}
+
+void MTCommandQueue::SubmitWait(Fence& fence)
+{
+    /* Encode GPU-side wait into its own command buffer, so all subsequently submitted command buffers are blocked until the fence is signaled */
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    if (fenceMT.GetNative() != nil)
+    {
+        id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+        fenceMT.EncodeWait(cmdBuffer);
+        SubmitCommandBuffer(cmdBuffer);
+    }
+    else
+    {
+        /* Fall back to CPU-side wait if shared events are not supported */
+        fenceMT.Wait(UINT64_MAX);
+    }
 }
 
 bool MTCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return false;//todo
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    return fenceMT.Wait(timeout);
 }
 
 void MTCommandQueue::WaitIdle()
@@ -87,6 +144,32 @@ void MTCommandQueue::WaitIdle()
 }
 
 
+/* ----- Sparse resources ----- */
+
+bool MTCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings)
+{
+    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    if (!textureMT.IsSparse())
+        return false;
+
+    if (@available(macOS 11.0, iOS 13.0, *))
+    {
+        /* Encode tile mappings into their own command buffer, so they are executed in submission order */
+        id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+        {
+            id<MTLResourceStateCommandEncoder> resourceStateEncoder = [cmdBuffer resourceStateCommandEncoder];
+            for_range(i, numMappings)
+                textureMT.EncodeTileMapping(resourceStateEncoder, mappings[i]);
+            [resourceStateEncoder endEncoding];
+        }
+        SubmitCommandBuffer(cmdBuffer);
+        return true;
+    }
+
+    return false;
+}
+
+
 /*
  * Internal
  */
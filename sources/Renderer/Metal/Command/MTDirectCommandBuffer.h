@@ -10,6 +10,8 @@
 
 
 #include "MTCommandBuffer.h"
+#include "../../../Core/LinearArena.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/Container/SmallVector.h>
 
 
@@ -72,6 +74,11 @@ class MTDirectCommandBuffer final : public MTCommandBuffer
 
         SmallVector<id<MTLDrawable>, 2> drawables_;
 
+        LinearArena                     frameArena_;                    // Arena for transient allocations between Begin() and End()
+        LinearArena*                    prevFrameArena_     = nullptr;
+
+        CPUProfileSpan                  encodeSpan_;
+
 };
 
 
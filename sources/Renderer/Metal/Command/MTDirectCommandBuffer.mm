@@ -24,11 +24,16 @@
 #include "../Texture/MTSampler.h"
 #include "../Texture/MTRenderTarget.h"
 #include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/IndirectArguments.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <algorithm>
 #include <limits.h>
+#include <string.h>
 
 #include <LLGL/Backend/Metal/NativeHandle.h>
 #include <LLGL/Backend/Metal/NativeCommand.h>
@@ -56,6 +61,8 @@ MTDirectCommandBuffer::MTDirectCommandBuffer(id<MTLDevice> device, MTCommandQueu
 
 void MTDirectCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     /*
     If the previous encoded command buffer was submitted to the command queue,
     we have to wait until our in-flight resources (such as staging buffer pool) become available again.
@@ -78,9 +85,11 @@ void MTDirectCommandBuffer::Begin()
         }
     ];
 
-    /* Reset schedulers and pools */
+    /* Reset schedulers and begin new frame in staging ring */
     context_.Reset(cmdBuffer_);
-    ResetStagingPool();
+
+    /* Make frame arena current for transient allocations during encoding */
+    prevFrameArena_ = frameArena_.BeginFrame();
 }
 
 void MTDirectCommandBuffer::End()
@@ -96,6 +105,11 @@ void MTDirectCommandBuffer::End()
     }
 
     ResetRenderStates();
+
+    frameArena_.EndFrame(prevFrameArena_);
+    prevFrameArena_ = nullptr;
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void MTDirectCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -106,7 +120,7 @@ void MTDirectCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
         if (commandBufferMT.IsMultiSubmitCmdBuffer() && !commandBufferMT.IsPrimary())
         {
             auto& multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
-            ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
+            ExecuteMTSecondaryCommandBuffer(multiSubmitCommandBufferMT, context_);
         }
     }
 }
@@ -125,7 +139,7 @@ void MTDirectCommandBuffer::UpdateBuffer(
     id<MTLBuffer> srcBuffer = nil;
     NSUInteger srcOffset = 0;
 
-    WriteStagingBuffer(data, static_cast<NSUInteger>(dataSize), srcBuffer, srcOffset);
+    context_.WriteStagingBuffer(data, static_cast<NSUInteger>(dataSize), srcBuffer, srcOffset);
 
     /* Encode blit command to copy staging buffer region to destination buffer */
     auto blitEncoder = context_.BindBlitEncoder();
@@ -158,6 +172,29 @@ void MTDirectCommandBuffer::CopyBuffer(
     ];
 }
 
+void MTDirectCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+    auto& srcBufferMT = LLGL_CAST(MTBuffer&, srcBuffer);
+
+    /* Encode all regions with the same blit command encoder */
+    auto blitEncoder = context_.BindBlitEncoder();
+    for_range(i, numRegions)
+    {
+        [blitEncoder
+            copyFromBuffer:     srcBufferMT.GetNative()
+            sourceOffset:       static_cast<NSUInteger>(regions[i].srcOffset)
+            toBuffer:           dstBufferMT.GetNative()
+            destinationOffset:  static_cast<NSUInteger>(regions[i].dstOffset)
+            size:               static_cast<NSUInteger>(regions[i].size)
+        ];
+    }
+}
+
 void MTDirectCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -242,6 +279,45 @@ void MTDirectCommandBuffer::FillBuffer(
         FillBufferByte4(dstBufferMT, range, value);
 }
 
+void MTDirectCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(static_cast<std::uint64_t>([dstBufferMT.GetNative() length]), dstOffset, clearSize);
+
+    /* Use native fill operation if the element is a repeated 32-bit pattern, otherwise write the element repeatedly */
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+        FillBuffer(dstBuffer, dstOffset, pattern, clearSize);
+    else
+        ClearBufferWithElement(*this, dstBuffer, dstOffset, clearSize, element, elementSize);
+}
+
+void MTDirectCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    context_.ClearTexture(textureMT, subresource, clearValue);
+}
+
+void MTDirectCommandBuffer::DiscardResource(Resource& /*resource*/)
+{
+    // dummy - Metal discards attachments only with MTLStoreActionDontCare/MTLLoadActionDontCare
+}
+
 void MTDirectCommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -273,6 +349,42 @@ void MTDirectCommandBuffer::CopyTexture(
     ];
 }
 
+void MTDirectCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+
+    /* Encode all regions with the same blit command encoder */
+    auto blitEncoder = context_.BindBlitEncoder();
+    for_range(i, numRegions)
+    {
+        const TextureCopyRegion& region = regions[i];
+
+        MTLOrigin srcOrigin, dstOrigin;
+        MTTypes::Convert(srcOrigin, region.srcLocation.offset);
+        MTTypes::Convert(dstOrigin, region.dstLocation.offset);
+
+        MTLSize srcSize;
+        MTTypes::Convert(srcSize, region.extent);
+
+        [blitEncoder
+            copyFromTexture:    srcTextureMT.GetNative()
+            sourceSlice:        region.srcLocation.arrayLayer
+            sourceLevel:        region.srcLocation.mipLevel
+            sourceOrigin:       srcOrigin
+            sourceSize:         srcSize
+            toTexture:          dstTextureMT.GetNative()
+            destinationSlice:   region.dstLocation.arrayLayer
+            destinationLevel:   region.dstLocation.mipLevel
+            destinationOrigin:  dstOrigin
+        ];
+    }
+}
+
 void MTDirectCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -401,6 +513,22 @@ void MTDirectCommandBuffer::GenerateMips(Texture& texture, const TextureSubresou
     }
 }
 
+void MTDirectCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    // Encode MIP-map generation for all textures into the same blit command encoder
+    id<MTLBlitCommandEncoder> blitEncoder = nil;
+    for_range(i, numTextures)
+    {
+        auto* textureMT = LLGL_CAST(MTTexture*, textures[i]);
+        if ([textureMT->GetNative() mipmapLevelCount] > 1)
+        {
+            if (blitEncoder == nil)
+                blitEncoder = context_.BindBlitEncoder();
+            [blitEncoder generateMipmapsForTexture:textureMT->GetNative()];
+        }
+    }
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void MTDirectCommandBuffer::SetViewport(const Viewport& viewport)
@@ -425,20 +553,23 @@ void MTDirectCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor
 
 /* ----- Input Assembly ------ */
 
-void MTDirectCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void MTDirectCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    context_.SetVertexBuffer(bufferMT.GetNative(), 0);
+    context_.SetVertexBuffer(bufferMT.GetNative(), static_cast<NSUInteger>(offset));
 }
 
-void MTDirectCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void MTDirectCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayMT = LLGL_CAST(MTBufferArray&, bufferArray);
-    context_.SetVertexBuffers(
-        bufferArrayMT.GetIDArray().data(),
-        bufferArrayMT.GetOffsets().data(),
-        static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size())
-    );
+    const NSUInteger count = static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size());
+    if (offsets != nullptr)
+    {
+        SmallVector<NSUInteger, 8> offsetsMT(offsets, offsets + count);
+        context_.SetVertexBuffers(bufferArrayMT.GetIDArray().data(), offsetsMT.data(), count);
+    }
+    else
+        context_.SetVertexBuffers(bufferArrayMT.GetIDArray().data(), bufferArrayMT.GetOffsets().data(), count);
 }
 
 void MTDirectCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -479,6 +610,12 @@ void MTDirectCommandBuffer::SetResource(std::uint32_t descriptor, Resource& reso
     context_.SetResource(descriptor, resource);
 }
 
+void MTDirectCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/)
+{
+    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    context_.SetBufferRange(descriptor, bufferMT, static_cast<NSUInteger>(offset));
+}
+
 /* ----- Render Passes ----- */
 
 void MTDirectCommandBuffer::BeginRenderPass(
@@ -505,6 +642,11 @@ void MTDirectCommandBuffer::EndRenderPass()
     context_.EndRenderPass();
 }
 
+void MTDirectCommandBuffer::NextSubpass()
+{
+    // dummy - subpasses continue with the same render command encoder, so framebuffer fetch reads attachments from tile memory
+}
+
 void MTDirectCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
     if ((flags & ClearFlags::All) == 0)
@@ -607,6 +749,41 @@ void MTDirectCommandBuffer::SetStencilReference(std::uint32_t reference, const S
     context_.SetStencilRef(reference, stencilFace);
 }
 
+void MTDirectCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    context_.SetCullMode(MTTypes::ToMTLCullMode(cullMode));
+}
+
+void MTDirectCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTDirectCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTDirectCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    context_.SetPrimitiveType(MTTypes::ToMTLPrimitiveType(primitiveTopology));
+}
+
+void MTDirectCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    context_.SetDepthBias(depthBiasDesc.constantFactor, depthBiasDesc.slopeFactor, depthBiasDesc.clamp);
+}
+
+void MTDirectCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTDirectCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by Metal
+}
+
 void MTDirectCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     context_.SetUniforms(first, data, dataSize);
@@ -634,6 +811,16 @@ void MTDirectCommandBuffer::EndRenderCondition()
     //todo
 }
 
+void MTDirectCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    //todo: resolve counter sample buffer via resolveCounters:inRange:destinationBuffer:destinationOffset: once query heaps are supported
+}
+
 /* ----- Stream Output ------ */
 
 void MTDirectCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -801,6 +988,34 @@ void MTDirectCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::
     }
 }
 
+void MTDirectCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    if (context_.GetNumPatchControlPoints() > 0)
+    {
+        /* Dispatch tessellation for each draw command individually */
+        for_range(i, numDraws)
+            MTDirectCommandBuffer::DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+    }
+    else if (numDraws > 0)
+    {
+        /* Flush render states once for all draw commands */
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+        {
+            [renderEncoder
+                drawIndexedPrimitives:  context_.GetPrimitiveType()
+                indexCount:             static_cast<NSUInteger>(draws->numIndices)
+                indexType:              context_.GetIndexType()
+                indexBuffer:            context_.GetIndexBuffer()
+                indexBufferOffset:      context_.GetIndexBufferOffset(static_cast<NSUInteger>(draws->firstIndex))
+                instanceCount:          static_cast<NSUInteger>(draws->numInstances)
+                baseVertex:             static_cast<NSUInteger>(draws->vertexOffset)
+                baseInstance:           static_cast<NSUInteger>(draws->firstInstance)
+            ];
+        }
+    }
+}
+
 [[noreturn]]
 static void TrapIndirectPatchesNotSupported()
 {
@@ -953,6 +1168,87 @@ void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t of
     }
 }
 
+void MTDirectCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (context_.GetNumPatchControlPoints() > 0)
+        TrapIndirectPatchesNotSupported();
+
+    auto& argumentsBufferMT = LLGL_CAST(MTBuffer&, argumentsBuffer);
+    auto& countBufferMT     = LLGL_CAST(MTBuffer&, countBuffer);
+    context_.DrawIndirectCount(
+        argumentsBufferMT.GetNative(),
+        static_cast<NSUInteger>(argumentsOffset),
+        countBufferMT.GetNative(),
+        static_cast<NSUInteger>(countOffset),
+        static_cast<NSUInteger>(maxNumCommands),
+        static_cast<NSUInteger>(stride),
+        false
+    );
+}
+
+void MTDirectCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (context_.GetNumPatchControlPoints() > 0)
+        TrapIndirectPatchesNotSupported();
+
+    auto& argumentsBufferMT = LLGL_CAST(MTBuffer&, argumentsBuffer);
+    auto& countBufferMT     = LLGL_CAST(MTBuffer&, countBuffer);
+    context_.DrawIndirectCount(
+        argumentsBufferMT.GetNative(),
+        static_cast<NSUInteger>(argumentsOffset),
+        countBufferMT.GetNative(),
+        static_cast<NSUInteger>(countOffset),
+        static_cast<NSUInteger>(maxNumCommands),
+        static_cast<NSUInteger>(stride),
+        true
+    );
+}
+
+void MTDirectCommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        [renderEncoder
+            drawMeshThreadgroups:           MTLSizeMake(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ)
+            threadsPerObjectThreadgroup:    context_.GetThreadsPerObjectThreadgroup()
+            threadsPerMeshThreadgroup:      context_.GetThreadsPerMeshThreadgroup()
+        ];
+    }
+}
+
+void MTDirectCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        /* Metal has no multi-draw for mesh threadgroups, so encode each indirect command individually */
+        auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        while (numCommands-- > 0)
+        {
+            [renderEncoder
+                drawMeshThreadgroupsWithIndirectBuffer: bufferMT.GetNative()
+                indirectBufferOffset:                   static_cast<NSUInteger>(offset)
+                threadsPerObjectThreadgroup:            context_.GetThreadsPerObjectThreadgroup()
+                threadsPerMeshThreadgroup:              context_.GetThreadsPerMeshThreadgroup()
+            ];
+            offset += stride;
+        }
+    }
+}
+
 /* ----- Compute ----- */
 
 void MTDirectCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -980,6 +1276,7 @@ void MTDirectCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offse
 void MTDirectCommandBuffer::PushDebugGroup(const char* name)
 {
     #ifdef LLGL_DEBUG
+    context_.FlushParallelCommandBuffers();
     [cmdBuffer_ pushDebugGroup:[NSString stringWithUTF8String:name]];
     #endif // /LLGL_DEBUG
 }
@@ -987,6 +1284,7 @@ void MTDirectCommandBuffer::PushDebugGroup(const char* name)
 void MTDirectCommandBuffer::PopDebugGroup()
 {
     #ifdef LLGL_DEBUG
+    context_.FlushParallelCommandBuffers();
     [cmdBuffer_ popDebugGroup];
     #endif // /LLGL_DEBUG
 }
@@ -0,0 +1,87 @@
+/*
+ * MTIndirectDrawEncoder.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_INDIRECT_DRAW_ENCODER_H
+#define LLGL_MT_INDIRECT_DRAW_ENCODER_H
+
+
+#import <Metal/Metal.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Helper class to manage an internal <MTLIndirectCommandBuffer> (ICB) that is filled by a compute kernel.
+This is used to implement DrawIndirectCount and DrawIndexedIndirectCount, where the number of draw commands is sourced from a GPU buffer.
+All draw commands inherit the pipeline state and buffers from the render command encoder that executes them.
+*/
+class MTIndirectDrawEncoder
+{
+
+    public:
+
+        MTIndirectDrawEncoder(id<MTLDevice> device);
+        ~MTIndirectDrawEncoder();
+
+        // Returns true if the specified device supports encoding indirect command buffers on the GPU.
+        static bool IsSupported(id<MTLDevice> device);
+
+        // Resets the range of encoded commands. This must be called for each new MTLCommandBuffer.
+        void Reset();
+
+        /*
+        Dispatches the builtin kernel that encodes up to 'maxNumCommands' draw commands into the internal ICB.
+        If 'indexBuffer' is not nil, indexed draw commands are encoded.
+        Returns the range of commands within the ICB returned by GetNative() that must be executed by the render command encoder.
+        */
+        NSRange EncodeDraws(
+            id<MTLComputeCommandEncoder>    computeEncoder,
+            MTLPrimitiveType                primitiveType,
+            id<MTLBuffer>                   argumentsBuffer,
+            NSUInteger                      argumentsOffset,
+            id<MTLBuffer>                   countBuffer,
+            NSUInteger                      countOffset,
+            NSUInteger                      maxNumCommands,
+            NSUInteger                      stride,
+            id<MTLBuffer>                   indexBuffer     = nil,
+            NSUInteger                      indexOffset     = 0,
+            MTLIndexType                    indexType       = MTLIndexTypeUInt32
+        );
+
+        // Returns the native MTLIndirectCommandBuffer object.
+        inline id<MTLIndirectCommandBuffer> GetNative() const
+        {
+            return native_;
+        }
+
+    private:
+
+        // Allocates a new ICB if the specified number of commands exceeds the remaining capacity.
+        void Grow(NSUInteger numCommands);
+
+    private:
+
+        id<MTLDevice>                   device_             = nil;
+        id<MTLIndirectCommandBuffer>    native_             = nil;
+        id<MTLArgumentEncoder>          argumentEncoder_    = nil;
+        id<MTLBuffer>                   argumentBuffer_     = nil;
+        NSUInteger                      capacity_           = 0;
+        NSUInteger                      offset_             = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,168 @@
+/*
+ * MTIndirectDrawEncoder.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTIndirectDrawEncoder.h"
+#include "../RenderState/MTBuiltinPSOFactory.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Must match 'DrawParams' structure in builtin kernel <g_metalSrcEncodeIndirectDraws>.
+struct MTIndirectDrawParams
+{
+    std::uint32_t primitiveType;
+    std::uint32_t firstCommand;
+    std::uint32_t maxNumCommands;
+    std::uint32_t stride;
+};
+
+static constexpr NSUInteger g_minIndirectCommandCount = 64;
+
+MTIndirectDrawEncoder::MTIndirectDrawEncoder(id<MTLDevice> device) :
+    device_ { device }
+{
+}
+
+MTIndirectDrawEncoder::~MTIndirectDrawEncoder()
+{
+    [native_ release];
+    [argumentEncoder_ release];
+    [argumentBuffer_ release];
+}
+
+bool MTIndirectDrawEncoder::IsSupported(id<MTLDevice> device)
+{
+    /* Encoding ICBs in a compute kernel requires Metal 2.1 and GPU family Mac2 or Apple3 */
+    if (@available(macOS 10.15, iOS 13.0, *))
+        return ([device supportsFamily:MTLGPUFamilyMac2] || [device supportsFamily:MTLGPUFamilyApple3]);
+    return false;
+}
+
+void MTIndirectDrawEncoder::Reset()
+{
+    offset_ = 0;
+}
+
+NSRange MTIndirectDrawEncoder::EncodeDraws(
+    id<MTLComputeCommandEncoder>    computeEncoder,
+    MTLPrimitiveType                primitiveType,
+    id<MTLBuffer>                   argumentsBuffer,
+    NSUInteger                      argumentsOffset,
+    id<MTLBuffer>                   countBuffer,
+    NSUInteger                      countOffset,
+    NSUInteger                      maxNumCommands,
+    NSUInteger                      stride,
+    id<MTLBuffer>                   indexBuffer,
+    NSUInteger                      indexOffset,
+    MTLIndexType                    indexType)
+{
+    /* Reserve range of commands for this draw; previous ranges are still referenced by the current command buffer */
+    Grow(maxNumCommands);
+    const NSRange range = NSMakeRange(offset_, maxNumCommands);
+    offset_ += maxNumCommands;
+
+    /* Select builtin kernel for the respective draw command type */
+    MTBuiltinComputePSO builtin = MTBuiltinComputePSO::EncodeIndirectDraws;
+    if (indexBuffer != nil)
+    {
+        builtin = (indexType == MTLIndexTypeUInt16 ? MTBuiltinComputePSO::EncodeIndexedIndirectDraws16 : MTBuiltinComputePSO::EncodeIndexedIndirectDraws32);
+    }
+    id<MTLComputePipelineState> computePSO = MTBuiltinPSOFactory::Get().GetComputePSO(builtin);
+    LLGL_ASSERT(computePSO != nil, "builtin PSO to encode indirect draw commands is not available");
+
+    MTIndirectDrawParams params;
+    {
+        params.primitiveType    = static_cast<std::uint32_t>(primitiveType);
+        params.firstCommand     = static_cast<std::uint32_t>(range.location);
+        params.maxNumCommands   = static_cast<std::uint32_t>(maxNumCommands);
+        params.stride           = static_cast<std::uint32_t>(stride / sizeof(std::uint32_t));
+    }
+
+    /* Encode kernel dispatch with one thread per draw command */
+    [computeEncoder setComputePipelineState:computePSO];
+    [computeEncoder setBuffer:argumentsBuffer offset:argumentsOffset atIndex:0];
+    [computeEncoder setBuffer:countBuffer offset:countOffset atIndex:1];
+    [computeEncoder setBytes:&params length:sizeof(params) atIndex:2];
+    [computeEncoder setBuffer:argumentBuffer_ offset:0 atIndex:3];
+    if (indexBuffer != nil)
+        [computeEncoder setBuffer:indexBuffer offset:indexOffset atIndex:4];
+
+    [computeEncoder useResource:native_ usage:MTLResourceUsageWrite];
+
+    const NSUInteger maxLocalThreads = std::min<NSUInteger>(maxNumCommands, [computePSO maxTotalThreadsPerThreadgroup]);
+    [computeEncoder
+        dispatchThreads:        MTLSizeMake(maxNumCommands, 1, 1)
+        threadsPerThreadgroup:  MTLSizeMake(maxLocalThreads, 1, 1)
+    ];
+
+    return range;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void MTIndirectDrawEncoder::Grow(NSUInteger numCommands)
+{
+    if (native_ != nil && offset_ + numCommands <= capacity_)
+        return;
+
+    /* Allocate new ICB and start at the beginning; the command buffer retains the previous ICB until it has completed */
+    capacity_ = std::max(std::max(numCommands, g_minIndirectCommandCount), capacity_ + capacity_/2);
+    offset_   = 0;
+
+    MTLIndirectCommandBufferDescriptor* icbDesc = [[MTLIndirectCommandBufferDescriptor alloc] init];
+    {
+        icbDesc.commandTypes            = (MTLIndirectCommandTypeDraw | MTLIndirectCommandTypeDrawIndexed);
+        icbDesc.inheritPipelineState    = YES;
+        icbDesc.inheritBuffers          = YES;
+    }
+    [native_ release];
+    native_ = [device_ newIndirectCommandBufferWithDescriptor:icbDesc maxCommandCount:capacity_ options:MTLResourceStorageModePrivate];
+    [icbDesc release];
+
+    if (native_ == nil)
+        LLGL_TRAP("failed to create MTLIndirectCommandBuffer with %u commands", static_cast<unsigned>(capacity_));
+
+    /* Create argument encoder once; the argument buffer layout only consists of the ICB */
+    if (argumentEncoder_ == nil)
+    {
+        MTLArgumentDescriptor* argDesc = [[MTLArgumentDescriptor alloc] init];
+        {
+            argDesc.index       = 0;
+            argDesc.dataType    = MTLDataTypeIndirectCommandBuffer;
+            argDesc.access      = MTLArgumentAccessWriteOnly;
+        }
+        argumentEncoder_ = [device_ newArgumentEncoderWithArguments:@[argDesc]];
+        [argDesc release];
+
+        argumentBuffer_ = [device_ newBufferWithLength:[argumentEncoder_ encodedLength] options:MTLResourceStorageModeShared];
+    }
+    else
+    {
+        /* Argument buffer might still be read by the GPU, so allocate a new one for the new ICB */
+        [argumentBuffer_ release];
+        argumentBuffer_ = [device_ newBufferWithLength:[argumentEncoder_ encodedLength] options:MTLResourceStorageModeShared];
+    }
+
+    [argumentEncoder_ setArgumentBuffer:argumentBuffer_ offset:0];
+    [argumentEncoder_ setIndirectCommandBuffer:native_ atIndex:0];
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
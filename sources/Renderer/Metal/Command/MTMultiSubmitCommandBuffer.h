@@ -12,6 +12,12 @@
 #include "MTCommandBuffer.h"
 #include "MTCommandOpcode.h"
 #include "../../VirtualCommandBuffer.h"
+#include "../../../Core/CPUProfilerUtils.h"
+
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "../../../JIT/JITProgram.h"
+#   include <memory>
+#endif
 
 
 namespace LLGL
@@ -37,12 +43,28 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
         // Returns true.
         bool IsMultiSubmitCmdBuffer() const override;
 
+        // Returns true if this command buffer only records commands for a render command encoder, i.e. it can be encoded with a parallel render command encoder.
+        inline bool IsRenderEncoderOnly() const
+        {
+            return isRenderEncoderOnly_;
+        }
+
         // Returns the internal virtual command buffer.
         inline const MTVirtualCommandBuffer& GetVirtualCommandBuffer() const
         {
             return buffer_;
         }
 
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+
+        // Returns the just-in-time compiled command buffer that can be executed natively, or null if not available.
+        inline const std::unique_ptr<JITProgram>& GetExecutable() const
+        {
+            return executable_;
+        }
+
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+
     private:
 
         void QueueDrawable(MTKView* view);
@@ -50,6 +72,15 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
         void GenerateMipmapsForTexture(id<MTLTexture> texture);
 
+        // Fills the buffer range with the repeated element by copying it from a single chunk in the staging buffer.
+        void FillBufferWithElement(
+            MTBuffer&       bufferMT,
+            std::uint64_t   offset,
+            std::uint64_t   size,
+            const void*     element,
+            std::uint32_t   elementSize
+        );
+
         void SetNativeVertexBuffers(NSUInteger count, const id<MTLBuffer>* buffers, const NSUInteger* offsets);
         void SetNativeIndexBuffer(id<MTLBuffer> buffer, NSUInteger offset, bool indexType16Bits);
 
@@ -70,10 +101,17 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
         MTVirtualCommandBuffer          buffer_;
         MTOpcode                        lastOpcode_             = MTOpcodeNop;
+        bool                            isRenderEncoderOnly_    = true;
 
         SmallVector<MTKView*, 2>        views_;
         SmallVector<id<MTLTexture>, 2>  intermediateTextures_;
 
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+        std::unique_ptr<JITProgram>     executable_;
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+
+        CPUProfileSpan                  encodeSpan_;
+
 };
 
 
@@ -23,17 +23,28 @@
 #include "../Texture/MTSampler.h"
 #include "../Texture/MTRenderTarget.h"
 #include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/IndirectArguments.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <algorithm>
 #include <limits.h>
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+#   include "MTCommandAssembler.h"
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 
 namespace LLGL
 {
 
 
+// Maximum size (in bytes) of the staging chunk that is written once for each fill command.
+static const std::uint64_t g_maxFillBufferChunkSize = 65536;
+
 MTMultiSubmitCommandBuffer::MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc) :
     MTCommandBuffer       { device, desc.flags                                  },
     isSecondaryCmdBuffer_ { ((desc.flags & CommandBufferFlags::Secondary) != 0) }
@@ -49,10 +60,17 @@ MTMultiSubmitCommandBuffer::~MTMultiSubmitCommandBuffer()
 
 void MTMultiSubmitCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     buffer_.Clear();
-    lastOpcode_ = MTOpcodeNop;
+    lastOpcode_             = MTOpcodeNop;
+    isRenderEncoderOnly_    = true;
     ResetRenderStates();
     ReleaseIntermediateResources();
+
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+    executable_.reset();
+    #endif // /LLGL_ENABLE_JIT_COMPILER
 }
 
 void MTMultiSubmitCommandBuffer::End()
@@ -64,6 +82,20 @@ void MTMultiSubmitCommandBuffer::End()
         PresentDrawables();
     }
     buffer_.Pack();
+
+    #ifdef LLGL_ENABLE_JIT_COMPILER
+    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        /*
+        Generate native assembly only if command buffer will be submitted multiple times.
+        The program references the packed command buffer, so it must be assembled after packing.
+        If no program can be generated, the command buffer is emulated.
+        */
+        executable_ = AssembleMTMultiSubmitCommandBuffer(*this);
+    }
+    #endif // /LLGL_ENABLE_JIT_COMPILER
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void MTMultiSubmitCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -128,6 +160,17 @@ void MTMultiSubmitCommandBuffer::CopyBuffer(
     }
 }
 
+void MTMultiSubmitCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    /* Consecutive copy commands are encoded with the same blit command encoder */
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 void MTMultiSubmitCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -174,41 +217,56 @@ void MTMultiSubmitCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-#if 0 //TODO
-    if (fillSize == 0)
-        return;
-
     auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
 
-    /* Check if native "fillBuffer" command can be used */
-    const bool valueBytesAreEqual =
-    (
-        ((value >> 24) & 0x000000FF) == (value & 0x000000FF) &&
-        ((value >> 16) & 0x000000FF) == (value & 0x000000FF) &&
-        ((value >>  8) & 0x000000FF) == (value & 0x000000FF)
-    );
-
-    /* Determine buffer range for fill command */
-    NSRange range;
+    /* Fill entire buffer if whole size is specified; the offset is ignored in this case */
     if (fillSize == LLGL_WHOLE_SIZE)
     {
-        NSUInteger bufferSize = [dstBufferMT.GetNative() length];
-        range = NSMakeRange(0, bufferSize);
+        dstOffset   = 0;
+        fillSize    = static_cast<std::uint64_t>([dstBufferMT.GetNative() length]);
     }
-    else
+
+    FillBufferWithElement(dstBufferMT, dstOffset, fillSize, &value, sizeof(value));
+}
+
+void MTMultiSubmitCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(static_cast<std::uint64_t>([dstBufferMT.GetNative() length]), dstOffset, clearSize);
+
+    FillBufferWithElement(dstBufferMT, dstOffset, clearSize, element, elementSize);
+}
+
+void MTMultiSubmitCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    /* Clear texture at execution time with the same encoding as the direct command buffer */
+    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    auto cmd = AllocCommand<MTCmdClearTexture>(MTOpcodeClearTexture);
     {
-        range = NSMakeRange(
-            static_cast<NSUInteger>(dstOffset),
-            static_cast<NSUInteger>(fillSize)
-        );
+        cmd->texture        = &textureMT;
+        cmd->subresource    = subresource;
+        cmd->clearValue     = clearValue;
     }
+}
 
-    /* Fill with native command if all four bytes are equal, otherwise use blit and comput commands */
-    if (valueBytesAreEqual)
-        FillBufferByte1(dstBufferMT, range, static_cast<std::uint8_t>(value & 0x000000FF));
-    else
-        FillBufferByte4(dstBufferMT, range, value);
-#endif
+void MTMultiSubmitCommandBuffer::DiscardResource(Resource& /*resource*/)
+{
+    // dummy - Metal discards attachments only with MTLStoreActionDontCare/MTLLoadActionDontCare
 }
 
 void MTMultiSubmitCommandBuffer::CopyTexture(
@@ -242,6 +300,17 @@ void MTMultiSubmitCommandBuffer::CopyTexture(
     }
 }
 
+void MTMultiSubmitCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    /* Consecutive copy commands are encoded with the same blit command encoder */
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
 void MTMultiSubmitCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -340,6 +409,12 @@ void MTMultiSubmitCommandBuffer::GenerateMips(Texture& texture, const TextureSub
     }
 }
 
+void MTMultiSubmitCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    for_range(i, numTextures)
+        MTMultiSubmitCommandBuffer::GenerateMips(*textures[i]);
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void MTMultiSubmitCommandBuffer::SetViewport(const Viewport& viewport)
@@ -383,22 +458,25 @@ void MTMultiSubmitCommandBuffer::SetNativeVertexBuffers(NSUInteger count, const
     }
 }
 
-void MTMultiSubmitCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void MTMultiSubmitCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     id<MTLBuffer> bufferId = bufferMT.GetNative();
-    const NSUInteger bufferOffset = 0;
+    const NSUInteger bufferOffset = static_cast<NSUInteger>(offset);
     SetNativeVertexBuffers(1, &bufferId, &bufferOffset);
 }
 
-void MTMultiSubmitCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void MTMultiSubmitCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayMT = LLGL_CAST(MTBufferArray&, bufferArray);
-    SetNativeVertexBuffers(
-        static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size()),
-        bufferArrayMT.GetIDArray().data(),
-        bufferArrayMT.GetOffsets().data()
-    );
+    const NSUInteger count = static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size());
+    if (offsets != nullptr)
+    {
+        SmallVector<NSUInteger, 8> offsetsMT(offsets, offsets + count);
+        SetNativeVertexBuffers(count, bufferArrayMT.GetIDArray().data(), offsetsMT.data());
+    }
+    else
+        SetNativeVertexBuffers(count, bufferArrayMT.GetIDArray().data(), bufferArrayMT.GetOffsets().data());
 }
 
 //private
@@ -445,6 +523,16 @@ void MTMultiSubmitCommandBuffer::SetResource(std::uint32_t descriptor, Resource&
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/)
+{
+    auto cmd = AllocCommand<MTCmdSetBufferRange>(MTOpcodeSetBufferRange);
+    {
+        cmd->descriptor = descriptor;
+        cmd->buffer     = LLGL_CAST(MTBuffer*, &buffer);
+        cmd->offset     = static_cast<NSUInteger>(offset);
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void MTMultiSubmitCommandBuffer::BeginRenderPass(
@@ -484,6 +572,11 @@ void MTMultiSubmitCommandBuffer::EndRenderPass()
     AllocOpcode(MTOpcodeEndRenderPass);
 }
 
+void MTMultiSubmitCommandBuffer::NextSubpass()
+{
+    // dummy - subpasses continue with the same render command encoder, so framebuffer fetch reads attachments from tile memory
+}
+
 //TODO: support clearing all active attachments at once
 void MTMultiSubmitCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
@@ -553,6 +646,10 @@ void MTMultiSubmitCommandBuffer::SetPipelineState(PipelineState& pipelineState)
         /* Set graphics pipeline with encoder scheduler */
         auto cmd = AllocCommand<MTCmdSetGraphicsPSO>(MTOpcodeSetGraphicsPSO);
         cmd->graphicsPSO = LLGL_CAST(MTGraphicsPSO*, &pipelineStateMT);
+
+        /* Tessellation PSOs dispatch a compute kernel before each draw command */
+        if (cmd->graphicsPSO->GetNumPatchControlPoints() > 0)
+            isRenderEncoderOnly_ = false;
     }
     else
     {
@@ -582,6 +679,52 @@ void MTMultiSubmitCommandBuffer::SetStencilReference(std::uint32_t reference, co
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    auto cmd = AllocCommand<MTCmdSetCullMode>(MTOpcodeSetCullMode);
+    {
+        cmd->cullMode = MTTypes::ToMTLCullMode(cullMode);
+    }
+}
+
+void MTMultiSubmitCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTMultiSubmitCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTMultiSubmitCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    auto cmd = AllocCommand<MTCmdSetPrimitiveType>(MTOpcodeSetPrimitiveType);
+    {
+        cmd->primitiveType = MTTypes::ToMTLPrimitiveType(primitiveTopology);
+    }
+}
+
+void MTMultiSubmitCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    auto cmd = AllocCommand<MTCmdSetDepthBias>(MTOpcodeSetDepthBias);
+    {
+        cmd->depthBias  = depthBiasDesc.constantFactor;
+        cmd->depthSlope = depthBiasDesc.slopeFactor;
+        cmd->depthClamp = depthBiasDesc.clamp;
+    }
+}
+
+void MTMultiSubmitCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by Metal
+}
+
+void MTMultiSubmitCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by Metal
+}
+
 void MTMultiSubmitCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     auto cmd = AllocCommand<MTCmdSetUniforms>(MTOpcodeSetUniforms, dataSize);
@@ -614,6 +757,16 @@ void MTMultiSubmitCommandBuffer::EndRenderCondition()
     //todo
 }
 
+void MTMultiSubmitCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    //todo: resolve counter sample buffer via resolveCounters:inRange:destinationBuffer:destinationOffset: once query heaps are supported
+}
+
 /* ----- Stream Output ------ */
 
 void MTMultiSubmitCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -694,6 +847,21 @@ void MTMultiSubmitCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices,
     }
 }
 
+void MTMultiSubmitCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+    {
+        auto cmd = AllocCommand<MTCmdDrawIndexed>(MTOpcodeDrawIndexed);
+        {
+            cmd->indexCount     = static_cast<NSUInteger>(draws->numIndices);
+            cmd->firstIndex     = static_cast<NSUInteger>(draws->firstIndex);
+            cmd->instanceCount  = static_cast<NSUInteger>(draws->numInstances);
+            cmd->baseVertex     = static_cast<NSUInteger>(draws->vertexOffset);
+            cmd->baseInstance   = static_cast<NSUInteger>(draws->firstInstance);
+        }
+    }
+}
+
 #if 0 //TODO
 [[noreturn]]
 static void TrapIndirectPatchesNotSupported()
@@ -856,6 +1024,68 @@ void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64
 #endif
 }
 
+void MTMultiSubmitCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferMT = LLGL_CAST(MTBuffer&, argumentsBuffer);
+    auto& countBufferMT     = LLGL_CAST(MTBuffer&, countBuffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirectCount>(MTOpcodeDrawIndirectCount);
+    {
+        cmd->argumentsBuffer    = argumentsBufferMT.GetNative();
+        cmd->argumentsOffset    = static_cast<NSUInteger>(argumentsOffset);
+        cmd->countBuffer        = countBufferMT.GetNative();
+        cmd->countOffset        = static_cast<NSUInteger>(countOffset);
+        cmd->maxNumCommands     = static_cast<NSUInteger>(maxNumCommands);
+        cmd->stride             = static_cast<NSUInteger>(stride);
+    }
+}
+
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& argumentsBufferMT = LLGL_CAST(MTBuffer&, argumentsBuffer);
+    auto& countBufferMT     = LLGL_CAST(MTBuffer&, countBuffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirectCount>(MTOpcodeDrawIndexedIndirectCount);
+    {
+        cmd->argumentsBuffer    = argumentsBufferMT.GetNative();
+        cmd->argumentsOffset    = static_cast<NSUInteger>(argumentsOffset);
+        cmd->countBuffer        = countBufferMT.GetNative();
+        cmd->countOffset        = static_cast<NSUInteger>(countOffset);
+        cmd->maxNumCommands     = static_cast<NSUInteger>(maxNumCommands);
+        cmd->stride             = static_cast<NSUInteger>(stride);
+    }
+}
+
+void MTMultiSubmitCommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    auto cmd = AllocCommand<MTCmdDrawMeshThreadgroups>(MTOpcodeDrawMeshThreadgroups);
+    {
+        cmd->threadgroups = MTLSizeMake(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+    }
+}
+
+void MTMultiSubmitCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto cmd = AllocCommand<MTCmdDrawMeshThreadgroupsIndirect>(MTOpcodeDrawMeshThreadgroupsIndirect);
+    {
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->numCommands            = static_cast<NSUInteger>(numCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
+    }
+}
+
 /* ----- Compute ----- */
 
 void MTMultiSubmitCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -947,58 +1177,49 @@ void MTMultiSubmitCommandBuffer::PresentDrawables()
     views_.clear();
 }
 
-#if 0 //TODO
-void MTMultiSubmitCommandBuffer::FillBufferByte1(MTBuffer& bufferMT, const NSRange& range, std::uint8_t value)
+void MTMultiSubmitCommandBuffer::FillBufferWithElement(
+    MTBuffer&       bufferMT,
+    std::uint64_t   offset,
+    std::uint64_t   size,
+    const void*     element,
+    std::uint32_t   elementSize)
 {
-    context_.PauseRenderEncoder();
-    {
-        auto blitEncoder = context_.BindBlitEncoder();
-        [blitEncoder fillBuffer:bufferMT.GetNative() range:range value:value];
-    }
-    context_.ResumeRenderEncoder();
-}
-
-void MTMultiSubmitCommandBuffer::FillBufferByte4(MTBuffer& bufferMT, const NSRange& range, std::uint32_t value)
-{
-    /* Use emulated fill command if buffer range is small enough to avoid having both a blit and compute encoder */
-    if (range.length > g_minFillBufferForKernel)
-        FillBufferByte4Accelerated(bufferMT, range, value);
-    else
-        FillBufferByte4Emulated(bufferMT, range, value);
-}
+    if (size == 0)
+        return;
 
-void MTMultiSubmitCommandBuffer::FillBufferByte4Emulated(MTBuffer& bufferMT, const NSRange& range, std::uint32_t value)
-{
-    /* Copy value into stack local buffer */
-    std::uint32_t localBuffer[g_minFillBufferForKernel / sizeof(std::uint32_t)];
-    std::fill(std::begin(localBuffer), std::end(localBuffer), value);
+    /* Repeat element in a chunk whose size is a multiple of both the element size and 4 bytes, since blit copies require 4-byte aligned ranges */
+    std::uint32_t patternSize = elementSize;
+    while (patternSize % 4 != 0)
+        patternSize += elementSize;
 
-    /* Write clear value into first range of destination buffer */
-    UpdateBuffer(bufferMT, range.location, localBuffer, range.length);
-}
+    const std::uint64_t maxChunkSize = g_maxFillBufferChunkSize / patternSize * patternSize;
 
-//TODO: manage binding of compute PSO in MTCommandContext
-void MTMultiSubmitCommandBuffer::FillBufferByte4Accelerated(MTBuffer& bufferMT, const NSRange& range, std::uint32_t value)
-{
-    context_.PauseRenderEncoder();
-    {
-        auto computeEncoder = context_.BindComputeEncoder();
+    SmallVector<std::uint8_t, 1024> chunk;
+    chunk.resize(static_cast<std::size_t>(std::min<std::uint64_t>(maxChunkSize, size)));
+    for (std::size_t pos = 0; pos < chunk.size(); pos += elementSize)
+        ::memcpy(&chunk[pos], element, std::min<std::size_t>(elementSize, chunk.size() - pos));
 
-        /* Bind compute PSO with kernel to fill buffer */
-        id<MTLComputePipelineState> pso = MTBuiltinPSOFactory::Get().GetComputePSO(MTBuiltinComputePSO::FillBufferByte4);
-        [computeEncoder setComputePipelineState:pso];
+    /* Write chunk once into the staging buffer and copy it repeatedly into the destination range */
+    id<MTLBuffer> srcBuffer = nil;
+    NSUInteger srcOffset = 0;
 
-        /* Bind destination buffer range and store clear value as input constant buffer */
-        [computeEncoder setBuffer:bufferMT.GetNative() offset:range.location atIndex:0];
-        [computeEncoder setBytes:&value length:sizeof(value) atIndex:1];
+    WriteStagingBuffer(chunk.data(), static_cast<NSUInteger>(chunk.size()), srcBuffer, srcOffset);
 
-        /* Dispatch compute kernels */
-        const NSUInteger numValues = range.length / sizeof(std::uint32_t);
-        DispatchThreads1D(computeEncoder, pso, numValues);
+    while (size > 0)
+    {
+        const std::uint64_t copySize = std::min<std::uint64_t>(chunk.size(), size);
+        auto cmd = AllocCommand<MTCmdCopyBuffer>(MTOpcodeCopyBuffer);
+        {
+            cmd->sourceBuffer       = srcBuffer;
+            cmd->sourceOffset       = srcOffset;
+            cmd->destinationBuffer  = bufferMT.GetNative();
+            cmd->destinationOffset  = static_cast<NSUInteger>(offset);
+            cmd->size               = static_cast<NSUInteger>(copySize);
+        }
+        offset  += copySize;
+        size    -= copySize;
     }
-    context_.ResumeRenderEncoder();
 }
-#endif //TODO
 
 void MTMultiSubmitCommandBuffer::GenerateMipmapsForTexture(id<MTLTexture> texture)
 {
@@ -1023,8 +1244,36 @@ void MTMultiSubmitCommandBuffer::ReleaseIntermediateResources()
     intermediateTextures_.clear();
 }
 
+// Returns true if the specified opcode is executed with the render command encoder only and does not modify the render pass.
+static bool IsRenderEncoderOpcode(const MTOpcode opcode)
+{
+    switch (opcode)
+    {
+        case MTOpcodeNop:
+        case MTOpcodeSetGraphicsPSO:
+        case MTOpcodeSetViewports:
+        case MTOpcodeSetScissorRects:
+        case MTOpcodeSetBlendColor:
+        case MTOpcodeSetStencilRef:
+        case MTOpcodeSetUniforms:
+        case MTOpcodeSetVertexBuffers:
+        case MTOpcodeSetIndexBuffer:
+        case MTOpcodeSetResourceHeap:
+        case MTOpcodeSetResource:
+        case MTOpcodeSetBufferRange:
+        case MTOpcodeDraw:
+        case MTOpcodeDrawIndexed:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 {
+    if (!IsRenderEncoderOpcode(opcode))
+        isRenderEncoderOnly_ = false;
+
     /* Redundant single-opcode instructions can be ignored (such as MTOpcodeFlush) */
     if (lastOpcode_ != opcode)
     {
@@ -1036,6 +1285,8 @@ void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 template <typename TCommand>
 TCommand* MTMultiSubmitCommandBuffer::AllocCommand(const MTOpcode opcode, std::size_t payloadSize)
 {
+    if (!IsRenderEncoderOpcode(opcode))
+        isRenderEncoderOnly_ = false;
     lastOpcode_ = opcode;
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
@@ -31,6 +31,27 @@ class MTDevice
         */
         static NSUInteger FindSuitableSampleCountOr1(id<MTLDevice> device, NSUInteger samples);
 
+        /*
+        Returns true if the CPU and GPU share the same physical memory, i.e. on iOS and Apple silicon.
+        Managed storage is redundant on such devices, since there is no separate copy of a resource that must be synchronized.
+        */
+        static bool HasUnifiedMemory(id<MTLDevice> device);
+
+        // Returns true if the Metal device supports MTLStorageModeMemoryless, i.e. it has an Apple GPU with tile memory.
+        static bool SupportsMemorylessStorage(id<MTLDevice> device);
+
+        // Returns true if the Metal device supports object and mesh functions, i.e. it belongs to the Metal 3 GPU family.
+        static bool SupportsMeshShaders(id<MTLDevice> device);
+
+        // Returns true if the Metal device supports sparse textures in sparse heaps, i.e. it belongs to the Apple 6 GPU family.
+        static bool SupportsSparseTextures(id<MTLDevice> device);
+
+        // Returns true if the Metal device supports programmable blending, i.e. fragment functions can read color attachments with [[color(n)]].
+        static bool SupportsFramebufferFetch(id<MTLDevice> device);
+
+        // Returns the maximum number of views for vertex amplification (at most 32), or 0 if the device cannot amplify vertices into at least 2 views.
+        static std::uint32_t GetMaxVertexAmplificationCount(id<MTLDevice> device);
+
 };
 
 
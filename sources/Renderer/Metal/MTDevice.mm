@@ -6,6 +6,7 @@
  */
 
 #include "MTDevice.h"
+#include <LLGL/Platform/Platform.h>
 
 
 namespace LLGL
@@ -31,6 +32,62 @@ NSUInteger MTDevice::FindSuitableSampleCountOr1(id<MTLDevice> device, NSUInteger
         return 1u;
 }
 
+bool MTDevice::HasUnifiedMemory(id<MTLDevice> device)
+{
+    #ifdef LLGL_OS_IOS
+    return true;
+    #else
+    if (@available(macOS 10.15, *))
+        return [device hasUnifiedMemory];
+    return false;
+    #endif
+}
+
+bool MTDevice::SupportsMemorylessStorage(id<MTLDevice> device)
+{
+    #ifdef LLGL_OS_IOS
+    return true;
+    #else
+    if (@available(macOS 11.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+    #endif
+}
+
+bool MTDevice::SupportsMeshShaders(id<MTLDevice> device)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+        return [device supportsFamily:MTLGPUFamilyMetal3];
+    return false;
+}
+
+bool MTDevice::SupportsSparseTextures(id<MTLDevice> device)
+{
+    if (@available(macOS 11.0, iOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple6];
+    return false;
+}
+
+bool MTDevice::SupportsFramebufferFetch(id<MTLDevice> device)
+{
+    /* Programmable blending is available on all Apple GPUs, but not on Intel or AMD GPUs on macOS */
+    if (@available(macOS 10.15, iOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+}
+
+std::uint32_t MTDevice::GetMaxVertexAmplificationCount(id<MTLDevice> device)
+{
+    if (@available(macOS 10.15.4, iOS 13.0, *))
+    {
+        std::uint32_t count = 0;
+        while (count < 32u && [device supportsVertexAmplificationCount:(count + 1)])
+            ++count;
+        return (count >= 2 ? count : 0u);
+    }
+    return 0;
+}
+
 
 } // /namespace LLGL
 
@@ -8,6 +8,8 @@
 #include "MTFeatureSet.h"
 #include "MTDevice.h"
 #include "OSXAvailability.h"
+#include "Command/MTIndirectDrawEncoder.h"
+#include <LLGL/PipelineStateFlags.h>
 #include <AvailabilityMacros.h>
 #include <initializer_list>
 #include <algorithm>
@@ -124,10 +126,18 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     features.hasInstancing                  = true;
     features.hasOffsetInstancing            = true;
     features.hasIndirectDrawing             = true;
+    features.hasIndirectDrawingCount        = MTIndirectDrawEncoder::IsSupported(device);
     features.hasViewportArrays              = (version >= 103);
     features.hasConservativeRasterization   = false;
     features.hasStreamOutputs               = false;
     features.hasLogicOp                     = false;
+    features.hasMeshShaders                 = MTDevice::SupportsMeshShaders(device);
+    features.hasSparseTextures              = MTDevice::SupportsSparseTextures(device);
+    features.hasInputAttachments            = MTDevice::SupportsFramebufferFetch(device);
+    features.hasConcurrentResourceCreation  = true;
+
+    const std::uint32_t maxVertexAmplificationCount = MTDevice::GetMaxVertexAmplificationCount(device);
+    features.hasMultiview                   = (maxVertexAmplificationCount >= 2);
 
     /* Specify limits */
     auto& limits = caps.limits;
@@ -153,6 +163,20 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     limits.maxComputeShaderWorkGroupSize[1] = static_cast<std::uint32_t>(workGroupSize.height);
     limits.maxComputeShaderWorkGroupSize[2] = static_cast<std::uint32_t>(workGroupSize.depth);
 
+    if (features.hasMeshShaders)
+    {
+        /* Metal limits the total number of mesh threadgroups per grid to 1024 */
+        limits.maxMeshShaderWorkGroups[0]   = 1024u;
+        limits.maxMeshShaderWorkGroups[1]   = 1024u;
+        limits.maxMeshShaderWorkGroups[2]   = 1024u;
+    }
+
+    /* Multiview is implemented with vertex amplification, so the number of views is limited by the amplification count */
+    limits.maxMultiviewViews                = maxVertexAmplificationCount;
+
+    /* Depth-stencil states are baked into MTLDepthStencilState objects and cannot be set dynamically */
+    limits.dynamicStates                    = (DynamicStateFlags::CullMode | DynamicStateFlags::PrimitiveTopology | DynamicStateFlags::DepthBias);
+
     #ifdef LLGL_OS_IOS
     limits.maxTessFactor                    = 16u;
     #else
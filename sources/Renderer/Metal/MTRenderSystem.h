@@ -13,7 +13,6 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
-#include "../ProxyPipelineCache.h"
 
 #include "Command/MTCommandQueue.h"
 #include "Command/MTCommandBuffer.h"
@@ -22,9 +21,11 @@
 #include "Buffer/MTBuffer.h"
 #include "Buffer/MTBufferArray.h"
 #include "Buffer/MTIntermediateBuffer.h"
+#include "Buffer/MTBufferHeapPool.h"
 
 #include "RenderState/MTPipelineLayout.h"
 #include "RenderState/MTPipelineState.h"
+#include "RenderState/MTPipelineCache.h"
 #include "RenderState/MTResourceHeap.h"
 #include "RenderState/MTRenderPass.h"
 #include "RenderState/MTFence.h"
@@ -34,8 +35,10 @@
 #include "Texture/MTTexture.h"
 #include "Texture/MTSampler.h"
 #include "Texture/MTRenderTarget.h"
+#include "Texture/MTTransientHeapPool.h"
 
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -54,6 +57,10 @@ class MTRenderSystem final : public RenderSystem
         MTRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~MTRenderSystem();
 
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
     private:
 
         void CreateDeviceResources(id<MTLDevice> sharedDevice = nil);
@@ -63,19 +70,34 @@ class MTRenderSystem final : public RenderSystem
 
         MTLFeatureSet QueryHighestFeatureSet() const;
 
+        bool SupportsArgumentBuffersTier2() const;
+
         const MTRenderPass* GetDefaultRenderPass() const;
 
+        id<MTLHeap> GetOrCreateSparseHeap();
+
+        // Waits until all command queues are idle, including the compute and copy queues.
+        void WaitIdleAllQueues();
+
     private:
 
         /* ----- Common objects ----- */
 
         id<MTLDevice>                           device_             = nil;
         std::unique_ptr<MTIntermediateBuffer>   intermediateBuffer_;
+        NSInteger                               argumentBufferSlot_ = -1; // See RendererConfigurationMetal::argumentBufferSlot
+        std::unique_ptr<MTBufferHeapPool>       bufferHeapPool_;            // See RendererConfigurationMetal::bufferHeapSize
+        std::unique_ptr<MTTransientHeapPool>    transientHeapPool_;
+        id<MTLHeap>                             sparseHeap_         = nil;  // Created on demand for MiscFlags::Sparse.
+        std::mutex                              sparseHeapMutex_;
+        MTShaderLibraryCache                    shaderLibraryCache_;
 
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<MTSwapChain>          swapChains_;
         HWObjectInstance<MTCommandQueue>        commandQueue_;
+        HWObjectInstance<MTCommandQueue>        computeCommandQueue_;   // Created on demand.
+        HWObjectInstance<MTCommandQueue>        copyCommandQueue_;      // Created on demand.
         HWObjectContainer<MTCommandBuffer>      commandBuffers_;
         HWObjectContainer<MTBuffer>             buffers_;
         HWObjectContainer<MTBufferArray>        bufferArrays_;
@@ -85,7 +107,7 @@ class MTRenderSystem final : public RenderSystem
         HWObjectContainer<MTRenderTarget>       renderTargets_;
         HWObjectContainer<MTShader>             shaders_;
         HWObjectContainer<MTPipelineLayout>     pipelineLayouts_;
-        HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
+        HWObjectContainer<MTPipelineCache>      pipelineCaches_;
         HWObjectContainer<MTPipelineState>  	pipelineStates_;
         HWObjectContainer<MTResourceHeap>       resourceHeaps_;
         //HWObjectContainer<MTQueryHeap>          queryHeaps_;
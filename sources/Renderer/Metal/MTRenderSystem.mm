@@ -9,12 +9,15 @@
 #include "../CheckedCast.h"
 #include "../TextureUtils.h"
 #include "../RenderSystemUtils.h"
+#include "../MemoryInfoUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include "Command/MTDirectCommandBuffer.h"
 #include "Command/MTMultiSubmitCommandBuffer.h"
 #include "MTFeatureSet.h"
+#include "MTDevice.h"
 #include "MTTypes.h"
 #include "RenderState/MTGraphicsPSO.h"
 #include "RenderState/MTComputePSO.h"
@@ -38,10 +41,23 @@ MTRenderSystem::MTRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     else
         CreateDeviceResources();
     QueryRenderingCaps();
+
+    if (auto* rendererConfigMT = GetRendererConfiguration<RendererConfigurationMetal>(renderSystemDesc))
+    {
+        if (rendererConfigMT->argumentBufferSlot >= 0 && SupportsArgumentBuffersTier2())
+            argumentBufferSlot_ = rendererConfigMT->argumentBufferSlot;
+        if (rendererConfigMT->bufferHeapSize > 0 && MTBufferHeapPool::IsSupported())
+            bufferHeapPool_ = MakeUnique<MTBufferHeapPool>(device_, static_cast<NSUInteger>(rendererConfigMT->bufferHeapSize));
+    }
+
+    /* Transient textures are only aliased if placement heaps are supported; otherwise, MiscFlags::Transient is ignored */
+    if (MTTransientHeapPool::IsSupported())
+        transientHeapPool_ = MakeUnique<MTTransientHeapPool>(device_);
 }
 
 MTRenderSystem::~MTRenderSystem()
 {
+    [sparseHeap_ release];
     [device_ release];
 }
 
@@ -64,6 +80,26 @@ CommandQueue* MTRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* MTRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    /* Metal has no dedicated queue types, but each MTLCommandQueue may execute concurrently to the others */
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (!computeCommandQueue_)
+                computeCommandQueue_ = MakeUnique<MTCommandQueue>(device_);
+            return computeCommandQueue_.get();
+
+        case CommandQueueType::Copy:
+            if (!copyCommandQueue_)
+                copyCommandQueue_ = MakeUnique<MTCommandQueue>(device_);
+            return copyCommandQueue_.get();
+
+        default:
+            return commandQueue_.get();
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* MTRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -75,7 +111,10 @@ CommandBuffer* MTRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
     and the command buffer will be submitted immediately after encoding is done.
     */
     if ((commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
-        return commandBuffers_.emplace<MTDirectCommandBuffer>(device_, *commandQueue_, commandBufferDesc);
+    {
+        auto& commandQueueMT = LLGL_CAST(MTCommandQueue&, *GetCommandQueue(commandBufferDesc.queueType));
+        return commandBuffers_.emplace<MTDirectCommandBuffer>(device_, commandQueueMT, commandBufferDesc);
+    }
     else
         return commandBuffers_.emplace<MTMultiSubmitCommandBuffer>(device_, commandBufferDesc);
 }
@@ -89,8 +128,10 @@ void MTRenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* MTRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateBuffer");
+
     RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
-    return buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData);
+    return buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData, bufferHeapPool_.get());
 }
 
 BufferArray* MTRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -111,28 +152,28 @@ void MTRenderSystem::Release(BufferArray& bufferArray)
 
 void MTRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     bufferMT.Write(static_cast<NSUInteger>(offset), data, static_cast<NSUInteger>(dataSize));
 }
 
 void MTRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     bufferMT.Read(static_cast<NSUInteger>(offset), data, static_cast<NSUInteger>(dataSize));
 }
 
 void* MTRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     return bufferMT.Map(access);
 }
 
 void* MTRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     return bufferMT.Map(access, static_cast<NSUInteger>(offset), static_cast<NSUInteger>(length));
 }
@@ -147,9 +188,13 @@ void MTRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    auto* textureMT = textures_.emplace<MTTexture>(device_, textureDesc);
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateTexture");
 
-    if (initialImage != nullptr)
+    id<MTLHeap> sparseHeap = ((textureDesc.miscFlags & MiscFlags::Sparse) != 0 ? GetOrCreateSparseHeap() : nil);
+    auto* textureMT = textures_.emplace<MTTexture>(device_, textureDesc, transientHeapPool_.get(), sparseHeap);
+
+    /* Memoryless and sparse textures have no backing store that could be initialized */
+    if (initialImage != nullptr && !textureMT->IsMemoryless() && !textureMT->IsSparse())
     {
         textureMT->WriteRegion(
             //TextureRegion{ Offset3D{ 0, 0, 0 }, textureMT->GetMipExtent(0) },
@@ -180,19 +225,22 @@ Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void MTRenderSystem::Release(Texture& texture)
 {
+    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    if (textureMT.IsTransient())
+        transientHeapPool_->ReleaseHeap(textureMT.GetAliasingGroup());
     textures_.erase(&texture);
 }
 
 void MTRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
     textureMT.WriteRegion(textureRegion, srcImageView);
 }
 
 void MTRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
-    commandQueue_->WaitIdle();
+    WaitIdleAllQueues();
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
     textureMT.ReadRegion(textureRegion, dstImageView, commandQueue_->GetNative(), intermediateBuffer_.get());
 }
@@ -201,7 +249,7 @@ void MTRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* MTRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<MTSampler>(device_, samplerDesc);
+    return samplers_.emplace<MTSampler>(device_, samplerDesc, /*supportArgumentBuffers:*/ (argumentBufferSlot_ >= 0));
 }
 
 void MTRenderSystem::Release(Sampler& sampler)
@@ -213,7 +261,7 @@ void MTRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* MTRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<MTResourceHeap>(resourceHeapDesc, initialResourceViews);
+    return resourceHeaps_.emplace<MTResourceHeap>(device_, resourceHeapDesc, initialResourceViews, argumentBufferSlot_);
 }
 
 void MTRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -224,6 +272,11 @@ void MTRenderSystem::Release(ResourceHeap& resourceHeap)
 std::uint32_t MTRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
 {
     auto& resourceHeapMT = LLGL_CAST(MTResourceHeap&, resourceHeap);
+
+    /* Argument buffers are read by the GPU directly, so they must not be overwritten while still in use */
+    if (resourceHeapMT.HasArgumentBuffer())
+        WaitIdleAllQueues();
+
     return resourceHeapMT.WriteResourceViews(firstDescriptor, resourceViews);
 }
 
@@ -256,7 +309,7 @@ void MTRenderSystem::Release(RenderTarget& renderTarget)
 Shader* MTRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<MTShader>(device_, shaderDesc);
+    return shaders_.emplace<MTShader>(device_, shaderDesc, &shaderLibraryCache_);
 }
 
 void MTRenderSystem::Release(Shader& shader)
@@ -278,26 +331,32 @@ void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 /* ----- Pipeline Caches ----- */
 
-PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& /*initialBlob*/)
+PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
-    return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
+    return pipelineCaches_.emplace<MTPipelineCache>(device_, initialBlob);
 }
 
 void MTRenderSystem::Release(PipelineCache& pipelineCache)
 {
-    ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
+    pipelineCaches_.erase(&pipelineCache);
 }
 
 /* ----- Pipeline States ----- */
 
-PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTGraphicsPSO>(device_, pipelineStateDesc, GetDefaultRenderPass());
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    auto* pipelineCacheMT = (pipelineCache != nullptr ? LLGL_CAST(MTPipelineCache*, pipelineCache) : nullptr);
+    return pipelineStates_.emplace<MTGraphicsPSO>(device_, pipelineStateDesc, GetDefaultRenderPass(), pipelineCacheMT);
 }
 
-PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTComputePSO>(device_, pipelineStateDesc);
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    auto* pipelineCacheMT = (pipelineCache != nullptr ? LLGL_CAST(MTPipelineCache*, pipelineCache) : nullptr);
+    return pipelineStates_.emplace<MTComputePSO>(device_, pipelineStateDesc, pipelineCacheMT);
 }
 
 void MTRenderSystem::Release(PipelineState& pipelineState)
@@ -344,6 +403,25 @@ bool MTRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     return false;
 }
 
+bool MTRenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    outInfo = {};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+
+    /* Report device memory with its recommended working set size as budget; This also applies to unified memory architectures */
+    if (@available(macOS 10.13, iOS 16.0, *))
+    {
+        AppendMemoryHeapInfo(
+            outInfo,
+            /*deviceLocal:*/    true,
+            /*budget:*/         static_cast<std::uint64_t>([device_ recommendedMaxWorkingSetSize]),
+            /*usage:*/          static_cast<std::uint64_t>([device_ currentAllocatedSize])
+        );
+    }
+
+    return true;
+}
+
 
 /*
  * ======= Private: =======
@@ -532,6 +610,14 @@ MTLFeatureSet MTRenderSystem::QueryHighestFeatureSet() const
     return fsetDefault;
 }
 
+bool MTRenderSystem::SupportsArgumentBuffersTier2() const
+{
+    if (@available(macOS 10.13, iOS 11.0, *))
+        return ([device_ argumentBuffersSupport] >= MTLArgumentBuffersTier2);
+    else
+        return false;
+}
+
 const MTRenderPass* MTRenderSystem::GetDefaultRenderPass() const
 {
     if (!swapChains_.empty())
@@ -542,6 +628,38 @@ const MTRenderPass* MTRenderSystem::GetDefaultRenderPass() const
     return nullptr;
 }
 
+// Size of the sparse heap all tiles of sparse textures are allocated from.
+static constexpr NSUInteger g_sparseHeapSize = 256u * 1024u * 1024u;
+
+id<MTLHeap> MTRenderSystem::GetOrCreateSparseHeap()
+{
+    std::lock_guard<std::mutex> guard{ sparseHeapMutex_ };
+    if (sparseHeap_ == nil && MTDevice::SupportsSparseTextures(device_))
+    {
+        if (@available(macOS 11.0, iOS 13.0, *))
+        {
+            MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+            {
+                heapDesc.type           = MTLHeapTypeSparse;
+                heapDesc.storageMode    = MTLStorageModePrivate;
+                heapDesc.size           = g_sparseHeapSize;
+            }
+            sparseHeap_ = [device_ newHeapWithDescriptor:heapDesc];
+            [heapDesc release];
+        }
+    }
+    return sparseHeap_;
+}
+
+void MTRenderSystem::WaitIdleAllQueues()
+{
+    if (computeCommandQueue_)
+        computeCommandQueue_->WaitIdle();
+    if (copyCommandQueue_)
+        copyCommandQueue_->WaitIdle();
+    commandQueue_->WaitIdle();
+}
+
 
 } // /namespace LLGL
 
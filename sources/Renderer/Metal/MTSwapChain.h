@@ -52,6 +52,8 @@ class MTSwapChain final : public SwapChain
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
     public:
 
         // Updates the native render pass descriptor with the specified clear values. Returns null on failure.
@@ -87,6 +89,7 @@ class MTSwapChain final : public SwapChain
 
         MTLRenderPassDescriptor*    nativeMutableRenderPass_    = nullptr; // Cannot be id<>
         MTRenderPass                renderPass_;
+        bool                        lowLatency_                 = false;
 
 };
 
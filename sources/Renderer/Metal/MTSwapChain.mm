@@ -10,6 +10,8 @@
 #include "RenderState/MTRenderPass.h"
 #include "../TextureUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/CoreUtils.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
 
@@ -54,8 +56,9 @@ MTSwapChain::MTSwapChain(
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface)
 :
-    SwapChain   { desc         },
-    renderPass_ { device, desc }
+    SwapChain   { desc            },
+    renderPass_ { device, desc    },
+    lowLatency_ { desc.lowLatency }
 {
     /* Initialize surface for MetalKit view */
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
@@ -68,10 +71,19 @@ MTSwapChain::MTSwapChain(
     view_.colorPixelFormat          = renderPass_.GetColorAttachments()[0].pixelFormat;
     view_.depthStencilPixelFormat   = renderPass_.GetDepthStencilFormat();
     view_.sampleCount               = renderPass_.GetSampleCount();
+
+    /* Limit number of drawables to the maximum frame latency plus the one being displayed; CAMetalLayer only supports 2 or 3 drawables */
+    if (lowLatency_)
+    {
+        const NSUInteger maxFrameLatency = (desc.framesInFlight > 0 ? desc.framesInFlight : 1u);
+        [(CAMetalLayer*)[view_ layer] setMaximumDrawableCount:Clamp<NSUInteger>(maxFrameLatency + 1u, 2u, 3u)];
+    }
 }
 
 void MTSwapChain::Present()
 {
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
     /* Present backbuffer */
     [view_ draw];
 
@@ -147,6 +159,17 @@ bool MTSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return true;
 }
 
+bool MTSwapChain::WaitForNextFrame(std::uint64_t /*timeout*/)
+{
+    /*
+    Acquire the next drawable ahead of time, which blocks until one of the limited drawables becomes available.
+    The timeout is determined by CAMetalLayer::allowsNextDrawableTimeout, in which case the drawable is nil.
+    */
+    if (lowLatency_)
+        return (view_.currentDrawable != nil);
+    return true;
+}
+
 MTLRenderPassDescriptor* MTSwapChain::GetAndUpdateNativeRenderPass(
     const MTRenderPass& renderPass,
     std::uint32_t       numClearValues,
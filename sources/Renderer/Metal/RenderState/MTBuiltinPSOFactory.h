@@ -16,10 +16,15 @@ namespace LLGL
 {
 
 
+struct ShaderDescriptor;
+
 // Enumeration of all builtin Metal compute PSOs.
 enum class MTBuiltinComputePSO
 {
     FillBufferByte4 = 0,
+    EncodeIndirectDraws,            // Only available if MTIndirectDrawEncoder::IsSupported() returns true.
+    EncodeIndexedIndirectDraws16,   // Only available if MTIndirectDrawEncoder::IsSupported() returns true.
+    EncodeIndexedIndirectDraws32,   // Only available if MTIndirectDrawEncoder::IsSupported() returns true.
     Num
 };
 
@@ -52,6 +57,19 @@ class MTBuiltinPSOFactory
             std::size_t                 kernelFuncSize
         );
 
+        void LoadBuiltinComputePSOFromSource(
+            id<MTLDevice>               device,
+            const MTBuiltinComputePSO   builtin,
+            const char*                 kernelSource,
+            const char*                 entryPoint
+        );
+
+        void CreateBuiltinComputePSO(
+            id<MTLDevice>               device,
+            const MTBuiltinComputePSO   builtin,
+            const ShaderDescriptor&     shaderDesc
+        );
+
     private:
 
         static const std::size_t g_numComputePSOs = static_cast<std::size_t>(MTBuiltinComputePSO::Num);
@@ -8,6 +8,7 @@
 #include "MTBuiltinPSOFactory.h"
 #include "../Shader/MTShader.h"
 #include "../Shader/Builtin/MTBuiltin.h"
+#include "../Command/MTIndirectDrawEncoder.h"
 #include "../MTCore.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Report.h>
@@ -26,6 +27,13 @@ MTBuiltinPSOFactory& MTBuiltinPSOFactory::Get()
 void MTBuiltinPSOFactory::CreateBuiltinPSOs(id<MTLDevice> device)
 {
     LoadBuiltinComputePSO(device, MTBuiltinComputePSO::FillBufferByte4, g_metalLibFillBufferByte4, g_metalLibFillBufferByte4Len);
+
+    if (MTIndirectDrawEncoder::IsSupported(device))
+    {
+        LoadBuiltinComputePSOFromSource(device, MTBuiltinComputePSO::EncodeIndirectDraws,          g_metalSrcEncodeIndirectDraws, "EncodeDraws"         );
+        LoadBuiltinComputePSOFromSource(device, MTBuiltinComputePSO::EncodeIndexedIndirectDraws16, g_metalSrcEncodeIndirectDraws, "EncodeIndexedDraws16");
+        LoadBuiltinComputePSOFromSource(device, MTBuiltinComputePSO::EncodeIndexedIndirectDraws32, g_metalSrcEncodeIndirectDraws, "EncodeIndexedDraws32");
+    }
 }
 
 id<MTLComputePipelineState> MTBuiltinPSOFactory::GetComputePSO(const MTBuiltinComputePSO builtin) const
@@ -58,6 +66,32 @@ void MTBuiltinPSOFactory::LoadBuiltinComputePSO(
         shaderDesc.entryPoint   = "CS";
         shaderDesc.profile      = "1.1";
     }
+    CreateBuiltinComputePSO(device, builtin, shaderDesc);
+}
+
+void MTBuiltinPSOFactory::LoadBuiltinComputePSOFromSource(
+    id<MTLDevice>               device,
+    const MTBuiltinComputePSO   builtin,
+    const char*                 kernelSource,
+    const char*                 entryPoint)
+{
+    /* Compile compute shader function from source */
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.type         = ShaderType::Compute;
+        shaderDesc.source       = kernelSource;
+        shaderDesc.sourceType   = ShaderSourceType::CodeString;
+        shaderDesc.entryPoint   = entryPoint;
+        shaderDesc.profile      = "2.1";
+    }
+    CreateBuiltinComputePSO(device, builtin, shaderDesc);
+}
+
+void MTBuiltinPSOFactory::CreateBuiltinComputePSO(
+    id<MTLDevice>               device,
+    const MTBuiltinComputePSO   builtin,
+    const ShaderDescriptor&     shaderDesc)
+{
     MTShader cs{ device, shaderDesc };
 
     /* We cannot recover from a faulty built-in shader */
@@ -18,13 +18,14 @@ namespace LLGL
 
 struct ComputePipelineDescriptor;
 class MTShader;
+class MTPipelineCache;
 
 class MTComputePSO final : public MTPipelineState
 {
 
     public:
 
-        MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc);
+        MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc, MTPipelineCache* pipelineCache = nullptr);
 
         // Binds the compute pipeline state with the specified command encoder.
         void Bind(id<MTLComputeCommandEncoder> computeEncoder);
@@ -38,9 +39,10 @@ class MTComputePSO final : public MTPipelineState
     private:
 
         id<MTLComputePipelineState> CreateNativeComputePipelineState(
-            id<MTLDevice>   device,
-            id<MTLFunction> function,
-            NSError*&       error
+            id<MTLDevice>       device,
+            id<MTLFunction>     function,
+            MTPipelineCache*    pipelineCache,
+            NSError*&           error
         );
 
     private:
@@ -7,6 +7,7 @@
 
 #include "MTComputePSO.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../MTCore.h"
 #include "../Shader/MTShader.h"
 #include "../../CheckedCast.h"
@@ -19,7 +20,7 @@ namespace LLGL
 {
 
 
-MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc) :
+MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc, MTPipelineCache* pipelineCache) :
     MTPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout }
 {
     /* Get native shader functions */
@@ -39,7 +40,7 @@ MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor
 
     /* Create native compute pipeline state */
     NSError* error = nullptr;
-    computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, error);
+    computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, pipelineCache, error);
     if (!computePipelineState_)
         MTThrowIfCreateFailed(error, "MTLComputePipelineState");
 }
@@ -58,17 +59,43 @@ void MTComputePSO::Bind(id<MTLComputeCommandEncoder> computeEncoder)
  */
 
 id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineState(
-    id<MTLDevice>   device,
-    id<MTLFunction> function,
-    NSError*&       error)
+    id<MTLDevice>       device,
+    id<MTLFunction>     function,
+    MTPipelineCache*    pipelineCache,
+    NSError*&           error)
 {
+    const MTLPipelineOption options = (NeedsConstantsCache() ? (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo) : MTLPipelineOptionNone);
+
+    if (pipelineCache != nullptr && pipelineCache->HasArchive())
+    {
+        /* Create PSO with descriptor to look up its GPU binary in the pipeline cache and store it for the next application launch */
+        MTLComputePipelineDescriptor* psoDesc = [[MTLComputePipelineDescriptor alloc] init];
+        psoDesc.computeFunction = function;
+        pipelineCache->PrepareComputePipelineDescriptor(psoDesc);
+
+        MTLAutoreleasedComputePipelineReflection reflection = nil;
+        id<MTLComputePipelineState> pso = [device
+            newComputePipelineStateWithDescriptor:  psoDesc
+            options:                                options
+            reflection:                             (NeedsConstantsCache() ? &reflection : nil)
+            error:                                  &error
+        ];
+        if (pso != nil)
+            pipelineCache->AddComputePipelineFunctions(psoDesc);
+        [psoDesc release];
+
+        if (NeedsConstantsCache())
+            CreateConstantsCacheForComputePipeline(reflection);
+        return pso;
+    }
+
     if (NeedsConstantsCache())
     {
         /* Create PSO with reflection to generate constants cache */
         MTLAutoreleasedComputePipelineReflection reflection = nil;
         id<MTLComputePipelineState> pso = [device
             newComputePipelineStateWithFunction:    function
-            options:                                (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
+            options:                                options
             reflection:                             &reflection
             error:                                  &error
         ];
@@ -79,7 +106,6 @@ id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineState(
         return [device newComputePipelineStateWithFunction:function error:&error];
 }
 
-
 } // /namespace LLGL
 
 
@@ -14,13 +14,20 @@
 #include "MTConstantsCacheLayout.h"
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Container/DynamicArray.h>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
-// Manages the shader constants data for uniforms. Maximum size of such a cache is 4KB (as per Metal spec.).
+class MTStagingRing;
+
+/*
+Manages the shader constants data for uniforms.
+Constant buffers up to 4KB are passed inline via setBytes (as per Metal spec.),
+larger ones are written into the frame-fenced staging ring and bound with an offset.
+*/
 class MTConstantsCache
 {
 
@@ -38,10 +45,10 @@ class MTConstantsCache
         void SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize);
 
         // Flushes the pending descriptors to the specified command encoder.
-        void FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder);
-        void FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder);
-        void FlushComputeResources(id<MTLComputeCommandEncoder> computeEncoder);
-        void FlushComputeResourcesForced(id<MTLComputeCommandEncoder> computeEncoder);
+        void FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing);
+        void FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing);
+        void FlushComputeResources(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing);
+        void FlushComputeResourcesForced(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing);
 
         // Returns true if this cache has been invalidated.
         inline bool IsInvalidated() const
@@ -60,12 +67,26 @@ class MTConstantsCache
         using ConstantLocation  = MTConstantsCacheLayout::ConstantLocation;
         using ConstantBuffer    = MTConstantsCacheLayout::ConstantBuffer;
 
+    private:
+
+        // Writes the specified constant buffer into the staging ring and returns true if the ring buffer is already bound, i.e. only the offset must be updated.
+        bool WriteConstantBuffer(
+            std::size_t             constantBufferIndex,
+            MTStagingRing&          stagingRing,
+            id<MTLBuffer>&          outBuffer,
+            NSUInteger&             outOffset
+        );
+
+        void FlushGraphicsConstants(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing);
+        void FlushComputeConstants(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing);
+
     private:
 
         ArrayView<ConstantLocation> constantsMap_;
         ArrayView<ConstantBuffer>   constantBuffers_;
 
         DynamicByteArray            constants_;
+        std::vector<id<MTLBuffer>>  boundRingBuffers_;
 
         union
         {
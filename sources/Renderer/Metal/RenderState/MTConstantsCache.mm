@@ -7,6 +7,7 @@
 
 #include "MTConstantsCache.h"
 #include "../Shader/MTShader.h"
+#include "../Buffer/MTStagingRing.h"
 #include "../../PipelineStateUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
@@ -19,6 +20,12 @@ namespace LLGL
 {
 
 
+// Maximum size of inline constant data for setBytes, setVertexBytes, and setFragmentBytes.
+static constexpr std::uint16_t g_maxInlineConstantsSize = 4096;
+
+// Offset alignment for constant buffers; 256 bytes satisfies the constant address space on all Metal devices.
+static constexpr NSUInteger g_constantBufferOffsetAlignment = 256;
+
 void MTConstantsCache::Reset(const MTConstantsCacheLayout* layout)
 {
     if (layout != nullptr)
@@ -47,6 +54,7 @@ void MTConstantsCache::Reset(const MTConstantsCacheLayout* layout)
 void MTConstantsCache::Reset()
 {
     dirtyBits_.bits = 0xFF;
+    boundRingBuffers_.assign(constantBuffers_.size(), nil);
 }
 
 void MTConstantsCache::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
@@ -69,50 +77,135 @@ void MTConstantsCache::SetUniforms(std::uint32_t first, const void* data, std::u
         dataSize -= constant.size;
         bytes += constant.size;
     }
-    Reset();
+
+    /* Only invalidate the constants; ring buffers remain bound to the current encoder */
+    dirtyBits_.bits = 0xFF;
 }
 
-void MTConstantsCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder)
+void MTConstantsCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing)
 {
     if (dirtyBits_.graphics != 0)
-        FlushGraphicsResourcesForced(renderEncoder);
+        FlushGraphicsConstants(renderEncoder, stagingRing);
+}
+
+void MTConstantsCache::FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing)
+{
+    boundRingBuffers_.assign(constantBuffers_.size(), nil);
+    FlushGraphicsConstants(renderEncoder, stagingRing);
+}
+
+void MTConstantsCache::FlushComputeResources(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing)
+{
+    if (dirtyBits_.compute != 0)
+        FlushComputeConstants(computeEncoder, stagingRing);
+}
+
+void MTConstantsCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing)
+{
+    boundRingBuffers_.assign(constantBuffers_.size(), nil);
+    FlushComputeConstants(computeEncoder, stagingRing);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool MTConstantsCache::WriteConstantBuffer(
+    std::size_t     constantBufferIndex,
+    MTStagingRing&  stagingRing,
+    id<MTLBuffer>&  outBuffer,
+    NSUInteger&     outOffset)
+{
+    const ConstantBuffer& constantBuffer = constantBuffers_[constantBufferIndex];
+    stagingRing.Write(
+        constants_.get() + constantBuffer.offset,
+        constantBuffer.size,
+        outBuffer,
+        outOffset,
+        g_constantBufferOffsetAlignment
+    );
+
+    /* Ring buffer only needs a new offset if it is still bound from the previous flush */
+    if (boundRingBuffers_[constantBufferIndex] == outBuffer)
+        return true;
+
+    boundRingBuffers_[constantBufferIndex] = outBuffer;
+    return false;
 }
 
-void MTConstantsCache::FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder)
+void MTConstantsCache::FlushGraphicsConstants(id<MTLRenderCommandEncoder> renderEncoder, MTStagingRing& stagingRing)
 {
-    for (const ConstantBuffer& constantBuffer : constantBuffers_)
+    for_range(i, constantBuffers_.size())
     {
-        if ((constantBuffer.stages & StageFlags::VertexStage) != 0)
+        const ConstantBuffer& constantBuffer = constantBuffers_[i];
+        if ((constantBuffer.stages & (StageFlags::VertexStage | StageFlags::FragmentStage)) == 0)
+            continue;
+
+        if (constantBuffer.size > g_maxInlineConstantsSize)
         {
-            [renderEncoder
-                setVertexBytes: constants_.get() + constantBuffer.offset
-                length:         constantBuffer.size
-                atIndex:        constantBuffer.index
-            ];
+            /* Bind large constant buffers from staging ring */
+            id<MTLBuffer> buffer = nil;
+            NSUInteger offset = 0;
+            const bool isBound = WriteConstantBuffer(i, stagingRing, buffer, offset);
+
+            if ((constantBuffer.stages & StageFlags::VertexStage) != 0)
+            {
+                if (isBound)
+                    [renderEncoder setVertexBufferOffset:offset atIndex:constantBuffer.index];
+                else
+                    [renderEncoder setVertexBuffer:buffer offset:offset atIndex:constantBuffer.index];
+            }
+            if ((constantBuffer.stages & StageFlags::FragmentStage) != 0)
+            {
+                if (isBound)
+                    [renderEncoder setFragmentBufferOffset:offset atIndex:constantBuffer.index];
+                else
+                    [renderEncoder setFragmentBuffer:buffer offset:offset atIndex:constantBuffer.index];
+            }
         }
-        if ((constantBuffer.stages & StageFlags::FragmentStage) != 0)
+        else
         {
-            [renderEncoder
-                setFragmentBytes:   constants_.get() + constantBuffer.offset
-                length:             constantBuffer.size
-                atIndex:            constantBuffer.index
-            ];
+            if ((constantBuffer.stages & StageFlags::VertexStage) != 0)
+            {
+                [renderEncoder
+                    setVertexBytes: constants_.get() + constantBuffer.offset
+                    length:         constantBuffer.size
+                    atIndex:        constantBuffer.index
+                ];
+            }
+            if ((constantBuffer.stages & StageFlags::FragmentStage) != 0)
+            {
+                [renderEncoder
+                    setFragmentBytes:   constants_.get() + constantBuffer.offset
+                    length:             constantBuffer.size
+                    atIndex:            constantBuffer.index
+                ];
+            }
         }
     }
     dirtyBits_.graphics = 0;
 }
 
-void MTConstantsCache::FlushComputeResources(id<MTLComputeCommandEncoder> computeEncoder)
-{
-    if (dirtyBits_.compute != 0)
-        FlushComputeResourcesForced(computeEncoder);
-}
-
-void MTConstantsCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder> computeEncoder)
+void MTConstantsCache::FlushComputeConstants(id<MTLComputeCommandEncoder> computeEncoder, MTStagingRing& stagingRing)
 {
-    for (const ConstantBuffer& constantBuffer : constantBuffers_)
+    for_range(i, constantBuffers_.size())
     {
-        if ((constantBuffer.stages & StageFlags::ComputeStage) != 0)
+        const ConstantBuffer& constantBuffer = constantBuffers_[i];
+        if ((constantBuffer.stages & StageFlags::ComputeStage) == 0)
+            continue;
+
+        if (constantBuffer.size > g_maxInlineConstantsSize)
+        {
+            /* Bind large constant buffers from staging ring */
+            id<MTLBuffer> buffer = nil;
+            NSUInteger offset = 0;
+            if (WriteConstantBuffer(i, stagingRing, buffer, offset))
+                [computeEncoder setBufferOffset:offset atIndex:constantBuffer.index];
+            else
+                [computeEncoder setBuffer:buffer offset:offset atIndex:constantBuffer.index];
+        }
+        else
         {
             [computeEncoder
                 setBytes:   constants_.get() + constantBuffer.offset
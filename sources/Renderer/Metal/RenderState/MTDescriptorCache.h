@@ -21,6 +21,7 @@ namespace LLGL
 
 
 class MTPipelineLayout;
+class MTBuffer;
 
 struct MTDynamicResourceLayout
 {
@@ -47,6 +48,9 @@ class MTDescriptorCache
         // Sets the specified resource in this cache.
         void SetResource(std::uint32_t descriptor, Resource& resource);
 
+        // Sets the specified buffer with an offset in this cache. If only the offset changes, the buffer is not rebound on the next flush.
+        void SetBufferRange(std::uint32_t descriptor, MTBuffer& bufferMT, NSUInteger offset);
+
         // Flushes the pending descriptors to the specified command encoder.
         void FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder);
         void FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder);
@@ -69,8 +73,11 @@ class MTDescriptorCache
 
         void BuildResourceBindings(const ArrayView<MTDynamicResourceLayout>& bindings);
 
-        void BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource);
-        void BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource);
+        void BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset);
+        void BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset);
+
+        void BindGraphicsBufferOffset(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, NSUInteger offset);
+        void BindComputeBufferOffset(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, NSUInteger offset);
 
         // Marks the specified binding as invalidated.
         void InvalidateBinding(std::uint8_t index);
@@ -84,11 +91,19 @@ class MTDescriptorCache
             return (((dirtyBindings_[index / 64] >> (index % 64)) & 0x1) != 0);
         }
 
+        // Returns true if only the offset of the specified buffer binding is invalidated.
+        inline bool IsBindingOffsetOnly(std::uint8_t index) const
+        {
+            return (((offsetOnlyBindings_[index / 64] >> (index % 64)) & 0x1) != 0);
+        }
+
     private:
 
         ArrayView<MTDynamicResourceLayout>  layouts_;
         std::vector<id>                     bindings_;
+        std::vector<NSUInteger>             offsets_;                       // Buffer offsets for each binding
         std::uint64_t                       dirtyBindings_[4]   = {};
+        std::uint64_t                       offsetOnlyBindings_[4] = {};    // Dirty buffer bindings where only the offset has changed
         std::uint8_t                        dirtyRange_[2]      = {};
 
 };
@@ -34,6 +34,7 @@ void MTDescriptorCache::Reset(const MTPipelineLayout* pipelineLayout)
         layouts_ = pipelineLayout->GetDynamicBindings();
         LLGL_ASSERT(layouts_.size() <= 0xFF);
         bindings_.resize(layouts_.size());
+        offsets_.resize(layouts_.size());
     }
     else
     {
@@ -50,6 +51,7 @@ void MTDescriptorCache::Reset()
     dirtyBindings_[1]   = ~0ull;
     dirtyBindings_[2]   = ~0ull;
     dirtyBindings_[3]   = ~0ull;
+    ::memset(offsetOnlyBindings_, 0, sizeof(offsetOnlyBindings_));
     dirtyRange_[0]      = 0;
     dirtyRange_[1]      = static_cast<std::uint8_t>(bindings_.size());
 }
@@ -62,6 +64,7 @@ void MTDescriptorCache::Clear()
     dirtyBindings_[1]   = 0;
     dirtyBindings_[2]   = 0;
     dirtyBindings_[3]   = 0;
+    ::memset(offsetOnlyBindings_, 0, sizeof(offsetOnlyBindings_));
     dirtyRange_[0]      = 0xFF;
     dirtyRange_[1]      = 0;
 }
@@ -86,6 +89,7 @@ void MTDescriptorCache::SetResource(std::uint32_t descriptor, Resource& resource
         {
             auto& bufferMT = LLGL_CAST(MTBuffer&, resource);
             bindings_[descriptor] = bufferMT.GetNative();
+            offsets_[descriptor] = 0;
         }
         break;
 
@@ -104,7 +108,35 @@ void MTDescriptorCache::SetResource(std::uint32_t descriptor, Resource& resource
         break;
     }
 
-    InvalidateBinding(static_cast<std::uint8_t>(descriptor));
+    const std::uint8_t index = static_cast<std::uint8_t>(descriptor);
+    offsetOnlyBindings_[index / 64] &= ~(1ull << (index % 64));
+    InvalidateBinding(index);
+}
+
+void MTDescriptorCache::SetBufferRange(std::uint32_t descriptor, MTBuffer& bufferMT, NSUInteger offset)
+{
+    if (descriptor >= layouts_.size())
+        return /*Out of range*/;
+
+    const MTDynamicResourceLayout& layout = layouts_[descriptor];
+    if (layout.type != ResourceType::Buffer)
+        return /*Type mismatch*/;
+
+    LLGL_ASSERT(bindings_.size() >= layouts_.size());
+
+    /* Only update the offset if the same buffer is still bound or only its offset is pending */
+    const std::uint8_t index = static_cast<std::uint8_t>(descriptor);
+    id<MTLBuffer> buffer = bufferMT.GetNative();
+
+    if (bindings_[descriptor] == buffer && (!IsBindingInvalidated(index) || IsBindingOffsetOnly(index)))
+        offsetOnlyBindings_[index / 64] |= (1ull << (index % 64));
+    else
+        offsetOnlyBindings_[index / 64] &= ~(1ull << (index % 64));
+
+    bindings_[descriptor]   = buffer;
+    offsets_[descriptor]    = offset;
+
+    InvalidateBinding(index);
 }
 
 void MTDescriptorCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder)
@@ -115,8 +147,10 @@ void MTDescriptorCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> rende
         LLGL_ASSERT(layouts_.size() >= dirtyRange_[1]);
         for_subrange(i, dirtyRange_[0], dirtyRange_[1])
         {
-            if (IsBindingInvalidated(i))
-                BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i]);
+            if (IsBindingOffsetOnly(i))
+                BindGraphicsBufferOffset(renderEncoder, layouts_[i], offsets_[i]);
+            else if (IsBindingInvalidated(i))
+                BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i], offsets_[i]);
         }
         Clear();
     }
@@ -126,7 +160,7 @@ void MTDescriptorCache::FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder>
 {
     LLGL_ASSERT(bindings_.size() >= layouts_.size());
     for_range(i, layouts_.size())
-        BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i]);
+        BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i], offsets_[i]);
     Clear();
 }
 
@@ -138,8 +172,10 @@ void MTDescriptorCache::FlushComputeResources(id<MTLComputeCommandEncoder> compu
         LLGL_ASSERT(layouts_.size() >= dirtyRange_[1]);
         for_subrange(i, dirtyRange_[0], dirtyRange_[1])
         {
-            if (IsBindingInvalidated(i))
-                BindComputeResource(computeEncoder, layouts_[i], bindings_[i]);
+            if (IsBindingOffsetOnly(i))
+                BindComputeBufferOffset(computeEncoder, layouts_[i], offsets_[i]);
+            else if (IsBindingInvalidated(i))
+                BindComputeResource(computeEncoder, layouts_[i], bindings_[i], offsets_[i]);
         }
         Clear();
     }
@@ -149,7 +185,7 @@ void MTDescriptorCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder>
 {
     LLGL_ASSERT(bindings_.size() >= layouts_.size());
     for_range(i, layouts_.size())
-        BindComputeResource(computeEncoder, layouts_[i], bindings_[i]);
+        BindComputeResource(computeEncoder, layouts_[i], bindings_[i], offsets_[i]);
     Clear();
 }
 
@@ -158,7 +194,7 @@ void MTDescriptorCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder>
  * ======= Private: =======
  */
 
-void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource)
+void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset)
 {
     switch (layout.type)
     {
@@ -171,7 +207,7 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
             {
                 [renderEncoder
                     setVertexBuffer:    static_cast<id<MTLBuffer>>(resource)
-                    offset:             0
+                    offset:             offset
                     atIndex:            layout.slot
                 ];
             }
@@ -179,7 +215,7 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
             {
                 [renderEncoder
                     setFragmentBuffer:  static_cast<id<MTLBuffer>>(resource)
-                    offset:             0
+                    offset:             offset
                     atIndex:            layout.slot
                 ];
             }
@@ -226,7 +262,7 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
     }
 }
 
-void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource)
+void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset)
 {
     switch (layout.type)
     {
@@ -239,7 +275,7 @@ void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> compute
             {
                 [computeEncoder
                     setBuffer:  static_cast<id<MTLBuffer>>(resource)
-                    offset:     0
+                    offset:     offset
                     atIndex:    layout.slot
                 ];
             }
@@ -280,6 +316,36 @@ void MTDescriptorCache::InvalidateBinding(std::uint8_t index)
 }
 
 
+void MTDescriptorCache::BindGraphicsBufferOffset(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, NSUInteger offset)
+{
+    if ((layout.stages & StageFlags::VertexStage) != 0)
+    {
+        [renderEncoder
+            setVertexBufferOffset:  offset
+            atIndex:                layout.slot
+        ];
+    }
+    if ((layout.stages & StageFlags::FragmentStage) != 0)
+    {
+        [renderEncoder
+            setFragmentBufferOffset:    offset
+            atIndex:                    layout.slot
+        ];
+    }
+}
+
+void MTDescriptorCache::BindComputeBufferOffset(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, NSUInteger offset)
+{
+    if ((layout.stages & StageFlags::ComputeStage) != 0)
+    {
+        [computeEncoder
+            setBufferOffset:    offset
+            atIndex:            layout.slot
+        ];
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -12,29 +12,56 @@
 #import <Metal/Metal.h>
 
 #include <LLGL/Fence.h>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
-//TODO: currently unused
+/*
+Metal implementation of the <Fence> interface with an MTLSharedEvent, i.e. a monotonically increasing 64-bit value.
+If shared events are not available (before macOS 10.14 and iOS 12), the fence falls back to the completion of the command buffer it was signaled with.
+*/
 class MTFence final : public Fence
 {
 
+    public:
+
+        void SetDebugName(const char* name) override;
+
     public:
 
         MTFence(id<MTLDevice> device);
         ~MTFence();
 
-        inline id<MTLFence> GetNative() const
+        // Encodes a signal operation with the next value into the specified command buffer.
+        void EncodeSignal(id<MTLCommandBuffer> cmdBuffer);
+
+        // Encodes a GPU-side wait for the last signaled value into the specified command buffer.
+        void EncodeWait(id<MTLCommandBuffer> cmdBuffer);
+
+        // Blocks the calling thread until the last signaled value has been reached or the timeout (in nanoseconds) expired.
+        bool Wait(std::uint64_t timeout);
+
+        // Returns the native MTLSharedEvent object or nil if shared events are not supported.
+        inline id GetNative() const
         {
             return native_;
         }
 
+        // Returns the last value this fence has been signaled with.
+        inline std::uint64_t GetSignaledValue() const
+        {
+            return value_;
+        }
+
     private:
 
-        id<MTLFence> native_ = nil;
+        id                      native_             = nil; // id<MTLSharedEvent>
+        id                      listener_           = nil; // MTLSharedEventListener
+        std::uint64_t           value_              = 0;
+        id<MTLCommandBuffer>    signalCmdBuffer_    = nil; // Fallback if shared events are not supported
 
 };
 
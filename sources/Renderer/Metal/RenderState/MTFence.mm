@@ -6,20 +6,113 @@
  */
 
 #include "MTFence.h"
+#include <dispatch/dispatch.h>
 
 
 namespace LLGL
 {
 
 
-MTFence::MTFence(id<MTLDevice> device) :
-    native_ { [device newFence] }
+MTFence::MTFence(id<MTLDevice> device)
 {
+    if (@available(macOS 10.14, iOS 12.0, *))
+        native_ = [device newSharedEvent];
 }
 
 MTFence::~MTFence()
 {
-    [native_ release];
+    if (signalCmdBuffer_ != nil)
+        [signalCmdBuffer_ release];
+    if (listener_ != nil)
+        [listener_ release];
+    if (native_ != nil)
+        [native_ release];
+}
+
+void MTFence::SetDebugName(const char* name)
+{
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+            [(id<MTLSharedEvent>)native_ setLabel:(name != nullptr ? [NSString stringWithUTF8String:name] : nil)];
+    }
+}
+
+void MTFence::EncodeSignal(id<MTLCommandBuffer> cmdBuffer)
+{
+    ++value_;
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+        {
+            [cmdBuffer encodeSignalEvent:(id<MTLSharedEvent>)native_ value:value_];
+            return;
+        }
+    }
+
+    /* Fall back to completion of the signaling command buffer */
+    if (signalCmdBuffer_ != nil)
+        [signalCmdBuffer_ release];
+    signalCmdBuffer_ = [cmdBuffer retain];
+}
+
+void MTFence::EncodeWait(id<MTLCommandBuffer> cmdBuffer)
+{
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+            [cmdBuffer encodeWaitForEvent:(id<MTLSharedEvent>)native_ value:value_];
+    }
+}
+
+bool MTFence::Wait(std::uint64_t timeout)
+{
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+        {
+            id<MTLSharedEvent> sharedEvent = (id<MTLSharedEvent>)native_;
+            const std::uint64_t value = value_;
+            if (sharedEvent.signaledValue >= value)
+                return true;
+            if (timeout == 0)
+                return false;
+
+            if (@available(macOS 12.0, iOS 15.0, *))
+            {
+                /* Wait on the event directly; timeout is specified in milliseconds, so round up to not return early */
+                const std::uint64_t timeoutMS = (timeout == UINT64_MAX ? UINT64_MAX : (timeout + 999999) / 1000000);
+                return [sharedEvent waitUntilSignaledValue:value timeoutMS:timeoutMS];
+            }
+
+            /* Wait for CPU notification with a semaphore; the listener block retains the semaphore in case this wait times out */
+            if (listener_ == nil)
+                listener_ = [[MTLSharedEventListener alloc] init];
+
+            dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+            [sharedEvent
+                notifyListener: (MTLSharedEventListener*)listener_
+                atValue:        value
+                block:          ^(id<MTLSharedEvent> event, std::uint64_t signaledValue)
+                {
+                    dispatch_semaphore_signal(semaphore);
+                }
+            ];
+            const dispatch_time_t waitTime = (timeout == UINT64_MAX ? DISPATCH_TIME_FOREVER : dispatch_time(DISPATCH_TIME_NOW, static_cast<std::int64_t>(timeout)));
+            const bool result = (dispatch_semaphore_wait(semaphore, waitTime) == 0);
+            dispatch_release(semaphore);
+            return result;
+        }
+    }
+
+    /* Fall back to waiting for the signaling command buffer; no timeout available */
+    if (signalCmdBuffer_ != nil)
+    {
+        if (timeout == 0 && [signalCmdBuffer_ status] < MTLCommandBufferStatusCompleted)
+            return false;
+        [signalCmdBuffer_ waitUntilCompleted];
+    }
+    return true;
 }
 
 
@@ -19,6 +19,7 @@ namespace LLGL
 
 
 class MTRenderPass;
+class MTPipelineCache;
 class ByteBufferIterator;
 struct GraphicsPipelineDescriptor;
 
@@ -30,7 +31,8 @@ class MTGraphicsPSO final : public MTPipelineState
         MTGraphicsPSO(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
-            const MTRenderPass*                 defaultRenderPass
+            const MTRenderPass*                 defaultRenderPass,
+            MTPipelineCache*                    pipelineCache       = nullptr
         );
 
         // Binds the render pipeline state, depth-stencil states, and sets the remaining parameters with the specified command encoder.
@@ -71,6 +73,24 @@ class MTGraphicsPSO final : public MTPipelineState
             return tessPipelineState_;
         }
 
+        // Returns true if this PSO was created with object and mesh functions instead of a vertex function.
+        inline bool IsMeshPipeline() const
+        {
+            return isMeshPipeline_;
+        }
+
+        // Returns the number of threads per threadgroup for the object function. This is (1, 1, 1) if there is no object function.
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return threadsPerObjectThreadgroup_;
+        }
+
+        // Returns the number of threads per threadgroup for the mesh function.
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return threadsPerMeshThreadgroup_;
+        }
+
         // Returns true if the scissor test is enabled for this PSO.
         inline bool HasScissorTest() const
         {
@@ -89,20 +109,40 @@ class MTGraphicsPSO final : public MTPipelineState
             return stencilRefDynamic_;
         }
 
+        // Returns the bitmask of dynamic states. See DynamicStateFlags.
+        inline long GetDynamicStates() const
+        {
+            return dynamicStates_;
+        }
+
     private:
 
         bool CreateRenderPipelineState(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
-            const MTRenderPass*                 defaultRenderPass
+            const MTRenderPass*                 defaultRenderPass,
+            MTPipelineCache*                    pipelineCache
+        );
+
+        bool CreateMeshRenderPipelineState(
+            id<MTLDevice>                       device,
+            const GraphicsPipelineDescriptor&   desc,
+            const MTRenderPass&                 renderPass
         );
 
         id<MTLRenderPipelineState> CreateNativeRenderPipelineState(
             id<MTLDevice>                   device,
             MTLRenderPipelineDescriptor*    desc,
+            MTPipelineCache*                pipelineCache,
             NSError*&                       error
         );
 
+        // Creates the render pipeline state on Metal's own compiler threads. Bind blocks until it is available.
+        void CreateNativeRenderPipelineStateAsync(
+            id<MTLDevice>                   device,
+            MTLRenderPipelineDescriptor*    desc
+        );
+
         void CreateDepthStencilState(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc
@@ -126,6 +166,10 @@ class MTGraphicsPSO final : public MTPipelineState
         NSUInteger                  numPatchControlPoints_  = 0;
         MTLPatchType                patchType_              = MTLPatchTypeNone;
 
+        bool                        isMeshPipeline_                 = false;
+        MTLSize                     threadsPerObjectThreadgroup_    = { 1, 1, 1 };
+        MTLSize                     threadsPerMeshThreadgroup_      = { 1, 1, 1 };
+
         float                       depthBias_              = 0.0f;
         float                       depthSlope_             = 0.0f;
         float                       depthClamp_             = 0.0f;
@@ -140,6 +184,8 @@ class MTGraphicsPSO final : public MTPipelineState
         std::uint32_t               stencilFrontRef_        = 0;
         std::uint32_t               stencilBackRef_         = 0;
 
+        long                        dynamicStates_          = 0;
+
         DynamicByteArray            staticStateBuffer_;
         NSUInteger                  numStaticViewports_     = 0;
         NSUInteger                  numStaticScissors_      = 0;
@@ -8,8 +8,10 @@
 #include "MTGraphicsPSO.h"
 #include "MTRenderPass.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../Shader/MTShader.h"
 //#include "../Command/MTCommandContext.h"
+#include "../Command/MTIndirectDrawEncoder.h"
 #include "../MTTypes.h"
 #include "../MTCore.h"
 #include "../../CheckedCast.h"
@@ -49,7 +51,8 @@ static void FillDefaultMTStencilDesc(MTLStencilDescriptor* dst)
 MTGraphicsPSO::MTGraphicsPSO(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    MTPipelineCache*                    pipelineCache)
 :
     MTPipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout }
 {
@@ -73,8 +76,10 @@ MTGraphicsPSO::MTGraphicsPSO(
     blendColor_[2]      = desc.blend.blendFactor[2];
     blendColor_[3]      = desc.blend.blendFactor[3];
 
+    dynamicStates_      = desc.dynamicStates;
+
     /* Create render pipeline and depth-stencil states */
-    if (CreateRenderPipelineState(device, desc, defaultRenderPass))
+    if (CreateRenderPipelineState(device, desc, defaultRenderPass, pipelineCache))
     {
         CreateDepthStencilState(device, desc);
         BuildStaticStateBuffer(desc);
@@ -83,6 +88,8 @@ MTGraphicsPSO::MTGraphicsPSO(
 
 void MTGraphicsPSO::Bind(id<MTLRenderCommandEncoder> renderEncoder)
 {
+    WaitForAsyncCreation();
+
     [renderEncoder setRenderPipelineState:renderPipelineState_];
     [renderEncoder setDepthStencilState:depthStencilState_];
     [renderEncoder setCullMode:cullMode_];
@@ -207,8 +214,22 @@ static const MTShader* GetVertexOrPostTessVertexShader(const GraphicsPipelineDes
 bool MTGraphicsPSO::CreateRenderPipelineState(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    MTPipelineCache*                    pipelineCache)
 {
+    /* Get render pass object */
+    const MTRenderPass* renderPassMT = nullptr;
+    if (const RenderPass* renderPass = desc.renderPass)
+        renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
+    else if (defaultRenderPass != nullptr)
+        renderPassMT = defaultRenderPass;
+    else
+        throw std::invalid_argument("cannot create graphics pipeline without render pass");
+
+    /* Mesh pipelines replace the vertex function by object and mesh functions */
+    if (desc.meshShader != nullptr)
+        return CreateMeshRenderPipelineState(device, desc, *renderPassMT);
+
     /* Get native shader functions */
     const MTShader* vertexShaderMT = GetVertexOrPostTessVertexShader(desc);
 
@@ -227,19 +248,10 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
         return false;
     }
 
-    /* Get render pass object */
-    const MTRenderPass* renderPassMT = nullptr;
-    if (const RenderPass* renderPass = desc.renderPass)
-        renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
-    else if (defaultRenderPass != nullptr)
-        renderPassMT = defaultRenderPass;
-    else
-        throw std::invalid_argument("cannot create graphics pipeline without render pass");
-
     /* Create render pipeline state */
     MTLRenderPipelineDescriptor* psoDesc = [[MTLRenderPipelineDescriptor alloc] init];
     {
-        psoDesc.vertexDescriptor        = vertexShaderMT->GetMTLVertexDesc();
+        psoDesc.vertexDescriptor        = (desc.vertexStreams.empty() ? vertexShaderMT->GetMTLVertexDesc() : nil);
         psoDesc.alphaToCoverageEnabled  = MTBoolean(desc.blend.alphaToCoverageEnabled);
         psoDesc.alphaToOneEnabled       = NO;
         psoDesc.fragmentFunction        = GetNativeMTShader(desc.fragmentShader);
@@ -265,6 +277,13 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
         psoDesc.rasterizationEnabled            = (desc.rasterizer.discardEnabled ? NO : YES);
         psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPassMT->GetSampleCount() : 1u);
 
+        /* Specify number of views that are amplified for multiview render passes */
+        if (const std::uint32_t viewMask = renderPassMT->GetViewMask())
+        {
+            if (@available(macOS 10.15.4, iOS 13.0, *))
+                psoDesc.maxVertexAmplificationCount = static_cast<NSUInteger>(__builtin_popcount(viewMask));
+        }
+
         /* Specify tessellation state */
         if (numPatchControlPoints_ > 0)
         {
@@ -280,9 +299,23 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
             psoDesc.tessellationOutputWindingOrder      = (desc.tessellation.outputWindingCCW ? MTLWindingCounterClockwise : MTLWindingClockwise);
             psoDesc.tessellationPartitionMode           = MTTypes::ToMTLPartitionMode(desc.tessellation.partition);
         }
+        else if (MTIndirectDrawEncoder::IsSupported(device))
+        {
+            /* Allow draw commands from indirect command buffers (ICB) to inherit this PSO (see DrawIndirectCount) */
+            if (@available(macOS 10.14, iOS 12.0, *))
+                psoDesc.supportIndirectCommandBuffers = YES;
+        }
+    }
+    /* Create PSO asynchronously unless it needs reflection, a tessellation stage, or a lookup in the pipeline cache */
+    if (numPatchControlPoints_ == 0 && !NeedsConstantsCache() && (pipelineCache == nullptr || !pipelineCache->HasArchive()))
+    {
+        CreateNativeRenderPipelineStateAsync(device, psoDesc);
+        [psoDesc release];
+        return true;
     }
+
     NSError* error = nullptr;
-    renderPipelineState_ = CreateNativeRenderPipelineState(device, psoDesc, error);
+    renderPipelineState_ = CreateNativeRenderPipelineState(device, psoDesc, pipelineCache, error);
     if (!renderPipelineState_)
         MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
     [psoDesc release];
@@ -292,7 +325,19 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
     {
         if (auto* tessComputeShaderMT = LLGL_CAST(const MTShader*, desc.tessControlShader))
         {
-            tessPipelineState_ = [device newComputePipelineStateWithFunction:tessComputeShaderMT->GetNative() error:&error];
+            if (pipelineCache != nullptr && pipelineCache->HasArchive())
+            {
+                /* Create tessellation compute PSO with descriptor to look up its GPU binary in the pipeline cache */
+                MTLComputePipelineDescriptor* tessPSODesc = [[MTLComputePipelineDescriptor alloc] init];
+                tessPSODesc.computeFunction = tessComputeShaderMT->GetNative();
+                pipelineCache->PrepareComputePipelineDescriptor(tessPSODesc);
+                tessPipelineState_ = [device newComputePipelineStateWithDescriptor:tessPSODesc options:MTLPipelineOptionNone reflection:nil error:&error];
+                if (tessPipelineState_)
+                    pipelineCache->AddComputePipelineFunctions(tessPSODesc);
+                [tessPSODesc release];
+            }
+            else
+                tessPipelineState_ = [device newComputePipelineStateWithFunction:tessComputeShaderMT->GetNative() error:&error];
             if (!tessPipelineState_)
                 MTThrowIfCreateFailed(error, "MTLComputePipelineState");
         }
@@ -303,26 +348,120 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
     return true;
 }
 
+bool MTGraphicsPSO::CreateMeshRenderPipelineState(
+    id<MTLDevice>                       device,
+    const GraphicsPipelineDescriptor&   desc,
+    const MTRenderPass&                 renderPass)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        const MTShader* meshShaderMT = LLGL_CAST(const MTShader*, desc.meshShader);
+        const MTShader* taskShaderMT = LLGL_CAST(const MTShader*, desc.taskShader);
+        if (meshShaderMT->GetNative() == nil)
+        {
+            GetMutableReport().Errorf("cannot create Metal mesh PSO without valid mesh function");
+            return false;
+        }
+
+        /* Store threadgroup sizes for DrawMeshTasks commands */
+        isMeshPipeline_             = true;
+        threadsPerMeshThreadgroup_  = meshShaderMT->GetNumThreadsPerGroup();
+        if (taskShaderMT != nullptr)
+            threadsPerObjectThreadgroup_ = taskShaderMT->GetNumThreadsPerGroup();
+
+        MTLMeshRenderPipelineDescriptor* psoDesc = [[MTLMeshRenderPipelineDescriptor alloc] init];
+        {
+            psoDesc.objectFunction          = GetNativeMTShader(desc.taskShader);
+            psoDesc.meshFunction            = meshShaderMT->GetNative();
+            psoDesc.fragmentFunction        = GetNativeMTShader(desc.fragmentShader);
+            psoDesc.alphaToCoverageEnabled  = MTBoolean(desc.blend.alphaToCoverageEnabled);
+            psoDesc.alphaToOneEnabled       = NO;
+
+            /* Initialize pixel formats from render pass */
+            const MTColorAttachmentFormatVector& colorAttachments = renderPass.GetColorAttachments();
+            for_range(i, std::min(colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)))
+            {
+                FillColorAttachmentDesc(
+                    psoDesc.colorAttachments[i],
+                    colorAttachments[i].pixelFormat,
+                    desc.blend,
+                    desc.blend.targets[desc.blend.independentBlendEnabled ? i : 0]
+                );
+            };
+
+            psoDesc.depthAttachmentPixelFormat      = renderPass.GetDepthAttachment().pixelFormat;
+            psoDesc.stencilAttachmentPixelFormat    = renderPass.GetStencilAttachment().pixelFormat;
+            psoDesc.rasterizationEnabled            = (desc.rasterizer.discardEnabled ? NO : YES);
+            psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPass.GetSampleCount() : 1u);
+            psoDesc.maxVertexAmplificationCount     = static_cast<NSUInteger>(std::max(1, __builtin_popcount(renderPass.GetViewMask())));
+        }
+        NSError* error = nullptr;
+        renderPipelineState_ = [device newRenderPipelineStateWithMeshDescriptor:psoDesc options:MTLPipelineOptionNone reflection:nil error:&error];
+        if (!renderPipelineState_)
+            MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+        [psoDesc release];
+
+        return true;
+    }
+    else
+    {
+        GetMutableReport().Errorf("cannot create Metal mesh PSO: object and mesh functions require macOS 13.0 or iOS 16.0");
+        return false;
+    }
+}
+
 id<MTLRenderPipelineState> MTGraphicsPSO::CreateNativeRenderPipelineState(
     id<MTLDevice>                   device,
     MTLRenderPipelineDescriptor*    desc,
+    MTPipelineCache*                pipelineCache,
     NSError*&                       error)
 {
+    /* Look up GPU binaries in pipeline cache first */
+    if (pipelineCache != nullptr)
+        pipelineCache->PrepareRenderPipelineDescriptor(desc);
+
+    id<MTLRenderPipelineState> pso = nil;
     if (NeedsConstantsCache())
     {
         /* Create PSO with reflection to generate constants cache */
         MTLAutoreleasedRenderPipelineReflection reflection = nil;
-        id<MTLRenderPipelineState> pso = [device
+        pso = [device
             newRenderPipelineStateWithDescriptor:   desc
             options:                                (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
             reflection:                             &reflection
             error:                                  &error
         ];
         CreateConstantsCacheForRenderPipeline(reflection);
-        return pso;
     }
     else
-        return [device newRenderPipelineStateWithDescriptor:desc error:&error];
+        pso = [device newRenderPipelineStateWithDescriptor:desc error:&error];
+
+    /* Store GPU binaries in pipeline cache for the next application launch */
+    if (pso != nil && pipelineCache != nullptr)
+        pipelineCache->AddRenderPipelineFunctions(desc);
+
+    return pso;
+}
+
+void MTGraphicsPSO::CreateNativeRenderPipelineStateAsync(
+    id<MTLDevice>                   device,
+    MTLRenderPipelineDescriptor*    desc)
+{
+    dispatch_group_t group = BeginAsyncCreation();
+    [device
+        newRenderPipelineStateWithDescriptor:   desc
+        completionHandler:                      ^(id<MTLRenderPipelineState> pso, NSError* error)
+        {
+            /* PSO is only valid for the duration of this handler unless it is retained; errors are reported instead of thrown on this thread */
+            renderPipelineState_ = [pso retain];
+            if (pso == nil)
+            {
+                const char* errorText = (error != nil ? [[error localizedDescription] UTF8String] : "unknown error");
+                ResetReport(std::string{ "failed to create instance of <MTLRenderPipelineState>: " } + errorText + "\n", true);
+            }
+            dispatch_group_leave(group);
+        }
+    ];
 }
 
 void MTGraphicsPSO::CreateDepthStencilState(
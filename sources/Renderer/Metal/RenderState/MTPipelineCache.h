@@ -0,0 +1,72 @@
+/*
+ * MTPipelineCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_PIPELINE_CACHE_H
+#define LLGL_MT_PIPELINE_CACHE_H
+
+
+#import <Metal/Metal.h>
+
+#include <LLGL/PipelineCache.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Pipeline cache implementation with MTLBinaryArchive (macOS 11.0, iOS 14.0).
+Pipeline states that are created with this cache look up their GPU binaries in the archive first and add them to the archive otherwise,
+so a serialized archive allows subsequent application launches to skip the GPU compiler.
+If MTLBinaryArchive is not available, this cache has no effect and returns an empty blob.
+*/
+class MTPipelineCache final : public PipelineCache
+{
+
+    public:
+
+        MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob);
+        ~MTPipelineCache();
+
+        Blob GetBlob() const override;
+
+    public:
+
+        // Adds the binary archive to the specified render pipeline descriptor, so its functions are looked up in this cache.
+        void PrepareRenderPipelineDescriptor(MTLRenderPipelineDescriptor* desc);
+
+        // Adds the binary archive to the specified compute pipeline descriptor, so its function is looked up in this cache.
+        void PrepareComputePipelineDescriptor(MTLComputePipelineDescriptor* desc);
+
+        // Adds the GPU binaries of the specified render pipeline descriptor to this cache.
+        void AddRenderPipelineFunctions(MTLRenderPipelineDescriptor* desc);
+
+        // Adds the GPU binary of the specified compute pipeline descriptor to this cache.
+        void AddComputePipelineFunctions(MTLComputePipelineDescriptor* desc);
+
+        // Returns true if this cache is backed by a binary archive.
+        inline bool HasArchive() const
+        {
+            return (archive_ != nil);
+        }
+
+    private:
+
+        id      archive_        = nil; // id<MTLBinaryArchive>
+        NSURL*  initialBlobURL_ = nil; // Temporary file the archive was loaded from
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,128 @@
+/*
+ * MTPipelineCache.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTPipelineCache.h"
+
+
+namespace LLGL
+{
+
+
+// Returns a new URL for a temporary file; MTLBinaryArchive can only be loaded from and serialized to files.
+static NSURL* NewTemporaryFileURL()
+{
+    NSString* filename = [NSString stringWithFormat:@"LLGL-PipelineCache-%@.bin", [[NSUUID UUID] UUIDString]];
+    NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:filename];
+    return [[NSURL alloc] initFileURLWithPath:path];
+}
+
+MTPipelineCache::MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        MTLBinaryArchiveDescriptor* archiveDesc = [[MTLBinaryArchiveDescriptor alloc] init];
+
+        /* Write initial blob into temporary file to load the archive from; the file must outlive the archive */
+        if (initialBlob)
+        {
+            NSData* data = [NSData dataWithBytesNoCopy:const_cast<void*>(initialBlob.GetData()) length:initialBlob.GetSize() freeWhenDone:NO];
+            initialBlobURL_ = NewTemporaryFileURL();
+            if ([data writeToURL:initialBlobURL_ atomically:NO])
+                archiveDesc.url = initialBlobURL_;
+        }
+
+        NSError* error = nil;
+        archive_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+
+        if (archive_ == nil && archiveDesc.url != nil)
+        {
+            /* Initial blob was created for a different device or OS version, so start with an empty archive */
+            archiveDesc.url = nil;
+            archive_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+        }
+
+        [archiveDesc release];
+    }
+}
+
+MTPipelineCache::~MTPipelineCache()
+{
+    [archive_ release];
+    if (initialBlobURL_ != nil)
+    {
+        [[NSFileManager defaultManager] removeItemAtURL:initialBlobURL_ error:nil];
+        [initialBlobURL_ release];
+    }
+}
+
+Blob MTPipelineCache::GetBlob() const
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        if (archive_ != nil)
+        {
+            /* Serialize archive into a separate temporary file, since the initial file might still be mapped by the archive */
+            NSURL* url = NewTemporaryFileURL();
+
+            Blob blob;
+            NSError* error = nil;
+            if ([(id<MTLBinaryArchive>)archive_ serializeToURL:url error:&error])
+            {
+                blob = Blob::CreateFromFile([[url path] UTF8String]);
+                [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+            }
+
+            [url release];
+            return blob;
+        }
+    }
+    return {};
+}
+
+void MTPipelineCache::PrepareRenderPipelineDescriptor(MTLRenderPipelineDescriptor* desc)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        if (archive_ != nil)
+            desc.binaryArchives = @[ (id<MTLBinaryArchive>)archive_ ];
+    }
+}
+
+void MTPipelineCache::PrepareComputePipelineDescriptor(MTLComputePipelineDescriptor* desc)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        if (archive_ != nil)
+            desc.binaryArchives = @[ (id<MTLBinaryArchive>)archive_ ];
+    }
+}
+
+void MTPipelineCache::AddRenderPipelineFunctions(MTLRenderPipelineDescriptor* desc)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        /* Failing to add functions only means they have to be compiled again on the next launch */
+        if (archive_ != nil)
+            [(id<MTLBinaryArchive>)archive_ addRenderPipelineFunctionsWithDescriptor:desc error:nil];
+    }
+}
+
+void MTPipelineCache::AddComputePipelineFunctions(MTLComputePipelineDescriptor* desc)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        if (archive_ != nil)
+            [(id<MTLBinaryArchive>)archive_ addComputePipelineFunctionsWithDescriptor:desc error:nil];
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -33,6 +33,7 @@ class MTPipelineState : public PipelineState
     public:
 
         MTPipelineState(bool isGraphicsPSO, const PipelineLayout* pipelineLayout);
+        ~MTPipelineState();
 
         const Report* GetReport() const override final;
 
@@ -66,6 +67,15 @@ class MTPipelineState : public PipelineState
         void CreateConstantsCacheForRenderPipeline(MTLRenderPipelineReflection* reflection);
         void CreateConstantsCacheForComputePipeline(MTLComputePipelineReflection* reflection);
 
+        /*
+        Returns a dispatch group that must be left when the asynchronous creation of the native PSO has completed.
+        GetReport and WaitForAsyncCreation block until then.
+        */
+        dispatch_group_t BeginAsyncCreation();
+
+        // Blocks until the asynchronous creation of the native PSO has completed, or returns immediately if there is none.
+        void WaitForAsyncCreation() const;
+
         // Returns a mutable reference to the PSO report.
         inline Report& GetMutableReport()
         {
@@ -78,6 +88,7 @@ class MTPipelineState : public PipelineState
         const MTPipelineLayout*                 pipelineLayout_         = nullptr;
         std::unique_ptr<MTConstantsCacheLayout> constantsCacheLayout_;
         Report                                  report_;
+        dispatch_group_t                        asyncGroup_             = nil;
 
 };
 
@@ -23,8 +23,19 @@ MTPipelineState::MTPipelineState(bool isGraphicsPSO, const PipelineLayout* pipel
         pipelineLayout_ = LLGL_CAST(const MTPipelineLayout*, pipelineLayout);
 }
 
+MTPipelineState::~MTPipelineState()
+{
+    /* Completion handler of asynchronous PSO creation refers to this object, so wait until it has finished */
+    if (asyncGroup_ != nil)
+    {
+        dispatch_group_wait(asyncGroup_, DISPATCH_TIME_FOREVER);
+        dispatch_release(asyncGroup_);
+    }
+}
+
 const Report* MTPipelineState::GetReport() const
 {
+    WaitForAsyncCreation();
     return (report_ ? &report_ : nullptr);
 }
 
@@ -38,6 +49,20 @@ void MTPipelineState::ResetReport(std::string&& text, bool hasErrors)
     report_.Reset(std::forward<std::string&&>(text), hasErrors);
 }
 
+dispatch_group_t MTPipelineState::BeginAsyncCreation()
+{
+    if (asyncGroup_ == nil)
+        asyncGroup_ = dispatch_group_create();
+    dispatch_group_enter(asyncGroup_);
+    return asyncGroup_;
+}
+
+void MTPipelineState::WaitForAsyncCreation() const
+{
+    if (asyncGroup_ != nil)
+        dispatch_group_wait(asyncGroup_, DISPATCH_TIME_FOREVER);
+}
+
 bool MTPipelineState::NeedsConstantsCache() const
 {
     return (pipelineLayout_ != nullptr && !pipelineLayout_->GetUniforms().empty());
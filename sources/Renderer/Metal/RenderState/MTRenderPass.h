@@ -78,12 +78,19 @@ class MTRenderPass final : public RenderPass
             return sampleCount_;
         }
 
+        // Returns the bitmask of views for multiview rendering or 0 if multiview is disabled.
+        inline std::uint32_t GetViewMask() const
+        {
+            return viewMask_;
+        }
+
     private:
 
         MTColorAttachmentFormatVector   colorAttachments_;
         MTAttachmentFormat              depthAttachment_;
         MTAttachmentFormat              stencilAttachment_;
         NSUInteger                      sampleCount_        = 1;
+        std::uint32_t                   viewMask_           = 0;
 
 };
 
@@ -53,7 +53,8 @@ static MTAttachmentFormat MakeMTAttachmentFormat(const Format format)
 
 // Initializer when a custom render pass is created
 MTRenderPass::MTRenderPass(id<MTLDevice> device, const RenderPassDescriptor& desc) :
-    sampleCount_ { GetMTRenderPassSampleCount(device, desc.samples) }
+    sampleCount_ { GetMTRenderPassSampleCount(device, desc.samples) },
+    viewMask_    { desc.viewMask                                    }
 {
     const auto numColorAttachments = NumEnabledColorAttachments(desc);
     LLGL_ASSERT(numColorAttachments <= LLGL_MAX_NUM_COLOR_ATTACHMENTS);
@@ -75,6 +76,7 @@ MTRenderPass::MTRenderPass(id<MTLDevice> device, const RenderTargetDescriptor& d
         colorAttachments_   = renderPassMT->GetColorAttachments();
         depthAttachment_    = renderPassMT->GetDepthAttachment();
         stencilAttachment_  = renderPassMT->GetStencilAttachment();
+        viewMask_           = renderPassMT->GetViewMask();
     }
     else
     {
@@ -195,6 +197,14 @@ static void SetMTStencilAttachmentClearValue(
     dst.clearStencil    = clearValue.stencil;
 }
 
+// Returns the load action for the specified attachment; memoryless attachments have no content that could be loaded.
+static MTLLoadAction GetNativeLoadAction(MTLRenderPassAttachmentDescriptor* attachment, MTLLoadAction loadAction)
+{
+    if (loadAction == MTLLoadActionLoad && MTTexture::IsMemoryless(attachment.texture))
+        return MTLLoadActionDontCare;
+    return loadAction;
+}
+
 std::uint32_t MTRenderPass::UpdateNativeRenderPass(
     MTLRenderPassDescriptor*    nativeRenderPass,
     std::uint32_t               numClearValues,
@@ -214,7 +224,7 @@ std::uint32_t MTRenderPass::UpdateNativeRenderPass(
 
         if (attachment.loadAction != MTLLoadActionDontCare)
         {
-            nativeRenderPass.colorAttachments[i].loadAction = attachment.loadAction;
+            nativeRenderPass.colorAttachments[i].loadAction = GetNativeLoadAction(nativeRenderPass.colorAttachments[i], attachment.loadAction);
             //nativeRenderPass.colorAttachments[i].storeAction = attachment.storeAction;
 
             /* Clear color attachment with input or default value */
@@ -236,7 +246,7 @@ std::uint32_t MTRenderPass::UpdateNativeRenderPass(
 
     if (depthAttachment_.loadAction != MTLLoadActionDontCare)
     {
-        nativeRenderPass.depthAttachment.loadAction = depthAttachment_.loadAction;
+        nativeRenderPass.depthAttachment.loadAction = GetNativeLoadAction(nativeRenderPass.depthAttachment, depthAttachment_.loadAction);
         //nativeRenderPass.depthAttachment.storeAction = depthAttachment_.storeAction;
 
         if (depthAttachment_.loadAction == MTLLoadActionClear)
@@ -255,7 +265,7 @@ std::uint32_t MTRenderPass::UpdateNativeRenderPass(
     /* Update clear value for stencil attachment */
     if (stencilAttachment_.loadAction != MTLLoadActionDontCare)
     {
-        nativeRenderPass.stencilAttachment.loadAction = stencilAttachment_.loadAction;
+        nativeRenderPass.stencilAttachment.loadAction = GetNativeLoadAction(nativeRenderPass.stencilAttachment, stencilAttachment_.loadAction);
         //nativeRenderPass.stencilAttachment.storeAction = stencilAttachment_.storeAction;
 
         if (stencilAttachment_.loadAction == MTLLoadActionClear)
@@ -29,6 +29,7 @@ namespace LLGL
 enum MTResourceType : std::uint32_t;
 class MTTexture;
 class BindingDescriptorIterator;
+struct BindingDescriptor;
 struct MTResourceBinding;
 struct ResourceHeapDescriptor;
 struct TextureViewDescriptor;
@@ -47,8 +48,10 @@ class MTResourceHeap final : public ResourceHeap
     public:
 
         MTResourceHeap(
+            id<MTLDevice>                               device,
             const ResourceHeapDescriptor&               desc,
-            const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
+            const ArrayView<ResourceViewDescriptor>&    initialResourceViews    = {},
+            NSInteger                                   argumentBufferSlot      = -1
         );
         ~MTResourceHeap();
 
@@ -61,6 +64,12 @@ class MTResourceHeap final : public ResourceHeap
         bool HasGraphicsResources() const;
         bool HasComputeResources() const;
 
+        // Returns true if this resource heap encodes its descriptor sets into an argument buffer. See RendererConfigurationMetal::argumentBufferSlot.
+        inline bool HasArgumentBuffer() const
+        {
+            return (argumentBuffer_ != nil);
+        }
+
     private:
 
         struct MTResourceBinding;
@@ -148,7 +157,7 @@ class MTResourceHeap final : public ResourceHeap
         const char* BindKernelResources(id<MTLComputeCommandEncoder> cmdEncoder, const char* heapPtr);
 
         void WriteResourceViewBuffer(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding);
-        void WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding, std::uint32_t descriptorSet);
+        id<MTLTexture> WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding, std::uint32_t descriptorSet);
         void WriteResourceViewSamplerState(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding);
 
         void ExchangeTextureView(
@@ -157,6 +166,23 @@ class MTResourceHeap final : public ResourceHeap
             id<MTLTexture>                          textureView
         );
 
+        void CreateArgumentBuffer(
+            id<MTLDevice>                           device,
+            const ArrayView<BindingDescriptor>&     bindings,
+            NSUInteger                              numDescriptorSets,
+            NSUInteger                              argumentBufferSlot
+        );
+
+        void EncodeArgument(
+            std::uint32_t                           descriptorSet,
+            std::uint32_t                           bindingIndex,
+            const ResourceViewDescriptor&           desc,
+            id<MTLTexture>                          textureView
+        );
+
+        void BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet);
+        void BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet);
+
         id<MTLTexture> GetOrCreateTexture(
             std::uint32_t                           descriptorSet,
             const BindingSegmentLocation::Stage&    binding,
@@ -188,6 +214,17 @@ class MTResourceHeap final : public ResourceHeap
         std::vector<id<MTLTexture>>         textureViews_;
         std::uint32_t                       numTextureViewsPerSet_  = 0;
 
+        id<MTLArgumentEncoder>              argumentEncoder_        = nil;
+        id<MTLBuffer>                       argumentBuffer_         = nil;  // Argument buffer with one encoded range per descriptor set.
+        NSUInteger                          argumentBufferStride_   = 0;
+        NSUInteger                          argumentBufferSlot_     = 0;
+        long                                argumentBufferStages_   = 0;    // Bitwise OR combination of StageFlags of all heap bindings.
+
+        std::vector<id<MTLResource>>        argumentResources_;             // Resources referenced by the argument buffer per descriptor set: read-only resources first, then read-write resources.
+        std::vector<std::uint32_t>          argumentResourceIndices_;       // Maps a binding index to its index in argumentResources_ within a descriptor set.
+        NSUInteger                          numArgumentReadResources_   = 0;
+        NSUInteger                          numArgumentWriteResources_  = 0;
+
 };
 
 
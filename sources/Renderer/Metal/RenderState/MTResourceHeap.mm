@@ -18,6 +18,7 @@
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/PipelineLayoutFlags.h>
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -79,14 +80,23 @@ struct MTResourceHeapSegment
 #define MTRESOURCEHEAP_DATA1_OFFSETS_CONST(PTR)         MTRESOURCEHEAP_DATA1(PTR, const NSUInteger)
 #define MTRESOURCEHEAP_DATA1_OFFSETS(PTR)               MTRESOURCEHEAP_DATA1(PTR, NSUInteger)
 
+// Stage flags that map to the Metal vertex, fragment, and kernel functions.
+static constexpr long g_vertexStages    = (StageFlags::VertexStage | StageFlags::TessEvaluationStage);
+static constexpr long g_fragmentStages  = (StageFlags::FragmentStage);
+static constexpr long g_kernelStages    = (StageFlags::ComputeStage | StageFlags::TessControlStage);
+
+static constexpr std::uint32_t g_invalidArgumentResourceIndex = ~0u;
+
 
 /*
  * MTResourceHeap class
  */
 
 MTResourceHeap::MTResourceHeap(
+    id<MTLDevice>                               device,
     const ResourceHeapDescriptor&               desc,
-    const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+    const ArrayView<ResourceViewDescriptor>&    initialResourceViews,
+    NSInteger                                   argumentBufferSlot)
 {
     /* Get pipeline layout object */
     auto pipelineLayoutMT = LLGL_CAST(MTPipelineLayout*, desc.pipelineLayout);
@@ -102,28 +112,24 @@ MTResourceHeap::MTResourceHeap(
     bindingMap_.resize(numBindings);
 
     /* Build buffer segments */
-    constexpr long vertexStages     = (StageFlags::VertexStage | StageFlags::TessEvaluationStage);
-    constexpr long fragmentStages   = (StageFlags::FragmentStage);
-    constexpr long kernelStages     = (StageFlags::ComputeStage | StageFlags::TessControlStage);
-
     BindingDescriptorIterator bindingIter{ bindings };
 
     /* Build vertex resource segments */
-    segmentation_.numVertexBufferSegments       = AllocBufferSegments(bindingIter, vertexStages);
-    segmentation_.numVertexTextureSegments      = AllocTextureSegments(bindingIter, vertexStages);
-    segmentation_.numVertexSamplerSegments      = AllocSamplerStateSegments(bindingIter, vertexStages);
+    segmentation_.numVertexBufferSegments       = AllocBufferSegments(bindingIter, g_vertexStages);
+    segmentation_.numVertexTextureSegments      = AllocTextureSegments(bindingIter, g_vertexStages);
+    segmentation_.numVertexSamplerSegments      = AllocSamplerStateSegments(bindingIter, g_vertexStages);
 
     /* Build fragment resource segments */
-    segmentation_.numFragmentBufferSegments     = AllocBufferSegments(bindingIter, fragmentStages);
-    segmentation_.numFragmentTextureSegments    = AllocTextureSegments(bindingIter, fragmentStages);
-    segmentation_.numFragmentSamplerSegments    = AllocSamplerStateSegments(bindingIter, fragmentStages);
+    segmentation_.numFragmentBufferSegments     = AllocBufferSegments(bindingIter, g_fragmentStages);
+    segmentation_.numFragmentTextureSegments    = AllocTextureSegments(bindingIter, g_fragmentStages);
+    segmentation_.numFragmentSamplerSegments    = AllocSamplerStateSegments(bindingIter, g_fragmentStages);
 
     /* Build kernel resource segments (and store buffer offset to kernel segments) */
     heapOffsetKernel_ = static_cast<std::uint32_t>(heap_.Size());
 
-    segmentation_.numKernelBufferSegments       = AllocBufferSegments(bindingIter, kernelStages);
-    segmentation_.numKernelTextureSegments      = AllocTextureSegments(bindingIter, kernelStages);
-    segmentation_.numKernelSamplerSegments      = AllocSamplerStateSegments(bindingIter, kernelStages);
+    segmentation_.numKernelBufferSegments       = AllocBufferSegments(bindingIter, g_kernelStages);
+    segmentation_.numKernelTextureSegments      = AllocTextureSegments(bindingIter, g_kernelStages);
+    segmentation_.numKernelSamplerSegments      = AllocSamplerStateSegments(bindingIter, g_kernelStages);
 
     /* Store resource usage bits in segmentation header */
     CacheResourceUsage();
@@ -135,6 +141,10 @@ MTResourceHeap::MTResourceHeap(
     /* Allocate texture view array */
     textureViews_.resize(numTextureViewsPerSet_ * numSegmentSets);
 
+    /* Encode descriptor sets into argument buffer if enabled */
+    if (argumentBufferSlot >= 0)
+        CreateArgumentBuffer(device, bindings, numSegmentSets, static_cast<NSUInteger>(argumentBufferSlot));
+
     /* Write initial resource views */
     if (!initialResourceViews.empty())
         WriteResourceViews(0, initialResourceViews);
@@ -147,6 +157,8 @@ MTResourceHeap::~MTResourceHeap()
         if (tex != nil)
             [tex release];
     }
+    [argumentEncoder_ release];
+    [argumentBuffer_ release];
 }
 
 std::uint32_t MTResourceHeap::GetNumDescriptorSets() const
@@ -180,12 +192,15 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
             continue;
 
         /* Get binding information and heap start for descriptor set */
-        const auto& binding = bindingMap_[firstDescriptor % numBindings];
+        const auto  bindingIndex    = firstDescriptor % numBindings;
+        const auto& binding         = bindingMap_[bindingIndex];
 
         auto descriptorSet  = firstDescriptor / numBindings;
         auto heapStartPtr   = heap_.SegmentData(descriptorSet);
 
         /* Write descriptor into respective heap segment for each affected shader stage */
+        id<MTLTexture> textureView = nil;
+
         for_range(stage, static_cast<int>(MTShaderStage_Count))
         {
             auto offset     = binding.stages[stage].segmentOffset;
@@ -201,7 +216,7 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
                     WriteResourceViewBuffer(desc, heapPtr, binding.stages[stage]);
                     break;
                 case MTResourceType_Texture:
-                    WriteResourceViewTexture(desc, heapPtr, binding.stages[stage], descriptorSet);
+                    textureView = WriteResourceViewTexture(desc, heapPtr, binding.stages[stage], descriptorSet);
                     break;
                 case MTResourceType_SamplerState:
                     WriteResourceViewSamplerState(desc, heapPtr, binding.stages[stage]);
@@ -209,6 +224,10 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
             }
         }
 
+        /* Encode descriptor into argument buffer */
+        if (argumentEncoder_ != nil)
+            EncodeArgument(descriptorSet, bindingIndex, desc, textureView);
+
         ++numWritten;
         ++firstDescriptor;
     }
@@ -221,6 +240,12 @@ void MTResourceHeap::BindGraphicsResources(id<MTLRenderCommandEncoder> renderEnc
     if (descriptorSet >= heap_.NumSets())
         return;
 
+    if (argumentBuffer_ != nil)
+    {
+        BindGraphicsArgumentBuffer(renderEncoder, descriptorSet);
+        return;
+    }
+
     const char* heapPtr = heap_.SegmentData(descriptorSet);
     if (segmentation_.hasVertexResources)
         heapPtr = BindVertexResources(renderEncoder, heapPtr);
@@ -233,6 +258,12 @@ void MTResourceHeap::BindComputeResources(id<MTLComputeCommandEncoder> computeEn
     if (descriptorSet >= heap_.NumSets())
         return;
 
+    if (argumentBuffer_ != nil)
+    {
+        BindComputeArgumentBuffer(computeEncoder, descriptorSet);
+        return;
+    }
+
     if (segmentation_.hasKernelResources)
     {
         auto heapPtr = heap_.SegmentData(descriptorSet) + heapOffsetKernel_;
@@ -566,11 +597,13 @@ void MTResourceHeap::WriteResourceViewBuffer(const ResourceViewDescriptor& desc,
     MTRESOURCEHEAP_DATA1_OFFSETS(heapPtr)[binding.descriptorIndex] = static_cast<NSUInteger>(desc.bufferView.offset);
 }
 
-void MTResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding, std::uint32_t descriptorSet)
+id<MTLTexture> MTResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding, std::uint32_t descriptorSet)
 {
     /* Get texture resource and Write MTLTexture ID */
     auto textureMT = LLGL_CAST(MTTexture*, GetAsExpectedTexture(desc.resource));
-    MTRESOURCEHEAP_DATA0_MTLTEXTURE(heapPtr)[binding.descriptorIndex] = GetOrCreateTexture(descriptorSet, binding, *textureMT, desc.textureView);
+    id<MTLTexture> texture = GetOrCreateTexture(descriptorSet, binding, *textureMT, desc.textureView);
+    MTRESOURCEHEAP_DATA0_MTLTEXTURE(heapPtr)[binding.descriptorIndex] = texture;
+    return texture;
 }
 
 void MTResourceHeap::WriteResourceViewSamplerState(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding)
@@ -580,6 +613,200 @@ void MTResourceHeap::WriteResourceViewSamplerState(const ResourceViewDescriptor&
     MTRESOURCEHEAP_DATA0_MTLSAMPLERSTATE(heapPtr)[binding.descriptorIndex] = samplerMT->GetNative();
 }
 
+static MTLArgumentAccess GetArgumentAccess(const BindingDescriptor& binding)
+{
+    return ((binding.bindFlags & BindFlags::Storage) != 0 ? MTLArgumentAccessReadWrite : MTLArgumentAccessReadOnly);
+}
+
+void MTResourceHeap::CreateArgumentBuffer(
+    id<MTLDevice>                       device,
+    const ArrayView<BindingDescriptor>& bindings,
+    NSUInteger                          numDescriptorSets,
+    NSUInteger                          argumentBufferSlot)
+{
+    if (bindings.empty() || numDescriptorSets == 0)
+        return;
+
+    /* Describe each heap binding as argument with the binding index as argument index */
+    NSMutableArray<MTLArgumentDescriptor*>* argumentDescs = [[NSMutableArray alloc] initWithCapacity:bindings.size()];
+
+    argumentResourceIndices_.resize(bindings.size(), g_invalidArgumentResourceIndex);
+
+    for_range(i, bindings.size())
+    {
+        const BindingDescriptor& binding = bindings[i];
+
+        MTLArgumentDescriptor* argumentDesc = [MTLArgumentDescriptor argumentDescriptor];
+        argumentDesc.index = i;
+
+        switch (binding.type)
+        {
+            case ResourceType::Buffer:
+                argumentDesc.dataType   = MTLDataTypePointer;
+                argumentDesc.access     = GetArgumentAccess(binding);
+                break;
+            case ResourceType::Texture:
+                /* Tier 2 argument buffers only store the resource ID, so the texture type does not affect the layout */
+                argumentDesc.dataType   = MTLDataTypeTexture;
+                argumentDesc.access     = GetArgumentAccess(binding);
+                break;
+            case ResourceType::Sampler:
+                argumentDesc.dataType   = MTLDataTypeSampler;
+                break;
+            default:
+                continue;
+        }
+
+        [argumentDescs addObject:argumentDesc];
+
+        /* Count resources that must be made resident when the heap is bound */
+        if (binding.type != ResourceType::Sampler)
+        {
+            if ((binding.bindFlags & BindFlags::Storage) != 0)
+                ++numArgumentWriteResources_;
+            else
+                ++numArgumentReadResources_;
+        }
+
+        argumentBufferStages_ |= binding.stageFlags;
+    }
+
+    /* Sort resources into read-only and read-write ranges, so they can be made resident with one call per usage */
+    std::uint32_t readIndex = 0, writeIndex = static_cast<std::uint32_t>(numArgumentReadResources_);
+    for_range(i, bindings.size())
+    {
+        const BindingDescriptor& binding = bindings[i];
+        if (binding.type == ResourceType::Buffer || binding.type == ResourceType::Texture)
+            argumentResourceIndices_[i] = ((binding.bindFlags & BindFlags::Storage) != 0 ? writeIndex++ : readIndex++);
+    }
+
+    /* Create argument encoder and allocate one encoded range per descriptor set */
+    argumentEncoder_        = [device newArgumentEncoderWithArguments:argumentDescs];
+    argumentBufferStride_   = GetAlignedSize<NSUInteger>([argumentEncoder_ encodedLength], [argumentEncoder_ alignment]);
+    argumentBufferSlot_     = argumentBufferSlot;
+    argumentBuffer_         = [device newBufferWithLength:argumentBufferStride_ * numDescriptorSets options:MTLResourceCPUCacheModeWriteCombined];
+
+    [argumentDescs release];
+
+    /* Initialize residency list with the argument buffer itself for descriptors that have not been written yet */
+    argumentResources_.resize((numArgumentReadResources_ + numArgumentWriteResources_) * numDescriptorSets, argumentBuffer_);
+}
+
+void MTResourceHeap::EncodeArgument(
+    std::uint32_t                   descriptorSet,
+    std::uint32_t                   bindingIndex,
+    const ResourceViewDescriptor&   desc,
+    id<MTLTexture>                  textureView)
+{
+    [argumentEncoder_ setArgumentBuffer:argumentBuffer_ offset:argumentBufferStride_ * descriptorSet];
+
+    id<MTLResource> resource = nil;
+
+    switch (desc.resource->GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto bufferMT = LLGL_CAST(MTBuffer*, desc.resource);
+            [argumentEncoder_
+                setBuffer:  bufferMT->GetNative()
+                offset:     static_cast<NSUInteger>(desc.bufferView.offset)
+                atIndex:    bindingIndex
+            ];
+            resource = bufferMT->GetNative();
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            /* Use texture view that has been created for the heap segments or the texture itself */
+            if (textureView == nil)
+                textureView = LLGL_CAST(MTTexture*, desc.resource)->GetNative();
+            [argumentEncoder_ setTexture:textureView atIndex:bindingIndex];
+            resource = textureView;
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto samplerMT = LLGL_CAST(MTSampler*, desc.resource);
+            [argumentEncoder_ setSamplerState:samplerMT->GetNative() atIndex:bindingIndex];
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    /* Store resource for residency when the heap is bound */
+    const std::uint32_t resourceIndex = argumentResourceIndices_[bindingIndex];
+    if (resource != nil && resourceIndex != g_invalidArgumentResourceIndex)
+    {
+        const NSUInteger numResourcesPerSet = numArgumentReadResources_ + numArgumentWriteResources_;
+        argumentResources_[descriptorSet * numResourcesPerSet + resourceIndex] = resource;
+    }
+}
+
+void MTResourceHeap::BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet)
+{
+    const NSUInteger offset = argumentBufferStride_ * descriptorSet;
+
+    /* Bind argument buffer to all affected shader stages */
+    MTLRenderStages stages = 0;
+    if ((argumentBufferStages_ & g_vertexStages) != 0)
+    {
+        [renderEncoder setVertexBuffer:argumentBuffer_ offset:offset atIndex:argumentBufferSlot_];
+        stages |= MTLRenderStageVertex;
+    }
+    if ((argumentBufferStages_ & g_fragmentStages) != 0)
+    {
+        [renderEncoder setFragmentBuffer:argumentBuffer_ offset:offset atIndex:argumentBufferSlot_];
+        stages |= MTLRenderStageFragment;
+    }
+
+    /* Make all resources resident that are referenced by the argument buffer */
+    const NSUInteger numResourcesPerSet = numArgumentReadResources_ + numArgumentWriteResources_;
+    if (stages == 0 || numResourcesPerSet == 0)
+        return;
+
+    const id<MTLResource>* resources = &argumentResources_[descriptorSet * numResourcesPerSet];
+
+    if (@available(macOS 10.15, iOS 13.0, *))
+    {
+        if (numArgumentReadResources_ > 0)
+            [renderEncoder useResources:resources count:numArgumentReadResources_ usage:MTLResourceUsageRead stages:stages];
+        if (numArgumentWriteResources_ > 0)
+            [renderEncoder useResources:resources + numArgumentReadResources_ count:numArgumentWriteResources_ usage:(MTLResourceUsageRead | MTLResourceUsageWrite) stages:stages];
+    }
+    else
+    {
+        if (numArgumentReadResources_ > 0)
+            [renderEncoder useResources:resources count:numArgumentReadResources_ usage:MTLResourceUsageRead];
+        if (numArgumentWriteResources_ > 0)
+            [renderEncoder useResources:resources + numArgumentReadResources_ count:numArgumentWriteResources_ usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+    }
+}
+
+void MTResourceHeap::BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet)
+{
+    if ((argumentBufferStages_ & g_kernelStages) == 0)
+        return;
+
+    /* Bind argument buffer to kernel stage */
+    [computeEncoder setBuffer:argumentBuffer_ offset:argumentBufferStride_ * descriptorSet atIndex:argumentBufferSlot_];
+
+    /* Make all resources resident that are referenced by the argument buffer */
+    const NSUInteger numResourcesPerSet = numArgumentReadResources_ + numArgumentWriteResources_;
+    if (numResourcesPerSet == 0)
+        return;
+
+    const id<MTLResource>* resources = &argumentResources_[descriptorSet * numResourcesPerSet];
+
+    if (numArgumentReadResources_ > 0)
+        [computeEncoder useResources:resources count:numArgumentReadResources_ usage:MTLResourceUsageRead];
+    if (numArgumentWriteResources_ > 0)
+        [computeEncoder useResources:resources + numArgumentReadResources_ count:numArgumentWriteResources_ usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+}
+
 [[noreturn]]
 static void ErrTextureViewSwizzleNotSupported()
 {
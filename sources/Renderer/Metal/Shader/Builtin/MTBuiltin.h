@@ -15,6 +15,8 @@
 extern const char*          g_metalLibFillBufferByte4;
 extern const std::size_t    g_metalLibFillBufferByte4Len;
 
+extern const char*          g_metalSrcEncodeIndirectDraws;
+
 
 #endif
 
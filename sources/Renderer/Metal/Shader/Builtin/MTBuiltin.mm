@@ -31,6 +31,112 @@ const std::size_t g_metalLibFillBufferByte4Len =
     #endif
 );
 
+/*
+Encoding indirect command buffers requires Metal shading language 2.1 while the precompiled builtin libraries target 1.1,
+so these kernels are compiled from source at runtime, and only on devices that support indirect command buffers.
+*/
+const char* g_metalSrcEncodeIndirectDraws = R"(
+#include <metal_stdlib>
+
+using namespace metal;
+
+struct DrawParams
+{
+    uint primitiveType;
+    uint firstCommand;
+    uint maxNumCommands;
+    uint stride; // Stride between argument sets in 32-bit words
+};
+
+struct DrawIndirectArguments
+{
+    uint numVertices;
+    uint numInstances;
+    uint firstVertex;
+    uint firstInstance;
+};
+
+struct DrawIndexedIndirectArguments
+{
+    uint numIndices;
+    uint numInstances;
+    uint firstIndex;
+    int  vertexOffset;
+    uint firstInstance;
+};
+
+struct IndirectCommands
+{
+    command_buffer commands [[id(0)]];
+};
+
+kernel void EncodeDraws(
+    device const uint*          arguments   [[buffer(0)]],
+    device const uint*          count       [[buffer(1)]],
+    constant DrawParams&        params      [[buffer(2)]],
+    device IndirectCommands&    icb         [[buffer(3)]],
+    uint                        threadID    [[thread_position_in_grid]])
+{
+    if (threadID >= params.maxNumCommands)
+        return;
+
+    render_command cmd(icb.commands, params.firstCommand + threadID);
+
+    if (threadID < count[0])
+    {
+        device const DrawIndirectArguments& args = *(device const DrawIndirectArguments*)(arguments + threadID * params.stride);
+        cmd.draw_primitives(primitive_type(params.primitiveType), args.firstVertex, args.numVertices, args.numInstances, args.firstInstance);
+    }
+    else
+        cmd.reset();
+}
+
+template <typename TIndex>
+void EncodeIndexedDraw(
+    device const uint*          arguments,
+    device const uint*          count,
+    constant DrawParams&        params,
+    device IndirectCommands&    icb,
+    device const TIndex*        indices,
+    uint                        threadID)
+{
+    if (threadID >= params.maxNumCommands)
+        return;
+
+    render_command cmd(icb.commands, params.firstCommand + threadID);
+
+    if (threadID < count[0])
+    {
+        device const DrawIndexedIndirectArguments& args = *(device const DrawIndexedIndirectArguments*)(arguments + threadID * params.stride);
+        cmd.draw_indexed_primitives(primitive_type(params.primitiveType), args.numIndices, indices + args.firstIndex, args.numInstances, args.vertexOffset, args.firstInstance);
+    }
+    else
+        cmd.reset();
+}
+
+kernel void EncodeIndexedDraws16(
+    device const uint*          arguments   [[buffer(0)]],
+    device const uint*          count       [[buffer(1)]],
+    constant DrawParams&        params      [[buffer(2)]],
+    device IndirectCommands&    icb         [[buffer(3)]],
+    device const ushort*        indices     [[buffer(4)]],
+    uint                        threadID    [[thread_position_in_grid]])
+{
+    EncodeIndexedDraw<ushort>(arguments, count, params, icb, indices, threadID);
+}
+
+kernel void EncodeIndexedDraws32(
+    device const uint*          arguments   [[buffer(0)]],
+    device const uint*          count       [[buffer(1)]],
+    constant DrawParams&        params      [[buffer(2)]],
+    device IndirectCommands&    icb         [[buffer(3)]],
+    device const uint*          indices     [[buffer(4)]],
+    uint                        threadID    [[thread_position_in_grid]])
+{
+    EncodeIndexedDraw<uint>(arguments, count, params, icb, indices, threadID);
+}
+)";
+
 
 
 // ================================================================================
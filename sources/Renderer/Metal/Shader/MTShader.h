@@ -13,6 +13,10 @@
 
 #include <LLGL/Shader.h>
 #include <LLGL/Report.h>
+#include "MTShaderLibraryCache.h"
+#include <mutex>
+#include <string>
+#include <vector>
 
 
 namespace LLGL
@@ -28,7 +32,7 @@ class MTShader final : public Shader
 
     public:
 
-        MTShader(id<MTLDevice> device, const ShaderDescriptor& desc);
+        MTShader(id<MTLDevice> device, const ShaderDescriptor& desc, MTShaderLibraryCache* libraryCache = nullptr);
         ~MTShader();
 
     public:
@@ -42,17 +46,11 @@ class MTShader final : public Shader
         // Returns the number of patch control points for a post-tessellation vertex shader or 0 if this is not a vertex shader.
         NSUInteger GetNumPatchControlPoints() const;
 
-        // Returns the native MTLFunction object.
-        inline id<MTLFunction> GetNative() const
-        {
-            return native_;
-        }
+        // Returns the native MTLFunction object. Blocks until the shader library has been compiled.
+        id<MTLFunction> GetNative() const;
 
-        // Returns the MTLVertexDescriptor object for this shader program.
-        inline MTLVertexDescriptor* GetMTLVertexDesc() const
-        {
-            return vertexDesc_;
-        }
+        // Returns the MTLVertexDescriptor object for this shader program. Blocks until the shader library has been compiled.
+        MTLVertexDescriptor* GetMTLVertexDesc() const;
 
         // Returns the number of threads per thread-group for compute kernels.
         inline const MTLSize& GetNumThreadsPerGroup() const
@@ -62,8 +60,8 @@ class MTShader final : public Shader
 
     private:
 
-        bool Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
-        bool CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
+        bool Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTShaderLibraryCache* libraryCache);
+        bool CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTShaderLibraryCache* libraryCache);
         bool CompileFromLibraryWithData(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
         bool CompileFromDefaultLibrary(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
 
@@ -71,6 +69,10 @@ class MTShader final : public Shader
 
         bool LoadShaderFunction(const char* entryPoint, NSError* error = nullptr);
 
+        // Waits for the pending shader library and loads the shader function from it. Only the first call has an effect.
+        void WaitForPendingLibrary() const;
+        void LoadFunctionFromPendingLibrary();
+
         bool ReflectComputePipeline(ShaderReflection& reflection) const;
 
     private:
@@ -84,6 +86,12 @@ class MTShader final : public Shader
 
         MTLVertexDescriptor*    vertexDesc_         = nullptr;
 
+        /* Shared library that is still being compiled asynchronously, and the parameters to finish this shader with once it is available */
+        MTShaderLibrarySPtr             pendingLibrary_;
+        std::string                     pendingEntryPoint_;
+        std::vector<VertexAttribute>    pendingVertexAttribs_;
+        mutable std::once_flag          pendingLibraryFlag_;
+
 };
 
 
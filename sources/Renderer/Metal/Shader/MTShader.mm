@@ -12,23 +12,27 @@
 #include <LLGL/Utils/ForRange.h>
 #include <cstring>
 #include <set>
+#include <string>
 
 
 namespace LLGL
 {
 
 
-MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc) :
+MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc, MTShaderLibraryCache* libraryCache) :
     Shader  { desc.type },
     device_ { device    }
 {
-    if (Compile(device, desc))
+    if (Compile(device, desc, libraryCache))
     {
-        /* Build vertex input layout */
-        BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
+        /* Build vertex input layout; this depends on the patch type of the shader function, so it must wait for a pending library */
+        if (pendingLibrary_)
+            pendingVertexAttribs_.assign(desc.vertex.inputAttribs.begin(), desc.vertex.inputAttribs.end());
+        else
+            BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
 
-        /* Store work group size for compute shaders */
-        if (desc.type == ShaderType::Compute)
+        /* Store work group size for compute shaders and object/mesh functions */
+        if (desc.type == ShaderType::Compute || desc.type == ShaderType::Task || desc.type == ShaderType::Mesh)
         {
             const auto& workGroupSize = desc.compute.workGroupSize;
             numThreadsPerGroup_ = MTLSizeMake(workGroupSize.width, workGroupSize.height, workGroupSize.depth);
@@ -76,11 +80,13 @@ static MTLLanguageVersion GetMTLLanguageVersion(const ShaderDescriptor& desc)
 
 const Report* MTShader::GetReport() const
 {
+    WaitForPendingLibrary();
     return (report_ ? &report_ : nullptr);
 }
 
 bool MTShader::Reflect(ShaderReflection& reflection) const
 {
+    WaitForPendingLibrary();
     if (GetType() == ShaderType::Compute)
         return ReflectComputePipeline(reflection);
     else
@@ -89,6 +95,7 @@ bool MTShader::Reflect(ShaderReflection& reflection) const
 
 bool MTShader::IsPostTessellationVertex() const
 {
+    WaitForPendingLibrary();
     return (GetType() == ShaderType::Vertex && native_ != nil && [native_ patchType] != MTLPatchTypeNone);
 }
 
@@ -100,17 +107,29 @@ NSUInteger MTShader::GetNumPatchControlPoints() const
         return 0;
 }
 
+id<MTLFunction> MTShader::GetNative() const
+{
+    WaitForPendingLibrary();
+    return native_;
+}
+
+MTLVertexDescriptor* MTShader::GetMTLVertexDesc() const
+{
+    WaitForPendingLibrary();
+    return vertexDesc_;
+}
+
 
 /*
  * ======= Private: =======
  */
 
-bool MTShader::Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc)
+bool MTShader::Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTShaderLibraryCache* libraryCache)
 {
     if ((shaderDesc.flags & ShaderCompileFlags::DefaultLibrary) != 0)
         return CompileFromDefaultLibrary(device, shaderDesc);
     else if (IsShaderSourceCode(shaderDesc.sourceType))
-        return CompileFromLibraryWithSource(device, shaderDesc);
+        return CompileFromLibraryWithSource(device, shaderDesc, libraryCache);
     else
         return CompileFromLibraryWithData(device, shaderDesc);
 }
@@ -153,7 +172,31 @@ bool MTShader::CompileFromDefaultLibrary(id<MTLDevice> device, const ShaderDescr
     return LoadShaderFunction(shaderDesc.entryPoint);
 }
 
-bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc)
+// Returns the key to deduplicate shader libraries with identical source and compile options.
+static std::string GetLibraryCacheKey(NSString* source, const ShaderDescriptor& shaderDesc)
+{
+    std::string key = [source UTF8String];
+
+    key += '\0';
+    key += (shaderDesc.profile != nullptr ? shaderDesc.profile : "");
+    key += '\0';
+    key += std::to_string(shaderDesc.flags);
+
+    if (shaderDesc.defines != nullptr)
+    {
+        for (const ShaderMacro* defines = shaderDesc.defines; defines->name != nullptr; ++defines)
+        {
+            key += '\0';
+            key += defines->name;
+            key += '=';
+            key += (defines->definition != nullptr ? defines->definition : "1");
+        }
+    }
+
+    return key;
+}
+
+bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTShaderLibraryCache* libraryCache)
 {
     /* Get source */
     NSString* sourceString = nil;
@@ -176,26 +219,26 @@ bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDe
         return false;
     }
 
-    /* Convert entry point to NSString, and initialize shader compile options */
+    /* Initialize shader compile options */
     MTLCompileOptions* opt = ToMTLCompileOptions(shaderDesc);
 
-    /* Load shader library */
-    NSError* error = [NSError alloc];
-
-    library_ = [device
-        newLibraryWithSource:   sourceString
-        options:                opt
-        error:                  &error
-    ];
+    /*
+    Compile shader library asynchronously on Metal's own compiler threads, so multiple shaders can be compiled in parallel.
+    Shaders with identical source and compile options share the same library.
+    */
+    if (libraryCache != nullptr)
+        pendingLibrary_ = libraryCache->GetOrCompileLibrary(device, sourceString, opt, GetLibraryCacheKey(sourceString, shaderDesc));
+    else
+    {
+        pendingLibrary_ = std::make_shared<MTShaderLibrary>();
+        pendingLibrary_->CompileAsync(device, sourceString, opt);
+    }
+    pendingEntryPoint_ = (shaderDesc.entryPoint != nullptr ? shaderDesc.entryPoint : "");
 
     [sourceString release];
     [opt release];
 
-    /* Load shader function with entry point */
-    const bool success = LoadShaderFunction(shaderDesc.entryPoint, error);
-    [error release];
-
-    return success;
+    return true;
 }
 
 //TODO: this is untested!!!
@@ -323,6 +366,33 @@ bool MTShader::LoadShaderFunction(const char* entryPoint, NSError* error)
     return result;
 }
 
+void MTShader::WaitForPendingLibrary() const
+{
+    if (pendingLibrary_)
+        std::call_once(pendingLibraryFlag_, [this]() { const_cast<MTShader*>(this)->LoadFunctionFromPendingLibrary(); });
+}
+
+void MTShader::LoadFunctionFromPendingLibrary()
+{
+    /* Wait for asynchronous compilation and retain library for this shader */
+    if (id<MTLLibrary> library = pendingLibrary_->WaitForLibrary())
+        library_ = [library retain];
+
+    const bool result = LoadShaderFunction(pendingEntryPoint_.c_str());
+
+    /* Post report with compiler output */
+    const std::string& log = pendingLibrary_->GetLog();
+    if (!log.empty())
+        report_.Reset(StringView{ log }, !result);
+    else if (!result)
+        report_.Errorf("failed to load Metal shader function: %s\n", pendingEntryPoint_.c_str());
+
+    if (result)
+        BuildInputLayout(pendingVertexAttribs_.size(), pendingVertexAttribs_.data());
+
+    pendingVertexAttribs_.clear();
+}
+
 static ResourceType ToResourceType(MTLArgumentType type)
 {
     switch (type)
@@ -0,0 +1,98 @@
+/*
+ * MTShaderLibraryCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_SHADER_LIBRARY_CACHE_H
+#define LLGL_MT_SHADER_LIBRARY_CACHE_H
+
+
+#import <Metal/Metal.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+Shader library that is compiled asynchronously from Metal shading language source.
+The library is shared between all shaders that are created with the same source and compile options.
+*/
+class MTShaderLibrary
+{
+
+    public:
+
+        MTShaderLibrary();
+        ~MTShaderLibrary();
+
+        MTShaderLibrary(const MTShaderLibrary&) = delete;
+        MTShaderLibrary& operator = (const MTShaderLibrary&) = delete;
+
+        // Starts the asynchronous compilation of the specified source on Metal's own compiler threads.
+        void CompileAsync(id<MTLDevice> device, NSString* source, MTLCompileOptions* options);
+
+        // Blocks until the compilation has completed and returns the library, or nil if the compilation failed.
+        id<MTLLibrary> WaitForLibrary() const;
+
+        // Returns the compiler output. This is only valid after WaitForLibrary has returned.
+        inline const std::string& GetLog() const
+        {
+            return log_;
+        }
+
+    private:
+
+        dispatch_group_t    group_      = nil;
+        id<MTLLibrary>      library_    = nil;
+        std::string         log_;
+
+};
+
+using MTShaderLibrarySPtr = std::shared_ptr<MTShaderLibrary>;
+
+/*
+Cache of asynchronously compiled shader libraries to deduplicate identical Metal shading language sources.
+Libraries are only kept alive by the shaders that refer to them.
+*/
+class MTShaderLibraryCache
+{
+
+    public:
+
+        MTShaderLibraryCache() = default;
+
+        MTShaderLibraryCache(const MTShaderLibraryCache&) = delete;
+        MTShaderLibraryCache& operator = (const MTShaderLibraryCache&) = delete;
+
+        // Returns the shared library for the specified source and compile options, and starts its compilation if there is no such library yet.
+        MTShaderLibrarySPtr GetOrCompileLibrary(
+            id<MTLDevice>       device,
+            NSString*           source,
+            MTLCompileOptions*  options,
+            const std::string&  key
+        );
+
+    private:
+
+        std::mutex                                              mutex_;
+        std::map<std::string, std::weak_ptr<MTShaderLibrary>>   libraries_; // Keyed by source and compile options
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
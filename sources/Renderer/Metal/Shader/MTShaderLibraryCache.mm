@@ -0,0 +1,94 @@
+/*
+ * MTShaderLibraryCache.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTShaderLibraryCache.h"
+
+
+namespace LLGL
+{
+
+
+/*
+ * MTShaderLibrary class
+ */
+
+MTShaderLibrary::MTShaderLibrary() :
+    group_ { dispatch_group_create() }
+{
+}
+
+MTShaderLibrary::~MTShaderLibrary()
+{
+    /* Completion handler refers to this object, so wait until it has finished */
+    dispatch_group_wait(group_, DISPATCH_TIME_FOREVER);
+    dispatch_release(group_);
+    if (library_)
+        [library_ release];
+}
+
+void MTShaderLibrary::CompileAsync(id<MTLDevice> device, NSString* source, MTLCompileOptions* options)
+{
+    dispatch_group_enter(group_);
+    [device
+        newLibraryWithSource:   source
+        options:                options
+        completionHandler:      ^(id<MTLLibrary> library, NSError* error)
+        {
+            /* Library is only valid for the duration of this handler unless it is retained */
+            library_ = [library retain];
+            if (error != nil)
+                log_ = [[error localizedDescription] UTF8String];
+            dispatch_group_leave(group_);
+        }
+    ];
+}
+
+id<MTLLibrary> MTShaderLibrary::WaitForLibrary() const
+{
+    dispatch_group_wait(group_, DISPATCH_TIME_FOREVER);
+    return library_;
+}
+
+
+/*
+ * MTShaderLibraryCache class
+ */
+
+MTShaderLibrarySPtr MTShaderLibraryCache::GetOrCompileLibrary(
+    id<MTLDevice>       device,
+    NSString*           source,
+    MTLCompileOptions*  options,
+    const std::string&  key)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Share library with other shaders of the same source that are still alive */
+    std::weak_ptr<MTShaderLibrary>& entry = libraries_[key];
+    if (MTShaderLibrarySPtr library = entry.lock())
+        return library;
+
+    /* Remove all other expired entries before a new library is added */
+    for (auto it = libraries_.begin(); it != libraries_.end();)
+    {
+        if (it->second.expired() && it->first != key)
+            it = libraries_.erase(it);
+        else
+            ++it;
+    }
+
+    MTShaderLibrarySPtr library = std::make_shared<MTShaderLibrary>();
+    library->CompileAsync(device, source, options);
+    libraries_[key] = library;
+    return library;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
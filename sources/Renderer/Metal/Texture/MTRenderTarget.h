@@ -44,6 +44,12 @@ class MTRenderTarget final : public RenderTarget
             const ClearValue*   clearValues
         );
 
+        // Returns the bitmask of views for multiview rendering or 0 if multiview is disabled.
+        inline std::uint32_t GetViewMask() const
+        {
+            return renderPass_.GetViewMask();
+        }
+
         // Returns the native render pass descriptor <MTLRenderPassDescriptor>.
         inline MTLRenderPassDescriptor* GetNativeRenderPass() const
         {
@@ -67,9 +73,18 @@ class MTRenderTarget final : public RenderTarget
             NSUInteger      sampleCount = 1u
         );
 
-        id<MTLTexture> CreateAttachmentTexture(id<MTLDevice> device, MTLPixelFormat pixelFormat);
+        id<MTLTexture> CreateAttachmentTexture(id<MTLDevice> device, MTLPixelFormat pixelFormat, bool isMemoryless = false);
         id<MTLTexture> CreateAttachmentTextureView(id<MTLTexture> sourceTexture, MTLPixelFormat pixelFormat);
 
+        // Creates a 2D array texture view of the consecutive array layers that are rendered with multiview.
+        id<MTLTexture> CreateMultiviewTextureView(
+            id<MTLTexture>  sourceTexture,
+            MTLPixelFormat  pixelFormat,
+            NSUInteger      mipLevel,
+            NSUInteger      arrayLayer,
+            NSUInteger      numViews
+        );
+
     private:
 
         Extent2D                        resolution_;
@@ -11,6 +11,7 @@
 #include "../MTDevice.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
@@ -104,6 +105,10 @@ MTRenderTarget::MTRenderTarget(id<MTLDevice> device, const RenderTargetDescripto
         else
             LLGL_TRAP("invalid format for render-target depth-stencil attachment: %s", ToString(format));
     }
+
+    /* Enable layered rendering for multiview; each attachment is a texture view of only the layers that are rendered */
+    if (const std::uint32_t viewMask = renderPass_.GetViewMask())
+        nativeRenderPass_.renderTargetArrayLength = NumRenderPassViews(viewMask);
 }
 
 MTRenderTarget::~MTRenderTarget()
@@ -177,7 +182,16 @@ void MTRenderTarget::CreateAttachment(
         auto& textureMT = LLGL_CAST(MTTexture&, *texture);
         id<MTLTexture> tex = textureMT.GetNative();
 
-        if (inAttachment.format != Format::Undefined)
+        if (const std::uint32_t viewMask = renderPass_.GetViewMask())
+        {
+            /*
+            Create 2D array texture view of all rendered layers for multiview,
+            since the layer offsets of vertex amplification are relative to the first slice
+            */
+            const MTLPixelFormat pixelFormat = (inAttachment.format != Format::Undefined ? MTTypes::ToMTLPixelFormat(inAttachment.format) : tex.pixelFormat);
+            outAttachment.texture = CreateMultiviewTextureView(tex, pixelFormat, inAttachment.mipLevel, inAttachment.arrayLayer, NumRenderPassViews(viewMask));
+        }
+        else if (inAttachment.format != Format::Undefined)
         {
             /* Create texture view with format */
             const MTLPixelFormat pixelFormat = MTTypes::ToMTLPixelFormat(inAttachment.format);
@@ -191,9 +205,10 @@ void MTRenderTarget::CreateAttachment(
     }
     else
     {
-        /* Create internal texture for attachment */
+        /* Create internal texture for attachment; keep it in tile memory only if the render pass discards its content anyway */
         const MTLPixelFormat pixelFormat = MTTypes::ToMTLPixelFormat(inAttachment.format);
-        outAttachment.texture = CreateAttachmentTexture(device, pixelFormat);
+        const bool isMemoryless = (fmt.storeAction == MTLStoreActionDontCare && fmt.loadAction != MTLLoadActionLoad);
+        outAttachment.texture = CreateAttachmentTexture(device, pixelFormat, isMemoryless);
     }
 
     /* Add optional resolve attachment if a texture is specified */
@@ -221,10 +236,25 @@ void MTRenderTarget::CreateAttachment(
     /* Store remaining attachment parameters */
     outAttachment.level        = inAttachment.mipLevel;
     outAttachment.slice        = inAttachment.arrayLayer;
+
+    if (renderPass_.GetViewMask() != 0 && inAttachment.texture != nullptr)
+    {
+        /* Multiview texture views already start at the specified MIP-map level and array layer */
+        outAttachment.level    = 0;
+        outAttachment.slice    = 0;
+    }
+
     outAttachment.loadAction   = fmt.loadAction;
     outAttachment.storeAction  = fmt.storeAction;
 
-    if (outAttachment.storeAction == MTLStoreActionStore && outAttachment.resolveTexture != nil)
+    if (MTTexture::IsMemoryless(outAttachment.texture))
+    {
+        /* Memoryless attachments can neither be loaded nor stored, only resolved */
+        if (outAttachment.loadAction == MTLLoadActionLoad)
+            outAttachment.loadAction = MTLLoadActionDontCare;
+        outAttachment.storeAction = (outAttachment.resolveTexture != nil ? MTLStoreActionMultisampleResolve : MTLStoreActionDontCare);
+    }
+    else if (outAttachment.storeAction == MTLStoreActionStore && outAttachment.resolveTexture != nil)
         outAttachment.storeAction = MTLStoreActionStoreAndMultisampleResolve;
 }
 
@@ -247,10 +277,16 @@ MTLTextureDescriptor* MTRenderTarget::CreateTextureDesc(
     return texDesc;
 }
 
-id<MTLTexture> MTRenderTarget::CreateAttachmentTexture(id<MTLDevice> device, MTLPixelFormat pixelFormat)
+id<MTLTexture> MTRenderTarget::CreateAttachmentTexture(id<MTLDevice> device, MTLPixelFormat pixelFormat, bool isMemoryless)
 {
     MTLTextureDescriptor* texDesc = CreateTextureDesc(device, pixelFormat, renderPass_.GetSampleCount());
 
+    if (isMemoryless && MTDevice::SupportsMemorylessStorage(device))
+    {
+        if (@available(macOS 11.0, iOS 10.0, *))
+            texDesc.storageMode = MTLStorageModeMemoryless;
+    }
+
     id<MTLTexture> newTexture = [device newTextureWithDescriptor:texDesc];
     internalTextures_.push_back(newTexture);
     [texDesc release];
@@ -265,6 +301,23 @@ id<MTLTexture> MTRenderTarget::CreateAttachmentTextureView(id<MTLTexture> source
     return newTextureView;
 }
 
+id<MTLTexture> MTRenderTarget::CreateMultiviewTextureView(
+    id<MTLTexture>  sourceTexture,
+    MTLPixelFormat  pixelFormat,
+    NSUInteger      mipLevel,
+    NSUInteger      arrayLayer,
+    NSUInteger      numViews)
+{
+    id<MTLTexture> newTextureView = [sourceTexture
+        newTextureViewWithPixelFormat:  pixelFormat
+        textureType:                    MTLTextureType2DArray
+        levels:                         NSMakeRange(mipLevel, 1)
+        slices:                         NSMakeRange(arrayLayer, numViews)
+    ];
+    internalTextures_.push_back(newTextureView);
+    return newTextureView;
+}
+
 
 } // /namespace LLGL
 
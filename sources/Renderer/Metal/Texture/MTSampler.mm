@@ -16,8 +16,8 @@ namespace LLGL
 {
 
 
-MTSampler::MTSampler(id<MTLDevice> device, const SamplerDescriptor& desc) :
-    native_ { MTSampler::CreateNative(device, desc) }
+MTSampler::MTSampler(id<MTLDevice> device, const SamplerDescriptor& desc, bool supportArgumentBuffers) :
+    native_ { MTSampler::CreateNative(device, desc, supportArgumentBuffers) }
 {
 }
 
@@ -59,10 +59,15 @@ void MTSampler::ConvertDesc(MTLSamplerDescriptor* dst, const SamplerDescriptor&
     #endif // /LLGL_OS_IOS
 }
 
-id<MTLSamplerState> MTSampler::CreateNative(id<MTLDevice> device, const SamplerDescriptor& desc)
+id<MTLSamplerState> MTSampler::CreateNative(id<MTLDevice> device, const SamplerDescriptor& desc, bool supportArgumentBuffers)
 {
     MTLSamplerDescriptor* samplerStateDesc = [[MTLSamplerDescriptor alloc] init];
     MTSampler::ConvertDesc(samplerStateDesc, desc);
+    if (supportArgumentBuffers)
+    {
+        if (@available(macOS 10.13, iOS 11.0, *))
+            samplerStateDesc.supportArgumentBuffers = YES;
+    }
     id<MTLSamplerState> samplerState = [device newSamplerStateWithDescriptor:samplerStateDesc];
     [samplerStateDesc release];
     return samplerState;
@@ -23,6 +23,7 @@ struct MutableImageView;
 struct SubresourceCPUMappingLayout;
 struct FormatAttributes;
 class MTIntermediateBuffer;
+class MTTransientHeapPool;
 
 class MTTexture final : public Texture
 {
@@ -33,7 +34,18 @@ class MTTexture final : public Texture
 
     public:
 
-        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc);
+        bool GetSparseProperties(SparseTextureProperties& outProperties) const override;
+
+    public:
+
+        // Creates the texture in the transient heap pool if MiscFlags::Transient is specified and the pool is not null,
+        // in the sparse heap if MiscFlags::Sparse is specified and the heap is not nil; otherwise, creates it from the device.
+        MTTexture(
+            id<MTLDevice>               device,
+            const TextureDescriptor&    desc,
+            MTTransientHeapPool*        transientHeapPool   = nullptr,
+            id<MTLHeap>                 sparseHeap          = nil
+        );
         ~MTTexture();
 
         // Returns the region for the specified subresource.
@@ -50,6 +62,9 @@ class MTTexture final : public Texture
             MTIntermediateBuffer*   intermediateBuffer  = nullptr
         );
 
+        // Encodes the tile mapping for the specified region of this sparse texture.
+        void EncodeTileMapping(id<MTLResourceStateCommandEncoder> encoder, const SparseTextureMapping& mapping) API_AVAILABLE(macos(11.0), ios(13.0));
+
         // Creats a new MTLTexture object as subresource view from this texture.
         id<MTLTexture> CreateSubresourceView(const TextureSubresource& subresource);
 
@@ -62,6 +77,35 @@ class MTTexture final : public Texture
             return native_;
         }
 
+        // Returns true if this texture is placed in a heap that is aliased with other transient textures.
+        inline bool IsTransient() const
+        {
+            return (aliasingHeap_ != nil);
+        }
+
+        // Returns the aliasing group this texture was created with. Only used for transient textures.
+        inline std::uint32_t GetAliasingGroup() const
+        {
+            return aliasingGroup_;
+        }
+
+        // Returns true if this texture is placed in a sparse heap and its tiles are mapped on demand.
+        inline bool IsSparse() const
+        {
+            return (sparseHeap_ != nil);
+        }
+
+        // Returns true if this texture only lives in tile memory, i.e. it was created with MTLStorageModeMemoryless.
+        inline bool IsMemoryless() const
+        {
+            return MTTexture::IsMemoryless(native_);
+        }
+
+    public:
+
+        // Returns true if the specified native texture was created with MTLStorageModeMemoryless. Its content cannot be loaded or stored by a render pass.
+        static bool IsMemoryless(id<MTLTexture> texture);
+
     private:
 
         void ReadRegionFromSharedMemory(
@@ -84,7 +128,10 @@ class MTTexture final : public Texture
 
     private:
 
-        id<MTLTexture> native_ = nil;
+        id<MTLTexture>  native_         = nil;
+        id<MTLHeap>     aliasingHeap_   = nil; // Must be released after the native texture.
+        std::uint32_t   aliasingGroup_  = 0;
+        id<MTLHeap>     sparseHeap_     = nil; // Must be released after the native texture.
 
 };
 
@@ -6,10 +6,12 @@
  */
 
 #include "MTTexture.h"
+#include "MTTransientHeapPool.h"
 #include "../MTTypes.h"
 #include "../MTDevice.h"
 #include "../Buffer/MTIntermediateBuffer.h"
 #include "../../TextureUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/ImageFlags.h>
 #include <LLGL/Utils/ForRange.h>
@@ -42,13 +44,25 @@ static MTLTextureUsage GetTextureUsage(const TextureDescriptor& desc)
     return usage;
 }
 
-static MTLResourceOptions GetResourceOptions(const TextureDescriptor& desc)
+static MTLResourceOptions GetResourceOptions(id<MTLDevice> device, const TextureDescriptor& desc)
 {
     MTLResourceOptions opt = 0;
 
     if (IsDepthOrStencilFormat(desc.format))
         opt |= MTLResourceStorageModePrivate;
     #ifndef LLGL_OS_IOS
+    else if (MTDevice::HasUnifiedMemory(device))
+    {
+        /*
+        With unified memory, textures that are only written by the CPU are shared, so replaceRegion and getBytes access them directly.
+        Attachments and storage textures are written by the GPU and keep managed storage.
+        */
+        constexpr long gpuWriteBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment | BindFlags::Storage);
+        if ((desc.bindFlags & gpuWriteBindFlags) == 0)
+            opt |= MTLResourceStorageModeShared;
+        else
+            opt |= MTLResourceStorageModeManaged;
+    }
     else
         opt |= MTLResourceStorageModeManaged;
     #endif // /LLGL_OS_IOS
@@ -83,23 +97,92 @@ static void ConvertTextureDesc(id<MTLDevice> device, MTLTextureDescriptor* dst,
     dst.sampleCount         = (IsMultiSampleTexture(src.type) ? MTDevice::FindSuitableSampleCount(device, static_cast<NSUInteger>(src.samples)) : 1u);
     dst.arrayLength         = GetTextureLayers(src);
     dst.usage               = GetTextureUsage(src);
-    dst.resourceOptions     = GetResourceOptions(src);
+    dst.resourceOptions     = GetResourceOptions(device, src);
     if (IsMultiSampleTexture(src.type) || IsDepthOrStencilFormat(src.format))
         dst.storageMode = MTLStorageModePrivate;
 }
 
-MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc) :
+// Returns true if the specified texture descriptor can be placed into a transient heap.
+static bool IsTransientTextureDesc(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Transient) != 0 &&
+        (desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0
+    );
+}
+
+// Returns true if the specified texture descriptor only describes an attachment that can be kept in tile memory.
+static bool IsMemorylessTextureDesc(const TextureDescriptor& desc)
+{
+    constexpr long attachmentBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment);
+    return
+    (
+        (desc.miscFlags & MiscFlags::Memoryless) != 0 &&
+        (desc.bindFlags & attachmentBindFlags) != 0 &&
+        (desc.bindFlags & ~attachmentBindFlags) == 0
+    );
+}
+
+// Returns true if the specified texture descriptor can be placed into a sparse heap.
+static bool IsSparseTextureDesc(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Sparse) != 0 &&
+        (desc.type == TextureType::Texture2D || desc.type == TextureType::Texture2DArray || desc.type == TextureType::Texture3D)
+    );
+}
+
+MTTexture::MTTexture(
+    id<MTLDevice>               device,
+    const TextureDescriptor&    desc,
+    MTTransientHeapPool*        transientHeapPool,
+    id<MTLHeap>                 sparseHeap)
+:
     Texture { desc.type, desc.bindFlags }
 {
     MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
     ConvertTextureDesc(device, texDesc, desc);
-    native_ = [device newTextureWithDescriptor:texDesc];
+
+    if (IsMemorylessTextureDesc(desc) && MTDevice::SupportsMemorylessStorage(device))
+    {
+        /* Keep attachment in tile memory only; memoryless textures cannot be placed into heaps */
+        if (@available(macOS 11.0, iOS 10.0, *))
+            texDesc.storageMode = MTLStorageModeMemoryless;
+    }
+    else if (sparseHeap != nil && IsSparseTextureDesc(desc))
+    {
+        /* Sparse textures are only accessed by the GPU; tiles are mapped with MTLResourceStateCommandEncoder */
+        texDesc.storageMode = MTLStorageModePrivate;
+        sparseHeap_         = [sparseHeap retain];
+        native_             = [sparseHeap_ newTextureWithDescriptor:texDesc];
+    }
+    else if (transientHeapPool != nullptr && IsTransientTextureDesc(desc))
+    {
+        /* Heaps only support private and shared storage; transient attachments are only accessed by the GPU */
+        texDesc.storageMode = MTLStorageModePrivate;
+
+        /* Place texture at the beginning of the heap that is shared by all textures of the same aliasing group */
+        if (@available(macOS 10.15, iOS 13.0, *))
+        {
+            aliasingGroup_  = desc.aliasingGroup;
+            aliasingHeap_   = transientHeapPool->AllocHeap(aliasingGroup_, texDesc);
+            native_         = [aliasingHeap_ newTextureWithDescriptor:texDesc offset:0];
+        }
+    }
+
+    if (native_ == nil)
+        native_ = [device newTextureWithDescriptor:texDesc];
+
     [texDesc release];
 }
 
 MTTexture::~MTTexture()
 {
     [native_ release];
+    [aliasingHeap_ release];
+    [sparseHeap_ release];
 }
 
 Extent3D MTTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -151,7 +234,7 @@ TextureDescriptor MTTexture::GetDesc() const
 
     texDesc.type            = GetType();
     texDesc.bindFlags       = GetBindFlags();
-    texDesc.miscFlags       = 0;
+    texDesc.miscFlags       = (IsTransient() ? MiscFlags::Transient : 0) | (IsMemoryless() ? MiscFlags::Memoryless : 0);
     texDesc.mipLevels       = static_cast<std::uint32_t>([native_ mipmapLevelCount]);
     texDesc.format          = GetFormat();
     texDesc.extent.width    = static_cast<std::uint32_t>([native_ width]);
@@ -177,6 +260,30 @@ SubresourceFootprint MTTexture::GetSubresourceFootprint(std::uint32_t mipLevel)
     return CalcPackedSubresourceFootprint(GetType(), GetFormat(), GetMipExtent(0), mipLevel, numArrayLayers);
 }
 
+bool MTTexture::GetSparseProperties(SparseTextureProperties& outProperties) const
+{
+    if (!IsSparse())
+        return false;
+
+    if (@available(macOS 11.0, iOS 13.0, *))
+    {
+        id<MTLDevice> device = [native_ device];
+        const MTLSize tileSize = [device
+            sparseTileSizeWithTextureType:  [native_ textureType]
+            pixelFormat:                    [native_ pixelFormat]
+            sampleCount:                    [native_ sampleCount]
+        ];
+        outProperties.tileSize.x        = static_cast<std::uint32_t>(tileSize.width);
+        outProperties.tileSize.y        = static_cast<std::uint32_t>(tileSize.height);
+        outProperties.tileSize.z        = static_cast<std::uint32_t>(tileSize.depth);
+        outProperties.numStandardMips   = static_cast<std::uint32_t>([native_ firstMipmapInTail]);
+        outProperties.tileMemorySize    = static_cast<std::uint64_t>([device sparseTileSizeInBytes]);
+        return true;
+    }
+
+    return false;
+}
+
 void MTTexture::WriteRegion(const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
     /* Convert region to MTLRegion */
@@ -271,6 +378,50 @@ void MTTexture::ReadRegion(
     }
 }
 
+void MTTexture::EncodeTileMapping(id<MTLResourceStateCommandEncoder> encoder, const SparseTextureMapping& mapping)
+{
+    const TextureRegion&        region          = mapping.region;
+    const TextureSubresource&   subresource     = region.subresource;
+    const bool                  is3DTexture     = (GetType() == TextureType::Texture3D);
+    const NSUInteger            baseSlice       = (is3DTexture ? 0u : subresource.baseArrayLayer);
+    const NSUInteger            numSlices       = (is3DTexture ? 1u : std::max(1u, subresource.numArrayLayers));
+    const NSUInteger            firstTailMip    = [native_ firstMipmapInTail];
+
+    /* Convert texel region into tile region; the MIP tail is always mapped as a whole per slice */
+    NSUInteger  mipLevel    = subresource.baseMipLevel;
+    MTLRegion   tileRegion  = MTLRegionMake3D(0, 0, 0, 1, 1, 1);
+
+    if (mipLevel >= firstTailMip)
+        mipLevel = firstTailMip;
+    else
+    {
+        const MTLSize tileSize = [[native_ device]
+            sparseTileSizeWithTextureType:  [native_ textureType]
+            pixelFormat:                    [native_ pixelFormat]
+            sampleCount:                    [native_ sampleCount]
+        ];
+        const NSUInteger beginX = static_cast<NSUInteger>(region.offset.x) / tileSize.width;
+        const NSUInteger beginY = static_cast<NSUInteger>(region.offset.y) / tileSize.height;
+        const NSUInteger beginZ = (is3DTexture ? static_cast<NSUInteger>(region.offset.z) / tileSize.depth : 0u);
+        const NSUInteger endX   = DivideRoundUp<NSUInteger>(static_cast<NSUInteger>(region.offset.x) + region.extent.x, tileSize.width);
+        const NSUInteger endY   = DivideRoundUp<NSUInteger>(static_cast<NSUInteger>(region.offset.y) + region.extent.y, tileSize.height);
+        const NSUInteger endZ   = (is3DTexture ? DivideRoundUp<NSUInteger>(static_cast<NSUInteger>(region.offset.z) + region.extent.z, tileSize.depth) : 1u);
+        tileRegion = MTLRegionMake3D(beginX, beginY, beginZ, endX - beginX, endY - beginY, endZ - beginZ);
+    }
+
+    const MTLSparseTextureMappingMode mode = (mapping.commit ? MTLSparseTextureMappingModeMap : MTLSparseTextureMappingModeUnmap);
+    for_subrange(slice, baseSlice, baseSlice + numSlices)
+    {
+        [encoder
+            updateTextureMapping:   native_
+            mode:                   mode
+            region:                 tileRegion
+            mipLevel:               mipLevel
+            slice:                  slice
+        ];
+    }
+}
+
 id<MTLTexture> MTTexture::CreateSubresourceView(const TextureSubresource& subresource)
 {
     NSUInteger firstLevel   = static_cast<NSUInteger>(subresource.baseMipLevel);
@@ -292,6 +443,13 @@ NSUInteger MTTexture::GetBytesPerRow(std::uint32_t rowExtent) const
     return LLGL::GetMemoryFootprint(format, rowExtent);
 }
 
+bool MTTexture::IsMemoryless(id<MTLTexture> texture)
+{
+    if (@available(macOS 11.0, iOS 10.0, *))
+        return (texture != nil && [texture storageMode] == MTLStorageModeMemoryless);
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -0,0 +1,82 @@
+/*
+ * MTTransientHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_TRANSIENT_HEAP_POOL_H
+#define LLGL_MT_TRANSIENT_HEAP_POOL_H
+
+
+#import <Metal/Metal.h>
+
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Pool of Metal placement heaps for transient render target attachments (see MiscFlags::Transient).
+All textures of the same aliasing group are placed at the beginning of the same heap, so their memory is aliased.
+If a new texture does not fit into the current heap of its group, a larger heap is created for the group.
+Textures retain their heap, so previous heaps remain valid until all of their textures have been released.
+This class is thread-safe, so transient textures can be created and released concurrently.
+*/
+class MTTransientHeapPool
+{
+
+    public:
+
+        MTTransientHeapPool(id<MTLDevice> device);
+        ~MTTransientHeapPool();
+
+        MTTransientHeapPool(const MTTransientHeapPool&) = delete;
+        MTTransientHeapPool& operator = (const MTTransientHeapPool&) = delete;
+
+        // Returns true if the running OS supports placement heaps with hazard tracking.
+        static bool IsSupported();
+
+        // Returns the heap of the specified aliasing group that is large enough for the specified texture. The returned heap is retained and must be released by the caller.
+        id<MTLHeap> AllocHeap(std::uint32_t aliasingGroup, MTLTextureDescriptor* textureDesc);
+
+        // Releases a texture of the specified aliasing group. The group releases its heap once all of its textures have been released.
+        void ReleaseHeap(std::uint32_t aliasingGroup);
+
+    private:
+
+        struct AliasingGroup
+        {
+            std::uint32_t   id;
+            id<MTLHeap>     heap;
+            NSUInteger      size;
+            std::uint32_t   numTextures;
+        };
+
+    private:
+
+        AliasingGroup* FindAliasingGroup(std::uint32_t aliasingGroup);
+
+        void CreateHeap(AliasingGroup& group, NSUInteger size);
+
+    private:
+
+        id<MTLDevice>               device_ = nil;
+        std::vector<AliasingGroup>  groups_;
+        std::mutex                  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
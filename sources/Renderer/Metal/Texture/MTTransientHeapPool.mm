@@ -0,0 +1,119 @@
+/*
+ * MTTransientHeapPool.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTTransientHeapPool.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+MTTransientHeapPool::MTTransientHeapPool(id<MTLDevice> device) :
+    device_ { device }
+{
+}
+
+MTTransientHeapPool::~MTTransientHeapPool()
+{
+    for (AliasingGroup& group : groups_)
+        [group.heap release];
+}
+
+bool MTTransientHeapPool::IsSupported()
+{
+    /* Placement heaps and heaps with tracked hazards require macOS 10.15 and iOS 13 */
+    if (@available(macOS 10.15, iOS 13.0, *))
+        return true;
+    return false;
+}
+
+id<MTLHeap> MTTransientHeapPool::AllocHeap(std::uint32_t aliasingGroup, MTLTextureDescriptor* textureDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    AliasingGroup* group = FindAliasingGroup(aliasingGroup);
+    if (group == nullptr)
+    {
+        groups_.push_back(AliasingGroup{ aliasingGroup, nil, 0, 0 });
+        group = &(groups_.back());
+    }
+
+    /* Replace heap of this group if the new texture does not fit; previous textures keep their own reference to the old heap */
+    const MTLSizeAndAlign sizeAndAlign = [device_ heapTextureSizeAndAlignWithDescriptor:textureDesc];
+    if (group->heap == nil || group->size < sizeAndAlign.size)
+        CreateHeap(*group, std::max(group->size, sizeAndAlign.size));
+
+    /* Retain heap while the lock is held, since another thread might replace the heap of this group right after */
+    ++group->numTextures;
+    return [group->heap retain];
+}
+
+void MTTransientHeapPool::ReleaseHeap(std::uint32_t aliasingGroup)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (auto it = groups_.begin(); it != groups_.end(); ++it)
+    {
+        if (it->id == aliasingGroup)
+        {
+            LLGL_ASSERT(it->numTextures > 0);
+            if (--it->numTextures == 0)
+            {
+                [it->heap release];
+                groups_.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+MTTransientHeapPool::AliasingGroup* MTTransientHeapPool::FindAliasingGroup(std::uint32_t aliasingGroup)
+{
+    for (AliasingGroup& group : groups_)
+    {
+        if (group.id == aliasingGroup)
+            return &group;
+    }
+    return nullptr;
+}
+
+void MTTransientHeapPool::CreateHeap(AliasingGroup& group, NSUInteger size)
+{
+    MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+    {
+        heapDesc.size           = size;
+        heapDesc.storageMode    = MTLStorageModePrivate;
+        if (@available(macOS 10.15, iOS 13.0, *))
+        {
+            /* Place all textures at offset 0 and let Metal track hazards across the entire heap, so aliased textures are synchronized */
+            heapDesc.type               = MTLHeapTypePlacement;
+            heapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+        }
+    }
+    [group.heap release];
+    group.heap = [device_ newHeapWithDescriptor:heapDesc];
+    [heapDesc release];
+
+    if (group.heap == nil)
+        LLGL_TRAP("failed to create MTLHeap with %u bytes for transient Metal textures", static_cast<unsigned>(size));
+
+    group.size = size;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
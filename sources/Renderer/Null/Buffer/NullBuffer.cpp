@@ -87,6 +87,18 @@ bool NullBuffer::CopyFromBuffer(std::uint64_t dstOffset, const NullBuffer& srcBu
     return false;
 }
 
+bool NullBuffer::Fill(std::uint64_t offset, const void* element, std::uint32_t elementSize, std::uint64_t size)
+{
+    if (elementSize > 0 && IsRangeInsideBuffer(*this, offset, size))
+    {
+        char* dst = GetBytesAt(offset);
+        for (std::uint64_t pos = 0; pos < size; pos += elementSize)
+            ::memcpy(dst + pos, element, static_cast<std::size_t>(std::min<std::uint64_t>(elementSize, size - pos)));
+        return true;
+    }
+    return false;
+}
+
 bool NullBuffer::CpuAccessRead(std::uint64_t offset, void* data, std::uint64_t size)
 {
     if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0)
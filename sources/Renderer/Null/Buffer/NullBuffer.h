@@ -39,6 +39,9 @@ class NullBuffer final : public Buffer
 
         bool CopyFromBuffer(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
 
+        // Fills the buffer range with the repeated element. A trailing partial element is truncated.
+        bool Fill(std::uint64_t offset, const void* element, std::uint32_t elementSize, std::uint64_t size);
+
         void* Map(const CPUAccess access, std::uint64_t offset, std::uint64_t length);
         void Unmap();
 
@@ -10,6 +10,9 @@
 
 
 #include <LLGL/IndirectArguments.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include "../../BufferUtils.h"
 #include <cstddef>
 #include <cstdint>
 
@@ -30,6 +33,15 @@ struct NullCmdBufferWrite
 //  std::int8_t data[dataSize];
 };
 
+struct NullCmdBufferFill
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+    std::uint64_t   size;
+    std::uint32_t   elementSize;
+    std::uint8_t    element[g_maxClearElementSize];
+};
+
 struct NullCmdCopySubresource
 {
     Resource*       srcResource;
@@ -58,6 +70,13 @@ struct NullCmdGenerateMips
     std::uint32_t   numMipLevels;
 };
 
+struct NullCmdClearTexture
+{
+    NullTexture*        texture;
+    TextureSubresource  subresource;
+    ClearValue          clearValue;
+};
+
 //TODO...
 
 struct NullCmdDraw
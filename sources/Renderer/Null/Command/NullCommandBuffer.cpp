@@ -11,6 +11,7 @@
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Utils/ForRange.h>
 
 #include "../NullSwapChain.h"
 #include "../Buffer/NullBuffer.h"
@@ -23,14 +24,17 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
-    desc { desc }
+NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc, NullProfiler* profiler, bool executeCommands) :
+    desc             { desc            },
+    profiler_        { profiler        },
+    executeCommands_ { executeCommands }
 {
 }
 
@@ -39,10 +43,14 @@ NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
 void NullCommandBuffer::Begin()
 {
     buffer_.Clear();
+    if (profiler_ != nullptr)
+        encodingBeginTime_ = NullProfiler::Now();
 }
 
 void NullCommandBuffer::End()
 {
+    if (profiler_ != nullptr)
+        profiler_->RecordEncoding(encodingBeginTime_);
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
         ExecuteVirtualCommands();
 }
@@ -99,6 +107,16 @@ void NullCommandBuffer::CopyBuffer(
     }
 }
 
+void NullCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 static Extent3D GetSubresourceExtent(TextureType type, const Extent3D& extent, std::uint32_t numArrayLayers)
 {
     switch (type)
@@ -150,8 +168,50 @@ void NullCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    //auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
-    //todo
+    auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+
+    /* Fill entire buffer if whole size is specified; the offset is ignored in this case */
+    if (fillSize == LLGL_WHOLE_SIZE)
+    {
+        dstOffset   = 0;
+        fillSize    = dstBufferNull.desc.size;
+    }
+
+    auto cmd = AllocCommand<NullCmdBufferFill>(NullOpcodeBufferFill);
+    {
+        cmd->buffer         = &dstBufferNull;
+        cmd->offset         = dstOffset;
+        cmd->size           = fillSize;
+        cmd->elementSize    = sizeof(value);
+        ::memcpy(cmd->element, &value, sizeof(value));
+    }
+}
+
+void NullCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(dstBufferNull.desc.size, dstOffset, clearSize);
+
+    auto cmd = AllocCommand<NullCmdBufferFill>(NullOpcodeBufferFill);
+    {
+        cmd->buffer         = &dstBufferNull;
+        cmd->offset         = dstOffset;
+        cmd->size           = clearSize;
+        cmd->elementSize    = elementSize;
+        ::memcpy(cmd->element, element, elementSize);
+    }
 }
 
 void NullCommandBuffer::CopyTexture(
@@ -171,7 +231,7 @@ void NullCommandBuffer::CopyTexture(
         cmd->srcY           = srcLocation.offset.y;
         cmd->srcZ           = srcLocation.offset.z;
         cmd->dstResource    = &dstTextureNull;
-        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(srcLocation.mipLevel, srcLocation.arrayLayer);
+        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(dstLocation.mipLevel, dstLocation.arrayLayer);
         cmd->dstX           = dstLocation.offset.x;
         cmd->dstY           = dstLocation.offset.y;
         cmd->dstZ           = dstLocation.offset.z;
@@ -183,6 +243,16 @@ void NullCommandBuffer::CopyTexture(
     }
 }
 
+void NullCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
 void NullCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -221,6 +291,22 @@ void NullCommandBuffer::CopyTextureFromFramebuffer(
     //todo
 }
 
+void NullCommandBuffer::ClearTexture(Texture& texture, const TextureSubresource& subresource, const ClearValue& clearValue)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    auto cmd = AllocCommand<NullCmdClearTexture>(NullOpcodeClearTexture);
+    {
+        cmd->texture        = &textureNull;
+        cmd->subresource    = subresource;
+        cmd->clearValue     = clearValue;
+    }
+}
+
+void NullCommandBuffer::DiscardResource(Resource& /*resource*/)
+{
+    // dummy - contents of null resources are always preserved
+}
+
 void NullCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
@@ -247,6 +333,12 @@ void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
     }
 }
 
+void NullCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    for_range(i, numTextures)
+        GenerateMips(*textures[i]);
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void NullCommandBuffer::SetViewport(const Viewport& viewport)
@@ -271,16 +363,21 @@ void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sc
 
 /* ----- Buffers ------ */
 
-void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void NullCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
-    renderState_.vertexBuffers = { &bufferNull };
+    renderState_.vertexBuffers          = { &bufferNull };
+    renderState_.vertexBufferOffsets    = { offset };
 }
 
-void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayNull = LLGL_CAST(NullBufferArray&, bufferArray);
     renderState_.vertexBuffers = SmallVector<const NullBuffer*>(bufferArrayNull.buffers.begin(), bufferArrayNull.buffers.end());
+    if (offsets != nullptr)
+        renderState_.vertexBufferOffsets = SmallVector<std::uint64_t>(offsets, offsets + bufferArrayNull.buffers.size());
+    else
+        renderState_.vertexBufferOffsets = SmallVector<std::uint64_t>(bufferArrayNull.buffers.size(), 0);
 }
 
 void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -312,6 +409,11 @@ void NullCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource
     //todo
 }
 
+void NullCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    //todo
+}
+
 /* ----- Render Passes ----- */
 
 void NullCommandBuffer::BeginRenderPass(
@@ -338,6 +440,11 @@ void NullCommandBuffer::EndRenderPass()
     //todo
 }
 
+void NullCommandBuffer::NextSubpass()
+{
+    //todo
+}
+
 void NullCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
     //todo
@@ -366,6 +473,41 @@ void NullCommandBuffer::SetStencilReference(std::uint32_t reference, const Stenc
     //todo
 }
 
+void NullCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetShadingRate(const ShadingRateDescriptor& shadingRateDesc)
+{
+    //todo
+}
+
+void NullCommandBuffer::SetShadingRateImage(Texture* texture)
+{
+    //todo
+}
+
 void NullCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     //todo
@@ -396,6 +538,17 @@ void NullCommandBuffer::EndRenderCondition()
     //todo
 }
 
+void NullCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    //todo
+}
+
 /* ----- Stream Output ------ */
 
 void NullCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -511,6 +664,12 @@ void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint
     AllocDrawIndexedCommand(drawArgs);
 }
 
+void NullCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+        AllocDrawIndexedCommand(*draws);
+}
+
 void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
@@ -551,6 +710,46 @@ void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset
     }
 }
 
+static std::uint32_t ReadIndirectDrawCount(Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands)
+{
+    auto& countBufferNull = LLGL_CAST(NullBuffer&, countBuffer);
+    std::uint32_t numCommands = 0;
+    countBufferNull.Read(countOffset, &numCommands, sizeof(numCommands));
+    return std::min(numCommands, maxNumCommands);
+}
+
+void NullCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    DrawIndirect(argumentsBuffer, argumentsOffset, ReadIndirectDrawCount(countBuffer, countOffset, maxNumCommands), stride);
+}
+
+void NullCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    DrawIndexedIndirect(argumentsBuffer, argumentsOffset, ReadIndirectDrawCount(countBuffer, countOffset, maxNumCommands), stride);
+}
+
+void NullCommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    // dummy
+}
+
+void NullCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    // dummy
+}
+
 /* ----- Compute ----- */
 
 void NullCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -598,7 +797,9 @@ bool NullCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
 
 void NullCommandBuffer::ExecuteVirtualCommands()
 {
-    ExecuteNullVirtualCommandBuffer(buffer_);
+    /* Skip replay entirely to only measure the encoding overhead of the frontend */
+    if (executeCommands_)
+        ExecuteNullVirtualCommandBuffer(buffer_, profiler_);
     if ((desc.flags & CommandBufferFlags::MultiSubmit) == 0)
         buffer_.Clear();
 }
@@ -610,12 +811,16 @@ void NullCommandBuffer::ExecuteVirtualCommands()
 
 void NullCommandBuffer::AllocOpcode(const NullOpcode opcode)
 {
+    if (profiler_ != nullptr)
+        profiler_->RecordEncodedOpcode(opcode);
     buffer_.AllocOpcode(opcode);
 }
 
 template <typename TCommand>
 TCommand* NullCommandBuffer::AllocCommand(const NullOpcode opcode, std::size_t payloadSize)
 {
+    if (profiler_ != nullptr)
+        profiler_->RecordEncodedOpcode(opcode);
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
 
@@ -12,6 +12,7 @@
 #include <LLGL/CommandBuffer.h>
 #include <LLGL/Container/SmallVector.h>
 #include "NullCommandOpcode.h"
+#include "../NullProfiler.h"
 #include "../../VirtualCommandBuffer.h"
 
 
@@ -20,6 +21,7 @@ namespace LLGL
 
 
 class NullBuffer;
+class NullProfiler;
 
 using NullVirtualCommandBuffer = VirtualCommandBuffer<NullOpcode>;
 
@@ -32,7 +34,7 @@ class NullCommandBuffer final : public CommandBuffer
 
     public:
 
-        NullCommandBuffer(const CommandBufferDescriptor& desc);
+        NullCommandBuffer(const CommandBufferDescriptor& desc, NullProfiler* profiler = nullptr, bool executeCommands = true);
 
     public:
 
@@ -50,6 +52,7 @@ class NullCommandBuffer final : public CommandBuffer
             SmallVector<Viewport>           viewports;
             SmallVector<Scissor>            scissors;
             SmallVector<const NullBuffer*>  vertexBuffers;
+            SmallVector<std::uint64_t>      vertexBufferOffsets;
             const NullBuffer*               indexBuffer         = nullptr;
             Format                          indexBufferFormat   = Format::Undefined;
             std::uint64_t                   indexBufferOffset   = 0;
@@ -72,6 +75,10 @@ class NullCommandBuffer final : public CommandBuffer
         NullVirtualCommandBuffer    buffer_;
         RenderState                 renderState_;
 
+        NullProfiler*               profiler_           = nullptr;
+        NullProfiler::TimePoint     encodingBeginTime_;
+        const bool                  executeCommands_    = true;
+
 };
 
 
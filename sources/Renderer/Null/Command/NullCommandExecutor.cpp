@@ -36,6 +36,12 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
             cmd->buffer->Write(cmd->offset, cmd + 1, cmd->size);
             return (sizeof(*cmd) + cmd->size);
         }
+        case NullOpcodeBufferFill:
+        {
+            auto cmd = reinterpret_cast<const NullCmdBufferFill*>(pc);
+            cmd->buffer->Fill(cmd->offset, cmd->element, cmd->elementSize, cmd->size);
+            return sizeof(*cmd);
+        }
         case NullOpcodeCopySubresource:
         {
             auto cmd = reinterpret_cast<const NullCmdCopySubresource*>(pc);
@@ -56,7 +62,20 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
             }
             else if (dst->GetResourceType() == ResourceType::Texture)
             {
-                //TODO
+                auto* dstTexture = LLGL_CAST(NullTexture*, dst);
+                if (src->GetResourceType() == ResourceType::Texture)
+                {
+                    auto* srcTexture = LLGL_CAST(const NullTexture*, src);
+                    TextureLocation dstLocation{ Offset3D{ static_cast<std::int32_t>(cmd->dstX), static_cast<std::int32_t>(cmd->dstY), static_cast<std::int32_t>(cmd->dstZ) } };
+                    TextureLocation srcLocation{ Offset3D{ static_cast<std::int32_t>(cmd->srcX), static_cast<std::int32_t>(cmd->srcY), static_cast<std::int32_t>(cmd->srcZ) } };
+                    dstTexture->UnpackSubresourceIndex(cmd->dstSubresource, dstLocation.mipLevel, dstLocation.arrayLayer);
+                    srcTexture->UnpackSubresourceIndex(cmd->srcSubresource, srcLocation.mipLevel, srcLocation.arrayLayer);
+                    dstTexture->CopyFromTexture(dstLocation, *srcTexture, srcLocation, Extent3D{ static_cast<std::uint32_t>(cmd->width), cmd->height, cmd->depth });
+                }
+                else if (src->GetResourceType() == ResourceType::Buffer)
+                {
+                    //TODO
+                }
             }
             return sizeof(*cmd);
         }
@@ -67,6 +86,12 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
             cmd->texture->GenerateMips(&subresource);
             return sizeof(*cmd);
         }
+        case NullOpcodeClearTexture:
+        {
+            auto cmd = reinterpret_cast<const NullCmdClearTexture*>(pc);
+            cmd->texture->Clear(cmd->subresource, cmd->clearValue);
+            return sizeof(*cmd);
+        }
         //TODO...
         case NullOpcodeDraw:
         {
@@ -96,8 +121,39 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
     }
 }
 
-void ExecuteNullVirtualCommandBuffer(const NullVirtualCommandBuffer& virtualCmdBuffer)
+static void ExecuteNullVirtualCommandBufferProfiled(const NullVirtualCommandBuffer& virtualCmdBuffer, NullProfiler& profiler)
 {
+    const NullProfiler::TimePoint beginTime = NullProfiler::Now();
+
+    for (const auto& chunk : virtualCmdBuffer)
+    {
+        auto pc     = chunk.data;
+        auto pcEnd  = chunk.data + chunk.size;
+
+        while (pc < pcEnd)
+        {
+            /* Read opcode */
+            const NullOpcode opcode = *reinterpret_cast<const NullOpcode*>(pc);
+            pc += sizeof(NullOpcode);
+
+            /* Execute command, increment program counter, and record time per opcode */
+            const NullProfiler::TimePoint opcodeBeginTime = NullProfiler::Now();
+            pc += ExecuteNullCommand(opcode, pc);
+            profiler.RecordExecutedOpcode(opcode, opcodeBeginTime);
+        }
+    }
+
+    profiler.RecordExecution(beginTime);
+}
+
+void ExecuteNullVirtualCommandBuffer(const NullVirtualCommandBuffer& virtualCmdBuffer, NullProfiler* profiler)
+{
+    if (profiler != nullptr)
+    {
+        ExecuteNullVirtualCommandBufferProfiled(virtualCmdBuffer, *profiler);
+        return;
+    }
+
     /* Initialize program counter to execute virtual GL commands */
     for (const auto& chunk : virtualCmdBuffer)
     {
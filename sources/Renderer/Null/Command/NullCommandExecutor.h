@@ -16,8 +16,10 @@ namespace LLGL
 {
 
 
-// Executes all virtual commands from the specified command buffer.
-void ExecuteNullVirtualCommandBuffer(const NullVirtualCommandBuffer& virtualCmdBuffer);
+class NullProfiler;
+
+// Executes all virtual commands from the specified command buffer. Timing is recorded into the profiler if it's non-null.
+void ExecuteNullVirtualCommandBuffer(const NullVirtualCommandBuffer& virtualCmdBuffer, NullProfiler* profiler = nullptr);
 
 
 } // /namespace LLGL
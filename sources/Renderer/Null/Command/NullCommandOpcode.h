@@ -19,8 +19,10 @@ namespace LLGL
 enum NullOpcode : std::uint8_t
 {
     NullOpcodeBufferWrite = 1,
+    NullOpcodeBufferFill,
     NullOpcodeCopySubresource,
     NullOpcodeGenerateMips,
+    NullOpcodeClearTexture,
     //TODO
     NullOpcodeDraw,
     NullOpcodeDrawIndexed,
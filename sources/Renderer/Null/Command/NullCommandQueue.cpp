@@ -36,14 +36,15 @@ bool NullCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuer
 
 /* ----- Fences ----- */
 
-void NullCommandQueue::Submit(Fence& fence)
+void NullCommandQueue::Submit(Fence& /*fence*/)
 {
-    //todo
+    // Command buffers are executed on submission, so there is no pending work a fence would have to wait for
 }
 
-bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+bool NullCommandQueue::WaitFence(Fence& /*fence*/, std::uint64_t /*timeout*/)
 {
-    return false; //todo
+    // All previously submitted command buffers have already been executed
+    return true;
 }
 
 void NullCommandQueue::WaitIdle()
@@ -39,6 +39,18 @@ namespace ModuleNull
 
 } // /namespace LLGL
 
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#include "../DirectCommandBufferImpl.h"
+#include "Command/NullCommandBuffer.h"
+
+#define LLGL_NULL_DIRECT_DISPATCH(CMDBUFFER, CALL) \
+    LLGL_DIRECT_DISPATCH_FINAL(NullCommandBuffer, CMDBUFFER, CALL)
+
+LLGL_IMPLEMENT_DIRECT_COMMAND_BUFFER(LLGL_NULL_DIRECT_DISPATCH)
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
 #ifndef LLGL_BUILD_STATIC_LIB
 
 extern "C"
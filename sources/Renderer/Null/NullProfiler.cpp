@@ -0,0 +1,115 @@
+/*
+ * NullProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullProfiler.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static const char* NullOpcodeToString(std::uint32_t opcode)
+{
+    switch (opcode)
+    {
+        case NullOpcodeBufferWrite:         return "BufferWrite";
+        case NullOpcodeBufferFill:          return "BufferFill";
+        case NullOpcodeCopySubresource:     return "CopySubresource";
+        case NullOpcodeGenerateMips:        return "GenerateMips";
+        case NullOpcodeClearTexture:        return "ClearTexture";
+        case NullOpcodeDraw:                return "Draw";
+        case NullOpcodeDrawIndexed:         return "DrawIndexed";
+        case NullOpcodePushDebugGroup:      return "PushDebugGroup";
+        case NullOpcodePopDebugGroup:       return "PopDebugGroup";
+        default:                            return nullptr;
+    }
+}
+
+static std::uint64_t GetElapsedNanoseconds(const NullProfiler::TimePoint& beginTime)
+{
+    const auto elapsed = NullProfiler::Now() - beginTime;
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+NullProfiler::NullProfiler() :
+    numObjectAllocations_      { 0 },
+    numCommandBuffersEncoded_  { 0 },
+    encodingTime_              { 0 },
+    numCommandBuffersExecuted_ { 0 },
+    executionTime_             { 0 }
+{
+    for (OpcodeCounters& counters : opcodes_)
+    {
+        counters.numEncoded     = 0;
+        counters.numExecuted    = 0;
+        counters.executionTime  = 0;
+    }
+}
+
+NullProfiler::TimePoint NullProfiler::Now()
+{
+    return Clock::now();
+}
+
+void NullProfiler::RecordObjectAllocation()
+{
+    numObjectAllocations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NullProfiler::RecordEncodedOpcode(NullOpcode opcode)
+{
+    if (opcode < Null::maxNumOpcodes)
+        opcodes_[opcode].numEncoded.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NullProfiler::RecordEncoding(const TimePoint& beginTime)
+{
+    numCommandBuffersEncoded_.fetch_add(1, std::memory_order_relaxed);
+    encodingTime_.fetch_add(GetElapsedNanoseconds(beginTime), std::memory_order_relaxed);
+}
+
+void NullProfiler::RecordExecutedOpcode(NullOpcode opcode, const TimePoint& beginTime)
+{
+    if (opcode < Null::maxNumOpcodes)
+    {
+        OpcodeCounters& counters = opcodes_[opcode];
+        counters.numExecuted.fetch_add(1, std::memory_order_relaxed);
+        counters.executionTime.fetch_add(GetElapsedNanoseconds(beginTime), std::memory_order_relaxed);
+    }
+}
+
+void NullProfiler::RecordExecution(const TimePoint& beginTime)
+{
+    numCommandBuffersExecuted_.fetch_add(1, std::memory_order_relaxed);
+    executionTime_.fetch_add(GetElapsedNanoseconds(beginTime), std::memory_order_relaxed);
+}
+
+void NullProfiler::QueryProfile(Null::Profile& outProfile) const
+{
+    outProfile.numObjectAllocations         = numObjectAllocations_.load(std::memory_order_relaxed);
+    outProfile.numCommandBuffersEncoded     = numCommandBuffersEncoded_.load(std::memory_order_relaxed);
+    outProfile.encodingTime                 = encodingTime_.load(std::memory_order_relaxed);
+    outProfile.numCommandBuffersExecuted    = numCommandBuffersExecuted_.load(std::memory_order_relaxed);
+    outProfile.executionTime                = executionTime_.load(std::memory_order_relaxed);
+
+    for_range(i, Null::maxNumOpcodes)
+    {
+        Null::OpcodeProfile& dst = outProfile.opcodes[i];
+        dst.name            = NullOpcodeToString(i);
+        dst.numEncoded      = opcodes_[i].numEncoded.load(std::memory_order_relaxed);
+        dst.numExecuted     = opcodes_[i].numExecuted.load(std::memory_order_relaxed);
+        dst.executionTime   = opcodes_[i].executionTime.load(std::memory_order_relaxed);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
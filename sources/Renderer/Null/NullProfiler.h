@@ -0,0 +1,75 @@
+/*
+ * NullProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_PROFILER_H
+#define LLGL_NULL_PROFILER_H
+
+
+#include <LLGL/Backend/Null/NativeHandle.h>
+#include "Command/NullCommandOpcode.h"
+#include <atomic>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+// Thread-safe CPU-side counters for the Null renderer to measure the overhead of the frontend.
+class NullProfiler
+{
+
+    public:
+
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+
+    public:
+
+        NullProfiler();
+
+        // Returns the current time point to measure time intervals with.
+        static TimePoint Now();
+
+        void RecordObjectAllocation();
+        void RecordEncodedOpcode(NullOpcode opcode);
+        void RecordEncoding(const TimePoint& beginTime);
+        void RecordExecutedOpcode(NullOpcode opcode, const TimePoint& beginTime);
+        void RecordExecution(const TimePoint& beginTime);
+
+        // Copies a snapshot of all counters into the output profile.
+        void QueryProfile(Null::Profile& outProfile) const;
+
+    private:
+
+        struct OpcodeCounters
+        {
+            std::atomic<std::uint64_t> numEncoded;
+            std::atomic<std::uint64_t> numExecuted;
+            std::atomic<std::uint64_t> executionTime;
+        };
+
+    private:
+
+        std::atomic<std::uint64_t>  numObjectAllocations_;
+        std::atomic<std::uint64_t>  numCommandBuffersEncoded_;
+        std::atomic<std::uint64_t>  encodingTime_;
+        std::atomic<std::uint64_t>  numCommandBuffersExecuted_;
+        std::atomic<std::uint64_t>  executionTime_;
+        OpcodeCounters              opcodes_[Null::maxNumOpcodes];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
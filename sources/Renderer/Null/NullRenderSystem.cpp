@@ -6,9 +6,12 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../RenderSystemUtils.h"
+#include "../MemoryInfoUtils.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
+#include <string.h>
 
 
 namespace LLGL
@@ -64,6 +67,10 @@ static void InitNullRendererFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = true;
     features.hasRenderCondition             = true;
+    features.hasConcurrentPipelineStateCreation = true;
+    features.hasIndirectDrawingCount        = true;
+    features.hasConcurrentShaderCreation    = true;
+    features.hasConcurrentResourceCreation  = true;
 }
 
 static void InitNullRendererLimits(RenderingLimits& limits)
@@ -96,6 +103,13 @@ static void InitNullRendererLimits(RenderingLimits& limits)
     limits.maxDepthBufferSamples            = 1;
     limits.maxStencilBufferSamples          = 1;
     limits.maxNoAttachmentSamples           = 1;
+    limits.dynamicStates                    = (
+        DynamicStateFlags::CullMode             |
+        DynamicStateFlags::DepthState           |
+        DynamicStateFlags::StencilState         |
+        DynamicStateFlags::PrimitiveTopology    |
+        DynamicStateFlags::DepthBias
+    );
 }
 
 static RenderingCapabilities GetNullRenderingCaps()
@@ -124,13 +138,28 @@ NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDes
 {
     SetRendererInfo(GetNullRenderInfo());
     SetRenderingCaps(GetNullRenderingCaps());
+
+    if (auto* rendererConfigNull = GetRendererConfiguration<RendererConfigurationNull>(renderSystemDesc))
+    {
+        if (rendererConfigNull->enableProfiling)
+            profiler_ = MakeUnique<NullProfiler>();
+        executeCommands_ = rendererConfigNull->executeCommands;
+    }
+}
+
+template <typename T>
+T* NullRenderSystem::TrackAllocation(T* object)
+{
+    if (profiler_)
+        profiler_->RecordObjectAllocation();
+    return object;
 }
 
 /* ----- Swap-chain ----- */
 
 SwapChain* NullRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<NullSwapChain>(swapChainDesc, surface);
+    return TrackAllocation(swapChains_.emplace<NullSwapChain>(swapChainDesc, surface));
 }
 
 void NullRenderSystem::Release(SwapChain& swapChain)
@@ -149,7 +178,7 @@ CommandQueue* NullRenderSystem::GetCommandQueue()
 
 CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc);
+    return TrackAllocation(commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc, profiler_.get(), executeCommands_));
 }
 
 void NullRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -162,13 +191,13 @@ void NullRenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
-    return buffers_.emplace<NullBuffer>(bufferDesc, initialData);
+    return TrackAllocation(buffers_.emplace<NullBuffer>(bufferDesc, initialData));
 }
 
 BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
-    return bufferArrays_.emplace<NullBufferArray>(numBuffers, bufferArray);
+    return TrackAllocation(bufferArrays_.emplace<NullBufferArray>(numBuffers, bufferArray));
 }
 
 void NullRenderSystem::Release(Buffer& buffer)
@@ -215,7 +244,7 @@ void NullRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    return textures_.emplace<NullTexture>(textureDesc, initialImage);
+    return TrackAllocation(textures_.emplace<NullTexture>(textureDesc, initialImage));
 }
 
 void NullRenderSystem::Release(Texture& texture)
@@ -239,7 +268,7 @@ void NullRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textur
 
 Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<NullSampler>(samplerDesc);
+    return TrackAllocation(samplers_.emplace<NullSampler>(samplerDesc));
 }
 
 void NullRenderSystem::Release(Sampler& sampler)
@@ -251,7 +280,7 @@ void NullRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<NullResourceHeap>(resourceHeapDesc, initialResourceViews);
+    return TrackAllocation(resourceHeaps_.emplace<NullResourceHeap>(resourceHeapDesc, initialResourceViews));
 }
 
 void NullRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -269,7 +298,7 @@ std::uint32_t NullRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, st
 
 RenderPass* NullRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
-    return renderPasses_.emplace<NullRenderPass>(renderPassDesc);
+    return TrackAllocation(renderPasses_.emplace<NullRenderPass>(renderPassDesc));
 }
 
 void NullRenderSystem::Release(RenderPass& renderPass)
@@ -281,7 +310,7 @@ void NullRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
-    return renderTargets_.emplace<NullRenderTarget>(renderTargetDesc);
+    return TrackAllocation(renderTargets_.emplace<NullRenderTarget>(renderTargetDesc));
 }
 
 void NullRenderSystem::Release(RenderTarget& renderTarget)
@@ -293,7 +322,7 @@ void NullRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* NullRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
-    return shaders_.emplace<NullShader>(shaderDesc);
+    return TrackAllocation(shaders_.emplace<NullShader>(shaderDesc));
 }
 
 void NullRenderSystem::Release(Shader& shader)
@@ -305,7 +334,7 @@ void NullRenderSystem::Release(Shader& shader)
 
 PipelineLayout* NullRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<NullPipelineLayout>(pipelineLayoutDesc);
+    return TrackAllocation(pipelineLayouts_.emplace<NullPipelineLayout>(pipelineLayoutDesc));
 }
 
 void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -317,7 +346,7 @@ void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 PipelineCache* NullRenderSystem::CreatePipelineCache(const Blob& /*initialBlob*/)
 {
-    return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
+    return TrackAllocation(ProxyPipelineCache::CreateInstance(pipelineCacheProxy_));
 }
 
 void NullRenderSystem::Release(PipelineCache& pipelineCache)
@@ -329,12 +358,12 @@ void NullRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* NullRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
-    return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
+    return TrackAllocation(pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc));
 }
 
 PipelineState* NullRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
-    return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
+    return TrackAllocation(pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc));
 }
 
 void NullRenderSystem::Release(PipelineState& pipelineState)
@@ -346,7 +375,7 @@ void NullRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* NullRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
 {
-    return queryHeaps_.emplace<NullQueryHeap>(queryHeapDesc);
+    return TrackAllocation(queryHeaps_.emplace<NullQueryHeap>(queryHeapDesc));
 }
 
 void NullRenderSystem::Release(QueryHeap& queryHeap)
@@ -358,7 +387,7 @@ void NullRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* NullRenderSystem::CreateFence()
 {
-    return fences_.emplace<NullFence>();
+    return TrackAllocation(fences_.emplace<NullFence>());
 }
 
 void NullRenderSystem::Release(Fence& fence)
@@ -370,7 +399,23 @@ void NullRenderSystem::Release(Fence& fence)
 
 bool NullRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
-    return (nativeHandle == nullptr || nativeHandleSize == 0); // dummy
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Null::RenderSystemNativeHandle))
+    {
+        auto* nativeHandleNull = static_cast<Null::RenderSystemNativeHandle*>(nativeHandle);
+        ::memset(nativeHandleNull, 0, sizeof(Null::RenderSystemNativeHandle));
+        if (profiler_)
+            profiler_->QueryProfile(nativeHandleNull->profile);
+        return true;
+    }
+    return false;
+}
+
+bool NullRenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    /* Null renderer has no device memory, so only report the host memory allocated for its resources */
+    outInfo = MemoryInfo{};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+    return true;
 }
 
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "NullSwapChain.h"
+#include "NullProfiler.h"
 #include "Command/NullCommandBuffer.h"
 #include "Command/NullCommandQueue.h"
 #include "Buffer/NullBuffer.h"
@@ -28,6 +29,7 @@
 #include "../ProxyPipelineCache.h"
 
 #include "../ContainerTypes.h"
+#include <mutex>
 
 
 namespace LLGL
@@ -45,11 +47,21 @@ class NullRenderSystem final : public RenderSystem
 
         NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
 
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
+    private:
+
+        // Returns the specified object and records its allocation if profiling is enabled.
+        template <typename T>
+        T* TrackAllocation(T* object);
+
     private:
 
         /* ----- Common objects ----- */
 
         const RenderSystemDescriptor            desc_;
+        std::unique_ptr<NullProfiler>           profiler_;
+        bool                                    executeCommands_        = true;
 
         /* ----- Hardware object containers ----- */
 
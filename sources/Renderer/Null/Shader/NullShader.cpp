@@ -44,6 +44,8 @@ bool NullShader::Reflect(ShaderReflection& reflection) const
             reflection.fragment = desc.fragment;
             break;
         case ShaderType::Compute:
+        case ShaderType::Task:
+        case ShaderType::Mesh:
             reflection.compute = desc.compute;
             break;
         default:
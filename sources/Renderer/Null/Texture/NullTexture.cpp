@@ -98,6 +98,44 @@ void NullTexture::Read(const TextureRegion& textureRegion, const MutableImageVie
     }
 }
 
+void NullTexture::CopyFromTexture(const TextureLocation& dstLocation, const NullTexture& srcTexture, const TextureLocation& srcLocation, const Extent3D& extent)
+{
+    if (dstLocation.mipLevel < images_.size() && srcLocation.mipLevel < srcTexture.images_.size())
+    {
+        /* Read pixels from source MIP-map image into intermediate image and write them into destination MIP-map image */
+        const Image& srcMipMap = srcTexture.images_[srcLocation.mipLevel];
+        Image& dstMipMap = images_[dstLocation.mipLevel];
+        const Offset3D srcOffset = CalcTextureOffset(srcTexture.GetType(), srcLocation.offset, srcLocation.arrayLayer);
+        const Offset3D dstOffset = CalcTextureOffset(GetType(), dstLocation.offset, dstLocation.arrayLayer);
+        Image intermediateImage{ extent, srcMipMap.GetFormat(), srcMipMap.GetDataType() };
+        srcMipMap.ReadPixels(srcOffset, extent, intermediateImage.GetMutableView());
+        dstMipMap.WritePixels(dstOffset, extent, intermediateImage.GetView());
+    }
+}
+
+void NullTexture::Clear(const TextureSubresource& subresource, const ClearValue& clearValue)
+{
+    /* Depth-stencil images store the depth and stencil values in their first two components */
+    const ColorRGBAf fillColor =
+    (
+        IsDepthOrStencilFormat(desc.format)
+            ? ColorRGBAf{ clearValue.depth, static_cast<float>(clearValue.stencil), 0.0f, 0.0f }
+            : ColorRGBAf{ clearValue.color[0], clearValue.color[1], clearValue.color[2], clearValue.color[3] }
+    );
+
+    const std::uint32_t mipLevelEnd = std::min<std::uint32_t>(subresource.baseMipLevel + subresource.numMipLevels, static_cast<std::uint32_t>(images_.size()));
+
+    for_subrange(mipLevel, subresource.baseMipLevel, mipLevelEnd)
+    {
+        /* Fill the selected array layers of this MIP-map image, or all depth slices for 3D textures */
+        Image& mipMap = images_[mipLevel];
+        const Offset3D offset = CalcTextureOffset(GetType(), Offset3D{}, subresource.baseArrayLayer);
+        const Extent3D extent = CalcTextureExtent(GetType(), LLGL::GetMipExtent(GetType(), desc.extent, mipLevel), subresource.numArrayLayers);
+        const Image fillImage{ extent, mipMap.GetFormat(), mipMap.GetDataType(), fillColor };
+        mipMap.WritePixels(offset, extent, fillImage.GetView());
+    }
+}
+
 void NullTexture::GenerateMips(const TextureSubresource* subresource)
 {
     //todo
@@ -105,13 +143,13 @@ void NullTexture::GenerateMips(const TextureSubresource* subresource)
 
 std::uint32_t NullTexture::PackSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
 {
-    return (mipLevel * desc.mipLevels + arrayLayer);
+    return (mipLevel * desc.arrayLayers + arrayLayer);
 }
 
 void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_t& outMipLevel, std::uint32_t& outArrayLayer) const
 {
-    outMipLevel     = subresource / desc.mipLevels;
-    outArrayLayer   = subresource % desc.mipLevels;
+    outMipLevel     = subresource / desc.arrayLayers;
+    outArrayLayer   = subresource % desc.arrayLayers;
 }
 
 
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Texture.h>
+#include <LLGL/CommandBufferFlags.h>
 #include <LLGL/Utils/Image.h>
 #include <string>
 #include <vector>
@@ -40,6 +41,12 @@ class NullTexture final : public Texture
         void Write(const TextureRegion& textureRegion, const ImageView& srcImageView);
         void Read(const TextureRegion& textureRegion, const MutableImageView& dstImageView);
 
+        // Copies the region from the source texture into this texture. The array layers are included in the extent as for CommandBuffer::CopyTexture.
+        void CopyFromTexture(const TextureLocation& dstLocation, const NullTexture& srcTexture, const TextureLocation& srcLocation, const Extent3D& extent);
+
+        // Clears the specified subresource with the color, or depth and stencil values for depth-stencil formats.
+        void Clear(const TextureSubresource& subresource, const ClearValue& clearValue);
+
         // Generates the MIP-map images for either the entire resource or a rubresource.
         void GenerateMips(const TextureSubresource* subresource = nullptr);
 
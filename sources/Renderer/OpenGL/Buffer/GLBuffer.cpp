@@ -12,7 +12,10 @@
 #include "../GLTypes.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../../Core/CoreUtils.h"
+#include <algorithm>
 #include <memory>
+#include <vector>
+#include <cstring>
 
 
 namespace LLGL
@@ -102,8 +105,22 @@ BufferDescriptor GLBuffer::GetDesc() const
     return bufferDesc;
 }
 
+bool GLBuffer::GetClampedRange(std::uint64_t offset, std::uint64_t size, GLintptr& outOffset, GLsizeiptr& outSize) const
+{
+    const std::uint64_t bufferSize = static_cast<std::uint64_t>(GetSize());
+    if (!(offset < bufferSize))
+        return false;
+
+    outOffset   = static_cast<GLintptr>(offset);
+    outSize     = static_cast<GLsizeiptr>(std::min(size, bufferSize - offset));
+
+    return true;
+}
+
 void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage)
 {
+    size_ = size;
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -224,6 +241,47 @@ void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_
     }
 }
 
+void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, const void* element, std::uint32_t elementSize)
+{
+    #ifdef GL_ARB_clear_buffer_object
+    /* Select an unsigned integer format that matches the element size; other sizes are emulated */
+    GLenum internalFormat = 0, format = 0;
+    switch (elementSize)
+    {
+        case  8: internalFormat = GL_RG32UI;   format = GL_RG_INTEGER;   break;
+        case 12: internalFormat = GL_RGB32UI;  format = GL_RGB_INTEGER;  break;
+        case 16: internalFormat = GL_RGBA32UI; format = GL_RGBA_INTEGER; break;
+        default:                                                          break;
+    }
+    if (internalFormat != 0 && HasExtension(GLExt::ARB_clear_buffer_object))
+    {
+        GLStateManager::Get().BindGLBuffer(*this);
+        glClearBufferSubData(GetGLTarget(), internalFormat, offset, size, format, GL_UNSIGNED_INT, element);
+    }
+    else
+    #endif // /GL_ARB_clear_buffer_object
+    {
+        /* Emulate buffer clear operation */
+        GLStateManager::Get().BindGLBuffer(*this);
+
+        /* Allocate intermediate buffer with the repeated element to fill the GPU buffer with */
+        std::vector<char> intermediateBuffer(static_cast<std::size_t>(size));
+        for (std::size_t i = 0; i < intermediateBuffer.size(); i += elementSize)
+            std::memcpy(&intermediateBuffer[i], element, std::min<std::size_t>(elementSize, intermediateBuffer.size() - i));
+
+        /* Submit intermeidate buffer to GPU buffer */
+        glBufferSubData(GetGLTarget(), offset, size, intermediateBuffer.data());
+    }
+}
+
+void GLBuffer::InvalidateBufferData()
+{
+    #ifdef GL_ARB_invalidate_subdata
+    if (HasExtension(GLExt::ARB_invalidate_subdata))
+        glInvalidateBufferData(GetID());
+    #endif // /GL_ARB_invalidate_subdata
+}
+
 void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
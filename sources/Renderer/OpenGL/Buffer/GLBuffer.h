@@ -41,6 +41,9 @@ class GLBuffer : public Buffer
 
         void ClearBufferData(std::uint32_t data);
         void ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_t data);
+        void ClearBufferSubData(GLintptr offset, GLsizeiptr size, const void* element, std::uint32_t elementSize);
+
+        void InvalidateBufferData();
 
         void CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
 
@@ -57,6 +60,15 @@ class GLBuffer : public Buffer
             return id_;
         }
 
+        // Converts the specified buffer range into GL types and clamps it to the buffer size. Returns false if the offset is out of bounds.
+        bool GetClampedRange(std::uint64_t offset, std::uint64_t size, GLintptr& outOffset, GLsizeiptr& outSize) const;
+
+        // Returns the size (in bytes) the buffer storage was allocated with.
+        inline GLsizeiptr GetSize() const
+        {
+            return size_;
+        }
+
         // Returns the primary buffer target. In case the buffer was created with multiple binding flags, other targets can be used, too.
         inline GLBufferTarget GetTarget() const
         {
@@ -81,6 +93,7 @@ class GLBuffer : public Buffer
     private:
 
         GLuint          id_                 = 0;
+        GLsizeiptr      size_               = 0;
         GLBufferTarget  target_             = GLBufferTarget::ArrayBuffer;
         bool            indexType16Bits_    = false;
 
@@ -7,8 +7,6 @@
 
 #include "GLBufferArrayWithVAO.h"
 #include "GLBufferWithVAO.h"
-#include "../GLObjectUtils.h"
-#include "../RenderState/GLStateManager.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
 #include "../Ext/GLExtensionRegistry.h"
@@ -30,23 +28,11 @@ GLBufferArrayWithVAO::GLBufferArrayWithVAO(std::uint32_t numBuffers, Buffer* con
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
     {
-        /* Build vertex array with native VAO */
-        BuildVertexArrayWithVAO(numBuffers, bufferArray);
+        /* Build vertex input layout for native VAO */
+        BuildVertexInputLayout(numBuffers, bufferArray);
     }
 }
 
-void GLBufferArrayWithVAO::SetDebugName(const char* name)
-{
-    #ifdef LLGL_GL_ENABLE_OPENGL2X
-    if (HasNativeVAO())
-    #endif
-    {
-        /* Set label for VAO */
-        GLSetObjectLabel(GL_VERTEX_ARRAY, vao_.GetID(), name);
-    }
-}
-
-
 /*
  * ======= Private: =======
  */
@@ -59,28 +45,19 @@ static void ThrowNoVertexBufferErr()
     );
 }
 
-void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
+void GLBufferArrayWithVAO::BuildVertexInputLayout(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
+    /* VAO is built on demand by the state manager of each GL context */
+    while (GLBuffer* bufferGL = NextArrayResource<GLBuffer>(numBuffers, bufferArray))
     {
-        while (GLBuffer* bufferGL = NextArrayResource<GLBuffer>(numBuffers, bufferArray))
+        if ((bufferGL->GetBindFlags() & BindFlags::VertexBuffer) != 0)
         {
-            if ((bufferGL->GetBindFlags() & BindFlags::VertexBuffer) != 0)
-            {
-                /* Bind VBO */
-                auto* vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, bufferGL);
-                GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, vertexBufferGL->GetID());
-
-                /* Build each vertex attribute */
-                for (const VertexAttribute& attrib : vertexBufferGL->GetVertexAttribs())
-                    vao_.BuildVertexAttribute(attrib);
-            }
-            else
-                ThrowNoVertexBufferErr();
+            auto* vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, bufferGL);
+            vertexInputLayout_.AppendBuffer(vertexBufferGL->GetID(), vertexBufferGL->GetVertexAttribs());
         }
+        else
+            ThrowNoVertexBufferErr();
     }
-    GLStateManager::Get().BindVertexArray(0);
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -10,7 +10,7 @@
 
 
 #include "GLBufferArray.h"
-#include "GLVertexArrayObject.h"
+#include "GLVertexInputLayout.h"
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 #   include "GL2XVertexArray.h"
 #endif
@@ -23,18 +23,14 @@ namespace LLGL
 class GLBufferArrayWithVAO final : public GLBufferArray
 {
 
-    public:
-
-        void SetDebugName(const char* name) override;
-
     public:
 
         GLBufferArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
+        // Returns the vertex input layout to bind a cached vertex-array-object (VAO).
+        inline const GLVertexInputLayout& GetVertexInputLayout() const
         {
-            return vao_.GetID();
+            return vertexInputLayout_;
         }
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -47,14 +43,14 @@ class GLBufferArrayWithVAO final : public GLBufferArray
 
     private:
 
-        void BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
+        void BuildVertexInputLayout(std::uint32_t numBuffers, Buffer* const * bufferArray);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator(std::uint32_t numBuffers, Buffer* const * bufferArray);
         #endif
 
     private:
 
-        GLVertexArrayObject vao_;
+        GLVertexInputLayout vertexInputLayout_;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GL2XVertexArray     vertexArrayGL2X_;
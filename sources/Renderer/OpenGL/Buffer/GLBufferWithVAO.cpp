@@ -6,7 +6,6 @@
  */
 
 #include "GLBufferWithVAO.h"
-#include "../RenderState/GLStateManager.h"
 #include "../Ext/GLExtensionRegistry.h"
 
 
@@ -36,8 +35,8 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
     {
-        /* Build vertex array with native VAO */
-        BuildVertexArrayWithVAO();
+        /* Build vertex input layout for native VAO */
+        BuildVertexInputLayout();
     }
 }
 
@@ -46,19 +45,11 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
  * ======= Private: =======
  */
 
-void GLBufferWithVAO::BuildVertexArrayWithVAO()
+void GLBufferWithVAO::BuildVertexInputLayout()
 {
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
-    {
-        /* Bind VBO */
-        GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, GetID());
-
-        /* Build each vertex attribute */
-        for (const auto& attrib : vertexAttribs_)
-            vao_.BuildVertexAttribute(attrib);
-    }
-    GLStateManager::Get().BindVertexArray(0);
+    /* VAO is built on demand by the state manager of each GL context */
+    vertexInputLayout_ = GLVertexInputLayout{};
+    vertexInputLayout_.AppendBuffer(GetID(), vertexAttribs_);
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -10,7 +10,7 @@
 
 
 #include "GLBuffer.h"
-#include "GLVertexArrayObject.h"
+#include "GLVertexInputLayout.h"
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 #   include "GL2XVertexArray.h"
 #endif
@@ -29,10 +29,10 @@ class GLBufferWithVAO final : public GLBuffer
 
         void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
+        // Returns the vertex input layout to bind a cached vertex-array-object (VAO).
+        inline const GLVertexInputLayout& GetVertexInputLayout() const
         {
-            return vao_.GetID();
+            return vertexInputLayout_;
         }
 
         // Returns the list of vertex attributes.
@@ -51,14 +51,14 @@ class GLBufferWithVAO final : public GLBuffer
 
     private:
 
-        void BuildVertexArrayWithVAO();
+        void BuildVertexInputLayout();
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator();
         #endif
 
     private:
 
-        GLVertexArrayObject             vao_;
+        GLVertexInputLayout             vertexInputLayout_;
         std::vector<VertexAttribute>    vertexAttribs_;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
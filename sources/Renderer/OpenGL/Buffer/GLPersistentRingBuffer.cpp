@@ -0,0 +1,176 @@
+/*
+ * GLPersistentRingBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLPersistentRingBuffer.h"
+#include "GLBuffer.h"
+#include "../RenderState/GLFence.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+GLPersistentRingBuffer& GLPersistentRingBuffer::Get()
+{
+    static GLPersistentRingBuffer instance;
+    return instance;
+}
+
+GLPersistentRingBuffer::GLPersistentRingBuffer()
+{
+    // dummy
+}
+
+GLPersistentRingBuffer::~GLPersistentRingBuffer()
+{
+    // dummy
+}
+
+void GLPersistentRingBuffer::Clear()
+{
+    /* Release mapped storage and fences; GL context must still be current */
+    if (buffer_)
+    {
+        buffer_->UnmapBuffer();
+        buffer_.reset();
+    }
+    mappedData_ = nullptr;
+    for_range(i, numSegments)
+    {
+        segmentFences_[i].reset();
+        segmentPending_[i] = false;
+    }
+    segment_        = 0;
+    segmentOffset_  = 0;
+}
+
+bool GLPersistentRingBuffer::IsSupported()
+{
+    #ifdef GL_ARB_buffer_storage
+    return
+    (
+        HasExtension(GLExt::ARB_buffer_storage) &&
+        HasExtension(GLExt::ARB_sync)           &&
+        HasExtension(GLExt::ARB_copy_buffer)
+    );
+    #else
+    return false;
+    #endif
+}
+
+bool GLPersistentRingBuffer::BufferSubData(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data)
+{
+    /* Write data into coherently mapped memory and enqueue copy into destination buffer */
+    GLuint      srcBufferID = 0;
+    GLintptr    srcOffset   = 0;
+    if (!WriteData(size, data, alignment, srcBufferID, srcOffset))
+        return false;
+
+    dstBuffer.CopyBufferSubData(*buffer_, srcOffset, dstOffset, size);
+
+    return true;
+}
+
+bool GLPersistentRingBuffer::WriteData(GLsizeiptr size, const void* data, GLsizeiptr dataAlignment, GLuint& outBufferID, GLintptr& outOffset)
+{
+    /* Data that does not fit into a single segment is not staged */
+    if (size <= 0 || size > segmentSize)
+        return false;
+
+    /* Create persistent storage on first use */
+    if (mappedData_ == nullptr && !CreateStorage())
+        return false;
+
+    /* Move on to next segment if the current one cannot hold the data */
+    GLsizeiptr offset = GetAlignedSize(segmentOffset_, std::max(alignment, dataAlignment));
+    if (offset + size > segmentSize)
+    {
+        if (!AdvanceSegment())
+            return false;
+        offset = 0;
+    }
+
+    /* Write data into coherently mapped memory */
+    outBufferID = buffer_->GetID();
+    outOffset   = static_cast<GLintptr>(segment_) * segmentSize + offset;
+    std::memcpy(mappedData_ + outOffset, data, static_cast<std::size_t>(size));
+
+    segmentOffset_ = offset + size;
+
+    return true;
+}
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLPersistentRingBuffer::CreateStorage()
+{
+    if (!IsSupported())
+        return false;
+
+    #ifdef GL_ARB_buffer_storage
+
+    /* Allocate immutable storage and map it persistently for the entire lifetime of the ring buffer */
+    const GLsizeiptr    storageSize     = static_cast<GLsizeiptr>(numSegments) * segmentSize;
+    const GLbitfield    storageFlags    = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    buffer_ = MakeUnique<GLBuffer>(0, "LLGL.PersistentRingBuffer");
+    buffer_->BufferStorage(storageSize, nullptr, storageFlags, GL_STREAM_DRAW);
+
+    mappedData_ = reinterpret_cast<char*>(buffer_->MapBufferRange(0, storageSize, storageFlags));
+    if (mappedData_ == nullptr)
+    {
+        buffer_.reset();
+        return false;
+    }
+
+    for_range(i, numSegments)
+        segmentFences_[i] = MakeUnique<GLFence>();
+
+    return true;
+
+    #else // GL_ARB_buffer_storage
+
+    return false;
+
+    #endif // /GL_ARB_buffer_storage
+}
+
+bool GLPersistentRingBuffer::AdvanceSegment()
+{
+    /* Fence all commands that read from the current segment */
+    segmentFences_[segment_]->Submit();
+    segmentPending_[segment_] = true;
+
+    /* Move on to next segment and wait until the GPU has consumed it */
+    segment_        = (segment_ + 1) % numSegments;
+    segmentOffset_  = 0;
+
+    if (segmentPending_[segment_])
+    {
+        constexpr GLuint64 infiniteTimeout = ~0ull;
+        if (!segmentFences_[segment_]->Wait(infiniteTimeout))
+            return false;
+        segmentPending_[segment_] = false;
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
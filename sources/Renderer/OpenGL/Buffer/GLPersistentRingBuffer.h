@@ -0,0 +1,100 @@
+/*
+ * GLPersistentRingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PERSISTENT_RING_BUFFER_H
+#define LLGL_GL_PERSISTENT_RING_BUFFER_H
+
+
+#include "../OpenGL.h"
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+class GLFence;
+
+/*
+Ring buffer of persistently and coherently mapped GL buffer storage to stage data for buffer updates.
+Data is written into the mapped memory and then copied into the destination buffer on the GPU timeline,
+which avoids the implicit driver synchronization of glBufferSubData when the destination is still in use.
+The ring is split into segments that are reclaimed via GLFence once the GPU has consumed them.
+*/
+class GLPersistentRingBuffer
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLPersistentRingBuffer& Get();
+
+    public:
+
+        GLPersistentRingBuffer(const GLPersistentRingBuffer&) = delete;
+        GLPersistentRingBuffer& operator = (const GLPersistentRingBuffer&) = delete;
+
+        GLPersistentRingBuffer(GLPersistentRingBuffer&&) = delete;
+        GLPersistentRingBuffer& operator = (GLPersistentRingBuffer&&) = delete;
+
+        // Releases the resource for this singleton class.
+        void Clear();
+
+        // Returns true if the extensions for persistent buffer mapping and fence synchronization are supported.
+        static bool IsSupported();
+
+        /*
+        Stages the specified data in the ring buffer and copies it into the destination buffer.
+        Returns false if the data cannot be staged, in which case the caller must fall back to GLBuffer::BufferSubData.
+        */
+        bool BufferSubData(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data);
+
+        /*
+        Writes the specified data into the ring buffer and returns the buffer ID and offset where the GPU can read it, e.g. with glBindBufferRange.
+        The offset is a multiple of 'dataAlignment'. The data remains valid until the GPU has consumed the segment it was written to.
+        Returns false if the data cannot be staged.
+        */
+        bool WriteData(GLsizeiptr size, const void* data, GLsizeiptr dataAlignment, GLuint& outBufferID, GLintptr& outOffset);
+
+    private:
+
+        GLPersistentRingBuffer();
+        ~GLPersistentRingBuffer();
+
+        bool CreateStorage();
+
+        // Submits the fence of the current segment and moves on to the next one, blocking until the GPU has released it.
+        bool AdvanceSegment();
+
+    private:
+
+        static constexpr std::uint32_t  numSegments = 3;            // Triple buffering
+        static constexpr GLsizeiptr     segmentSize = 1024 * 1024;  // 1 MB per segment
+        static constexpr GLsizeiptr     alignment   = 16;
+
+    private:
+
+        std::unique_ptr<GLBuffer>   buffer_;
+        char*                       mappedData_                     = nullptr;
+        std::unique_ptr<GLFence>    segmentFences_[numSegments];
+        bool                        segmentPending_[numSegments]    = {};
+        std::uint32_t               segment_                        = 0;
+        GLsizeiptr                  segmentOffset_                  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
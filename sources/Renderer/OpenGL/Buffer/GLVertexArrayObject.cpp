@@ -6,13 +6,13 @@
  */
 
 #include "GLVertexArrayObject.h"
+#include "GLVertexInputLayout.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../RenderState/GLStateManager.h"
-#include "../GLTypes.h"
-#include "../GLCore.h"
 #include "../../../Core/Exception.h"
-#include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -27,64 +27,147 @@ GLVertexArrayObject::GLVertexArrayObject()
 
 GLVertexArrayObject::~GLVertexArrayObject()
 {
+    /* Owner of this VAO must notify the state manager about its release */
     if (HasNativeVAO())
-    {
         glDeleteVertexArrays(1, &id_);
-        GLStateManager::Get().NotifyVertexArrayRelease(id_);
-    }
 }
 
-void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute)
+bool GLVertexArrayObject::HasSeparateVertexFormat()
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+    return HasExtension(GLExt::ARB_vertex_attrib_binding);
+    #else
+    return false;
+    #endif
+}
+
+void GLVertexArrayObject::BuildVertexLayout(GLStateManager& stateMngr, const GLVertexInputLayout& layout)
 {
     LLGL_ASSERT_GL_EXT(ARB_vertex_array_object);
 
-    /* Get data type and components of vector type */
-    const FormatAttributes& formatAttribs = GetFormatAttribs(attribute.format);
-    if ((formatAttribs.flags & FormatFlags::SupportsVertex) == 0)
+    for (const GLVertexAttribute& attrib : layout.GetAttribs())
     {
-        if (const char* formatStr = ToString(attribute.format))
-            LLGL_TRAP("LLGL::Format::%s cannot be used for vertex attributes", formatStr);
-        else
-            LLGL_TRAP("unknown format cannot be used for vertex attributes");
+        if (attrib.integer != GL_FALSE)
+            LLGL_ASSERT_GL_EXT(EXT_gpu_shader4, "integral vertex attributes");
+
+        /* Enable array index in currently bound VAO */
+        glEnableVertexAttribArray(attrib.index);
     }
 
-    /* Convert offset to pointer sized type (for 32- and 64 bit builds) */
-    const GLenum        dataType        = GLTypes::Map(formatAttribs.dataType);
-    const GLint         components      = static_cast<GLint>(formatAttribs.components);
-    const GLuint        attribIndex     = static_cast<GLuint>(attribute.location);
-    const GLsizei       stride          = static_cast<GLsizei>(attribute.stride);
-    const GLsizeiptr    offsetPtrSized  = static_cast<GLsizeiptr>(attribute.offset);
+    if (HasSeparateVertexFormat())
+    {
+        BuildVertexFormat(layout);
+        BindVertexBuffers(layout);
+    }
+    else
+        BuildVertexAttribPointers(stateMngr, layout);
+}
 
-    /* Enable array index in currently bound VAO */
-    glEnableVertexAttribArray(attribIndex);
+void GLVertexArrayObject::BindVertexBuffers(const GLVertexInputLayout& layout)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
 
-    /* Set instance divisor */
-    if (attribute.instanceDivisor > 0)
-        glVertexAttribDivisor(attribIndex, attribute.instanceDivisor);
+    const auto& bindings = layout.GetBindings();
 
-    /* Use currently bound VBO for VertexAttribPointer functions */
-    if ((formatAttribs.flags & FormatFlags::IsNormalized) == 0 && !IsFloatFormat(attribute.format))
+    #ifdef GL_ARB_multi_bind
+    if (bindings.size() >= 2 && HasExtension(GLExt::ARB_multi_bind))
     {
-        LLGL_ASSERT_GL_EXT(EXT_gpu_shader4, "integral vertex attributes");
-        glVertexAttribIPointer(
-            attribIndex,
-            components,
-            dataType,
-            stride,
-            reinterpret_cast<const void*>(offsetPtrSized)
-        );
+        /* Bind all vertex buffers at once */
+        constexpr std::size_t maxNumBindings = 16;
+        GLuint      buffers[maxNumBindings];
+        GLintptr    offsets[maxNumBindings];
+        GLsizei     strides[maxNumBindings];
+
+        for (std::size_t first = 0; first < bindings.size(); first += maxNumBindings)
+        {
+            const std::size_t count = std::min(bindings.size() - first, maxNumBindings);
+            for_range(i, count)
+            {
+                buffers[i] = bindings[first + i].buffer;
+                offsets[i] = bindings[first + i].offset;
+                strides[i] = bindings[first + i].stride;
+            }
+            glBindVertexBuffers(static_cast<GLuint>(first), static_cast<GLsizei>(count), buffers, offsets, strides);
+        }
     }
     else
+    #endif // /GL_ARB_multi_bind
     {
-        const GLboolean normalized = GLBoolean((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
-        glVertexAttribPointer(
-            attribIndex,
-            components,
-            dataType,
-            normalized,
-            stride,
-            reinterpret_cast<const void*>(offsetPtrSized)
-        );
+        for_range(i, bindings.size())
+            glBindVertexBuffer(static_cast<GLuint>(i), bindings[i].buffer, bindings[i].offset, bindings[i].stride);
+    }
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexArrayObject::BuildVertexFormat(const GLVertexInputLayout& layout)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    for (const GLVertexAttribute& attrib : layout.GetAttribs())
+    {
+        /* Specify attribute format relative to its vertex buffer binding */
+        if (attrib.integer != GL_FALSE)
+            glVertexAttribIFormat(attrib.index, attrib.size, attrib.type, attrib.offset);
+        else
+            glVertexAttribFormat(attrib.index, attrib.size, attrib.type, attrib.normalized, attrib.offset);
+        glVertexAttribBinding(attrib.index, attrib.bindingIndex);
+    }
+
+    /* Set instance divisor per binding */
+    const auto& bindings = layout.GetBindings();
+    for_range(i, bindings.size())
+    {
+        if (bindings[i].divisor > 0)
+            glVertexBindingDivisor(static_cast<GLuint>(i), bindings[i].divisor);
+    }
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+void GLVertexArrayObject::BuildVertexAttribPointers(GLStateManager& stateMngr, const GLVertexInputLayout& layout)
+{
+    const auto& bindings = layout.GetBindings();
+
+    for (const GLVertexAttribute& attrib : layout.GetAttribs())
+    {
+        const GLVertexBinding& binding = bindings[attrib.bindingIndex];
+
+        /* Set instance divisor */
+        if (binding.divisor > 0)
+            glVertexAttribDivisor(attrib.index, binding.divisor);
+
+        /* Use currently bound VBO for VertexAttribPointer functions; convert offset to pointer sized type (for 32- and 64 bit builds) */
+        stateMngr.BindBuffer(GLBufferTarget::ArrayBuffer, binding.buffer);
+
+        const GLsizeiptr offsetPtrSized = static_cast<GLsizeiptr>(binding.offset) + static_cast<GLsizeiptr>(attrib.offset);
+
+        if (attrib.integer != GL_FALSE)
+        {
+            glVertexAttribIPointer(
+                attrib.index,
+                attrib.size,
+                attrib.type,
+                binding.stride,
+                reinterpret_cast<const void*>(offsetPtrSized)
+            );
+        }
+        else
+        {
+            glVertexAttribPointer(
+                attrib.index,
+                attrib.size,
+                attrib.type,
+                attrib.normalized,
+                binding.stride,
+                reinterpret_cast<const void*>(offsetPtrSized)
+            );
+        }
     }
 }
 
@@ -16,7 +16,8 @@ namespace LLGL
 {
 
 
-struct VertexAttribute;
+class GLStateManager;
+class GLVertexInputLayout;
 
 // Wrapper class for an OpenGL Vertex-Array-Object (VAO), for GL 3.0+.
 class GLVertexArrayObject
@@ -27,8 +28,20 @@ class GLVertexArrayObject
         GLVertexArrayObject();
         ~GLVertexArrayObject();
 
-        // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
-        void BuildVertexAttribute(const VertexAttribute& attribute);
+        GLVertexArrayObject(const GLVertexArrayObject&) = delete;
+        GLVertexArrayObject& operator = (const GLVertexArrayObject&) = delete;
+
+        // Returns true if vertex formats can be specified separately from their vertex buffers (GL_ARB_vertex_attrib_binding).
+        static bool HasSeparateVertexFormat();
+
+        /*
+        Builds all vertex attributes of the specified layout. This VAO must be bound.
+        With separate vertex formats, the vertex buffers are bound via BindVertexBuffers, otherwise they are captured with 'glVertexAttrib*Pointer'.
+        */
+        void BuildVertexLayout(GLStateManager& stateMngr, const GLVertexInputLayout& layout);
+
+        // Binds the vertex buffers of the specified layout. This VAO must be bound and must have been built with a separate vertex format.
+        void BindVertexBuffers(const GLVertexInputLayout& layout);
 
         // Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
@@ -36,6 +49,11 @@ class GLVertexArrayObject
             return id_;
         }
 
+    private:
+
+        void BuildVertexFormat(const GLVertexInputLayout& layout);
+        void BuildVertexAttribPointers(GLStateManager& stateMngr, const GLVertexInputLayout& layout);
+
     private:
 
         GLuint id_ = 0; //!< Vertex array object ID.
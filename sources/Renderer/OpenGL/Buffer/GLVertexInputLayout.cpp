@@ -0,0 +1,129 @@
+/*
+ * GLVertexInputLayout.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexInputLayout.h"
+#include "../GLTypes.h"
+#include "../GLCore.h"
+#include "../../../Core/MacroUtils.h"
+#include "../../../Core/Exception.h"
+#include <LLGL/VertexAttribute.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static GLVertexAttribute ConvertVertexAttribute(GLuint bindingIndex, const VertexAttribute& attribute)
+{
+    /* Get data type and components of vector type */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(attribute.format);
+    if ((formatAttribs.flags & FormatFlags::SupportsVertex) == 0)
+    {
+        if (const char* formatStr = ToString(attribute.format))
+            LLGL_TRAP("LLGL::Format::%s cannot be used for vertex attributes", formatStr);
+        else
+            LLGL_TRAP("unknown format cannot be used for vertex attributes");
+    }
+
+    const bool isNormalized = ((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
+
+    GLVertexAttribute attributeGL;
+    {
+        attributeGL.bindingIndex    = bindingIndex;
+        attributeGL.index           = static_cast<GLuint>(attribute.location);
+        attributeGL.size            = static_cast<GLint>(formatAttribs.components);
+        attributeGL.type            = GLTypes::Map(formatAttribs.dataType);
+        attributeGL.normalized      = GLBoolean(isNormalized);
+        attributeGL.integer         = GLBoolean(!isNormalized && !IsFloatFormat(attribute.format));
+        attributeGL.offset          = static_cast<GLuint>(attribute.offset);
+    }
+    return attributeGL;
+}
+
+void GLVertexInputLayout::AppendBuffer(GLuint bufferID, const std::vector<VertexAttribute>& attribs)
+{
+    const GLuint bindingIndex = static_cast<GLuint>(bindings_.size());
+
+    /* All attributes of the same buffer share their stride and instance divisor */
+    GLVertexBinding binding;
+    {
+        binding.buffer  = bufferID;
+        binding.stride  = (attribs.empty() ? 0 : static_cast<GLsizei>(attribs.front().stride));
+        binding.divisor = (attribs.empty() ? 0 : static_cast<GLuint>(attribs.front().instanceDivisor));
+        binding.offset  = 0;
+    }
+    bindings_.push_back(binding);
+
+    for (const VertexAttribute& attrib : attribs)
+        attribs_.push_back(ConvertVertexAttribute(bindingIndex, attrib));
+}
+
+void GLVertexInputLayout::AssignWithOffsets(const GLVertexInputLayout& layout, std::size_t numOffsets, const std::uint64_t* offsets)
+{
+    attribs_    = layout.attribs_;
+    bindings_   = layout.bindings_;
+    for_range(i, std::min(numOffsets, bindings_.size()))
+        bindings_[i].offset = static_cast<GLintptr>(offsets[i]);
+}
+
+static int CompareVertexAttributeSWO(const GLVertexAttribute& lhs, const GLVertexAttribute& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO( bindingIndex );
+    LLGL_COMPARE_MEMBER_SWO( index        );
+    LLGL_COMPARE_MEMBER_SWO( size         );
+    LLGL_COMPARE_MEMBER_SWO( type         );
+    LLGL_COMPARE_MEMBER_SWO( normalized   );
+    LLGL_COMPARE_MEMBER_SWO( integer      );
+    LLGL_COMPARE_MEMBER_SWO( offset       );
+    return 0;
+}
+
+int GLVertexInputLayout::CompareFormatSWO(const GLVertexInputLayout& lhs, const GLVertexInputLayout& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO( attribs_.size()  );
+    LLGL_COMPARE_MEMBER_SWO( bindings_.size() );
+
+    for_range(i, lhs.attribs_.size())
+    {
+        const int order = CompareVertexAttributeSWO(lhs.attribs_[i], rhs.attribs_[i]);
+        if (order != 0)
+            return order;
+    }
+
+    for_range(i, lhs.bindings_.size())
+    {
+        LLGL_COMPARE_MEMBER_SWO( bindings_[i].stride  );
+        LLGL_COMPARE_MEMBER_SWO( bindings_[i].divisor );
+    }
+
+    return 0;
+}
+
+int GLVertexInputLayout::CompareSWO(const GLVertexInputLayout& lhs, const GLVertexInputLayout& rhs)
+{
+    const int order = GLVertexInputLayout::CompareFormatSWO(lhs, rhs);
+    if (order != 0)
+        return order;
+
+    for_range(i, lhs.bindings_.size())
+    {
+        LLGL_COMPARE_MEMBER_SWO( bindings_[i].buffer );
+        LLGL_COMPARE_MEMBER_SWO( bindings_[i].offset );
+    }
+
+    return 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * GLVertexInputLayout.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_INPUT_LAYOUT_H
+#define LLGL_GL_VERTEX_INPUT_LAYOUT_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+struct VertexAttribute;
+
+// Vertex attribute translated into GL parameters.
+struct GLVertexAttribute
+{
+    GLuint      bindingIndex;   // Index of the vertex buffer within the input layout
+    GLuint      index;          // Vertex attribute location
+    GLint       size;           // Number of components
+    GLenum      type;
+    GLboolean   normalized;
+    GLboolean   integer;        // Attribute is specified with glVertexAttribIPointer/glVertexAttribIFormat
+    GLuint      offset;
+};
+
+// Vertex buffer binding of a vertex input layout.
+struct GLVertexBinding
+{
+    GLuint      buffer;
+    GLsizei     stride;
+    GLuint      divisor;
+    GLintptr    offset;         // Offset (in bytes) of the first vertex within the buffer
+};
+
+/*
+Vertex attributes and vertex buffers that are bound together, i.e. a single vertex buffer or a vertex buffer array.
+This serves as key for the VAO cache in GLStateManager.
+*/
+class GLVertexInputLayout
+{
+
+    public:
+
+        // Appends the specified vertex buffer with its vertex attributes as next binding.
+        void AppendBuffer(GLuint bufferID, const std::vector<VertexAttribute>& attribs);
+
+        // Copies the specified layout and replaces the offsets of its first bindings by the specified offsets (in bytes).
+        void AssignWithOffsets(const GLVertexInputLayout& layout, std::size_t numOffsets, const std::uint64_t* offsets);
+
+        // Returns the list of vertex attributes.
+        inline const std::vector<GLVertexAttribute>& GetAttribs() const
+        {
+            return attribs_;
+        }
+
+        // Returns the list of vertex buffer bindings.
+        inline const std::vector<GLVertexBinding>& GetBindings() const
+        {
+            return bindings_;
+        }
+
+    public:
+
+        // Compares the vertex format of both layouts, i.e. all attributes and binding strides and divisors but not the buffers, in a strict-weak-order (SWO).
+        static int CompareFormatSWO(const GLVertexInputLayout& lhs, const GLVertexInputLayout& rhs);
+
+        // Compares the vertex format and vertex buffers of both layouts in a strict-weak-order (SWO).
+        static int CompareSWO(const GLVertexInputLayout& lhs, const GLVertexInputLayout& rhs);
+
+    private:
+
+        std::vector<GLVertexAttribute>  attribs_;
+        std::vector<GLVertexBinding>    bindings_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
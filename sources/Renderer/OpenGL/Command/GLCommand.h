@@ -12,9 +12,11 @@
 #include <LLGL/CommandBufferFlags.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Types.h>
 #include "../RenderState/GLState.h"
 #include "../GLProfile.h"
+#include "../../BufferUtils.h"
 #include <cstdint>
 
 
@@ -27,11 +29,13 @@ class GLBuffer;
 class GLTexture;
 class GLResourceHeap;
 class GLPipelineState;
+class GLUniformBlockStorage;
 class GLQueryHeap;
 class GLSwapChain;
 class GLRenderTarget;
 class GLRenderPass;
 class GLDeferredCommandBuffer;
+class GLVertexInputLayout;
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 class GL2XVertexArray;
 class GL2XSampler;
@@ -69,6 +73,32 @@ struct GLCmdClearBufferSubData
     std::uint32_t   data;
 };
 
+struct GLCmdClearBufferSubDataElement
+{
+    GLBuffer*       buffer;
+    GLintptr        offset;
+    GLsizeiptr      size;
+    std::uint32_t   elementSize;
+    std::uint8_t    element[g_maxClearElementSize];
+};
+
+struct GLCmdClearTexSubImage
+{
+    GLTexture*          texture;
+    TextureSubresource  subresource;
+    ClearValue          clearValue;
+};
+
+struct GLCmdInvalidateBufferData
+{
+    GLBuffer* buffer;
+};
+
+struct GLCmdInvalidateTexImage
+{
+    GLTexture* texture;
+};
+
 struct GLCmdCopyImageSubData
 {
     GLTexture*  dstTexture;
@@ -115,6 +145,12 @@ struct GLCmdGenerateMipmapSubresource
     std::uint32_t   numArrayLayers;
 };
 
+struct GLCmdGenerateMipmapArray
+{
+    std::uint32_t   numTextures;
+//  Texture*        textures[numTextures];
+};
+
 struct GLCmdExecute
 {
     const GLDeferredCommandBuffer* commandBuffer;
@@ -173,15 +209,22 @@ struct GLCmdClearAttachmentsWithRenderPass
 //  const ClearValue*   clearValues[numClearValues];
 };
 
+struct GLCmdInvalidateAttachmentsWithRenderPass
+{
+    const GLRenderPass* renderPass;
+};
+
 struct GLCmdClearBuffers
 {
     std::uint32_t   numAttachments;
 //  AttachmentClear attachments[numAttachments];
 };
 
-struct GLCmdBindVertexArray
+struct GLCmdBindVertexInputLayout
 {
-    GLuint vao;
+    const GLVertexInputLayout*  vertexInputLayout;
+    std::uint32_t               numOffsets;
+//  std::uint64_t               offsets[numOffsets];
 };
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -204,6 +247,15 @@ struct GLCmdBindBufferBase
     GLuint          id;
 };
 
+struct GLCmdBindBufferRange
+{
+    GLBufferTarget  target;
+    GLuint          index;
+    GLuint          id;
+    GLintptr        offset;
+    GLsizeiptr      size;
+};
+
 struct GLCmdBindBuffersBase
 {
     GLBufferTarget  target;
@@ -253,6 +305,26 @@ struct GLCmdSetStencilRef
     GLenum  face;
 };
 
+struct GLCmdSetCullMode
+{
+    CullMode cullMode;
+};
+
+struct GLCmdSetDepthBias
+{
+    DepthBiasDescriptor depthBias;
+};
+
+struct GLCmdSetDepthState
+{
+    DepthDescriptor depth;
+};
+
+struct GLCmdSetStencilState
+{
+    StencilDescriptor stencil;
+};
+
 struct GLCmdSetUniforms
 {
     GLuint      program;
@@ -263,6 +335,13 @@ struct GLCmdSetUniforms
 //  GLuint      buffer[size];
 };
 
+struct GLCmdBindUniformBlocks
+{
+    const GLUniformBlockStorage*    storage;
+    GLsizeiptr                      size;
+//  char                            data[size];
+};
+
 struct GLCmdBeginQuery
 {
     GLQueryHeap*    queryHeap;
@@ -271,7 +350,17 @@ struct GLCmdBeginQuery
 
 struct GLCmdEndQuery
 {
-    GLQueryHeap* queryHeap;
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   query;
+};
+
+struct GLCmdResolveQueryData
+{
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   firstQuery;
+    std::uint32_t   numQueries;
+    GLuint          dstBuffer;
+    GLintptr        dstOffset;
 };
 
 struct GLCmdBeginConditionalRender
@@ -332,6 +421,16 @@ struct GLCmdDrawElementsBaseVertex
     GLint           basevertex;
 };
 
+struct GLCmdMultiDrawElementsBaseVertex
+{
+    GLenum          mode;
+    GLenum          type;
+    GLsizei         drawcount;
+//  const GLvoid*   indices[drawcount];
+//  GLsizei         counts[drawcount];
+//  GLint           basevertices[drawcount];
+};
+
 struct GLCmdDrawElementsInstanced
 {
     GLenum          mode;
@@ -391,6 +490,29 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArraysIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawElementsIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    GLenum          type;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
 struct GLCmdDispatchCompute
 {
     GLuint numgroups[3];
@@ -13,148 +13,146 @@
 #include "GLDeferredCommandBuffer.h"
 #include "../../../JIT/JITCompiler.h"
 
-#include "../GLSwapChain.h"
 #include "../GLTypes.h"
 #include "../GLCore.h"
+#include "../GLProfile.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
-#include "../../CheckedCast.h"
-#include "../../../Core/Assertion.h"
 
-#include "../Shader/GLShaderProgram.h"
 #include "../Shader/GLShaderUniform.h"
 
-#include "../Texture/GLTexture.h"
-#include "../Texture/GLMipGenerator.h"
-#include "../Texture/GLFramebufferCapture.h"
-#ifdef LLGL_GL_ENABLE_OPENGL2X
-#   include "../Texture/GL2XSampler.h"
-#endif
+#include "../RenderState/GLStateManager.h"
 
-#include "../Buffer/GLBufferWithVAO.h"
-#include "../Buffer/GLBufferArrayWithVAO.h"
 
-#include "../RenderState/GLStateManager.h"
-#include "../RenderState/GLGraphicsPSO.h"
-#include "../RenderState/GLResourceHeap.h"
-#include "../RenderState/GLRenderPass.h"
-#include "../RenderState/GLQueryHeap.h"
+namespace LLGL
+{
 
-#include <algorithm>
 
+/* Declare index of variadic argument of entry point and index of stack allocation for the active state manager */
+static const JITVarArg      g_stateMngrArg{ 0 };
+static const JITStackPtr    g_stateMngrRef{ 0 };
 
-namespace LLGL
+// Initializes the reference to the active state manager in the local stack of the JIT program.
+static void InitGLStateManagerRef(GLStateManager** stateMngrRef, GLStateManager* stateMngr)
 {
+    *stateMngrRef = stateMngr;
+}
 
+// Executes a single GL command from the JIT program with the active state manager, which might be switched by the command.
+static void ExecuteGLCommandWithStateManagerRef(GLStateManager** stateMngrRef, const void* pc, std::uint32_t opcode)
+{
+    ExecuteGLCommand(static_cast<GLOpcode>(opcode), pc, *stateMngrRef);
+}
 
-static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITCompiler& compiler)
+// Generates a call to the command executor. This is used for all commands that depend on the state manager or on class member functions.
+static void AssembleGLCommandExecutorCall(JITCompiler& compiler, const GLOpcode opcode, const void* pc)
 {
-    /* Declare index of variadic argument of entry point */
-    static const JITVarArg g_stateMngrArg{ 0 };
+    compiler.Call(ExecuteGLCommandWithStateManagerRef, g_stateMngrRef, pc, static_cast<std::uint32_t>(opcode));
+}
 
-    /* Generate native CPU opcodes for emulated GLOpcode */
+// Generates native CPU opcodes for the specified GLOpcode and returns the size (in bytes) of the command arguments; must match 'ExecuteGLCommand'.
+static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITCompiler& compiler)
+{
     switch (opcode)
     {
         case GLOpcodeBufferSubData:
         {
             auto cmd = reinterpret_cast<const GLCmdBufferSubData*>(pc);
-            compiler.CallMember(&GLBuffer::BufferSubData, cmd->buffer, cmd->offset, cmd->size, (cmd + 1));
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeCopyBufferSubData:
         {
-            auto cmd = reinterpret_cast<const GLCmdCopyBufferSubData*>(pc);
-            compiler.CallMember(&GLBuffer::CopyBufferSubData, cmd->writeBuffer, cmd->readBuffer, cmd->readOffset, cmd->writeOffset, cmd->size);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdCopyBufferSubData);
         }
         case GLOpcodeClearBufferData:
         {
-            auto cmd = reinterpret_cast<const GLCmdClearBufferData*>(pc);
-            compiler.CallMember(&GLBuffer::ClearBufferData, cmd->buffer, cmd->data);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdClearBufferData);
         }
         case GLOpcodeClearBufferSubData:
         {
-            auto cmd = reinterpret_cast<const GLCmdClearBufferSubData*>(pc);
-            compiler.CallMember(&GLBuffer::ClearBufferSubData, cmd->buffer, cmd->offset, cmd->size, cmd->data);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdClearBufferSubData);
         }
-        case GLOpcodeCopyImageSubData:
+        case GLOpcodeClearBufferSubDataElement:
         {
-            auto cmd = reinterpret_cast<const GLCmdCopyImageSubData*>(pc);
-            compiler.CallMember(&GLTexture::CopyImageSubData, cmd->dstTexture, cmd->dstLevel, &(cmd->dstOffset), cmd->srcTexture, cmd->srcLevel, &(cmd->srcOffset), &(cmd->extent));
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdClearBufferSubDataElement);
         }
-        case GLOpcodeCopyImageToBuffer:
+        case GLOpcodeClearTexSubImage:
         {
-            auto cmd = reinterpret_cast<const GLCmdCopyImageBuffer*>(pc);
-            compiler.CallMember(&GLTexture::CopyImageToBuffer, cmd->texture, &(cmd->region), cmd->bufferID, cmd->offset, cmd->size, cmd->rowLength, cmd->imageHeight);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdClearTexSubImage);
+        }
+        case GLOpcodeInvalidateBufferData:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdInvalidateBufferData);
+        }
+        case GLOpcodeInvalidateTexImage:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdInvalidateTexImage);
+        }
+        case GLOpcodeCopyImageSubData:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdCopyImageSubData);
         }
+        case GLOpcodeCopyImageToBuffer:
         case GLOpcodeCopyImageFromBuffer:
         {
-            auto cmd = reinterpret_cast<const GLCmdCopyImageBuffer*>(pc);
-            compiler.CallMember(&GLTexture::CopyImageFromBuffer, cmd->texture, &(cmd->region), cmd->bufferID, cmd->offset, cmd->size, cmd->rowLength, cmd->imageHeight);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdCopyImageBuffer);
         }
         case GLOpcodeCopyFramebufferSubData:
         {
-            auto cmd = reinterpret_cast<const GLCmdCopyFramebufferSubData*>(pc);
-            compiler.CallMember(&GLFramebufferCapture::CaptureFramebuffer, &(GLFramebufferCapture::Get()), g_stateMngrArg, cmd->dstTexture, cmd->dstLevel, &(cmd->dstOffset), &(cmd->srcOffset), &(cmd->extent));
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdCopyFramebufferSubData);
         }
         case GLOpcodeGenerateMipmap:
         {
-            auto cmd = reinterpret_cast<const GLCmdGenerateMipmap*>(pc);
-            compiler.CallMember(&GLMipGenerator::GenerateMipsForTexture, &(GLMipGenerator::Get()), g_stateMngrArg, cmd->texture);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdGenerateMipmap);
         }
         case GLOpcodeGenerateMipmapSubresource:
         {
-            auto cmd = reinterpret_cast<const GLCmdGenerateMipmapSubresource*>(pc);
-            compiler.CallMember(&GLMipGenerator::GenerateMipsRangeForTexture, &(GLMipGenerator::Get()), g_stateMngrArg, cmd->texture, cmd->baseMipLevel, cmd->numMipLevels, cmd->baseArrayLayer, cmd->numArrayLayers);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdGenerateMipmapSubresource);
+        }
+        case GLOpcodeGenerateMipmapArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdGenerateMipmapArray*>(pc);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(Texture*)*cmd->numTextures);
         }
         case GLOpcodeExecute:
         {
-            auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
-            compiler.Call(ExecuteGLDeferredCommandBuffer, cmd->commandBuffer, g_stateMngrArg);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdExecute);
         }
         case GLOpcodeViewport:
         {
-            auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
-            {
-                compiler.CallMember(&GLStateManager::SetViewport, g_stateMngrArg, &(cmd->viewport));
-                compiler.CallMember(&GLStateManager::SetDepthRange, g_stateMngrArg, &(cmd->depthRange));
-            }
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdViewport);
         }
         case GLOpcodeViewportArray:
         {
             auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
-            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
-            {
-                compiler.CallMember(&GLStateManager::SetViewportArray, g_stateMngrArg, cmd->first, cmd->count, cmdData);
-                compiler.CallMember(&GLStateManager::SetDepthRangeArray, g_stateMngrArg, cmd->first, cmd->count, (cmdData + sizeof(GLViewport)*cmd->count));
-            }
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
         }
         case GLOpcodeScissor:
         {
-            auto cmd = reinterpret_cast<const GLCmdScissor*>(pc);
-            {
-                compiler.CallMember(&GLStateManager::SetScissor, g_stateMngrArg, &(cmd->scissor));
-            }
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdScissor);
         }
         case GLOpcodeScissorArray:
         {
             auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
-            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
-            {
-                compiler.CallMember(&GLStateManager::SetScissorArray, g_stateMngrArg, cmd->first, cmd->count, cmdData);
-            }
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
         }
         case GLOpcodeClearColor:
@@ -177,141 +175,172 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         }
         case GLOpcodeClear:
         {
-            auto cmd = reinterpret_cast<const GLCmdClear*>(pc);
-            compiler.CallMember(&GLStateManager::Clear, g_stateMngrArg, cmd->flags);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdClear);
         }
         case GLOpcodeClearAttachmentsWithRenderPass:
         {
             auto cmd = reinterpret_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc);
-            compiler.CallMember(&GLStateManager::ClearAttachmentsWithRenderPass, g_stateMngrArg, cmd->renderPass, cmd->numClearValues, (cmd + 1));
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
         }
+        case GLOpcodeInvalidateAttachmentsWithRenderPass:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdInvalidateAttachmentsWithRenderPass);
+        }
         case GLOpcodeClearBuffers:
         {
             auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
-            compiler.CallMember(&GLStateManager::ClearBuffers, g_stateMngrArg, cmd->numAttachments, (cmd + 1));
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
         }
-        case GLOpcodeBindVertexArray:
+        case GLOpcodeBindVertexInputLayout:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
-            return sizeof(*cmd);
+            auto cmd = reinterpret_cast<const GLCmdBindVertexInputLayout*>(pc);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return (sizeof(*cmd) + sizeof(std::uint64_t)*cmd->numOffsets);
         }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         case GLOpcodeBindGL2XVertexArray:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindGL2XVertexArray*>(pc);
-            compiler.CallMember(&GL2XVertexArray::Bind, cmd->vertexArrayGL2X, g_stateMngrArg);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindGL2XVertexArray);
         }
         #endif
         case GLOpcodeBindElementArrayBufferToVAO:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
-            compiler.CallMember(&GLStateManager::BindElementArrayBufferToVAO, g_stateMngrArg, cmd->id, cmd->indexType16Bits);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindElementArrayBufferToVAO);
         }
         case GLOpcodeBindBufferBase:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindBufferBase*>(pc);
-            compiler.CallMember(&GLStateManager::BindBufferBase, g_stateMngrArg, cmd->target, cmd->index, cmd->id);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindBufferBase);
         }
         case GLOpcodeBindBuffersBase:
         {
             auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffersBase, g_stateMngrArg, cmd->target, cmd->first, cmd->count, (cmd + 1));
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
         }
+        case GLOpcodeBindBufferRange:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindBufferRange);
+        }
         case GLOpcodeBeginTransformFeedback:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedback*>(pc);
             compiler.Call(glBeginTransformFeedback, cmd->primitiveMove);
             return sizeof(*cmd);
         }
-        #ifdef GL_NV_transform_feedback
         case GLOpcodeBeginTransformFeedbackNV:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedbackNV*>(pc);
+            #ifdef GL_NV_transform_feedback
             compiler.Call(glBeginTransformFeedbackNV, cmd->primitiveMove);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_NV_transform_feedback
         case GLOpcodeEndTransformFeedback:
         {
             compiler.Call(glEndTransformFeedback);
             return 0;
         }
-        #ifdef GL_NV_transform_feedback
         case GLOpcodeEndTransformFeedbackNV:
         {
+            #ifdef GL_NV_transform_feedback
             compiler.Call(glEndTransformFeedbackNV);
+            #endif
             return 0;
         }
-        #endif // /GL_NV_transform_feedback
         case GLOpcodeBindResourceHeap:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindResourceHeap*>(pc);
-            compiler.CallMember(&GLResourceHeap::Bind, cmd->resourceHeap, g_stateMngrArg, cmd->descriptorSet);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindResourceHeap);
         }
         case GLOpcodeBindRenderTarget:
         {
-            //TODO: update reference to GLStateManager; find better way to update g_stateMngrArg (2nd parameter)
-            auto cmd = reinterpret_cast<const GLCmdBindRenderTarget*>(pc);
-            compiler.CallMember(&GLStateManager::BindRenderTarget, g_stateMngrArg, cmd->renderTarget, nullptr);
-            return sizeof(*cmd);
+            /* Binding a render target can switch the active state manager, which is tracked by the command executor */
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindRenderTarget);
         }
         case GLOpcodeBindPipelineState:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindPipelineState*>(pc);
-            if (cmd->pipelineState->IsGraphicsPSO())
-                compiler.CallMember(&GLGraphicsPSO::Bind, cmd->pipelineState, g_stateMngrArg);
-            else
-                compiler.CallMember(&GLPipelineState::Bind, cmd->pipelineState, g_stateMngrArg);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindPipelineState);
         }
         case GLOpcodeSetBlendColor:
         {
-            auto cmd = reinterpret_cast<const GLCmdSetBlendColor*>(pc);
-            compiler.CallMember(&GLStateManager::SetBlendColor, g_stateMngrArg, cmd->color);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetBlendColor);
         }
         case GLOpcodeSetStencilRef:
         {
-            auto cmd = reinterpret_cast<const GLCmdSetStencilRef*>(pc);
-            compiler.CallMember(&GLStateManager::SetStencilRef, g_stateMngrArg, cmd->ref, cmd->face);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetStencilRef);
+        }
+        case GLOpcodeSetCullMode:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetCullMode);
+        }
+        case GLOpcodeSetDepthBias:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetDepthBias);
+        }
+        case GLOpcodeSetDepthState:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetDepthState);
+        }
+        case GLOpcodeSetStencilState:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdSetStencilState);
         }
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            compiler.Call(GLSetUniformsByType, cmd->type, cmd->location, cmd->count, (cmd + 1));
+            compiler.Call(GLSetUniformsByType, cmd->type, cmd->location, cmd->count, reinterpret_cast<const void*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeBindUniformBlocks:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindUniformBlocks*>(pc);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
         {
-            auto cmd = reinterpret_cast<const GLCmdBeginQuery*>(pc);
-            compiler.CallMember(&GLQueryHeap::Begin, cmd->queryHeap, cmd->query);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBeginQuery);
         }
         case GLOpcodeEndQuery:
         {
-            auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
-            compiler.CallMember(&GLQueryHeap::End, cmd->queryHeap);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdEndQuery);
+        }
+        case GLOpcodeResolveQueryData:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdResolveQueryData);
         }
         case GLOpcodeBeginConditionalRender:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginConditionalRender*>(pc);
+            #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
             compiler.Call(glBeginConditionalRender, cmd->id, cmd->mode);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeEndConditionalRender:
         {
+            #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
             compiler.Call(glEndConditionalRender);
+            #endif
             return 0;
         }
         case GLOpcodeDrawArrays:
@@ -326,26 +355,18 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.Call(glDrawArraysInstanced, cmd->mode, cmd->first, cmd->count, cmd->instancecount);
             return sizeof(*cmd);
         }
-        #ifdef GL_ARB_base_instance
         case GLOpcodeDrawArraysInstancedBaseInstance:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
+            #ifdef LLGL_GLEXT_BASE_INSTANCE
             compiler.Call(glDrawArraysInstancedBaseInstance, cmd->mode, cmd->first, cmd->count, cmd->instancecount, cmd->baseinstance);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_base_instance
         case GLOpcodeDrawArraysIndirect:
         {
-            //TODO: generate loop in ASM
-            auto cmd = reinterpret_cast<const GLCmdDrawArraysIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
-            GLintptr offset = cmd->indirect;
-            for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
-            {
-                compiler.Call(glDrawArraysIndirect, cmd->mode, reinterpret_cast<const GLvoid*>(offset));
-                offset += cmd->stride;
-            }
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdDrawArraysIndirect);
         }
         case GLOpcodeDrawElements:
         {
@@ -356,9 +377,23 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeDrawElementsBaseVertex:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+            #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
             compiler.Call(glDrawElementsBaseVertex, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+            #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            const std::size_t drawcount = static_cast<std::size_t>(cmd->drawcount);
+            #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+            auto indices        = reinterpret_cast<const GLvoid* const*>(cmd + 1);
+            auto counts         = reinterpret_cast<const GLsizei*>(indices + drawcount);
+            auto baseVertices   = reinterpret_cast<const GLint*>(counts + drawcount);
+            compiler.Call(glMultiDrawElementsBaseVertex, cmd->mode, counts, cmd->type, indices, cmd->drawcount, baseVertices);
+            #endif
+            return (sizeof(*cmd) + drawcount * (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint)));
+        }
         case GLOpcodeDrawElementsInstanced:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
@@ -368,88 +403,77 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeDrawElementsInstancedBaseVertex:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+            #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
             compiler.Call(glDrawElementsInstancedBaseVertex, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+            #endif
             return sizeof(*cmd);
         }
-        #ifdef GL_ARB_base_instance
         case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            #ifdef LLGL_GLEXT_BASE_INSTANCE
             compiler.Call(glDrawElementsInstancedBaseVertexBaseInstance, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex, cmd->baseinstance);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_base_instance
         case GLOpcodeDrawElementsIndirect:
         {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsIndirect*>(pc);
-            {
-                //TODO: generate loop in ASM
-                compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
-                GLintptr offset = cmd->indirect;
-                for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
-                {
-                    compiler.Call(glDrawElementsIndirect, cmd->mode, cmd->type, reinterpret_cast<const GLvoid*>(offset));
-                    offset += cmd->stride;
-                }
-            }
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdDrawElementsIndirect);
         }
-        #ifdef GL_ARB_multi_draw_indirect
         case GLOpcodeMultiDrawArraysIndirect:
         {
-            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
-            compiler.Call(glMultiDrawArraysIndirect, cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdMultiDrawArraysIndirect);
         }
         case GLOpcodeMultiDrawElementsIndirect:
         {
-            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
-            compiler.Call(glMultiDrawElementsIndirect, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdMultiDrawElementsIndirect);
+        }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdMultiDrawArraysIndirectCount);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdMultiDrawElementsIndirectCount);
         }
-        #endif // /GL_ARB_multi_draw_indirect
-        #ifdef GL_ARB_compute_shader
         case GLOpcodeDispatchCompute:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
+            #ifdef LLGL_GLEXT_COMPUTE_SHADER
             compiler.Call(glDispatchCompute, cmd->numgroups[0], cmd->numgroups[1], cmd->numgroups[2]);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeDispatchComputeIndirect:
         {
-            auto cmd = reinterpret_cast<const GLCmdDispatchComputeIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DispatchIndirectBuffer, cmd->id);
-            compiler.Call(glDispatchComputeIndirect, cmd->indirect);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdDispatchComputeIndirect);
         }
-        #endif // /GL_ARB_compute_shader
         case GLOpcodeBindTexture:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
-            compiler.CallMember(&GLStateManager::ActiveTexture, g_stateMngrArg, cmd->slot);
-            compiler.CallMember(&GLStateManager::BindGLTexture, g_stateMngrArg, cmd->texture);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindTexture);
         }
         case GLOpcodeBindImageTexture:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindImageTexture*>(pc);
-            compiler.CallMember(&GLStateManager::BindImageTexture, g_stateMngrArg, cmd->unit, cmd->level, cmd->format, cmd->texture);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindImageTexture);
         }
         case GLOpcodeBindSampler:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindSampler*>(pc);
-            compiler.CallMember(&GLStateManager::BindSampler, g_stateMngrArg, cmd->layer, cmd->sampler);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindSampler);
         }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         case GLOpcodeBindGL2XSampler:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindGL2XSampler*>(pc);
-            compiler.CallMember(&GLStateManager::BindGL2XSampler, g_stateMngrArg, cmd->layer, cmd->samplerGL2X);
-            return sizeof(*cmd);
+            AssembleGLCommandExecutorCall(compiler, opcode, pc);
+            return sizeof(GLCmdBindGL2XSampler);
         }
         #endif
         #ifdef LLGL_GLEXT_MEMORY_BARRIERS
@@ -460,36 +484,26 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             return sizeof(*cmd);
         }
         #endif
-        #ifdef GL_KHR_debug
         case GLOpcodePushDebugGroup:
         {
             auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
+            #ifdef LLGL_GLEXT_DEBUG
             compiler.Call(glPushDebugGroup, cmd->source, cmd->id, cmd->length, reinterpret_cast<const GLchar*>(cmd + 1));
+            #endif
             return (sizeof(*cmd) + cmd->length + 1);
         }
         case GLOpcodePopDebugGroup:
         {
+            #ifdef LLGL_GLEXT_DEBUG
             compiler.Call(glPopDebugGroup);
+            #endif
             return 0;
         }
-        #endif // /GL_KHR_debug
         default:
             return 0;
     }
 }
 
-// Determines the maximum requried stack size to execute the specified command buffer natively
-static std::size_t RequiredLocalStackSize(const GLDeferredCommandBuffer& cmdBuffer)
-{
-    std::size_t maxSize = 0;
-
-    maxSize = cmdBuffer.GetMaxNumViewports() * sizeof(GLViewport);
-    maxSize = std::max(maxSize, cmdBuffer.GetMaxNumViewports() * sizeof(GLDepthRange));
-    maxSize = std::max(maxSize, cmdBuffer.GetMaxNumScissors() * sizeof(GLScissor));
-
-    return maxSize;
-}
-
 std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer)
 {
     /* Try to create a JIT-compiler for the active architecture (if supported) */
@@ -498,14 +512,14 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
         /* Declare variadic arguments for entry point of JIT program */
         compiler->EntryPointVarArgs({ JIT::ArgType::Ptr });
 
-        /* Declare stack allocation for temporary storage (viewports and scissors) */
-        auto stackSize = static_cast<std::uint32_t>(RequiredLocalStackSize(cmdBuffer));
-        if (stackSize > 0)
-            compiler->StackAlloc(stackSize);
+        /* Declare stack allocation for the reference to the active state manager */
+        compiler->StackAlloc(sizeof(GLStateManager*));
 
         /* Assemble GL commands into JIT program */
         compiler->Begin();
 
+        compiler->Call(InitGLStateManagerRef, g_stateMngrRef, g_stateMngrArg);
+
         /* Initialize program counter to execute virtual GL commands */
         const auto& virtualCmdBuffer = cmdBuffer.GetVirtualCommandBuffer();
 
@@ -527,7 +541,7 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
 
         compiler->End();
 
-        /* Build final program */
+        /* Build final program; this is null if the program could not be encoded or executable memory is not available */
         return compiler->FlushProgram();
     }
     return nullptr;
@@ -10,7 +10,11 @@
 #include "../RenderState/GLPipelineLayout.h"
 #include "../RenderState/GLPipelineState.h"
 #include "../RenderState/GLGraphicsPSO.h"
+#include "../RenderState/GLRenderPass.h"
+#include "../GLTypes.h"
 #include "../../CheckedCast.h"
+#include <LLGL/SwapChain.h>
+#include <LLGL/TypeInfo.h>
 
 
 namespace LLGL
@@ -56,6 +60,15 @@ void GLCommandBuffer::SetPipelineRenderState(const GLPipelineState& pipelineStat
     /* Store barrier flags; These must be invalidated when a new resource or resource-heap is set */
     renderState_.activeBarriers = pipelineStateGL.GetBarriersBitfield();
     renderState_.dirtyBarriers  = 0;
+
+    /* Uniform blocks must be bound again for the new PSO */
+    renderState_.dirtyUniformBlocks = pipelineStateGL.HasUniformBlocks();
+}
+
+void GLCommandBuffer::SetPrimitiveTopologyRenderState(const PrimitiveTopology primitiveTopology)
+{
+    renderState_.drawMode       = GLTypes::ToDrawMode(primitiveTopology);
+    renderState_.primitiveMode  = GLTypes::ToPrimitiveMode(primitiveTopology);
 }
 
 void GLCommandBuffer::InvalidateMemoryBarriers(GLbitfield barriers)
@@ -71,6 +84,43 @@ GLbitfield GLCommandBuffer::FlushAndGetMemoryBarriers()
     return barriers;
 }
 
+void GLCommandBuffer::InvalidateUniformBlocks()
+{
+    if (renderState_.boundPipelineState != nullptr && renderState_.boundPipelineState->HasUniformBlocks())
+        renderState_.dirtyUniformBlocks = true;
+}
+
+const GLUniformBlockStorage* GLCommandBuffer::FlushAndGetUniformBlocks()
+{
+    if (renderState_.dirtyUniformBlocks)
+    {
+        renderState_.dirtyUniformBlocks = false;
+        const GLUniformBlockStorage& uniformBlocks = renderState_.boundPipelineState->GetUniformBlocks();
+        if (uniformBlocks.HasBlocks())
+            return &uniformBlocks;
+    }
+    return nullptr;
+}
+
+bool GLCommandBuffer::WriteUniformBlockMembers(const GLUniformLocation& uniform, const void* data, std::size_t dataSize)
+{
+    if (uniform.numBlockMembers == 0)
+        return false;
+
+    const GLPipelineState* pipelineState = renderState_.boundPipelineState;
+    pipelineState->GetUniformBlocks().WriteMembers(uniform.firstBlockMember, uniform.numBlockMembers, uniform.count, uniform.wordSize * 4, data, dataSize);
+    renderState_.dirtyUniformBlocks = true;
+
+    return true;
+}
+
+const GLRenderPass* GLCommandBuffer::GetSwapChainRenderPass(const RenderTarget& renderTarget)
+{
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+        return LLGL_CAST(const GLRenderPass*, renderTarget.GetRenderPass());
+    return nullptr;
+}
+
 /* ----- Extensions ----- */
 
 bool GLCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -21,6 +21,7 @@ namespace LLGL
 
 
 struct GLRenderState;
+class GLRenderPass;
 
 class GLCommandBuffer : public CommandBuffer
 {
@@ -45,6 +46,9 @@ class GLCommandBuffer : public CommandBuffer
         // Stores the render states for the specified PSO: Draw mode, primitive mode, binding layout.
         void SetPipelineRenderState(const GLPipelineState& pipelineStateGL);
 
+        // Stores the draw and primitive mode for the dynamic primitive topology.
+        void SetPrimitiveTopologyRenderState(const PrimitiveTopology primitiveTopology);
+
         // InvalidaTes the specified memory barrier bits.
         void InvalidateMemoryBarriers(GLbitfield barriers);
 
@@ -52,6 +56,18 @@ class GLCommandBuffer : public CommandBuffer
         LLGL_NODISCARD
         GLbitfield FlushAndGetMemoryBarriers();
 
+        // Invalidates the uniform blocks of the bound PSO, so they are uploaded before the next draw or compute command.
+        void InvalidateUniformBlocks();
+
+        // Returns the uniform blocks of the bound PSO if they must be uploaded, or null otherwise. See RendererConfigurationOpenGL::uniformBufferSlot.
+        const GLUniformBlockStorage* FlushAndGetUniformBlocks();
+
+        // Writes the specified uniform into the uniform blocks of the bound PSO. Returns false if the uniform must be set with glUniform* commands instead.
+        bool WriteUniformBlockMembers(const GLUniformLocation& uniform, const void* data, std::size_t dataSize);
+
+        // Returns the default render pass of the specified render target if it is a swap-chain, so its discarded attachments can be invalidated. Otherwise, returns null.
+        static const GLRenderPass* GetSwapChainRenderPass(const RenderTarget& renderTarget);
+
     protected:
 
         // Returns the current render state.
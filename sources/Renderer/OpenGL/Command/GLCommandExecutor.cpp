@@ -28,6 +28,7 @@
 
 #include "../Buffer/GLBufferWithVAO.h"
 #include "../Buffer/GLBufferArrayWithVAO.h"
+#include "../Buffer/GLPersistentRingBuffer.h"
 
 #include "../RenderState/GLStateManager.h"
 #include "../RenderState/GLPipelineState.h"
@@ -49,14 +50,15 @@ namespace LLGL
 {
 
 
-static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr)
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr)
 {
     switch (opcode)
     {
         case GLOpcodeBufferSubData:
         {
             auto cmd = reinterpret_cast<const GLCmdBufferSubData*>(pc);
-            cmd->buffer->BufferSubData(cmd->offset, cmd->size, cmd + 1);
+            if (!GLPersistentRingBuffer::Get().BufferSubData(*(cmd->buffer), cmd->offset, cmd->size, cmd + 1))
+                cmd->buffer->BufferSubData(cmd->offset, cmd->size, cmd + 1);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeCopyBufferSubData:
@@ -77,6 +79,30 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             cmd->buffer->ClearBufferSubData(cmd->offset, cmd->size, cmd->data);
             return sizeof(*cmd);
         }
+        case GLOpcodeClearBufferSubDataElement:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearBufferSubDataElement*>(pc);
+            cmd->buffer->ClearBufferSubData(cmd->offset, cmd->size, cmd->element, cmd->elementSize);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearTexSubImage:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearTexSubImage*>(pc);
+            cmd->texture->ClearTexSubImage(cmd->subresource, cmd->clearValue);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeInvalidateBufferData:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvalidateBufferData*>(pc);
+            cmd->buffer->InvalidateBufferData();
+            return sizeof(*cmd);
+        }
+        case GLOpcodeInvalidateTexImage:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvalidateTexImage*>(pc);
+            cmd->texture->InvalidateTexImage();
+            return sizeof(*cmd);
+        }
         case GLOpcodeCopyImageSubData:
         {
             auto cmd = reinterpret_cast<const GLCmdCopyImageSubData*>(pc);
@@ -113,6 +139,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             GLMipGenerator::Get().GenerateMipsRangeForTexture(*stateMngr, *(cmd->texture), cmd->baseMipLevel, cmd->numMipLevels, cmd->baseArrayLayer, cmd->numArrayLayers);
             return sizeof(*cmd);
         }
+        case GLOpcodeGenerateMipmapArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdGenerateMipmapArray*>(pc);
+            GLMipGenerator::Get().GenerateMipsForTextures(*stateMngr, cmd->numTextures, reinterpret_cast<Texture* const*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(Texture*)*cmd->numTextures);
+        }
         case GLOpcodeExecute:
         {
             auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
@@ -186,23 +218,29 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
                 stateMngr->ClearAttachmentsWithRenderPass(*(cmd->renderPass), cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
         }
+        case GLOpcodeInvalidateAttachmentsWithRenderPass:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvalidateAttachmentsWithRenderPass*>(pc);
+            stateMngr->InvalidateAttachmentsWithRenderPass(*(cmd->renderPass));
+            return sizeof(*cmd);
+        }
         case GLOpcodeClearBuffers:
         {
             auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
             stateMngr->ClearBuffers(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
         }
-        case GLOpcodeBindVertexArray:
+        case GLOpcodeBindVertexInputLayout:
         {
-            auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            stateMngr->BindVertexArray(cmd->vao);
-            return sizeof(*cmd);
+            auto cmd = reinterpret_cast<const GLCmdBindVertexInputLayout*>(pc);
+            stateMngr->BindVertexInputLayout(*(cmd->vertexInputLayout), cmd->numOffsets, reinterpret_cast<const std::uint64_t*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(std::uint64_t)*cmd->numOffsets);
         }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         case GLOpcodeBindGL2XVertexArray:
         {
             auto cmd = reinterpret_cast<const GLCmdBindGL2XVertexArray*>(pc);
-            cmd->vertexArrayGL2X->Bind(*stateMngr);
+            stateMngr->BindGL2XVertexArray(*(cmd->vertexArrayGL2X));
             return sizeof(*cmd);
         }
         #endif
@@ -224,6 +262,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->BindBuffersBase(cmd->target, cmd->first, cmd->count, reinterpret_cast<const GLuint*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
         }
+        case GLOpcodeBindBufferRange:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindBufferRange*>(pc);
+            stateMngr->BindBufferRange(cmd->target, cmd->index, cmd->id, cmd->offset, cmd->size);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBeginTransformFeedback:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedback*>(pc);
@@ -282,12 +326,42 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->SetStencilRef(cmd->ref, cmd->face);
             return sizeof(*cmd);
         }
+        case GLOpcodeSetCullMode:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetCullMode*>(pc);
+            stateMngr->SetDynamicCullMode(cmd->cullMode);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetDepthBias:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetDepthBias*>(pc);
+            stateMngr->SetDynamicDepthBias(cmd->depthBias);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetDepthState:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetDepthState*>(pc);
+            stateMngr->SetDynamicDepthState(cmd->depth);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetStencilState:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetStencilState*>(pc);
+            stateMngr->SetDynamicStencilState(cmd->stencil);
+            return sizeof(*cmd);
+        }
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
             GLSetUniformsByType(cmd->type, cmd->location, cmd->count, (cmd + 1));
             return (sizeof(*cmd) + cmd->size);
         }
+        case GLOpcodeBindUniformBlocks:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindUniformBlocks*>(pc);
+            cmd->storage->BindBlocks(*stateMngr, (cmd + 1));
+            return (sizeof(*cmd) + cmd->size);
+        }
         case GLOpcodeBeginQuery:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginQuery*>(pc);
@@ -297,7 +371,13 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeEndQuery:
         {
             auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
-            cmd->queryHeap->End();
+            cmd->queryHeap->End(cmd->query);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeResolveQueryData:
+        {
+            auto cmd = reinterpret_cast<const GLCmdResolveQueryData*>(pc);
+            cmd->queryHeap->ResolveData(cmd->firstQuery, cmd->numQueries, cmd->dstBuffer, cmd->dstOffset);
             return sizeof(*cmd);
         }
         case GLOpcodeBeginConditionalRender:
@@ -363,6 +443,18 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            const std::size_t drawcount = static_cast<std::size_t>(cmd->drawcount);
+            #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+            auto indices        = reinterpret_cast<const GLvoid* const*>(cmd + 1);
+            auto counts         = reinterpret_cast<const GLsizei*>(indices + drawcount);
+            auto baseVertices   = reinterpret_cast<const GLint*>(counts + drawcount);
+            glMultiDrawElementsBaseVertex(cmd->mode, counts, cmd->type, indices, cmd->drawcount, baseVertices);
+            #endif
+            return (sizeof(*cmd) + drawcount * (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint)));
+        }
         case GLOpcodeDrawElementsInstanced:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
@@ -417,6 +509,26 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawArraysIndirectCountARB(cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawElementsIndirectCountARB(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeDispatchCompute:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
@@ -513,8 +625,9 @@ static void ExecuteGLCommandsEmulated(const GLVirtualCommandBuffer& virtualCmdBu
 
 static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& stateMngr)
 {
-    /* Execute native program and pass pointer to state manager */
-    exec.GetEntryPoint()(&stateMngr);
+    /* Execute native program and pass pointer to state manager; entry point must not be called as variadic function on ARM64 */
+    auto entryPoint = reinterpret_cast<void(*)(GLStateManager*)>(exec.GetEntryPoint());
+    entryPoint(&stateMngr);
 }
 
 #endif // /LLGL_ENABLE_JIT_COMPILER
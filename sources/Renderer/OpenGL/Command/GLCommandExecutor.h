@@ -9,6 +9,10 @@
 #define LLGL_GL_COMMAND_EXECUTOR_H
 
 
+#include "GLCommandOpcode.h"
+#include <cstddef>
+
+
 namespace LLGL
 {
 
@@ -26,6 +30,12 @@ GL render states are tracked with the specified state manager.
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 
+/*
+Executes the single GL command at the specified program counter and returns the size (in bytes) of the command arguments.
+The state manager is updated if the command switches to another GL context.
+*/
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr);
+
 // Executes the specified native GL command.
 void ExecuteNativeGLCommand(const OpenGL::NativeCommand& cmd, GLStateManager& stateMngr);
 
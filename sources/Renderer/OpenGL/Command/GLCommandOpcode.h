@@ -22,12 +22,17 @@ enum GLOpcode : std::uint8_t
     GLOpcodeCopyBufferSubData,
     GLOpcodeClearBufferData,
     GLOpcodeClearBufferSubData,
+    GLOpcodeClearBufferSubDataElement,
+    GLOpcodeClearTexSubImage,
+    GLOpcodeInvalidateBufferData,
+    GLOpcodeInvalidateTexImage,
     GLOpcodeCopyImageSubData,
     GLOpcodeCopyImageToBuffer,
     GLOpcodeCopyImageFromBuffer,
     GLOpcodeCopyFramebufferSubData,
     GLOpcodeGenerateMipmap,
     GLOpcodeGenerateMipmapSubresource,
+    GLOpcodeGenerateMipmapArray,
     GLOpcodeExecute,
     GLOpcodeViewport,
     GLOpcodeViewportArray,
@@ -38,12 +43,14 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClearStencil,
     GLOpcodeClear,
     GLOpcodeClearAttachmentsWithRenderPass,
+    GLOpcodeInvalidateAttachmentsWithRenderPass,
     GLOpcodeClearBuffers,
-    GLOpcodeBindVertexArray,
+    GLOpcodeBindVertexInputLayout,
     GLOpcodeBindGL2XVertexArray,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
     GLOpcodeBindBuffersBase,
+    GLOpcodeBindBufferRange,
     GLOpcodeBeginTransformFeedback,
     GLOpcodeBeginTransformFeedbackNV,
     GLOpcodeEndTransformFeedback,
@@ -53,9 +60,15 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBindPipelineState,
     GLOpcodeSetBlendColor,
     GLOpcodeSetStencilRef,
+    GLOpcodeSetCullMode,
+    GLOpcodeSetDepthBias,
+    GLOpcodeSetDepthState,
+    GLOpcodeSetStencilState,
     GLOpcodeSetUniforms,
+    GLOpcodeBindUniformBlocks,
     GLOpcodeBeginQuery,
     GLOpcodeEndQuery,
+    GLOpcodeResolveQueryData,
     GLOpcodeBeginConditionalRender,
     GLOpcodeEndConditionalRender,
     GLOpcodeDrawArrays,
@@ -64,12 +77,15 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawArraysIndirect,
     GLOpcodeDrawElements,
     GLOpcodeDrawElementsBaseVertex,
+    GLOpcodeMultiDrawElementsBaseVertex,
     GLOpcodeDrawElementsInstanced,
     GLOpcodeDrawElementsInstancedBaseVertex,
     GLOpcodeDrawElementsInstancedBaseVertexBaseInstance,
     GLOpcodeDrawElementsIndirect,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArraysIndirectCount,
+    GLOpcodeMultiDrawElementsIndirectCount,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
@@ -12,11 +12,14 @@
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Texture/GLTexture.h"
 #include "../../CheckedCast.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <algorithm>
 #include <cstring>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
@@ -32,6 +35,8 @@ GLCommandQueue::GLCommandQueue(GLStateManager& stateManager) :
 
 void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_CPU_PROFILE_SCOPE("CommandQueue::Submit");
+
     /*
     Only deferred command buffers can be submitted multiple times (via GLDeferredCommandBuffer),
     otherwise the commands must be submitted immediately (via GLImmediateCommandBuffer).
@@ -144,6 +149,24 @@ static void QueryResultPipelineStatistics(GLQueryHeap& queryHeapGL, std::uint32_
     #endif // /GL_ARB_pipeline_statistics_query
 }
 
+#if defined LLGL_OPENGL && defined GL_ARB_timer_query
+
+// Writes the differences between each pair of GL_TIMESTAMP queries into the output data, i.e. the elapsed time in nanoseconds.
+template <typename T>
+static void QueryResultTimestampPairs(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery, std::uint32_t numQueries, T* data)
+{
+    const auto& idList = queryHeapGL.GetIDs();
+    for_range(i, numQueries)
+    {
+        GLuint64 timestamps[2] = {};
+        glGetQueryObjectui64v(idList[(firstQuery + i) * 2    ], GL_QUERY_RESULT, &timestamps[0]);
+        glGetQueryObjectui64v(idList[(firstQuery + i) * 2 + 1], GL_QUERY_RESULT, &timestamps[1]);
+        data[i] = static_cast<T>(timestamps[1] >= timestamps[0] ? timestamps[1] - timestamps[0] : 0);
+    }
+}
+
+#endif // /GL_ARB_timer_query
+
 bool GLCommandQueue::QueryResult(
     QueryHeap&      queryHeap,
     std::uint32_t   firstQuery,
@@ -159,6 +182,19 @@ bool GLCommandQueue::QueryResult(
 
     if (AreQueryResultsAvailable(queryHeapGL, firstGroupQuery, numGroupQueries))
     {
+        #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+        if (queryHeapGL.IsTimestampPair())
+        {
+            if (dataSize == numQueries * sizeof(std::uint32_t))
+                QueryResultTimestampPairs(queryHeapGL, firstQuery, numQueries, reinterpret_cast<std::uint32_t*>(data));
+            else if (dataSize == numQueries * sizeof(std::uint64_t))
+                QueryResultTimestampPairs(queryHeapGL, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
+            else
+                return false;
+            return true;
+        }
+        #endif // /GL_ARB_timer_query
+
         if (dataSize == numQueries * sizeof(std::uint32_t))
             QueryResultUInt32(queryHeapGL, firstGroupQuery, numGroupQueries, reinterpret_cast<std::uint32_t*>(data));
         else if (dataSize == numQueries * sizeof(std::uint64_t))
@@ -173,6 +209,30 @@ bool GLCommandQueue::QueryResult(
     return false;
 }
 
+bool GLCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (HasExtension(GLExt::ARB_timer_query) && HasExtension(GLExt::ARB_sync))
+    {
+        /* Sample CPU ticks before and after the GPU timestamp, since GL_TIMESTAMP is not sampled atomically with the CPU clock */
+        GLint64 gpuTimestamp = 0;
+        const std::uint64_t cpuTicksStart = Timer::Tick();
+        glGetInteger64v(GL_TIMESTAMP, &gpuTimestamp);
+        const std::uint64_t cpuTicksEnd = Timer::Tick();
+
+        const std::uint64_t cpuFrequency = Timer::Frequency();
+        const std::uint64_t cpuTicksHalfDelta = (cpuTicksEnd - cpuTicksStart) / 2;
+
+        outCalibration.gpuTimestamp = static_cast<std::uint64_t>(gpuTimestamp);
+        outCalibration.gpuFrequency = 1000000000ull; // GL timestamps are always in nanoseconds
+        outCalibration.cpuTicks     = cpuTicksStart + cpuTicksHalfDelta;
+        outCalibration.maxDeviation = (cpuTicksHalfDelta * 1000000000ull + cpuFrequency - 1) / cpuFrequency;
+        return true;
+    }
+    #endif // /GL_ARB_timer_query
+    return false;
+}
+
 /* ----- Fences ----- */
 
 void GLCommandQueue::Submit(Fence& fence)
@@ -192,6 +252,21 @@ void GLCommandQueue::WaitIdle()
     glFinish();
 }
 
+/* ----- Sparse resources ----- */
+
+bool GLCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings)
+{
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    if (!textureGL.IsSparse())
+        return false;
+
+    /* Page commitments are executed immediately in GL command stream order */
+    for_range(i, numMappings)
+        textureGL.TexPageCommitment(mappings[i]);
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
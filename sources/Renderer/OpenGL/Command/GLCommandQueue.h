@@ -26,6 +26,12 @@ class GLCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        bool QueryTimestampCalibration(TimestampCalibration& outCalibration) override;
+
+        bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings) override;
+
     public:
 
         GLCommandQueue(GLStateManager& stateManager);
@@ -8,6 +8,7 @@
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
 #include <LLGL/Constants.h>
+#include <LLGL/IndirectArguments.h>
 
 #include "../../TextureUtils.h"
 #include "../GLSwapChain.h"
@@ -17,6 +18,8 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 #include "../Shader/GLShaderPipeline.h"
 
@@ -59,35 +62,49 @@ GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t initial
 
 void GLDeferredCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     /* Reset internal command buffer */
     buffer_.Clear();
     ResetRenderState();
 
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    drawBatch_.indices.clear();
+    drawBatch_.counts.clear();
+    drawBatch_.baseVertices.clear();
+    #endif
+
     #ifdef LLGL_ENABLE_JIT_COMPILER
 
     /* Reset states relevant to the GL command assembler */
     executable_.reset();
-    maxNumViewports_ = 0;
-    maxNumScissors_  = 0;
 
     #endif // /LLGL_ENABLE_JIT_COMPILER
 }
 
 void GLDeferredCommandBuffer::End()
 {
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-
-    /* Generate native assembly only if command buffer will be submitted multiple times */
-    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
-        executable_ = AssembleGLDeferredCommandBuffer(*this);
-
-    #else
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    /* Encode remaining draw commands */
+    FlushDrawBatch();
+    #endif
 
-    /* Pack virtual command buffer if it has to be traversed multiple times */
     if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        /* Pack virtual command buffer if it has to be traversed multiple times */
         buffer_.Pack();
 
-    #endif // /LLGL_ENABLE_JIT_COMPILER
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+        /*
+        Generate native assembly only if command buffer will be submitted multiple times.
+        The program references the packed command buffer, so it must be assembled after packing.
+        If no program can be generated, the command buffer is emulated.
+        */
+        executable_ = AssembleGLDeferredCommandBuffer(*this);
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+    }
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void GLDeferredCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -143,6 +160,17 @@ void GLDeferredCommandBuffer::CopyBuffer(
     }
 }
 
+void GLDeferredCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    /* GL has no batched copy command, so each region is recorded individually */
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 void GLDeferredCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -190,6 +218,83 @@ void GLDeferredCommandBuffer::FillBuffer(
     }
 }
 
+void GLDeferredCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(static_cast<std::uint64_t>(dstBufferGL.GetSize()), dstOffset, clearSize);
+
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+    {
+        auto cmd = AllocCommand<GLCmdClearBufferSubData>(GLOpcodeClearBufferSubData);
+        {
+            cmd->buffer = &dstBufferGL;
+            cmd->offset = static_cast<GLintptr>(dstOffset);
+            cmd->size   = static_cast<GLsizeiptr>(clearSize);
+            cmd->data   = pattern;
+        }
+    }
+    else
+    {
+        auto cmd = AllocCommand<GLCmdClearBufferSubDataElement>(GLOpcodeClearBufferSubDataElement);
+        {
+            cmd->buffer         = &dstBufferGL;
+            cmd->offset         = static_cast<GLintptr>(dstOffset);
+            cmd->size           = static_cast<GLsizeiptr>(clearSize);
+            cmd->elementSize    = elementSize;
+            ::memcpy(cmd->element, element, elementSize);
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto cmd = AllocCommand<GLCmdClearTexSubImage>(GLOpcodeClearTexSubImage);
+    {
+        cmd->texture        = LLGL_CAST(GLTexture*, &texture);
+        cmd->subresource    = subresource;
+        cmd->clearValue     = clearValue;
+    }
+}
+
+void GLDeferredCommandBuffer::DiscardResource(Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto cmd = AllocCommand<GLCmdInvalidateBufferData>(GLOpcodeInvalidateBufferData);
+            cmd->buffer = LLGL_CAST(GLBuffer*, &resource);
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto cmd = AllocCommand<GLCmdInvalidateTexImage>(GLOpcodeInvalidateTexImage);
+            cmd->texture = LLGL_CAST(GLTexture*, &resource);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
 void GLDeferredCommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -209,6 +314,17 @@ void GLDeferredCommandBuffer::CopyTexture(
     }
 }
 
+void GLDeferredCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    /* GL has no batched copy command, so each region is recorded individually */
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
 void GLDeferredCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -269,14 +385,19 @@ void GLDeferredCommandBuffer::GenerateMips(Texture& texture, const TextureSubres
     }
 }
 
+void GLDeferredCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    auto cmd = AllocCommand<GLCmdGenerateMipmapArray>(GLOpcodeGenerateMipmapArray, sizeof(Texture*)*numTextures);
+    {
+        cmd->numTextures = numTextures;
+        ::memcpy(cmd + 1, textures, sizeof(Texture*)*numTextures);
+    }
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void GLDeferredCommandBuffer::SetViewport(const Viewport& viewport)
 {
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-    maxNumViewports_ = std::max(maxNumViewports_, 1u);
-    #endif // /LLGL_ENABLE_JIT_COMPILER
-
     auto cmd = AllocCommand<GLCmdViewport>(GLOpcodeViewport);
     {
         cmd->viewport   = GLViewport{ viewport.x, viewport.y, viewport.width, viewport.height };
@@ -289,10 +410,6 @@ void GLDeferredCommandBuffer::SetViewports(std::uint32_t numViewports, const Vie
     /* Clamp number of viewports to limit */
     numViewports = std::min(numViewports, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
 
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-    maxNumViewports_ = std::max(maxNumViewports_, numViewports);
-    #endif // /LLGL_ENABLE_JIT_COMPILER
-
     /* Encode GL command */
     auto cmd = AllocCommand<GLCmdViewportArray>(GLOpcodeViewportArray, (sizeof(GLViewport) + sizeof(GLDepthRange))*numViewports);
     {
@@ -319,10 +436,6 @@ void GLDeferredCommandBuffer::SetViewports(std::uint32_t numViewports, const Vie
 
 void GLDeferredCommandBuffer::SetScissor(const Scissor& scissor)
 {
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-    maxNumScissors_ = std::max(maxNumScissors_, 1u);
-    #endif // /LLGL_ENABLE_JIT_COMPILER
-
     auto cmd = AllocCommand<GLCmdScissor>(GLOpcodeScissor);
     cmd->scissor = GLScissor{ scissor.x, scissor.y, scissor.width, scissor.height };
 }
@@ -332,10 +445,6 @@ void GLDeferredCommandBuffer::SetScissors(std::uint32_t numScissors, const Sciss
     /* Clamp number of scissors to limit */
     numScissors = std::min(numScissors, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
 
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-    maxNumScissors_ = std::max(maxNumScissors_, numScissors);
-    #endif // /LLGL_ENABLE_JIT_COMPILER
-
     /* Encode GL command */
     auto cmd = AllocCommand<GLCmdScissorArray>(GLOpcodeScissorArray, sizeof(GLScissor)*numScissors);
     {
@@ -355,7 +464,7 @@ void GLDeferredCommandBuffer::SetScissors(std::uint32_t numScissors, const Sciss
 
 /* ----- Input Assembly ------ */
 
-void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -363,19 +472,20 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         if (!HasNativeVAO())
         {
+            if (offset != 0)
+                LLGL_TRAP_FEATURE_NOT_SUPPORTED("vertex buffer offsets");
             auto cmd = AllocCommand<GLCmdBindGL2XVertexArray>(GLOpcodeBindGL2XVertexArray);
             cmd->vertexArrayGL2X = &(bufferWithVAO.GetVertexArrayGL2X());
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
-            auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-            cmd->vao = bufferWithVAO.GetVaoID();
+            EncodeBindVertexInputLayout(bufferWithVAO.GetVertexInputLayout(), (offset != 0 ? 1 : 0), &offset);
         }
     }
 }
 
-void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -383,14 +493,16 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         if (!HasNativeVAO())
         {
+            if (offsets != nullptr)
+                LLGL_TRAP_FEATURE_NOT_SUPPORTED("vertex buffer offsets");
             auto cmd = AllocCommand<GLCmdBindGL2XVertexArray>(GLOpcodeBindGL2XVertexArray);
             cmd->vertexArrayGL2X = &(bufferArrayWithVAO.GetVertexArrayGL2X());
         }
         else
         #endif
         {
-            auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-            cmd->vao = bufferArrayWithVAO.GetVaoID();
+            const GLVertexInputLayout& layout = bufferArrayWithVAO.GetVertexInputLayout();
+            EncodeBindVertexInputLayout(layout, (offsets != nullptr ? layout.GetBindings().size() : 0), offsets);
         }
     }
 }
@@ -500,6 +612,51 @@ void GLDeferredCommandBuffer::SetResource(std::uint32_t descriptor, Resource& re
     }
 }
 
+void GLDeferredCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
+
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+
+    GLintptr offsetGL = 0;
+    GLsizeiptr sizeGL = 0;
+    if (!bufferGL.GetClampedRange(offset, size, offsetGL, sizeGL))
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& binding = bindingList[descriptor];
+    switch (binding.type)
+    {
+        case GLResourceType_UBO:
+        {
+            BindBufferRange(GLBufferTarget::UniformBuffer, bufferGL, binding.slot, offsetGL, sizeGL);
+        }
+        break;
+
+        case GLResourceType_SSBO:
+        {
+            BindBufferRange(GLBufferTarget::ShaderStorageBuffer, bufferGL, binding.slot, offsetGL, sizeGL);
+            #ifdef LLGL_GLEXT_MEMORY_BARRIERS
+            if ((bufferGL.GetBindFlags() & BindFlags::Storage) != 0)
+                InvalidateMemoryBarriers(GL_SHADER_STORAGE_BARRIER_BIT);
+            #endif
+        }
+        break;
+
+        default:
+        {
+            /* Texture buffers are bound as a whole */
+            SetResource(descriptor, static_cast<Resource&>(buffer));
+        }
+        break;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void GLDeferredCommandBuffer::BeginRenderPass(
@@ -521,12 +678,28 @@ void GLDeferredCommandBuffer::BeginRenderPass(
             cmd->numClearValues = numClearValues;
             ::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
         }
+        renderPass_ = cmd->renderPass;
     }
+    else
+        renderPass_ = GetSwapChainRenderPass(renderTarget);
 }
 
 void GLDeferredCommandBuffer::EndRenderPass()
 {
-    // dummy
+    /* Invalidate attachments whose content is not stored */
+    if (renderPass_ != nullptr && renderPass_->GetNumStoreInvalidations() > 0)
+    {
+        auto cmd = AllocCommand<GLCmdInvalidateAttachmentsWithRenderPass>(GLOpcodeInvalidateAttachmentsWithRenderPass);
+        {
+            cmd->renderPass = renderPass_;
+        }
+    }
+    renderPass_ = nullptr;
+}
+
+void GLDeferredCommandBuffer::NextSubpass()
+{
+    // dummy - reading attachments with GL_EXT_shader_framebuffer_fetch is coherent and requires no barrier between subpasses
 }
 
 void GLDeferredCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -597,6 +770,54 @@ void GLDeferredCommandBuffer::SetStencilReference(std::uint32_t reference, const
     }
 }
 
+void GLDeferredCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    auto cmd = AllocCommand<GLCmdSetCullMode>(GLOpcodeSetCullMode);
+    {
+        cmd->cullMode = cullMode;
+    }
+}
+
+void GLDeferredCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    auto cmd = AllocCommand<GLCmdSetDepthState>(GLOpcodeSetDepthState);
+    {
+        cmd->depth = depthDesc;
+    }
+}
+
+void GLDeferredCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    auto cmd = AllocCommand<GLCmdSetStencilState>(GLOpcodeSetStencilState);
+    {
+        cmd->stencil = stencilDesc;
+    }
+}
+
+void GLDeferredCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    /* Draw and primitive modes are baked into each draw command */
+    SetPrimitiveTopologyRenderState(primitiveTopology);
+}
+
+void GLDeferredCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    auto cmd = AllocCommand<GLCmdSetDepthBias>(GLOpcodeSetDepthBias);
+    {
+        cmd->depthBias = depthBiasDesc;
+    }
+}
+
+void GLDeferredCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by OpenGL
+}
+
+void GLDeferredCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by OpenGL
+}
+
 void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -619,8 +840,15 @@ void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data,
         if (first >= uniformMap.size())
             return /*GL_INVALID_INDEX*/;
 
-        /* Allocate GL command and copy data buffer */
+        /* Write uniform into uniform blocks if it has been moved there; they are recorded with the next draw or compute command */
         const auto& uniform = uniformMap[first];
+        if (WriteUniformBlockMembers(uniform, words, static_cast<std::size_t>(wordsEnd - words) * 4))
+        {
+            words += uniform.wordSize;
+            continue;
+        }
+
+        /* Allocate GL command and copy data buffer */
         const std::uint32_t uniformSize = uniform.wordSize * 4;
         auto cmd = AllocCommand<GLCmdSetUniforms>(GLOpcodeSetUniforms, dataSize);
         {
@@ -646,11 +874,12 @@ void GLDeferredCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t que
     }
 }
 
-void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto cmd = AllocCommand<GLCmdEndQuery>(GLOpcodeEndQuery);
     {
-        cmd->queryHeap = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->query      = query;
     }
 }
 
@@ -668,6 +897,23 @@ void GLDeferredCommandBuffer::EndRenderCondition()
     AllocOpcode(GLOpcodeEndConditionalRender);
 }
 
+void GLDeferredCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto cmd = AllocCommand<GLCmdResolveQueryData>(GLOpcodeResolveQueryData);
+    {
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->firstQuery = firstQuery;
+        cmd->numQueries = numQueries;
+        cmd->dstBuffer  = LLGL_CAST(GLBuffer&, dstBuffer).GetID();
+        cmd->dstOffset  = static_cast<GLintptr>(dstOffset);
+    }
+}
+
 /* ----- Stream Output ------ */
 
 #ifndef __APPLE__
@@ -726,15 +972,17 @@ The indices actually store the index start offset, but must be passed to GL as a
 */
 
 #ifdef LLGL_GLEXT_MEMORY_BARRIERS
-#   define LLGL_FLUSH_MEMORY_BARRIERS() \
+#   define LLGL_FLUSH_PENDING_STATES()  \
+        FlushUniformBlocks();           \
         FlushMemoryBarriers()
 #else
-#   define LLGL_FLUSH_MEMORY_BARRIERS()
+#   define LLGL_FLUSH_PENDING_STATES()  \
+        FlushUniformBlocks()
 #endif // /LLGL_GLEXT_MEMORY_BARRIERS
 
 void GLDeferredCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawArrays>(GLOpcodeDrawArrays);
     {
         cmd->mode   = GetDrawMode();
@@ -745,7 +993,14 @@ void GLDeferredCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firs
 
 void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    if (IsDrawBatchingSupported())
+    {
+        BatchDrawElements(GetDrawMode(), static_cast<GLsizei>(numIndices), GetIndexType(), GetIndicesOffset(firstIndex), 0);
+        return;
+    }
+    #endif // /LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
     auto cmd = AllocCommand<GLCmdDrawElements>(GLOpcodeDrawElements);
     {
         cmd->mode       = GetDrawMode();
@@ -757,7 +1012,14 @@ void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_
 
 void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    if (IsDrawBatchingSupported())
+    {
+        BatchDrawElements(GetDrawMode(), static_cast<GLsizei>(numIndices), GetIndexType(), GetIndicesOffset(firstIndex), vertexOffset);
+        return;
+    }
+    #endif // /LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
     auto cmd = AllocCommand<GLCmdDrawElementsBaseVertex>(GLOpcodeDrawElementsBaseVertex);
     {
         cmd->mode       = GetDrawMode();
@@ -770,7 +1032,7 @@ void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_
 
 void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawArraysInstanced>(GLOpcodeDrawArraysInstanced);
     {
         cmd->mode           = GetDrawMode();
@@ -783,7 +1045,7 @@ void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint
 void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     #ifndef __APPLE__
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawArraysInstancedBaseInstance>(GLOpcodeDrawArraysInstancedBaseInstance);
     {
         cmd->mode           = GetDrawMode();
@@ -799,7 +1061,7 @@ void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint
 
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawElementsInstanced>(GLOpcodeDrawElementsInstanced);
     {
         cmd->mode           = GetDrawMode();
@@ -812,7 +1074,7 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawElementsInstancedBaseVertex>(GLOpcodeDrawElementsInstancedBaseVertex);
     {
         cmd->mode           = GetDrawMode();
@@ -827,7 +1089,7 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     #ifndef __APPLE__
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawElementsInstancedBaseVertexBaseInstance>(GLOpcodeDrawElementsInstancedBaseVertexBaseInstance);
     {
         cmd->mode           = GetDrawMode();
@@ -843,9 +1105,41 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
     #endif
 }
 
+void GLDeferredCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    LLGL_FLUSH_PENDING_STATES();
+    for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+    {
+        #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+        if (draws->numInstances == 1 && draws->firstInstance == 0 && IsDrawBatchingSupported())
+        {
+            /* Merge non-instanced draws into a single glMultiDrawElementsBaseVertex command */
+            BatchDrawElements(GetDrawMode(), static_cast<GLsizei>(draws->numIndices), GetIndexType(), GetIndicesOffset(draws->firstIndex), draws->vertexOffset);
+            continue;
+        }
+        #endif // /LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+
+        #ifndef __APPLE__
+        auto cmd = AllocCommand<GLCmdDrawElementsInstancedBaseVertexBaseInstance>(GLOpcodeDrawElementsInstancedBaseVertexBaseInstance);
+        {
+            cmd->mode           = GetDrawMode();
+            cmd->count          = static_cast<GLsizei>(draws->numIndices);
+            cmd->type           = GetIndexType();
+            cmd->indices        = GetIndicesOffset(draws->firstIndex);
+            cmd->instancecount  = static_cast<GLsizei>(draws->numInstances);
+            cmd->basevertex     = draws->vertexOffset;
+            cmd->baseinstance   = draws->firstInstance;
+        }
+        #else
+        ErrUnsupportedGLProc("glDrawElementsInstancedBaseVertexBaseInstance");
+        return;
+        #endif
+    }
+}
+
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawArraysIndirect>(GLOpcodeDrawArraysIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -858,7 +1152,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -888,7 +1182,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -902,7 +1196,7 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -932,12 +1226,75 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_PENDING_STATES();
+    const GLintptr indirect = static_cast<GLintptr>(argumentsOffset);
+    auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirectCount>(GLOpcodeMultiDrawArraysIndirectCount);
+    {
+        cmd->id             = LLGL_CAST(GLBuffer&, argumentsBuffer).GetID();
+        cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = GetDrawMode();
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+    #else
+    ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    #endif
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_PENDING_STATES();
+    const GLintptr indirect = static_cast<GLintptr>(argumentsOffset);
+    auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirectCount>(GLOpcodeMultiDrawElementsIndirectCount);
+    {
+        cmd->id             = LLGL_CAST(GLBuffer&, argumentsBuffer).GetID();
+        cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = GetDrawMode();
+        cmd->type           = GetIndexType();
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+    #else
+    ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    #endif
+}
+
+void GLDeferredCommandBuffer::DrawMeshTasks(std::uint32_t /*numThreadGroupsX*/, std::uint32_t /*numThreadGroupsY*/, std::uint32_t /*numThreadGroupsZ*/)
+{
+    // dummy - not supported by OpenGL
+}
+
+void GLDeferredCommandBuffer::DrawMeshTasksIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // dummy - not supported by OpenGL
+}
+
 /* ----- Compute ----- */
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     #ifndef __APPLE__
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDispatchCompute>(GLOpcodeDispatchCompute);
     {
         cmd->numgroups[0] = numWorkGroupsX;
@@ -952,7 +1309,7 @@ void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32
 void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #ifndef __APPLE__
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto cmd = AllocCommand<GLCmdDispatchComputeIndirect>(GLOpcodeDispatchComputeIndirect);
     {
         cmd->id         = LLGL_CAST(const GLBuffer&, buffer).GetID();
@@ -1032,6 +1389,18 @@ void GLDeferredCommandBuffer::BindBufferBase(const GLBufferTarget bufferTarget,
     }
 }
 
+void GLDeferredCommandBuffer::BindBufferRange(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot, GLintptr offset, GLsizeiptr size)
+{
+    auto cmd = AllocCommand<GLCmdBindBufferRange>(GLOpcodeBindBufferRange);
+    {
+        cmd->target = bufferTarget;
+        cmd->index  = slot;
+        cmd->id     = bufferGL.GetID();
+        cmd->offset = offset;
+        cmd->size   = size;
+    }
+}
+
 void GLDeferredCommandBuffer::BindBuffersBase(const GLBufferTarget bufferTarget, std::uint32_t first, std::uint32_t count, const Buffer *const *const buffers)
 {
     if (count > 1)
@@ -1058,6 +1427,17 @@ void GLDeferredCommandBuffer::BindBuffersBase(const GLBufferTarget bufferTarget,
     }
 }
 
+void GLDeferredCommandBuffer::EncodeBindVertexInputLayout(const GLVertexInputLayout& layout, std::size_t numOffsets, const std::uint64_t* offsets)
+{
+    auto cmd = AllocCommand<GLCmdBindVertexInputLayout>(GLOpcodeBindVertexInputLayout, sizeof(std::uint64_t)*numOffsets);
+    {
+        cmd->vertexInputLayout  = &layout;
+        cmd->numOffsets         = static_cast<std::uint32_t>(numOffsets);
+        if (numOffsets > 0)
+            ::memcpy(cmd + 1, offsets, sizeof(std::uint64_t)*numOffsets);
+    }
+}
+
 void GLDeferredCommandBuffer::BindTexture(GLTexture& textureGL, std::uint32_t slot)
 {
     auto cmd = AllocCommand<GLCmdBindTexture>(GLOpcodeBindTexture);
@@ -1109,14 +1489,117 @@ void GLDeferredCommandBuffer::FlushMemoryBarriers()
     }
 }
 
+void GLDeferredCommandBuffer::FlushUniformBlocks()
+{
+    if (const GLUniformBlockStorage* uniformBlocks = FlushAndGetUniformBlocks())
+    {
+        /* Copy uniform data, since the storage of the PSO can be modified again before this command buffer is executed */
+        const std::size_t size = uniformBlocks->GetSize();
+        auto cmd = AllocCommand<GLCmdBindUniformBlocks>(GLOpcodeBindUniformBlocks, size);
+        {
+            cmd->storage    = uniformBlocks;
+            cmd->size       = static_cast<GLsizeiptr>(size);
+            ::memcpy(cmd + 1, uniformBlocks->GetData(), size);
+        }
+    }
+}
+
+#ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+
+bool GLDeferredCommandBuffer::IsDrawBatchingSupported() const
+{
+    return HasExtension(GLExt::ARB_draw_elements_base_vertex);
+}
+
+void GLDeferredCommandBuffer::BatchDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLint baseVertex)
+{
+    /*
+    Consecutive draw commands always share the same pipeline state, vertex array, and resource bindings,
+    since any state change would have been encoded as a separate command and flushed the current batch.
+    Only the draw mode and index type must be compared, because they are baked into the draw command.
+    */
+    if (!drawBatch_.counts.empty() && (drawBatch_.mode != mode || drawBatch_.type != type))
+        FlushDrawBatch();
+
+    drawBatch_.mode = mode;
+    drawBatch_.type = type;
+    drawBatch_.indices.push_back(indices);
+    drawBatch_.counts.push_back(count);
+    drawBatch_.baseVertices.push_back(baseVertex);
+}
+
+void GLDeferredCommandBuffer::FlushDrawBatch()
+{
+    const std::size_t numDraws = drawBatch_.counts.size();
+    if (numDraws == 0)
+        return;
+
+    if (numDraws == 1)
+    {
+        /* Encode single draw command as it would have been encoded without batching */
+        if (drawBatch_.baseVertices[0] == 0)
+        {
+            auto cmd = buffer_.AllocCommand<GLCmdDrawElements>(GLOpcodeDrawElements);
+            {
+                cmd->mode       = drawBatch_.mode;
+                cmd->count      = drawBatch_.counts[0];
+                cmd->type       = drawBatch_.type;
+                cmd->indices    = drawBatch_.indices[0];
+            }
+        }
+        else
+        {
+            auto cmd = buffer_.AllocCommand<GLCmdDrawElementsBaseVertex>(GLOpcodeDrawElementsBaseVertex);
+            {
+                cmd->mode       = drawBatch_.mode;
+                cmd->count      = drawBatch_.counts[0];
+                cmd->type       = drawBatch_.type;
+                cmd->indices    = drawBatch_.indices[0];
+                cmd->basevertex = drawBatch_.baseVertices[0];
+            }
+        }
+    }
+    else
+    {
+        /* Encode all draw commands as a single multi-draw command with its arguments in the payload */
+        const std::size_t indicesSize   = sizeof(const GLvoid*) * numDraws;
+        const std::size_t countsSize    = sizeof(GLsizei) * numDraws;
+        const std::size_t basesSize     = sizeof(GLint) * numDraws;
+
+        auto cmd = buffer_.AllocCommand<GLCmdMultiDrawElementsBaseVertex>(GLOpcodeMultiDrawElementsBaseVertex, indicesSize + countsSize + basesSize);
+        {
+            cmd->mode       = drawBatch_.mode;
+            cmd->type       = drawBatch_.type;
+            cmd->drawcount  = static_cast<GLsizei>(numDraws);
+
+            char* payload = reinterpret_cast<char*>(cmd + 1);
+            ::memcpy(payload, drawBatch_.indices.data(), indicesSize);
+            ::memcpy(payload + indicesSize, drawBatch_.counts.data(), countsSize);
+            ::memcpy(payload + indicesSize + countsSize, drawBatch_.baseVertices.data(), basesSize);
+        }
+    }
+
+    drawBatch_.indices.clear();
+    drawBatch_.counts.clear();
+    drawBatch_.baseVertices.clear();
+}
+
+#endif // /LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+
 void GLDeferredCommandBuffer::AllocOpcode(const GLOpcode opcode)
 {
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    FlushDrawBatch();
+    #endif
     buffer_.AllocOpcode(opcode);
 }
 
 template <typename TCommand>
 TCommand* GLDeferredCommandBuffer::AllocCommand(const GLOpcode opcode, std::size_t payloadSize)
 {
+    #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    FlushDrawBatch();
+    #endif
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
 
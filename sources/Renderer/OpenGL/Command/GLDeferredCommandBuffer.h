@@ -12,6 +12,7 @@
 #include "GLCommandBuffer.h"
 #include "GLCommandOpcode.h"
 #include "../../VirtualCommandBuffer.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <memory>
 #include <vector>
 
@@ -33,6 +34,7 @@ class GLSwapChain;
 class GLStateManager;
 class GLRenderPass;
 class GLShaderPipeline;
+class GLVertexInputLayout;
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 class GL2XSampler;
 #endif
@@ -78,23 +80,12 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
             return executable_;
         }
 
-        // Returns the maximum number of viewports that are set in this command buffer.
-        inline std::uint32_t GetMaxNumViewports() const
-        {
-            return maxNumViewports_;
-        }
-
-        // Returns the maximum number of scissors that are set in this command buffer.
-        inline std::uint32_t GetMaxNumScissors() const
-        {
-            return maxNumScissors_;
-        }
-
         #endif // /LLGL_ENABLE_JIT_COMPILER
 
     private:
 
         void BindBufferBase(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot);
+        void BindBufferRange(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot, GLintptr offset, GLsizeiptr size);
         void BindBuffersBase(const GLBufferTarget bufferTarget, std::uint32_t first, std::uint32_t count, const Buffer *const *const buffers);
         void BindTexture(GLTexture& textureGL, std::uint32_t slot);
         void BindImageTexture(const GLTexture& textureGL, std::uint32_t slot);
@@ -105,6 +96,25 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
         void FlushMemoryBarriers();
 
+        // Records the uniform blocks of the bound PSO if they have been modified. See GLCommandBuffer::FlushAndGetUniformBlocks().
+        void FlushUniformBlocks();
+
+        // Encodes the binding of the specified vertex input layout with optional offsets for its first vertex buffer bindings.
+        void EncodeBindVertexInputLayout(const GLVertexInputLayout& layout, std::size_t numOffsets, const std::uint64_t* offsets);
+
+        #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+
+        // Returns true if consecutive indexed draw commands can be merged into a single glMultiDrawElementsBaseVertex command.
+        bool IsDrawBatchingSupported() const;
+
+        // Appends an indexed draw command to the pending draw batch, flushing the previous batch if its draw mode or index type differs.
+        void BatchDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLint baseVertex);
+
+        // Encodes the pending draw batch as a single command. This is called before any other command is encoded.
+        void FlushDrawBatch();
+
+        #endif // /LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+
         // Allocates only an opcode for empty commands.
         void AllocOpcode(const GLOpcode opcode);
 
@@ -112,17 +122,34 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         template <typename TCommand>
         TCommand* AllocCommand(const GLOpcode opcode, std::size_t payloadSize = 0);
 
+    private:
+
+        // Consecutive indexed draw commands that have not been encoded yet.
+        struct GLDrawBatch
+        {
+            GLenum                      mode        = 0;
+            GLenum                      type        = 0;
+            std::vector<const GLvoid*>  indices;
+            std::vector<GLsizei>        counts;
+            std::vector<GLint>          baseVertices;
+        };
+
     private:
 
         long                        flags_                  = 0;
         GLVirtualCommandBuffer      buffer_;
+        const GLRenderPass*         renderPass_             = nullptr; // Render pass of the current BeginRenderPass/EndRenderPass block.
+
+        #ifdef LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+        GLDrawBatch                 drawBatch_;
+        #endif
 
         #ifdef LLGL_ENABLE_JIT_COMPILER
         std::unique_ptr<JITProgram> executable_;
-        std::uint32_t               maxNumViewports_        = 0;
-        std::uint32_t               maxNumScissors_         = 0;
         #endif // /LLGL_ENABLE_JIT_COMPILER
 
+        CPUProfileSpan              encodeSpan_;
+
 };
 
 
@@ -10,9 +10,11 @@
 #include "GLCommandExecutor.h"
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/IndirectArguments.h>
 #include <LLGL/Utils/ForRange.h>
 
 #include "../../TextureUtils.h"
+#include "../../BufferUtils.h"
 #include "../GLSwapChain.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
@@ -21,6 +23,8 @@
 #include "../GLCore.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 #include "../Shader/GLShaderProgram.h"
 
@@ -35,6 +39,7 @@
 
 #include "../Buffer/GLBufferWithVAO.h"
 #include "../Buffer/GLBufferArrayWithVAO.h"
+#include "../Buffer/GLPersistentRingBuffer.h"
 
 #include "../RenderState/GLStateManager.h"
 #include "../RenderState/GLGraphicsPSO.h"
@@ -60,12 +65,14 @@ GLImmediateCommandBuffer::GLImmediateCommandBuffer(GLStateManager& stateManager)
 
 void GLImmediateCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     ResetRenderState();
 }
 
 void GLImmediateCommandBuffer::End()
 {
-    // dummy
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void GLImmediateCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -83,7 +90,8 @@ void GLImmediateCommandBuffer::UpdateBuffer(
     std::uint16_t   dataSize)
 {
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
-    dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
+    if (!GLPersistentRingBuffer::Get().BufferSubData(dstBufferGL, static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data))
+        dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void GLImmediateCommandBuffer::CopyBuffer(
@@ -103,6 +111,17 @@ void GLImmediateCommandBuffer::CopyBuffer(
     );
 }
 
+void GLImmediateCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    /* GL has no batched copy command, so each region is copied individually */
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
 void GLImmediateCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -137,6 +156,54 @@ void GLImmediateCommandBuffer::FillBuffer(
         dstBufferGL.ClearBufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(fillSize), value);
 }
 
+void GLImmediateCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(static_cast<std::uint64_t>(dstBufferGL.GetSize()), dstOffset, clearSize);
+
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+        dstBufferGL.ClearBufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(clearSize), pattern);
+    else
+        dstBufferGL.ClearBufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(clearSize), element, elementSize);
+}
+
+void GLImmediateCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    textureGL.ClearTexSubImage(subresource, clearValue);
+}
+
+void GLImmediateCommandBuffer::DiscardResource(Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            LLGL_CAST(GLBuffer&, resource).InvalidateBufferData();
+            break;
+        case ResourceType::Texture:
+            LLGL_CAST(GLTexture&, resource).InvalidateTexImage();
+            break;
+        default:
+            break;
+    }
+}
+
 void GLImmediateCommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -156,6 +223,17 @@ void GLImmediateCommandBuffer::CopyTexture(
     );
 }
 
+void GLImmediateCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    /* GL has no batched copy command, so each region is copied individually */
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
 void GLImmediateCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -215,6 +293,11 @@ void GLImmediateCommandBuffer::GenerateMips(Texture& texture, const TextureSubre
     );
 }
 
+void GLImmediateCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    GLMipGenerator::Get().GenerateMipsForTextures(*stateMngr_, numTextures, textures);
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void GLImmediateCommandBuffer::SetViewport(const Viewport& viewport)
@@ -283,7 +366,7 @@ void GLImmediateCommandBuffer::SetScissors(std::uint32_t numScissors, const Scis
 
 /* ----- Input Assembly ------ */
 
-void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -294,18 +377,20 @@ void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
         if (!HasNativeVAO())
         {
             /* Bind vertex array with emulator (for GL 2.x compatibility) */
-            vertexBufferGL.GetVertexArrayGL2X().Bind(*stateMngr_);
+            if (offset != 0)
+                LLGL_TRAP_FEATURE_NOT_SUPPORTED("vertex buffer offsets");
+            stateMngr_->BindGL2XVertexArray(vertexBufferGL.GetVertexArrayGL2X());
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
-            /* Bind vertex array with native VAO */
-            stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+            /* Bind vertex array with cached native VAO */
+            stateMngr_->BindVertexInputLayout(vertexBufferGL.GetVertexInputLayout(), 1, &offset);
         }
     }
 }
 
-void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -316,13 +401,16 @@ void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         if (!HasNativeVAO())
         {
             /* Bind vertex array with emulator (for GL 2.x compatibility) */
-            vertexBufferArrayGL.GetVertexArrayGL2X().Bind(*stateMngr_);
+            if (offsets != nullptr)
+                LLGL_TRAP_FEATURE_NOT_SUPPORTED("vertex buffer offsets");
+            stateMngr_->BindGL2XVertexArray(vertexBufferArrayGL.GetVertexArrayGL2X());
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
-            /* Bind vertex array with native VAO */
-            stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+            /* Bind vertex array with cached native VAO */
+            const GLVertexInputLayout& layout = vertexBufferArrayGL.GetVertexInputLayout();
+            stateMngr_->BindVertexInputLayout(layout, (offsets != nullptr ? layout.GetBindings().size() : 0), offsets);
         }
     }
 }
@@ -430,6 +518,51 @@ void GLImmediateCommandBuffer::SetResource(std::uint32_t descriptor, Resource& r
     }
 }
 
+void GLImmediateCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
+
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+
+    GLintptr offsetGL = 0;
+    GLsizeiptr sizeGL = 0;
+    if (!bufferGL.GetClampedRange(offset, size, offsetGL, sizeGL))
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& binding = bindingList[descriptor];
+    switch (binding.type)
+    {
+        case GLResourceType_UBO:
+        {
+            stateMngr_->BindBufferRange(GLBufferTarget::UniformBuffer, binding.slot, bufferGL.GetID(), offsetGL, sizeGL);
+        }
+        break;
+
+        case GLResourceType_SSBO:
+        {
+            stateMngr_->BindBufferRange(GLBufferTarget::ShaderStorageBuffer, binding.slot, bufferGL.GetID(), offsetGL, sizeGL);
+            #ifdef LLGL_GLEXT_MEMORY_BARRIERS
+            if ((bufferGL.GetBindFlags() & BindFlags::Storage) != 0)
+                InvalidateMemoryBarriers(GL_SHADER_STORAGE_BARRIER_BIT);
+            #endif
+        }
+        break;
+
+        default:
+        {
+            /* Texture buffers are bound as a whole */
+            SetResource(descriptor, static_cast<Resource&>(buffer));
+        }
+        break;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void GLImmediateCommandBuffer::BeginRenderPass(
@@ -447,14 +580,26 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     /* Clear render target attachments with render pass */
     if (renderPass != nullptr)
     {
-        auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
-        stateMngr_->ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues);
+        renderPass_ = LLGL_CAST(const GLRenderPass*, renderPass);
+        stateMngr_->ClearAttachmentsWithRenderPass(*renderPass_, numClearValues, clearValues);
     }
+    else
+        renderPass_ = GetSwapChainRenderPass(renderTarget);
 }
 
 void GLImmediateCommandBuffer::EndRenderPass()
 {
-    // dummy
+    /* Invalidate attachments whose content is not stored */
+    if (renderPass_ != nullptr)
+    {
+        stateMngr_->InvalidateAttachmentsWithRenderPass(*renderPass_);
+        renderPass_ = nullptr;
+    }
+}
+
+void GLImmediateCommandBuffer::NextSubpass()
+{
+    // dummy - reading attachments with GL_EXT_shader_framebuffer_fetch is coherent and requires no barrier between subpasses
 }
 
 void GLImmediateCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -503,6 +648,41 @@ void GLImmediateCommandBuffer::SetStencilReference(std::uint32_t reference, cons
     stateMngr_->SetStencilRef(static_cast<GLint>(reference), GLTypes::Map(stencilFace));
 }
 
+void GLImmediateCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    stateMngr_->SetDynamicCullMode(cullMode);
+}
+
+void GLImmediateCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    stateMngr_->SetDynamicDepthState(depthDesc);
+}
+
+void GLImmediateCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    stateMngr_->SetDynamicStencilState(stencilDesc);
+}
+
+void GLImmediateCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    SetPrimitiveTopologyRenderState(primitiveTopology);
+}
+
+void GLImmediateCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    stateMngr_->SetDynamicDepthBias(depthBiasDesc);
+}
+
+void GLImmediateCommandBuffer::SetShadingRate(const ShadingRateDescriptor& /*shadingRateDesc*/)
+{
+    // dummy - not supported by OpenGL
+}
+
+void GLImmediateCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - not supported by OpenGL
+}
+
 void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -521,8 +701,10 @@ void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data
         if (first >= uniformMap.size())
             return /*GL_INVALID_INDEX*/;
 
+        /* Write uniform into uniform blocks (if it has been moved there) or set it directly */
         const auto& uniform = uniformMap[first];
-        GLSetUniformsByType(uniform.type, uniform.location, uniform.count, words);
+        if (!WriteUniformBlockMembers(uniform, words, static_cast<std::size_t>(wordsEnd - words) * 4))
+            GLSetUniformsByType(uniform.type, uniform.location, uniform.count, words);
 
         words += uniform.wordSize;
     }
@@ -537,11 +719,11 @@ void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t qu
     queryHeapGL.Begin(query);
 }
 
-void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    /* Begin query with internal target */
+    /* End query with internal target */
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
-    queryHeapGL.End();
+    queryHeapGL.End(query);
 }
 
 void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
@@ -559,6 +741,18 @@ void GLImmediateCommandBuffer::EndRenderCondition()
     #endif
 }
 
+void GLImmediateCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    queryHeapGL.ResolveData(firstQuery, numQueries, dstBufferGL.GetID(), static_cast<GLintptr>(dstOffset));
+}
+
 /* ----- Stream Output ------ */
 
 void GLImmediateCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -608,15 +802,17 @@ The indices actually store the index start offset, but must be passed to GL as a
 */
 
 #ifdef LLGL_GLEXT_MEMORY_BARRIERS
-#   define LLGL_FLUSH_MEMORY_BARRIERS() \
+#   define LLGL_FLUSH_PENDING_STATES()  \
+        FlushUniformBlocks();           \
         if (GLbitfield barriers = FlushAndGetMemoryBarriers()) { glMemoryBarrier(barriers); }
 #else
-#   define LLGL_FLUSH_MEMORY_BARRIERS()
+#   define LLGL_FLUSH_PENDING_STATES()  \
+        FlushUniformBlocks()
 #endif // /LLGL_GLEXT_MEMORY_BARRIERS
 
 void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawArrays(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -626,7 +822,7 @@ void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t fir
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawElements(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -638,7 +834,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawElementsBaseVertex(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -651,7 +847,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawArraysInstanced(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -663,7 +859,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     #ifdef LLGL_GLEXT_BASE_INSTANCE
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawArraysInstancedBaseInstance(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -676,7 +872,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawElementsInstanced(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -689,7 +885,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawElementsInstancedBaseVertex(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -704,7 +900,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     #ifdef LLGL_GLEXT_BASE_INSTANCE
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDrawElementsInstancedBaseVertexBaseInstance(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -717,10 +913,31 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
     #endif
 }
 
+void GLImmediateCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    #ifdef LLGL_GLEXT_BASE_INSTANCE
+    LLGL_FLUSH_PENDING_STATES();
+    const GLenum drawMode = GetDrawMode();
+    const GLenum indexType = GetIndexType();
+    for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+    {
+        glDrawElementsInstancedBaseVertexBaseInstance(
+            drawMode,
+            static_cast<GLsizei>(draws->numIndices),
+            indexType,
+            GetIndicesOffset(draws->firstIndex),
+            static_cast<GLsizei>(draws->numInstances),
+            draws->vertexOffset,
+            draws->firstInstance
+        );
+    }
+    #endif
+}
+
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
 
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -736,7 +953,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
 
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -773,7 +990,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
 
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -790,7 +1007,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
 
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -826,12 +1043,83 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     #endif
 }
 
+void GLImmediateCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_PENDING_STATES();
+
+    /* Bind indirect argument buffer and draw count buffer */
+    auto& argumentsBufferGL = LLGL_CAST(GLBuffer&, argumentsBuffer);
+    auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, argumentsBufferGL.GetID());
+    stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(argumentsOffset);
+    glMultiDrawArraysIndirectCountARB(
+        GetDrawMode(),
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    #endif
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_PENDING_STATES();
+
+    /* Bind indirect argument buffer and draw count buffer */
+    auto& argumentsBufferGL = LLGL_CAST(GLBuffer&, argumentsBuffer);
+    auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, argumentsBufferGL.GetID());
+    stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(argumentsOffset);
+    glMultiDrawElementsIndirectCountARB(
+        GetDrawMode(),
+        GetIndexType(),
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    #endif
+}
+
+void GLImmediateCommandBuffer::DrawMeshTasks(std::uint32_t /*numThreadGroupsX*/, std::uint32_t /*numThreadGroupsY*/, std::uint32_t /*numThreadGroupsZ*/)
+{
+    // dummy - not supported by OpenGL
+}
+
+void GLImmediateCommandBuffer::DrawMeshTasksIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // dummy - not supported by OpenGL
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     #ifdef LLGL_GLEXT_COMPUTE_SHADER
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     glDispatchCompute(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
     #endif
 }
@@ -839,7 +1127,7 @@ void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint3
 void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #ifdef LLGL_GLEXT_COMPUTE_SHADER
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATES();
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DispatchIndirectBuffer, bufferGL.GetID());
     glDispatchComputeIndirect(static_cast<GLintptr>(offset));
@@ -894,6 +1182,17 @@ bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void GLImmediateCommandBuffer::FlushUniformBlocks()
+{
+    if (const GLUniformBlockStorage* uniformBlocks = FlushAndGetUniformBlocks())
+        uniformBlocks->BindBlocks(*stateMngr_, uniformBlocks->GetData());
+}
+
+
 } // /namespace LLGL
 
 
@@ -10,6 +10,7 @@
 
 
 #include "GLCommandBuffer.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <memory>
 
 
@@ -40,7 +41,15 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        GLStateManager* stateMngr_ = nullptr;
+        // Uploads the uniform blocks of the bound PSO if they have been modified. See GLCommandBuffer::FlushAndGetUniformBlocks().
+        void FlushUniformBlocks();
+
+    private:
+
+        GLStateManager*     stateMngr_  = nullptr;
+        const GLRenderPass* renderPass_ = nullptr; // Render pass of the current BeginRenderPass/EndRenderPass block.
+
+        CPUProfileSpan  encodeSpan_;
 
 };
 
@@ -16,6 +16,7 @@ namespace LLGL
 /*
 Loads all suported OpenGL extensions (suported by both the OpenGL server and LLGL) and returns true on success.
 Otherwise, at least one extension was erroneously reported as available while their respective procedures could not be loaded.
+If 'abortOnFailure' is true, procedures may be loaded on their first invocation instead.
 */
 bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure = false);
 
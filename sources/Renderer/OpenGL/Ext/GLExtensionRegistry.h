@@ -30,6 +30,7 @@ enum class GLExt
 {
     /* OpenGL core extensions (ARB) */
     ARB_base_instance = 0,              // GL 4.1
+    ARB_bindless_texture,
     ARB_clear_buffer_object,
     ARB_clear_texture,
     ARB_clip_control,
@@ -47,10 +48,12 @@ enum class GLExt
     ARB_framebuffer_object,
     ARB_get_program_binary,
     ARB_get_texture_sub_image,          // GL 4.5
+    ARB_indirect_parameters,            // GL 4.6
     ARB_geometry_shader4,               // no procedures
     ARB_gl_spirv,                       // GL 4.6
     ARB_instanced_arrays,               // GL 2.1
     ARB_internalformat_query,
+    ARB_invalidate_subdata,             // GL 4.3
     ARB_internalformat_query2,
     ARB_multitexture,                   // GL 1.2
     ARB_multi_bind,                     // GL 4.3
@@ -59,6 +62,7 @@ enum class GLExt
     ARB_pipeline_statistics_query,
     ARB_polygon_offset_clamp,
     ARB_program_interface_query,        // GL 4.2
+    ARB_query_buffer_object,            // GL 4.4, no procedures
     ARB_sampler_objects,                // GL 3.2
     ARB_seamless_cubemap_per_texture,   // GL 3.2
     ARB_shader_image_load_store,
@@ -67,6 +71,7 @@ enum class GLExt
     ARB_shader_objects_30,              // GL 3.0
     ARB_shader_objects_40,              // GL 4.0
     ARB_shader_storage_buffer_object,   // GL 4.2
+    ARB_sparse_texture,
     ARB_sync,
     ARB_tessellation_shader,            // GL 3.2
     ARB_texture_compression,
@@ -80,6 +85,7 @@ enum class GLExt
     ARB_transform_feedback3,
     ARB_uniform_buffer_object,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,          // GL 4.3
     ARB_vertex_buffer_object,
     ARB_vertex_shader,
     ARB_viewport_array,
@@ -91,6 +97,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -100,6 +107,7 @@ enum class GLExt
     EXT_copy_texture,                   // GL 1.2
     EXT_draw_buffers2,
     EXT_gpu_shader4,                    // GL 2.0
+    EXT_shader_framebuffer_fetch,       // no procedures
     EXT_stencil_two_side,               //ATI_separate_stencil,
     EXT_texture3D,                      // GL 1.2
     EXT_texture_array,                  // no procedures
@@ -113,6 +121,12 @@ enum class GLExt
     NV_conservative_raster,             // no procedures
     NV_transform_feedback,
 
+    /* NVIDIA experimental extensions (NVX) */
+    NVX_gpu_memory_info,                // no procedures
+
+    /* Oculus VR specific extensions (OVR) */
+    OVR_multiview,
+
     /* Intel sepcific extensions (INTEL) */
     INTEL_conservative_rasterization,   // no procedures
 
@@ -7,21 +7,25 @@
 
 #include "../Ext/GLExtensionLoader.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../GLCore.h"
 #include "../../../Core/Exception.h"
 #include "GLCoreExtensions.h"
 #include "GLCoreExtensionsProxy.h"
 #include <LLGL/Utils/ForRange.h>
-#include <functional>
 #include <string>
-#include <map>
+#include <unordered_set>
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#   include <EGL/egl.h>
+#endif
 
 
 namespace LLGL
 {
 
 
-// OpenGL extension map type: Maps the extension name to boolean indicating whether or not the extension was loaded successully.
-using GLExtensionMap = std::map<std::string, bool>;
+// OpenGL extension set type: Contains the names of all extensions supported by the OpenGL server.
+using GLExtensionMap = std::unordered_set<std::string>;
 
 /* --- Internal functions --- */
 
@@ -35,6 +39,11 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #   ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #   endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -43,36 +52,74 @@ bool LoadGLProc(T& procAddr, const char* procName)
     return (procAddr != nullptr);
 }
 
-static void ExtractExtensionsFromString(GLExtensionMap& extensions, const std::string& extString)
+static void ExtractExtensionsFromString(GLExtensionMap& extensions, const char* extString)
 {
-    size_t first = 0, last = 0;
-
-    /* Find next extension name in string */
-    while ( ( last = extString.find(' ', first) ) != std::string::npos )
+    /* Store each space separated extension name in hash-set */
+    for (const char* first = extString; *first != '\0';)
     {
-        /* Store current extension name in hash-map */
-        auto name = extString.substr(first, last - first);
-        extensions[name] = false;
-        first = last + 1;
+        const char* last = first;
+        while (*last != ' ' && *last != '\0')
+            ++last;
+
+        if (last > first)
+            extensions.emplace(first, static_cast<std::size_t>(last - first));
+
+        first = (*last == ' ' ? last + 1 : last);
     }
 }
 
 
 #ifndef __APPLE__
 
-using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOnFailure, bool usePlaceholder)>;
+// Determines how the procedures of an OpenGL extension are loaded.
+enum class GLProcLoadMode
+{
+    Immediate,      // Resolve all procedures now and fail if any of them is unavailable.
+    Deferred,       // Install trampolines that resolve each procedure on its first invocation.
+    Placeholder,    // Install proxies that report illegal use of an unsupported extension.
+};
+
+/*
+Trampoline for an OpenGL procedure that is resolved on its first invocation.
+This avoids thousands of wglGetProcAddress/glXGetProcAddress calls at startup for procedures an application never uses.
+TTag must provide the static functions Name() and Proc(), the latter returning a reference to the global procedure pointer.
+*/
+template <typename TTag, typename TProc>
+struct GLDeferredProc;
+
+template <typename TTag, typename TRet, typename... TArgs>
+struct GLDeferredProc<TTag, TRet (APIENTRY*)(TArgs...)>
+{
+    static TRet APIENTRY Invoke(TArgs... args)
+    {
+        if (!LoadGLProc(TTag::Proc(), TTag::Name()))
+            ErrUnsupportedGLProc(TTag::Name());
+        return TTag::Proc()(args...);
+    }
+};
+
+using LoadGLExtensionProc = bool (*)(const char* extName, bool abortOnFailure, GLProcLoadMode loadMode);
 
 #define DECL_LOADGLEXT_PROC(EXTNAME) \
-    Load_GL_ ## EXTNAME(const char* extName, bool abortOnFailure, bool usePlaceholder)
+    Load_GL_ ## EXTNAME(const char* extName, bool abortOnFailure, GLProcLoadMode loadMode)
 
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
 #define LOAD_GLPROC(NAME)                                                           \
-    if (usePlaceholder)                                                             \
+    if (loadMode == GLProcLoadMode::Placeholder)                                    \
     {                                                                               \
         NAME = Proxy_##NAME;                                                        \
     }                                                                               \
+    else if (loadMode == GLProcLoadMode::Deferred)                                  \
+    {                                                                               \
+        struct Tag                                                                  \
+        {                                                                           \
+            static const char* Name() { return #NAME; }                             \
+            static decltype(NAME)& Proc() { return NAME; }                          \
+        };                                                                          \
+        NAME = GLDeferredProc<Tag, decltype(NAME)>::Invoke;                         \
+    }                                                                               \
     else if (!LoadGLProc(NAME, #NAME))                                              \
     {                                                                               \
         if (abortOnFailure)                                                         \
@@ -157,6 +204,16 @@ static bool DECL_LOADGLEXT_PROC(ARB_vertex_array_object)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_vertex_attrib_binding)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_vertex_shader)
 {
     LOAD_GLPROC( glEnableVertexAttribArray  );
@@ -201,6 +258,8 @@ static bool DECL_LOADGLEXT_PROC(ARB_uniform_buffer_object)
     LOAD_GLPROC( glGetUniformBlockIndex      );
     LOAD_GLPROC( glGetActiveUniformBlockiv   );
     LOAD_GLPROC( glGetActiveUniformBlockName );
+    LOAD_GLPROC( glGetUniformIndices         );
+    LOAD_GLPROC( glGetActiveUniformsiv       );
     LOAD_GLPROC( glUniformBlockBinding       );
     LOAD_GLPROC( glBindBufferBase            );
     return true;
@@ -233,6 +292,7 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_elements_base_vertex)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
@@ -609,6 +669,12 @@ static bool DECL_LOADGLEXT_PROC(KHR_debug)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
 {
     LOAD_GLPROC( glClipControl );
@@ -653,6 +719,16 @@ static bool DECL_LOADGLEXT_PROC(NV_transform_feedback)
     return true;
 }
 
+#ifdef GL_OVR_multiview
+
+static bool DECL_LOADGLEXT_PROC(OVR_multiview)
+{
+    LOAD_GLPROC( glFramebufferTextureMultiviewOVR );
+    return true;
+}
+
+#endif // /GL_OVR_multiview
+
 static bool DECL_LOADGLEXT_PROC(ARB_sync)
 {
     LOAD_GLPROC( glFenceSync      );
@@ -701,6 +777,12 @@ static bool DECL_LOADGLEXT_PROC(ARB_texture_storage)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_sparse_texture)
+{
+    LOAD_GLPROC( glTexPageCommitmentARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_texture_storage_multisample)
 {
     LOAD_GLPROC( glTexStorage2DMultisample );
@@ -732,6 +814,14 @@ static bool DECL_LOADGLEXT_PROC(ARB_polygon_offset_clamp)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_invalidate_subdata)
+{
+    LOAD_GLPROC( glInvalidateTexImage );
+    LOAD_GLPROC( glInvalidateBufferData );
+    LOAD_GLPROC( glInvalidateFramebuffer );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_shader_image_load_store)
 {
     LOAD_GLPROC( glBindImageTexture );
@@ -739,6 +829,15 @@ static bool DECL_LOADGLEXT_PROC(ARB_shader_image_load_store)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_bindless_texture)
+{
+    LOAD_GLPROC( glGetTextureHandleARB             );
+    LOAD_GLPROC( glGetTextureSamplerHandleARB      );
+    LOAD_GLPROC( glMakeTextureHandleResidentARB    );
+    LOAD_GLPROC( glMakeTextureHandleNonResidentARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_framebuffer_no_attachments)
 {
     LOAD_GLPROC( glFramebufferParameteri     );
@@ -767,6 +866,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_multi_draw_indirect)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_indirect_parameters)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCountARB   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCountARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_get_texture_sub_image)
 {
     LOAD_GLPROC( glGetTextureSubImage           );
@@ -906,7 +1012,7 @@ static GLExtensionMap QuerySupportedOpenGLExtensions(bool isCoreProfile)
             {
                 /* Get current extension string */
                 if (auto extString = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)))
-                    extensions[extString] = false;
+                    extensions.emplace(extString);
             }
         }
 
@@ -954,7 +1060,7 @@ static void IncludeDefaultCoreProfileExtensions(GLExtensionMap& extensions)
         "GL_EXT_texture3D",
     };
     for (const auto& ext : coreProfileDefaultExtenions)
-        extensions[ext] = false;
+        extensions.insert(ext);
 }
 
 // Includes all GL extensions that are implied by other extensions
@@ -965,7 +1071,7 @@ static void IncludeImpliedExtensions(GLExtensionMap& extensions)
         if (extensions.find(originExtension) != extensions.end())
         {
             for (auto ext : impliedExtensions)
-                extensions[ext] = false;
+                extensions.emplace(ext);
         }
     };
     ImplyExtension("GL_ARB_gpu_shader5", { "GL_ARB_geometry_shader4" });
@@ -983,8 +1089,6 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     if (g_OpenGLExtensionsLoaded)
         return true;
 
-    GLExtensionMap extensions = QuerySupportedOpenGLExtensions(isCoreProfile);
-
     #ifdef __APPLE__
 
     /* Enable OpenGL extension support by host MacOS version */
@@ -1056,28 +1160,37 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
 
     #else // __APPLE__
 
-    auto LoadExtension = [&extensions, abortOnFailure](const char* extName, const LoadGLExtensionProc& extLoadingProc, GLExt extensionID) -> void
+    /* Extension names are only queried once, since the set of extensions is the same for all contexts LLGL creates */
+    GLExtensionMap extensions = QuerySupportedOpenGLExtensions(isCoreProfile);
+
+    auto LoadExtension = [&extensions, abortOnFailure](const char* extName, LoadGLExtensionProc extLoadingProc, GLExt extensionID) -> void
     {
-        /* Try to load OpenGL extension */
-        auto it = extensions.find(extName);
-        if (it != extensions.end())
+        if (extensions.find(extName) != extensions.end())
         {
-            if (extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ false))
+            if (abortOnFailure)
+            {
+                /*
+                Defer resolving procedures until they are first called, since a procedure that fails to load would abort anyway.
+                Such a procedure is then reported as unsupported on its first invocation.
+                */
+                extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Deferred);
+                RegisterExtension(extensionID);
+            }
+            else if (extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Immediate))
             {
-                /* Enable extension in registry */
+                /* Enable extension in registry only if all procedures could be loaded */
                 RegisterExtension(extensionID);
-                it->second = true;
             }
             else
             {
                 /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-                extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ true);
+                extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Placeholder);
             }
         }
         else
         {
-            /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-            extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ true);
+            /* Use dummy procedures to detect illegal use of OpenGL extension */
+            extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Placeholder);
         }
     };
 
@@ -1107,6 +1220,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     /* Load hardware buffer extensions */
     LOAD_GLEXT( ARB_vertex_buffer_object         );
     LOAD_GLEXT( ARB_vertex_array_object          );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     LOAD_GLEXT( ARB_vertex_shader                );
     LOAD_GLEXT( ARB_framebuffer_object           );
     LOAD_GLEXT( ARB_uniform_buffer_object        );
@@ -1156,6 +1270,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( ARB_clip_control                 );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
@@ -1168,16 +1283,23 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_gl_spirv                     );
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
+    LOAD_GLEXT( ARB_sparse_texture               );
     LOAD_GLEXT( ARB_buffer_storage               );
     LOAD_GLEXT( ARB_copy_buffer                  );
     LOAD_GLEXT( ARB_copy_image                   );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
     LOAD_GLEXT( ARB_shader_image_load_store      );
+    LOAD_GLEXT( ARB_bindless_texture             );
     LOAD_GLEXT( ARB_framebuffer_no_attachments   );
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_indirect_parameters          );
     LOAD_GLEXT( ARB_get_texture_sub_image        );
+    #ifdef GL_OVR_multiview
+    LOAD_GLEXT( OVR_multiview                    );
+    #endif
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -1190,11 +1312,13 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_texture_cube_map             );
     ENABLE_GLEXT( ARB_texture_cube_map_array       );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
     ENABLE_GLEXT( ARB_seamless_cubemap_per_texture );
     ENABLE_GLEXT( ARB_ES3_compatibility            );
     ENABLE_GLEXT( EXT_texture_array                );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( NV_conservative_raster           );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
@@ -184,6 +184,14 @@ DECL_GLPROC(PFNGLDELETEVERTEXARRAYSPROC,                            glDeleteVert
 DECL_GLPROC(PFNGLBINDVERTEXARRAYPROC,                               glBindVertexArray,                              void,           (GLuint));
 DECL_GLPROC(PFNGLISVERTEXARRAYPROC,                                 glIsVertexArray,                                GLboolean,      (GLuint));
 
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(PFNGLBINDVERTEXBUFFERPROC,                              glBindVertexBuffer,                             void,           (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(PFNGLVERTEXATTRIBFORMATPROC,                            glVertexAttribFormat,                           void,           (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBIFORMATPROC,                           glVertexAttribIFormat,                          void,           (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBBINDINGPROC,                           glVertexAttribBinding,                          void,           (GLuint, GLuint));
+DECL_GLPROC(PFNGLVERTEXBINDINGDIVISORPROC,                          glVertexBindingDivisor,                         void,           (GLuint, GLuint));
+
 /* GL_ARB_framebuffer_object */
 
 DECL_GLPROC(PFNGLGENRENDERBUFFERSPROC,                              glGenRenderbuffers,                             void,           (GLsizei n, GLuint *));
@@ -222,6 +230,7 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDPROC,                         glDrawElemen
 
 DECL_GLPROC(PFNGLDRAWELEMENTSBASEVERTEXPROC,                        glDrawElementsBaseVertex,                       void,           (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,               glDrawElementsInstancedBaseVertex,              void,           (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,                   glMultiDrawElementsBaseVertex,                  void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -400,6 +409,8 @@ DECL_GLPROC(PFNGLGETPROGRAMPIPELINEINFOLOGPROC,                     glGetProgram
 DECL_GLPROC(PFNGLGETUNIFORMBLOCKINDEXPROC,                          glGetUniformBlockIndex,                         GLuint,         (GLuint, const GLchar*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC,                       glGetActiveUniformBlockiv,                      void,           (GLuint, GLuint, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC,                     glGetActiveUniformBlockName,                    void,           (GLuint, GLuint, GLsizei, GLsizei*, GLchar*));
+DECL_GLPROC(PFNGLGETUNIFORMINDICESPROC,                             glGetUniformIndices,                            void,           (GLuint, GLsizei, const GLchar* const*, GLuint*));
+DECL_GLPROC(PFNGLGETACTIVEUNIFORMSIVPROC,                           glGetActiveUniformsiv,                          void,           (GLuint, GLsizei, const GLuint*, GLenum, GLint*));
 DECL_GLPROC(PFNGLUNIFORMBLOCKBINDINGPROC,                           glUniformBlockBinding,                          void,           (GLuint, GLuint, GLuint));
 DECL_GLPROC(PFNGLBINDBUFFERBASEPROC,                                glBindBufferBase,                               void,           (GLenum, GLuint, GLuint));
 
@@ -454,6 +465,10 @@ DECL_GLPROC(PFNGLGETOBJECTLABELPROC,                                glGetObjectL
 DECL_GLPROC(PFNGLOBJECTPTRLABELPROC,                                glObjectPtrLabel,                               void,           (const void*, GLsizei, const GLchar*));
 DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectPtrLabel,                            void,           (const void*, GLsizei, GLsizei*, GLchar*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
 /* GL_ARB_clip_control */
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
@@ -475,6 +490,12 @@ DECL_GLPROC(PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC,                   glTransformF
 DECL_GLPROC(PFNGLGETVARYINGLOCATIONNVPROC,                          glGetVaryingLocationNV,                         GLint,          (GLuint, const GLchar*));
 DECL_GLPROC(PFNGLGETACTIVEVARYINGNVPROC,                            glGetActiveVaryingNV,                           void,           (GLuint, GLuint, GLsizei, GLsizei*, GLsizei*, GLenum*, GLchar*));
 
+/* GL_OVR_multiview */
+
+#ifdef GL_OVR_multiview
+DECL_GLPROC(PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC,                glFramebufferTextureMultiviewOVR,               void,           (GLenum, GLenum, GLuint, GLint, GLint, GLsizei));
+#endif
+
 /* GL_ARB_sync */
 
 DECL_GLPROC(PFNGLFENCESYNCPROC,                                     glFenceSync,                                    GLsync,         (GLenum, GLbitfield));
@@ -511,6 +532,10 @@ DECL_GLPROC(PFNGLTEXSTORAGE1DPROC,                                  glTexStorage
 DECL_GLPROC(PFNGLTEXSTORAGE2DPROC,                                  glTexStorage2D,                                 void,           (GLenum, GLsizei, GLenum, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLTEXSTORAGE3DPROC,                                  glTexStorage3D,                                 void,           (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei));
 
+/* GL_ARB_sparse_texture */
+
+DECL_GLPROC(PFNGLTEXPAGECOMMITMENTARBPROC,                          glTexPageCommitmentARB,                         void,           (GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLboolean));
+
 /* GL_ARB_texture_storage_multisample */
 
 DECL_GLPROC(PFNGLTEXSTORAGE2DMULTISAMPLEPROC,                       glTexStorage2DMultisample,                      void,           (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean));
@@ -532,11 +557,24 @@ DECL_GLPROC(PFNGLCOPYIMAGESUBDATAPROC,                              glCopyImageS
 
 DECL_GLPROC(PFNGLPOLYGONOFFSETCLAMPPROC,                            glPolygonOffsetClamp,                           void,           (GLfloat, GLfloat, GLfloat));
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(PFNGLINVALIDATETEXIMAGEPROC,                            glInvalidateTexImage,                           void,           (GLuint, GLint));
+DECL_GLPROC(PFNGLINVALIDATEBUFFERDATAPROC,                          glInvalidateBufferData,                         void,           (GLuint));
+DECL_GLPROC(PFNGLINVALIDATEFRAMEBUFFERPROC,                         glInvalidateFramebuffer,                        void,           (GLenum, GLsizei, const GLenum*));
+
 /* GL_ARB_shader_image_load_store */
 
 DECL_GLPROC(PFNGLBINDIMAGETEXTUREPROC,                              glBindImageTexture,                             void,           (GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum));
 DECL_GLPROC(PFNGLMEMORYBARRIERPROC,                                 glMemoryBarrier,                                void,           (GLbitfield));
 
+/* GL_ARB_bindless_texture */
+
+DECL_GLPROC(PFNGLGETTEXTUREHANDLEARBPROC,                           glGetTextureHandleARB,                          GLuint64,       (GLuint));
+DECL_GLPROC(PFNGLGETTEXTURESAMPLERHANDLEARBPROC,                    glGetTextureSamplerHandleARB,                   GLuint64,       (GLuint, GLuint));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC,                  glMakeTextureHandleResidentARB,                 void,           (GLuint64));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,               glMakeTextureHandleNonResidentARB,              void,           (GLuint64));
+
 /* GL_ARB_framebuffer_no_attachments */
 
 DECL_GLPROC(PFNGLFRAMEBUFFERPARAMETERIPROC,                         glFramebufferParameteri,                        void,           (GLenum, GLenum, GLint));
@@ -557,6 +595,11 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElemen
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC,                     glMultiDrawElementsIndirect,                    void,           (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC,               glMultiDrawArraysIndirectCountARB,              void,           (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC,             glMultiDrawElementsIndirectCountARB,            void,           (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
 /* GL_ARB_get_texture_sub_image */
 
 DECL_GLPROC(PFNGLGETTEXTURESUBIMAGEPROC,                            glGetTextureSubImage,                           void,           (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void*));
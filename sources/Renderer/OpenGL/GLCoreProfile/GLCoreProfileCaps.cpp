@@ -207,6 +207,11 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasPipelineCaching             = (HasExtension(GLExt::ARB_get_program_binary) && GLGetInt(GL_NUM_PROGRAM_BINARY_FORMATS) > 0);
     features.hasPipelineStatistics          = HasExtension(GLExt::ARB_pipeline_statistics_query);
     features.hasRenderCondition             = true;
+    features.hasIndirectDrawingCount        = HasExtension(GLExt::ARB_indirect_parameters);
+    features.hasSparseTextures              = (HasExtension(GLExt::ARB_sparse_texture) && HasExtension(GLExt::ARB_texture_storage));
+    features.hasQueryResolve                = (HasExtension(GLExt::ARB_query_buffer_object) && HasExtension(GLExt::ARB_timer_query));
+    features.hasTextureMinLODClamp          = true;
+    features.hasMultiview                   = HasExtension(GLExt::OVR_multiview);
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
@@ -280,6 +285,21 @@ static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimit
     /* Determine tessellation limits */
     limits.maxTessFactor = GLGetUInt(GL_MAX_TESS_GEN_LEVEL);
 
+    /* All dynamic states are supported, since GL has no monolithic pipeline state objects */
+    limits.dynamicStates = (
+        DynamicStateFlags::CullMode             |
+        DynamicStateFlags::DepthState           |
+        DynamicStateFlags::StencilState         |
+        DynamicStateFlags::PrimitiveTopology    |
+        DynamicStateFlags::DepthBias
+    );
+
+    /* Determine maximum number of views for multiview render passes */
+    #ifdef LLGL_GLEXT_MULTIVIEW
+    if (features.hasMultiview)
+        limits.maxMultiviewViews = std::min(GLGetUInt(GL_MAX_VIEWS_OVR), 32u);
+    #endif // /LLGL_GLEXT_MULTIVIEW
+
     /* Determine maximum number of samples for render-target attachments */
     #ifdef GL_ARB_texture_multisample
     if (HasExtension(GLExt::ARB_texture_multisample))
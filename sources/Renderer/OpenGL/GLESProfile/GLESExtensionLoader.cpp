@@ -177,6 +177,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     {
         ENABLE_GLEXT(ARB_ES3_compatibility);
         ENABLE_GLEXT(ARB_get_program_binary);
+        ENABLE_GLEXT(ARB_invalidate_subdata);
         ENABLE_GLEXT(ARB_shader_objects_30);
     }
 
@@ -194,6 +195,15 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_copy_image);
     }
 
+    #ifndef LLGL_OS_IOS
+
+    /* Enable optional extensions without procedures only if they are reported by the driver */
+    const GLESExtensionMap supportedExtensions = QuerySupportedOpenGLExtensions(isCoreProfile);
+    if (supportedExtensions.find("GL_EXT_shader_framebuffer_fetch") != supportedExtensions.end())
+        ENABLE_GLEXT(EXT_shader_framebuffer_fetch);
+
+    #endif // /LLGL_OS_IOS
+
     #undef ENABLE_GLEXT
 
     #if 0 //TODO
@@ -160,6 +160,8 @@ static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
     features.hasPipelineCaching             = (version >= 300); // GLES 3.0
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = false;
+    features.hasInputAttachments            = HasExtension(GLExt::EXT_shader_framebuffer_fetch);
+    features.hasTextureMinLODClamp          = (version >= 300); // GLES 3.0
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
@@ -212,6 +214,15 @@ static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
     /* Determine tessellation limits */
     limits.maxTessFactor                    = GLGetUInt(GL_MAX_TESS_GEN_LEVEL);
     #endif
+
+    /* All dynamic states are supported, since GL has no monolithic pipeline state objects */
+    limits.dynamicStates                    = (
+        DynamicStateFlags::CullMode             |
+        DynamicStateFlags::DepthState           |
+        DynamicStateFlags::StencilState         |
+        DynamicStateFlags::PrimitiveTopology    |
+        DynamicStateFlags::DepthBias
+    );
 }
 
 static void GLGetTextureLimits(const RenderingFeatures& features, RenderingLimits& limits, GLint version)
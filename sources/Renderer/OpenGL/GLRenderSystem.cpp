@@ -9,21 +9,27 @@
 #include "GLProfile.h"
 #include "Texture/GLMipGenerator.h"
 #include "Texture/GLTextureViewPool.h"
+#include "Texture/GLTextureHandlePool.h"
+#include "Texture/GLStagingPixelBuffer.h"
 #include "Texture/GLFramebufferCapture.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionRegistry.h"
 #include "RenderState/GLStatePool.h"
 #include "../RenderSystemUtils.h"
+#include "../PipelineStateUtils.h"
 #include "GLTypes.h"
 #include "GLCore.h"
 #include "Shader/GLLegacyShader.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
+#include "Buffer/GLPersistentRingBuffer.h"
 #include "../CheckedCast.h"
 #include "../BufferUtils.h"
+#include "../MemoryInfoUtils.h"
 #include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include "../../Platform/Debug.h"
 #include "GLRenderingCaps.h"
 #include "Command/GLImmediateCommandBuffer.h"
@@ -31,6 +37,7 @@
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 #ifdef LLGL_OPENGL
 #   include "Shader/GLSeparableShader.h"
@@ -52,29 +59,50 @@ static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescri
 }
 
 GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    contextMngr_  { GetGLProfileFromDesc(renderSystemDesc), renderSystemDesc.nativeHandle, renderSystemDesc.nativeHandleSize },
-    debugContext_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)                                         }
+    contextMngr_
+    {
+        GetGLProfileFromDesc(renderSystemDesc),
+        renderSystemDesc.nativeHandle,
+        renderSystemDesc.nativeHandleSize,
+        ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0)
+    },
+    debugContext_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) },
+    headless_     { ((renderSystemDesc.flags & RenderSystemFlags::Headless   ) != 0) }
 {
+    /* Persistent pipeline cache can only be mapped once the renderer info is known, i.e. after the first GL context has been created */
+    if (renderSystemDesc.pipelineCacheFilename != nullptr)
+        persistentPipelineCacheFilename_ = renderSystemDesc.pipelineCacheFilename;
+
+    /* Headless render systems never create a swap-chain, so create the primary GL context and its dependent devices right away */
+    if (headless_)
+        CreateGLContextDependentDevices(contextMngr_.MakeHeadlessContextCurrent());
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLFramebufferCapture::Get().Clear();
+    GLTextureHandlePool::Get().Clear();
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
     GLStatePool::Get().Clear();
+    GLPersistentRingBuffer::Get().Clear();
+    GLStagingPixelBuffer::Get().Clear();
+    GLShader::SetDefaultUniformBufferSlot(-1);
 }
 
 /* ----- Swap-chain ----- */
 
 SwapChain* GLRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
+    if (contextMngr_.IsSurfaceless())
+        LLGL_TRAP("cannot create OpenGL swap-chain for headless render system with surfaceless GL context");
+
     const bool isFirstSwapChain = swapChains_.empty();
     auto* swapChainGL = swapChains_.emplace<GLSwapChain>(swapChainDesc, surface, contextMngr_);
 
-    /* Create devices that require an active GL context */
-    if (isFirstSwapChain)
+    /* Create devices that require an active GL context, unless they have already been created for a headless render system */
+    if (isFirstSwapChain && !headless_)
         CreateGLContextDependentDevices(swapChainGL->GetStateManager());
 
     return swapChainGL;
@@ -156,8 +184,16 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& bufferDe
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateBuffer");
+
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
+    LLGL_ASSERT(
+        !workerContextScope.IsWorkerContext() || (bufferDesc.bindFlags & BindFlags::VertexBuffer) == 0,
+        "vertex buffers cannot be created on a GL worker context"
+    );
+
     auto bufferGL = CreateGLBuffer(bufferDesc, initialData);
 
     /* Store meta data for certain types of buffers */
@@ -216,6 +252,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
     buffers_.erase(&buffer);
 }
 
@@ -226,6 +263,7 @@ void GLRenderSystem::Release(BufferArray& bufferArray)
 
 void GLRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
 }
@@ -318,8 +356,12 @@ void GLRenderSystem::ValidateGLTextureType(const TextureType type)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateTexture");
+
     ValidateGLTextureType(textureDesc.type);
 
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
+
     /* Create <GLTexture> object; will result in a GL renderbuffer or texture instance */
     auto* textureGL = textures_.emplace<GLTexture>(textureDesc);
 
@@ -331,13 +373,21 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
     textures_.erase(&texture);
 }
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    /* Bind texture and write texture sub data */
+    GLWorkerContextScope workerContextScope{ contextMngr_ };
+
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /* Stage large images through the pixel unpack buffer; it is only used by the primary GL context */
+    if (!workerContextScope.IsWorkerContext() && GLStagingPixelBuffer::Get().TextureSubImage(textureGL, textureRegion, srcImageView))
+        return;
+
+    /* Bind texture and write texture sub data */
     textureGL.TextureSubImage(textureRegion, srcImageView, false);
 }
 
@@ -356,6 +406,10 @@ void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     }
     #endif
 
+    /* Read large images through the pixel pack buffer */
+    if (GLStagingPixelBuffer::Get().GetTextureSubImage(textureGL, textureRegion, dstImageView))
+        return;
+
     textureGL.GetTextureSubImage(textureRegion, dstImageView, false);
 }
 
@@ -374,11 +428,9 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
     else
     #endif
     {
-        /* Create native GL sampler state */
+        /* Create sampler state that shares its native GL sampler with all other samplers of identical parameters */
         LLGL_ASSERT(HasNativeSamplers(), "LLGL was not compiled with LLGL_GL_ENABLE_OPENGL2X but \"GL_ARB_sampler_objects\" is not supported");
-        auto* samplerGL = samplers_.emplace<GLSampler>(samplerDesc.debugName);
-        samplerGL->SamplerParameters(samplerDesc);
-        return samplerGL;
+        return samplers_.emplace<GLSampler>(samplerDesc);
     }
 }
 
@@ -399,7 +451,7 @@ void GLRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* GLRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<GLResourceHeap>(resourceHeapDesc, initialResourceViews);
+    return resourceHeaps_.emplace<GLResourceHeap>(resourceHeapDesc, initialResourceViews, contextMngr_.GetProfile().bindlessTextureBufferSlot);
 }
 
 void GLRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -457,6 +509,10 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
         case ShaderType::Compute:
             LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasComputeShaders);
             break;
+        case ShaderType::Task:
+        case ShaderType::Mesh:
+            LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasMeshShaders);
+            break;
         default:
             break;
     }
@@ -466,7 +522,7 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     if (HasExtension(GLExt::ARB_separate_shader_objects) && (shaderDesc.flags & ShaderCompileFlags::SeparateShader) != 0)
     {
         /* Create separable shader for program pipeline */
-        return shaders_.emplace<GLSeparableShader>(shaderDesc);
+        return shaders_.emplace<GLSeparableShader>(shaderDesc, persistentPipelineCache_.get());
     }
     else
     #endif
@@ -513,8 +569,24 @@ void GLRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
+// GL program binaries only depend on the shaders, so fixed-function states are not part of the key.
+static std::uint64_t GetPersistentPipelineCacheKey(const ArrayView<Shader*>& shaders)
+{
+    PersistentPipelineCacheKey key;
+    for (Shader* shader : shaders)
+    {
+        if (shader != nullptr)
+            key.Append(LLGL_CAST(const GLShader*, shader)->GetContentHash());
+    }
+    return key.Get();
+}
+
 PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+        return CreatePipelineStateWithPersistentCache(pipelineStateDesc, GetPersistentPipelineCacheKey(GetShadersAsArray(pipelineStateDesc)));
     return pipelineStates_.emplace<GLGraphicsPSO>(
         pipelineStateDesc,
         GetRenderingCaps().limits,
@@ -524,6 +596,10 @@ PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
 
 PipelineState* GLRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+        return CreatePipelineStateWithPersistentCache(pipelineStateDesc, GetPersistentPipelineCacheKey(GetShadersAsArray(pipelineStateDesc)));
     return pipelineStates_.emplace<GLComputePSO>(
         pipelineStateDesc,
         (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
@@ -569,6 +645,28 @@ bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
         return false;
 }
 
+bool GLRenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    outInfo = MemoryInfo{};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+
+    #ifdef GL_NVX_gpu_memory_info
+    if (HasExtension(GLExt::NVX_gpu_memory_info))
+    {
+        /* Query total and currently available video memory (in KB) */
+        GLint totalMemoryKB = 0, availableMemoryKB = 0;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &totalMemoryKB);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &availableMemoryKB);
+
+        const std::uint64_t budget  = static_cast<std::uint64_t>(totalMemoryKB) * 1024u;
+        const std::uint64_t usage   = static_cast<std::uint64_t>(std::max(0, totalMemoryKB - availableMemoryKB)) * 1024u;
+        AppendMemoryHeapInfo(outInfo, true, budget, usage);
+    }
+    #endif // /GL_NVX_gpu_memory_info
+
+    return true;
+}
+
 
 /*
  * ======= Private: =======
@@ -583,9 +681,36 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLStateManager& stateManage
     /* Create command queue instance */
     commandQueue_ = MakeUnique<GLCommandQueue>(stateManager);
 
-    /* Query renderer information and limits */
+    /* Create shared GL contexts for worker threads */
+    contextMngr_.CreateWorkerContexts(contextMngr_.GetProfile().numWorkerContexts);
+
+    /* Query renderer information and limits; concurrent resource creation depends on the worker contexts */
     QueryRendererInfo();
     QueryRenderingCaps();
+
+    #ifdef GL_KHR_parallel_shader_compile
+    /* Let the driver choose the number of background threads to compile shaders and link programs */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    #endif
+
+    /* Move default uniforms into uniform blocks, which are written into the persistent ring buffer */
+    const int uniformBufferSlot = contextMngr_.GetProfile().uniformBufferSlot;
+    if (uniformBufferSlot >= 0 && HasExtension(GLExt::ARB_uniform_buffer_object) && GLPersistentRingBuffer::IsSupported())
+        GLShader::SetDefaultUniformBufferSlot(uniformBufferSlot);
+
+    /* Map persistent pipeline cache file now that the renderer info is known */
+    if (!persistentPipelineCacheFilename_.empty() && GetRenderingCaps().features.hasPipelineCaching)
+        persistentPipelineCache_ = MakeUnique<PersistentPipelineCache>(persistentPipelineCacheFilename_.c_str(), GetRendererInfo());
+}
+
+template <typename TPipelineDesc>
+PipelineState* GLRenderSystem::CreatePipelineStateWithPersistentCache(const TPipelineDesc& pipelineStateDesc, std::uint64_t key)
+{
+    GLPipelineCache transientCache{ persistentPipelineCache_->Find(key) };
+    PipelineState* pipelineState = CreatePipelineState(pipelineStateDesc, &transientCache);
+    persistentPipelineCache_->Store(key, transientCache.GetBlob());
+    return pipelineState;
 }
 
 #ifdef GL_KHR_debug
@@ -703,6 +828,7 @@ void GLRenderSystem::QueryRenderingCaps()
 {
     RenderingCapabilities caps;
     GLQueryRenderingCaps(caps);
+    caps.features.hasConcurrentResourceCreation = contextMngr_.HasWorkerContexts();
     SetRenderingCaps(caps);
 }
 
@@ -40,9 +40,11 @@
 #include "RenderState/GLResourceHeap.h"
 
 #include "../ProxyPipelineCache.h"
+#include "../PersistentPipelineCache.h"
 
 #include <string>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 
@@ -63,6 +65,8 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
     private:
 
         void CreateGLContextDependentDevices(GLStateManager& stateManager);
@@ -74,6 +78,10 @@ class GLRenderSystem final : public RenderSystem
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
+        // Creates a PSO with a transient pipeline cache whose blob is stored in the persistent pipeline cache.
+        template <typename TPipelineDesc>
+        PipelineState* CreatePipelineStateWithPersistentCache(const TPipelineDesc& pipelineStateDesc, std::uint64_t key);
+
         void ValidateGLTextureType(const TextureType type);
 
     private:
@@ -82,6 +90,7 @@ class GLRenderSystem final : public RenderSystem
 
         GLContextManager                        contextMngr_;
         bool                                    debugContext_   = false;
+        bool                                    headless_       = false;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectInstance<GLCommandQueue>        commandQueue_;
@@ -104,6 +113,9 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLQueryHeap>          queryHeaps_;
         HWObjectContainer<GLFence>              fences_;
 
+        std::string                             persistentPipelineCacheFilename_;
+        std::unique_ptr<PersistentPipelineCache> persistentPipelineCache_;
+
 };
 
 
@@ -47,7 +47,7 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClearStencil );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClear );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClearAttachmentsWithRenderPass );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClearBuffers );
-LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindVertexArray );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindVertexInputLayout );
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindGL2XVertexArray );
 #endif
@@ -63,6 +63,10 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindRenderTarget );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindPipelineState );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetBlendColor );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetStencilRef );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetCullMode );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetDepthBias );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetDepthState );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetStencilState );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetUniforms );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginQuery );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndQuery );
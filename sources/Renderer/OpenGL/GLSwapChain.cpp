@@ -8,6 +8,9 @@
 #include "GLSwapChain.h"
 #include "../TextureUtils.h"
 #include "Platform/GLContextManager.h"
+#include "../../Core/CPUProfilerUtils.h"
+#include "../../Core/CoreUtils.h"
+#include <LLGL/Format.h>
 #include <LLGL/Platform/Platform.h>
 
 #ifdef LLGL_OS_LINUX
@@ -19,6 +22,23 @@ namespace LLGL
 {
 
 
+// Returns the descriptor for the default swap-chain render pass, which loads and stores all attachments unless the depth-stencil buffer is discarded.
+static RenderPassDescriptor GetSwapChainRenderPassDesc(Format colorFormat, Format depthStencilFormat, std::uint32_t samples, bool discardDepthStencil)
+{
+    const AttachmentStoreOp depthStencilStoreOp = (discardDepthStencil ? AttachmentStoreOp::Undefined : AttachmentStoreOp::Store);
+
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.colorAttachments[0] = AttachmentFormatDescriptor{ colorFormat, AttachmentLoadOp::Load, AttachmentStoreOp::Store };
+        if (IsDepthFormat(depthStencilFormat))
+            renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ depthStencilFormat, AttachmentLoadOp::Load, depthStencilStoreOp };
+        if (IsStencilFormat(depthStencilFormat))
+            renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ depthStencilFormat, AttachmentLoadOp::Load, depthStencilStoreOp };
+        renderPassDesc.samples = samples;
+    }
+    return renderPassDesc;
+}
+
 GLSwapChain::GLSwapChain(
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
@@ -60,11 +80,32 @@ GLSwapChain::GLSwapChain(
 
     /* Get state manager and reset current framebuffer height */
     GetStateManager().ResetFramebufferHeight(framebufferHeight_);
+
+    /* Create default render pass to specify which attachments can be discarded at the end of a render pass */
+    renderPass_ = MakeUnique<GLRenderPass>(
+        GetSwapChainRenderPassDesc(GetColorFormat(), GetDepthStencilFormat(), GetSamples(), desc.discardDepthStencil)
+    );
 }
 
 void GLSwapChain::Present()
 {
-    swapChainContext_->SwapBuffers();
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+    if (swapChainContext_)
+        swapChainContext_->SwapBuffers();
+}
+
+void GLSwapChain::PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+    if (!swapChainContext_)
+        return;
+
+    if (numDamageRects > 0 && damageRects != nullptr)
+        swapChainContext_->SwapBuffersWithDamage(numDamageRects, damageRects);
+    else
+        swapChainContext_->SwapBuffers();
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
@@ -94,7 +135,7 @@ Format GLSwapChain::GetDepthStencilFormat() const
 
 const RenderPass* GLSwapChain::GetRenderPass() const
 {
-    return nullptr; // dummy
+    return renderPass_.get();
 }
 
 bool GLSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
@@ -133,6 +174,32 @@ bool GLSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
     return true;
 }
 
+void GLSwapChain::DetachSurfacePrimary()
+{
+    /* Unbind drawable surface if it is current, but keep the GL context and all its resources alive */
+    if (GLSwapChainContext::GetCurrent() == swapChainContext_.get())
+        GLSwapChainContext::MakeCurrent(nullptr);
+
+    /* Destroy the drawable surface (e.g. the EGLSurface) before the native window is destroyed */
+    swapChainContext_.reset();
+}
+
+bool GLSwapChain::AttachSurfacePrimary(const Extent2D& resolution)
+{
+    /* Create new drawable surface for the same GL context */
+    swapChainContext_ = GLSwapChainContext::Create(*context_, GetSurface());
+    if (!swapChainContext_)
+        return false;
+
+    const GLint height = static_cast<GLint>(resolution.y);
+    framebufferHeight_ = height;
+
+    GLSwapChainContext::MakeCurrent(swapChainContext_.get());
+    GetStateManager().ResetFramebufferHeight(height);
+
+    return true;
+}
+
 bool GLSwapChain::SetSwapInterval(int swapInterval)
 {
     GLSwapChainContext::MakeCurrent(swapChainContext_.get());
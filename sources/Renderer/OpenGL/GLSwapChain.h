@@ -14,6 +14,7 @@
 #include <LLGL/RendererConfiguration.h>
 #include "OpenGL.h"
 #include "RenderState/GLStateManager.h"
+#include "RenderState/GLRenderPass.h"
 #include "Platform/GLContext.h"
 #include "Platform/GLSwapChainContext.h"
 #include <memory>
@@ -41,6 +42,7 @@ class GLSwapChain final : public SwapChain
         );
 
         void Present() override;
+        void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
 
         std::uint32_t GetCurrentSwapIndex() const override;
         std::uint32_t GetNumSwapBuffers() const override;
@@ -69,6 +71,8 @@ class GLSwapChain final : public SwapChain
     private:
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
+        void DetachSurfacePrimary() override;
+        bool AttachSurfacePrimary(const Extent2D& resolution) override;
 
         bool SetSwapInterval(int swapInterval);
 
@@ -80,6 +84,7 @@ class GLSwapChain final : public SwapChain
 
         std::shared_ptr<GLContext>          context_;
         std::unique_ptr<GLSwapChainContext> swapChainContext_;
+        std::unique_ptr<GLRenderPass>       renderPass_;
         GLint                               framebufferHeight_ = 0;
 
 };
@@ -24,6 +24,10 @@
 #   define LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
 #endif
 
+#if defined GL_ARB_draw_elements_base_vertex && defined LLGL_OPENGL
+#   define LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+#endif
+
 #if defined GL_ARB_base_instance
 #   define LLGL_GLEXT_BASE_INSTANCE
 #endif
@@ -32,6 +36,10 @@
 #   define LLGL_GLEXT_MULTI_DRAW_INDIRECT
 #endif
 
+#if defined GL_ARB_indirect_parameters
+#   define LLGL_GLEXT_INDIRECT_PARAMETERS
+#endif
+
 #if defined GL_ARB_compute_shader || defined GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_COMPUTE_SHADER
 #endif
@@ -73,6 +81,10 @@
 #   define LLGL_GLEXT_CLIP_CONTROL
 #endif
 
+#if defined GL_OVR_multiview && defined LLGL_OPENGL && !defined __APPLE__
+#   define LLGL_GLEXT_MULTIVIEW
+#endif
+
 #ifdef GL_TEXTURE_BORDER_COLOR
 #   define LLGL_SAMPLER_BORDER_COLOR
 #endif
@@ -81,6 +93,14 @@
 #   define LLGL_GLEXT_MEMORY_BARRIERS
 #endif
 
+#if defined GL_ARB_invalidate_subdata || defined GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_INVALIDATE_FRAMEBUFFER
+#endif
+
+#if defined GL_ARB_texture_storage || defined GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_TEXTURE_STORAGE
+#endif
+
 // At most one of these should be defined to indicate which API
 // we'll be using to implement fixed-index primitive restart.
 #if defined GL_ES_VERSION_2_0 || defined GL_VERSION_4_3
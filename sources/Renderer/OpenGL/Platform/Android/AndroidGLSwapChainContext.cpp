@@ -11,6 +11,10 @@
 #include "../../../../Core/CoreUtils.h"
 #include "../../../../Core/Exception.h"
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Container/SmallVector.h>
+#include <LLGL/Utils/ForRange.h>
+#include <cstring>
 
 
 namespace LLGL
@@ -36,6 +40,26 @@ bool GLSwapChainContext::MakeCurrentUnchecked(GLSwapChainContext* context)
  * AndroidGLSwapChainContext class
  */
 
+#ifdef EGL_KHR_swap_buffers_with_damage
+
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    return (extensions != nullptr && std::strstr(extensions, name) != nullptr);
+}
+
+// Returns the procedure address of eglSwapBuffersWithDamageKHR or eglSwapBuffersWithDamageEXT, which share the same signature.
+static PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC LoadEGLSwapBuffersWithDamageProc(EGLDisplay display)
+{
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (HasEGLExtension(extensions, "EGL_KHR_swap_buffers_with_damage"))
+        return reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+    if (HasEGLExtension(extensions, "EGL_EXT_swap_buffers_with_damage"))
+        return reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+    return nullptr;
+}
+
+#endif // /EGL_KHR_swap_buffers_with_damage
+
 AndroidGLSwapChainContext::AndroidGLSwapChainContext(AndroidGLContext& context, Surface& surface) :
     GLSwapChainContext { context                 },
     display_           { context.GetEGLDisplay() },
@@ -49,6 +73,10 @@ AndroidGLSwapChainContext::AndroidGLSwapChainContext(AndroidGLContext& context,
     surface_ = eglCreateWindowSurface(display_, context.GetEGLConfig(), nativeHandle.window, nullptr);
     if (!surface_)
         LLGL_TRAP("eglCreateWindowSurface failed (%s)", EGLErrorToString());
+
+    #ifdef EGL_KHR_swap_buffers_with_damage
+    eglSwapBuffersWithDamage_ = LoadEGLSwapBuffersWithDamageProc(display_);
+    #endif
 }
 
 AndroidGLSwapChainContext::~AndroidGLSwapChainContext()
@@ -62,6 +90,33 @@ bool AndroidGLSwapChainContext::SwapBuffers()
     return true;
 }
 
+bool AndroidGLSwapChainContext::SwapBuffersWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    #ifdef EGL_KHR_swap_buffers_with_damage
+    if (eglSwapBuffersWithDamage_ != nullptr)
+    {
+        /* Convert damage rectangles into EGL rectangles, whose origin is in the lower-left corner of the surface */
+        EGLint surfaceHeight = 0;
+        eglQuerySurface(display_, surface_, EGL_HEIGHT, &surfaceHeight);
+
+        SmallVector<EGLint, 16> rects;
+        rects.resize(numDamageRects * 4);
+        for_range(i, numDamageRects)
+        {
+            const Scissor& rect = damageRects[i];
+            rects[i*4 + 0] = rect.x;
+            rects[i*4 + 1] = surfaceHeight - rect.y - rect.height;
+            rects[i*4 + 2] = rect.width;
+            rects[i*4 + 3] = rect.height;
+        }
+
+        return (eglSwapBuffersWithDamage_(display_, surface_, rects.data(), static_cast<EGLint>(numDamageRects)) == EGL_TRUE);
+    }
+    #endif // /EGL_KHR_swap_buffers_with_damage
+
+    return SwapBuffers();
+}
+
 void AndroidGLSwapChainContext::Resize(const Extent2D& resolution)
 {
     // dummy
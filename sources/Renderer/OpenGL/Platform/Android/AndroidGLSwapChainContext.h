@@ -12,6 +12,7 @@
 #include "../GLSwapChainContext.h"
 #include "../../OpenGL.h"
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 
 namespace LLGL
@@ -30,6 +31,7 @@ class AndroidGLSwapChainContext final : public GLSwapChainContext
         ~AndroidGLSwapChainContext();
 
         bool SwapBuffers() override;
+        bool SwapBuffersWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
         void Resize(const Extent2D& resolution) override;
 
     public:
@@ -42,6 +44,10 @@ class AndroidGLSwapChainContext final : public GLSwapChainContext
         EGLContext context_ = nullptr;
         EGLSurface surface_ = nullptr;
 
+        #ifdef EGL_KHR_swap_buffers_with_damage
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC eglSwapBuffersWithDamage_ = nullptr; // Either from EGL_KHR_swap_buffers_with_damage or EGL_EXT_swap_buffers_with_damage.
+        #endif
+
 };
 
 
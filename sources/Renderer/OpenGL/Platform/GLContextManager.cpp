@@ -9,9 +9,11 @@
 #include "../RenderState/GLStateManager.h"
 #include "../Ext/GLExtensionLoader.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../Ext/GLExtensions.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Window.h>
 #include <LLGL/Canvas.h>
+#include <LLGL/Utils/ForRange.h>
 #include <cstring>
 
 
@@ -22,16 +24,28 @@ namespace LLGL
 GLContextManager::GLContextManager(
     const RendererConfigurationOpenGL&  profile,
     const void*                         customNativeHandle,
-    std::size_t                         customNativeHandleSize)
+    std::size_t                         customNativeHandleSize,
+    bool                                headless)
 {
-    profile_.contextProfile = profile.contextProfile;
-    profile_.majorVersion   = profile.majorVersion;
-    profile_.minorVersion   = profile.minorVersion;
+    profile_.contextProfile             = profile.contextProfile;
+    profile_.majorVersion               = profile.majorVersion;
+    profile_.minorVersion               = profile.minorVersion;
+    profile_.suppressFailedExtensions   = profile.suppressFailedExtensions;
+    profile_.bindlessTextureBufferSlot  = profile.bindlessTextureBufferSlot;
+    profile_.uniformBufferSlot          = profile.uniformBufferSlot;
+    profile_.numWorkerContexts          = profile.numWorkerContexts;
     if (customNativeHandle != nullptr && customNativeHandleSize > 0)
     {
         customNativeHandle_.resize(customNativeHandleSize, UninitializeTag{});
         std::memcpy(customNativeHandle_.get(), customNativeHandle, customNativeHandleSize);
     }
+
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Headless render systems use surfaceless EGL contexts unless a custom GLX context has been specified */
+    surfaceless_ = (headless && customNativeHandle_.empty());
+    #else
+    (void)headless;
+    #endif
 }
 
 std::shared_ptr<GLContext> GLContextManager::AllocContext(const GLPixelFormat* pixelFormat, Surface* surface)
@@ -42,6 +56,103 @@ std::shared_ptr<GLContext> GLContextManager::AllocContext(const GLPixelFormat* p
         return FindOrMakeAnyContext();
 }
 
+void GLContextManager::CreateWorkerContexts(std::uint32_t numContexts)
+{
+    /* Worker contexts can only share objects with a primary GL context that was created by this manager */
+    if (numContexts == 0 || pixelFormats_.empty() || !customNativeHandle_.empty())
+        return;
+
+    const GLPixelFormatWithContext& primaryFormat = pixelFormats_.front();
+
+    std::lock_guard<std::mutex> guard{ workerContextsMutex_ };
+    workerContexts_.reserve(workerContexts_.size() + numContexts);
+
+    for_range(i, numContexts)
+    {
+        GLWorkerContext workerContext;
+        CreatePlaceholderContext(workerContext, primaryFormat.pixelFormat, primaryFormat.context.get());
+
+        /* Initialize state manager for new GL context; GLContext::Create() has made the new context current */
+        GLStateManager& stateMngr = workerContext.context->GetStateManager();
+        stateMngr.DetermineExtensionsAndLimits();
+        InitRenderStates(stateMngr);
+
+        workerContexts_.emplace_back(std::move(workerContext));
+    }
+
+    /* Make previous GL context current again */
+    GLSwapChainContext::RestoreCurrent();
+}
+
+GLSwapChainContext* GLContextManager::AcquireWorkerContext()
+{
+    std::unique_lock<std::mutex> lock{ workerContextsMutex_ };
+
+    if (workerContexts_.empty())
+        return nullptr;
+
+    for (;;)
+    {
+        /* Return first worker context that is not in use by another thread */
+        for (GLWorkerContext& workerContext : workerContexts_)
+        {
+            if (!workerContext.isAcquired)
+            {
+                workerContext.isAcquired = true;
+                return workerContext.swapChainContext.get();
+            }
+        }
+
+        /* Wait until another thread releases its worker context */
+        workerContextsAvailable_.wait(lock);
+    }
+}
+
+void GLContextManager::ReleaseWorkerContext(GLSwapChainContext* workerContext)
+{
+    {
+        std::lock_guard<std::mutex> guard{ workerContextsMutex_ };
+        for (GLWorkerContext& entry : workerContexts_)
+        {
+            if (entry.swapChainContext.get() == workerContext)
+            {
+                entry.isAcquired = false;
+                break;
+            }
+        }
+    }
+    workerContextsAvailable_.notify_one();
+}
+
+
+GLStateManager& GLContextManager::MakeHeadlessContextCurrent()
+{
+    std::shared_ptr<GLContext> primaryContext = FindOrMakeAnyContext();
+
+    if (!headlessContext_.swapChainContext)
+    {
+        const GLPixelFormatWithContext& primaryFormat = pixelFormats_.front();
+        if (surfaceless_)
+        {
+            #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+            headlessContext_.swapChainContext = GLSwapChainContext::CreateHeadless(*primaryContext);
+            #endif
+        }
+        else if (primaryFormat.surface)
+            headlessContext_.swapChainContext = GLSwapChainContext::Create(*primaryContext, *primaryFormat.surface);
+        else
+        {
+            /* Primary GL context was created for another surface, so link it to a new placeholder surface */
+            headlessContext_.surface            = CreatePlaceholderSurface();
+            headlessContext_.swapChainContext   = GLSwapChainContext::Create(*primaryContext, *headlessContext_.surface);
+        }
+    }
+
+    GLSwapChainContext::MakeCurrent(headlessContext_.swapChainContext.get());
+
+    return primaryContext->GetStateManager();
+}
+
 
 /*
  * ======= Private: =======
@@ -66,26 +177,49 @@ std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
     #endif
 }
 
-std::shared_ptr<GLContext> GLContextManager::MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface)
+void GLContextManager::CreatePlaceholderContext(GLWorkerContext& outContext, const GLPixelFormat& pixelFormat, GLContext* sharedContext)
 {
-    /* Create placeholder surface is none was specified */
-    std::unique_ptr<Surface> placeholderSurface;
-    if (surface == nullptr)
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (surfaceless_)
     {
-        placeholderSurface = CreatePlaceholderSurface();
-        surface = placeholderSurface.get();
+        outContext.context          = GLContext::CreateHeadless(pixelFormat, profile_, sharedContext);
+        outContext.swapChainContext = GLSwapChainContext::CreateHeadless(*outContext.context);
+        return;
     }
+    #endif
+
+    outContext.surface          = CreatePlaceholderSurface();
+    outContext.context          = GLContext::Create(pixelFormat, profile_, *outContext.surface, sharedContext);
+    outContext.swapChainContext = GLSwapChainContext::Create(*outContext.context, *outContext.surface);
+}
 
+std::shared_ptr<GLContext> GLContextManager::MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface)
+{
     /* Use shared GL context if there already is one */
     GLContext* sharedContext = (pixelFormats_.empty() ? nullptr : pixelFormats_.front().context.get());
 
     /* Create new GL context and append to pixel format list */
     GLPixelFormatWithContext formatWithContext;
+    formatWithContext.pixelFormat = pixelFormat;
+
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (surfaceless_)
     {
-        formatWithContext.pixelFormat   = pixelFormat;
-        formatWithContext.surface       = std::move(placeholderSurface);
-        formatWithContext.context       = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
+        /* Surfaceless contexts never require a placeholder surface */
+        formatWithContext.context = GLContext::CreateHeadless(pixelFormat, profile_, sharedContext);
     }
+    else
+    #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+    {
+        /* Create placeholder surface is none was specified */
+        if (surface == nullptr)
+        {
+            formatWithContext.surface = CreatePlaceholderSurface();
+            surface = formatWithContext.surface.get();
+        }
+        formatWithContext.context = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
+    }
+
     pixelFormats_.emplace_back(std::move(formatWithContext));
 
     std::shared_ptr<GLContext> context = pixelFormats_.back().context;
@@ -152,6 +286,50 @@ void GLContextManager::InitRenderStates(GLStateManager& stateMngr)
 }
 
 
+
+/*
+ * GLWorkerContextScope class
+ */
+
+GLWorkerContextScope::GLWorkerContextScope(GLContextManager& contextMngr) :
+    contextMngr_ { contextMngr }
+{
+    /* Only acquire a worker context if the calling thread has no current GL context, i.e. it is not the primary thread */
+    if (GLContext::GetCurrent() == nullptr)
+    {
+        workerContext_ = contextMngr_.AcquireWorkerContext();
+        if (workerContext_ != nullptr)
+        {
+            GLSwapChainContext::MakeCurrent(workerContext_);
+
+            /* Objects might have been deleted on other GL contexts since this worker context was used, so re-query its cached states */
+            workerContext_->GetGLContext().GetStateManager().ClearCache();
+        }
+    }
+}
+
+GLWorkerContextScope::~GLWorkerContextScope()
+{
+    if (workerContext_ != nullptr)
+    {
+        /* Wait until all commands of this worker context have completed before the resources are used on another GL context */
+        if (HasExtension(GLExt::ARB_sync))
+        {
+            GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(sync);
+        }
+        else
+        {
+            glFinish();
+        }
+
+        GLSwapChainContext::MakeCurrent(nullptr);
+        contextMngr_.ReleaseWorkerContext(workerContext_);
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -10,10 +10,13 @@
 
 
 #include "GLContext.h"
+#include "GLSwapChainContext.h"
 #include <LLGL/RendererConfiguration.h>
 #include <LLGL/Container/DynamicArray.h>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 
 
 namespace LLGL
@@ -42,7 +45,8 @@ class GLContextManager
         GLContextManager(
             const RendererConfigurationOpenGL&  profile,
             const void*                         customNativeHandle      = nullptr,
-            std::size_t                         customNativeHandleSize  = 0
+            std::size_t                         customNativeHandleSize  = 0,
+            bool                                headless                = false
         );
 
     public:
@@ -50,6 +54,18 @@ class GLContextManager
         // Returns a GL context with the specified pixel format or any context if 'pixelFormat' is null.
         std::shared_ptr<GLContext> AllocContext(const GLPixelFormat* pixelFormat = nullptr, Surface* surface = nullptr);
 
+        // Creates the specified number of worker contexts that share their objects with the primary GL context. Must be called on the primary thread.
+        void CreateWorkerContexts(std::uint32_t numContexts);
+
+        // Returns a worker context that is not in use by another thread and waits until one is available. Returns null if there are no worker contexts.
+        GLSwapChainContext* AcquireWorkerContext();
+
+        // Returns the specified worker context to this manager so it can be acquired by other threads.
+        void ReleaseWorkerContext(GLSwapChainContext* workerContext);
+
+        // Makes the primary GL context current without any swap-chain and returns its state manager. This is used for headless render systems.
+        GLStateManager& MakeHeadlessContextCurrent();
+
     public:
 
         // Returns the OpenGL profile configuration.
@@ -58,6 +74,18 @@ class GLContextManager
             return profile_;
         }
 
+        // Returns true if GL contexts are created without any surface, i.e. swap-chains cannot be created.
+        inline bool IsSurfaceless() const
+        {
+            return surfaceless_;
+        }
+
+        // Returns true if worker contexts have been created. Must be called on the primary thread.
+        inline bool HasWorkerContexts() const
+        {
+            return !workerContexts_.empty();
+        }
+
     private:
 
         struct GLPixelFormatWithContext
@@ -67,11 +95,26 @@ class GLContextManager
             std::shared_ptr<GLContext>  context;
         };
 
+        struct GLWorkerContext
+        {
+            std::unique_ptr<Surface>            surface;
+            std::unique_ptr<GLContext>          context;
+            std::unique_ptr<GLSwapChainContext> swapChainContext;
+            bool                                isAcquired          = false;
+        };
+
     private:
 
         // Creates an invisible surface as placeholder for a GL context.
         std::unique_ptr<Surface> CreatePlaceholderSurface();
 
+        // Creates a new GL context and its swap-chain context on the placeholder surface or without any surface if surfaceless contexts are enabled.
+        void CreatePlaceholderContext(
+            GLWorkerContext&        outContext,
+            const GLPixelFormat&    pixelFormat,
+            GLContext*              sharedContext
+        );
+
         // Makes a new GL context with the specified pixel format and creates a placeholder surface is none was specified.
         std::shared_ptr<GLContext> MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface = nullptr);
 
@@ -89,6 +132,42 @@ class GLContextManager
         RendererConfigurationOpenGL             profile_;
         std::vector<GLPixelFormatWithContext>   pixelFormats_;
         DynamicByteArray                        customNativeHandle_;
+        bool                                    surfaceless_            = false;
+        GLWorkerContext                         headlessContext_;               // Swap-chain context link for the primary GL context of headless render systems.
+
+        std::vector<GLWorkerContext>            workerContexts_;
+        std::mutex                              workerContextsMutex_;
+        std::condition_variable                 workerContextsAvailable_;
+
+};
+
+/*
+Helper class to make a worker context current for the lifetime of this object if no GL context is current on the calling thread.
+When the scope ends, it waits until the GL commands of the worker context have completed, so their results can be used on any other GL context.
+*/
+class GLWorkerContextScope
+{
+
+    public:
+
+        GLWorkerContextScope(const GLWorkerContextScope&) = delete;
+        GLWorkerContextScope& operator = (const GLWorkerContextScope&) = delete;
+
+        GLWorkerContextScope(GLContextManager& contextMngr);
+        ~GLWorkerContextScope();
+
+    public:
+
+        // Returns true if this scope has made a worker context current.
+        inline bool IsWorkerContext() const
+        {
+            return (workerContext_ != nullptr);
+        }
+
+    private:
+
+        GLContextManager&   contextMngr_;
+        GLSwapChainContext* workerContext_  = nullptr;
 
 };
 
@@ -13,13 +13,18 @@ namespace LLGL
 {
 
 
-static GLSwapChainContext* g_currentSwapChainContext;
+static thread_local GLSwapChainContext* g_currentSwapChainContext;
 
 GLSwapChainContext::GLSwapChainContext(GLContext& context) :
     context_ { context }
 {
 }
 
+bool GLSwapChainContext::SwapBuffersWithDamage(std::uint32_t /*numDamageRects*/, const Scissor* /*damageRects*/)
+{
+    return SwapBuffers();
+}
+
 bool GLSwapChainContext::MakeCurrent(GLSwapChainContext* context)
 {
     bool result = true;
@@ -32,6 +37,19 @@ bool GLSwapChainContext::MakeCurrent(GLSwapChainContext* context)
     return result;
 }
 
+bool GLSwapChainContext::RestoreCurrent()
+{
+    if (g_currentSwapChainContext != nullptr)
+        return GLSwapChainContext::MakeCurrentUnchecked(g_currentSwapChainContext);
+    else
+        return true;
+}
+
+GLSwapChainContext* GLSwapChainContext::GetCurrent()
+{
+    return g_currentSwapChainContext;
+}
+
 
 } // /namespace LLGL
 
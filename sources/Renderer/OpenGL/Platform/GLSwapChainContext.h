@@ -11,6 +11,7 @@
 
 #include <LLGL/Surface.h>
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -19,6 +20,7 @@ namespace LLGL
 
 class Surface;
 class GLContext;
+struct Scissor;
 
 // Helper class to manage the link between a swap-chain and a GL context.
 class GLSwapChainContext
@@ -34,6 +36,9 @@ class GLSwapChainContext
         // Swaps the back buffer with the front buffer (Win32: ::SwapBuffers, X11: glXSwapBuffers).
         virtual bool SwapBuffers() = 0;
 
+        // Swaps the back buffer with the front buffer and only updates the specified damage rectangles (EGL: eglSwapBuffersWithDamageKHR). By default calls SwapBuffers.
+        virtual bool SwapBuffersWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects);
+
         // Resizes the GL swap-chain context. This is called after the context surface has been resized.
         virtual void Resize(const Extent2D& resolution) = 0;
 
@@ -49,9 +54,22 @@ class GLSwapChainContext
         // Creates a platform specific GLSwapChainContext instance.
         static std::unique_ptr<GLSwapChainContext> Create(GLContext& context, Surface& surface);
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        // Creates a platform specific GLSwapChainContext instance for a headless GL context (see GLContext::CreateHeadless).
+        static std::unique_ptr<GLSwapChainContext> CreateHeadless(GLContext& context);
+
+        #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
         // Makes the specified swap-chain context link current. If null, no context is current.
         static bool MakeCurrent(GLSwapChainContext* context);
 
+        // Makes the current swap-chain context link current again, e.g. after a new GL context has been created on the calling thread.
+        static bool RestoreCurrent();
+
+        // Returns the swap-chain context link that is current on the calling thread or null if there is none.
+        static GLSwapChainContext* GetCurrent();
+
     protected:
 
         // Initializes the swap-chain context with the specified GL context.
@@ -18,6 +18,11 @@
 #include <LLGL/Log.h>
 #include <algorithm>
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#   include <EGL/eglext.h>
+#   include <cstring>
+#endif
+
 
 namespace LLGL
 {
@@ -54,6 +59,19 @@ std::unique_ptr<GLContext> GLContext::Create(
     );
 }
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    GLContext*                          sharedContext)
+{
+    LinuxGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxGLContext>(pixelFormat, profile, sharedContextEGL);
+}
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
 
 /*
  * LinuxGLContext class
@@ -79,8 +97,30 @@ LinuxGLContext::LinuxGLContext(
         CreateGLXContext(pixelFormat, profile, nativeWindowHandle, sharedContext);
 }
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+LinuxGLContext::LinuxGLContext(
+    const GLPixelFormat&                    pixelFormat,
+    const RendererConfigurationOpenGL&      profile,
+    LinuxGLContext*                         sharedContext)
+:
+    samples_ { pixelFormat.samples }
+{
+    CreateEGLContext(pixelFormat, profile, sharedContext);
+}
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
 LinuxGLContext::~LinuxGLContext()
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (eglContext_ != EGL_NO_CONTEXT)
+    {
+        DeleteEGLContext();
+        return;
+    }
+    #endif
+
     if (!isProxyGLC_)
         DeleteGLXContext();
 }
@@ -92,6 +132,12 @@ int LinuxGLContext::GetSamples() const
 
 bool LinuxGLContext::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Surfaceless EGL contexts cannot be represented by the GLX native handle */
+    if (eglContext_ != EGL_NO_CONTEXT)
+        return false;
+    #endif
+
     if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::RenderSystemNativeHandle))
     {
         auto* nativeHandleGL = reinterpret_cast<OpenGL::RenderSystemNativeHandle*>(nativeHandle);
@@ -108,6 +154,12 @@ bool LinuxGLContext::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
 
 bool LinuxGLContext::SetSwapInterval(int interval)
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Surfaceless EGL contexts have no default framebuffer to swap */
+    if (eglContext_ != EGL_NO_CONTEXT)
+        return false;
+    #endif
+
     /* Load GL extension "glXSwapIntervalSGI" to set v-sync interval */
     if (glXSwapIntervalSGI || LoadSwapIntervalProcs())
         return (glXSwapIntervalSGI(interval) == 0);
@@ -270,6 +322,136 @@ void LinuxGLContext::CreateProxyContext(
     DeduceDepthStencilFormat(pixelFormat.depthBits, pixelFormat.stencilBits);
 }
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    return (extensions != nullptr && std::strstr(extensions, name) != nullptr);
+}
+
+// Returns an EGL display that does not require a display server, i.e. no X11 or Wayland connection.
+static EGLDisplay GetHeadlessEGLDisplay()
+{
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglGetPlatformDisplayEXT != nullptr)
+    {
+        #ifdef EGL_MESA_platform_surfaceless
+        /* Prefer the surfaceless platform of Mesa drivers */
+        if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+        #endif // /EGL_MESA_platform_surfaceless
+
+        #ifdef EGL_EXT_platform_device
+        /* Use first EGL device otherwise, which is what proprietary drivers such as NVIDIA's provide for headless rendering */
+        if (HasEGLExtension(clientExtensions, "EGL_EXT_platform_device"))
+        {
+            auto eglQueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+            EGLDeviceEXT device = nullptr;
+            EGLint numDevices = 0;
+            if (eglQueryDevicesEXT != nullptr && eglQueryDevicesEXT(1, &device, &numDevices) && numDevices > 0)
+            {
+                EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+                if (display != EGL_NO_DISPLAY)
+                    return display;
+            }
+        }
+        #endif // /EGL_EXT_platform_device
+    }
+
+    /* Fall back to default display */
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+// Creates an EGL context with the specified version and profile. Returns EGL_NO_CONTEXT on failure.
+static EGLContext CreateEGLContextWithVersion(EGLDisplay display, EGLConfig config, EGLContext sharedContext, int major, int minor, bool coreProfile)
+{
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,          major,
+        EGL_CONTEXT_MINOR_VERSION_KHR,          minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,    (coreProfile ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR),
+        EGL_NONE
+    };
+    return eglCreateContext(display, config, sharedContext, (major > 0 ? contextAttribs : nullptr));
+}
+
+void LinuxGLContext::CreateEGLContext(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    LinuxGLContext*                     sharedContext)
+{
+    /* Initialize EGL display; this is a no-op if the display has already been initialized for another context */
+    eglDisplay_ = GetHeadlessEGLDisplay();
+    if (eglDisplay_ == EGL_NO_DISPLAY)
+        LLGL_TRAP("failed to get EGL display for headless OpenGL context");
+
+    if (!eglInitialize(eglDisplay_, nullptr, nullptr))
+        LLGL_TRAP("failed to initialize EGL display for headless OpenGL context (error = 0x%04X)", static_cast<unsigned>(eglGetError()));
+
+    if (!HasEGLExtension(eglQueryString(eglDisplay_, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+        LLGL_TRAP("cannot create headless OpenGL context: EGL_KHR_surfaceless_context not supported");
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+        LLGL_TRAP("failed to bind OpenGL API to EGL");
+
+    /* Choose any config that can render with OpenGL; the context is never bound to a surface */
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,       0,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+
+    EGLConfig config = nullptr;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(eglDisplay_, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+        LLGL_TRAP("failed to choose EGL config for headless OpenGL context");
+
+    /* Create context with requested version or with the highest core profile version that is supported */
+    EGLContext eglcShared = (sharedContext != nullptr ? sharedContext->eglContext_ : EGL_NO_CONTEXT);
+    const bool coreProfile = (profile.contextProfile == OpenGLContextProfile::CoreProfile);
+
+    if (profile.majorVersion > 0 || !coreProfile)
+        eglContext_ = CreateEGLContextWithVersion(eglDisplay_, config, eglcShared, profile.majorVersion, profile.minorVersion, coreProfile);
+    else
+    {
+        static const int coreProfileVersions[][2] = { { 4, 6 }, { 4, 5 }, { 4, 3 }, { 4, 1 }, { 4, 0 }, { 3, 3 }, { 3, 2 } };
+        for (const auto& version : coreProfileVersions)
+        {
+            eglContext_ = CreateEGLContextWithVersion(eglDisplay_, config, eglcShared, version[0], version[1], true);
+            if (eglContext_ != EGL_NO_CONTEXT)
+                break;
+        }
+    }
+
+    if (eglContext_ == EGL_NO_CONTEXT)
+        LLGL_TRAP("failed to create headless OpenGL context (error = 0x%04X)", static_cast<unsigned>(eglGetError()));
+
+    /* Make new context current without any surface */
+    if (!eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext_))
+        Log::Errorf("eglMakeCurrent failed on headless OpenGL context\n");
+
+    /* Set fixed color and depth-stencil formats; they only serve as hints since there is no default framebuffer */
+    SetDefaultColorFormat();
+    DeduceDepthStencilFormat(pixelFormat.depthBits, pixelFormat.stencilBits);
+}
+
+void LinuxGLContext::DeleteEGLContext()
+{
+    /* EGL displays are shared by all contexts of this process, so the display is not terminated here */
+    if (eglGetCurrentContext() == eglContext_)
+        eglMakeCurrent(eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(eglDisplay_, eglContext_);
+}
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
 
 } // /namespace LLGL
 
@@ -15,6 +15,10 @@
 #include <LLGL/Platform/NativeHandle.h>
 #include <X11/Xlib.h>
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -33,6 +37,18 @@ class LinuxGLContext : public GLContext
             LinuxGLContext*                         sharedContext,
             const OpenGL::RenderSystemNativeHandle* customNativeHandle
         );
+
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        // Initializes a surfaceless EGL context for headless rendering.
+        LinuxGLContext(
+            const GLPixelFormat&                    pixelFormat,
+            const RendererConfigurationOpenGL&      profile,
+            LinuxGLContext*                         sharedContext
+        );
+
+        #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
         ~LinuxGLContext();
 
         int GetSamples() const override;
@@ -47,6 +63,22 @@ class LinuxGLContext : public GLContext
             return glc_;
         }
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        // Returns the EGL display of the surfaceless context or EGL_NO_DISPLAY if this is a GLX context.
+        inline ::EGLDisplay GetEGLDisplay() const
+        {
+            return eglDisplay_;
+        }
+
+        // Returns the surfaceless EGL context or EGL_NO_CONTEXT if this is a GLX context.
+        inline ::EGLContext GetEGLContext() const
+        {
+            return eglContext_;
+        }
+
+        #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
     private:
 
         bool SetSwapInterval(int interval) override;
@@ -71,6 +103,18 @@ class LinuxGLContext : public GLContext
             const OpenGL::RenderSystemNativeHandle& nativeContextHandle
         );
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        void CreateEGLContext(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            LinuxGLContext*                     sharedContext
+        );
+
+        void DeleteEGLContext();
+
+        #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
     private:
 
         ::Display*      display_    = nullptr;
@@ -78,6 +122,11 @@ class LinuxGLContext : public GLContext
         int             samples_    = 1;
         bool            isProxyGLC_ = false;
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+        ::EGLDisplay    eglDisplay_ = EGL_NO_DISPLAY;
+        ::EGLContext    eglContext_ = EGL_NO_CONTEXT;
+        #endif
+
 };
 
 
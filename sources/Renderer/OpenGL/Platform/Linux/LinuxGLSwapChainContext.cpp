@@ -24,6 +24,15 @@ std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& contex
     return MakeUnique<LinuxGLSwapChainContext>(static_cast<LinuxGLContext&>(context), surface);
 }
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+std::unique_ptr<GLSwapChainContext> GLSwapChainContext::CreateHeadless(GLContext& context)
+{
+    return MakeUnique<LinuxGLSwapChainContext>(static_cast<LinuxGLContext&>(context));
+}
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
 bool GLSwapChainContext::MakeCurrentUnchecked(GLSwapChainContext* context)
 {
     return LinuxGLSwapChainContext::MakeCurrentGLXContext(static_cast<LinuxGLSwapChainContext*>(context));
@@ -49,8 +58,25 @@ LinuxGLSwapChainContext::LinuxGLSwapChainContext(LinuxGLContext& context, Surfac
         throw std::runtime_error("failed to get X11 Display and Window from swap-chain surface");
 }
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+LinuxGLSwapChainContext::LinuxGLSwapChainContext(LinuxGLContext& context) :
+    GLSwapChainContext { context                  },
+    eglDisplay_        { context.GetEGLDisplay()  },
+    eglContext_        { context.GetEGLContext()  }
+{
+}
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
 bool LinuxGLSwapChainContext::SwapBuffers()
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Surfaceless contexts have no back buffer */
+    if (eglContext_ != EGL_NO_CONTEXT)
+        return false;
+    #endif
+
     glXSwapBuffers(dpy_, wnd_);
     return true;
 }
@@ -62,10 +88,19 @@ void LinuxGLSwapChainContext::Resize(const Extent2D& resolution)
 
 bool LinuxGLSwapChainContext::MakeCurrentGLXContext(LinuxGLSwapChainContext* context)
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (context != nullptr && context->eglContext_ != EGL_NO_CONTEXT)
+        return (eglMakeCurrent(context->eglDisplay_, EGL_NO_SURFACE, EGL_NO_SURFACE, context->eglContext_) == EGL_TRUE);
+    else if (context == nullptr && eglGetCurrentContext() != EGL_NO_CONTEXT)
+        return (eglMakeCurrent(eglGetCurrentDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+    #endif
+
     if (context)
         return glXMakeCurrent(context->dpy_, context->wnd_, context->glc_);
+    else if (::Display* dpy = glXGetCurrentDisplay())
+        return glXMakeCurrent(dpy, None, nullptr);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return true;
 }
 
 
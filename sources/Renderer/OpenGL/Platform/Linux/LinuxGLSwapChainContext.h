@@ -13,6 +13,10 @@
 #include "../../OpenGL.h"
 #include <X11/Xlib.h>
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -28,6 +32,11 @@ class LinuxGLSwapChainContext final : public GLSwapChainContext
 
         LinuxGLSwapChainContext(LinuxGLContext& context, Surface& surface);
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+        // Initializes the swap-chain context for a surfaceless EGL context.
+        LinuxGLSwapChainContext(LinuxGLContext& context);
+        #endif
+
         bool SwapBuffers() override;
         void Resize(const Extent2D& resolution) override;
 
@@ -41,6 +50,11 @@ class LinuxGLSwapChainContext final : public GLSwapChainContext
         ::Window        wnd_ = 0;
         ::GLXContext    glc_ = nullptr;
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+        ::EGLDisplay    eglDisplay_ = EGL_NO_DISPLAY;
+        ::EGLContext    eglContext_ = EGL_NO_CONTEXT;
+        #endif
+
 };
 
 
@@ -33,6 +33,10 @@
 #define GL_DISPATCH_INDIRECT_BUFFER         ( 0x90EE )
 #endif
 
+#ifndef GL_PARAMETER_BUFFER
+#define GL_PARAMETER_BUFFER                 ( 0x80EE )
+#endif
+
 #ifndef GL_QUERY_BUFFER
 #define GL_QUERY_BUFFER                     ( 0x9192 )
 #endif
@@ -94,6 +94,12 @@ static const GLenum g_bufferTargetBindings[] =
     0,
     #endif
 
+    #ifdef GL_PARAMETER_BUFFER_BINDING
+    GL_PARAMETER_BUFFER_BINDING,
+    #else
+    0,
+    #endif
+
     #ifdef GL_PIXEL_PACK_BUFFER_BINDING
     GL_PIXEL_PACK_BUFFER_BINDING,
     #else
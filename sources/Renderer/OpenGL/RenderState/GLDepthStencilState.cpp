@@ -37,32 +37,44 @@ GLDepthStencilState::GLDepthStencilState(const DepthDescriptor& depthDesc, const
 }
 
 void GLDepthStencilState::Bind(GLStateManager& stateMngr)
+{
+    BindDelta(stateMngr, DeltaAll);
+}
+
+void GLDepthStencilState::BindDelta(GLStateManager& stateMngr, std::uint32_t deltaFlags)
 {
     /* Setup depth state */
-    if (depthTestEnabled_)
+    if ((deltaFlags & DeltaDepthTest) != 0)
     {
-        stateMngr.Enable(GLState::DepthTest);
-        stateMngr.SetDepthFunc(depthFunc_);
+        if (depthTestEnabled_)
+        {
+            stateMngr.Enable(GLState::DepthTest);
+            stateMngr.SetDepthFunc(depthFunc_);
+        }
+        else
+            stateMngr.Disable(GLState::DepthTest);
     }
-    else
-        stateMngr.Disable(GLState::DepthTest);
 
-    stateMngr.SetDepthMask(depthMask_);
+    if ((deltaFlags & DeltaDepthMask) != 0)
+        stateMngr.SetDepthMask(depthMask_);
 
     /* Setup stencil state */
-    if (stencilTestEnabled_)
+    if ((deltaFlags & DeltaStencil) != 0)
     {
-        stateMngr.Enable(GLState::StencilTest);
-        if (independentStencilFaces_)
+        if (stencilTestEnabled_)
         {
-            BindStencilFaceState(stencilFront_, GL_FRONT);
-            BindStencilFaceState(stencilBack_, GL_BACK);
+            stateMngr.Enable(GLState::StencilTest);
+            if (independentStencilFaces_)
+            {
+                BindStencilFaceState(stencilFront_, GL_FRONT);
+                BindStencilFaceState(stencilBack_, GL_BACK);
+            }
+            else
+                BindStencilState(stencilFront_);
         }
         else
-            BindStencilState(stencilFront_);
+            stateMngr.Disable(GLState::StencilTest);
     }
-    else
-        stateMngr.Disable(GLState::StencilTest);
 }
 
 void GLDepthStencilState::BindStencilRefOnly(GLint ref, GLenum face)
@@ -114,6 +126,30 @@ void GLDepthStencilState::BindStencilWriteMaskOnly()
     }
 }
 
+void GLDepthStencilState::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    depthTestEnabled_   = depthDesc.testEnabled;
+    depthMask_          = GLBoolean(depthDesc.writeEnabled);
+    depthFunc_          = GLTypes::Map(depthDesc.compareOp);
+}
+
+void GLDepthStencilState::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    /* Keep previous stencil reference values, since they are either static or set with SetStencilRef */
+    const GLint frontRef    = stencilFront_.ref;
+    const GLint backRef     = stencilBack_.ref;
+
+    stencilTestEnabled_ = stencilDesc.testEnabled;
+
+    GLStencilFaceState::Convert(stencilFront_, stencilDesc.front, referenceDynamic_);
+    GLStencilFaceState::Convert(stencilBack_, stencilDesc.back, referenceDynamic_);
+
+    stencilFront_.ref   = frontRef;
+    stencilBack_.ref    = backRef;
+
+    independentStencilFaces_ = (GLStencilFaceState::CompareSWO(stencilFront_, stencilBack_) != 0);
+}
+
 int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDepthStencilState& rhs)
 {
     LLGL_COMPARE_BOOL_MEMBER_SWO( depthTestEnabled_ );
@@ -145,6 +181,32 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDept
     return 0;
 }
 
+std::uint32_t GLDepthStencilState::GetDeltaFlags(const GLDepthStencilState& from, const GLDepthStencilState& to)
+{
+    std::uint32_t deltaFlags = 0;
+
+    if (from.depthTestEnabled_ != to.depthTestEnabled_ || (to.depthTestEnabled_ && from.depthFunc_ != to.depthFunc_))
+        deltaFlags |= DeltaDepthTest;
+
+    if (from.depthMask_ != to.depthMask_)
+        deltaFlags |= DeltaDepthMask;
+
+    if (from.stencilTestEnabled_ != to.stencilTestEnabled_)
+        deltaFlags |= DeltaStencil;
+    else if (to.stencilTestEnabled_)
+    {
+        if (from.independentStencilFaces_ != to.independentStencilFaces_ ||
+            from.referenceDynamic_        != to.referenceDynamic_        ||
+            GLStencilFaceState::CompareSWO(from.stencilFront_, to.stencilFront_) != 0 ||
+            GLStencilFaceState::CompareSWO(from.stencilBack_, to.stencilBack_) != 0)
+        {
+            deltaFlags |= DeltaStencil;
+        }
+    }
+
+    return deltaFlags;
+}
+
 
 /*
  * ======= Private: =======
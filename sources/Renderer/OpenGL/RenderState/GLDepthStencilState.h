@@ -12,6 +12,7 @@
 #include <LLGL/ForwardDecls.h>
 #include "../OpenGL.h"
 #include <memory>
+#include <cstdint>
 #include <limits.h>
 
 
@@ -27,6 +28,17 @@ using GLDepthStencilStateSPtr = std::shared_ptr<GLDepthStencilState>;
 class GLDepthStencilState
 {
 
+    public:
+
+        // Flags for the groups of states that differ between two depth-stencil states.
+        enum : std::uint32_t
+        {
+            DeltaDepthTest  = (1u << 0), // Depth test and compare function
+            DeltaDepthMask  = (1u << 1),
+            DeltaStencil    = (1u << 2), // Stencil test and all stencil face states
+            DeltaAll        = (DeltaDepthTest | DeltaDepthMask | DeltaStencil),
+        };
+
     public:
 
         GLDepthStencilState() = default;
@@ -38,17 +50,35 @@ class GLDepthStencilState
         // Binds the entire depth-stencil state.
         void Bind(GLStateManager& stateMngr);
 
+        // Binds only the groups of states specified by the bitmask of Delta* flags.
+        void BindDelta(GLStateManager& stateMngr, std::uint32_t deltaFlags);
+
         // Binds only the stencil reference together with the remaining parameters for the glStencilFunc* call.
         void BindStencilRefOnly(GLint ref, GLenum face = GL_FRONT_AND_BACK);
 
         // Binds only the stencil write mask.
         void BindStencilWriteMaskOnly();
 
+        // Returns true if the stencil reference is set independently of this state.
+        inline bool IsStencilRefDynamic() const
+        {
+            return referenceDynamic_;
+        }
+
+        // Replaces the depth test, depth mask, and depth function. Used for dynamic pipeline states.
+        void SetDepthState(const DepthDescriptor& depthDesc);
+
+        // Replaces all stencil states except the stencil reference values. Used for dynamic pipeline states.
+        void SetStencilState(const StencilDescriptor& stencilDesc);
+
     public:
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLDepthStencilState& lhs, const GLDepthStencilState& rhs);
 
+        // Returns the bitmask of Delta* flags that must be bound to switch from one depth-stencil state to the other.
+        static std::uint32_t GetDeltaFlags(const GLDepthStencilState& from, const GLDepthStencilState& to);
+
     private:
 
         struct GLStencilFaceState
@@ -0,0 +1,128 @@
+/*
+ * GLFramebufferCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLFramebufferCache.h"
+#include "GLStateManager.h"
+#include "../Texture/GLTexture.h"
+#include "../Texture/GLFramebuffer.h"
+#include "../GLTypes.h"
+#include "../Ext/GLExtensions.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLFramebufferCache::~GLFramebufferCache()
+{
+    for (const Entry& entry : entries_)
+        glDeleteFramebuffers(1, &(entry.fbo));
+}
+
+// Maps GLFramebufferTarget to the <target> parameter of the glFramebuffer* functions.
+static GLenum ToGLFramebufferTarget(GLFramebufferTarget target)
+{
+    switch (target)
+    {
+        case GLFramebufferTarget::DrawFramebuffer:  return GL_DRAW_FRAMEBUFFER;
+        case GLFramebufferTarget::ReadFramebuffer:  return GL_READ_FRAMEBUFFER;
+        default:                                    return GL_FRAMEBUFFER;
+    }
+}
+
+static GLenum GetGLAttachmentForInternalFormat(GLenum internalFormat)
+{
+    if (GLTypes::IsDepthFormat(internalFormat))
+        return GL_DEPTH_ATTACHMENT;
+    if (GLTypes::IsDepthStencilFormat(internalFormat))
+        return GL_DEPTH_STENCIL_ATTACHMENT;
+    return GL_COLOR_ATTACHMENT0;
+}
+
+void GLFramebufferCache::BindFramebufferWithTexture(
+    GLStateManager&     stateMngr,
+    GLFramebufferTarget target,
+    const GLTexture&    texture,
+    GLint               mipLevel,
+    GLint               arrayLayer)
+{
+    const GLuint    texID           = texture.GetID();
+    const bool      isRenderbuffer  = texture.IsRenderbuffer();
+
+    /* Find FBO with the same attachment and move it to the front of the list */
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        if (it->texture         == texID            &&
+            it->isRenderbuffer  == isRenderbuffer   &&
+            it->mipLevel        == mipLevel         &&
+            it->arrayLayer      == arrayLayer)
+        {
+            std::rotate(entries_.begin(), it, it + 1);
+            stateMngr.BindFramebuffer(target, entries_.front().fbo);
+            return;
+        }
+    }
+
+    /* Release least recently used FBO if the cache is full; re-attaching a different texture would invalidate the FBO anyway */
+    if (entries_.size() == maxNumEntries)
+    {
+        const GLuint fbo = entries_.back().fbo;
+        glDeleteFramebuffers(1, &fbo);
+        stateMngr.NotifyFramebufferRelease(fbo);
+        entries_.pop_back();
+    }
+
+    /* Create new FBO with a single attachment */
+    Entry newEntry;
+    {
+        newEntry.texture        = texID;
+        newEntry.isRenderbuffer = isRenderbuffer;
+        newEntry.mipLevel       = mipLevel;
+        newEntry.arrayLayer     = arrayLayer;
+        newEntry.fbo            = 0;
+    }
+    glGenFramebuffers(1, &(newEntry.fbo));
+    stateMngr.BindFramebuffer(target, newEntry.fbo);
+
+    GLFramebuffer::AttachTexture(
+        texture,
+        GetGLAttachmentForInternalFormat(texture.GetGLInternalFormat()),
+        mipLevel,
+        arrayLayer,
+        ToGLFramebufferTarget(target)
+    );
+
+    entries_.insert(entries_.begin(), newEntry);
+}
+
+void GLFramebufferCache::NotifyTextureRelease(GLStateManager& stateMngr, GLuint texture, bool isRenderbuffer)
+{
+    /* Remove all FBOs that refer to this texture, since its name can be reused for a new texture */
+    auto it = std::remove_if(
+        entries_.begin(),
+        entries_.end(),
+        [&stateMngr, texture, isRenderbuffer](const Entry& entry) -> bool
+        {
+            if (entry.texture == texture && entry.isRenderbuffer == isRenderbuffer)
+            {
+                glDeleteFramebuffers(1, &(entry.fbo));
+                stateMngr.NotifyFramebufferRelease(entry.fbo);
+                return true;
+            }
+            return false;
+        }
+    );
+    entries_.erase(it, entries_.end());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,79 @@
+/*
+ * GLFramebufferCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_FRAMEBUFFER_CACHE_H
+#define LLGL_GL_FRAMEBUFFER_CACHE_H
+
+
+#include "GLState.h"
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+class GLTexture;
+
+/*
+Least-recently-used cache of framebuffer objects (FBO) with a single texture attachment for a single GL context, since FBOs are not shared between contexts.
+This is used for texture copy, blit, and readback operations that would otherwise create a temporary FBO each time,
+which requires the driver to validate the framebuffer completeness over and over again.
+*/
+class GLFramebufferCache
+{
+
+    public:
+
+        GLFramebufferCache() = default;
+        ~GLFramebufferCache();
+
+        GLFramebufferCache(const GLFramebufferCache&) = delete;
+        GLFramebufferCache& operator = (const GLFramebufferCache&) = delete;
+
+        // Binds an FBO with the specified texture subresource attached to it and creates a new one if there is no such FBO yet.
+        void BindFramebufferWithTexture(
+            GLStateManager&     stateMngr,
+            GLFramebufferTarget target,
+            const GLTexture&    texture,
+            GLint               mipLevel,
+            GLint               arrayLayer
+        );
+
+        // Releases all FBOs that refer to the specified texture or renderbuffer.
+        void NotifyTextureRelease(GLStateManager& stateMngr, GLuint texture, bool isRenderbuffer);
+
+    private:
+
+        static constexpr std::size_t maxNumEntries = 16;
+
+        struct Entry
+        {
+            GLuint  texture;
+            bool    isRenderbuffer;
+            GLint   mipLevel;
+            GLint   arrayLayer;
+            GLuint  fbo;
+        };
+
+    private:
+
+        std::vector<Entry> entries_; // Ordered from most recently used to least recently used
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -70,6 +70,9 @@ GLGraphicsPSO::GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const Rende
     else
         patchVertices_ = 0;
 
+    /* Vertex pulling still requires a VAO, but one without vertex attributes */
+    hasVertexStreams_ = !desc.vertexStreams.empty();
+
     /* Create depth-stencil state */
     depthStencilState_ = GLStatePool::Get().CreateDepthStencilState(desc.depth, desc.stencil);
 
@@ -105,11 +108,11 @@ void GLGraphicsPSO::Bind(GLStateManager& stateMngr)
     /* Set input-assembler state */
     if (patchVertices_ > 0)
         stateMngr.SetPatchVertices(patchVertices_);
+    if (hasVertexStreams_)
+        stateMngr.BindEmptyVertexInputLayout();
 
     /* Bind depth-stencil, rasterizer, and blend states */
-    stateMngr.BindDepthStencilState(depthStencilState_.get());
-    stateMngr.BindRasterizerState(rasterizerState_.get());
-    stateMngr.BindBlendState(blendState_.get());
+    stateMngr.BindRenderStates(depthStencilState_.get(), rasterizerState_.get(), blendState_.get());
 
     /* Set static viewports and scissors */
     if (staticStateBuffer_)
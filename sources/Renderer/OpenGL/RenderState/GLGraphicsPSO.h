@@ -64,6 +64,7 @@ class GLGraphicsPSO final : public GLPipelineState
         GLenum                  drawMode_           = GL_TRIANGLES; // for glDraw*
         GLenum                  primitiveMode_      = GL_TRIANGLES; // for glBeginTransformFeedback*
         GLint                   patchVertices_      = 0;
+        bool                    hasVertexStreams_   = false; // Vertex pulling from storage buffers
 
         // State objects
         GLDepthStencilStateSPtr depthStencilState_;
@@ -183,9 +183,7 @@ void GLPipelineLayout::BuildStaticSamplers(const std::vector<StaticSamplerDescri
         for (const auto& desc : staticSamplerDescs)
         {
             /* Create GL3+ sampler and store slot and name separately */
-            auto sampler = MakeUnique<GLSampler>();
-            sampler->SamplerParameters(desc.sampler);
-            staticSamplers_.push_back(std::move(sampler));
+            staticSamplers_.push_back(MakeUnique<GLSampler>(desc.sampler));
             staticSamplerSlots_.push_back(desc.slot.index);
             resourceNames_.push_back(desc.name);
         }
@@ -41,7 +41,7 @@ GLPipelineState::GLPipelineState(
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
 
             /* Query information log and stop linking shader pipelines if the default permutation has errors */
-            if (permutation == GLShader::PermutationDefault)
+            if (permutation == GLShader::PermutationDefault && !GLShader::HasParallelShaderCompile())
             {
                 shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
                 if (report_.HasErrors())
@@ -62,16 +62,18 @@ GLPipelineState::GLPipelineState(
                 GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
         }
 
-        /* Build uniform table */
-        for_range(permutationIndex, GLShader::PermutationCount)
-        {
-            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
-            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
-        }
-
         /* Cache barriers bitfield */
         barriers_ = pipelineLayout_->GetBarriersBitfield();
     }
+
+    /* Separable shaders are not patched, so only combined shader programs can have uniform blocks for their default uniforms */
+    if (GLShader::GetDefaultUniformBufferSlot() >= 0 && !shaders.empty())
+        hasUniformBlocks_ = !LLGL_CAST(const GLShader*, shaders[0])->IsSeparable();
+
+    /* Let the driver link all permutations in the background; linking only blocks once the report or the uniforms are requested */
+    isLinkPending_ = true;
+    if (!GLShader::HasParallelShaderCompile())
+        ResolvePendingLink();
 }
 
 GLPipelineState::~GLPipelineState()
@@ -83,6 +85,8 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    if (isLinkPending_)
+        ResolvePendingLink();
     return (report_ ? &report_ : nullptr);
 }
 
@@ -115,8 +119,48 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
+void GLPipelineState::ResolvePendingLink() const
+{
+    isLinkPending_ = false;
+
+    /* Query deferred information log of the default permutation; errors from PSO creation are appended after the link log */
+    if (GLShader::HasParallelShaderCompile() && shaderPipelines_[GLShader::PermutationDefault].get() != nullptr)
+    {
+        Report linkReport;
+        shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(linkReport);
+        if (report_)
+        {
+            if (report_.HasErrors())
+                linkReport.Errorf("%s", report_.GetText());
+            else
+                linkReport.Printf("%s", report_.GetText());
+        }
+        report_ = std::move(linkReport);
+    }
+
+    /* Build uniform table */
+    for_range(permutationIndex, GLShader::PermutationCount)
+    {
+        const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
+        if (hasUniformBlocks_)
+            BuildUniformBlocks(permutation);
+        if (pipelineLayout_ != nullptr)
+            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
+    }
+}
+
+void GLPipelineState::BuildUniformBlocks(GLShader::Permutation permutation) const
+{
+    /* All permutations share the same std140 layout, so only the binding slots must be assigned for each program */
+    if (shaderPipelines_[permutation].get() != nullptr)
+    {
+        const GLuint program = shaderPipelines_[permutation]->GetID();
+        uniformBlocks_.BuildBlocks(program, static_cast<GLuint>(GLShader::GetDefaultUniformBufferSlot()));
+    }
+}
+
 //TODO: support separate shaders; each separable shader needs its own set of uniform locations
-void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
+void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms) const
 {
     if (shaderPipelines_[permutation].get() != nullptr && !uniforms.empty())
     {
@@ -184,11 +228,28 @@ static GLuint GetUniformWordSize(GLenum type)
     }
 }
 
-void GLPipelineState::BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform)
+void GLPipelineState::BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform) const
 {
     /* Find uniform location by name in shader pipeline */
     GLint location = glGetUniformLocation(program, inUniform.name.c_str());
-    if (location == -1)
+
+    outUniform.firstBlockMember = 0;
+    outUniform.numBlockMembers  = 0;
+
+    GLenum  blockMemberType     = 0;
+    GLsizei blockMemberCount    = 0;
+
+    if (location == -1 &&
+        uniformBlocks_.HasBlocks() &&
+        uniformBlocks_.BuildMembers(program, inUniform.name.c_str(), blockMemberType, blockMemberCount, outUniform.firstBlockMember, outUniform.numBlockMembers))
+    {
+        /* Write uniform that has been moved into uniform blocks */
+        outUniform.type     = GLTypes::UnmapUniformType(blockMemberType);
+        outUniform.location = -1;
+        outUniform.count    = blockMemberCount;
+        outUniform.wordSize = GetUniformWordSize(blockMemberType);
+    }
+    else if (location == -1)
     {
         /* Write invalid uniform location */
         outUniform.type     = UniformType::Undefined;
@@ -13,6 +13,7 @@
 #include "../Shader/GLShaderBindingLayout.h"
 #include "../Shader/GLShaderPipeline.h"
 #include "../Shader/GLShader.h"
+#include "GLUniformBlockStorage.h"
 #include <LLGL/Report.h>
 #include <LLGL/PipelineState.h>
 #include <LLGL/RenderSystemFlags.h>
@@ -35,7 +36,9 @@ struct GLUniformLocation
     UniformType type;
     GLint       location;
     GLsizei     count;
-    GLuint      wordSize; // Size in words (32-bit values)
+    GLuint      wordSize;           // Size in words (32-bit values)
+    GLuint      firstBlockMember;   // Only used if 'location' is -1. See GLUniformBlockStorage.
+    GLuint      numBlockMembers;
 };
 
 // Base class for OpenGL PSOs.
@@ -78,9 +81,25 @@ class GLPipelineState : public PipelineState
         // Returns the list of uniforms that maps from index of 'PipelineLayoutDescriptor::uniforms[]' to GL uniform location.
         inline const std::vector<GLUniformLocation>& GetUniformMap() const
         {
+            if (isLinkPending_)
+                ResolvePendingLink();
             return uniformMap_;
         }
 
+        // Returns true if the default uniforms of this PSO have been moved into uniform blocks. See GetUniformBlocks().
+        inline bool HasUniformBlocks() const
+        {
+            return hasUniformBlocks_;
+        }
+
+        // Returns the CPU storage of the uniform blocks that replace the default uniform block. See RendererConfigurationOpenGL::uniformBufferSlot.
+        inline GLUniformBlockStorage& GetUniformBlocks() const
+        {
+            if (isLinkPending_)
+                ResolvePendingLink();
+            return uniformBlocks_;
+        }
+
         // Returns the GL bitfield of the memory barriers the pipeline layout of this PSO was created with. See GLPipelineLayout::GetBarriersBitfield().
         inline GLbitfield GetBarriersBitfield() const
         {
@@ -97,21 +116,30 @@ class GLPipelineState : public PipelineState
 
     private:
 
+        // Queries the deferred link status and builds the uniform map once the driver finished linking. See GLShader::HasParallelShaderCompile().
+        void ResolvePendingLink() const;
+
+        // Builds the uniform blocks that replace the default uniform block and assigns their binding slots.
+        void BuildUniformBlocks(GLShader::Permutation permutation) const;
+
         // Builds the index-to-uniform map.
-        void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
+        void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms) const;
 
         // Builds the specified uniform location.
-        void BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform);
+        void BuildUniformLocation(GLuint program, GLUniformLocation& outUniform, const UniformDescriptor& inUniform) const;
 
     private:
 
-        const bool                      isGraphicsPSO_                                  = false;
-        const GLPipelineLayout*         pipelineLayout_                                 = nullptr;
-        GLShaderPipelineSPtr            shaderPipelines_[GLShader::PermutationCount];
-        GLShaderBindingLayoutSPtr       shaderBindingLayout_;
-        std::vector<GLUniformLocation>  uniformMap_;
-        GLbitfield                      barriers_                                       = 0;
-        Report                          report_;
+        const bool                              isGraphicsPSO_                          = false;
+        const GLPipelineLayout*                 pipelineLayout_                         = nullptr;
+        GLShaderPipelineSPtr                    shaderPipelines_[GLShader::PermutationCount];
+        GLShaderBindingLayoutSPtr               shaderBindingLayout_;
+        mutable std::vector<GLUniformLocation>  uniformMap_;
+        mutable GLUniformBlockStorage           uniformBlocks_;
+        bool                                    hasUniformBlocks_                       = false; // Only used with RendererConfigurationOpenGL::uniformBufferSlot
+        GLbitfield                              barriers_                               = 0;
+        mutable Report                          report_;
+        mutable bool                            isLinkPending_                          = false; // Only used with GL_KHR_parallel_shader_compile
 
 };
 
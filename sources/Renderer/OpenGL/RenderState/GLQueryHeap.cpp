@@ -6,6 +6,7 @@
  */
 
 #include "GLQueryHeap.h"
+#include "GLStateManager.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
@@ -73,6 +74,18 @@ GLQueryHeap::GLQueryHeap(const QueryHeapDescriptor& desc) :
     }
     else
     #endif
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (desc.type == QueryType::TimeElapsed && HasExtension(GLExt::ARB_timer_query))
+    {
+        /*
+        Allocate two IDs for a timestamp at the beginning and end of each query,
+        because GL_TIME_ELAPSED queries cannot be nested but GL_TIMESTAMP queries can
+        */
+        groupSize_          = 2;
+        isTimestampPair_    = true;
+    }
+    else
+    #endif
     {
         /* Allocate single ID */
         groupSize_ = 1;
@@ -108,18 +121,56 @@ void GLQueryHeap::SetDebugName(const char* name)
 
 void GLQueryHeap::Begin(std::uint32_t query)
 {
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (isTimestampPair_)
+    {
+        /* Record first timestamp */
+        glQueryCounter(ids_[groupSize_ * query], GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* Begin all queries in forward order: [0, n) */
     for_range(i, groupSize_)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i + groupSize_ * query]);
 }
 
-void GLQueryHeap::End()
+void GLQueryHeap::End(std::uint32_t query)
 {
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (isTimestampPair_)
+    {
+        /* Record second timestamp */
+        glQueryCounter(ids_[groupSize_ * query + 1], GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* End all queries in reverse order: (n, 0] */
     for_range_reverse(i, groupSize_)
         glEndQuery(MapQueryType(GetType(), i));
 }
 
+void GLQueryHeap::ResolveData(std::uint32_t firstQuery, std::uint32_t numQueries, GLuint dstBuffer, GLintptr dstOffset)
+{
+    #if defined LLGL_OPENGL && defined GL_ARB_query_buffer_object
+    if (HasExtension(GLExt::ARB_query_buffer_object) && HasExtension(GLExt::ARB_timer_query))
+    {
+        /* While a buffer is bound to GL_QUERY_BUFFER, the 'params' argument is interpreted as byte offset into that buffer */
+        GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, dstBuffer);
+
+        const std::uint32_t firstID = firstQuery * groupSize_;
+        const std::uint32_t numIDs  = numQueries * groupSize_;
+
+        for_range(i, numIDs)
+        {
+            const GLintptr offset = dstOffset + static_cast<GLintptr>(i * sizeof(GLuint64));
+            glGetQueryObjectui64v(ids_[firstID + i], GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(offset));
+        }
+    }
+    #endif // /GL_ARB_query_buffer_object
+}
+
 
 } // /namespace LLGL
 
@@ -31,7 +31,10 @@ class GLQueryHeap final : public QueryHeap
         ~GLQueryHeap();
 
         void Begin(std::uint32_t query);
-        void End();
+        void End(std::uint32_t query);
+
+        // Writes the results of the specified range of queries into the destination buffer with GL_QUERY_BUFFER (GL 4.4).
+        void ResolveData(std::uint32_t firstQuery, std::uint32_t numQueries, GLuint dstBuffer, GLintptr dstOffset);
 
         // Returns the the specified query ID.
         inline GLuint GetID(std::uint32_t query) const
@@ -51,10 +54,17 @@ class GLQueryHeap final : public QueryHeap
             return groupSize_;
         }
 
+        // Returns true if each query is a pair of GL_TIMESTAMP queries instead of a single GL_TIME_ELAPSED query.
+        inline bool IsTimestampPair() const
+        {
+            return isTimestampPair_;
+        }
+
     private:
 
         std::vector<GLuint> ids_;
-        std::uint32_t       groupSize_  = 1;
+        std::uint32_t       groupSize_          = 1;
+        bool                isTimestampPair_    = false;
 
 };
 
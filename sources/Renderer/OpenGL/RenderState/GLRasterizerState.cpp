@@ -67,39 +67,60 @@ GLRasterizerState::GLRasterizerState(const RasterizerDescriptor& desc)
 }
 
 void GLRasterizerState::Bind(GLStateManager& stateMngr)
+{
+    BindDelta(stateMngr, DeltaAll);
+}
+
+void GLRasterizerState::BindDelta(GLStateManager& stateMngr, std::uint32_t deltaFlags)
 {
     #ifdef LLGL_OPENGL
-    stateMngr.SetPolygonMode(polygonMode_);
-    stateMngr.Set(GLState::DepthClamp, depthClampEnabled_);
-    stateMngr.Set(GLState::Multisample, multiSampleEnabled_);
-    stateMngr.Set(GLState::LineSmooth, lineSmoothEnabled_);
+    if ((deltaFlags & DeltaPolygonMode) != 0)
+        stateMngr.SetPolygonMode(polygonMode_);
     #endif
 
-    stateMngr.SetFrontFace(frontFace_);
-    stateMngr.SetLineWidth(lineWidth_);
+    if ((deltaFlags & DeltaCapabilities) != 0)
+    {
+        #ifdef LLGL_OPENGL
+        stateMngr.Set(GLState::DepthClamp, depthClampEnabled_);
+        stateMngr.Set(GLState::Multisample, multiSampleEnabled_);
+        stateMngr.Set(GLState::LineSmooth, lineSmoothEnabled_);
+        #endif
 
-    stateMngr.Set(GLState::RasterizerDiscard, rasterizerDiscard_);
-    stateMngr.Set(GLState::ScissorTest, scissorTestEnabled_);
+        stateMngr.Set(GLState::RasterizerDiscard, rasterizerDiscard_);
+        stateMngr.Set(GLState::ScissorTest, scissorTestEnabled_);
 
-    if (cullFace_ != 0)
-    {
-        stateMngr.Enable(GLState::CullFace);
-        stateMngr.SetCullFace(cullFace_);
+        #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+        stateMngr.Set(GLStateExt::ConservativeRasterization, conservativeRaster_);
+        #endif
     }
-    else
-        stateMngr.Disable(GLState::CullFace);
 
-    if (polygonOffsetEnabled_)
+    if ((deltaFlags & DeltaFrontFace) != 0)
+        stateMngr.SetFrontFace(frontFace_);
+
+    if ((deltaFlags & DeltaLineWidth) != 0)
+        stateMngr.SetLineWidth(lineWidth_);
+
+    if ((deltaFlags & DeltaCullFace) != 0)
     {
-        stateMngr.Enable(polygonOffsetMode_);
-        stateMngr.SetPolygonOffset(polygonOffsetFactor_, polygonOffsetUnits_, polygonOffsetClamp_);
+        if (cullFace_ != 0)
+        {
+            stateMngr.Enable(GLState::CullFace);
+            stateMngr.SetCullFace(cullFace_);
+        }
+        else
+            stateMngr.Disable(GLState::CullFace);
     }
-    else
-        stateMngr.Disable(polygonOffsetMode_);
 
-    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
-    stateMngr.Set(GLStateExt::ConservativeRasterization, conservativeRaster_);
-    #endif
+    if ((deltaFlags & DeltaPolygonOffset) != 0)
+    {
+        if (polygonOffsetEnabled_)
+        {
+            stateMngr.Enable(polygonOffsetMode_);
+            stateMngr.SetPolygonOffset(polygonOffsetFactor_, polygonOffsetUnits_, polygonOffsetClamp_);
+        }
+        else
+            stateMngr.Disable(polygonOffsetMode_);
+    }
 }
 
 void GLRasterizerState::BindFrontFaceOnly(GLStateManager& stateMngr)
@@ -107,6 +128,19 @@ void GLRasterizerState::BindFrontFaceOnly(GLStateManager& stateMngr)
     stateMngr.SetFrontFace(frontFace_);
 }
 
+void GLRasterizerState::SetCullMode(const CullMode cullMode)
+{
+    cullFace_ = GLTypes::Map(cullMode);
+}
+
+void GLRasterizerState::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    polygonOffsetEnabled_   = IsPolygonOffsetEnabled(depthBiasDesc);
+    polygonOffsetFactor_    = depthBiasDesc.slopeFactor;
+    polygonOffsetUnits_     = depthBiasDesc.constantFactor;
+    polygonOffsetClamp_     = depthBiasDesc.clamp;
+}
+
 int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasterizerState& rhs)
 {
     #ifdef LLGL_OPENGL
@@ -133,6 +167,50 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasteriz
     return 0;
 }
 
+std::uint32_t GLRasterizerState::GetDeltaFlags(const GLRasterizerState& from, const GLRasterizerState& to)
+{
+    std::uint32_t deltaFlags = 0;
+
+    #ifdef LLGL_OPENGL
+    if (from.polygonMode_ != to.polygonMode_)
+        deltaFlags |= DeltaPolygonMode;
+    if (from.depthClampEnabled_ != to.depthClampEnabled_)
+        deltaFlags |= DeltaCapabilities;
+    #endif
+
+    if (from.multiSampleEnabled_ != to.multiSampleEnabled_ ||
+        from.lineSmoothEnabled_  != to.lineSmoothEnabled_  ||
+        from.rasterizerDiscard_  != to.rasterizerDiscard_  ||
+        from.scissorTestEnabled_ != to.scissorTestEnabled_)
+    {
+        deltaFlags |= DeltaCapabilities;
+    }
+
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    if (from.conservativeRaster_ != to.conservativeRaster_)
+        deltaFlags |= DeltaCapabilities;
+    #endif
+
+    if (from.frontFace_ != to.frontFace_)
+        deltaFlags |= DeltaFrontFace;
+    if (from.lineWidth_ != to.lineWidth_)
+        deltaFlags |= DeltaLineWidth;
+    if (from.cullFace_ != to.cullFace_)
+        deltaFlags |= DeltaCullFace;
+
+    /* Polygon offset mode must also be disabled in the previous mode if it changes */
+    if (from.polygonOffsetEnabled_ != to.polygonOffsetEnabled_ ||
+        from.polygonOffsetMode_    != to.polygonOffsetMode_    ||
+        (to.polygonOffsetEnabled_ &&
+         (from.polygonOffsetFactor_ != to.polygonOffsetFactor_ ||
+          from.polygonOffsetUnits_  != to.polygonOffsetUnits_  ||
+          from.polygonOffsetClamp_  != to.polygonOffsetClamp_)))
+    {
+        deltaFlags |= DeltaPolygonOffset;
+    }
+
+    return deltaFlags;
+}
 
 } // /namespace LLGL
 
@@ -10,10 +10,12 @@
 
 
 #include <LLGL/ForwardDecls.h>
+#include <LLGL/PipelineStateFlags.h>
 #include "../OpenGL.h"
 #include "GLState.h"
 #include <memory>
 #include <limits>
+#include <cstdint>
 
 
 namespace LLGL
@@ -28,6 +30,20 @@ using GLRasterizerStateSPtr = std::shared_ptr<GLRasterizerState>;
 class GLRasterizerState
 {
 
+    public:
+
+        // Flags for the groups of states that differ between two rasterizer states.
+        enum : std::uint32_t
+        {
+            DeltaPolygonMode    = (1u << 0),
+            DeltaCapabilities   = (1u << 1), // Depth clamp, multi-sampling, line smoothing, rasterizer discard, scissor test, conservative rasterization
+            DeltaFrontFace      = (1u << 2),
+            DeltaLineWidth      = (1u << 3),
+            DeltaCullFace       = (1u << 4),
+            DeltaPolygonOffset  = (1u << 5),
+            DeltaAll            = (DeltaPolygonMode | DeltaCapabilities | DeltaFrontFace | DeltaLineWidth | DeltaCullFace | DeltaPolygonOffset),
+        };
+
     public:
 
         GLRasterizerState() = default;
@@ -39,14 +55,26 @@ class GLRasterizerState
         // Binds the entire rasterizer state.
         void Bind(GLStateManager& stateMngr);
 
+        // Binds only the groups of states specified by the bitmask of Delta* flags.
+        void BindDelta(GLStateManager& stateMngr, std::uint32_t deltaFlags);
+
         // Binds the front facing only.
         void BindFrontFaceOnly(GLStateManager& stateMngr);
 
+        // Replaces the cull mode. Used for dynamic pipeline states.
+        void SetCullMode(const CullMode cullMode);
+
+        // Replaces the polygon offset parameters. Used for dynamic pipeline states.
+        void SetDepthBias(const DepthBiasDescriptor& depthBiasDesc);
+
     public:
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLRasterizerState& lhs, const GLRasterizerState& rhs);
 
+        // Returns the bitmask of Delta* flags that must be bound to switch from one rasterizer state to the other.
+        static std::uint32_t GetDeltaFlags(const GLRasterizerState& from, const GLRasterizerState& to);
+
     private:
 
         #ifdef LLGL_OPENGL
@@ -8,17 +8,19 @@
 #include "GLRenderPass.h"
 #include "../../RenderPassUtils.h"
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
 {
 
 
-GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
+GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc) :
+    viewMask_ { desc.viewMask }
 {
     /* Check which color attachment must be cleared */
-    numColorAttachments_ = static_cast<std::uint8_t>(FillClearColorAttachmentIndices(LLGL_MAX_NUM_COLOR_ATTACHMENTS, clearColorAttachments_, desc));
-    if (numColorAttachments_ > 0)
+    numColorAttachments_ = static_cast<std::uint8_t>(NumEnabledColorAttachments(desc));
+    if (FillClearColorAttachmentIndices(LLGL_MAX_NUM_COLOR_ATTACHMENTS, clearColorAttachments_, desc) > 0)
         clearMask_ |= GL_COLOR_BUFFER_BIT;
 
     /* Check if depth attachment must be cleared */
@@ -28,6 +30,31 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Check which attachments don't have to be loaded or stored, so they can be invalidated with glInvalidateFramebuffer */
+    for_range(i, numColorAttachments_)
+        AppendInvalidations(desc.colorAttachments[i], GL_COLOR_ATTACHMENT0 + i);
+
+    if (desc.depthAttachment.format != Format::Undefined)
+        AppendInvalidations(desc.depthAttachment, GL_DEPTH_ATTACHMENT);
+    if (desc.stencilAttachment.format != Format::Undefined)
+        AppendInvalidations(desc.stencilAttachment, GL_STENCIL_ATTACHMENT);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLRenderPass::AppendInvalidations(const AttachmentFormatDescriptor& attachmentDesc, GLenum attachment)
+{
+    /* Previous content is not needed if the attachment is cleared or its content is undefined */
+    if (attachmentDesc.loadOp != AttachmentLoadOp::Load)
+        loadInvalidations_[numLoadInvalidations_++] = attachment;
+
+    /* Outcome of the render pass is not needed if its store operation is undefined */
+    if (attachmentDesc.storeOp == AttachmentStoreOp::Undefined)
+        storeInvalidations_[numStoreInvalidations_++] = attachment;
 }
 
 
@@ -22,6 +22,11 @@ namespace LLGL
 class GLRenderPass final : public RenderPass
 {
 
+    public:
+
+        // Maximum number of attachments that can be invalidated: all color attachments plus depth and stencil attachments.
+        static constexpr std::uint32_t maxNumInvalidations = LLGL_MAX_NUM_COLOR_ATTACHMENTS + 2;
+
     public:
 
         GLRenderPass(const RenderPassDescriptor& desc);
@@ -44,12 +49,53 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns the number of attachments whose previous content is discarded when a render pass begins.
+        inline std::uint8_t GetNumLoadInvalidations() const
+        {
+            return numLoadInvalidations_;
+        }
+
+        // Returns the array of FBO attachments whose previous content is discarded when a render pass begins, e.g. GL_COLOR_ATTACHMENT0 or GL_DEPTH_ATTACHMENT.
+        inline const GLenum* GetLoadInvalidations() const
+        {
+            return loadInvalidations_;
+        }
+
+        // Returns the number of attachments whose content is discarded when a render pass ends.
+        inline std::uint8_t GetNumStoreInvalidations() const
+        {
+            return numStoreInvalidations_;
+        }
+
+        // Returns the array of FBO attachments whose content is discarded when a render pass ends, e.g. GL_COLOR_ATTACHMENT0 or GL_DEPTH_ATTACHMENT.
+        inline const GLenum* GetStoreInvalidations() const
+        {
+            return storeInvalidations_;
+        }
+
+        // Returns the bitmask of views for multiview rendering (GL_OVR_multiview) or 0 if multiview is disabled.
+        inline std::uint32_t GetViewMask() const
+        {
+            return viewMask_;
+        }
+
+    private:
+
+        void AppendInvalidations(const AttachmentFormatDescriptor& attachmentDesc, GLenum attachment);
+
     private:
 
         GLbitfield      clearMask_                                              = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
         std::uint8_t    numColorAttachments_                                    = 0;
 
+        GLenum          loadInvalidations_[maxNumInvalidations]                 = {};
+        GLenum          storeInvalidations_[maxNumInvalidations]                = {};
+        std::uint8_t    numLoadInvalidations_                                   = 0;
+        std::uint8_t    numStoreInvalidations_                                  = 0;
+
+        std::uint32_t   viewMask_                                               = 0;
+
 };
 
 
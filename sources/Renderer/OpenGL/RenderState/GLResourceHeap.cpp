@@ -17,6 +17,7 @@
 #endif
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLTextureViewPool.h"
+#include "../Texture/GLTextureHandlePool.h"
 #include "../../CheckedCast.h"
 #include "../../BindingDescriptorIterator.h"
 #include "../GLTypes.h"
@@ -111,7 +112,8 @@ static bool IsGLBufferViewEnabled(const BufferViewDescriptor& bufferViewDesc)
 
 GLResourceHeap::GLResourceHeap(
     const ResourceHeapDescriptor&               desc,
-    const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+    const ArrayView<ResourceViewDescriptor>&    initialResourceViews,
+    int                                         bindlessTextureBufferSlot)
 {
     /* Get pipeline layout object */
     auto pipelineLayoutGL = LLGL_CAST(const GLPipelineLayout*, desc.pipelineLayout);
@@ -142,6 +144,10 @@ GLResourceHeap::GLResourceHeap(
     const auto numSegmentSets = (numResourceViews / numBindings);
     heap_.FinalizeSegments(numSegmentSets);
 
+    /* Store sampled textures as bindless handles if enabled */
+    if (bindlessTextureBufferSlot >= 0)
+        InitBindlessTextures(bindingIter, static_cast<GLuint>(bindlessTextureBufferSlot), numSegmentSets);
+
     /* Write initial resource views */
     if (!initialResourceViews.empty())
         WriteResourceViews(0, initialResourceViews);
@@ -149,6 +155,9 @@ GLResourceHeap::GLResourceHeap(
 
 GLResourceHeap::~GLResourceHeap()
 {
+    /* Release all bindless texture handles before the texture views they might refer to */
+    ReleaseAllBindlessTextureHandles();
+
     /* Release all texture views for this resource heap */
     FreeAllSegmentsTextureViews();
 }
@@ -171,6 +180,7 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
 
     /* Write each resource view into respective segment */
     std::uint32_t numWritten = 0;
+    std::uint32_t firstDirtySet = numSets, lastDirtySet = 0;
 
     for (const auto& desc : resourceViews)
     {
@@ -186,6 +196,12 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
         auto heapPtr        = heapStartPtr + binding.segmentOffset;
         auto segment        = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
 
+        /* Release bindless texture handle before the texture view it might refer to is released */
+        const std::int32_t bindlessIndex = (bindless_ ? bindless_->bindingMap[firstDescriptor % numBindings] : -1);
+        const std::size_t bindlessEntry = (bindlessIndex >= 0 ? descriptorSet * bindless_->handlesPerSet + static_cast<std::uint32_t>(bindlessIndex) : 0);
+        if (bindlessIndex >= 0)
+            ReleaseBindlessTextureHandle(bindlessEntry);
+
         /* Write descriptor into respective heap segment */
         switch (segment->type)
         {
@@ -214,10 +230,26 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
                 break;
         }
 
+        /* Store texture or sampler ID for the bindless handle of this binding */
+        if (bindlessIndex >= 0)
+        {
+            const GLuint objectID = GLRESOURCEHEAP_DATA0(heapPtr, const GLuint)[binding.descriptorIndex];
+            if (segment->type == GLResourceType_Sampler)
+                bindless_->samplerIDs[bindlessEntry] = objectID;
+            else
+                bindless_->textureIDs[bindlessEntry] = objectID;
+            firstDirtySet   = std::min(firstDirtySet, descriptorSet);
+            lastDirtySet    = std::max(lastDirtySet, descriptorSet);
+        }
+
         ++numWritten;
         ++firstDescriptor;
     }
 
+    /* Make new bindless handles resident and upload them for all modified descriptor sets */
+    if (firstDirtySet <= lastDirtySet)
+        UpdateBindlessTextureHandles(firstDirtySet, lastDirtySet - firstDirtySet + 1);
+
     return numWritten;
 }
 
@@ -330,6 +362,27 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
     for_range(i, segmentation_.numStorageBufferSegments)
         heapPtr += BindBuffersSegment(stateMngr, heapPtr, GLBufferTarget::ShaderStorageBuffer);
 
+    if (bindless_)
+    {
+        /* Bind range of bindless texture handles for this descriptor set instead of texture units */
+        const GLsizeiptr handlesStride = static_cast<GLsizeiptr>(sizeof(GLuint64) * bindless_->handlesPerSet);
+        stateMngr.BindBufferRange(
+            GLBufferTarget::ShaderStorageBuffer,
+            bindless_->bufferSlot,
+            bindless_->buffer->GetID(),
+            static_cast<GLintptr>(handlesStride * descriptorSet),
+            static_cast<GLsizeiptr>(sizeof(GLuint64) * bindless_->count)
+        );
+
+        /* Jump over texture segments */
+        for_range(i, segmentation_.numTextureSegments)
+            heapPtr += GLRESOURCEHEAP_CONST_SEGMENT(heapPtr)->size;
+
+        /* Bind all image texture units; samplers are part of the bindless handles */
+        for_range(i, segmentation_.numImageTextureSegments)
+            heapPtr += BindImageTexturesSegment(stateMngr, heapPtr);
+    }
+    else
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     if (!HasNativeSamplers())
     {
@@ -422,6 +475,115 @@ void GLResourceHeap::FreeAllSegmentsTextureViews()
         FreeAllSegmentSetTextureViews(heapPtr);
 }
 
+void GLResourceHeap::InitBindlessTextures(BindingDescriptorIterator& bindingIter, GLuint bufferSlot, std::uint32_t numSets)
+{
+    #if defined GL_ARB_bindless_texture && defined GL_ARB_shader_storage_buffer_object
+
+    if (!GLTextureHandlePool::IsSupported() || !HasExtension(GLExt::ARB_shader_storage_buffer_object) || !HasNativeSamplers())
+        return;
+
+    /* Collect all sampled textures; each one gets a handle in ascending order of binding slots */
+    auto textureBindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Texture, BindFlags::Sampled);
+    if (textureBindingSlots.empty() || numSets == 0)
+        return;
+
+    auto bindless = MakeUnique<BindlessTextures>();
+
+    bindless->bufferSlot    = bufferSlot;
+    bindless->count         = static_cast<std::uint32_t>(textureBindingSlots.size());
+    bindless->bindingMap.resize(bindingMap_.size(), -1);
+
+    for_range(i, textureBindingSlots.size())
+        bindless->bindingMap[textureBindingSlots[i].index] = static_cast<std::int32_t>(i);
+
+    /* Combine samplers with the texture on the same binding slot */
+    auto samplerBindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Sampler, 0);
+    for (const auto& samplerBinding : samplerBindingSlots)
+    {
+        const auto* textureBinding = FindInSortedArray<GLResourceBinding>(
+            textureBindingSlots.data(),
+            textureBindingSlots.size(),
+            [&samplerBinding](const GLResourceBinding& entry) -> int
+            {
+                return (static_cast<int>(samplerBinding.slot) - static_cast<int>(entry.slot));
+            }
+        );
+        if (textureBinding != nullptr)
+            bindless->bindingMap[samplerBinding.index] = bindless->bindingMap[textureBinding->index];
+    }
+
+    /* Align handle range of each descriptor set to SSBO offset alignment */
+    GLint offsetAlignment = 0;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+
+    const std::size_t handlesSize = GetAlignedSize<std::size_t>(sizeof(GLuint64) * bindless->count, static_cast<std::size_t>(std::max(1, offsetAlignment)));
+    bindless->handlesPerSet = static_cast<std::uint32_t>(DivideRoundUp<std::size_t>(handlesSize, sizeof(GLuint64)));
+
+    const std::size_t numHandles = static_cast<std::size_t>(bindless->handlesPerSet) * numSets;
+    bindless->textureIDs.resize(numHandles, 0);
+    bindless->samplerIDs.resize(numHandles, 0);
+    bindless->handles.resize(numHandles, 0);
+
+    /* Create shader storage buffer for all handles */
+    bindless->buffer = MakeUnique<GLBuffer>(BindFlags::Storage, "LLGL.BindlessTextureHandles");
+    bindless->buffer->BufferStorage(
+        static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandles),
+        bindless->handles.data(),
+        GL_DYNAMIC_STORAGE_BIT,
+        GL_DYNAMIC_DRAW
+    );
+
+    bindless_ = std::move(bindless);
+
+    #endif // /GL_ARB_bindless_texture && GL_ARB_shader_storage_buffer_object
+}
+
+void GLResourceHeap::ReleaseBindlessTextureHandle(std::size_t handleIndex)
+{
+    GLuint64& handle = bindless_->handles[handleIndex];
+    if (handle != 0)
+    {
+        GLTextureHandlePool::Get().ReleaseHandle(handle);
+        handle = 0;
+    }
+}
+
+void GLResourceHeap::ReleaseAllBindlessTextureHandles()
+{
+    if (bindless_)
+    {
+        for_range(i, bindless_->handles.size())
+            ReleaseBindlessTextureHandle(i);
+    }
+}
+
+void GLResourceHeap::UpdateBindlessTextureHandles(std::uint32_t firstSet, std::uint32_t numSets)
+{
+    const std::size_t firstHandle   = static_cast<std::size_t>(bindless_->handlesPerSet) * firstSet;
+    const std::size_t numHandles    = static_cast<std::size_t>(bindless_->handlesPerSet) * numSets;
+
+    /* Acquire resident handles for all texture bindings that have been released or not written yet */
+    for_range(i, numHandles)
+    {
+        const std::size_t handleIndex   = firstHandle + i;
+        const std::size_t setOffset     = (handleIndex % bindless_->handlesPerSet);
+        if (setOffset < bindless_->count && bindless_->handles[handleIndex] == 0)
+        {
+            bindless_->handles[handleIndex] = GLTextureHandlePool::Get().AcquireHandle(
+                bindless_->textureIDs[handleIndex],
+                bindless_->samplerIDs[handleIndex]
+            );
+        }
+    }
+
+    /* Upload handles of all modified descriptor sets at once */
+    bindless_->buffer->BufferSubData(
+        static_cast<GLintptr>(sizeof(GLuint64) * firstHandle),
+        static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandles),
+        &(bindless_->handles[firstHandle])
+    );
+}
+
 void GLResourceHeap::AllocSegmentsUBO(BindingDescriptorIterator& bindingIter)
 {
     /* Collect all uniform buffers */
@@ -17,6 +17,8 @@
 #include "../../SegmentedBuffer.h"
 #include "../OpenGL.h"
 #include <functional>
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -25,6 +27,7 @@ namespace LLGL
 
 enum GLResourceType : std::uint32_t;
 class GLStateManager;
+class GLBuffer;
 class BindingDescriptorIterator;
 struct ResourceHeapDescriptor;
 
@@ -43,7 +46,8 @@ class GLResourceHeap final : public ResourceHeap
 
         GLResourceHeap(
             const ResourceHeapDescriptor&               desc,
-            const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
+            const ArrayView<ResourceViewDescriptor>&    initialResourceViews        = {},
+            int                                         bindlessTextureBufferSlot   = -1
         );
         ~GLResourceHeap();
 
@@ -84,6 +88,19 @@ class GLResourceHeap final : public ResourceHeap
             std::size_t index;  // Index to the input bindings list
         };
 
+        // Bindless texture handles per descriptor set. See RendererConfigurationOpenGL::bindlessTextureBufferSlot.
+        struct BindlessTextures
+        {
+            GLuint                      bufferSlot      = 0;    // SSBO binding slot for the handle buffer
+            std::uint32_t               count           = 0;    // Number of handles per descriptor set
+            std::uint32_t               handlesPerSet   = 0;    // Number of handles per descriptor set including padding for the offset alignment
+            std::vector<std::int32_t>   bindingMap;             // Maps a binding index to a handle index, or -1 if the binding has no handle
+            std::vector<GLuint>         textureIDs;             // Texture ID for each handle
+            std::vector<GLuint>         samplerIDs;             // Optional sampler ID for each handle
+            std::vector<GLuint64>       handles;                // Resident texture handles
+            std::unique_ptr<GLBuffer>   buffer;                 // Shader storage buffer with all handles
+        };
+
     private:
 
         void AllocTextureView(GLuint& texViewID, GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc);
@@ -124,6 +141,11 @@ class GLResourceHeap final : public ResourceHeap
             std::size_t                 payload2Stride
         );
 
+        void InitBindlessTextures(BindingDescriptorIterator& bindingIter, GLuint bufferSlot, std::uint32_t numSets);
+        void ReleaseBindlessTextureHandle(std::size_t handleIndex);
+        void ReleaseAllBindlessTextureHandles();
+        void UpdateBindlessTextureHandles(std::uint32_t firstSet, std::uint32_t numSets);
+
         void WriteBindingMappings(const GLResourceBinding* first, SegmentationSizeType count);
         void CopyBindingMapping(const GLResourceBinding& dst, const GLResourceBinding& src);
 
@@ -155,6 +177,7 @@ class GLResourceHeap final : public ResourceHeap
         SmallVector<BindingSegmentLocation> bindingMap_;    // Maps a binding index to a descriptor location.
         BufferSegmentation                  segmentation_;
         SegmentedBuffer                     heap_;          // Buffer with resource binding information and stride (in bytes) per descriptor set
+        std::unique_ptr<BindlessTextures>   bindless_;      // Only used if bindless textures are enabled
 
 };
 
@@ -80,6 +80,7 @@ enum class GLBufferTarget
     DispatchIndirectBuffer,     // GL_DISPATCH_INDIRECT_BUFFER
     DrawIndirectBuffer,         // GL_DRAW_INDIRECT_BUFFER
     ElementArrayBuffer,         // GL_ELEMENT_ARRAY_BUFFER
+    ParameterBuffer,            // GL_PARAMETER_BUFFER
     PixelPackBuffer,            // GL_PIXEL_PACK_BUFFER
     PixelUnpackBuffer,          // GL_PIXEL_UNPACK_BUFFER
     QueryBuffer,                // GL_QUERY_BUFFER
@@ -156,6 +157,7 @@ struct GLRenderState
     const GLPipelineState*  boundPipelineState  = nullptr;
     GLbitfield              activeBarriers      = 0;
     GLbitfield              dirtyBarriers       = 0;
+    bool                    dirtyUniformBlocks  = false;
 };
 
 struct GLPixelStore
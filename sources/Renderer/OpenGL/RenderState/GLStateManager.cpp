@@ -17,6 +17,7 @@
 #include "../Texture/GLRenderTarget.h"
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 #   include "../Texture/GL2XSampler.h"
+#   include "../Buffer/GL2XVertexArray.h"
 #endif
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
@@ -26,6 +27,7 @@
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
 #include <functional>
+#include <algorithm>
 
 #ifdef LLGL_OPENGL
 #include "../Shader/GLProgramPipeline.h"
@@ -84,6 +86,7 @@ static const GLenum g_bufferTargetsEnum[] =
     GL_DISPATCH_INDIRECT_BUFFER,
     GL_DRAW_INDIRECT_BUFFER,
     GL_ELEMENT_ARRAY_BUFFER,
+    GL_PARAMETER_BUFFER,
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
     GL_QUERY_BUFFER,
@@ -149,8 +152,8 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
  * GLStateManager static members
  */
 
-GLStateManager*             GLStateManager::current_;
-GLStateManager::GLLimits    GLStateManager::commonLimits_;
+thread_local GLStateManager*    GLStateManager::current_;
+GLStateManager::GLLimits        GLStateManager::commonLimits_;
 
 struct GLStateManager::GLIntermediateBufferWriteMasks
 {
@@ -210,6 +213,7 @@ void GLStateManager::ClearCache()
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     ::memset(boundGLTextures_, 0, sizeof(boundGLTextures_));
     ::memset(boundGL2XSamplers_, 0, sizeof(boundGL2XSamplers_));
+    boundGL2XVertexArray_ = nullptr;
     #endif
 
     boundRenderTarget_          = nullptr;
@@ -225,6 +229,9 @@ void GLStateManager::ClearCache()
     boundRasterizerState_       = nullptr;
     boundBlendState_            = nullptr;
     frontFacingDirtyBit_        = false;
+
+    depthStencilDeltas_.Clear();
+    rasterizerDeltas_.Clear();
 }
 
 void GLStateManager::Set(GLState state, bool value)
@@ -666,6 +673,7 @@ void GLStateManager::NotifyDepthStencilStateRelease(GLDepthStencilState* depthSt
 {
     if (boundDepthStencilState_ == depthStencilState)
         boundDepthStencilState_ = nullptr;
+    depthStencilDeltas_.Purge(depthStencilState);
 }
 
 void GLStateManager::BindDepthStencilState(GLDepthStencilState* depthStencilState)
@@ -697,6 +705,12 @@ void GLStateManager::SetDepthMask(GLboolean flag)
 
 void GLStateManager::SetStencilRef(GLint ref, GLenum face)
 {
+    /* Store reference values in case the stencil state is changed dynamically afterwards */
+    if (face != GL_BACK)
+        stencilRefs_[0] = ref;
+    if (face != GL_FRONT)
+        stencilRefs_[1] = ref;
+
     if (boundDepthStencilState_ != nullptr)
         boundDepthStencilState_->BindStencilRefOnly(ref, face);
 }
@@ -710,6 +724,7 @@ void GLStateManager::NotifyRasterizerStateRelease(GLRasterizerState* rasterizerS
         boundRasterizerState_ = nullptr;
         frontFacingDirtyBit_ = false;
     }
+    rasterizerDeltas_.Purge(rasterizerState);
 }
 
 void GLStateManager::BindRasterizerState(GLRasterizerState* rasterizerState)
@@ -762,6 +777,83 @@ void GLStateManager::SetBlendColor(const GLfloat color[4])
     }
 }
 
+/* ----- Pipeline states ----- */
+
+void GLStateManager::BindRenderStates(GLDepthStencilState* depthStencilState, GLRasterizerState* rasterizerState, GLBlendState* blendState)
+{
+    /* Bind depth-stencil state or only the difference to the previous one */
+    if (depthStencilState != nullptr && depthStencilState != boundDepthStencilState_)
+    {
+        if (boundDepthStencilState_ != nullptr && boundDepthStencilState_ != &dynamicDepthStencilState_)
+            depthStencilState->BindDelta(*this, FindOrCreateDepthStencilDelta(boundDepthStencilState_, depthStencilState));
+        else
+            depthStencilState->Bind(*this);
+        boundDepthStencilState_ = depthStencilState;
+    }
+
+    /* Bind rasterizer state or only the difference to the previous one */
+    if (rasterizerState != nullptr)
+    {
+        if (rasterizerState != boundRasterizerState_)
+        {
+            if (boundRasterizerState_ != nullptr && boundRasterizerState_ != &dynamicRasterizerState_)
+            {
+                std::uint32_t deltaFlags = FindOrCreateRasterizerDelta(boundRasterizerState_, rasterizerState);
+                if (frontFacingDirtyBit_)
+                    deltaFlags |= GLRasterizerState::DeltaFrontFace;
+                rasterizerState->BindDelta(*this, deltaFlags);
+            }
+            else
+                rasterizerState->Bind(*this);
+            boundRasterizerState_ = rasterizerState;
+            frontFacingDirtyBit_ = false;
+        }
+        else if (frontFacingDirtyBit_)
+        {
+            rasterizerState->BindFrontFaceOnly(*this);
+            frontFacingDirtyBit_ = false;
+        }
+    }
+
+    /* Blend states are bound entirely, since they are mostly shared between PSOs anyway */
+    BindBlendState(blendState);
+}
+
+void GLStateManager::SetDynamicCullMode(const CullMode cullMode)
+{
+    GLRasterizerState& rasterizerState = GetDynamicRasterizerState();
+    rasterizerState.SetCullMode(cullMode);
+    rasterizerState.BindDelta(*this, GLRasterizerState::DeltaCullFace);
+}
+
+void GLStateManager::SetDynamicDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    GLRasterizerState& rasterizerState = GetDynamicRasterizerState();
+    rasterizerState.SetDepthBias(depthBiasDesc);
+    rasterizerState.BindDelta(*this, GLRasterizerState::DeltaPolygonOffset);
+}
+
+void GLStateManager::SetDynamicDepthState(const DepthDescriptor& depthDesc)
+{
+    GLDepthStencilState& depthStencilState = GetDynamicDepthStencilState();
+    depthStencilState.SetDepthState(depthDesc);
+    depthStencilState.BindDelta(*this, (GLDepthStencilState::DeltaDepthTest | GLDepthStencilState::DeltaDepthMask));
+}
+
+void GLStateManager::SetDynamicStencilState(const StencilDescriptor& stencilDesc)
+{
+    GLDepthStencilState& depthStencilState = GetDynamicDepthStencilState();
+    depthStencilState.SetStencilState(stencilDesc);
+    depthStencilState.BindDelta(*this, GLDepthStencilState::DeltaStencil);
+
+    /* Stencil compare function and reference values are bound together, so re-apply the last dynamic reference values */
+    if (stencilDesc.testEnabled && depthStencilState.IsStencilRefDynamic())
+    {
+        depthStencilState.BindStencilRefOnly(stencilRefs_[0], GL_FRONT);
+        depthStencilState.BindStencilRefOnly(stencilRefs_[1], GL_BACK);
+    }
+}
+
 void GLStateManager::SetLogicOp(GLenum opcode)
 {
     #ifdef LLGL_OPENGL
@@ -929,6 +1021,45 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
     }
 }
 
+void GLStateManager::BindVertexInputLayout(const GLVertexInputLayout& layout, std::size_t numOffsets, const std::uint64_t* offsets)
+{
+    /* Only copy the layout if any of its vertex buffers is bound with an offset */
+    const bool hasOffsets = (offsets != nullptr && std::any_of(offsets, offsets + numOffsets, [](std::uint64_t offset) { return (offset != 0); }));
+    if (hasOffsets)
+    {
+        offsetVertexInputLayout_.AssignWithOffsets(layout, numOffsets, offsets);
+        vertexArrayCache_.BindVertexInputLayout(*this, offsetVertexInputLayout_);
+    }
+    else
+        vertexArrayCache_.BindVertexInputLayout(*this, layout);
+}
+
+void GLStateManager::BindEmptyVertexInputLayout()
+{
+    /* Core profiles cannot draw without a VAO, but keep any VAO whose vertex buffers have been bound explicitly */
+    #ifdef LLGL_GL_ENABLE_OPENGL2X
+    if (!HasNativeVAO())
+        return;
+    #endif // /LLGL_GL_ENABLE_OPENGL2X
+
+    if (contextState_.boundVertexArray == 0)
+        vertexArrayCache_.BindVertexInputLayout(*this, emptyVertexInputLayout_);
+}
+
+#ifdef LLGL_GL_ENABLE_OPENGL2X
+
+void GLStateManager::BindGL2XVertexArray(const GL2XVertexArray& vertexArray)
+{
+    /* Only re-specify vertex attributes if the emulated vertex array has changed */
+    if (boundGL2XVertexArray_ != &vertexArray)
+    {
+        vertexArray.Bind(*this);
+        boundGL2XVertexArray_ = &vertexArray;
+    }
+}
+
+#endif // /LLGL_GL_ENABLE_OPENGL2X
+
 void GLStateManager::BindGLBuffer(const GLBuffer& buffer)
 {
     BindBuffer(buffer.GetTarget(), buffer.GetID());
@@ -1015,7 +1146,17 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
 
     /* Release buffer ID from all potentially used GL buffer targets */
     if ((bindFlags & BindFlags::VertexBuffer) != 0)
+    {
         NotifyBufferRelease(id, GLBufferTarget::ArrayBuffer);
+
+        /* Release VAOs that refer to this vertex buffer */
+        vertexArrayCache_.NotifyBufferRelease(*this, id);
+
+        #ifdef LLGL_GL_ENABLE_OPENGL2X
+        /* Emulated vertex array is owned by the buffer, so its address might be reused */
+        boundGL2XVertexArray_ = nullptr;
+        #endif
+    }
     if ((bindFlags & BindFlags::IndexBuffer) != 0)
         NotifyBufferRelease(id, GLBufferTarget::ElementArrayBuffer);
     if ((bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -1028,6 +1169,7 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     {
         NotifyBufferRelease(id, GLBufferTarget::DrawIndirectBuffer);
         NotifyBufferRelease(id, GLBufferTarget::DispatchIndirectBuffer);
+        NotifyBufferRelease(id, GLBufferTarget::ParameterBuffer);
     }
 
     NotifyBufferRelease(id, GLBufferTarget::CopyReadBuffer);
@@ -1099,6 +1241,11 @@ void GLStateManager::NotifyFramebufferRelease(GLuint framebuffer)
         InvalidateBoundGLObject(boundFramebuffer, framebuffer);
 }
 
+void GLStateManager::BindFramebufferWithTexture(GLFramebufferTarget target, const GLTexture& texture, GLint mipLevel, GLint arrayLayer)
+{
+    framebufferCache_.BindFramebufferWithTexture(*this, target, texture, mipLevel, arrayLayer);
+}
+
 void GLStateManager::NotifyGLRenderTargetRelease(GLRenderTarget* renderTarget)
 {
     if (boundRenderTarget_ == renderTarget)
@@ -1142,6 +1289,7 @@ void GLStateManager::DeleteRenderbuffer(GLuint renderbuffer)
     {
         glDeleteRenderbuffers(1, &renderbuffer);
         InvalidateBoundGLObject(contextState_.boundRenderbuffer, renderbuffer);
+        framebufferCache_.NotifyTextureRelease(*this, renderbuffer, true);
     }
 }
 
@@ -1375,6 +1523,7 @@ void GLStateManager::DeleteTexture(GLuint texture, GLTextureTarget target, bool
     {
         glDeleteTextures(1, &texture);
         NotifyTextureRelease(texture, target, invalidateActiveLayerOnly);
+        framebufferCache_.NotifyTextureRelease(*this, texture, false);
     }
 }
 
@@ -1677,6 +1826,105 @@ void GLStateManager::FlipFrontFacing(bool isFlipped)
     frontFacingDirtyBit_ = true;
 }
 
+std::uint32_t GLStateManager::FindOrCreateDepthStencilDelta(GLDepthStencilState* from, GLDepthStencilState* to)
+{
+    return depthStencilDeltas_.FindOrCreate(
+        from, to,
+        [](const void* lhs, const void* rhs) -> std::uint32_t
+        {
+            return GLDepthStencilState::GetDeltaFlags(
+                *static_cast<const GLDepthStencilState*>(lhs),
+                *static_cast<const GLDepthStencilState*>(rhs)
+            );
+        }
+    );
+}
+
+std::uint32_t GLStateManager::FindOrCreateRasterizerDelta(GLRasterizerState* from, GLRasterizerState* to)
+{
+    return rasterizerDeltas_.FindOrCreate(
+        from, to,
+        [](const void* lhs, const void* rhs) -> std::uint32_t
+        {
+            return GLRasterizerState::GetDeltaFlags(
+                *static_cast<const GLRasterizerState*>(lhs),
+                *static_cast<const GLRasterizerState*>(rhs)
+            );
+        }
+    );
+}
+
+GLDepthStencilState& GLStateManager::GetDynamicDepthStencilState()
+{
+    /* Copy the currently bound state, which is then bound entirely with the next PSO, since its content changes over time */
+    if (boundDepthStencilState_ != &dynamicDepthStencilState_)
+    {
+        if (boundDepthStencilState_ != nullptr)
+            dynamicDepthStencilState_ = *boundDepthStencilState_;
+        boundDepthStencilState_ = &dynamicDepthStencilState_;
+    }
+    return dynamicDepthStencilState_;
+}
+
+GLRasterizerState& GLStateManager::GetDynamicRasterizerState()
+{
+    /* Copy the currently bound state, which is then bound entirely with the next PSO, since its content changes over time */
+    if (boundRasterizerState_ != &dynamicRasterizerState_)
+    {
+        if (boundRasterizerState_ != nullptr)
+            dynamicRasterizerState_ = *boundRasterizerState_;
+        boundRasterizerState_ = &dynamicRasterizerState_;
+    }
+    return dynamicRasterizerState_;
+}
+
+std::uint32_t GLStateManager::RenderStateDeltaCache::FindOrCreate(
+    const void*     from,
+    const void*     to,
+    std::uint32_t   (*getDeltaFlags)(const void*, const void*))
+{
+    /* Find delta in MRU list and move it to the front */
+    for_range(i, numEntries)
+    {
+        if (entries[i].from == from && entries[i].to == to)
+        {
+            const RenderStateDelta entry = entries[i];
+            std::move_backward(entries, entries + i, entries + i + 1);
+            entries[0] = entry;
+            return entry.flags;
+        }
+    }
+
+    /* Compute new delta and drop the least recently used entry if the list is full */
+    if (numEntries < maxNumEntries)
+        ++numEntries;
+    std::move_backward(entries, entries + numEntries - 1, entries + numEntries);
+
+    entries[0].from     = from;
+    entries[0].to       = to;
+    entries[0].flags    = getDeltaFlags(from, to);
+
+    return entries[0].flags;
+}
+
+void GLStateManager::RenderStateDeltaCache::Purge(const void* state)
+{
+    RenderStateDelta* end = std::remove_if(
+        entries,
+        entries + numEntries,
+        [state](const RenderStateDelta& entry) -> bool
+        {
+            return (entry.from == state || entry.to == state);
+        }
+    );
+    numEntries = static_cast<std::size_t>(end - entries);
+}
+
+void GLStateManager::RenderStateDeltaCache::Clear()
+{
+    numEntries = 0;
+}
+
 static void AccumCommonGLLimits(GLStateManager::GLLimits& dst, const GLStateManager::GLLimits& src)
 {
     if (dst.maxViewports == 0)
@@ -1838,6 +2086,9 @@ void GLStateManager::ClearAttachmentsWithRenderPass(
     const ClearValue defaultClearValue;
     auto mask = renderPassGL.GetClearMask();
 
+    /* Invalidate attachments whose previous content is not loaded, so tile-based GPUs don't have to restore it before the clear operations */
+    InvalidateFramebufferAttachments(renderPassGL.GetNumLoadInvalidations(), renderPassGL.GetLoadInvalidations(), /*isEndOfRenderPass:*/ false);
+
     GLIntermediateBufferWriteMasks intermediateMasks;
 
     /* Clear color attachments */
@@ -1899,6 +2150,56 @@ void GLStateManager::ClearAttachmentsWithRenderPass(
     RestoreWriteMasks(intermediateMasks);
 }
 
+void GLStateManager::InvalidateAttachmentsWithRenderPass(const GLRenderPass& renderPassGL)
+{
+    InvalidateFramebufferAttachments(renderPassGL.GetNumStoreInvalidations(), renderPassGL.GetStoreInvalidations(), /*isEndOfRenderPass:*/ true);
+}
+
+void GLStateManager::InvalidateFramebufferAttachments(std::uint32_t numAttachments, const GLenum* attachments, bool isEndOfRenderPass)
+{
+    #ifdef LLGL_GLEXT_INVALIDATE_FRAMEBUFFER
+    if (numAttachments == 0 || !HasExtension(GLExt::ARB_invalidate_subdata))
+        return;
+
+    GLenum attachmentsGL[GLRenderPass::maxNumInvalidations];
+    GLsizei numAttachmentsGL = 0;
+
+    if (boundRenderTarget_ != nullptr)
+    {
+        /*
+        Multi-sampled color attachments are resolved when the next render target is bound,
+        so they must not be invalidated at the end of a render pass if the render target has resolve attachments.
+        */
+        const bool keepColorAttachments = (isEndOfRenderPass && boundRenderTarget_->HasResolveAttachments());
+        for_range(i, numAttachments)
+        {
+            const bool isColorAttachment = (attachments[i] != GL_DEPTH_ATTACHMENT && attachments[i] != GL_STENCIL_ATTACHMENT);
+            if (!(keepColorAttachments && isColorAttachment))
+                attachmentsGL[numAttachmentsGL++] = attachments[i];
+        }
+        BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, boundRenderTarget_->GetFramebuffer().GetID());
+    }
+    else
+    {
+        /* Default framebuffer only has a single color buffer and uses different attachment names */
+        for_range(i, numAttachments)
+        {
+            switch (attachments[i])
+            {
+                case GL_COLOR_ATTACHMENT0:  attachmentsGL[numAttachmentsGL++] = GL_COLOR;   break;
+                case GL_DEPTH_ATTACHMENT:   attachmentsGL[numAttachmentsGL++] = GL_DEPTH;   break;
+                case GL_STENCIL_ATTACHMENT: attachmentsGL[numAttachmentsGL++] = GL_STENCIL; break;
+                default:                                                                    break;
+            }
+        }
+        BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, 0);
+    }
+
+    if (numAttachmentsGL > 0)
+        glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachmentsGL, attachmentsGL);
+    #endif // /LLGL_GLEXT_INVALIDATE_FRAMEBUFFER
+}
+
 std::uint32_t GLStateManager::ClearColorBuffers(
     const std::uint8_t*             colorBuffers,
     std::uint32_t                   numClearValues,
@@ -11,6 +11,10 @@
 
 #include "GLState.h"
 #include "GLContextState.h"
+#include "GLVertexArrayCache.h"
+#include "GLFramebufferCache.h"
+#include "GLDepthStencilState.h"
+#include "GLRasterizerState.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/CommandBufferFlags.h>
 #include "../OpenGL.h"
@@ -38,6 +42,7 @@ class GLProgramPipeline;
 class GLShaderProgram;
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 class GL2XSampler;
+class GL2XVertexArray;
 #endif
 
 // OpenGL state machine manager that keeps track of certain GL states.
@@ -161,6 +166,23 @@ class GLStateManager
         void BindBlendState(GLBlendState* blendState);
 
         void SetBlendColor(const GLfloat color[4]);
+
+        /* ----- Pipeline states ----- */
+
+        /*
+        Binds the depth-stencil, rasterizer, and blend states of a graphics PSO together.
+        Switching between recently bound combinations only binds the pre-computed difference between their depth-stencil and rasterizer states.
+        */
+        void BindRenderStates(GLDepthStencilState* depthStencilState, GLRasterizerState* rasterizerState, GLBlendState* blendState);
+
+        /*
+        Binds dynamic pipeline states on top of the currently bound depth-stencil or rasterizer state.
+        The bound state is copied into an internal state first, so that the original state objects remain unmodified.
+        */
+        void SetDynamicCullMode(const CullMode cullMode);
+        void SetDynamicDepthBias(const DepthBiasDescriptor& depthBiasDesc);
+        void SetDynamicDepthState(const DepthDescriptor& depthDesc);
+        void SetDynamicStencilState(const StencilDescriptor& stencilDesc);
         void SetLogicOp(GLenum opcode);
 
         /* ----- Buffer ----- */
@@ -175,6 +197,20 @@ class GLStateManager
 
         void BindVertexArray(GLuint vertexArray);
 
+        /*
+        Binds a cached VAO for the specified vertex input layout. VAOs are built on demand for this GL context.
+        If offsets are specified, they replace the offsets (in bytes) of the first vertex buffer bindings of the layout.
+        */
+        void BindVertexInputLayout(const GLVertexInputLayout& layout, std::size_t numOffsets = 0, const std::uint64_t* offsets = nullptr);
+
+        // Binds a cached VAO without vertex attributes unless a VAO is already bound. Used for graphics pipelines with vertex pulling.
+        void BindEmptyVertexInputLayout();
+
+        #ifdef LLGL_GL_ENABLE_OPENGL2X
+        // Binds the emulated vertex array unless it is already bound.
+        void BindGL2XVertexArray(const GL2XVertexArray& vertexArray);
+        #endif
+
         void BindGLBuffer(const GLBuffer& buffer);
 
         void NotifyVertexArrayRelease(GLuint vertexArray);
@@ -203,6 +239,9 @@ class GLStateManager
         void PopBoundFramebuffer();
 
         void NotifyFramebufferRelease(GLuint framebuffer);
+
+        // Binds a cached FBO with the specified texture subresource as its only attachment, e.g. to copy or read from a texture.
+        void BindFramebufferWithTexture(GLFramebufferTarget target, const GLTexture& texture, GLint mipLevel, GLint arrayLayer);
         void NotifyGLRenderTargetRelease(GLRenderTarget* renderTarget);
 
         GLRenderTarget* GetBoundRenderTarget() const;
@@ -285,6 +324,9 @@ class GLStateManager
             const ClearValue*   clearValues
         );
 
+        // Invalidates all attachments of the bound render target whose content is discarded at the end of the specified render pass.
+        void InvalidateAttachmentsWithRenderPass(const GLRenderPass& renderPassGL);
+
         void Clear(long flags);
         void ClearBuffers(std::uint32_t numAttachments, const AttachmentClear* attachments);
 
@@ -329,6 +371,12 @@ class GLStateManager
         void SetFrontFaceInternal(GLenum mode);
         void FlipFrontFacing(bool isFlipped);
 
+        std::uint32_t FindOrCreateDepthStencilDelta(GLDepthStencilState* from, GLDepthStencilState* to);
+        std::uint32_t FindOrCreateRasterizerDelta(GLRasterizerState* from, GLRasterizerState* to);
+
+        GLDepthStencilState& GetDynamicDepthStencilState();
+        GLRasterizerState& GetDynamicRasterizerState();
+
         void DetermineLimits();
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
@@ -355,6 +403,9 @@ class GLStateManager
             GLIntermediateBufferWriteMasks& intermediateMasks
         );
 
+        // Invalidates the specified FBO attachments of the bound render target with glInvalidateFramebuffer.
+        void InvalidateFramebufferAttachments(std::uint32_t numAttachments, const GLenum* attachments, bool isEndOfRenderPass);
+
     private:
 
         struct CapabilityStackEntry
@@ -392,10 +443,31 @@ class GLStateManager
             GLuint program;
         };
 
+        // Pre-computed Delta* flags to switch from one sub-state of a graphics PSO to another.
+        struct RenderStateDelta
+        {
+            const void*     from;
+            const void*     to;
+            std::uint32_t   flags;
+        };
+
+        // Small most-recently-used list of state deltas; the first entry is the most recently used one.
+        struct RenderStateDeltaCache
+        {
+            static constexpr std::size_t maxNumEntries = 8;
+
+            std::uint32_t FindOrCreate(const void* from, const void* to, std::uint32_t (*getDeltaFlags)(const void*, const void*));
+            void Purge(const void* state);
+            void Clear();
+
+            std::size_t         numEntries  = 0;
+            RenderStateDelta    entries[maxNumEntries];
+        };
+
     private:
 
-        static GLStateManager*  current_;
-        static GLLimits         commonLimits_;          // Common denominator of limitations for all GL contexts
+        static thread_local GLStateManager* current_;               // Current state manager per thread
+        static GLLimits                     commonLimits_;          // Common denominator of limitations for all GL contexts
 
     private:
 
@@ -406,6 +478,7 @@ class GLStateManager
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GLTexture*                          boundGLTextures_[GLContextState::numTextureLayers]      = {};
         const GL2XSampler*                  boundGL2XSamplers_[GLContextState::numTextureLayers]    = {};
+        const GL2XVertexArray*              boundGL2XVertexArray_                                   = nullptr;
         #endif
 
         GLRenderTarget*                     boundRenderTarget_          = nullptr;
@@ -427,6 +500,13 @@ class GLStateManager
 
         bool                                frontFacingDirtyBit_        = false;
 
+        GLDepthStencilState                 dynamicDepthStencilState_;  // Copy of the bound depth-stencil state with dynamic states applied
+        GLRasterizerState                   dynamicRasterizerState_;    // Copy of the bound rasterizer state with dynamic states applied
+        GLint                               stencilRefs_[2]             = { 0, 0 }; // Last dynamic stencil reference values for front and back faces
+
+        RenderStateDeltaCache               depthStencilDeltas_;
+        RenderStateDeltaCache               rasterizerDeltas_;
+
         std::stack<CapabilityStackEntry>    capabilitiesStack_;
         std::stack<BufferStackEntry>        bufferStack_;
         std::stack<TextureStackEntry>       textureState_;
@@ -434,6 +514,11 @@ class GLStateManager
         std::stack<RenderbufferStackEntry>  renderbufferStack_;
         std::stack<ShaderProgramStackEntry> shaderProgramStack_;
 
+        GLVertexArrayCache                  vertexArrayCache_;
+        GLFramebufferCache                  framebufferCache_;
+        GLVertexInputLayout                 offsetVertexInputLayout_;   // Intermediate layout for vertex buffer bindings with offsets
+        GLVertexInputLayout                 emptyVertexInputLayout_;    // Layout without vertex attributes for vertex pulling
+
 };
 
 
@@ -0,0 +1,193 @@
+/*
+ * GLUniformBlockStorage.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLUniformBlockStorage.h"
+#include "GLStateManager.h"
+#include "../Shader/GLShader.h"
+#include "../Buffer/GLPersistentRingBuffer.h"
+#include "../Ext/GLExtensions.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+bool GLUniformBlockStorage::BuildBlocks(GLuint program, GLuint firstSlot)
+{
+    blocks_.clear();
+    members_.clear();
+    data_.clear();
+
+    /* Query offset alignment for glBindBufferRange */
+    GLint offsetAlignment = 1;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    alignment_ = std::max<GLsizeiptr>(1, offsetAlignment);
+
+    /* Find uniform block of each shader stage and assign consecutive binding slots */
+    const ShaderType shaderTypes[] =
+    {
+        ShaderType::Vertex,
+        ShaderType::TessControl,
+        ShaderType::TessEvaluation,
+        ShaderType::Geometry,
+        ShaderType::Fragment,
+        ShaderType::Compute,
+    };
+
+    GLsizeiptr storageSize = 0;
+
+    for (ShaderType shaderType : shaderTypes)
+    {
+        const char* blockName = GLShader::GetDefaultUniformBlockName(shaderType);
+        const GLuint blockIndex = glGetUniformBlockIndex(program, blockName);
+        if (blockIndex == GL_INVALID_INDEX)
+            continue;
+
+        GLint blockSize = 0;
+        glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+
+        Block block;
+        {
+            block.name      = blockName;
+            block.index     = blockIndex;
+            block.slot      = firstSlot + static_cast<GLuint>(blocks_.size());
+            block.offset    = static_cast<GLintptr>(storageSize);
+            block.size      = static_cast<GLsizeiptr>(blockSize);
+        }
+        glUniformBlockBinding(program, block.index, block.slot);
+        blocks_.push_back(block);
+
+        storageSize = GetAlignedSize(storageSize + block.size, alignment_);
+    }
+
+    /* Uniforms that are never written are zero-initialized like uniforms in the default block */
+    data_.resize(static_cast<std::size_t>(storageSize), 0);
+
+    return !blocks_.empty();
+}
+
+// Returns the number of matrix columns of the specified uniform type, or 1 if this is not a matrix type.
+static GLuint GetUniformNumColumns(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT_MAT2:
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT2x4:
+            return 2;
+        case GL_FLOAT_MAT3:
+        case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3x4:
+            return 3;
+        case GL_FLOAT_MAT4:
+        case GL_FLOAT_MAT4x2:
+        case GL_FLOAT_MAT4x3:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+bool GLUniformBlockStorage::BuildMembers(GLuint program, const char* name, GLenum& outType, GLsizei& outCount, GLuint& outFirstMember, GLuint& outNumMembers)
+{
+    outFirstMember  = static_cast<GLuint>(members_.size());
+    outNumMembers   = 0;
+
+    for (const Block& block : blocks_)
+    {
+        /* Members of a uniform block are queried by their block name, e.g. "LLGL_VertexUniforms.wvpMatrix"; arrays may require the "[0]" suffix */
+        std::string memberName = block.name;
+        memberName += '.';
+        memberName += name;
+
+        const GLchar* memberNameStr = memberName.c_str();
+        GLuint memberIndex = GL_INVALID_INDEX;
+        glGetUniformIndices(program, 1, &memberNameStr, &memberIndex);
+        if (memberIndex == GL_INVALID_INDEX)
+        {
+            memberName += "[0]";
+            memberNameStr = memberName.c_str();
+            glGetUniformIndices(program, 1, &memberNameStr, &memberIndex);
+            if (memberIndex == GL_INVALID_INDEX)
+                continue;
+        }
+
+        /* Query memory layout of block member */
+        GLint type = 0, size = 0, offset = 0, arrayStride = 0, matrixStride = 0;
+        glGetActiveUniformsiv(program, 1, &memberIndex, GL_UNIFORM_TYPE,            &type);
+        glGetActiveUniformsiv(program, 1, &memberIndex, GL_UNIFORM_SIZE,            &size);
+        glGetActiveUniformsiv(program, 1, &memberIndex, GL_UNIFORM_OFFSET,          &offset);
+        glGetActiveUniformsiv(program, 1, &memberIndex, GL_UNIFORM_ARRAY_STRIDE,    &arrayStride);
+        glGetActiveUniformsiv(program, 1, &memberIndex, GL_UNIFORM_MATRIX_STRIDE,   &matrixStride);
+
+        Member member;
+        {
+            member.offset       = static_cast<GLuint>(block.offset + offset);
+            member.arrayStride  = static_cast<GLuint>(arrayStride);
+            member.matrixStride = static_cast<GLuint>(matrixStride);
+            member.numColumns   = GetUniformNumColumns(static_cast<GLenum>(type));
+        }
+        members_.push_back(member);
+
+        outType  = static_cast<GLenum>(type);
+        outCount = static_cast<GLsizei>(size);
+        ++outNumMembers;
+    }
+
+    return (outNumMembers > 0);
+}
+
+void GLUniformBlockStorage::WriteMembers(GLuint firstMember, GLuint numMembers, GLsizei count, GLuint elementSize, const void* data, std::size_t dataSize)
+{
+    if (elementSize == 0)
+        return;
+
+    /* Only write array elements that are entirely contained in the input data */
+    const std::size_t numElements = std::min<std::size_t>(static_cast<std::size_t>(count), dataSize / elementSize);
+
+    for_range(i, numMembers)
+    {
+        const Member& member = members_[firstMember + i];
+        const GLuint columnSize = elementSize / member.numColumns;
+
+        /* Copy each matrix column separately, since std140 pads them to the size of a vec4 */
+        const char* src = reinterpret_cast<const char*>(data);
+        for_range(element, numElements)
+        {
+            char* dst = data_.data() + member.offset + element * member.arrayStride;
+            for_range(column, member.numColumns)
+            {
+                std::memcpy(dst + column * member.matrixStride, src, columnSize);
+                src += columnSize;
+            }
+        }
+    }
+}
+
+void GLUniformBlockStorage::BindBlocks(GLStateManager& stateMngr, const void* data) const
+{
+    /* Write uniform data into ring buffer; this only fails if the data is larger than a segment of the ring buffer */
+    GLuint      bufferID    = 0;
+    GLintptr    offset      = 0;
+    if (!GLPersistentRingBuffer::Get().WriteData(static_cast<GLsizeiptr>(data_.size()), data, alignment_, bufferID, offset))
+        return;
+
+    for (const Block& block : blocks_)
+        stateMngr.BindBufferRange(GLBufferTarget::UniformBuffer, block.slot, bufferID, offset + block.offset, block.size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,106 @@
+/*
+ * GLUniformBlockStorage.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_UNIFORM_BLOCK_STORAGE_H
+#define LLGL_GL_UNIFORM_BLOCK_STORAGE_H
+
+
+#include "../OpenGL.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+/*
+CPU storage of the uniform blocks that replace the default uniform block of a shader program, one for each shader stage.
+CommandBuffer::SetUniforms writes into this storage, which is then uploaded into the persistent ring buffer
+and bound to consecutive uniform buffer slots before the next draw or compute command.
+See RendererConfigurationOpenGL::uniformBufferSlot.
+*/
+class GLUniformBlockStorage
+{
+
+    public:
+
+        // Queries the uniform blocks of the specified program and assigns consecutive binding slots starting with 'firstSlot'. Returns false if the program has no such blocks.
+        bool BuildBlocks(GLuint program, GLuint firstSlot);
+
+        /*
+        Queries the block members for the specified uniform name, which may occur in the block of each shader stage.
+        Returns false if the uniform is not a member of any block. Otherwise, the type and array size of the uniform are returned in 'outType' and 'outCount'.
+        */
+        bool BuildMembers(GLuint program, const char* name, GLenum& outType, GLsizei& outCount, GLuint& outFirstMember, GLuint& outNumMembers);
+
+        // Writes the specified uniform data into the CPU storage. The data is tightly packed with 'elementSize' bytes for each array element.
+        void WriteMembers(GLuint firstMember, GLuint numMembers, GLsizei count, GLuint elementSize, const void* data, std::size_t dataSize);
+
+        // Writes the specified data into the ring buffer and binds the range of each uniform block to its binding slot.
+        void BindBlocks(GLStateManager& stateMngr, const void* data) const;
+
+    public:
+
+        // Returns true if the program has any uniform blocks for its default uniforms.
+        inline bool HasBlocks() const
+        {
+            return !blocks_.empty();
+        }
+
+        // Returns the CPU storage of all uniform blocks.
+        inline const void* GetData() const
+        {
+            return data_.data();
+        }
+
+        // Returns the size (in bytes) of the CPU storage of all uniform blocks.
+        inline std::size_t GetSize() const
+        {
+            return data_.size();
+        }
+
+    private:
+
+        struct Block
+        {
+            const char* name;
+            GLuint      index;
+            GLuint      slot;
+            GLintptr    offset; // Offset within the storage of all blocks
+            GLsizeiptr  size;
+        };
+
+        struct Member
+        {
+            GLuint      offset; // Offset within the storage of all blocks
+            GLuint      arrayStride;
+            GLuint      matrixStride;
+            GLuint      numColumns;
+        };
+
+    private:
+
+        std::vector<Block>  blocks_;
+        std::vector<Member> members_;
+        std::vector<char>   data_;
+        GLsizeiptr          alignment_  = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
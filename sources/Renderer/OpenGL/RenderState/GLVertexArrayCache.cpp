@@ -0,0 +1,96 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexArrayCache.h"
+#include "GLStateManager.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+void GLVertexArrayCache::BindVertexInputLayout(GLStateManager& stateMngr, const GLVertexInputLayout& layout)
+{
+    const bool separateFormat = GLVertexArrayObject::HasSeparateVertexFormat();
+
+    /* Find VAO with compatible vertex format, and with the same vertex buffers if they cannot be bound separately */
+    std::size_t insertionIndex = 0;
+    EntryPtr* entry = FindInSortedArray<EntryPtr>(
+        entries_.data(),
+        entries_.size(),
+        [&layout, separateFormat](const EntryPtr& entry) -> int
+        {
+            if (separateFormat)
+                return GLVertexInputLayout::CompareFormatSWO(entry->layout, layout);
+            else
+                return GLVertexInputLayout::CompareSWO(entry->layout, layout);
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+    {
+        Entry& cachedEntry = *(entry->get());
+        stateMngr.BindVertexArray(cachedEntry.vao.GetID());
+
+        /* Only rebind vertex buffers if they differ from the ones bound to this VAO */
+        if (separateFormat && GLVertexInputLayout::CompareSWO(cachedEntry.layout, layout) != 0)
+        {
+            cachedEntry.vao.BindVertexBuffers(layout);
+            cachedEntry.layout = layout;
+        }
+    }
+    else
+    {
+        /* Build new VAO with insertion sort */
+        EntryPtr newEntry = MakeUnique<Entry>();
+        newEntry->layout = layout;
+
+        stateMngr.BindVertexArray(newEntry->vao.GetID());
+        newEntry->vao.BuildVertexLayout(stateMngr, layout);
+
+        entries_.insert(entries_.begin() + insertionIndex, std::move(newEntry));
+    }
+}
+
+void GLVertexArrayCache::NotifyBufferRelease(GLStateManager& stateMngr, GLuint buffer)
+{
+    /* Remove all VAOs that refer to this buffer; erasing entries keeps the container sorted */
+    auto it = std::remove_if(
+        entries_.begin(),
+        entries_.end(),
+        [&stateMngr, buffer](const EntryPtr& entry) -> bool
+        {
+            for (const GLVertexBinding& binding : entry->layout.GetBindings())
+            {
+                if (binding.buffer == buffer)
+                {
+                    stateMngr.NotifyVertexArrayRelease(entry->vao.GetID());
+                    return true;
+                }
+            }
+            return false;
+        }
+    );
+    entries_.erase(it, entries_.end());
+}
+
+void GLVertexArrayCache::Clear(GLStateManager& stateMngr)
+{
+    for (const EntryPtr& entry : entries_)
+        stateMngr.NotifyVertexArrayRelease(entry->vao.GetID());
+    entries_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,74 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include "../Buffer/GLVertexInputLayout.h"
+#include "../Buffer/GLVertexArrayObject.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+/*
+Cache of vertex-array-objects (VAO) for a single GL context, since VAOs are not shared between contexts.
+With GL_ARB_vertex_attrib_binding, VAOs are keyed by vertex format only and the vertex buffers are rebound when they differ.
+Otherwise, VAOs are keyed by vertex format and vertex buffers.
+Index buffers are not part of the key, because GLStateManager binds them to whichever VAO is active.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache() = default;
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Binds a VAO for the specified vertex input layout and builds a new one if there is no compatible VAO yet.
+        void BindVertexInputLayout(GLStateManager& stateMngr, const GLVertexInputLayout& layout);
+
+        // Releases all VAOs that refer to the specified vertex buffer.
+        void NotifyBufferRelease(GLStateManager& stateMngr, GLuint buffer);
+
+        // Releases all VAOs.
+        void Clear(GLStateManager& stateMngr);
+
+    private:
+
+        struct Entry
+        {
+            GLVertexInputLayout layout; // Vertex format and buffers that are currently bound to this VAO
+            GLVertexArrayObject vao;
+        };
+
+        using EntryPtr = std::unique_ptr<Entry>;
+
+    private:
+
+        std::vector<EntryPtr> entries_; // Sorted by GLVertexInputLayout::CompareSWO or CompareFormatSWO
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
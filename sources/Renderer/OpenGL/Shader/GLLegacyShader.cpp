@@ -12,6 +12,7 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../../../Core/Exception.h"
+#include <cstring>
 
 
 namespace LLGL
@@ -51,6 +52,12 @@ void GLLegacyShader::CompileShaderSource(GLuint shader, const char* source)
     glCompileShader(shader);
 }
 
+bool GLLegacyShader::QueryStatusAndLog(std::string& log) const
+{
+    log = GLLegacyShader::GetGLShaderLog(GetID());
+    return GLLegacyShader::GetCompileStatus(GetID());
+}
+
 bool GLLegacyShader::GetCompileStatus(GLuint shader)
 {
     GLint status = 0;
@@ -95,6 +102,13 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
 
 bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
 {
+    /* Let the driver compile in the background and query the status when the report is requested */
+    if (GLShader::HasParallelShaderCompile())
+    {
+        DeferStatusAndLog();
+        return true;
+    }
+
     /* Query compile status and log */
     const bool status = GLLegacyShader::GetCompileStatus(GetID());
     ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
@@ -111,28 +125,25 @@ void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 
 void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
-    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> bool
+    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation) -> bool
     {
         const GLuint shader = CreateShaderPermutation(permutation);
-        auto sourceCallback = std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1);
-
-        if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
+        auto sourceCallback = [this, shader](const char* source)
         {
-            const std::string fileContent = ReadFileString(shaderDesc.source);
-            GLShader::PatchShaderSource(sourceCallback, fileContent.c_str(), shaderDesc, enabledFlags);
-        }
-        else
-            GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
-
+            /* Hash final source after patching, since shader macros and permutations modify the source */
+            AppendContentHash(source, ::strlen(source));
+            GLLegacyShader::CompileShaderSource(shader, source);
+        };
+        GLShader::PatchShaderSourcePermutation(sourceCallback, shaderDesc, permutation);
         return FinalizeShaderPermutation(permutation);
     };
 
     /* Compile and patch default shader permutation */
-    if (CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization))
+    if (CompileShaderPermutation(PermutationDefault))
     {
         /* Compile and patch shader permutation for flipped Y-position */
         if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
-            CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+            CompileShaderPermutation(PermutationFlippedYPosition);
     }
 }
 
@@ -143,31 +154,16 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 
     if (HasExtension(GLExt::ARB_gl_spirv) && HasExtension(GLExt::ARB_ES2_compatibility))
     {
-        /* Get shader binary */
-        std::vector<char>   fileContent;
-        const void*         binaryBuffer    = nullptr;
-        GLsizei             binaryLength    = 0;
-
-        if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
+        auto binaryCallback = [this, shader](const void* binary, std::size_t binarySize, const char* entryPoint)
         {
-            /* Load binary from file */
-            fileContent = ReadFileBuffer(shaderDesc.source);
-            binaryBuffer = fileContent.data();
-            binaryLength = static_cast<GLsizei>(fileContent.size());
-        }
-        else
-        {
-            /* Load binary from buffer */
-            binaryBuffer = shaderDesc.source;
-            binaryLength = static_cast<GLsizei>(shaderDesc.sourceSize);
-        }
-
-        /* Load shader binary */
-        glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
-
-        /* Specialize for the default "main" function in a SPIR-V module  */
-        const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
-        glSpecializeShader(shader, entryPoint, 0, nullptr, nullptr);
+            /* Load SPIR-V module and specialize its entry point; this bypasses the GLSL front-end of the driver entirely */
+            glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binary, static_cast<GLsizei>(binarySize));
+            glSpecializeShader(shader, entryPoint, 0, nullptr, nullptr);
+
+            AppendContentHash(binary, binarySize);
+            AppendContentHash(entryPoint, ::strlen(entryPoint));
+        };
+        GLShader::ReadShaderBinary(binaryCallback, shaderDesc);
     }
     else
     #endif
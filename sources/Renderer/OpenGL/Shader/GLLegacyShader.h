@@ -43,6 +43,8 @@ class GLLegacyShader final : public GLShader
 
     private:
 
+        bool QueryStatusAndLog(std::string& log) const override;
+
         GLuint CreateShaderPermutation(Permutation permutation);
         bool FinalizeShaderPermutation(Permutation permutation);
 
@@ -21,7 +21,7 @@ namespace LLGL
 
 static GLuint SortShaderArray(std::size_t numShaders, const Shader* const* shaders, GLShader::Permutation permutation, GLuint* outShaderIDs)
 {
-    constexpr auto numShaderTypes = (static_cast<int>(ShaderType::Compute) + 1);
+    constexpr auto numShaderTypes = (static_cast<int>(ShaderType::Mesh) + 1);
 
     /* Find shaders that are affected by permutation */
     const GLShader* finalGLPositionShader = nullptr;
@@ -9,25 +9,26 @@
 #include "GLLegacyShader.h"
 #include "GLShaderProgram.h"
 #include "GLShaderBindingLayout.h"
+#include "../RenderState/GLPipelineCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <cstring>
 
 
 namespace LLGL
 {
 
 
-GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
+GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc, PersistentPipelineCache* persistentCache) :
     GLShader { /*isSeparable:*/ true, desc }
 {
-    GLLegacyShader intermediateShader{ desc };
-    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
-    {
-        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
-            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
-    }
+    /* Program binaries are cached with the patched source or the SPIR-V module as key */
+    if (persistentCache != nullptr)
+        BuildSeparableGLProgramsWithCache(desc, *persistentCache);
+    else
+        BuildSeparableGLPrograms(desc);
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -72,6 +73,12 @@ void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
  * ======= Private: =======
  */
 
+bool GLSeparableShader::QueryStatusAndLog(std::string& log) const
+{
+    log = GLShaderProgram::GetGLProgramLog(GetID());
+    return GLShaderProgram::GetLinkStatus(GetID());
+}
+
 static GLuint CreateSeparableGLProgram()
 {
     if (const GLuint program = glCreateProgram())
@@ -82,12 +89,97 @@ static GLuint CreateSeparableGLProgram()
     return 0;
 }
 
-bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
+void GLSeparableShader::BuildSeparableGLPrograms(const ShaderDescriptor& desc, GLPipelineCache* pipelineCache)
+{
+    GLLegacyShader intermediateShader{ desc };
+    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault, pipelineCache))
+    {
+        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
+            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition, pipelineCache);
+    }
+
+    /* Inherit content hash of patched source from intermediate shader if it was not hashed before */
+    if (pipelineCache == nullptr)
+    {
+        const std::uint64_t sourceHash = intermediateShader.GetContentHash();
+        AppendContentHash(&sourceHash, sizeof(sourceHash));
+    }
+}
+
+void GLSeparableShader::BuildSeparableGLProgramsWithCache(const ShaderDescriptor& desc, PersistentPipelineCache& persistentCache)
+{
+    /* Hash patched source of all permutations or the SPIR-V module without compiling them; SPIR-V modules cannot be patched, so they only have the default permutation */
+    const bool hasFlippedYPosition = (IsShaderSourceCode(desc.sourceType) && GLShader::NeedsPermutationFlippedYPosition(desc.type, desc.flags));
+    if (IsShaderSourceCode(desc.sourceType))
+    {
+        auto sourceCallback = [this](const char* source)
+        {
+            AppendContentHash(source, ::strlen(source));
+        };
+
+        GLShader::PatchShaderSourcePermutation(sourceCallback, desc, PermutationDefault);
+        if (hasFlippedYPosition)
+            GLShader::PatchShaderSourcePermutation(sourceCallback, desc, PermutationFlippedYPosition);
+    }
+    else
+    {
+        auto binaryCallback = [this](const void* binary, std::size_t binarySize, const char* entryPoint)
+        {
+            AppendContentHash(binary, binarySize);
+            AppendContentHash(entryPoint, ::strlen(entryPoint));
+        };
+        GLShader::ReadShaderBinary(binaryCallback, desc);
+    }
+
+    /* Salt key to distinguish separable shader programs from combined programs of PSOs */
+    PersistentPipelineCacheKey key;
+    key.AppendString("GLSeparableShader");
+    key.Append(GetContentHash());
+
+    /* Try to load all permutations from the cached program binaries; the driver may reject them after an update */
+    GLPipelineCache transientCache{ persistentCache.Find(key.Get()) };
+
+    if (LoadSeparableGLProgram(transientCache, PermutationDefault) &&
+        (!hasFlippedYPosition || LoadSeparableGLProgram(transientCache, PermutationFlippedYPosition)))
+    {
+        ReportStatusAndLog(true, GLShaderProgram::GetGLProgramLog(GetID()));
+        return;
+    }
+
+    /* Discard partially loaded programs, then compile and link from source and store the new program binaries */
+    if (GetID(PermutationFlippedYPosition) != GetID())
+        glDeleteProgram(GetID(PermutationFlippedYPosition));
+    glDeleteProgram(GetID());
+    SetID(0, PermutationFlippedYPosition);
+    SetID(0, PermutationDefault);
+
+    BuildSeparableGLPrograms(desc, &transientCache);
+    persistentCache.Store(key.Get(), transientCache.GetBlob());
+}
+
+bool GLSeparableShader::LoadSeparableGLProgram(GLPipelineCache& pipelineCache, Permutation permutation)
+{
+    if (!pipelineCache.HasProgramBinary(permutation))
+        return false;
+
+    /* Create new separable GL program for current permutation and load binary */
+    const GLuint program = CreateSeparableGLProgram();
+    SetID(program, permutation);
+    return pipelineCache.ProgramBinary(permutation, program);
+}
+
+bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation, GLPipelineCache* pipelineCache)
 {
     /* Create new separable GL program for current permutation */
     const GLuint program = CreateSeparableGLProgram();
     SetID(program, permutation);
 
+    #ifdef GL_ARB_get_program_binary
+    /* Hint the driver to keep the program binary retrievable for the pipeline cache */
+    if (pipelineCache != nullptr)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    #endif
+
     /* Compile and attach intermediate GL shader object */
     const GLuint shader = intermediateShader.GetID(permutation);
     glAttachShader(program, shader);
@@ -118,10 +210,21 @@ bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermed
     /* Detach intermediate shader before it gets deleted */
     glDetachShader(program, shader);
 
+    /* Let the driver link in the background and query the status when the report is requested; program binaries require the linked program */
+    if (pipelineCache == nullptr && GLShader::HasParallelShaderCompile())
+    {
+        DeferStatusAndLog();
+        return true;
+    }
+
     /* Query link status and log */
     const bool status = GLShaderProgram::GetLinkStatus(program);
     ReportStatusAndLog(status, GLShaderProgram::GetGLProgramLog(program));
 
+    /* Retrieve program binary to store it in the pipeline cache */
+    if (status && pipelineCache != nullptr)
+        pipelineCache->GetProgramBinary(permutation, program);
+
     return status;
 }
 
@@ -19,6 +19,8 @@ namespace LLGL
 
 class GLLegacyShader;
 class GLShaderBindingLayout;
+class GLPipelineCache;
+class PersistentPipelineCache;
 
 // Shader implementation for separable GL shader programs; requires GL_ARB_separate_shader_objects extension.
 class GLSeparableShader final : public GLShader
@@ -31,7 +33,7 @@ class GLSeparableShader final : public GLShader
 
     public:
 
-        GLSeparableShader(const ShaderDescriptor& desc);
+        GLSeparableShader(const ShaderDescriptor& desc, PersistentPipelineCache* persistentCache = nullptr);
         ~GLSeparableShader();
 
         // Binds the resource names to their respective binding slots for this separable shader. Also implemented in GLShaderProgram.
@@ -42,7 +44,12 @@ class GLSeparableShader final : public GLShader
 
     private:
 
-        bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
+        bool QueryStatusAndLog(std::string& log) const override;
+
+        void BuildSeparableGLPrograms(const ShaderDescriptor& desc, GLPipelineCache* pipelineCache = nullptr);
+        void BuildSeparableGLProgramsWithCache(const ShaderDescriptor& desc, PersistentPipelineCache& persistentCache);
+        bool LoadSeparableGLProgram(GLPipelineCache& pipelineCache, Permutation permutation);
+        bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation, GLPipelineCache* pipelineCache);
 
     private:
 
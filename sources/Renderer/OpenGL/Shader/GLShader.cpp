@@ -32,10 +32,19 @@ GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
     BuildVertexInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
     BuildTransformFeedbackVaryings(desc.vertex.outputAttribs.size(), desc.vertex.outputAttribs.data());
     BuildFragmentOutputLayout(desc.fragment.outputAttribs.size(), desc.fragment.outputAttribs.data());
+    BuildContentHash();
 }
 
 const Report* GLShader::GetReport() const
 {
+    /* Query deferred status only when it is needed, since it waits for the driver to finish compiling or linking */
+    if (isReportPending_)
+    {
+        std::string log;
+        const bool status = QueryStatusAndLog(log);
+        ResetReportWithNewline(report_, log.c_str(), !status);
+        isReportPending_ = false;
+    }
     return (report_ ? &report_ : nullptr);
 }
 
@@ -112,6 +121,41 @@ bool GLShader::HasAnyShaderPermutation(Permutation permutation, const ArrayView<
     return false;
 }
 
+bool GLShader::HasParallelShaderCompile()
+{
+    #ifdef GL_KHR_parallel_shader_compile
+    return HasExtension(GLExt::KHR_parallel_shader_compile);
+    #else
+    return false;
+    #endif
+}
+
+static int g_defaultUniformBufferSlot = -1;
+
+void GLShader::SetDefaultUniformBufferSlot(int slot)
+{
+    g_defaultUniformBufferSlot = slot;
+}
+
+int GLShader::GetDefaultUniformBufferSlot()
+{
+    return g_defaultUniformBufferSlot;
+}
+
+const char* GLShader::GetDefaultUniformBlockName(const ShaderType shaderType)
+{
+    switch (shaderType)
+    {
+        case ShaderType::Vertex:            return "LLGL_VertexUniforms";
+        case ShaderType::TessControl:       return "LLGL_TessControlUniforms";
+        case ShaderType::TessEvaluation:    return "LLGL_TessEvaluationUniforms";
+        case ShaderType::Geometry:          return "LLGL_GeometryUniforms";
+        case ShaderType::Fragment:          return "LLGL_FragmentUniforms";
+        case ShaderType::Compute:           return "LLGL_ComputeUniforms";
+        default:                            return nullptr;
+    }
+}
+
 void GLShader::PatchShaderSource(
     const ShaderSourceCallback& sourceCallback,
     const char*                 shaderSource,
@@ -128,6 +172,11 @@ void GLShader::PatchShaderSource(
     /* Add '#pragma optimize(off)'-directive to source if optimization is disabled */
     const bool pragmaOptimizeOff = ((shaderFlags & ShaderCompileFlags::NoOptimization) != 0);
 
+    /* Move default uniforms into a uniform block, unless this is a separable shader that is linked into its own program */
+    const char* uniformBlockName = nullptr;
+    if (GLShader::GetDefaultUniformBufferSlot() >= 0 && (shaderDesc.flags & ShaderCompileFlags::SeparateShader) == 0)
+        uniformBlockName = GLShader::GetDefaultUniformBlockName(shaderDesc.type);
+
     /* Get source code */
     GLShader::PatchShaderSourceWithOptions(
         /*sourceCallback:*/         sourceCallback,
@@ -135,29 +184,76 @@ void GLShader::PatchShaderSource(
         /*defines:*/                shaderDesc.defines,
         /*pragmaOptimizeOff:*/      pragmaOptimizeOff,
         /*vertexTransformStmt:*/    vertexTransformStmt,
-        /*versionOverride:*/        shaderDesc.profile
+        /*versionOverride:*/        shaderDesc.profile,
+        /*uniformBlockName:*/       uniformBlockName
     );
 }
 
+void GLShader::PatchShaderSourcePermutation(
+    const ShaderSourceCallback& sourceCallback,
+    const ShaderDescriptor&     shaderDesc,
+    Permutation                 permutation)
+{
+    /* Only the permutation for flipped Y-position patches the clipping origin */
+    long enabledFlags = ShaderCompileFlags::NoOptimization;
+    if (permutation == PermutationFlippedYPosition)
+        enabledFlags |= ShaderCompileFlags::PatchClippingOrigin;
+
+    if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
+    {
+        const std::string fileContent = ReadFileString(shaderDesc.source);
+        GLShader::PatchShaderSource(sourceCallback, fileContent.c_str(), shaderDesc, enabledFlags);
+    }
+    else
+        GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
+}
+
+void GLShader::ReadShaderBinary(const ShaderBinaryCallback& binaryCallback, const ShaderDescriptor& shaderDesc)
+{
+    /* Specialize for the default "main" function in a SPIR-V module unless another entry point is specified */
+    const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
+
+    if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
+    {
+        /* Load binary from file */
+        const std::vector<char> fileContent = ReadFileBuffer(shaderDesc.source);
+        binaryCallback(fileContent.data(), fileContent.size(), entryPoint);
+    }
+    else
+    {
+        /* Load binary from buffer */
+        binaryCallback(shaderDesc.source, shaderDesc.sourceSize, entryPoint);
+    }
+}
+
 void GLShader::PatchShaderSourceWithOptions(
     const ShaderSourceCallback& sourceCallback,
     const char*                 source,
     const ShaderMacro*          defines,
     bool                        pragmaOptimizeOff,
     const char*                 vertexTransformStmt,
-    const char*                 versionOverride)
+    const char*                 versionOverride,
+    const char*                 uniformBlockName)
 {
     if (sourceCallback)
     {
         const bool hasDefines           = (defines != nullptr && defines->name != nullptr);
         const bool hasVertexStmt        = (vertexTransformStmt != nullptr);
         const bool hasVersionOverride   = (versionOverride != nullptr && *versionOverride != '\0');
-        if (hasDefines || pragmaOptimizeOff || hasVertexStmt || hasVersionOverride)
+        const bool hasUniformBlock      = (uniformBlockName != nullptr);
+        if (hasDefines || pragmaOptimizeOff || hasVertexStmt || hasVersionOverride || hasUniformBlock)
         {
             GLShaderSourcePatcher patcher{ source };
             if (hasVersionOverride)
                 patcher.OverrideVersion(versionOverride);
             patcher.AddDefines(defines);
+            if (hasUniformBlock)
+            {
+                /* Derive instance name from block name, e.g. "LLGL_VertexUniforms" turns into "llgl_VertexUniforms" */
+                std::string instanceName = uniformBlockName;
+                instanceName.replace(0, 4, "llgl");
+                patcher.ConvertDefaultUniformsToBlock(uniformBlockName, instanceName.c_str());
+            }
             if (pragmaOptimizeOff)
                 patcher.AddPragmaDirective("optimize(off)");
             patcher.AddFinalVertexTransformStatements(vertexTransformStmt);
@@ -171,6 +267,7 @@ void GLShader::PatchShaderSourceWithOptions(
 void GLShader::ReportStatusAndLog(bool status, const std::string& log)
 {
     ResetReportWithNewline(report_, log.c_str(), !status);
+    isReportPending_ = false;
 }
 
 
@@ -270,6 +367,20 @@ void GLShader::BuildTransformFeedbackVaryings(std::size_t numVaryings, const Ver
 }
 
 
+void GLShader::BuildContentHash()
+{
+    /* Hash shader type and attribute layout; shader source or binary is appended by the sub class */
+    contentHash_.Append(GetType());
+    contentHash_.Append(numVertexAttribs_);
+    for (const GLShaderAttribute& attrib : shaderAttribs_)
+    {
+        contentHash_.Append(attrib.index);
+        contentHash_.AppendString(attrib.name);
+    }
+    for (const char* varying : transformFeedbackVaryings_)
+        contentHash_.AppendString(varying);
+}
+
 } // /namespace LLGL
 
 
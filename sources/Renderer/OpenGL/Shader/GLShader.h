@@ -13,6 +13,7 @@
 #include <LLGL/Report.h>
 #include "../OpenGL.h"
 #include "../../../Core/LinearStringContainer.h"
+#include "../../PersistentPipelineCache.h"
 #include <functional>
 
 
@@ -29,6 +30,9 @@ struct GLShaderAttribute
 // Callback interface for shader source patching.
 using ShaderSourceCallback = std::function<void(const char* source)>;
 
+// Callback interface for shader binaries, i.e. a SPIR-V module and the entry point to specialize.
+using ShaderBinaryCallback = std::function<void(const void* binary, std::size_t binarySize, const char* entryPoint)>;
+
 class GLShader : public Shader
 {
 
@@ -83,6 +87,12 @@ class GLShader : public Shader
             return isSeparable_;
         }
 
+        // Returns a hash of the shader type, attributes, and final shader source or binary. This is the same across application runs.
+        inline std::uint64_t GetContentHash() const
+        {
+            return contentHash_.Get();
+        }
+
     public:
 
         // Returns true if the specified shader descriptor requires the permutation with flipped Y-position; See PermutationFlippedYPosition.
@@ -91,6 +101,21 @@ class GLShader : public Shader
         // Returns true if any of the specified shaders has the specified permutation.
         static bool HasAnyShaderPermutation(Permutation permutation, const ArrayView<Shader*>& shaders);
 
+        /*
+        Returns true if the driver compiles and links shaders in parallel (GL_KHR_parallel_shader_compile).
+        In this case, compile and link status must only be queried lazily, since querying them waits for the driver to finish.
+        */
+        static bool HasParallelShaderCompile();
+
+        // Sets the first binding slot for the uniform blocks that replace the default uniform block, or -1 to disable them. See RendererConfigurationOpenGL::uniformBufferSlot.
+        static void SetDefaultUniformBufferSlot(int slot);
+
+        // Returns the first binding slot for the uniform blocks that replace the default uniform block, or -1 if they are disabled.
+        static int GetDefaultUniformBufferSlot();
+
+        // Returns the name of the uniform block the default uniforms of the specified shader stage are moved into, or null if the shader type has no such block.
+        static const char* GetDefaultUniformBlockName(const ShaderType shaderType);
+
         // Patches the shader source and invokes the callback with the preprocessed shader. See ShaderCompileFlags.
         static void PatchShaderSource(
             const ShaderSourceCallback& sourceCallback,
@@ -99,6 +124,16 @@ class GLShader : public Shader
             long                        enabledFlags
         );
 
+        // Patches the shader source (or source file) of the specified permutation and invokes the callback with the preprocessed shader.
+        static void PatchShaderSourcePermutation(
+            const ShaderSourceCallback& sourceCallback,
+            const ShaderDescriptor&     shaderDesc,
+            Permutation                 permutation
+        );
+
+        // Reads the shader binary (or binary file) and invokes the callback with the binary and its entry point, which is "main" by default.
+        static void ReadShaderBinary(const ShaderBinaryCallback& binaryCallback, const ShaderDescriptor& shaderDesc);
+
         // Patches the shader source with the specified options: macro definitions, pragma directives, additional statements etc.
         static void PatchShaderSourceWithOptions(
             const ShaderSourceCallback& sourceCallback,
@@ -106,7 +141,8 @@ class GLShader : public Shader
             const ShaderMacro*          defines,
             bool                        pragmaOptimizeOff   = false,
             const char*                 vertexTransformStmt = nullptr,
-            const char*                 versionOverride     = nullptr
+            const char*                 versionOverride     = nullptr,
+            const char*                 uniformBlockName    = nullptr
         );
 
     protected:
@@ -116,18 +152,34 @@ class GLShader : public Shader
         // Resets the report with the specified compile/link status and log.
         void ReportStatusAndLog(bool status, const std::string& log);
 
+        // Defers the compile/link status and log until the report is requested. See QueryStatusAndLog.
+        inline void DeferStatusAndLog()
+        {
+            isReportPending_ = true;
+        }
+
+        // Queries the compile/link status and log of the default permutation for a deferred report.
+        virtual bool QueryStatusAndLog(std::string& log) const = 0;
+
         // Stores the native shader ID.
         inline void SetID(GLuint id, Permutation permutation = PermutationDefault)
         {
             id_[permutation] = id;
         }
 
+        // Appends the specified shader source or binary to the content hash.
+        inline void AppendContentHash(const void* data, std::size_t size)
+        {
+            contentHash_.AppendBytes(data, size);
+        }
+
     private:
 
         void ReserveAttribs(const ShaderDescriptor& desc);
         bool BuildVertexInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
         void BuildFragmentOutputLayout(std::size_t numFragmentAttribs, const FragmentAttribute* fragmentAttribs);
         void BuildTransformFeedbackVaryings(std::size_t numVaryings, const VertexAttribute* varyings);
+        void BuildContentHash();
 
     private:
 
@@ -137,7 +189,9 @@ class GLShader : public Shader
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
-        Report                          report_;
+        mutable Report                  report_;
+        mutable bool                    isReportPending_            = false;
+        PersistentPipelineCacheKey      contentHash_;
 
 };
 
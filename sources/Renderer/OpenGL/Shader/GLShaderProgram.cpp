@@ -95,6 +95,10 @@ GLShaderProgram::GLShaderProgram(
     {
         if (!(pipelineCache->HasProgramBinary(permutation) && pipelineCache->ProgramBinary(permutation, GetID())))
         {
+            #ifdef GL_ARB_get_program_binary
+            /* Hint the driver to keep the program binary retrievable for the pipeline cache */
+            glProgramParameteri(GetID(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            #endif
             BuildProgramBinary(numShaders, shaders, permutation);
             pipelineCache->GetProgramBinary(permutation, GetID());
         }
@@ -7,7 +7,9 @@
 
 #include "GLShaderSourcePatcher.h"
 #include <LLGL/ShaderFlags.h>
+#include <vector>
 #include <string.h>
+#include <stdlib.h>
 
 
 namespace LLGL
@@ -19,6 +21,16 @@ static bool IsWhitespace(char c)
     return c == ' ' || c == '\t';
 }
 
+static bool IsNewline(char c)
+{
+    return c == '\n' || c == '\r';
+}
+
+static bool IsIdentifierChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
 static bool ScanToken(const char*& s, char tokenChar)
 {
     if (s[0] == tokenChar)
@@ -68,6 +80,12 @@ static void SkipWhitespaces(const char*& s)
         ++s;
 }
 
+static void SkipWhitespacesAndNewlines(const char*& s)
+{
+    while (IsWhitespace(*s) || IsNewline(*s))
+        ++s;
+}
+
 static bool SkipComment(const char*& s)
 {
     if (ScanToken(s, "//"))
@@ -137,6 +155,33 @@ static std::size_t FindEndOfVersionDirective(const char* source)
     return std::string::npos;
 }
 
+// Returns the number of the '#version'-directive, or 110 if the source has no such directive.
+static int FindVersionNumber(const char* source)
+{
+    const char* s = source;
+    while (*s != '\0')
+    {
+        if (SkipComment(s))
+        {
+            /* Ignore comments */
+            continue;
+        }
+        else if (ScanToken(s, "#"))
+        {
+            /* Scan for "version" token and parse the number after it */
+            SkipWhitespaces(s);
+            if (ScanToken(s, "version"))
+                return ::atoi(s);
+        }
+        else
+        {
+            /* Move to next character */
+            ++s;
+        }
+    }
+    return 110;
+}
+
 GLShaderSourcePatcher::GLShaderSourcePatcher(const char* source) :
     source_ { source }
 {
@@ -325,6 +370,313 @@ void GLShaderSourcePatcher::AddFinalVertexTransformStatements(const char* statem
 }
 
 
+// Scans the identifier at the current source position and returns its length, or 0 if there is no identifier.
+static std::size_t ScanIdentifier(const char*& s)
+{
+    const char* start = s;
+    if (IsIdentifierChar(*s) && !(*s >= '0' && *s <= '9'))
+    {
+        while (IsIdentifierChar(*s))
+            ++s;
+    }
+    return static_cast<std::size_t>(s - start);
+}
+
+static bool IsIdentifierEqual(const char* ident, std::size_t identLen, const char* token)
+{
+    return (::strlen(token) == identLen && ::strncmp(ident, token, identLen) == 0);
+}
+
+static bool IsPrecisionQualifier(const char* ident, std::size_t identLen)
+{
+    return
+    (
+        IsIdentifierEqual(ident, identLen, "lowp")      ||
+        IsIdentifierEqual(ident, identLen, "mediump")   ||
+        IsIdentifierEqual(ident, identLen, "highp")
+    );
+}
+
+// Returns true if the specified identifier denotes a non-opaque type that can be moved into a uniform block.
+static bool IsUniformBlockMemberType(const char* ident, std::size_t identLen)
+{
+    static const char* const memberTypes[] =
+    {
+        "float", "vec2", "vec3", "vec4",
+        "int", "ivec2", "ivec3", "ivec4",
+        "uint", "uvec2", "uvec3", "uvec4",
+        "mat2", "mat3", "mat4",
+        "mat2x2", "mat2x3", "mat2x4",
+        "mat3x2", "mat3x3", "mat3x4",
+        "mat4x2", "mat4x3", "mat4x4",
+    };
+    for (const char* type : memberTypes)
+    {
+        if (IsIdentifierEqual(ident, identLen, type))
+            return true;
+    }
+    return false;
+}
+
+// Returns true if the token at the specified source position is the first one in its statement, i.e. it's only preceded by whitespaces on its line or by ';' or '}'.
+static bool IsStartOfStatement(const char* source, const char* s)
+{
+    while (s > source)
+    {
+        const char c = *(--s);
+        if (IsNewline(c) || c == ';' || c == '}')
+            return true;
+        if (!IsWhitespace(c))
+            return false;
+    }
+    return true;
+}
+
+// Returns true if the token at the specified source position is preceded by the member access operator '.'.
+static bool IsMemberAccess(const char* source, const char* s)
+{
+    while (s > source)
+    {
+        const char c = *(--s);
+        if (c == '.')
+            return true;
+        if (!IsWhitespace(c) && !IsNewline(c))
+            return false;
+    }
+    return false;
+}
+
+static void SkipDirective(const char*& s)
+{
+    /* Skip until end of line that is not continued with a backslash */
+    for (char prev = '\0'; *s != '\0'; prev = *s++)
+    {
+        if (*s == '\n' && prev != '\\')
+            break;
+    }
+}
+
+// Source location of a default uniform declaration that can be moved into a uniform block, e.g. "uniform highp vec4 colors[2];".
+struct GLSLUniformDeclaration
+{
+    std::size_t begin       = 0; // Position of the 'uniform' keyword
+    std::size_t memberBegin = 0; // Position of the precision qualifier or type
+    std::size_t end         = 0; // Position after the ';' token
+    std::string name;
+};
+
+// Scans the remainder of a uniform declaration after the 'uniform' keyword. Returns false if this declaration cannot be moved into a uniform block.
+static bool ScanUniformBlockMemberDeclaration(const char* source, const char*& s, GLSLUniformDeclaration& outDecl)
+{
+    /* Scan optional precision qualifier and type */
+    SkipWhitespacesAndNewlines(s);
+    outDecl.memberBegin = static_cast<std::size_t>(s - source);
+
+    const char* ident = s;
+    std::size_t identLen = ScanIdentifier(s);
+    if (IsPrecisionQualifier(ident, identLen))
+    {
+        SkipWhitespacesAndNewlines(s);
+        ident = s;
+        identLen = ScanIdentifier(s);
+    }
+    if (!IsUniformBlockMemberType(ident, identLen))
+        return false;
+
+    /* Scan uniform name */
+    SkipWhitespacesAndNewlines(s);
+    const char* name = s;
+    const std::size_t nameLen = ScanIdentifier(s);
+    if (nameLen == 0)
+        return false;
+    outDecl.name.assign(name, nameLen);
+
+    /* Scan optional array dimension */
+    SkipWhitespacesAndNewlines(s);
+    if (ScanToken(s, '['))
+    {
+        SkipUntilToken(s, ']');
+        SkipWhitespacesAndNewlines(s);
+    }
+
+    /* Declaration must end here, i.e. initializers and multiple declarators are not supported */
+    if (!ScanToken(s, ';'))
+        return false;
+
+    outDecl.end = static_cast<std::size_t>(s - source);
+    return true;
+}
+
+// Appends the source range [begin, end) and qualifies all identifiers that match one of the specified names with 'qualifier'.
+static void AppendWithQualifiedIdentifiers(
+    std::string&                                dst,
+    const char*                                 source,
+    const char*                                 begin,
+    const char*                                 end,
+    const std::vector<GLSLUniformDeclaration>&  decls,
+    const char*                                 qualifier)
+{
+    const char* lastAppended = begin;
+    for (const char* s = begin; s < end;)
+    {
+        if (SkipComment(s))
+        {
+            /* Ignore comments */
+            continue;
+        }
+        else if (IsIdentifierChar(*s))
+        {
+            /* Scan entire token, which might also be a number literal */
+            const char* ident = s;
+            while (s < end && IsIdentifierChar(*s))
+                ++s;
+
+            const std::size_t identLen = static_cast<std::size_t>(s - ident);
+            if (!IsMemberAccess(source, ident))
+            {
+                for (const GLSLUniformDeclaration& decl : decls)
+                {
+                    if (IsIdentifierEqual(ident, identLen, decl.name.c_str()))
+                    {
+                        dst.append(lastAppended, ident);
+                        dst += qualifier;
+                        dst += '.';
+                        lastAppended = ident;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            /* Move to next character */
+            ++s;
+        }
+    }
+    dst.append(lastAppended, end);
+}
+
+// Appends only the newline characters of the source range [begin, end) to keep the line numbers of the remaining source.
+static void AppendNewlines(std::string& dst, const char* begin, const char* end)
+{
+    for (; begin != end; ++begin)
+    {
+        if (*begin == '\n')
+            dst += '\n';
+    }
+}
+
+bool GLShaderSourcePatcher::ConvertDefaultUniformsToBlock(const char* blockName, const char* instanceName)
+{
+    /* Uniform blocks require GLSL 140; GLSL ES 100 is the only lower version number that includes ES */
+    const char* source = GetSource();
+    if (FindVersionNumber(source) < 140)
+        return false;
+
+    /* Find all top-level uniform declarations after the '#version'-directive and any previously inserted statement */
+    std::vector<GLSLUniformDeclaration> decls;
+    std::size_t codeBlockDepth      = 0;
+    int         conditionalDepth    = 0;
+
+    for (const char* s = source + statementInsertPos_; *s != '\0';)
+    {
+        if (SkipComment(s))
+        {
+            /* Ignore comments */
+            continue;
+        }
+        else if (ScanToken(s, '#'))
+        {
+            /* Record stepping into and out of conditionals, i.e. '#if', '#ifdef', '#ifndef', and '#endif' */
+            SkipWhitespaces(s);
+            if (ScanToken(s, "if"))
+                conditionalDepth++;
+            else if (ScanToken(s, "endif"))
+                conditionalDepth--;
+            SkipDirective(s);
+        }
+        else if (ScanToken(s, '{'))
+        {
+            /* Record stepping into a code block */
+            codeBlockDepth++;
+        }
+        else if (ScanToken(s, '}'))
+        {
+            /* Record stepping out of a code block */
+            if (codeBlockDepth > 0)
+                codeBlockDepth--;
+        }
+        else if (IsIdentifierChar(*s))
+        {
+            /* Scan entire token and check if it starts a top-level uniform declaration */
+            const char* ident = s;
+            while (IsIdentifierChar(*s))
+                ++s;
+
+            const std::size_t identLen = static_cast<std::size_t>(s - ident);
+            if (codeBlockDepth == 0 && IsIdentifierEqual(ident, identLen, "uniform") && IsStartOfStatement(source, ident))
+            {
+                GLSLUniformDeclaration decl;
+                decl.begin = static_cast<std::size_t>(ident - source);
+                if (ScanUniformBlockMemberDeclaration(source, s, decl))
+                {
+                    /* Leave source unmodified if declarations depend on preprocessor conditionals */
+                    if (conditionalDepth > 0)
+                        return false;
+                    decls.push_back(std::move(decl));
+                }
+            }
+        }
+        else
+        {
+            /* Move to next character */
+            ++s;
+        }
+    }
+
+    if (decls.empty())
+        return false;
+
+    /* Generate uniform block on a single line, so the line numbers of the remaining source remain the same */
+    std::string blockDecl = "layout(std140) uniform ";
+    blockDecl += blockName;
+    blockDecl += " { ";
+    for (const GLSLUniformDeclaration& decl : decls)
+    {
+        /* Append member declaration without newlines */
+        for (std::size_t pos = decl.memberBegin; pos < decl.end; ++pos)
+            blockDecl += (IsNewline(source[pos]) ? ' ' : source[pos]);
+        blockDecl += ' ';
+    }
+    blockDecl += "} ";
+    blockDecl += instanceName;
+    blockDecl += ';';
+
+    /* Replace first declaration with uniform block, remove all other declarations, and qualify all references to the moved uniforms */
+    std::string patched;
+    patched.reserve(source_.size() + blockDecl.size());
+    patched.append(source, statementInsertPos_);
+
+    const char* lastDeclEnd = source + statementInsertPos_;
+    for (std::size_t i = 0; i < decls.size(); ++i)
+    {
+        const GLSLUniformDeclaration& decl = decls[i];
+        AppendWithQualifiedIdentifiers(patched, source, lastDeclEnd, source + decl.begin, decls, instanceName);
+        if (i == 0)
+            patched += blockDecl;
+        AppendNewlines(patched, source + decl.begin, source + decl.end);
+        lastDeclEnd = source + decl.end;
+    }
+    AppendWithQualifiedIdentifiers(patched, source, lastDeclEnd, source + source_.size(), decls, instanceName);
+
+    /* Replace source with patched source; the entry point must be searched again */
+    source_ = std::move(patched);
+    entryPointStartPos_ = std::string::npos;
+
+    return true;
+}
+
+
 /*
  * ======= Private: =======
  */
@@ -41,6 +41,13 @@ class GLShaderSourcePatcher
         //       i.e. no preprocessing is performed prior to scanning the source.
         void AddFinalVertexTransformStatements(const char* statement);
 
+        // Moves all top-level uniforms of a non-opaque type (e.g. "uniform mat4 wvpMatrix;") from the default uniform block into a std140 uniform block with the specified block and instance name.
+        // All references to these uniforms are qualified with the instance name, e.g. "wvpMatrix" turns into "llgl_VertexUniforms.wvpMatrix". Returns false if no uniforms have been moved.
+        // If any of these uniforms is declared inside a preprocessor conditional, the source is not modified. This requires GLSL 140 or GLSL ES 300.
+        // NOTE: This patcher cannot distinguish between a uniform and a local variable or struct member of the same name,
+        //       i.e. no preprocessing or semantic analysis is performed prior to scanning the source.
+        bool ConvertDefaultUniformsToBlock(const char* blockName, const char* instanceName);
+
     public:
 
         // Returns the current shader source as null terminated string.
@@ -12,6 +12,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../RenderState/GLStateManager.h"
+#include "../../../Core/Exception.h"
 
 
 namespace LLGL
@@ -73,7 +74,17 @@ GLFramebuffer& GLFramebuffer::operator = (GLFramebuffer&& rhs) noexcept
 void GLFramebuffer::GenFramebuffer()
 {
     DeleteFramebuffer();
-    glGenFramebuffers(1, &id_);
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Create new FBO directly, so it can be used with DSA functions without binding it first */
+        glCreateFramebuffers(1, &id_);
+    }
+    else
+    #endif
+    {
+        glGenFramebuffers(1, &id_);
+    }
 }
 
 void GLFramebuffer::DeleteFramebuffer()
@@ -96,6 +107,17 @@ bool GLFramebuffer::FramebufferParameters(
     #ifdef GL_ARB_framebuffer_no_attachments
     if (HasExtension(GLExt::ARB_framebuffer_no_attachments))
     {
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_LAYERS, layers);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_SAMPLES, samples);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS, fixedSampleLocations);
+            return true;
+        }
+        #endif // /GL_ARB_direct_state_access
         GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::Framebuffer, GetID());
         glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
         glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
@@ -113,9 +135,47 @@ void GLFramebuffer::AttachTexture(
     GLenum              attachment,
     GLint               mipLevel,
     GLint               arrayLayer,
-    GLenum              target)
+    GLenum              target,
+    GLuint              framebufferID)
 {
     GLuint texID = texture.GetID();
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (framebufferID != 0 && HasExtension(GLExt::ARB_direct_state_access))
+    {
+        if (texture.IsRenderbuffer())
+        {
+            /* Attach renderbuffer to named FBO */
+            glNamedFramebufferRenderbuffer(framebufferID, attachment, GL_RENDERBUFFER, texID);
+        }
+        else
+        {
+            /* Attach texture to named FBO; cube faces are addressed as array layers with DSA */
+            switch (texture.GetType())
+            {
+                case TextureType::Texture1D:
+                case TextureType::Texture2D:
+                    glNamedFramebufferTexture(framebufferID, attachment, texID, mipLevel);
+                    break;
+                case TextureType::Texture3D:
+                case TextureType::TextureCube:
+                case TextureType::Texture1DArray:
+                case TextureType::Texture2DArray:
+                case TextureType::TextureCubeArray:
+                    glNamedFramebufferTextureLayer(framebufferID, attachment, texID, mipLevel, arrayLayer);
+                    break;
+                case TextureType::Texture2DMS:
+                    glNamedFramebufferTexture(framebufferID, attachment, texID, 0);
+                    break;
+                case TextureType::Texture2DMSArray:
+                    glNamedFramebufferTextureLayer(framebufferID, attachment, texID, 0, arrayLayer);
+                    break;
+            }
+        }
+        return;
+    }
+    #endif // /GL_ARB_direct_state_access
+
     if (texture.IsRenderbuffer())
     {
         /* Attach renderbuffer to FBO */
@@ -153,9 +213,36 @@ void GLFramebuffer::AttachTexture(
     }
 }
 
-void GLFramebuffer::AttachRenderbuffer(GLenum attachment, GLuint renderbufferID)
+void GLFramebuffer::AttachTextureMultiview(
+    const GLTexture&    texture,
+    GLenum              attachment,
+    GLint               mipLevel,
+    GLint               baseViewIndex,
+    GLsizei             numViews,
+    GLuint              framebufferID)
 {
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbufferID);
+    #ifdef LLGL_GLEXT_MULTIVIEW
+    if (framebufferID != 0)
+        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebufferID);
+    glFramebufferTextureMultiviewOVR(GL_DRAW_FRAMEBUFFER, attachment, texture.GetID(), mipLevel, baseViewIndex, numViews);
+    #else
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_OVR_multiview");
+    #endif // /LLGL_GLEXT_MULTIVIEW
+}
+
+void GLFramebuffer::AttachRenderbuffer(GLenum attachment, GLuint renderbufferID, GLuint framebufferID)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (framebufferID != 0 && HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Attach renderbuffer to named FBO */
+        glNamedFramebufferRenderbuffer(framebufferID, attachment, GL_RENDERBUFFER, renderbufferID);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbufferID);
+    }
 }
 
 void GLFramebuffer::Blit(GLint width, GLint height, GLenum mask)
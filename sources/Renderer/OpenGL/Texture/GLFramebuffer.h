@@ -77,15 +77,31 @@ class GLFramebuffer
 
     public:
 
+        // Attaches the texture to the FBO that is currently bound to 'target', or directly to the named FBO 'framebufferID' if non-zero and DSA is supported.
         static void AttachTexture(
             const GLTexture&    texture,
             GLenum              attachment,
             GLint               mipLevel,
             GLint               arrayLayer,
-            GLenum              target = GL_FRAMEBUFFER
+            GLenum              target          = GL_FRAMEBUFFER,
+            GLuint              framebufferID   = 0
         );
 
-        static void AttachRenderbuffer(GLenum attachment, GLuint renderbufferID);
+        /*
+        Attaches the consecutive array layers [baseViewIndex, baseViewIndex + numViews) of the 2D array texture as multiview attachment (GL_OVR_multiview).
+        There is no DSA variant for this function, so the named FBO 'framebufferID' is bound to GL_DRAW_FRAMEBUFFER if non-zero.
+        */
+        static void AttachTextureMultiview(
+            const GLTexture&    texture,
+            GLenum              attachment,
+            GLint               mipLevel,
+            GLint               baseViewIndex,
+            GLsizei             numViews,
+            GLuint              framebufferID   = 0
+        );
+
+        // Attaches the renderbuffer to the currently bound FBO, or directly to the named FBO 'framebufferID' if non-zero and DSA is supported.
+        static void AttachRenderbuffer(GLenum attachment, GLuint renderbufferID, GLuint framebufferID = 0);
 
         static void Blit(GLint width, GLint height, GLenum mask);
 
@@ -43,6 +43,19 @@ void GLIntermediateTexture::ReleaseTexture()
     }
 }
 
+bool GLIntermediateTexture::InvalidateStorage(GLenum internalFormat, GLsizei width, GLsizei height)
+{
+    if (texID != 0 && this->internalFormat == internalFormat && this->width == width && this->height == height)
+        return false;
+
+    /* Immutable storage cannot be resized, so the texture must be recreated */
+    ReleaseTexture();
+    this->internalFormat    = internalFormat;
+    this->width             = width;
+    this->height            = height;
+    return true;
+}
+
 
 /*
  * GLFramebufferCapture class
@@ -56,7 +69,7 @@ GLFramebufferCapture& GLFramebufferCapture::Get()
 
 void GLFramebufferCapture::Clear()
 {
-    blitTextureFBOPair_.ReleaseFBOs();
+    intermediateFBO_.DeleteFramebuffer();
     intermediateTex_.ReleaseTexture();
 }
 
@@ -90,19 +103,36 @@ void GLFramebufferCapture::CaptureFramebuffer(
     const GLint             screenPosX      = srcOffset.x;
     const GLint             screenPosY      = stateMngr.GetFramebufferHeight() - height - srcOffset.y;
 
-    /* Create intermediate texture and FBOs */
+    /* Create intermediate texture and FBO; immutable storage is only reallocated when the format or extent changes */
+    const GLenum internalFormat = textureGL.GetGLInternalFormat();
+
+    #ifdef LLGL_GLEXT_TEXTURE_STORAGE
+    const bool allocStorage = (HasExtension(GLExt::ARB_texture_storage) && intermediateTex_.InvalidateStorage(internalFormat, width, height));
+    #endif
+
     intermediateTex_.CreateTexture();
-    blitTextureFBOPair_.CreateFBOs();
+    if (!intermediateFBO_)
+        intermediateFBO_.GenFramebuffer();
 
     /* Copy framebuffer into intermediate texture */
     stateMngr.PushBoundTexture(target);
     {
         stateMngr.BindTexture(target, intermediateTex_.texID);
 
-        if (isDepthStencil)
-            glTexImage2D(targetGL, 0, textureGL.GetGLInternalFormat(), width, height, 0, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, nullptr);
+        #ifdef LLGL_GLEXT_TEXTURE_STORAGE
+        if (HasExtension(GLExt::ARB_texture_storage))
+        {
+            if (allocStorage)
+                glTexStorage2D(targetGL, 1, internalFormat, width, height);
+        }
         else
-            glTexImage2D(targetGL, 0, textureGL.GetGLInternalFormat(), width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        #endif
+        {
+            if (isDepthStencil)
+                glTexImage2D(targetGL, 0, internalFormat, width, height, 0, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, nullptr);
+            else
+                glTexImage2D(targetGL, 0, internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
 
         glCopyTexSubImage2D(targetGL, 0, 0, 0, screenPosX, screenPosY, width, height);
     }
@@ -112,12 +142,11 @@ void GLFramebufferCapture::CaptureFramebuffer(
     stateMngr.PushBoundFramebuffer(GLFramebufferTarget::ReadFramebuffer);
     stateMngr.PushBoundFramebuffer(GLFramebufferTarget::DrawFramebuffer);
     {
-        /* Bind read framebuffer for intermediate texture and draw framebuffer for destination texture */
-        stateMngr.BindFramebuffer(GLFramebufferTarget::ReadFramebuffer, blitTextureFBOPair_.fbos[0]);
-        stateMngr.BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, blitTextureFBOPair_.fbos[1]);
-
+        /* Bind read framebuffer for intermediate texture and cached draw framebuffer for destination texture */
+        stateMngr.BindFramebuffer(GLFramebufferTarget::ReadFramebuffer, intermediateFBO_.GetID());
         GLProfile::FramebufferTexture2D(GL_READ_FRAMEBUFFER, attachment, targetGL, intermediateTex_.texID, 0);
-        GLFramebuffer::AttachTexture(textureGL, attachment, dstLevel, dstOffset.z, GL_DRAW_FRAMEBUFFER);
+
+        stateMngr.BindFramebufferWithTexture(GLFramebufferTarget::DrawFramebuffer, textureGL, dstLevel, dstOffset.z);
 
         BlitFramebufferNearestFlippedYAxis(dstOffset.x, dstOffset.y, width, height, bitmask);
     }
@@ -29,7 +29,13 @@ struct GLIntermediateTexture
     void CreateTexture();
     void ReleaseTexture();
 
-    GLuint texID = 0;
+    // Releases the texture if its immutable storage does not match the specified format and extent. Returns true if new storage must be allocated.
+    bool InvalidateStorage(GLenum internalFormat, GLsizei width, GLsizei height);
+
+    GLuint  texID           = 0;
+    GLenum  internalFormat  = 0;
+    GLsizei width           = 0;
+    GLsizei height          = 0;
 };
 
 class GLFramebufferCapture
@@ -68,7 +74,7 @@ class GLFramebufferCapture
     private:
 
         GLIntermediateTexture   intermediateTex_;
-        GLFramebufferPair       blitTextureFBOPair_;
+        GLFramebuffer           intermediateFBO_;
 
 };
 
@@ -14,6 +14,8 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -89,6 +91,50 @@ void GLMipGenerator::GenerateMipsRangeForTexture(
     }
 }
 
+void GLMipGenerator::GenerateMipsForTextures(GLStateManager& stateMngr, std::uint32_t numTextures, Texture* const * textures)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Generate MIP-maps of named texture objects without any binding */
+        for_range(i, numTextures)
+            glGenerateTextureMipmap(LLGL_CAST(GLTexture*, textures[i])->GetID());
+        return;
+    }
+    #endif
+
+    /* Sort textures by type, so each texture target is only stored and restored once */
+    SmallVector<GLTexture*, 16> texturesGL;
+    texturesGL.reserve(numTextures);
+    for_range(i, numTextures)
+        texturesGL.push_back(LLGL_CAST(GLTexture*, textures[i]));
+
+    std::stable_sort(
+        texturesGL.begin(),
+        texturesGL.end(),
+        [](const GLTexture* lhs, const GLTexture* rhs) -> bool
+        {
+            return (lhs->GetType() < rhs->GetType());
+        }
+    );
+
+    for (auto it = texturesGL.begin(); it != texturesGL.end();)
+    {
+        /* Restore previously bound texture on active layer after all textures of the same type */
+        const TextureType texType = (*it)->GetType();
+        const GLTextureTarget texTarget = GLStateManager::GetTextureTarget(texType);
+        stateMngr.PushBoundTexture(texTarget);
+        {
+            for (; it != texturesGL.end() && (*it)->GetType() == texType; ++it)
+            {
+                stateMngr.BindTexture(texTarget, (*it)->GetID());
+                glGenerateMipmap(GLTypes::Map(texType));
+            }
+        }
+        stateMngr.PopBoundTexture();
+    }
+}
+
 
 /*
  * ======= Private: =======
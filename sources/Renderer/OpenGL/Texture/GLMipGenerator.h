@@ -19,6 +19,7 @@ namespace LLGL
 {
 
 
+class Texture;
 class GLTexture;
 class GLStateManager;
 
@@ -57,6 +58,9 @@ class GLMipGenerator
             std::uint32_t   numArrayLayers = 1
         );
 
+        // Generates the entire MIP-map chain for each texture in the specified array. Textures are grouped by type to bind each texture target only once.
+        void GenerateMipsForTextures(GLStateManager& stateMngr, std::uint32_t numTextures, Texture* const * textures);
+
     private:
 
         GLMipGenerator() = default;
@@ -8,7 +8,6 @@
 #include "GLReadTextureFBO.h"
 #include "GLTexture.h"
 #include "../RenderState/GLStateManager.h"
-#include "../GLTypes.h"
 #include <LLGL/TextureFlags.h>
 
 
@@ -16,15 +15,9 @@ namespace LLGL
 {
 
 
-GLReadTextureFBO::GLReadTextureFBO()
+GLReadTextureFBO::GLReadTextureFBO() :
+    stateMngr_ { GLStateManager::Get() }
 {
-    fbo_.GenFramebuffer();
-    GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::ReadFramebuffer, fbo_.GetID());
-}
-
-GLReadTextureFBO::~GLReadTextureFBO()
-{
-    fbo_.DeleteFramebuffer();
 }
 
 // Converts the corresponding offset component into the array layer with respect to the texture type
@@ -45,24 +38,13 @@ static GLint TextureOffsetToArrayLayer(const TextureType type, const Offset3D& o
     }
 }
 
-static GLenum GetGLAttachmentForInternalFormat(GLenum internalFormat)
-{
-    if (GLTypes::IsDepthFormat(internalFormat))
-        return GL_DEPTH_ATTACHMENT;
-    if (GLTypes::IsDepthStencilFormat(internalFormat))
-        return GL_DEPTH_STENCIL_ATTACHMENT;
-    return GL_COLOR_ATTACHMENT0;
-}
-
 void GLReadTextureFBO::Attach(GLTexture& texture, GLint mipLevel, const Offset3D& offset)
 {
-    const GLenum attachment = GetGLAttachmentForInternalFormat(texture.GetGLInternalFormat());
-    GLFramebuffer::AttachTexture(
+    stateMngr_.BindFramebufferWithTexture(
+        GLFramebufferTarget::ReadFramebuffer,
         texture,
-        attachment,
-        static_cast<GLint>(mipLevel),
-        TextureOffsetToArrayLayer(texture.GetType(), offset),
-        GL_READ_FRAMEBUFFER
+        mipLevel,
+        TextureOffsetToArrayLayer(texture.GetType(), offset)
     );
 }
 
@@ -9,35 +9,34 @@
 #define LLGL_GL_READ_TEXTURE_FBO_H
 
 
-#include "GLFramebuffer.h"
+#include "../OpenGL.h"
+#include <LLGL/Types.h>
 
 
 namespace LLGL
 {
 
 
-struct TextureLocation;
 class GLTexture;
+class GLStateManager;
 
-// Wrapper class for GL framebuffer objects (FBOs) of type GL_READ_FRAMEBUFFER used for texture read operations.
+/*
+Helper class to bind framebuffer objects (FBOs) of type GL_READ_FRAMEBUFFER used for texture read operations.
+The FBOs are taken from the framebuffer cache of the current GL context, so they are not validated again for each read operation.
+*/
 class GLReadTextureFBO
 {
 
     public:
 
         GLReadTextureFBO();
-        ~GLReadTextureFBO();
 
+        // Binds an FBO with the specified texture subresource to GL_READ_FRAMEBUFFER.
         void Attach(GLTexture& texture, GLint mipLevel, const Offset3D& offset);
 
-        inline GLuint GetFBO() const
-        {
-            return fbo_.GetID();
-        }
-
     private:
 
-        GLFramebuffer fbo_;
+        GLStateManager& stateMngr_;
 
 };
 
@@ -10,10 +10,12 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLRenderPass.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
@@ -87,7 +89,7 @@ const RenderPass* GLRenderTarget::GetRenderPass() const
 
 void GLRenderTarget::ResolveMultisampled(GLStateManager& stateMngr)
 {
-    if (framebufferResolve_.Valid() && !drawBuffersResolve_.empty())
+    if (HasResolveAttachments())
     {
         stateMngr.BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebufferResolve_.GetID());
         stateMngr.BindFramebuffer(GLFramebufferTarget::ReadFramebuffer, framebuffer_.GetID());
@@ -139,23 +141,63 @@ void GLRenderTarget::SetDrawBuffers()
     SetGLDrawBuffers(drawBuffers_);
 }
 
+// Returns true if FBOs can be configured with DSA, i.e. without binding them first.
+static bool HasFramebufferDSA()
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    return HasExtension(GLExt::ARB_direct_state_access);
+    #else
+    return false;
+    #endif
+}
+
+// Sets the draw buffers for the named FBO with DSA or the currently bound FBO otherwise.
+static void SetGLDrawBuffersForFramebuffer(GLuint framebufferID, const SmallVector<GLenum, 2>& drawBuffers)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasFramebufferDSA())
+    {
+        if (drawBuffers.empty())
+            glNamedFramebufferDrawBuffer(framebufferID, GL_NONE);
+        else
+            glNamedFramebufferDrawBuffers(framebufferID, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        SetGLDrawBuffers(drawBuffers);
+    }
+}
+
 
 /*
  * ======= Private: =======
  */
 
-static void GLThrowIfFramebufferStatusFailed(const char* info)
+static void GLThrowIfFramebufferStatusFailed(GLuint framebufferID, const char* info)
 {
-    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-    GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasFramebufferDSA())
+    {
+        const GLenum status = glCheckNamedFramebufferStatus(framebufferID, GL_DRAW_FRAMEBUFFER);
+        GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
+    }
 }
 
 void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc)
 {
     const std::uint32_t numColorAttachments = GetNumColorAttachments();
 
-    /* Bind primary FBO */
-    GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer_.GetID());
+    /* Bind primary FBO (not required with DSA) */
+    const bool isDSA = HasFramebufferDSA();
+    if (!isDSA)
+        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer_.GetID());
     {
         /* Attach all color targets */
         for_range(colorTarget, numColorAttachments)
@@ -166,8 +208,8 @@ void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescript
             BuildDepthStencilAttachment(desc.depthStencilAttachment);
 
         /* Finalize primary FBO by setting draw buffers and validate its status */
-        SetGLDrawBuffers(drawBuffers_);
-        GLThrowIfFramebufferStatusFailed("color attachment to framebuffer object (FBO) failed");
+        SetGLDrawBuffersForFramebuffer(framebuffer_.GetID(), drawBuffers_);
+        GLThrowIfFramebufferStatusFailed(framebuffer_.GetID(), "color attachment to framebuffer object (FBO) failed");
     }
 
     /* Create secondary FBO if there are any resolve targets */
@@ -176,8 +218,9 @@ void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescript
         /* Create secondary FBO if standard multi-sampling is enabled */
         framebufferResolve_.GenFramebuffer();
 
-        /* Bind multi-sampled FBO */
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebufferResolve_.GetID());
+        /* Bind multi-sampled FBO (not required with DSA) */
+        if (!isDSA)
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebufferResolve_.GetID());
         {
             /* Attach all color resolve targets */
             for_range(colorTarget, numColorAttachments)
@@ -187,8 +230,8 @@ void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescript
             }
 
             /* Set draw buffers for this framebuffer is multi-sampling is enabled */
-            SetGLDrawBuffers(drawBuffersResolve_);
-            GLThrowIfFramebufferStatusFailed("color attachments to multi-sample framebuffer object (FBO) failed");
+            SetGLDrawBuffersForFramebuffer(framebufferResolve_.GetID(), drawBuffersResolve_);
+            GLThrowIfFramebufferStatusFailed(framebufferResolve_.GetID(), "color attachments to multi-sample framebuffer object (FBO) failed");
         }
     }
 }
@@ -204,39 +247,40 @@ void GLRenderTarget::CreateFramebufferWithNoAttachments()
     else
     #endif // /GL_ARB_framebuffer_no_attachments
     {
-        /* Bind primary FBO and create dummy renderbuffer attachment */
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer_.GetID());
-        CreateAndAttachRenderbuffer(GL_COLOR_ATTACHMENT0, GL_RED);
+        /* Bind primary FBO (not required with DSA) and create dummy renderbuffer attachment */
+        if (!HasFramebufferDSA())
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer_.GetID());
+        CreateAndAttachRenderbuffer(framebuffer_.GetID(), GL_COLOR_ATTACHMENT0, GL_RED);
     }
 
     /* Validate framebuffer status */
-    GLThrowIfFramebufferStatusFailed("initializing default parameters for framebuffer object (FBO) failed");
+    GLThrowIfFramebufferStatusFailed(framebuffer_.GetID(), "initializing default parameters for framebuffer object (FBO) failed");
 }
 
 void GLRenderTarget::BuildColorAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget)
 {
     const GLenum binding = AllocColorAttachmentBinding(colorTarget);
     if (auto* texture = attachmentDesc.texture)
-        BuildAttachmentWithTexture(binding, attachmentDesc);
+        BuildAttachmentWithTexture(framebuffer_.GetID(), binding, attachmentDesc);
     else
-        BuildAttachmentWithRenderbuffer(binding, attachmentDesc.format);
+        BuildAttachmentWithRenderbuffer(framebuffer_.GetID(), binding, attachmentDesc.format);
 }
 
 void GLRenderTarget::BuildResolveAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget)
 {
     LLGL_ASSERT_PTR(attachmentDesc.texture);
-    BuildAttachmentWithTexture(AllocResolveAttachmentBinding(colorTarget), attachmentDesc);
+    BuildAttachmentWithTexture(framebufferResolve_.GetID(), AllocResolveAttachmentBinding(colorTarget), attachmentDesc);
 }
 
 void GLRenderTarget::BuildDepthStencilAttachment(const AttachmentDescriptor& attachmentDesc)
 {
     if (auto* texture = attachmentDesc.texture)
-        BuildAttachmentWithTexture(AllocDepthStencilAttachmentBinding(texture->GetFormat()), attachmentDesc);
+        BuildAttachmentWithTexture(framebuffer_.GetID(), AllocDepthStencilAttachmentBinding(texture->GetFormat()), attachmentDesc);
     else
-        BuildAttachmentWithRenderbuffer(AllocDepthStencilAttachmentBinding(attachmentDesc.format), attachmentDesc.format);
+        BuildAttachmentWithRenderbuffer(framebuffer_.GetID(), AllocDepthStencilAttachmentBinding(attachmentDesc.format), attachmentDesc.format);
 }
 
-void GLRenderTarget::BuildAttachmentWithTexture(GLenum binding, const AttachmentDescriptor& attachmentDesc)
+void GLRenderTarget::BuildAttachmentWithTexture(GLuint framebufferID, GLenum binding, const AttachmentDescriptor& attachmentDesc)
 {
     LLGL_ASSERT_PTR(attachmentDesc.texture);
     auto* textureGL = LLGL_CAST(GLTexture*, attachmentDesc.texture);
@@ -245,22 +289,31 @@ void GLRenderTarget::BuildAttachmentWithTexture(GLenum binding, const Attachment
     auto mipLevel = attachmentDesc.mipLevel;
     ValidateMipResolution(*textureGL, mipLevel);
 
+    /* Attach consecutive array layers as views for multiview render passes */
+    const std::uint32_t viewMask = (renderPass_ != nullptr ? LLGL_CAST(const GLRenderPass*, renderPass_)->GetViewMask() : 0);
+    if (viewMask != 0)
+    {
+        const GLsizei numViews = static_cast<GLsizei>(NumRenderPassViews(viewMask));
+        GLFramebuffer::AttachTextureMultiview(*textureGL, binding, static_cast<GLint>(mipLevel), static_cast<GLint>(attachmentDesc.arrayLayer), numViews, framebufferID);
+        return;
+    }
+
     /* Attach texture to framebuffer */
-    GLFramebuffer::AttachTexture(*textureGL, binding, static_cast<GLint>(mipLevel), static_cast<GLint>(attachmentDesc.arrayLayer));
+    GLFramebuffer::AttachTexture(*textureGL, binding, static_cast<GLint>(mipLevel), static_cast<GLint>(attachmentDesc.arrayLayer), GL_FRAMEBUFFER, framebufferID);
 }
 
-void GLRenderTarget::BuildAttachmentWithRenderbuffer(GLenum binding, Format format)
+void GLRenderTarget::BuildAttachmentWithRenderbuffer(GLuint framebufferID, GLenum binding, Format format)
 {
-    CreateAndAttachRenderbuffer(binding, GLTypes::Map(format));
+    CreateAndAttachRenderbuffer(framebufferID, binding, GLTypes::Map(format));
 }
 
-void GLRenderTarget::CreateAndAttachRenderbuffer(GLenum binding, GLenum internalFormat)
+void GLRenderTarget::CreateAndAttachRenderbuffer(GLuint framebufferID, GLenum binding, GLenum internalFormat)
 {
     GLRenderbuffer renderbuffer;
     {
         renderbuffer.GenRenderbuffer();
-        renderbuffer.BindAndAllocStorage(internalFormat, resolution_[0], resolution_[1], samples_);
-        GLFramebuffer::AttachRenderbuffer(binding, renderbuffer.GetID());
+        GLRenderbuffer::AllocStorage(renderbuffer.GetID(), internalFormat, resolution_[0], resolution_[1], samples_);
+        GLFramebuffer::AttachRenderbuffer(binding, renderbuffer.GetID(), framebufferID);
     }
     renderbuffers_.push_back(std::move(renderbuffer));
 }
@@ -56,6 +56,12 @@ class GLRenderTarget final : public RenderTarget
             return framebuffer_;
         }
 
+        // Returns true if this render target has a secondary FBO to resolve multi-sampled color attachments into.
+        inline bool HasResolveAttachments() const
+        {
+            return (framebufferResolve_.Valid() && !drawBuffersResolve_.empty());
+        }
+
     private:
 
         void CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc);
@@ -65,10 +71,10 @@ class GLRenderTarget final : public RenderTarget
         void BuildResolveAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget);
         void BuildDepthStencilAttachment(const AttachmentDescriptor& attachmentDesc);
 
-        void BuildAttachmentWithTexture(GLenum binding, const AttachmentDescriptor& attachmentDesc);
-        void BuildAttachmentWithRenderbuffer(GLenum binding, Format format);
+        void BuildAttachmentWithTexture(GLuint framebufferID, GLenum binding, const AttachmentDescriptor& attachmentDesc);
+        void BuildAttachmentWithRenderbuffer(GLuint framebufferID, GLenum binding, Format format);
 
-        void CreateAndAttachRenderbuffer(GLenum binding, GLenum internalFormat);
+        void CreateAndAttachRenderbuffer(GLuint framebufferID, GLenum binding, GLenum internalFormat);
 
         GLenum AllocColorAttachmentBinding(std::uint32_t colorTarget);
         GLenum AllocResolveAttachmentBinding(std::uint32_t colorTarget);
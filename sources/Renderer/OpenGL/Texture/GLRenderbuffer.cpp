@@ -40,7 +40,17 @@ GLRenderbuffer& GLRenderbuffer::operator = (GLRenderbuffer&& rhs) noexcept
 void GLRenderbuffer::GenRenderbuffer()
 {
     DeleteRenderbuffer();
-    glGenRenderbuffers(1, &id_);
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Create new renderbuffer directly, so its storage can be allocated without binding it first */
+        glCreateRenderbuffers(1, &id_);
+    }
+    else
+    #endif
+    {
+        glGenRenderbuffers(1, &id_);
+    }
 }
 
 void GLRenderbuffer::DeleteRenderbuffer()
@@ -6,6 +6,7 @@
  */
 
 #include "GLSampler.h"
+#include "GLTextureHandlePool.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
@@ -16,17 +17,103 @@ namespace LLGL
 {
 
 
-GLSampler::GLSampler(const char* debugName)
+/*
+ * GLSamplerObject class
+ */
+
+GLSamplerObject::GLSamplerObject(const GLSamplerParameters& params)
 {
     glGenSamplers(1, &id_);
-    if (debugName != nullptr)
-        SetDebugName(debugName);
+
+    /* Set texture coordinate wrap modes */
+    glSamplerParameteri(id_, GL_TEXTURE_WRAP_S, params.wrapS);
+    glSamplerParameteri(id_, GL_TEXTURE_WRAP_T, params.wrapT);
+    glSamplerParameteri(id_, GL_TEXTURE_WRAP_R, params.wrapR);
+
+    /* Set filter states */
+    glSamplerParameteri(id_, GL_TEXTURE_MIN_FILTER, params.minFilter);
+    glSamplerParameteri(id_, GL_TEXTURE_MAG_FILTER, params.magFilter);
+    #ifdef LLGL_OPENGL
+    glSamplerParameterf(id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, params.maxAnisotropy);
+    #endif
+
+    /* Set MIP-map level selection */
+    glSamplerParameterf(id_, GL_TEXTURE_MIN_LOD, params.minLOD);
+    glSamplerParameterf(id_, GL_TEXTURE_MAX_LOD, params.maxLOD);
+    #ifdef LLGL_OPENGL
+    glSamplerParameterf(id_, GL_TEXTURE_LOD_BIAS, params.lodBias);
+    #endif
+
+    /* Set compare operation */
+    glSamplerParameteri(id_, GL_TEXTURE_COMPARE_MODE, params.compareMode);
+    if (params.compareMode != GL_NONE)
+        glSamplerParameteri(id_, GL_TEXTURE_COMPARE_FUNC, params.compareFunc);
+
+    /* Set border color */
+    #ifdef LLGL_SAMPLER_BORDER_COLOR
+    glSamplerParameterfv(id_, GL_TEXTURE_BORDER_COLOR, params.borderColor);
+    #endif
+}
+
+GLSamplerObject::GLSamplerObject(GLSamplerObject&& rhs) noexcept :
+    id_ { rhs.id_ }
+{
+    rhs.id_ = 0;
+}
+
+GLSamplerObject& GLSamplerObject::operator = (GLSamplerObject&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        Reset();
+        id_ = rhs.id_;
+        rhs.id_ = 0;
+    }
+    return *this;
+}
+
+GLSamplerObject::~GLSamplerObject()
+{
+    Reset();
+}
+
+void GLSamplerObject::Reset()
+{
+    if (id_ != 0)
+    {
+        glDeleteSamplers(1, &id_);
+        GLStateManager::Get().NotifySamplerRelease(id_);
+        GLTextureHandlePool::Get().NotifySamplerRelease(id_);
+        id_ = 0;
+    }
+}
+
+
+/*
+ * GLSampler class
+ */
+
+GLSampler::GLSampler(const SamplerDescriptor& desc)
+{
+    /* Zero-initialize parameters including padding bytes, since the pool compares them bytewise */
+    GLSamplerParameters params = {};
+    GLSampler::ConvertDesc(params, desc);
+
+    id_ = GLSampler::GetSamplerPool().Acquire(
+        params,
+        [](const GLSamplerParameters& samplerParams) -> GLSamplerObject
+        {
+            return GLSamplerObject{ samplerParams };
+        }
+    );
+
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
 }
 
 GLSampler::~GLSampler()
 {
-    glDeleteSamplers(1, &id_);
-    GLStateManager::Get().NotifySamplerRelease(id_);
+    GLSampler::GetSamplerPool().Release(id_);
 }
 
 void GLSampler::SetDebugName(const char* name)
@@ -42,40 +129,30 @@ static GLenum GetGLSamplerMinFilter(const SamplerDescriptor& desc)
         return GLTypes::Map(desc.minFilter);
 }
 
-void GLSampler::SamplerParameters(const SamplerDescriptor& desc)
+void GLSampler::ConvertDesc(GLSamplerParameters& outParams, const SamplerDescriptor& inDesc)
 {
-    /* Set texture coordinate wrap modes */
-    glSamplerParameteri(id_, GL_TEXTURE_WRAP_S, GLTypes::Map(desc.addressModeU));
-    glSamplerParameteri(id_, GL_TEXTURE_WRAP_T, GLTypes::Map(desc.addressModeV));
-    glSamplerParameteri(id_, GL_TEXTURE_WRAP_R, GLTypes::Map(desc.addressModeW));
-
-    /* Set filter states */
-    glSamplerParameteri(id_, GL_TEXTURE_MIN_FILTER, GetGLSamplerMinFilter(desc));
-    glSamplerParameteri(id_, GL_TEXTURE_MAG_FILTER, GLTypes::Map(desc.magFilter));
-    #ifdef LLGL_OPENGL
-    glSamplerParameterf(id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, static_cast<float>(desc.maxAnisotropy));
-    #endif
-
-    /* Set MIP-map level selection */
-    glSamplerParameterf(id_, GL_TEXTURE_MIN_LOD, desc.minLOD);
-    glSamplerParameterf(id_, GL_TEXTURE_MAX_LOD, desc.maxLOD);
-    #ifdef LLGL_OPENGL
-    glSamplerParameterf(id_, GL_TEXTURE_LOD_BIAS, desc.mipMapLODBias);
-    #endif
-
-    /* Set compare operation */
-    if (desc.compareEnabled)
-    {
-        glSamplerParameteri(id_, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
-        glSamplerParameteri(id_, GL_TEXTURE_COMPARE_FUNC, GLTypes::Map(desc.compareOp));
-    }
-    else
-        glSamplerParameteri(id_, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+    outParams.wrapS         = static_cast<GLint>(GLTypes::Map(inDesc.addressModeU));
+    outParams.wrapT         = static_cast<GLint>(GLTypes::Map(inDesc.addressModeV));
+    outParams.wrapR         = static_cast<GLint>(GLTypes::Map(inDesc.addressModeW));
+    outParams.minFilter     = static_cast<GLint>(GetGLSamplerMinFilter(inDesc));
+    outParams.magFilter     = static_cast<GLint>(GLTypes::Map(inDesc.magFilter));
+    outParams.compareMode   = (inDesc.compareEnabled ? GL_COMPARE_REF_TO_TEXTURE : GL_NONE);
+    outParams.compareFunc   = (inDesc.compareEnabled ? static_cast<GLint>(GLTypes::Map(inDesc.compareOp)) : 0);
+    outParams.maxAnisotropy = static_cast<GLfloat>(inDesc.maxAnisotropy);
+    outParams.minLOD        = inDesc.minLOD;
+    outParams.maxLOD        = inDesc.maxLOD;
+    outParams.lodBias       = inDesc.mipMapLODBias;
+
+    outParams.borderColor[0] = inDesc.borderColor[0];
+    outParams.borderColor[1] = inDesc.borderColor[1];
+    outParams.borderColor[2] = inDesc.borderColor[2];
+    outParams.borderColor[3] = inDesc.borderColor[3];
+}
 
-    /* Set border color */
-    #ifdef LLGL_SAMPLER_BORDER_COLOR
-    glSamplerParameterfv(id_, GL_TEXTURE_BORDER_COLOR, desc.borderColor);
-    #endif
+GLSamplerPool& GLSampler::GetSamplerPool()
+{
+    static GLSamplerPool samplerPool;
+    return samplerPool;
 }
 
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/Sampler.h>
 #include "../OpenGL.h"
+#include "../../SharedStatePool.h"
 #include <memory>
 
 
@@ -18,27 +19,87 @@ namespace LLGL
 {
 
 
+// Native GL sampler parameters. This is the key of GLSamplerPool and must be zero-initialized before it is filled in.
+struct GLSamplerParameters
+{
+    GLint   wrapS;
+    GLint   wrapT;
+    GLint   wrapR;
+    GLint   minFilter;
+    GLint   magFilter;
+    GLint   compareMode;
+    GLint   compareFunc;
+    GLfloat maxAnisotropy;
+    GLfloat minLOD;
+    GLfloat maxLOD;
+    GLfloat lodBias;
+    GLfloat borderColor[4];
+};
+
+// Owner of a native GL sampler object. Deletes the sampler and notifies the state manager when it goes out of scope.
+class GLSamplerObject
+{
+
+    public:
+
+        GLSamplerObject() = default;
+        GLSamplerObject(const GLSamplerObject&) = delete;
+        GLSamplerObject& operator = (const GLSamplerObject&) = delete;
+
+        GLSamplerObject(GLSamplerObject&& rhs) noexcept;
+        GLSamplerObject& operator = (GLSamplerObject&& rhs) noexcept;
+
+        ~GLSamplerObject();
+
+        // Generates a new GL sampler object and sets the specified parameters, i.e. glSamplerParameter*.
+        explicit GLSamplerObject(const GLSamplerParameters& params);
+
+        // Returns the hardware sampler ID.
+        inline GLuint Get() const
+        {
+            return id_;
+        }
+
+    private:
+
+        void Reset();
+
+    private:
+
+        GLuint id_ = 0;
+
+};
+
+// Pool of native GL samplers that are shared between all samplers and static samplers with identical parameters.
+using GLSamplerPool = SharedStatePool<GLSamplerParameters, GLSamplerObject>;
+
 class GLSampler final : public Sampler
 {
 
     public:
 
+        // Sets the debug label of the native GL sampler. Since native samplers are shared, this label applies to all samplers with identical parameters.
         void SetDebugName(const char* name) override;
 
     public:
 
-        GLSampler(const char* debugName = nullptr);
+        GLSampler(const SamplerDescriptor& desc);
         ~GLSampler();
 
-        // Sets the GL sampler parameters with the specified descriptor, i.e. glSamplerParameter*.
-        void SamplerParameters(const SamplerDescriptor& desc);
-
-        // Returns the hardware sampler ID.
+        // Returns the hardware sampler ID. This is shared between all samplers with identical parameters.
         inline GLuint GetID() const
         {
             return id_;
         }
 
+    public:
+
+        // Converts the specified sampler descriptor to the native GL sampler parameters.
+        static void ConvertDesc(GLSamplerParameters& outParams, const SamplerDescriptor& inDesc);
+
+        // Returns the pool of native GL samplers.
+        static GLSamplerPool& GetSamplerPool();
+
     private:
 
         GLuint id_ = 0;
@@ -0,0 +1,111 @@
+/*
+ * GLStagingPixelBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLStagingPixelBuffer.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+GLStagingPixelBuffer& GLStagingPixelBuffer::Get()
+{
+    static GLStagingPixelBuffer instance;
+    return instance;
+}
+
+bool GLStagingPixelBuffer::IsSupported()
+{
+    return HasExtension(GLExt::ARB_map_buffer_range);
+}
+
+GLStagingPixelBuffer::GLStagingPixelBuffer()
+{
+    // dummy
+}
+
+GLStagingPixelBuffer::~GLStagingPixelBuffer()
+{
+    // dummy
+}
+
+void GLStagingPixelBuffer::Clear()
+{
+    /* Delete buffer storage; GL context must still be current */
+    if (id_ != 0)
+    {
+        GLStateManager::Get().NotifyBufferRelease(id_, GLBufferTarget::PixelUnpackBuffer);
+        glDeleteBuffers(1, &id_);
+        id_ = 0;
+    }
+    readback_.Clear();
+}
+
+bool GLStagingPixelBuffer::TextureSubImage(GLTexture& textureGL, const TextureRegion& region, const ImageView& srcImageView)
+{
+    /* Only stage large images for textures; renderbuffers cannot be written */
+    if (srcImageView.data == nullptr || srcImageView.dataSize < minStagingSize || textureGL.IsRenderbuffer() || !IsSupported())
+        return false;
+
+    if (id_ == 0)
+        glGenBuffers(1, &id_);
+
+    const GLsizeiptr size = static_cast<GLsizeiptr>(srcImageView.dataSize);
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, id_);
+    {
+        /* Orphan previous storage, so uploads that are still pending keep their own copy of the data */
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+
+        void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (dst == nullptr)
+        {
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+            return false;
+        }
+
+        ::memcpy(dst, srcImageView.data, srcImageView.dataSize);
+
+        /* Data store can become corrupted while mapped (e.g. on a screen mode change), so write the client memory directly in that case */
+        if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_FALSE)
+        {
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+            return false;
+        }
+
+        /* Source image data from the beginning of the bound pixel unpack buffer */
+        ImageView stagedImageView = srcImageView;
+        stagedImageView.data = nullptr;
+        textureGL.TextureSubImage(region, stagedImageView, false);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+
+    return true;
+}
+
+bool GLStagingPixelBuffer::GetTextureSubImage(GLTexture& textureGL, const TextureRegion& region, const MutableImageView& dstImageView)
+{
+    /* Only stage large images for textures; renderbuffers cannot be read */
+    if (dstImageView.dataSize < minStagingSize || textureGL.IsRenderbuffer() || !GLTextureReadback::IsSupported(dstImageView.format))
+        return false;
+
+    /* Resolve immediately, since RenderSystem::ReadTexture must return with the image data */
+    readback_.Begin(textureGL, region, dstImageView);
+    return readback_.Resolve(dstImageView);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
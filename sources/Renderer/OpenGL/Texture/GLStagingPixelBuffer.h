@@ -0,0 +1,91 @@
+/*
+ * GLStagingPixelBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_STAGING_PIXEL_BUFFER_H
+#define LLGL_GL_STAGING_PIXEL_BUFFER_H
+
+
+#include "../OpenGL.h"
+#include "GLTextureReadback.h"
+#include <LLGL/ImageFlags.h>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+struct TextureRegion;
+
+/*
+Streaming pixel unpack buffer (PBO) to stage large texture uploads and pixel pack buffer to read them back.
+The image data is copied into the mapped buffer storage and glTexSubImage sources it from GL_PIXEL_UNPACK_BUFFER,
+so the driver can schedule the transfer on the GPU timeline instead of blocking until it has copied the client memory.
+The storage is orphaned with each upload, so pending transfers never have to be waited on.
+*/
+class GLStagingPixelBuffer
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLStagingPixelBuffer& Get();
+
+        // Returns true if the extension for mapping buffer ranges is supported.
+        static bool IsSupported();
+
+    public:
+
+        GLStagingPixelBuffer(const GLStagingPixelBuffer&) = delete;
+        GLStagingPixelBuffer& operator = (const GLStagingPixelBuffer&) = delete;
+
+        GLStagingPixelBuffer(GLStagingPixelBuffer&&) = delete;
+        GLStagingPixelBuffer& operator = (GLStagingPixelBuffer&&) = delete;
+
+        // Releases the resource for this singleton class.
+        void Clear();
+
+        /*
+        Stages the specified image data in the pixel unpack buffer and writes it into the destination texture.
+        Returns false if the image is too small to benefit from staging or cannot be staged,
+        in which case the caller must fall back to GLTexture::TextureSubImage.
+        */
+        bool TextureSubImage(GLTexture& textureGL, const TextureRegion& region, const ImageView& srcImageView);
+
+        /*
+        Reads the texture region through the pixel pack buffer into the destination image.
+        Returns false if the image is too small to benefit from staging or cannot be staged,
+        in which case the caller must fall back to GLTexture::GetTextureSubImage.
+        */
+        bool GetTextureSubImage(GLTexture& textureGL, const TextureRegion& region, const MutableImageView& dstImageView);
+
+    private:
+
+        GLStagingPixelBuffer();
+        ~GLStagingPixelBuffer();
+
+    private:
+
+        // Images smaller than this are written directly, since the driver copies them into its own staging memory quickly.
+        static constexpr std::size_t minStagingSize = 256 * 1024;
+
+    private:
+
+        GLuint              id_         = 0;
+        GLTextureReadback   readback_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
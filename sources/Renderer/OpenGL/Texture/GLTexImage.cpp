@@ -81,7 +81,7 @@ static Format FindSuitableDepthFormat(const TextureDescriptor& desc)
     return desc.format;
 }
 
-#ifdef GL_ARB_texture_storage
+#ifdef LLGL_GLEXT_TEXTURE_STORAGE
 
 // Returns true if the specified GL texture target is a cube face other than GL_TEXTURE_CUBE_MAP_POSITIVE_X
 static bool IsSecondaryCubeFaceTarget(GLenum target)
@@ -96,13 +96,30 @@ static bool IsSecondaryCubeFaceTarget(GLenum target)
     );
 }
 
-#endif // /GL_ARB_texture_storage
+#endif // /LLGL_GLEXT_TEXTURE_STORAGE
+
+#if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+
+// Returns true if the storage of the specified GL texture can be allocated without binding it first, i.e. with DSA
+static bool IsTextureStorageDSA(GLuint texID)
+{
+    return (texID != 0 && HasExtension(GLExt::ARB_direct_state_access) && HasExtension(GLExt::ARB_texture_storage));
+}
+
+// Returns true if the specified GL texture target is any of the cube face targets
+static bool IsCubeFaceTarget(GLenum target)
+{
+    return (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z);
+}
+
+#endif // /GL_ARB_direct_state_access
 
 /* ----- Back-end OpenGL functions ----- */
 
 #ifdef LLGL_OPENGL
 
 static void GLTexImage1DBase(
+    GLuint          texID,
     GLenum          target,
     std::uint32_t   mipLevels,
     const Format    textureFormat,
@@ -115,7 +132,24 @@ static void GLTexImage1DBase(
     auto internalFormat = GLTypes::Map(textureFormat);
     auto sx             = static_cast<GLsizei>(width);
 
-    #ifdef GL_ARB_texture_storage
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (IsTextureStorageDSA(texID))
+    {
+        /* Allocate immutable storage of named texture object */
+        glTextureStorage1D(texID, static_cast<GLsizei>(mipLevels), internalFormat, sx);
+
+        /* Initialize highest MIP level */
+        if (data != nullptr)
+        {
+            if (IsCompressedFormat(textureFormat))
+                glCompressedTextureSubImage1D(texID, 0, 0, sx, internalFormat, static_cast<GLsizei>(dataSize), data);
+            else
+                glTextureSubImage1D(texID, 0, 0, sx, format, type, data);
+        }
+    }
+    else
+    #endif
+    #ifdef LLGL_GLEXT_TEXTURE_STORAGE
     if (HasExtension(GLExt::ARB_texture_storage))
     {
         /* Allocate immutable texture storage */
@@ -155,6 +189,7 @@ static void GLTexImage1DBase(
 #endif
 
 static void GLTexImage2DBase(
+    GLuint          texID,
     GLenum          target,
     std::uint32_t   mipLevels,
     const Format    textureFormat,
@@ -169,7 +204,36 @@ static void GLTexImage2DBase(
     auto sx             = static_cast<GLsizei>(width);
     auto sy             = static_cast<GLsizei>(height);
 
-    #ifdef GL_ARB_texture_storage
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (IsTextureStorageDSA(texID))
+    {
+        /* Allocate immutable storage of named texture object (only once, not for ever cube face!) */
+        if (!IsSecondaryCubeFaceTarget(target))
+            glTextureStorage2D(texID, static_cast<GLsizei>(mipLevels), internalFormat, sx, sy);
+
+        /* Initialize highest MIP level; cube faces are addressed as array layers with DSA */
+        if (data != nullptr)
+        {
+            if (IsCubeFaceTarget(target))
+            {
+                const GLint cubeFace = static_cast<GLint>(target - GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+                if (IsCompressedFormat(textureFormat))
+                    glCompressedTextureSubImage3D(texID, 0, 0, 0, cubeFace, sx, sy, 1, internalFormat, static_cast<GLsizei>(dataSize), data);
+                else
+                    glTextureSubImage3D(texID, 0, 0, 0, cubeFace, sx, sy, 1, format, type, data);
+            }
+            else
+            {
+                if (IsCompressedFormat(textureFormat))
+                    glCompressedTextureSubImage2D(texID, 0, 0, 0, sx, sy, internalFormat, static_cast<GLsizei>(dataSize), data);
+                else
+                    glTextureSubImage2D(texID, 0, 0, 0, sx, sy, format, type, data);
+            }
+        }
+    }
+    else
+    #endif
+    #ifdef LLGL_GLEXT_TEXTURE_STORAGE
     if (HasExtension(GLExt::ARB_texture_storage))
     {
         /* Allocate immutable texture storage (only once, not for ever cube face!) */
@@ -224,6 +288,7 @@ static void GLTexImage2DBase(
 }
 
 static void GLTexImage3DBase(
+    GLuint          texID,
     GLenum          target,
     std::uint32_t   mipLevels,
     const Format    textureFormat,
@@ -240,7 +305,24 @@ static void GLTexImage3DBase(
     auto sy             = static_cast<GLsizei>(height);
     auto sz             = static_cast<GLsizei>(depth);
 
-    #ifdef GL_ARB_texture_storage
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (IsTextureStorageDSA(texID))
+    {
+        /* Allocate immutable storage of named texture object */
+        glTextureStorage3D(texID, static_cast<GLsizei>(mipLevels), internalFormat, sx, sy, sz);
+
+        /* Initialize highest MIP level */
+        if (data != nullptr)
+        {
+            if (IsCompressedFormat(textureFormat))
+                glCompressedTextureSubImage3D(texID, 0, 0, 0, 0, sx, sy, sz, internalFormat, static_cast<GLsizei>(dataSize), data);
+            else
+                glTextureSubImage3D(texID, 0, 0, 0, 0, sx, sy, sz, format, type, data);
+        }
+    }
+    else
+    #endif
+    #ifdef LLGL_GLEXT_TEXTURE_STORAGE
     if (HasExtension(GLExt::ARB_texture_storage))
     {
         /* Allocate immutable texture storage */
@@ -294,6 +376,7 @@ static void GLTexImage3DBase(
 #ifdef LLGL_OPENGL
 
 static void GLTexImage2DMultisampleBase(
+    GLuint          texID,
     GLenum          target,
     std::uint32_t   samples,
     const Format    textureFormat,
@@ -307,6 +390,14 @@ static void GLTexImage2DMultisampleBase(
     auto sy                     = static_cast<GLsizei>(height);
     auto fixedSampleLocations   = static_cast<GLboolean>(fixedSamples ? GL_TRUE : GL_FALSE);
 
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (IsTextureStorageDSA(texID) && HasExtension(GLExt::ARB_texture_storage_multisample))
+    {
+        /* Allocate immutable storage of named texture object */
+        glTextureStorage2DMultisample(texID, sampleCount, internalFormat, sx, sy, fixedSampleLocations);
+    }
+    else
+    #endif
     #ifdef GL_ARB_texture_storage_multisample
     if (HasExtension(GLExt::ARB_texture_storage_multisample))
     {
@@ -322,6 +413,7 @@ static void GLTexImage2DMultisampleBase(
 }
 
 static void GLTexImage3DMultisampleBase(
+    GLuint          texID,
     GLenum          target,
     std::uint32_t   samples,
     const Format    textureFormat,
@@ -337,6 +429,14 @@ static void GLTexImage3DMultisampleBase(
     auto sz                     = static_cast<GLsizei>(depth);
     auto fixedSampleLocations   = static_cast<GLboolean>(fixedSamples ? GL_TRUE : GL_FALSE);
 
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (IsTextureStorageDSA(texID) && HasExtension(GLExt::ARB_texture_storage_multisample))
+    {
+        /* Allocate immutable storage of named texture object */
+        glTextureStorage3DMultisample(texID, sampleCount, internalFormat, sx, sy, sz, fixedSampleLocations);
+    }
+    else
+    #endif
     #ifdef GL_ARB_texture_storage_multisample
     if (HasExtension(GLExt::ARB_texture_storage_multisample))
     {
@@ -358,6 +458,7 @@ static void GLTexImage3DMultisampleBase(
 #ifdef LLGL_OPENGL
 
 static void GLTexImage1D(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -366,12 +467,13 @@ static void GLTexImage1D(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage1DBase(GL_TEXTURE_1D, mipLevels, internalFormat, width, format, type, data, compressedSize);
+    GLTexImage1DBase(texID, GL_TEXTURE_1D, mipLevels, internalFormat, width, format, type, data, compressedSize);
 }
 
 #endif
 
 static void GLTexImage2D(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -381,10 +483,11 @@ static void GLTexImage2D(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage2DBase(GL_TEXTURE_2D, mipLevels, internalFormat, width, height, format, type, data, compressedSize);
+    GLTexImage2DBase(texID, GL_TEXTURE_2D, mipLevels, internalFormat, width, height, format, type, data, compressedSize);
 }
 
 static void GLTexImage3D(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -395,10 +498,11 @@ static void GLTexImage3D(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_3D, mipLevels, internalFormat, width, height, depth, format, type, data, compressedSize);
+    GLTexImage3DBase(texID, GL_TEXTURE_3D, mipLevels, internalFormat, width, height, depth, format, type, data, compressedSize);
 }
 
 static void GLTexImageCube(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -409,12 +513,13 @@ static void GLTexImageCube(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage2DBase(GLTypes::ToTextureCubeMap(cubeFaceIndex), mipLevels, internalFormat, width, height, format, type, data, compressedSize);
+    GLTexImage2DBase(texID, GLTypes::ToTextureCubeMap(cubeFaceIndex), mipLevels, internalFormat, width, height, format, type, data, compressedSize);
 }
 
 #ifdef LLGL_OPENGL
 
 static void GLTexImage1DArray(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -424,12 +529,13 @@ static void GLTexImage1DArray(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage2DBase(GL_TEXTURE_1D_ARRAY, mipLevels, internalFormat, width, layers, format, type, data, compressedSize);
+    GLTexImage2DBase(texID, GL_TEXTURE_1D_ARRAY, mipLevels, internalFormat, width, layers, format, type, data, compressedSize);
 }
 
 #endif
 
 static void GLTexImage2DArray(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -440,12 +546,13 @@ static void GLTexImage2DArray(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_2D_ARRAY, mipLevels, internalFormat, width, height, layers, format, type, data, compressedSize);
+    GLTexImage3DBase(texID, GL_TEXTURE_2D_ARRAY, mipLevels, internalFormat, width, height, layers, format, type, data, compressedSize);
 }
 
 #ifdef LLGL_OPENGL
 
 static void GLTexImageCubeArray(
+    GLuint          texID,
     std::uint32_t   mipLevels,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -456,20 +563,22 @@ static void GLTexImageCubeArray(
     const void*     data,
     std::size_t     compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_CUBE_MAP_ARRAY, mipLevels, internalFormat, width, height, layers, format, type, data, compressedSize);
+    GLTexImage3DBase(texID, GL_TEXTURE_CUBE_MAP_ARRAY, mipLevels, internalFormat, width, height, layers, format, type, data, compressedSize);
 }
 
 static void GLTexImage2DMultisample(
+    GLuint          texID,
     std::uint32_t   samples,
     const Format    internalFormat,
     std::uint32_t   width,
     std::uint32_t   height,
     bool            fixedSamples)
 {
-    GLTexImage2DMultisampleBase(GL_TEXTURE_2D_MULTISAMPLE, samples, internalFormat, width, height, fixedSamples);
+    GLTexImage2DMultisampleBase(texID, GL_TEXTURE_2D_MULTISAMPLE, samples, internalFormat, width, height, fixedSamples);
 }
 
 static void GLTexImage2DMultisampleArray(
+    GLuint          texID,
     std::uint32_t   samples,
     const Format    internalFormat,
     std::uint32_t   width,
@@ -477,19 +586,20 @@ static void GLTexImage2DMultisampleArray(
     std::uint32_t   depth,
     bool            fixedSamples)
 {
-    GLTexImage3DMultisampleBase(GL_TEXTURE_2D_MULTISAMPLE_ARRAY, samples, internalFormat, width, height, depth, fixedSamples);
+    GLTexImage3DMultisampleBase(texID, GL_TEXTURE_2D_MULTISAMPLE_ARRAY, samples, internalFormat, width, height, depth, fixedSamples);
 }
 
 #endif
 
 #ifdef LLGL_OPENGL
 
-static void GLTexImage1D(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImage1D(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image from descriptor */
         GLTexImage1D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -509,6 +619,7 @@ static void GLTexImage1D(const TextureDescriptor& desc, const ImageView* imageVi
         /* Initialize texture image with default color */
         auto image = GenImageDataRGBAf(desc.extent.x, desc.clearValue.color);
         GLTexImage1D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -521,6 +632,7 @@ static void GLTexImage1D(const TextureDescriptor& desc, const ImageView* imageVi
     {
         /* Allocate texture without initial data */
         GLTexImage1D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -533,12 +645,13 @@ static void GLTexImage1D(const TextureDescriptor& desc, const ImageView* imageVi
 
 #endif
 
-static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImage2D(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image from descriptor */
         GLTexImage2D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -556,6 +669,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
             /* Initialize depth-stencil texture image with default depth */
             auto image = GenImageDataD32fS8ui(desc.extent.x * desc.extent.y, desc.clearValue.depth, desc.clearValue.stencil);
             GLTexImage2D(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -569,6 +683,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
         {
             /* Allocate depth-stencil texture image without initial data */
             GLTexImage2D(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -586,6 +701,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
             /* Initialize depth texture image with default depth */
             auto image = GenImageDataRf(desc.extent.x * desc.extent.y, desc.clearValue.depth);
             GLTexImage2D(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -599,6 +715,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
         {
             /* Allocate depth texture image without initial data */
             GLTexImage2D(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -614,6 +731,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
         /* Initialize texture image with default color */
         auto image = GenImageDataRGBAf(desc.extent.x * desc.extent.y, desc.clearValue.color);
         GLTexImage2D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -627,6 +745,7 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
     {
         /* Allocate texture without initial data */
         GLTexImage2D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -638,12 +757,13 @@ static void GLTexImage2D(const TextureDescriptor& desc, const ImageView* imageVi
     }
 }
 
-static void GLTexImage3D(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImage3D(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image from descriptor */
         GLTexImage3D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -665,6 +785,7 @@ static void GLTexImage3D(const TextureDescriptor& desc, const ImageView* imageVi
         /* Initialize texture image with default color */
         auto image = GenImageDataRGBAf(desc.extent.x * desc.extent.y * desc.extent.z, desc.clearValue.color);
         GLTexImage3D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -679,6 +800,7 @@ static void GLTexImage3D(const TextureDescriptor& desc, const ImageView* imageVi
     {
         /* Allocate texture without initial data */
         GLTexImage3D(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -691,7 +813,7 @@ static void GLTexImage3D(const TextureDescriptor& desc, const ImageView* imageVi
     }
 }
 
-static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImageCube(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     const auto numMipLevels = NumMipLevels(desc);
 
@@ -710,6 +832,7 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
         for_range(arrayLayer, desc.arrayLayers)
         {
             GLTexImageCube(
+                texID,
                 numMipLevels,
                 desc.format,
                 desc.extent.x,
@@ -741,6 +864,7 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
         for_range(arrayLayer, desc.arrayLayers)
         {
             GLTexImageCube(
+                texID,
                 numMipLevels,
                 internalFormat,
                 desc.extent.x,
@@ -770,6 +894,7 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
         for_range(arrayLayer, desc.arrayLayers)
         {
             GLTexImageCube(
+                texID,
                 numMipLevels,
                 internalFormat,
                 desc.extent.x,
@@ -788,6 +913,7 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
         for_range(arrayLayer, desc.arrayLayers)
         {
             GLTexImageCube(
+                texID,
                 numMipLevels,
                 desc.format,
                 desc.extent.x,
@@ -805,6 +931,7 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
         for_range(arrayLayer, desc.arrayLayers)
         {
             GLTexImageCube(
+                texID,
                 numMipLevels,
                 desc.format,
                 desc.extent.x,
@@ -820,12 +947,13 @@ static void GLTexImageCube(const TextureDescriptor& desc, const ImageView* image
 
 #ifdef LLGL_OPENGL
 
-static void GLTexImage1DArray(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImage1DArray(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image from descriptor */
         GLTexImage1DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -846,6 +974,7 @@ static void GLTexImage1DArray(const TextureDescriptor& desc, const ImageView* im
         /* Initialize texture image with default color */
         auto image = GenImageDataRGBAf(desc.extent.x * desc.arrayLayers, desc.clearValue.color);
         GLTexImage1DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -859,6 +988,7 @@ static void GLTexImage1DArray(const TextureDescriptor& desc, const ImageView* im
     {
         /* Allocate texture without initial data */
         GLTexImage1DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -872,12 +1002,13 @@ static void GLTexImage1DArray(const TextureDescriptor& desc, const ImageView* im
 
 #endif
 
-static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImage2DArray(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image from descriptor */
         GLTexImage2DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -896,6 +1027,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
             /* Initialize depth-stencil texture image with default depth */
             auto image = GenImageDataD32fS8ui(desc.extent.x * desc.extent.y * desc.arrayLayers, desc.clearValue.depth, desc.clearValue.stencil);
             GLTexImage2DArray(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -910,6 +1042,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
         {
             /* Allocate depth-stencil texture image without initial data */
             GLTexImage2DArray(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -928,6 +1061,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
             /* Initialize depth texture image with default depth */
             auto image = GenImageDataRf(desc.extent.x * desc.extent.y * desc.arrayLayers, desc.clearValue.depth);
             GLTexImage2DArray(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -942,6 +1076,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
         {
             /* Allocate depth texture image without initial data */
             GLTexImage2DArray(
+                texID,
                 NumMipLevels(desc),
                 FindSuitableDepthFormat(desc),
                 desc.extent.x,
@@ -958,6 +1093,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
         /* Initialize texture image with default color */
         auto image = GenImageDataRGBAf(desc.extent.x * desc.extent.y * desc.arrayLayers, desc.clearValue.color);
         GLTexImage2DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -972,6 +1108,7 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
     {
         /* Allocate texture without initial data */
         GLTexImage2DArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -986,12 +1123,13 @@ static void GLTexImage2DArray(const TextureDescriptor& desc, const ImageView* im
 
 #ifdef LLGL_OPENGL
 
-static void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageView* imageView)
+static void GLTexImageCubeArray(GLuint texID, const TextureDescriptor& desc, const ImageView* imageView)
 {
     if (imageView != nullptr)
     {
         /* Setup texture image cube-faces from descriptor */
         GLTexImageCubeArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -1013,6 +1151,7 @@ static void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageView*
         /* Initialize texture image cube-faces with default color */
         auto image = GenImageDataRGBAf(desc.extent.x * desc.extent.y * desc.arrayLayers, desc.clearValue.color);
         GLTexImageCubeArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -1027,6 +1166,7 @@ static void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageView*
     {
         /* Allocate texture without initial data */
         GLTexImageCubeArray(
+            texID,
             NumMipLevels(desc),
             desc.format,
             desc.extent.x,
@@ -1039,10 +1179,11 @@ static void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageView*
     }
 }
 
-static void GLTexImage2DMS(const TextureDescriptor& desc)
+static void GLTexImage2DMS(GLuint texID, const TextureDescriptor& desc)
 {
     /* Setup multi-sampled texture storage from descriptor */
     GLTexImage2DMultisample(
+        texID,
         desc.samples,
         desc.format,
         desc.extent.x,
@@ -1051,10 +1192,11 @@ static void GLTexImage2DMS(const TextureDescriptor& desc)
     );
 }
 
-static void GLTexImage2DMSArray(const TextureDescriptor& desc)
+static void GLTexImage2DMSArray(GLuint texID, const TextureDescriptor& desc)
 {
     /* Setup multi-sampled array texture storage from descriptor */
     GLTexImage2DMultisampleArray(
+        texID,
         desc.samples,
         desc.format,
         desc.extent.x,
@@ -1066,7 +1208,7 @@ static void GLTexImage2DMSArray(const TextureDescriptor& desc)
 
 #endif
 
-bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView)
+bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView, GLuint texID)
 {
     //TODO: on-the-fly decompression would be awesome (if GL_ARB_texture_compression is unsupported), but a lot of work :-/
     /* If compressed format is requested, GL_ARB_texture_compression must be supported */
@@ -1077,43 +1219,43 @@ bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView)
     {
         #ifdef LLGL_OPENGL
         case TextureType::Texture1D:
-            GLTexImage1D(desc, imageView);
+            GLTexImage1D(texID, desc, imageView);
             break;
         #endif
 
         case TextureType::Texture2D:
-            GLTexImage2D(desc, imageView);
+            GLTexImage2D(texID, desc, imageView);
             break;
 
         case TextureType::Texture3D:
-            GLTexImage3D(desc, imageView);
+            GLTexImage3D(texID, desc, imageView);
             break;
 
         case TextureType::TextureCube:
-            GLTexImageCube(desc, imageView);
+            GLTexImageCube(texID, desc, imageView);
             break;
 
         #ifdef LLGL_OPENGL
         case TextureType::Texture1DArray:
-            GLTexImage1DArray(desc, imageView);
+            GLTexImage1DArray(texID, desc, imageView);
             break;
         #endif
 
         case TextureType::Texture2DArray:
-            GLTexImage2DArray(desc, imageView);
+            GLTexImage2DArray(texID, desc, imageView);
             break;
 
         #ifdef LLGL_OPENGL
         case TextureType::TextureCubeArray:
-            GLTexImageCubeArray(desc, imageView);
+            GLTexImageCubeArray(texID, desc, imageView);
             break;
 
         case TextureType::Texture2DMS:
-            GLTexImage2DMS(desc);
+            GLTexImage2DMS(texID, desc);
             break;
 
         case TextureType::Texture2DMSArray:
-            GLTexImage2DMSArray(desc);
+            GLTexImage2DMSArray(texID, desc);
             break;
         #endif
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/ImageFlags.h>
 #include <LLGL/TextureFlags.h>
+#include "../OpenGL.h"
 
 
 namespace LLGL
@@ -18,7 +19,8 @@ namespace LLGL
 
 
 // Allocates the texture storage with optional initial image data for the currently bound GL texture.
-bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView);
+// If 'texID' is non-zero and "GL_ARB_direct_state_access" is supported, the storage of that named texture is allocated directly without binding it.
+bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView, GLuint texID = 0);
 
 
 } // /namespace LLGL
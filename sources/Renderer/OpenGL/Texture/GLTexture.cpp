@@ -7,6 +7,7 @@
 
 #include "GLTexture.h"
 #include "GLTextureViewPool.h"
+#include "GLTextureHandlePool.h"
 #include "GLRenderbuffer.h"
 #include "GLReadTextureFBO.h"
 #include "GLMipGenerator.h"
@@ -26,6 +27,8 @@
 #include "../../../Core/Exception.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -59,7 +62,19 @@ static bool IsRenderbufferSufficient(const TextureDescriptor& desc)
         desc.mipLevels == 1 &&
         (desc.type == TextureType::Texture2D || desc.type == TextureType::Texture2DMS) &&
         (attachmentBindFlags == BindFlags::ColorAttachment || attachmentBindFlags == BindFlags::DepthStencilAttachment) &&
-        ((desc.miscFlags & MiscFlags::NoInitialData) != 0)
+        ((desc.miscFlags & (MiscFlags::NoInitialData | MiscFlags::Sparse)) == MiscFlags::NoInitialData)
+    );
+}
+
+// Returns true if the specified texture descriptor can be allocated as sparse texture with GL_ARB_sparse_texture.
+static bool IsSparseTextureSupported(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Sparse) != 0 &&
+        (desc.type == TextureType::Texture2D || desc.type == TextureType::Texture2DArray || desc.type == TextureType::Texture3D) &&
+        HasExtension(GLExt::ARB_sparse_texture) &&
+        HasExtension(GLExt::ARB_texture_storage)
     );
 }
 
@@ -79,6 +94,7 @@ GLTexture::GLTexture(const TextureDescriptor& desc) :
     Texture         { desc.type, desc.bindFlags                },
     numMipLevels_   { static_cast<GLsizei>(NumMipLevels(desc)) },
     isRenderbuffer_ { IsRenderbufferSufficient(desc)           },
+    isSparse_       { IsSparseTextureSupported(desc)           },
     swizzleFormat_  { MapToGLSwizzleFormat(desc.format)        }
 {
     if (IsRenderbuffer())
@@ -133,9 +149,10 @@ GLTexture::~GLTexture()
     }
     else
     {
-        /* Delete texture and notify state manager as well as texture-view pool since this could be the source for a texture-view */
+        /* Delete texture and notify state manager, texture-view pool, and bindless handle pool since this could be the source for a texture-view */
         GLStateManager::Get().DeleteTexture(id_, GLStateManager::GetTextureTarget(GetType()));
         GLTextureViewPool::Get().NotifyTextureRelease(id_);
+        GLTextureHandlePool::Get().NotifyTextureRelease(id_);
     }
 }
 
@@ -297,6 +314,59 @@ SubresourceFootprint GLTexture::GetSubresourceFootprint(std::uint32_t mipLevel)
     return CalcPackedSubresourceFootprint(desc.type, desc.format, desc.extent, mipLevel, desc.arrayLayers);
 }
 
+bool GLTexture::GetSparseProperties(SparseTextureProperties& outProperties) const
+{
+    #ifdef GL_ARB_sparse_texture
+    if (isSparse_)
+    {
+        /* Query virtual page size for the internal format of this texture (index 0 is used by default) */
+        GLint pageSize[3] = { 1, 1, 1 };
+        const GLenum target = GetGLTexTarget();
+        glGetInternalformativ(target, internalFormat_, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &pageSize[0]);
+        glGetInternalformativ(target, internalFormat_, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &pageSize[1]);
+        glGetInternalformativ(target, internalFormat_, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &pageSize[2]);
+
+        outProperties.tileSize.x        = static_cast<std::uint32_t>(pageSize[0]);
+        outProperties.tileSize.y        = static_cast<std::uint32_t>(pageSize[1]);
+        outProperties.tileSize.z        = static_cast<std::uint32_t>(pageSize[2]);
+        outProperties.numStandardMips   = static_cast<std::uint32_t>(numSparseLevels_);
+        outProperties.tileMemorySize    = GetMemoryFootprint(GetFormat(), static_cast<std::size_t>(pageSize[0] * pageSize[1] * pageSize[2]));
+        return true;
+    }
+    #endif // /GL_ARB_sparse_texture
+    return false;
+}
+
+bool GLTexture::SetMinLOD(float minLOD)
+{
+    /* Renderbuffers cannot be sampled and multi-sampled textures have no MIP-maps */
+    if (IsRenderbuffer() || IsMultiSampleTexture(GetType()))
+        return false;
+
+    /*
+    Use GL_TEXTURE_BASE_LEVEL instead of GL_TEXTURE_MIN_LOD,
+    since the latter is a sampler state that is ignored while a GL sampler object is bound to the same texture unit
+    */
+    const GLint baseLevel = static_cast<GLint>(minLOD);
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+        glTextureParameteri(GetID(), GL_TEXTURE_BASE_LEVEL, baseLevel);
+    else
+    #endif
+    {
+        const GLTextureTarget target = GLStateManager::GetTextureTarget(GetType());
+        GLStateManager::Get().PushBoundTexture(target);
+        {
+            GLStateManager::Get().BindTexture(target, GetID());
+            glTexParameteri(GetGLTexTarget(), GL_TEXTURE_BASE_LEVEL, baseLevel);
+        }
+        GLStateManager::Get().PopBoundTexture();
+    }
+
+    return true;
+}
+
 void GLTexture::BindAndAllocStorage(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
     /* Allocate texture or renderbuffer storage */
@@ -352,19 +422,34 @@ static TextureSwizzleRGBA GetTextureSwizzlePermutationAlpha(const TextureSwizzle
     return permutation;
 }
 
-static void InitializeGLTextureSwizzle(GLenum target, const TextureSwizzleRGBA& swizzle)
+static void InitializeGLTextureSwizzle(GLenum target, GLuint texID, const TextureSwizzleRGBA& swizzle)
 {
-    glTexParameteri(target, GL_TEXTURE_SWIZZLE_R, GLTypes::Map(swizzle.r));
-    glTexParameteri(target, GL_TEXTURE_SWIZZLE_G, GLTypes::Map(swizzle.g));
-    glTexParameteri(target, GL_TEXTURE_SWIZZLE_B, GLTypes::Map(swizzle.b));
-    glTexParameteri(target, GL_TEXTURE_SWIZZLE_A, GLTypes::Map(swizzle.a));
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (texID != 0)
+    {
+        /* Set swizzle parameters of named texture object directly */
+        glTextureParameteri(texID, GL_TEXTURE_SWIZZLE_R, GLTypes::Map(swizzle.r));
+        glTextureParameteri(texID, GL_TEXTURE_SWIZZLE_G, GLTypes::Map(swizzle.g));
+        glTextureParameteri(texID, GL_TEXTURE_SWIZZLE_B, GLTypes::Map(swizzle.b));
+        glTextureParameteri(texID, GL_TEXTURE_SWIZZLE_A, GLTypes::Map(swizzle.a));
+    }
+    else
+    #endif
+    {
+        glTexParameteri(target, GL_TEXTURE_SWIZZLE_R, GLTypes::Map(swizzle.r));
+        glTexParameteri(target, GL_TEXTURE_SWIZZLE_G, GLTypes::Map(swizzle.g));
+        glTexParameteri(target, GL_TEXTURE_SWIZZLE_B, GLTypes::Map(swizzle.b));
+        glTexParameteri(target, GL_TEXTURE_SWIZZLE_A, GLTypes::Map(swizzle.a));
+    }
 }
 
+// Initializes the swizzle parameters of the currently bound GL texture, or of the named texture object 'texID' if non-zero (requires DSA).
 static void InitializeGLTextureSwizzleWithFormat(
     const TextureType           type,
     const GLSwizzleFormat       swizzleFormat,
     const TextureSwizzleRGBA&   swizzle,
-    bool                        ignoreIdentitySwizzle)
+    bool                        ignoreIdentitySwizzle,
+    GLuint                      texID                   = 0)
 {
     /* Ignore initialization if default values can be used */
     if (swizzleFormat == GLSwizzleFormat::RGBA && ignoreIdentitySwizzle)
@@ -375,15 +460,15 @@ static void InitializeGLTextureSwizzleWithFormat(
     switch (swizzleFormat)
     {
         case GLSwizzleFormat::RGBA:
-            InitializeGLTextureSwizzle(target, swizzle);
+            InitializeGLTextureSwizzle(target, texID, swizzle);
             break;
 
         case GLSwizzleFormat::BGRA:
-            InitializeGLTextureSwizzle(target, GetTextureSwizzlePermutationBGRA(swizzle));
+            InitializeGLTextureSwizzle(target, texID, GetTextureSwizzlePermutationBGRA(swizzle));
             break;
 
         case GLSwizzleFormat::Alpha:
-            InitializeGLTextureSwizzle(target, GetTextureSwizzlePermutationAlpha(swizzle));
+            InitializeGLTextureSwizzle(target, texID, GetTextureSwizzlePermutationAlpha(swizzle));
             break;
     }
 }
@@ -907,6 +992,44 @@ static void GLGetTextureImage(
     }
 }
 
+#else // /LLGL_OPENGL
+
+/*
+Reads the texture region with glReadPixels from a temporary read framebuffer, one array layer at a time.
+If a buffer is bound to GL_PIXEL_PACK_BUFFER, the data is written into that buffer without waiting for the GPU.
+*/
+static void GLReadPixelsFromTexture(
+    GLTexture&                  textureGL,
+    const TextureRegion&        region,
+    const MutableImageView&     dstImageView)
+{
+    /* Translate source region into actual texture dimensions */
+    const TextureType   type        = textureGL.GetType();
+    const Offset3D      offset      = CalcTextureOffset(type, region.offset, region.subresource.baseArrayLayer);
+    const Extent3D      extent      = CalcTextureExtent(type, region.extent, region.subresource.numArrayLayers);
+    const GLint         mipLevel    = static_cast<GLint>(region.subresource.baseMipLevel);
+    const std::size_t   layerSize   = dstImageView.dataSize / std::max(1u, extent.z);
+
+    GLStateManager::Get().PushBoundFramebuffer(GLFramebufferTarget::ReadFramebuffer);
+    {
+        GLReadTextureFBO readFBO;
+        for_range(layer, extent.z)
+        {
+            readFBO.Attach(textureGL, mipLevel, Offset3D{ offset.x, offset.y, offset.z + static_cast<std::int32_t>(layer) });
+            glReadPixels(
+                offset.x,
+                offset.y,
+                static_cast<GLsizei>(extent.x),
+                static_cast<GLsizei>(extent.y),
+                GLTypes::Map(dstImageView.format, IsIntDataType(dstImageView.dataType)),
+                GLTypes::Map(dstImageView.dataType),
+                reinterpret_cast<char*>(dstImageView.data) + layerSize * layer
+            );
+        }
+    }
+    GLStateManager::Get().PopBoundFramebuffer();
+}
+
 #endif // /LLGL_OPENGL
 
 void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableImageView& dstImageView, bool restoreBoundTexture)
@@ -941,13 +1064,171 @@ void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableIma
 
         #else
 
-        //TODO: copy texture to unpack buffer, then map buffer range to CPU memory
-        LLGL_TRAP_NOT_IMPLEMENTED();
+        /* GLES has no glGetTexImage, so read pixels from a framebuffer with the texture attached */
+        GLReadPixelsFromTexture(*this, region, dstImageView);
 
         #endif // /LLGL_OPENGL
     }
 }
 
+void GLTexture::TexPageCommitment(const SparseTextureMapping& mapping)
+{
+    #ifdef GL_ARB_sparse_texture
+    if (!isSparse_)
+        return;
+
+    const TextureRegion&    region  = mapping.region;
+    Offset3D                offset  = region.offset;
+    Extent3D                extent  = region.extent;
+
+    if (static_cast<GLint>(region.subresource.baseMipLevel) >= numSparseLevels_)
+    {
+        /* Levels of the MIP tail can only be committed as a whole */
+        offset = Offset3D{};
+        extent = GetMipExtent(region.subresource.baseMipLevel);
+    }
+
+    if (GetType() == TextureType::Texture2DArray)
+    {
+        /* Array layers are addressed by the Z-offset and depth */
+        offset.z        = static_cast<std::int32_t>(region.subresource.baseArrayLayer);
+        extent.z        = region.subresource.numArrayLayers;
+    }
+
+    GLStateManager::Get().BindGLTexture(*this);
+    glTexPageCommitmentARB(
+        GetGLTexTarget(),
+        static_cast<GLint>(region.subresource.baseMipLevel),
+        offset.x,
+        offset.y,
+        offset.z,
+        static_cast<GLsizei>(extent.x),
+        static_cast<GLsizei>(extent.y),
+        static_cast<GLsizei>(extent.z),
+        (mapping.commit ? GL_TRUE : GL_FALSE)
+    );
+    #endif // /GL_ARB_sparse_texture
+}
+
+void GLTexture::ClearTexSubImage(const TextureSubresource& subresource, const ClearValue& clearValue)
+{
+    const Format                format          = GetFormat();
+    const FormatAttributes&     formatAttribs   = GetFormatAttribs(format);
+    const bool                  isTexture3D     = (GetType() == TextureType::Texture3D);
+
+    #ifdef GL_ARB_clear_texture
+    if (!IsRenderbuffer() && HasExtension(GLExt::ARB_clear_texture))
+    {
+        /* Select pixel format and data type that matches the clear value */
+        GLenum      pixelFormat = GL_RGBA;
+        GLenum      dataType    = GL_FLOAT;
+        const void* data        = clearValue.color;
+        GLint       intColor[4] = {};
+        GLuint      depthStencil[2] = {};
+
+        if (IsDepthFormat(format) && IsStencilFormat(format))
+        {
+            /* GL_FLOAT_32_UNSIGNED_INT_24_8_REV stores the float depth in the first and the stencil in the lowest 8 bits of the second word */
+            pixelFormat = GL_DEPTH_STENCIL;
+            dataType    = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+            std::memcpy(&depthStencil[0], &(clearValue.depth), sizeof(float));
+            depthStencil[1] = (clearValue.stencil & 0xFFu);
+            data        = depthStencil;
+        }
+        else if (IsDepthFormat(format))
+        {
+            pixelFormat = GL_DEPTH_COMPONENT;
+            data        = &(clearValue.depth);
+        }
+        else if (IsStencilFormat(format))
+        {
+            pixelFormat = GL_STENCIL_INDEX;
+            dataType    = GL_UNSIGNED_INT;
+            data        = &(clearValue.stencil);
+        }
+        else if ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0)
+        {
+            /* Integer formats must be cleared with integer values, which are truncated from the floating-point clear color */
+            pixelFormat = GL_RGBA_INTEGER;
+            dataType    = ((formatAttribs.flags & FormatFlags::IsUnsigned) != 0 ? GL_UNSIGNED_INT : GL_INT);
+            for_range(i, 4)
+            {
+                if (dataType == GL_UNSIGNED_INT)
+                    intColor[i] = static_cast<GLint>(static_cast<GLuint>(std::max(0.0f, clearValue.color[i])));
+                else
+                    intColor[i] = static_cast<GLint>(clearValue.color[i]);
+            }
+            data = intColor;
+        }
+
+        for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+        {
+            const Extent3D mipExtent = GetMipExtent(mipLevel);
+            const Offset3D offset = (isTexture3D ? Offset3D{} : CalcTextureOffset(GetType(), Offset3D{}, subresource.baseArrayLayer));
+            const Extent3D extent = (isTexture3D ? mipExtent : CalcTextureExtent(GetType(), mipExtent, subresource.numArrayLayers));
+            glClearTexSubImage(
+                GetID(),
+                static_cast<GLint>(mipLevel),
+                offset.x,
+                offset.y,
+                offset.z,
+                static_cast<GLsizei>(extent.x),
+                static_cast<GLsizei>(extent.y),
+                static_cast<GLsizei>(extent.z),
+                pixelFormat,
+                dataType,
+                data
+            );
+        }
+    }
+    else
+    #endif // /GL_ARB_clear_texture
+    {
+        /* Clear each MIP-map level and array layer (or depth slice) with a cached framebuffer */
+        AttachmentClear attachment;
+        {
+            if (IsDepthFormat(format) && IsStencilFormat(format))
+                attachment = AttachmentClear{ clearValue.depth, clearValue.stencil };
+            else if (IsDepthFormat(format))
+                attachment = AttachmentClear{ clearValue.depth };
+            else if (IsStencilFormat(format))
+                attachment = AttachmentClear{ clearValue.stencil };
+            else
+                attachment = AttachmentClear{ clearValue.color, 0 };
+        }
+
+        GLStateManager& stateMngr = GLStateManager::Get();
+        stateMngr.PushBoundFramebuffer(GLFramebufferTarget::DrawFramebuffer);
+        stateMngr.PushState(GLState::ScissorTest);
+        stateMngr.Disable(GLState::ScissorTest);
+        {
+            for_subrange(mipLevel, subresource.baseMipLevel, subresource.baseMipLevel + subresource.numMipLevels)
+            {
+                const std::uint32_t baseLayer = (isTexture3D ? 0u : subresource.baseArrayLayer);
+                const std::uint32_t numLayers = (isTexture3D ? GetMipExtent(mipLevel).z : subresource.numArrayLayers);
+                for_subrange(arrayLayer, baseLayer, baseLayer + numLayers)
+                {
+                    stateMngr.BindFramebufferWithTexture(GLFramebufferTarget::DrawFramebuffer, *this, static_cast<GLint>(mipLevel), static_cast<GLint>(arrayLayer));
+                    stateMngr.ClearBuffers(1, &attachment);
+                }
+            }
+        }
+        stateMngr.PopState();
+        stateMngr.PopBoundFramebuffer();
+    }
+}
+
+void GLTexture::InvalidateTexImage()
+{
+    #ifdef GL_ARB_invalidate_subdata
+    if (!IsRenderbuffer() && HasExtension(GLExt::ARB_invalidate_subdata))
+    {
+        for_range(mipLevel, GetNumMipLevels())
+            glInvalidateTexImage(GetID(), static_cast<GLint>(mipLevel));
+    }
+    #endif // /GL_ARB_invalidate_subdata
+}
+
 GLenum GLTexture::GetGLTexTarget() const
 {
     return GLTypes::Map(GetType());
@@ -1003,20 +1284,6 @@ static ImageFormat MapSwizzleImageFormat(const ImageFormat format)
 
 void GLTexture::AllocTextureStorage(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    /* Bind texture */
-    GLStateManager::Get().BindGLTexture(*this);
-
-    /* Initialize texture parameters for the first time (sampler states not supported for multisample textures) */
-    if (!IsMultiSampleTexture(textureDesc.type))
-    {
-        GLenum target = GLTypes::Map(textureDesc.type);
-        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GetInitialGlTextureMinFilter(textureDesc));
-        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GetInitialGlTextureMagFilter(textureDesc));
-    }
-
-    /* Configure texture swizzling if format is not supported */
-    InitializeGLTextureSwizzleWithFormat(GetType(), swizzleFormat_, {}, true);
-
     /* Convert initial image data for texture swizzle formats */
     ImageView intermediateImageView;
 
@@ -1027,16 +1294,84 @@ void GLTexture::AllocTextureStorage(const TextureDescriptor& textureDesc, const
         initialImage = &intermediateImageView;
     }
 
-    /* Build texture storage and upload image dataa */
-    //GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
-    GLTexImage(textureDesc, initialImage);
+    /* Sparse textures are allocated without initial data, since no pages are committed yet */
+    TextureDescriptor sparseTextureDesc;
+    if (isSparse_)
+    {
+        sparseTextureDesc = textureDesc;
+        sparseTextureDesc.miscFlags |= MiscFlags::NoInitialData;
+        initialImage = nullptr;
+    }
+    const TextureDescriptor& storageDesc = (isSparse_ ? sparseTextureDesc : textureDesc);
 
-    /* Store internal GL format */
-    internalFormat_ = GetTextureInternalFormat();
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access) && HasExtension(GLExt::ARB_texture_storage))
+    {
+        /* Initialize texture parameters of named texture object without touching the binding state */
+        if (!IsMultiSampleTexture(textureDesc.type))
+        {
+            glTextureParameteri(id_, GL_TEXTURE_MIN_FILTER, GetInitialGlTextureMinFilter(textureDesc));
+            glTextureParameteri(id_, GL_TEXTURE_MAG_FILTER, GetInitialGlTextureMagFilter(textureDesc));
+        }
+        InitializeGLTextureSwizzleWithFormat(GetType(), swizzleFormat_, {}, true, id_);
+
+        /* Build texture storage and upload image data */
+        #ifdef GL_ARB_sparse_texture
+        if (isSparse_)
+            glTextureParameteri(id_, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+        #endif
+
+        GLTexImage(storageDesc, initialImage, id_);
+
+        #ifdef GL_ARB_sparse_texture
+        if (isSparse_)
+            glGetTextureParameteriv(id_, GL_NUM_SPARSE_LEVELS_ARB, &numSparseLevels_);
+        #endif
+
+        /* Store internal GL format */
+        internalFormat_ = GetTextureInternalFormat();
+
+        /* Generate MIP-maps if enabled */
+        if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
+            glGenerateTextureMipmap(id_);
+    }
+    else
+    #endif
+    {
+        /* Bind texture */
+        GLStateManager::Get().BindGLTexture(*this);
 
-    /* Generate MIP-maps if enabled */
-    if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
-        GLMipGenerator::Get().GenerateMips(textureDesc.type);
+        /* Initialize texture parameters for the first time (sampler states not supported for multisample textures) */
+        if (!IsMultiSampleTexture(textureDesc.type))
+        {
+            GLenum target = GLTypes::Map(textureDesc.type);
+            glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GetInitialGlTextureMinFilter(textureDesc));
+            glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GetInitialGlTextureMagFilter(textureDesc));
+        }
+
+        /* Configure texture swizzling if format is not supported */
+        InitializeGLTextureSwizzleWithFormat(GetType(), swizzleFormat_, {}, true);
+
+        /* Build texture storage and upload image dataa */
+        #ifdef GL_ARB_sparse_texture
+        if (isSparse_)
+            glTexParameteri(GetGLTexTarget(), GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+        #endif
+
+        GLTexImage(storageDesc, initialImage);
+
+        #ifdef GL_ARB_sparse_texture
+        if (isSparse_)
+            glGetTexParameteriv(GetGLTexTarget(), GL_NUM_SPARSE_LEVELS_ARB, &numSparseLevels_);
+        #endif
+
+        /* Store internal GL format */
+        internalFormat_ = GetTextureInternalFormat();
+
+        /* Generate MIP-maps if enabled */
+        if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
+            GLMipGenerator::Get().GenerateMips(textureDesc.type);
+    }
 }
 
 void GLTexture::AllocRenderbufferStorage(const TextureDescriptor& textureDesc)
@@ -1062,10 +1397,20 @@ static void BindGLTextureNonPersistent(const GLTexture& textureGL)
 
 GLenum GLTexture::GetTextureInternalFormat() const
 {
-    /* Bind texture and query attributes */
     GLint format = 0;
-    BindGLTextureNonPersistent(*this);
-    GLProfile::GetTexParameterInternalFormat(GetGLTexLevelTarget(), &format);
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Query internal format of named texture object directly */
+        glGetTextureLevelParameteriv(id_, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    }
+    else
+    #endif
+    {
+        /* Bind texture and query attributes */
+        BindGLTextureNonPersistent(*this);
+        GLProfile::GetTexParameterInternalFormat(GetGLTexLevelTarget(), &format);
+    }
     return static_cast<GLenum>(format);
 }
 
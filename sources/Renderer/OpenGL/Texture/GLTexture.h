@@ -42,6 +42,10 @@ class GLTexture final : public Texture
 
         void SetDebugName(const char* name) override;
 
+        bool GetSparseProperties(SparseTextureProperties& outProperties) const override;
+
+        bool SetMinLOD(float minLOD) override;
+
     public:
 
         GLTexture(const TextureDescriptor& desc);
@@ -86,6 +90,15 @@ class GLTexture final : public Texture
         // Reads the specified image data from a subregion of this texture.
         void GetTextureSubImage(const TextureRegion& region, const MutableImageView& dstImageView, bool restoreBoundTexture = true);
 
+        // Commits or releases the pages of the specified sparse texture region (glTexPageCommitmentARB).
+        void TexPageCommitment(const SparseTextureMapping& mapping);
+
+        // Clears the specified subresource with glClearTexSubImage or with a temporary framebuffer if that is not supported.
+        void ClearTexSubImage(const TextureSubresource& subresource, const ClearValue& clearValue);
+
+        // Invalidates the contents of all MIP-map levels with glInvalidateTexImage. This has no effect for renderbuffers or if the extension is not supported.
+        void InvalidateTexImage();
+
         // Returns the GL_TEXTURE_TARGET parameter of this texture.
         GLenum GetGLTexTarget() const;
 
@@ -124,6 +137,12 @@ class GLTexture final : public Texture
             return isRenderbuffer_;
         }
 
+        // Returns true if this is a sparse texture, i.e. GL_TEXTURE_SPARSE_ARB is enabled.
+        inline bool IsSparse() const
+        {
+            return isSparse_;
+        }
+
         // Returns the texture swizzle format.
         inline GLSwizzleFormat GetSwizzleFormat() const
         {
@@ -161,6 +180,8 @@ class GLTexture final : public Texture
 
         const GLsizei           numMipLevels_   = 1;
         const bool              isRenderbuffer_ = false;
+        const bool              isSparse_       = false;
+        GLint                   numSparseLevels_= 0;                        // GL_NUM_SPARSE_LEVELS_ARB
         const GLSwizzleFormat   swizzleFormat_  = GLSwizzleFormat::RGBA;    // Identity texture swizzle by default
 
         #ifdef LLGL_OPENGLES3
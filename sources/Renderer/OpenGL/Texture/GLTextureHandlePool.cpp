@@ -0,0 +1,167 @@
+/*
+ * GLTextureHandlePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLTextureHandlePool.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLTextureHandlePool::~GLTextureHandlePool()
+{
+    Clear();
+}
+
+GLTextureHandlePool& GLTextureHandlePool::Get()
+{
+    static GLTextureHandlePool instance;
+    return instance;
+}
+
+bool GLTextureHandlePool::IsSupported()
+{
+    #ifdef GL_ARB_bindless_texture
+    return HasExtension(GLExt::ARB_bindless_texture);
+    #else
+    return false;
+    #endif
+}
+
+void GLTextureHandlePool::Clear()
+{
+    #ifdef GL_ARB_bindless_texture
+    /* Make all remaining handles non-resident and clear container */
+    for (const auto& entry : handles_)
+        glMakeTextureHandleNonResidentARB(entry.handle);
+    #endif
+    handles_.clear();
+}
+
+// Returns the comparison of the specified handle with the handle of the entry for binary search.
+static int CompareTextureHandle(GLuint64 lhs, GLuint64 rhs)
+{
+    if (lhs < rhs)
+        return -1;
+    if (lhs > rhs)
+        return +1;
+    return 0;
+}
+
+GLuint64 GLTextureHandlePool::AcquireHandle(GLuint texID, GLuint samplerID)
+{
+    #ifdef GL_ARB_bindless_texture
+
+    if (texID == 0 || !IsSupported())
+        return 0;
+
+    /* Query handle for texture or texture/sampler pair; GL returns the same handle for the same pair */
+    const GLuint64 handle = (samplerID != 0 ? glGetTextureSamplerHandleARB(texID, samplerID) : glGetTextureHandleARB(texID));
+    if (handle == 0)
+        return 0;
+
+    /* Try to find resident handle */
+    std::size_t insertionIndex = 0;
+    auto* entry = FindInSortedArray<GLTextureHandle>(
+        handles_.data(),
+        handles_.size(),
+        [handle](const GLTextureHandle& rhs)
+        {
+            return CompareTextureHandle(handle, rhs.handle);
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+    {
+        /* Share resident handle */
+        ++entry->refCount;
+    }
+    else
+    {
+        /* Make new handle resident */
+        glMakeTextureHandleResidentARB(handle);
+
+        GLTextureHandle newEntry;
+        {
+            newEntry.handle     = handle;
+            newEntry.texID      = texID;
+            newEntry.samplerID  = samplerID;
+            newEntry.refCount   = 1;
+        }
+        handles_.insert(handles_.begin() + insertionIndex, newEntry);
+    }
+
+    return handle;
+
+    #else
+
+    return 0;
+
+    #endif // /GL_ARB_bindless_texture
+}
+
+void GLTextureHandlePool::ReleaseHandle(GLuint64 handle)
+{
+    #ifdef GL_ARB_bindless_texture
+
+    if (handle == 0)
+        return;
+
+    std::size_t index = 0;
+    auto* entry = FindInSortedArray<GLTextureHandle>(
+        handles_.data(),
+        handles_.size(),
+        [handle](const GLTextureHandle& rhs)
+        {
+            return CompareTextureHandle(handle, rhs.handle);
+        },
+        &index
+    );
+
+    /* Handles that were implicitly deleted with their texture or sampler are no longer in the container */
+    if (entry != nullptr && --entry->refCount == 0)
+    {
+        glMakeTextureHandleNonResidentARB(handle);
+        handles_.erase(handles_.begin() + index);
+    }
+
+    #endif // /GL_ARB_bindless_texture
+}
+
+void GLTextureHandlePool::NotifyTextureRelease(GLuint texID)
+{
+    RemoveAllFromListIf(
+        handles_,
+        [texID](const GLTextureHandle& entry) -> bool
+        {
+            return (entry.texID == texID);
+        }
+    );
+}
+
+void GLTextureHandlePool::NotifySamplerRelease(GLuint samplerID)
+{
+    RemoveAllFromListIf(
+        handles_,
+        [samplerID](const GLTextureHandle& entry) -> bool
+        {
+            return (entry.samplerID == samplerID);
+        }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
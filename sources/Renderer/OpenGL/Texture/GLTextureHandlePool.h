@@ -0,0 +1,94 @@
+/*
+ * GLTextureHandlePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_TEXTURE_HANDLE_POOL_H
+#define LLGL_GL_TEXTURE_HANDLE_POOL_H
+
+
+#include <vector>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Class to manage the residency of bindless GL texture handles (GL_ARB_bindless_texture); used by <GLResourceHeap>.
+Handles are unique per texture/sampler pair, so the same handle can be shared between multiple resource heaps
+but must only be made resident once.
+*/
+class GLTextureHandlePool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLTextureHandlePool& Get();
+
+        // Returns true if the extension "GL_ARB_bindless_texture" is supported.
+        static bool IsSupported();
+
+    public:
+
+        GLTextureHandlePool(const GLTextureHandlePool&) = delete;
+        GLTextureHandlePool& operator = (const GLTextureHandlePool&) = delete;
+
+        GLTextureHandlePool(GLTextureHandlePool&&) = delete;
+        GLTextureHandlePool& operator = (GLTextureHandlePool&&) = delete;
+
+        ~GLTextureHandlePool();
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Returns a resident texture handle for the specified texture and optional sampler and increments its reference counter,
+        or 0 if the extension "GL_ARB_bindless_texture" is not supported.
+        */
+        GLuint64 AcquireHandle(GLuint texID, GLuint samplerID = 0);
+
+        // Decrements the reference counter of the specified handle and makes it non-resident when it is no longer used.
+        void ReleaseHandle(GLuint64 handle);
+
+        // Notifies the handle pool that the specified texture was released. GL implicitly deletes all handles of that texture.
+        void NotifyTextureRelease(GLuint texID);
+
+        // Notifies the handle pool that the specified sampler was released. GL implicitly deletes all handles of that sampler.
+        void NotifySamplerRelease(GLuint samplerID);
+
+    private:
+
+        GLTextureHandlePool() = default;
+
+    private:
+
+        // Resident texture handle with reference counter; managed by <GLTextureHandlePool>
+        struct GLTextureHandle
+        {
+            GLuint64    handle      = 0;
+            GLuint      texID       = 0;
+            GLuint      samplerID   = 0;
+            GLuint      refCount    = 0;
+        };
+
+    private:
+
+        // Container of all resident texture handles, sorted by handle value.
+        std::vector<GLTextureHandle> handles_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
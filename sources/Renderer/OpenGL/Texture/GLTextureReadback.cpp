@@ -0,0 +1,108 @@
+/*
+ * GLTextureReadback.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLTextureReadback.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+GLTextureReadback::~GLTextureReadback()
+{
+    Clear();
+}
+
+bool GLTextureReadback::IsSupported(ImageFormat format)
+{
+    /* Stencil values might be separated on the CPU (see GLGetTexImage), which cannot source from a pixel pack buffer */
+    return (HasExtension(GLExt::ARB_map_buffer_range) && format != ImageFormat::Stencil);
+}
+
+void GLTextureReadback::Clear()
+{
+    if (id_ != 0)
+    {
+        GLStateManager::Get().NotifyBufferRelease(id_, GLBufferTarget::PixelPackBuffer);
+        glDeleteBuffers(1, &id_);
+        id_         = 0;
+        size_       = 0;
+        capacity_   = 0;
+    }
+}
+
+void GLTextureReadback::Begin(GLTexture& textureGL, const TextureRegion& region, const MutableImageView& dstImageView)
+{
+    if (id_ == 0)
+        glGenBuffers(1, &id_);
+
+    size_ = static_cast<GLsizeiptr>(dstImageView.dataSize);
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, id_);
+    {
+        /* Only grow buffer storage; previous readbacks have been resolved before a new one begins */
+        if (size_ > capacity_)
+        {
+            capacity_ = std::max(size_, capacity_ + capacity_ / 2);
+            glBufferData(GL_PIXEL_PACK_BUFFER, capacity_, nullptr, GL_STREAM_READ);
+        }
+
+        /* Write image data to the beginning of the bound pixel pack buffer */
+        MutableImageView packedImageView = dstImageView;
+        packedImageView.data = nullptr;
+        textureGL.GetTextureSubImage(region, packedImageView, false);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+    fence_.Submit();
+}
+
+bool GLTextureReadback::IsComplete()
+{
+    return (id_ != 0 && fence_.Wait(0));
+}
+
+bool GLTextureReadback::Resolve(const MutableImageView& dstImageView)
+{
+    if (id_ == 0 || dstImageView.data == nullptr)
+        return false;
+
+    constexpr GLuint64 infiniteTimeout = ~0ull;
+    if (!fence_.Wait(infiniteTimeout))
+        return false;
+
+    const GLsizeiptr size = std::min(size_, static_cast<GLsizeiptr>(dstImageView.dataSize));
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, id_);
+
+    const void* src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (src != nullptr)
+    {
+        ::memcpy(dstImageView.data, src, static_cast<std::size_t>(size));
+
+        /* Data store can become corrupted while mapped (e.g. on a screen mode change) */
+        if (glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_FALSE)
+            src = nullptr;
+    }
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+    return (src != nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
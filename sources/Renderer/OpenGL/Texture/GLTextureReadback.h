@@ -0,0 +1,72 @@
+/*
+ * GLTextureReadback.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_TEXTURE_READBACK_H
+#define LLGL_GL_TEXTURE_READBACK_H
+
+
+#include "../OpenGL.h"
+#include "../RenderState/GLFence.h"
+#include <LLGL/ImageFlags.h>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+struct TextureRegion;
+
+/*
+Asynchronous texture readback through a pixel pack buffer (PBO).
+Begin() only records the transfer from the texture into the buffer and submits a fence,
+so the caller can poll IsComplete() and resolve the image data once the GPU has finished, without stalling the pipeline.
+*/
+class GLTextureReadback
+{
+
+    public:
+
+        GLTextureReadback() = default;
+        ~GLTextureReadback();
+
+        GLTextureReadback(const GLTextureReadback&) = delete;
+        GLTextureReadback& operator = (const GLTextureReadback&) = delete;
+
+        // Returns true if pixel pack buffers can be mapped and the texture format can be read into a buffer.
+        static bool IsSupported(ImageFormat format);
+
+        // Deletes the pixel pack buffer; GL context must still be current.
+        void Clear();
+
+        // Starts reading the texture region into the pixel pack buffer. The image view's data pointer is ignored.
+        void Begin(GLTexture& textureGL, const TextureRegion& region, const MutableImageView& dstImageView);
+
+        // Returns true if the GPU has finished writing the pixel pack buffer. Does not block.
+        bool IsComplete();
+
+        // Waits until the transfer is complete and copies the image data into the destination. Returns false on failure.
+        bool Resolve(const MutableImageView& dstImageView);
+
+    private:
+
+        GLuint      id_         = 0;
+        GLsizeiptr  size_       = 0;
+        GLsizeiptr  capacity_   = 0;
+        GLFence     fence_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "GLTextureViewPool.h"
 #include "GLTexture.h"
+#include "GLTextureHandlePool.h"
 #include "../RenderState/GLStateManager.h"
 #include "../GLProfile.h"
 #include "../GLTypes.h"
@@ -14,15 +15,14 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
-#include "../../../Core/MacroUtils.h"
-#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-static constexpr std::size_t g_maxNumReusableTextureViews = 16;
+// Maximum number of unreferenced texture views that are kept alive for reuse.
+static constexpr std::size_t g_maxNumUnusedTextureViews = 64;
 
 GLTextureViewPool::~GLTextureViewPool()
 {
@@ -37,120 +37,12 @@ GLTextureViewPool& GLTextureViewPool::Get()
 
 void GLTextureViewPool::Clear()
 {
-    /* Delete all texture view GL objects and clear container */
-    for (const auto& texView : textureViews_)
-    {
-        if (texView.texID != 0)
-            glDeleteTextures(1, &(texView.texID));
-    }
+    /* Delete all texture view GL objects and clear containers */
+    for (const auto& entry : textureViews_)
+        glDeleteTextures(1, &(entry.first));
     textureViews_.clear();
-    numReusableEntries_ = 0;
-}
-
-GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
-{
-    #ifdef GL_ARB_texture_view
-
-    if (!HasExtension(GLExt::ARB_texture_view))
-        return 0;
-
-    /* Compress texture view descriptor for faster comparison and sorting */
-    GLTextureView texView;
-    {
-        texView.sourceTexID = sourceTexID;
-    }
-    CompressTextureViewDesc(texView.view, textureViewDesc);
-
-    /* Try to find texture view with same parameters */
-    std::size_t insertionIndex = 0;
-    auto* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [&texView](const GLTextureView& rhs)
-        {
-            return GLTextureViewPool::CompareTextureViewSWO(texView, rhs);
-        },
-        &insertionIndex
-    );
-
-    if (sharedTexView != nullptr)
-    {
-        /* Create a shared GL texture view from the descriptor */
-        return CreateGLTextureView(*sharedTexView, textureViewDesc, true, restoreBoundTexture);
-    }
-    else
-    {
-        /* Create new GL texture view and store it with insertion sort */
-        GLuint texID = CreateGLTextureView(texView, textureViewDesc, false, restoreBoundTexture);
-        textureViews_.insert(textureViews_.begin() + insertionIndex, texView);
-        return texID;
-    }
-
-    #else
-
-    return 0;
-
-    #endif
-}
-
-void GLTextureViewPool::ReleaseTextureView(GLuint texID)
-{
-    /* Try to find texture by GL texture ID only */
-    std::size_t insertionIndex = 0;
-    GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [texID](const GLTextureView& rhs)
-        {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(texID, rhs.texID);
-            return 0;
-        },
-        &insertionIndex
-    );
-
-    if (sharedTexView != nullptr)
-    {
-        /* Delete GL texture view if the reference counter reaches 0 */
-        ReleaseSharedGLTextureView(*sharedTexView);
-
-        /* Remove unused entries in the array after a given amount has been freed */
-        if (numReusableEntries_ > g_maxNumReusableTextureViews)
-            FlushReusableTextureViews();
-    }
-}
-
-void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
-{
-    /* Move all objects that are about to be removed at the end of the list using 'std::remove' */
-    auto it = std::remove_if(
-        textureViews_.begin(),
-        textureViews_.end(),
-        [sourceTexID](const GLTextureView& entry)
-        {
-            return (entry.texID == 0 || entry.sourceTexID == sourceTexID);
-        }
-    );
-
-    /* Iterate over all elements to be deleted */
-    for (; it != textureViews_.end(); ++it)
-        DeleteGLTextureView(*it);
-
-    /* Finally remove the entries from the list */
-    textureViews_.erase(it, textureViews_.end());
-
-    /* Reset reusable entries, since we just deleted all unused entries */
-    numReusableEntries_ = 0;
-}
-
-
-/*
- * ======= Private: =======
- */
-
-int GLTextureViewPool::CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs)
-{
-    LLGL_COMPARE_MEMBER_SWO( sourceTexID );
-    return CompareCompressedTexViewSWO(lhs.view, rhs.view);
+    sourceTextureViews_.clear();
+    unusedTextureViews_.clear();
 }
 
 #ifdef GL_ARB_texture_view
@@ -207,76 +99,133 @@ static GLuint GenGLTextureView(GLuint sourceTexID, const TextureViewDescriptor&
     return texID;
 }
 
-GLuint GLTextureViewPool::CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture)
+// Uncompresses the specified 4-bit texture type to a 'GLTextureTarget' enum entry.
+static GLTextureTarget UncompressGLTextureTarget(std::uint32_t type)
+{
+    return GLStateManager::GetTextureTarget(static_cast<TextureType>(type));
+}
+
+GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
 {
-    if (isSharedTex)
+    #ifdef GL_ARB_texture_view
+
+    if (!HasExtension(GLExt::ARB_texture_view))
+        return 0;
+
+    /* Compress texture view descriptor for faster comparison */
+    CompressedTexView view;
+    CompressTextureViewDesc(view, textureViewDesc);
+
+    /* Try to find texture view with same parameters among the views of the source texture */
+    std::vector<GLuint>& sourceViews = sourceTextureViews_[sourceTexID];
+    for (GLuint texID : sourceViews)
     {
-        if (texView.texID == 0)
+        GLTextureView& texView = textureViews_[texID];
+        if (CompareCompressedTexViewSWO(texView.view, view) == 0)
         {
-            /* Create new GL texture view if ID is invalid */
-            GLuint texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
-            RetainSharedGLTextureView(texView, texID);
+            /* Reclaim unused texture view from LRU list */
+            if (texView.refCount == 0)
+                unusedTextureViews_.erase(texView.unusedIt);
+            texView.refCount++;
+            return texID;
         }
     }
-    else
+
+    /* Create new GL texture view */
+    const GLuint texID = GenGLTextureView(sourceTexID, textureViewDesc, restoreBoundTexture);
+    if (texID != 0)
     {
-        /* Create a new GL texture view and initialize reference counter */
-        texView.texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
+        GLTextureView& texView = textureViews_[texID];
+        {
+            texView.sourceTexID = sourceTexID;
+            texView.refCount    = 1;
+            texView.view        = view;
+        }
+        sourceViews.push_back(texID);
     }
+    return texID;
 
-    /* Increment reference counter for the shared texture view */
-    texView.refCount++;
-
-    return texView.texID;
-}
+    #else
 
-// Uncompresses the specified 4-bit texture type to a 'GLTextureTarget' enum entry.
-static GLTextureTarget UncompressGLTextureTarget(std::uint32_t type)
-{
-    return GLStateManager::GetTextureTarget(static_cast<TextureType>(type));
-}
+    return 0;
 
-void GLTextureViewPool::DeleteGLTextureView(GLTextureView& texView)
-{
-    GLStateManager::Get().DeleteTexture(texView.texID, UncompressGLTextureTarget(texView.view.type));
+    #endif
 }
 
-void GLTextureViewPool::RetainSharedGLTextureView(GLTextureView& texView, GLuint texID)
+void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 {
-    if (texView.texID == 0)
+    auto it = textureViews_.find(texID);
+    if (it != textureViews_.end() && it->second.refCount > 0)
     {
-        /* If this is shared texture view, reclaim one of the reusable entries */
-        texView.texID = texID;
-        if (numReusableEntries_ > 0)
-            --numReusableEntries_;
+        /* Move texture view into LRU list once the reference counter reaches 0 */
+        GLTextureView& texView = it->second;
+        texView.refCount--;
+        if (texView.refCount == 0)
+        {
+            unusedTextureViews_.push_front(texID);
+            texView.unusedIt = unusedTextureViews_.begin();
+            EvictUnusedTextureViews();
+        }
     }
 }
 
-void GLTextureViewPool::ReleaseSharedGLTextureView(GLTextureView& texView)
+void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
 {
-    if (texView.refCount > 0)
+    auto it = sourceTextureViews_.find(sourceTexID);
+    if (it != sourceTextureViews_.end())
     {
-        texView.refCount--;
-        if (texView.refCount == 0)
+        /* Delete all texture views that were derived from the released texture */
+        for (GLuint texID : it->second)
         {
-            DeleteGLTextureView(texView);
-            ++numReusableEntries_;
+            auto viewIt = textureViews_.find(texID);
+            if (viewIt != textureViews_.end())
+            {
+                DeleteGLTextureView(texID, viewIt->second);
+                textureViews_.erase(viewIt);
+            }
         }
+        sourceTextureViews_.erase(it);
     }
 }
 
-void GLTextureViewPool::FlushReusableTextureViews()
+
+/*
+ * ======= Private: =======
+ */
+
+void GLTextureViewPool::DeleteGLTextureView(GLuint texID, GLTextureView& texView)
+{
+    if (texView.refCount == 0)
+        unusedTextureViews_.erase(texView.unusedIt);
+    GLStateManager::Get().DeleteTexture(texID, UncompressGLTextureTarget(texView.view.type));
+    GLTextureHandlePool::Get().NotifyTextureRelease(texID);
+}
+
+void GLTextureViewPool::EvictUnusedTextureViews()
 {
-    if (numReusableEntries_ > 0)
+    while (unusedTextureViews_.size() > g_maxNumUnusedTextureViews)
     {
-        RemoveAllFromListIf(
-            textureViews_,
-            [](const GLTextureView& entry)
-            {
-                return (entry.texID == 0);
-            }
-        );
-        numReusableEntries_ = 0;
+        /* Delete least recently used texture view and remove it from the index of its source texture */
+        const GLuint texID = unusedTextureViews_.back();
+        auto viewIt = textureViews_.find(texID);
+        if (viewIt == textureViews_.end())
+        {
+            unusedTextureViews_.pop_back();
+            continue;
+        }
+
+        const GLuint sourceTexID = viewIt->second.sourceTexID;
+        DeleteGLTextureView(texID, viewIt->second);
+        textureViews_.erase(viewIt);
+
+        auto sourceIt = sourceTextureViews_.find(sourceTexID);
+        if (sourceIt != sourceTextureViews_.end())
+        {
+            std::vector<GLuint>& sourceViews = sourceIt->second;
+            RemoveFromList(sourceViews, texID);
+            if (sourceViews.empty())
+                sourceTextureViews_.erase(sourceIt);
+        }
     }
 }
 
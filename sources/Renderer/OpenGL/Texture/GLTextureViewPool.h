@@ -12,6 +12,8 @@
 #include <LLGL/TextureFlags.h>
 #include <cstdint>
 #include <vector>
+#include <list>
+#include <unordered_map>
 #include "../OpenGL.h"
 #include "../../TextureUtils.h"
 
@@ -20,7 +22,10 @@ namespace LLGL
 {
 
 
-// Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>
+/*
+Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>
+Views that are no longer referenced are kept in a bounded LRU list, so they can be reused without another call to 'glTextureView'.
+*/
 class GLTextureViewPool
 {
 
@@ -48,7 +53,7 @@ class GLTextureViewPool
         */
         GLuint CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture = true);
 
-        // Release the texture view that was created with CreateTextureView.
+        // Release the texture view that was created with CreateTextureView. Unused views are deleted once they are evicted from the LRU list.
         void ReleaseTextureView(GLuint texID);
 
         /*
@@ -66,37 +71,28 @@ class GLTextureViewPool
         // Structure that stores a GL texture that was generated with 'glTextureView'; managed by <GLTextureViewPool>
         struct GLTextureView
         {
-            GLuint              texID       = 0;
-            GLuint              sourceTexID = 0;
-            GLuint              refCount    = 0;
-            CompressedTexView   view        = {};
+            GLuint                      sourceTexID = 0;
+            GLuint                      refCount    = 0;
+            CompressedTexView           view        = {};
+            std::list<GLuint>::iterator unusedIt;           // Position in the LRU list of unused views; only valid if 'refCount' is 0.
         };
 
-        // Compares the two texture views in a strict-weak-order (SWO).
-        static int CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs);
-
-        // Creats a new GL texture view and stores it in the specified view entry.
-        GLuint CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture);
-
-        // Deletes the specified GL texture view.
-        void DeleteGLTextureView(GLTextureView& texView);
+        // Deletes the specified GL texture view and removes it from the LRU list if it is unused. This does not remove the entry from the containers.
+        void DeleteGLTextureView(GLuint texID, GLTextureView& texView);
 
-        // Assignes the specified texture view a new GL texture ID and reclaims it as a reusable entry.
-        void RetainSharedGLTextureView(GLTextureView& texView, GLuint texID);
-
-        // Release the specified GL texture object and marks the entry as reusable.
-        void ReleaseSharedGLTextureView(GLTextureView& texView);
-
-        // Removes all empty entries from the texture view list.
-        void FlushReusableTextureViews();
+        // Deletes the least recently used texture views until the number of unused views is within its limit.
+        void EvictUnusedTextureViews();
 
     private:
 
-        // Container of all managed texture views.
-        std::vector<GLTextureView>  textureViews_;
+        // All managed texture views indexed by their GL texture ID.
+        std::unordered_map<GLuint, GLTextureView>           textureViews_;
+
+        // IDs of all texture views indexed by their source texture ID. Views of the same source texture are compared linearly.
+        std::unordered_map<GLuint, std::vector<GLuint>>     sourceTextureViews_;
 
-        // Number of textures that are already freed, but not removed from the texture view array yet.
-        std::size_t                 numReusableEntries_ = 0;
+        // IDs of all texture views with a reference count of zero, ordered from most to least recently released.
+        std::list<GLuint>                                   unusedTextureViews_;
 
 };
 
@@ -0,0 +1,386 @@
+/*
+ * PersistentPipelineCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "PersistentPipelineCache.h"
+#include "../Platform/MappedFile.h"
+#include "../Core/CPUProfilerUtils.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+#include "../Core/PackStructPush.inl"
+
+struct PersistentPipelineCacheHeader
+{
+    char            magic[4];   // "LLPC"
+    std::uint32_t   version;    // persistentPipelineCacheVersion
+    std::uint64_t   cacheID;    // Hash of the renderer info
+    std::uint32_t   numEntries; // Number of entries that follow this header, sorted by key
+    std::uint32_t   reserved;
+}
+LLGL_PACK_STRUCT;
+
+struct PersistentPipelineCacheEntry
+{
+    std::uint64_t   key;
+    std::uint64_t   offset;     // Offset (in bytes) from the beginning of the file
+    std::uint64_t   size;
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+// Increment this version whenever the file format or the blob format of any backend changes.
+static constexpr std::uint32_t persistentPipelineCacheVersion = 1;
+
+static constexpr char persistentPipelineCacheMagic[4] = { 'L', 'L', 'P', 'C' };
+
+
+/*
+ * PersistentPipelineCacheKey class
+ */
+
+void PersistentPipelineCacheKey::AppendBytes(const void* data, std::size_t size)
+{
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    for_range(i, size)
+    {
+        hash_ ^= bytes[i];
+        hash_ *= 0x00000100000001B3ull;
+    }
+}
+
+void PersistentPipelineCacheKey::AppendString(const char* str)
+{
+    const std::size_t len = (str != nullptr ? ::strlen(str) : 0);
+    Append(static_cast<std::uint64_t>(len));
+    AppendBytes(str, len);
+}
+
+void PersistentPipelineCacheKey::AppendDescriptor(const GraphicsPipelineDescriptor& desc)
+{
+    Append(desc.indexFormat);
+    Append(desc.primitiveTopology);
+
+    Append(static_cast<std::uint64_t>(desc.viewports.size()));
+    for (const Viewport& viewport : desc.viewports)
+    {
+        Append(viewport.x);
+        Append(viewport.y);
+        Append(viewport.width);
+        Append(viewport.height);
+        Append(viewport.minDepth);
+        Append(viewport.maxDepth);
+    }
+
+    Append(static_cast<std::uint64_t>(desc.scissors.size()));
+    for (const Scissor& scissor : desc.scissors)
+    {
+        Append(scissor.x);
+        Append(scissor.y);
+        Append(scissor.width);
+        Append(scissor.height);
+    }
+
+    Append(desc.depth.testEnabled);
+    Append(desc.depth.writeEnabled);
+    Append(desc.depth.compareOp);
+
+    Append(desc.stencil.testEnabled);
+    Append(desc.stencil.referenceDynamic);
+    for (const StencilFaceDescriptor* face : { &desc.stencil.front, &desc.stencil.back })
+    {
+        Append(face->stencilFailOp);
+        Append(face->depthFailOp);
+        Append(face->depthPassOp);
+        Append(face->compareOp);
+        Append(face->readMask);
+        Append(face->writeMask);
+        Append(face->reference);
+    }
+
+    Append(desc.rasterizer.polygonMode);
+    Append(desc.rasterizer.cullMode);
+    Append(desc.rasterizer.depthBias.constantFactor);
+    Append(desc.rasterizer.depthBias.slopeFactor);
+    Append(desc.rasterizer.depthBias.clamp);
+    Append(desc.rasterizer.frontCCW);
+    Append(desc.rasterizer.discardEnabled);
+    Append(desc.rasterizer.depthClampEnabled);
+    Append(desc.rasterizer.scissorTestEnabled);
+    Append(desc.rasterizer.multiSampleEnabled);
+    Append(desc.rasterizer.antiAliasedLineEnabled);
+    Append(desc.rasterizer.conservativeRasterization);
+    Append(desc.rasterizer.lineWidth);
+
+    Append(desc.blend.alphaToCoverageEnabled);
+    Append(desc.blend.independentBlendEnabled);
+    Append(desc.blend.sampleMask);
+    Append(desc.blend.logicOp);
+    Append(desc.blend.blendFactor);
+    Append(desc.blend.blendFactorDynamic);
+    for (const BlendTargetDescriptor& target : desc.blend.targets)
+    {
+        Append(target.blendEnabled);
+        Append(target.srcColor);
+        Append(target.dstColor);
+        Append(target.colorArithmetic);
+        Append(target.srcAlpha);
+        Append(target.dstAlpha);
+        Append(target.alphaArithmetic);
+        Append(target.colorMask);
+    }
+
+    Append(desc.tessellation.partition);
+    Append(desc.tessellation.maxTessFactor);
+    Append(desc.tessellation.outputWindingCCW);
+}
+
+
+/*
+ * PersistentPipelineCache class
+ */
+
+static std::uint64_t GetPersistentPipelineCacheID(const RendererInfo& info)
+{
+    PersistentPipelineCacheKey cacheID;
+    cacheID.AppendString(info.rendererName.c_str());
+    cacheID.AppendString(info.deviceName.c_str());
+    cacheID.AppendString(info.vendorName.c_str());
+    cacheID.AppendString(info.shadingLanguageName.c_str());
+    cacheID.Append(static_cast<std::uint64_t>(info.pipelineCacheID.size()));
+    cacheID.AppendBytes(info.pipelineCacheID.data(), info.pipelineCacheID.size());
+    return cacheID.Get();
+}
+
+PersistentPipelineCache::PersistentPipelineCache(const char* filename, const RendererInfo& rendererInfo) :
+    filename_ { filename                                   },
+    cacheID_  { GetPersistentPipelineCacheID(rendererInfo) }
+{
+    if (!MapCacheFile())
+        mappedFile_.reset();
+}
+
+PersistentPipelineCache::~PersistentPipelineCache()
+{
+    if (!newEntries_.empty() && !WriteCacheFile())
+        Log::Errorf("failed to write persistent pipeline cache: %s\n", filename_.c_str());
+}
+
+Blob PersistentPipelineCache::Find(std::uint64_t key) const
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "PersistentPipelineCache");
+
+    /* Return copy of new entries, since they can be replaced by another thread */
+    auto it = newEntries_.find(key);
+    if (it != newEntries_.end())
+        return Blob::CreateCopy(it->second);
+
+    /* Return weak reference to mapped entries, since the mapping remains valid for the lifetime of this cache */
+    if (const PersistentPipelineCacheEntry* entry = FindMappedEntry(key))
+        return GetMappedBlob(*entry);
+
+    return Blob{};
+}
+
+static bool IsBlobEqual(const Blob& lhs, const Blob& rhs)
+{
+    return (lhs.GetSize() == rhs.GetSize() && ::memcmp(lhs.GetData(), rhs.GetData(), lhs.GetSize()) == 0);
+}
+
+void PersistentPipelineCache::Store(std::uint64_t key, Blob&& blob)
+{
+    if (!blob)
+        return;
+
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "PersistentPipelineCache");
+
+    auto it = newEntries_.find(key);
+    if (it != newEntries_.end())
+    {
+        if (!IsBlobEqual(it->second, blob))
+            it->second = std::move(blob);
+    }
+    else
+    {
+        const PersistentPipelineCacheEntry* entry = FindMappedEntry(key);
+        if (entry == nullptr || !IsBlobEqual(GetMappedBlob(*entry), blob))
+            newEntries_[key] = std::move(blob);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool PersistentPipelineCache::MapCacheFile()
+{
+    mappedFile_ = MappedFile::Open(filename_.c_str());
+    if (!mappedFile_)
+        return false;
+
+    /* Validate header; a cache file of another device, driver, or version is discarded entirely */
+    const std::size_t fileSize = mappedFile_->GetSize();
+    if (fileSize < sizeof(PersistentPipelineCacheHeader))
+        return false;
+
+    const PersistentPipelineCacheHeader* header = static_cast<const PersistentPipelineCacheHeader*>(mappedFile_->GetData());
+    if (::memcmp(header->magic, persistentPipelineCacheMagic, sizeof(header->magic)) != 0 ||
+        header->version != persistentPipelineCacheVersion ||
+        header->cacheID != cacheID_)
+    {
+        return false;
+    }
+
+    const std::size_t tableSize = static_cast<std::size_t>(header->numEntries) * sizeof(PersistentPipelineCacheEntry);
+    if (tableSize > fileSize - sizeof(PersistentPipelineCacheHeader))
+        return false;
+
+    /* Only keep a reference to the entry table; the blobs are read on demand */
+    mappedEntries_      = reinterpret_cast<const PersistentPipelineCacheEntry*>(header + 1);
+    numMappedEntries_   = header->numEntries;
+
+    return true;
+}
+
+const PersistentPipelineCacheEntry* PersistentPipelineCache::FindMappedEntry(std::uint64_t key) const
+{
+    const PersistentPipelineCacheEntry* entriesEnd = mappedEntries_ + numMappedEntries_;
+    const PersistentPipelineCacheEntry* entry = std::lower_bound(
+        mappedEntries_,
+        entriesEnd,
+        key,
+        [](const PersistentPipelineCacheEntry& lhs, std::uint64_t rhs) -> bool
+        {
+            return (lhs.key < rhs);
+        }
+    );
+
+    if (entry == entriesEnd || entry->key != key)
+        return nullptr;
+
+    /* Ignore entries that exceed the mapped file, e.g. for truncated files */
+    const std::uint64_t fileSize = mappedFile_->GetSize();
+    if (entry->offset > fileSize || entry->size > fileSize - entry->offset)
+        return nullptr;
+
+    return entry;
+}
+
+Blob PersistentPipelineCache::GetMappedBlob(const PersistentPipelineCacheEntry& entry) const
+{
+    const char* data = static_cast<const char*>(mappedFile_->GetData()) + entry.offset;
+    return Blob::CreateWeakRef(data, static_cast<std::size_t>(entry.size));
+}
+
+bool PersistentPipelineCache::WriteCacheFile()
+{
+    /* Merge mapped and new entries into a single table sorted by key; new entries replace mapped entries */
+    std::vector<std::uint64_t> newKeys;
+    newKeys.reserve(newEntries_.size());
+    for (const auto& entry : newEntries_)
+        newKeys.push_back(entry.first);
+    std::sort(newKeys.begin(), newKeys.end());
+
+    std::vector<PersistentPipelineCacheEntry>   entries;
+    std::vector<Blob>                           blobs;
+
+    entries.reserve(numMappedEntries_ + newKeys.size());
+    blobs.reserve(numMappedEntries_ + newKeys.size());
+
+    auto AppendEntry = [&entries, &blobs](std::uint64_t key, Blob&& blob)
+    {
+        PersistentPipelineCacheEntry entry;
+        {
+            entry.key       = key;
+            entry.offset    = 0;
+            entry.size      = blob.GetSize();
+        }
+        entries.push_back(entry);
+        blobs.push_back(std::move(blob));
+    };
+
+    std::size_t newKeyIndex = 0;
+    for_range(i, numMappedEntries_)
+    {
+        const std::uint64_t mappedKey = mappedEntries_[i].key;
+        while (newKeyIndex < newKeys.size() && newKeys[newKeyIndex] <= mappedKey)
+        {
+            const std::uint64_t newKey = newKeys[newKeyIndex++];
+            AppendEntry(newKey, Blob::CreateWeakRef(newEntries_[newKey].GetData(), newEntries_[newKey].GetSize()));
+        }
+        if (!entries.empty() && entries.back().key == mappedKey)
+            continue;
+        if (const PersistentPipelineCacheEntry* entry = FindMappedEntry(mappedKey))
+            AppendEntry(mappedKey, GetMappedBlob(*entry));
+    }
+    while (newKeyIndex < newKeys.size())
+    {
+        const std::uint64_t newKey = newKeys[newKeyIndex++];
+        AppendEntry(newKey, Blob::CreateWeakRef(newEntries_[newKey].GetData(), newEntries_[newKey].GetSize()));
+    }
+
+    /* Assign offsets of blobs that follow the entry table */
+    PersistentPipelineCacheHeader header;
+    {
+        ::memcpy(header.magic, persistentPipelineCacheMagic, sizeof(header.magic));
+        header.version      = persistentPipelineCacheVersion;
+        header.cacheID      = cacheID_;
+        header.numEntries   = static_cast<std::uint32_t>(entries.size());
+        header.reserved     = 0;
+    }
+    std::uint64_t offset = sizeof(header) + entries.size() * sizeof(PersistentPipelineCacheEntry);
+    for (PersistentPipelineCacheEntry& entry : entries)
+    {
+        entry.offset = offset;
+        offset += entry.size;
+    }
+
+    /* Write into temporary file first, since the previous file is still mapped */
+    const std::string tempFilename = filename_ + ".tmp";
+    {
+        std::ofstream file{ tempFilename, std::ios::out | std::ios::binary | std::ios::trunc };
+        if (!file.good())
+            return false;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(PersistentPipelineCacheEntry));
+        for (const Blob& blob : blobs)
+            file.write(static_cast<const char*>(blob.GetData()), blob.GetSize());
+
+        if (!file.good())
+            return false;
+    }
+
+    /* Release mapping and replace previous file */
+    blobs.clear();
+    mappedEntries_      = nullptr;
+    numMappedEntries_   = 0;
+    mappedFile_.reset();
+
+    ::remove(filename_.c_str());
+    return (::rename(tempFilename.c_str(), filename_.c_str()) == 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,128 @@
+/*
+ * PersistentPipelineCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PERSISTENT_PIPELINE_CACHE_H
+#define LLGL_PERSISTENT_PIPELINE_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+class MappedFile;
+struct RendererInfo;
+struct GraphicsPipelineDescriptor;
+struct PersistentPipelineCacheEntry;
+
+// FNV-1a hash accumulator to generate the keys of persistent pipeline cache entries.
+class LLGL_EXPORT PersistentPipelineCacheKey
+{
+
+    public:
+
+        // Appends the specified bytes to the hash.
+        void AppendBytes(const void* data, std::size_t size);
+
+        // Appends the specified null-terminated string to the hash. Null pointers are treated as empty strings.
+        void AppendString(const char* str);
+
+        /*
+        Appends all fixed-function states of the specified graphics PSO descriptor, i.e. everything but the render system objects.
+        Shaders, pipeline layouts, and render passes must be appended by the backend, since only the backend knows their content.
+        */
+        void AppendDescriptor(const GraphicsPipelineDescriptor& desc);
+
+        // Appends the specified value to the hash. Only types without padding bytes must be appended.
+        template <typename T>
+        inline void Append(const T& value)
+        {
+            AppendBytes(&value, sizeof(value));
+        }
+
+        // Returns the final hash value.
+        inline std::uint64_t Get() const
+        {
+            return hash_;
+        }
+
+    private:
+
+        std::uint64_t hash_ = 0xCBF29CE484222325ull;
+
+};
+
+/*
+Render system wide pipeline cache that is stored in a single file.
+The file is memory mapped and each entry is only read from disk when it is requested via Find.
+The entire file is discarded if it was written for a different renderer, device, or driver (see RendererInfo::pipelineCacheID).
+New entries are written back to the file when this cache is destroyed.
+All functions are thread-safe, since PSOs can be created concurrently.
+*/
+class LLGL_EXPORT PersistentPipelineCache
+{
+
+    public:
+
+        PersistentPipelineCache(const char* filename, const RendererInfo& rendererInfo);
+        ~PersistentPipelineCache();
+
+        PersistentPipelineCache(const PersistentPipelineCache&) = delete;
+        PersistentPipelineCache& operator = (const PersistentPipelineCache&) = delete;
+
+        // Returns the blob of the entry with the specified key or an empty blob if there is no such entry.
+        Blob Find(std::uint64_t key) const;
+
+        // Stores the blob for the specified key. Does nothing if the blob is empty or equal to the existing entry.
+        void Store(std::uint64_t key, Blob&& blob);
+
+    private:
+
+        // Maps the cache file into memory and validates its header. Returns false if the file cannot be used.
+        bool MapCacheFile();
+
+        // Returns the mapped entry with the specified key or null if there is no such entry.
+        const PersistentPipelineCacheEntry* FindMappedEntry(std::uint64_t key) const;
+
+        // Returns the mapped blob of the specified entry.
+        Blob GetMappedBlob(const PersistentPipelineCacheEntry& entry) const;
+
+        // Writes all mapped and new entries into the cache file. Returns false on failure.
+        bool WriteCacheFile();
+
+    private:
+
+        std::string                                 filename_;
+        std::uint64_t                               cacheID_            = 0;
+
+        std::unique_ptr<MappedFile>                 mappedFile_;
+        const PersistentPipelineCacheEntry*         mappedEntries_      = nullptr;
+        std::uint32_t                               numMappedEntries_   = 0;
+
+        std::unordered_map<std::uint64_t, Blob>     newEntries_;
+        mutable std::mutex                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,246 @@
+/*
+ * PipelineStateSignature.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/PipelineStateSignature.h>
+#include <LLGL/Utils/ForRange.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Signature type identifiers in the first word, so graphics and compute signatures never compare equal.
+enum PipelineStateSignatureType : std::uint32_t
+{
+    PipelineStateSignatureType_Graphics = 1,
+    PipelineStateSignatureType_Compute  = 2,
+};
+
+// Packs up to four enumeration values into a single word. All PSO enumerations have less than 256 entries.
+template <typename T0, typename T1 = std::uint8_t, typename T2 = std::uint8_t, typename T3 = std::uint8_t>
+static std::uint32_t PackEnums(T0 e0, T1 e1 = T1(0), T2 e2 = T2(0), T3 e3 = T3(0))
+{
+    return
+    (
+        (static_cast<std::uint32_t>(e0) & 0xFFu)         |
+        (static_cast<std::uint32_t>(e1) & 0xFFu) <<  8u |
+        (static_cast<std::uint32_t>(e2) & 0xFFu) << 16u |
+        (static_cast<std::uint32_t>(e3) & 0xFFu) << 24u
+    );
+}
+
+PipelineStateSignature::PipelineStateSignature(const GraphicsPipelineDescriptor& desc)
+{
+    Build(desc);
+}
+
+PipelineStateSignature::PipelineStateSignature(const ComputePipelineDescriptor& desc)
+{
+    Build(desc);
+}
+
+void PipelineStateSignature::Build(const GraphicsPipelineDescriptor& desc)
+{
+    data_.clear();
+    data_.push_back(PipelineStateSignatureType_Graphics);
+
+    /* Append render system objects by their identity */
+    AppendObject(desc.pipelineLayout);
+    AppendObject(desc.renderPass);
+    AppendObject(desc.vertexShader);
+    AppendObject(desc.tessControlShader);
+    AppendObject(desc.tessEvaluationShader);
+    AppendObject(desc.geometryShader);
+    AppendObject(desc.taskShader);
+    AppendObject(desc.meshShader);
+    AppendObject(desc.fragmentShader);
+
+    /* Append all boolean states as a single bitfield */
+    const bool flags[] =
+    {
+        desc.depth.testEnabled,
+        desc.depth.writeEnabled,
+        desc.stencil.testEnabled,
+        desc.stencil.referenceDynamic,
+        desc.rasterizer.frontCCW,
+        desc.rasterizer.discardEnabled,
+        desc.rasterizer.depthClampEnabled,
+        desc.rasterizer.scissorTestEnabled,
+        desc.rasterizer.multiSampleEnabled,
+        desc.rasterizer.antiAliasedLineEnabled,
+        desc.rasterizer.conservativeRasterization,
+        desc.blend.alphaToCoverageEnabled,
+        desc.blend.independentBlendEnabled,
+        desc.blend.blendFactorDynamic,
+        desc.tessellation.outputWindingCCW,
+    };
+
+    std::uint32_t flagBits = 0;
+    for_range(i, sizeof(flags)/sizeof(flags[0]))
+    {
+        if (flags[i])
+            flagBits |= (1u << i);
+    }
+    data_.push_back(flagBits);
+
+    /* Append enumerations */
+    data_.push_back(PackEnums(desc.indexFormat, desc.primitiveTopology, desc.rasterizer.polygonMode, desc.rasterizer.cullMode));
+    data_.push_back(PackEnums(desc.depth.compareOp, desc.blend.logicOp, desc.tessellation.partition));
+
+    /* Append stencil faces only if the stencil test is enabled */
+    if (desc.stencil.testEnabled)
+    {
+        for (const StencilFaceDescriptor* face : { &desc.stencil.front, &desc.stencil.back })
+        {
+            data_.push_back(PackEnums(face->stencilFailOp, face->depthFailOp, face->depthPassOp, face->compareOp));
+            data_.push_back(face->readMask);
+            data_.push_back(face->writeMask);
+            data_.push_back(desc.stencil.referenceDynamic ? 0u : face->reference);
+        }
+    }
+
+    /* Append rasterizer states */
+    AppendFloat(desc.rasterizer.depthBias.constantFactor);
+    AppendFloat(desc.rasterizer.depthBias.slopeFactor);
+    AppendFloat(desc.rasterizer.depthBias.clamp);
+    AppendFloat(desc.rasterizer.lineWidth);
+
+    /* Append blend states; blend factor is only considered if it's not dynamic */
+    data_.push_back(desc.blend.sampleMask);
+    if (!desc.blend.blendFactorDynamic)
+    {
+        for (float factor : desc.blend.blendFactor)
+            AppendFloat(factor);
+    }
+
+    const std::size_t numBlendTargets = (desc.blend.independentBlendEnabled ? LLGL_MAX_NUM_COLOR_ATTACHMENTS : 1);
+    for_range(i, numBlendTargets)
+    {
+        /* Blend operations are irrelevant for disabled blend targets */
+        const BlendTargetDescriptor& target = desc.blend.targets[i];
+        if (target.blendEnabled)
+        {
+            data_.push_back(PackEnums(target.srcColor, target.dstColor, target.colorArithmetic, target.colorMask));
+            data_.push_back(PackEnums(target.srcAlpha, target.dstAlpha, target.alphaArithmetic, 1u));
+        }
+        else
+        {
+            data_.push_back(PackEnums(0u, 0u, 0u, target.colorMask));
+            data_.push_back(0u);
+        }
+    }
+
+    data_.push_back(desc.tessellation.maxTessFactor);
+
+    /* Append static viewports and scissors */
+    data_.push_back(static_cast<std::uint32_t>(desc.viewports.size()));
+    for (const Viewport& viewport : desc.viewports)
+    {
+        AppendFloat(viewport.x);
+        AppendFloat(viewport.y);
+        AppendFloat(viewport.width);
+        AppendFloat(viewport.height);
+        AppendFloat(viewport.minDepth);
+        AppendFloat(viewport.maxDepth);
+    }
+
+    data_.push_back(static_cast<std::uint32_t>(desc.scissors.size()));
+    for (const Scissor& scissor : desc.scissors)
+    {
+        data_.push_back(static_cast<std::uint32_t>(scissor.x));
+        data_.push_back(static_cast<std::uint32_t>(scissor.y));
+        data_.push_back(static_cast<std::uint32_t>(scissor.width));
+        data_.push_back(static_cast<std::uint32_t>(scissor.height));
+    }
+
+    UpdateHash();
+}
+
+void PipelineStateSignature::Build(const ComputePipelineDescriptor& desc)
+{
+    data_.clear();
+    data_.push_back(PipelineStateSignatureType_Compute);
+    AppendObject(desc.pipelineLayout);
+    AppendObject(desc.computeShader);
+    UpdateHash();
+}
+
+int PipelineStateSignature::CompareSWO(const PipelineStateSignature& lhs, const PipelineStateSignature& rhs)
+{
+    /* Compare hash first, so the serialized data only needs to be compared on hash collisions */
+    if (lhs.GetHash() < rhs.GetHash())
+        return -1;
+    if (lhs.GetHash() > rhs.GetHash())
+        return +1;
+    if (lhs.GetSize() < rhs.GetSize())
+        return -1;
+    if (lhs.GetSize() > rhs.GetSize())
+        return +1;
+    if (lhs.GetSize() == 0)
+        return 0;
+    return std::memcmp(lhs.GetData(), rhs.GetData(), lhs.GetSize() * sizeof(std::uint32_t));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void PipelineStateSignature::AppendObject(const void* obj)
+{
+    const std::uint64_t addr = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(obj));
+    data_.push_back(static_cast<std::uint32_t>(addr));
+    data_.push_back(static_cast<std::uint32_t>(addr >> 32));
+}
+
+void PipelineStateSignature::AppendFloat(float value)
+{
+    /* Normalize negative zero, so it matches positive zero */
+    if (value == 0.0f)
+        value = 0.0f;
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    data_.push_back(bits);
+}
+
+void PipelineStateSignature::UpdateHash()
+{
+    /* FNV-1a over 32-bit words with a final avalanche step, since the words are mostly small integers */
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (std::uint32_t word : data_)
+    {
+        hash ^= word;
+        hash *= 0x00000100000001B3ull;
+    }
+    hash ^= (hash >> 33);
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= (hash >> 33);
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= (hash >> 33);
+    hash_ = hash;
+}
+
+
+/* ----- Operators ----- */
+
+LLGL_EXPORT bool operator == (const PipelineStateSignature& lhs, const PipelineStateSignature& rhs)
+{
+    return (PipelineStateSignature::CompareSWO(lhs, rhs) == 0);
+}
+
+LLGL_EXPORT bool operator != (const PipelineStateSignature& lhs, const PipelineStateSignature& rhs)
+{
+    return !(lhs == rhs);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
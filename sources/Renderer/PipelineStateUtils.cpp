@@ -99,6 +99,8 @@ LLGL_EXPORT SmallVector<Shader*, 5> GetShadersAsArray(const GraphicsPipelineDesc
     AddShaderIfSet(shaders, desc.tessControlShader);
     AddShaderIfSet(shaders, desc.tessEvaluationShader);
     AddShaderIfSet(shaders, desc.geometryShader);
+    AddShaderIfSet(shaders, desc.taskShader);
+    AddShaderIfSet(shaders, desc.meshShader);
     AddShaderIfSet(shaders, desc.fragmentShader);
     return shaders;
 }
@@ -22,6 +22,14 @@ LLGL_EXPORT std::uint32_t NumEnabledColorAttachments(const RenderPassDescriptor&
     return n;
 }
 
+LLGL_EXPORT std::uint32_t NumRenderPassViews(std::uint32_t viewMask)
+{
+    std::uint32_t n = 1;
+    while (n < 32 && (viewMask >> n) != 0)
+        ++n;
+    return n;
+}
+
 LLGL_EXPORT void ResetClearColorAttachmentIndices(
     std::uint32_t   numClearIndices,
     std::uint8_t*   outClearIndices)
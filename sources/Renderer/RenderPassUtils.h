@@ -24,6 +24,9 @@ namespace LLGL
 // Returns the number of enabled color attachments in the specified render pass.
 LLGL_EXPORT std::uint32_t NumEnabledColorAttachments(const RenderPassDescriptor& renderPassDesc);
 
+// Returns the number of views of a multiview render pass up to the highest bit in the specified view mask, or 1 if the view mask is zero.
+LLGL_EXPORT std::uint32_t NumRenderPassViews(std::uint32_t viewMask);
+
 // Fills the array of indices with the invalid index of 0xFF.
 LLGL_EXPORT void ResetClearColorAttachmentIndices(
     std::uint32_t   numClearIndices,
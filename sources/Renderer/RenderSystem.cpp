@@ -6,12 +6,15 @@
  */
 
 #include "../Platform/Module.h"
+#include "../Platform/MappedFile.h"
 #include "../Core/CoreUtils.h"
 #include "../Core/StringUtils.h"
 #include "../Core/Assertion.h"
 #include "../Core/Exception.h"
+#include "../Core/Threading.h"
 #include "../Core/StringUtils.h"
 #include "RenderTargetUtils.h"
+#include "RenderSystemProbeCache.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Format.h>
@@ -23,6 +26,9 @@
 #include <LLGL/RenderSystem.h>
 #include <string>
 #include <unordered_map>
+#include <mutex>
+#include <exception>
+#include <vector>
 
 #include "../Core/PrintfUtils.h"
 
@@ -188,6 +194,31 @@ static RenderSystemDeleter::RenderSystemDeleterFuncPtr LoadRenderSystemDeleter(M
     return reinterpret_cast<RenderSystemDeleter::RenderSystemDeleterFuncPtr>(module.LoadProcedure("LLGL_RenderSystem_Free"));
 }
 
+static bool LoadRenderSystemProbe(
+    Module&                         module,
+    const RenderSystemDescriptor&   renderSystemDesc,
+    RenderSystemProbe&              outProbe,
+    bool&                           outSupported)
+{
+    /* Load optional "LLGL_RenderSystem_Probe" procedure */
+    LLGL_PROC_INTERFACE(int, PFN_RENDERSYSTEM_PROBE, (const void*, int, void*, int));
+
+    auto RenderSystem_Probe = reinterpret_cast<PFN_RENDERSYSTEM_PROBE>(module.LoadProcedure("LLGL_RenderSystem_Probe"));
+    outSupported = (RenderSystem_Probe != nullptr);
+    if (!RenderSystem_Probe)
+        return false;
+
+    return
+    (
+        RenderSystem_Probe(
+            &renderSystemDesc,
+            static_cast<int>(sizeof(RenderSystemDescriptor)),
+            &outProbe,
+            static_cast<int>(sizeof(RenderSystemProbe))
+        ) != 0
+    );
+}
+
 #endif // /LLGL_BUILD_STATIC_LIB
 
 RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDesc, Report* report)
@@ -301,6 +332,143 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
     #endif // /LLGL_BUILD_STATIC_LIB
 }
 
+// Fills the probe from a render system that was only allocated to query its capabilities.
+static void CopyRenderSystemProbe(const RenderSystem& renderSystem, RenderSystemProbe& outProbe)
+{
+    outProbe.info = renderSystem.GetRendererInfo();
+    outProbe.caps = renderSystem.GetRenderingCaps();
+
+    /* Without a probe procedure, only the adapter the render system was created with is known */
+    RenderSystemAdapterInfo adapter;
+    {
+        adapter.name        = outProbe.info.deviceName;
+        adapter.vendorName  = outProbe.info.vendorName;
+    }
+    outProbe.adapters = { adapter };
+}
+
+bool RenderSystem::Probe(
+    const RenderSystemDescriptor&   renderSystemDesc,
+    RenderSystemProbe&              outProbe,
+    const char*                     cacheFilename,
+    Report*                         report)
+{
+    /* Return cached probe of a previous run unless the module file or the graphics drivers have changed since then */
+    RenderSystemProbeCacheKey cacheKey;
+    if (cacheFilename != nullptr)
+    {
+        #ifdef LLGL_BUILD_STATIC_LIB
+        cacheKey = GetRenderSystemProbeCacheKey(nullptr);
+        #else
+        cacheKey = GetRenderSystemProbeCacheKey(Module::GetModuleFilename(renderSystemDesc.moduleName.c_str()).c_str());
+        #endif
+
+        if (ReadRenderSystemProbeCache(cacheFilename, renderSystemDesc.moduleName, renderSystemDesc.flags, cacheKey, outProbe))
+        {
+            outProbe.fromCache = true;
+            return true;
+        }
+    }
+
+    /* Initialize mobile specific states */
+    #if defined LLGL_OS_ANDROID
+
+    AndroidApp::Get().Initialize(renderSystemDesc.androidApp);
+
+    #endif
+
+    /* Probe without debug layer and without any swap-chain */
+    RenderSystemDescriptor probeDesc = renderSystemDesc;
+    {
+        probeDesc.flags     |= RenderSystemFlags::Headless;
+        probeDesc.debugger  = nullptr;
+    }
+
+    RenderSystemProbe probe;
+    probe.moduleName = renderSystemDesc.moduleName;
+
+    #ifdef LLGL_BUILD_STATIC_LIB
+
+    probe.rendererID = StaticModule::GetRendererID(renderSystemDesc.moduleName);
+
+    if (StaticModule::SupportsProbe(renderSystemDesc.moduleName))
+    {
+        if (!StaticModule::ProbeRenderSystem(probeDesc, probe))
+        {
+            ReportException(report, "failed to probe render system module: %s", renderSystemDesc.moduleName.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        std::unique_ptr<RenderSystem> renderSystem{ StaticModule::AllocRenderSystem(probeDesc) };
+        if (!renderSystem)
+        {
+            ReportException(report, "failed to allocate render system for probe: %s", renderSystemDesc.moduleName.c_str());
+            return false;
+        }
+        CopyRenderSystemProbe(*renderSystem, probe);
+    }
+
+    #else // LLGL_BUILD_STATIC_LIB
+
+    /* Load render system module; it is released again at the end of this function */
+    const std::string       moduleFilename  = Module::GetModuleFilename(renderSystemDesc.moduleName.c_str());
+    std::unique_ptr<Module> module          = Module::Load(moduleFilename.c_str(), report);
+    if (!module)
+        return false;
+
+    if (!LoadRenderSystemBuildID(*module, moduleFilename, report))
+    {
+        ReportException(report, "build ID mismatch in render system module");
+        return false;
+    }
+
+    probe.rendererID = LoadRenderSystemRendererID(*module, probeDesc);
+
+    #ifdef LLGL_ENABLE_EXCEPTIONS
+    try
+    #endif
+    {
+        /* Prefer the module's probe procedure, otherwise allocate a headless render system and release it immediately */
+        bool probeSupported = false;
+        const bool probed = LoadRenderSystemProbe(*module, probeDesc, probe, probeSupported);
+        if (probeSupported && !probed)
+        {
+            ReportException(report, "failed to probe render system module: %s", moduleFilename.c_str());
+            return false;
+        }
+        if (!probeSupported)
+        {
+            RenderSystemPtr renderSystem
+            {
+                LoadRenderSystem(*module, moduleFilename.c_str(), probeDesc, report),
+                RenderSystemDeleter{ LoadRenderSystemDeleter(*module) }
+            };
+            if (!renderSystem)
+                return false;
+            CopyRenderSystemProbe(*renderSystem, probe);
+        }
+    }
+    #ifdef LLGL_ENABLE_EXCEPTIONS
+    catch (const std::exception& e)
+    {
+        /* Throw with new exception, otherwise the exception's v-table will be corrupted since it's part of the module */
+        ReportException(report, e.what());
+        return false;
+    }
+    #endif // /LLGL_ENABLE_EXCEPTIONS
+
+    #endif // /LLGL_BUILD_STATIC_LIB
+
+    /* Store probe for the next run */
+    if (cacheFilename != nullptr && !WriteRenderSystemProbeCache(cacheFilename, renderSystemDesc.flags, cacheKey, probe))
+        Log::Errorf("failed to write render system probe cache: %s\n", cacheFilename);
+
+    outProbe = std::move(probe);
+    return true;
+}
+
 void RenderSystem::Unload(RenderSystemPtr&& renderSystem)
 {
     auto it = g_renderSystemModules.find(renderSystem.get());
@@ -337,6 +505,271 @@ const Report* RenderSystem::GetReport() const
     return (pimpl_->report ? &(pimpl_->report) : nullptr);
 }
 
+CommandQueue* RenderSystem::GetCommandQueue(const CommandQueueType /*type*/)
+{
+    return GetCommandQueue();
+}
+
+bool RenderSystem::QueryMemoryInfo(MemoryInfo& /*outInfo*/)
+{
+    return false; // dummy
+}
+
+// Maps the specified uncompressed file region into memory and returns a pointer to its first byte.
+static const void* MapFileStreamRegion(const FileStreamRegion& fileRegion, std::unique_ptr<MappedFile>& outFile)
+{
+    if (fileRegion.filename == nullptr)
+        return nullptr;
+
+    if (fileRegion.compression != FileStreamCompression::Uncompressed)
+    {
+        Log::Errorf("cannot stream compressed file region without RenderingFeatures::hasFileStreamDecompression: %s\n", fileRegion.filename);
+        return nullptr;
+    }
+
+    if (fileRegion.uncompressedSize != 0 && fileRegion.uncompressedSize != fileRegion.size)
+    {
+        Log::Errorf("size mismatch of uncompressed file region: %u specified, but %u expected\n", fileRegion.uncompressedSize, fileRegion.size);
+        return nullptr;
+    }
+
+    outFile = MappedFile::Open(fileRegion.filename);
+    if (!outFile)
+    {
+        Log::Errorf("failed to open file for streaming: %s\n", fileRegion.filename);
+        return nullptr;
+    }
+
+    if (fileRegion.offset > outFile->GetSize() || outFile->GetSize() - fileRegion.offset < fileRegion.size)
+    {
+        Log::Errorf(
+            "file region [%llu, %llu) out of bounds: %s\n",
+            static_cast<unsigned long long>(fileRegion.offset),
+            static_cast<unsigned long long>(fileRegion.offset + fileRegion.size),
+            fileRegion.filename
+        );
+        return nullptr;
+    }
+
+    return static_cast<const char*>(outFile->GetData()) + static_cast<std::size_t>(fileRegion.offset);
+}
+
+bool RenderSystem::StreamBufferFromFile(Buffer& buffer, std::uint64_t offset, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    std::unique_ptr<MappedFile> file;
+    const void* data = MapFileStreamRegion(fileRegion, file);
+    if (data == nullptr)
+        return false;
+
+    WriteBuffer(buffer, offset, data, fileRegion.size);
+
+    if (fence != nullptr)
+        GetCommandQueue()->Submit(*fence);
+
+    return true;
+}
+
+bool RenderSystem::StreamTextureFromFile(Texture& texture, const TextureRegion& textureRegion, const FileStreamRegion& fileRegion, Fence* fence)
+{
+    std::unique_ptr<MappedFile> file;
+    const void* data = MapFileStreamRegion(fileRegion, file);
+    if (data == nullptr)
+        return false;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(texture.GetFormat());
+    const ImageView imageView{ formatAttribs.format, formatAttribs.dataType, data, fileRegion.size };
+    WriteTexture(texture, textureRegion, imageView);
+
+    if (fence != nullptr)
+        GetCommandQueue()->Submit(*fence);
+
+    return true;
+}
+
+void RenderSystem::CreateBuffers(
+    std::uint32_t           numBuffers,
+    const BufferDescriptor* bufferDescs,
+    Buffer**                outBuffers,
+    const void* const *     initialData)
+{
+    LLGL_ASSERT(numBuffers == 0 || (bufferDescs != nullptr && outBuffers != nullptr));
+    for_range(i, numBuffers)
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
+}
+
+void RenderSystem::CreateTextures(
+    std::uint32_t               numTextures,
+    const TextureDescriptor*    textureDescs,
+    Texture**                   outTextures,
+    const ImageView* const *    initialImages)
+{
+    LLGL_ASSERT(numTextures == 0 || (textureDescs != nullptr && outTextures != nullptr));
+    for_range(i, numTextures)
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr ? initialImages[i] : nullptr));
+}
+
+template <typename TObject, typename TCreateFunc>
+static void CreateObjectsConcurrent(
+    std::uint32_t   numObjects,
+    TObject**       outObjects,
+    unsigned        threadCount,
+    TCreateFunc     createFunc)
+{
+    /* Forward first exception of any worker thread to the calling thread, since exceptions must not leave a std::thread */
+    std::mutex          exceptionMutex;
+    std::exception_ptr  exception;
+
+    DoConcurrent(
+        [&](std::size_t index)
+        {
+            try
+            {
+                outObjects[index] = createFunc(index);
+            }
+            catch (...)
+            {
+                outObjects[index] = nullptr;
+                std::lock_guard<std::mutex> guard{ exceptionMutex };
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        },
+        numObjects,
+        threadCount,
+        1
+    );
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void RenderSystem::CreateShaders(
+    std::uint32_t           numShaders,
+    const ShaderDescriptor* shaderDescs,
+    Shader**                outShaders,
+    unsigned                threadCount)
+{
+    LLGL_ASSERT(numShaders == 0 || (shaderDescs != nullptr && outShaders != nullptr));
+
+    if (!GetRenderingCaps().features.hasConcurrentShaderCreation)
+        threadCount = 1;
+
+    CreateObjectsConcurrent(
+        numShaders,
+        outShaders,
+        threadCount,
+        [this, shaderDescs](std::size_t index) -> Shader*
+        {
+            return CreateShader(shaderDescs[index]);
+        }
+    );
+}
+
+// Appends all macros of the specified null-terminated array to the output list.
+static void AppendShaderMacros(std::vector<ShaderMacro>& outMacros, const ShaderMacro* macros)
+{
+    if (macros != nullptr)
+    {
+        for (; macros->name != nullptr; ++macros)
+            outMacros.push_back(*macros);
+    }
+}
+
+void RenderSystem::CreateShaders(
+    const ShaderDescriptor&     shaderDesc,
+    std::uint32_t               numPermutations,
+    const ShaderMacro* const *  permutationDefines,
+    Shader**                    outShaders,
+    unsigned                    threadCount)
+{
+    LLGL_ASSERT(numPermutations == 0 || (permutationDefines != nullptr && outShaders != nullptr));
+
+    if (!GetRenderingCaps().features.hasConcurrentShaderCreation)
+        threadCount = 1;
+
+    /* Read source file only once for all permutations */
+    ShaderDescriptor    sharedShaderDesc = shaderDesc;
+    std::string         fileContent;
+
+    if (shaderDesc.sourceType == ShaderSourceType::CodeFile && numPermutations > 0)
+    {
+        fileContent                 = ReadFileString(shaderDesc.source);
+        sharedShaderDesc.source     = fileContent.c_str();
+        sharedShaderDesc.sourceSize = fileContent.size();
+        sharedShaderDesc.sourceType = ShaderSourceType::CodeString;
+        if (sharedShaderDesc.debugName == nullptr)
+            sharedShaderDesc.debugName = shaderDesc.source;
+    }
+
+    /* Merge shared macros with the macros of each permutation into null-terminated lists */
+    std::vector<std::vector<ShaderMacro>> permutationMacros;
+    permutationMacros.resize(numPermutations);
+
+    for_range(i, numPermutations)
+    {
+        AppendShaderMacros(permutationMacros[i], shaderDesc.defines);
+        AppendShaderMacros(permutationMacros[i], permutationDefines[i]);
+        permutationMacros[i].push_back(ShaderMacro{});
+    }
+
+    CreateObjectsConcurrent(
+        numPermutations,
+        outShaders,
+        threadCount,
+        [this, &sharedShaderDesc, &permutationMacros](std::size_t index) -> Shader*
+        {
+            ShaderDescriptor permutationDesc = sharedShaderDesc;
+            permutationDesc.defines = permutationMacros[index].data();
+            return CreateShader(permutationDesc);
+        }
+    );
+}
+
+template <typename TPipelineDescriptor>
+static void CreatePipelineStatesConcurrent(
+    RenderSystem&               renderSystem,
+    std::uint32_t               numPipelineStates,
+    const TPipelineDescriptor*  pipelineStateDescs,
+    PipelineState**             outPipelineStates,
+    PipelineCache*              pipelineCache,
+    unsigned                    threadCount)
+{
+    LLGL_ASSERT(numPipelineStates == 0 || (pipelineStateDescs != nullptr && outPipelineStates != nullptr));
+
+    if (!renderSystem.GetRenderingCaps().features.hasConcurrentPipelineStateCreation)
+        threadCount = 1;
+
+    CreateObjectsConcurrent(
+        numPipelineStates,
+        outPipelineStates,
+        threadCount,
+        [&renderSystem, pipelineStateDescs, pipelineCache](std::size_t index) -> PipelineState*
+        {
+            return renderSystem.CreatePipelineState(pipelineStateDescs[index], pipelineCache);
+        }
+    );
+}
+
+void RenderSystem::CreatePipelineStates(
+    std::uint32_t                       numPipelineStates,
+    const GraphicsPipelineDescriptor*   pipelineStateDescs,
+    PipelineState**                     outPipelineStates,
+    PipelineCache*                      pipelineCache,
+    unsigned                            threadCount)
+{
+    CreatePipelineStatesConcurrent(*this, numPipelineStates, pipelineStateDescs, outPipelineStates, pipelineCache, threadCount);
+}
+
+void RenderSystem::CreatePipelineStates(
+    std::uint32_t                       numPipelineStates,
+    const ComputePipelineDescriptor*    pipelineStateDescs,
+    PipelineState**                     outPipelineStates,
+    PipelineCache*                      pipelineCache,
+    unsigned                            threadCount)
+{
+    CreatePipelineStatesConcurrent(*this, numPipelineStates, pipelineStateDescs, outPipelineStates, pipelineCache, threadCount);
+}
+
 
 /*
  * ======= Protected: =======
@@ -100,6 +100,19 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"   );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"   );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"       );
+    LLGL_VALIDATE_FEATURE( hasConcurrentPipelineStateCreation, "concurrent PSO creation" );
+    LLGL_VALIDATE_FEATURE( hasIndirectDrawingCount,      "indirect drawing count"      );
+    LLGL_VALIDATE_FEATURE( hasConcurrentShaderCreation,  "concurrent shader creation"  );
+    LLGL_VALIDATE_FEATURE( hasConcurrentResourceCreation, "concurrent resource creation" );
+    LLGL_VALIDATE_FEATURE( hasMeshShaders,               "mesh shaders"                );
+    LLGL_VALIDATE_FEATURE( hasSparseTextures,            "sparse textures"             );
+    LLGL_VALIDATE_FEATURE( hasInputAttachments,          "input attachments"           );
+    LLGL_VALIDATE_FEATURE( hasQueryResolve,              "query resolve"               );
+    LLGL_VALIDATE_FEATURE( hasFileStreamDecompression,   "file stream decompression"   );
+    LLGL_VALIDATE_FEATURE( hasTextureMinLODClamp,        "texture min-LOD clamp"       );
+    LLGL_VALIDATE_FEATURE( hasVariableRateShading,       "variable rate shading"       );
+    LLGL_VALIDATE_FEATURE( hasShadingRateImage,          "shading-rate images"         );
+    LLGL_VALIDATE_FEATURE( hasMultiview,                 "multiview rendering"         );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -166,6 +179,9 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_LIMIT( maxConstantBufferSize,             "constant buffer size"                      );
     LLGL_VALIDATE_LIMIT( maxStreamOutputs,                  "stream outputs"                            );
     LLGL_VALIDATE_LIMIT( maxTessFactor,                     "tessellation factor"                       );
+    LLGL_VALIDATE_LIMIT( maxMeshShaderWorkGroups[0],        "mesh shader work groups on X-axis"         );
+    LLGL_VALIDATE_LIMIT( maxMeshShaderWorkGroups[1],        "mesh shader work groups on Y-axis"         );
+    LLGL_VALIDATE_LIMIT( maxMeshShaderWorkGroups[2],        "mesh shader work groups on Z-axis"         );
 
     #undef LLGL_VALIDATE_LIMIT
     #undef LLGL_CONTINUE_VALIDATION_IF
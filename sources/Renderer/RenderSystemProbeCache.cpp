@@ -0,0 +1,419 @@
+/*
+ * RenderSystemProbeCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "RenderSystemProbeCache.h"
+#include "BuildID.h"
+#include "../Platform/MappedFile.h"
+#include "../Platform/DriverStamp.h"
+#include <LLGL/Utils/ForRange.h>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+
+namespace LLGL
+{
+
+
+#include "../Core/PackStructPush.inl"
+
+struct RenderSystemProbeCacheHeader
+{
+    char            magic[4];   // "LLRP"
+    std::uint32_t   version;    // renderSystemProbeCacheVersion
+    std::int32_t    buildID;    // LLGL_BUILD_ID; the features and limits are stored as raw structures, so their layout must match
+    std::uint32_t   numEntries; // Number of entries that follow this header, each prefixed with its size
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+// Increment this version whenever the file format changes.
+static constexpr std::uint32_t renderSystemProbeCacheVersion = 2;
+
+static constexpr char renderSystemProbeCacheMagic[4] = { 'L', 'L', 'R', 'P' };
+
+static_assert(std::is_trivially_copyable<RenderingFeatures>::value, "RenderingFeatures must be trivially copyable to be stored in the probe cache");
+static_assert(std::is_trivially_copyable<RenderingLimits>::value, "RenderingLimits must be trivially copyable to be stored in the probe cache");
+
+
+/*
+ * Serialization
+ */
+
+class ProbeCacheWriter
+{
+
+    public:
+
+        void WriteBytes(const void* data, std::size_t size)
+        {
+            const char* bytes = static_cast<const char*>(data);
+            data_.insert(data_.end(), bytes, bytes + size);
+        }
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            WriteBytes(&value, sizeof(value));
+        }
+
+        void WriteString(const std::string& str)
+        {
+            Write(static_cast<std::uint32_t>(str.size()));
+            WriteBytes(str.data(), str.size());
+        }
+
+        template <typename T>
+        void WriteArray(const std::vector<T>& container)
+        {
+            Write(static_cast<std::uint32_t>(container.size()));
+            WriteBytes(container.data(), container.size() * sizeof(T));
+        }
+
+        const std::vector<char>& GetData() const
+        {
+            return data_;
+        }
+
+    private:
+
+        std::vector<char> data_;
+
+};
+
+// Reader with bounds checking; all functions return false once the end of the data has been exceeded.
+class ProbeCacheReader
+{
+
+    public:
+
+        ProbeCacheReader(const char* data, std::size_t size) :
+            data_ { data },
+            size_ { size }
+        {
+        }
+
+        bool ReadBytes(void* data, std::size_t size)
+        {
+            if (size > size_ - pos_)
+                return false;
+            if (size > 0)
+                ::memcpy(data, data_ + pos_, size);
+            pos_ += size;
+            return true;
+        }
+
+        template <typename T>
+        bool Read(T& value)
+        {
+            return ReadBytes(&value, sizeof(value));
+        }
+
+        bool ReadString(std::string& str)
+        {
+            std::uint32_t len = 0;
+            if (!Read(len) || len > size_ - pos_)
+                return false;
+            str.assign(data_ + pos_, len);
+            pos_ += len;
+            return true;
+        }
+
+        template <typename T>
+        bool ReadArray(std::vector<T>& container)
+        {
+            std::uint32_t count = 0;
+            if (!Read(count) || count > (size_ - pos_) / sizeof(T))
+                return false;
+            container.resize(count);
+            return ReadBytes(container.data(), count * sizeof(T));
+        }
+
+        // Reads a raw structure that was prefixed with its size to detect layout changes.
+        template <typename T>
+        bool ReadStruct(T& value)
+        {
+            std::uint32_t size = 0;
+            return (Read(size) && size == sizeof(T) && Read(value));
+        }
+
+    private:
+
+        const char*     data_   = nullptr;
+        std::size_t     size_   = 0;
+        std::size_t     pos_    = 0;
+
+};
+
+static void WriteProbeEntry(ProbeCacheWriter& writer, long flags, const RenderSystemProbeCacheKey& key, const RenderSystemProbe& probe)
+{
+    writer.Write(static_cast<std::int64_t>(flags));
+    writer.WriteString(probe.moduleName);
+    writer.Write(key.moduleFileSize);
+    writer.Write(key.moduleFileTime);
+    writer.WriteString(key.driverStamp);
+    writer.Write(static_cast<std::int32_t>(probe.rendererID));
+
+    writer.Write(static_cast<std::uint32_t>(probe.adapters.size()));
+    for (const RenderSystemAdapterInfo& adapter : probe.adapters)
+    {
+        writer.WriteString(adapter.name);
+        writer.WriteString(adapter.vendorName);
+        writer.Write(adapter.videoMemory);
+    }
+
+    writer.WriteString(probe.info.rendererName);
+    writer.WriteString(probe.info.deviceName);
+    writer.WriteString(probe.info.vendorName);
+    writer.WriteString(probe.info.shadingLanguageName);
+    writer.Write(static_cast<std::uint32_t>(probe.info.extensionNames.size()));
+    for (const std::string& extension : probe.info.extensionNames)
+        writer.WriteString(extension);
+    writer.WriteArray(probe.info.pipelineCacheID);
+
+    writer.Write(probe.caps.screenOrigin);
+    writer.Write(probe.caps.clippingRange);
+    writer.WriteArray(probe.caps.shadingLanguages);
+    writer.WriteArray(probe.caps.textureFormats);
+    writer.Write(static_cast<std::uint32_t>(sizeof(probe.caps.features)));
+    writer.Write(probe.caps.features);
+    writer.Write(static_cast<std::uint32_t>(sizeof(probe.caps.limits)));
+    writer.Write(probe.caps.limits);
+}
+
+static bool ReadProbeEntry(ProbeCacheReader& reader, long& outFlags, RenderSystemProbeCacheKey& outKey, RenderSystemProbe& outProbe)
+{
+    std::int64_t flags = 0;
+    std::int32_t rendererID = 0;
+    if (!reader.Read(flags)                         ||
+        !reader.ReadString(outProbe.moduleName)     ||
+        !reader.Read(outKey.moduleFileSize)         ||
+        !reader.Read(outKey.moduleFileTime)         ||
+        !reader.ReadString(outKey.driverStamp)      ||
+        !reader.Read(rendererID))
+    {
+        return false;
+    }
+
+    outFlags            = static_cast<long>(flags);
+    outProbe.rendererID = static_cast<int>(rendererID);
+
+    std::uint32_t numAdapters = 0;
+    if (!reader.Read(numAdapters))
+        return false;
+
+    outProbe.adapters.clear();
+    for_range(i, numAdapters)
+    {
+        RenderSystemAdapterInfo adapter;
+        if (!reader.ReadString(adapter.name) || !reader.ReadString(adapter.vendorName) || !reader.Read(adapter.videoMemory))
+            return false;
+        outProbe.adapters.push_back(std::move(adapter));
+    }
+
+    std::uint32_t numExtensions = 0;
+    if (!reader.ReadString(outProbe.info.rendererName)          ||
+        !reader.ReadString(outProbe.info.deviceName)            ||
+        !reader.ReadString(outProbe.info.vendorName)            ||
+        !reader.ReadString(outProbe.info.shadingLanguageName)   ||
+        !reader.Read(numExtensions))
+    {
+        return false;
+    }
+
+    outProbe.info.extensionNames.clear();
+    for_range(i, numExtensions)
+    {
+        std::string extension;
+        if (!reader.ReadString(extension))
+            return false;
+        outProbe.info.extensionNames.push_back(std::move(extension));
+    }
+
+    return
+    (
+        reader.ReadArray(outProbe.info.pipelineCacheID)     &&
+        reader.Read(outProbe.caps.screenOrigin)             &&
+        reader.Read(outProbe.caps.clippingRange)            &&
+        reader.ReadArray(outProbe.caps.shadingLanguages)    &&
+        reader.ReadArray(outProbe.caps.textureFormats)      &&
+        reader.ReadStruct(outProbe.caps.features)           &&
+        reader.ReadStruct(outProbe.caps.limits)
+    );
+}
+
+// Calls the specified function for each raw entry of the probe cache file until it returns false.
+template <typename TFunc>
+static bool ForEachProbeCacheEntry(const MappedFile& file, const TFunc& func)
+{
+    const std::size_t fileSize = file.GetSize();
+    if (fileSize < sizeof(RenderSystemProbeCacheHeader))
+        return false;
+
+    /* Validate header; a cache file of another version or build of LLGL is discarded entirely */
+    const char* data = static_cast<const char*>(file.GetData());
+    RenderSystemProbeCacheHeader header;
+    ::memcpy(&header, data, sizeof(header));
+
+    if (::memcmp(header.magic, renderSystemProbeCacheMagic, sizeof(header.magic)) != 0 ||
+        header.version != renderSystemProbeCacheVersion ||
+        header.buildID != LLGL_BUILD_ID)
+    {
+        return false;
+    }
+
+    ProbeCacheReader reader{ data + sizeof(header), fileSize - sizeof(header) };
+    for_range(i, header.numEntries)
+    {
+        std::vector<char> entryData;
+        if (!reader.ReadArray(entryData))
+            return false;
+        if (!func(entryData))
+            break;
+    }
+
+    return true;
+}
+
+
+static bool operator == (const RenderSystemProbeCacheKey& lhs, const RenderSystemProbeCacheKey& rhs)
+{
+    return
+    (
+        lhs.moduleFileSize  == rhs.moduleFileSize   &&
+        lhs.moduleFileTime  == rhs.moduleFileTime   &&
+        lhs.driverStamp     == rhs.driverStamp
+    );
+}
+
+
+/*
+ * Global functions
+ */
+
+RenderSystemProbeCacheKey GetRenderSystemProbeCacheKey(const char* moduleFilename)
+{
+    RenderSystemProbeCacheKey key;
+
+    if (moduleFilename != nullptr)
+    {
+        #ifdef _WIN32
+        struct _stat64 fileStat;
+        const bool hasFileStat = (::_stat64(moduleFilename, &fileStat) == 0);
+        #else
+        struct stat fileStat;
+        const bool hasFileStat = (::stat(moduleFilename, &fileStat) == 0);
+        #endif
+
+        if (hasFileStat)
+        {
+            key.moduleFileSize = static_cast<std::uint64_t>(fileStat.st_size);
+            key.moduleFileTime = static_cast<std::int64_t>(fileStat.st_mtime);
+        }
+    }
+
+    key.driverStamp = GetGraphicsDriverStamp();
+
+    return key;
+}
+
+bool ReadRenderSystemProbeCache(const char* filename, const std::string& moduleName, long flags, const RenderSystemProbeCacheKey& key, RenderSystemProbe& outProbe)
+{
+    std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+    if (!file)
+        return false;
+
+    bool found = false;
+
+    ForEachProbeCacheEntry(
+        *file,
+        [&moduleName, flags, &key, &outProbe, &found](const std::vector<char>& entryData) -> bool
+        {
+            ProbeCacheReader entryReader{ entryData.data(), entryData.size() };
+            RenderSystemProbe probe;
+            RenderSystemProbeCacheKey entryKey;
+            long entryFlags = 0;
+            if (ReadProbeEntry(entryReader, entryFlags, entryKey, probe) && entryFlags == flags && probe.moduleName == moduleName && entryKey == key)
+            {
+                outProbe = std::move(probe);
+                found = true;
+            }
+            return !found;
+        }
+    );
+
+    return found;
+}
+
+bool WriteRenderSystemProbeCache(const char* filename, long flags, const RenderSystemProbeCacheKey& key, const RenderSystemProbe& probe)
+{
+    /* Gather all previous entries except the one that is replaced */
+    std::vector<std::vector<char>> entries;
+
+    if (std::unique_ptr<MappedFile> file = MappedFile::Open(filename))
+    {
+        ForEachProbeCacheEntry(
+            *file,
+            [&probe, flags, &entries](const std::vector<char>& entryData) -> bool
+            {
+                ProbeCacheReader entryReader{ entryData.data(), entryData.size() };
+                RenderSystemProbe prevProbe;
+                RenderSystemProbeCacheKey prevKey;
+                long prevFlags = 0;
+                if (ReadProbeEntry(entryReader, prevFlags, prevKey, prevProbe) && !(prevFlags == flags && prevProbe.moduleName == probe.moduleName))
+                    entries.push_back(entryData);
+                return true;
+            }
+        );
+    }
+
+    /* Append new entry */
+    ProbeCacheWriter entryWriter;
+    WriteProbeEntry(entryWriter, flags, key, probe);
+    entries.push_back(entryWriter.GetData());
+
+    /* Write header and all entries prefixed with their size */
+    RenderSystemProbeCacheHeader header;
+    {
+        ::memcpy(header.magic, renderSystemProbeCacheMagic, sizeof(header.magic));
+        header.version      = renderSystemProbeCacheVersion;
+        header.buildID      = LLGL_BUILD_ID;
+        header.numEntries   = static_cast<std::uint32_t>(entries.size());
+    }
+    ProbeCacheWriter fileWriter;
+    fileWriter.Write(header);
+    for (const std::vector<char>& entryData : entries)
+        fileWriter.WriteArray(entryData);
+
+    /* Write into temporary file first to never leave a truncated cache file behind */
+    const std::string tempFilename = std::string(filename) + ".tmp";
+    {
+        std::ofstream file{ tempFilename, std::ios::out | std::ios::binary | std::ios::trunc };
+        if (!file.good())
+            return false;
+
+        const std::vector<char>& data = fileWriter.GetData();
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+        if (!file.good())
+            return false;
+    }
+
+    ::remove(filename);
+    return (::rename(tempFilename.c_str(), filename) == 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,55 @@
+/*
+ * RenderSystemProbeCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RENDER_SYSTEM_PROBE_CACHE_H
+#define LLGL_RENDER_SYSTEM_PROBE_CACHE_H
+
+
+#include <LLGL/RenderSystemFlags.h>
+#include <cstdint>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+// Invalidation key of a probe cache entry. Entries are only returned if their key matches the current key.
+struct RenderSystemProbeCacheKey
+{
+    std::uint64_t   moduleFileSize  = 0;    // Size (in bytes) of the render system module file or zero if it is unknown.
+    std::int64_t    moduleFileTime  = 0;    // Last modification time of the render system module file or zero if it is unknown.
+    std::string     driverStamp;            // Installed graphics adapters and driver versions (see GetGraphicsDriverStamp).
+};
+
+/*
+Returns the invalidation key for the specified render system module file. This only queries file attributes and the platform's driver information, so it is cheap compared to a probe.
+If the module filename is null or the file cannot be found, e.g. for static builds or modules that are only found via the library search path, the key only contains the driver stamp.
+*/
+RenderSystemProbeCacheKey GetRenderSystemProbeCacheKey(const char* moduleFilename);
+
+/*
+Reads the probe for the specified module name and render system flags from the probe cache file.
+Returns false if the file does not exist, was written by a different build of LLGL (see LLGL_BUILD_ID), or has no entry with a matching invalidation key.
+*/
+bool ReadRenderSystemProbeCache(const char* filename, const std::string& moduleName, long flags, const RenderSystemProbeCacheKey& key, RenderSystemProbe& outProbe);
+
+/*
+Writes the specified probe for the render system flags and invalidation key into the probe cache file.
+All other entries of the file are preserved and a previous entry for the same module name and flags is replaced.
+*/
+bool WriteRenderSystemProbeCache(const char* filename, long flags, const RenderSystemProbeCacheKey& key, const RenderSystemProbe& probe);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
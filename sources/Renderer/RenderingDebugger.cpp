@@ -11,6 +11,7 @@
 #include <LLGL/Container/Strings.h>
 #include "../Core/StringUtils.h"
 #include <map>
+#include <string>
 
 
 namespace LLGL
@@ -44,6 +45,10 @@ struct RenderingDebugger::Pimpl
     const char*             source          = "";
     const char*             groupName       = "";
     bool                    isTimeRecording = false;
+    bool                    isValidating    = true;
+    bool                    detectOverruns  = false;
+    std::string             captureFilename;
+    std::uint32_t           captureFrames   = 0;
 };
 
 
@@ -77,6 +82,42 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetValidation(bool enabled)
+{
+    pimpl_->isValidating = enabled;
+}
+
+bool RenderingDebugger::GetValidation() const
+{
+    return pimpl_->isValidating;
+}
+
+void RenderingDebugger::SetBufferOverrunDetection(bool enabled)
+{
+    pimpl_->detectOverruns = enabled;
+}
+
+bool RenderingDebugger::GetBufferOverrunDetection() const
+{
+    return pimpl_->detectOverruns;
+}
+
+void RenderingDebugger::SetCapture(const char* filename, std::uint32_t numFrames)
+{
+    pimpl_->captureFilename = (filename != nullptr ? filename : "");
+    pimpl_->captureFrames   = numFrames;
+}
+
+const char* RenderingDebugger::GetCaptureFilename() const
+{
+    return pimpl_->captureFilename.c_str();
+}
+
+std::uint32_t RenderingDebugger::GetCaptureFrames() const
+{
+    return pimpl_->captureFrames;
+}
+
 void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 {
     /* Print formatted string */
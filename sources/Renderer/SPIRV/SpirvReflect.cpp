@@ -8,13 +8,45 @@
 #include "SpirvReflect.h"
 #include "SpirvModule.h"
 #include "../../Core/CoreUtils.h"
+#include <algorithm>
 #include <string>
+#include <string.h>
 
 
 namespace LLGL
 {
 
 
+/*
+ * SpirvNameDecorations class
+ */
+
+const char* SpirvNameDecorations::Get(spv::Id id) const
+{
+    /* Sort names lazily, since all OpName instructions precede the declarations that query them */
+    if (!sorted_)
+    {
+        std::stable_sort(
+            names_.begin(), names_.end(),
+            [](const Entry& lhs, const Entry& rhs) -> bool
+            {
+                return (lhs.id < rhs.id);
+            }
+        );
+        sorted_ = true;
+    }
+
+    auto it = std::lower_bound(
+        names_.begin(), names_.end(), id,
+        [](const Entry& entry, spv::Id id) -> bool
+        {
+            return (entry.id < id);
+        }
+    );
+    return (it != names_.end() && it->id == id ? it->name : "");
+}
+
+
 /*
  * SpirvReflect class
  */
@@ -306,6 +338,322 @@ SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector
     return SpirvResult::NoError;
 }
 
+// Push constant block member decoration, either a member name or a member offset.
+struct SpvMemberDecoration
+{
+    spv::Id         structId;
+    std::uint32_t   member;
+    const char*     name;
+    std::uint32_t   offset;
+};
+
+SpirvResult SpirvReflectModuleRecord(const SpirvModuleView& module, SpirvReflectRecord& outRecord)
+{
+    /* Parse SPIR-V header */
+    SpirvHeader header;
+    SpirvResult result = module.ReadHeader(header);
+    if (result != SpirvResult::NoError)
+        return result;
+
+    outRecord = SpirvReflectRecord{};
+    outRecord.bindingPoints.reserve(header.idBound / 16u);
+
+    /*
+    Push constant member names and offsets precede the declaration of the push constant variable,
+    so gather them for all structures and filter them once the push constant type is known.
+    */
+    std::vector<SpvMemberDecoration>                memberDecorations;
+    std::vector<std::pair<spv::Id, spv::Id>>        pushConstantPointers;
+    spv::Id                                         pushConstantTypeId      = 0;
+
+    for (auto it = module.begin(); it != module.end(); ++it)
+    {
+        /* Only decode instructions that are relevant for the record */
+        const spv::Op opcode = it.Opcode();
+        if (opcode == spv::Op::OpFunction)
+        {
+            /* No more declarations and decorations after first OpFunction instruction */
+            break;
+        }
+
+        switch (opcode)
+        {
+            case spv::Op::OpExecutionMode:
+            {
+                /* OpExecutionMode EntryPoint[0] Mode[1] (Literals[2+]) */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                ParseSpvExecutionMode(instr, outRecord.executionMode);
+            }
+            break;
+
+            case spv::Op::OpMemberName:
+            {
+                /* OpMemberName TypeId Member[0] Name[1] */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                memberDecorations.push_back(SpvMemberDecoration{ instr.type, instr.GetUInt32(0), instr.GetString(1), 0 });
+            }
+            break;
+
+            case spv::Op::OpMemberDecorate:
+            {
+                /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 3)
+                    return SpirvResult::OperandOutOfBounds;
+                if (static_cast<spv::Decoration>(instr.GetUInt32(2)) == spv::DecorationOffset)
+                {
+                    if (instr.numOperands < 4)
+                        return SpirvResult::OperandOutOfBounds;
+                    memberDecorations.push_back(SpvMemberDecoration{ instr.GetUInt32(0), instr.GetUInt32(1), nullptr, instr.GetUInt32(3) });
+                }
+            }
+            break;
+
+            case spv::Op::OpDecorate:
+            {
+                /* OpDecorate Target[0] Decoration[1] Value[2] */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+
+                const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
+                if (decoration == spv::DecorationDescriptorSet ||
+                    decoration == spv::DecorationBinding)
+                {
+                    if (instr.numOperands < 3)
+                        return SpirvResult::OperandOutOfBounds;
+
+                    const spv::Id varId = instr.GetUInt32(0);
+                    auto* binding = FindOrInsertBindingPoint(outRecord.bindingPoints, varId);
+                    binding->id = varId;
+                    if (decoration == spv::DecorationDescriptorSet)
+                    {
+                        binding->set                = instr.GetUInt32(2);
+                        binding->setWordOffset      = module.WordOffset(it) + 3;
+                    }
+                    else
+                    {
+                        binding->binding            = instr.GetUInt32(2);
+                        binding->bindingWordOffset  = module.WordOffset(it) + 3;
+                    }
+                }
+            }
+            break;
+
+            case spv::Op::OpTypePointer:
+            {
+                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                if (static_cast<spv::StorageClass>(instr.GetUInt32(0)) == spv::StorageClassPushConstant)
+                    pushConstantPointers.push_back({ instr.result, instr.GetUInt32(1) });
+            }
+            break;
+
+            case spv::Op::OpVariable:
+            {
+                /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
+                const SpirvInstruction instr = it.Get();
+                if (instr.numOperands < 1)
+                    return SpirvResult::OperandOutOfBounds;
+                if (pushConstantTypeId == 0 && static_cast<spv::StorageClass>(instr.GetUInt32(0)) == spv::StorageClassPushConstant)
+                {
+                    /* Resolve pointer subtype of push constant variable; the pointer type is always declared before the variable */
+                    for (const auto& pointer : pushConstantPointers)
+                    {
+                        if (pointer.first == instr.type)
+                        {
+                            pushConstantTypeId = pointer.second;
+                            break;
+                        }
+                    }
+                    if (pushConstantTypeId == 0)
+                        return SpirvResult::IdTypeMismatch;
+                }
+            }
+            break;
+
+            default:
+            break;
+        }
+    }
+
+    /* Gather fields of push constant block */
+    if (pushConstantTypeId != 0)
+    {
+        auto GetOrMakeField = [&outRecord](std::uint32_t index) -> SpirvReflectRecord::PushConstantField&
+        {
+            if (index >= outRecord.pushConstantFields.size())
+                outRecord.pushConstantFields.resize(index + 1);
+            return outRecord.pushConstantFields[index];
+        };
+
+        for (const SpvMemberDecoration& decoration : memberDecorations)
+        {
+            if (decoration.structId != pushConstantTypeId)
+                continue;
+            if (decoration.name != nullptr)
+                GetOrMakeField(decoration.member).name = decoration.name;
+            else
+                GetOrMakeField(decoration.member).offset = decoration.offset;
+        }
+    }
+
+    return SpirvResult::NoError;
+}
+
+// Magic number and version of serialized reflection records. Increment the version whenever the record layout changes.
+static constexpr std::uint32_t g_spvRecordMagic     = 0x52525053; // 'SPRR'
+static constexpr std::uint32_t g_spvRecordVersion   = 1;
+
+enum SpvRecordExecutionModeFlags : std::uint32_t
+{
+    SpvRecordEarlyFragmentTest  = (1 << 0),
+    SpvRecordOriginUpperLeft    = (1 << 1),
+    SpvRecordDepthGreater       = (1 << 2),
+    SpvRecordDepthLess          = (1 << 3),
+};
+
+std::vector<char> SpirvSerializeReflectRecord(const SpirvReflectRecord& record)
+{
+    std::vector<std::uint32_t> words;
+
+    /* Write header and execution mode */
+    const SpirvReflect::SpvExecutionMode& mode = record.executionMode;
+    std::uint32_t modeFlags = 0;
+    if (mode.earlyFragmentTest) { modeFlags |= SpvRecordEarlyFragmentTest; }
+    if (mode.originUpperLeft)   { modeFlags |= SpvRecordOriginUpperLeft;   }
+    if (mode.depthGreater)      { modeFlags |= SpvRecordDepthGreater;      }
+    if (mode.depthLess)         { modeFlags |= SpvRecordDepthLess;         }
+
+    words.insert(words.end(), { g_spvRecordMagic, g_spvRecordVersion, modeFlags, mode.localSizeX, mode.localSizeY, mode.localSizeZ });
+
+    /* Write binding points */
+    words.push_back(static_cast<std::uint32_t>(record.bindingPoints.size()));
+    for (const SpirvReflect::SpvBindingPoint& binding : record.bindingPoints)
+        words.insert(words.end(), { binding.id, binding.set, binding.setWordOffset, binding.binding, binding.bindingWordOffset });
+
+    /* Write push constant fields with their names padded to word boundaries */
+    words.push_back(static_cast<std::uint32_t>(record.pushConstantFields.size()));
+    for (const SpirvReflectRecord::PushConstantField& field : record.pushConstantFields)
+    {
+        const std::uint32_t nameLength = static_cast<std::uint32_t>(field.name.size());
+        words.insert(words.end(), { field.offset, nameLength });
+        const std::size_t nameOffset = words.size();
+        words.resize(nameOffset + (nameLength + 3) / 4, 0u);
+        ::memcpy(&words[nameOffset], field.name.data(), nameLength);
+    }
+
+    std::vector<char> data;
+    data.resize(words.size() * sizeof(std::uint32_t));
+    ::memcpy(data.data(), words.data(), data.size());
+    return data;
+}
+
+// Helper class to read words from a serialized reflection record with bounds checking.
+class SpvRecordReader
+{
+
+    public:
+
+        SpvRecordReader(const void* data, std::size_t size) :
+            data_ { static_cast<const char*>(data)   },
+            size_ { size / sizeof(std::uint32_t)    }
+        {
+        }
+
+        bool Read(std::uint32_t& outWord)
+        {
+            if (pos_ >= size_)
+                return false;
+            ::memcpy(&outWord, data_ + pos_ * sizeof(std::uint32_t), sizeof(std::uint32_t));
+            ++pos_;
+            return true;
+        }
+
+        bool ReadString(std::string& outString, std::uint32_t length)
+        {
+            const std::size_t numWords = (length + 3) / 4;
+            if (numWords > size_ - pos_)
+                return false;
+            outString.assign(data_ + pos_ * sizeof(std::uint32_t), length);
+            pos_ += numWords;
+            return true;
+        }
+
+        // Returns true if the specified number of words can still be read.
+        bool HasWords(std::size_t numWords) const
+        {
+            return (numWords <= size_ - pos_);
+        }
+
+    private:
+
+        const char*     data_   = nullptr;
+        std::size_t     size_   = 0;
+        std::size_t     pos_    = 0;
+
+};
+
+bool SpirvDeserializeReflectRecord(const void* data, std::size_t size, SpirvReflectRecord& outRecord)
+{
+    if (data == nullptr || size % sizeof(std::uint32_t) != 0)
+        return false;
+
+    SpvRecordReader reader{ data, size };
+
+    /* Read header and execution mode */
+    std::uint32_t magic = 0, version = 0, modeFlags = 0;
+    if (!(reader.Read(magic) && magic == g_spvRecordMagic && reader.Read(version) && version == g_spvRecordVersion))
+        return false;
+
+    SpirvReflectRecord record;
+    SpirvReflect::SpvExecutionMode& mode = record.executionMode;
+    if (!(reader.Read(modeFlags) && reader.Read(mode.localSizeX) && reader.Read(mode.localSizeY) && reader.Read(mode.localSizeZ)))
+        return false;
+
+    mode.earlyFragmentTest  = ((modeFlags & SpvRecordEarlyFragmentTest) != 0);
+    mode.originUpperLeft    = ((modeFlags & SpvRecordOriginUpperLeft  ) != 0);
+    mode.depthGreater       = ((modeFlags & SpvRecordDepthGreater     ) != 0);
+    mode.depthLess          = ((modeFlags & SpvRecordDepthLess        ) != 0);
+
+    /* Read binding points */
+    std::uint32_t numBindingPoints = 0;
+    if (!(reader.Read(numBindingPoints) && reader.HasWords(static_cast<std::size_t>(numBindingPoints) * 5)))
+        return false;
+
+    record.bindingPoints.resize(numBindingPoints);
+    for (SpirvReflect::SpvBindingPoint& binding : record.bindingPoints)
+    {
+        reader.Read(binding.id);
+        reader.Read(binding.set);
+        reader.Read(binding.setWordOffset);
+        reader.Read(binding.binding);
+        reader.Read(binding.bindingWordOffset);
+    }
+
+    /* Read push constant fields */
+    std::uint32_t numPushConstantFields = 0;
+    if (!(reader.Read(numPushConstantFields) && reader.HasWords(static_cast<std::size_t>(numPushConstantFields) * 2)))
+        return false;
+
+    record.pushConstantFields.resize(numPushConstantFields);
+    for (SpirvReflectRecord::PushConstantField& field : record.pushConstantFields)
+    {
+        std::uint32_t nameLength = 0;
+        if (!(reader.Read(field.offset) && reader.Read(nameLength) && reader.ReadString(field.name, nameLength)))
+            return false;
+    }
+
+    outRecord = std::move(record);
+    return true;
+}
+
 
 /*
  * ======= Private: =======
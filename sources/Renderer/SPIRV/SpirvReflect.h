@@ -13,6 +13,7 @@
 #include "SpirvModule.h"
 #include <vector>
 #include <map>
+#include <string>
 
 
 namespace LLGL
@@ -20,6 +21,7 @@ namespace LLGL
 
 
 // Helper class to hold SPIR-V name decorations.
+// Names are stored sparsely, since only a small fraction of all IDs in a module have a name.
 class SpirvNameDecorations
 {
 
@@ -34,19 +36,21 @@ class SpirvNameDecorations
 
         inline void Reset(std::uint32_t idBound)
         {
+            idBound_ = idBound;
+            sorted_ = true;
             names_.clear();
-            names_.resize(idBound);
         }
 
-        inline const char* Get(spv::Id id) const
-        {
-            return (id < names_.size() ? names_[id] : "");
-        }
+        const char* Get(spv::Id id) const;
 
         inline void Set(spv::Id id, const char* name)
         {
-            if (id < names_.size())
-                names_[id] = name;
+            if (id < idBound_)
+            {
+                if (!names_.empty() && id <= names_.back().id)
+                    sorted_ = false;
+                names_.push_back(Entry{ id, name });
+            }
         }
 
     public:
@@ -58,7 +62,17 @@ class SpirvNameDecorations
 
     private:
 
-        std::vector<const char*> names_;
+        struct Entry
+        {
+            spv::Id     id;
+            const char* name;
+        };
+
+    private:
+
+        std::uint32_t               idBound_    = 0;
+        mutable bool                sorted_     = true;
+        mutable std::vector<Entry>  names_;
 
 };
 
@@ -237,6 +251,38 @@ class SpirvReflect
 };
 
 
+/*
+Compact reflection record with all module information that is required to create a shader.
+Unlike the SpirvReflect containers, this record does not refer to the SPIR-V module and can be serialized.
+*/
+struct SpirvReflectRecord
+{
+    // Field of the push constant block.
+    struct PushConstantField
+    {
+        std::string     name;
+        std::uint32_t   offset  = 0;
+    };
+
+    SpirvReflect::SpvExecutionMode              executionMode;
+    std::vector<SpirvReflect::SpvBindingPoint>  bindingPoints;
+    std::vector<PushConstantField>              pushConstantFields;
+};
+
+
+/*
+Reflect the specified SPIR-V module for execution mode, binding points, and push constants in a single pass.
+Only the opcode of each instruction is decoded unless it is one of the few relevant declarations or decorations,
+and parsing stops at the first function body since no more declarations follow in the logical layout of a module.
+*/
+SpirvResult SpirvReflectModuleRecord(const SpirvModuleView& module, SpirvReflectRecord& outRecord);
+
+// Serializes the specified reflection record into a compact byte buffer.
+std::vector<char> SpirvSerializeReflectRecord(const SpirvReflectRecord& record);
+
+// Deserializes the reflection record from the specified byte buffer. Returns false if the buffer is malformed or was written by a different version.
+bool SpirvDeserializeReflectRecord(const void* data, std::size_t size, SpirvReflectRecord& outRecord);
+
 // Reflect the specified SPIR-V module only for the execution mode.
 SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode);
 
@@ -0,0 +1,332 @@
+/*
+ * SpirvStrip.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SpirvStrip.h"
+#include "SpirvInstruction.h"
+#include "SpirvInstructionInfo.h"
+#include <algorithm>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// OpDecorateString and OpMemberDecorateString (formerly SPV_GOOGLE_decorate_string) are not part of the SPIR-V 1.2 headers.
+static const spv::Op g_spvOpDecorateString = static_cast<spv::Op>(5632);
+
+// Location of a single instruction within the SPIR-V module.
+struct SpvInstrLocation
+{
+    std::uint32_t   offset;
+    std::uint32_t   wordCount;
+    spv::Op         opcode;
+};
+
+// Function range within the list of instructions.
+struct SpvFunctionRange
+{
+    spv::Id         id;
+    std::size_t     first;      // Index of OpFunction instruction.
+    std::size_t     last;       // Index of OpFunctionEnd instruction.
+    bool            reachable;
+};
+
+static bool IsSpvDebugInfoInstruction(spv::Op opcode)
+{
+    switch (opcode)
+    {
+        case spv::OpSourceContinued:
+        case spv::OpSource:
+        case spv::OpSourceExtension:
+        case spv::OpString:
+        case spv::OpLine:
+        case spv::OpNoLine:
+        case spv::OpModuleProcessed:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsSpvNameInstruction(spv::Op opcode)
+{
+    return (opcode == spv::OpName || opcode == spv::OpMemberName);
+}
+
+// Returns true if the specified instruction only annotates its target ID, i.e. the target ID is not used by it.
+static bool IsSpvTargetAnnotation(spv::Op opcode)
+{
+    switch (opcode)
+    {
+        case spv::OpName:
+        case spv::OpMemberName:
+        case spv::OpDecorate:
+        case spv::OpMemberDecorate:
+        case spv::OpDecorateId:
+            return true;
+        default:
+            return (opcode == g_spvOpDecorateString);
+    }
+}
+
+// Returns the word index of the result ID of the specified instruction, or 0 if it has no result ID.
+static std::uint32_t GetSpvResultWordIndex(spv::Op opcode)
+{
+    const SpirvInstructionInfo info = GetSpirvInstructionInfo(opcode);
+    if (info.hasResult)
+        return (info.hasType ? 2 : 1);
+    return 0;
+}
+
+SpirvResult SpirvStripModule(SpirvModule& module, long flags)
+{
+    /* Parse SPIR-V header */
+    SpirvHeader header;
+    SpirvResult result = module.ReadHeader(header);
+    if (result != SpirvResult::NoError)
+        return result;
+
+    std::vector<std::uint32_t>& words = module.Words();
+    const std::uint32_t numWords = static_cast<std::uint32_t>(words.size());
+    const std::uint32_t idBound = header.idBound;
+
+    /* Gather all instruction locations and function ranges in a single pass */
+    std::vector<SpvInstrLocation>   instrs;
+    std::vector<SpvFunctionRange>   functions;
+    std::vector<spv::Id>            entryPoints;
+    std::vector<spv::Id>            pushConstantTypes;
+
+    for (std::uint32_t offset = sizeof(SpirvHeader)/sizeof(std::uint32_t); offset < numWords;)
+    {
+        const std::uint32_t wordCount = (words[offset] >> spv::WordCountShift);
+        if (wordCount == 0 || offset + wordCount > numWords)
+            return SpirvResult::InvalidModule;
+
+        const spv::Op opcode = static_cast<spv::Op>(words[offset] & spv::OpCodeMask);
+        const std::uint32_t* instrWords = &words[offset];
+
+        switch (opcode)
+        {
+            case spv::OpEntryPoint:
+                if (wordCount < 3)
+                    return SpirvResult::OperandOutOfBounds;
+                entryPoints.push_back(instrWords[2]);
+                break;
+
+            case spv::OpTypePointer:
+                /* OpTypePointer Result[1] StorageClass[2] Type[3] */
+                if (wordCount < 4)
+                    return SpirvResult::OperandOutOfBounds;
+                if (static_cast<spv::StorageClass>(instrWords[2]) == spv::StorageClassPushConstant)
+                    pushConstantTypes.push_back(instrWords[3]);
+                break;
+
+            case spv::OpFunction:
+                /* OpFunction ResultType[1] Result[2] FunctionControl[3] FunctionType[4] */
+                if (wordCount < 3)
+                    return SpirvResult::OperandOutOfBounds;
+                functions.push_back(SpvFunctionRange{ instrWords[2], instrs.size(), instrs.size(), false });
+                break;
+
+            case spv::OpFunctionEnd:
+                if (functions.empty())
+                    return SpirvResult::InvalidModule;
+                functions.back().last = instrs.size();
+                break;
+
+            default:
+                break;
+        }
+
+        instrs.push_back(SpvInstrLocation{ offset, wordCount, opcode });
+        offset += wordCount;
+    }
+
+    const std::size_t numInstrs = instrs.size();
+    const std::size_t firstFunctionInstr = (functions.empty() ? numInstrs : functions.front().first);
+
+    std::vector<bool> removedInstrs(numInstrs, false);
+    std::vector<bool> removedIds(idBound, false);
+
+    auto MarkRemovedId = [&removedIds, idBound](spv::Id id)
+    {
+        if (id < idBound)
+            removedIds[id] = true;
+    };
+
+    /* Remove debug instructions */
+    if ((flags & SpirvStripFlags::DebugInfo) != 0)
+    {
+        for (std::size_t i = 0; i < numInstrs; ++i)
+        {
+            if (IsSpvDebugInfoInstruction(instrs[i].opcode))
+                removedInstrs[i] = true;
+        }
+    }
+
+    /* Remove functions that are not reachable from any entry point */
+    if ((flags & SpirvStripFlags::UnreachableFunctions) != 0 && !entryPoints.empty())
+    {
+        auto FindFunction = [&functions](spv::Id id) -> SpvFunctionRange*
+        {
+            for (SpvFunctionRange& func : functions)
+            {
+                if (func.id == id)
+                    return &func;
+            }
+            return nullptr;
+        };
+
+        /* Traverse call graph, beginning with all entry points */
+        std::vector<SpvFunctionRange*> pending;
+        for (spv::Id id : entryPoints)
+        {
+            if (SpvFunctionRange* func = FindFunction(id))
+            {
+                if (!func->reachable)
+                {
+                    func->reachable = true;
+                    pending.push_back(func);
+                }
+            }
+        }
+
+        while (!pending.empty())
+        {
+            const SpvFunctionRange* func = pending.back();
+            pending.pop_back();
+
+            for (std::size_t i = func->first; i <= func->last; ++i)
+            {
+                /* OpFunctionCall ResultType[1] Result[2] Function[3] Arguments[4+] */
+                if (instrs[i].opcode == spv::OpFunctionCall && instrs[i].wordCount >= 4)
+                {
+                    if (SpvFunctionRange* callee = FindFunction(words[instrs[i].offset + 3]))
+                    {
+                        if (!callee->reachable)
+                        {
+                            callee->reachable = true;
+                            pending.push_back(callee);
+                        }
+                    }
+                }
+            }
+        }
+
+        /* Remove unreachable functions including all IDs they define */
+        for (const SpvFunctionRange& func : functions)
+        {
+            if (func.reachable)
+                continue;
+
+            for (std::size_t i = func.first; i <= func.last; ++i)
+            {
+                removedInstrs[i] = true;
+                if (std::uint32_t resultIndex = GetSpvResultWordIndex(instrs[i].opcode))
+                {
+                    if (resultIndex < instrs[i].wordCount)
+                        MarkRemovedId(words[instrs[i].offset + resultIndex]);
+                }
+            }
+        }
+    }
+
+    /* Remove global variables that are not referenced by any remaining instruction */
+    if ((flags & SpirvStripFlags::UnusedVariables) != 0)
+    {
+        /*
+        Gather all IDs that are used by remaining instructions except annotations.
+        Literal operands are treated as IDs as well, which can only keep an unused variable alive but never remove a used one.
+        */
+        std::vector<bool> usedIds(idBound, false);
+
+        for (std::size_t i = 0; i < numInstrs; ++i)
+        {
+            const SpvInstrLocation& instr = instrs[i];
+            if (removedInstrs[i] || IsSpvTargetAnnotation(instr.opcode))
+                continue;
+
+            const std::uint32_t resultIndex = GetSpvResultWordIndex(instr.opcode);
+            for (std::uint32_t j = 1; j < instr.wordCount; ++j)
+            {
+                const std::uint32_t word = words[instr.offset + j];
+                if (j != resultIndex && word < idBound)
+                    usedIds[word] = true;
+            }
+        }
+
+        for (std::size_t i = 0; i < firstFunctionInstr; ++i)
+        {
+            /* OpVariable ResultType[1] Result[2] StorageClass[3] (Initializer[4]) */
+            const SpvInstrLocation& instr = instrs[i];
+            if (instr.opcode == spv::OpVariable && instr.wordCount >= 4 && !removedInstrs[i])
+            {
+                const spv::Id id = words[instr.offset + 2];
+                if (id < idBound && !usedIds[id])
+                {
+                    removedInstrs[i] = true;
+                    MarkRemovedId(id);
+                }
+            }
+        }
+    }
+
+    /* Remove names and annotations of removed IDs, and all debug names except for push constant blocks */
+    const bool stripNames = ((flags & SpirvStripFlags::DebugNames) != 0);
+
+    for (std::size_t i = 0; i < firstFunctionInstr; ++i)
+    {
+        const SpvInstrLocation& instr = instrs[i];
+        if (removedInstrs[i] || !IsSpvTargetAnnotation(instr.opcode) || instr.wordCount < 2)
+            continue;
+
+        /* Target ID is always the first operand of annotations */
+        const spv::Id target = words[instr.offset + 1];
+        if (target < idBound && removedIds[target])
+            removedInstrs[i] = true;
+        else if (stripNames && IsSpvNameInstruction(instr.opcode))
+        {
+            bool isPushConstantType = false;
+            for (spv::Id typeId : pushConstantTypes)
+            {
+                if (typeId == target)
+                {
+                    isPushConstantType = true;
+                    break;
+                }
+            }
+            if (!isPushConstantType)
+                removedInstrs[i] = true;
+        }
+    }
+
+    /* Compact remaining instructions in-place */
+    std::uint32_t writeOffset = sizeof(SpirvHeader)/sizeof(std::uint32_t);
+    for (std::size_t i = 0; i < numInstrs; ++i)
+    {
+        if (removedInstrs[i])
+            continue;
+
+        const SpvInstrLocation& instr = instrs[i];
+        if (writeOffset != instr.offset)
+            std::copy(words.begin() + instr.offset, words.begin() + instr.offset + instr.wordCount, words.begin() + writeOffset);
+        writeOffset += instr.wordCount;
+    }
+
+    words.resize(writeOffset);
+    words.shrink_to_fit();
+
+    return SpirvResult::NoError;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,55 @@
+/*
+ * SpirvStrip.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SPIRV_STRIP_H
+#define LLGL_SPIRV_STRIP_H
+
+
+#include "SpirvModule.h"
+
+
+namespace LLGL
+{
+
+
+// SPIR-V module strip flags.
+struct SpirvStripFlags
+{
+    enum
+    {
+        // Strips source, line, and module-processed debug instructions.
+        DebugInfo               = (1 << 0),
+
+        // Strips OpName and OpMemberName instructions, except for push constant blocks whose member names are required for reflection.
+        DebugNames              = (1 << 1),
+
+        // Strips functions that are not reachable from any entry point.
+        UnreachableFunctions    = (1 << 2),
+
+        // Strips global variables that are not referenced by any entry point or remaining function.
+        UnusedVariables         = (1 << 3),
+
+        All                     = (DebugInfo | DebugNames | UnreachableFunctions | UnusedVariables),
+    };
+};
+
+/*
+Strips debug instructions and dead code from the specified SPIR-V module in-place.
+Decorations and names that refer to removed IDs are removed as well. The ID bound in the module header remains unchanged.
+This invalidates all word offsets into the module, so it must be done before the module is reflected.
+*/
+SpirvResult SpirvStripModule(SpirvModule& module, long flags = SpirvStripFlags::All);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
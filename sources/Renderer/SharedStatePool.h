@@ -0,0 +1,128 @@
+/*
+ * SharedStatePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHARED_STATE_POOL_H
+#define LLGL_SHARED_STATE_POOL_H
+
+
+#include "../Core/CoreUtils.h"
+#include "../Core/CPUProfilerUtils.h"
+#include <LLGL/NonCopyable.h>
+#include <vector>
+#include <mutex>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace LLGL
+{
+
+
+/*
+Thread-safe pool of reference counted native state objects, which are shared between all render system objects with identical descriptors.
+This is used for immutable native objects that are expensive to create or limited in number, e.g. Vulkan samplers.
+Descriptors are compared bytewise, so they must be zero-initialized (including padding bytes) before they are filled in.
+The object type must own the native handle and provide access to it via Get(), e.g. ComPtr or VKPtr.
+*/
+template <typename TDesc, typename TObject>
+class SharedStatePool final : public NonCopyable
+{
+
+        static_assert(std::is_trivially_copyable<TDesc>::value, "SharedStatePool<TDesc, TObject>: TDesc must be trivially copyable");
+
+    public:
+
+        using HandleType = decltype(std::declval<const TObject&>().Get());
+
+    public:
+
+        /*
+        Returns the native object for the specified descriptor and increments its reference counter.
+        If there is no such object yet, it is created with the specified function, which must return a TObject.
+        */
+        template <typename TCreateFunc>
+        HandleType Acquire(const TDesc& desc, TCreateFunc createFunc)
+        {
+            LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "SharedStatePool");
+
+            std::size_t insertionIndex = 0;
+            if (Entry* entry = FindEntry(desc, insertionIndex))
+            {
+                ++entry->refCount;
+                return entry->object.Get();
+            }
+
+            /* Create new native object with insertion sort */
+            auto entryIter = entries_.insert(entries_.begin() + insertionIndex, Entry{ desc, createFunc(desc), 1 });
+            return entryIter->object.Get();
+        }
+
+        // Decrements the reference counter of the specified native object and destroys it when it's no longer used.
+        void Release(HandleType handle)
+        {
+            LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "SharedStatePool");
+            for (auto it = entries_.begin(); it != entries_.end(); ++it)
+            {
+                if (it->object.Get() == handle)
+                {
+                    if (--it->refCount == 0)
+                        entries_.erase(it);
+                    return;
+                }
+            }
+        }
+
+        // Returns the number of unique native objects in this pool.
+        std::size_t GetSize() const
+        {
+            LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "SharedStatePool");
+            return entries_.size();
+        }
+
+    private:
+
+        struct Entry
+        {
+            TDesc           desc;
+            TObject         object;
+            std::uint32_t   refCount;
+        };
+
+    private:
+
+        // Searches the entry with the specified descriptor with complexity O(log n).
+        Entry* FindEntry(const TDesc& desc, std::size_t& insertionIndex)
+        {
+            return FindInSortedArray<Entry>(
+                entries_.data(),
+                entries_.size(),
+                [&desc](const Entry& entry) -> int
+                {
+                    return std::memcmp(&desc, &(entry.desc), sizeof(TDesc));
+                },
+                &insertionIndex
+            );
+        }
+
+    private:
+
+        std::vector<Entry>  entries_;
+        mutable std::mutex  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
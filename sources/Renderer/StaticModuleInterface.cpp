@@ -41,6 +41,10 @@ LLGL_DECLARE_STATIC_MODULE_INTERFACE(OpenGLES3);
 
 #ifdef LLGL_BUILD_RENDERER_VULKAN
 LLGL_DECLARE_STATIC_MODULE_INTERFACE(Vulkan);
+namespace ModuleVulkan
+{
+    extern bool ProbeRenderSystem(const LLGL::RenderSystemDescriptor*, LLGL::RenderSystemProbe*);
+}
 #endif
 
 #ifdef LLGL_BUILD_RENDERER_METAL
@@ -205,6 +209,26 @@ RenderSystem* AllocRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     return nullptr;
 }
 
+bool SupportsProbe(const std::string& moduleName)
+{
+    #ifdef LLGL_BUILD_RENDERER_VULKAN
+    if (moduleName == ModuleVulkan::GetModuleName())
+        return true;
+    #endif
+
+    return false;
+}
+
+bool ProbeRenderSystem(const RenderSystemDescriptor& renderSystemDesc, RenderSystemProbe& outProbe)
+{
+    #ifdef LLGL_BUILD_RENDERER_VULKAN
+    if (renderSystemDesc.moduleName == ModuleVulkan::GetModuleName())
+        return ModuleVulkan::ProbeRenderSystem(&renderSystemDesc, &outProbe);
+    #endif
+
+    return false;
+}
+
 
 } // /namespace StaticModule
 
@@ -36,6 +36,12 @@ int GetRendererID(const std::string& moduleName);
 // Allocates a new renderer system of the specified module. This is an owning raw pointer!
 RenderSystem* AllocRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
 
+// Returns true if the specified module can be probed without allocating a render system.
+bool SupportsProbe(const std::string& moduleName);
+
+// Probes the adapters and capabilities of the specified module without allocating a render system. See SupportsProbe.
+bool ProbeRenderSystem(const RenderSystemDescriptor& renderSystemDesc, RenderSystemProbe& outProbe);
+
 
 } // /namespace StaticModule
 
@@ -23,6 +23,7 @@ struct SwapChain::Pimpl
     Extent2D                    resolution;
     Offset2D                    normalModeSurfacePos;
     bool                        normalModeSurfacePosStored = false;
+    bool                        surfaceDetached            = false;
 };
 
 SwapChain::SwapChain() :
@@ -114,6 +115,21 @@ bool SwapChain::ResizeBuffers(const Extent2D& resolution, long flags)
     return false;
 }
 
+void SwapChain::PresentWithDamage(std::uint32_t /*numDamageRects*/, const Scissor* /*damageRects*/)
+{
+    Present();
+}
+
+bool SwapChain::WaitForNextFrame(std::uint64_t /*timeout*/)
+{
+    return true; // dummy
+}
+
+SurfaceTransform SwapChain::GetSurfaceTransform() const
+{
+    return SurfaceTransform::Identity;
+}
+
 /* ----- Configuration ----- */
 
 bool SwapChain::SwitchFullscreen(bool enable)
@@ -139,11 +155,50 @@ Surface& SwapChain::GetSurface() const
     return *(pimpl_->surface);
 }
 
+void SwapChain::DetachSurface()
+{
+    if (!pimpl_->surfaceDetached)
+    {
+        DetachSurfacePrimary();
+        pimpl_->surfaceDetached = true;
+    }
+}
+
+bool SwapChain::AttachSurface()
+{
+    if (pimpl_->surfaceDetached)
+    {
+        /* Take resolution from new surface */
+        const Extent2D resolution = GetSurface().GetContentSize();
+        if (resolution.x == 0 || resolution.y == 0 || !AttachSurfacePrimary(resolution))
+            return false;
+
+        pimpl_->resolution      = resolution;
+        pimpl_->surfaceDetached = false;
+    }
+    return true;
+}
+
+bool SwapChain::IsSurfaceDetached() const
+{
+    return pimpl_->surfaceDetached;
+}
+
 
 /*
  * ======= Protected: =======
  */
 
+void SwapChain::DetachSurfacePrimary()
+{
+    // dummy
+}
+
+bool SwapChain::AttachSurfacePrimary(const Extent2D& resolution)
+{
+    return ResizeBuffersPrimary(resolution);
+}
+
 void SwapChain::SetOrCreateSurface(
     const std::shared_ptr<Surface>& surface,
     const Extent2D&                 size,
@@ -23,6 +23,16 @@ ResourceType Texture::GetResourceType() const
     return ResourceType::Texture;
 }
 
+bool Texture::GetSparseProperties(SparseTextureProperties& /*outProperties*/) const
+{
+    return false; // dummy
+}
+
+bool Texture::SetMinLOD(float /*minLOD*/)
+{
+    return false; // dummy
+}
+
 
 } // /namespace LLGL
 
@@ -33,6 +33,131 @@ struct DefaultBufferGrowPolicy
     }
 };
 
+// POD structure for the memory chunks of virtual command buffers. These chunks contain a payload at the end of the struct.
+struct VirtualCommandChunk
+{
+    std::size_t             capacity;
+    std::size_t             size;
+    VirtualCommandChunk*    next;
+    // <payload>
+};
+
+/*
+Thread local free-list of memory chunks that is shared between all virtual command buffers.
+Chunks are returned to the pool of the thread that releases them, so no synchronization is required.
+*/
+class VirtualCommandChunkPool
+{
+
+    public:
+
+        // Maximum number of bytes that are kept in the pool of each thread. Chunks beyond this limit are freed immediately.
+        static constexpr std::size_t maxPoolSize = 4u * 1024u * 1024u;
+
+    public:
+
+        // Allocates a new memory chunk with at least the specified capacity plus sizeof(VirtualCommandChunk).
+        static VirtualCommandChunk* Alloc(std::size_t capacity)
+        {
+            PoolState& pool = VirtualCommandChunkPool::GetPoolState();
+
+            /* Find smallest pooled chunk that fits, but don't waste chunks that are more than twice as big as requested */
+            VirtualCommandChunk** bestFit = nullptr;
+            for (VirtualCommandChunk** c = &(pool.first); *c != nullptr; c = &((*c)->next))
+            {
+                if ((*c)->capacity >= capacity && (*c)->capacity <= capacity * 2)
+                {
+                    if (bestFit == nullptr || (*c)->capacity < (*bestFit)->capacity)
+                        bestFit = c;
+                }
+            }
+
+            if (bestFit != nullptr)
+            {
+                /* Take chunk out of the pool */
+                VirtualCommandChunk* chunk = *bestFit;
+                *bestFit = chunk->next;
+                pool.size -= chunk->capacity;
+                return chunk;
+            }
+
+            /* Allocate new chunk */
+            VirtualCommandChunk* chunk = reinterpret_cast<VirtualCommandChunk*>(::new std::uint8_t[sizeof(VirtualCommandChunk) + capacity]);
+            chunk->capacity = capacity;
+            return chunk;
+        }
+
+        // Returns the specified memory chunk to the pool or deletes it if the pool is full.
+        static void Free(VirtualCommandChunk* chunk)
+        {
+            if (chunk != nullptr)
+            {
+                PoolState& pool = VirtualCommandChunkPool::GetPoolState();
+                if (pool.enabled && pool.size + chunk->capacity <= maxPoolSize)
+                {
+                    chunk->next = pool.first;
+                    pool.first  = chunk;
+                    pool.size   += chunk->capacity;
+                }
+                else
+                    VirtualCommandChunkPool::Delete(chunk);
+            }
+        }
+
+    private:
+
+        // Trivially destructible state of each thread's pool, so it remains accessible while other thread local and static objects are destroyed.
+        struct PoolState
+        {
+            VirtualCommandChunk*    first;
+            std::size_t             size;
+            bool                    enabled;
+        };
+
+        // Frees all pooled chunks when the thread exits and disables the pool for any remaining virtual command buffers.
+        struct PoolJanitor
+        {
+            PoolJanitor()
+            {
+                VirtualCommandChunkPool::GetPoolStateStorage().enabled = true;
+            }
+            ~PoolJanitor()
+            {
+                PoolState& pool = VirtualCommandChunkPool::GetPoolStateStorage();
+                pool.enabled = false;
+                for (VirtualCommandChunk* c = pool.first, *next = nullptr; c != nullptr; c = next)
+                {
+                    next = c->next;
+                    VirtualCommandChunkPool::Delete(c);
+                }
+                pool.first  = nullptr;
+                pool.size   = 0;
+            }
+        };
+
+    private:
+
+        static void Delete(VirtualCommandChunk* chunk)
+        {
+            std::uint8_t* buf = reinterpret_cast<std::uint8_t*>(chunk);
+            delete [] buf;
+        }
+
+        static PoolState& GetPoolStateStorage()
+        {
+            static thread_local PoolState state{ nullptr, 0, false };
+            return state;
+        }
+
+        static PoolState& GetPoolState()
+        {
+            static thread_local PoolJanitor janitor;
+            (void)janitor;
+            return GetPoolStateStorage();
+        }
+
+};
+
 // Container class to manage the memory for virtual command buffers.
 template <typename TOpcode, typename TGrowPolicy = DefaultBufferGrowPolicy>
 class VirtualCommandBuffer
@@ -40,14 +165,7 @@ class VirtualCommandBuffer
 
     private:
 
-        // POD structure for the memory chunks. These chunks contain a payload at the end of the struct.
-        struct Chunk
-        {
-            std::size_t capacity;
-            std::size_t size;
-            Chunk*      next;
-            // <payload>
-        };
+        using Chunk = VirtualCommandChunk;
 
     public:
 
@@ -135,6 +253,8 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(last_, rhs.last_);
+            std::swap(lastSize_, rhs.lastSize_);
             std::swap(size_, rhs.size_);
         }
 
@@ -143,6 +263,8 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(last_, rhs.last_);
+            std::swap(lastSize_, rhs.lastSize_);
             std::swap(size_, rhs.size_);
             return *this;
         }
@@ -177,15 +299,56 @@ class VirtualCommandBuffer
             return (Size() == 0);
         }
 
-        // Clears the container but keeps the allocated capacity.
+        /*
+        Clears the container but keeps the allocated capacity.
+        If the previous content spanned multiple chunks, they are returned to the chunk pool
+        and replaced by a single chunk that fits the previous size, i.e. the high-water mark of the last encoding.
+        */
         void Clear()
         {
             if (!Empty())
             {
+                const std::size_t highWaterMark = size_;
+                const bool spannedMultipleChunks = (first_ != current_);
+
                 for (Chunk* c = first_; c != nullptr; c = c->next)
                     c->size = 0;
                 current_    = first_;
                 size_       = 0;
+
+                if (spannedMultipleChunks)
+                    Reserve(highWaterMark);
+            }
+            ResetLast();
+        }
+
+        /*
+        Ensures the first chunk has at least the specified capacity (in bytes) so that many commands can be encoded without further allocations.
+        This has no effect if the buffer is not empty or the first chunk is already big enough.
+        */
+        void Reserve(std::size_t capacity)
+        {
+            if (Empty() && (first_ == nullptr || first_->capacity < capacity || first_->next != nullptr))
+            {
+                if (first_ != nullptr && first_->capacity >= capacity)
+                {
+                    /* Keep first chunk and release all others */
+                    for (Chunk* c = first_->next, *next = nullptr; c != nullptr; c = next)
+                    {
+                        next = c->next;
+                        VirtualCommandBuffer::FreeChunk(c);
+                    }
+                    first_->next = nullptr;
+                }
+                else
+                {
+                    /* Replace all chunks with a single chunk */
+                    Release();
+                    first_ = VirtualCommandBuffer::AllocChunk(std::max(capacity, initialCapacity_));
+                }
+                current_    = first_;
+                biggest_    = first_;
+                capacity_   = first_->capacity;
             }
         }
 
@@ -202,6 +365,7 @@ class VirtualCommandBuffer
             biggest_    = nullptr;
             capacity_   = 0;
             size_       = 0;
+            ResetLast();
         }
 
         // Packs the entire buffer to one consecutive memory block.
@@ -217,6 +381,7 @@ class VirtualCommandBuffer
                 else
                     PackNew();
             }
+            ResetLast();
         }
 
         // Allocates a new opcode in this virtual command buffer.
@@ -235,6 +400,45 @@ class VirtualCommandBuffer
             return reinterpret_cast<TCommand*>(data + sizeof(opcode));
         }
 
+        // Returns the opcode of the last allocated command or zero if there is no such command, e.g. after the buffer has been packed.
+        TOpcode LastOpcode() const
+        {
+            return (last_ != nullptr ? *reinterpret_cast<const TOpcode*>(last_) : TOpcode(0));
+        }
+
+        // Returns the last allocated command if it has the specified opcode and payload size (in bytes). Otherwise, null is returned.
+        template <typename TCommand>
+        TCommand* LastCommand(const TOpcode opcode, std::size_t payloadSize = 0)
+        {
+            if (LastOpcode() == opcode && lastSize_ == sizeof(opcode) + sizeof(TCommand) + payloadSize)
+                return reinterpret_cast<TCommand*>(last_ + sizeof(opcode));
+            return nullptr;
+        }
+
+        /*
+        Replaces the opcode of the last allocated command and appends an extension with optional payload (in bytes) to its arguments.
+        This is used to fuse a sequence of commands into a single superinstruction. The previous command arguments are preserved.
+        */
+        template <typename TExtension>
+        TExtension* ExtendLastCommand(const TOpcode opcode, std::size_t payloadSize = 0)
+        {
+            LLGL_ASSERT_PTR(last_);
+
+            /* Release last command; its memory is left intact within the current chunk */
+            const char*         lastData = last_;
+            const std::size_t   lastSize = lastSize_;
+            current_->size  -= lastSize;
+            size_           -= lastSize;
+
+            /* Re-allocate command with extension; this only copies the arguments if the command has moved into the next chunk */
+            char* data = AllocData(lastSize + sizeof(TExtension) + payloadSize);
+            if (data != lastData)
+                ::memcpy(data, lastData, lastSize);
+            *reinterpret_cast<TOpcode*>(data) = opcode;
+
+            return reinterpret_cast<TExtension*>(data + lastSize);
+        }
+
     public:
 
         // STL compatible function to return the constant iterator to the first memory chunk.
@@ -263,26 +467,21 @@ class VirtualCommandBuffer
 
     private:
 
-        // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk).
+        // Allocates a memory chunk of at least the specified capacity plus sizeof(Chunk) from the chunk pool.
         static Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
         {
-            Chunk* chunk = reinterpret_cast<Chunk*>(::new std::uint8_t[sizeof(Chunk) + capacity]);
+            Chunk* chunk = VirtualCommandChunkPool::Alloc(capacity);
             {
-                chunk->capacity = capacity;
-                chunk->size     = 0;
-                chunk->next     = next;
+                chunk->size = 0;
+                chunk->next = next;
             }
             return chunk;
         }
 
-        // Deletes the specified memory chunk.
+        // Returns the specified memory chunk to the chunk pool.
         static void FreeChunk(Chunk* chunk)
         {
-            if (chunk != nullptr)
-            {
-                std::uint8_t* buf = reinterpret_cast<std::uint8_t*>(chunk);
-                delete [] buf;
-            }
+            VirtualCommandChunkPool::Free(chunk);
         }
 
         // Returns a raw pointer to the beginning of the chunk data.
@@ -310,8 +509,8 @@ class VirtualCommandBuffer
         {
             current_->next = VirtualCommandBuffer::AllocChunk(capacity, next);
             current_ = current_->next;
-            capacity_ += capacity;
-            if (biggest_ == nullptr || capacity > biggest_->capacity)
+            capacity_ += current_->capacity;
+            if (biggest_ == nullptr || current_->capacity > biggest_->capacity)
                 biggest_ = current_;
         }
 
@@ -335,6 +534,7 @@ class VirtualCommandBuffer
                         Chunk* secondNext = current_->next->next;
                         if (biggest_ == current_->next)
                             biggest_ = secondNext;
+                        capacity_ -= current_->next->capacity;
                         VirtualCommandBuffer::FreeChunk(current_->next);
                         AllocNextChunkAndMakeCurrent(capacity, secondNext);
                     }
@@ -351,7 +551,7 @@ class VirtualCommandBuffer
                 first_      = VirtualCommandBuffer::AllocChunk(capacity);
                 current_    = first_;
                 biggest_    = first_;
-                capacity_   = capacity;
+                capacity_   = first_->capacity;
             }
         }
 
@@ -372,10 +572,19 @@ class VirtualCommandBuffer
             char* data = VirtualCommandBuffer::GetChunkData(current_) + current_->size;
             current_->size += size;
             LLGL_ASSERT(current_->size <= current_->capacity);
-            size_ += size;
+            size_       += size;
+            last_       = data;
+            lastSize_   = size;
             return data;
         }
 
+        // Resets the reference to the last allocated command.
+        void ResetLast()
+        {
+            last_       = nullptr;
+            lastSize_   = 0;
+        }
+
         // Returns the biggest memory chunk.
         Chunk* FindBiggestChunk() const
         {
@@ -432,7 +641,7 @@ class VirtualCommandBuffer
             first_      = chunk;
             current_    = chunk;
             biggest_    = chunk;
-            capacity_   = chunk->size;
+            capacity_   = chunk->capacity;
         }
 
         // Packs the entire virtual command buffer into a new single memory chunk.
@@ -457,7 +666,7 @@ class VirtualCommandBuffer
             first_      = chunk;
             current_    = chunk;
             biggest_    = chunk;
-            capacity_   = chunk->size;
+            capacity_   = chunk->capacity;
         }
 
     private:
@@ -465,6 +674,8 @@ class VirtualCommandBuffer
         Chunk*      first_              = nullptr;
         Chunk*      current_            = nullptr;
         Chunk*      biggest_            = nullptr; // Keep track of biggest chunk for packing
+        char*       last_               = nullptr; // Last allocated command for peephole optimizations
+        std::size_t lastSize_           = 0;
         std::size_t capacity_           = 0;
         std::size_t size_               = 0;
         std::size_t initialCapacity_    = TGrowPolicy::MinChunkCapacity();
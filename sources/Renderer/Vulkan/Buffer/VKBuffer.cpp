@@ -9,6 +9,8 @@
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../VKDevice.h"
+#include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKTransientBufferRing.h"
 #include "../Ext/VKExtensions.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../../ResourceUtils.h"
@@ -21,7 +23,8 @@ namespace LLGL
 
 static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
 {
-    VkBufferUsageFlags flags = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    /* Primary buffers can always be copied from, so they can be relocated during device memory defragmentation */
+    VkBufferUsageFlags flags = (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
 
     if ((desc.bindFlags & BindFlags::VertexBuffer) != 0)
         flags |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
@@ -48,9 +51,6 @@ static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
         }
     }
 
-    if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 || (desc.bindFlags & BindFlags::CopySrc) != 0)
-        flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-
     return flags;
 }
 
@@ -76,7 +76,7 @@ static VkAccessFlags GetBufferVkAccessFlags(long bindFlags)
     return accessFlags;
 }
 
-VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
+VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc, const ArrayView<std::uint32_t>& sharedQueueFamilies) :
     Buffer            { desc.bindFlags                         },
     bufferObj_        { device                                 },
     bufferObjStaging_ { device                                 },
@@ -97,6 +97,13 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
         createInfo.queueFamilyIndexCount    = 0;
         createInfo.pQueueFamilyIndices      = nullptr;
     }
+    if (!sharedQueueFamilies.empty())
+    {
+        /* Share buffer between queue families without ownership transfers */
+        createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(sharedQueueFamilies.size());
+        createInfo.pQueueFamilyIndices      = sharedQueueFamilies.data();
+    }
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
 
@@ -114,6 +121,16 @@ BufferDescriptor VKBuffer::GetDesc() const
     return bufferDesc;
 }
 
+bool VKBuffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    if (directMemory_)
+        return directMemory_->SetPriority(VKTypes::ToVkMemoryPriority(priority));
+    else if (VKDeviceMemoryRegion* region = bufferObj_.GetMemoryRegion())
+        return region->GetParentChunk()->SetPriority(VKTypes::ToVkMemoryPriority(priority));
+    else
+        return false;
+}
+
 void VKBuffer::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion)
 {
     bufferObj_.BindMemoryRegion(device, memoryRegion);
@@ -124,8 +141,32 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
     bufferObjStaging_ = std::move(deviceBuffer);
 }
 
+void VKBuffer::BindDirectMemory(VkDevice device, std::unique_ptr<VKDeviceMemory>&& deviceMemory)
+{
+    directMemory_ = std::move(deviceMemory);
+
+    VkResult result = vkBindBufferMemory(device, GetVkBuffer(), directMemory_->GetVkDeviceMemory(), 0);
+    VKThrowIfFailed(result, "failed to bind device memory to Vulkan direct upload buffer");
+
+    /* Keep memory mapped for the entire lifetime of this buffer */
+    mappedData_ = static_cast<char*>(directMemory_->Map(device, 0, VK_WHOLE_SIZE));
+}
+
+void VKBuffer::BindTransientMemory(VkDevice device, const VKTransientBufferRing& ring, VkDeviceSize offset)
+{
+    VkResult result = vkBindBufferMemory(device, GetVkBuffer(), ring.GetVkDeviceMemory(), offset);
+    VKThrowIfFailed(result, "failed to bind device memory to Vulkan transient buffer");
+
+    /* Ring memory is mapped persistently, so this buffer can be written just like a direct upload buffer */
+    mappedData_ = ring.GetMappedData() + offset;
+}
+
 void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length)
 {
+    /* Directly mapped buffers don't need any copies, since host and device share the same memory */
+    if (IsDirectlyMapped())
+        return mappedData_;
+
     if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Copy GPU local buffer into staging buffer for read accces */
@@ -10,8 +10,10 @@
 
 
 #include <LLGL/Buffer.h>
+#include <LLGL/Container/ArrayView.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
+#include <memory>
 
 
 namespace LLGL
@@ -19,6 +21,7 @@ namespace LLGL
 
 
 class VKDevice;
+class VKTransientBufferRing;
 
 class VKBuffer : public Buffer
 {
@@ -27,13 +30,22 @@ class VKBuffer : public Buffer
 
         BufferDescriptor GetDesc() const override;
 
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+
     public:
 
-        VKBuffer(VkDevice device, const BufferDescriptor& desc);
+        // Creates the buffer in concurrent sharing mode if 'sharedQueueFamilies' is not empty.
+        VKBuffer(VkDevice device, const BufferDescriptor& desc, const ArrayView<std::uint32_t>& sharedQueueFamilies = {});
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
 
+        // Binds the specified dedicated device memory, which must be host visible, and maps it persistently (for MiscFlags::DirectUpload).
+        void BindDirectMemory(VkDevice device, std::unique_ptr<VKDeviceMemory>&& deviceMemory);
+
+        // Binds a range of the persistently mapped memory of the specified transient buffer ring (for MiscFlags::Transient). The memory is owned by the ring.
+        void BindTransientMemory(VkDevice device, const VKTransientBufferRing& ring, VkDeviceSize offset);
+
         void* Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length);
         void Unmap(VKDevice& device);
 
@@ -79,6 +91,24 @@ class VKBuffer : public Buffer
             return size_;
         }
 
+        // Returns the dedicated device memory of a directly mapped buffer or null if this buffer uses regular device memory.
+        inline VKDeviceMemory* GetDirectMemory() const
+        {
+            return directMemory_.get();
+        }
+
+        // Returns the persistently mapped memory of a directly mapped buffer or null if this buffer uses regular device memory.
+        inline char* GetMappedData() const
+        {
+            return mappedData_;
+        }
+
+        // Returns true if this buffer is persistently mapped into device local memory that is visible to the host.
+        inline bool IsDirectlyMapped() const
+        {
+            return (mappedData_ != nullptr);
+        }
+
         // Returns the VkIndexType specified at creation time.
         inline VkIndexType GetIndexType() const
         {
@@ -93,9 +123,13 @@ class VKBuffer : public Buffer
 
     private:
 
+        std::unique_ptr<VKDeviceMemory> directMemory_; // Must be declared before bufferObj_, so the memory is released after the buffer
+
         VKDeviceBuffer  bufferObj_;
         VKDeviceBuffer  bufferObjStaging_;
 
+        char*           mappedData_             = nullptr;
+
         VkDeviceSize    size_                   = 0;
         VkDeviceSize    mappedWriteRange_[2]    = { 0, 0 };
 
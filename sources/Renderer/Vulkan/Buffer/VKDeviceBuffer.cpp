@@ -42,7 +42,9 @@ VKDeviceBuffer::VKDeviceBuffer(
 VKDeviceBuffer::VKDeviceBuffer(VKDeviceBuffer&& rhs) noexcept :
     buffer_       { std::move(rhs.buffer_) },
     requirements_ { rhs.requirements_      },
-    memoryRegion_ { rhs.memoryRegion_      }
+    memoryRegion_ { rhs.memoryRegion_      },
+    size_         { rhs.size_              },
+    usage_        { rhs.usage_             }
 {
     rhs.memoryRegion_ = nullptr;
 }
@@ -52,6 +54,8 @@ VKDeviceBuffer& VKDeviceBuffer::operator = (VKDeviceBuffer&& rhs) noexcept
     buffer_             = std::move(rhs.buffer_);
     requirements_       = rhs.requirements_;
     memoryRegion_       = rhs.memoryRegion_;
+    size_               = rhs.size_;
+    usage_              = rhs.usage_;
     rhs.memoryRegion_   = nullptr;
     return *this;
 }
@@ -64,6 +68,8 @@ void VKDeviceBuffer::CreateVkBuffer(VkDevice device, const VkBufferCreateInfo& c
     auto result = vkCreateBuffer(device, &createInfo, nullptr, buffer_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan buffer");
     vkGetBufferMemoryRequirements(device, buffer_, &requirements_);
+    size_   = createInfo.size;
+    usage_  = createInfo.usage;
 }
 
 void VKDeviceBuffer::CreateVkBufferAndMemoryRegion(
@@ -86,11 +86,25 @@ class VKDeviceBuffer
             return memoryRegion_;
         }
 
+        // Returns the size the native VkBuffer was created with.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the usage flags the native VkBuffer was created with.
+        inline VkBufferUsageFlags GetUsage() const
+        {
+            return usage_;
+        }
+
     private:
 
         VKPtr<VkBuffer>         buffer_;
         VkMemoryRequirements    requirements_   = {};
         VKDeviceMemoryRegion*   memoryRegion_   = nullptr;
+        VkDeviceSize            size_           = 0;
+        VkBufferUsageFlags      usage_          = 0;
 
 };
 
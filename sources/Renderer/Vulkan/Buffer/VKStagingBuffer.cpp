@@ -0,0 +1,132 @@
+/*
+ * VKStagingBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKStagingBuffer.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/ImageUtils.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+constexpr VkDeviceSize VKStagingBuffer::writeAlignment;
+
+VKStagingBuffer::VKStagingBuffer(VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize size) :
+    buffer_ { deviceMemoryMngr.GetVkDevice(), vkDestroyBuffer },
+    size_   { size                                            }
+{
+    VkDevice device = deviceMemoryMngr.GetVkDevice();
+
+    /* Create native Vulkan buffer that can only be used as copy source */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = size;
+        createInfo.usage                    = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    VkResult result = vkCreateBuffer(device, &createInfo, nullptr, buffer_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan staging buffer");
+
+    /* Allocate dedicated device memory chunk, bind it to the buffer, and map it persistently into host memory */
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, buffer_, &requirements);
+
+    deviceMemory_ = deviceMemoryMngr.AllocateDedicatedChunk(
+        requirements,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    );
+
+    result = vkBindBufferMemory(device, buffer_, deviceMemory_->GetVkDeviceMemory(), 0);
+    VKThrowIfFailed(result, "failed to bind device memory to Vulkan staging buffer");
+
+    mappedData_ = static_cast<char*>(deviceMemory_->Map(device, 0, VK_WHOLE_SIZE));
+}
+
+VKStagingBuffer::VKStagingBuffer(VKStagingBuffer&& rhs) noexcept :
+    buffer_       { std::move(rhs.buffer_)       },
+    deviceMemory_ { std::move(rhs.deviceMemory_) },
+    mappedData_   { rhs.mappedData_              },
+    size_         { rhs.size_                    },
+    offset_       { rhs.offset_                  }
+{
+    rhs.mappedData_ = nullptr;
+    rhs.size_       = 0;
+    rhs.offset_     = 0;
+}
+
+VKStagingBuffer& VKStagingBuffer::operator = (VKStagingBuffer&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        buffer_         = std::move(rhs.buffer_);
+        deviceMemory_   = std::move(rhs.deviceMemory_);
+        mappedData_     = rhs.mappedData_;
+        size_           = rhs.size_;
+        offset_         = rhs.offset_;
+        rhs.mappedData_ = nullptr;
+        rhs.size_       = 0;
+        rhs.offset_     = 0;
+    }
+    return *this;
+}
+
+void VKStagingBuffer::Reset()
+{
+    offset_ = 0;
+}
+
+bool VKStagingBuffer::Capacity(VkDeviceSize dataSize) const
+{
+    return (offset_ + dataSize <= size_);
+}
+
+void VKStagingBuffer::Write(
+    VkCommandBuffer commandBuffer,
+    VkBuffer        dstBuffer,
+    VkDeviceSize    dstOffset,
+    const void*     data,
+    VkDeviceSize    dataSize)
+{
+    /* Copy data to persistently mapped memory; no flush required for coherent memory */
+    CopyToWriteCombinedMemory(mappedData_ + offset_, data, static_cast<std::size_t>(dataSize));
+
+    /* Record copy command from staging buffer region into destination buffer */
+    VkBufferCopy region;
+    {
+        region.srcOffset    = offset_;
+        region.dstOffset    = dstOffset;
+        region.size         = dataSize;
+    }
+    vkCmdCopyBuffer(commandBuffer, buffer_, dstBuffer, 1, &region);
+}
+
+void VKStagingBuffer::WriteAndIncrementOffset(
+    VkCommandBuffer commandBuffer,
+    VkBuffer        dstBuffer,
+    VkDeviceSize    dstOffset,
+    const void*     data,
+    VkDeviceSize    dataSize)
+{
+    Write(commandBuffer, dstBuffer, dstOffset, data, dataSize);
+    offset_ = GetAlignedSize(offset_ + dataSize, VKStagingBuffer::writeAlignment);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
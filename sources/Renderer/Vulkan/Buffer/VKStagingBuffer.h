@@ -0,0 +1,109 @@
+/*
+ * VKStagingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_H
+#define LLGL_VK_STAGING_BUFFER_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../Memory/VKDeviceMemory.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Instances of this class represent a single chunk in the staging buffer pool
+to handle dynamic buffer updates during command buffer recording.
+Each chunk owns a dedicated VkDeviceMemory object that remains persistently mapped into host memory,
+so writing to this buffer only bumps an offset and never goes through the device memory manager's block lists.
+*/
+class VKStagingBuffer
+{
+
+    public:
+
+        // Creates the native Vulkan buffer with a dedicated host visible and coherent device memory chunk.
+        VKStagingBuffer(VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize size);
+
+        VKStagingBuffer(VKStagingBuffer&& rhs) noexcept;
+        VKStagingBuffer& operator = (VKStagingBuffer&& rhs) noexcept;
+
+        VKStagingBuffer(const VKStagingBuffer&) = delete;
+        VKStagingBuffer& operator = (const VKStagingBuffer&) = delete;
+
+        // Resets the writing offset.
+        void Reset();
+
+        // Returns true if the remaining buffer size can fit the specified data size.
+        bool Capacity(VkDeviceSize dataSize) const;
+
+        // Writes the specified data to the mapped staging memory and records a copy command into the destination buffer.
+        void Write(
+            VkCommandBuffer commandBuffer,
+            VkBuffer        dstBuffer,
+            VkDeviceSize    dstOffset,
+            const void*     data,
+            VkDeviceSize    dataSize
+        );
+
+        // Writes the specified data to the mapped staging memory and increments the write offset.
+        void WriteAndIncrementOffset(
+            VkCommandBuffer commandBuffer,
+            VkBuffer        dstBuffer,
+            VkDeviceSize    dstOffset,
+            const void*     data,
+            VkDeviceSize    dataSize
+        );
+
+        // Returns the native Vulkan buffer.
+        inline VkBuffer GetVkBuffer() const
+        {
+            return buffer_.Get();
+        }
+
+        // Returns the size of the native Vulkan buffer.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the current writing offset.
+        inline VkDeviceSize GetOffset() const
+        {
+            return offset_;
+        }
+
+    public:
+
+        // Alignment of each staged write within a chunk. This satisfies the offset alignment for buffer-to-image copies of all non-compressed formats.
+        static constexpr VkDeviceSize writeAlignment = 16;
+
+    private:
+
+        VKPtr<VkBuffer>                 buffer_;
+        std::unique_ptr<VKDeviceMemory> deviceMemory_;
+        char*                           mappedData_     = nullptr;
+        VkDeviceSize                    size_           = 0;
+        VkDeviceSize                    offset_         = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,91 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKStagingBufferPool.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKStagingBufferPool::VKStagingBufferPool(VKDeviceMemoryManager* deviceMemoryMngr, VkDeviceSize chunkSize) :
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    chunkSize_        { chunkSize        }
+{
+}
+
+void VKStagingBufferPool::InitializeDevice(VKDeviceMemoryManager* deviceMemoryMngr, VkDeviceSize chunkSize)
+{
+    deviceMemoryMngr_   = deviceMemoryMngr;
+    chunkSize_          = chunkSize;
+}
+
+void VKStagingBufferPool::Reset()
+{
+    /* Release oversized chunks that were only allocated for a single large upload, so they don't stay resident until the pool is destroyed */
+    chunks_.erase(
+        std::remove_if(
+            chunks_.begin(),
+            chunks_.end(),
+            [this](const VKStagingBuffer& chunk) -> bool
+            {
+                return (chunk.GetSize() > chunkSize_);
+            }
+        ),
+        chunks_.end()
+    );
+
+    for (VKStagingBuffer& chunk : chunks_)
+        chunk.Reset();
+    chunkIdx_ = 0;
+}
+
+VkDeviceSize VKStagingBufferPool::GetTotalSize() const
+{
+    VkDeviceSize totalSize = 0;
+    for (const VKStagingBuffer& chunk : chunks_)
+        totalSize += chunk.GetSize();
+    return totalSize;
+}
+
+void VKStagingBufferPool::WriteStaged(
+    VkCommandBuffer commandBuffer,
+    VkBuffer        dstBuffer,
+    VkDeviceSize    dstOffset,
+    const void*     data,
+    VkDeviceSize    dataSize)
+{
+    /* Find a chunk that fits the requested data size or allocate a new chunk */
+    while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(dataSize))
+        ++chunkIdx_;
+
+    if (chunkIdx_ == chunks_.size())
+        AllocChunk(dataSize);
+
+    /* Write data to current chunk */
+    chunks_[chunkIdx_].WriteAndIncrementOffset(commandBuffer, dstBuffer, dstOffset, data, dataSize);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKStagingBufferPool::AllocChunk(VkDeviceSize minChunkSize)
+{
+    chunks_.emplace_back(*deviceMemoryMngr_, std::max(chunkSize_, minChunkSize));
+    chunkIdx_ = chunks_.size() - 1;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
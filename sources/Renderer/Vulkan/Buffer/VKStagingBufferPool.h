@@ -0,0 +1,77 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include "VKStagingBuffer.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Linear allocator for transient buffer uploads.
+Each chunk is a persistently mapped staging buffer that is only reset once the GPU has finished reading from it,
+e.g. when the recording fence of a command buffer has been signaled.
+Chunks that exceed the configured chunk size are released on reset instead of being recycled.
+*/
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool() = default;
+        VKStagingBufferPool(VKDeviceMemoryManager* deviceMemoryMngr, VkDeviceSize chunkSize);
+
+        // Initializes the device memory manager and chunk size.
+        void InitializeDevice(VKDeviceMemoryManager* deviceMemoryMngr, VkDeviceSize chunkSize);
+
+        // Resets all chunks in the pool and releases the chunks that are larger than the configured chunk size.
+        void Reset();
+
+        // Returns the total size (in bytes) of all chunks in this pool.
+        VkDeviceSize GetTotalSize() const;
+
+        // Writes the specified data to the destination buffer using the staging pool and records the copy command into the specified command buffer.
+        void WriteStaged(
+            VkCommandBuffer commandBuffer,
+            VkBuffer        dstBuffer,
+            VkDeviceSize    dstOffset,
+            const void*     data,
+            VkDeviceSize    dataSize
+        );
+
+    private:
+
+        // Allocates a new chunk with the specified minimal size.
+        void AllocChunk(VkDeviceSize minChunkSize);
+
+    private:
+
+        VKDeviceMemoryManager*          deviceMemoryMngr_   = nullptr;
+
+        std::vector<VKStagingBuffer>    chunks_;
+        std::size_t                     chunkIdx_           = 0;
+        VkDeviceSize                    chunkSize_          = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
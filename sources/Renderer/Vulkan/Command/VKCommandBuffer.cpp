@@ -7,6 +7,8 @@
 
 #include "VKCommandBuffer.h"
 #include "VKCommandQueue.h"
+#include "VKTransferQueue.h"
+#include "VKCommandPoolCache.h"
 #include "../VKPhysicalDevice.h"
 #include "../VKSwapChain.h"
 #include "../VKTypes.h"
@@ -24,11 +26,15 @@
 #include "../Buffer/VKBuffer.h"
 #include "../Buffer/VKBufferArray.h"
 #include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CPUProfilerUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/IndirectArguments.h>
 #include <cstddef>
+#include <algorithm>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -48,19 +54,67 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
         return 1u;
 }
 
+// Returns the maximum number of draws for a native multi draw command or 0 if VK_EXT_multi_draw is not supported
+static std::uint32_t GetMaxMultiDrawCount(const VKPhysicalDevice& physicalDevice)
+{
+    #ifdef VK_EXT_multi_draw
+    if (HasExtension(VKExt::EXT_multi_draw))
+        return physicalDevice.GetMultiDrawProperties().maxMultiDrawCount;
+    #endif
+    return 0u;
+}
+
+#ifdef VK_KHR_fragment_shading_rate
+
+// Returns the fragment size in pixels for the specified shading rate
+static VkExtent2D GetVkFragmentSize(const ShadingRate rate)
+{
+    switch (rate)
+    {
+        case ShadingRate::Rate1x1: return VkExtent2D{ 1, 1 };
+        case ShadingRate::Rate1x2: return VkExtent2D{ 1, 2 };
+        case ShadingRate::Rate2x1: return VkExtent2D{ 2, 1 };
+        case ShadingRate::Rate2x2: return VkExtent2D{ 2, 2 };
+        case ShadingRate::Rate2x4: return VkExtent2D{ 2, 4 };
+        case ShadingRate::Rate4x2: return VkExtent2D{ 4, 2 };
+        case ShadingRate::Rate4x4: return VkExtent2D{ 4, 4 };
+    }
+    return VkExtent2D{ 1, 1 };
+}
+
+// Sets the fragment size for the specified shading rate. Combiners are always KEEP, since shading-rate attachments are not supported
+static void VKCmdSetFragmentShadingRate(VkCommandBuffer commandBuffer, const ShadingRate rate)
+{
+    const VkExtent2D fragmentSize = GetVkFragmentSize(rate);
+    const VkFragmentShadingRateCombinerOpKHR combinerOps[2] =
+    {
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+    };
+    vkCmdSetFragmentShadingRateKHR(commandBuffer, &fragmentSize, combinerOps);
+}
+
+#endif // /VK_KHR_fragment_shading_rate
+
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
     VkDevice                        device,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
     VkQueue                         commandQueue,
+    std::uint32_t                   commandQueueFamily,
+    VKTransferQueue*                transferQueue,
+    VKCommandPoolCache*             commandPoolCache,
     const QueueFamilyIndices&       queueFamilyIndices,
     const CommandBufferDescriptor&  desc)
 :
     device_                 { device                                        },
     commandQueue_           { commandQueue                                  },
+    transferQueue_          { transferQueue                                 },
     commandPool_            { device, vkDestroyCommandPool                  },
     numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
     maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
+    maxMultiDrawCount_      { GetMaxMultiDrawCount(physicalDevice)          },
     recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence }      },
@@ -82,7 +136,8 @@ VKCommandBuffer::VKCommandBuffer(
             if (desc.renderPass != nullptr)
             {
                 auto* renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
-                renderPass_ = renderPassVK->GetVkRenderPass();
+                renderPass_     = renderPassVK->GetVkRenderPass();
+                renderingPass_  = renderPassVK;
                 usageFlags_ |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             }
         }
@@ -90,15 +145,27 @@ VKCommandBuffer::VKCommandBuffer(
             usageFlags_ |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     }
 
-    /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
-    CreateVkCommandBuffers();
+    /* Initialize staging buffer pools for transient buffer updates */
+    for_range(i, numCommandBuffers_)
+        stagingBufferPoolArray_[i].InitializeDevice(&deviceMemoryMngr, static_cast<VkDeviceSize>(desc.minStagingPoolSize));
+
+    /* Create native command buffer objects; transient command buffers acquire them from the per-thread command pools each time they are encoded */
+    if ((desc.flags & CommandBufferFlags::Transient) != 0 && commandPoolCache != nullptr)
+    {
+        transientPoolCache_ = commandPoolCache;
+    }
+    else
+    {
+        CreateVkCommandPool(commandQueueFamily);
+        CreateVkCommandBuffers();
+    }
     CreateVkRecordingFences();
 }
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    if (transientPoolCache_ == nullptr)
+        vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
@@ -117,6 +184,8 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
 
 void VKCommandBuffer::Begin()
 {
+    encodeSpan_.Begin();
+
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
@@ -134,6 +203,17 @@ void VKCommandBuffer::Begin()
         inheritanceInfo.pipelineStatistics      = 0;
     }
 
+    #ifdef VK_KHR_dynamic_rendering
+    /* Inherit attachment formats instead of a render pass object with dynamic rendering */
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
+    if (IsSecondaryCmdBuffer() && renderingPass_ != nullptr && renderingPass_->UsesDynamicRendering())
+    {
+        renderingPass_->FillInheritanceRenderingInfo(inheritanceRenderingInfo);
+        inheritanceRenderingInfo.flags  = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR;
+        inheritanceInfo.pNext           = &inheritanceRenderingInfo;
+    }
+    #endif
+
     /* Begin recording of current command buffer */
     VkCommandBufferBeginInfo beginInfo;
     {
@@ -157,10 +237,19 @@ void VKCommandBuffer::Begin()
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     hasDynamicScissorRect_                  = false;
+
+    #ifdef VK_KHR_fragment_shading_rate
+    /* Initialize default shading rate, since it is a dynamic state of all graphics PSOs */
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+        VKCmdSetFragmentShadingRate(commandBuffer_, ShadingRate::Rate1x1);
+    #endif
 }
 
 void VKCommandBuffer::End()
 {
+    /* Flush remaining barriers that have not been consumed by any subsequent command */
+    context_.FlushBarriers();
+
     /* End encoding of current command buffer */
     VkResult result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -171,17 +260,22 @@ void VKCommandBuffer::End()
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
     {
+        if (transferQueue_ != nullptr)
+            transferQueue_->FlushPendingAcquires();
         VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
         VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
     }
 
     ResetBindingStates();
+
+    encodeSpan_.End("CommandBuffer::Encode");
 }
 
 void VKCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, secondaryCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
+    context_.FlushBarriers();
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
 }
 
@@ -201,13 +295,15 @@ void VKCommandBuffer::UpdateBuffer(
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
-        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer());
+        WriteBufferInline(dstBufferVK.GetVkBuffer(), offset, data, size);
         BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
         ResumeRenderPass();
     }
     else
     {
-        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer());
+        WriteBufferInline(dstBufferVK.GetVkBuffer(), offset, data, size);
         BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
     }
 }
@@ -232,11 +328,79 @@ void VKCommandBuffer::CopyBuffer(
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer(), srcBufferVK.GetVkBuffer());
         vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer(), srcBufferVK.GetVkBuffer());
         vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+    }
+
+    /* Make copied data visible to the host for buffers that are read directly by the CPU */
+    if (dstBufferVK.IsDirectlyMapped())
+    {
+        context_.BufferMemoryBarrier(
+            dstBufferVK.GetVkBuffer(),
+            0,
+            VK_WHOLE_SIZE,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_HOST_READ_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_HOST_BIT
+        );
+    }
+}
+
+void VKCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+
+    /* Pass all regions to a single vkCmdCopyBuffer command */
+    SmallVector<VkBufferCopy, 16> regionsVK;
+    regionsVK.resize(numRegions);
+    for_range(i, numRegions)
+    {
+        regionsVK[i].srcOffset  = static_cast<VkDeviceSize>(regions[i].srcOffset);
+        regionsVK[i].dstOffset  = static_cast<VkDeviceSize>(regions[i].dstOffset);
+        regionsVK[i].size       = static_cast<VkDeviceSize>(regions[i].size);
+    }
+
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer(), srcBufferVK.GetVkBuffer());
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
+        ResumeRenderPass();
+    }
+    else
+    {
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer(), srcBufferVK.GetVkBuffer());
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
+    }
+
+    /* Make copied data visible to the host for buffers that are read directly by the CPU */
+    if (dstBufferVK.IsDirectlyMapped())
+    {
+        context_.BufferMemoryBarrier(
+            dstBufferVK.GetVkBuffer(),
+            0,
+            VK_WHOLE_SIZE,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_HOST_READ_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_HOST_BIT
+        );
+    }
 }
 
 void VKCommandBuffer::CopyBufferFromTexture(
@@ -263,20 +427,38 @@ void VKCommandBuffer::CopyBufferFromTexture(
         region.imageExtent                      = VKTypes::ToVkExtent(srcRegion.extent);
     }
 
-    //TODO: context must detect if barriers are incompatible
-    context_.BufferMemoryBarrier(dstBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_WRITE_BIT, true);
-    VkImageLayout oldLayout = srcTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, true);
+    /* Enqueue barriers and flush them right before the copy command; the transition back is batched with subsequent barriers */
+    context_.BufferMemoryBarrier(dstBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_WRITE_BIT);
+    VkImageLayout oldLayout = srcTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriers();
         context_.CopyImageToBuffer(srcTextureVK, dstBufferVK, region);
+        srcTextureVK.TransitionImageLayout(context_, oldLayout);
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriers();
         context_.CopyImageToBuffer(srcTextureVK, dstBufferVK, region);
+        srcTextureVK.TransitionImageLayout(context_, oldLayout);
+    }
 
-    srcTextureVK.TransitionImageLayout(context_, oldLayout, true);
+    /* Make copied data visible to the host for buffers that are read directly by the CPU */
+    if (dstBufferVK.IsDirectlyMapped())
+    {
+        context_.BufferMemoryBarrier(
+            dstBufferVK.GetVkBuffer(),
+            0,
+            VK_WHOLE_SIZE,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_HOST_READ_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_HOST_BIT
+        );
+    }
 }
 
 void VKCommandBuffer::FillBuffer(
@@ -304,11 +486,134 @@ void VKCommandBuffer::FillBuffer(
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer());
         vkCmdFillBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, value);
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer());
         vkCmdFillBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, value);
+    }
+}
+
+void VKCommandBuffer::ClearBuffer(
+    Buffer&             dstBuffer,
+    const Format        format,
+    const ClearValue&   clearValue,
+    std::uint64_t       dstOffset,
+    std::uint64_t       clearSize)
+{
+    std::uint8_t element[g_maxClearElementSize];
+    const std::uint32_t elementSize = EncodeClearColorElement(format, clearValue.color, element);
+    if (elementSize == 0)
+        return;
+
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    /* Resolve LLGL_WHOLE_SIZE to the entire buffer (see ResolveClearBufferRange) */
+    ResolveClearBufferRange(dstBufferVK.GetSize(), dstOffset, clearSize);
+
+    /* Use vkCmdFillBuffer if the element is a repeated 32-bit pattern, otherwise write the element repeatedly with vkCmdUpdateBuffer */
+    std::uint32_t pattern = 0;
+    if (GetClearElementPattern32(element, elementSize, pattern))
+        FillBuffer(dstBuffer, dstOffset, pattern, clearSize);
+    else
+        ClearBufferWithElement(*this, dstBuffer, dstOffset, clearSize, element, elementSize);
+}
+
+// Converts the clear color into the union member that Vulkan interprets for the specified format, i.e. float32, int32, or uint32.
+static void ToVkClearColorForFormat(VkClearColorValue& dst, const float (&src)[4], const Format format)
+{
+    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    if ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0)
+    {
+        for_range(i, 4)
+        {
+            if ((formatAttribs.flags & FormatFlags::IsUnsigned) != 0)
+                dst.uint32[i] = static_cast<std::uint32_t>(std::max(0.0f, src[i]));
+            else
+                dst.int32[i] = static_cast<std::int32_t>(src[i]);
+        }
+    }
+    else
+    {
+        for_range(i, 4)
+            dst.float32[i] = src[i];
+    }
+}
+
+void VKCommandBuffer::ClearTexture(
+    Texture&                    texture,
+    const TextureSubresource&   subresource,
+    const ClearValue&           clearValue)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    /* Array layers are ignored for 3D textures, since each MIP-map is cleared as a whole */
+    const bool isTexture3D = (textureVK.GetType() == TextureType::Texture3D);
+
+    VkImageSubresourceRange range;
+    {
+        range.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(textureVK.GetVkFormat());
+        range.baseMipLevel      = subresource.baseMipLevel;
+        range.levelCount        = subresource.numMipLevels;
+        range.baseArrayLayer    = (isTexture3D ? 0u : subresource.baseArrayLayer);
+        range.layerCount        = (isTexture3D ? 1u : subresource.numArrayLayers);
+    }
+
+    /* Enqueue barriers and flush them right before the clear command; the transition back is batched with subsequent barriers */
+    VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    context_.FlushBarriers();
+
+    if (IsDepthOrStencilFormat(textureVK.GetFormat()))
+    {
+        VkClearDepthStencilValue clearDepthStencil;
+        {
+            clearDepthStencil.depth     = clearValue.depth;
+            clearDepthStencil.stencil   = clearValue.stencil;
+        }
+        vkCmdClearDepthStencilImage(commandBuffer_, textureVK.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearDepthStencil, 1, &range);
+    }
+    else
+    {
+        VkClearColorValue clearColor;
+        ToVkClearColorForFormat(clearColor, clearValue.color, textureVK.GetFormat());
+        vkCmdClearColorImage(commandBuffer_, textureVK.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearColor, 1, &range);
+    }
+
+    textureVK.TransitionImageLayout(context_, oldLayout);
+}
+
+void VKCommandBuffer::DiscardResource(Resource& resource)
+{
+    /* Buffers have no layout, so only textures can skip preserving their contents */
+    if (resource.GetResourceType() == ResourceType::Texture)
+    {
+        auto& textureVK = LLGL_CAST(VKTexture&, resource);
+        textureVK.DiscardContents(context_);
+    }
+}
+
+static void ToVkImageCopy(
+    VkImageCopy&            dst,
+    const VKTexture&        dstTextureVK,
+    const TextureLocation&  dstLocation,
+    const VKTexture&        srcTextureVK,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    dst.srcSubresource.aspectMask       = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
+    dst.srcSubresource.mipLevel         = srcLocation.mipLevel;
+    dst.srcSubresource.baseArrayLayer   = srcLocation.arrayLayer;
+    dst.srcSubresource.layerCount       = 1;
+    dst.srcOffset                       = VKTypes::ToVkOffset(srcLocation.offset);
+    dst.dstSubresource.aspectMask       = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
+    dst.dstSubresource.mipLevel         = dstLocation.mipLevel;
+    dst.dstSubresource.baseArrayLayer   = dstLocation.arrayLayer;
+    dst.dstSubresource.layerCount       = 1;
+    dst.dstOffset                       = VKTypes::ToVkOffset(dstLocation.offset);
+    dst.extent                          = VKTypes::ToVkExtent(extent);
 }
 
 void VKCommandBuffer::CopyTexture(
@@ -322,28 +627,52 @@ void VKCommandBuffer::CopyTexture(
     auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
 
     VkImageCopy region;
-    {
-        region.srcSubresource.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
-        region.srcSubresource.mipLevel          = srcLocation.mipLevel;
-        region.srcSubresource.baseArrayLayer    = srcLocation.arrayLayer;
-        region.srcSubresource.layerCount        = 1;
-        region.srcOffset                        = VKTypes::ToVkOffset(srcLocation.offset);
-        region.dstSubresource.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
-        region.dstSubresource.mipLevel          = dstLocation.mipLevel;
-        region.dstSubresource.baseArrayLayer    = dstLocation.arrayLayer;
-        region.dstSubresource.layerCount        = 1;
-        region.dstOffset                        = VKTypes::ToVkOffset(dstLocation.offset);
-        region.extent                           = VKTypes::ToVkExtent(extent);
-    }
+    ToVkImageCopy(region, dstTextureVK, dstLocation, srcTextureVK, srcLocation, extent);
 
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriers();
         context_.CopyTexture(srcTextureVK, dstTextureVK, region);
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriers();
         context_.CopyTexture(srcTextureVK, dstTextureVK, region);
+    }
+}
+
+void VKCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    /* Pass all regions to a single vkCmdCopyImage command */
+    SmallVector<VkImageCopy, 16> regionsVK;
+    regionsVK.resize(numRegions);
+    for_range(i, numRegions)
+        ToVkImageCopy(regionsVK[i], dstTextureVK, regions[i].dstLocation, srcTextureVK, regions[i].srcLocation, regions[i].extent);
+
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        context_.FlushBarriers();
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
+        ResumeRenderPass();
+    }
+    else
+    {
+        context_.FlushBarriers();
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
+    }
 }
 
 void VKCommandBuffer::CopyTextureFromBuffer(
@@ -370,20 +699,24 @@ void VKCommandBuffer::CopyTextureFromBuffer(
         region.imageExtent                      = VKTypes::ToVkExtent(dstRegion.extent);
     }
 
-    //TODO: context must detect if barriers are incompatible
-    context_.BufferMemoryBarrier(srcBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_READ_BIT, true);
-    VkImageLayout oldLayout = dstTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
+    /* Enqueue barriers and flush them right before the copy command; the transition back is batched with subsequent barriers */
+    context_.BufferMemoryBarrier(srcBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_READ_BIT);
+    VkImageLayout oldLayout = dstTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriers();
         context_.CopyBufferToImage(srcBufferVK, dstTextureVK, region);
+        dstTextureVK.TransitionImageLayout(context_, oldLayout);
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriers();
         context_.CopyBufferToImage(srcBufferVK, dstTextureVK, region);
-
-    dstTextureVK.TransitionImageLayout(context_, oldLayout, true);
+        dstTextureVK.TransitionImageLayout(context_, oldLayout);
+    }
 }
 
 void VKCommandBuffer::CopyTextureFromFramebuffer(
@@ -407,6 +740,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
+        context_.FlushBarriers();
         boundSwapChain_->CopyImage(
             context_,
             dstTextureVK.GetVkImage(),
@@ -420,6 +754,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
     }
     else
     {
+        context_.FlushBarriers();
         boundSwapChain_->CopyImage(
             context_,
             dstTextureVK.GetVkImage(),
@@ -435,6 +770,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    context_.FlushBarriers();
     context_.GenerateMips(
         textureVK.GetVkImage(),
         textureVK.GetVkFormat(),
@@ -453,6 +789,7 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     if (subresource.baseMipLevel   < maxNumMipLevels   && subresource.numMipLevels   > 0 &&
         subresource.baseArrayLayer < maxNumArrayLayers && subresource.numArrayLayers > 0)
     {
+        context_.FlushBarriers();
         context_.GenerateMips(
             textureVK.GetVkImage(),
             textureVK.GetVkFormat(),
@@ -462,6 +799,26 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     }
 }
 
+void VKCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    /* Gather all textures that have a MIP-map chain to generate */
+    SmallVector<VKTexture*, 16> texturesVK;
+    texturesVK.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        auto* textureVK = LLGL_CAST(VKTexture*, textures[i]);
+        if (textureVK->GetNumMipLevels() > 1)
+            texturesVK.push_back(textureVK);
+    }
+
+    if (!texturesVK.empty())
+    {
+        context_.FlushBarriers();
+        context_.GenerateMipsBatch(static_cast<std::uint32_t>(texturesVK.size()), texturesVK.data());
+    }
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void VKCommandBuffer::SetViewport(const Viewport& viewport)
@@ -469,6 +826,11 @@ void VKCommandBuffer::SetViewport(const Viewport& viewport)
     /* Convert viewport to VkViewport type */
     VkViewport viewportVK;
     VKTypes::Convert(viewportVK, viewport);
+
+    /* Rotate viewport into the orientation of a pre-rotated swap-chain */
+    if (boundSwapChain_ != nullptr && boundSwapChain_->IsPreRotated())
+        boundSwapChain_->TransformViewport(viewportVK);
+
     vkCmdSetViewport(commandBuffer_, 0, 1, &viewportVK);
 }
 
@@ -481,6 +843,13 @@ void VKCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* v
     for_range(i, numViewports)
         VKTypes::Convert(viewportsVK[i], viewports[i]);
 
+    /* Rotate viewports into the orientation of a pre-rotated swap-chain */
+    if (boundSwapChain_ != nullptr && boundSwapChain_->IsPreRotated())
+    {
+        for_range(i, numViewports)
+            boundSwapChain_->TransformViewport(viewportsVK[i]);
+    }
+
     vkCmdSetViewport(commandBuffer_, 0, numViewports, viewportsVK);
 }
 
@@ -491,6 +860,11 @@ void VKCommandBuffer::SetScissor(const Scissor& scissor)
         /* Convert scissor to VkRect2D type */
         VkRect2D scissorVK;
         VKTypes::Convert(scissorVK, scissor);
+
+        /* Rotate scissor into the orientation of a pre-rotated swap-chain */
+        if (boundSwapChain_ != nullptr && boundSwapChain_->IsPreRotated())
+            boundSwapChain_->TransformScissor(scissorVK);
+
         vkCmdSetScissor(commandBuffer_, 0, 1, &scissorVK);
     }
 }
@@ -506,23 +880,30 @@ void VKCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scis
         for_range(i, numScissors)
             VKTypes::Convert(scissorsVK[i], scissors[i]);
 
+        /* Rotate scissors into the orientation of a pre-rotated swap-chain */
+        if (boundSwapChain_ != nullptr && boundSwapChain_->IsPreRotated())
+        {
+            for_range(i, numScissors)
+                boundSwapChain_->TransformScissor(scissorsVK[i]);
+        }
+
         vkCmdSetScissor(commandBuffer_, 0, numScissors, scissorsVK);
     }
 }
 
 /* ----- Input Assembly ------ */
 
-void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void VKCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
     VkBuffer buffers[] = { bufferVK.GetVkBuffer() };
-    VkDeviceSize offsets[] = { 0 };
+    VkDeviceSize offsets[] = { offset };
 
     vkCmdBindVertexBuffers(commandBuffer_, 0, 1, buffers, offsets);
 }
 
-void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray, const std::uint64_t* offsets)
 {
     auto& bufferArrayVK = LLGL_CAST(VKBufferArray&, bufferArray);
     vkCmdBindVertexBuffers(
@@ -530,7 +911,7 @@ void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         0,
         static_cast<std::uint32_t>(bufferArrayVK.GetBuffers().size()),
         bufferArrayVK.GetBuffers().data(),
-        bufferArrayVK.GetOffsets().data()
+        (offsets != nullptr ? offsets : bufferArrayVK.GetOffsets().data())
     );
 }
 
@@ -555,11 +936,24 @@ void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
 
     /* Bind resource heap to pipeline bind point and insert resource barrier into command buffer */
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
-    if (!(descriptorSet < resourceHeapVK.GetVkDescriptorSets().size()))
+    if (!(descriptorSet < resourceHeapVK.GetNumDescriptorSets()))
         return /*Descriptor set out of bounds*/;
 
-    boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
-    resourceHeapVK.SubmitPipelineBarrier(commandBuffer_, descriptorSet);
+    if (resourceHeapVK.IsBindless())
+    {
+        /* Bind the single bindless descriptor set only once per PSO and pass the descriptor set index via push constants */
+        VkDescriptorSet bindlessSet = resourceHeapVK.GetVkDescriptorSets().front();
+        if (boundBindlessHeapSet_ != bindlessSet)
+        {
+            boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, bindlessSet);
+            boundBindlessHeapSet_ = bindlessSet;
+        }
+        boundPipelineState_->PushHeapIndex(commandBuffer_, descriptorSet);
+    }
+    else
+        boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
+
+    resourceHeapVK.SubmitPipelineBarrier(context_, descriptorSet);
 }
 
 void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
@@ -571,6 +965,17 @@ void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     }
 }
 
+void VKCommandBuffer::SetResource(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ != nullptr && descriptor < boundPipelineLayout_->GetLayoutDynamicBindings().size())
+    {
+        /* LLGL_WHOLE_SIZE and VK_WHOLE_SIZE are both the maximum 64-bit value, so the size can be passed through */
+        auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+        const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
+        descriptorCache_->EmplaceBufferRangeDescriptor(bufferVK, offset, size, binding, descriptorSetWriter_);
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void VKCommandBuffer::BeginRenderPass(
@@ -593,6 +998,9 @@ void VKCommandBuffer::BeginRenderPass(
         renderPass_                     = swapChainVK.GetSwapChainRenderPass().GetVkRenderPass();
         secondaryRenderPass_            = swapChainVK.GetSecondaryVkRenderPass();
         framebuffer_                    = swapChainVK.GetVkFramebuffer(currentColorBuffer_);
+        renderingPass_                  = &(swapChainVK.GetSwapChainRenderPass());
+        secondaryRenderingPass_         = &(swapChainVK.GetSecondaryRenderPass());
+        renderingAttachments_           = &(swapChainVK.GetRenderingAttachments(currentColorBuffer_));
         framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
         numColorAttachments_            = swapChainVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
@@ -606,6 +1014,9 @@ void VKCommandBuffer::BeginRenderPass(
         renderPass_                     = renderTargetVK.GetVkRenderPass();
         secondaryRenderPass_            = renderTargetVK.GetSecondaryVkRenderPass();
         framebuffer_                    = renderTargetVK.GetVkFramebuffer();
+        renderingPass_                  = &(renderTargetVK.GetPrimaryRenderPass());
+        secondaryRenderingPass_         = &(renderTargetVK.GetSecondaryRenderPass());
+        renderingAttachments_           = &(renderTargetVK.GetRenderingAttachments());
         framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
         numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
@@ -622,7 +1033,8 @@ void VKCommandBuffer::BeginRenderPass(
     {
         /* Get native VkRenderPass object */
         auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
-        renderPass_ = renderPassVK->GetVkRenderPass();
+        renderPass_     = renderPassVK->GetVkRenderPass();
+        renderingPass_  = renderPassVK;
         ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
     }
 
@@ -638,18 +1050,29 @@ void VKCommandBuffer::BeginRenderPass(
         #endif
     );
 
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
+    #ifdef VK_KHR_dynamic_rendering
+    if (renderingPass_->UsesDynamicRendering())
     {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = renderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea        = framebufferRenderArea_;
-        beginInfo.clearValueCount   = numClearValuesVK;
-        beginInfo.pClearValues      = clearValuesVK;
+        /* Record begin of dynamic rendering without render pass and framebuffer objects */
+        BeginDynamicRendering(*renderingPass_, numClearValuesVK, clearValuesVK);
+    }
+    else
+    #endif // /VK_KHR_dynamic_rendering
+    {
+        /* Record begin of render pass */
+        VkRenderPassBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.renderPass        = renderPass_;
+            beginInfo.framebuffer       = framebuffer_;
+            beginInfo.renderArea        = framebufferRenderArea_;
+            beginInfo.clearValueCount   = numClearValuesVK;
+            beginInfo.pClearValues      = clearValuesVK;
+        }
+        context_.FlushBarriers();
+        vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 
     /* Store new record state */
     recordState_ = RecordState::InsideRenderPass;
@@ -657,19 +1080,36 @@ void VKCommandBuffer::BeginRenderPass(
 
 void VKCommandBuffer::EndRenderPass()
 {
-    LLGL_ASSERT(renderPass_ != VK_NULL_HANDLE);
+    LLGL_ASSERT(IsInsideRenderPass());
 
     /* Record and of render pass */
-    vkCmdEndRenderPass(commandBuffer_);
+    #ifdef VK_KHR_dynamic_rendering
+    if (renderingPass_->UsesDynamicRendering())
+        EndDynamicRendering();
+    else
+    #endif
+        vkCmdEndRenderPass(commandBuffer_);
 
     /* Reset render pass and framebuffer attributes */
-    renderPass_     = VK_NULL_HANDLE;
-    framebuffer_    = VK_NULL_HANDLE;
+    renderPass_             = VK_NULL_HANDLE;
+    framebuffer_            = VK_NULL_HANDLE;
+    renderingPass_          = nullptr;
+    secondaryRenderingPass_ = nullptr;
+    renderingAttachments_   = nullptr;
 
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
 }
 
+void VKCommandBuffer::NextSubpass()
+{
+    LLGL_ASSERT(IsInsideRenderPass());
+
+    /* Render passes with more than one subpass are never encoded with dynamic rendering */
+    if (!renderingPass_->UsesDynamicRendering())
+        vkCmdNextSubpass(commandBuffer_, subpassContents_);
+}
+
 static void ToVkClearColor(VkClearColorValue& dst, const float (&src)[4])
 {
     dst.float32[0] = src[0];
@@ -803,11 +1243,12 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     /* Keep reference to bound piepline layout (can be null) */
     boundPipelineState_     = &pipelineStateVK;
     boundPipelineLayout_    = pipelineStateVK.GetPipelineLayout();
+    boundBindlessHeapSet_   = VK_NULL_HANDLE;
 
     /* Reset descriptor cache for dynamic resources */
     if (boundPipelineLayout_ != nullptr)
     {
-        descriptorCache_ = boundPipelineLayout_->GetDescriptorCache();
+        descriptorCache_ = GetOrCreateDescriptorCache(*boundPipelineLayout_);
         if (descriptorCache_ != nullptr)
         {
             descriptorCache_->Reset();
@@ -828,6 +1269,82 @@ void VKCommandBuffer::SetStencilReference(std::uint32_t reference, const Stencil
     vkCmdSetStencilReference(commandBuffer_, VKTypes::Map(stencilFace), reference);
 }
 
+void VKCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    #ifdef VK_EXT_extended_dynamic_state
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+        vkCmdSetCullModeEXT(commandBuffer_, VKTypes::Map(cullMode));
+    #endif
+}
+
+void VKCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    #ifdef VK_EXT_extended_dynamic_state
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        vkCmdSetDepthTestEnableEXT(commandBuffer_, VKBoolean(depthDesc.testEnabled));
+        vkCmdSetDepthWriteEnableEXT(commandBuffer_, VKBoolean(depthDesc.writeEnabled));
+        vkCmdSetDepthCompareOpEXT(commandBuffer_, VKTypes::Map(depthDesc.compareOp));
+    }
+    #endif
+}
+
+#ifdef VK_EXT_extended_dynamic_state
+
+static void VKCmdSetStencilFaceState(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, const StencilFaceDescriptor& desc)
+{
+    vkCmdSetStencilOpEXT(
+        commandBuffer,
+        faceMask,
+        VKTypes::Map(desc.stencilFailOp),
+        VKTypes::Map(desc.depthPassOp),
+        VKTypes::Map(desc.depthFailOp),
+        VKTypes::Map(desc.compareOp)
+    );
+    vkCmdSetStencilCompareMask(commandBuffer, faceMask, desc.readMask);
+    vkCmdSetStencilWriteMask(commandBuffer, faceMask, desc.writeMask);
+}
+
+#endif // /VK_EXT_extended_dynamic_state
+
+void VKCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    #ifdef VK_EXT_extended_dynamic_state
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        vkCmdSetStencilTestEnableEXT(commandBuffer_, VKBoolean(stencilDesc.testEnabled));
+        VKCmdSetStencilFaceState(commandBuffer_, VK_STENCIL_FACE_FRONT_BIT, stencilDesc.front);
+        VKCmdSetStencilFaceState(commandBuffer_, VK_STENCIL_FACE_BACK_BIT, stencilDesc.back);
+    }
+    #endif
+}
+
+void VKCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology primitiveTopology)
+{
+    #ifdef VK_EXT_extended_dynamic_state
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+        vkCmdSetPrimitiveTopologyEXT(commandBuffer_, VKTypes::Map(primitiveTopology));
+    #endif
+}
+
+void VKCommandBuffer::SetDepthBias(const DepthBiasDescriptor& depthBiasDesc)
+{
+    vkCmdSetDepthBias(commandBuffer_, depthBiasDesc.constantFactor, depthBiasDesc.clamp, depthBiasDesc.slopeFactor);
+}
+
+void VKCommandBuffer::SetShadingRate(const ShadingRateDescriptor& shadingRateDesc)
+{
+    #ifdef VK_KHR_fragment_shading_rate
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+        VKCmdSetFragmentShadingRate(commandBuffer_, shadingRateDesc.rate);
+    #endif
+}
+
+void VKCommandBuffer::SetShadingRateImage(Texture* /*texture*/)
+{
+    // dummy - shading-rate attachments are not supported by the Vulkan backend
+}
+
 void VKCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     if (boundPipelineState_ != nullptr)
@@ -923,6 +1440,58 @@ void VKCommandBuffer::EndRenderCondition()
     vkCmdEndConditionalRenderingEXT(commandBuffer_);
 }
 
+void VKCommandBuffer::ResolveQueryData(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    /* Pipeline statistics are written as one structure per query, all other queries as one 64-bit value per native query */
+    const VkDeviceSize stride =
+    (
+        queryHeapVK.GetType() == QueryType::PipelineStatistics
+            ? sizeof(QueryPipelineStatistics)
+            : sizeof(std::uint64_t)
+    );
+
+    const bool wasInsideRenderPass = IsInsideRenderPass();
+    if (wasInsideRenderPass)
+        PauseRenderPass();
+
+    context_.FlushBarriersForTransfer(dstBufferVK.GetVkBuffer());
+    vkCmdCopyQueryPoolResults(
+        commandBuffer_,
+        queryHeapVK.GetVkQueryPool(),
+        firstQuery * queryHeapVK.GetGroupSize(),
+        numQueries * queryHeapVK.GetGroupSize(),
+        dstBufferVK.GetVkBuffer(),
+        static_cast<VkDeviceSize>(dstOffset),
+        stride,
+        (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT)
+    );
+
+    if (wasInsideRenderPass)
+        ResumeRenderPass();
+
+    /* Make resolved data visible to the host for buffers that are read directly by the CPU */
+    if (dstBufferVK.IsDirectlyMapped())
+    {
+        context_.BufferMemoryBarrier(
+            dstBufferVK.GetVkBuffer(),
+            0,
+            VK_WHOLE_SIZE,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_ACCESS_HOST_READ_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_HOST_BIT
+        );
+    }
+}
+
 /* ----- Stream Output ------ */
 
 #if 0
@@ -958,54 +1527,109 @@ void VKCommandBuffer::EndStreamOutput()
 void VKCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDraw(commandBuffer_, numVertices, 1, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void VKCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    FlushDescriptorCache();
+    context_.FlushBarriers();
+
+    #ifdef VK_EXT_multi_draw
+    if (maxMultiDrawCount_ > 1)
+    {
+        /* Encode consecutive draws with the same instance range as a single native multi draw command */
+        for (std::uint32_t i = 0; i < numDraws;)
+        {
+            const DrawIndexedIndirectArguments& firstDraw = draws[i];
+            multiDrawIndexedInfos_.clear();
+
+            for (; i < numDraws && multiDrawIndexedInfos_.size() < maxMultiDrawCount_; ++i)
+            {
+                if (draws[i].numInstances != firstDraw.numInstances || draws[i].firstInstance != firstDraw.firstInstance)
+                    break;
+
+                VkMultiDrawIndexedInfoEXT drawInfo;
+                {
+                    drawInfo.firstIndex     = draws[i].firstIndex;
+                    drawInfo.indexCount     = draws[i].numIndices;
+                    drawInfo.vertexOffset   = draws[i].vertexOffset;
+                }
+                multiDrawIndexedInfos_.push_back(drawInfo);
+            }
+
+            vkCmdDrawMultiIndexedEXT(
+                commandBuffer_,
+                static_cast<std::uint32_t>(multiDrawIndexedInfos_.size()),
+                multiDrawIndexedInfos_.data(),
+                firstDraw.numInstances,
+                firstDraw.firstInstance,
+                sizeof(VkMultiDrawIndexedInfoEXT),
+                nullptr
+            );
+        }
+        return;
+    }
+    #endif // /VK_EXT_multi_draw
+
+    for (const DrawIndexedIndirectArguments* drawsEnd = draws + numDraws; draws != drawsEnd; ++draws)
+        vkCmdDrawIndexed(commandBuffer_, draws->numIndices, draws->numInstances, draws->firstIndex, draws->vertexOffset, draws->firstInstance);
+}
+
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
@@ -1013,6 +1637,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
@@ -1032,6 +1657,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
@@ -1039,6 +1665,7 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
@@ -1055,17 +1682,88 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_ASSERT_VK_EXT(KHR_draw_indirect_count);
+    FlushDescriptorCache();
+    context_.FlushBarriers();
+    auto& argumentsBufferVK = LLGL_CAST(VKBuffer&, argumentsBuffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndirectCountKHR(
+        commandBuffer_,
+        argumentsBufferVK.GetVkBuffer(),
+        argumentsOffset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        std::min(maxNumCommands, maxDrawIndirectCount_),
+        stride
+    );
+}
+
+void VKCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         argumentsBuffer,
+    std::uint64_t   argumentsOffset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_ASSERT_VK_EXT(KHR_draw_indirect_count);
+    FlushDescriptorCache();
+    context_.FlushBarriers();
+    auto& argumentsBufferVK = LLGL_CAST(VKBuffer&, argumentsBuffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndexedIndirectCountKHR(
+        commandBuffer_,
+        argumentsBufferVK.GetVkBuffer(),
+        argumentsOffset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        std::min(maxNumCommands, maxDrawIndirectCount_),
+        stride
+    );
+}
+
+void VKCommandBuffer::DrawMeshTasks(std::uint32_t numThreadGroupsX, std::uint32_t numThreadGroupsY, std::uint32_t numThreadGroupsZ)
+{
+    #ifdef VK_EXT_mesh_shader
+    LLGL_ASSERT_VK_EXT(EXT_mesh_shader);
+    FlushDescriptorCache();
+    context_.FlushBarriers();
+    vkCmdDrawMeshTasksEXT(commandBuffer_, numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+    #endif // /VK_EXT_mesh_shader
+}
+
+void VKCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    #ifdef VK_EXT_mesh_shader
+    LLGL_ASSERT_VK_EXT(EXT_mesh_shader);
+    FlushDescriptorCache();
+    context_.FlushBarriers();
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    vkCmdDrawMeshTasksIndirectEXT(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
+    #endif // /VK_EXT_mesh_shader
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
+    context_.FlushBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
@@ -1240,11 +1938,31 @@ void VKCommandBuffer::ConvertRenderPassClearValues(
 
 void VKCommandBuffer::PauseRenderPass()
 {
+    #ifdef VK_KHR_dynamic_rendering
+    if (renderingPass_->UsesDynamicRendering())
+    {
+        EndDynamicRendering();
+        return;
+    }
+    #endif
     vkCmdEndRenderPass(commandBuffer_);
 }
 
 void VKCommandBuffer::ResumeRenderPass()
 {
+    #ifdef VK_KHR_dynamic_rendering
+    if (renderingPass_->UsesDynamicRendering())
+    {
+        /* Resume with the secondary render pass to load the content of all attachments */
+        renderingPass_ = secondaryRenderingPass_;
+        BeginDynamicRendering(*renderingPass_, 0, nullptr);
+        return;
+    }
+    #endif
+
+    /* Barriers must not be deferred into the render pass */
+    context_.FlushBarriers();
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -1259,6 +1977,168 @@ void VKCommandBuffer::ResumeRenderPass()
     vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 }
 
+#ifdef VK_KHR_dynamic_rendering
+
+static void InitRenderingAttachmentInfo(
+    VkRenderingAttachmentInfoKHR&   dst,
+    VkImageView                     imageView,
+    VkImageLayout                   imageLayout,
+    VkAttachmentLoadOp              loadOp,
+    VkAttachmentStoreOp             storeOp)
+{
+    dst.sType               = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    dst.pNext               = nullptr;
+    dst.imageView           = imageView;
+    dst.imageLayout         = imageLayout;
+    dst.resolveMode         = VK_RESOLVE_MODE_NONE;
+    dst.resolveImageView    = VK_NULL_HANDLE;
+    dst.resolveImageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.loadOp              = loadOp;
+    dst.storeOp             = storeOp;
+    dst.clearValue          = {};
+}
+
+// Returns the resolve mode for the specified format. Integer formats cannot be averaged.
+static VkResolveModeFlagBits GetVkResolveModeForFormat(VkFormat format)
+{
+    return (IsIntegralFormat(VKTypes::Unmap(format)) ? VK_RESOLVE_MODE_SAMPLE_ZERO_BIT : VK_RESOLVE_MODE_AVERAGE_BIT);
+}
+
+static VkRenderingFlagsKHR GetVkRenderingFlags(VkSubpassContents subpassContents)
+{
+    #ifdef VK_EXT_nested_command_buffer
+    if (subpassContents == VK_SUBPASS_CONTENTS_INLINE_AND_SECONDARY_COMMAND_BUFFERS_EXT)
+        return (VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT);
+    #endif
+    return 0;
+}
+
+void VKCommandBuffer::BeginDynamicRendering(const VKRenderPass& renderPass, std::uint32_t numClearValues, const VkClearValue* clearValues)
+{
+    LLGL_ASSERT_PTR(renderingAttachments_);
+    const VKRenderingAttachments& attachments = *renderingAttachments_;
+
+    /* Barriers must not be deferred into the render pass */
+    TransitionRenderingAttachments(renderPass, true);
+    context_.FlushBarriers();
+
+    /* Initialize color attachments with their resolve attachments */
+    VkRenderingAttachmentInfoKHR colorAttachmentsVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    for_range(i, attachments.numColorAttachments)
+    {
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetAttachmentDesc(i);
+        VkRenderingAttachmentInfoKHR& dst = colorAttachmentsVK[i];
+        InitRenderingAttachmentInfo(dst, attachments.colorAttachments[i].imageView, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, attachmentDesc.loadOp, attachmentDesc.storeOp);
+
+        if (attachmentDesc.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR && i < numClearValues)
+            dst.clearValue = clearValues[i];
+
+        const VKRenderingAttachment& resolveAttachment = attachments.resolveAttachments[i];
+        if (resolveAttachment.imageView != VK_NULL_HANDLE)
+        {
+            dst.resolveMode         = GetVkResolveModeForFormat(resolveAttachment.format);
+            dst.resolveImageView    = resolveAttachment.imageView;
+            dst.resolveImageLayout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    /* Initialize depth and stencil attachments; both refer to the same image view */
+    VkRenderingAttachmentInfoKHR depthAttachmentVK;
+    VkRenderingAttachmentInfoKHR stencilAttachmentVK;
+
+    const VKRenderingAttachment& depthStencilAttachment = attachments.depthStencilAttachment;
+    const bool hasDepthStencil = (depthStencilAttachment.imageView != VK_NULL_HANDLE);
+
+    if (hasDepthStencil)
+    {
+        const std::uint32_t depthStencilIndex = attachments.numColorAttachments;
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetAttachmentDesc(depthStencilIndex);
+        InitRenderingAttachmentInfo(depthAttachmentVK, depthStencilAttachment.imageView, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, attachmentDesc.loadOp, attachmentDesc.storeOp);
+        InitRenderingAttachmentInfo(stencilAttachmentVK, depthStencilAttachment.imageView, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, attachmentDesc.stencilLoadOp, attachmentDesc.stencilStoreOp);
+
+        if (depthStencilIndex < numClearValues)
+        {
+            depthAttachmentVK.clearValue    = clearValues[depthStencilIndex];
+            stencilAttachmentVK.clearValue  = clearValues[depthStencilIndex];
+        }
+    }
+
+    const bool hasDepth     = (hasDepthStencil && depthStencilAttachment.format != VK_FORMAT_S8_UINT);
+    const bool hasStencil   = (hasDepthStencil && VKTypes::IsVkFormatStencil(depthStencilAttachment.format));
+
+    /* Record begin of dynamic rendering */
+    VkRenderingInfoKHR renderingInfo;
+    {
+        renderingInfo.sType                 = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext                 = nullptr;
+        renderingInfo.flags                 = GetVkRenderingFlags(subpassContents_);
+        renderingInfo.renderArea            = framebufferRenderArea_;
+        renderingInfo.layerCount            = 1;
+        renderingInfo.viewMask              = renderPass.GetViewMask();
+        renderingInfo.colorAttachmentCount  = attachments.numColorAttachments;
+        renderingInfo.pColorAttachments     = colorAttachmentsVK;
+        renderingInfo.pDepthAttachment      = (hasDepth ? &depthAttachmentVK : nullptr);
+        renderingInfo.pStencilAttachment    = (hasStencil ? &stencilAttachmentVK : nullptr);
+    }
+    vkCmdBeginRenderingKHR(commandBuffer_, &renderingInfo);
+}
+
+void VKCommandBuffer::EndDynamicRendering()
+{
+    vkCmdEndRenderingKHR(commandBuffer_);
+
+    /* Transition attachments into their final layouts; these barriers are flushed by the next command that depends on them */
+    TransitionRenderingAttachments(*renderingPass_, false);
+}
+
+static void TransitionRenderingAttachment(
+    VKCommandContext&               context,
+    const VKRenderingAttachment&    attachment,
+    const VkAttachmentDescription&  attachmentDesc,
+    VkImageLayout                   attachmentLayout,
+    bool                            beginRendering)
+{
+    if (attachment.image == VK_NULL_HANDLE)
+        return;
+
+    const VkImageLayout oldLayout = (beginRendering ? attachmentDesc.initialLayout : attachmentLayout);
+    const VkImageLayout newLayout = (beginRendering ? attachmentLayout : attachmentDesc.finalLayout);
+
+    if (oldLayout != newLayout)
+        context.ImageMemoryBarrier(attachment.image, attachment.format, oldLayout, newLayout, attachment.subresource);
+}
+
+void VKCommandBuffer::TransitionRenderingAttachments(const VKRenderPass& renderPass, bool beginRendering)
+{
+    const VKRenderingAttachments& attachments = *renderingAttachments_;
+    const bool hasResolveAttachments = (renderPass.GetSampleCountBits() > VK_SAMPLE_COUNT_1_BIT);
+
+    for_range(i, attachments.numColorAttachments)
+    {
+        TransitionRenderingAttachment(
+            context_, attachments.colorAttachments[i], renderPass.GetAttachmentDesc(i), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, beginRendering
+        );
+        if (hasResolveAttachments)
+        {
+            TransitionRenderingAttachment(
+                context_, attachments.resolveAttachments[i], renderPass.GetAttachmentDesc(renderPass.GetNumAttachments() + i),
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, beginRendering
+            );
+        }
+    }
+
+    if (attachments.depthStencilAttachment.image != VK_NULL_HANDLE)
+    {
+        TransitionRenderingAttachment(
+            context_, attachments.depthStencilAttachment, renderPass.GetAttachmentDesc(attachments.numColorAttachments),
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, beginRendering
+        );
+    }
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 bool VKCommandBuffer::IsInsideRenderPass() const
 {
     return (recordState_ == RecordState::InsideRenderPass);
@@ -1273,30 +2153,58 @@ void VKCommandBuffer::BufferPipelineBarrier(
     VkPipelineStageFlags    srcStageMask,
     VkPipelineStageFlags    dstStageMask)
 {
-    VkBufferMemoryBarrier barrier;
-    {
-        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.pNext               = nullptr;
-        barrier.srcAccessMask       = srcAccessMask;
-        barrier.dstAccessMask       = dstAccessMask;
-        barrier.srcQueueFamilyIndex = 0;
-        barrier.dstQueueFamilyIndex = 0;
-        barrier.buffer              = buffer;
-        barrier.offset              = offset;
-        barrier.size                = size;
-    }
-    vkCmdPipelineBarrier(commandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+    /* Enqueue barrier into command context; it is flushed right before the next command that depends on it */
+    context_.BufferMemoryBarrier(buffer, offset, size, srcAccessMask, dstAccessMask, srcStageMask, dstStageMask);
+}
+
+// Maximum size (in bytes) of data that can be written inline with vkCmdUpdateBuffer.
+static constexpr VkDeviceSize maxInlineUpdateSize = 65536;
+
+void VKCommandBuffer::WriteBufferInline(VkBuffer buffer, VkDeviceSize offset, const void* data, VkDeviceSize size)
+{
+    /*
+    Small updates are stored in the command buffer itself, which is cheaper than a staging copy.
+    Larger or unaligned updates are written into the linear staging pool of the current native command buffer,
+    which is recycled once the recording fence for this command buffer has been signaled.
+    */
+    if (size <= maxInlineUpdateSize && size % 4 == 0 && offset % 4 == 0)
+        vkCmdUpdateBuffer(commandBuffer_, buffer, offset, size, data);
+    else
+        stagingBufferPool_->WriteStaged(commandBuffer_, buffer, offset, data, size);
 }
 
 void VKCommandBuffer::FlushDescriptorCache()
 {
     if (descriptorCache_ != nullptr && descriptorCache_->IsInvalidated())
     {
-        VkDescriptorSet descriptorSet = descriptorCache_->FlushDescriptorSet(*descriptorSetPool_, descriptorSetWriter_);
-        boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, descriptorSet);
+        if (descriptorCache_->HasPushDescriptors())
+        {
+            /* Push descriptors directly into the command buffer without allocating a staging descriptor set */
+            const VkWriteDescriptorSet* writes = nullptr;
+            const std::uint32_t numWrites = descriptorCache_->FlushPushDescriptors(writes);
+            boundPipelineState_->PushDynamicDescriptorSet(commandBuffer_, numWrites, writes);
+        }
+        else
+        {
+            VkDescriptorSet descriptorSet = descriptorCache_->FlushDescriptorSet(*descriptorSetPool_, descriptorSetWriter_);
+            boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, descriptorSet);
+        }
     }
 }
 
+VKDescriptorCache* VKCommandBuffer::GetOrCreateDescriptorCache(const VKPipelineLayout& pipelineLayout)
+{
+    if (pipelineLayout.GetNumBindings() == 0)
+        return nullptr;
+
+    /* Each command buffer owns its own descriptor cache per pipeline layout, so no synchronization is required between threads */
+    std::unique_ptr<VKDescriptorCache>& descriptorCache = descriptorCaches_[pipelineLayout.GetUniqueID()];
+    if (!descriptorCache)
+        descriptorCache = pipelineLayout.CreateDescriptorCache(device_);
+
+    return descriptorCache.get();
+}
+
 void VKCommandBuffer::AcquireNextBuffer()
 {
     /* Move to next command buffer index */
@@ -1312,9 +2220,14 @@ void VKCommandBuffer::AcquireNextBuffer()
     recordingFenceDirty_[commandBufferIndex_] = false;
 
     /* Make next command buffer current and reset pools and context */
-    commandBuffer_      = commandBufferArray_[commandBufferIndex_];
+    if (transientPoolCache_ != nullptr)
+        commandBuffer_  = transientPoolCache_->AcquireCommandBuffer(bufferLevel_);
+    else
+        commandBuffer_  = commandBufferArray_[commandBufferIndex_];
     descriptorSetPool_  = &(descriptorSetPoolArray_[commandBufferIndex_]);
     descriptorSetPool_->Reset();
+    stagingBufferPool_  = &(stagingBufferPoolArray_[commandBufferIndex_]);
+    stagingBufferPool_->Reset();
     context_.Reset(commandBuffer_);
 }
 
@@ -1323,6 +2236,7 @@ void VKCommandBuffer::ResetBindingStates()
     boundSwapChain_         = nullptr;
     boundPipelineLayout_    = nullptr;
     boundPipelineState_     = nullptr;
+    boundBindlessHeapSet_   = VK_NULL_HANDLE;
     descriptorCache_        = nullptr;
 }
 
@@ -16,6 +16,10 @@
 #include "VKCommandContext.h"
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
+#include "../Buffer/VKStagingBufferPool.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <map>
+#include <memory>
 #include <vector>
 
 
@@ -24,11 +28,15 @@ namespace LLGL
 
 
 class VKPhysicalDevice;
+class VKDeviceMemoryManager;
 class VKResourceHeap;
 class VKRenderPass;
+struct VKRenderingAttachments;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
+class VKTransferQueue;
+class VKCommandPoolCache;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -42,7 +50,11 @@ class VKCommandBuffer final : public CommandBuffer
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
             VkDevice                        device,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
             VkQueue                         commandQueue,
+            std::uint32_t                   commandQueueFamily,
+            VKTransferQueue*                transferQueue,
+            VKCommandPoolCache*             commandPoolCache,   // Per-thread command pools for transient command buffers; null if transient command buffers use their own pool.
             const QueueFamilyIndices&       queueFamilyIndices,
             const CommandBufferDescriptor&  desc
         );
@@ -102,6 +114,17 @@ class VKCommandBuffer final : public CommandBuffer
         void PauseRenderPass();
         void ResumeRenderPass();
 
+        #ifdef VK_KHR_dynamic_rendering
+
+        // Begins dynamic rendering with the attachment operations of the specified render pass for the current rendering attachments.
+        void BeginDynamicRendering(const VKRenderPass& renderPass, std::uint32_t numClearValues, const VkClearValue* clearValues);
+        void EndDynamicRendering();
+
+        // Transitions the current rendering attachments into or out of their attachment layouts, which render pass objects do implicitly.
+        void TransitionRenderingAttachments(const VKRenderPass& renderPass, bool beginRendering);
+
+        #endif // /VK_KHR_dynamic_rendering
+
         bool IsInsideRenderPass() const;
 
         void BufferPipelineBarrier(
@@ -114,8 +137,14 @@ class VKCommandBuffer final : public CommandBuffer
             VkPipelineStageFlags    dstStageMask    = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
         );
 
+        // Writes the specified data into the buffer with vkCmdUpdateBuffer if possible, or with a copy from the staging pool otherwise.
+        void WriteBufferInline(VkBuffer buffer, VkDeviceSize offset, const void* data, VkDeviceSize size);
+
         void FlushDescriptorCache();
 
+        // Returns the descriptor cache of this command buffer for the specified pipeline layout or null if it has no dynamic bindings.
+        VKDescriptorCache* GetOrCreateDescriptorCache(const VKPipelineLayout& pipelineLayout);
+
         // Acquires the next native VkCommandBuffer object.
         void AcquireNextBuffer();
 
@@ -138,8 +167,10 @@ class VKCommandBuffer final : public CommandBuffer
         VkDevice                        device_                                         = VK_NULL_HANDLE;
 
         VkQueue                         commandQueue_                                   = VK_NULL_HANDLE;
+        VKTransferQueue*                transferQueue_                                  = nullptr;
 
         VKPtr<VkCommandPool>            commandPool_;
+        VKCommandPoolCache*             transientPoolCache_                             = nullptr; // Only used for transient command buffers
 
         VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_                                 = VK_NULL_HANDLE;
@@ -168,6 +199,10 @@ class VKCommandBuffer final : public CommandBuffer
         bool                            hasDepthStencilAttachment_                      = false;
         VkSubpassContents               subpassContents_                                = VK_SUBPASS_CONTENTS_INLINE;
 
+        const VKRenderPass*             renderingPass_                                  = nullptr; // active render pass for dynamic rendering or inherited render pass of secondary command buffers
+        const VKRenderPass*             secondaryRenderingPass_                         = nullptr; // to pause/resume dynamic rendering
+        const VKRenderingAttachments*   renderingAttachments_                           = nullptr; // replaces the framebuffer for dynamic rendering
+
         std::uint32_t                   queuePresentFamily_                             = 0;
 
         bool                            scissorEnabled_                                 = false;
@@ -175,19 +210,33 @@ class VKCommandBuffer final : public CommandBuffer
         VkPipelineBindPoint             pipelineBindPoint_                              = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         const VKPipelineLayout*         boundPipelineLayout_                            = nullptr;
         VKPipelineState*                boundPipelineState_                             = nullptr;
+        VkDescriptorSet                 boundBindlessHeapSet_                           = VK_NULL_HANDLE; // Bindless descriptor set that is bound for the current PSO.
 
         std::uint32_t                   maxDrawIndirectCount_                           = 0;
+        std::uint32_t                   maxMultiDrawCount_                              = 0;
+
+        #ifdef VK_EXT_multi_draw
+        std::vector<VkMultiDrawIndexedInfoEXT> multiDrawIndexedInfos_; // Scratch buffer for MultiDrawIndexed to avoid reallocations per call.
+        #endif
 
         VKStagingDescriptorSetPool      descriptorSetPoolArray_[maxNumCommandBuffers];
         VKStagingDescriptorSetPool*     descriptorSetPool_                              = nullptr;
         VKDescriptorCache*              descriptorCache_                                = nullptr;
         VKDescriptorSetWriter           descriptorSetWriter_;
 
+        // Descriptor caches owned by this command buffer for each pipeline layout (by unique ID) with dynamic bindings.
+        std::map<std::uint64_t, std::unique_ptr<VKDescriptorCache>> descriptorCaches_;
+
+        VKStagingBufferPool             stagingBufferPoolArray_[maxNumCommandBuffers];
+        VKStagingBufferPool*            stagingBufferPool_                              = nullptr;
+
         #if 1//TODO: optimize usage of query pools
         std::vector<VKQueryHeap*>       queryHeapsInFlight_;
         std::size_t                     numQueryHeapsInFlight_                          = 0;
         #endif
 
+        CPUProfileSpan                  encodeSpan_;
+
 };
 
 
@@ -13,6 +13,7 @@
 #include "../../../Core/Assertion.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -24,42 +25,37 @@ VKCommandContext::VKCommandContext() :
 }
 
 VKCommandContext::VKCommandContext(VkCommandBuffer commandBuffer) :
-    commandBuffer_     { commandBuffer },
-    numMemoryBarriers_ { 0             },
-    numBufferBarriers_ { 0             },
-    numImageBarriers_  { 0             }
+    commandBuffer_ { commandBuffer }
 {
-    /* Initialize default structure members of all barriers */
-    for (VkMemoryBarrier& barrier : memoryBarriers_)
-    {
-        barrier.sType               = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        barrier.pNext               = nullptr;
-    }
-    for (VkBufferMemoryBarrier& barrier : bufferBarriers_)
-    {
-        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.pNext               = nullptr;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    }
-    for (VkImageMemoryBarrier& barrier : imageBarriers_)
-    {
-        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.pNext               = nullptr;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    }
+    /* Initialize default structure members of global memory barrier */
+    memoryBarrier_.sType            = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier_.pNext            = nullptr;
+    memoryBarrier_.srcAccessMask    = 0;
+    memoryBarrier_.dstAccessMask    = 0;
 }
 
 
 void VKCommandContext::Reset(VkCommandBuffer commandBuffer)
 {
-    LLGL_ASSERT(numMemoryBarriers_ == 0, "memory barriers have not be flushed before end of previous command buffer");
-    LLGL_ASSERT(numBufferBarriers_ == 0, "buffer memory barriers have not be flushed before end of previous command buffer");
-    LLGL_ASSERT(numImageBarriers_ == 0, "image memory barriers have not be flushed before end of previous command buffer");
+    LLGL_ASSERT(!HasPendingBarriers(), "memory barriers have not be flushed before end of previous command buffer");
     commandBuffer_ = commandBuffer;
 }
 
+void VKCommandContext::GlobalMemoryBarrier(
+    VkPipelineStageFlags    srcStageMask,
+    VkAccessFlags           srcAccessMask,
+    VkPipelineStageFlags    dstStageMask,
+    VkAccessFlags           dstAccessMask)
+{
+    /* Merge access masks into the single global memory barrier; stage masks are combined for the entire barrier command anyway */
+    memoryBarrier_.srcAccessMask |= srcAccessMask;
+    memoryBarrier_.dstAccessMask |= dstAccessMask;
+    hasMemoryBarrier_ = true;
+
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
+}
+
 void VKCommandContext::BufferMemoryBarrier(
     VkBuffer        buffer,
     VkDeviceSize    offset,
@@ -68,25 +64,90 @@ void VKCommandContext::BufferMemoryBarrier(
     VkAccessFlags   dstAccessMask,
     bool            flushImmediately)
 {
-    if (numBufferBarriers_ == maxNumBarriers)
+    BufferMemoryBarrier(
+        buffer,
+        offset,
+        size,
+        srcAccessMask,
+        dstAccessMask,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
+    );
+
+    if (flushImmediately)
         FlushBarriers();
+}
 
+void VKCommandContext::BufferMemoryBarrier(
+    VkBuffer                buffer,
+    VkDeviceSize            offset,
+    VkDeviceSize            size,
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask,
+    VkPipelineStageFlags    srcStageMask,
+    VkPipelineStageFlags    dstStageMask)
+{
     /* Initialize buffer memory barrier descriptor */
-    VkBufferMemoryBarrier& barrier = bufferBarriers_[numBufferBarriers_++];
+    VkBufferMemoryBarrier barrier;
     {
-        barrier.srcAccessMask   = srcAccessMask;
-        barrier.dstAccessMask   = dstAccessMask;
-        barrier.buffer          = buffer;
-        barrier.offset          = offset;
-        barrier.size            = size;
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = srcAccessMask;
+        barrier.dstAccessMask       = dstAccessMask;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer              = buffer;
+        barrier.offset              = offset;
+        barrier.size                = size;
     }
+    EmplaceBufferBarrier(barrier);
 
     /* Initialize pipeline state flags */
-    srcStageMask_ |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-    dstStageMask_ |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
+}
 
-    if (flushImmediately)
-        FlushBarriers();
+// Returns true if the specified layout is used for color or depth-stencil attachments and returns their pipeline stages and access flags.
+static bool GetAttachmentLayoutStageAndAccess(VkImageLayout layout, VkPipelineStageFlags& outStageMask, VkAccessFlags& outAccessMask)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            outStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            outAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            return true;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            outStageMask    = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            outAccessMask   = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns the pipeline stages and access flags that are synchronized with an attachment transition from or to the specified layout.
+static void GetAttachmentTransitionStageAndAccess(VkImageLayout layout, VkPipelineStageFlags& outStageMask, VkAccessFlags& outAccessMask)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            outStageMask    = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            outAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            outStageMask    = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            outAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            outStageMask    = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            outAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            break;
+        default:
+            /* Undefined and presentable images are synchronized via semaphores only */
+            outStageMask    = 0;
+            outAccessMask   = 0;
+            break;
+    }
 }
 
 void VKCommandContext::ImageMemoryBarrier(
@@ -97,14 +158,15 @@ void VKCommandContext::ImageMemoryBarrier(
     const TextureSubresource&   subresource,
     bool                        flushImmediately)
 {
-    if (numImageBarriers_ == maxNumBarriers)
-        FlushBarriers();
-
     /* Initialize image memory barrier descriptor */
-    VkImageMemoryBarrier& barrier = imageBarriers_[numImageBarriers_++];
+    VkImageMemoryBarrier barrier;
     {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
         barrier.oldLayout                       = oldLayout;
         barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
         barrier.image                           = image;
         barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(format);
         barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
@@ -131,14 +193,37 @@ void VKCommandContext::ImageMemoryBarrier(
         srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
         dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    else if (GetAttachmentLayoutStageAndAccess(newLayout, dstStageMask, barrier.dstAccessMask))
+    {
+        /* Transition into attachment layout to begin dynamic rendering; previous writes to the same attachment must be complete */
+        if (!GetAttachmentLayoutStageAndAccess(oldLayout, srcStageMask, barrier.srcAccessMask))
+        {
+            GetAttachmentTransitionStageAndAccess(oldLayout, srcStageMask, barrier.srcAccessMask);
+            srcStageMask            |= dstStageMask;
+            barrier.srcAccessMask   |= (barrier.dstAccessMask & (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT));
+        }
+    }
+    else if (GetAttachmentLayoutStageAndAccess(oldLayout, srcStageMask, barrier.srcAccessMask))
+    {
+        /* Transition out of attachment layout to end dynamic rendering */
+        barrier.srcAccessMask &= (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+        GetAttachmentTransitionStageAndAccess(newLayout, dstStageMask, barrier.dstAccessMask);
+        if (dstStageMask == 0)
+            dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    }
     else
     {
         barrier.srcAccessMask = 0;
         barrier.dstAccessMask = 0;
     }
 
-    srcStageMask_ |= srcStageMask;
-    dstStageMask_ |= dstStageMask;
+    /* Drop transitions that have no effect */
+    if (oldLayout != newLayout || barrier.srcAccessMask != 0 || barrier.dstAccessMask != 0)
+    {
+        EmplaceImageBarrier(barrier);
+        srcStageMask_ |= srcStageMask;
+        dstStageMask_ |= dstStageMask;
+    }
 
     if (flushImmediately)
         FlushBarriers();
@@ -146,26 +231,62 @@ void VKCommandContext::ImageMemoryBarrier(
 
 void VKCommandContext::FlushBarriers()
 {
-    if (numMemoryBarriers_ > 0 || numBufferBarriers_ > 0 || numImageBarriers_ > 0)
+    if (HasPendingBarriers())
     {
         vkCmdPipelineBarrier(
             commandBuffer_,
             srcStageMask_,
             dstStageMask_,
             0, // VkDependencyFlags
-            numMemoryBarriers_,
-            memoryBarriers_,
-            numBufferBarriers_,
-            bufferBarriers_,
-            numImageBarriers_,
-            imageBarriers_
+            (hasMemoryBarrier_ ? 1u : 0u),
+            &memoryBarrier_,
+            static_cast<std::uint32_t>(bufferBarriers_.size()),
+            bufferBarriers_.data(),
+            static_cast<std::uint32_t>(imageBarriers_.size()),
+            imageBarriers_.data()
         );
-        numMemoryBarriers_  = 0;
-        numBufferBarriers_  = 0;
-        numImageBarriers_   = 0;
-        srcStageMask_       = 0;
-        dstStageMask_       = 0;
+        memoryBarrier_.srcAccessMask    = 0;
+        memoryBarrier_.dstAccessMask    = 0;
+        hasMemoryBarrier_               = false;
+        bufferBarriers_.clear();
+        imageBarriers_.clear();
+    }
+
+    /* Reset stage masks even if all barriers have been dropped */
+    srcStageMask_ = 0;
+    dstStageMask_ = 0;
+}
+
+void VKCommandContext::FlushBarriersForTransfer(VkBuffer dstBuffer, VkBuffer srcBuffer)
+{
+    if (!HasPendingBarriers())
+        return;
+
+    /*
+    Transfer commands only depend on pending barriers that guard other transfer writes if they access the same buffers.
+    This allows consecutive buffer updates to share a single barrier before the next draw or dispatch command.
+    */
+    if (srcStageMask_ == VK_PIPELINE_STAGE_TRANSFER_BIT && !hasMemoryBarrier_ && imageBarriers_.empty())
+    {
+        bool hasDependency = false;
+        for (const VkBufferMemoryBarrier& barrier : bufferBarriers_)
+        {
+            if (barrier.buffer == dstBuffer || barrier.buffer == srcBuffer)
+            {
+                hasDependency = true;
+                break;
+            }
+        }
+        if (!hasDependency)
+            return;
     }
+
+    FlushBarriers();
+}
+
+bool VKCommandContext::HasPendingBarriers() const
+{
+    return (hasMemoryBarrier_ || !bufferBarriers_.empty() || !imageBarriers_.empty());
 }
 
 void VKCommandContext::CopyBuffer(
@@ -188,6 +309,15 @@ void VKCommandContext::CopyTexture(
     VKTexture&          srcTexture,
     VKTexture&          dstTexture,
     const VkImageCopy&  region)
+{
+    CopyTexture(srcTexture, dstTexture, 1, &region);
+}
+
+void VKCommandContext::CopyTexture(
+    VKTexture&          srcTexture,
+    VKTexture&          dstTexture,
+    std::uint32_t       numRegions,
+    const VkImageCopy*  regions)
 {
     vkCmdCopyImage(
         commandBuffer_,
@@ -195,8 +325,8 @@ void VKCommandContext::CopyTexture(
         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
         dstTexture.GetVkImage(),
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &region
+        numRegions,
+        regions
     );
 }
 
@@ -246,11 +376,12 @@ void VKCommandContext::CopyBufferToImage(
     VkFormat                    format,
     const VkOffset3D&           offset,
     const VkExtent3D&           extent,
-    const TextureSubresource&   subresource)
+    const TextureSubresource&   subresource,
+    VkDeviceSize                srcOffset)
 {
     VkBufferImageCopy region;
     {
-        region.bufferOffset                     = 0;
+        region.bufferOffset                     = srcOffset;
         region.bufferRowLength                  = 0;
         region.bufferImageHeight                = 0;
         region.imageSubresource.aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(format);
@@ -444,6 +575,217 @@ void VKCommandContext::GenerateMips(
     }
 }
 
+// Appends an image memory barrier for a single MIP-map level and all array layers of the specified texture.
+static void AppendMipLevelBarrier(
+    SmallVector<VkImageMemoryBarrier, 32>&  barriers,
+    const VKTexture&                        texture,
+    std::uint32_t                           mipLevel,
+    VkAccessFlags                           srcAccessMask,
+    VkAccessFlags                           dstAccessMask,
+    VkImageLayout                           oldLayout,
+    VkImageLayout                           newLayout)
+{
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = srcAccessMask;
+        barrier.dstAccessMask                   = dstAccessMask;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = texture.GetVkImage();
+        barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(texture.GetVkFormat());
+        barrier.subresourceRange.baseMipLevel   = mipLevel;
+        barrier.subresourceRange.levelCount     = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = texture.GetNumArrayLayers();
+    }
+    barriers.push_back(barrier);
+}
+
+void VKCommandContext::GenerateMipsBatch(std::uint32_t numTextures, VKTexture* const * textures)
+{
+    /* Transition all MIP-map levels of all textures to VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL with a single barrier batch */
+    std::uint32_t maxNumMipLevels = 0;
+
+    for_range(i, numTextures)
+    {
+        const VKTexture* texture = textures[i];
+        ImageMemoryBarrier(
+            texture->GetVkImage(),
+            texture->GetVkFormat(),
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            TextureSubresource{ 0, texture->GetNumArrayLayers(), 0, texture->GetNumMipLevels() }
+        );
+        maxNumMipLevels = std::max(maxNumMipLevels, texture->GetNumMipLevels());
+    }
+
+    FlushBarriers();
+
+    /*
+    Record one MIP-map level of all textures at a time. Each level only needs a single pipeline barrier for all textures, which
+    transitions the previous level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, releases the level before that for shader reads,
+    and releases the last level of each texture whose MIP-map chain is complete.
+    */
+    SmallVector<VkImageMemoryBarrier, 32> barriers;
+
+    for (std::uint32_t mipLevel = 1; mipLevel <= maxNumMipLevels; ++mipLevel)
+    {
+        barriers.clear();
+
+        for_range(i, numTextures)
+        {
+            const VKTexture&    texture         = *textures[i];
+            const std::uint32_t numMipLevels    = texture.GetNumMipLevels();
+
+            if (mipLevel < numMipLevels)
+            {
+                /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
+                AppendMipLevelBarrier(
+                    barriers, texture, mipLevel - 1,
+                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+                );
+            }
+            else if (mipLevel == numMipLevels)
+            {
+                /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+                AppendMipLevelBarrier(
+                    barriers, texture, mipLevel - 1,
+                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                );
+            }
+
+            if (mipLevel >= 2 && mipLevel <= numMipLevels)
+            {
+                /* Transition MIP level that was blitted from in the previous iteration back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+                AppendMipLevelBarrier(
+                    barriers, texture, mipLevel - 2,
+                    VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                );
+            }
+        }
+
+        if (!barriers.empty())
+        {
+            vkCmdPipelineBarrier(
+                commandBuffer_,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, (VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT), 0,
+                0, nullptr,
+                0, nullptr,
+                static_cast<std::uint32_t>(barriers.size()), barriers.data()
+            );
+        }
+
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) for all array layers of each texture */
+        for_range(i, numTextures)
+        {
+            const VKTexture& texture = *textures[i];
+            if (mipLevel >= texture.GetNumMipLevels())
+                continue;
+
+            const VkImageAspectFlags    aspectMask  = VKImageUtils::GetInclusiveVkImageAspect(texture.GetVkFormat());
+            const VkExtent3D&           extent      = texture.GetVkExtent();
+
+            VkImageBlit blit;
+
+            blit.srcSubresource.aspectMask      = aspectMask;
+            blit.srcSubresource.mipLevel        = mipLevel - 1;
+            blit.srcSubresource.baseArrayLayer  = 0;
+            blit.srcSubresource.layerCount      = texture.GetNumArrayLayers();
+            blit.srcOffsets[0]                  = { 0, 0, 0 };
+            blit.srcOffsets[1].x                = static_cast<std::int32_t>(std::max(1u, extent.width  >> (mipLevel - 1)));
+            blit.srcOffsets[1].y                = static_cast<std::int32_t>(std::max(1u, extent.height >> (mipLevel - 1)));
+            blit.srcOffsets[1].z                = static_cast<std::int32_t>(std::max(1u, extent.depth  >> (mipLevel - 1)));
+            blit.dstSubresource.aspectMask      = aspectMask;
+            blit.dstSubresource.mipLevel        = mipLevel;
+            blit.dstSubresource.baseArrayLayer  = 0;
+            blit.dstSubresource.layerCount      = texture.GetNumArrayLayers();
+            blit.dstOffsets[0]                  = { 0, 0, 0 };
+            blit.dstOffsets[1].x                = static_cast<std::int32_t>(std::max(1u, extent.width  >> mipLevel));
+            blit.dstOffsets[1].y                = static_cast<std::int32_t>(std::max(1u, extent.height >> mipLevel));
+            blit.dstOffsets[1].z                = static_cast<std::int32_t>(std::max(1u, extent.depth  >> mipLevel));
+
+            vkCmdBlitImage(
+                commandBuffer_,
+                texture.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                texture.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                1, &blit,
+                VK_FILTER_LINEAR
+            );
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns the exclusive end of the specified buffer range or VK_WHOLE_SIZE.
+static VkDeviceSize GetBufferRangeEnd(VkDeviceSize offset, VkDeviceSize size)
+{
+    return (size == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : offset + size);
+}
+
+void VKCommandContext::EmplaceBufferBarrier(const VkBufferMemoryBarrier& barrier)
+{
+    for (VkBufferMemoryBarrier& entry : bufferBarriers_)
+    {
+        if (entry.buffer == barrier.buffer)
+        {
+            /* Merge into pending barrier for the same buffer by combining access masks and the union of both ranges */
+            const VkDeviceSize offset   = std::min(entry.offset, barrier.offset);
+            const VkDeviceSize end      = std::max(GetBufferRangeEnd(entry.offset, entry.size), GetBufferRangeEnd(barrier.offset, barrier.size));
+            entry.srcAccessMask |= barrier.srcAccessMask;
+            entry.dstAccessMask |= barrier.dstAccessMask;
+            entry.offset        = offset;
+            entry.size          = (end == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : end - offset);
+            return;
+        }
+    }
+    bufferBarriers_.push_back(barrier);
+}
+
+static bool IsEqualImageSubresourceRange(const VkImageSubresourceRange& lhs, const VkImageSubresourceRange& rhs)
+{
+    return
+    (
+        lhs.aspectMask      == rhs.aspectMask       &&
+        lhs.baseMipLevel    == rhs.baseMipLevel     &&
+        lhs.levelCount      == rhs.levelCount       &&
+        lhs.baseArrayLayer  == rhs.baseArrayLayer   &&
+        lhs.layerCount      == rhs.layerCount
+    );
+}
+
+void VKCommandContext::EmplaceImageBarrier(const VkImageMemoryBarrier& barrier)
+{
+    for (auto it = imageBarriers_.begin(); it != imageBarriers_.end(); ++it)
+    {
+        VkImageMemoryBarrier& entry = *it;
+        if (entry.image == barrier.image && entry.newLayout == barrier.oldLayout && IsEqualImageSubresourceRange(entry.subresourceRange, barrier.subresourceRange))
+        {
+            /*
+            Combine chained transitions, since no command can access the intermediate layout before the barriers are flushed.
+            Drop the combined transition entirely if it returns to its initial layout without any memory dependency.
+            */
+            entry.newLayout     = barrier.newLayout;
+            entry.srcAccessMask |= barrier.srcAccessMask;
+            entry.dstAccessMask |= barrier.dstAccessMask;
+            if (entry.oldLayout == entry.newLayout && entry.srcAccessMask == 0 && entry.dstAccessMask == 0)
+                imageBarriers_.erase(it);
+            return;
+        }
+    }
+    imageBarriers_.push_back(barrier);
+}
+
 
 } // /namespace LLGL
 
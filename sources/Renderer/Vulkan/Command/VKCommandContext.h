@@ -9,6 +9,7 @@
 #define LLGL_VK_COMMAND_CONTEXT_H
 
 
+#include <LLGL/Container/SmallVector.h>
 #include "../VKPtr.h"
 #include <vulkan/vulkan.h>
 #include <memory>
@@ -36,6 +37,20 @@ class VKCommandContext
 
         /* --- Memory barriers --- */
 
+        /*
+        Pending barriers are accumulated until they are flushed as a single vkCmdPipelineBarrier command.
+        Barriers for the same buffer are merged, chained layout transitions of the same image subresource are combined,
+        and transitions that have no effect are dropped.
+        */
+
+        // Enqueues a global memory barrier. All global memory barriers are merged into a single VkMemoryBarrier.
+        void GlobalMemoryBarrier(
+            VkPipelineStageFlags        srcStageMask,
+            VkAccessFlags               srcAccessMask,
+            VkPipelineStageFlags        dstStageMask,
+            VkAccessFlags               dstAccessMask
+        );
+
         void BufferMemoryBarrier(
             VkBuffer                    buffer,
             VkDeviceSize                offset,
@@ -45,6 +60,16 @@ class VKCommandContext
             bool                        flushImmediately    = false
         );
 
+        void BufferMemoryBarrier(
+            VkBuffer                    buffer,
+            VkDeviceSize                offset,
+            VkDeviceSize                size,
+            VkAccessFlags               srcAccessMask,
+            VkAccessFlags               dstAccessMask,
+            VkPipelineStageFlags        srcStageMask,
+            VkPipelineStageFlags        dstStageMask
+        );
+
         void ImageMemoryBarrier(
             VkImage                     image,
             VkFormat                    format,
@@ -57,6 +82,12 @@ class VKCommandContext
         // Submits this pipeline barrier into the current command buffer.
         void FlushBarriers();
 
+        // Flushes pending barriers before a transfer command, unless they only guard transfer writes into buffers other than the specified ones.
+        void FlushBarriersForTransfer(VkBuffer dstBuffer, VkBuffer srcBuffer = VK_NULL_HANDLE);
+
+        // Returns true if there are any pending barriers that have not been flushed yet.
+        bool HasPendingBarriers() const;
+
         /* --- Resource operations --- */
 
         void CopyBuffer(
@@ -73,6 +104,13 @@ class VKCommandContext
             const VkImageCopy&  region
         );
 
+        void CopyTexture(
+            VKTexture&          srcTexture,
+            VKTexture&          dstTexture,
+            std::uint32_t       numRegions,
+            const VkImageCopy*  regions
+        );
+
         void CopyImage(
             VkImage             srcImage,
             VkImageLayout       srcImageLayout,
@@ -98,7 +136,8 @@ class VKCommandContext
             VkFormat                    format,
             const VkOffset3D&           offset,
             const VkExtent3D&           extent,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            VkDeviceSize                srcOffset       = 0
         );
 
         void CopyBufferToImage(
@@ -130,24 +169,36 @@ class VKCommandContext
             const TextureSubresource&   subresource
         );
 
+        /*
+        Generates the entire MIP-map chain for each texture in the specified array.
+        The blits of all textures are recorded level by level, so each MIP-map level requires only a single pipeline barrier for all textures.
+        */
+        void GenerateMipsBatch(std::uint32_t numTextures, VKTexture* const * textures);
+
     private:
 
-        static constexpr std::uint32_t maxNumBarriers = 4;
+        // Merges the specified buffer barrier with a pending barrier for the same buffer or appends it.
+        void EmplaceBufferBarrier(const VkBufferMemoryBarrier& barrier);
+
+        // Combines the specified image barrier with a pending transition of the same subresource or appends it.
+        void EmplaceImageBarrier(const VkImageMemoryBarrier& barrier);
 
     private:
 
-        VkCommandBuffer         commandBuffer_                  = VK_NULL_HANDLE;
+        // Number of barriers per type that are stored without heap allocation.
+        static constexpr std::size_t numLocalBarriers = 4;
+
+    private:
 
-        VkPipelineStageFlags    srcStageMask_                   = 0;
-        VkPipelineStageFlags    dstStageMask_                   = 0;
+        VkCommandBuffer                                         commandBuffer_      = VK_NULL_HANDLE;
 
-        std::uint32_t           numMemoryBarriers_ : 4;
-        std::uint32_t           numBufferBarriers_ : 4;
-        std::uint32_t           numImageBarriers_  : 4;
+        VkPipelineStageFlags                                    srcStageMask_       = 0;
+        VkPipelineStageFlags                                    dstStageMask_       = 0;
 
-        VkMemoryBarrier         memoryBarriers_[maxNumBarriers];
-        VkBufferMemoryBarrier   bufferBarriers_[maxNumBarriers];
-        VkImageMemoryBarrier    imageBarriers_[maxNumBarriers];
+        bool                                                    hasMemoryBarrier_   = false;
+        VkMemoryBarrier                                         memoryBarrier_;
+        SmallVector<VkBufferMemoryBarrier, numLocalBarriers>    bufferBarriers_;
+        SmallVector<VkImageMemoryBarrier, numLocalBarriers>     imageBarriers_;
 
 };
 
@@ -0,0 +1,141 @@
+/*
+ * VKCommandPoolCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKCommandPoolCache.h"
+#include "../VKCore.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+VKCommandPoolCache::VKCommandPoolCache(VkDevice device, VkQueue queue, std::uint32_t queueFamilyIndex) :
+    device_           { device           },
+    queue_            { queue            },
+    queueFamilyIndex_ { queueFamilyIndex },
+    frameFences_      { VKPtr<VkFence>{ device, vkDestroyFence },
+                        VKPtr<VkFence>{ device, vkDestroyFence },
+                        VKPtr<VkFence>{ device, vkDestroyFence } }
+{
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    for_range(i, maxNumFrames)
+    {
+        VkResult result = vkCreateFence(device_, &createInfo, nullptr, frameFences_[i].ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for transient command pools");
+    }
+}
+
+VkCommandBuffer VKCommandPoolCache::AcquireCommandBuffer(VkCommandBufferLevel level)
+{
+    FramePool& framePool = GetOrCreateFramePool();
+
+    /* Re-use command buffer that has been allocated in a previous cycle of this frame */
+    const std::size_t levelIndex = (level == VK_COMMAND_BUFFER_LEVEL_SECONDARY ? 1 : 0);
+    std::vector<VkCommandBuffer>& commandBuffers = framePool.commandBuffers[levelIndex];
+    std::size_t& numAcquired = framePool.numAcquired[levelIndex];
+
+    if (numAcquired == commandBuffers.size())
+    {
+        /* Allocate new command buffer from the pool of this thread */
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = framePool.commandPool;
+            allocInfo.level                 = level;
+            allocInfo.commandBufferCount    = 1;
+        }
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBuffer);
+        VKThrowIfFailed(result, "failed to allocate transient Vulkan command buffer");
+        commandBuffers.push_back(commandBuffer);
+    }
+
+    return commandBuffers[numAcquired++];
+}
+
+void VKCommandPoolCache::NextFrame()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Fence all work that has been submitted during the current frame with an empty submission, since queue submissions complete in order */
+    VkFence currentFence = frameFences_[currentFrame_].Get();
+    VkResult result = VKQueueSubmit(queue_, 0, nullptr, currentFence);
+    VKThrowIfFailed(result, "failed to submit fence for transient Vulkan command pools");
+    frameFencesDirty_[currentFrame_] = true;
+
+    /* Move to next frame and wait until it has completed on the GPU before its command pools can be reset */
+    currentFrame_ = (currentFrame_ + 1) % maxNumFrames;
+
+    if (frameFencesDirty_[currentFrame_])
+    {
+        VkFence nextFence = frameFences_[currentFrame_].Get();
+        vkWaitForFences(device_, 1, &nextFence, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &nextFence);
+        frameFencesDirty_[currentFrame_] = false;
+        ResetFramePools(currentFrame_);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKCommandPoolCache::FramePool& VKCommandPoolCache::GetOrCreateFramePool()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    ThreadPoolsPtr& threadPools = threadPools_[std::this_thread::get_id()];
+    if (!threadPools)
+        threadPools = ThreadPoolsPtr{ new ThreadPools{} };
+
+    FramePool& framePool = threadPools->frames[currentFrame_];
+    if (framePool.commandPool.Get() == VK_NULL_HANDLE)
+    {
+        /* Create transient command pool, whose command buffers are only reset all at once */
+        VkCommandPoolCreateInfo createInfo;
+        {
+            createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            createInfo.pNext            = nullptr;
+            createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            createInfo.queueFamilyIndex = queueFamilyIndex_;
+        }
+        framePool.commandPool = VKPtr<VkCommandPool>{ device_, vkDestroyCommandPool };
+        VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, framePool.commandPool.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create transient Vulkan command pool");
+    }
+
+    return framePool;
+}
+
+void VKCommandPoolCache::ResetFramePools(std::uint32_t frame)
+{
+    for (auto& threadPools : threadPools_)
+    {
+        FramePool& framePool = threadPools.second->frames[frame];
+        if (framePool.numAcquired[0] > 0 || framePool.numAcquired[1] > 0)
+        {
+            vkResetCommandPool(device_, framePool.commandPool, 0);
+            framePool.numAcquired[0] = 0;
+            framePool.numAcquired[1] = 0;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,98 @@
+/*
+ * VKCommandPoolCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_COMMAND_POOL_CACHE_H
+#define LLGL_VK_COMMAND_POOL_CACHE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache of transient command pools for each encoding thread and frame in flight.
+Native command buffers are acquired from the command pool of the calling thread for the current frame and are never freed individually.
+Instead, all command pools of a frame are reset at once with vkResetCommandPool before that frame is encoded again,
+after the fence that was submitted at the end of that frame has been signaled.
+*/
+class VKCommandPoolCache
+{
+
+    public:
+
+        VKCommandPoolCache(VkDevice device, VkQueue queue, std::uint32_t queueFamilyIndex);
+
+        VKCommandPoolCache(const VKCommandPoolCache&) = delete;
+        VKCommandPoolCache& operator = (const VKCommandPoolCache&) = delete;
+
+        // Acquires a native command buffer of the specified level from the command pool of the calling thread for the current frame.
+        VkCommandBuffer AcquireCommandBuffer(VkCommandBufferLevel level);
+
+        // Fences the current frame and moves on to the next one. Waits for the next frame to complete on the GPU before its command pools are reset.
+        void NextFrame();
+
+    private:
+
+        static constexpr std::uint32_t maxNumFrames = 3;
+
+        // Command pool of a single thread for a single frame.
+        struct FramePool
+        {
+            VKPtr<VkCommandPool>            commandPool;
+            std::vector<VkCommandBuffer>    commandBuffers[2];  // Primary and secondary command buffers
+            std::size_t                     numAcquired[2]      = {};
+        };
+
+        // Command pools of a single thread for all frames.
+        struct ThreadPools
+        {
+            FramePool frames[maxNumFrames];
+        };
+
+        using ThreadPoolsPtr = std::unique_ptr<ThreadPools>;
+
+    private:
+
+        // Returns the command pool of the calling thread for the current frame and creates it on first use.
+        FramePool& GetOrCreateFramePool();
+
+        void ResetFramePools(std::uint32_t frame);
+
+    private:
+
+        VkDevice                                    device_             = VK_NULL_HANDLE;
+        VkQueue                                     queue_              = VK_NULL_HANDLE;
+        std::uint32_t                               queueFamilyIndex_   = 0;
+
+        std::mutex                                  mutex_;
+        std::map<std::thread::id, ThreadPoolsPtr>   threadPools_;
+
+        VKPtr<VkFence>                              frameFences_[maxNumFrames];
+        bool                                        frameFencesDirty_[maxNumFrames] = {};
+        std::uint32_t                               currentFrame_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,10 +7,17 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKTransferQueue.h"
+#include "VKDeferredReleaseQueue.h"
 #include "../RenderState/VKFence.h"
 #include "../RenderState/VKQueryHeap.h"
+#include "../Texture/VKTexture.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
 
 
 namespace LLGL
@@ -31,28 +38,51 @@ VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuff
         submitInfo.signalSemaphoreCount = 0;
         submitInfo.pSignalSemaphores    = nullptr;
     }
-    return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
+    return VKQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(
+    VkDevice                device,
+    VkQueue                 queue,
+    VKTransferQueue*        transferQueue,
+    VKDeviceMemoryManager*  deviceMemoryMngr,
+    VKDeferredReleaseQueue* deferredReleaseQueue)
+:
+    device_                 { device                    },
+    native_                 { queue                     },
+    transferQueue_          { transferQueue             },
+    deviceMemoryMngr_       { deviceMemoryMngr          },
+    deferredReleaseQueue_   { deferredReleaseQueue      },
+    sparseBindFence_        { device, vkDestroyFence    }
 {
 }
 
+#ifdef VK_EXT_calibrated_timestamps
+
+void VKCommandQueue::EnableTimestampCalibration(VkTimeDomainEXT hostTimeDomain, float timestampPeriod)
+{
+    hostTimeDomain_     = hostTimeDomain;
+    timestampPeriod_    = timestampPeriod;
+}
+
+#endif // /VK_EXT_calibrated_timestamps
+
 /* ----- Command Buffers ----- */
 
 void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_CPU_PROFILE_SCOPE("CommandQueue::Submit");
+
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
     if (!commandBufferVK.IsImmediateCmdBuffer())
     {
+        FlushPendingTransfers();
         VkResult result = VKSubmitCommandBuffer(
             native_,
             commandBufferVK.GetVkCommandBuffer(),
             commandBufferVK.GetQueueSubmitFenceAndFlush()
         );
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
     }
 }
 
@@ -98,13 +128,122 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryP
 }
 #endif
 
+bool VKCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    #ifdef VK_EXT_calibrated_timestamps
+    if (hostTimeDomain_ != VK_TIME_DOMAIN_MAX_ENUM_EXT)
+    {
+        VkCalibratedTimestampInfoEXT timestampInfos[2];
+        {
+            timestampInfos[0].sType         = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestampInfos[0].pNext         = nullptr;
+            timestampInfos[0].timeDomain    = VK_TIME_DOMAIN_DEVICE_EXT;
+            timestampInfos[1].sType         = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestampInfos[1].pNext         = nullptr;
+            timestampInfos[1].timeDomain    = hostTimeDomain_;
+        }
+        std::uint64_t timestamps[2] = {};
+        std::uint64_t maxDeviation  = 0;
+        VkResult result = vkGetCalibratedTimestampsEXT(device_, 2, timestampInfos, timestamps, &maxDeviation);
+        if (result != VK_SUCCESS)
+            return false;
+
+        /* Device timestamps are in ticks of 'timestampPeriod' nanoseconds */
+        outCalibration.gpuTimestamp = timestamps[0];
+        outCalibration.gpuFrequency = static_cast<std::uint64_t>(1.0e9 / static_cast<double>(timestampPeriod_) + 0.5);
+        outCalibration.cpuTicks     = timestamps[1];
+        outCalibration.maxDeviation = maxDeviation;
+        return true;
+    }
+    #endif // /VK_EXT_calibrated_timestamps
+    return false;
+}
+
 /* ----- Fences ----- */
 
 void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
     fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    FlushPendingTransfers();
+
+    #ifdef VK_KHR_timeline_semaphore
+    if (fenceVK.IsTimeline())
+    {
+        /* Signal next value of timeline semaphore with an empty submission */
+        const std::uint64_t signalValue = fenceVK.NextSignalValue();
+        const VkSemaphore   semaphore   = fenceVK.GetVkSemaphore();
+
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = 0;
+            timelineInfo.pWaitSemaphoreValues       = nullptr;
+            timelineInfo.signalSemaphoreValueCount  = 1;
+            timelineInfo.pSignalSemaphoreValues     = &signalValue;
+        }
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = &timelineInfo;
+            submitInfo.waitSemaphoreCount   = 0;
+            submitInfo.pWaitSemaphores      = nullptr;
+            submitInfo.pWaitDstStageMask    = nullptr;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &semaphore;
+        }
+        VKQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+        return;
+    }
+    #endif // /VK_KHR_timeline_semaphore
+
+    VKQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+}
+
+void VKCommandQueue::SubmitWait(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+
+    #ifdef VK_KHR_timeline_semaphore
+    if (fenceVK.IsTimeline())
+    {
+        /* Wait on the GPU for the last signaled value of timeline semaphore with an empty submission */
+        const std::uint64_t         waitValue   = fenceVK.GetSignalValue();
+        const VkSemaphore           semaphore   = fenceVK.GetVkSemaphore();
+        const VkPipelineStageFlags  waitStage   = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = 1;
+            timelineInfo.pWaitSemaphoreValues       = &waitValue;
+            timelineInfo.signalSemaphoreValueCount  = 0;
+            timelineInfo.pSignalSemaphoreValues     = nullptr;
+        }
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = &timelineInfo;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = &semaphore;
+            submitInfo.pWaitDstStageMask    = &waitStage;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        VkResult result = VKQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit fence wait to Vulkan queue");
+        return;
+    }
+    #endif // /VK_KHR_timeline_semaphore
+
+    /* Binary fences cannot be waited on by the GPU, so block the CPU until the fence has been signaled */
+    fenceVK.Wait(device_, ~0ull);
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -115,7 +254,86 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
-    vkQueueWaitIdle(native_);
+    if (transferQueue_ != nullptr)
+        transferQueue_->WaitIdle();
+    VKQueueWaitIdle(native_);
+
+    /* All deferred releases are safe once the queue is idle */
+    if (deferredReleaseQueue_ != nullptr)
+        deferredReleaseQueue_->Flush();
+}
+
+/* ----- Sparse resources ----- */
+
+bool VKCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    if (!textureVK.IsSparse() || deviceMemoryMngr_ == nullptr)
+        return false;
+
+    /* Allocate or release tile memory and gather all memory binds */
+    std::vector<VkSparseImageMemoryBind> imageBinds;
+    std::vector<VkSparseMemoryBind> opaqueBinds;
+
+    for_range(i, numMappings)
+        textureVK.UpdateSparseTiles(*deviceMemoryMngr_, mappings[i], imageBinds, opaqueBinds);
+
+    VkSparseImageMemoryBindInfo imageBindInfo;
+    {
+        imageBindInfo.image     = textureVK.GetVkImage();
+        imageBindInfo.bindCount = static_cast<std::uint32_t>(imageBinds.size());
+        imageBindInfo.pBinds    = imageBinds.data();
+    }
+    VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+    {
+        opaqueBindInfo.image        = textureVK.GetVkImage();
+        opaqueBindInfo.bindCount    = static_cast<std::uint32_t>(opaqueBinds.size());
+        opaqueBindInfo.pBinds       = opaqueBinds.data();
+    }
+    VkBindSparseInfo bindInfo;
+    {
+        bindInfo.sType                  = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindInfo.pNext                  = nullptr;
+        bindInfo.waitSemaphoreCount     = 0;
+        bindInfo.pWaitSemaphores        = nullptr;
+        bindInfo.bufferBindCount        = 0;
+        bindInfo.pBufferBinds           = nullptr;
+        bindInfo.imageOpaqueBindCount   = (opaqueBinds.empty() ? 0u : 1u);
+        bindInfo.pImageOpaqueBinds      = &opaqueBindInfo;
+        bindInfo.imageBindCount         = (imageBinds.empty() ? 0u : 1u);
+        bindInfo.pImageBinds            = &imageBindInfo;
+        bindInfo.signalSemaphoreCount   = 0;
+        bindInfo.pSignalSemaphores      = nullptr;
+    }
+
+    if (bindInfo.imageOpaqueBindCount == 0 && bindInfo.imageBindCount == 0)
+        return true;
+
+    /* Create fence for sparse binding operations on first use */
+    if (sparseBindFence_.Get() == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device_, &createInfo, nullptr, sparseBindFence_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for sparse binding");
+    }
+    else
+        vkResetFences(device_, 1, sparseBindFence_.GetAddressOf());
+
+    /*
+    Sparse binding operations are not implicitly ordered with subsequent queue submissions,
+    so wait until the new tile mappings are in place before any command buffer can be submitted that accesses them.
+    */
+    VkResult result = VKQueueBindSparse(native_, 1, &bindInfo, sparseBindFence_);
+    VKThrowIfFailed(result, "failed to bind sparse memory to Vulkan image");
+
+    vkWaitForFences(device_, 1, sparseBindFence_.GetAddressOf(), VK_TRUE, UINT64_MAX);
+
+    return true;
 }
 
 
@@ -123,6 +341,12 @@ void VKCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void VKCommandQueue::FlushPendingTransfers()
+{
+    if (transferQueue_ != nullptr)
+        transferQueue_->FlushPendingAcquires();
+}
+
 VkResult VKCommandQueue::GetQueryResults(
     VKQueryHeap&    queryHeapVK,
     std::uint32_t   firstQuery,
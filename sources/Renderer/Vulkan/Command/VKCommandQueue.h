@@ -21,6 +21,9 @@ namespace LLGL
 
 
 class VKQueryHeap;
+class VKTransferQueue;
+class VKDeviceMemoryManager;
+class VKDeferredReleaseQueue;
 
 // Helper function to submit the specified Vulkan command buffer to a command queue.
 VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence);
@@ -34,7 +37,28 @@ class VKCommandQueue final : public CommandQueue
 
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        void SubmitWait(Fence& fence) override;
+
+        bool QueryTimestampCalibration(TimestampCalibration& outCalibration) override;
+
+        bool UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const SparseTextureMapping* mappings) override;
+
+    public:
+
+        VKCommandQueue(
+            VkDevice                device,
+            VkQueue                 queue,
+            VKTransferQueue*        transferQueue           = nullptr,
+            VKDeviceMemoryManager*  deviceMemoryMngr        = nullptr,
+            VKDeferredReleaseQueue* deferredReleaseQueue    = nullptr
+        );
+
+        #ifdef VK_EXT_calibrated_timestamps
+
+        // Enables timestamp calibration with the specified host time domain, which must match the clock of Timer::Tick.
+        void EnableTimestampCalibration(VkTimeDomainEXT hostTimeDomain, float timestampPeriod);
+
+        #endif // /VK_EXT_calibrated_timestamps
 
     private:
 
@@ -64,10 +88,22 @@ class VKCommandQueue final : public CommandQueue
             VkQueryResultFlags  flags
         );
 
+        // Submits pending queue ownership acquisitions of asynchronous uploads before the next submission.
+        void FlushPendingTransfers();
+
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        VkDevice                device_                 = VK_NULL_HANDLE;
+        VkQueue                 native_                 = VK_NULL_HANDLE;
+        VKTransferQueue*        transferQueue_          = nullptr;
+        VKDeviceMemoryManager*  deviceMemoryMngr_       = nullptr; // Memory pool for tiles of sparse textures
+        VKDeferredReleaseQueue* deferredReleaseQueue_   = nullptr;
+        VKPtr<VkFence>          sparseBindFence_;
+
+        #ifdef VK_EXT_calibrated_timestamps
+        VkTimeDomainEXT         hostTimeDomain_         = VK_TIME_DOMAIN_MAX_ENUM_EXT; // Host time domain for calibrated timestamps; MAX_ENUM if disabled
+        float                   timestampPeriod_        = 1.0f;
+        #endif
 
 };
 
@@ -0,0 +1,121 @@
+/*
+ * VKDeferredReleaseQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDeferredReleaseQueue.h"
+#include "../VKCore.h"
+
+
+namespace LLGL
+{
+
+
+VKDeferredReleaseQueue::FrameBatch::FrameBatch(VkDevice device) :
+    fence { device }
+{
+}
+
+VKDeferredReleaseQueue::VKDeferredReleaseQueue(VkDevice device, VkQueue queue) :
+    device_ { device },
+    queue_  { queue  }
+{
+}
+
+void VKDeferredReleaseQueue::Defer(std::function<void()>&& releaseCallback)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    currentCallbacks_.push_back(std::move(releaseCallback));
+}
+
+void VKDeferredReleaseQueue::NextFrame()
+{
+    std::vector<std::function<void()>> completedCallbacks;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+
+        if (!currentCallbacks_.empty())
+        {
+            /* Fence all work that has been submitted so far with an empty submission, since queue submissions complete in order */
+            FrameBatchPtr batch = AllocBatch();
+            VkResult result = VKQueueSubmit(queue_, 0, nullptr, batch->fence.GetVkFence());
+            VKThrowIfFailed(result, "failed to submit fence for deferred releases to Vulkan graphics queue");
+
+            batch->releaseCallbacks = std::move(currentCallbacks_);
+            currentCallbacks_.clear();
+            inFlightBatches_.push_back(std::move(batch));
+        }
+
+        TakeCompletedCallbacks(completedCallbacks);
+    }
+
+    /* Invoke callbacks outside the lock, since they release resources that might be deferred again */
+    for (const auto& callback : completedCallbacks)
+        callback();
+}
+
+void VKDeferredReleaseQueue::Flush()
+{
+    std::vector<std::function<void()>> remainingCallbacks;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+
+        for (FrameBatchPtr& batch : inFlightBatches_)
+        {
+            for (auto& callback : batch->releaseCallbacks)
+                remainingCallbacks.push_back(std::move(callback));
+        }
+        inFlightBatches_.clear();
+
+        for (auto& callback : currentCallbacks_)
+            remainingCallbacks.push_back(std::move(callback));
+        currentCallbacks_.clear();
+    }
+
+    for (const auto& callback : remainingCallbacks)
+        callback();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKDeferredReleaseQueue::FrameBatchPtr VKDeferredReleaseQueue::AllocBatch()
+{
+    if (freeBatches_.empty())
+        return FrameBatchPtr{ new FrameBatch{ device_ } };
+
+    FrameBatchPtr batch = std::move(freeBatches_.back());
+    freeBatches_.pop_back();
+    batch->fence.Reset(device_);
+    return batch;
+}
+
+void VKDeferredReleaseQueue::TakeCompletedCallbacks(std::vector<std::function<void()>>& outCallbacks)
+{
+    /* Batches complete in submission order, so stop polling at the first batch that is still in flight */
+    std::size_t numCompleted = 0;
+    for (; numCompleted < inFlightBatches_.size(); ++numCompleted)
+    {
+        FrameBatch& batch = *inFlightBatches_[numCompleted];
+        if (!batch.fence.Wait(device_, 0))
+            break;
+
+        for (auto& callback : batch.releaseCallbacks)
+            outCallbacks.push_back(std::move(callback));
+        batch.releaseCallbacks.clear();
+
+        freeBatches_.push_back(std::move(inFlightBatches_[numCompleted]));
+    }
+    inFlightBatches_.erase(inFlightBatches_.begin(), inFlightBatches_.begin() + numCompleted);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
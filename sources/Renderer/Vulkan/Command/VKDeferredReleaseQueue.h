@@ -0,0 +1,89 @@
+/*
+ * VKDeferredReleaseQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DEFERRED_RELEASE_QUEUE_H
+#define LLGL_VK_DEFERRED_RELEASE_QUEUE_H
+
+
+#include "../Vulkan.h"
+#include "../RenderState/VKFence.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Queue of release callbacks that are deferred until the GPU has finished all work that was submitted before they were queued.
+All callbacks that are queued between two frames are grouped into one batch, which is fenced with an empty submission
+to the graphics queue when the next frame begins. Completed batches are only polled and never waited on, except for Flush.
+Callbacks can be deferred from any thread; they are always invoked without holding the internal lock.
+*/
+class VKDeferredReleaseQueue
+{
+
+    public:
+
+        VKDeferredReleaseQueue(VkDevice device, VkQueue queue);
+
+        VKDeferredReleaseQueue(const VKDeferredReleaseQueue&) = delete;
+        VKDeferredReleaseQueue& operator = (const VKDeferredReleaseQueue&) = delete;
+
+        // Queues the specified release callback for the current frame.
+        void Defer(std::function<void()>&& releaseCallback);
+
+        // Fences all callbacks of the current frame and invokes the callbacks of all previous frames that have completed on the GPU.
+        void NextFrame();
+
+        // Invokes all remaining callbacks. The GPU must be idle, e.g. after vkQueueWaitIdle.
+        void Flush();
+
+    private:
+
+        struct FrameBatch
+        {
+            FrameBatch(VkDevice device);
+
+            VKFence                             fence;
+            std::vector<std::function<void()>>  releaseCallbacks;
+        };
+
+        using FrameBatchPtr = std::unique_ptr<FrameBatch>;
+
+    private:
+
+        // Returns a batch with an unsignaled fence, either recycled or newly created.
+        FrameBatchPtr AllocBatch();
+
+        // Moves the callbacks of all leading batches whose fences have been signaled into the output container.
+        void TakeCompletedCallbacks(std::vector<std::function<void()>>& outCallbacks);
+
+    private:
+
+        VkDevice                            device_             = VK_NULL_HANDLE;
+        VkQueue                             queue_              = VK_NULL_HANDLE;
+
+        std::vector<std::function<void()>>  currentCallbacks_;
+        std::vector<FrameBatchPtr>          inFlightBatches_;   // Batches in submission order
+        std::vector<FrameBatchPtr>          freeBatches_;
+        std::mutex                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,461 @@
+/*
+ * VKTransferQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKTransferQueue.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKInitializers.h"
+#include "../Buffer/VKBuffer.h"
+#include "../Texture/VKTexture.h"
+#include "../Texture/VKImageUtils.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/TextureFlags.h>
+#include <algorithm>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+static void CreateVkSemaphore(VkDevice device, VKPtr<VkSemaphore>& outSemaphore)
+{
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, outSemaphore.ReleaseAndGetAddressOf());
+    VKThrowIfCreateFailed(result, "VkSemaphore");
+}
+
+static void RecordBufferBarrier(
+    VkCommandBuffer                 commandBuffer,
+    VkPipelineStageFlags            srcStageMask,
+    VkPipelineStageFlags            dstStageMask,
+    const VkBufferMemoryBarrier&    barrier)
+{
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+}
+
+static void RecordImageBarrier(
+    VkCommandBuffer                 commandBuffer,
+    VkPipelineStageFlags            srcStageMask,
+    VkPipelineStageFlags            dstStageMask,
+    const VkImageMemoryBarrier&     barrier)
+{
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+VKTransferQueue::Upload::Upload(VkDevice device) :
+    releaseSemaphore  { device, vkDestroySemaphore },
+    transferSemaphore { device, vkDestroySemaphore },
+    stagingBuffer     { device                     }
+{
+}
+
+VKTransferQueue::AcquireBatch::AcquireBatch(VkDevice device) :
+    fence { device }
+{
+}
+
+VKTransferQueue::VKTransferQueue(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr) :
+    device_              { device                                        },
+    deviceMemoryMngr_    { deviceMemoryMngr                              },
+    graphicsFamily_      { device.GetQueueFamilyIndices().graphicsFamily },
+    transferFamily_      { device.GetTransferQueueFamily()               },
+    concurrentSharing_   { !device.GetSharedQueueFamilies().empty()      },
+    transferCommandPool_ { device, vkDestroyCommandPool                  }
+{
+    LLGL_ASSERT(device.GetVkTransferQueue() != VK_NULL_HANDLE, "cannot create transfer queue without dedicated Vulkan transfer queue family");
+
+    /* Resources in concurrent sharing mode must not be transferred between queue families */
+    if (concurrentSharing_)
+    {
+        graphicsFamily_ = VK_QUEUE_FAMILY_IGNORED;
+        transferFamily_ = VK_QUEUE_FAMILY_IGNORED;
+    }
+
+    /* Create command pool for the transfer queue family */
+    VkCommandPoolCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        createInfo.queueFamilyIndex = device.GetTransferQueueFamily();
+    }
+    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, transferCommandPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan command pool for transfer queue");
+}
+
+VKTransferQueue::~VKTransferQueue()
+{
+    WaitIdle();
+}
+
+void VKTransferQueue::WriteBuffer(VKBuffer& buffer, VkDeviceSize offset, const void* data, VkDeviceSize dataSize)
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    UploadPtr upload = BeginUpload(buffer.GetVkBuffer(), VK_NULL_HANDLE, data, dataSize);
+
+    VkBufferMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask       = 0;
+        barrier.srcQueueFamilyIndex = graphicsFamily_;
+        barrier.dstQueueFamilyIndex = transferFamily_;
+        barrier.buffer              = buffer.GetVkBuffer();
+        barrier.offset              = offset;
+        barrier.size                = dataSize;
+    }
+
+    /* Release buffer range from graphics queue */
+    RecordBufferBarrier(upload->releaseCommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, barrier);
+
+    /* Acquire buffer range on transfer queue */
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    RecordBufferBarrier(upload->transferCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, barrier);
+
+    /* Copy staging buffer into destination buffer */
+    VkBufferCopy region;
+    {
+        region.srcOffset    = 0;
+        region.dstOffset    = offset;
+        region.size         = dataSize;
+    }
+    vkCmdCopyBuffer(upload->transferCommandBuffer, upload->stagingBuffer.GetVkBuffer(), buffer.GetVkBuffer(), 1, &region);
+
+    /* Release buffer range from transfer queue back to graphics queue */
+    barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask       = 0;
+    barrier.srcQueueFamilyIndex = transferFamily_;
+    barrier.dstQueueFamilyIndex = graphicsFamily_;
+    RecordBufferBarrier(upload->transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, barrier);
+
+    /* Defer acquire operation on graphics queue until the next submission */
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = buffer.GetAccessFlags();
+    pendingBufferAcquires_.push_back(barrier);
+
+    SubmitUpload(std::move(upload));
+}
+
+void VKTransferQueue::WriteTexture(
+    VKTexture&                  texture,
+    const VkOffset3D&           offset,
+    const VkExtent3D&           extent,
+    const TextureSubresource&   subresource,
+    const void*                 data,
+    VkDeviceSize                dataSize)
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    const VkImageLayout layout = texture.GetVkImageLayout();
+    LLGL_ASSERT(layout != VK_IMAGE_LAYOUT_UNDEFINED, "cannot upload texture with undefined image layout on transfer queue");
+
+    UploadPtr upload = BeginUpload(VK_NULL_HANDLE, texture.GetVkImage(), data, dataSize);
+
+    const VkImageAspectFlags aspectMask = VKImageUtils::GetInclusiveVkImageAspect(texture.GetVkFormat());
+
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask                   = 0;
+        barrier.oldLayout                       = layout;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex             = graphicsFamily_;
+        barrier.dstQueueFamilyIndex             = transferFamily_;
+        barrier.image                           = texture.GetVkImage();
+        barrier.subresourceRange.aspectMask     = aspectMask;
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+        barrier.subresourceRange.levelCount     = subresource.numMipLevels;
+        barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+    }
+
+    /* Release image subresource from graphics queue and transition it into transfer destination layout */
+    RecordImageBarrier(upload->releaseCommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, barrier);
+
+    /* Acquire image subresource on transfer queue with the same layout transition; without ownership transfer, the layout has already been transitioned */
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    if (concurrentSharing_)
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    RecordImageBarrier(upload->transferCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, barrier);
+
+    /* Copy staging buffer into destination image */
+    VkBufferImageCopy region;
+    {
+        region.bufferOffset                     = 0;
+        region.bufferRowLength                  = 0;
+        region.bufferImageHeight                = 0;
+        region.imageSubresource.aspectMask      = aspectMask;
+        region.imageSubresource.mipLevel        = subresource.baseMipLevel;
+        region.imageSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        region.imageSubresource.layerCount      = subresource.numArrayLayers;
+        region.imageOffset                      = offset;
+        region.imageExtent                      = extent;
+    }
+    vkCmdCopyBufferToImage(
+        upload->transferCommandBuffer,
+        upload->stagingBuffer.GetVkBuffer(),
+        texture.GetVkImage(),
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        1,
+        &region
+    );
+
+    /* Release image subresource from transfer queue and transition it back into its previous layout */
+    barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask       = 0;
+    barrier.oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout           = layout;
+    barrier.srcQueueFamilyIndex = transferFamily_;
+    barrier.dstQueueFamilyIndex = graphicsFamily_;
+    RecordImageBarrier(upload->transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, barrier);
+
+    /* Defer acquire operation on graphics queue until the next submission; without ownership transfer, the layout has already been transitioned */
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    if (concurrentSharing_)
+        barrier.oldLayout = layout;
+    pendingImageAcquires_.push_back(barrier);
+
+    SubmitUpload(std::move(upload));
+}
+
+void VKTransferQueue::FlushPendingAcquires()
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    if (pendingUploads_.empty())
+        return;
+
+    AcquireBatchPtr batch = MakeUnique<AcquireBatch>(device_);
+
+    /* Record all pending acquire operations into a single pipeline barrier */
+    batch->commandBuffer = device_.AllocCommandBuffer();
+    vkCmdPipelineBarrier(
+        batch->commandBuffer,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, // VkDependencyFlags
+        0,
+        nullptr,
+        static_cast<std::uint32_t>(pendingBufferAcquires_.size()),
+        pendingBufferAcquires_.data(),
+        static_cast<std::uint32_t>(pendingImageAcquires_.size()),
+        pendingImageAcquires_.data()
+    );
+    VkResult result = vkEndCommandBuffer(batch->commandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for queue ownership acquisition");
+
+    /* Wait for all pending uploads on the graphics queue */
+    std::vector<VkSemaphore>            waitSemaphores;
+    std::vector<VkPipelineStageFlags>   waitStages;
+
+    waitSemaphores.reserve(pendingUploads_.size());
+    for (const UploadPtr& upload : pendingUploads_)
+        waitSemaphores.push_back(upload->transferSemaphore.Get());
+    waitStages.resize(waitSemaphores.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores.size());
+        submitInfo.pWaitSemaphores      = waitSemaphores.data();
+        submitInfo.pWaitDstStageMask    = waitStages.data();
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = &(batch->commandBuffer);
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    batch->fence.Reset(device_);
+    result = VKQueueSubmit(device_.GetVkQueue(), 1, &submitInfo, batch->fence.GetVkFence());
+    VKThrowIfFailed(result, "failed to submit queue ownership acquisition to Vulkan graphics queue");
+
+    /* Keep uploads alive until the batch has completed */
+    batch->uploads = std::move(pendingUploads_);
+    pendingUploads_.clear();
+    pendingBufferAcquires_.clear();
+    pendingImageAcquires_.clear();
+
+    inFlightBatches_.push_back(std::move(batch));
+}
+
+void VKTransferQueue::WaitIdle()
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    FlushPendingAcquires();
+    ReleaseCompletedBatches(true);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKTransferQueue::UploadPtr VKTransferQueue::BeginUpload(VkBuffer dstBuffer, VkImage dstImage, const void* data, VkDeviceSize dataSize)
+{
+    ReleaseCompletedBatches(false);
+
+    /* Resources that are still in transit must be acquired by the graphics queue before they can be released again */
+    auto it = std::find_if(
+        pendingUploads_.begin(),
+        pendingUploads_.end(),
+        [dstBuffer, dstImage](const UploadPtr& upload) -> bool
+        {
+            return ((dstBuffer != VK_NULL_HANDLE && upload->dstBuffer == dstBuffer) || (dstImage != VK_NULL_HANDLE && upload->dstImage == dstImage));
+        }
+    );
+    if (it != pendingUploads_.end())
+        FlushPendingAcquires();
+
+    UploadPtr upload = MakeUnique<Upload>(device_);
+    {
+        upload->dstBuffer = dstBuffer;
+        upload->dstImage  = dstImage;
+    }
+
+    /* Create and initialize staging buffer */
+    VkBufferCreateInfo stagingCreateInfo;
+    BuildVkBufferCreateInfo(stagingCreateInfo, dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    upload->stagingBuffer = VKDeviceBuffer
+    {
+        device_,
+        stagingCreateInfo,
+        deviceMemoryMngr_,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    };
+    device_.WriteBuffer(upload->stagingBuffer, data, dataSize);
+
+    /* Begin command buffers for both queues */
+    upload->releaseCommandBuffer    = device_.AllocCommandBuffer();
+    upload->transferCommandBuffer   = AllocTransferCommandBuffer();
+
+    CreateVkSemaphore(device_, upload->releaseSemaphore);
+    CreateVkSemaphore(device_, upload->transferSemaphore);
+
+    return upload;
+}
+
+void VKTransferQueue::SubmitUpload(UploadPtr&& upload)
+{
+    VkResult result = vkEndCommandBuffer(upload->releaseCommandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for queue ownership release");
+
+    result = vkEndCommandBuffer(upload->transferCommandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for transfer queue");
+
+    /* Submit release operation to graphics queue */
+    VkSemaphore releaseSemaphore = upload->releaseSemaphore.Get();
+
+    VkSubmitInfo releaseSubmitInfo;
+    {
+        releaseSubmitInfo.sType                 = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        releaseSubmitInfo.pNext                 = nullptr;
+        releaseSubmitInfo.waitSemaphoreCount    = 0;
+        releaseSubmitInfo.pWaitSemaphores       = nullptr;
+        releaseSubmitInfo.pWaitDstStageMask     = nullptr;
+        releaseSubmitInfo.commandBufferCount    = 1;
+        releaseSubmitInfo.pCommandBuffers       = &(upload->releaseCommandBuffer);
+        releaseSubmitInfo.signalSemaphoreCount  = 1;
+        releaseSubmitInfo.pSignalSemaphores     = &releaseSemaphore;
+    }
+    result = VKQueueSubmit(device_.GetVkQueue(), 1, &releaseSubmitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit queue ownership release to Vulkan graphics queue");
+
+    /* Submit copy command to transfer queue once the graphics queue has released the resource */
+    const VkPipelineStageFlags  waitStage           = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSemaphore                 transferSemaphore   = upload->transferSemaphore.Get();
+
+    VkSubmitInfo transferSubmitInfo;
+    {
+        transferSubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        transferSubmitInfo.pNext                = nullptr;
+        transferSubmitInfo.waitSemaphoreCount   = 1;
+        transferSubmitInfo.pWaitSemaphores      = &releaseSemaphore;
+        transferSubmitInfo.pWaitDstStageMask    = &waitStage;
+        transferSubmitInfo.commandBufferCount   = 1;
+        transferSubmitInfo.pCommandBuffers      = &(upload->transferCommandBuffer);
+        transferSubmitInfo.signalSemaphoreCount = 1;
+        transferSubmitInfo.pSignalSemaphores    = &transferSemaphore;
+    }
+    result = VKQueueSubmit(device_.GetVkTransferQueue(), 1, &transferSubmitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan transfer queue");
+
+    pendingUploads_.push_back(std::move(upload));
+}
+
+void VKTransferQueue::ReleaseCompletedBatches(bool wait)
+{
+    for (auto it = inFlightBatches_.begin(); it != inFlightBatches_.end();)
+    {
+        AcquireBatch& batch = **it;
+        if (batch.fence.Wait(device_, (wait ? UINT64_MAX : 0)))
+        {
+            /* Fence also guarantees completion of the earlier release submissions and, via the semaphores, of all transfer submissions */
+            for (UploadPtr& upload : batch.uploads)
+            {
+                vkFreeCommandBuffers(device_, device_.GetVkCommandPool(), 1, &(upload->releaseCommandBuffer));
+                vkFreeCommandBuffers(device_, transferCommandPool_, 1, &(upload->transferCommandBuffer));
+                upload->stagingBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+            }
+            vkFreeCommandBuffers(device_, device_.GetVkCommandPool(), 1, &(batch.commandBuffer));
+            it = inFlightBatches_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+VkCommandBuffer VKTransferQueue::AllocTransferCommandBuffer()
+{
+    VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
+
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                = nullptr;
+        allocInfo.commandPool          = transferCommandPool_;
+        allocInfo.level                = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount   = 1;
+    }
+    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, &cmdBuffer);
+    VKThrowIfFailed(result, "failed to allocate Vulkan command buffer for transfer queue");
+
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    result = vkBeginCommandBuffer(cmdBuffer, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer for transfer queue");
+
+    return cmdBuffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,135 @@
+/*
+ * VKTransferQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_TRANSFER_QUEUE_H
+#define LLGL_VK_TRANSFER_QUEUE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include "../RenderState/VKFence.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKBuffer;
+class VKTexture;
+class VKDeviceMemoryManager;
+struct TextureSubresource;
+
+/*
+Asynchronous upload queue on a dedicated transfer queue family.
+Each upload is recorded and submitted to the transfer queue without waiting for its completion.
+Since resources are created with exclusive sharing mode, each upload performs a queue family ownership transfer:
+the graphics queue releases the destination region to the transfer queue, which acquires it, records the copy command, and releases it back.
+The final acquire operations on the graphics queue are deferred until the next submission to the graphics queue, i.e. the first use of the resource.
+If resources are created with concurrent sharing mode (see VKDevice::GetSharedQueueFamilies), the same barriers are recorded without ownership transfers.
+All public functions are thread-safe; they lock the command pool mutex of the device since acquire operations are recorded into its command pool.
+*/
+class VKTransferQueue
+{
+
+    public:
+
+        VKTransferQueue(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr);
+        ~VKTransferQueue();
+
+        VKTransferQueue(const VKTransferQueue&) = delete;
+        VKTransferQueue& operator = (const VKTransferQueue&) = delete;
+
+        // Uploads the specified data into the buffer range without waiting for completion.
+        void WriteBuffer(VKBuffer& buffer, VkDeviceSize offset, const void* data, VkDeviceSize dataSize);
+
+        // Uploads the specified image data into the texture region without waiting for completion. The texture must not be in undefined layout.
+        void WriteTexture(
+            VKTexture&                  texture,
+            const VkOffset3D&           offset,
+            const VkExtent3D&           extent,
+            const TextureSubresource&   subresource,
+            const void*                 data,
+            VkDeviceSize                dataSize
+        );
+
+        // Submits the ownership acquire operations of all pending uploads to the graphics queue. Must be called before any other graphics queue submission.
+        void FlushPendingAcquires();
+
+        // Flushes all pending acquire operations and blocks until all uploads have completed.
+        void WaitIdle();
+
+    private:
+
+        struct Upload
+        {
+            Upload(VkDevice device);
+
+            VkBuffer                dstBuffer               = VK_NULL_HANDLE;
+            VkImage                 dstImage                = VK_NULL_HANDLE;
+            VkCommandBuffer         releaseCommandBuffer    = VK_NULL_HANDLE;   // Graphics queue command buffer that releases ownership to the transfer queue.
+            VkCommandBuffer         transferCommandBuffer   = VK_NULL_HANDLE;   // Transfer queue command buffer that records the copy command.
+            VKPtr<VkSemaphore>      releaseSemaphore;
+            VKPtr<VkSemaphore>      transferSemaphore;
+            VKDeviceBuffer          stagingBuffer;
+        };
+
+        using UploadPtr = std::unique_ptr<Upload>;
+
+        struct AcquireBatch
+        {
+            AcquireBatch(VkDevice device);
+
+            VkCommandBuffer         commandBuffer   = VK_NULL_HANDLE;
+            VKFence                 fence;
+            std::vector<UploadPtr>  uploads;
+        };
+
+        using AcquireBatchPtr = std::unique_ptr<AcquireBatch>;
+
+    private:
+
+        // Creates a new upload with initialized staging buffer and flushes pending acquires if the specified resource is still in transit.
+        UploadPtr BeginUpload(VkBuffer dstBuffer, VkImage dstImage, const void* data, VkDeviceSize dataSize);
+
+        // Submits the release and transfer command buffers of the specified upload and stores its acquire barrier.
+        void SubmitUpload(UploadPtr&& upload);
+
+        // Releases all acquire batches that have completed. Blocks until all of them have completed if 'wait' is true.
+        void ReleaseCompletedBatches(bool wait);
+
+        VkCommandBuffer AllocTransferCommandBuffer();
+
+    private:
+
+        VKDevice&                               device_;
+        VKDeviceMemoryManager&                  deviceMemoryMngr_;
+
+        std::uint32_t                           graphicsFamily_     = 0;
+        std::uint32_t                           transferFamily_     = 0;
+        bool                                    concurrentSharing_  = false;    // Resources are shared between queue families, so barriers don't transfer ownership.
+        VKPtr<VkCommandPool>                    transferCommandPool_;
+
+        std::vector<UploadPtr>                  pendingUploads_;    // Uploads whose acquire operation has not been submitted yet.
+        std::vector<VkBufferMemoryBarrier>      pendingBufferAcquires_;
+        std::vector<VkImageMemoryBarrier>       pendingImageAcquires_;
+        std::vector<AcquireBatchPtr>            inFlightBatches_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
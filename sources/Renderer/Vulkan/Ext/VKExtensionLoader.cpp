@@ -95,6 +95,16 @@ static bool DECL_LOADVKEXT_PROC(EXT_transform_feedback)
     return true;
 }
 
+#ifdef VK_EXT_pageable_device_local_memory
+
+static bool DECL_LOADVKEXT_PROC(EXT_pageable_device_local_memory)
+{
+    LOAD_VKPROC( vkSetDeviceMemoryPriorityEXT );
+    return true;
+}
+
+#endif // /VK_EXT_pageable_device_local_memory
+
 static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
 {
     LOAD_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -107,6 +117,132 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
     return true;
 }
 
+#ifdef VK_KHR_get_memory_requirements2
+
+static bool DECL_LOADVKEXT_PROC(KHR_get_memory_requirements2)
+{
+    LOAD_VKPROC( vkGetImageMemoryRequirements2KHR );
+    return true;
+}
+
+#endif // /VK_KHR_get_memory_requirements2
+
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    LOAD_VKPROC( vkSignalSemaphoreKHR          );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_draw_indirect_count)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR        );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+    return true;
+}
+
+#ifdef VK_KHR_present_wait
+
+static bool DECL_LOADVKEXT_PROC(KHR_present_wait)
+{
+    LOAD_VKPROC( vkWaitForPresentKHR );
+    return true;
+}
+
+#endif // /VK_KHR_present_wait
+
+#ifdef VK_KHR_push_descriptor
+
+static bool DECL_LOADVKEXT_PROC(KHR_push_descriptor)
+{
+    LOAD_VKPROC( vkCmdPushDescriptorSetKHR );
+    return true;
+}
+
+#endif // /VK_KHR_push_descriptor
+
+#ifdef VK_KHR_dynamic_rendering
+
+static bool DECL_LOADVKEXT_PROC(KHR_dynamic_rendering)
+{
+    LOAD_VKPROC( vkCmdBeginRenderingKHR );
+    LOAD_VKPROC( vkCmdEndRenderingKHR   );
+    return true;
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
+#ifdef VK_KHR_fragment_shading_rate
+
+static bool DECL_LOADVKEXT_PROC(KHR_fragment_shading_rate)
+{
+    LOAD_VKPROC( vkCmdSetFragmentShadingRateKHR );
+    return true;
+}
+
+#endif // /VK_KHR_fragment_shading_rate
+
+#ifdef VK_EXT_multi_draw
+
+static bool DECL_LOADVKEXT_PROC(EXT_multi_draw)
+{
+    LOAD_VKPROC( vkCmdDrawMultiEXT        );
+    LOAD_VKPROC( vkCmdDrawMultiIndexedEXT );
+    return true;
+}
+
+#endif // /VK_EXT_multi_draw
+
+#ifdef VK_EXT_mesh_shader
+
+static bool DECL_LOADVKEXT_PROC(EXT_mesh_shader)
+{
+    LOAD_VKPROC( vkCmdDrawMeshTasksEXT              );
+    LOAD_VKPROC( vkCmdDrawMeshTasksIndirectEXT      );
+    LOAD_VKPROC( vkCmdDrawMeshTasksIndirectCountEXT );
+    return true;
+}
+
+#endif // /VK_EXT_mesh_shader
+
+#ifdef VK_EXT_extended_dynamic_state
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state)
+{
+    LOAD_VKPROC( vkCmdSetCullModeEXT            );
+    LOAD_VKPROC( vkCmdSetPrimitiveTopologyEXT   );
+    LOAD_VKPROC( vkCmdSetDepthTestEnableEXT     );
+    LOAD_VKPROC( vkCmdSetDepthWriteEnableEXT    );
+    LOAD_VKPROC( vkCmdSetDepthCompareOpEXT      );
+    LOAD_VKPROC( vkCmdSetStencilTestEnableEXT   );
+    LOAD_VKPROC( vkCmdSetStencilOpEXT           );
+    return true;
+}
+
+#endif // /VK_EXT_extended_dynamic_state
+
+#ifdef VK_EXT_host_image_copy
+
+static bool DECL_LOADVKEXT_PROC(EXT_host_image_copy)
+{
+    LOAD_VKPROC( vkCopyMemoryToImageEXT     );
+    LOAD_VKPROC( vkTransitionImageLayoutEXT );
+    return true;
+}
+
+#endif // /VK_EXT_host_image_copy
+
+#ifdef VK_EXT_calibrated_timestamps
+
+static bool DECL_LOADVKEXT_PROC(EXT_calibrated_timestamps)
+{
+    LOAD_VKPROC( vkGetCalibratedTimestampsEXT );
+    return true;
+}
+
+#endif // /VK_EXT_calibrated_timestamps
+
 #undef DECL_LOADVKEXT_PROC_BASE
 #undef DECL_LOADVKEXT_PROC_INSTANCE
 #undef DECL_LOADVKEXT_PROC
@@ -177,12 +313,58 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
 
     /* Multi-vendor extensions */
     LOAD_VKEXT( KHR_get_physical_device_properties2 );
+    LOAD_VKEXT( KHR_timeline_semaphore              );
+    LOAD_VKEXT( KHR_draw_indirect_count             );
     LOAD_VKEXT( EXT_debug_marker                    );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    #ifdef VK_EXT_pageable_device_local_memory
+    LOAD_VKEXT( EXT_pageable_device_local_memory    );
+    #endif
+    #ifdef VK_KHR_get_memory_requirements2
+    LOAD_VKEXT( KHR_get_memory_requirements2        );
+    #endif
+    #ifdef VK_KHR_present_wait
+    LOAD_VKEXT( KHR_present_wait                    );
+    #endif
+    #ifdef VK_KHR_push_descriptor
+    LOAD_VKEXT( KHR_push_descriptor                 );
+    #endif
+    #ifdef VK_KHR_dynamic_rendering
+    LOAD_VKEXT( KHR_dynamic_rendering               );
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    LOAD_VKEXT( KHR_fragment_shading_rate           );
+    #endif
+    #ifdef VK_EXT_multi_draw
+    LOAD_VKEXT( EXT_multi_draw                      );
+    #endif
+    #ifdef VK_EXT_mesh_shader
+    LOAD_VKEXT( EXT_mesh_shader                     );
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state
+    LOAD_VKEXT( EXT_extended_dynamic_state          );
+    #endif
+    #ifdef VK_EXT_host_image_copy
+    LOAD_VKEXT( EXT_host_image_copy                 );
+    #endif
+    #ifdef VK_EXT_calibrated_timestamps
+    LOAD_VKEXT( EXT_calibrated_timestamps           );
+    #endif
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
     ENABLE_VKEXT( EXT_nested_command_buffer      );
+    ENABLE_VKEXT( KHR_maintenance3               );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
+    ENABLE_VKEXT( KHR_pipeline_library           );
+    ENABLE_VKEXT( EXT_graphics_pipeline_library  );
+    ENABLE_VKEXT( EXT_memory_budget              );
+    ENABLE_VKEXT( EXT_memory_priority            );
+    ENABLE_VKEXT( KHR_present_id                 );
+    ENABLE_VKEXT( KHR_incremental_present        );
+    ENABLE_VKEXT( KHR_dedicated_allocation       );
+    ENABLE_VKEXT( KHR_copy_commands2             );
+    ENABLE_VKEXT( KHR_format_feature_flags2      );
 
     #undef LOAD_VKEXT
 
@@ -25,6 +25,54 @@ static const char* g_VKOptionalExtensions[] =
     #ifdef VK_KHR_get_physical_device_properties2
     VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
     #endif
+    #ifdef VK_KHR_timeline_semaphore
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_maintenance3
+    VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_pipeline_library
+    VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_draw_indirect_count
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_present_id
+    VK_KHR_PRESENT_ID_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_present_wait
+    VK_KHR_PRESENT_WAIT_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_incremental_present
+    VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_push_descriptor
+    VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_dynamic_rendering
+    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_get_memory_requirements2
+    VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_dedicated_allocation
+    VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_copy_commands2
+    VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_format_feature_flags2
+    VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_shader_float_controls
+    VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_spirv_1_4
+    VK_KHR_SPIRV_1_4_EXTENSION_NAME,
+    #endif
     #ifdef VK_EXT_debug_marker
     VK_EXT_DEBUG_MARKER_EXTENSION_NAME,
     #endif
@@ -40,6 +88,36 @@ static const char* g_VKOptionalExtensions[] =
     #ifdef VK_EXT_nested_command_buffer
     VK_EXT_NESTED_COMMAND_BUFFER_EXTENSION_NAME,
     #endif
+    #ifdef VK_EXT_descriptor_indexing
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_graphics_pipeline_library
+    VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_memory_priority
+    VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_pageable_device_local_memory
+    VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_multi_draw
+    VK_EXT_MULTI_DRAW_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_mesh_shader
+    VK_EXT_MESH_SHADER_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state
+    VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_host_image_copy
+    VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_calibrated_timestamps
+    VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME,
+    #endif
     nullptr,
 };
 
@@ -58,7 +136,7 @@ const char** GetOptionalExtensions()
     return g_VKOptionalExtensions;
 }
 
-static bool IsVulkanInstanceExtRequired(const StringView& name)
+static bool IsVulkanInstanceExtSurfaceOnly(const StringView& name)
 {
     return
     (
@@ -91,8 +169,8 @@ static bool IsVulkanInstanceExtDebugOnly(const StringView& name)
 VKExtSupport GetVulkanInstanceExtensionSupport(const char* extensionName)
 {
     const StringView name = extensionName;
-    if (IsVulkanInstanceExtRequired(name))
-        return VKExtSupport::Required;
+    if (IsVulkanInstanceExtSurfaceOnly(name))
+        return VKExtSupport::SurfaceOnly;
     if (IsVulkanInstanceExtOptional(name))
         return VKExtSupport::Optional;
     if (IsVulkanInstanceExtDebugOnly(name))
@@ -23,6 +23,20 @@ enum class VKExt
     /* Khronos extensions */
     KHR_maintenance1,
     KHR_get_physical_device_properties2,
+    KHR_timeline_semaphore,
+    KHR_maintenance3,
+    KHR_pipeline_library,
+    KHR_draw_indirect_count,
+    KHR_present_id,
+    KHR_present_wait,
+    KHR_incremental_present,
+    KHR_push_descriptor,
+    KHR_dynamic_rendering,
+    KHR_get_memory_requirements2,
+    KHR_dedicated_allocation,
+    KHR_copy_commands2,
+    KHR_format_feature_flags2,
+    KHR_fragment_shading_rate,
 
     /* Multivendor extensions */
     EXT_debug_marker,
@@ -30,6 +44,16 @@ enum class VKExt
     EXT_transform_feedback,
     EXT_conservative_rasterization,
     EXT_nested_command_buffer,
+    EXT_descriptor_indexing,
+    EXT_graphics_pipeline_library,
+    EXT_memory_budget,
+    EXT_memory_priority,
+    EXT_pageable_device_local_memory,
+    EXT_multi_draw,
+    EXT_mesh_shader,
+    EXT_extended_dynamic_state,
+    EXT_host_image_copy,
+    EXT_calibrated_timestamps,
 
     /* Enumeration entry counter */
     Count,
@@ -41,6 +65,7 @@ enum class VKExtSupport
     Unsupported,    // Vulkan extension is unsupported and will not be loaded.
     Optional,       // Vulkan extension is supported but optional.
     DebugOnly,      // Vulkan extension is supported but only used for debugging.
+    SurfaceOnly,    // Vulkan extension is supported but only used for presentation, i.e. not for headless render systems.
     Required,       // Vulkan extension is supported and required.
 };
 
@@ -61,6 +61,12 @@ DECL_VKPROC( vkCmdBeginQueryIndexedEXT            );
 DECL_VKPROC( vkCmdEndQueryIndexedEXT              );
 DECL_VKPROC( vkCmdDrawIndirectByteCountEXT        );
 
+/* VK_EXT_pageable_device_local_memory */
+
+#ifdef VK_EXT_pageable_device_local_memory
+DECL_VKPROC( vkSetDeviceMemoryPriorityEXT );
+#endif
+
 /* VK_KHR_get_physical_device_properties2 */
 
 DECL_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -71,6 +77,89 @@ DECL_VKPROC( vkGetPhysicalDeviceQueueFamilyProperties2KHR       );
 DECL_VKPROC( vkGetPhysicalDeviceMemoryProperties2KHR            );
 DECL_VKPROC( vkGetPhysicalDeviceSparseImageFormatProperties2KHR );
 
+/* VK_KHR_get_memory_requirements2 */
+
+#ifdef VK_KHR_get_memory_requirements2
+DECL_VKPROC( vkGetImageMemoryRequirements2KHR );
+#endif
+
+/* VK_KHR_timeline_semaphore */
+
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+DECL_VKPROC( vkSignalSemaphoreKHR          );
+
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR        );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+
+/* VK_KHR_present_wait */
+
+#ifdef VK_KHR_present_wait
+DECL_VKPROC( vkWaitForPresentKHR );
+#endif
+
+/* VK_KHR_push_descriptor */
+
+#ifdef VK_KHR_push_descriptor
+DECL_VKPROC( vkCmdPushDescriptorSetKHR );
+#endif
+
+/* VK_KHR_dynamic_rendering */
+
+#ifdef VK_KHR_dynamic_rendering
+DECL_VKPROC( vkCmdBeginRenderingKHR );
+DECL_VKPROC( vkCmdEndRenderingKHR   );
+#endif
+
+/* VK_KHR_fragment_shading_rate */
+
+#ifdef VK_KHR_fragment_shading_rate
+DECL_VKPROC( vkCmdSetFragmentShadingRateKHR );
+#endif
+
+/* VK_EXT_multi_draw */
+
+#ifdef VK_EXT_multi_draw
+DECL_VKPROC( vkCmdDrawMultiEXT        );
+DECL_VKPROC( vkCmdDrawMultiIndexedEXT );
+#endif
+
+/* VK_EXT_mesh_shader */
+
+#ifdef VK_EXT_mesh_shader
+DECL_VKPROC( vkCmdDrawMeshTasksEXT              );
+DECL_VKPROC( vkCmdDrawMeshTasksIndirectEXT      );
+DECL_VKPROC( vkCmdDrawMeshTasksIndirectCountEXT );
+#endif
+
+/* VK_EXT_host_image_copy */
+
+#ifdef VK_EXT_host_image_copy
+DECL_VKPROC( vkCopyMemoryToImageEXT     );
+DECL_VKPROC( vkTransitionImageLayoutEXT );
+#endif
+
+/* VK_EXT_extended_dynamic_state */
+
+#ifdef VK_EXT_extended_dynamic_state
+DECL_VKPROC( vkCmdSetCullModeEXT            );
+DECL_VKPROC( vkCmdSetPrimitiveTopologyEXT   );
+DECL_VKPROC( vkCmdSetDepthTestEnableEXT     );
+DECL_VKPROC( vkCmdSetDepthWriteEnableEXT    );
+DECL_VKPROC( vkCmdSetDepthCompareOpEXT      );
+DECL_VKPROC( vkCmdSetStencilTestEnableEXT   );
+DECL_VKPROC( vkCmdSetStencilOpEXT           );
+#endif
+
+/* VK_EXT_calibrated_timestamps */
+
+#ifdef VK_EXT_calibrated_timestamps
+DECL_VKPROC( vkGetPhysicalDeviceCalibrateableTimeDomainsEXT );
+DECL_VKPROC( vkGetCalibratedTimestampsEXT                   );
+#endif
+
 #undef DECL_VKPROC
 
 
@@ -7,6 +7,8 @@
 
 #include "VKDeviceMemory.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../ContainerTypes.h"
 
 #include "../../../Core/Assertion.h"
@@ -16,46 +18,103 @@ namespace LLGL
 {
 
 
-VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
+VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex, bool useTLSF) :
+    device_          { device               },
     deviceMemory_    { device, vkFreeMemory },
     size_            { size                 },
     memoryTypeIndex_ { memoryTypeIndex      },
     maxNewBlockSize_ { size                 }
 {
+    /* Create TLSF allocator for this chunk if enabled */
+    if (useTLSF)
+    {
+        tlsf_ = MakeUnique<VKDeviceMemoryTLSF>(this, size, memoryTypeIndex);
+        maxNewBlockSize_ = 0;
+    }
+
     /* Allocate device memory */
-    VkMemoryAllocateInfo allocInfo;
+    AllocDeviceMemory(nullptr);
+}
+
+VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex, VkImage dedicatedImage, float priority) :
+    device_          { device               },
+    deviceMemory_    { device, vkFreeMemory },
+    size_            { size                 },
+    memoryTypeIndex_ { memoryTypeIndex      },
+    isDedicated_     { true                 },
+    maxNewBlockSize_ { size                 }
+{
+    const void* next = nullptr;
+
+    #ifdef VK_KHR_dedicated_allocation
+    VkMemoryDedicatedAllocateInfoKHR dedicatedInfo;
+    if (dedicatedImage != VK_NULL_HANDLE && HasExtension(VKExt::KHR_dedicated_allocation))
     {
-        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.pNext             = nullptr;
-        allocInfo.allocationSize    = size;
-        allocInfo.memoryTypeIndex   = memoryTypeIndex;
+        dedicatedInfo.sType     = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        dedicatedInfo.pNext     = next;
+        dedicatedInfo.image     = dedicatedImage;
+        dedicatedInfo.buffer    = VK_NULL_HANDLE;
+        next = &dedicatedInfo;
     }
-    VkResult result = vkAllocateMemory(device, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
+    #endif // /VK_KHR_dedicated_allocation
 
-    if (result != VK_SUCCESS)
+    #ifdef VK_EXT_memory_priority
+    VkMemoryPriorityAllocateInfoEXT priorityInfo;
+    if (priority >= 0.0f && priority <= 1.0f && HasExtension(VKExt::EXT_memory_priority))
     {
-        std::string info = "failed to allocate Vulkan device memory of " + std::to_string(size) + " bytes";
-        VKThrowIfFailed(result, info.c_str());
+        priorityInfo.sType      = VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT;
+        priorityInfo.pNext      = next;
+        priorityInfo.priority   = priority;
+        next = &priorityInfo;
     }
+    #endif // /VK_EXT_memory_priority
+
+    AllocDeviceMemory(next);
 }
 
-void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
+void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize /*size*/)
 {
-    void* data = nullptr;
+    std::lock_guard<std::mutex> guard{ mappingMutex_ };
 
-    VkResult result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    /* A VkDeviceMemory object can only be mapped once at a time, so map the entire chunk for the first mapping only */
+    if (mappingCounter_ == 0)
+    {
+        VkResult result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &mappedData_);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    }
+    ++mappingCounter_;
 
-    return data;
+    return static_cast<char*>(mappedData_) + offset;
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    std::lock_guard<std::mutex> guard{ mappingMutex_ };
+
+    if (mappingCounter_ > 0 && --mappingCounter_ == 0)
+    {
+        vkUnmapMemory(device, deviceMemory_);
+        mappedData_ = nullptr;
+    }
+}
+
+bool VKDeviceMemory::SetPriority(float priority)
+{
+    #ifdef VK_EXT_pageable_device_local_memory
+    if (HasExtension(VKExt::EXT_pageable_device_local_memory))
+    {
+        vkSetDeviceMemoryPriorityEXT(device_, deviceMemory_, priority);
+        return true;
+    }
+    #endif // /VK_EXT_pageable_device_local_memory
+    return false;
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
 {
+    if (tlsf_)
+        return tlsf_->Allocate(size, alignment);
+
     if (size > 0 && alignment > 0)
     {
         /* Adjust size and offset by alignment */
@@ -88,6 +147,12 @@ VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize a
 
 void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
+    if (tlsf_)
+    {
+        tlsf_->Release(region);
+        return;
+    }
+
     if (region)
     {
         /* Increase maximal size of fragmented blocks */
@@ -111,21 +176,50 @@ void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 
 bool VKDeviceMemory::IsEmpty() const
 {
+    if (tlsf_)
+        return tlsf_->IsEmpty();
     return blocks_.empty();
 }
 
 VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 {
+    if (tlsf_)
+        return tlsf_->GetMaxAllocationSize();
     return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
 }
 
+VkDeviceSize VKDeviceMemory::GetUsedSize() const
+{
+    if (tlsf_)
+        return size_ - tlsf_->GetFreeSize();
+
+    VkDeviceSize usedSize = 0;
+    for (const auto& block : blocks_)
+        usedSize += block->GetSize();
+    return usedSize;
+}
+
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
+    details.totalSize += size_;
+
+    if (tlsf_)
+    {
+        tlsf_->AccumDetails(details);
+        return;
+    }
+
+    VkDeviceSize fragmentedSize = 0;
+    for (const auto& block : fragmentedBlocks_)
+        fragmentedSize += block->GetSize();
+
     details.numChunks               += 1;
     details.numBlocks               += blocks_.size();
     details.numFragments            += fragmentedBlocks_.size();
     details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
     details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.freeSize                += maxNewBlockSize_ + fragmentedSize;
+    details.maxFreeBlockSize        = std::max(details.maxFreeBlockSize, GetMaxAllocationSize());
 }
 
 #ifdef LLGL_DEBUG
@@ -205,6 +299,24 @@ void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
  * ======= Private: =======
  */
 
+void VKDeviceMemory::AllocDeviceMemory(const void* next)
+{
+    VkMemoryAllocateInfo allocInfo;
+    {
+        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext             = next;
+        allocInfo.allocationSize    = size_;
+        allocInfo.memoryTypeIndex   = memoryTypeIndex_;
+    }
+    VkResult result = vkAllocateMemory(device_, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
+
+    if (result != VK_SUCCESS)
+    {
+        std::string info = "failed to allocate Vulkan device memory of " + std::to_string(size_) + " bytes";
+        VKThrowIfFailed(result, info.c_str());
+    }
+}
+
 VkDeviceSize VKDeviceMemory::GetNextOffset() const
 {
     if (blocks_.empty())
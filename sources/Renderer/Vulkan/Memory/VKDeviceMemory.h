@@ -10,11 +10,13 @@
 
 
 #include "VKDeviceMemoryRegion.h"
+#include "VKDeviceMemoryTLSF.h"
 #include "../VKPtr.h"
 #include <vulkan/vulkan.h>
 #include <cstdint>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #ifdef LLGL_DEBUG
 #   include <ostream>
@@ -33,6 +35,21 @@ struct VKDeviceMemoryDetails
     std::size_t     numFragments            = 0;
     VkDeviceSize    maxNewBlockSize         = 0;
     VkDeviceSize    maxFragmentedBlockSize  = 0;
+    VkDeviceSize    totalSize               = 0; // Accumulated size of all chunks.
+    VkDeviceSize    freeSize                = 0; // Accumulated size of all free memory, i.e. fragmented blocks and unused memory at the end of each chunk.
+    VkDeviceSize    maxFreeBlockSize        = 0; // Largest contiguous free memory block across all chunks.
+
+    /*
+    Returns the external fragmentation in the range [0, 1], i.e. 1 - (largest free block / total free memory).
+    A value of 0 means all free memory is contiguous; a value close to 1 means free memory is scattered across many small blocks.
+    */
+    inline float GetFragmentation() const
+    {
+        if (freeSize > 0)
+            return 1.0f - static_cast<float>(static_cast<double>(maxFreeBlockSize) / static_cast<double>(freeSize));
+        else
+            return 0.0f;
+    }
 };
 
 // An instance of this class holds a single VkDeviceMemory allocation chunk.
@@ -41,17 +58,32 @@ class VKDeviceMemory
 
     public:
 
-        VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+        VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex, bool useTLSF = false);
+
+        /*
+        Allocates a device memory chunk that is dedicated to the specified image (VK_KHR_dedicated_allocation).
+        If 'priority' is in the range [0, 1], the chunk is allocated with that priority (VK_EXT_memory_priority).
+        Dedicated chunks must not be used for any other allocation than the one for their image.
+        */
+        VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex, VkImage dedicatedImage, float priority);
 
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
+        VKDeviceMemory(VKDeviceMemory&&) = delete;
+        VKDeviceMemory& operator = (VKDeviceMemory&&) = delete;
 
+        /*
+        Maps the specified range of this device memory chunk into CPU memory space.
+        The entire chunk is mapped only once and reference counted, so different regions of the same chunk can be mapped from multiple threads.
+        Each call to Map must be followed by a call to Unmap.
+        */
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
         void Unmap(VkDevice device);
 
+        // Sets the priority (in the range [0, 1]) of this device memory chunk. Returns false if VK_EXT_pageable_device_local_memory is not supported.
+        bool SetPriority(float priority);
+
         // Tries to allocate a new block within this device memory chunk, and returns null of failure.
         VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation = false);
 
@@ -64,6 +96,9 @@ class VKDeviceMemory
         // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
         VkDeviceSize GetMaxAllocationSize() const;
 
+        // Returns the accumulated size of all allocated blocks within this device memory chunk.
+        VkDeviceSize GetUsedSize() const;
+
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
@@ -92,8 +127,17 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
+        // Returns true if this device memory chunk is dedicated to a single image.
+        inline bool IsDedicated() const
+        {
+            return isDedicated_;
+        }
+
     private:
 
+        // Allocates the native device memory object with the specified extension structures.
+        void AllocDeviceMemory(const void* next);
+
         // Returns the next offset after the last block.
         VkDeviceSize GetNextOffset() const;
 
@@ -135,9 +179,11 @@ class VKDeviceMemory
 
     private:
 
+        VkDevice                                            device_                 = VK_NULL_HANDLE;
         VKPtr<VkDeviceMemory>                               deviceMemory_;
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
+        bool                                                isDedicated_            = false;
 
         VkDeviceSize                                        maxNewBlockSize_        = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
@@ -145,6 +191,12 @@ class VKDeviceMemory
         VkDeviceSize                                        maxFragmentedBlockSize_ = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  fragmentedBlocks_;
 
+        std::unique_ptr<VKDeviceMemoryTLSF>                 tlsf_;                      // Optional TLSF allocator; replaces the block lists above.
+
+        std::mutex                                          mappingMutex_;
+        void*                                               mappedData_             = nullptr;
+        std::uint32_t                                       mappingCounter_         = 0;
+
 };
 
 
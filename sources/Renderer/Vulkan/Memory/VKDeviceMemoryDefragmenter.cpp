@@ -0,0 +1,242 @@
+/*
+ * VKDeviceMemoryDefragmenter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDeviceMemoryDefragmenter.h"
+#include "VKDeviceMemoryManager.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKInitializers.h"
+#include "../Command/VKCommandQueue.h"
+#include "../Command/VKTransferQueue.h"
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+
+namespace LLGL
+{
+
+
+constexpr double VKDeviceMemoryDefragmenter::maxSourceChunkOccupancy;
+
+VKDeviceMemoryDefragmenter::VKDeviceMemoryDefragmenter(
+    VKDevice&               device,
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    VkDeviceSize            budget,
+    VKTransferQueue*        transferQueue)
+:
+    device_           { device           },
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    budget_           { budget           },
+    transferQueue_    { transferQueue    },
+    fence_            { device           }
+{
+}
+
+VKDeviceMemoryDefragmenter::~VKDeviceMemoryDefragmenter()
+{
+    ReleasePendingRelocations(true);
+}
+
+void VKDeviceMemoryDefragmenter::RegisterBuffer(VKDeviceBuffer* buffer)
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    if (buffer != nullptr)
+        buffers_.push_back(buffer);
+}
+
+void VKDeviceMemoryDefragmenter::UnregisterBuffer(VKDeviceBuffer* buffer)
+{
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    auto it = std::find(buffers_.begin(), buffers_.end(), buffer);
+    if (it != buffers_.end())
+    {
+        /* Swap with last entry since the order of registered buffers is irrelevant */
+        *it = buffers_.back();
+        buffers_.pop_back();
+    }
+}
+
+void VKDeviceMemoryDefragmenter::NextStep()
+{
+    if (budget_ == 0)
+        return;
+
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+    /* Skip this step while the previous relocations are still in flight */
+    if (!ReleasePendingRelocations(false))
+        return;
+
+    VKDeviceMemory* srcChunk = FindSourceChunk();
+    if (srcChunk == nullptr)
+        return;
+
+    VkDeviceSize relocatedSize = 0;
+
+    for (VKDeviceBuffer* buffer : buffers_)
+    {
+        /* Always relocate at least one buffer per step, even if it exceeds the budget */
+        if (relocatedSize >= budget_)
+            break;
+
+        VKDeviceMemoryRegion* srcRegion = buffer->GetMemoryRegion();
+        if (srcRegion == nullptr || srcRegion->GetParentChunk() != srcChunk)
+            continue;
+
+        /* Create new native buffer with the same attributes */
+        VkBufferCreateInfo createInfo;
+        BuildVkBufferCreateInfo(createInfo, buffer->GetSize(), buffer->GetUsage());
+
+        const ArrayView<std::uint32_t> sharedQueueFamilies = device_.GetSharedQueueFamilies();
+        if (!sharedQueueFamilies.empty())
+        {
+            createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+            createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(sharedQueueFamilies.size());
+            createInfo.pQueueFamilyIndices      = sharedQueueFamilies.data();
+        }
+
+        VKDeviceBuffer dstBuffer{ device_, createInfo };
+
+        /* Allocate memory region in a denser chunk; stop this step if there is no space left */
+        VKDeviceMemoryRegion* dstRegion = deviceMemoryMngr_.AllocateForRelocation(dstBuffer.GetRequirements(), *srcChunk);
+        if (dstRegion == nullptr)
+            break;
+
+        dstBuffer.BindMemoryRegion(device_, dstRegion);
+
+        if (commandBuffer_ == VK_NULL_HANDLE)
+        {
+            /* Begin command buffer and wait for all previously submitted work that might still access the source buffers */
+            commandBuffer_ = device_.AllocCommandBuffer();
+            RecordMemoryBarrier(
+                commandBuffer_,
+                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_WRITE_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT,     VK_ACCESS_TRANSFER_READ_BIT
+            );
+        }
+
+        /* Record copy command from previous into new buffer */
+        VkBufferCopy region;
+        {
+            region.srcOffset    = 0;
+            region.dstOffset    = 0;
+            region.size         = buffer->GetSize();
+        }
+        vkCmdCopyBuffer(commandBuffer_, buffer->GetVkBuffer(), dstBuffer.GetVkBuffer(), 1, &region);
+
+        relocatedSize += srcRegion->GetSize();
+
+        /* Swap new buffer into the registered buffer and keep the previous one alive until the copy has completed */
+        std::swap(*buffer, dstBuffer);
+        pendingBuffers_.push_back(std::move(dstBuffer));
+    }
+
+    if (commandBuffer_ != VK_NULL_HANDLE)
+    {
+        /* Make relocated buffers visible to all subsequently submitted work */
+        RecordMemoryBarrier(
+            commandBuffer_,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,     VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT)
+        );
+
+        VkResult result = vkEndCommandBuffer(commandBuffer_);
+        VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for device memory defragmentation");
+
+        /* Relocated buffers might still be in transit from asynchronous uploads */
+        if (transferQueue_ != nullptr)
+            transferQueue_->FlushPendingAcquires();
+
+        fence_.Reset(device_);
+        result = VKSubmitCommandBuffer(device_.GetVkQueue(), commandBuffer_, fence_.GetVkFence());
+        VKThrowIfFailed(result, "failed to submit Vulkan command buffer for device memory defragmentation");
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKDeviceMemoryDefragmenter::ReleasePendingRelocations(bool wait)
+{
+    if (commandBuffer_ == VK_NULL_HANDLE)
+        return true;
+
+    if (!fence_.Wait(device_, (wait ? UINT64_MAX : 0)))
+        return false;
+
+    /* Release previous buffers and their memory regions; this releases the source chunk once it is empty */
+    for (VKDeviceBuffer& buffer : pendingBuffers_)
+        buffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+    pendingBuffers_.clear();
+
+    vkFreeCommandBuffers(device_, device_.GetVkCommandPool(), 1, &commandBuffer_);
+    commandBuffer_ = VK_NULL_HANDLE;
+
+    return true;
+}
+
+VKDeviceMemory* VKDeviceMemoryDefragmenter::FindSourceChunk() const
+{
+    /* Accumulate relocatable size per chunk */
+    std::unordered_map<VKDeviceMemory*, VkDeviceSize> relocatableSizes;
+    for (VKDeviceBuffer* buffer : buffers_)
+    {
+        if (VKDeviceMemoryRegion* region = buffer->GetMemoryRegion())
+            relocatableSizes[region->GetParentChunk()] += region->GetSize();
+    }
+
+    /* Find sparsest chunk that is only occupied by registered buffers, since other allocations would keep it alive anyway */
+    VKDeviceMemory* srcChunk        = nullptr;
+    double          minOccupancy    = maxSourceChunkOccupancy;
+
+    for (const auto& entry : relocatableSizes)
+    {
+        VKDeviceMemory*     chunk       = entry.first;
+        const VkDeviceSize  usedSize    = chunk->GetUsedSize();
+        if (entry.second == usedSize)
+        {
+            const double occupancy = static_cast<double>(usedSize) / static_cast<double>(chunk->GetSize());
+            if (occupancy <= minOccupancy)
+            {
+                srcChunk        = chunk;
+                minOccupancy    = occupancy;
+            }
+        }
+    }
+
+    return srcChunk;
+}
+
+void VKDeviceMemoryDefragmenter::RecordMemoryBarrier(
+    VkCommandBuffer         commandBuffer,
+    VkPipelineStageFlags    srcStageMask,
+    VkAccessFlags           srcAccessMask,
+    VkPipelineStageFlags    dstStageMask,
+    VkAccessFlags           dstAccessMask)
+{
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = srcAccessMask;
+        barrier.dstAccessMask   = dstAccessMask;
+    }
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,105 @@
+/*
+ * VKDeviceMemoryDefragmenter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DEVICE_MEMORY_DEFRAGMENTER_H
+#define LLGL_VK_DEVICE_MEMORY_DEFRAGMENTER_H
+
+
+#include "../Vulkan.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include "../RenderState/VKFence.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKDeviceMemory;
+class VKDeviceMemoryManager;
+class VKTransferQueue;
+
+/*
+Incremental defragmenter for Vulkan device memory.
+Each step relocates a bounded number of bytes of registered buffers out of the sparsest device memory chunk into denser chunks using GPU copies.
+The previous native buffers and their memory regions are kept alive until the copy commands and all previously submitted work have completed,
+at which point the memory manager releases the source chunk once it has become empty.
+Only buffers whose native handle is queried at command recording time can be registered, i.e. buffers that are not referenced by any descriptor set.
+All public functions lock the command pool mutex of the device, so buffers can be registered from multiple threads.
+*/
+class VKDeviceMemoryDefragmenter
+{
+
+    public:
+
+        VKDeviceMemoryDefragmenter(
+            VKDevice&               device,
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            VkDeviceSize            budget,
+            VKTransferQueue*        transferQueue       = nullptr
+        );
+        ~VKDeviceMemoryDefragmenter();
+
+        VKDeviceMemoryDefragmenter(const VKDeviceMemoryDefragmenter&) = delete;
+        VKDeviceMemoryDefragmenter& operator = (const VKDeviceMemoryDefragmenter&) = delete;
+
+        // Registers the specified device buffer as relocatable.
+        void RegisterBuffer(VKDeviceBuffer* buffer);
+
+        // Unregisters the specified device buffer. This must be called before the buffer is released or when its native handle is stored elsewhere.
+        void UnregisterBuffer(VKDeviceBuffer* buffer);
+
+        // Releases completed relocations and relocates up to the budget of bytes. Does nothing if the previous step is still in flight.
+        void NextStep();
+
+    private:
+
+        // Releases the previous buffers of completed relocations. Returns false if the relocations are still in flight and 'wait' is false.
+        bool ReleasePendingRelocations(bool wait);
+
+        // Returns the chunk with the lowest occupancy that can be entirely drained by relocating registered buffers, or null if there is none.
+        VKDeviceMemory* FindSourceChunk() const;
+
+        // Records a global memory barrier in the specified command buffer.
+        void RecordMemoryBarrier(
+            VkCommandBuffer         commandBuffer,
+            VkPipelineStageFlags    srcStageMask,
+            VkAccessFlags           srcAccessMask,
+            VkPipelineStageFlags    dstStageMask,
+            VkAccessFlags           dstAccessMask
+        );
+
+    private:
+
+        // Source chunks above this occupancy are not worth draining.
+        static constexpr double maxSourceChunkOccupancy = 0.5;
+
+    private:
+
+        VKDevice&                       device_;
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        VkDeviceSize                    budget_             = 0;
+        VKTransferQueue*                transferQueue_      = nullptr;
+
+        std::vector<VKDeviceBuffer*>    buffers_;
+        std::vector<VKDeviceBuffer>     pendingBuffers_;    // Previous buffers that are released once the fence has been signaled.
+
+        VKFence                         fence_;
+        VkCommandBuffer                 commandBuffer_      = VK_NULL_HANDLE;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -18,12 +19,14 @@ VKDeviceMemoryManager::VKDeviceMemoryManager(
     VkDevice                                device,
     const VkPhysicalDeviceMemoryProperties& memoryProperties,
     VkDeviceSize                            minAllocationSize,
-    bool                                    reduceFragmentation)
+    bool                                    reduceFragmentation,
+    VulkanDeviceMemoryStrategy              strategy)
 :
     device_              { device              },
     memoryProperties_    { memoryProperties    },
     minAllocationSize_   { minAllocationSize   },
-    reduceFragmentation_ { reduceFragmentation }
+    reduceFragmentation_ { reduceFragmentation },
+    strategy_            { strategy            }
 {
 }
 
@@ -33,14 +36,13 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     std::uint32_t           memoryTypeBits,
     VkMemoryPropertyFlags   properties)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     const VkDeviceSize  alignedSize     = GetAlignedSize(size, alignment);
     const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
-    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
-        return chunk->Allocate(size, alignment);
-    else
-        return nullptr;
+    return AllocateInAnyChunk(allocationSize, memoryTypeIndex, size, alignment, alignedSize);
 }
 
 VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
@@ -55,10 +57,26 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     );
 }
 
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateDedicated(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties,
+    VkImage                     image,
+    float                       priority)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    const std::uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+    if (VKDeviceMemory* chunk = chunks_.emplace<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex, image, priority))
+        return chunk->Allocate(requirements.size, requirements.alignment);
+    return nullptr;
+}
+
 void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
     {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+
         if (VKDeviceMemory* chunk = region->GetParentChunk())
         {
             /* Release block in chunk */
@@ -71,20 +89,75 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
     }
 }
 
+// Returns the ratio of allocated memory within the specified chunk in the range [0, 1].
+static double GetChunkOccupancy(const VKDeviceMemory& chunk)
+{
+    return static_cast<double>(chunk.GetUsedSize()) / static_cast<double>(chunk.GetSize());
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateForRelocation(
+    const VkMemoryRequirements& requirements,
+    const VKDeviceMemory&       srcChunk)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    const VkDeviceSize  alignedSize     = GetAlignedSize(requirements.size, requirements.alignment);
+    const std::uint32_t memoryTypeIndex = srcChunk.GetMemoryTypeIndex();
+    const double        srcOccupancy    = GetChunkOccupancy(srcChunk);
+
+    /* Only move into chunks that are denser than the source, so relocations cannot bounce back and forth between chunks */
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk != &srcChunk &&
+            !chunk->IsDedicated() &&
+            chunk->GetMemoryTypeIndex() == memoryTypeIndex &&
+            chunk->GetMaxAllocationSize() >= alignedSize &&
+            GetChunkOccupancy(*chunk) > srcOccupancy)
+        {
+            if (VKDeviceMemoryRegion* region = chunk->Allocate(requirements.size, requirements.alignment, reduceFragmentation_))
+                return region;
+        }
+    }
+
+    return nullptr;
+}
+
+std::unique_ptr<VKDeviceMemory> VKDeviceMemoryManager::AllocateDedicatedChunk(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties)
+{
+    const std::uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+    return MakeUnique<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex);
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
     {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+
         for (const auto& chunk : chunks_)
             chunk->AccumDetails(details);
     }
     return details;
 }
 
+bool VKDeviceMemoryManager::HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
+{
+    for_range(i, memoryProperties_.memoryTypeCount)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties_.memoryTypes[i].propertyFlags & properties) == properties)
+            return true;
+    }
+    return false;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     std::size_t i = 0;
     for (const auto& chunk : chunks_)
     {
@@ -121,20 +194,35 @@ std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits
 
 VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
 {
-    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
+    const bool useTLSF = (strategy_ == VulkanDeviceMemoryStrategy::TLSF);
+    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex, useTLSF);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateInAnyChunk(
+    VkDeviceSize    allocationSize,
+    std::uint32_t   memoryTypeIndex,
+    VkDeviceSize    size,
+    VkDeviceSize    alignment,
+    VkDeviceSize    alignedSize)
 {
-    /* Search for a suitable chunk */
+    /*
+    Search for a suitable chunk. The maximum allocation size is only an upper bound,
+    so the allocation can still fail due to alignment, in which case we continue with the next chunk.
+    */
     for (const auto& chunk : chunks_)
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        if (!chunk->IsDedicated() && chunk->GetMaxAllocationSize() >= alignedSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
+        {
+            if (VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment, reduceFragmentation_))
+                return region;
+        }
     }
 
     /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+    if (VKDeviceMemory* chunk = AllocChunk(allocationSize, memoryTypeIndex))
+        return chunk->Allocate(size, alignment, reduceFragmentation_);
+
+    return nullptr;
 }
 
 
@@ -11,12 +11,14 @@
 
 //#include "../Vulkan.h"
 #include <vulkan/vulkan.h>
+#include <LLGL/RendererConfiguration.h>
 #include "../VKPtr.h"
 #include "../../ContainerTypes.h"
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -28,6 +30,7 @@ Vulkan device memory manager. Memory allocations are stored in a small hierarchy
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+All allocation and release functions are thread-safe.
 */
 class VKDeviceMemoryManager
 {
@@ -38,7 +41,8 @@ class VKDeviceMemoryManager
             VkDevice                                device,
             const VkPhysicalDeviceMemoryProperties& memoryProperties,
             VkDeviceSize                            minAllocationSize,
-            bool                                    reduceFragmentation
+            bool                                    reduceFragmentation,
+            VulkanDeviceMemoryStrategy              strategy            = VulkanDeviceMemoryStrategy::Default
         );
 
         VKDeviceMemoryManager(const VKDeviceMemoryManager&) = delete;
@@ -58,12 +62,47 @@ class VKDeviceMemoryManager
             VkMemoryPropertyFlags       properties
         );
 
+        /*
+        Allocates a new device memory chunk with a single block that is dedicated to the specified image.
+        The chunk is released together with its block and is never used for other allocations.
+        If 'priority' is in the range [0, 1], it is passed to the driver as initial memory priority (VK_EXT_memory_priority).
+        */
+        VKDeviceMemoryRegion* AllocateDedicated(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties,
+            VkImage                     image,
+            float                       priority = -1.0f
+        );
+
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        /*
+        Tries to allocate a device memory block with the specified memory requirements to relocate an allocation out of the specified chunk.
+        Only chunks with the same memory type and a higher occupancy than the source chunk are considered and no new chunk is allocated.
+        Returns null if there is no suitable chunk.
+        */
+        VKDeviceMemoryRegion* AllocateForRelocation(
+            const VkMemoryRequirements& requirements,
+            const VKDeviceMemory&       srcChunk
+        );
+
+        /*
+        Allocates a dedicated device memory chunk that is not sub-allocated by this memory manager.
+        This is used for persistently mapped memory such as transient staging buffers
+        since a VkDeviceMemory object can only be mapped once at a time.
+        */
+        std::unique_ptr<VKDeviceMemory> AllocateDedicatedChunk(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties
+        );
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Returns true if any of the specified memory types has all the specified property flags.
+        bool HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -76,6 +115,12 @@ class VKDeviceMemoryManager
             return device_;
         }
 
+        // Returns the minimal size of each device memory chunk that is shared between multiple allocations.
+        inline VkDeviceSize GetMinAllocationSize() const
+        {
+            return minAllocationSize_;
+        }
+
     private:
 
         // Finds a memory type index for the specified attributes.
@@ -84,8 +129,14 @@ class VKDeviceMemoryManager
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
         VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
 
-        // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        // Tries to allocate a region in any suitable device memory chunk, or allocates a new chunk.
+        VKDeviceMemoryRegion* AllocateInAnyChunk(
+            VkDeviceSize    allocationSize,
+            std::uint32_t   memoryTypeIndex,
+            VkDeviceSize    size,
+            VkDeviceSize    alignment,
+            VkDeviceSize    alignedSize
+        );
 
     private:
 
@@ -94,8 +145,10 @@ class VKDeviceMemoryManager
 
         VkDeviceSize                                minAllocationSize_      = 1024*1024;
         bool                                        reduceFragmentation_    = false;
+        VulkanDeviceMemoryStrategy                  strategy_               = VulkanDeviceMemoryStrategy::Default;
 
-        UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
+        SlotObjectContainer<VKDeviceMemory>         chunks_;
+        mutable std::mutex                          mutex_;
 
 };
 
@@ -0,0 +1,400 @@
+/*
+ * VKDeviceMemoryTLSF.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDeviceMemoryTLSF.h"
+#include "VKDeviceMemory.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+constexpr std::uint32_t VKDeviceMemoryTLSF::slCountLog2;
+constexpr std::uint32_t VKDeviceMemoryTLSF::slCount;
+constexpr std::uint32_t VKDeviceMemoryTLSF::flCount;
+
+// Returns the index of the lowest set bit; 'x' must not be zero.
+static std::uint32_t FindLowestBit(std::uint64_t x)
+{
+    #if defined __GNUC__ || defined __clang__
+    return static_cast<std::uint32_t>(__builtin_ctzll(x));
+    #elif defined _MSC_VER && (defined _M_X64 || defined _M_ARM64)
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+    return static_cast<std::uint32_t>(index);
+    #else
+    std::uint32_t index = 0;
+    while ((x & 1ull) == 0)
+    {
+        x >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+// Returns the index of the highest set bit; 'x' must not be zero.
+static std::uint32_t FindHighestBit(std::uint64_t x)
+{
+    #if defined __GNUC__ || defined __clang__
+    return static_cast<std::uint32_t>(63 - __builtin_clzll(x));
+    #elif defined _MSC_VER && (defined _M_X64 || defined _M_ARM64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, x);
+    return static_cast<std::uint32_t>(index);
+    #else
+    std::uint32_t index = 0;
+    while (x > 1ull)
+    {
+        x >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+VKDeviceMemoryTLSF::VKDeviceMemoryTLSF(VKDeviceMemory* deviceMemory, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
+    deviceMemory_    { deviceMemory    },
+    memoryTypeIndex_ { memoryTypeIndex }
+{
+    for (auto& freeList : freeLists_)
+        std::fill(std::begin(freeList), std::end(freeList), nullptr);
+
+    /* Start with a single free block that spans the entire chunk */
+    if (size > 0)
+    {
+        Block* block = AllocBlockNode();
+        block->offset   = 0;
+        block->size     = size;
+        InsertFreeBlock(block);
+    }
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryTLSF::Allocate(VkDeviceSize size, VkDeviceSize alignment)
+{
+    if (size == 0 || alignment == 0)
+        return nullptr;
+
+    const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
+
+    Block* block = FindSuitableFreeBlock(alignedSize, alignment);
+    if (block == nullptr)
+        return nullptr;
+
+    RemoveFreeBlock(block);
+
+    /* Split off lower part if offset must be aligned; the previous physical block is always in use, so it cannot be merged */
+    const VkDeviceSize alignedOffset = GetAlignedSize(block->offset, alignment);
+    if (block->offset < alignedOffset)
+    {
+        Block* upper = SplitBlock(block, alignedOffset - block->offset);
+        InsertFreeBlock(block);
+        block = upper;
+    }
+
+    /* Split off upper part if the block is larger than requested; the next physical block is always in use, so it cannot be merged */
+    if (block->size > alignedSize)
+    {
+        Block* upper = SplitBlock(block, alignedSize);
+        InsertFreeBlock(upper);
+    }
+
+    /* Make new region for this block */
+    block->region = MakeUnique<VKDeviceMemoryRegion>(deviceMemory_, block->size, block->offset, memoryTypeIndex_);
+    usedBlocks_[block->offset] = block;
+
+    return block->region.get();
+}
+
+bool VKDeviceMemoryTLSF::Release(VKDeviceMemoryRegion* region)
+{
+    if (region == nullptr)
+        return false;
+
+    auto it = usedBlocks_.find(region->GetOffset());
+    if (it == usedBlocks_.end() || it->second->region.get() != region)
+        return false;
+
+    Block* block = it->second;
+    usedBlocks_.erase(it);
+    block->region.reset();
+
+    /* Merge with free physical neighbors */
+    if (Block* prev = block->prevPhys)
+    {
+        if (!prev->region)
+        {
+            RemoveFreeBlock(prev);
+            MergeBlocks(prev, block);
+            block = prev;
+        }
+    }
+
+    if (Block* next = block->nextPhys)
+    {
+        if (!next->region)
+        {
+            RemoveFreeBlock(next);
+            MergeBlocks(block, next);
+        }
+    }
+
+    InsertFreeBlock(block);
+
+    return true;
+}
+
+bool VKDeviceMemoryTLSF::IsEmpty() const
+{
+    return usedBlocks_.empty();
+}
+
+VkDeviceSize VKDeviceMemoryTLSF::GetMaxAllocationSize() const
+{
+    if (flBitmap_ == 0)
+        return 0;
+
+    /* Return the upper bound of the highest non-empty bin */
+    const std::uint32_t fl = FindHighestBit(flBitmap_);
+    const std::uint32_t sl = FindHighestBit(slBitmaps_[fl]);
+
+    if (fl == 0)
+        return static_cast<VkDeviceSize>(sl);
+
+    const VkDeviceSize binBase  = (1ull << (fl + slCountLog2 - 1));
+    const VkDeviceSize binWidth = (binBase >> slCountLog2);
+
+    return binBase + binWidth * (sl + 1) - 1;
+}
+
+void VKDeviceMemoryTLSF::AccumDetails(VKDeviceMemoryDetails& details) const
+{
+    /* Find the largest free block in the highest non-empty bin */
+    VkDeviceSize maxFreeBlockSize = 0;
+
+    if (flBitmap_ != 0)
+    {
+        const std::uint32_t fl = FindHighestBit(flBitmap_);
+        const std::uint32_t sl = FindHighestBit(slBitmaps_[fl]);
+        for (const Block* block = freeLists_[fl][sl]; block != nullptr; block = block->nextFree)
+            maxFreeBlockSize = std::max(maxFreeBlockSize, block->size);
+    }
+
+    details.numChunks               += 1;
+    details.numBlocks               += usedBlocks_.size();
+    details.numFragments            += numFreeBlocks_;
+    details.freeSize                += freeSize_;
+    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFreeBlockSize);
+    details.maxFreeBlockSize        = std::max(details.maxFreeBlockSize, maxFreeBlockSize);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKDeviceMemoryTLSF::MapSize(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl)
+{
+    if (size < slCount)
+    {
+        /* Small blocks are stored linearly in the first level */
+        fl = 0;
+        sl = static_cast<std::uint32_t>(size);
+    }
+    else
+    {
+        const std::uint32_t highestBit = FindHighestBit(size);
+        fl = highestBit - slCountLog2 + 1;
+        sl = static_cast<std::uint32_t>(size >> (highestBit - slCountLog2)) ^ slCount;
+    }
+}
+
+VkDeviceSize VKDeviceMemoryTLSF::RoundUpSize(VkDeviceSize size)
+{
+    if (size >= slCount)
+        return size + (1ull << (FindHighestBit(size) - slCountLog2)) - 1;
+    else
+        return size;
+}
+
+VKDeviceMemoryTLSF::Block* VKDeviceMemoryTLSF::FindFreeBlock(VkDeviceSize size) const
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSize(RoundUpSize(size), fl, sl);
+
+    if (fl >= flCount)
+        return nullptr;
+
+    /* Search for non-empty bin in the same first level */
+    std::uint32_t slMap = slBitmaps_[fl] & (~0u << sl);
+    if (slMap == 0)
+    {
+        /* Search for non-empty bin in any higher first level */
+        if (fl + 1 >= flCount)
+            return nullptr;
+
+        const std::uint64_t flMap = flBitmap_ & (~0ull << (fl + 1));
+        if (flMap == 0)
+            return nullptr;
+
+        fl      = FindLowestBit(flMap);
+        slMap   = slBitmaps_[fl];
+    }
+
+    sl = FindLowestBit(slMap);
+
+    return freeLists_[fl][sl];
+}
+
+// Returns true if the specified size with alignment fits into the free block.
+static bool IsBlockSuitable(VkDeviceSize blockOffset, VkDeviceSize blockSize, VkDeviceSize size, VkDeviceSize alignment)
+{
+    const VkDeviceSize alignedOffset = GetAlignedSize(blockOffset, alignment);
+    return (alignedOffset - blockOffset + size <= blockSize);
+}
+
+VKDeviceMemoryTLSF::Block* VKDeviceMemoryTLSF::FindSuitableFreeBlock(VkDeviceSize size, VkDeviceSize alignment) const
+{
+    /* Try good-fit block first; most blocks are already aligned */
+    if (Block* block = FindFreeBlock(size))
+    {
+        if (IsBlockSuitable(block->offset, block->size, size, alignment))
+            return block;
+    }
+
+    /* Try block that fits the worst case alignment padding */
+    if (alignment > 1)
+    {
+        if (Block* block = FindFreeBlock(size + alignment - 1))
+            return block;
+    }
+
+    /* Fall back to linear search in the bin of the exact size, since the good-fit search rounds up to the next bin */
+    std::uint32_t fl = 0, sl = 0;
+    MapSize(size, fl, sl);
+
+    if (fl < flCount)
+    {
+        for (Block* block = freeLists_[fl][sl]; block != nullptr; block = block->nextFree)
+        {
+            if (IsBlockSuitable(block->offset, block->size, size, alignment))
+                return block;
+        }
+    }
+
+    return nullptr;
+}
+
+void VKDeviceMemoryTLSF::InsertFreeBlock(Block* block)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSize(block->size, fl, sl);
+    LLGL_ASSERT(fl < flCount);
+
+    /* Insert block at the front of its free list */
+    Block* head = freeLists_[fl][sl];
+    block->prevFree = nullptr;
+    block->nextFree = head;
+    if (head != nullptr)
+        head->prevFree = block;
+    freeLists_[fl][sl] = block;
+
+    /* Mark bins as non-empty */
+    flBitmap_       |= (1ull << fl);
+    slBitmaps_[fl]  |= (1u << sl);
+
+    freeSize_ += block->size;
+    ++numFreeBlocks_;
+}
+
+void VKDeviceMemoryTLSF::RemoveFreeBlock(Block* block)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSize(block->size, fl, sl);
+
+    /* Unlink block from its free list */
+    if (block->prevFree != nullptr)
+        block->prevFree->nextFree = block->nextFree;
+    else
+        freeLists_[fl][sl] = block->nextFree;
+
+    if (block->nextFree != nullptr)
+        block->nextFree->prevFree = block->prevFree;
+
+    block->prevFree = nullptr;
+    block->nextFree = nullptr;
+
+    /* Mark bins as empty if this was the last block */
+    if (freeLists_[fl][sl] == nullptr)
+    {
+        slBitmaps_[fl] &= ~(1u << sl);
+        if (slBitmaps_[fl] == 0)
+            flBitmap_ &= ~(1ull << fl);
+    }
+
+    freeSize_ -= block->size;
+    --numFreeBlocks_;
+}
+
+VKDeviceMemoryTLSF::Block* VKDeviceMemoryTLSF::SplitBlock(Block* block, VkDeviceSize size)
+{
+    Block* upper = AllocBlockNode();
+    {
+        upper->offset   = block->offset + size;
+        upper->size     = block->size - size;
+        upper->prevPhys = block;
+        upper->nextPhys = block->nextPhys;
+    }
+    if (block->nextPhys != nullptr)
+        block->nextPhys->prevPhys = upper;
+
+    block->size     = size;
+    block->nextPhys = upper;
+
+    return upper;
+}
+
+void VKDeviceMemoryTLSF::MergeBlocks(Block* lower, Block* upper)
+{
+    lower->size     += upper->size;
+    lower->nextPhys = upper->nextPhys;
+    if (upper->nextPhys != nullptr)
+        upper->nextPhys->prevPhys = lower;
+    FreeBlockNode(upper);
+}
+
+VKDeviceMemoryTLSF::Block* VKDeviceMemoryTLSF::AllocBlockNode()
+{
+    if (!unusedBlockNodes_.empty())
+    {
+        Block* block = unusedBlockNodes_.back();
+        unusedBlockNodes_.pop_back();
+        return block;
+    }
+    blockNodes_.push_back(MakeUnique<Block>());
+    return blockNodes_.back().get();
+}
+
+void VKDeviceMemoryTLSF::FreeBlockNode(Block* block)
+{
+    *block = Block{};
+    unusedBlockNodes_.push_back(block);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
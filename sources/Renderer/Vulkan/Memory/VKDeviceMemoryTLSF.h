@@ -0,0 +1,132 @@
+/*
+ * VKDeviceMemoryTLSF.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DEVICE_MEMORY_TLSF_H
+#define LLGL_VK_DEVICE_MEMORY_TLSF_H
+
+
+#include "VKDeviceMemoryRegion.h"
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemory;
+struct VKDeviceMemoryDetails;
+
+/*
+Two-Level Segregated Fit (TLSF) allocator for sub-regions within a single VkDeviceMemory chunk.
+Free blocks are stored in segregated free lists indexed by a first level (power of two) and a second level (linear subdivision).
+Both levels are tracked with bitmasks, so finding a suitable free block, splitting it, and merging it with its physical neighbors on release are all in O(1).
+*/
+class VKDeviceMemoryTLSF
+{
+
+    public:
+
+        VKDeviceMemoryTLSF(VKDeviceMemory* deviceMemory, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+
+        VKDeviceMemoryTLSF(const VKDeviceMemoryTLSF&) = delete;
+        VKDeviceMemoryTLSF& operator = (const VKDeviceMemoryTLSF&) = delete;
+
+        // Tries to allocate a new region with the specified size and alignment, and returns null on failure.
+        VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment);
+
+        // Releases the specified region and merges its block with free neighbors. Returns false if the region was not allocated by this allocator.
+        bool Release(VKDeviceMemoryRegion* region);
+
+        // Returns true if no more regions are allocated.
+        bool IsEmpty() const;
+
+        // Returns an upper bound of the largest size that can be allocated. This is derived from the bitmasks only.
+        VkDeviceSize GetMaxAllocationSize() const;
+
+        // Accumulates the memory details of this allocator into the output structure.
+        void AccumDetails(VKDeviceMemoryDetails& details) const;
+
+        // Returns the accumulated size of all free blocks.
+        inline VkDeviceSize GetFreeSize() const
+        {
+            return freeSize_;
+        }
+
+    private:
+
+        static constexpr std::uint32_t slCountLog2  = 4;
+        static constexpr std::uint32_t slCount      = (1u << slCountLog2);
+        static constexpr std::uint32_t flCount      = 64;
+
+        struct Block
+        {
+            VkDeviceSize                            offset      = 0;
+            VkDeviceSize                            size        = 0;
+            Block*                                  prevPhys    = nullptr;
+            Block*                                  nextPhys    = nullptr;
+            Block*                                  prevFree    = nullptr;
+            Block*                                  nextFree    = nullptr;
+            std::unique_ptr<VKDeviceMemoryRegion>   region;     // Null if this block is free.
+        };
+
+    private:
+
+        // Maps the specified size to its first- and second level indices.
+        static void MapSize(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl);
+
+        // Rounds up the specified size to the next second level bin so that any block in the resulting bin can fit the size.
+        static VkDeviceSize RoundUpSize(VkDeviceSize size);
+
+        // Finds a free block that can fit at least the specified size, or null if there is none.
+        Block* FindFreeBlock(VkDeviceSize size) const;
+
+        // Finds a free block that can fit the specified size with alignment, or null if there is none.
+        Block* FindSuitableFreeBlock(VkDeviceSize size, VkDeviceSize alignment) const;
+
+        void InsertFreeBlock(Block* block);
+        void RemoveFreeBlock(Block* block);
+
+        // Splits the specified block at the specified size and returns the upper block.
+        Block* SplitBlock(Block* block, VkDeviceSize size);
+
+        // Merges the upper block into the lower block and releases the upper block node.
+        void MergeBlocks(Block* lower, Block* upper);
+
+        Block* AllocBlockNode();
+        void FreeBlockNode(Block* block);
+
+    private:
+
+        VKDeviceMemory*                             deviceMemory_           = nullptr;
+        std::uint32_t                               memoryTypeIndex_        = 0;
+
+        std::uint64_t                               flBitmap_               = 0;
+        std::uint32_t                               slBitmaps_[flCount]     = {};
+        Block*                                      freeLists_[flCount][slCount];
+
+        std::vector<std::unique_ptr<Block>>         blockNodes_;
+        std::vector<Block*>                         unusedBlockNodes_;
+        std::unordered_map<VkDeviceSize, Block*>    usedBlocks_;            // Used blocks by their offset.
+
+        VkDeviceSize                                freeSize_               = 0;
+        std::size_t                                 numFreeBlocks_          = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,141 @@
+/*
+ * VKTransientBufferRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKTransientBufferRing.h"
+#include "VKDeviceMemoryManager.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+// Transient buffers are written by the CPU and read by the GPU within the same frame, so they don't need device local memory.
+static constexpr VkMemoryPropertyFlags transientMemoryProperties = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+VKTransientBufferRing::FrameFence::FrameFence(VkDevice device) :
+    fence { device }
+{
+}
+
+VKTransientBufferRing::VKTransientBufferRing(VkDevice device, VkQueue queue, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize capacity) :
+    device_           { device           },
+    queue_            { queue            },
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    capacity_         { capacity         }
+{
+}
+
+bool VKTransientBufferRing::Allocate(const VkMemoryRequirements& requirements, VkDeviceSize& outOffset)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (requirements.size > capacity_)
+        return false;
+
+    if (!deviceMemory_ && !CreateDeviceMemory(requirements))
+        return false;
+
+    if ((requirements.memoryTypeBits & (1u << deviceMemory_->GetMemoryTypeIndex())) == 0)
+        return false;
+
+    /*
+    Allocations never make the head catch up with the tail, so that (head_ == tail_) always denotes an empty ring.
+    If the range until the end of the ring is too small, it is skipped and only recycled once the current frame has completed.
+    */
+    VkDeviceSize offset = GetAlignedSize(head_, requirements.alignment);
+    if (head_ >= tail_)
+    {
+        if (offset + requirements.size > capacity_)
+        {
+            if (requirements.size >= tail_)
+                return false;
+            offset = 0;
+        }
+    }
+    else if (offset + requirements.size >= tail_)
+        return false;
+
+    head_           = offset + requirements.size;
+    hasFrameAllocs_ = true;
+    outOffset       = offset;
+
+    return true;
+}
+
+void VKTransientBufferRing::NextFrame()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (hasFrameAllocs_)
+    {
+        /* Fence all work that has been submitted so far with an empty submission, since queue submissions complete in order */
+        FrameFencePtr frame = AllocFrameFence();
+        VkResult result = VKQueueSubmit(queue_, 0, nullptr, frame->fence.GetVkFence());
+        VKThrowIfFailed(result, "failed to submit fence for transient buffers to Vulkan graphics queue");
+
+        frame->endOffset = head_;
+        inFlightFrames_.push_back(std::move(frame));
+        hasFrameAllocs_ = false;
+    }
+
+    /* Frames complete in submission order, so stop polling at the first frame that is still in flight */
+    std::size_t numCompleted = 0;
+    for (; numCompleted < inFlightFrames_.size(); ++numCompleted)
+    {
+        FrameFence& frame = *inFlightFrames_[numCompleted];
+        if (!frame.fence.Wait(device_, 0))
+            break;
+
+        tail_ = frame.endOffset;
+        freeFrames_.push_back(std::move(inFlightFrames_[numCompleted]));
+    }
+    inFlightFrames_.erase(inFlightFrames_.begin(), inFlightFrames_.begin() + numCompleted);
+
+    /* Rewind the ring once it is empty to avoid skipping its end for the next allocation */
+    if (inFlightFrames_.empty())
+        head_ = tail_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKTransientBufferRing::CreateDeviceMemory(const VkMemoryRequirements& requirements)
+{
+    if (!deviceMemoryMngr_.HasMemoryType(requirements.memoryTypeBits, transientMemoryProperties))
+        return false;
+
+    VkMemoryRequirements ringRequirements = requirements;
+    ringRequirements.size = capacity_;
+
+    /* Keep memory mapped for the entire lifetime of the ring */
+    deviceMemory_   = deviceMemoryMngr_.AllocateDedicatedChunk(ringRequirements, transientMemoryProperties);
+    mappedData_     = static_cast<char*>(deviceMemory_->Map(device_, 0, VK_WHOLE_SIZE));
+
+    return true;
+}
+
+VKTransientBufferRing::FrameFencePtr VKTransientBufferRing::AllocFrameFence()
+{
+    if (freeFrames_.empty())
+        return FrameFencePtr{ new FrameFence{ device_ } };
+
+    FrameFencePtr frame = std::move(freeFrames_.back());
+    freeFrames_.pop_back();
+    frame->fence.Reset(device_);
+    return frame;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,108 @@
+/*
+ * VKTransientBufferRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_TRANSIENT_BUFFER_RING_H
+#define LLGL_VK_TRANSIENT_BUFFER_RING_H
+
+
+#include "../Vulkan.h"
+#include "../RenderState/VKFence.h"
+#include "VKDeviceMemory.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Ring of persistently mapped host visible device memory for buffers with MiscFlags::Transient.
+Buffers are bound at a bump offset into a single VkDeviceMemory chunk and never go through VKDeviceMemoryManager::Allocate.
+All allocations between two frames are fenced with an empty submission to the graphics queue when the next frame begins,
+and their memory is recycled once that fence has been signaled. The chunk is only allocated when the first transient buffer is created.
+*/
+class VKTransientBufferRing
+{
+
+    public:
+
+        VKTransientBufferRing(VkDevice device, VkQueue queue, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize capacity);
+
+        VKTransientBufferRing(const VKTransientBufferRing&) = delete;
+        VKTransientBufferRing& operator = (const VKTransientBufferRing&) = delete;
+
+        // Allocates a range for the specified requirements. Returns false if the ring is exhausted or its memory type is incompatible.
+        bool Allocate(const VkMemoryRequirements& requirements, VkDeviceSize& outOffset);
+
+        // Fences all allocations of the current frame and recycles the memory of all previous frames that have completed on the GPU.
+        void NextFrame();
+
+        // Returns the device memory chunk of this ring or VK_NULL_HANDLE if no transient buffer has been allocated yet.
+        inline VkDeviceMemory GetVkDeviceMemory() const
+        {
+            return (deviceMemory_ ? deviceMemory_->GetVkDeviceMemory() : VK_NULL_HANDLE);
+        }
+
+        // Returns the persistently mapped memory of this ring.
+        inline char* GetMappedData() const
+        {
+            return mappedData_;
+        }
+
+    private:
+
+        struct FrameFence
+        {
+            FrameFence(VkDevice device);
+
+            VKFence         fence;
+            VkDeviceSize    endOffset = 0; // Head of the ring when this frame was fenced
+        };
+
+        using FrameFencePtr = std::unique_ptr<FrameFence>;
+
+    private:
+
+        // Allocates and maps the device memory chunk for the first transient buffer.
+        bool CreateDeviceMemory(const VkMemoryRequirements& requirements);
+
+        // Returns a frame fence that is unsignaled, either recycled or newly created.
+        FrameFencePtr AllocFrameFence();
+
+    private:
+
+        VkDevice                        device_             = VK_NULL_HANDLE;
+        VkQueue                         queue_              = VK_NULL_HANDLE;
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        VkDeviceSize                    capacity_           = 0;
+
+        std::unique_ptr<VKDeviceMemory> deviceMemory_;
+        char*                           mappedData_         = nullptr;
+
+        VkDeviceSize                    head_               = 0; // Offset of the next allocation
+        VkDeviceSize                    tail_               = 0; // Start of the oldest allocation that might still be in use
+        bool                            hasFrameAllocs_     = false;
+
+        std::vector<FrameFencePtr>      inFlightFrames_;    // Frames in submission order
+        std::vector<FrameFencePtr>      freeFrames_;
+        std::mutex                      mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -30,7 +30,7 @@ VKComputePSO::VKComputePSO(
 {
     /* Create Vulkan compute pipeline object */
     if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, desc, pipelineCacheVK->GetNative());
+        CreateVkPipeline(device, desc, pipelineCacheVK->GetNativeForCurrentThread());
     else
         CreateVkPipeline(device, desc);
 }
@@ -12,6 +12,7 @@
 #include "../Texture/VKTexture.h"
 #include "../Texture/VKSampler.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/Exception.h"
 #include <LLGL/Utils/ForRange.h>
 #include <vector>
 #include <algorithm>
@@ -31,27 +32,48 @@ static std::uint32_t SumDescriptorPoolSizes(std::uint32_t numSizes, const VkDesc
 
 VKDescriptorCache::VKDescriptorCache(
     VkDevice                            device,
-    VkDescriptorPool                    descriptorPool,
     VkDescriptorSetLayout               setLayout,
     std::uint32_t                       numSizes,
     const VkDescriptorPoolSize*         sizes,
-    const ArrayView<VKLayoutBinding>&   bindings)
+    const ArrayView<VKLayoutBinding>&   bindings,
+    bool                                pushDescriptors)
 :
     device_         { device                                  },
+    descriptorPool_ { device, vkDestroyDescriptorPool         },
     setLayout_      { setLayout                               },
     poolSizes_      { sizes, sizes + numSizes                 },
     numDescriptors_ { SumDescriptorPoolSizes(numSizes, sizes) }
 {
-    /* Allocate descriptor set for immutable samplers */
+    /* Push descriptors are written directly into the command buffer, so neither a descriptor pool nor a cached descriptor set is required */
+    if (pushDescriptors)
+    {
+        BuildPushDescriptors(bindings);
+        return;
+    }
+
+    /* Create descriptor pool for the cached descriptor set */
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = 0;
+        poolCreateInfo.maxSets          = 1;
+        poolCreateInfo.poolSizeCount    = numSizes;
+        poolCreateInfo.pPoolSizes       = sizes;
+    }
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for descriptor cache");
+
+    /* Allocate descriptor set that caches all dynamic descriptors */
     VkDescriptorSetAllocateInfo allocInfo;
     {
         allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
         allocInfo.pNext                 = nullptr;
-        allocInfo.descriptorPool        = descriptorPool;
+        allocInfo.descriptorPool        = descriptorPool_;
         allocInfo.descriptorSetCount    = 1;
         allocInfo.pSetLayouts           = &setLayout;
     }
-    VkResult result = vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet_);
+    result = vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet_);
     VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
 
     /* Pre-allocate VkCopyDescriptorSet array */
@@ -68,7 +90,7 @@ void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBind
     switch (resource.GetResourceType())
     {
         case ResourceType::Buffer:
-            EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, resource), binding, setWriter);
+            EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, resource), 0, VK_WHOLE_SIZE, binding, setWriter);
             dirty_ = true;
             break;
 
@@ -87,6 +109,17 @@ void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBind
     }
 }
 
+void VKDescriptorCache::EmplaceBufferRangeDescriptor(
+    VKBuffer&               bufferVK,
+    VkDeviceSize            offset,
+    VkDeviceSize            range,
+    const VKLayoutBinding&  binding,
+    VKDescriptorSetWriter&  setWriter)
+{
+    EmplaceBufferDescriptor(bufferVK, offset, range, binding, setWriter);
+    dirty_ = true;
+}
+
 VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter)
 {
     if (!dirty_ || setLayout_ == VK_NULL_HANDLE)
@@ -99,9 +132,6 @@ VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool
     */
     VkDescriptorSet descriptorSetCopy = pool.AllocateDescriptorSet(setLayout_, static_cast<std::uint32_t>(poolSizes_.size()), poolSizes_.data());
 
-    /* Lock mutex to guard copy descriptors since they are shared across threads */
-    std::lock_guard<std::mutex> guard{ copyDescMutex_ };
-
     UpdateCopyDescriptorSet(descriptorSetCopy);
 
     vkUpdateDescriptorSets(
@@ -118,6 +148,38 @@ VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool
     return descriptorSetCopy;
 }
 
+std::uint32_t VKDescriptorCache::FlushPushDescriptors(const VkWriteDescriptorSet*& outWrites)
+{
+    if (!dirty_)
+        return 0;
+
+    /* Clear cache after updated  */
+    dirty_ = false;
+
+    if (pushWrittenMask_ == 0)
+        return 0;
+
+    /* Push all descriptors at once if every binding has been written; otherwise, gather the written descriptors only */
+    const std::uint32_t numWrites = static_cast<std::uint32_t>(pushWrites_.size());
+    const std::uint32_t allWrittenMask = (numWrites < 32 ? ((1u << numWrites) - 1u) : ~0u);
+
+    if (pushWrittenMask_ == allWrittenMask)
+    {
+        outWrites = pushWrites_.data();
+        return numWrites;
+    }
+
+    pushWritesCompact_.clear();
+    for_range(i, numWrites)
+    {
+        if ((pushWrittenMask_ & (1u << i)) != 0)
+            pushWritesCompact_.push_back(pushWrites_[i]);
+    }
+
+    outWrites = pushWritesCompact_.data();
+    return static_cast<std::uint32_t>(pushWritesCompact_.size());
+}
+
 
 /*
  * ======= Private: =======
@@ -149,13 +211,37 @@ VkDescriptorImageInfo* VKDescriptorCache::NextImageInfoOrUpdateCache(VKDescripto
     return info;
 }
 
-void VKDescriptorCache::EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
+void VKDescriptorCache::EmplaceBufferDescriptor(
+    VKBuffer&               bufferVK,
+    VkDeviceSize            offset,
+    VkDeviceSize            range,
+    const VKLayoutBinding&  binding,
+    VKDescriptorSetWriter&  setWriter)
 {
+    if (HasPushDescriptors())
+    {
+        /* Overwrite the retained descriptor for this binding */
+        const std::uint32_t index = FindPushDescriptorIndex(binding);
+        VkDescriptorBufferInfo& bufferInfo = pushBufferInfos_[index];
+        {
+            bufferInfo.buffer   = bufferVK.GetVkBuffer();
+            bufferInfo.offset   = offset;
+            bufferInfo.range    = range;
+        }
+        VkWriteDescriptorSet& writeDesc = pushWrites_[index];
+        {
+            writeDesc.pImageInfo        = nullptr;
+            writeDesc.pBufferInfo       = &bufferInfo;
+        }
+        pushWrittenMask_ |= (1u << index);
+        return;
+    }
+
     auto bufferInfo = NextBufferInfoOrUpdateCache(setWriter);
     {
         bufferInfo->buffer  = bufferVK.GetVkBuffer();
-        bufferInfo->offset  = 0;
-        bufferInfo->range   = VK_WHOLE_SIZE;
+        bufferInfo->offset  = offset;
+        bufferInfo->range   = range;
     }
     auto writeDesc = setWriter.NextWriteDescriptor();
     {
@@ -184,6 +270,25 @@ static VkImageLayout GetShaderReadOptimalImageLayout(Format format)
 
 void VKDescriptorCache::EmplaceTextureDescriptor(VKTexture& textureVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
 {
+    if (HasPushDescriptors())
+    {
+        /* Overwrite the retained descriptor for this binding */
+        const std::uint32_t index = FindPushDescriptorIndex(binding);
+        VkDescriptorImageInfo& imageInfo = pushImageInfos_[index];
+        {
+            imageInfo.sampler       = VK_NULL_HANDLE;
+            imageInfo.imageView     = textureVK.GetVkImageView();
+            imageInfo.imageLayout   = GetShaderReadOptimalImageLayout(textureVK.GetFormat());
+        }
+        VkWriteDescriptorSet& writeDesc = pushWrites_[index];
+        {
+            writeDesc.pImageInfo        = &imageInfo;
+            writeDesc.pBufferInfo       = nullptr;
+        }
+        pushWrittenMask_ |= (1u << index);
+        return;
+    }
+
     auto imageInfo = NextImageInfoOrUpdateCache(setWriter);
     {
         imageInfo->sampler       = VK_NULL_HANDLE;
@@ -205,6 +310,25 @@ void VKDescriptorCache::EmplaceTextureDescriptor(VKTexture& textureVK, const VKL
 
 void VKDescriptorCache::EmplaceSamplerDescriptor(VKSampler& samplerVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
 {
+    if (HasPushDescriptors())
+    {
+        /* Overwrite the retained descriptor for this binding */
+        const std::uint32_t index = FindPushDescriptorIndex(binding);
+        VkDescriptorImageInfo& imageInfo = pushImageInfos_[index];
+        {
+            imageInfo.sampler       = samplerVK.GetVkSampler();
+            imageInfo.imageView     = VK_NULL_HANDLE;
+            imageInfo.imageLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        VkWriteDescriptorSet& writeDesc = pushWrites_[index];
+        {
+            writeDesc.pImageInfo        = &imageInfo;
+            writeDesc.pBufferInfo       = nullptr;
+        }
+        pushWrittenMask_ |= (1u << index);
+        return;
+    }
+
     auto imageInfo = NextImageInfoOrUpdateCache(setWriter);
     {
         imageInfo->sampler          = samplerVK.GetVkSampler();
@@ -304,6 +428,43 @@ void VKDescriptorCache::UpdateCopyDescriptorSet(VkDescriptorSet dstSet)
         copyDesc.dstSet = dstSet;
 }
 
+void VKDescriptorCache::BuildPushDescriptors(const ArrayView<VKLayoutBinding>& bindings)
+{
+    /* Pre-allocate one descriptor write per binding; the info arrays are never resized, so the write descriptors can point into them */
+    const std::size_t numBindings = bindings.size();
+    pushWrites_.resize(numBindings);
+    pushBufferInfos_.resize(numBindings);
+    pushImageInfos_.resize(numBindings);
+
+    for_range(i, numBindings)
+    {
+        VkWriteDescriptorSet& writeDesc = pushWrites_[i];
+        {
+            writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDesc.pNext             = nullptr;
+            writeDesc.dstSet            = VK_NULL_HANDLE; // Ignored by vkCmdPushDescriptorSetKHR
+            writeDesc.dstBinding        = bindings[i].dstBinding;
+            writeDesc.dstArrayElement   = 0;
+            writeDesc.descriptorCount   = 1;
+            writeDesc.descriptorType    = bindings[i].descriptorType;
+            writeDesc.pImageInfo        = nullptr;
+            writeDesc.pBufferInfo       = nullptr;
+            writeDesc.pTexelBufferView  = nullptr;
+        }
+    }
+}
+
+std::uint32_t VKDescriptorCache::FindPushDescriptorIndex(const VKLayoutBinding& binding) const
+{
+    /* Push descriptors are limited to LLGL_VK_MAX_NUM_PUSH_DESCRIPTORS, so a linear search is sufficient */
+    for_range(i, pushWrites_.size())
+    {
+        if (pushWrites_[i].dstBinding == binding.dstBinding)
+            return static_cast<std::uint32_t>(i);
+    }
+    LLGL_TRAP("binding %u not found in push descriptor cache", binding.dstBinding);
+}
+
 
 } // /namespace LLGL
 
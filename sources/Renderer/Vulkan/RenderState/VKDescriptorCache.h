@@ -10,11 +10,11 @@
 
 
 #include "../Vulkan.h"
+#include "../VKPtr.h"
 #include "VKPipelineLayout.h"
 #include "VKDescriptorSetWriter.h"
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/ArrayView.h>
-#include <mutex>
 
 
 namespace LLGL
@@ -27,7 +27,13 @@ class VKSampler;
 class VKStagingDescriptorSetPool;
 struct VKLayoutBinding;
 
-// Vulkan descriptor wrapper to manage dynamic descriptor bindings.
+/*
+Vulkan descriptor wrapper to manage dynamic descriptor bindings.
+Each command buffer owns its own instance for each pipeline layout (see VKPipelineLayout::CreateDescriptorCache),
+so multiple threads can record command buffers without any synchronization.
+If the pipeline layout uses push descriptors (VK_KHR_push_descriptor), the cache only retains one descriptor write per binding
+and no descriptor sets are allocated or copied at all.
+*/
 class VKDescriptorCache
 {
 
@@ -35,11 +41,11 @@ class VKDescriptorCache
 
         VKDescriptorCache(
             VkDevice                            device,
-            VkDescriptorPool                    descriptorPool,
             VkDescriptorSetLayout               setLayout,
             std::uint32_t                       numSizes,
             const VkDescriptorPoolSize*         sizes,
-            const ArrayView<VKLayoutBinding>&   bindings
+            const ArrayView<VKLayoutBinding>&   bindings,
+            bool                                pushDescriptors = false
         );
 
         // Resets the descriptor cache.
@@ -48,12 +54,27 @@ class VKDescriptorCache
         // Emplaces a descriptor into the cache for the specified resource.
         void EmplaceDescriptor(Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
+        // Emplaces a descriptor into the cache for the specified buffer range.
+        void EmplaceBufferRangeDescriptor(
+            VKBuffer&               bufferVK,
+            VkDeviceSize            offset,
+            VkDeviceSize            range,
+            const VKLayoutBinding&  binding,
+            VKDescriptorSetWriter&  setWriter
+        );
+
         /*
         Flushes all changed descriptor by allocating a new descriptor set.
         Otherwise, no changes took place (i.e. IsInvalidated() is false) and VK_NULL_HANDLE is returned.
         */
         VkDescriptorSet FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter);
 
+        /*
+        Flushes all descriptors that have been written so far for 'vkCmdPushDescriptorSetKHR' and returns the number of writes in 'outWrites'.
+        Returns 0 if no changes took place (i.e. IsInvalidated() is false). Only valid if HasPushDescriptors() is true.
+        */
+        std::uint32_t FlushPushDescriptors(const VkWriteDescriptorSet*& outWrites);
+
         // Returns true if any cache entries are invalidated and need to be flushed again.
         inline bool IsInvalidated() const
         {
@@ -66,28 +87,49 @@ class VKDescriptorCache
             return numDescriptors_;
         }
 
+        // Returns true if this cache records push descriptors instead of allocating descriptor sets.
+        inline bool HasPushDescriptors() const
+        {
+            return !pushWrites_.empty();
+        }
+
     private:
 
         VkDescriptorBufferInfo* NextBufferInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
         VkDescriptorImageInfo* NextImageInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
 
-        void EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
+        void EmplaceBufferDescriptor(
+            VKBuffer&               bufferVK,
+            VkDeviceSize            offset,
+            VkDeviceSize            range,
+            const VKLayoutBinding&  binding,
+            VKDescriptorSetWriter&  setWriter
+        );
         void EmplaceTextureDescriptor(VKTexture& textureVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
         void EmplaceSamplerDescriptor(VKSampler& samplerVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
         void BuildCopyDescriptors(ArrayView<VKLayoutBinding> bindings);
         void UpdateCopyDescriptorSet(VkDescriptorSet dstSet);
 
+        void BuildPushDescriptors(const ArrayView<VKLayoutBinding>& bindings);
+        std::uint32_t FindPushDescriptorIndex(const VKLayoutBinding& binding) const;
+
     private:
 
         VkDevice                                device_         = VK_NULL_HANDLE;
+        VKPtr<VkDescriptorPool>                 descriptorPool_;                    // Pool for the cached descriptor set only.
         VkDescriptorSetLayout                   setLayout_      = VK_NULL_HANDLE;
         VkDescriptorSet                         descriptorSet_  = VK_NULL_HANDLE;   // Cached Vulkan descriptor set.
         SmallVector<VkDescriptorPoolSize, 4>    poolSizes_;
 
         std::uint32_t                           numDescriptors_ = 0;                // Total number of descriptors in cache.
         SmallVector<VkCopyDescriptorSet, 4>     copyDescs_;
-        std::mutex                              copyDescMutex_;
+
+        SmallVector<VkWriteDescriptorSet, 8>    pushWrites_;                        // One descriptor write per binding; only used with push descriptors.
+        SmallVector<VkWriteDescriptorSet, 8>    pushWritesCompact_;                 // Written descriptors only, if not all bindings have been written yet.
+        SmallVector<VkDescriptorBufferInfo, 8>  pushBufferInfos_;
+        SmallVector<VkDescriptorImageInfo, 8>   pushImageInfos_;
+        std::uint32_t                           pushWrittenMask_ = 0;              // Bitmask of bindings that have been written at least once.
 
         bool                                    dirty_          = false;
 
@@ -7,15 +7,39 @@
 
 #include "VKFence.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
 
 
 namespace LLGL
 {
 
 
-VKFence::VKFence(VkDevice device) :
-    fence_ { device, vkDestroyFence }
+VKFence::VKFence(VkDevice device, bool timeline) :
+    fence_     { device, vkDestroyFence     },
+    semaphore_ { device, vkDestroySemaphore }
 {
+    #ifdef VK_KHR_timeline_semaphore
+    if (timeline)
+    {
+        VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+        {
+            typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+            typeCreateInfo.pNext            = nullptr;
+            typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+            typeCreateInfo.initialValue     = 0;
+        }
+        VkSemaphoreCreateInfo createInfo;
+        {
+            createInfo.sType    = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext    = &typeCreateInfo;
+            createInfo.flags    = 0;
+        }
+        auto result = vkCreateSemaphore(device, &createInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+        return;
+    }
+    #endif // /VK_KHR_timeline_semaphore
+
     VkFenceCreateInfo createInfo;
     {
         createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -28,14 +52,45 @@ VKFence::VKFence(VkDevice device) :
 
 void VKFence::Reset(VkDevice device)
 {
-    vkResetFences(device, 1, fence_.GetAddressOf());
+    /* Timeline semaphores never need to be reset, since each submission signals a new value */
+    if (!IsTimeline())
+        vkResetFences(device, 1, fence_.GetAddressOf());
 }
 
 bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
 {
+    #ifdef VK_KHR_timeline_semaphore
+    if (IsTimeline())
+    {
+        if (timeout == 0)
+        {
+            /* Poll counter value without entering a wait */
+            std::uint64_t value = 0;
+            vkGetSemaphoreCounterValueKHR(device, semaphore_, &value);
+            return (value >= signalValue_);
+        }
+
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = semaphore_.GetAddressOf();
+            waitInfo.pValues        = &signalValue_;
+        }
+        return (vkWaitSemaphoresKHR(device, &waitInfo, timeout) == VK_SUCCESS);
+    }
+    #endif // /VK_KHR_timeline_semaphore
+
     return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
 }
 
+std::uint64_t VKFence::NextSignalValue()
+{
+    return ++signalValue_;
+}
+
 
 } // /namespace LLGL
 
@@ -19,25 +19,53 @@ namespace LLGL
 {
 
 
+/*
+Vulkan fence that is either backed by a binary VkFence or by a timeline VkSemaphore.
+In timeline mode, each submission signals the next 64-bit counter value, so the fence never needs to be reset
+and can be polled on the CPU by reading the current counter value.
+*/
 class VKFence final : public Fence
 {
 
     public:
 
-        VKFence(VkDevice device);
+        VKFence(VkDevice device, bool timeline = false);
 
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
-        // Returns the native VkFence handle.
+        // Increments and returns the value the next submission must signal. Only valid in timeline mode.
+        std::uint64_t NextSignalValue();
+
+        // Returns true if this fence is backed by a timeline semaphore.
+        inline bool IsTimeline() const
+        {
+            return (semaphore_.Get() != VK_NULL_HANDLE);
+        }
+
+        // Returns the native VkFence handle. This is VK_NULL_HANDLE in timeline mode.
         inline VkFence GetVkFence() const
         {
             return fence_;
         }
 
+        // Returns the native timeline VkSemaphore handle. This is VK_NULL_HANDLE if this is a binary fence.
+        inline VkSemaphore GetVkSemaphore() const
+        {
+            return semaphore_;
+        }
+
+        // Returns the most recent value that has been submitted for signaling.
+        inline std::uint64_t GetSignalValue() const
+        {
+            return signalValue_;
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  semaphore_;
+        std::uint64_t       signalValue_    = 0;
 
 };
 
@@ -16,6 +16,7 @@
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
 #include <cstddef>
+#include <algorithm>
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Utils/TypeNames.h>
@@ -33,11 +34,13 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    VKPipelineLibrary*                  pipelineLibrary)
 :
     VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
     scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
-    hasDynamicScissor_ { desc.scissors.empty()                                                                 }
+    hasDynamicScissor_ { desc.scissors.empty()                                                                 },
+    pipelineLibrary_   { pipelineLibrary                                                                       }
 {
     /* Get render pass from descriptor or default render pass */
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
@@ -46,11 +49,17 @@ VKGraphicsPSO::VKGraphicsPSO(
     /* Create Vulkan graphics pipeline object */
     const VKRenderPass* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
     if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative());
+        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNativeForCurrentThread());
     else
         CreateVkPipeline(device, *renderPassVK, limits, desc);
 }
 
+VKGraphicsPSO::~VKGraphicsPSO()
+{
+    if (derivativeHash_ != 0)
+        pipelineLibrary_->UnregisterParentPipeline(derivativeHash_, GetVkPipeline());
+}
+
 
 /*
  * ======= Private: =======
@@ -285,6 +294,37 @@ static void CreateDynamicState(
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_BLEND_CONSTANTS);
     if (desc.stencil.referenceDynamic)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
+    if ((desc.dynamicStates & DynamicStateFlags::DepthBias) != 0)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS);
+
+    #ifdef VK_EXT_extended_dynamic_state
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        if ((desc.dynamicStates & DynamicStateFlags::CullMode) != 0)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        if ((desc.dynamicStates & DynamicStateFlags::PrimitiveTopology) != 0)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+        if ((desc.dynamicStates & DynamicStateFlags::DepthState) != 0)
+        {
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        }
+        if ((desc.dynamicStates & DynamicStateFlags::StencilState) != 0)
+        {
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
+        }
+    }
+    #endif // /VK_EXT_extended_dynamic_state
+
+    #ifdef VK_KHR_fragment_shading_rate
+    /* Shading rate is always dynamic, since it is independent of the PSO in the LLGL interface */
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
+    #endif
 
     createInfo.sType                = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     createInfo.pNext                = nullptr;
@@ -300,11 +340,12 @@ bool VKGraphicsPSO::CreateVkPipeline(
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineCache                     pipelineCache)
 {
-    /* Get shader program object */
+    /* Get shader program object; mesh pipelines have no vertex input */
     const VKShader* vertexShaderVK = LLGL_CAST(const VKShader*, desc.vertexShader);
-    if (vertexShaderVK == nullptr)
+    const bool isMeshPipeline = (desc.meshShader != nullptr);
+    if (vertexShaderVK == nullptr && !isMeshPipeline)
     {
-        GetMutableReport().Errorf("cannot create Vulkan graphics pipeline without vertex shader\n");
+        GetMutableReport().Errorf("cannot create Vulkan graphics pipeline without vertex or mesh shader\n");
         return false;
     }
 
@@ -338,13 +379,21 @@ bool VKGraphicsPSO::CreateVkPipeline(
     FillAndAppendShaderStageCreateInfo(desc.tessControlShader,      shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.tessEvaluationShader,   shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.geometryShader,         shaderStageCreateInfos, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.taskShader,             shaderStageCreateInfos, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.meshShader,             shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.fragmentShader,         shaderStageCreateInfos, shaderCreationFailed);
     if (shaderCreationFailed)
         return false;
 
     /* Initialize vertex input descriptor */
-    VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
-    vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
+    VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo = {};
+    if (!desc.vertexStreams.empty())
+    {
+        /* Vertex pulling fetches all attributes from storage buffers, so the vertex input state remains empty */
+        vertexInputCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    }
+    else if (vertexShaderVK != nullptr)
+        vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
 
     /* Initialize input assembly state */
     VkPipelineInputAssemblyStateCreateInfo inputAssembly;
@@ -365,6 +414,10 @@ bool VKGraphicsPSO::CreateVkPipeline(
     VkPipelineRasterizationConservativeStateCreateInfoEXT createInfoConservativeRasterExt;
     CreateRasterizerState(desc.rasterizer, limits, rasterizerState, createInfoConservativeRasterExt);
 
+    /* Depth bias must be enabled statically for its dynamic state to take effect */
+    if ((desc.dynamicStates & DynamicStateFlags::DepthBias) != 0)
+        rasterizerState.depthBiasEnable = VK_TRUE;
+
     /* Initialize multi-sample state */
     VkPipelineMultisampleStateCreateInfo multisampleState;
     const VkSampleCountFlagBits sampleCountBits = (desc.rasterizer.multiSampleEnabled ? renderPass.GetSampleCountBits() : VK_SAMPLE_COUNT_1_BIT);
@@ -377,24 +430,36 @@ bool VKGraphicsPSO::CreateVkPipeline(
     /* Initialize color-blend state */
     std::vector<VkPipelineColorBlendAttachmentState> attachmentStatesVK;
     VkPipelineColorBlendStateCreateInfo colorBlendState;
-    CreateColorBlendState(desc.blend, colorBlendState, attachmentStatesVK, renderPass.GetNumColorAttachments());
+    CreateColorBlendState(desc.blend, colorBlendState, attachmentStatesVK, renderPass.GetNumSubpassColorAttachments(desc.subpass));
 
     /* Initialize dynamic state */
     std::vector<VkDynamicState> dynamicStatesVK;
     VkPipelineDynamicStateCreateInfo dynamicState;
     CreateDynamicState(desc, dynamicState, dynamicStatesVK);
 
+    /* Specify attachment formats instead of a native render pass object with dynamic rendering */
+    const void* createInfoNext = nullptr;
+
+    #ifdef VK_KHR_dynamic_rendering
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+    if (renderPass.UsesDynamicRendering())
+    {
+        renderPass.FillPipelineRenderingCreateInfo(renderingCreateInfo);
+        createInfoNext = &renderingCreateInfo;
+    }
+    #endif
+
     /* Create graphics pipeline state object */
     VkGraphicsPipelineCreateInfo createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        createInfo.pNext                = nullptr;
+        createInfo.pNext                = createInfoNext;
         createInfo.flags                = 0;
         createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
         createInfo.pStages              = shaderStageCreateInfos.data();
-        createInfo.pVertexInputState    = (&vertexInputCreateInfo);
-        createInfo.pInputAssemblyState  = (&inputAssembly);
-        createInfo.pTessellationState   = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
+        createInfo.pVertexInputState    = (isMeshPipeline ? nullptr : &vertexInputCreateInfo);
+        createInfo.pInputAssemblyState  = (isMeshPipeline ? nullptr : &inputAssembly);
+        createInfo.pTessellationState   = (!isMeshPipeline && inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
         createInfo.pViewportState       = (&viewportState);
         createInfo.pRasterizationState  = (&rasterizerState);
         createInfo.pMultisampleState    = (&multisampleState);
@@ -403,14 +468,394 @@ bool VKGraphicsPSO::CreateVkPipeline(
         createInfo.pDynamicState        = (!dynamicStatesVK.empty() ? &dynamicState : nullptr);
         createInfo.layout               = GetVkPipelineLayout();
         createInfo.renderPass           = renderPass.GetVkRenderPass();
-        createInfo.subpass              = 0;
+        createInfo.subpass              = desc.subpass;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
+
+    if (pipelineLibrary_ != nullptr)
+    {
+        /* Mesh pipelines have no vertex input interface, so they cannot be linked from the library parts */
+        if (pipelineLibrary_->HasGraphicsPipelineLibrary() && !isMeshPipeline)
+            LinkVkPipelineFromLibraryParts(device, createInfo, renderPass, desc, pipelineCache);
+        else
+            CreateVkPipelineDerivative(device, createInfo, desc, pipelineCache);
+    }
+    else
+    {
+        VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
+        VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+    }
+
+    return true;
+}
+
+// FNV-1a hash over the members of partial pipeline states. Only types without padding bytes must be appended.
+class VKPipelineStateHasher
+{
+
+    public:
+
+        template <typename T>
+        void Append(const T& value)
+        {
+            const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            for_range(i, sizeof(T))
+            {
+                hash_ ^= bytes[i];
+                hash_ *= 0x00000100000001B3ull;
+            }
+        }
+
+        template <typename T>
+        void AppendArray(const T* values, std::uint32_t count)
+        {
+            Append(count);
+            if (values != nullptr)
+            {
+                for_range(i, count)
+                    Append(values[i]);
+            }
+        }
+
+        inline std::uint64_t Get() const
+        {
+            return hash_;
+        }
+
+    private:
+
+        std::uint64_t hash_ = 0xCBF29CE484222325ull;
+
+};
+
+static std::uint64_t GetShaderUniqueID(const Shader* shader)
+{
+    return (shader != nullptr ? LLGL_CAST(const VKShader*, shader)->GetUniqueID() : 0);
+}
+
+static VKPipelineLibraryPart GetLibraryPartForDynamicState(VkDynamicState state)
+{
+    switch (state)
+    {
+        case VK_DYNAMIC_STATE_VIEWPORT:                 return VKPipelineLibraryPart_PreRasterization;
+        case VK_DYNAMIC_STATE_SCISSOR:                  return VKPipelineLibraryPart_PreRasterization;
+        case VK_DYNAMIC_STATE_DEPTH_BIAS:               return VKPipelineLibraryPart_PreRasterization;
+        case VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK:     return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_STENCIL_WRITE_MASK:       return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_STENCIL_REFERENCE:        return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_BLEND_CONSTANTS:          return VKPipelineLibraryPart_FragmentOutput;
+        #ifdef VK_EXT_extended_dynamic_state
+        case VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT:   return VKPipelineLibraryPart_VertexInput;
+        case VK_DYNAMIC_STATE_CULL_MODE_EXT:            return VKPipelineLibraryPart_PreRasterization;
+        case VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT:    return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT:   return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT:     return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT:  return VKPipelineLibraryPart_FragmentShader;
+        case VK_DYNAMIC_STATE_STENCIL_OP_EXT:           return VKPipelineLibraryPart_FragmentShader;
+        #endif // /VK_EXT_extended_dynamic_state
+        #ifdef VK_KHR_fragment_shading_rate
+        case VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR: return VKPipelineLibraryPart_PreRasterization;
+        #endif
+        default:                                        return VKPipelineLibraryPart_Num;
+    }
+}
+
+static void AppendMultisampleStateToHash(VKPipelineStateHasher& hasher, const VkPipelineMultisampleStateCreateInfo& state)
+{
+    hasher.Append(state.rasterizationSamples);
+    hasher.Append(state.sampleShadingEnable);
+    hasher.Append(state.minSampleShading);
+    hasher.Append(state.pSampleMask != nullptr ? *state.pSampleMask : ~0u);
+    hasher.Append(state.alphaToCoverageEnable);
+    hasher.Append(state.alphaToOneEnable);
+}
+
+static void AppendDynamicStateToHash(VKPipelineStateHasher& hasher, const VkPipelineDynamicStateCreateInfo& state)
+{
+    hasher.AppendArray(state.pDynamicStates, state.dynamicStateCount);
+}
+
+static void InitLibraryPartCreateInfo(VkGraphicsPipelineCreateInfo& createInfo)
+{
+    createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.pNext                = nullptr;
+    createInfo.flags                = 0;
+    createInfo.stageCount           = 0;
+    createInfo.pStages              = nullptr;
+    createInfo.pVertexInputState    = nullptr;
+    createInfo.pInputAssemblyState  = nullptr;
+    createInfo.pTessellationState   = nullptr;
+    createInfo.pViewportState       = nullptr;
+    createInfo.pRasterizationState  = nullptr;
+    createInfo.pMultisampleState    = nullptr;
+    createInfo.pDepthStencilState   = nullptr;
+    createInfo.pColorBlendState     = nullptr;
+    createInfo.pDynamicState        = nullptr;
+    createInfo.layout               = VK_NULL_HANDLE;
+    createInfo.renderPass           = VK_NULL_HANDLE;
+    createInfo.subpass              = 0;
+    createInfo.basePipelineHandle   = VK_NULL_HANDLE;
+    createInfo.basePipelineIndex    = -1;
+}
+
+void VKGraphicsPSO::LinkVkPipelineFromLibraryParts(
+    VkDevice                            device,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    const VKRenderPass&                 renderPass,
+    const GraphicsPipelineDescriptor&   desc,
+    VkPipelineCache                     pipelineCache)
+{
+    #if defined VK_EXT_graphics_pipeline_library && defined VK_KHR_pipeline_library
+
+    const std::uint64_t layoutHash      = GetPipelineLayoutHash();
+    const std::uint64_t renderPassID    = renderPass.GetUniqueID();
+
+    /* Split shader stages into pre-rasterization and fragment shader stages */
+    SmallVector<VkPipelineShaderStageCreateInfo, 4> preRasterStages;
+    const VkPipelineShaderStageCreateInfo* fragmentStage = nullptr;
+
+    for_range(i, createInfo.stageCount)
+    {
+        if (createInfo.pStages[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+            fragmentStage = &(createInfo.pStages[i]);
+        else
+            preRasterStages.push_back(createInfo.pStages[i]);
+    }
+
+    /* Split dynamic states into the library parts they belong to */
+    std::vector<VkDynamicState>         partDynamicStatesVK[VKPipelineLibraryPart_Num];
+    VkPipelineDynamicStateCreateInfo    partDynamicStates[VKPipelineLibraryPart_Num];
+
+    if (createInfo.pDynamicState != nullptr)
+    {
+        for_range(i, createInfo.pDynamicState->dynamicStateCount)
+        {
+            const VkDynamicState state = createInfo.pDynamicState->pDynamicStates[i];
+            const VKPipelineLibraryPart part = GetLibraryPartForDynamicState(state);
+            if (part != VKPipelineLibraryPart_Num)
+                partDynamicStatesVK[part].push_back(state);
+            #ifdef VK_KHR_fragment_shading_rate
+            /* Fragment shading rate is part of both the pre-rasterization and fragment shader state */
+            if (state == VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR)
+                partDynamicStatesVK[VKPipelineLibraryPart_FragmentShader].push_back(state);
+            #endif
+        }
+    }
+
+    VkGraphicsPipelineCreateInfo    partCreateInfos[VKPipelineLibraryPart_Num];
+    VKPipelineStateHasher           partHashers[VKPipelineLibraryPart_Num];
+
+    for (int part = 0; part < VKPipelineLibraryPart_Num; ++part)
+    {
+        VkPipelineDynamicStateCreateInfo& dynamicState = partDynamicStates[part];
+        {
+            dynamicState.sType              = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+            dynamicState.pNext              = nullptr;
+            dynamicState.flags              = 0;
+            dynamicState.dynamicStateCount  = static_cast<std::uint32_t>(partDynamicStatesVK[part].size());
+            dynamicState.pDynamicStates     = (partDynamicStatesVK[part].empty() ? nullptr : partDynamicStatesVK[part].data());
+        }
+        InitLibraryPartCreateInfo(partCreateInfos[part]);
+        partCreateInfos[part].pDynamicState = (dynamicState.dynamicStateCount > 0 ? &dynamicState : nullptr);
+        AppendDynamicStateToHash(partHashers[part], dynamicState);
+    }
+
+    /* Initialize vertex input interface: vertex input and input assembly states */
+    {
+        VkGraphicsPipelineCreateInfo&   partCreateInfo  = partCreateInfos[VKPipelineLibraryPart_VertexInput];
+        VKPipelineStateHasher&          hasher          = partHashers[VKPipelineLibraryPart_VertexInput];
+
+        partCreateInfo.pVertexInputState    = createInfo.pVertexInputState;
+        partCreateInfo.pInputAssemblyState  = createInfo.pInputAssemblyState;
+
+        const VkPipelineVertexInputStateCreateInfo& vertexInput = *createInfo.pVertexInputState;
+        hasher.AppendArray(vertexInput.pVertexBindingDescriptions, vertexInput.vertexBindingDescriptionCount);
+        hasher.AppendArray(vertexInput.pVertexAttributeDescriptions, vertexInput.vertexAttributeDescriptionCount);
+        hasher.Append(createInfo.pInputAssemblyState->topology);
+        hasher.Append(createInfo.pInputAssemblyState->primitiveRestartEnable);
+    }
+
+    /* Initialize pre-rasterization shaders: vertex processing shader stages, tessellation, viewport, and rasterizer states */
+    {
+        VkGraphicsPipelineCreateInfo&   partCreateInfo  = partCreateInfos[VKPipelineLibraryPart_PreRasterization];
+        VKPipelineStateHasher&          hasher          = partHashers[VKPipelineLibraryPart_PreRasterization];
+
+        partCreateInfo.stageCount           = static_cast<std::uint32_t>(preRasterStages.size());
+        partCreateInfo.pStages              = preRasterStages.data();
+        partCreateInfo.pTessellationState   = createInfo.pTessellationState;
+        partCreateInfo.pViewportState       = createInfo.pViewportState;
+        partCreateInfo.pRasterizationState  = createInfo.pRasterizationState;
+        partCreateInfo.layout               = createInfo.layout;
+        partCreateInfo.pNext                = createInfo.pNext;
+        partCreateInfo.renderPass           = createInfo.renderPass;
+        partCreateInfo.subpass              = createInfo.subpass;
+
+        hasher.Append(layoutHash);
+        hasher.Append(renderPassID);
+        hasher.Append(createInfo.subpass);
+        hasher.Append(GetShaderUniqueID(desc.vertexShader));
+        hasher.Append(GetShaderUniqueID(desc.tessControlShader));
+        hasher.Append(GetShaderUniqueID(desc.tessEvaluationShader));
+        hasher.Append(GetShaderUniqueID(desc.geometryShader));
+        hasher.Append(createInfo.pTessellationState != nullptr ? createInfo.pTessellationState->patchControlPoints : 0u);
+
+        const VkPipelineViewportStateCreateInfo& viewportState = *createInfo.pViewportState;
+        hasher.AppendArray(viewportState.pViewports, viewportState.viewportCount);
+        hasher.AppendArray(viewportState.pScissors, viewportState.scissorCount);
+
+        const VkPipelineRasterizationStateCreateInfo& rasterizerState = *createInfo.pRasterizationState;
+        hasher.Append(rasterizerState.depthClampEnable);
+        hasher.Append(rasterizerState.rasterizerDiscardEnable);
+        hasher.Append(rasterizerState.polygonMode);
+        hasher.Append(rasterizerState.cullMode);
+        hasher.Append(rasterizerState.frontFace);
+        hasher.Append(rasterizerState.depthBiasEnable);
+        hasher.Append(rasterizerState.depthBiasConstantFactor);
+        hasher.Append(rasterizerState.depthBiasClamp);
+        hasher.Append(rasterizerState.depthBiasSlopeFactor);
+        hasher.Append(rasterizerState.lineWidth);
+        hasher.Append(desc.rasterizer.conservativeRasterization);
+    }
+
+    /* Initialize fragment shader: fragment shader stage, multi-sample, and depth-stencil states */
+    {
+        VkGraphicsPipelineCreateInfo&   partCreateInfo  = partCreateInfos[VKPipelineLibraryPart_FragmentShader];
+        VKPipelineStateHasher&          hasher          = partHashers[VKPipelineLibraryPart_FragmentShader];
+
+        partCreateInfo.stageCount           = (fragmentStage != nullptr ? 1u : 0u);
+        partCreateInfo.pStages              = fragmentStage;
+        partCreateInfo.pMultisampleState    = createInfo.pMultisampleState;
+        partCreateInfo.pDepthStencilState   = createInfo.pDepthStencilState;
+        partCreateInfo.layout               = createInfo.layout;
+        partCreateInfo.pNext                = createInfo.pNext;
+        partCreateInfo.renderPass           = createInfo.renderPass;
+        partCreateInfo.subpass              = createInfo.subpass;
+
+        hasher.Append(layoutHash);
+        hasher.Append(renderPassID);
+        hasher.Append(createInfo.subpass);
+        hasher.Append(GetShaderUniqueID(desc.fragmentShader));
+        AppendMultisampleStateToHash(hasher, *createInfo.pMultisampleState);
+
+        const VkPipelineDepthStencilStateCreateInfo& depthStencilState = *createInfo.pDepthStencilState;
+        hasher.Append(depthStencilState.depthTestEnable);
+        hasher.Append(depthStencilState.depthWriteEnable);
+        hasher.Append(depthStencilState.depthCompareOp);
+        hasher.Append(depthStencilState.depthBoundsTestEnable);
+        hasher.Append(depthStencilState.stencilTestEnable);
+        hasher.Append(depthStencilState.front);
+        hasher.Append(depthStencilState.back);
+        hasher.Append(depthStencilState.minDepthBounds);
+        hasher.Append(depthStencilState.maxDepthBounds);
+    }
+
+    /* Initialize fragment output interface: color-blend and multi-sample states */
+    {
+        VkGraphicsPipelineCreateInfo&   partCreateInfo  = partCreateInfos[VKPipelineLibraryPart_FragmentOutput];
+        VKPipelineStateHasher&          hasher          = partHashers[VKPipelineLibraryPart_FragmentOutput];
+
+        partCreateInfo.pMultisampleState    = createInfo.pMultisampleState;
+        partCreateInfo.pColorBlendState     = createInfo.pColorBlendState;
+        partCreateInfo.pNext                = createInfo.pNext;
+        partCreateInfo.renderPass           = createInfo.renderPass;
+        partCreateInfo.subpass              = createInfo.subpass;
+
+        hasher.Append(renderPassID);
+        hasher.Append(createInfo.subpass);
+        AppendMultisampleStateToHash(hasher, *createInfo.pMultisampleState);
+
+        const VkPipelineColorBlendStateCreateInfo& colorBlendState = *createInfo.pColorBlendState;
+        hasher.Append(colorBlendState.logicOpEnable);
+        hasher.Append(colorBlendState.logicOp);
+        hasher.AppendArray(colorBlendState.pAttachments, colorBlendState.attachmentCount);
+        hasher.Append(colorBlendState.blendConstants);
+    }
+
+    /* Get cached library parts or compile missing ones */
+    VkPipeline libraries[VKPipelineLibraryPart_Num];
+
+    for (int part = 0; part < VKPipelineLibraryPart_Num; ++part)
+    {
+        libraryParts_[part] = pipelineLibrary_->GetOrCreatePart(
+            static_cast<VKPipelineLibraryPart>(part),
+            partHashers[part].Get(),
+            partCreateInfos[part],
+            pipelineCache
+        );
+        libraries[part] = libraryParts_[part]->Get();
+    }
+
+    /* Link final graphics pipeline from library parts */
+    VkPipelineLibraryCreateInfoKHR libraryCreateInfo;
+    {
+        libraryCreateInfo.sType         = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+        libraryCreateInfo.pNext         = nullptr;
+        libraryCreateInfo.libraryCount  = VKPipelineLibraryPart_Num;
+        libraryCreateInfo.pLibraries    = libraries;
+    }
+    VkGraphicsPipelineCreateInfo linkCreateInfo;
+    {
+        InitLibraryPartCreateInfo(linkCreateInfo);
+        linkCreateInfo.pNext        = &libraryCreateInfo;
+        linkCreateInfo.layout       = createInfo.layout;
+        linkCreateInfo.renderPass   = createInfo.renderPass;
+        linkCreateInfo.subpass      = createInfo.subpass;
+    }
+    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &linkCreateInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
+    VKThrowIfFailed(result, "failed to link Vulkan graphics pipeline from libraries");
+
+    #endif // /VK_EXT_graphics_pipeline_library && VK_KHR_pipeline_library
+}
+
+void VKGraphicsPSO::CreateVkPipelineDerivative(
+    VkDevice                            device,
+    VkGraphicsPipelineCreateInfo&       createInfo,
+    const GraphicsPipelineDescriptor&   desc,
+    VkPipelineCache                     pipelineCache)
+{
+    /* Derive from a live PSO with the same shaders and pipeline layout, since those are the most expensive states to compile */
+    VKPipelineStateHasher hasher;
+    hasher.Append(GetPipelineLayoutHash());
+    hasher.Append(GetShaderUniqueID(desc.vertexShader));
+    hasher.Append(GetShaderUniqueID(desc.tessControlShader));
+    hasher.Append(GetShaderUniqueID(desc.tessEvaluationShader));
+    hasher.Append(GetShaderUniqueID(desc.geometryShader));
+    hasher.Append(GetShaderUniqueID(desc.taskShader));
+    hasher.Append(GetShaderUniqueID(desc.meshShader));
+    hasher.Append(GetShaderUniqueID(desc.fragmentShader));
+
+    const std::uint64_t derivativeHash = std::max<std::uint64_t>(1, hasher.Get());
+
+    createInfo.flags |= VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT;
+
+    VkPipeline parentPipeline = pipelineLibrary_->FindParentPipeline(derivativeHash);
+    if (parentPipeline != VK_NULL_HANDLE)
+    {
+        createInfo.flags                |= VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        createInfo.basePipelineHandle   = parentPipeline;
+        createInfo.basePipelineIndex    = -1;
+    }
+
     VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
     VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
 
-    return true;
+    /* Register this PSO as parent for subsequent derivatives if there is none yet */
+    if (parentPipeline == VK_NULL_HANDLE)
+    {
+        pipelineLibrary_->RegisterParentPipeline(derivativeHash, GetVkPipeline());
+        derivativeHash_ = derivativeHash;
+    }
+}
+
+std::uint64_t VKGraphicsPSO::GetPipelineLayoutHash() const
+{
+    /* Pipeline layout permutations only depend on the base pipeline layout and the push constant ranges */
+    VKPipelineStateHasher hasher;
+    hasher.Append(GetPipelineLayout() != nullptr ? GetPipelineLayout()->GetUniqueID() : 0ull);
+    hasher.AppendArray(GetUniformRanges().data(), static_cast<std::uint32_t>(GetUniformRanges().size()));
+    hasher.Append(GetHeapIndexStageFlags());
+    return hasher.Get();
 }
 
 
@@ -10,6 +10,7 @@
 
 
 #include "VKPipelineState.h"
+#include "VKPipelineLibrary.h"
 
 
 namespace LLGL
@@ -38,8 +39,10 @@ class VKGraphicsPSO final : public VKPipelineState
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits,
-            PipelineCache*                      pipelineCache       = nullptr
+            PipelineCache*                      pipelineCache       = nullptr,
+            VKPipelineLibrary*                  pipelineLibrary     = nullptr
         );
+        ~VKGraphicsPSO();
 
         // Returns true if scissors are enabled.
         inline bool IsScissorEnabled() const
@@ -63,10 +66,34 @@ class VKGraphicsPSO final : public VKPipelineState
             VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
         );
 
+        // Links the native PSO from separately compiled library parts that are shared with other PSOs.
+        void LinkVkPipelineFromLibraryParts(
+            VkDevice                            device,
+            const VkGraphicsPipelineCreateInfo& createInfo,
+            const VKRenderPass&                 renderPass,
+            const GraphicsPipelineDescriptor&   desc,
+            VkPipelineCache                     pipelineCache
+        );
+
+        // Creates the native PSO as derivative of a previously created PSO with the same shaders and pipeline layout.
+        void CreateVkPipelineDerivative(
+            VkDevice                            device,
+            VkGraphicsPipelineCreateInfo&       createInfo,
+            const GraphicsPipelineDescriptor&   desc,
+            VkPipelineCache                     pipelineCache
+        );
+
+        // Returns the hash of the pipeline layout permutation this PSO was created with.
+        std::uint64_t GetPipelineLayoutHash() const;
+
     private:
 
-        bool scissorEnabled_    = false;
-        bool hasDynamicScissor_ = false;
+        bool                        scissorEnabled_     = false;
+        bool                        hasDynamicScissor_  = false;
+
+        VKPipelineLibrary*          pipelineLibrary_    = nullptr;
+        VKPipelineLibrary::PartPtr  libraryParts_[VKPipelineLibraryPart_Num];
+        std::uint64_t               derivativeHash_     = 0;        // Hash for derivatives of this PSO; 0 if this PSO is not registered as parent pipeline.
 
 };
 
@@ -7,6 +7,7 @@
 
 #include "VKPipelineBarrier.h"
 #include "../Buffer/VKBuffer.h"
+#include "../Command/VKCommandContext.h"
 //#include "../Texture/VKTexture.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
@@ -22,20 +23,23 @@ bool VKPipelineBarrier::IsActive() const
     return (srcStageMask_ != 0 && dstStageMask_ != 0);
 }
 
-void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer)
+void VKPipelineBarrier::Submit(VKCommandContext& context)
 {
-    vkCmdPipelineBarrier(
-        commandBuffer,
-        srcStageMask_,
-        dstStageMask_,
-        0, // VkDependencyFlags
-        static_cast<std::uint32_t>(memoryBarriers_.size()),
-        memoryBarriers_.data(),
-        static_cast<std::uint32_t>(bufferBarriers_.size()),
-        bufferBarriers_.data(),
-        static_cast<std::uint32_t>(imageBarriers_.size()),
-        imageBarriers_.data()
-    );
+    for (const VkMemoryBarrier& barrier : memoryBarriers_)
+        context.GlobalMemoryBarrier(srcStageMask_, barrier.srcAccessMask, dstStageMask_, barrier.dstAccessMask);
+
+    for (const VkBufferMemoryBarrier& barrier : bufferBarriers_)
+    {
+        context.BufferMemoryBarrier(
+            barrier.buffer,
+            barrier.offset,
+            barrier.size,
+            barrier.srcAccessMask,
+            barrier.dstAccessMask,
+            srcStageMask_,
+            dstStageMask_
+        );
+    }
 }
 
 bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags)
@@ -101,6 +105,7 @@ bool VKPipelineBarrier::Update()
     srcStageMask_ = 0;
     dstStageMask_ = 0;
     memoryBarriers_.clear();
+    bufferBarriers_.clear();
 
     /* Iterate over all bindings and re-generate all barriers */
     for (const ResourceBinding& binding : bindings_)
@@ -159,8 +164,8 @@ void VKPipelineBarrier::InsertBufferMemoryBarrier(VkPipelineStageFlags stageFlag
         barrier.pNext                   = nullptr;
         barrier.srcAccessMask           = srcAccess;
         barrier.dstAccessMask           = dstAccess;
-        barrier.srcQueueFamilyIndex     = 0;
-        barrier.dstQueueFamilyIndex     = 0;
+        barrier.srcQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
         barrier.buffer                  = buffer;
         barrier.offset                  = 0;
         barrier.size                    = VK_WHOLE_SIZE;
@@ -21,6 +21,7 @@ namespace LLGL
 
 
 class Resource;
+class VKCommandContext;
 
 // Helper class to manage information for a Vulkan pipeline barrier command.
 class VKPipelineBarrier
@@ -31,8 +32,8 @@ class VKPipelineBarrier
         // Returns true if this barrier is active in any stage.
         bool IsActive() const;
 
-        // Submits this pipeline barrier into the specified command buffer.
-        void Submit(VkCommandBuffer commandBuffer);
+        // Enqueues this pipeline barrier into the specified command context, so it can be merged with other pending barriers.
+        void Submit(VKCommandContext& context);
 
         // Emplaces the specified resource into the pipeline barrier.
         bool Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags);
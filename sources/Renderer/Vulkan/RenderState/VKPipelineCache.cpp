@@ -6,7 +6,9 @@
  */
 
 #include "VKPipelineCache.h"
+#include <LLGL/Container/SmallVector.h>
 #include <cstdint>
+#include <string.h>
 
 
 namespace LLGL
@@ -18,19 +20,22 @@ VKPipelineCache::VKPipelineCache(VkDevice device, const Blob& initialBlob)
     device_ { device                         },
     cache_  { device, vkDestroyPipelineCache }
 {
-    VkPipelineCacheCreateInfo createInfo;
+    CreateVkPipelineCache(cache_.ReleaseAndGetAddressOf(), initialBlob.GetData(), initialBlob.GetSize());
+
+    /* Keep a copy of the initial blob for thread-local caches, since the blob might only be a weak reference */
+    if (initialBlob)
     {
-        createInfo.sType            = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = 0;
-        createInfo.initialDataSize  = initialBlob.GetSize();
-        createInfo.pInitialData     = initialBlob.GetData();
+        initialData_ = DynamicByteArray{ initialBlob.GetSize(), UninitializeTag{} };
+        ::memcpy(initialData_.get(), initialBlob.GetData(), initialBlob.GetSize());
     }
-    vkCreatePipelineCache(device, &createInfo, nullptr, cache_.ReleaseAndGetAddressOf());
 }
 
 Blob VKPipelineCache::GetBlob() const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    MergeThreadCaches();
+
     /* Determine cache size and return binary data */
     std::size_t dataSize = 0;
     vkGetPipelineCacheData(device_, cache_, &dataSize, nullptr);
@@ -41,6 +46,66 @@ Blob VKPipelineCache::GetBlob() const
     return Blob::CreateStrongRef(std::move(data));
 }
 
+VkPipelineCache VKPipelineCache::GetNativeForCurrentThread()
+{
+    const std::thread::id threadID = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* First thread uses the primary cache, so single-threaded use never has to merge caches */
+    if (primaryThreadID_ == std::thread::id{} || primaryThreadID_ == threadID)
+    {
+        primaryThreadID_ = threadID;
+        return cache_.Get();
+    }
+
+    /* Create thread-local cache on demand */
+    auto it = threadCaches_.find(threadID);
+    if (it == threadCaches_.end())
+    {
+        VKPtr<VkPipelineCache> threadCache{ device_, vkDestroyPipelineCache };
+        CreateVkPipelineCache(threadCache.ReleaseAndGetAddressOf(), initialData_.get(), initialData_.size());
+        it = threadCaches_.emplace(threadID, std::move(threadCache)).first;
+    }
+
+    return it->second.Get();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineCache::CreateVkPipelineCache(VkPipelineCache* outCache, const void* initialData, std::size_t initialDataSize)
+{
+    VkPipelineCacheCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = 0;
+        createInfo.initialDataSize  = initialDataSize;
+        createInfo.pInitialData     = initialData;
+    }
+    vkCreatePipelineCache(device_, &createInfo, nullptr, outCache);
+}
+
+void VKPipelineCache::MergeThreadCaches() const
+{
+    if (threadCaches_.empty())
+        return;
+
+    /*
+    Merge thread-local caches into primary cache. Thread-local caches remain valid,
+    since other threads might still create pipelines with them while this cache is serialized.
+    */
+    SmallVector<VkPipelineCache, 8> srcCaches;
+    srcCaches.reserve(threadCaches_.size());
+    for (const auto& threadCache : threadCaches_)
+        srcCaches.push_back(threadCache.second.Get());
+
+    vkMergePipelineCaches(device_, cache_, static_cast<std::uint32_t>(srcCaches.size()), srcCaches.data());
+}
+
 
 } // /namespace LLGL
 
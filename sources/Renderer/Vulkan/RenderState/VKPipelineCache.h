@@ -11,13 +11,23 @@
 
 #include <vulkan/vulkan.h>
 #include <LLGL/PipelineCache.h>
+#include <LLGL/Container/DynamicArray.h>
 #include "../VKPtr.h"
+#include <map>
+#include <mutex>
+#include <thread>
 
 
 namespace LLGL
 {
 
 
+/*
+Pipeline cache implementation with VkPipelineCache.
+Since concurrent access to a single VkPipelineCache is internally synchronized by the driver,
+each thread that creates pipelines with this cache gets its own VkPipelineCache.
+The first thread uses the primary cache directly and all thread-local caches are merged into the primary cache in GetBlob().
+*/
 class VKPipelineCache final : public PipelineCache
 {
 
@@ -29,16 +39,31 @@ class VKPipelineCache final : public PipelineCache
 
     public:
 
-        // Returns the native pipeline cache object.
+        // Returns the native primary pipeline cache object.
         inline VkPipelineCache GetNative() const
         {
             return cache_.Get();
         }
 
+        // Returns the native pipeline cache object for the calling thread. This is created on demand, initialized with the initial blob.
+        VkPipelineCache GetNativeForCurrentThread();
+
     private:
 
-        VkDevice                device_ = VK_NULL_HANDLE;
-        VKPtr<VkPipelineCache>  cache_;
+        void CreateVkPipelineCache(VkPipelineCache* outCache, const void* initialData, std::size_t initialDataSize);
+
+        // Merges all thread-local caches into the primary cache. Must be called with the mutex locked.
+        void MergeThreadCaches() const;
+
+    private:
+
+        VkDevice                                            device_             = VK_NULL_HANDLE;
+        VKPtr<VkPipelineCache>                              cache_;
+
+        mutable std::mutex                                  mutex_;
+        std::thread::id                                     primaryThreadID_;   // Thread that uses the primary cache directly
+        std::map<std::thread::id, VKPtr<VkPipelineCache>>   threadCaches_;      // Caches for all other threads
+        DynamicByteArray                                    initialData_;       // Copy of the initial blob to initialize thread-local caches
 
 };
 
@@ -10,6 +10,7 @@
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../VKStaticLimits.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../Texture/VKSampler.h"
 #include "../Shader/VKShader.h"
 #include "../Shader/VKShaderModulePool.h"
@@ -18,6 +19,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/SmallVector.h>
 #include <algorithm>
+#include <atomic>
 
 
 namespace LLGL
@@ -26,42 +28,110 @@ namespace LLGL
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::defaultPipelineLayout_;
 
-VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc) :
+static std::uint64_t GenerateUniquePipelineLayoutID()
+{
+    static std::atomic<std::uint64_t> nextID{ 1 };
+    return nextID++;
+}
+
+#ifdef VK_KHR_push_descriptor
+
+// Returns true if the specified dynamic bindings can be bound with push descriptors instead of staging descriptor sets.
+static bool CanUsePushDescriptors(const std::vector<BindingDescriptor>& bindings)
+{
+    if (!HasExtension(VKExt::KHR_push_descriptor))
+        return false;
+
+    std::uint32_t numDescriptors = 0;
+    for (const BindingDescriptor& binding : bindings)
+        numDescriptors += std::max(1u, binding.arraySize);
+
+    return (numDescriptors <= LLGL_VK_MAX_NUM_PUSH_DESCRIPTORS);
+}
+
+#endif // /VK_KHR_push_descriptor
+
+VKPipelineLayout::VKPipelineLayout(
+    VkDevice                        device,
+    VKSamplerPool&                  samplerPool,
+    const PipelineLayoutDescriptor& desc,
+    const VKBindlessConfig&         bindlessConfig)
+:
     pipelineLayout_ { device, vkDestroyPipelineLayout          },
     setLayouts_     { { device, vkDestroyDescriptorSetLayout },
                       { device, vkDestroyDescriptorSetLayout },
                       { device, vkDestroyDescriptorSetLayout } },
     descriptorPool_ { device, vkDestroyDescriptorPool          },
+    uniqueID_       { GenerateUniquePipelineLayoutID()         },
+    samplerPool_    { samplerPool                              },
     uniformDescs_   { desc.uniforms                            },
     barrierFlags_   { desc.barrierFlags                        }
 {
     /* Create Vulkan descriptor set layouts */
     if (!desc.heapBindings.empty())
-        CreateBindingSetLayout(device, desc.heapBindings, heapBindings_, SetLayoutType_HeapBindings);
+    {
+        if (bindlessConfig.capacity > 0)
+            CreateBindlessHeapSetLayout(device, desc.heapBindings, bindlessConfig);
+        else
+            CreateBindingSetLayout(device, desc.heapBindings, heapBindings_, SetLayoutType_HeapBindings);
+    }
     if (!desc.bindings.empty())
-        CreateBindingSetLayout(device, desc.bindings, bindings_, SetLayoutType_DynamicBindings);
+    {
+        #ifdef VK_KHR_push_descriptor
+        if (CanUsePushDescriptors(desc.bindings))
+        {
+            /* Dynamic bindings are pushed directly into the command buffer; no descriptor sets are allocated for this layout */
+            CreateBindingSetLayout(device, desc.bindings, bindings_, SetLayoutType_DynamicBindings, VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+            pushDescriptors_ = true;
+        }
+        else
+        #endif // /VK_KHR_push_descriptor
+        {
+            CreateBindingSetLayout(device, desc.bindings, bindings_, SetLayoutType_DynamicBindings);
+        }
+    }
     if (!desc.staticSamplers.empty())
-        CreateImmutableSamplers(device, desc.staticSamplers);
+        CreateImmutableSamplers(device, samplerPool, desc.staticSamplers);
 
-    /* Create descriptor pool for dynamic descriptors and immutable samplers */
-    if (!desc.bindings.empty() || !desc.staticSamplers.empty())
-        CreateDescriptorPool(device);
-    if (!desc.bindings.empty())
-        CreateDescriptorCache(device, setLayouts_[SetLayoutType_DynamicBindings].Get());
+    /* Create descriptor pool for immutable samplers; descriptor caches for dynamic descriptors are owned by each command buffer */
     if (!desc.staticSamplers.empty())
+    {
+        CreateDescriptorPool(device);
         CreateStaticDescriptorSet(device, setLayouts_[SetLayoutType_ImmutableSamplers].Get());
+    }
 
     /* Don't create a VkPipelineLayout object if this instance only has push constants as those are part of the permutations for each PSO */
     if (!desc.heapBindings.empty() || !desc.bindings.empty() || !desc.staticSamplers.empty())
     {
         BuildDescriptorSetBindingTables(desc);
-        pipelineLayout_ = CreateVkPipelineLayout(device);
+        if (IsBindless())
+        {
+            /* Reserve first 4 bytes of push constants for the bindless heap index */
+            VkPushConstantRange heapIndexRange;
+            {
+                heapIndexRange.stageFlags   = heapIndexStageFlags_;
+                heapIndexRange.offset       = 0;
+                heapIndexRange.size         = sizeof(std::uint32_t);
+            }
+            pipelineLayout_ = CreateVkPipelineLayout(device, { heapIndexRange });
+        }
+        else
+            pipelineLayout_ = CreateVkPipelineLayout(device);
     }
 }
 
 VKPipelineLayout::~VKPipelineLayout()
 {
     VKShaderModulePool::Get().NotifyReleasePipelineLayout(this);
+
+    /* Release immutable samplers after all objects that refer to them have been destroyed */
+    pipelineLayout_.Release();
+    for (VKPtr<VkDescriptorSetLayout>& setLayout : setLayouts_)
+        setLayout.Release();
+    descriptorPool_.Release();
+
+    for (VkSampler sampler : immutableSamplers_)
+        samplerPool_.Release(sampler);
 }
 
 std::uint32_t VKPipelineLayout::GetNumHeapBindings() const
@@ -165,16 +235,64 @@ static void BuildPushConstantRanges(
     );
 }
 
+// Extends the push constant ranges of all stages to offset 0 to include the bindless heap index and returns the stage flags to push the index with.
+static VkShaderStageFlags MergeHeapIndexPushConstantRange(
+    const ArrayView<UniformDescriptor>&         uniformDescs,
+    const std::vector<VkPushConstantRange>&     uniformRanges,
+    std::vector<VkPushConstantRange>&           stageRanges,
+    VkShaderStageFlags                          heapIndexStageFlags)
+{
+    /* Uniforms must be declared after the heap index in the push constant block */
+    for_range(i, uniformRanges.size())
+    {
+        if (uniformRanges[i].size > 0 && uniformRanges[i].offset < sizeof(std::uint32_t))
+        {
+            LLGL_TRAP(
+                "uniform '%s' overlaps with bindless resource heap index at push constant offset 0",
+                uniformDescs[i].name.c_str()
+            );
+        }
+    }
+
+    /* No two push constant ranges must share the same stage, so extend the existing ranges instead of adding a new one */
+    VkShaderStageFlags stageFlags = 0;
+    for (VkPushConstantRange& range : stageRanges)
+    {
+        range.size      += range.offset;
+        range.offset    = 0;
+        stageFlags      |= range.stageFlags;
+    }
+
+    /* Add range for all remaining stages that read the heap index */
+    if (const VkShaderStageFlags remainingStageFlags = (heapIndexStageFlags & ~stageFlags))
+    {
+        VkPushConstantRange heapIndexRange;
+        {
+            heapIndexRange.stageFlags   = remainingStageFlags;
+            heapIndexRange.offset       = 0;
+            heapIndexRange.size         = sizeof(std::uint32_t);
+        }
+        stageRanges.push_back(heapIndexRange);
+        stageFlags |= remainingStageFlags;
+    }
+
+    return stageFlags;
+}
+
 VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayoutPermutation(
     VkDevice                            device,
     const ArrayView<Shader*>&           shaders,
-    std::vector<VkPushConstantRange>&   outUniformRanges) const
+    std::vector<VkPushConstantRange>&   outUniformRanges,
+    VkShaderStageFlags&                 outHeapIndexStageFlags) const
 {
+    outHeapIndexStageFlags = heapIndexStageFlags_;
     #ifdef LLGL_ENABLE_SPIRV_REFLECT
     if (!uniformDescs_.empty())
     {
         std::vector<VkPushConstantRange> pushConstantRangesPerStage;
         BuildPushConstantRanges(shaders, uniformDescs_, pushConstantRangesPerStage, outUniformRanges);
+        if (IsBindless())
+            outHeapIndexStageFlags = MergeHeapIndexPushConstantRange(uniformDescs_, outUniformRanges, pushConstantRangesPerStage, heapIndexStageFlags_);
         return CreateVkPipelineLayout(device, pushConstantRangesPerStage);
     }
     #else
@@ -206,10 +324,35 @@ bool VKPipelineLayout::NeedsShaderModulePermutation(const VKShader& shaderVK) co
     );
 }
 
-VKPtr<VkShaderModule> VKPipelineLayout::CreateVkShaderModulePermutation(VKShader& shaderVK) const
+bool VKPipelineLayout::BuildShaderCodePermutation(const VKShader& shaderVK, VKShaderCode& outShaderCode) const
 {
-    return shaderVK.CreateVkShaderModulePermutation(
-        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)
+    return shaderVK.BuildShaderCodePermutation(
+        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+        outShaderCode
+    );
+}
+
+std::unique_ptr<VKDescriptorCache> VKPipelineLayout::CreateDescriptorCache(VkDevice device) const
+{
+    if (bindings_.empty())
+        return nullptr;
+
+    /*
+    Don't account descriptors in the dynamic cache for immutable samplers,
+    so accumulate pool sizes only for dynamic resources here
+    */
+    VKPoolSizeAccumulator poolSizeAccum;
+    for (const auto binding : bindings_)
+        poolSizeAccum.Accumulate(binding.descriptorType);
+    poolSizeAccum.Finalize();
+
+    return MakeUnique<VKDescriptorCache>(
+        device,
+        setLayouts_[SetLayoutType_DynamicBindings].Get(),
+        poolSizeAccum.Size(),
+        poolSizeAccum.Data(),
+        bindings_,
+        pushDescriptors_
     );
 }
 
@@ -251,6 +394,15 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     if ((flags & StageFlags::FragmentStage      ) != 0) { bitmask |= VK_SHADER_STAGE_FRAGMENT_BIT;                }
     if ((flags & StageFlags::ComputeStage       ) != 0) { bitmask |= VK_SHADER_STAGE_COMPUTE_BIT;                 }
 
+    #ifdef VK_EXT_mesh_shader
+    /* Mesh pipeline stages are included in StageFlags::AllGraphicsStages, so only use them when the extension is enabled */
+    if (HasExtension(VKExt::EXT_mesh_shader))
+    {
+        if ((flags & StageFlags::TaskStage      ) != 0) { bitmask |= VK_SHADER_STAGE_TASK_BIT_EXT;                }
+        if ((flags & StageFlags::MeshStage      ) != 0) { bitmask |= VK_SHADER_STAGE_MESH_BIT_EXT;                }
+    }
+    #endif // /VK_EXT_mesh_shader
+
     return bitmask;
 }
 
@@ -262,6 +414,8 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
         case ResourceType::Sampler:
             return VK_DESCRIPTOR_TYPE_SAMPLER;
         case ResourceType::Texture:
+            if ((desc.bindFlags & BindFlags::InputAttachment) != 0)
+                return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case ResourceType::Buffer:
             if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -278,13 +432,15 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
 void VKPipelineLayout::CreateVkDescriptorSetLayout(
     VkDevice                                        device,
     SetLayoutType                                   setLayoutType,
-    const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings)
+    const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
+    const void*                                     createInfoNext,
+    VkDescriptorSetLayoutCreateFlags                createFlags)
 {
     VkDescriptorSetLayoutCreateInfo createInfo;
     {
         createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        createInfo.pNext        = nullptr;
-        createInfo.flags        = 0;
+        createInfo.pNext        = createInfoNext;
+        createInfo.flags        = createFlags;
         createInfo.bindingCount = static_cast<std::uint32_t>(setLayoutBindings.size());
         createInfo.pBindings    = setLayoutBindings.data();
     }
@@ -301,11 +457,32 @@ static void Convert(VkDescriptorSetLayoutBinding& dst, const BindingDescriptor&
     dst.pImmutableSamplers  = nullptr;
 }
 
+// Creates the list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding')
+static void BuildLayoutBindings(
+    const std::vector<BindingDescriptor>&               inBindings,
+    const std::vector<VkDescriptorSetLayoutBinding>&    setLayoutBindings,
+    std::vector<VKLayoutBinding>&                       outBindings)
+{
+    outBindings.reserve(inBindings.size());
+    for_range(i, inBindings.size())
+    {
+        outBindings.push_back(
+            VKLayoutBinding
+            {
+                inBindings[i].slot.index,
+                inBindings[i].stageFlags,
+                setLayoutBindings[i].descriptorType
+            }
+        );
+    }
+}
+
 void VKPipelineLayout::CreateBindingSetLayout(
     VkDevice                                device,
     const std::vector<BindingDescriptor>&   inBindings,
     std::vector<VKLayoutBinding>&           outBindings,
-    SetLayoutType                           setLayoutType)
+    SetLayoutType                           setLayoutType,
+    VkDescriptorSetLayoutCreateFlags        createFlags)
 {
     /* Convert heap bindings to native descriptor set layout bindings and create Vulkan descriptor set layout */
     const auto numBindings = inBindings.size();
@@ -314,21 +491,68 @@ void VKPipelineLayout::CreateBindingSetLayout(
     for_range(i, numBindings)
         Convert(setLayoutBindings[i], inBindings[i]);
 
-    CreateVkDescriptorSetLayout(device, setLayoutType, setLayoutBindings);
+    CreateVkDescriptorSetLayout(device, setLayoutType, setLayoutBindings, nullptr, createFlags);
+
+    BuildLayoutBindings(inBindings, setLayoutBindings, outBindings);
+}
+
+void VKPipelineLayout::CreateBindlessHeapSetLayout(
+    VkDevice                                device,
+    const std::vector<BindingDescriptor>&   inBindings,
+    const VKBindlessConfig&                 bindlessConfig)
+{
+    #ifdef VK_EXT_descriptor_indexing
+
+    /* Convert heap bindings to partially bound descriptor arrays, one element per descriptor set of a resource heap */
+    const auto numBindings = inBindings.size();
+    std::vector<VkDescriptorSetLayoutBinding> setLayoutBindings(numBindings);
+    std::vector<VkDescriptorBindingFlagsEXT> bindingFlags(numBindings);
+
+    heapUpdateWhilePending_ = bindlessConfig.updateUnusedWhilePending;
 
-    /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
-    outBindings.reserve(numBindings);
     for_range(i, numBindings)
     {
-        outBindings.push_back(
-            VKLayoutBinding
-            {
-                inBindings[i].slot.index,
-                inBindings[i].stageFlags,
-                setLayoutBindings[i].descriptorType
-            }
-        );
+        Convert(setLayoutBindings[i], inBindings[i]);
+        setLayoutBindings[i].descriptorCount = bindlessConfig.capacity;
+
+        bindingFlags[i] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+        if ((bindlessConfig.updateAfterBindTypes & (1u << setLayoutBindings[i].descriptorType)) != 0)
+        {
+            bindingFlags[i] |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+            if (bindlessConfig.updateUnusedWhilePending)
+                bindingFlags[i] |= VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+            heapUpdateAfterBindPool_ = true;
+        }
+        else
+            heapUpdateWhilePending_ = false;
+
+        heapIndexStageFlags_ |= setLayoutBindings[i].stageFlags;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo;
+    {
+        bindingFlagsInfo.sType          = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsInfo.pNext          = nullptr;
+        bindingFlagsInfo.bindingCount   = static_cast<std::uint32_t>(bindingFlags.size());
+        bindingFlagsInfo.pBindingFlags  = bindingFlags.data();
     }
+    CreateVkDescriptorSetLayout(
+        device,
+        SetLayoutType_HeapBindings,
+        setLayoutBindings,
+        &bindingFlagsInfo,
+        (heapUpdateAfterBindPool_ ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT : 0)
+    );
+
+    BuildLayoutBindings(inBindings, setLayoutBindings, heapBindings_);
+    bindlessCapacity_ = bindlessConfig.capacity;
+
+    #else
+
+    /* Fall back to regular heap bindings */
+    CreateBindingSetLayout(device, inBindings, heapBindings_, SetLayoutType_HeapBindings);
+
+    #endif // /VK_EXT_descriptor_indexing
 }
 
 static void Convert(VkDescriptorSetLayoutBinding& dst, const StaticSamplerDescriptor& src, const VkSampler* immutableSamplerVK)
@@ -340,19 +564,19 @@ static void Convert(VkDescriptorSetLayoutBinding& dst, const StaticSamplerDescri
     dst.pImmutableSamplers  = immutableSamplerVK;
 }
 
-void VKPipelineLayout::CreateImmutableSamplers(VkDevice device, const ArrayView<StaticSamplerDescriptor>& staticSamplers)
+void VKPipelineLayout::CreateImmutableSamplers(VkDevice device, VKSamplerPool& samplerPool, const ArrayView<StaticSamplerDescriptor>& staticSamplers)
 {
-    /* Create all immutable Vulkan samplers */
+    /* Acquire all immutable Vulkan samplers from the shared pool */
     immutableSamplers_.reserve(staticSamplers.size());
     for (const auto& staticSamplerDesc : staticSamplers)
-        immutableSamplers_.push_back(VKSampler::CreateVkSampler(device, staticSamplerDesc.sampler));
+        immutableSamplers_.push_back(VKSampler::AcquireVkSampler(device, samplerPool, staticSamplerDesc.sampler));
 
     /* Convert heap bindings to native descriptor set layout bindings and create Vulkan descriptor set layout */
     const auto numBindings = staticSamplers.size();
     std::vector<VkDescriptorSetLayoutBinding> setLayoutBindings(numBindings);
 
     for_range(i, numBindings)
-        Convert(setLayoutBindings[i], staticSamplers[i], immutableSamplers_[i].GetAddressOf());
+        Convert(setLayoutBindings[i], staticSamplers[i], &immutableSamplers_[i]);
 
     CreateVkDescriptorSetLayout(device, SetLayoutType_ImmutableSamplers, setLayoutBindings);
 }
@@ -394,15 +618,9 @@ VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device
 
 void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
 {
-    /* Accumulate descriptor pool sizes for all dynamic resources and immutable samplers */
+    /* Accumulate descriptor pool sizes for all immutable samplers */
     VKPoolSizeAccumulator poolSizeAccum;
-
-    for (const auto binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType);
-
-    if (!immutableSamplers_.empty())
-        poolSizeAccum.Accumulate(VK_DESCRIPTOR_TYPE_SAMPLER, static_cast<std::uint32_t>(immutableSamplers_.size()));
-
+    poolSizeAccum.Accumulate(VK_DESCRIPTOR_TYPE_SAMPLER, static_cast<std::uint32_t>(immutableSamplers_.size()));
     poolSizeAccum.Finalize();
 
     /* Create Vulkan descriptor pool */
@@ -411,7 +629,7 @@ void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
         poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         poolCreateInfo.pNext            = nullptr;
         poolCreateInfo.flags            = 0;
-        poolCreateInfo.maxSets          = 2;
+        poolCreateInfo.maxSets          = 1;
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
     }
@@ -419,21 +637,6 @@ void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
     VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for static samplers");
 }
 
-void VKPipelineLayout::CreateDescriptorCache(VkDevice device, VkDescriptorSetLayout setLayout)
-{
-    /*
-    Don't account descriptors in the dynamic cache for immutable samplers,
-    so accumulate pool sizes only for dynamiuc resources here
-    */
-    VKPoolSizeAccumulator poolSizeAccum;
-    for (const auto binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType);
-    poolSizeAccum.Finalize();
-
-    /* Allocate unique descriptor cache */
-    descriptorCache_ = MakeUnique<VKDescriptorCache>(device, descriptorPool_, setLayout, poolSizeAccum.Size(), poolSizeAccum.Data(), bindings_);
-}
-
 void VKPipelineLayout::CreateStaticDescriptorSet(VkDevice device, VkDescriptorSetLayout setLayout)
 {
     /* Allocate descriptor set for immutable samplers */
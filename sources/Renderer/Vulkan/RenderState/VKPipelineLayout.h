@@ -15,7 +15,9 @@
 #include "../Shader/VKShader.h"
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "../Texture/VKSampler.h"
 #include "../../../Core/PackedPermutation.h"
+#include <memory>
 #include <vector>
 
 
@@ -33,6 +35,14 @@ struct VKLayoutBinding
     VkDescriptorType    descriptorType;
 };
 
+// Bindless configuration for heap bindings. See RendererConfigurationVulkan::bindlessResourceHeapCapacity.
+struct VKBindlessConfig
+{
+    std::uint32_t       capacity                    = 0;        // Number of array elements for each heap binding. Bindless mode is disabled if this is 0.
+    std::uint32_t       updateAfterBindTypes        = 0;        // Bitmask of (1 << VkDescriptorType) for all descriptor types that support update-after-bind.
+    bool                updateUnusedWhilePending    = false;    // Specifies whether descriptors can be updated while the descriptor set is in use by pending command buffers.
+};
+
 class VKPipelineLayout final : public PipelineLayout
 {
 
@@ -42,24 +52,31 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc);
+        VKPipelineLayout(
+            VkDevice                        device,
+            VKSamplerPool&                  samplerPool,
+            const PipelineLayoutDescriptor& desc,
+            const VKBindlessConfig&         bindlessConfig  = {}
+        );
         ~VKPipelineLayout();
 
         /*
         Creates a permutation of this pipeline layout for the specified shaders with push constants.
         If this pipeline layout does not have any push constants (i.e. uniform descriptors), no permutation is created and the return value is VK_NULL_HANDLE.
+        In bindless mode, 'outHeapIndexStageFlags' receives the stage flags that must be used to push the heap index at offset 0.
         */
         VKPtr<VkPipelineLayout> CreateVkPipelineLayoutPermutation(
             VkDevice                            device,
             const ArrayView<Shader*>&           shaders,
-            std::vector<VkPushConstantRange>&   outUniformRanges
+            std::vector<VkPushConstantRange>&   outUniformRanges,
+            VkShaderStageFlags&                 outHeapIndexStageFlags
         ) const;
 
         // Returns true if a permutation is required for the specified shader.
         bool NeedsShaderModulePermutation(const VKShader& shaderVK) const;
 
-        // Creates a permutation of the specified shader. Should only be used by VKShaderModulePool.
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(VKShader& shaderVK) const;
+        // Builds the SPIR-V code for a permutation of the specified shader. Returns false if no permutation is required. Should only be used by VKShaderModulePool.
+        bool BuildShaderCodePermutation(const VKShader& shaderVK, VKShaderCode& outShaderCode) const;
 
         // Returns the native VkPipelineLayout object.
         inline VkPipelineLayout GetVkPipelineLayout() const
@@ -115,10 +132,16 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
-        // Returns the descriptor cache for dynamic resources or null if there is none.
-        inline VKDescriptorCache* GetDescriptorCache() const
+        /*
+        Creates a new descriptor cache for the dynamic bindings of this pipeline layout or null if there are none.
+        Each command buffer owns its own descriptor caches, so they can be recorded concurrently.
+        */
+        std::unique_ptr<VKDescriptorCache> CreateDescriptorCache(VkDevice device) const;
+
+        // Returns the unique ID of this pipeline layout. IDs are never reused, unlike the addresses of released pipeline layouts.
+        inline std::uint64_t GetUniqueID() const
         {
-            return descriptorCache_.get();
+            return uniqueID_;
         }
 
         // Returns true if this instance provides permutations for the native Vulkan pipeline layout.
@@ -133,6 +156,42 @@ class VKPipelineLayout final : public PipelineLayout
             return barrierFlags_;
         }
 
+        // Returns true if the heap bindings of this pipeline layout are declared as bindless descriptor arrays.
+        inline bool IsBindless() const
+        {
+            return (bindlessCapacity_ > 0);
+        }
+
+        // Returns the number of array elements of each bindless heap binding or 0 if bindless mode is disabled.
+        inline std::uint32_t GetBindlessCapacity() const
+        {
+            return bindlessCapacity_;
+        }
+
+        // Returns the shader stages that read the bindless heap index from push constants. This is 0 if bindless mode is disabled.
+        inline VkShaderStageFlags GetHeapIndexStageFlags() const
+        {
+            return heapIndexStageFlags_;
+        }
+
+        // Returns true if the heap descriptor set layout was created with the update-after-bind pool flag.
+        inline bool HasHeapUpdateAfterBindPool() const
+        {
+            return heapUpdateAfterBindPool_;
+        }
+
+        // Returns true if all heap bindings can be written while the descriptor set is in use by pending command buffers.
+        inline bool HasHeapUpdateWhilePending() const
+        {
+            return heapUpdateWhilePending_;
+        }
+
+        // Returns true if the dynamic descriptor set layout was created for push descriptors (VK_KHR_push_descriptor).
+        inline bool HasPushDescriptors() const
+        {
+            return pushDescriptors_;
+        }
+
     public:
 
         // Creates the default VkPipelineLayout object.
@@ -168,18 +227,28 @@ class VKPipelineLayout final : public PipelineLayout
         void CreateVkDescriptorSetLayout(
             VkDevice                                        device,
             SetLayoutType                                   setLayoutType,
-            const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings
+            const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
+            const void*                                     createInfoNext      = nullptr,
+            VkDescriptorSetLayoutCreateFlags                createFlags         = 0
         );
 
         void CreateBindingSetLayout(
             VkDevice                                device,
             const std::vector<BindingDescriptor>&   inBindings,
             std::vector<VKLayoutBinding>&           outBindings,
-            SetLayoutType                           setLayoutType
+            SetLayoutType                           setLayoutType,
+            VkDescriptorSetLayoutCreateFlags        createFlags     = 0
+        );
+
+        void CreateBindlessHeapSetLayout(
+            VkDevice                                device,
+            const std::vector<BindingDescriptor>&   inBindings,
+            const VKBindlessConfig&                 bindlessConfig
         );
 
         void CreateImmutableSamplers(
             VkDevice                                    device,
+            VKSamplerPool&                              samplerPool,
             const ArrayView<StaticSamplerDescriptor>&   staticSamplers
         );
 
@@ -189,7 +258,6 @@ class VKPipelineLayout final : public PipelineLayout
         ) const;
 
         void CreateDescriptorPool(VkDevice device);
-        void CreateDescriptorCache(VkDevice device, VkDescriptorSetLayout setLayout);
         void CreateStaticDescriptorSet(VkDevice device, VkDescriptorSetLayout setLayout);
 
         void BuildDescriptorSetBindingTables(const PipelineLayoutDescriptor& desc);
@@ -215,16 +283,23 @@ class VKPipelineLayout final : public PipelineLayout
         PackedPermutation3                  layoutTypeOrder_;
 
         VKPtr<VkDescriptorPool>             descriptorPool_;
-        std::unique_ptr<VKDescriptorCache>  descriptorCache_;
+        std::uint64_t                       uniqueID_                               = 0;
         VkDescriptorSet                     staticDescriptorSet_                    = VK_NULL_HANDLE;
 
         std::vector<VKLayoutBinding>        heapBindings_;
         std::vector<VKLayoutBinding>        bindings_;
-        std::vector<VKPtr<VkSampler>>       immutableSamplers_;
+        VKSamplerPool&                      samplerPool_;
+        std::vector<VkSampler>              immutableSamplers_;
         std::vector<UniformDescriptor>      uniformDescs_;
 
         long                                barrierFlags_                           = 0;
 
+        std::uint32_t                       bindlessCapacity_                       = 0;
+        VkShaderStageFlags                  heapIndexStageFlags_                    = 0;
+        bool                                heapUpdateAfterBindPool_                = false;
+        bool                                heapUpdateWhilePending_                 = false;
+        bool                                pushDescriptors_                        = false;
+
 };
 
 
@@ -0,0 +1,150 @@
+/*
+ * VKPipelineLibrary.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKPipelineLibrary.h"
+#include "../VKCore.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CPUProfilerUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Minimum number of entries per part map before expired entries are removed.
+static constexpr std::size_t minPartsSweepSize = 64;
+
+VKPipelineLibrary::VKPipelineLibrary(VkDevice device, bool graphicsPipelineLibrary) :
+    device_                  { device                  },
+    graphicsPipelineLibrary_ { graphicsPipelineLibrary }
+{
+}
+
+#ifdef VK_EXT_graphics_pipeline_library
+
+static VkGraphicsPipelineLibraryFlagsEXT GetVkGraphicsPipelineLibraryFlags(VKPipelineLibraryPart part)
+{
+    switch (part)
+    {
+        case VKPipelineLibraryPart_VertexInput:         return VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+        case VKPipelineLibraryPart_PreRasterization:    return VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+        case VKPipelineLibraryPart_FragmentShader:      return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+        case VKPipelineLibraryPart_FragmentOutput:      return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+        default:                                        return 0;
+    }
+}
+
+#endif // /VK_EXT_graphics_pipeline_library
+
+VKPipelineLibrary::PartPtr VKPipelineLibrary::GetOrCreatePart(
+    VKPipelineLibraryPart               part,
+    std::uint64_t                       hash,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    VkPipelineCache                     pipelineCache)
+{
+    LLGL_ASSERT(graphicsPipelineLibrary_);
+    LLGL_ASSERT(part < VKPipelineLibraryPart_Num);
+
+    /* Return cached part if it is still in use by another PSO */
+    PartMap& partMap = parts_[part];
+    {
+        LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKPipelineLibrary");
+        auto it = partMap.find(hash);
+        if (it != partMap.end())
+        {
+            if (PartPtr cachedPart = it->second.lock())
+                return cachedPart;
+        }
+    }
+
+    #ifdef VK_EXT_graphics_pipeline_library
+
+    /* Compile new library part without lock, so other threads can compile their parts concurrently */
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo;
+    {
+        libraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        libraryCreateInfo.pNext = createInfo.pNext;
+        libraryCreateInfo.flags = GetVkGraphicsPipelineLibraryFlags(part);
+    }
+    VkGraphicsPipelineCreateInfo partCreateInfo = createInfo;
+    {
+        partCreateInfo.pNext    = &libraryCreateInfo;
+        partCreateInfo.flags    |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    }
+    PartPtr newPart = std::make_shared<VKPtr<VkPipeline>>(device_, vkDestroyPipeline);
+    VkResult result = vkCreateGraphicsPipelines(device_, pipelineCache, 1, &partCreateInfo, nullptr, newPart->ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline library");
+
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKPipelineLibrary");
+
+    /* Prefer the part of another thread that has compiled the same part in the meantime, so all PSOs share the same library */
+    std::weak_ptr<VKPtr<VkPipeline>>& entry = partMap[hash];
+    if (PartPtr cachedPart = entry.lock())
+        return cachedPart;
+
+    entry = newPart;
+
+    /* Remove expired entries whenever the map has doubled its size since the last sweep */
+    if (partMap.size() >= std::max(minPartsSweepSize, partsSweepSize_[part] * 2))
+        ReleaseExpiredParts(part);
+
+    return newPart;
+
+    #else // VK_EXT_graphics_pipeline_library
+
+    return nullptr;
+
+    #endif // /VK_EXT_graphics_pipeline_library
+}
+
+VkPipeline VKPipelineLibrary::FindParentPipeline(std::uint64_t hash) const
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKPipelineLibrary");
+    auto it = parentPipelines_.find(hash);
+    return (it != parentPipelines_.end() ? it->second : VK_NULL_HANDLE);
+}
+
+void VKPipelineLibrary::RegisterParentPipeline(std::uint64_t hash, VkPipeline pipeline)
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKPipelineLibrary");
+    if (pipeline != VK_NULL_HANDLE)
+        parentPipelines_.emplace(hash, pipeline);
+}
+
+void VKPipelineLibrary::UnregisterParentPipeline(std::uint64_t hash, VkPipeline pipeline)
+{
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKPipelineLibrary");
+    auto it = parentPipelines_.find(hash);
+    if (it != parentPipelines_.end() && it->second == pipeline)
+        parentPipelines_.erase(it);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineLibrary::ReleaseExpiredParts(VKPipelineLibraryPart part)
+{
+    PartMap& partMap = parts_[part];
+    for (auto it = partMap.begin(); it != partMap.end();)
+    {
+        if (it->second.expired())
+            it = partMap.erase(it);
+        else
+            ++it;
+    }
+    partsSweepSize_[part] = partMap.size();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
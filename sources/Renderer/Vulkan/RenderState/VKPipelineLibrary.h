@@ -0,0 +1,113 @@
+/*
+ * VKPipelineLibrary.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_PIPELINE_LIBRARY_H
+#define LLGL_VK_PIPELINE_LIBRARY_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+// Graphics pipeline library part enumeration. Each part is compiled separately and linked into the final graphics PSO.
+enum VKPipelineLibraryPart
+{
+    VKPipelineLibraryPart_VertexInput = 0,
+    VKPipelineLibraryPart_PreRasterization,
+    VKPipelineLibraryPart_FragmentShader,
+    VKPipelineLibraryPart_FragmentOutput,
+
+    VKPipelineLibraryPart_Num,
+};
+
+/*
+Cache of partial graphics pipelines for VK_EXT_graphics_pipeline_library and of parent pipelines for pipeline derivatives.
+Library parts are shared between all graphics PSOs that have been created with the same partial state
+and they are released as soon as the last of these PSOs is released.
+If graphics pipeline libraries are not supported, graphics PSOs are created as derivatives of a live PSO with the same shaders and pipeline layout.
+All functions are thread-safe, since PSOs can be created concurrently.
+*/
+class VKPipelineLibrary
+{
+
+    public:
+
+        using PartPtr = std::shared_ptr<VKPtr<VkPipeline>>;
+
+    public:
+
+        VKPipelineLibrary(VkDevice device, bool graphicsPipelineLibrary);
+
+        VKPipelineLibrary(const VKPipelineLibrary&) = delete;
+        VKPipelineLibrary& operator = (const VKPipelineLibrary&) = delete;
+
+        /*
+        Returns the cached library part with the specified hash or compiles a new one from the specified create-info.
+        The create-info must only contain the state for this part; the library flags and type are set by this function.
+        */
+        PartPtr GetOrCreatePart(
+            VKPipelineLibraryPart               part,
+            std::uint64_t                       hash,
+            const VkGraphicsPipelineCreateInfo& createInfo,
+            VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
+        );
+
+        // Returns the parent pipeline for derivatives with the specified hash or VK_NULL_HANDLE if there is none.
+        VkPipeline FindParentPipeline(std::uint64_t hash) const;
+
+        // Registers the specified pipeline as parent for derivatives with the specified hash, unless there already is one.
+        void RegisterParentPipeline(std::uint64_t hash, VkPipeline pipeline);
+
+        // Unregisters the specified pipeline as parent for derivatives. Must be called before the pipeline is destroyed.
+        void UnregisterParentPipeline(std::uint64_t hash, VkPipeline pipeline);
+
+        // Returns true if graphics PSOs are linked from library parts. Otherwise, they are created as pipeline derivatives.
+        inline bool HasGraphicsPipelineLibrary() const
+        {
+            return graphicsPipelineLibrary_;
+        }
+
+    private:
+
+        // Removes all entries of library parts that have already been released. The mutex must be locked.
+        void ReleaseExpiredParts(VKPipelineLibraryPart part);
+
+    private:
+
+        using PartMap = std::unordered_map<std::uint64_t, std::weak_ptr<VKPtr<VkPipeline>>>;
+
+    private:
+
+        VkDevice                                        device_                     = VK_NULL_HANDLE;
+        bool                                            graphicsPipelineLibrary_    = false;
+
+        PartMap                                         parts_[VKPipelineLibraryPart_Num];
+        std::size_t                                     partsSweepSize_[VKPipelineLibraryPart_Num] = {};
+
+        std::unordered_map<std::uint64_t, VkPipeline>   parentPipelines_;
+
+        mutable std::mutex                              mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
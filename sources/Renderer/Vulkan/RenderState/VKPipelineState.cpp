@@ -27,9 +27,10 @@ VKPipelineState::VKPipelineState(
 {
     if (pipelineLayout != nullptr)
     {
-        pipelineLayout_ = LLGL_CAST(const VKPipelineLayout*, pipelineLayout);
+        pipelineLayout_         = LLGL_CAST(const VKPipelineLayout*, pipelineLayout);
+        heapIndexStageFlags_    = pipelineLayout_->GetHeapIndexStageFlags();
         if (pipelineLayout_->GetNumUniforms() > 0)
-            pipelineLayoutPerm_ = pipelineLayout_->CreateVkPipelineLayoutPermutation(device, shaders, uniformRanges_);
+            pipelineLayoutPerm_ = pipelineLayout_->CreateVkPipelineLayoutPermutation(device, shaders, uniformRanges_, heapIndexStageFlags_);
     }
 }
 
@@ -86,12 +87,35 @@ void VKPipelineState::BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, Vk
         BindDescriptorSets(commandBuffer, pipelineLayout_->GetBindPointForDynamicBindings(), 1, &descriptorSet);
 }
 
+void VKPipelineState::PushDynamicDescriptorSet(VkCommandBuffer commandBuffer, std::uint32_t numWrites, const VkWriteDescriptorSet* writes)
+{
+    #ifdef VK_KHR_push_descriptor
+    if (pipelineLayout_ != nullptr && numWrites > 0)
+    {
+        vkCmdPushDescriptorSetKHR(
+            /*commandBuffer:*/          commandBuffer,
+            /*pipelineBindPoint:*/      GetBindPoint(),
+            /*layout:*/                 GetVkPipelineLayout(),
+            /*set:*/                    pipelineLayout_->GetBindPointForDynamicBindings(),
+            /*descriptorWriteCount:*/   numWrites,
+            /*pDescriptorWrites:*/      writes
+        );
+    }
+    #endif // /VK_KHR_push_descriptor
+}
+
 void VKPipelineState::BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet)
 {
     if (pipelineLayout_ != nullptr && descriptorSet != VK_NULL_HANDLE)
         BindDescriptorSets(commandBuffer, pipelineLayout_->GetBindPointForHeapBindings(), 1, &descriptorSet);
 }
 
+void VKPipelineState::PushHeapIndex(VkCommandBuffer commandBuffer, std::uint32_t heapIndex)
+{
+    if (heapIndexStageFlags_ != 0)
+        vkCmdPushConstants(commandBuffer, GetVkPipelineLayout(), heapIndexStageFlags_, 0, sizeof(heapIndex), &heapIndex);
+}
+
 void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size)
 {
     if (first >= uniformRanges_.size())
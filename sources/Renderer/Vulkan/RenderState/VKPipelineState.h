@@ -48,9 +48,15 @@ class VKPipelineState : public PipelineState
         // Binds the specified descriptor set to the dynamic descriptor set binding point.
         void BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet);
 
+        // Pushes the specified descriptor writes to the dynamic descriptor set binding point. Requires a pipeline layout with push descriptors.
+        void PushDynamicDescriptorSet(VkCommandBuffer commandBuffer, std::uint32_t numWrites, const VkWriteDescriptorSet* writes);
+
         // Binds the specified descriptor set to teh heap descriptor set binding point.
         void BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet);
 
+        // Pushes the bindless resource heap index to the command buffer at push-constant offset 0. Does nothing if the pipeline layout is not bindless.
+        void PushHeapIndex(VkCommandBuffer commandBuffer, std::uint32_t heapIndex);
+
         // Pushes the specified values to the command buffer as push-constants.
         void PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size);
 
@@ -88,6 +94,18 @@ class VKPipelineState : public PipelineState
         */
         void GetShaderCreateInfoAndOptionalPermutation(VKShader& shaderVK, VkPipelineShaderStageCreateInfo& outCreateInfo);
 
+        // Returns the push constant ranges of all uniforms of the pipeline layout permutation.
+        inline const std::vector<VkPushConstantRange>& GetUniformRanges() const
+        {
+            return uniformRanges_;
+        }
+
+        // Returns the shader stage flags for the bindless heap index in the push constants.
+        inline VkShaderStageFlags GetHeapIndexStageFlags() const
+        {
+            return heapIndexStageFlags_;
+        }
+
         // Returns the mutable report object.
         inline Report& GetMutableReport()
         {
@@ -110,6 +128,7 @@ class VKPipelineState : public PipelineState
         const VKPipelineLayout*             pipelineLayout_     = nullptr;
         VkPipelineBindPoint                 bindPoint_          = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         std::vector<VkPushConstantRange>    uniformRanges_;     // Push constant ranges; One range for each uniform descriptor. See UniformDescriptor.
+        VkShaderStageFlags                  heapIndexStageFlags_ = 0;   // Stage flags for the bindless heap index in push constants; 0 if the pipeline layout is not bindless.
         Report                              report_;
 
 };
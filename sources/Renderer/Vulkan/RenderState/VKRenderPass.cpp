@@ -8,9 +8,12 @@
 #include "VKRenderPass.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../RenderPassUtils.h"
+#include "../../PersistentPipelineCache.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
+#include <atomic>
 #include <limits>
 
 
@@ -18,6 +21,38 @@ namespace LLGL
 {
 
 
+bool VKIsDynamicRenderingEnabled()
+{
+    #ifdef VK_KHR_dynamic_rendering
+    return HasExtension(VKExt::KHR_dynamic_rendering);
+    #else
+    return false;
+    #endif
+}
+
+static std::uint64_t GenerateUniqueRenderPassID()
+{
+    static std::atomic<std::uint64_t> nextID{ 1 };
+    return nextID++;
+}
+
+// Returns a hash of all render pass states that are relevant for pipeline compatibility with dynamic rendering.
+static std::uint64_t GetRenderingCompatibilityHash(
+    std::uint32_t           numColorAttachments,
+    const VkFormat*         colorFormats,
+    VkFormat                depthStencilFormat,
+    VkSampleCountFlagBits   sampleCountBits,
+    std::uint32_t           viewMask)
+{
+    PersistentPipelineCacheKey hash;
+    hash.Append(numColorAttachments);
+    hash.AppendBytes(colorFormats, sizeof(VkFormat) * numColorAttachments);
+    hash.Append(depthStencilFormat);
+    hash.Append(sampleCountBits);
+    hash.Append(viewMask);
+    return hash.Get();
+}
+
 VKRenderPass::VKRenderPass(VkDevice device) :
     renderPass_ { device, vkDestroyRenderPass }
 {
@@ -90,6 +125,28 @@ static void InitDepthStencilVkAttachmentDesc(
     dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 }
 
+// Bitmasks of color attachments that are rendered into or read as input attachments within a subpass.
+struct VKSubpassAttachmentMasks
+{
+    std::uint32_t color = 0;
+    std::uint32_t input = 0;
+};
+
+// Returns the number of attachment references to cover all attachments of the specified bitmask, i.e. the index of the highest bit plus one.
+static std::uint32_t GetAttachmentRefCount(std::uint32_t attachmentMask)
+{
+    std::uint32_t count = 0;
+    for (; attachmentMask != 0; attachmentMask >>= 1)
+        ++count;
+    return count;
+}
+
+static void InitAttachmentRef(VkAttachmentReference& dst, bool isEnabled, std::uint32_t attachment, VkImageLayout layout)
+{
+    dst.attachment  = (isEnabled ? attachment : VK_ATTACHMENT_UNUSED);
+    dst.layout      = (isEnabled ? layout : VK_IMAGE_LAYOUT_UNDEFINED);
+}
+
 void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescriptor& desc)
 {
     /* Get number of attachments */
@@ -164,27 +221,40 @@ void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescripto
     }
 
     /* Create render pass with native attachment descriptors */
-    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits);
+    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits, desc.subpasses, desc.viewMask);
 }
 
 void VKRenderPass::CreateVkRenderPassWithDescriptors(
-    VkDevice                        device,
-    std::uint32_t                   numAttachments,
-    std::uint32_t                   numColorAttachments,
-    const VkAttachmentDescription*  attachmentDescs,
-    VkSampleCountFlagBits           sampleCountBits)
+    VkDevice                                device,
+    std::uint32_t                           numAttachments,
+    std::uint32_t                           numColorAttachments,
+    const VkAttachmentDescription*          attachmentDescs,
+    VkSampleCountFlagBits                   sampleCountBits,
+    const ArrayView<SubpassDescriptor>&     subpasses,
+    std::uint32_t                           viewMask)
 {
     LLGL_ASSERT(numAttachments <= LLGL_MAX_NUM_ATTACHMENTS);
     LLGL_ASSERT(numColorAttachments <= LLGL_MAX_NUM_COLOR_ATTACHMENTS);
 
     /* Uninitialized stack memory for descriptor containers */
-    VkAttachmentReference colorAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
-    VkAttachmentReference resolveAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
     VkAttachmentReference depthStencilAttachmentRef;
 
+    const bool hasDepthStencil  = (numColorAttachments < numAttachments);
+    const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
+
     /* Store sample count bits and number of color attachments (required for default blend states in VKGraphicsPipeline) */
     sampleCountBits_        = sampleCountBits;
+    numAttachments_         = static_cast<std::uint8_t>(numAttachments);
     numColorAttachments_    = static_cast<std::uint8_t>(numColorAttachments);
+    viewMask_               = viewMask;
+
+    /* Store attachment descriptors and formats to begin dynamic rendering and to build compatible PSOs */
+    attachmentDescs_.assign(attachmentDescs, attachmentDescs + (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments));
+
+    for_range(i, numColorAttachments)
+        colorFormats_[i] = attachmentDescs[i].format;
+
+    depthStencilFormat_ = (hasDepthStencil ? attachmentDescs[numColorAttachments].format : VK_FORMAT_UNDEFINED);
 
     /* Build bitmask for clear values: least significant bit (LSB) is used for the first attachment */
     clearValuesMask_ = 0;
@@ -198,14 +268,6 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         }
     }
 
-    /* Initialize attachment reference */
-    for_range(i, numColorAttachments)
-    {
-        colorAttachmentsRefs[i].attachment  = i;
-        colorAttachmentsRefs[i].layout      = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-    }
-
-    const bool hasDepthStencil = (numColorAttachments < numAttachments);
     if (hasDepthStencil)
     {
         depthStencilIndex_ = static_cast<std::uint8_t>(numColorAttachments);
@@ -213,43 +275,107 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         depthStencilAttachmentRef.layout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
 
-    const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
-    if (hasMultiSampling)
+    /* Determine color and input attachments of each subpass; a render pass without subpass descriptors has a single subpass for all color attachments */
+    const std::uint32_t numSubpasses = std::max(1u, static_cast<std::uint32_t>(subpasses.size()));
+    const std::uint32_t enabledColorAttachmentMask = ((1u << numColorAttachments) - 1u);
+
+    std::vector<VKSubpassAttachmentMasks> subpassMasks(numSubpasses);
+    subpassColorAttachmentCounts_.resize(numSubpasses);
+
+    for_range(subpass, numSubpasses)
     {
-        std::uint32_t resolveAttachmentIndex = numAttachments;
-        for_range(i, numColorAttachments)
+        VKSubpassAttachmentMasks& masks = subpassMasks[subpass];
+        if (subpass < subpasses.size())
         {
-            if (attachmentDescs[numAttachments + i].format == VK_FORMAT_UNDEFINED)
-            {
-                resolveAttachmentsRefs[i].attachment    = VK_ATTACHMENT_UNUSED;
-                resolveAttachmentsRefs[i].layout        = VK_IMAGE_LAYOUT_UNDEFINED;
-            }
-            else
-            {
-                resolveAttachmentsRefs[i].attachment    = resolveAttachmentIndex++;
-                resolveAttachmentsRefs[i].layout        = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-            }
+            /* Attachments that are read as input attachments cannot be rendered into within the same subpass */
+            masks.input = (subpasses[subpass].inputAttachmentMask & enabledColorAttachmentMask);
+            masks.color = (subpasses[subpass].colorAttachmentMask & enabledColorAttachmentMask & ~masks.input);
         }
+        else
+            masks.color = enabledColorAttachmentMask;
+        subpassColorAttachmentCounts_[subpass] = static_cast<std::uint8_t>(GetAttachmentRefCount(masks.color));
+    }
+
+    /* No native render pass is needed with dynamic rendering; compatible render passes share their ID to share PSO library parts */
+    if (UsesDynamicRendering())
+    {
+        uniqueID_ = GetRenderingCompatibilityHash(numColorAttachments, colorFormats_, depthStencilFormat_, sampleCountBits, viewMask);
+        renderPass_.Release();
+        return;
     }
 
-    /* Initialize sub-pass descriptor */
-    VkSubpassDescription subpassDesc;
+    uniqueID_ = GenerateUniqueRenderPassID();
+
+    /* Initialize sub-pass descriptors; color and input attachment references are indexed by their color attachment index */
+    std::vector<VkSubpassDescription>   subpassDescs(numSubpasses);
+    std::vector<VkAttachmentReference>  attachmentRefs(numSubpasses * LLGL_MAX_NUM_COLOR_ATTACHMENTS * 3);
+    std::vector<std::uint32_t>          preserveAttachments(numSubpasses * LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+
+    for_range(subpass, numSubpasses)
     {
-        subpassDesc.flags                   = 0;
-        subpassDesc.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
-        subpassDesc.inputAttachmentCount    = 0;
-        subpassDesc.pInputAttachments       = nullptr;
-        subpassDesc.colorAttachmentCount    = numColorAttachments;
-        subpassDesc.pColorAttachments       = colorAttachmentsRefs;
-        subpassDesc.pResolveAttachments     = (hasMultiSampling && numColorAttachments > 0 ? resolveAttachmentsRefs : nullptr);
-        subpassDesc.pDepthStencilAttachment = (hasDepthStencil ? &depthStencilAttachmentRef : nullptr);
-        subpassDesc.preserveAttachmentCount = 0;
-        subpassDesc.pPreserveAttachments    = nullptr;
+        const VKSubpassAttachmentMasks& masks = subpassMasks[subpass];
+
+        VkAttachmentReference* colorAttachmentsRefs    = &(attachmentRefs[(subpass * 3 + 0) * LLGL_MAX_NUM_COLOR_ATTACHMENTS]);
+        VkAttachmentReference* resolveAttachmentsRefs  = &(attachmentRefs[(subpass * 3 + 1) * LLGL_MAX_NUM_COLOR_ATTACHMENTS]);
+        VkAttachmentReference* inputAttachmentsRefs    = &(attachmentRefs[(subpass * 3 + 2) * LLGL_MAX_NUM_COLOR_ATTACHMENTS]);
+        std::uint32_t* subpassPreserveAttachments      = &(preserveAttachments[subpass * LLGL_MAX_NUM_COLOR_ATTACHMENTS]);
+
+        const std::uint32_t numColorRefs = GetAttachmentRefCount(masks.color);
+        const std::uint32_t numInputRefs = GetAttachmentRefCount(masks.input);
+
+        for_range(i, numColorRefs)
+            InitAttachmentRef(colorAttachmentsRefs[i], ((masks.color >> i) & 1u) != 0, i, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+        for_range(i, numInputRefs)
+            InitAttachmentRef(inputAttachmentsRefs[i], ((masks.input >> i) & 1u) != 0, i, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        /* Resolve multi-sampled attachments at the end of the last subpass only */
+        const bool hasResolveRefs = (hasMultiSampling && numColorRefs > 0 && subpass + 1 == numSubpasses);
+        if (hasResolveRefs)
+        {
+            std::uint32_t resolveAttachmentIndex = numAttachments;
+            for_range(i, numColorAttachments)
+            {
+                const bool isResolveEnabled = (attachmentDescs[numAttachments + i].format != VK_FORMAT_UNDEFINED);
+                if (i < numColorRefs)
+                    InitAttachmentRef(resolveAttachmentsRefs[i], isResolveEnabled && ((masks.color >> i) & 1u) != 0, resolveAttachmentIndex, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+                if (isResolveEnabled)
+                    ++resolveAttachmentIndex;
+            }
+        }
+
+        /* Preserve the content of attachments that are not used in this subpass but in any subsequent subpass */
+        std::uint32_t laterUsedMask = 0;
+        for (std::uint32_t laterSubpass = subpass + 1; laterSubpass < numSubpasses; ++laterSubpass)
+            laterUsedMask |= (subpassMasks[laterSubpass].color | subpassMasks[laterSubpass].input);
+
+        const std::uint32_t preserveMask = (laterUsedMask & ~(masks.color | masks.input));
+        std::uint32_t numPreserveAttachments = 0;
+        for_range(i, numColorAttachments)
+        {
+            if (((preserveMask >> i) & 1u) != 0)
+                subpassPreserveAttachments[numPreserveAttachments++] = i;
+        }
+
+        VkSubpassDescription& subpassDesc = subpassDescs[subpass];
+        {
+            subpassDesc.flags                   = 0;
+            subpassDesc.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+            subpassDesc.inputAttachmentCount    = numInputRefs;
+            subpassDesc.pInputAttachments       = (numInputRefs > 0 ? inputAttachmentsRefs : nullptr);
+            subpassDesc.colorAttachmentCount    = numColorRefs;
+            subpassDesc.pColorAttachments       = colorAttachmentsRefs;
+            subpassDesc.pResolveAttachments     = (hasResolveRefs ? resolveAttachmentsRefs : nullptr);
+            subpassDesc.pDepthStencilAttachment = (hasDepthStencil ? &depthStencilAttachmentRef : nullptr);
+            subpassDesc.preserveAttachmentCount = numPreserveAttachments;
+            subpassDesc.pPreserveAttachments    = (numPreserveAttachments > 0 ? subpassPreserveAttachments : nullptr);
+        }
     }
 
-    /* Initialize sub-pass dependency */
-    VkSubpassDependency subpassDep;
+    /* Initialize sub-pass dependencies: one external dependency and one by-region dependency between each pair of consecutive subpasses */
+    std::vector<VkSubpassDependency> subpassDeps(numSubpasses);
     {
+        VkSubpassDependency& subpassDep = subpassDeps[0];
         subpassDep.srcSubpass       = VK_SUBPASS_EXTERNAL;
         subpassDep.dstSubpass       = 0;
         subpassDep.srcStageMask     = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT; //VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
@@ -258,24 +384,85 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         subpassDep.dstAccessMask    = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
         subpassDep.dependencyFlags  = 0;
     }
+    for (std::uint32_t subpass = 1; subpass < numSubpasses; ++subpass)
+    {
+        VkSubpassDependency& subpassDep = subpassDeps[subpass];
+        subpassDep.srcSubpass       = subpass - 1;
+        subpassDep.dstSubpass       = subpass;
+        subpassDep.srcStageMask     = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        subpassDep.dstStageMask     = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        subpassDep.srcAccessMask    = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        subpassDep.dstAccessMask    = VK_ACCESS_INPUT_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        subpassDep.dependencyFlags  = VK_DEPENDENCY_BY_REGION_BIT;
+    }
+
+    /* Render all views of a multiview render pass in each subpass; all views are spatially correlated for multiview rendering */
+    std::vector<std::uint32_t> subpassViewMasks;
+    VkRenderPassMultiviewCreateInfo multiviewCreateInfo;
+
+    if (viewMask != 0)
+    {
+        subpassViewMasks.resize(numSubpasses, viewMask);
+        multiviewCreateInfo.sType                   = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO;
+        multiviewCreateInfo.pNext                   = nullptr;
+        multiviewCreateInfo.subpassCount            = numSubpasses;
+        multiviewCreateInfo.pViewMasks              = subpassViewMasks.data();
+        multiviewCreateInfo.dependencyCount         = 0;
+        multiviewCreateInfo.pViewOffsets            = nullptr;
+        multiviewCreateInfo.correlationMaskCount    = 1;
+        multiviewCreateInfo.pCorrelationMasks       = &viewMask;
+    }
 
     /* Create swap-chain render pass */
     VkRenderPassCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-        createInfo.pNext            = nullptr;
+        createInfo.pNext            = (viewMask != 0 ? &multiviewCreateInfo : nullptr);
         createInfo.flags            = 0;
         createInfo.attachmentCount  = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
         createInfo.pAttachments     = attachmentDescs;
-        createInfo.subpassCount     = 1;
-        createInfo.pSubpasses       = (&subpassDesc);
-        createInfo.dependencyCount  = 1;
-        createInfo.pDependencies    = (&subpassDep);
+        createInfo.subpassCount     = numSubpasses;
+        createInfo.pSubpasses       = subpassDescs.data();
+        createInfo.dependencyCount  = numSubpasses;
+        createInfo.pDependencies    = subpassDeps.data();
     }
     VkResult result = vkCreateRenderPass(device, &createInfo, nullptr, renderPass_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan render pass");
 }
 
+bool VKRenderPass::UsesDynamicRendering() const
+{
+    return (VKIsDynamicRenderingEnabled() && GetNumSubpasses() <= 1);
+}
+
+#ifdef VK_KHR_dynamic_rendering
+
+void VKRenderPass::FillPipelineRenderingCreateInfo(VkPipelineRenderingCreateInfoKHR& outCreateInfo) const
+{
+    outCreateInfo.sType                     = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    outCreateInfo.pNext                     = nullptr;
+    outCreateInfo.viewMask                  = viewMask_;
+    outCreateInfo.colorAttachmentCount      = numColorAttachments_;
+    outCreateInfo.pColorAttachmentFormats   = colorFormats_;
+    outCreateInfo.depthAttachmentFormat     = (depthStencilFormat_ != VK_FORMAT_S8_UINT ? depthStencilFormat_ : VK_FORMAT_UNDEFINED);
+    outCreateInfo.stencilAttachmentFormat   = (VKTypes::IsVkFormatStencil(depthStencilFormat_) ? depthStencilFormat_ : VK_FORMAT_UNDEFINED);
+}
+
+void VKRenderPass::FillInheritanceRenderingInfo(VkCommandBufferInheritanceRenderingInfoKHR& outInheritanceInfo) const
+{
+    outInheritanceInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+    outInheritanceInfo.pNext                    = nullptr;
+    outInheritanceInfo.flags                    = 0;
+    outInheritanceInfo.viewMask                 = viewMask_;
+    outInheritanceInfo.colorAttachmentCount     = numColorAttachments_;
+    outInheritanceInfo.pColorAttachmentFormats  = colorFormats_;
+    outInheritanceInfo.depthAttachmentFormat    = (depthStencilFormat_ != VK_FORMAT_S8_UINT ? depthStencilFormat_ : VK_FORMAT_UNDEFINED);
+    outInheritanceInfo.stencilAttachmentFormat  = (VKTypes::IsVkFormatStencil(depthStencilFormat_) ? depthStencilFormat_ : VK_FORMAT_UNDEFINED);
+    outInheritanceInfo.rasterizationSamples     = sampleCountBits_;
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 
 } // /namespace LLGL
 
@@ -10,9 +10,13 @@
 
 
 #include <LLGL/RenderPass.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Constants.h>
+#include <LLGL/Container/ArrayView.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
+#include <vector>
 
 
 namespace LLGL
@@ -20,6 +24,31 @@ namespace LLGL
 
 
 struct RenderPassDescriptor;
+struct SubpassDescriptor;
+
+// Image of a single attachment that is bound with dynamic rendering. A null image denotes an unused attachment.
+struct VKRenderingAttachment
+{
+    VkImage             image       = VK_NULL_HANDLE;
+    VkImageView         imageView   = VK_NULL_HANDLE;
+    VkFormat            format      = VK_FORMAT_UNDEFINED;
+    TextureSubresource  subresource;
+};
+
+// Attachments of a render target or swap-chain buffer. This replaces the VkFramebuffer object when dynamic rendering is enabled.
+struct VKRenderingAttachments
+{
+    std::uint32_t           numColorAttachments                                 = 0;
+    VKRenderingAttachment   colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment   resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment   depthStencilAttachment;
+};
+
+/*
+Returns true if render passes are encoded with VK_KHR_dynamic_rendering.
+In this case, VKRenderPass only describes the attachment formats and operations, and no VkRenderPass or VkFramebuffer objects are created.
+*/
+bool VKIsDynamicRenderingEnabled();
 
 class VKRenderPass final : public RenderPass
 {
@@ -36,19 +65,52 @@ class VKRenderPass final : public RenderPass
         );
 
         void CreateVkRenderPassWithDescriptors(
-            VkDevice                        device,
-            std::uint32_t                   numAttachments,
-            std::uint32_t                   numColorAttachments,
-            const VkAttachmentDescription*  attachmentDescs,
-            VkSampleCountFlagBits           sampleCountBits
+            VkDevice                                device,
+            std::uint32_t                           numAttachments,
+            std::uint32_t                           numColorAttachments,
+            const VkAttachmentDescription*          attachmentDescs,
+            VkSampleCountFlagBits                   sampleCountBits,
+            const ArrayView<SubpassDescriptor>&     subpasses           = {},
+            std::uint32_t                           viewMask            = 0
         );
 
-        // Returns the Vulkan render pass object.
+        /*
+        Returns true if this render pass is encoded with dynamic rendering.
+        Render passes with more than one subpass always create a native render pass object, since subpasses cannot be expressed with dynamic rendering.
+        */
+        bool UsesDynamicRendering() const;
+
+        #ifdef VK_KHR_dynamic_rendering
+
+        // Fills the rendering info for graphics pipelines that are compatible with this render pass.
+        void FillPipelineRenderingCreateInfo(VkPipelineRenderingCreateInfoKHR& outCreateInfo) const;
+
+        // Fills the rendering info for secondary command buffers that are executed within this render pass.
+        void FillInheritanceRenderingInfo(VkCommandBufferInheritanceRenderingInfoKHR& outInheritanceInfo) const;
+
+        #endif // /VK_KHR_dynamic_rendering
+
+        // Returns the Vulkan render pass object. This is null if dynamic rendering is enabled.
         inline VkRenderPass GetVkRenderPass() const
         {
             return renderPass_;
         }
 
+        /*
+        Returns the descriptor of the specified attachment.
+        Color attachments come first, followed by the depth-stencil attachment and then the resolve attachments (see GetNumAttachments).
+        */
+        inline const VkAttachmentDescription& GetAttachmentDesc(std::uint32_t index) const
+        {
+            return attachmentDescs_[index];
+        }
+
+        // Returns the number of color and depth-stencil attachments, i.e. the index of the first resolve attachment descriptor.
+        inline std::uint8_t GetNumAttachments() const
+        {
+            return numAttachments_;
+        }
+
         /*
         Returns the bitmask for all attachments that require a clear value.
         the least significant bit specifies whether the first attachment has a clear value or not.
@@ -76,21 +138,56 @@ class VKRenderPass final : public RenderPass
             return numColorAttachments_;
         }
 
+        // Returns the number of subpasses of this render pass. This is at least 1.
+        inline std::uint32_t GetNumSubpasses() const
+        {
+            return static_cast<std::uint32_t>(subpassColorAttachmentCounts_.size());
+        }
+
+        // Returns the number of color attachment references of the specified subpass, i.e. the number of blend states graphics PSOs must specify for that subpass.
+        inline std::uint8_t GetNumSubpassColorAttachments(std::uint32_t subpass) const
+        {
+            return (subpass < subpassColorAttachmentCounts_.size() ? subpassColorAttachmentCounts_[subpass] : numColorAttachments_);
+        }
+
         // Returns the sample count flag bits for this render pass.
         inline VkSampleCountFlagBits GetSampleCountBits() const
         {
             return sampleCountBits_;
         }
 
-    private:
+        // Returns the bitmask of views for multiview rendering. This is 0 if multiview rendering is disabled.
+        inline std::uint32_t GetViewMask() const
+        {
+            return viewMask_;
+        }
 
-        VKPtr<VkRenderPass>     renderPass_;
+        /*
+        Returns the unique ID of the native render pass. A new ID is generated each time the native render pass is (re-)created.
+        With dynamic rendering, this is a hash of the attachment formats and sample count, i.e. all compatible render passes share the same ID.
+        */
+        inline std::uint64_t GetUniqueID() const
+        {
+            return uniqueID_;
+        }
+
+    private:
 
-        std::uint64_t           clearValuesMask_        = 0;
-        std::uint8_t            depthStencilIndex_      = 0xFFu;
-        std::uint8_t            numClearValues_         = 0;
-        std::uint8_t            numColorAttachments_    = 0;
-        VkSampleCountFlagBits   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
+        VKPtr<VkRenderPass>                     renderPass_;
+        std::uint64_t                           uniqueID_                                           = 0;
+
+        std::vector<VkAttachmentDescription>    attachmentDescs_;
+        std::vector<std::uint8_t>               subpassColorAttachmentCounts_;
+        VkFormat                                colorFormats_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]       = {};
+        VkFormat                                depthStencilFormat_                                 = VK_FORMAT_UNDEFINED;
+
+        std::uint64_t                           clearValuesMask_                                    = 0;
+        std::uint8_t                            depthStencilIndex_                                  = 0xFFu;
+        std::uint8_t                            numClearValues_                                     = 0;
+        std::uint8_t                            numAttachments_                                     = 0;
+        std::uint8_t                            numColorAttachments_                                = 0;
+        VkSampleCountFlagBits                   sampleCountBits_                                    = VK_SAMPLE_COUNT_1_BIT;
+        std::uint32_t                           viewMask_                                           = 0;
 
 };
 
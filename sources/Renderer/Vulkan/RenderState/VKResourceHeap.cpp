@@ -23,6 +23,7 @@
 #include "../../../Core/Exception.h"
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <map>
 
 
@@ -30,12 +31,19 @@ namespace LLGL
 {
 
 
+VKResourceHeap::VKRetiredVersionBatch::VKRetiredVersionBatch(VkDevice device) :
+    fence { device }
+{
+}
+
 VKResourceHeap::VKResourceHeap(
     VkDevice                                    device,
+    VkQueue                                     queue,
     const ResourceHeapDescriptor&               desc,
     const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
 :
-    descriptorPool_ { device, vkDestroyDescriptorPool }
+    descriptorPool_ { device, vkDestroyDescriptorPool },
+    queue_          { queue                          }
 {
     /* Get pipeline layout object */
     auto* pipelineLayoutVK = LLGL_CAST(VKPipelineLayout*, desc.pipelineLayout);
@@ -44,14 +52,47 @@ VKResourceHeap::VKResourceHeap(
 
     /* Get and validate number of bindings and resource views */
     CopyLayoutBindings(pipelineLayoutVK->GetLayoutHeapBindings());
+    setLayout_ = pipelineLayoutVK->GetSetLayoutForHeapBindings();
 
     const std::uint32_t numBindings         = static_cast<std::uint32_t>(bindings_.size());
     const std::uint32_t numResourceViews    = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
 
     /* Create descriptor pool and array of descriptor sets */
     const std::uint32_t numDescriptorSets = (numResourceViews / numBindings);
-    CreateDescriptorPool(device, numDescriptorSets);
-    CreateDescriptorSets(device, numDescriptorSets, pipelineLayoutVK->GetSetLayoutForHeapBindings());
+    numDescriptorSets_ = numDescriptorSets;
+
+    if (pipelineLayoutVK->IsBindless())
+    {
+        /* Allocate a single descriptor set whose bindings are arrays with one element per descriptor set of this heap */
+        const std::uint32_t capacity = pipelineLayoutVK->GetBindlessCapacity();
+        if (numDescriptorSets > capacity)
+        {
+            LLGL_TRAP(
+                "cannot create bindless resource heap with %u descriptor sets; limit is %u (see RendererConfigurationVulkan::bindlessResourceHeapCapacity)",
+                numDescriptorSets, capacity
+            );
+        }
+
+        #ifdef VK_EXT_descriptor_indexing
+        const VkDescriptorPoolCreateFlags poolFlags = (pipelineLayoutVK->HasHeapUpdateAfterBindPool() ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT : 0);
+        #else
+        const VkDescriptorPoolCreateFlags poolFlags = 0;
+        #endif
+
+        CreateDescriptorPool(device, 1, capacity, poolFlags, descriptorPool_);
+        CreateDescriptorSets(device, 1, setLayout_);
+
+        bindless_           = true;
+        updateWhilePending_ = pipelineLayoutVK->HasHeapUpdateWhilePending();
+    }
+    else
+    {
+        CreateDescriptorPool(device, numDescriptorSets, numDescriptorSets, 0, descriptorPool_);
+        CreateDescriptorSets(device, numDescriptorSets, setLayout_);
+
+        /* Keep track of written descriptors, since only those can be copied into new versions of a descriptor set */
+        writtenDescriptors_.resize(numDescriptorSets * numBindings, false);
+    }
 
     /* Allocate array for descriptor set barriers */
     if ((pipelineLayoutVK->GetBarrierFlags() & BarrierFlags::Storage) != 0)
@@ -64,7 +105,7 @@ VKResourceHeap::VKResourceHeap(
 
 std::uint32_t VKResourceHeap::GetNumDescriptorSets() const
 {
-    return static_cast<std::uint32_t>(descriptorSets_.size());
+    return numDescriptorSets_;
 }
 
 std::uint32_t VKResourceHeap::WriteResourceViews(
@@ -90,6 +131,13 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     VKDescriptorSetWriter setWriter{ numResourceViewWrites, numResourceViewWrites };
     VKDescriptorBarrierWriter barrierWriter;
 
+    /* Replace all affected descriptor sets that may be in use by pending command buffers with new versions */
+    if (!bindless_)
+    {
+        RecycleCompletedVersions(device);
+        CreateDescriptorSetVersions(device, firstDescriptor / numBindings, (firstDescriptor + numResourceViewWrites - 1) / numBindings);
+    }
+
     for (const ResourceViewDescriptor& desc : resourceViews)
     {
         /* Skip over empty resource descriptors */
@@ -115,6 +163,7 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
 
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
                 FillWriteDescriptorWithImageView(device, desc, descriptorSet, binding, setWriter);
                 break;
 
@@ -128,16 +177,28 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
                 break;
         }
 
+        if (!bindless_)
+            writtenDescriptors_[firstDescriptor] = true;
+
         ++firstDescriptor;
     }
 
     if (setWriter.GetNumWrites() > 0)
     {
-        /* All command buffers must have finished execution before any affected descriptor set can be updated */
-        vkDeviceWaitIdle(device);
+        /*
+        All command buffers must have finished execution before the bindless descriptor set can be updated,
+        unless all of its bindings can be updated while it is in use by pending command buffers.
+        Otherwise, the affected descriptor sets have already been replaced by new versions that are not in use yet.
+        */
+        if (bindless_ && !updateWhilePending_)
+            VKDeviceWaitIdle(device);
         setWriter.UpdateDescriptorSets(device);
     }
 
+    /* Fence previous versions that were replaced by this write */
+    if (!bindless_)
+        SubmitRetiredVersions();
+
     /* Update pipeline barriers */
     for_subrange(i, barrierWriter.barrierChangeRanges[0], barrierWriter.barrierChangeRanges[1])
     {
@@ -151,14 +212,14 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     return setWriter.GetNumWrites();
 }
 
-void VKResourceHeap::SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet)
+void VKResourceHeap::SubmitPipelineBarrier(VKCommandContext& context, std::uint32_t descriptorSet)
 {
     if (descriptorSet < barriers_.size())
     {
         if (VKPipelineBarrier* barrier = barriers_[descriptorSet].get())
         {
             if (barrier->IsActive())
-                barrier->Submit(commandBuffer);
+                barrier->Submit(context);
         }
     }
 }
@@ -192,8 +253,9 @@ static bool IsDescriptorTypeImageView(VkDescriptorType type)
 {
     return
     (
-        type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
-        type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE
+        type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE    ||
+        type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE    ||
+        type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT
     );
 }
 
@@ -226,12 +288,17 @@ void VKResourceHeap::CopyLayoutBinding(VKDescriptorBinding& dst, const VKLayoutB
     dst.bufferViewIndex = (IsDescriptorTypeBufferView(src.descriptorType) ? numBufferViewsPerSet_++ : VKResourceHeap::invalidViewIndex);
 }
 
-void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets)
+void VKResourceHeap::CreateDescriptorPool(
+    VkDevice                    device,
+    std::uint32_t               numDescriptorSets,
+    std::uint32_t               numDescriptorsPerBinding,
+    VkDescriptorPoolCreateFlags createFlags,
+    VKPtr<VkDescriptorPool>&    outDescriptorPool)
 {
     /* Accumulate descriptor pool sizes */
     VKPoolSizeAccumulator poolSizeAccum;
     for (const VKDescriptorBinding& binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType, numDescriptorSets);
+        poolSizeAccum.Accumulate(binding.descriptorType, numDescriptorsPerBinding);
     poolSizeAccum.Finalize();
 
     /* Create Vulkan descriptor pool */
@@ -239,12 +306,12 @@ void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDesc
     {
         poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         poolCreateInfo.pNext            = nullptr;
-        poolCreateInfo.flags            = 0;
+        poolCreateInfo.flags            = createFlags;
         poolCreateInfo.maxSets          = numDescriptorSets;
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
     }
-    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, outDescriptorPool.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
 }
 
@@ -292,9 +359,8 @@ void VKResourceHeap::FillWriteDescriptorWithSampler(
     /* Initialize write descriptor */
     VkWriteDescriptorSet* writeDesc = setWriter.NextWriteDescriptor();
     {
-        writeDesc->dstSet           = descriptorSets_[descriptorSet];
+        GetWriteDestination(descriptorSet, writeDesc->dstSet, writeDesc->dstArrayElement);
         writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
         writeDesc->descriptorCount  = 1;
         writeDesc->descriptorType   = binding.descriptorType;
         writeDesc->pImageInfo       = imageInfo;
@@ -313,20 +379,18 @@ void VKResourceHeap::FillWriteDescriptorWithImageView(
     auto* textureVK = LLGL_CAST(VKTexture*, desc.resource);
 
     /* Initialize image information */
-    const std::size_t imageViewIndex = descriptorSet * numImageViewsPerSet_ + binding.imageViewIndex;
     VkDescriptorImageInfo* imageInfo = setWriter.NextImageInfo();
     {
         imageInfo->sampler       = VK_NULL_HANDLE;
-        imageInfo->imageView     = GetOrCreateImageView(device, *textureVK, desc, imageViewIndex);
+        imageInfo->imageView     = GetImageView(device, *textureVK, desc);
         imageInfo->imageLayout   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     }
 
     /* Initialize write descriptor */
     VkWriteDescriptorSet* writeDesc = setWriter.NextWriteDescriptor();
     {
-        writeDesc->dstSet           = descriptorSets_[descriptorSet];
+        GetWriteDestination(descriptorSet, writeDesc->dstSet, writeDesc->dstArrayElement);
         writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
         writeDesc->descriptorCount  = 1;
         writeDesc->descriptorType   = binding.descriptorType;
         writeDesc->pImageInfo       = imageInfo;
@@ -364,9 +428,8 @@ void VKResourceHeap::FillWriteDescriptorWithBufferRange(
     /* Initialize write descriptor */
     VkWriteDescriptorSet* writeDesc = setWriter.NextWriteDescriptor();
     {
-        writeDesc->dstSet           = descriptorSets_[descriptorSet];
+        GetWriteDestination(descriptorSet, writeDesc->dstSet, writeDesc->dstArrayElement);
         writeDesc->dstBinding       = binding.dstBinding;
-        writeDesc->dstArrayElement  = 0;
         writeDesc->descriptorCount  = 1;
         writeDesc->descriptorType   = binding.descriptorType;
         writeDesc->pImageInfo       = nullptr;
@@ -382,6 +445,142 @@ void VKResourceHeap::FillWriteDescriptorWithBufferRange(
     }
 }
 
+void VKResourceHeap::CreateDescriptorSetVersions(VkDevice device, std::uint32_t firstSet, std::uint32_t lastSet)
+{
+    const std::uint32_t numBindings = static_cast<std::uint32_t>(bindings_.size());
+    VKDescriptorSetWriter copyWriter{ 0, 0, (lastSet - firstSet + 1) * numBindings };
+
+    for (std::uint32_t descriptorSet = firstSet; descriptorSet <= lastSet; ++descriptorSet)
+    {
+        /* Descriptor sets that have never been written cannot be in use by the GPU */
+        const auto writtenBegin = writtenDescriptors_.begin() + descriptorSet * numBindings;
+        const auto writtenEnd   = writtenBegin + numBindings;
+        if (std::find(writtenBegin, writtenEnd, true) == writtenEnd)
+            continue;
+
+        /* Copy all written descriptors from the current version into the new one */
+        const VkDescriptorSet prevVersion = descriptorSets_[descriptorSet];
+        const VkDescriptorSet nextVersion = AllocDescriptorSetVersion(device);
+
+        for_range(i, numBindings)
+        {
+            if (writtenBegin[i])
+            {
+                VkCopyDescriptorSet* copyDesc = copyWriter.NextCopyDescriptor();
+                {
+                    copyDesc->srcSet            = prevVersion;
+                    copyDesc->srcBinding        = bindings_[i].dstBinding;
+                    copyDesc->srcArrayElement   = 0;
+                    copyDesc->dstSet            = nextVersion;
+                    copyDesc->dstBinding        = bindings_[i].dstBinding;
+                    copyDesc->dstArrayElement   = 0;
+                    copyDesc->descriptorCount   = 1;
+                }
+            }
+        }
+
+        /* Replace current version and retire the previous one until the GPU has finished all work submitted so far */
+        descriptorSets_[descriptorSet] = nextVersion;
+
+        if (!currentRetiredBatch_)
+            currentRetiredBatch_ = AllocRetiredBatch(device);
+        currentRetiredBatch_->descriptorSets.push_back(prevVersion);
+    }
+
+    /* Perform copies before any writes, since vkUpdateDescriptorSets always performs writes before copies */
+    copyWriter.UpdateDescriptorSets(device);
+}
+
+VkDescriptorSet VKResourceHeap::AllocDescriptorSetVersion(VkDevice device)
+{
+    /* Recycle descriptor set of a previous version that has been retired */
+    if (!freeVersions_.empty())
+    {
+        VkDescriptorSet descriptorSet = freeVersions_.back();
+        freeVersions_.pop_back();
+        return descriptorSet;
+    }
+
+    /* Create new version pool with the same capacity as the primary pool if the last one is exhausted */
+    if (numFreeVersionSlots_ == 0)
+    {
+        VKPtr<VkDescriptorPool> versionPool{ device, vkDestroyDescriptorPool };
+        CreateDescriptorPool(device, numDescriptorSets_, numDescriptorSets_, 0, versionPool);
+        versionPools_.push_back(std::move(versionPool));
+        numFreeVersionSlots_ = numDescriptorSets_;
+    }
+
+    /* Allocate descriptor set from last version pool */
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = versionPools_.back();
+        allocInfo.descriptorSetCount    = 1;
+        allocInfo.pSetLayouts           = &setLayout_;
+    }
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    VkResult result = vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet);
+    VKThrowIfFailed(result, "failed to allocate new version of Vulkan descriptor set");
+    --numFreeVersionSlots_;
+
+    return descriptorSet;
+}
+
+VKResourceHeap::VKRetiredVersionBatchPtr VKResourceHeap::AllocRetiredBatch(VkDevice device)
+{
+    if (freeRetiredBatches_.empty())
+        return VKRetiredVersionBatchPtr{ new VKRetiredVersionBatch{ device } };
+
+    VKRetiredVersionBatchPtr batch = std::move(freeRetiredBatches_.back());
+    freeRetiredBatches_.pop_back();
+    batch->fence.Reset(device);
+    return batch;
+}
+
+void VKResourceHeap::SubmitRetiredVersions()
+{
+    if (currentRetiredBatch_)
+    {
+        /* Fence all work that has been submitted so far with an empty submission, since queue submissions complete in order */
+        VkResult result = VKQueueSubmit(queue_, 0, nullptr, currentRetiredBatch_->fence.GetVkFence());
+        VKThrowIfFailed(result, "failed to submit fence for retired Vulkan descriptor sets");
+        inFlightRetiredBatches_.push_back(std::move(currentRetiredBatch_));
+    }
+}
+
+void VKResourceHeap::RecycleCompletedVersions(VkDevice device)
+{
+    /* Batches complete in submission order, so stop polling at the first batch that is still in flight */
+    std::size_t numCompleted = 0;
+    for (; numCompleted < inFlightRetiredBatches_.size(); ++numCompleted)
+    {
+        VKRetiredVersionBatch& batch = *inFlightRetiredBatches_[numCompleted];
+        if (!batch.fence.Wait(device, 0))
+            break;
+
+        freeVersions_.insert(freeVersions_.end(), batch.descriptorSets.begin(), batch.descriptorSets.end());
+        batch.descriptorSets.clear();
+
+        freeRetiredBatches_.push_back(std::move(inFlightRetiredBatches_[numCompleted]));
+    }
+    inFlightRetiredBatches_.erase(inFlightRetiredBatches_.begin(), inFlightRetiredBatches_.begin() + numCompleted);
+}
+
+void VKResourceHeap::GetWriteDestination(std::uint32_t descriptorSet, VkDescriptorSet& outDstSet, std::uint32_t& outDstArrayElement) const
+{
+    if (bindless_)
+    {
+        outDstSet           = descriptorSets_.front();
+        outDstArrayElement  = descriptorSet;
+    }
+    else
+    {
+        outDstSet           = descriptorSets_[descriptorSet];
+        outDstArrayElement  = 0;
+    }
+}
+
 bool VKResourceHeap::ExchangeBufferBarrier(std::uint32_t descriptorSet, Buffer* resource, const VKDescriptorBinding& binding)
 {
     if (descriptorSet < barriers_.size())
@@ -419,39 +618,13 @@ bool VKResourceHeap::RemoveBarrier(std::uint32_t descriptorSet, std::uint32_t sl
         return false;
 }
 
-VkImageView VKResourceHeap::GetOrCreateImageView(
-    VkDevice                        device,
-    VKTexture&                      textureVK,
-    const ResourceViewDescriptor&   desc,
-    std::size_t                     imageViewIndex)
+VkImageView VKResourceHeap::GetImageView(VkDevice device, VKTexture& textureVK, const ResourceViewDescriptor& desc)
 {
+    /* Image views for subresources are cached by the texture, so writing the same view again does not create a new one */
     if (IsTextureViewEnabled(desc.textureView))
-    {
-        /* Creates a new image view for the specified subresource descriptor */
-        VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
-        textureVK.CreateImageView(device, desc.textureView, imageView);
-
-        /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
-
-        /* Increase image view container for new entry */
-        if (imageViewIndex >= imageViews_.size())
-            imageViews_.resize(imageViewIndex + 1);
-
-        /* Emplace new image view entry */
-        imageViews_[imageViewIndex] = std::move(imageView);
-        return imageViews_[imageViewIndex].Get();
-    }
+        return textureVK.GetOrCreateCachedImageView(device, desc.textureView);
     else
-    {
-        /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
-
-        /* Returns the standard image view */
         return textureVK.GetVkImageView();
-    }
 }
 
 
@@ -14,9 +14,11 @@
 #include <LLGL/Container/SmallVector.h>
 #include "VKPipelineBarrier.h"
 #include "VKPipelineLayout.h"
+#include "VKFence.h"
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -31,6 +33,13 @@ struct ResourceHeapDescriptor;
 struct ResourceViewDescriptor;
 struct TextureViewDescriptor;
 
+/*
+Resource heap of Vulkan descriptor sets.
+Unless all descriptors can be updated while the heap is in use by pending command buffers (bindless mode with update-after-bind),
+each descriptor set that is written again is replaced by a new version (copy-on-write) instead of waiting for the device to become idle.
+Previous versions are retired with a fence that is submitted to the graphics queue after the write and recycled once the fence has been signaled.
+Command buffers that have been encoded with the current version must therefore be submitted before the heap is written again.
+*/
 class VKResourceHeap final : public ResourceHeap
 {
 
@@ -42,6 +51,7 @@ class VKResourceHeap final : public ResourceHeap
 
         VKResourceHeap(
             VkDevice                                    device,
+            VkQueue                                     queue,
             const ResourceHeapDescriptor&               desc,
             const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
         );
@@ -52,8 +62,8 @@ class VKResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
-        // Inserts a pipeline barrier command into the command buffer if this resource heap requires it.
-        void SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet);
+        // Enqueues the pipeline barrier into the command context if this resource heap requires it.
+        void SubmitPipelineBarrier(VKCommandContext& context, std::uint32_t descriptorSet);
 
         // Returns the native Vulkan descritpor pool.
         inline VkDescriptorPool GetVkDescriptorPool() const
@@ -61,12 +71,18 @@ class VKResourceHeap final : public ResourceHeap
             return descriptorPool_.Get();
         }
 
-        // Returns the list of native Vulkan descriptor sets.
+        // Returns the list of native Vulkan descriptor sets. In bindless mode, this only contains a single descriptor set.
         inline const std::vector<VkDescriptorSet>& GetVkDescriptorSets() const
         {
             return descriptorSets_;
         }
 
+        // Returns true if all descriptor sets of this heap are array elements of a single native descriptor set. See VKPipelineLayout::IsBindless.
+        inline bool IsBindless() const
+        {
+            return bindless_;
+        }
+
     private:
 
         static constexpr std::uint32_t invalidViewIndex = 0xFFFF;
@@ -85,12 +101,29 @@ class VKResourceHeap final : public ResourceHeap
             std::uint32_t barrierChangeRanges[2] = {};
         };
 
+        // Batch of retired descriptor set versions that are recycled once the fence has been signaled.
+        struct VKRetiredVersionBatch
+        {
+            VKRetiredVersionBatch(VkDevice device);
+
+            VKFence                             fence;
+            std::vector<VkDescriptorSet>        descriptorSets;
+        };
+
+        using VKRetiredVersionBatchPtr = std::unique_ptr<VKRetiredVersionBatch>;
+
     private:
 
         void CopyLayoutBindings(const ArrayView<VKLayoutBinding>& layoutBindings);
         void CopyLayoutBinding(VKDescriptorBinding& dst, const VKLayoutBinding& src);
 
-        void CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets);
+        void CreateDescriptorPool(
+            VkDevice                    device,
+            std::uint32_t               numDescriptorSets,
+            std::uint32_t               numDescriptorsPerBinding,
+            VkDescriptorPoolCreateFlags createFlags,
+            VKPtr<VkDescriptorPool>&    outDescriptorPool
+        );
 
         void CreateDescriptorSets(
             VkDevice                device,
@@ -122,17 +155,28 @@ class VKResourceHeap final : public ResourceHeap
             VKDescriptorBarrierWriter&      barrierWriter
         );
 
+        // Replaces all previously written descriptor sets in the range [firstSet, lastSet] by new versions and retires the previous ones.
+        void CreateDescriptorSetVersions(VkDevice device, std::uint32_t firstSet, std::uint32_t lastSet);
+
+        // Returns a recycled descriptor set or allocates a new one from the version pools.
+        VkDescriptorSet AllocDescriptorSetVersion(VkDevice device);
+
+        // Returns a batch for retired versions with an unsignaled fence, either recycled or newly created.
+        VKRetiredVersionBatchPtr AllocRetiredBatch(VkDevice device);
+
+        // Fences all versions retired by the current write and recycles those of previous writes that have completed on the GPU.
+        void SubmitRetiredVersions();
+        void RecycleCompletedVersions(VkDevice device);
+
+        // Returns the native descriptor set and array element that must be written for the specified descriptor set of this heap.
+        void GetWriteDestination(std::uint32_t descriptorSet, VkDescriptorSet& outDstSet, std::uint32_t& outDstArrayElement) const;
+
         bool ExchangeBufferBarrier(std::uint32_t descriptorSet, Buffer* resource, const VKDescriptorBinding& binding);
         bool EmplaceBarrier(std::uint32_t descriptorSet, std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags);
         bool RemoveBarrier(std::uint32_t descriptorSet, std::uint32_t slot);
 
-        // Returns the image view for the specified texture or creates one if the texture-view is enabled.
-        VkImageView GetOrCreateImageView(
-            VkDevice                        device,
-            VKTexture&                      textureVK,
-            const ResourceViewDescriptor&   desc,
-            std::size_t                     imageViewIndex
-        );
+        // Returns the image view for the specified texture or the cached subresource view if the texture-view is enabled.
+        VkImageView GetImageView(VkDevice device, VKTexture& textureVK, const ResourceViewDescriptor& desc);
 
     private:
 
@@ -140,13 +184,26 @@ class VKResourceHeap final : public ResourceHeap
         std::vector<VkDescriptorSet>        descriptorSets_;
         SmallVector<VKDescriptorBinding>    bindings_;
 
-        std::vector<VKPtr<VkImageView>>     imageViews_;
       //std::vector<VKPtr<VkBufferView>>    bufferViews_;
         std::uint32_t                       numImageViewsPerSet_    = 0;
         std::uint32_t                       numBufferViewsPerSet_   = 0;
 
         std::vector<VKPipelineBarrierPtr>   barriers_;
 
+        std::uint32_t                       numDescriptorSets_      = 0;
+        bool                                bindless_               = false;
+        bool                                updateWhilePending_     = false; // Descriptors can be written without waiting for the device to become idle.
+
+        VkQueue                             queue_                  = VK_NULL_HANDLE;
+        VkDescriptorSetLayout               setLayout_              = VK_NULL_HANDLE;
+        std::vector<bool>                   writtenDescriptors_;                // Descriptors that have been written at least once, i.e. must be copied into new versions.
+        std::vector<VKPtr<VkDescriptorPool>> versionPools_;
+        std::uint32_t                       numFreeVersionSlots_    = 0;        // Number of descriptor sets that can still be allocated from the last version pool.
+        std::vector<VkDescriptorSet>        freeVersions_;
+        VKRetiredVersionBatchPtr            currentRetiredBatch_;
+        std::vector<VKRetiredVersionBatchPtr> inFlightRetiredBatches_;          // Batches in submission order
+        std::vector<VKRetiredVersionBatchPtr> freeRetiredBatches_;
+
 };
 
 
@@ -59,6 +59,18 @@ class VKStagingDescriptorPool
             const VkDescriptorPoolSize* sizes
         );
 
+        // Returns the maximum number of descriptor sets this pool was initialized with.
+        inline std::uint32_t GetSetCapacity() const
+        {
+            return setCapacity_;
+        }
+
+        // Returns the maximum number of descriptors of the specified type this pool was initialized with.
+        inline std::uint32_t GetDescriptorCapacity(VkDescriptorType type) const
+        {
+            return poolCapacities_[static_cast<int>(type)];
+        }
+
     private:
 
         VkDevice                device_                             = VK_NULL_HANDLE;
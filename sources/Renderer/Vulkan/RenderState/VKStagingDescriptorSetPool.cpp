@@ -19,14 +19,38 @@ VKStagingDescriptorSetPool::VKStagingDescriptorSetPool(VkDevice device) :
 {
 }
 
+// Number of consecutive resets with an oversized descriptor pool before it is shrunk.
+static constexpr std::uint32_t g_maxNumOversizedResets = 120;
+
 void VKStagingDescriptorSetPool::Reset()
 {
-    if (!descriptorPools_.empty())
+    if (descriptorPools_.empty())
+        return;
+
+    UpdatePeakUsage();
+
+    if (descriptorPoolIndex_ > 0)
+    {
+        /* Last frame ran out of space in the first pool, so replace all pools by a single one that fits the peak usage */
+        descriptorPools_.clear();
+        AllocateDescriptorPoolForPeakUsage();
+        numOversizedResets_ = 0;
+    }
+    else if (IsDescriptorPoolOversized(descriptorPools_.front()) && ++numOversizedResets_ >= g_maxNumOversizedResets)
+    {
+        /* Shrink pool that has been much larger than needed for a while to reduce driver memory */
+        descriptorPools_.clear();
+        AllocateDescriptorPoolForPeakUsage();
+        numOversizedResets_ = 0;
+    }
+    else
     {
-        for_range(i, descriptorPoolIndex_ + 1)
-            descriptorPools_[i].Reset();
-        descriptorPoolIndex_ = 0;
+        descriptorPools_.front().Reset();
+        if (!IsDescriptorPoolOversized(descriptorPools_.front()))
+            numOversizedResets_ = 0;
     }
+
+    descriptorPoolIndex_ = 0;
 }
 
 VkDescriptorSet VKStagingDescriptorSetPool::AllocateDescriptorSet(
@@ -46,6 +70,12 @@ VkDescriptorSet VKStagingDescriptorSetPool::AllocateDescriptorSet(
         if (descriptorPoolIndex_ == descriptorPools_.size())
             AllocateDescriptorPool();
     }
+
+    /* Record usage for the size of the next descriptor pools */
+    ++numSets_;
+    for_range(i, numSizes)
+        numDescriptors_[static_cast<int>(sizes[i].type)] += sizes[i].descriptorCount;
+
     return descriptorPools_[descriptorPoolIndex_].AllocateDescriptorSet(setLayout, numSizes, sizes);
 }
 
@@ -66,23 +96,83 @@ static std::uint32_t GetDescriptorPoolCapacity(std::uint32_t level)
     return (initialCapacity << std::min(level, 5u));
 }
 
+// Returns the specified usage plus 50% headroom, but no less than the specified minimum.
+static std::uint32_t GetCapacityWithHeadroom(std::uint32_t usage, std::uint32_t minCapacity)
+{
+    return std::max(usage + usage/2, minCapacity);
+}
+
+static constexpr VkDescriptorType g_stagingDescriptorTypes[] =
+{
+    VK_DESCRIPTOR_TYPE_SAMPLER,
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
+    VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+};
+
+static constexpr std::uint32_t g_numStagingDescriptorTypes = sizeof(g_stagingDescriptorTypes)/sizeof(g_stagingDescriptorTypes[0]);
+
+static constexpr std::uint32_t g_minDescriptorSetCapacity   = 64;
+static constexpr std::uint32_t g_minDescriptorPoolCapacity  = 64;
+
 void VKStagingDescriptorSetPool::AllocateDescriptorPool()
 {
     const std::uint32_t descriptorPoolSize = GetDescriptorPoolCapacity(capacityLevel_);
-    const VkDescriptorPoolSize poolSizes[] =
-    {
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLER,        descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,  descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,  descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptorPoolSize },
-    };
+    VkDescriptorPoolSize poolSizes[g_numStagingDescriptorTypes];
+    for_range(i, g_numStagingDescriptorTypes)
+        poolSizes[i] = VkDescriptorPoolSize{ g_stagingDescriptorTypes[i], descriptorPoolSize };
     const std::uint32_t setCapacity = GetDescriptorSetCapacity(capacityLevel_);
     descriptorPools_.emplace_back(device_);
-    descriptorPools_.back().Initialize(setCapacity, sizeof(poolSizes)/sizeof(poolSizes[0]), poolSizes);
+    descriptorPools_.back().Initialize(setCapacity, g_numStagingDescriptorTypes, poolSizes);
     ++capacityLevel_;
 }
 
+void VKStagingDescriptorSetPool::AllocateDescriptorPoolForPeakUsage()
+{
+    VkDescriptorPoolSize poolSizes[g_numStagingDescriptorTypes];
+    for_range(i, g_numStagingDescriptorTypes)
+    {
+        const VkDescriptorType type = g_stagingDescriptorTypes[i];
+        poolSizes[i] = VkDescriptorPoolSize{ type, GetCapacityWithHeadroom(peakNumDescriptors_[static_cast<int>(type)], g_minDescriptorPoolCapacity) };
+    }
+    const std::uint32_t setCapacity = GetCapacityWithHeadroom(peakNumSets_, g_minDescriptorSetCapacity);
+    descriptorPools_.emplace_back(device_);
+    descriptorPools_.back().Initialize(setCapacity, g_numStagingDescriptorTypes, poolSizes);
+}
+
+// Returns the maximum of the current usage and the previous peak, which decays by 1/16 each frame.
+static std::uint32_t DecayPeakUsage(std::uint32_t peak, std::uint32_t usage)
+{
+    return std::max(usage, peak - peak/16);
+}
+
+void VKStagingDescriptorSetPool::UpdatePeakUsage()
+{
+    peakNumSets_ = DecayPeakUsage(peakNumSets_, numSets_);
+    numSets_ = 0;
+    for_range(i, numDescriptorTypes)
+    {
+        peakNumDescriptors_[i] = DecayPeakUsage(peakNumDescriptors_[i], numDescriptors_[i]);
+        numDescriptors_[i] = 0;
+    }
+}
+
+bool VKStagingDescriptorSetPool::IsDescriptorPoolOversized(const VKStagingDescriptorPool& descriptorPool) const
+{
+    /* Pool is oversized if it can hold more than four times the peak usage plus headroom for all descriptor types */
+    if (descriptorPool.GetSetCapacity() <= GetCapacityWithHeadroom(peakNumSets_, g_minDescriptorSetCapacity) * 4)
+        return false;
+    for (VkDescriptorType type : g_stagingDescriptorTypes)
+    {
+        const std::uint32_t peakCapacity = GetCapacityWithHeadroom(peakNumDescriptors_[static_cast<int>(type)], g_minDescriptorPoolCapacity);
+        if (descriptorPool.GetDescriptorCapacity(type) <= peakCapacity * 4)
+            return false;
+    }
+    return true;
+}
+
 
 
 } // /namespace LLGL
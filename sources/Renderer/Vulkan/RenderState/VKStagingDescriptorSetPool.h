@@ -17,7 +17,12 @@ namespace LLGL
 {
 
 
-// Pool of Vulkan staging descriptor sets.
+/*
+Pool of Vulkan staging descriptor sets.
+The pool records how many descriptors are allocated between two resets, i.e. per frame,
+and sizes its descriptor pools after the recent peak usage. If a frame required more than one descriptor pool,
+all pools are replaced by a single one on the next reset, and a pool that is persistently oversized is shrunk.
+*/
 class VKStagingDescriptorSetPool
 {
 
@@ -25,7 +30,7 @@ class VKStagingDescriptorSetPool
 
         VKStagingDescriptorSetPool(VkDevice device);
 
-        // Resets all chunks in the pool.
+        // Resets all chunks in the pool and resizes the descriptor pools for the recorded usage if necessary.
         void Reset();
 
         // Copies the specified source descriptors into the native D3D descriptor heap.
@@ -40,12 +45,29 @@ class VKStagingDescriptorSetPool
         // Allocates a new descriptor pool with increased capacity.
         void AllocateDescriptorPool();
 
+        // Allocates a new descriptor pool that fits the peak usage plus some headroom.
+        void AllocateDescriptorPoolForPeakUsage();
+
+        // Updates the peak usage with the usage since the last reset.
+        void UpdatePeakUsage();
+
+        // Returns true if the specified descriptor pool is significantly larger than the peak usage.
+        bool IsDescriptorPoolOversized(const VKStagingDescriptorPool& descriptorPool) const;
+
     private:
 
-        VkDevice                                device_                 = VK_NULL_HANDLE;
+        static constexpr int numDescriptorTypes = VKStagingDescriptorPool::numDescriptorTypes;
+
+        VkDevice                                device_                                     = VK_NULL_HANDLE;
         std::vector<VKStagingDescriptorPool>    descriptorPools_;
-        std::size_t                             descriptorPoolIndex_    = 0;
-        std::uint32_t                           capacityLevel_          = 0;
+        std::size_t                             descriptorPoolIndex_                        = 0;
+        std::uint32_t                           capacityLevel_                              = 0;
+
+        std::uint32_t                           numSets_                                    = 0; // Number of sets allocated since last reset
+        std::uint32_t                           numDescriptors_[numDescriptorTypes]         = {};
+        std::uint32_t                           peakNumSets_                                = 0; // Slowly decaying maximum of numSets_
+        std::uint32_t                           peakNumDescriptors_[numDescriptorTypes]     = {};
+        std::uint32_t                           numOversizedResets_                         = 0; // Number of consecutive resets with an oversized pool
 
 };
 
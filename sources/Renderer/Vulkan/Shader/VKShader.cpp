@@ -14,14 +14,17 @@
 #include "../../../Core/ReportUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../PipelineStateUtils.h"
+#include "../../PersistentPipelineCache.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <set>
 
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 #   include "../../SPIRV/SpirvReflect.h"
+#   include "../../SPIRV/SpirvStrip.h"
 #endif
 
 
@@ -45,12 +48,21 @@ static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::ve
     return shaderModule;
 }
 
-VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
-    Shader  { desc.type },
-    device_ { device    }
+static std::uint64_t GenerateUniqueShaderID()
+{
+    static std::atomic<std::uint64_t> nextID{ 1 };
+    return nextID++;
+}
+
+VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc, PersistentPipelineCache* persistentCache) :
+    Shader    { desc.type                },
+    device_   { device                   },
+    uniqueID_ { GenerateUniqueShaderID() }
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
+    BuildContentHash();
+    BuildReflectRecord(persistentCache);
     BuildBindingLayout();
     BuildReport();
 }
@@ -123,10 +135,10 @@ bool VKShader::NeedsShaderModulePermutation(const PermutationBindingFunc& permut
     return false;
 }
 
-VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc)
+bool VKShader::BuildShaderCodePermutation(const PermutationBindingFunc& permutationBindingFunc, VKShaderCode& outShaderCode) const
 {
     if (!permutationBindingFunc)
-        return VK_NULL_HANDLE;
+        return false;
 
     /* Re-assign binding slots with a permutation of the binding layout */
     VKShaderBindingLayout bindingLayoutPerm = bindingLayout_;
@@ -141,15 +153,19 @@ VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const Permutatio
             modified = true;
     }
 
-    /* Create shader module permuation if there is at least one modified binding slot */
+    /* Patch binding decorations of the shader code permuation if there is at least one modified binding slot */
     if (modified)
     {
-        VKShaderCode shaderCodePerm = shaderCode_;
-        bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
-        return CreateVkShaderModule(device_, shaderCodePerm);
+        outShaderCode = shaderCode_;
+        bindingLayoutPerm.UpdateSpirvModule(outShaderCode.data(), outShaderCode.size() * sizeof(std::uint32_t));
     }
 
-    return VK_NULL_HANDLE;
+    return modified;
+}
+
+VKPtr<VkShaderModule> VKShader::CreateVkShaderModuleFromCode(const VKShaderCode& shaderCode) const
+{
+    return CreateVkShaderModule(device_, shaderCode);
 }
 
 static const char* GetOptString(const char* s)
@@ -167,6 +183,8 @@ static long ShaderTypeToStageFlags(const ShaderType type)
         case ShaderType::Geometry:          return StageFlags::GeometryStage;
         case ShaderType::Fragment:          return StageFlags::FragmentStage;
         case ShaderType::Compute:           return StageFlags::ComputeStage;
+        case ShaderType::Task:              return StageFlags::TaskStage;
+        case ShaderType::Mesh:              return StageFlags::MeshStage;
         default:                            return 0;
     }
 }
@@ -447,13 +465,13 @@ bool VKShader::ReflectLocalSize(Extent3D& outLocalSize) const
     if (GetType() != ShaderType::Compute)
         return false;
 
-    /* Parse shader module for execution mode */
-    SpirvReflect::SpvExecutionMode executionMode;
-    SpirvReflectExecutionMode(SpirvModuleView{ shaderCode_ }, executionMode);
+    if (!hasReflectRecord_)
+        return false;
 
-    /* Return local work group size */
+    /* Return local work group size from reflected execution mode */
+    const SpirvReflect::SpvExecutionMode& executionMode = reflectRecord_.executionMode;
     outLocalSize.x  = executionMode.localSizeX;
-    outLocalSize.y = executionMode.localSizeY;
+    outLocalSize.y  = executionMode.localSizeY;
     outLocalSize.z  = executionMode.localSizeZ;
 
     return true;
@@ -466,10 +484,7 @@ bool VKShader::ReflectPushConstants(
     /* Initialize output container with zero-ranges */
     outUniformRanges.resize(inUniformDescs.size());
 
-    /* Parse shader module for push-constants */
-    SpirvReflect::SpvBlock block;
-    SpirvResult result = SpirvReflectPushConstants(SpirvModuleView{ shaderCode_ }, block);
-    if (result != SpirvResult::NoError)
+    if (!hasReflectRecord_)
         return false;
 
     /* Build push constant ranges */
@@ -477,9 +492,9 @@ bool VKShader::ReflectPushConstants(
     {
         /* Find name of uniform descriptor in push-constant block fields */
         const UniformDescriptor& uniformDesc = inUniformDescs[i];
-        for (const SpirvReflect::SpvBlockField& field : block.fields)
+        for (const SpirvReflectRecord::PushConstantField& field : reflectRecord_.pushConstantFields)
         {
-            if (field.name != nullptr && ::strcmp(field.name, uniformDesc.name.c_str()) == 0)
+            if (field.name == uniformDesc.name)
             {
                 VKUniformRange& range = outUniformRanges[i];
                 {
@@ -580,9 +595,50 @@ void VKShader::BuildInputLayout(std::size_t numVertexAttribs, const VertexAttrib
     inputLayout_.bindingDescs.insert(inputLayout_.bindingDescs.end(), bindingDescSet.begin(), bindingDescSet.end());
 }
 
+void VKShader::BuildReflectRecord(PersistentPipelineCache* persistentCache)
+{
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+    if (shaderCode_.empty())
+        return;
+
+    /* Try to load reflection record from persistent cache first; the key only depends on the shader content */
+    std::uint64_t cacheKey = 0;
+    if (persistentCache != nullptr)
+    {
+        PersistentPipelineCacheKey key;
+        key.AppendString("SpirvReflectRecord");
+        key.Append(contentHash_);
+        cacheKey = key.Get();
+
+        if (Blob cachedRecord = persistentCache->Find(cacheKey))
+        {
+            if (SpirvDeserializeReflectRecord(cachedRecord.GetData(), cachedRecord.GetSize(), reflectRecord_))
+            {
+                hasReflectRecord_ = true;
+                return;
+            }
+        }
+    }
+
+    /* Reflect SPIR-V module in a single pass and store record in persistent cache */
+    if (SpirvReflectModuleRecord(SpirvModuleView{ shaderCode_ }, reflectRecord_) != SpirvResult::NoError)
+        return;
+
+    hasReflectRecord_ = true;
+
+    if (persistentCache != nullptr)
+        persistentCache->Store(cacheKey, Blob::CreateStrongRef(SpirvSerializeReflectRecord(reflectRecord_)));
+
+    #endif // /LLGL_ENABLE_SPIRV_REFLECT
+}
+
 void VKShader::BuildBindingLayout()
 {
-    bindingLayout_.BuildFromSpirvModule(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    if (hasReflectRecord_)
+        bindingLayout_.BuildFromBindingPoints(reflectRecord_.bindingPoints);
+    #endif
 }
 
 void VKShader::BuildReport()
@@ -603,6 +659,15 @@ void VKShader::BuildReport()
     }
 }
 
+void VKShader::BuildContentHash()
+{
+    PersistentPipelineCacheKey hash;
+    hash.Append(GetType());
+    hash.AppendString(entryPoint_.c_str());
+    hash.AppendBytes(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
+    contentHash_ = hash.Get();
+}
+
 bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
     return false; // dummy
@@ -642,6 +707,18 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         shaderCode_ = std::vector<std::uint32_t>(words, words + binaryLength/sizeof(std::uint32_t));
     }
 
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+    /* Strip debug information and dead code before the module is created and reflected */
+    if ((shaderDesc.flags & ShaderCompileFlags::StripDebugInfo) != 0)
+    {
+        SpirvModule module{ std::move(shaderCode_) };
+        SpirvStripModule(module);
+        shaderCode_ = std::move(module.Words());
+    }
+
+    #endif // /LLGL_ENABLE_SPIRV_REFLECT
+
     /* Store shader entry point (by default "main" for GLSL) */
     if (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0')
         entryPoint_ = "main";
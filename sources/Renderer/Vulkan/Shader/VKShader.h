@@ -24,6 +24,7 @@ namespace LLGL
 
 struct ShaderReflection;
 struct Extent3D;
+class PersistentPipelineCache;
 
 // Container type of 32-bit words for Vulkan shader binary code.
 using VKShaderCode = std::vector<std::uint32_t>;
@@ -48,7 +49,7 @@ class VKShader final : public Shader
 
     public:
 
-        VKShader(VkDevice device, const ShaderDescriptor& desc);
+        VKShader(VkDevice device, const ShaderDescriptor& desc, PersistentPipelineCache* persistentCache = nullptr);
         ~VKShader();
 
         bool ReflectLocalSize(Extent3D& outLocalSize) const;
@@ -72,11 +73,15 @@ class VKShader final : public Shader
         bool NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const;
 
         /*
-        Creates a shader module permutation with re-assigned binding slots using the specified function callback.
+        Builds a copy of the SPIR-V module with re-assigned binding slots using the specified function callback.
         Re-assigned descriptor sets for [0, N) invocations of the callback until 'permutationBindingFunc' returns false.
-        Returns VK_NULL_HANDLE if no permutation was created. Should only be used by VKPipelineLayout.
+        The decorations are patched in-place in the copied word stream, so no shader source is recompiled.
+        Returns false if no binding slot was modified. Should only be used by VKPipelineLayout.
         */
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc);
+        bool BuildShaderCodePermutation(const PermutationBindingFunc& permutationBindingFunc, VKShaderCode& outShaderCode) const;
+
+        // Creates a new Vulkan shader module from the specified SPIR-V code, e.g. a permutation of this shader. Should only be used by VKShaderModulePool.
+        VKPtr<VkShaderModule> CreateVkShaderModuleFromCode(const VKShaderCode& shaderCode) const;
 
         // Returns the Vulkan shader module.
         inline const VKPtr<VkShaderModule>& GetShaderModule() const
@@ -84,6 +89,18 @@ class VKShader final : public Shader
             return shaderModule_;
         }
 
+        // Returns the unique ID of this shader. IDs are never reused, unlike the addresses of released shaders.
+        inline std::uint64_t GetUniqueID() const
+        {
+            return uniqueID_;
+        }
+
+        // Returns a hash of the shader type, entry point, and SPIR-V code. Unlike the unique ID, this is the same across application runs.
+        inline std::uint64_t GetContentHash() const
+        {
+            return contentHash_;
+        }
+
     private:
 
         // Note: "Success" is a reserved macro by X11 lib.
@@ -99,8 +116,10 @@ class VKShader final : public Shader
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
+        void BuildReflectRecord(PersistentPipelineCache* persistentCache);
         void BuildBindingLayout();
         void BuildReport();
+        void BuildContentHash();
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
         bool LoadBinary(const ShaderDescriptor& shaderDesc);
@@ -116,11 +135,18 @@ class VKShader final : public Shader
     private:
 
         VkDevice                device_             = VK_NULL_HANDLE;
+        std::uint64_t           uniqueID_           = 0;
+        std::uint64_t           contentHash_        = 0;
 
         VKPtr<VkShaderModule>   shaderModule_;
         VKShaderCode            shaderCode_;
         VKShaderBindingLayout   bindingLayout_;
 
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        SpirvReflectRecord      reflectRecord_;                         // Reflection record for binding points, push constants, and execution mode.
+        bool                    hasReflectRecord_   = false;
+        #endif
+
         LoadBinaryResult        loadBinaryResult_   = LoadBinaryResult::Undefined;
         VertexInputLayout       inputLayout_;
 
@@ -12,26 +12,15 @@
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
-#ifdef LLGL_ENABLE_SPIRV_REFLECT
-#   include "../../SPIRV/SpirvReflect.h"
-#   include "../../SPIRV/SpirvModule.h"
-#endif
-
 
 namespace LLGL
 {
 
 
-bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t size)
-{
-    #ifdef LLGL_ENABLE_SPIRV_REFLECT
-
-    /* Reflect all SPIR-V binding points */
-    std::vector<SpirvReflect::SpvBindingPoint> bindingPoints;
-    SpirvResult result = SpirvReflectBindingPoints(SpirvModuleView{ data, size }, bindingPoints);
-    if (result != SpirvResult::NoError)
-        return false;
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
 
+void VKShaderBindingLayout::BuildFromBindingPoints(const std::vector<SpirvReflect::SpvBindingPoint>& bindingPoints)
+{
     /* Convert binding points into to module bindings */
     bindings_.resize(bindingPoints.size());
 
@@ -58,17 +47,10 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
             return lhs.dstBinding < rhs.dstBinding;
         }
     );
-
-    return true;
-
-    #else
-
-    /* Cannot build binding layout from SPIR-V module without capability of SPIR-V reflection */
-    return false;
-
-    #endif
 }
 
+#endif // /LLGL_ENABLE_SPIRV_REFLECT
+
 //private
 bool VKShaderBindingLayout::MatchesBindingSlot(
     const ModuleBinding&    binding,
@@ -14,6 +14,10 @@
 #include <vector>
 #include <cstdint>
 
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvReflect.h"
+#endif
+
 
 namespace LLGL
 {
@@ -24,8 +28,12 @@ class VKShaderBindingLayout
 
     public:
 
-        // Builds the internal binding table from the specified SPIR-V module.
-        bool BuildFromSpirvModule(const void* data, std::size_t size);
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+        // Builds the internal binding table from the specified reflected binding points, e.g. from a cached SPIR-V reflection record.
+        void BuildFromBindingPoints(const std::vector<SpirvReflect::SpvBindingPoint>& bindingPoints);
+
+        #endif // /LLGL_ENABLE_SPIRV_REFLECT
 
         // Returns true if the binding layout already matches the layout as is assigned by 'AssignBindingSlots'.
         bool MatchesBindingSlots(
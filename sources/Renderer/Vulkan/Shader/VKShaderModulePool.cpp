@@ -9,6 +9,8 @@
 #include "../RenderState/VKPipelineLayout.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../PersistentPipelineCache.h"
+#include "../../../Core/CPUProfilerUtils.h"
 
 
 namespace LLGL
@@ -23,11 +25,15 @@ VKShaderModulePool& VKShaderModulePool::Get()
 
 void VKShaderModulePool::Clear()
 {
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKShaderModulePool");
     permutations_.clear();
+    sharedModules_.clear();
 }
 
 VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKShaderModulePool");
+
     /* Try to find existing pair of shader/pipeline-layout */
     const auto* shaderPtr = &shader;
     const auto* pipelineLayoutPtr = &pipelineLayout;
@@ -47,29 +53,36 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
 
     if (permutation == nullptr)
     {
-        /* Create new shader module permutation */
-        VKPtr<VkShaderModule> shaderModule = pipelineLayout.CreateVkShaderModulePermutation(shader);
-        VkShaderModule nativeHandle = shaderModule.Get();
+        /* Build patched SPIR-V code for new permutation */
+        std::vector<std::uint32_t> shaderCode;
+        if (!pipelineLayout.BuildShaderCodePermutation(shader, shaderCode))
+            return VK_NULL_HANDLE;
 
-        if (nativeHandle != VK_NULL_HANDLE)
+        /* Share shader module with all other permutations that have the same code */
+        ShaderModulePermutation newPermutation;
         {
-            ShaderModulePermutation newPermutation;
-            {
-                newPermutation.pipelineLayout   = pipelineLayoutPtr;
-                newPermutation.shader           = shaderPtr;
-                newPermutation.shaderModule     = std::move(shaderModule);
-            }
-            permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
+            newPermutation.pipelineLayout   = pipelineLayoutPtr;
+            newPermutation.shader           = shaderPtr;
+            newPermutation.shaderModule     = AcquireSharedShaderModule(shader, shaderCode, newPermutation.codeHash);
         }
-        return nativeHandle;
+        permutations_.insert(permutations_.begin() + insertionPos, newPermutation);
+        return newPermutation.shaderModule;
     }
 
-    return permutation->shaderModule.Get();
+    return permutation->shaderModule;
 }
 
 void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 {
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKShaderModulePool");
+
     /* Since shader is the second key, we have to iterate over the entire list */
+    for (const ShaderModulePermutation& entry : permutations_)
+    {
+        if (entry.shader == shader)
+            ReleaseSharedShaderModule(entry.codeHash);
+    }
+
     RemoveAllFromListIf(
         permutations_,
         [shader](const ShaderModulePermutation& entry) -> bool
@@ -81,7 +94,15 @@ void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 
 void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
 {
+    LLGL_CPU_PROFILE_LOCK_GUARD(mutex_, "VKShaderModulePool");
+
     /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
+    for (const ShaderModulePermutation& entry : permutations_)
+    {
+        if (entry.pipelineLayout == pipelineLayout)
+            ReleaseSharedShaderModule(entry.codeHash);
+    }
+
     RemoveAllConsecutiveFromListIf(
         permutations_,
         [pipelineLayout](const ShaderModulePermutation& entry) -> bool
@@ -92,6 +113,69 @@ void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineL
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+static std::uint64_t GetShaderCodeHash(const std::vector<std::uint32_t>& shaderCode)
+{
+    PersistentPipelineCacheKey hash;
+    hash.Append(static_cast<std::uint64_t>(shaderCode.size()));
+    hash.AppendBytes(shaderCode.data(), shaderCode.size() * sizeof(std::uint32_t));
+    return hash.Get();
+}
+
+VkShaderModule VKShaderModulePool::AcquireSharedShaderModule(const VKShader& shader, const std::vector<std::uint32_t>& shaderCode, std::uint64_t& outCodeHash)
+{
+    const std::uint64_t codeHash = GetShaderCodeHash(shaderCode);
+    outCodeHash = codeHash;
+
+    std::size_t insertionPos = 0;
+    auto* sharedModule = FindInSortedArray<SharedShaderModule>(
+        sharedModules_.data(),
+        sharedModules_.size(),
+        [codeHash](const SharedShaderModule& entry) -> int
+        {
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(codeHash, entry.codeHash);
+            return 0;
+        },
+        &insertionPos
+    );
+
+    if (sharedModule == nullptr)
+    {
+        /* Create new shader module from patched code */
+        SharedShaderModule newSharedModule;
+        {
+            newSharedModule.codeHash        = codeHash;
+            newSharedModule.shaderModule    = shader.CreateVkShaderModuleFromCode(shaderCode);
+        }
+        sharedModule = &*sharedModules_.insert(sharedModules_.begin() + insertionPos, std::move(newSharedModule));
+    }
+
+    ++sharedModule->refCount;
+    return sharedModule->shaderModule.Get();
+}
+
+void VKShaderModulePool::ReleaseSharedShaderModule(std::uint64_t codeHash)
+{
+    std::size_t index = 0;
+    auto* sharedModule = FindInSortedArray<SharedShaderModule>(
+        sharedModules_.data(),
+        sharedModules_.size(),
+        [codeHash](const SharedShaderModule& entry) -> int
+        {
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(codeHash, entry.codeHash);
+            return 0;
+        },
+        &index
+    );
+
+    if (sharedModule != nullptr && --sharedModule->refCount == 0)
+        sharedModules_.erase(sharedModules_.begin() + (sharedModule - sharedModules_.data()));
+}
+
+
 } // /namespace LLGL
 
 
@@ -12,6 +12,8 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
+#include <mutex>
+#include <cstdint>
 
 
 namespace LLGL
@@ -21,7 +23,11 @@ namespace LLGL
 class VKShader;
 class VKPipelineLayout;
 
-// Singleton pool for Vulkan shader/pipeline-layout permutations.
+/*
+Singleton pool for Vulkan shader/pipeline-layout permutations. All functions are thread-safe, since PSOs can be created concurrently.
+Permutations are patched in the SPIR-V word stream and the resulting shader modules are shared by the hash of their code,
+so identical modules of different shaders (e.g. material permutations loaded separately) only invoke vkCreateShaderModule once.
+*/
 class VKShaderModulePool
 {
 
@@ -49,6 +55,14 @@ class VKShaderModulePool
         {
             const VKPipelineLayout* pipelineLayout  = nullptr;
             const VKShader*         shader          = nullptr;
+            std::uint64_t           codeHash        = 0;
+            VkShaderModule          shaderModule    = VK_NULL_HANDLE;   // Reference to the shared shader module.
+        };
+
+        struct SharedShaderModule
+        {
+            std::uint64_t           codeHash        = 0;
+            std::uint32_t           refCount        = 0;
             VKPtr<VkShaderModule>   shaderModule;
         };
 
@@ -56,9 +70,17 @@ class VKShaderModulePool
 
         VKShaderModulePool() = default;
 
+        // Returns the shared shader module for the specified permutation code and increments its reference counter.
+        VkShaderModule AcquireSharedShaderModule(const VKShader& shader, const std::vector<std::uint32_t>& shaderCode, std::uint64_t& outCodeHash);
+
+        // Decrements the reference counter of the shared shader module with the specified code hash and releases it once it's no longer used.
+        void ReleaseSharedShaderModule(std::uint64_t codeHash);
+
     private:
 
-        std::vector<ShaderModulePermutation> permutations_;
+        std::vector<ShaderModulePermutation>    permutations_;
+        std::vector<SharedShaderModule>         sharedModules_;     // Sorted by code hash
+        std::mutex                              mutex_;
 
 };
 
@@ -6,12 +6,17 @@
  */
 
 #include "VKDeviceImage.h"
+#include "VKImageUtils.h"
 #include "../Memory/VKDeviceMemory.h"
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../Command/VKCommandContext.h"
 #include "../VKCore.h"
+#include "../VKTypes.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/PrintfUtils.h"
+#include <vector>
 
 
 namespace LLGL
@@ -23,21 +28,53 @@ VKDeviceImage::VKDeviceImage(VkDevice device) :
 {
 }
 
-void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
+void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool preferDedicated)
 {
     VkDevice device = deviceMemoryMngr.GetVkDevice();
 
     /* Get memory requirements for the image */
-    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+    bool requiresDedicated = false, prefersDedicated = false;
+    QueryMemoryRequirements(device, requiresDedicated, prefersDedicated);
+
+    /* Back transient attachments with lazily allocated memory if available, so tile-based GPUs may never commit physical memory for them */
+    VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
-    /* Allocate device memory */
-    memoryRegion_ = deviceMemoryMngr.Allocate(
-        memoryRequirements_.size,
-        memoryRequirements_.alignment,
-        memoryRequirements_.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    if (isTransient_ && deviceMemoryMngr.HasMemoryType(memoryRequirements_.memoryTypeBits, memoryProperties | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+        memoryProperties |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+    /*
+    Use a dedicated allocation if the driver requires it, if it prefers it for render targets (which helps compression on some vendors),
+    or if the image would occupy a chunk of its own anyway. Transient attachments are excluded unless required, since they might never be committed.
+    */
+    const bool useDedicatedAllocation =
+    (
+        requiresDedicated ||
+        (
+            !isTransient_ &&
+            (
+                preferDedicated ||
+                (prefersDedicated && isAttachment_) ||
+                memoryRequirements_.size >= deviceMemoryMngr.GetMinAllocationSize()
+            )
+        )
     );
 
+    /* Allocate device memory; keep render targets resident with a higher priority */
+    if (useDedicatedAllocation)
+    {
+        const float priority = (isAttachment_ ? VKTypes::ToVkMemoryPriority(ResidencyPriority::High) : -1.0f);
+        memoryRegion_ = deviceMemoryMngr.AllocateDedicated(memoryRequirements_, memoryProperties, image_, priority);
+    }
+    else
+    {
+        memoryRegion_ = deviceMemoryMngr.Allocate(
+            memoryRequirements_.size,
+            memoryRequirements_.alignment,
+            memoryRequirements_.memoryTypeBits,
+            memoryProperties
+        );
+    }
+
     /* Bind image to device memory region */
     if (memoryRegion_ == nullptr)
     {
@@ -65,16 +102,40 @@ void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memo
     }
 }
 
+void VKDeviceImage::QuerySparseMemoryRequirements(VkDevice device, VkSparseImageMemoryRequirements& outSparseRequirements)
+{
+    /* Get memory requirements for the image; the alignment specifies the size of each sparse block */
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+
+    std::uint32_t numRequirements = 0;
+    vkGetImageSparseMemoryRequirements(device, image_, &numRequirements, nullptr);
+
+    std::vector<VkSparseImageMemoryRequirements> sparseRequirements(numRequirements);
+    vkGetImageSparseMemoryRequirements(device, image_, &numRequirements, sparseRequirements.data());
+
+    /* Use requirements of the first aspect that is not metadata */
+    outSparseRequirements = {};
+    for (const VkSparseImageMemoryRequirements& requirements : sparseRequirements)
+    {
+        if ((requirements.formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) == 0)
+        {
+            outSparseRequirements = requirements;
+            break;
+        }
+    }
+}
+
 void VKDeviceImage::CreateVkImage(
-    VkDevice                device,
-    VkImageType             imageType,
-    VkFormat                format,
-    const VkExtent3D&       extent,
-    std::uint32_t           numMipLevels,
-    std::uint32_t           numArrayLayers,
-    VkImageCreateFlags      createFlags,
-    VkSampleCountFlagBits   sampleCountBits,
-    VkImageUsageFlags       usageFlags)
+    VkDevice                        device,
+    VkImageType                     imageType,
+    VkFormat                        format,
+    const VkExtent3D&               extent,
+    std::uint32_t                   numMipLevels,
+    std::uint32_t                   numArrayLayers,
+    VkImageCreateFlags              createFlags,
+    VkSampleCountFlagBits           sampleCountBits,
+    VkImageUsageFlags               usageFlags,
+    const ArrayView<std::uint32_t>& sharedQueueFamilies)
 {
     /* Create image object */
     VkImageCreateInfo createInfo;
@@ -90,13 +151,23 @@ void VKDeviceImage::CreateVkImage(
         createInfo.samples                  = sampleCountBits;
         createInfo.tiling                   = VK_IMAGE_TILING_OPTIMAL;
         createInfo.usage                    = usageFlags;
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue unless shared with other queue families below
         createInfo.queueFamilyIndexCount    = 0;
         createInfo.pQueueFamilyIndices      = nullptr;
         createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED; // must be UNDEFINED or PREINITIALIZED
     }
+    if (!sharedQueueFamilies.empty())
+    {
+        /* Share image between queue families without ownership transfers; this may disable compression on some hardware */
+        createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(sharedQueueFamilies.size());
+        createInfo.pQueueFamilyIndices      = sharedQueueFamilies.data();
+    }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
     VKThrowIfCreateFailed(result, "VkImage");
+
+    isTransient_    = ((usageFlags & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0);
+    isAttachment_   = ((usageFlags & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) != 0);
 }
 
 void VKDeviceImage::ReleaseVkImage()
@@ -152,6 +223,107 @@ VkImageLayout VKDeviceImage::TransitionImageLayout(
     return (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? layout_ : oldLayout);
 }
 
+#ifdef VK_EXT_host_image_copy
+
+void VKDeviceImage::TransitionImageLayoutOnHost(VkDevice device, VkFormat format, VkImageLayout newLayout, const TextureSubresource& subresource)
+{
+    if (newLayout == layout_)
+        return;
+
+    VkHostImageLayoutTransitionInfoEXT transitionInfo;
+    {
+        transitionInfo.sType                            = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+        transitionInfo.pNext                            = nullptr;
+        transitionInfo.image                            = image_;
+        transitionInfo.oldLayout                        = layout_;
+        transitionInfo.newLayout                        = newLayout;
+        transitionInfo.subresourceRange.aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(format);
+        transitionInfo.subresourceRange.baseMipLevel    = subresource.baseMipLevel;
+        transitionInfo.subresourceRange.levelCount      = subresource.numMipLevels;
+        transitionInfo.subresourceRange.baseArrayLayer  = subresource.baseArrayLayer;
+        transitionInfo.subresourceRange.layerCount      = subresource.numArrayLayers;
+    }
+    VkResult result = vkTransitionImageLayoutEXT(device, 1, &transitionInfo);
+    VKThrowIfFailed(result, "failed to transition Vulkan image layout on host");
+
+    layout_ = newLayout;
+}
+
+void VKDeviceImage::CopyMemoryToImageOnHost(
+    VkDevice                    device,
+    VkFormat                    format,
+    const void*                 data,
+    const VkOffset3D&           offset,
+    const VkExtent3D&           extent,
+    const TextureSubresource&   subresource)
+{
+    VkMemoryToImageCopyEXT region;
+    {
+        region.sType                            = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+        region.pNext                            = nullptr;
+        region.pHostPointer                     = data;
+        region.memoryRowLength                  = 0;
+        region.memoryImageHeight                = 0;
+        region.imageSubresource.aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(format);
+        region.imageSubresource.mipLevel        = subresource.baseMipLevel;
+        region.imageSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        region.imageSubresource.layerCount      = subresource.numArrayLayers;
+        region.imageOffset                      = offset;
+        region.imageExtent                      = extent;
+    }
+    VkCopyMemoryToImageInfoEXT copyInfo;
+    {
+        copyInfo.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+        copyInfo.pNext          = nullptr;
+        copyInfo.flags          = 0;
+        copyInfo.dstImage       = image_;
+        copyInfo.dstImageLayout = layout_;
+        copyInfo.regionCount    = 1;
+        copyInfo.pRegions       = &region;
+    }
+    VkResult result = vkCopyMemoryToImageEXT(device, &copyInfo);
+    VKThrowIfFailed(result, "failed to copy host memory into Vulkan image");
+}
+
+#endif // /VK_EXT_host_image_copy
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKDeviceImage::QueryMemoryRequirements(VkDevice device, bool& outRequiresDedicated, bool& outPrefersDedicated)
+{
+    #if defined VK_KHR_get_memory_requirements2 && defined VK_KHR_dedicated_allocation
+    if (HasExtension(VKExt::KHR_get_memory_requirements2) && HasExtension(VKExt::KHR_dedicated_allocation))
+    {
+        VkMemoryDedicatedRequirementsKHR dedicatedRequirements = {};
+        dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+
+        VkImageMemoryRequirementsInfo2KHR requirementsInfo = {};
+        {
+            requirementsInfo.sType  = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR;
+            requirementsInfo.image  = image_;
+        }
+        VkMemoryRequirements2KHR requirements = {};
+        {
+            requirements.sType      = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+            requirements.pNext      = &dedicatedRequirements;
+        }
+        vkGetImageMemoryRequirements2KHR(device, &requirementsInfo, &requirements);
+
+        memoryRequirements_     = requirements.memoryRequirements;
+        outRequiresDedicated    = (dedicatedRequirements.requiresDedicatedAllocation != VK_FALSE);
+        outPrefersDedicated     = (dedicatedRequirements.prefersDedicatedAllocation != VK_FALSE);
+        return;
+    }
+    #endif // /VK_KHR_get_memory_requirements2 && VK_KHR_dedicated_allocation
+
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+    outRequiresDedicated    = false;
+    outPrefersDedicated     = false;
+}
+
 
 } // /namespace LLGL
 
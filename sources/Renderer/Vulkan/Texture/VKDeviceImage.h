@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Texture.h>
+#include <LLGL/Container/ArrayView.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
@@ -37,21 +38,29 @@ class VKDeviceImage
         VKDeviceImage(VKDeviceImage&&) = default;
         VKDeviceImage& operator = (VKDeviceImage&&) = default;
 
-        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
+        /*
+        Allocates and binds device memory for this image. Large images, render targets the driver prefers dedicated memory for,
+        and images with 'preferDedicated' set to true are allocated in their own device memory chunk (VK_KHR_dedicated_allocation).
+        */
+        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool preferDedicated = false);
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
+        // Queries the memory requirements of a sparse image. Device memory of sparse images is bound tile by tile instead of a single memory region.
+        void QuerySparseMemoryRequirements(VkDevice device, VkSparseImageMemoryRequirements& outSparseRequirements);
+
         void CreateVkImage(
-            VkDevice                device,
-            VkImageType             imageType,
-            VkFormat                format,
-            const VkExtent3D&       extent,
-            std::uint32_t           numMipLevels,
-            std::uint32_t           numArrayLayers,
-            VkImageCreateFlags      createFlags,
-            VkSampleCountFlagBits   sampleCountBits,
-            VkImageUsageFlags       usageFlags
+            VkDevice                        device,
+            VkImageType                     imageType,
+            VkFormat                        format,
+            const VkExtent3D&               extent,
+            std::uint32_t                   numMipLevels,
+            std::uint32_t                   numArrayLayers,
+            VkImageCreateFlags              createFlags,
+            VkSampleCountFlagBits           sampleCountBits,
+            VkImageUsageFlags               usageFlags,
+            const ArrayView<std::uint32_t>& sharedQueueFamilies = {}   // Creates the image in concurrent sharing mode if this is not empty.
         );
 
         void ReleaseVkImage();
@@ -72,6 +81,23 @@ class VKDeviceImage
             const TextureSubresource&   subresource
         );
 
+        #ifdef VK_EXT_host_image_copy
+
+        // Transitions all subresources of this image to the specified new layout on the host. The image must not be in use by the device.
+        void TransitionImageLayoutOnHost(VkDevice device, VkFormat format, VkImageLayout newLayout, const TextureSubresource& subresource);
+
+        // Copies the specified host memory into this image in its current layout. The image must not be in use by the device.
+        void CopyMemoryToImageOnHost(
+            VkDevice                    device,
+            VkFormat                    format,
+            const void*                 data,
+            const VkOffset3D&           offset,
+            const VkExtent3D&           extent,
+            const TextureSubresource&   subresource
+        );
+
+        #endif // /VK_EXT_host_image_copy
+
         // Returns the native VkImage handle.
         inline VkImage GetVkImage() const
         {
@@ -96,12 +122,19 @@ class VKDeviceImage
             return memoryRequirements_;
         }
 
+    private:
+
+        // Queries the memory requirements of this image and whether the driver requires or prefers a dedicated allocation for it.
+        void QueryMemoryRequirements(VkDevice device, bool& outRequiresDedicated, bool& outPrefersDedicated);
+
     private:
 
         VKPtr<VkImage>          image_;
         VkImageLayout           layout_             = VK_IMAGE_LAYOUT_UNDEFINED;
         VkMemoryRequirements    memoryRequirements_ = {};
         VKDeviceMemoryRegion*   memoryRegion_       = nullptr;
+        bool                    isTransient_        = false; // Image was created with VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
+        bool                    isAttachment_       = false; // Image was created with a color or depth-stencil attachment usage
 
 };
 
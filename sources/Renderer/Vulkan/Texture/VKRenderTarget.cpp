@@ -10,6 +10,7 @@
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
@@ -37,8 +38,9 @@ VKRenderTarget::VKRenderTarget(
 {
     if (desc.renderPass)
     {
-        /* Get render pass from descriptor */
+        /* Get render pass from descriptor; attachments of a multiview render pass cover one array layer per view */
         renderPass_ = LLGL_CAST(const VKRenderPass*, desc.renderPass);
+        viewMask_   = renderPass_->GetViewMask();
     }
     else
     {
@@ -187,7 +189,7 @@ void VKRenderTarget::CreateRenderPass(
     }
 
     /* Create native Vulkan render pass with attachment descriptors */
-    renderPass.CreateVkRenderPassWithDescriptors(device, numTargetAttachments, numColorAttachments_, attachmentDescs, sampleCountBits_);
+    renderPass.CreateVkRenderPassWithDescriptors(device, numTargetAttachments, numColorAttachments_, attachmentDescs, sampleCountBits_, {}, viewMask_);
 }
 
 void VKRenderTarget::CreateDefaultRenderPass(VkDevice device, const RenderTargetDescriptor& desc)
@@ -200,6 +202,12 @@ void VKRenderTarget::CreateSecondaryRenderPass(VkDevice device, const RenderTarg
     CreateRenderPass(device, desc, secondaryRenderPass_, VK_ATTACHMENT_LOAD_OP_LOAD);
 }
 
+TextureSubresource VKRenderTarget::GetAttachmentSubresource(const AttachmentDescriptor& attachmentDesc) const
+{
+    const std::uint32_t numArrayLayers = (viewMask_ != 0 ? NumRenderPassViews(viewMask_) : 1);
+    return TextureSubresource{ attachmentDesc.arrayLayer, numArrayLayers, attachmentDesc.mipLevel, 1 };
+}
+
 VkImageView VKRenderTarget::CreateAttachmentImageView(
     VkDevice                    device,
     VKTexture&                  textureVK,
@@ -211,9 +219,19 @@ VkImageView VKRenderTarget::CreateAttachmentImageView(
 
     /* Create new image view for MIP-level and array layer specified in attachment descriptor */
     VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
+    if (viewMask_ != 0)
     {
-        textureVK.CreateImageView(device, TextureSubresource{ attachmentDesc.arrayLayer, attachmentDesc.mipLevel }, format, imageView);
+        /* Create 2D-array view over one array layer per view for multiview render passes */
+        TextureViewDescriptor textureViewDesc;
+        {
+            textureViewDesc.type        = TextureType::Texture2DArray;
+            textureViewDesc.format      = format;
+            textureViewDesc.subresource = GetAttachmentSubresource(attachmentDesc);
+        }
+        textureVK.CreateImageView(device, textureViewDesc, imageView);
     }
+    else
+        textureVK.CreateImageView(device, TextureSubresource{ attachmentDesc.arrayLayer, attachmentDesc.mipLevel }, format, imageView);
     imageViews_.emplace_back(std::move(imageView));
 
     return imageViews_.back().Get();
@@ -240,6 +258,19 @@ VkImageView VKRenderTarget::CreateDepthStencilBuffer(VKDeviceMemoryManager& devi
     return depthStencilBuffer_.GetVkImageView();
 }
 
+static void SetRenderingAttachment(
+    VKRenderingAttachment&      dst,
+    VkImage                     image,
+    VkImageView                 imageView,
+    VkFormat                    format,
+    const TextureSubresource&   subresource = {})
+{
+    dst.image       = image;
+    dst.imageView   = imageView;
+    dst.format      = format;
+    dst.subresource = subresource;
+}
+
 void VKRenderTarget::CreateFramebuffer(
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
@@ -263,11 +294,17 @@ void VKRenderTarget::CreateFramebuffer(
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
             const Format colorFormat = GetAttachmentFormat(colorAttachment);
             attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
+            SetRenderingAttachment(
+                renderingAttachments_.colorAttachments[i], textureVK.GetVkImage(), attachmentImageViews[i], textureVK.GetVkFormat(),
+                GetAttachmentSubresource(colorAttachment)
+            );
         }
         else
         {
             /* Create internal color buffer */
             attachmentImageViews[i] = CreateColorBuffer(deviceMemoryMngr, colorAttachment.format);
+            const VKColorBuffer& colorBuffer = *colorBuffers_.back();
+            SetRenderingAttachment(renderingAttachments_.colorAttachments[i], colorBuffer.GetVkImage(), attachmentImageViews[i], colorBuffer.GetVkFormat());
         }
     }
 
@@ -281,11 +318,19 @@ void VKRenderTarget::CreateFramebuffer(
             /* Use attachment texture for depth-stencil view */
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
             attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
+            SetRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, textureVK.GetVkImage(), attachmentImageViews[numColorAttachments_], textureVK.GetVkFormat(),
+                GetAttachmentSubresource(depthStencilAttachment)
+            );
         }
         else
         {
             /* Create internal depth-stencil buffer */
             attachmentImageViews[numColorAttachments_] = CreateDepthStencilBuffer(deviceMemoryMngr, depthStencilFormat_);
+            SetRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, depthStencilBuffer_.GetVkImage(), attachmentImageViews[numColorAttachments_],
+                depthStencilBuffer_.GetVkFormat()
+            );
         }
     }
 
@@ -302,11 +347,21 @@ void VKRenderTarget::CreateFramebuffer(
                 /* Use attachment texture for color buffer view */
                 auto& textureVK = LLGL_CAST(VKTexture&, *texture);
                 const Format colorFormat = GetAttachmentFormat(resolveAttachment);
-                attachmentImageViews[attachmentCount++] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                attachmentImageViews[attachmentCount] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                SetRenderingAttachment(
+                    renderingAttachments_.resolveAttachments[i], textureVK.GetVkImage(), attachmentImageViews[attachmentCount], textureVK.GetVkFormat(),
+                    GetAttachmentSubresource(resolveAttachment)
+                );
+                ++attachmentCount;
             }
         }
     }
 
+    /* Attachments are bound directly when the render pass begins if dynamic rendering is enabled */
+    renderingAttachments_.numColorAttachments = numColorAttachments_;
+    if (renderPass_->UsesDynamicRendering())
+        return;
+
     /* Create framebuffer object */
     const Extent2D resolution = GetResolution();
     VkFramebufferCreateInfo createInfo;
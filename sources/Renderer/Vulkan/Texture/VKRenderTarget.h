@@ -62,6 +62,24 @@ class VKRenderTarget final : public RenderTarget
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the primary render pass, which is either the default render pass or the one specified in the descriptor.
+        inline const VKRenderPass& GetPrimaryRenderPass() const
+        {
+            return *renderPass_;
+        }
+
+        // Returns the secondary render pass, which loads the content of all attachments to resume rendering.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
+        // Returns the attachments that are bound with dynamic rendering.
+        inline const VKRenderingAttachments& GetRenderingAttachments() const
+        {
+            return renderingAttachments_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -80,6 +98,9 @@ class VKRenderTarget final : public RenderTarget
         void CreateDefaultRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
         void CreateSecondaryRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
 
+        // Returns the subresource of the specified attachment, which covers one array layer per view for multiview render passes.
+        TextureSubresource GetAttachmentSubresource(const AttachmentDescriptor& attachmentDesc) const;
+
         VkImageView CreateAttachmentImageView(
             VkDevice                    device,
             VKTexture&                  textureVK,
@@ -103,6 +124,7 @@ class VKRenderTarget final : public RenderTarget
         Extent2D                        resolution_;
 
         VKPtr<VkFramebuffer>            framebuffer_;
+        VKRenderingAttachments          renderingAttachments_;                          // Replaces the framebuffer if dynamic rendering is enabled.
         const VKRenderPass*             renderPass_             = nullptr;
         VKRenderPass                    defaultRenderPass_;
         VKRenderPass                    secondaryRenderPass_;
@@ -115,6 +137,7 @@ class VKRenderTarget final : public RenderTarget
 
         std::uint32_t                   numColorAttachments_    = 0;
         VkSampleCountFlagBits           sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
+        std::uint32_t                   viewMask_               = 0;                    // View mask of the multiview render pass this render target was created with.
 
 };
 
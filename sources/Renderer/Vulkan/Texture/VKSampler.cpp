@@ -15,11 +15,17 @@ namespace LLGL
 {
 
 
-VKSampler::VKSampler(VkDevice device, const SamplerDescriptor& desc) :
-    sampler_ { VKSampler::CreateVkSampler(device, desc) }
+VKSampler::VKSampler(VkDevice device, VKSamplerPool& samplerPool, const SamplerDescriptor& desc) :
+    samplerPool_ { samplerPool                                              },
+    sampler_     { VKSampler::AcquireVkSampler(device, samplerPool, desc)   }
 {
 }
 
+VKSampler::~VKSampler()
+{
+    samplerPool_.Release(sampler_);
+}
+
 static VkFilter GetVkFilter(const SamplerFilter filter)
 {
     return (filter == SamplerFilter::Linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
@@ -77,17 +83,23 @@ void VKSampler::ConvertDesc(VkSamplerCreateInfo& outDesc, const SamplerDescripto
     }
 }
 
-VKPtr<VkSampler> VKSampler::CreateVkSampler(VkDevice device, const SamplerDescriptor& desc)
+VkSampler VKSampler::AcquireVkSampler(VkDevice device, VKSamplerPool& samplerPool, const SamplerDescriptor& desc)
 {
-    /* Create sampler state */
-    VKPtr<VkSampler> sampler{ device, vkDestroySampler };
-    {
-        VkSamplerCreateInfo createInfo;
-        VKSampler::ConvertDesc(createInfo, desc);
-        VkResult result = vkCreateSampler(device, &createInfo, nullptr, sampler.ReleaseAndGetAddressOf());
-        VKThrowIfFailed(result, "failed to create Vulkan sampler");
-    }
-    return sampler;
+    /* Zero-initialize descriptor including its padding bytes, since the pool compares descriptors bytewise */
+    VkSamplerCreateInfo createInfo = {};
+    VKSampler::ConvertDesc(createInfo, desc);
+
+    return samplerPool.Acquire(
+        createInfo,
+        [device](const VkSamplerCreateInfo& samplerInfo) -> VKPtr<VkSampler>
+        {
+            /* Create sampler state */
+            VKPtr<VkSampler> sampler{ device, vkDestroySampler };
+            VkResult result = vkCreateSampler(device, &samplerInfo, nullptr, sampler.ReleaseAndGetAddressOf());
+            VKThrowIfFailed(result, "failed to create Vulkan sampler");
+            return sampler;
+        }
+    );
 }
 
 
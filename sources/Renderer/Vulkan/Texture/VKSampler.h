@@ -12,23 +12,28 @@
 #include <LLGL/Sampler.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../../SharedStatePool.h"
 
 
 namespace LLGL
 {
 
 
+// Pool of native Vulkan samplers that are shared between all samplers and immutable samplers with identical descriptors.
+using VKSamplerPool = SharedStatePool<VkSamplerCreateInfo, VKPtr<VkSampler>>;
+
 class VKSampler final : public Sampler
 {
 
     public:
 
-        VKSampler(VkDevice device, const SamplerDescriptor& desc);
+        VKSampler(VkDevice device, VKSamplerPool& samplerPool, const SamplerDescriptor& desc);
+        ~VKSampler();
 
         // Returns the Vulkan sampler object.
         inline VkSampler GetVkSampler() const
         {
-            return sampler_.Get();
+            return sampler_;
         }
 
     public:
@@ -36,12 +41,16 @@ class VKSampler final : public Sampler
         // Converts the specified sampler descriptor to the native Vulkan descriptor.
         static void ConvertDesc(VkSamplerCreateInfo& outDesc, const SamplerDescriptor& inDesc);
 
-        // Creates a native Vulkan sampler.
-        static VKPtr<VkSampler> CreateVkSampler(VkDevice device, const SamplerDescriptor& desc);
+        /*
+        Returns a native Vulkan sampler from the specified pool and creates it if there is no sampler with the same descriptor yet.
+        The sampler must be returned to the pool via VKSamplerPool::Release.
+        */
+        static VkSampler AcquireVkSampler(VkDevice device, VKSamplerPool& samplerPool, const SamplerDescriptor& desc);
 
     private:
 
-        VKPtr<VkSampler> sampler_;
+        VKSamplerPool&  samplerPool_;
+        VkSampler       sampler_        = VK_NULL_HANDLE;
 
 };
 
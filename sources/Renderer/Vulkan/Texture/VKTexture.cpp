@@ -8,11 +8,16 @@
 #include "VKTexture.h"
 #include "VKImageUtils.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKDeviceMemoryManager.h"
 #include "../Command/VKCommandContext.h"
+#include "../VKPhysicalDevice.h"
 #include "../../TextureUtils.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/PrintfUtils.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
 
@@ -29,20 +34,52 @@ static VKSwizzleFormat MapToVKSwizzleFormat(const Format format)
         return VKSwizzleFormat::RGBA;
 }
 
+// Returns true if the specified texture descriptor describes a sparse texture.
+static bool IsSparseTexture(const TextureDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Sparse) != 0 &&
+        (desc.type == TextureType::Texture2D || desc.type == TextureType::Texture2DArray || desc.type == TextureType::Texture3D)
+    );
+}
+
+// MIP level that is used in the key of MIP tails
+static constexpr std::uint32_t g_sparseMipTailKeyLevel = 0xFF;
+
+// Returns the key of a sparse tile: MIP level in bits [56, 64), array layer in bits [40, 56), and the tile coordinates in 13 bits each.
+static std::uint64_t GetSparseTileKey(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    return
+    (
+        (static_cast<std::uint64_t>(mipLevel   & 0xFF  ) << 56) |
+        (static_cast<std::uint64_t>(arrayLayer & 0xFFFF) << 40) |
+        (static_cast<std::uint64_t>(z          & 0x1FFF) << 26) |
+        (static_cast<std::uint64_t>(y          & 0x1FFF) << 13) |
+        (static_cast<std::uint64_t>(x          & 0x1FFF)      )
+    );
+}
+
 VKTexture::VKTexture(
-    VkDevice                    device,
-    VKDeviceMemoryManager&      deviceMemoryMngr,
-    const TextureDescriptor&    desc)
+    VkDevice                        device,
+    const VKPhysicalDevice&         physicalDevice,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
+    const TextureDescriptor&        desc,
+    const ArrayView<std::uint32_t>& sharedQueueFamilies)
 :
     Texture        { desc.type, desc.bindFlags         },
     image_         { device                            },
     imageView_     { device, vkDestroyImageView        },
     format_        { VKTypes::Map(desc.format)         },
-    swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
+    swizzleFormat_ { MapToVKSwizzleFormat(desc.format) },
+    isSparse_      { IsSparseTexture(desc)             }
 {
-    /* Create Vulkan image and allocate memory region */
-    CreateImage(device, desc);
-    image_.AllocateMemoryRegion(deviceMemoryMngr);
+    /* Create Vulkan image and allocate memory region; sparse images are bound tile by tile with VKCommandQueue::UpdateTileMappings */
+    CreateImage(device, physicalDevice, desc, sharedQueueFamilies);
+    if (isSparse_)
+        image_.QuerySparseMemoryRequirements(device, sparseRequirements_);
+    else
+        image_.AllocateMemoryRegion(deviceMemoryMngr, ((desc.miscFlags & MiscFlags::DedicatedMemory) != 0));
 }
 
 Extent3D VKTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -86,7 +123,7 @@ TextureDescriptor VKTexture::GetDesc() const
 
     texDesc.type        = GetType();
     texDesc.bindFlags   = GetBindFlags();
-    texDesc.miscFlags   = 0;
+    texDesc.miscFlags   = ((usageFlags_ & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0 ? MiscFlags::Memoryless : 0);
     texDesc.format      = GetFormat();
     texDesc.arrayLayers = GetNumArrayLayers();
     texDesc.mipLevels   = GetNumMipLevels();
@@ -133,6 +170,28 @@ TextureDescriptor VKTexture::GetDesc() const
     return texDesc;
 }
 
+bool VKTexture::SetResidencyPriority(ResidencyPriority priority)
+{
+    if (VKDeviceMemoryRegion* region = GetMemoryRegion())
+        return region->GetParentChunk()->SetPriority(VKTypes::ToVkMemoryPriority(priority));
+    else
+        return false;
+}
+
+bool VKTexture::GetSparseProperties(SparseTextureProperties& outProperties) const
+{
+    if (!isSparse_)
+        return false;
+
+    const VkExtent3D& granularity = sparseRequirements_.formatProperties.imageGranularity;
+
+    outProperties.tileSize          = Extent3D{ granularity.width, granularity.height, granularity.depth };
+    outProperties.numStandardMips   = std::min(sparseRequirements_.imageMipTailFirstLod, numMipLevels_);
+    outProperties.tileMemorySize    = image_.GetMemoryRequirements().alignment;
+
+    return true;
+}
+
 Format VKTexture::GetFormat() const
 {
     return VKTypes::Unmap(GetVkFormat());
@@ -235,6 +294,36 @@ void VKTexture::CreateImageView(
     );
 }
 
+VkImageView VKTexture::GetOrCreateCachedImageView(VkDevice device, const TextureViewDescriptor& textureViewDesc)
+{
+    std::lock_guard<std::mutex> guard{ cachedImageViewsMutex_ };
+
+    /* Compress texture view descriptor for faster comparison and sorting */
+    CompressedTexView view;
+    CompressTextureViewDesc(view, textureViewDesc);
+
+    /* Try to find image view with same parameters */
+    std::size_t insertionIndex = 0;
+    VKCachedImageView* cachedImageView = FindInSortedArray<VKCachedImageView>(
+        cachedImageViews_.data(),
+        cachedImageViews_.size(),
+        [&view](const VKCachedImageView& rhs)
+        {
+            return CompareCompressedTexViewSWO(view, rhs.view);
+        },
+        &insertionIndex
+    );
+
+    if (cachedImageView != nullptr)
+        return cachedImageView->imageView.Get();
+
+    /* Create new image view and store it with insertion sort */
+    VKCachedImageView newImageView{ view, VKPtr<VkImageView>{ device, vkDestroyImageView } };
+    CreateImageView(device, textureViewDesc, newImageView.imageView);
+    auto it = cachedImageViews_.insert(cachedImageViews_.begin() + insertionIndex, std::move(newImageView));
+    return it->imageView.Get();
+}
+
 static bool UsageFlagsAllowImageViews(VkImageUsageFlags flags)
 {
     /* Vulkan only alows image views on images that were created with these usage flags */
@@ -301,6 +390,146 @@ VkImageLayout VKTexture::TransitionImageLayout(
     return oldLayout;
 }
 
+void VKTexture::DiscardContents(VKCommandContext& context)
+{
+    /* Images that have never been transitioned have no contents to preserve */
+    const VkImageLayout currentLayout = GetVkImageLayout();
+    if (currentLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        const TextureSubresource fullSubresource{ 0, numArrayLayers_, 0, numMipLevels_ };
+        context.ImageMemoryBarrier(GetVkImage(), GetVkFormat(), VK_IMAGE_LAYOUT_UNDEFINED, currentLayout, fullSubresource, true);
+    }
+}
+
+#ifdef VK_EXT_host_image_copy
+
+void VKTexture::TransitionImageLayoutOnHost(VkDevice device, VkImageLayout newLayout)
+{
+    const TextureSubresource fullSubresource{ 0, numArrayLayers_, 0, numMipLevels_ };
+    image_.TransitionImageLayoutOnHost(device, GetVkFormat(), newLayout, fullSubresource);
+}
+
+void VKTexture::WriteOnHost(
+    VkDevice                    device,
+    const void*                 data,
+    const VkOffset3D&           offset,
+    const VkExtent3D&           extent,
+    const TextureSubresource&   subresource)
+{
+    image_.CopyMemoryToImageOnHost(device, GetVkFormat(), data, offset, extent, subresource);
+}
+
+#endif // /VK_EXT_host_image_copy
+
+
+void VKTexture::UpdateSparseTiles(
+    VKDeviceMemoryManager&                  deviceMemoryMngr,
+    const SparseTextureMapping&             mapping,
+    std::vector<VkSparseImageMemoryBind>&   outImageBinds,
+    std::vector<VkSparseMemoryBind>&        outOpaqueBinds)
+{
+    if (!isSparse_)
+        return;
+
+    const TextureSubresource&   subresource = mapping.region.subresource;
+    const std::uint32_t         mipLevel    = subresource.baseMipLevel;
+    const std::uint32_t         firstLayer  = subresource.baseArrayLayer;
+    const std::uint32_t         numLayers   = (GetType() == TextureType::Texture2DArray ? subresource.numArrayLayers : 1u);
+
+    if (mipLevel >= sparseRequirements_.imageMipTailFirstLod)
+    {
+        /* Bind MIP tail of each array layer as opaque memory range; all array layers share a single MIP tail with VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT */
+        const bool          isSingleMipTail = ((sparseRequirements_.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0);
+        const std::uint32_t layerBegin      = (isSingleMipTail ? 0u : firstLayer);
+        const std::uint32_t layerEnd        = (isSingleMipTail ? 1u : firstLayer + numLayers);
+
+        for_subrange(arrayLayer, layerBegin, layerEnd)
+        {
+            VkSparseMemoryBind bind;
+            {
+                bind.resourceOffset = sparseRequirements_.imageMipTailOffset + sparseRequirements_.imageMipTailStride * arrayLayer;
+                bind.size           = sparseRequirements_.imageMipTailSize;
+                bind.flags          = 0;
+            }
+            BindSparseTileMemory(
+                deviceMemoryMngr,
+                GetSparseTileKey(g_sparseMipTailKeyLevel, arrayLayer, 0, 0, 0),
+                bind.size,
+                mapping.commit,
+                bind.memory,
+                bind.memoryOffset
+            );
+            outOpaqueBinds.push_back(bind);
+        }
+    }
+    else
+    {
+        /* Determine range of tiles that intersect the mapping region */
+        const VkExtent3D&   granularity = sparseRequirements_.formatProperties.imageGranularity;
+        const Extent3D      mipExtent   = GetMipExtent(mipLevel);
+        const std::uint32_t mipDepth    = (GetType() == TextureType::Texture3D ? mipExtent.z : 1u);
+
+        const Offset3D&     offset      = mapping.region.offset;
+        const Extent3D&     extent      = mapping.region.extent;
+
+        const std::uint32_t tileBegin[3] =
+        {
+            static_cast<std::uint32_t>(offset.x) / granularity.width,
+            static_cast<std::uint32_t>(offset.y) / granularity.height,
+            (mipDepth > 1 ? static_cast<std::uint32_t>(offset.z) / granularity.depth : 0u),
+        };
+        const std::uint32_t tileEnd[3] =
+        {
+            DivideRoundUp(std::min(static_cast<std::uint32_t>(offset.x) + extent.x, mipExtent.x), granularity.width),
+            DivideRoundUp(std::min(static_cast<std::uint32_t>(offset.y) + extent.y, mipExtent.y), granularity.height),
+            (mipDepth > 1 ? DivideRoundUp(std::min(static_cast<std::uint32_t>(offset.z) + extent.z, mipDepth), granularity.depth) : 1u),
+        };
+
+        const VkDeviceSize tileMemorySize = image_.GetMemoryRequirements().alignment;
+
+        for_subrange(arrayLayer, firstLayer, firstLayer + numLayers)
+        {
+            for_subrange(z, tileBegin[2], tileEnd[2])
+            {
+                for_subrange(y, tileBegin[1], tileEnd[1])
+                {
+                    for_subrange(x, tileBegin[0], tileEnd[0])
+                    {
+                        VkSparseImageMemoryBind bind;
+                        {
+                            bind.subresource.aspectMask = sparseRequirements_.formatProperties.aspectMask;
+                            bind.subresource.mipLevel   = mipLevel;
+                            bind.subresource.arrayLayer = arrayLayer;
+                            bind.offset.x               = static_cast<std::int32_t>(x * granularity.width);
+                            bind.offset.y               = static_cast<std::int32_t>(y * granularity.height);
+                            bind.offset.z               = static_cast<std::int32_t>(z * granularity.depth);
+                            bind.extent.width           = std::min(granularity.width,  mipExtent.x - x * granularity.width);
+                            bind.extent.height          = std::min(granularity.height, mipExtent.y - y * granularity.height);
+                            bind.extent.depth           = std::min(granularity.depth,  mipDepth    - z * granularity.depth);
+                            bind.flags                  = 0;
+                        }
+                        BindSparseTileMemory(
+                            deviceMemoryMngr,
+                            GetSparseTileKey(mipLevel, arrayLayer, x, y, z),
+                            tileMemorySize,
+                            mapping.commit,
+                            bind.memory,
+                            bind.memoryOffset
+                        );
+                        outImageBinds.push_back(bind);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void VKTexture::ReleaseSparseTiles(VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    for (const auto& tile : sparseTiles_)
+        deviceMemoryMngr.Release(tile.second);
+    sparseTiles_.clear();
+}
 
 /*
  * ======= Private: =======
@@ -315,6 +544,10 @@ static VkImageCreateFlags GetVkImageCreateFlags(const TextureDescriptor& desc)
     if ((desc.bindFlags & BindFlags::Sampled) != 0)
         createFlags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
 
+    /* Sparse textures are bound to device memory tile by tile */
+    if (IsSparseTexture(desc))
+        createFlags |= (VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT);
+
     /*
     We only use VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT at the moment, to support cube maps.
     VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT is only required to make 3D textures compatible with 2D-array views, which LLGL does not support.
@@ -408,8 +641,29 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
         return VK_SAMPLE_COUNT_1_BIT;
 }
 
+// Returns true if the specified texture descriptor only describes an attachment that can be backed by lazily allocated memory.
+static bool IsMemorylessTextureDesc(const TextureDescriptor& desc)
+{
+    constexpr long attachmentBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment);
+    return
+    (
+        (desc.miscFlags & MiscFlags::Memoryless) != 0 &&
+        (desc.bindFlags & attachmentBindFlags) != 0 &&
+        (desc.bindFlags & ~attachmentBindFlags) == 0
+    );
+}
+
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
+    /* Transient attachments must not have any usage other than attachments, i.e. no transfer usage either */
+    if (IsMemorylessTextureDesc(desc))
+    {
+        if ((desc.bindFlags & BindFlags::ColorAttachment) != 0)
+            return (VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        else
+            return (VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    }
+
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
     /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled, CPU read access or copy source binding is requested */
@@ -430,22 +684,36 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     if ((desc.bindFlags & BindFlags::Storage) != 0)
         usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
 
-    #if 0//???
-    /* Enable input attachment bit when used for reading AND as attachment */
-    if ( (desc.bindFlags & (BindFlags::Sampled         | BindFlags::Storage               )) != 0 &&
-         (desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0 )
-    {
+    /* Enable reading the image as input attachment within subsequent subpasses */
+    if ((desc.bindFlags & BindFlags::InputAttachment) != 0)
         usageFlags |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
-    }
-    #endif
 
     return usageFlags;
 }
 
-void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
+// Returns true if the specified texture is only sampled by shaders, i.e. it is a candidate for host image copies.
+// Attachments and storage textures are excluded as host transfer usage is more likely to disable their device specific optimizations.
+static bool IsHostImageCopyCandidate(const TextureDescriptor& desc)
+{
+    const long nonAttachmentBindFlags = (BindFlags::Sampled | BindFlags::CopySrc | BindFlags::CopyDst);
+    return
+    (
+        (desc.bindFlags & BindFlags::Sampled) != 0 &&
+        (desc.bindFlags & ~nonAttachmentBindFlags) == 0 &&
+        !IsSparseTexture(desc) &&
+        !IsMultiSampleTexture(desc.type)
+    );
+}
+
+void VKTexture::CreateImage(
+    VkDevice                        device,
+    const VKPhysicalDevice&         physicalDevice,
+    const TextureDescriptor&        desc,
+    const ArrayView<std::uint32_t>& sharedQueueFamilies)
 {
     /* Setup texture parameters */
     VkImageType imageType = GetVkImageType(desc.type);
+    VkImageCreateFlags createFlags = GetVkImageCreateFlags(desc);
 
     extent_             = GetVkImageExtent3D(desc, imageType);
     numMipLevels_       = NumMipLevels(desc);
@@ -453,6 +721,15 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
     sampleCountBits_    = GetVkImageSampleCountFlags(desc);
     usageFlags_         = GetVkImageUsageFlags(desc);
 
+    #ifdef VK_EXT_host_image_copy
+    /* Allow texel data to be written by the host directly for sampled textures, which end up in shader-read-only layout after their upload */
+    if (IsHostImageCopyCandidate(desc) &&
+        physicalDevice.SupportsOptimalHostImageCopy(imageType, format_, createFlags, usageFlags_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL))
+    {
+        usageFlags_ |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+    }
+    #endif // /VK_EXT_host_image_copy
+
     /* Create image object */
     image_.CreateVkImage(
         device,
@@ -461,12 +738,54 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
         extent_,
         numMipLevels_,
         numArrayLayers_,
-        GetVkImageCreateFlags(desc),
+        createFlags,
         sampleCountBits_,
-        usageFlags_
+        usageFlags_,
+        sharedQueueFamilies
     );
 }
 
+void VKTexture::BindSparseTileMemory(
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    std::uint64_t           tileKey,
+    VkDeviceSize            size,
+    bool                    commit,
+    VkDeviceMemory&         outMemory,
+    VkDeviceSize&           outMemoryOffset)
+{
+    auto it = sparseTiles_.find(tileKey);
+    if (commit)
+    {
+        /* Allocate device memory for this tile if it's not already committed */
+        if (it == sparseTiles_.end())
+        {
+            const VkMemoryRequirements& requirements = image_.GetMemoryRequirements();
+            VKDeviceMemoryRegion* region = deviceMemoryMngr.Allocate(
+                size,
+                requirements.alignment,
+                requirements.memoryTypeBits,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+            );
+            if (region == nullptr)
+                LLGL_TRAP("failed to allocate 0x%016" PRIX64 " bytes of device memory for sparse Vulkan image tile", size);
+            it = sparseTiles_.emplace(tileKey, region).first;
+        }
+        outMemory       = it->second->GetParentChunk()->GetVkDeviceMemory();
+        outMemoryOffset = it->second->GetOffset();
+    }
+    else
+    {
+        /* Release device memory of this tile if it's committed */
+        if (it != sparseTiles_.end())
+        {
+            deviceMemoryMngr.Release(it->second);
+            sparseTiles_.erase(it);
+        }
+        outMemory       = VK_NULL_HANDLE;
+        outMemoryOffset = 0;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -13,7 +13,11 @@
 #include "VKDeviceImage.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../../TextureUtils.h"
 #include <cstdint>
+#include <map>
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -23,6 +27,7 @@ namespace LLGL
 class VKDeviceMemoryRegion;
 class VKDeviceMemoryManager;
 class VKCommandContext;
+class VKPhysicalDevice;
 
 // Predefined texture swizzles to emulate certain texture format
 enum class VKSwizzleFormat
@@ -38,12 +43,20 @@ class VKTexture final : public Texture
 
         #include <LLGL/Backend/Texture.inl>
 
+    public:
+
+        bool SetResidencyPriority(ResidencyPriority priority) override;
+
+        bool GetSparseProperties(SparseTextureProperties& outProperties) const override;
+
     public:
 
         VKTexture(
-            VkDevice                    device,
-            VKDeviceMemoryManager&      deviceMemoryMngr,
-            const TextureDescriptor&    desc
+            VkDevice                        device,
+            const VKPhysicalDevice&         physicalDevice,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
+            const TextureDescriptor&        desc,
+            const ArrayView<std::uint32_t>& sharedQueueFamilies = {}   // Creates the image in concurrent sharing mode if this is not empty.
         );
 
     public:
@@ -63,6 +76,12 @@ class VKTexture final : public Texture
             VKPtr<VkImageView>&             outImageView
         );
 
+        /*
+        Returns the image view for the specified view descriptor from the cache of this texture or creates it on first use.
+        Cached image views are destroyed together with this texture. This function is thread-safe.
+        */
+        VkImageView GetOrCreateCachedImageView(VkDevice device, const TextureViewDescriptor& textureViewDesc);
+
         // Creates the primary image view that is stored within this texture object.
         // If this texture was not created with a valid image view usage flag,
         // this function call has no effect and GetVkImageView() returns a null handle.
@@ -83,6 +102,36 @@ class VKTexture final : public Texture
             bool                        flushBarrier = false
         );
 
+        // Discards the contents of this image by transitioning all subresources from the undefined layout into its current layout.
+        void DiscardContents(VKCommandContext& context);
+
+        #ifdef VK_EXT_host_image_copy
+
+        // Transitions this image to the specified new layout on the host. The image must not be in use by the device.
+        void TransitionImageLayoutOnHost(VkDevice device, VkImageLayout newLayout);
+
+        // Copies the specified texel data into the texture region on the host. The image must not be in use by the device.
+        void WriteOnHost(
+            VkDevice                    device,
+            const void*                 data,
+            const VkOffset3D&           offset,
+            const VkExtent3D&           extent,
+            const TextureSubresource&   subresource
+        );
+
+        #endif // /VK_EXT_host_image_copy
+
+        // Allocates or releases device memory for the tiles of the specified sparse texture mapping and appends the respective memory binds.
+        void UpdateSparseTiles(
+            VKDeviceMemoryManager&                  deviceMemoryMngr,
+            const SparseTextureMapping&             mapping,
+            std::vector<VkSparseImageMemoryBind>&   outImageBinds,
+            std::vector<VkSparseMemoryBind>&        outOpaqueBinds
+        );
+
+        // Releases the device memory of all committed tiles of this sparse texture.
+        void ReleaseSparseTiles(VKDeviceMemoryManager& deviceMemoryMngr);
+
         // Returns the Vulkan image object.
         inline VkImage GetVkImage() const
         {
@@ -143,9 +192,48 @@ class VKTexture final : public Texture
             return image_.GetMemoryRegion();
         }
 
+        // Returns true if this texture was created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT.
+        inline bool IsSparse() const
+        {
+            return isSparse_;
+        }
+
+        // Returns true if this texture was created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT, i.e. it can be written with WriteOnHost.
+        inline bool IsHostImageCopyEnabled() const
+        {
+            #ifdef VK_EXT_host_image_copy
+            return ((usageFlags_ & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) != 0);
+            #else
+            return false;
+            #endif
+        }
+
+    private:
+
+        void CreateImage(
+            VkDevice                        device,
+            const VKPhysicalDevice&         physicalDevice,
+            const TextureDescriptor&        desc,
+            const ArrayView<std::uint32_t>& sharedQueueFamilies
+        );
+
+        void BindSparseTileMemory(
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            std::uint64_t           tileKey,
+            VkDeviceSize            size,
+            bool                    commit,
+            VkDeviceMemory&         outMemory,
+            VkDeviceSize&           outMemoryOffset
+        );
+
     private:
 
-        void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        // Image view that is cached per texture view descriptor; see GetOrCreateCachedImageView.
+        struct VKCachedImageView
+        {
+            CompressedTexView   view;
+            VKPtr<VkImageView>  imageView;
+        };
 
     private:
 
@@ -160,6 +248,13 @@ class VKTexture final : public Texture
         VkImageUsageFlags       usageFlags_         = 0;
         const VKSwizzleFormat   swizzleFormat_      = VKSwizzleFormat::RGBA;
 
+        const bool                                      isSparse_           = false;
+        VkSparseImageMemoryRequirements                 sparseRequirements_ = {};
+        std::map<std::uint64_t, VKDeviceMemoryRegion*>  sparseTiles_;               // Committed tiles of a sparse texture (see GetSparseTileKey)
+
+        std::vector<VKCachedImageView>                  cachedImageViews_;          // Sorted by compressed texture view descriptor
+        std::mutex                                      cachedImageViewsMutex_;
+
 };
 
 
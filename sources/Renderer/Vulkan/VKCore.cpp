@@ -10,6 +10,8 @@
 #include "../../Core/MacroUtils.h"
 #include "../../Core/Exception.h"
 #include <LLGL/Utils/ForRange.h>
+#include <mutex>
+#include <cstddef>
 
 
 namespace LLGL
@@ -293,6 +295,42 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
     return indices;
 }
 
+std::uint32_t VKFindDedicatedTransferQueueFamily(VkPhysicalDevice device)
+{
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(device);
+
+    for_range(i, queueFamilies.size())
+    {
+        const VkQueueFamilyProperties& family = queueFamilies[i];
+        if (family.queueCount > 0 &&
+            (family.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 &&
+            (family.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0)
+        {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+
+    return QueueFamilyIndices::invalidIndex;
+}
+
+std::uint32_t VKFindDedicatedComputeQueueFamily(VkPhysicalDevice device)
+{
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(device);
+
+    for_range(i, queueFamilies.size())
+    {
+        const VkQueueFamilyProperties& family = queueFamilies[i];
+        if (family.queueCount > 0 &&
+            (family.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 &&
+            (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0)
+        {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+
+    return QueueFamilyIndices::invalidIndex;
+}
+
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* candidates, std::size_t numCandidates, VkImageTiling tiling, VkFormatFeatureFlags features)
 {
     for_range(i, numCandidates)
@@ -322,6 +360,53 @@ std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryPro
     LLGL_TRAP("failed to find suitable Vulkan memory type");
 }
 
+// Small set of striped mutexes for all queues, so queue handles don't need a registry.
+static std::mutex g_queueMutexes[8];
+
+static std::mutex& GetQueueMutex(VkQueue queue)
+{
+    const std::uintptr_t queueHash = reinterpret_cast<std::uintptr_t>(queue) / alignof(std::max_align_t);
+    return g_queueMutexes[queueHash % LLGL_ARRAY_LENGTH(g_queueMutexes)];
+}
+
+VkResult VKQueueSubmit(VkQueue queue, std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence)
+{
+    std::lock_guard<std::mutex> guard{ GetQueueMutex(queue) };
+    return vkQueueSubmit(queue, submitCount, submits, fence);
+}
+
+VkResult VKQueueBindSparse(VkQueue queue, std::uint32_t bindInfoCount, const VkBindSparseInfo* bindInfos, VkFence fence)
+{
+    std::lock_guard<std::mutex> guard{ GetQueueMutex(queue) };
+    return vkQueueBindSparse(queue, bindInfoCount, bindInfos, fence);
+}
+
+VkResult VKQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* presentInfo)
+{
+    std::lock_guard<std::mutex> guard{ GetQueueMutex(queue) };
+    return vkQueuePresentKHR(queue, presentInfo);
+}
+
+VkResult VKQueueWaitIdle(VkQueue queue)
+{
+    std::lock_guard<std::mutex> guard{ GetQueueMutex(queue) };
+    return vkQueueWaitIdle(queue);
+}
+
+VkResult VKDeviceWaitIdle(VkDevice device)
+{
+    /* Lock all queue mutexes in a fixed order, since vkDeviceWaitIdle requires external synchronization of all queues */
+    for (std::mutex& queueMutex : g_queueMutexes)
+        queueMutex.lock();
+
+    VkResult result = vkDeviceWaitIdle(device);
+
+    for (std::mutex& queueMutex : g_queueMutexes)
+        queueMutex.unlock();
+
+    return result;
+}
+
 
 } // /namespace LLGL
 
@@ -84,11 +84,27 @@ std::vector<VkQueueFamilyProperties> VKQueryQueueFamilyProperties(VkPhysicalDevi
 
 SurfaceSupportDetails VKQuerySurfaceSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
 QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFlags flags, VkSurfaceKHR* surface = nullptr);
+
+// Returns the index of a queue family that supports transfer but neither graphics nor compute operations, or QueueFamilyIndices::invalidIndex if there is none.
+std::uint32_t VKFindDedicatedTransferQueueFamily(VkPhysicalDevice device);
+
+// Returns the index of a queue family that supports compute but no graphics operations, or QueueFamilyIndices::invalidIndex if there is none.
+std::uint32_t VKFindDedicatedComputeQueueFamily(VkPhysicalDevice device);
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* candidates, std::size_t numCandidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
 // Returns the memory type index that supports the specified type bits and properties, or throws an std::runtime_error exception on failure.
 std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties);
 
+/*
+Queue functions that lock a mutex for the specified queue, since Vulkan requires external synchronization of VkQueue objects
+and resources can be created and uploaded from multiple threads. These must be used instead of the plain vkQueue* functions and vkDeviceWaitIdle.
+*/
+VkResult VKQueueSubmit(VkQueue queue, std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence);
+VkResult VKQueueBindSparse(VkQueue queue, std::uint32_t bindInfoCount, const VkBindSparseInfo* bindInfos, VkFence fence);
+VkResult VKQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* presentInfo);
+VkResult VKQueueWaitIdle(VkQueue queue);
+VkResult VKDeviceWaitIdle(VkDevice device);
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include "Texture/VKTexture.h"
 #include "Memory/VKDeviceMemoryRegion.h"
 #include "Memory/VKDeviceMemory.h"
+#include "../../Core/ImageUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <string.h>
@@ -31,25 +32,35 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_                 { std::move(device.device_)      },
+    queueFamilyIndices_     { device.queueFamilyIndices_     },
+    graphicsQueue_          { device.graphicsQueue_          },
+    commandPool_            { std::move(device.commandPool_) },
+    transferQueueFamily_    { device.transferQueueFamily_    },
+    transferQueue_          { device.transferQueue_          },
+    computeQueueFamily_     { device.computeQueueFamily_     },
+    computeQueue_           { device.computeQueue_           },
+    sharedQueueFamilies_    { device.sharedQueueFamilies_    }
 {
 }
 
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
-    device_             = std::move(device.device_);
-    queueFamilyIndices_ = device.queueFamilyIndices_;
-    graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    device_                 = std::move(device.device_);
+    queueFamilyIndices_     = device.queueFamilyIndices_;
+    graphicsQueue_          = device.graphicsQueue_;
+    commandPool_            = std::move(device.commandPool_);
+    transferQueueFamily_    = device.transferQueueFamily_;
+    transferQueue_          = device.transferQueue_;
+    computeQueueFamily_     = device.computeQueueFamily_;
+    computeQueue_           = device.computeQueue_;
+    sharedQueueFamilies_    = device.sharedQueueFamilies_;
     return *this;
 }
 
 void VKDevice::WaitIdle()
 {
-    vkDeviceWaitIdle(device_);
+    VKDeviceWaitIdle(device_);
 }
 
 // Device-only layers are deprecated -> set 'enabledLayerCount' and 'ppEnabledLayerNames' members to zero during device creation.
@@ -58,14 +69,19 @@ void VKDevice::CreateLogicalDevice(
     VkPhysicalDevice                physicalDevice,
     const VkPhysicalDeviceFeatures* features,
     const char* const*              extensions,
-    std::uint32_t                   numExtensions)
+    std::uint32_t                   numExtensions,
+    bool                            enableTransferQueue,
+    bool                            enableComputeQueue,
+    void*                           extensionFeatures)
 {
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
 
-    SmallVector<VkDeviceQueueCreateInfo, 2> queueCreateInfos;
+    SmallVector<VkDeviceQueueCreateInfo, 4> queueCreateInfos;
 
-    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, float queuePriority)
+    constexpr float queuePriority = 1.0f;
+
+    auto AddQueueFamily = [&queueCreateInfos, &queuePriority](std::uint32_t family)
     {
         VkDeviceQueueCreateInfo info;
         {
@@ -79,18 +95,72 @@ void VKDevice::CreateLogicalDevice(
         queueCreateInfos.push_back(info);
     };
 
-    constexpr float queuePriority = 1.0f;
-
-    AddQueueFamily(queueFamilyIndices_.graphicsFamily, queuePriority);
+    AddQueueFamily(queueFamilyIndices_.graphicsFamily);
 
     if (queueFamilyIndices_.graphicsFamily != queueFamilyIndices_.presentFamily)
-        AddQueueFamily(queueFamilyIndices_.presentFamily, queuePriority);
+        AddQueueFamily(queueFamilyIndices_.presentFamily);
+
+    /* Add dedicated transfer queue family for asynchronous uploads (if enabled and supported) */
+    if (enableTransferQueue)
+    {
+        const std::uint32_t transferFamily = VKFindDedicatedTransferQueueFamily(physicalDevice);
+        if (transferFamily != QueueFamilyIndices::invalidIndex &&
+            transferFamily != queueFamilyIndices_.graphicsFamily &&
+            transferFamily != queueFamilyIndices_.presentFamily)
+        {
+            transferQueueFamily_ = transferFamily;
+            AddQueueFamily(transferQueueFamily_);
+        }
+    }
+
+    /* Add dedicated compute queue family for asynchronous compute (if enabled and supported) */
+    if (enableComputeQueue)
+    {
+        const std::uint32_t computeFamily = VKFindDedicatedComputeQueueFamily(physicalDevice);
+        if (computeFamily != QueueFamilyIndices::invalidIndex &&
+            computeFamily != queueFamilyIndices_.graphicsFamily &&
+            computeFamily != queueFamilyIndices_.presentFamily &&
+            computeFamily != transferQueueFamily_)
+        {
+            computeQueueFamily_ = computeFamily;
+            AddQueueFamily(computeQueueFamily_);
+
+            /* Resources are shared between the graphics, compute, and transfer queues without ownership transfers */
+            sharedQueueFamilies_.push_back(queueFamilyIndices_.graphicsFamily);
+            sharedQueueFamilies_.push_back(computeQueueFamily_);
+            if (transferQueueFamily_ != QueueFamilyIndices::invalidIndex)
+                sharedQueueFamilies_.push_back(transferQueueFamily_);
+        }
+    }
+
+    /* Enable timeline semaphore feature if its extension is enabled, since the feature must be supported by any device that supports the extension */
+    const void* createInfoNext = extensionFeatures;
+
+    #ifdef VK_KHR_timeline_semaphore
+
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+    {
+        timelineSemaphoreFeatures.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext             = extensionFeatures;
+        timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+    }
+
+    for_range(i, numExtensions)
+    {
+        if (::strcmp(extensions[i], VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0)
+        {
+            createInfoNext = &timelineSemaphoreFeatures;
+            break;
+        }
+    }
+
+    #endif // /VK_KHR_timeline_semaphore
 
     /* Create logical device */
     VkDeviceCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = createInfoNext;
         createInfo.flags                    = 0;
         createInfo.queueCreateInfoCount     = static_cast<std::uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
@@ -106,6 +176,14 @@ void VKDevice::CreateLogicalDevice(
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
+    /* Query dedicated transfer queue */
+    if (transferQueueFamily_ != QueueFamilyIndices::invalidIndex)
+        vkGetDeviceQueue(device_, transferQueueFamily_, 0, &transferQueue_);
+
+    /* Query dedicated compute queue */
+    if (computeQueueFamily_ != QueueFamilyIndices::invalidIndex)
+        vkGetDeviceQueue(device_, computeQueueFamily_, 0, &computeQueue_);
+
     /* Create default command pool */
     commandPool_ = CreateCommandPool();
 }
@@ -193,7 +271,7 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
             submitInfo.commandBufferCount   = 1;
             submitInfo.pCommandBuffers      = (&cmdBuffer);
         }
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        VKQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
 
         /* Wait for fence to be signaled */
         fence.Wait(device_, ULLONG_MAX);
@@ -211,6 +289,8 @@ void VKDevice::CopyBuffer(
     VkDeviceSize    srcOffset,
     VkDeviceSize    dstOffset)
 {
+    std::lock_guard<std::recursive_mutex> guard{ commandPoolMutex_ };
+
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkBufferCopy region;
@@ -232,8 +312,8 @@ void VKDevice::WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSiz
         VKDeviceMemory* deviceMemory = region->GetParentChunk();
         if (void* memory = deviceMemory->Map(device_, region->GetOffset() + offset, size))
         {
-            /* Copy input data to buffer memory */
-            ::memcpy(memory, data, static_cast<std::size_t>(size));
+            /* Copy input data to buffer memory; host-visible memory is typically write-combined */
+            CopyToWriteCombinedMemory(memory, data, static_cast<std::size_t>(size));
             deviceMemory->Unmap(device_);
         }
     }
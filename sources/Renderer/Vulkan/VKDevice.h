@@ -10,10 +10,13 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Container/SmallVector.h>
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <mutex>
 
 
 namespace LLGL
@@ -39,7 +42,10 @@ class VKDevice
             VkPhysicalDevice                physicalDevice,
             const VkPhysicalDeviceFeatures* features,
             const char* const*              extensions,
-            std::uint32_t                   numExtensions
+            std::uint32_t                   numExtensions,
+            bool                            enableTransferQueue = false,
+            bool                            enableComputeQueue  = false,
+            void*                           extensionFeatures   = nullptr   // Optional chain of extension feature structures for VkDeviceCreateInfo::pNext.
         );
 
         void LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevice device);
@@ -53,6 +59,7 @@ class VKDevice
 
         /* ----- Queue ----- */
 
+        // Allocates a one-shot command buffer from the internal command pool. The command pool mutex must be locked until the command buffer has been flushed.
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
@@ -108,12 +115,60 @@ class VKDevice
             return commandPool_;
         }
 
+        // Returns the mutex that guards the internal command pool and all command buffers allocated from it.
+        inline std::recursive_mutex& GetCommandPoolMutex()
+        {
+            return commandPoolMutex_;
+        }
+
+        // Returns the native VkQueue handle of the dedicated transfer queue or VK_NULL_HANDLE if there is none.
+        inline VkQueue GetVkTransferQueue() const
+        {
+            return transferQueue_;
+        }
+
+        // Returns the queue family index of the dedicated transfer queue or QueueFamilyIndices::invalidIndex if there is none.
+        inline std::uint32_t GetTransferQueueFamily() const
+        {
+            return transferQueueFamily_;
+        }
+
+        // Returns the native VkQueue handle of the dedicated compute queue or VK_NULL_HANDLE if there is none.
+        inline VkQueue GetVkComputeQueue() const
+        {
+            return computeQueue_;
+        }
+
+        // Returns the queue family index of the dedicated compute queue or QueueFamilyIndices::invalidIndex if there is none.
+        inline std::uint32_t GetComputeQueueFamily() const
+        {
+            return computeQueueFamily_;
+        }
+
+        /*
+        Returns the queue families that buffers and textures must be shared with in concurrent sharing mode.
+        This is empty unless a dedicated compute queue exists, in which case resources are accessed by more than one queue family without ownership transfers.
+        */
+        inline ArrayView<std::uint32_t> GetSharedQueueFamilies() const
+        {
+            return sharedQueueFamilies_;
+        }
+
     private:
 
         VKPtr<VkDevice>         device_;
         QueueFamilyIndices      queueFamilyIndices_;
         VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
         VKPtr<VkCommandPool>    commandPool_;
+        std::recursive_mutex    commandPoolMutex_;
+
+        std::uint32_t           transferQueueFamily_    = QueueFamilyIndices::invalidIndex;
+        VkQueue                 transferQueue_          = VK_NULL_HANDLE;
+
+        std::uint32_t           computeQueueFamily_     = QueueFamilyIndices::invalidIndex;
+        VkQueue                 computeQueue_           = VK_NULL_HANDLE;
+
+        SmallVector<std::uint32_t, 3> sharedQueueFamilies_;  // Queue families for concurrent sharing mode; empty if resources are exclusive to the graphics queue.
 
 };
 
@@ -34,11 +34,28 @@ namespace ModuleVulkan
     {
         return new VKRenderSystem{ *renderSystemDesc };
     }
+
+    bool ProbeRenderSystem(const LLGL::RenderSystemDescriptor* renderSystemDesc, LLGL::RenderSystemProbe* probe)
+    {
+        return VKRenderSystem::Probe(*renderSystemDesc, *probe);
+    }
 } // /namespace ModuleVulkan
 
 
 } // /namespace LLGL
 
+#ifdef LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
+#include "../DirectCommandBufferImpl.h"
+#include "Command/VKCommandBuffer.h"
+
+#define LLGL_VK_DIRECT_DISPATCH(CMDBUFFER, CALL) \
+    LLGL_DIRECT_DISPATCH_FINAL(VKCommandBuffer, CMDBUFFER, CALL)
+
+LLGL_IMPLEMENT_DIRECT_COMMAND_BUFFER(LLGL_VK_DIRECT_DISPATCH)
+
+#endif // /LLGL_ENABLE_DIRECT_BACKEND_CALLS
+
 #ifndef LLGL_BUILD_STATIC_LIB
 
 extern "C"
@@ -69,6 +86,17 @@ LLGL_EXPORT void* LLGL_RenderSystem_Alloc(const void* renderSystemDesc, int rend
     return nullptr;
 }
 
+LLGL_EXPORT int LLGL_RenderSystem_Probe(const void* renderSystemDesc, int renderSystemDescSize, void* probe, int probeSize)
+{
+    if (renderSystemDesc != nullptr && static_cast<std::size_t>(renderSystemDescSize) == sizeof(LLGL::RenderSystemDescriptor) &&
+        probe != nullptr && static_cast<std::size_t>(probeSize) == sizeof(LLGL::RenderSystemProbe))
+    {
+        auto desc = reinterpret_cast<const LLGL::RenderSystemDescriptor*>(renderSystemDesc);
+        return (LLGL::ModuleVulkan::ProbeRenderSystem(desc, reinterpret_cast<LLGL::RenderSystemProbe*>(probe)) ? 1 : 0);
+    }
+    return 0;
+}
+
 } // /extern "C"
 
 #endif // /LLGL_BUILD_STATIC_LIB
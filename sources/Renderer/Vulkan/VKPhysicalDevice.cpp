@@ -7,6 +7,7 @@
 
 #include "VKPhysicalDevice.h"
 #include "Ext/VKExtensionRegistry.h"
+#include "Ext/VKExtensions.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "RenderState/VKGraphicsPSO.h"
@@ -31,6 +32,13 @@ static const char* g_requiredVulkanExtensions[] =
     nullptr,
 };
 
+// Required extensions for headless render systems, i.e. without swap-chain support
+static const char* g_requiredVulkanExtensionsHeadless[] =
+{
+    VK_KHR_MAINTENANCE1_EXTENSION_NAME,
+    nullptr,
+};
+
 static bool CheckDeviceExtensionSupport(
     VkPhysicalDevice                    physicalDevice,
     const char* const*                  requiredExtensions,
@@ -53,16 +61,25 @@ static bool CheckDeviceExtensionSupport(
     return unsupported.empty();
 }
 
+static std::size_t GetNumExtensionNames(const char* const* extensionNames)
+{
+    std::size_t n = 0;
+    while (extensionNames[n] != nullptr)
+        ++n;
+    return n;
+}
+
 static bool IsPhysicalDeviceSuitable(
     VkPhysicalDevice                    physicalDevice,
+    const char* const*                  requiredExtensions,
     std::vector<VkExtensionProperties>& supportedExtensions)
 {
     /* Check if physical devices supports at least these extensions */
     std::vector<VkExtensionProperties> extensions;
     bool suitable = CheckDeviceExtensionSupport(
         physicalDevice,
-        g_requiredVulkanExtensions,
-        (sizeof(g_requiredVulkanExtensions) / sizeof(g_requiredVulkanExtensions[0]) - 1),
+        requiredExtensions,
+        GetNumExtensionNames(requiredExtensions),
         extensions
     );
 
@@ -87,14 +104,16 @@ static bool IsPreferredDeviceVendor(DeviceVendor vendor, long preferredDeviceFla
     }
 }
 
-bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags)
+bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags, bool headless)
 {
     /* Query all physical devices and pick suitable */
     std::vector<VkPhysicalDevice> physicalDevices = VKQueryPhysicalDevices(instance);
 
-    auto TryPickPhysicalDevice = [this](VkPhysicalDevice device) -> bool
+    const char** requiredExtensions = (headless ? g_requiredVulkanExtensionsHeadless : g_requiredVulkanExtensions);
+
+    auto TryPickPhysicalDevice = [this, requiredExtensions](VkPhysicalDevice device) -> bool
     {
-        if (!IsPhysicalDeviceSuitable(device, supportedExtensions_))
+        if (!IsPhysicalDeviceSuitable(device, requiredExtensions, supportedExtensions_))
         {
             /* Device doesn't support required extensions */
             return false;
@@ -104,7 +123,7 @@ bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDev
         for (const VkExtensionProperties& extension : supportedExtensions_)
             supportedExtensionNames_.insert(extension.extensionName);
 
-        if (!EnableExtensions(g_requiredVulkanExtensions, true))
+        if (!EnableExtensions(requiredExtensions, true))
         {
             /* Stop considering this physical device, because some required extensions are not supported */
             supportedExtensionNames_.clear();
@@ -213,6 +232,18 @@ static void GetVKPipelineCacheID(const VkPhysicalDeviceProperties& properties, s
     }
 }
 
+// Returns true if the graphics queue family of the specified physical device supports sparse binding operations.
+static bool IsSparseBindingQueueSupported(VkPhysicalDevice physicalDevice)
+{
+    const QueueFamilyIndices queueFamilyIndices = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(physicalDevice);
+    return
+    (
+        queueFamilyIndices.graphicsFamily < queueFamilies.size() &&
+        (queueFamilies[queueFamilyIndices.graphicsFamily].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0
+    );
+}
+
 void VKPhysicalDevice::QueryDeviceProperties(
     RendererInfo&               info,
     RenderingCapabilities&      caps,
@@ -268,6 +299,19 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasPipelineStatistics             = (features_.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
     caps.features.hasPipelineCaching                = true;
+    caps.features.hasConcurrentPipelineStateCreation = true;
+    caps.features.hasConcurrentResourceCreation     = true;
+    caps.features.hasIndirectDrawingCount           = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    caps.features.hasInputAttachments               = true;
+    caps.features.hasQueryResolve                   = true;
+    caps.features.hasSparseTextures                 = (features_.sparseBinding != VK_FALSE && features_.sparseResidencyImage2D != VK_FALSE && IsSparseBindingQueueSupported(physicalDevice_));
+    #ifdef VK_EXT_mesh_shader
+    caps.features.hasMeshShaders                    = IsExtensionFeatureSupported(VK_EXT_MESH_SHADER_EXTENSION_NAME);
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    caps.features.hasVariableRateShading            = IsExtensionFeatureSupported(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+    #endif
+    caps.features.hasMultiview                      = (multiviewFeatures_.multiview != VK_FALSE);
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -300,6 +344,35 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.limits.maxDepthBufferSamples               = VKTypes::GetMaxVkSampleCounts(limits.framebufferDepthSampleCounts);
     caps.limits.maxStencilBufferSamples             = VKTypes::GetMaxVkSampleCounts(limits.framebufferStencilSampleCounts);
     caps.limits.maxNoAttachmentSamples              = VKTypes::GetMaxVkSampleCounts(limits.framebufferNoAttachmentsSampleCounts);
+    #ifdef VK_EXT_mesh_shader
+    if (caps.features.hasMeshShaders)
+    {
+        /* Thread groups are launched for either the task or mesh shader, so report the lower limit of both */
+        caps.limits.maxMeshShaderWorkGroups[0] = std::min(meshShaderProperties_.maxTaskWorkGroupCount[0], meshShaderProperties_.maxMeshWorkGroupCount[0]);
+        caps.limits.maxMeshShaderWorkGroups[1] = std::min(meshShaderProperties_.maxTaskWorkGroupCount[1], meshShaderProperties_.maxMeshWorkGroupCount[1]);
+        caps.limits.maxMeshShaderWorkGroups[2] = std::min(meshShaderProperties_.maxTaskWorkGroupCount[2], meshShaderProperties_.maxMeshWorkGroupCount[2]);
+    }
+    #endif
+    if (caps.features.hasMultiview)
+    {
+        /* View masks are 32-bit masks, so more views cannot be addressed */
+        caps.limits.maxMultiviewViews = std::min(multiviewProperties_.maxMultiviewViewCount, 32u);
+    }
+
+    /* Depth bias is a core dynamic state; all other dynamic states require VK_EXT_extended_dynamic_state */
+    caps.limits.dynamicStates = DynamicStateFlags::DepthBias;
+    #ifdef VK_EXT_extended_dynamic_state
+    if (IsExtensionFeatureSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+    {
+        caps.limits.dynamicStates |=
+        (
+            DynamicStateFlags::CullMode             |
+            DynamicStateFlags::DepthState           |
+            DynamicStateFlags::StencilState         |
+            DynamicStateFlags::PrimitiveTopology
+        );
+    }
+    #endif
 
     /* Store graphics pipeline spcific limitations */
     pipelineLimits.lineWidthRange[0]    = limits.lineWidthRange[0];
@@ -313,7 +386,7 @@ void VKPhysicalDevice::QueryDeviceProperties(
     */
 }
 
-VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice)
+VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice, bool enableTransferQueue, bool enableComputeQueue)
 {
     VKDevice device;
     if (customLogicalDevice != VK_NULL_HANDLE)
@@ -325,16 +398,202 @@ VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice)
     }
     else
     {
+        /* Enable all supported extension features by chaining copies of the queried feature structures */
+        void* extensionFeatures = nullptr;
+
+        VkPhysicalDeviceMultiviewFeatures multiviewFeatures = multiviewFeatures_;
+        if (multiviewFeatures.multiview != VK_FALSE)
+        {
+            /* Only enable multiview for vertex and fragment shaders, since geometry and tessellation shaders are rarely supported with multiview */
+            multiviewFeatures.multiviewGeometryShader       = VK_FALSE;
+            multiviewFeatures.multiviewTessellationShader   = VK_FALSE;
+            multiviewFeatures.pNext = extensionFeatures;
+            extensionFeatures = &multiviewFeatures;
+        }
+
+        #ifdef VK_EXT_descriptor_indexing
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = descriptorIndexingFeatures_;
+        if (descriptorIndexingFeatures.sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT &&
+            SupportsExtension(VK_KHR_MAINTENANCE3_EXTENSION_NAME))
+        {
+            descriptorIndexingFeatures.pNext = extensionFeatures;
+            extensionFeatures = &descriptorIndexingFeatures;
+        }
+        #endif // /VK_EXT_descriptor_indexing
+
+        #ifdef VK_EXT_graphics_pipeline_library
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphicsPipelineLibraryFeatures = graphicsPipelineLibraryFeatures_;
+        if (graphicsPipelineLibraryFeatures.sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT)
+        {
+            graphicsPipelineLibraryFeatures.pNext = extensionFeatures;
+            extensionFeatures = &graphicsPipelineLibraryFeatures;
+        }
+        #endif // /VK_EXT_graphics_pipeline_library
+
+        #ifdef VK_EXT_memory_priority
+        VkPhysicalDeviceMemoryPriorityFeaturesEXT memoryPriorityFeatures = memoryPriorityFeatures_;
+        if (memoryPriorityFeatures.memoryPriority != VK_FALSE)
+        {
+            memoryPriorityFeatures.pNext = extensionFeatures;
+            extensionFeatures = &memoryPriorityFeatures;
+        }
+        #endif // /VK_EXT_memory_priority
+
+        #ifdef VK_EXT_pageable_device_local_memory
+        VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT pageableDeviceLocalMemoryFeatures = pageableDeviceLocalMemoryFeatures_;
+        if (pageableDeviceLocalMemoryFeatures.pageableDeviceLocalMemory != VK_FALSE)
+        {
+            pageableDeviceLocalMemoryFeatures.pNext = extensionFeatures;
+            extensionFeatures = &pageableDeviceLocalMemoryFeatures;
+        }
+        #endif // /VK_EXT_pageable_device_local_memory
+
+        #ifdef VK_EXT_multi_draw
+        VkPhysicalDeviceMultiDrawFeaturesEXT multiDrawFeatures = multiDrawFeatures_;
+        if (multiDrawFeatures.multiDraw != VK_FALSE)
+        {
+            multiDrawFeatures.pNext = extensionFeatures;
+            extensionFeatures = &multiDrawFeatures;
+        }
+        #endif // /VK_EXT_multi_draw
+
+        #ifdef VK_EXT_mesh_shader
+        VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures = meshShaderFeatures_;
+        if (meshShaderFeatures.meshShader != VK_FALSE)
+        {
+            /* Only enable task and mesh shaders, since the other features depend on features that are not enabled */
+            meshShaderFeatures.multiviewMeshShader                      = VK_FALSE;
+            meshShaderFeatures.primitiveFragmentShadingRateMeshShader   = VK_FALSE;
+            meshShaderFeatures.meshShaderQueries                        = VK_FALSE;
+            meshShaderFeatures.pNext = extensionFeatures;
+            extensionFeatures = &meshShaderFeatures;
+        }
+        #endif // /VK_EXT_mesh_shader
+
+        #ifdef VK_KHR_present_id
+        VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = presentIdFeatures_;
+        if (presentIdFeatures.presentId != VK_FALSE)
+        {
+            presentIdFeatures.pNext = extensionFeatures;
+            extensionFeatures = &presentIdFeatures;
+        }
+        #endif // /VK_KHR_present_id
+
+        #ifdef VK_KHR_present_wait
+        VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = presentWaitFeatures_;
+        if (presentWaitFeatures.presentWait != VK_FALSE)
+        {
+            presentWaitFeatures.pNext = extensionFeatures;
+            extensionFeatures = &presentWaitFeatures;
+        }
+        #endif // /VK_KHR_present_wait
+
+        #ifdef VK_KHR_dynamic_rendering
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = dynamicRenderingFeatures_;
+        if (dynamicRenderingFeatures.dynamicRendering != VK_FALSE)
+        {
+            dynamicRenderingFeatures.pNext = extensionFeatures;
+            extensionFeatures = &dynamicRenderingFeatures;
+        }
+        #endif // /VK_KHR_dynamic_rendering
+
+        #ifdef VK_EXT_extended_dynamic_state
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures = extendedDynamicStateFeatures_;
+        if (extendedDynamicStateFeatures.extendedDynamicState != VK_FALSE)
+        {
+            extendedDynamicStateFeatures.pNext = extensionFeatures;
+            extensionFeatures = &extendedDynamicStateFeatures;
+        }
+        #endif // /VK_EXT_extended_dynamic_state
+
+        #ifdef VK_KHR_fragment_shading_rate
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR fragmentShadingRateFeatures = fragmentShadingRateFeatures_;
+        if (fragmentShadingRateFeatures.pipelineFragmentShadingRate != VK_FALSE)
+        {
+            /* Only enable the per-draw shading rate, since shading-rate attachments are not supported */
+            fragmentShadingRateFeatures.primitiveFragmentShadingRate    = VK_FALSE;
+            fragmentShadingRateFeatures.attachmentFragmentShadingRate   = VK_FALSE;
+            fragmentShadingRateFeatures.pNext = extensionFeatures;
+            extensionFeatures = &fragmentShadingRateFeatures;
+        }
+        #endif // /VK_KHR_fragment_shading_rate
+
+        #ifdef VK_EXT_host_image_copy
+        VkPhysicalDeviceHostImageCopyFeaturesEXT hostImageCopyFeatures = hostImageCopyFeatures_;
+        if (hostImageCopyFeatures.hostImageCopy != VK_FALSE)
+        {
+            hostImageCopyFeatures.pNext = extensionFeatures;
+            extensionFeatures = &hostImageCopyFeatures;
+        }
+        #endif // /VK_EXT_host_image_copy
+
         device.CreateLogicalDevice(
             physicalDevice_,
             &features_,
             enabledExtensionNames_.data(),
-            static_cast<std::uint32_t>(enabledExtensionNames_.size())
+            static_cast<std::uint32_t>(enabledExtensionNames_.size()),
+            enableTransferQueue,
+            enableComputeQueue,
+            extensionFeatures
         );
     }
     return device;
 }
 
+bool VKPhysicalDevice::SupportsOptimalHostImageCopy(
+    VkImageType         imageType,
+    VkFormat            format,
+    VkImageCreateFlags  createFlags,
+    VkImageUsageFlags   usageFlags,
+    VkImageLayout       dstLayout) const
+{
+    #ifdef VK_EXT_host_image_copy
+
+    if (!HasExtension(VKExt::EXT_host_image_copy))
+        return false;
+
+    if (std::find(hostImageCopyDstLayouts_.begin(), hostImageCopyDstLayouts_.end(), dstLayout) == hostImageCopyDstLayouts_.end())
+        return false;
+
+    /* Check if format supports host transfers with optimal tiling */
+    VkFormatProperties3KHR formatProperties3 = {};
+    formatProperties3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3_KHR;
+
+    VkFormatProperties2 formatProperties = {};
+    formatProperties.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+    formatProperties.pNext = &formatProperties3;
+    vkGetPhysicalDeviceFormatProperties2(physicalDevice_, format, &formatProperties);
+
+    if ((formatProperties3.optimalTilingFeatures & VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT_EXT) == 0)
+        return false;
+
+    /* Host transfer usage might disable device specific layouts such as framebuffer compression, so only use it if device access remains optimal */
+    VkPhysicalDeviceImageFormatInfo2 imageFormatInfo = {};
+    {
+        imageFormatInfo.sType   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2;
+        imageFormatInfo.format  = format;
+        imageFormatInfo.type    = imageType;
+        imageFormatInfo.tiling  = VK_IMAGE_TILING_OPTIMAL;
+        imageFormatInfo.usage   = (usageFlags | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT);
+        imageFormatInfo.flags   = createFlags;
+    }
+    VkHostImageCopyDevicePerformanceQueryEXT performanceQuery = {};
+    performanceQuery.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT;
+
+    VkImageFormatProperties2 imageFormatProperties = {};
+    imageFormatProperties.sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2;
+    imageFormatProperties.pNext = &performanceQuery;
+
+    VkResult result = vkGetPhysicalDeviceImageFormatProperties2(physicalDevice_, &imageFormatInfo, &imageFormatProperties);
+    return (result == VK_SUCCESS && (performanceQuery.optimalDeviceAccess != VK_FALSE || performanceQuery.identicalMemoryLayout != VK_FALSE));
+
+    #else // VK_EXT_host_image_copy
+
+    return false;
+
+    #endif // /VK_EXT_host_image_copy
+}
+
 std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
 {
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
@@ -358,12 +617,63 @@ bool VKPhysicalDevice::SupportsExtension(const char* extension) const
  * ======= Private: =======
  */
 
+#ifdef VK_EXT_memory_budget
+
+bool VKPhysicalDevice::QueryMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& outBudgetProps) const
+{
+    /* Memory budget can only be queried with vkGetPhysicalDeviceMemoryProperties2, which is core since Vulkan 1.1 */
+    if (!HasExtension(VKExt::EXT_memory_budget) || properties_.apiVersion < VK_API_VERSION_1_1)
+        return false;
+
+    outBudgetProps = {};
+    outBudgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryPropertiesExt = {};
+    {
+        memoryPropertiesExt.sType   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        memoryPropertiesExt.pNext   = &outBudgetProps;
+    }
+    vkGetPhysicalDeviceMemoryProperties2(physicalDevice_, &memoryPropertiesExt);
+
+    return true;
+}
+
+#endif // /VK_EXT_memory_budget
+
+#ifdef VK_EXT_calibrated_timestamps
+
+bool VKPhysicalDevice::SupportsCalibrateableTimeDomain(VkInstance instance, VkTimeDomainEXT timeDomain) const
+{
+    if (!HasExtension(VKExt::EXT_calibrated_timestamps))
+        return false;
+
+    /* Load physical device procedure with the instance, since it cannot be loaded with vkGetDeviceProcAddr */
+    if (vkGetPhysicalDeviceCalibrateableTimeDomainsEXT == nullptr)
+    {
+        vkGetPhysicalDeviceCalibrateableTimeDomainsEXT = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(
+            vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")
+        );
+        if (vkGetPhysicalDeviceCalibrateableTimeDomainsEXT == nullptr)
+            return false;
+    }
+
+    std::uint32_t numTimeDomains = 0;
+    vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice_, &numTimeDomains, nullptr);
+
+    std::vector<VkTimeDomainEXT> timeDomains(numTimeDomains);
+    vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice_, &numTimeDomains, timeDomains.data());
+
+    return (std::find(timeDomains.begin(), timeDomains.end(), timeDomain) != timeDomains.end());
+}
+
+#endif // /VK_EXT_calibrated_timestamps
+
 bool VKPhysicalDevice::EnableExtensions(const char** extensions, bool required)
 {
     for (; *extensions != nullptr; ++extensions)
     {
         const char* name = *extensions;
-        if (supportedExtensionNames_.find(name) != supportedExtensionNames_.end())
+        if (supportedExtensionNames_.find(name) != supportedExtensionNames_.end() && IsExtensionFeatureSupported(name))
         {
             /* Add name to enabled Vulkan extensions */
             enabledExtensionNames_.push_back(name);
@@ -378,6 +688,63 @@ bool VKPhysicalDevice::EnableExtensions(const char** extensions, bool required)
     return true;
 }
 
+bool VKPhysicalDevice::IsExtensionFeatureSupported(const char* extension) const
+{
+    #ifdef VK_EXT_memory_priority
+    if (std::strcmp(extension, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME) == 0)
+        return (memoryPriorityFeatures_.memoryPriority != VK_FALSE);
+    #endif
+    #ifdef VK_EXT_pageable_device_local_memory
+    if (std::strcmp(extension, VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME) == 0)
+        return (pageableDeviceLocalMemoryFeatures_.pageableDeviceLocalMemory != VK_FALSE);
+    #endif
+    #ifdef VK_EXT_multi_draw
+    if (std::strcmp(extension, VK_EXT_MULTI_DRAW_EXTENSION_NAME) == 0)
+        return (multiDrawFeatures_.multiDraw != VK_FALSE);
+    #endif
+    #ifdef VK_EXT_mesh_shader
+    if (std::strcmp(extension, VK_EXT_MESH_SHADER_EXTENSION_NAME) == 0)
+        return (meshShaderFeatures_.meshShader != VK_FALSE && SupportsExtension(VK_KHR_SPIRV_1_4_EXTENSION_NAME));
+    #endif
+    #ifdef VK_KHR_present_id
+    if (std::strcmp(extension, VK_KHR_PRESENT_ID_EXTENSION_NAME) == 0)
+        return (presentIdFeatures_.presentId != VK_FALSE);
+    #endif
+    #ifdef VK_KHR_present_wait
+    if (std::strcmp(extension, VK_KHR_PRESENT_WAIT_EXTENSION_NAME) == 0)
+        return (presentWaitFeatures_.presentWait != VK_FALSE && presentIdFeatures_.presentId != VK_FALSE);
+    #endif
+    #ifdef VK_KHR_dynamic_rendering
+    /* Depth-stencil resolve and render pass 2, which dynamic rendering depends on, are only core since Vulkan 1.2 */
+    if (std::strcmp(extension, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) == 0)
+        return (dynamicRenderingFeatures_.dynamicRendering != VK_FALSE && properties_.apiVersion >= VK_API_VERSION_1_2);
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state
+    if (std::strcmp(extension, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME) == 0)
+        return (extendedDynamicStateFeatures_.extendedDynamicState != VK_FALSE);
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    /* Render pass 2, which fragment shading rate depends on, is only core since Vulkan 1.2 */
+    if (std::strcmp(extension, VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME) == 0)
+        return (fragmentShadingRateFeatures_.pipelineFragmentShadingRate != VK_FALSE && properties_.apiVersion >= VK_API_VERSION_1_2);
+    #endif
+    #ifdef VK_EXT_host_image_copy
+    /* Copy commands 2 and format feature flags 2, which host image copy depends on, are only core since Vulkan 1.3 */
+    if (std::strcmp(extension, VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME) == 0)
+    {
+        return
+        (
+            hostImageCopyFeatures_.hostImageCopy != VK_FALSE &&
+            (
+                properties_.apiVersion >= VK_API_VERSION_1_3 ||
+                (SupportsExtension(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME) && SupportsExtension(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME))
+            )
+        );
+    }
+    #endif
+    return true;
+}
+
 void VKPhysicalDevice::QueryDeviceInfo()
 {
     if (HasExtension(VKExt::KHR_get_physical_device_properties2))
@@ -394,6 +761,9 @@ void VKPhysicalDevice::QueryDeviceInfo()
         vkGetPhysicalDeviceProperties(physicalDevice_, &properties_);
         vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
     }
+
+    /* Query extension features that must be known before the logical device is created */
+    QueryExtensionFeatures();
 }
 
 void VKPhysicalDevice::QueryDeviceFeaturesWithExtensions()
@@ -453,6 +823,191 @@ void VKPhysicalDevice::QueryDeviceMemoryPropertiesWithExtensions()
     vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
 }
 
+void VKPhysicalDevice::QueryExtensionFeatures()
+{
+    /* Extension features can only be queried with vkGetPhysicalDeviceFeatures2, which is core since Vulkan 1.1 */
+    if (properties_.apiVersion < VK_API_VERSION_1_1)
+        return;
+
+    VkPhysicalDeviceFeatures2 featuresExt = {};
+    featuresExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+
+    VKBaseStructureInfo* currentDesc = reinterpret_cast<VKBaseStructureInfo*>(&featuresExt);
+
+    auto ChainDescritpor = [&currentDesc](void* descPtr, VkStructureType type)
+    {
+        currentDesc->pNext = descPtr;
+        auto baseDescPtr = reinterpret_cast<VKBaseStructureInfo*>(descPtr);
+        {
+            baseDescPtr->sType = type;
+        }
+        currentDesc = baseDescPtr;
+    };
+
+    /* Multiview is core since Vulkan 1.1 (formerly VK_KHR_multiview) */
+    ChainDescritpor(&multiviewFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES);
+
+    #ifdef VK_EXT_descriptor_indexing
+    if (SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        ChainDescritpor(&descriptorIndexingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT);
+    #endif
+
+    #if defined VK_EXT_graphics_pipeline_library && defined VK_KHR_pipeline_library
+    if (SupportsExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) && SupportsExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        ChainDescritpor(&graphicsPipelineLibraryFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+    #endif
+
+    #ifdef VK_EXT_memory_priority
+    if (SupportsExtension(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME))
+        ChainDescritpor(&memoryPriorityFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT);
+    #endif
+
+    #if defined VK_EXT_pageable_device_local_memory && defined VK_EXT_memory_priority
+    if (SupportsExtension(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME) && SupportsExtension(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME))
+        ChainDescritpor(&pageableDeviceLocalMemoryFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT);
+    #endif
+
+    #ifdef VK_EXT_multi_draw
+    if (SupportsExtension(VK_EXT_MULTI_DRAW_EXTENSION_NAME))
+        ChainDescritpor(&multiDrawFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT);
+    #endif
+
+    #ifdef VK_EXT_mesh_shader
+    if (SupportsExtension(VK_EXT_MESH_SHADER_EXTENSION_NAME))
+        ChainDescritpor(&meshShaderFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT);
+    #endif
+
+    #ifdef VK_KHR_present_id
+    if (SupportsExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME))
+        ChainDescritpor(&presentIdFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR);
+    #endif
+
+    #if defined VK_KHR_present_wait && defined VK_KHR_present_id
+    if (SupportsExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME) && SupportsExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME))
+        ChainDescritpor(&presentWaitFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR);
+    #endif
+
+    #ifdef VK_KHR_dynamic_rendering
+    if (SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        ChainDescritpor(&dynamicRenderingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+    #endif
+
+    #ifdef VK_EXT_extended_dynamic_state
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        ChainDescritpor(&extendedDynamicStateFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+    #endif
+
+    #ifdef VK_KHR_fragment_shading_rate
+    if (SupportsExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME))
+        ChainDescritpor(&fragmentShadingRateFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+    #endif
+
+    #ifdef VK_EXT_host_image_copy
+    if (SupportsExtension(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME))
+        ChainDescritpor(&hostImageCopyFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT);
+    #endif
+
+    if (featuresExt.pNext == nullptr)
+        return;
+
+    vkGetPhysicalDeviceFeatures2(physicalDevice_, &featuresExt);
+
+    /* Unchain feature structures again, so they can be copied individually */
+    multiviewFeatures_.pNext = nullptr;
+    #ifdef VK_EXT_descriptor_indexing
+    descriptorIndexingFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_graphics_pipeline_library
+    graphicsPipelineLibraryFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_memory_priority
+    memoryPriorityFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_pageable_device_local_memory
+    pageableDeviceLocalMemoryFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_multi_draw
+    multiDrawFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_mesh_shader
+    meshShaderFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_KHR_present_id
+    presentIdFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_KHR_present_wait
+    presentWaitFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_KHR_dynamic_rendering
+    dynamicRenderingFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state
+    extendedDynamicStateFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    fragmentShadingRateFeatures_.pNext = nullptr;
+    #endif
+    #ifdef VK_EXT_host_image_copy
+    hostImageCopyFeatures_.pNext = nullptr;
+    #endif
+
+    if (multiviewFeatures_.multiview != VK_FALSE)
+    {
+        /* Query maximum number of views per multiview render pass */
+        VkPhysicalDeviceProperties2 propertiesExt = {};
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &multiviewProperties_;
+        multiviewProperties_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES;
+        vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+        multiviewProperties_.pNext = nullptr;
+    }
+
+    #ifdef VK_EXT_multi_draw
+    if (multiDrawFeatures_.multiDraw != VK_FALSE)
+    {
+        /* Query maximum number of draws per multi draw command */
+        VkPhysicalDeviceProperties2 propertiesExt = {};
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &multiDrawProperties_;
+        multiDrawProperties_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
+        vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+        multiDrawProperties_.pNext = nullptr;
+    }
+    #endif // /VK_EXT_multi_draw
+
+    #ifdef VK_EXT_mesh_shader
+    if (meshShaderFeatures_.meshShader != VK_FALSE)
+    {
+        /* Query maximum number of thread groups per mesh shader draw command */
+        VkPhysicalDeviceProperties2 propertiesExt = {};
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &meshShaderProperties_;
+        meshShaderProperties_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT;
+        vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+        meshShaderProperties_.pNext = nullptr;
+    }
+    #endif // /VK_EXT_mesh_shader
+
+    #ifdef VK_EXT_host_image_copy
+    if (hostImageCopyFeatures_.hostImageCopy != VK_FALSE)
+    {
+        /* Query image layouts that are supported as destination of host image copies */
+        VkPhysicalDeviceHostImageCopyPropertiesEXT hostImageCopyProperties = {};
+        hostImageCopyProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
+
+        VkPhysicalDeviceProperties2 propertiesExt = {};
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &hostImageCopyProperties;
+        vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+
+        hostImageCopyDstLayouts_.resize(hostImageCopyProperties.copyDstLayoutCount);
+        hostImageCopyProperties.pCopySrcLayouts     = nullptr;
+        hostImageCopyProperties.copySrcLayoutCount  = 0;
+        hostImageCopyProperties.pCopyDstLayouts     = hostImageCopyDstLayouts_.data();
+        vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
+    }
+    #endif // /VK_EXT_host_image_copy
+}
 
 } // /namespace LLGL
 
@@ -30,8 +30,8 @@ class VKPhysicalDevice
 
         /* ----- Common ----- */
 
-        // Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance.
-        bool PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags = 0);
+        // Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance. Swap-chain support is not required if 'headless' is true.
+        bool PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags = 0, bool headless = false);
 
         // Loads the physical Vulkan device from a custom native handle.
         void LoadPhysicalDeviceWeakRef(VkPhysicalDevice physicalDevice);
@@ -42,13 +42,31 @@ class VKPhysicalDevice
             VKGraphicsPipelineLimits&   pipelineLimits
         );
 
-        VKDevice CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE);
+        /*
+        Creates the logical device. If 'enableTransferQueue' or 'enableComputeQueue' is true,
+        a dedicated transfer or compute queue is created as well if the device supports it.
+        */
+        VKDevice CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE, bool enableTransferQueue = false, bool enableComputeQueue = false);
 
         std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
 
         // Returns true if the specified Vulkan extension is supported by this physical device.
         bool SupportsExtension(const char* extension) const;
 
+        #ifdef VK_EXT_memory_budget
+
+        // Queries the current memory budget and usage of each memory heap. Returns false if VK_EXT_memory_budget is not supported.
+        bool QueryMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& outBudgetProps) const;
+
+        #endif // /VK_EXT_memory_budget
+
+        #ifdef VK_EXT_calibrated_timestamps
+
+        // Returns true if the specified time domain can be sampled with vkGetCalibratedTimestampsEXT. Returns false if VK_EXT_calibrated_timestamps is not supported.
+        bool SupportsCalibrateableTimeDomain(VkInstance instance, VkTimeDomainEXT timeDomain) const;
+
+        #endif // /VK_EXT_calibrated_timestamps
+
         /* ----- Handles ----- */
 
         // Returns the native VkPhysicalDevice handle.
@@ -81,6 +99,56 @@ class VKPhysicalDevice
             return memoryProperties_;
         }
 
+        #ifdef VK_EXT_descriptor_indexing
+
+        // Returns the descriptor indexing features of the physical device. All members are VK_FALSE if VK_EXT_descriptor_indexing is not supported.
+        inline const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& GetDescriptorIndexingFeatures() const
+        {
+            return descriptorIndexingFeatures_;
+        }
+
+        #endif // /VK_EXT_descriptor_indexing
+
+        #ifdef VK_EXT_graphics_pipeline_library
+
+        // Returns the graphics pipeline library features of the physical device. All members are VK_FALSE if VK_EXT_graphics_pipeline_library is not supported.
+        inline const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& GetGraphicsPipelineLibraryFeatures() const
+        {
+            return graphicsPipelineLibraryFeatures_;
+        }
+
+        #endif // /VK_EXT_graphics_pipeline_library
+
+        #ifdef VK_EXT_multi_draw
+
+        // Returns the multi draw properties of the physical device. The member 'maxMultiDrawCount' is 0 if VK_EXT_multi_draw is not supported.
+        inline const VkPhysicalDeviceMultiDrawPropertiesEXT& GetMultiDrawProperties() const
+        {
+            return multiDrawProperties_;
+        }
+
+        #endif // /VK_EXT_multi_draw
+
+        #ifdef VK_EXT_mesh_shader
+
+        // Returns the mesh shader features of the physical device. All members are VK_FALSE if VK_EXT_mesh_shader is not supported.
+        inline const VkPhysicalDeviceMeshShaderFeaturesEXT& GetMeshShaderFeatures() const
+        {
+            return meshShaderFeatures_;
+        }
+
+        #endif // /VK_EXT_mesh_shader
+
+        // Returns true if images with the specified parameters can be written by the host via VK_EXT_host_image_copy into the specified layout,
+        // and host transfer usage does not degrade device access performance. The usage flags must not include VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT.
+        bool SupportsOptimalHostImageCopy(
+            VkImageType         imageType,
+            VkFormat            format,
+            VkImageCreateFlags  createFlags,
+            VkImageUsageFlags   usageFlags,
+            VkImageLayout       dstLayout
+        ) const;
+
         // Returns the list of names of all supported and enabled extensions.
         inline const std::vector<const char*>& GetExtensionNames() const
         {
@@ -102,10 +170,14 @@ class VKPhysicalDevice
 
         bool EnableExtensions(const char** extensions, bool required = false);
 
+        // Returns false if the specified extension is supported but not its essential feature, in which case it must not be enabled.
+        bool IsExtensionFeatureSupported(const char* extension) const;
+
         void QueryDeviceInfo();
         void QueryDeviceFeaturesWithExtensions();
         void QueryDevicePropertiesWithExtensions();
         void QueryDeviceMemoryPropertiesWithExtensions();
+        void QueryExtensionFeatures();
 
     private:
 
@@ -122,6 +194,47 @@ class VKPhysicalDevice
 
         // Extension specific
         VkPhysicalDeviceConservativeRasterizationPropertiesEXT  conservRasterProps_         = {};
+        VkPhysicalDeviceMultiviewFeatures                       multiviewFeatures_          = {}; // Core since Vulkan 1.1
+        VkPhysicalDeviceMultiviewProperties                     multiviewProperties_        = {};
+        #ifdef VK_EXT_descriptor_indexing
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT           descriptorIndexingFeatures_ = {};
+        #endif
+        #ifdef VK_EXT_graphics_pipeline_library
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT      graphicsPipelineLibraryFeatures_ = {};
+        #endif
+        #ifdef VK_EXT_memory_priority
+        VkPhysicalDeviceMemoryPriorityFeaturesEXT               memoryPriorityFeatures_     = {};
+        #endif
+        #ifdef VK_EXT_pageable_device_local_memory
+        VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT    pageableDeviceLocalMemoryFeatures_ = {};
+        #endif
+        #ifdef VK_EXT_multi_draw
+        VkPhysicalDeviceMultiDrawFeaturesEXT                    multiDrawFeatures_          = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT                  multiDrawProperties_        = {};
+        #endif
+        #ifdef VK_EXT_mesh_shader
+        VkPhysicalDeviceMeshShaderFeaturesEXT                   meshShaderFeatures_         = {};
+        VkPhysicalDeviceMeshShaderPropertiesEXT                 meshShaderProperties_       = {};
+        #endif
+        #ifdef VK_KHR_present_id
+        VkPhysicalDevicePresentIdFeaturesKHR                    presentIdFeatures_          = {};
+        #endif
+        #ifdef VK_KHR_present_wait
+        VkPhysicalDevicePresentWaitFeaturesKHR                  presentWaitFeatures_        = {};
+        #endif
+        #ifdef VK_KHR_dynamic_rendering
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR             dynamicRenderingFeatures_   = {};
+        #endif
+        #ifdef VK_EXT_extended_dynamic_state
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT         extendedDynamicStateFeatures_ = {};
+        #endif
+        #ifdef VK_KHR_fragment_shading_rate
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR          fragmentShadingRateFeatures_ = {};
+        #endif
+        #ifdef VK_EXT_host_image_copy
+        VkPhysicalDeviceHostImageCopyFeaturesEXT                hostImageCopyFeatures_      = {};
+        std::vector<VkImageLayout>                              hostImageCopyDstLayouts_;
+        #endif
 
 };
 
@@ -12,10 +12,15 @@
 #include "Ext/VKExtensionRegistry.h"
 #include "Memory/VKDeviceMemory.h"
 #include "../RenderSystemUtils.h"
+#include "../MemoryInfoUtils.h"
 #include "../TextureUtils.h"
+#include "../BufferUtils.h"
 #include "../CheckedCast.h"
+#include "../PipelineStateUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/ImageUtils.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "VKInitializers.h"
@@ -24,7 +29,10 @@
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/ForRange.h>
 #include <limits>
+#include <algorithm>
+#include <string.h>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -33,9 +41,13 @@ namespace LLGL
 {
 
 
+// Default chunk size for the staging buffer pool used by VKRenderSystem::WriteBuffer
+static constexpr VkDeviceSize stagingBufferPoolChunkSize = (0xFFFF + 1);
+
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_          { vkDestroyInstance                                                },
-    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) }
+    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) },
+    headless_          { ((renderSystemDesc.flags & RenderSystemFlags::Headless   ) != 0) }
 {
     /* Extract optional renderer configuartion */
     auto* rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -53,6 +65,9 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         if (!PickPhysicalDevice(preferredDeviceFlags, customNativeHandle->physicalDevice))
             return;
         CreateLogicalDevice(customNativeHandle->device);
+
+        /* Create graphics PSOs as pipeline derivatives; graphics pipeline libraries are not supported for custom logical devices since their enabled features are unknown */
+        pipelineLibrary_ = MakeUnique<VKPipelineLibrary>(device_, false);
     }
     else
     {
@@ -63,7 +78,18 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         VKLoadInstanceExtensions(instance_);
         if (!PickPhysicalDevice(preferredDeviceFlags))
             return;
-        CreateLogicalDevice();
+        CreateLogicalDevice(
+            VK_NULL_HANDLE,
+            (rendererConfigVK != nullptr && rendererConfigVK->asyncTransferQueue),
+            (rendererConfigVK != nullptr && rendererConfigVK->asyncComputeQueue)
+        );
+
+        /* Enable bindless resource heaps; not supported for custom logical devices since their enabled features are unknown */
+        if (rendererConfigVK != nullptr && rendererConfigVK->bindlessResourceHeapCapacity > 0)
+            InitBindlessConfig(rendererConfigVK->bindlessResourceHeapCapacity);
+
+        /* Link graphics PSOs from shared pipeline libraries if supported, otherwise create them as pipeline derivatives */
+        pipelineLibrary_ = MakeUnique<VKPipelineLibrary>(device_, SupportsGraphicsPipelineLibrary());
     }
 
     /* Create default resources */
@@ -74,13 +100,77 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         device_,
         physicalDevice_.GetMemoryProperties(),
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
-        (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
+        (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false),
+        (rendererConfigVK != nullptr ? rendererConfigVK->deviceMemoryStrategy : VulkanDeviceMemoryStrategy::Default)
     );
+
+    /* Initialize staging buffer pool for transient buffer uploads */
+    stagingBufferPool_.InitializeDevice(deviceMemoryMngr_.get(), stagingBufferPoolChunkSize);
+
+    /* Create asynchronous upload queue if a dedicated transfer queue is available */
+    if (device_.GetVkTransferQueue() != VK_NULL_HANDLE)
+        transferQueue_ = MakeUnique<VKTransferQueue>(device_, *deviceMemoryMngr_);
+
+    /* Create queue for deferred resource releases if enabled */
+    if ((renderSystemDesc.flags & RenderSystemFlags::DeferredRelease) != 0)
+        deferredReleaseQueue_ = MakeUnique<VKDeferredReleaseQueue>(device_, device_.GetVkQueue());
+
+    /* Create per-thread command pools for transient command buffers */
+    commandPoolCache_ = MakeUnique<VKCommandPoolCache>(device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices().graphicsFamily);
+
+    /* Create ring of persistently mapped memory for transient buffers; its memory is only allocated with the first transient buffer */
+    const std::uint64_t transientBufferRingSize = (rendererConfigVK != nullptr ? rendererConfigVK->transientBufferRingSize : 4*1024*1024);
+    if (transientBufferRingSize > 0)
+    {
+        transientBufferRing_ = MakeUnique<VKTransientBufferRing>(
+            device_,
+            device_.GetVkQueue(),
+            *deviceMemoryMngr_,
+            static_cast<VkDeviceSize>(transientBufferRingSize)
+        );
+    }
+
+    /* Create command queue interface */
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(), transferQueue_.get(), deviceMemoryMngr_.get(), deferredReleaseQueue_.get());
+
+    /* Create asynchronous compute queue if a dedicated compute queue is available */
+    if (device_.GetVkComputeQueue() != VK_NULL_HANDLE)
+        computeCommandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkComputeQueue());
+
+    #if defined VK_EXT_calibrated_timestamps && (defined LLGL_OS_WIN32 || defined LLGL_OS_LINUX || defined LLGL_OS_ANDROID)
+    /* Enable calibrated timestamps if the device can sample the same clock as Timer::Tick */
+    #ifdef LLGL_OS_WIN32
+    constexpr VkTimeDomainEXT hostTimeDomain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+    #else
+    constexpr VkTimeDomainEXT hostTimeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+    #endif
+    if (physicalDevice_.SupportsCalibrateableTimeDomain(instance_, hostTimeDomain))
+        commandQueue_->EnableTimestampCalibration(hostTimeDomain, physicalDevice_.GetProperties().limits.timestampPeriod);
+    #endif // /VK_EXT_calibrated_timestamps
+
+    /* Create device memory defragmenter if a budget has been specified */
+    if (rendererConfigVK != nullptr && rendererConfigVK->deviceMemoryDefragmentationBudget > 0)
+    {
+        deviceMemoryDefrag_ = MakeUnique<VKDeviceMemoryDefragmenter>(
+            device_,
+            *deviceMemoryMngr_,
+            static_cast<VkDeviceSize>(rendererConfigVK->deviceMemoryDefragmentationBudget),
+            transferQueue_.get()
+        );
+    }
+
+    /* Map persistent pipeline cache file if specified */
+    if (renderSystemDesc.pipelineCacheFilename != nullptr)
+        persistentPipelineCache_ = MakeUnique<PersistentPipelineCache>(renderSystemDesc.pipelineCacheFilename, GetRendererInfo());
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
+    if (transferQueue_)
+        transferQueue_->WaitIdle();
     device_.WaitIdle();
+    if (deferredReleaseQueue_)
+        deferredReleaseQueue_->Flush();
     VKShaderModulePool::Get().Clear();
     VKPipelineLayout::ReleaseDefault();
 }
@@ -89,7 +179,21 @@ VKRenderSystem::~VKRenderSystem()
 
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface);
+    if (headless_)
+        LLGL_TRAP("cannot create Vulkan swap-chain for headless render system");
+
+    return swapChains_.emplace<VKSwapChain>(
+        instance_,
+        physicalDevice_,
+        device_,
+        *deviceMemoryMngr_,
+        deviceMemoryDefrag_.get(),
+        deferredReleaseQueue_.get(),
+        commandPoolCache_.get(),
+        transientBufferRing_.get(),
+        swapChainDesc,
+        surface
+    );
 }
 
 void VKRenderSystem::Release(SwapChain& swapChain)
@@ -104,11 +208,44 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    if (type == CommandQueueType::Compute && computeCommandQueue_)
+        return computeCommandQueue_.get();
+    else
+        return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), commandBufferDesc);
+    if (commandBufferDesc.queueType == CommandQueueType::Compute && computeCommandQueue_)
+    {
+        /* Record compute command buffers into their own pools; transient pools are paced by the swap-chains on the graphics queue */
+        return commandBuffers_.emplace<VKCommandBuffer>(
+            physicalDevice_,
+            device_,
+            *deviceMemoryMngr_,
+            device_.GetVkComputeQueue(),
+            device_.GetComputeQueueFamily(),
+            nullptr,
+            nullptr,
+            device_.GetQueueFamilyIndices(),
+            commandBufferDesc
+        );
+    }
+    return commandBuffers_.emplace<VKCommandBuffer>(
+        physicalDevice_,
+        device_,
+        *deviceMemoryMngr_,
+        device_.GetVkQueue(),
+        device_.GetQueueFamilyIndices().graphicsFamily,
+        transferQueue_.get(),
+        commandPoolCache_.get(),
+        device_.GetQueueFamilyIndices(),
+        commandBufferDesc
+    );
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -118,6 +255,29 @@ void VKRenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
+std::unique_ptr<VKDeviceMemory> VKRenderSystem::AllocateDirectBufferMemory(const BufferDescriptor& bufferDesc, const VkMemoryRequirements& requirements)
+{
+    if (IsReadbackBuffer(bufferDesc))
+    {
+        /* Readback buffers are written by copy commands and read by the CPU, so prefer host cached memory */
+        constexpr VkMemoryPropertyFlags readbackProperties = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        if (std::unique_ptr<VKDeviceMemory> deviceMemory = AllocateDirectMemory(requirements, readbackProperties | VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+            return deviceMemory;
+        return AllocateDirectMemory(requirements, readbackProperties);
+    }
+    else
+    {
+        /* Direct upload buffers are placed in video memory that is visible to the host, e.g. with resizable BAR */
+        constexpr VkMemoryPropertyFlags directUploadProperties =
+        (
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        );
+        return AllocateDirectMemory(requirements, directUploadProperties);
+    }
+}
+
 static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long cpuAccessFlags)
 {
     if ((cpuAccessFlags & CPUAccessFlags::Write) != 0)
@@ -128,8 +288,39 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long cpuAccessFlags)
 
 Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateBuffer");
+
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    /* Try to place transient buffers in the ring of persistently mapped memory that is recycled every frame */
+    if (transientBufferRing_ && (bufferDesc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc, device_.GetSharedQueueFamilies());
+        VkDeviceSize transientOffset = 0;
+        if (transientBufferRing_->Allocate(bufferVK->GetDeviceBuffer().GetRequirements(), transientOffset))
+        {
+            bufferVK->BindTransientMemory(device_, *transientBufferRing_, transientOffset);
+            if (initialData != nullptr)
+                CopyToWriteCombinedMemory(bufferVK->GetMappedData(), initialData, static_cast<std::size_t>(bufferDesc.size));
+            return bufferVK;
+        }
+        buffers_.erase(bufferVK);
+    }
+
+    /* Try to place readback and direct upload buffers in memory that is visible to the host; otherwise, fall back to regular device memory */
+    if (IsReadbackBuffer(bufferDesc) || (bufferDesc.miscFlags & MiscFlags::DirectUpload) != 0)
+    {
+        VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc, device_.GetSharedQueueFamilies());
+        if (std::unique_ptr<VKDeviceMemory> directMemory = AllocateDirectBufferMemory(bufferDesc, bufferVK->GetDeviceBuffer().GetRequirements()))
+        {
+            bufferVK->BindDirectMemory(device_, std::move(directMemory));
+            if (initialData != nullptr)
+                CopyToWriteCombinedMemory(bufferVK->GetMappedData(), initialData, static_cast<std::size_t>(bufferDesc.size));
+            return bufferVK;
+        }
+        buffers_.erase(bufferVK);
+    }
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -141,14 +332,7 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
     VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
 
     /* Create primary buffer object */
-    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
-
-    /* Allocate device memory */
-    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
-        bufferVK->GetDeviceBuffer().GetRequirements(),
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
-    bufferVK->BindMemoryRegion(device_, memoryRegion);
+    VKBuffer* bufferVK = CreateDeviceLocalBuffer(bufferDesc);
 
     /* Copy staging buffer into hardware buffer */
     device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), static_cast<VkDeviceSize>(bufferDesc.size));
@@ -167,19 +351,129 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
     return bufferVK;
 }
 
+// Maximum size (in bytes) of the staging buffer that is shared by the initial data of one batch in CreateBuffers and CreateTextures.
+static constexpr VkDeviceSize maxBatchStagingSize = 64ull * 1024ull * 1024ull;
+
+void VKRenderSystem::CreateBuffers(
+    std::uint32_t           numBuffers,
+    const BufferDescriptor* bufferDescs,
+    Buffer**                outBuffers,
+    const void* const *     initialData)
+{
+    LLGL_ASSERT(numBuffers == 0 || (bufferDescs != nullptr && outBuffers != nullptr));
+
+    struct PendingUpload
+    {
+        VKBuffer*       buffer;
+        const void*     data;
+        VkDeviceSize    size;
+        VkDeviceSize    stagingOffset;
+    };
+
+    std::vector<PendingUpload> pendingUploads;
+
+    for (std::uint32_t first = 0; first < numBuffers;)
+    {
+        /* Create buffers until their initial data exceeds the shared staging buffer */
+        VkDeviceSize stagingSize = 0;
+        pendingUploads.clear();
+
+        std::uint32_t i = first;
+        for (; i < numBuffers; ++i)
+        {
+            const BufferDescriptor& bufferDesc = bufferDescs[i];
+            const void* data = (initialData != nullptr ? initialData[i] : nullptr);
+
+            /* Buffers that are host visible or keep their staging buffer are created individually */
+            if (bufferDesc.cpuAccessFlags != 0 || (bufferDesc.miscFlags & (MiscFlags::DynamicUsage | MiscFlags::DirectUpload | MiscFlags::Transient)) != 0)
+            {
+                outBuffers[i] = CreateBuffer(bufferDesc, data);
+                continue;
+            }
+
+            RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
+
+            const VkDeviceSize dataSize = static_cast<VkDeviceSize>(bufferDesc.size);
+            if (data != nullptr && stagingSize > 0 && stagingSize + dataSize > maxBatchStagingSize)
+                break;
+
+            VKBuffer* bufferVK = CreateDeviceLocalBuffer(bufferDesc);
+            outBuffers[i] = bufferVK;
+
+            if (data != nullptr)
+            {
+                pendingUploads.push_back(PendingUpload{ bufferVK, data, dataSize, stagingSize });
+                stagingSize = GetAlignedSize<VkDeviceSize>(stagingSize + dataSize, 4);
+            }
+        }
+        first = i;
+
+        if (pendingUploads.empty())
+            continue;
+
+        /* Copy initial data of all buffers into a single staging buffer and upload it with a single command buffer */
+        VkBufferCreateInfo stagingCreateInfo;
+        BuildVkBufferCreateInfo(stagingCreateInfo, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+        VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
+
+        for (const PendingUpload& upload : pendingUploads)
+            device_.WriteBuffer(stagingBuffer, upload.data, upload.size, upload.stagingOffset);
+
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            for (const PendingUpload& upload : pendingUploads)
+                context_.CopyBuffer(stagingBuffer.GetVkBuffer(), upload.buffer->GetVkBuffer(), upload.size, upload.stagingOffset);
+        }
+        FlushCommandBuffer(cmdBuffer);
+
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+}
+
 BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
+
+    /* Buffer arrays store the native buffer handles, so these buffers can no longer be relocated */
+    if (deviceMemoryDefrag_)
+    {
+        for_range(i, numBuffers)
+        {
+            auto* bufferVK = LLGL_CAST(VKBuffer*, bufferArray[i]);
+            deviceMemoryDefrag_->UnregisterBuffer(&(bufferVK->GetDeviceBuffer()));
+        }
+    }
+
     return bufferArrays_.emplace<VKBufferArray>(numBuffers, bufferArray);
 }
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    /* Buffers that are released can no longer be relocated, even if their release is deferred */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    if (deviceMemoryDefrag_)
+        deviceMemoryDefrag_->UnregisterBuffer(&(bufferVK.GetDeviceBuffer()));
+
+    if (deferredReleaseQueue_)
+    {
+        deferredReleaseQueue_->Defer([this, &bufferVK]() { ReleaseBuffer(bufferVK); });
+        return;
+    }
+
+    ReleaseBuffer(bufferVK);
+}
+
+void VKRenderSystem::ReleaseBuffer(VKBuffer& bufferVK)
+{
+    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    if (VKDeviceMemory* directMemory = bufferVK.GetDirectMemory())
+        ReleaseDirectMemory(*directMemory);
     bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
-    buffers_.erase(&buffer);
+    buffers_.erase(&bufferVK);
 }
 
 void VKRenderSystem::Release(BufferArray& bufferArray)
@@ -191,31 +485,38 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const voi
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (bufferVK.IsDirectlyMapped())
+    {
+        /* Copy input data directly into persistently mapped device memory */
+        CopyToWriteCombinedMemory(bufferVK.GetMappedData() + offset, data, static_cast<std::size_t>(dataSize));
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy input data to staging buffer memory */
         device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
 
         /* Copy staging buffer into hardware buffer */
+        FlushPendingTransfers();
         device_.CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), dataSize, offset, offset);
     }
+    else if (transferQueue_)
+    {
+        /* Upload input data on dedicated transfer queue without waiting for completion */
+        transferQueue_->WriteBuffer(bufferVK, offset, data, dataSize);
+    }
     else
     {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            dataSize,
-            (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
-        );
-
-        VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, data, dataSize);
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
 
-        /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, offset);
+        /* Copy input data through persistently mapped staging pool into hardware buffer */
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            stagingBufferPool_.WriteStaged(cmdBuffer, bufferVK.GetVkBuffer(), offset, data, dataSize);
+        }
+        FlushCommandBuffer(cmdBuffer);
 
-        /* Release device memory region of staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Staging pool can be recycled immediately since the command buffer has been flushed synchronously */
+        stagingBufferPool_.Reset();
     }
 }
 
@@ -223,9 +524,15 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (bufferVK.IsDirectlyMapped())
+    {
+        /* Copy persistently mapped device memory to output data */
+        ::memcpy(data, bufferVK.GetMappedData() + offset, static_cast<std::size_t>(dataSize));
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy hardware buffer into staging buffer */
+        FlushPendingTransfers();
         device_.CopyBuffer(bufferVK.GetVkBuffer(), bufferVK.GetStagingVkBuffer(), dataSize, offset, offset);
 
         /* Copy staging buffer memory to output data */
@@ -244,6 +551,7 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
         VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
         /* Copy hardware buffer into staging buffer */
+        FlushPendingTransfers();
         device_.CopyBuffer(bufferVK.GetVkBuffer(), stagingBuffer.GetVkBuffer(), dataSize, offset, 0);
 
         /* Copy staging buffer memory to output data */
@@ -297,59 +605,26 @@ static VkImageLayout FindOptimalInitialVkImageLayout(Format format, long bindFla
 
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreateTexture");
+
     /* Determine size of image for staging buffer */
     const std::uint32_t imageSize       = NumMipTexels(textureDesc, 0);
     const std::size_t   initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
 
-    /* Set up initial image data */
-    const void* initialData = nullptr;
     DynamicByteArray intermediateData;
+    const void* initialData = GetInitialTextureData(textureDesc, initialImage, intermediateData);
 
-    if (initialImage != nullptr)
-    {
-        /* Check if image data must be converted */
-        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
-        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
-        {
-            /* Convert image format (will be null if no conversion is necessary) */
-            intermediateData = ConvertImageBuffer(*initialImage, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
-        }
+    /* Create device texture */
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, physicalDevice_, *deviceMemoryMngr_, textureDesc, device_.GetSharedQueueFamilies());
 
-        if (intermediateData)
-        {
-            /*
-            Validate that source image data was large enough so conversion is valid,
-            then use temporary image buffer as source for initial data
-            */
-            const std::size_t srcImageDataSize = GetMemoryFootprint(initialImage->format, initialImage->dataType, imageSize);
-            RenderSystem::AssertImageDataSize(initialImage->dataSize, srcImageDataSize);
-            initialData = intermediateData.get();
-        }
-        else
-        {
-            /*
-            Validate that image data is large enough,
-            then use input data as source for initial data
-            */
-            RenderSystem::AssertImageDataSize(initialImage->dataSize, initialDataSize);
-            initialData = initialImage->data;
-        }
-    }
-    else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0)
+    const bool generateMips = (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc));
+    if (InitializeTextureOnHost(*textureVK, initialData, generateMips))
     {
-        /* Allocate default image data */
-        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
-        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
-            intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
-        else
-            intermediateData = DynamicByteArray{ initialDataSize, UninitializeTag{} };
-
-        initialData = intermediateData.get();
+        /* Texture was initialized without staging buffer and command buffer, so only create its primary image view */
+        textureVK->CreateInternalImageView(device_);
+        return textureVK;
     }
 
-    /* Create device texture */
-    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
-
     if (initialData != nullptr)
     {
         /* Create staging buffer */
@@ -362,34 +637,12 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
         VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize);
 
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
         /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
         VkCommandBuffer cmdBuffer = AllocCommandBuffer();
         {
-            const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
-
-            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
-
-            context_.CopyBufferToImage(
-                stagingBuffer.GetVkBuffer(),
-                textureVK->GetVkImage(),
-                textureVK->GetVkFormat(),
-                VkOffset3D{ 0, 0, 0 },
-                textureVK->GetVkExtent(),
-                subresource
-            );
-
-            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
-
-            /* Generate MIP-maps if enabled */
-            if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
-            {
-                context_.GenerateMips(
-                    textureVK->GetVkImage(),
-                    textureVK->GetVkFormat(),
-                    textureVK->GetVkExtent(),
-                    subresource
-                );
-            }
+            RecordTextureUpload(*textureVK, stagingBuffer.GetVkBuffer(), 0, generateMips);
         }
         FlushCommandBuffer(cmdBuffer);
 
@@ -402,6 +655,8 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
         if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
         {
+            std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
             VkCommandBuffer cmdBuffer = AllocCommandBuffer();
             {
                 textureVK->TransitionImageLayout(context_, initialLayout, true);
@@ -416,12 +671,138 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     return textureVK;
 }
 
+void VKRenderSystem::CreateTextures(
+    std::uint32_t               numTextures,
+    const TextureDescriptor*    textureDescs,
+    Texture**                   outTextures,
+    const ImageView* const *    initialImages)
+{
+    LLGL_ASSERT(numTextures == 0 || (textureDescs != nullptr && outTextures != nullptr));
+
+    struct PendingTexture
+    {
+        VKTexture*          texture;
+        DynamicByteArray    intermediateData;
+        const void*         data;
+        VkDeviceSize        size;
+        VkDeviceSize        stagingOffset;
+        bool                generateMips;
+    };
+
+    std::vector<PendingTexture> pendingTextures;
+
+    for (std::uint32_t first = 0; first < numTextures;)
+    {
+        /* Create textures until their initial data exceeds the shared staging buffer */
+        VkDeviceSize stagingSize = 0;
+        pendingTextures.clear();
+
+        std::uint32_t i = first;
+        for (; i < numTextures; ++i)
+        {
+            const TextureDescriptor& textureDesc = textureDescs[i];
+            const ImageView* initialImage = (initialImages != nullptr ? initialImages[i] : nullptr);
+
+            const VkDeviceSize dataSize = static_cast<VkDeviceSize>(GetMemoryFootprint(textureDesc.format, NumMipTexels(textureDesc, 0)));
+            if (i > first && stagingSize + dataSize > maxBatchStagingSize)
+                break;
+
+            PendingTexture pending;
+            {
+                pending.data            = GetInitialTextureData(textureDesc, initialImage, pending.intermediateData);
+                pending.texture         = textures_.emplace<VKTexture>(device_, physicalDevice_, *deviceMemoryMngr_, textureDesc, device_.GetSharedQueueFamilies());
+                pending.generateMips    = (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc));
+            }
+            outTextures[i] = pending.texture;
+
+            /* Textures that are initialized on the host don't need any space in the staging buffer and are already in their initial layout */
+            if (InitializeTextureOnHost(*pending.texture, pending.data, pending.generateMips))
+            {
+                pending.data = nullptr;
+                pending.intermediateData.clear();
+            }
+            pending.size = (pending.data != nullptr ? dataSize : 0);
+
+            /* Buffer offsets of image copies must be a multiple of 4 and of the texel block size */
+            if (pending.data != nullptr)
+            {
+                const VkDeviceSize blockSize = std::max<VkDeviceSize>(1, GetFormatAttribs(textureDesc.format).bitSize / 8);
+                pending.stagingOffset   = GetAlignedSize<VkDeviceSize>(stagingSize, blockSize * 4);
+                stagingSize             = pending.stagingOffset + pending.size;
+            }
+            else
+                pending.stagingOffset   = 0;
+
+            pendingTextures.push_back(std::move(pending));
+        }
+        first = i;
+
+        /* Copy initial data of all textures into a single staging buffer */
+        VKDeviceBuffer stagingBuffer{ device_ };
+        if (stagingSize > 0)
+        {
+            VkBufferCreateInfo stagingCreateInfo;
+            BuildVkBufferCreateInfo(stagingCreateInfo, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+            stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
+
+            for (PendingTexture& pending : pendingTextures)
+            {
+                if (pending.data != nullptr)
+                {
+                    device_.WriteBuffer(stagingBuffer, pending.data, pending.size, pending.stagingOffset);
+                    pending.intermediateData.clear();
+                }
+            }
+        }
+
+        std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
+        /* Record uploads and initial layout transitions of all textures into a single command buffer */
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            for (const PendingTexture& pending : pendingTextures)
+            {
+                if (pending.data != nullptr)
+                    RecordTextureUpload(*pending.texture, stagingBuffer.GetVkBuffer(), pending.stagingOffset, pending.generateMips);
+                else
+                {
+                    const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(pending.texture->GetFormat(), pending.texture->GetBindFlags());
+                    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+                        pending.texture->TransitionImageLayout(context_, initialLayout, true);
+                }
+            }
+        }
+        FlushCommandBuffer(cmdBuffer);
+
+        if (stagingSize > 0)
+            stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+
+        /* Create primary image views for all textures */
+        for (const PendingTexture& pending : pendingTextures)
+            pending.texture->CreateInternalImageView(device_);
+    }
+}
+
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    if (deferredReleaseQueue_)
+    {
+        deferredReleaseQueue_->Defer([this, &textureVK]() { ReleaseTexture(textureVK); });
+        return;
+    }
+
+    ReleaseTexture(textureVK);
+}
+
+void VKRenderSystem::ReleaseTexture(VKTexture& textureVK)
+{
+    /* Release device memory region, then release texture object */
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
-    textures_.erase(&texture);
+    textureVK.ReleaseSparseTiles(*deviceMemoryMngr_);
+    textures_.erase(&textureVK);
 }
 
 void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
@@ -469,6 +850,39 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         imageData = srcImageView.data;
     }
 
+    if (transferQueue_ && textureVK.GetVkImageLayout() != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        /* Upload image data on dedicated transfer queue without waiting for completion */
+        transferQueue_->WriteTexture(
+            textureVK,
+            VkOffset3D{ offset.x, offset.y, offset.z },
+            VkExtent3D{ extent.x, extent.y, extent.z },
+            subresource,
+            imageData,
+            imageDataSize
+        );
+        return;
+    }
+
+    #ifdef VK_EXT_host_image_copy
+    if (textureVK.IsHostImageCopyEnabled() && textureVK.GetVkImageLayout() == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        /* Host image copies are not ordered with queue submissions, so wait for previous commands that might still sample this texture */
+        FlushPendingTransfers();
+        device_.WaitIdle();
+
+        /* Copy image data directly from host memory without staging buffer and command buffer */
+        textureVK.WriteOnHost(
+            device_,
+            imageData,
+            VkOffset3D{ offset.x, offset.y, offset.z },
+            VkExtent3D{ extent.x, extent.y, extent.z },
+            subresource
+        );
+        return;
+    }
+    #endif // /VK_EXT_host_image_copy
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -479,6 +893,8 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 
     VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, imageData, imageDataSize);
 
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
@@ -521,6 +937,8 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     BuildVkBufferCreateInfo(stagingCreateInfo, imageDataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
     VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
+    std::lock_guard<std::recursive_mutex> guard{ device_.GetCommandPoolMutex() };
+
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
@@ -561,7 +979,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<VKSampler>(device_, samplerDesc);
+    return samplers_.emplace<VKSampler>(device_, samplerPool_, samplerDesc);
 }
 
 void VKRenderSystem::Release(Sampler& sampler)
@@ -573,7 +991,7 @@ void VKRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* VKRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<VKResourceHeap>(device_, resourceHeapDesc, initialResourceViews);
+    return resourceHeaps_.emplace<VKResourceHeap>(device_, device_.GetVkQueue(), resourceHeapDesc, initialResourceViews);
 }
 
 void VKRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -616,7 +1034,7 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<VKShader>(device_, shaderDesc);
+    return shaders_.emplace<VKShader>(device_, shaderDesc, persistentPipelineCache_.get());
 }
 
 void VKRenderSystem::Release(Shader& shader)
@@ -628,7 +1046,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, samplerPool_, pipelineLayoutDesc, bindlessConfig_);
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -651,19 +1069,64 @@ void VKRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
+static void AppendShaderContentHashes(PersistentPipelineCacheKey& key, const ArrayView<Shader*>& shaders)
+{
+    for (Shader* shader : shaders)
+        key.Append(LLGL_CAST(VKShader*, shader)->GetContentHash());
+}
+
+static std::uint64_t GetPersistentPipelineCacheKey(const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    PersistentPipelineCacheKey key;
+    key.AppendDescriptor(pipelineStateDesc);
+    AppendShaderContentHashes(key, GetShadersAsArray(pipelineStateDesc));
+    return key.Get();
+}
+
+static std::uint64_t GetPersistentPipelineCacheKey(const ComputePipelineDescriptor& pipelineStateDesc)
+{
+    PersistentPipelineCacheKey key;
+    AppendShaderContentHashes(key, GetShadersAsArray(pipelineStateDesc));
+    return key.Get();
+}
+
 PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+    {
+        /* Create PSO with a transient pipeline cache that is initialized with the persistent cache entry, and store the updated entry afterwards */
+        const std::uint64_t key = GetPersistentPipelineCacheKey(pipelineStateDesc);
+        VKPipelineCache transientCache{ device_, persistentPipelineCache_->Find(key) };
+        PipelineState* pipelineState = CreatePipelineState(pipelineStateDesc, &transientCache);
+        persistentPipelineCache_->Store(key, transientCache.GetBlob());
+        return pipelineState;
+    }
+
     return pipelineStates_.emplace<VKGraphicsPSO>(
         device_,
         (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
         pipelineStateDesc,
         gfxPipelineLimits_,
-        pipelineCache
+        pipelineCache,
+        pipelineLibrary_.get()
     );
 }
 
 PipelineState* VKRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_CPU_PROFILE_SCOPE("RenderSystem::CreatePipelineState");
+
+    if (pipelineCache == nullptr && persistentPipelineCache_)
+    {
+        const std::uint64_t key = GetPersistentPipelineCacheKey(pipelineStateDesc);
+        VKPipelineCache transientCache{ device_, persistentPipelineCache_->Find(key) };
+        PipelineState* pipelineState = CreatePipelineState(pipelineStateDesc, &transientCache);
+        persistentPipelineCache_->Store(key, transientCache.GetBlob());
+        return pipelineState;
+    }
+
     return pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, pipelineCache);
 }
 
@@ -691,7 +1154,7 @@ void VKRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* VKRenderSystem::CreateFence()
 {
-    return fences_.emplace<VKFence>(device_);
+    return fences_.emplace<VKFence>(device_, HasExtension(VKExt::KHR_timeline_semaphore));
 }
 
 void VKRenderSystem::Release(Fence& fence)
@@ -714,6 +1177,38 @@ bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     return false;
 }
 
+bool VKRenderSystem::QueryMemoryInfo(MemoryInfo& outInfo)
+{
+    outInfo = {};
+    AccumulateMemoryInfo(outInfo, buffers_, textures_, swapChains_);
+    outInfo.stagingPools = stagingBufferPool_.GetTotalSize();
+
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+
+    #ifdef VK_EXT_memory_budget
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+    const bool hasMemoryBudget = physicalDevice_.QueryMemoryBudget(budgetProps);
+    #endif
+
+    for_range(i, std::min(memoryProperties.memoryHeapCount, LLGL_MAX_NUM_MEMORY_HEAPS))
+    {
+        const VkMemoryHeap& heap = memoryProperties.memoryHeaps[i];
+        const bool isDeviceLocal = ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+
+        #ifdef VK_EXT_memory_budget
+        if (hasMemoryBudget)
+        {
+            AppendMemoryHeapInfo(outInfo, isDeviceLocal, budgetProps.heapBudget[i], budgetProps.heapUsage[i]);
+            continue;
+        }
+        #endif
+
+        AppendMemoryHeapInfo(outInfo, isDeviceLocal, heap.size, 0);
+    }
+
+    return true;
+}
+
 
 /*
  * ======= Private: =======
@@ -750,7 +1245,8 @@ void VKRenderSystem::CreateInstance(const RendererConfigurationVulkan* config)
         (
             extSupport == VKExtSupport::Required ||
             extSupport == VKExtSupport::Optional ||
-            (this->debugLayerEnabled_ && extSupport == VKExtSupport::DebugOnly)
+            (this->debugLayerEnabled_ && extSupport == VKExtSupport::DebugOnly) ||
+            (!this->headless_ && extSupport == VKExtSupport::SurfaceOnly)
         );
     };
 
@@ -884,6 +1380,88 @@ void VKRenderSystem::CreateDebugReportCallback()
     VKThrowIfFailed(result, "failed to create Vulkan debug report callback");
 }
 
+static std::uint64_t GetVKDeviceLocalMemorySize(VkPhysicalDevice physicalDevice)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+    std::uint64_t size = 0;
+    for_range(i, memoryProperties.memoryHeapCount)
+    {
+        if ((memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+            size += memoryProperties.memoryHeaps[i].size;
+    }
+    return size;
+}
+
+bool VKRenderSystem::Probe(const RenderSystemDescriptor& renderSystemDesc, RenderSystemProbe& outProbe)
+{
+    /* Create minimal Vulkan instance without layers and surface extensions */
+    std::uint32_t instanceVersion = 0;
+    vkEnumerateInstanceVersion(&instanceVersion);
+    if (instanceVersion < VK_API_VERSION_1_0)
+        return false;
+
+    std::vector<const char*> extensionNames;
+    const std::vector<VkExtensionProperties> extensionProperties = VKQueryInstanceExtensionProperties();
+
+    for (const VkExtensionProperties& prop : extensionProperties)
+    {
+        const VKExtSupport extSupport = GetVulkanInstanceExtensionSupport(prop.extensionName);
+        if (extSupport == VKExtSupport::Required || extSupport == VKExtSupport::Optional)
+            extensionNames.push_back(prop.extensionName);
+    }
+
+    VkApplicationInfo appInfo = {};
+    {
+        appInfo.sType       = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        appInfo.apiVersion  = instanceVersion;
+    }
+    VkInstanceCreateInfo instanceInfo = {};
+    {
+        instanceInfo.sType                      = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceInfo.pApplicationInfo           = &appInfo;
+        instanceInfo.enabledExtensionCount      = static_cast<std::uint32_t>(extensionNames.size());
+        instanceInfo.ppEnabledExtensionNames    = (extensionNames.empty() ? nullptr : extensionNames.data());
+    }
+    VKPtr<VkInstance> instance{ vkDestroyInstance };
+    if (vkCreateInstance(&instanceInfo, nullptr, instance.ReleaseAndGetAddressOf()) != VK_SUCCESS)
+        return false;
+
+    /* Enumerate all physical devices as adapters */
+    outProbe.adapters.clear();
+    for (VkPhysicalDevice physicalDevice : VKQueryPhysicalDevices(instance))
+    {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+        RenderSystemAdapterInfo adapter;
+        {
+            adapter.name        = properties.deviceName;
+            adapter.vendorName  = GetVendorName(GetVendorByID(properties.vendorID));
+            adapter.videoMemory = GetVKDeviceLocalMemorySize(physicalDevice);
+        }
+        outProbe.adapters.push_back(std::move(adapter));
+    }
+
+    /* Pick the same physical device as the render system would and query its capabilities */
+    constexpr long preferredDeviceMask = (RenderSystemFlags::PreferNVIDIA | RenderSystemFlags::PreferAMD | RenderSystemFlags::PreferIntel);
+    const long preferredDeviceFlags = (renderSystemDesc.flags & preferredDeviceMask);
+    const bool headless = ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0);
+
+    VKPhysicalDevice physicalDevice;
+    if (!physicalDevice.PickPhysicalDevice(instance, preferredDeviceFlags, headless))
+        return false;
+
+    VKGraphicsPipelineLimits gfxPipelineLimits;
+    physicalDevice.QueryDeviceProperties(outProbe.info, outProbe.caps, gfxPipelineLimits);
+
+    const auto& extensions = physicalDevice.GetExtensionNames();
+    outProbe.info.extensionNames = std::vector<std::string>(extensions.begin(), extensions.end());
+
+    return true;
+}
+
 bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDevice customPhysicalDevice)
 {
     /* Pick physical device with Vulkan support */
@@ -892,7 +1470,7 @@ bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDev
         /* Load weak reference to custom native physical device */
         physicalDevice_.LoadPhysicalDeviceWeakRef(customPhysicalDevice);
     }
-    else if (!physicalDevice_.PickPhysicalDevice(instance_, preferredDeviceFlags))
+    else if (!physicalDevice_.PickPhysicalDevice(instance_, preferredDeviceFlags, headless_))
     {
         GetMutableReport().Errorf("failed to find suitable Vulkan device");
         return false;
@@ -914,18 +1492,55 @@ bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDev
     return true;
 }
 
-void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
+void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice, bool enableTransferQueue, bool enableComputeQueue)
 {
     /* Create logical device with all supported physical device feature */
-    device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice);
-
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
+    device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice, enableTransferQueue, enableComputeQueue);
 
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
 }
 
+void VKRenderSystem::InitBindlessConfig(std::uint32_t capacity)
+{
+    #ifdef VK_EXT_descriptor_indexing
+
+    if (!HasExtension(VKExt::EXT_descriptor_indexing))
+        return;
+
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& features = physicalDevice_.GetDescriptorIndexingFeatures();
+    if (!features.descriptorBindingPartiallyBound)
+        return;
+
+    bindlessConfig_.capacity = capacity;
+
+    /* Gather descriptor types that support update-after-bind */
+    auto EnableUpdateAfterBind = [this](VkBool32 supported, VkDescriptorType type)
+    {
+        if (supported)
+            bindlessConfig_.updateAfterBindTypes |= (1u << type);
+    };
+
+    EnableUpdateAfterBind(features.descriptorBindingSampledImageUpdateAfterBind,   VK_DESCRIPTOR_TYPE_SAMPLER       );
+    EnableUpdateAfterBind(features.descriptorBindingSampledImageUpdateAfterBind,   VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE );
+    EnableUpdateAfterBind(features.descriptorBindingStorageImageUpdateAfterBind,   VK_DESCRIPTOR_TYPE_STORAGE_IMAGE );
+    EnableUpdateAfterBind(features.descriptorBindingUniformBufferUpdateAfterBind,  VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    EnableUpdateAfterBind(features.descriptorBindingStorageBufferUpdateAfterBind,  VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    bindlessConfig_.updateUnusedWhilePending = (features.descriptorBindingUpdateUnusedWhilePending != VK_FALSE);
+
+    #endif // /VK_EXT_descriptor_indexing
+}
+
+bool VKRenderSystem::SupportsGraphicsPipelineLibrary() const
+{
+    #ifdef VK_EXT_graphics_pipeline_library
+    if (HasExtension(VKExt::KHR_pipeline_library) && HasExtension(VKExt::EXT_graphics_pipeline_library))
+        return (physicalDevice_.GetGraphicsPipelineLibraryFeatures().graphicsPipelineLibrary != VK_FALSE);
+    #endif
+    return false;
+}
+
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
 {
     if (config != nullptr)
@@ -972,6 +1587,204 @@ VKDeviceBuffer VKRenderSystem::CreateStagingBufferAndInitialize(
     return stagingBuffer;
 }
 
+// Returns the index of the first memory type that matches the specified bits and properties, just like the device memory manager selects it.
+static bool FindDirectMemoryType(
+    const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    std::uint32_t                           memoryTypeBits,
+    VkMemoryPropertyFlags                   properties,
+    std::uint32_t&                          outMemoryTypeIndex)
+{
+    for_range(i, memoryProperties.memoryTypeCount)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+        {
+            outMemoryTypeIndex = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<VKDeviceMemory> VKRenderSystem::AllocateDirectMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties)
+{
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+    std::uint32_t memoryTypeIndex = 0;
+    if (!FindDirectMemoryType(memoryProperties, requirements.memoryTypeBits, properties, memoryTypeIndex))
+        return nullptr;
+
+    /* Check budget of the memory heap, since host visible video memory is often limited without resizable BAR */
+    const std::uint32_t heapIndex = memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+
+    std::lock_guard<std::mutex> guard{ directMemoryMutex_ };
+
+    #ifdef VK_EXT_memory_budget
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+    if (physicalDevice_.QueryMemoryBudget(budgetProps))
+    {
+        if (budgetProps.heapUsage[heapIndex] + requirements.size > budgetProps.heapBudget[heapIndex])
+            return nullptr;
+    }
+    else
+    #endif // /VK_EXT_memory_budget
+    {
+        /* Without memory budget, only use up to half of the heap for directly mapped buffers */
+        if (directMemoryUsage_[heapIndex] + requirements.size > memoryProperties.memoryHeaps[heapIndex].size / 2)
+            return nullptr;
+    }
+
+    std::unique_ptr<VKDeviceMemory> deviceMemory = deviceMemoryMngr_->AllocateDedicatedChunk(requirements, properties);
+    directMemoryUsage_[heapIndex] += deviceMemory->GetSize();
+    return deviceMemory;
+}
+
+void VKRenderSystem::ReleaseDirectMemory(const VKDeviceMemory& deviceMemory)
+{
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+    const std::uint32_t heapIndex = memoryProperties.memoryTypes[deviceMemory.GetMemoryTypeIndex()].heapIndex;
+    std::lock_guard<std::mutex> guard{ directMemoryMutex_ };
+    directMemoryUsage_[heapIndex] -= deviceMemory.GetSize();
+}
+
+VKBuffer* VKRenderSystem::CreateDeviceLocalBuffer(const BufferDescriptor& bufferDesc)
+{
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc, device_.GetSharedQueueFamilies());
+
+    /* Allocate device memory */
+    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
+        bufferVK->GetDeviceBuffer().GetRequirements(),
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+    bufferVK->BindMemoryRegion(device_, memoryRegion);
+
+    /* Only buffers that are not referenced by descriptor sets can be relocated by the defragmenter */
+    if (deviceMemoryDefrag_ && (bufferDesc.bindFlags & (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage)) == 0)
+        deviceMemoryDefrag_->RegisterBuffer(&(bufferVK->GetDeviceBuffer()));
+
+    return bufferVK;
+}
+
+const void* VKRenderSystem::GetInitialTextureData(const TextureDescriptor& textureDesc, const ImageView* initialImage, DynamicByteArray& intermediateData)
+{
+    const std::uint32_t imageSize       = NumMipTexels(textureDesc, 0);
+    const std::size_t   initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
+
+    /*
+    Set up initial image data; memoryless textures cannot be initialized as they only support attachment usage,
+    and sparse textures have no device memory committed until their tiles are mapped
+    */
+    const void* initialData = nullptr;
+
+    const bool skipInitialData = ((textureDesc.miscFlags & (MiscFlags::Memoryless | MiscFlags::Sparse)) != 0);
+
+    if (initialImage != nullptr && !skipInitialData)
+    {
+        /* Check if image data must be converted */
+        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
+        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
+        {
+            /* Convert image format (will be null if no conversion is necessary) */
+            intermediateData = ConvertImageBuffer(*initialImage, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
+        }
+
+        if (intermediateData)
+        {
+            /*
+            Validate that source image data was large enough so conversion is valid,
+            then use temporary image buffer as source for initial data
+            */
+            const std::size_t srcImageDataSize = GetMemoryFootprint(initialImage->format, initialImage->dataType, imageSize);
+            RenderSystem::AssertImageDataSize(initialImage->dataSize, srcImageDataSize);
+            initialData = intermediateData.get();
+        }
+        else
+        {
+            /*
+            Validate that image data is large enough,
+            then use input data as source for initial data
+            */
+            RenderSystem::AssertImageDataSize(initialImage->dataSize, initialDataSize);
+            initialData = initialImage->data;
+        }
+    }
+    else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0 && !skipInitialData)
+    {
+        /* Allocate default image data */
+        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
+        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
+            intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
+        else
+            intermediateData = DynamicByteArray{ initialDataSize, UninitializeTag{} };
+
+        initialData = intermediateData.get();
+    }
+
+
+    return initialData;
+}
+
+void VKRenderSystem::RecordTextureUpload(VKTexture& textureVK, VkBuffer srcBuffer, VkDeviceSize srcOffset, bool generateMips)
+{
+    const TextureSubresource subresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() };
+
+    textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
+
+    context_.CopyBufferToImage(
+        srcBuffer,
+        textureVK.GetVkImage(),
+        textureVK.GetVkFormat(),
+        VkOffset3D{ 0, 0, 0 },
+        textureVK.GetVkExtent(),
+        subresource,
+        srcOffset
+    );
+
+    textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
+
+    /* Generate MIP-maps if enabled */
+    if (generateMips)
+    {
+        context_.GenerateMips(
+            textureVK.GetVkImage(),
+            textureVK.GetVkFormat(),
+            textureVK.GetVkExtent(),
+            subresource
+        );
+    }
+}
+
+bool VKRenderSystem::InitializeTextureOnHost(VKTexture& textureVK, const void* initialData, bool generateMips)
+{
+    #ifdef VK_EXT_host_image_copy
+
+    /* MIP-map generation requires blit commands */
+    if (!textureVK.IsHostImageCopyEnabled() || generateMips)
+        return false;
+
+    /* Host image copy is only enabled for textures whose upload ends in shader-read-only layout, so other initial layouts must be set with a command buffer */
+    if (initialData == nullptr &&
+        FindOptimalInitialVkImageLayout(textureVK.GetFormat(), textureVK.GetBindFlags()) != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        return false;
+    }
+
+    /* New image cannot be in use by the device yet, so it can be written by the host immediately */
+    textureVK.TransitionImageLayoutOnHost(device_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    if (initialData != nullptr)
+    {
+        const TextureSubresource subresource{ 0, textureVK.GetNumArrayLayers(), 0, 1 };
+        textureVK.WriteOnHost(device_, initialData, VkOffset3D{ 0, 0, 0 }, textureVK.GetVkExtent(), subresource);
+    }
+
+    return true;
+
+    #else // VK_EXT_host_image_copy
+
+    return false;
+
+    #endif // /VK_EXT_host_image_copy
+}
+
 VkCommandBuffer VKRenderSystem::AllocCommandBuffer(bool begin)
 {
     VkCommandBuffer cmdBuffer = device_.AllocCommandBuffer(begin);
@@ -981,9 +1794,16 @@ VkCommandBuffer VKRenderSystem::AllocCommandBuffer(bool begin)
 
 void VKRenderSystem::FlushCommandBuffer(VkCommandBuffer commandBuffer)
 {
+    FlushPendingTransfers();
     device_.FlushCommandBuffer(commandBuffer);
 }
 
+void VKRenderSystem::FlushPendingTransfers()
+{
+    if (transferQueue_)
+        transferQueue_->FlushPendingAcquires();
+}
+
 
 } // /namespace LLGL
 
@@ -13,15 +13,22 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../PersistentPipelineCache.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKDeviceMemoryDefragmenter.h"
+#include "Memory/VKTransientBufferRing.h"
 
 #include "Command/VKCommandQueue.h"
 #include "Command/VKCommandBuffer.h"
 #include "Command/VKCommandContext.h"
+#include "Command/VKTransferQueue.h"
+#include "Command/VKDeferredReleaseQueue.h"
+#include "Command/VKCommandPoolCache.h"
 #include "VKSwapChain.h"
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKStagingBufferPool.h"
 
 #include "Shader/VKShader.h"
 
@@ -34,11 +41,13 @@
 #include "RenderState/VKRenderPass.h"
 #include "RenderState/VKPipelineLayout.h"
 #include "RenderState/VKPipelineCache.h"
+#include "RenderState/VKPipelineLibrary.h"
 #include "RenderState/VKGraphicsPSO.h"
 #include "RenderState/VKResourceHeap.h"
 
 #include <string>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 #include <tuple>
@@ -60,15 +69,45 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+        /*
+        Queries all physical devices and the capabilities of the device that would be picked for the specified descriptor.
+        This only creates a temporary Vulkan instance without any layers or surface extensions and no logical device.
+        */
+        static bool Probe(const RenderSystemDescriptor& renderSystemDesc, RenderSystemProbe& outProbe);
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
+        bool QueryMemoryInfo(MemoryInfo& outInfo) override;
+
+        void CreateBuffers(
+            std::uint32_t           numBuffers,
+            const BufferDescriptor* bufferDescs,
+            Buffer**                outBuffers,
+            const void* const *     initialData
+        ) override;
+
+        void CreateTextures(
+            std::uint32_t               numTextures,
+            const TextureDescriptor*    textureDescs,
+            Texture**                   outTextures,
+            const ImageView* const *    initialImages
+        ) override;
+
     private:
 
         void CreateInstance(const RendererConfigurationVulkan* config);
         void CreateDebugReportCallback();
         bool PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDevice customPhysicalDevice = VK_NULL_HANDLE);
-        void CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE);
+        void CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE, bool enableTransferQueue = false, bool enableComputeQueue = false);
 
         bool IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const;
 
+        // Initializes the bindless configuration for pipeline layouts if the device supports descriptor indexing.
+        void InitBindlessConfig(std::uint32_t capacity);
+
+        // Returns true if graphics PSOs can be linked from graphics pipeline libraries.
+        bool SupportsGraphicsPipelineLibrary() const;
+
         VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo);
 
         VKDeviceBuffer CreateStagingBufferAndInitialize(
@@ -77,9 +116,40 @@ class VKRenderSystem final : public RenderSystem
             VkDeviceSize                dataSize
         );
 
+        // Allocates dedicated host visible memory for a readback buffer or a buffer with MiscFlags::DirectUpload, or returns null if no such memory is available within the budget.
+        std::unique_ptr<VKDeviceMemory> AllocateDirectBufferMemory(const BufferDescriptor& bufferDesc, const VkMemoryRequirements& requirements);
+
+        // Allocates dedicated device memory with the specified properties for directly mapped buffers, or returns null if no such memory is available within the budget of its heap.
+        std::unique_ptr<VKDeviceMemory> AllocateDirectMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties);
+
+        // Removes the specified device memory of a directly mapped buffer from the budget accounting.
+        void ReleaseDirectMemory(const VKDeviceMemory& deviceMemory);
+
+        // Releases the device memory and the object of the specified buffer immediately.
+        void ReleaseBuffer(VKBuffer& bufferVK);
+
+        // Releases the device memory and the object of the specified texture immediately.
+        void ReleaseTexture(VKTexture& textureVK);
+
+        // Creates a buffer in device local memory without initial data.
+        VKBuffer* CreateDeviceLocalBuffer(const BufferDescriptor& bufferDesc);
+
+        // Returns the initial image data for the specified texture, which is either the input image, a converted copy, or the default image stored in 'intermediateData'. Returns null if the texture must not be initialized.
+        const void* GetInitialTextureData(const TextureDescriptor& textureDesc, const ImageView* initialImage, DynamicByteArray& intermediateData);
+
+        // Records the upload of the first MIP-map from the source buffer into the texture and transitions the texture into sampling-ready state.
+        void RecordTextureUpload(VKTexture& textureVK, VkBuffer srcBuffer, VkDeviceSize srcOffset, bool generateMips);
+
+        // Writes the first MIP-map of the specified texture and transitions it into its initial layout on the host via VK_EXT_host_image_copy.
+        // Returns false if the texture cannot be initialized on the host, in which case it must be initialized with a command buffer.
+        bool InitializeTextureOnHost(VKTexture& textureVK, const void* initialData, bool generateMips);
+
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer commandBuffer);
 
+        // Submits pending queue ownership acquisitions of asynchronous uploads before any synchronous graphics queue operation.
+        void FlushPendingTransfers();
+
     private:
 
         /* ----- Common objects ----- */
@@ -91,9 +161,22 @@ class VKRenderSystem final : public RenderSystem
         VKCommandContext                        context_;
 
         bool                                    debugLayerEnabled_      = false;
+        bool                                    headless_               = false; // No surface extensions and no swap-chains.
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        VKStagingBufferPool                     stagingBufferPool_;
+        std::unique_ptr<VKDeviceMemoryDefragmenter> deviceMemoryDefrag_;
+        VkDeviceSize                            directMemoryUsage_[VK_MAX_MEMORY_HEAPS] = {}; // Memory of directly mapped buffers per heap
+        std::mutex                              directMemoryMutex_;
+        std::unique_ptr<VKTransferQueue>        transferQueue_;
+        std::unique_ptr<VKDeferredReleaseQueue> deferredReleaseQueue_;  // Only created with RenderSystemFlags::DeferredRelease
+        std::unique_ptr<VKCommandPoolCache>     commandPoolCache_;      // Per-thread command pools for transient command buffers
+        std::unique_ptr<VKTransientBufferRing>  transientBufferRing_;   // Only created with RendererConfigurationVulkan::transientBufferRingSize
+        VKBindlessConfig                        bindlessConfig_;
+        std::unique_ptr<VKPipelineLibrary>      pipelineLibrary_;
+        std::unique_ptr<PersistentPipelineCache> persistentPipelineCache_;
+        VKSamplerPool                           samplerPool_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
@@ -101,6 +184,7 @@ class VKRenderSystem final : public RenderSystem
 
         HWObjectContainer<VKSwapChain>          swapChains_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
+        HWObjectInstance<VKCommandQueue>        computeCommandQueue_;   // Only created with RendererConfigurationVulkan::asyncComputeQueue
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
         HWObjectContainer<VKBuffer>             buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
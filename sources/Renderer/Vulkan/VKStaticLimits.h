@@ -12,6 +12,9 @@
 // Maximum number of Vulkan shader stages per pipeline state object (PSO).
 #define LLGL_VK_MAX_NUM_PSO_SHADER_STAGES (5u)
 
+// Maximum number of dynamic descriptors that are bound with push descriptors. This is the minimum value of 'maxPushDescriptors' guaranteed by VK_KHR_push_descriptor.
+#define LLGL_VK_MAX_NUM_PUSH_DESCRIPTORS (32u)
+
 
 #endif
 
@@ -8,12 +8,18 @@
 #include "VKSwapChain.h"
 #include "VKCore.h"
 #include "VKTypes.h"
+#include "Ext/VKExtensions.h"
+#include "Ext/VKExtensionRegistry.h"
 #include "Command/VKCommandContext.h"
+#include "Command/VKCommandPoolCache.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKDeviceMemoryDefragmenter.h"
+#include "Memory/VKTransientBufferRing.h"
 #include "Texture/VKImageUtils.h"
 #include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
+#include "../../Core/CPUProfilerUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
@@ -27,6 +33,7 @@ namespace LLGL
 /* ----- Common ----- */
 
 const std::uint32_t VKSwapChain::maxNumColorBuffers;
+const std::uint32_t VKSwapChain::maxNumFramesInFlight;
 
 static VKPtr<VkImageView> NullVkImageView(VkDevice device)
 {
@@ -48,11 +55,21 @@ static VKPtr<VkFence> NullVkFence(VkDevice device)
     return VKPtr<VkFence>{ device, vkDestroyFence };
 }
 
+// Returns true if the specified surface transform swaps the width and height of the swap-chain images.
+static bool IsSurfaceTransformTransposed(VkSurfaceTransformFlagBitsKHR transform)
+{
+    return (transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR);
+}
+
 VKSwapChain::VKSwapChain(
     VkInstance                      instance,
     VkPhysicalDevice                physicalDevice,
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
+    VKDeviceMemoryDefragmenter*     deviceMemoryDefrag,
+    VKDeferredReleaseQueue*         deferredReleaseQueue,
+    VKCommandPoolCache*             commandPoolCache,
+    VKTransientBufferRing*          transientBufferRing,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface)
 :
@@ -61,6 +78,10 @@ VKSwapChain::VKSwapChain(
     physicalDevice_          { physicalDevice                  },
     device_                  { device                          },
     deviceMemoryMngr_        { deviceMemoryMngr                },
+    deviceMemoryDefrag_      { deviceMemoryDefrag              },
+    deferredReleaseQueue_    { deferredReleaseQueue            },
+    commandPoolCache_        { commandPoolCache                },
+    transientBufferRing_     { transientBufferRing             },
     surface_                 { instance, vkDestroySurfaceKHR   },
     swapChain_               { device, vkDestroySwapchainKHR   },
     swapChainRenderPass_     { device                          },
@@ -71,6 +92,12 @@ VKSwapChain::VKSwapChain(
     swapChainFramebuffers_   { NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_)      },
+    numFramesInFlight_       { (desc.framesInFlight > 0 ? std::min(desc.framesInFlight, maxNumFramesInFlight) : maxNumFramesInFlight) },
+    maxFrameLatency_         { (desc.lowLatency ? (desc.framesInFlight > 0 ? numFramesInFlight_ : 1u) : 0u) },
+    presentMode_             { desc.presentMode               },
+    deferredAcquire_         { desc.deferredAcquire           },
+    discardDepthStencil_     { desc.discardDepthStencil       },
+    preRotation_             { desc.preRotation               },
     secondaryRenderPass_     { device                          },
     depthStencilBuffer_      { device                          },
     colorBuffers_            { device, device, device          },
@@ -82,10 +109,14 @@ VKSwapChain::VKSwapChain(
                                NullVkSemaphore(device_)        },
     inFlightFences_          { NullVkFence(device_),
                                NullVkFence(device_),
-                               NullVkFence(device_)            }
+                               NullVkFence(device_)            },
+    frameTimelineSemaphore_  { NullVkSemaphore(device_)        }
 {
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
 
+    /* Wait for the presentation engine in low-latency mode if supported, otherwise only for the GPU */
+    presentWaitEnabled_ = (maxFrameLatency_ > 0 && HasExtension(VKExt::KHR_present_id) && HasExtension(VKExt::KHR_present_wait));
+
     CreatePresentSemaphoresAndFences();
     CreateGpuSurface();
 
@@ -100,6 +131,20 @@ VKSwapChain::VKSwapChain(
 
 void VKSwapChain::Present()
 {
+    PresentWithDamage(0, nullptr);
+}
+
+void VKSwapChain::PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects)
+{
+    LLGL_CPU_PROFILE_SCOPE("SwapChain::Present");
+
+    /* Ignore presentation while the swap-chain is detached from its surface */
+    if (swapChain_.Get() == VK_NULL_HANDLE)
+        return;
+
+    /* Swap-chain images must be acquired before they can be presented */
+    AcquirePendingColorBuffer();
+
     /* Initialize semaphores */
     VkSemaphore waitSemaphores[] = { imageAvailableSemaphore_[currentFrameInFlight_] };
     VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
@@ -118,7 +163,37 @@ void VKSwapChain::Present()
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores    = signalSemaphores;
     }
-    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
+
+    VkResult result = VK_SUCCESS;
+
+    #ifdef VK_KHR_timeline_semaphore
+    if (frameTimelineSemaphore_.Get() != VK_NULL_HANDLE)
+    {
+        /* Signal binary semaphore for presentation and next frame value on the timeline semaphore (value for binary semaphore is ignored) */
+        const VkSemaphore   timelineSignalSemaphores[]  = { signalSemaphores[0], frameTimelineSemaphore_ };
+        const std::uint64_t timelineSignalValues[]      = { 0, ++frameTimelineCounter_ };
+
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = 0;
+            timelineInfo.pWaitSemaphoreValues       = nullptr;
+            timelineInfo.signalSemaphoreValueCount  = 2;
+            timelineInfo.pSignalSemaphoreValues     = timelineSignalValues;
+        }
+        submitInfo.pNext                = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 2;
+        submitInfo.pSignalSemaphores    = timelineSignalSemaphores;
+
+        frameTimelineValues_[currentFrameInFlight_] = frameTimelineCounter_;
+        result = VKQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+    }
+    else
+    #endif // /VK_KHR_timeline_semaphore
+    {
+        result = VKQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
+    }
     VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 
     /* Present result on screen */
@@ -133,15 +208,76 @@ void VKSwapChain::Present()
         presentInfo.pImageIndices       = &currentColorBuffer_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+
+    #ifdef VK_KHR_present_id
+    /* Tag present with a monotonically increasing ID, so WaitForNextFrame can wait for it */
+    VkPresentIdKHR presentId;
+    if (presentWaitEnabled_)
+    {
+        ++presentIdCounter_;
+        presentId.sType             = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentId.pNext             = nullptr;
+        presentId.swapchainCount    = 1;
+        presentId.pPresentIds       = &presentIdCounter_;
+        presentInfo.pNext           = &presentId;
+    }
+    #endif // /VK_KHR_present_id
+
+    #ifdef VK_KHR_incremental_present
+    /* Only present damaged regions of the current image; rectangles are transformed into the orientation of pre-rotated images */
+    VkPresentRegionKHR  presentRegion;
+    VkPresentRegionsKHR presentRegions;
+    if (numDamageRects > 0 && damageRects != nullptr && HasExtension(VKExt::KHR_incremental_present))
+    {
+        damageRectsVK_.resize(numDamageRects);
+        for_range(i, numDamageRects)
+        {
+            VkRect2D rect;
+            VKTypes::Convert(rect, damageRects[i]);
+            if (IsPreRotated())
+                TransformScissor(rect);
+            damageRectsVK_[i].offset    = rect.offset;
+            damageRectsVK_[i].extent    = rect.extent;
+            damageRectsVK_[i].layer     = 0;
+        }
+
+        presentRegion.rectangleCount    = numDamageRects;
+        presentRegion.pRectangles       = damageRectsVK_.data();
+
+        presentRegions.sType            = VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR;
+        presentRegions.pNext            = presentInfo.pNext;
+        presentRegions.swapchainCount   = 1;
+        presentRegions.pRegions         = &presentRegion;
+        presentInfo.pNext               = &presentRegions;
+    }
+    #endif // /VK_KHR_incremental_present
+
+    result = VKQueuePresentKHR(presentQueue_, &presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
+    /* Relocate the next batch of device memory allocations at the end of each frame */
+    if (deviceMemoryDefrag_ != nullptr)
+        deviceMemoryDefrag_->NextStep();
+
+    /* Destroy resources whose release has been deferred until all frames that might use them have completed */
+    if (deferredReleaseQueue_ != nullptr)
+        deferredReleaseQueue_->NextFrame();
+
+    /* Recycle command pools of transient command buffers once the next frame has completed */
+    if (commandPoolCache_ != nullptr)
+        commandPoolCache_->NextFrame();
+
+    /* Recycle memory of transient buffers once all frames that might use them have completed */
+    if (transientBufferRing_ != nullptr)
+        transientBufferRing_->NextFrame();
+
     /* Move to next frame */
     AcquireNextColorBuffer();
 }
 
 std::uint32_t VKSwapChain::GetCurrentSwapIndex() const
 {
+    AcquirePendingColorBuffer();
     return currentColorBuffer_;
 }
 
@@ -183,12 +319,55 @@ bool VKSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return true;
 }
 
+bool VKSwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    if (maxFrameLatency_ == 0)
+        return true;
+
+    #ifdef VK_KHR_present_wait
+    if (presentWaitEnabled_)
+    {
+        /* Wait until no more than (maxFrameLatency - 1) presents of the current swap-chain are pending */
+        if (presentIdCounter_ + 1 < firstPresentId_ + maxFrameLatency_)
+            return true;
+        VkResult result = vkWaitForPresentKHR(device_, swapChain_, presentIdCounter_ + 1 - maxFrameLatency_, timeout);
+        return (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR);
+    }
+    #endif // /VK_KHR_present_wait
+
+    #ifdef VK_KHR_timeline_semaphore
+    if (frameTimelineSemaphore_.Get() != VK_NULL_HANDLE)
+    {
+        /* Wait until no more than (maxFrameLatency - 1) frames are pending on the GPU */
+        if (frameTimelineCounter_ + 1 <= maxFrameLatency_)
+            return true;
+
+        const std::uint64_t waitValue = frameTimelineCounter_ + 1 - maxFrameLatency_;
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = frameTimelineSemaphore_.GetAddressOf();
+            waitInfo.pValues        = &waitValue;
+        }
+        return (vkWaitSemaphoresKHR(device_, &waitInfo, timeout) == VK_SUCCESS);
+    }
+    #endif // /VK_KHR_timeline_semaphore
+
+    return true;
+}
+
 /* --- Extended functions --- */
 
 std::uint32_t VKSwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex) const
 {
     if (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX)
+    {
+        AcquirePendingColorBuffer();
         return currentColorBuffer_;
+    }
     else
         return std::min(swapBufferIndex, numColorBuffers_ - 1);
 }
@@ -277,6 +456,80 @@ void VKSwapChain::CopyImage(
     }
 }
 
+SurfaceTransform VKSwapChain::GetSurfaceTransform() const
+{
+    switch (preTransform_)
+    {
+        case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:    return SurfaceTransform::Rotate90;
+        case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:   return SurfaceTransform::Rotate180;
+        case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:   return SurfaceTransform::Rotate270;
+        default:                                        return SurfaceTransform::Identity;
+    }
+}
+
+/*
+The presentation engine rotates the swap-chain images clockwise by the pre-transform,
+so rectangles in the orientation of the surface are rotated counter-clockwise into the swap-chain images.
+*/
+
+void VKSwapChain::TransformViewport(VkViewport& viewport) const
+{
+    const float imageWidth  = static_cast<float>(swapChainExtent_.width);
+    const float imageHeight = static_cast<float>(swapChainExtent_.height);
+    const VkViewport src    = viewport;
+
+    switch (preTransform_)
+    {
+        case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:
+            viewport.x      = src.y;
+            viewport.y      = imageHeight - src.x - src.width;
+            viewport.width  = src.height;
+            viewport.height = src.width;
+            break;
+        case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:
+            viewport.x      = imageWidth - src.x - src.width;
+            viewport.y      = imageHeight - src.y - src.height;
+            break;
+        case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:
+            viewport.x      = imageWidth - src.y - src.height;
+            viewport.y      = src.x;
+            viewport.width  = src.height;
+            viewport.height = src.width;
+            break;
+        default:
+            break;
+    }
+}
+
+void VKSwapChain::TransformScissor(VkRect2D& scissor) const
+{
+    const std::int32_t  imageWidth  = static_cast<std::int32_t>(swapChainExtent_.width);
+    const std::int32_t  imageHeight = static_cast<std::int32_t>(swapChainExtent_.height);
+    const VkRect2D      src         = scissor;
+
+    switch (preTransform_)
+    {
+        case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:
+            scissor.offset.x        = src.offset.y;
+            scissor.offset.y        = std::max(0, imageHeight - src.offset.x - static_cast<std::int32_t>(src.extent.width));
+            scissor.extent.width    = src.extent.height;
+            scissor.extent.height   = src.extent.width;
+            break;
+        case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:
+            scissor.offset.x        = std::max(0, imageWidth - src.offset.x - static_cast<std::int32_t>(src.extent.width));
+            scissor.offset.y        = std::max(0, imageHeight - src.offset.y - static_cast<std::int32_t>(src.extent.height));
+            break;
+        case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:
+            scissor.offset.x        = std::max(0, imageWidth - src.offset.y - static_cast<std::int32_t>(src.extent.height));
+            scissor.offset.y        = src.offset.x;
+            scissor.extent.width    = src.extent.height;
+            scissor.extent.height   = src.extent.width;
+            break;
+        default:
+            break;
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -284,12 +537,14 @@ void VKSwapChain::CopyImage(
 
 bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 {
-    /* Check if new resolution would actually change the swap-chain extent */
-    if (swapChainExtent_.width  != resolution.x ||
-        swapChainExtent_.height != resolution.y)
+    /* Check if new resolution or a new orientation of the surface would actually change the swap-chain extent */
+    const VkExtent2D surfaceExtent = (IsSurfaceTransformTransposed(preTransform_) ? VkExtent2D{ swapChainExtent_.height, swapChainExtent_.width } : swapChainExtent_);
+    if (surfaceExtent.width  != resolution.x ||
+        surfaceExtent.height != resolution.y ||
+        (preRotation_ && PickSwapPreTransform(VKQuerySurfaceSupport(physicalDevice_, surface_).caps) != preTransform_))
     {
         /* Wait until graphics queue is idle before resources are destroyed and recreated */
-        vkQueueWaitIdle(graphicsQueue_);
+        VKQueueWaitIdle(graphicsQueue_);
 
         /* Recreate presenting semaphores and Vulkan surface */
         CreatePresentSemaphoresAndFences();
@@ -302,6 +557,33 @@ bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
     return true;
 }
 
+void VKSwapChain::DetachSurfacePrimary()
+{
+    /* Wait until graphics queue is idle before surface dependent resources are destroyed */
+    VKQueueWaitIdle(graphicsQueue_);
+
+    /* Release all objects that refer to the swap-chain images; the render passes remain valid as they only depend on the formats */
+    ReleaseRenderBuffers();
+    for_range(i, maxNumColorBuffers)
+    {
+        swapChainFramebuffers_[i].Release();
+        swapChainImageViews_[i].Release();
+    }
+
+    /* Release swap-chain before its surface */
+    swapChain_.Release();
+    surface_.Release();
+}
+
+bool VKSwapChain::AttachSurfacePrimary(const Extent2D& resolution)
+{
+    /* Recreate presenting semaphores, since a pending image acquisition might have been discarded with the previous swap-chain */
+    CreatePresentSemaphoresAndFences();
+    CreateGpuSurface();
+    CreateResolutionDependentResources(resolution);
+    return true;
+}
+
 void VKSwapChain::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
 {
     /* Create semaphore (no flags) */
@@ -327,14 +609,41 @@ void VKSwapChain::CreateGpuFence(VKPtr<VkFence>& fence)
     VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
+void VKSwapChain::CreateGpuTimelineSemaphore(VKPtr<VkSemaphore>& semaphore)
+{
+    #ifdef VK_KHR_timeline_semaphore
+    VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+    {
+        typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeCreateInfo.pNext            = nullptr;
+        typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeCreateInfo.initialValue     = 0;
+    }
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = &typeCreateInfo;
+        createInfo.flags = 0;
+    }
+    VkResult result = vkCreateSemaphore(device_, &createInfo, nullptr, semaphore.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+    #endif // /VK_KHR_timeline_semaphore
+}
+
 void VKSwapChain::CreatePresentSemaphoresAndFences()
 {
+    /* Use a single timeline semaphore for frame pacing if supported, otherwise one fence per frame in flight */
+    const bool hasTimelineSemaphore = HasExtension(VKExt::KHR_timeline_semaphore);
+    if (hasTimelineSemaphore)
+        CreateGpuTimelineSemaphore(frameTimelineSemaphore_);
+
     /* Create presentation semaphorse */
     for_range(i, maxNumFramesInFlight)
     {
         CreateGpuSemaphore(imageAvailableSemaphore_[i]);
         CreateGpuSemaphore(renderFinishedSemaphore_[i]);
-        CreateGpuFence(inFlightFences_[i]);
+        if (!hasTimelineSemaphore)
+            CreateGpuFence(inFlightFences_[i]);
     }
 }
 
@@ -403,13 +712,14 @@ void VKSwapChain::CreateRenderPass(VKRenderPass& renderPass, AttachmentLoadOp lo
         /* Specify single color attachment */
         renderPassDesc.colorAttachments[0] = AttachmentFormatDescriptor{ GetColorFormat(), loadOp, storeOp };
 
-        /* Specify depth-stencil attachment */
+        /* Specify depth-stencil attachment and discard its content at the end of each render pass if requested */
         const Format depthStencilFormat = GetDepthStencilFormat();
+        const AttachmentStoreOp depthStencilStoreOp = (discardDepthStencil_ ? AttachmentStoreOp::Undefined : storeOp);
 
         if (IsDepthFormat(depthStencilFormat))
-            renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, storeOp };
+            renderPassDesc.depthAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, depthStencilStoreOp };
         if (IsStencilFormat(depthStencilFormat))
-            renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, storeOp };
+            renderPassDesc.stencilAttachment = AttachmentFormatDescriptor{ depthStencilFormat, loadOp, depthStencilStoreOp };
     }
     renderPass.CreateVkRenderPass(device_, renderPassDesc);
 }
@@ -422,8 +732,12 @@ void VKSwapChain::CreateDefaultAndSecondaryRenderPass()
 
 void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval)
 {
-    /* Pick swap-chain extent by resolution */
-    swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, resolution);
+    /* Pick swap-chain extent by resolution and swap width and height if the images are pre-rotated by 90 or 270 degrees */
+    preTransform_ = PickSwapPreTransform(surfaceSupportDetails_.caps);
+    if (IsSurfaceTransformTransposed(preTransform_))
+        swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, Extent2D{ resolution.y, resolution.x });
+    else
+        swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, resolution);
 
     /* Get device queues for graphics and presentation */
     VkSurfaceKHR surface = surface_.Get();
@@ -463,7 +777,7 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
             createInfo.pQueueFamilyIndices      = nullptr;
         }
 
-        createInfo.preTransform                 = surfaceSupportDetails_.caps.currentTransform;
+        createInfo.preTransform                 = preTransform_;
         createInfo.compositeAlpha               = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
         createInfo.presentMode                  = presentMode;
         createInfo.clipped                      = VK_TRUE;
@@ -472,6 +786,9 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
     VkResult result = vkCreateSwapchainKHR(device_, &createInfo, nullptr, swapChain_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain");
 
+    /* Present IDs of previous swap-chains can no longer be waited on */
+    firstPresentId_ = presentIdCounter_ + 1;
+
     /* Query swap-chain images */
     result = vkGetSwapchainImagesKHR(device_, swapChain_, &numColorBuffers_, nullptr);
     VKThrowIfFailed(result, "failed to query number of Vulkan swap-chain images");
@@ -521,8 +838,42 @@ void VKSwapChain::CreateSwapChainImageViews()
     }
 }
 
+static void SetRenderingAttachment(VKRenderingAttachment& dst, VkImage image, VkImageView imageView, VkFormat format)
+{
+    dst.image       = image;
+    dst.imageView   = imageView;
+    dst.format      = format;
+}
+
+void VKSwapChain::CreateSwapChainRenderingAttachments()
+{
+    for_range(i, numColorBuffers_)
+    {
+        VKRenderingAttachments& attachments = swapChainRenderingAttachments_[i];
+        attachments.numColorAttachments = 1;
+
+        if (HasMultiSampling())
+        {
+            SetRenderingAttachment(attachments.colorAttachments[0], colorBuffers_[i].GetVkImage(), colorBuffers_[i].GetVkImageView(), swapChainFormat_.format);
+            SetRenderingAttachment(attachments.resolveAttachments[0], swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format);
+        }
+        else
+            SetRenderingAttachment(attachments.colorAttachments[0], swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format);
+
+        if (HasDepthStencilBuffer())
+            SetRenderingAttachment(attachments.depthStencilAttachment, depthStencilBuffer_.GetVkImage(), depthStencilBuffer_.GetVkImageView(), depthStencilFormat_);
+    }
+}
+
 void VKSwapChain::CreateSwapChainFramebuffers()
 {
+    /* Attachments are bound directly when the render pass begins if dynamic rendering is enabled */
+    if (VKIsDynamicRenderingEnabled())
+    {
+        CreateSwapChainRenderingAttachments();
+        return;
+    }
+
     /* Initialize image view attachments */
     VkImageView attachments[3] = {};
     std::uint32_t numAttachments = 0;
@@ -597,11 +948,14 @@ void VKSwapChain::CreateResolutionDependentResources(const Extent2D& resolution)
 {
     CreateSwapChain(resolution, vsyncInterval_);
 
+    /* Create render buffers with the actual extent of the swap-chain images, which can be clamped or pre-rotated */
+    const Extent2D imageExtent{ swapChainExtent_.width, swapChainExtent_.height };
+
     if (HasMultiSampling())
-        CreateColorBuffers(resolution);
+        CreateColorBuffers(imageExtent);
 
     if (depthStencilFormat_ != VK_FORMAT_UNDEFINED)
-        CreateDepthStencilBuffer(resolution);
+        CreateDepthStencilBuffer(imageExtent);
 
     CreateSwapChainFramebuffers();
 }
@@ -623,8 +977,29 @@ VkSurfaceFormatKHR VKSwapChain::PickSwapSurfaceFormat(const std::vector<VkSurfac
     return surfaceFormats.front();
 }
 
+// Returns the Vulkan present mode for the specified present mode or VK_PRESENT_MODE_MAX_ENUM_KHR for PresentMode::Default.
+static VkPresentModeKHR ToVkPresentMode(PresentMode presentMode)
+{
+    switch (presentMode)
+    {
+        case PresentMode::Immediate:    return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        case PresentMode::Mailbox:      return VK_PRESENT_MODE_MAILBOX_KHR;
+        case PresentMode::Fifo:         return VK_PRESENT_MODE_FIFO_KHR;
+        case PresentMode::FifoRelaxed:  return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+        default:                        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+    }
+}
+
 VkPresentModeKHR VKSwapChain::PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, std::uint32_t vsyncInterval) const
 {
+    /* Use explicitly requested present mode if supported by the surface */
+    const VkPresentModeKHR requestedMode = ToVkPresentMode(presentMode_);
+    if (requestedMode != VK_PRESENT_MODE_MAX_ENUM_KHR)
+    {
+        if (std::find(presentModes.begin(), presentModes.end(), requestedMode) != presentModes.end())
+            return requestedMode;
+    }
+
     if (vsyncInterval == 0)
     {
         /* Check if MAILBOX or IMMEDIATE presentation mode is available, to avoid vertical synchronization */
@@ -646,6 +1021,30 @@ VkExtent2D VKSwapChain::PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCa
     };
 }
 
+VkSurfaceTransformFlagBitsKHR VKSwapChain::PickSwapPreTransform(const VkSurfaceCapabilitiesKHR& surfaceCaps) const
+{
+    /* Use current transform of the surface for pre-rotation, so the compositor does not have to rotate the images */
+    if (preRotation_)
+    {
+        switch (surfaceCaps.currentTransform)
+        {
+            case VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR:
+            case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:
+            case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:
+            case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:
+                return surfaceCaps.currentTransform;
+            default:
+                break;
+        }
+    }
+
+    /* Otherwise, prefer identity transform and let the compositor handle the orientation */
+    if ((surfaceCaps.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) != 0)
+        return VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+
+    return surfaceCaps.currentTransform;
+}
+
 static std::vector<VkFormat> GetDepthStencilFormatPreference(int depthBits, int stencilBits)
 {
     if (stencilBits == 0)
@@ -684,19 +1083,52 @@ std::uint32_t VKSwapChain::PickSwapChainSize(std::uint32_t swapBuffers) const
 
 void VKSwapChain::AcquireNextColorBuffer()
 {
-    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % maxNumFramesInFlight;
-    vkWaitForFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
+    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % numFramesInFlight_;
 
-    vkAcquireNextImageKHR(
-        device_,
-        swapChain_,
-        UINT64_MAX,
-        imageAvailableSemaphore_[currentFrameInFlight_],
-        VK_NULL_HANDLE,
-        &currentColorBuffer_
-    );
+    /* Wait until the frame that previously used this slot has completed */
+    const bool hasTimelineSemaphore = (frameTimelineSemaphore_.Get() != VK_NULL_HANDLE);
+    if (hasTimelineSemaphore)
+    {
+        #ifdef VK_KHR_timeline_semaphore
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = frameTimelineSemaphore_.GetAddressOf();
+            waitInfo.pValues        = &frameTimelineValues_[currentFrameInFlight_];
+        }
+        vkWaitSemaphoresKHR(device_, &waitInfo, UINT64_MAX);
+        #endif // /VK_KHR_timeline_semaphore
+    }
+    else
+    {
+        /* Timeline semaphores never need to be reset */
+        vkWaitForFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
+    }
 
-    vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
+    /* Acquire next image now or defer it until the swap-chain is used, so a blocking acquire does not stall encoding of the next frame */
+    acquirePending_ = true;
+    if (!deferredAcquire_)
+        AcquirePendingColorBuffer();
+}
+
+void VKSwapChain::AcquirePendingColorBuffer() const
+{
+    if (acquirePending_)
+    {
+        vkAcquireNextImageKHR(
+            device_,
+            swapChain_,
+            UINT64_MAX,
+            imageAvailableSemaphore_[currentFrameInFlight_],
+            VK_NULL_HANDLE,
+            &currentColorBuffer_
+        );
+        acquirePending_ = false;
+    }
 }
 
 
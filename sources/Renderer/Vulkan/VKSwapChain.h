@@ -27,6 +27,10 @@ namespace LLGL
 
 class VKCommandContext;
 class VKDeviceMemoryManager;
+class VKDeviceMemoryDefragmenter;
+class VKDeferredReleaseQueue;
+class VKCommandPoolCache;
+class VKTransientBufferRing;
 class VKDeviceMemoryRegion;
 
 class VKSwapChain final : public SwapChain
@@ -39,11 +43,16 @@ class VKSwapChain final : public SwapChain
             VkPhysicalDevice                physicalDevice,
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
+            VKDeviceMemoryDefragmenter*     deviceMemoryDefrag,
+            VKDeferredReleaseQueue*         deferredReleaseQueue,
+            VKCommandPoolCache*             commandPoolCache,
+            VKTransientBufferRing*          transientBufferRing,
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface
         );
 
         void Present() override;
+        void PresentWithDamage(std::uint32_t numDamageRects, const Scissor* damageRects) override;
 
         std::uint32_t GetCurrentSwapIndex() const override;
         std::uint32_t GetNumSwapBuffers() const override;
@@ -56,6 +65,10 @@ class VKSwapChain final : public SwapChain
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
+        SurfaceTransform GetSurfaceTransform() const override;
+
     public:
 
         // Returns the swap-chain render pass object.
@@ -70,6 +83,18 @@ class VKSwapChain final : public SwapChain
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the secondary render pass, which loads the content of all attachments to resume rendering.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
+        // Returns the attachments of the specified swap buffer that are bound with dynamic rendering.
+        inline const VKRenderingAttachments& GetRenderingAttachments(std::uint32_t swapBufferIndex) const
+        {
+            return swapChainRenderingAttachments_[swapBufferIndex];
+        }
+
         // Returns the actual swap buffer index.
         std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
 
@@ -85,6 +110,18 @@ class VKSwapChain final : public SwapChain
             return swapChainExtent_;
         }
 
+        // Returns true if the swap-chain images are pre-rotated, i.e. viewports and scissors must be transformed with TransformViewport and TransformScissor.
+        inline bool IsPreRotated() const
+        {
+            return (preTransform_ != VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR);
+        }
+
+        // Transforms the specified viewport from the orientation of the surface into the pre-rotated swap-chain images.
+        void TransformViewport(VkViewport& viewport) const;
+
+        // Transforms the specified scissor rectangle from the orientation of the surface into the pre-rotated swap-chain images.
+        void TransformScissor(VkRect2D& scissor) const;
+
         // Returns true if this swap-chain has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
@@ -105,9 +142,12 @@ class VKSwapChain final : public SwapChain
     private:
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
+        void DetachSurfacePrimary() override;
+        bool AttachSurfacePrimary(const Extent2D& resolution) override;
 
         void CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore);
         void CreateGpuFence(VKPtr<VkFence>& fence);
+        void CreateGpuTimelineSemaphore(VKPtr<VkSemaphore>& semaphore);
         void CreatePresentSemaphoresAndFences();
         void CreateGpuSurface();
 
@@ -116,6 +156,7 @@ class VKSwapChain final : public SwapChain
 
         void CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval);
         void CreateSwapChainImageViews();
+        void CreateSwapChainRenderingAttachments();
         void CreateSwapChainFramebuffers();
 
         void CreateDepthStencilBuffer(const Extent2D& resolution);
@@ -127,10 +168,12 @@ class VKSwapChain final : public SwapChain
         VkSurfaceFormatKHR PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const;
         VkPresentModeKHR PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, std::uint32_t vsyncInterval) const;
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, const Extent2D& resolution) const;
+        VkSurfaceTransformFlagBitsKHR PickSwapPreTransform(const VkSurfaceCapabilitiesKHR& surfaceCaps) const;
         VkFormat PickDepthStencilFormat(int depthBits, int stencilBits) const;
         std::uint32_t PickSwapChainSize(std::uint32_t swapBuffers) const;
 
         void AcquireNextColorBuffer();
+        void AcquirePendingColorBuffer() const;
 
     private:
 
@@ -142,6 +185,10 @@ class VKSwapChain final : public SwapChain
         VkDevice                device_;
 
         VKDeviceMemoryManager&  deviceMemoryMngr_;
+        VKDeviceMemoryDefragmenter* deviceMemoryDefrag_                     = nullptr;
+        VKDeferredReleaseQueue* deferredReleaseQueue_                       = nullptr;
+        VKCommandPoolCache*     commandPoolCache_                           = nullptr;
+        VKTransientBufferRing*  transientBufferRing_                        = nullptr;
 
         VKPtr<VkSurfaceKHR>     surface_;
         SurfaceSupportDetails   surfaceSupportDetails_;
@@ -150,15 +197,24 @@ class VKSwapChain final : public SwapChain
         VKRenderPass            swapChainRenderPass_;
         VkSurfaceFormatKHR      swapChainFormat_                            = {};
         std::uint32_t           swapChainSamples_                           = 1;
-        VkExtent2D              swapChainExtent_                            = { 0, 0 };
+        VkExtent2D              swapChainExtent_                            = { 0, 0 }; // Extent of the swap-chain images, i.e. with width and height swapped for 90 and 270 degree pre-rotation.
+        VkSurfaceTransformFlagBitsKHR preTransform_                         = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
         VkImage                 swapChainImages_[maxNumColorBuffers];
         VKPtr<VkImageView>      swapChainImageViews_[maxNumColorBuffers];
         VKPtr<VkFramebuffer>    swapChainFramebuffers_[maxNumColorBuffers];
+        VKRenderingAttachments  swapChainRenderingAttachments_[maxNumColorBuffers]; // Replaces the framebuffers if dynamic rendering is enabled.
 
         std::uint32_t           numColorBuffers_                            = 2;
-        std::uint32_t           currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        mutable std::uint32_t   currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        std::uint32_t           numFramesInFlight_                          = maxNumFramesInFlight;
         std::uint32_t           currentFrameInFlight_                       = 0; // current index for maximum frames in flight
         std::uint32_t           vsyncInterval_                              = 0;
+        std::uint32_t           maxFrameLatency_                            = 0; // Maximum frame latency for low-latency mode; 0 if disabled.
+        PresentMode             presentMode_                                = PresentMode::Default;
+        bool                    deferredAcquire_                            = false;
+        bool                    discardDepthStencil_                        = false; // Depth-stencil attachment is not stored at the end of a render pass.
+        bool                    preRotation_                                = false; // Swap-chain is created with the current transform of the surface.
+        mutable bool            acquirePending_                             = false; // Next image must be acquired before the swap-chain is used.
 
         VKRenderPass            secondaryRenderPass_;
         VkFormat                depthStencilFormat_                         = VK_FORMAT_UNDEFINED;
@@ -172,6 +228,18 @@ class VKSwapChain final : public SwapChain
         VKPtr<VkSemaphore>      renderFinishedSemaphore_[maxNumFramesInFlight];
         VKPtr<VkFence>          inFlightFences_[maxNumFramesInFlight];
 
+        VKPtr<VkSemaphore>      frameTimelineSemaphore_;                        // Replaces 'inFlightFences_' if timeline semaphores are supported.
+        std::uint64_t           frameTimelineValues_[maxNumFramesInFlight]  = {};
+        std::uint64_t           frameTimelineCounter_                       = 0;
+
+        bool                    presentWaitEnabled_                         = false; // Low-latency mode uses VK_KHR_present_wait.
+        std::uint64_t           presentIdCounter_                           = 0;
+        std::uint64_t           firstPresentId_                             = 1;     // First present ID of the current VkSwapchainKHR object.
+
+        #ifdef VK_KHR_incremental_present
+        std::vector<VkRectLayerKHR> damageRectsVK_;                                         // Damage rectangles for VK_KHR_incremental_present; kept to avoid reallocation.
+        #endif
+
 };
 
 
@@ -37,6 +37,13 @@ VkShaderStageFlagBits Map(const ShaderType shaderType)
         case ShaderType::Geometry:          return VK_SHADER_STAGE_GEOMETRY_BIT;
         case ShaderType::Fragment:          return VK_SHADER_STAGE_FRAGMENT_BIT;
         case ShaderType::Compute:           return VK_SHADER_STAGE_COMPUTE_BIT;
+        #ifdef VK_EXT_mesh_shader
+        case ShaderType::Task:              return VK_SHADER_STAGE_TASK_BIT_EXT;
+        case ShaderType::Mesh:              return VK_SHADER_STAGE_MESH_BIT_EXT;
+        #else
+        case ShaderType::Task:              break;
+        case ShaderType::Mesh:              break;
+        #endif
     }
     MapFailed("ShaderType", "VkShaderStageFlagBits");
 }
@@ -435,6 +442,19 @@ VkColorComponentFlags ToVkColorComponentFlags(std::uint8_t colorMask)
     return bitmask;
 }
 
+float ToVkMemoryPriority(const ResidencyPriority priority)
+{
+    switch (priority)
+    {
+        case ResidencyPriority::Minimum:    return 0.0f;
+        case ResidencyPriority::Low:        return 0.25f;
+        case ResidencyPriority::Normal:     return 0.5f;
+        case ResidencyPriority::High:       return 0.75f;
+        case ResidencyPriority::Maximum:    return 1.0f;
+    }
+    return 0.5f;
+}
+
 Format Unmap(const VkFormat format)
 {
     switch (format)
@@ -18,6 +18,7 @@
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Format.h>
 #include <LLGL/SamplerFlags.h>
+#include <LLGL/ResourceFlags.h>
 #include <LLGL/QueryHeapFlags.h>
 
 
@@ -56,6 +57,7 @@ VkOffset3D              ToVkOffset(const Offset3D& offset);
 VkExtent3D              ToVkExtent(const Extent3D& extent);
 VkComponentSwizzle      ToVkComponentSwizzle(const TextureSwizzle swizzle);
 VkColorComponentFlags   ToVkColorComponentFlags(std::uint8_t colorMask);
+float                   ToVkMemoryPriority(const ResidencyPriority priority);
 
 Format Unmap( const VkFormat format );
 
@@ -0,0 +1,129 @@
+/*
+ * Benchmark.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BENCHMARK_H
+#define LLGL_BENCHMARK_H
+
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/ForRange.h>
+#include <functional>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+
+
+/*
+Shared scaffolding for the benchmark test projects (Test_Bandwidth, Test_DrawCalls, Test_EncodingScalability, Test_ImageConversion, Test_PipelineCreation).
+Each benchmark defines its own configuration and result types and uses these helpers for timing, command line parsing, and JSON output.
+*/
+
+// Command line arguments that are common to all benchmarks.
+struct BenchmarkCommandLine
+{
+    std::vector<std::string>    modules;        // Render system modules to benchmark; all available modules if none are specified.
+    std::string                 jsonFilename;   // Output filename for the results in JSON format from "--json=FILE"; empty if not specified.
+};
+
+// Callback to parse a benchmark specific option. Returns true if the argument was consumed.
+using BenchmarkOptionHandler = std::function<bool(const char* arg)>;
+
+// Returns the number of seconds for the specified number of ticks of LLGL::Timer.
+inline double TicksToSeconds(std::uint64_t ticks)
+{
+    return static_cast<double>(ticks) / static_cast<double>(LLGL::Timer::Frequency());
+}
+
+// Returns the value of the specified argument if it begins with the specified option prefix (e.g. "--draws="), or null otherwise.
+inline const char* MatchBenchmarkOption(const char* arg, const char* option)
+{
+    const std::size_t optionLen = std::strlen(option);
+    return (std::strncmp(arg, option, optionLen) == 0 ? arg + optionLen : nullptr);
+}
+
+/*
+Parses the command line for a benchmark. The "--json=FILE" option is handled here and all other options are passed to 'optionHandler'.
+Remaining arguments are module names if 'acceptModules' is true, or are reported as unknown arguments otherwise.
+*/
+inline BenchmarkCommandLine ParseBenchmarkCommandLine(int argc, char* argv[], const BenchmarkOptionHandler& optionHandler, bool acceptModules = true)
+{
+    BenchmarkCommandLine cmdLine;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (const char* value = MatchBenchmarkOption(argv[i], "--json="))
+            cmdLine.jsonFilename = value;
+        else if (optionHandler && optionHandler(argv[i]))
+            continue;
+        else if (acceptModules)
+            cmdLine.modules.push_back(argv[i]);
+        else
+            LLGL::Log::Errorf("unknown argument: %s\n", argv[i]);
+    }
+
+    if (acceptModules && cmdLine.modules.empty())
+        cmdLine.modules = LLGL::RenderSystem::FindModules();
+
+    return cmdLine;
+}
+
+/*
+Runs a benchmark for each of the specified modules and returns the exit code for the main function.
+TBenchmark must provide the functions 'bool Load(const std::string&)', 'void Run(const TConfig&, std::vector<TResult>&)', and 'void Release()'.
+*/
+template <typename TBenchmark, typename TConfig, typename TResult>
+int RunBenchmarkModules(const std::vector<std::string>& modules, const TConfig& config, std::vector<TResult>& results)
+{
+    int exitCode = 0;
+
+    for (const std::string& module : modules)
+    {
+        TBenchmark benchmark;
+        if (benchmark.Load(module))
+            benchmark.Run(config, results);
+        else
+            exitCode = 1;
+        benchmark.Release();
+    }
+
+    return exitCode;
+}
+
+/*
+Writes the benchmark results into a JSON file with the layout { "benchmark": NAME, "results": [ ... ] }.
+The 'writeResult' callback is invoked with the signature 'void(FILE*, const TResult&)' and must write a single JSON object without trailing separator.
+*/
+template <typename TResult, typename TWriteFunc>
+bool WriteBenchmarkJSON(const std::string& filename, const char* benchmarkName, const std::vector<TResult>& results, TWriteFunc writeResult)
+{
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if (file == nullptr)
+    {
+        LLGL::Log::Errorf("failed to write benchmark results: %s\n", filename.c_str());
+        return false;
+    }
+
+    std::fprintf(file, "{\n  \"benchmark\": \"%s\",\n  \"results\": [\n", benchmarkName);
+    for_range(i, results.size())
+    {
+        std::fprintf(file, "    ");
+        writeResult(file, results[i]);
+        std::fprintf(file, "%s\n", (i + 1 < results.size() ? "," : ""));
+    }
+    std::fprintf(file, "  ]\n}\n");
+
+    std::fclose(file);
+    return true;
+}
+
+
+#endif
+
+
+
+// ================================================================================
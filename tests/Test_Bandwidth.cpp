@@ -0,0 +1,411 @@
+/*
+ * Test_Bandwidth.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Benchmark for the upload and readback bandwidth of all transfer paths.
+Usage: Test_Bandwidth [MODULE...] [--max-size=BYTES] [--budget=MIB] [--json=FILE]
+If no module is specified, all available modules are benchmarked.
+Each operation is timed until the GPU has completed it (see CommandQueue::WaitIdle), so the latency includes any staging copies.
+*/
+
+struct BenchmarkConfig
+{
+    std::uint64_t   minSize         = 64;
+    std::uint64_t   maxSize         = 256ull * 1024ull * 1024ull;
+    std::uint64_t   budgetPerSize   = 512ull * 1024ull * 1024ull;   // Number of bytes to transfer for each size
+    std::uint32_t   minIterations   = 5;
+    std::uint32_t   maxIterations   = 200;
+};
+
+struct BenchmarkResult
+{
+    std::string     module;
+    std::string     path;
+    std::string     format;         // Empty for buffer transfers
+    std::uint64_t   size            = 0;
+    std::uint32_t   iterations      = 0;
+    double          bandwidth       = 0.0;  // GB/s over all iterations
+    double          latencyP50      = 0.0;  // Seconds
+    double          latencyP90      = 0.0;  // Seconds
+    double          latencyP99      = 0.0;  // Seconds
+};
+
+using TransferFunc = std::function<void()>;
+
+static double Percentile(const std::vector<double>& sortedValues, double percentile)
+{
+    const std::size_t index = static_cast<std::size_t>(percentile * static_cast<double>(sortedValues.size()));
+    return sortedValues[std::min(index, sortedValues.size() - 1)];
+}
+
+class BandwidthBenchmark
+{
+
+    public:
+
+        bool Load(const std::string& moduleName)
+        {
+            module_ = moduleName;
+
+            LLGL::Report report;
+            renderer_ = LLGL::RenderSystem::Load(moduleName, &report);
+            if (!renderer_)
+            {
+                LLGL::Log::Errorf("failed to load render system: %s\n", moduleName.c_str());
+                if (report.HasErrors())
+                    LLGL::Log::Errorf("%s", report.GetText());
+                return false;
+            }
+
+            cmdQueue_   = renderer_->GetCommandQueue();
+            cmdBuffer_  = renderer_->CreateCommandBuffer();
+
+            return true;
+        }
+
+        void Run(const BenchmarkConfig& config, std::vector<BenchmarkResult>& results)
+        {
+            LLGL::Log::Printf("\nrun bandwidth benchmarks for %s ...\n", renderer_->GetName());
+
+            const auto& limits = renderer_->GetRenderingCaps().limits;
+            const std::uint64_t maxSize = (limits.maxBufferSize > 0 ? std::min(config.maxSize, limits.maxBufferSize) : config.maxSize);
+
+            const LLGL::Format textureFormats[] =
+            {
+                LLGL::Format::R8UNorm,
+                LLGL::Format::RGBA8UNorm,
+                LLGL::Format::RGBA16Float,
+                LLGL::Format::RGBA32Float,
+            };
+
+            for (std::uint64_t size = config.minSize; size <= maxSize; size *= 4)
+            {
+                srcData_.resize(static_cast<std::size_t>(size));
+                dstData_.resize(static_cast<std::size_t>(size));
+                for_range(i, srcData_.size())
+                    srcData_[i] = static_cast<char>(i * 7u);
+
+                RunBufferTransfers(config, size, results);
+                for (LLGL::Format format : textureFormats)
+                    RunTextureTransfers(config, size, format, results);
+            }
+        }
+
+        void Release()
+        {
+            renderer_.reset();
+        }
+
+    private:
+
+        std::uint32_t GetNumIterations(const BenchmarkConfig& config, std::uint64_t size) const
+        {
+            const std::uint64_t iterations = config.budgetPerSize / size;
+            return static_cast<std::uint32_t>(std::max<std::uint64_t>(config.minIterations, std::min<std::uint64_t>(config.maxIterations, iterations)));
+        }
+
+        // Runs the transfer function several times and waits for the GPU after each iteration.
+        void MeasureTransfer(
+            const BenchmarkConfig&          config,
+            const char*                     path,
+            const char*                     format,
+            std::uint64_t                   size,
+            const TransferFunc&             transfer,
+            std::vector<BenchmarkResult>&   results)
+        {
+            const std::uint32_t numIterations = GetNumIterations(config, size);
+
+            /* Warm up staging pools and driver caches before measuring */
+            transfer();
+            cmdQueue_->WaitIdle();
+
+            std::vector<double> latencies;
+            latencies.reserve(numIterations);
+
+            double totalTime = 0.0;
+            for_range(i, numIterations)
+            {
+                const std::uint64_t start = LLGL::Timer::Tick();
+                {
+                    transfer();
+                    cmdQueue_->WaitIdle();
+                }
+                const double latency = TicksToSeconds(LLGL::Timer::Tick() - start);
+                latencies.push_back(latency);
+                totalTime += latency;
+            }
+
+            std::sort(latencies.begin(), latencies.end());
+
+            BenchmarkResult result;
+            {
+                result.module       = module_;
+                result.path         = path;
+                result.format       = format;
+                result.size         = size;
+                result.iterations   = numIterations;
+                result.bandwidth    = (totalTime > 0.0 ? static_cast<double>(size) * numIterations / totalTime / 1.0e9 : 0.0);
+                result.latencyP50   = Percentile(latencies, 0.50);
+                result.latencyP90   = Percentile(latencies, 0.90);
+                result.latencyP99   = Percentile(latencies, 0.99);
+            }
+            PrintResult(result);
+            results.push_back(result);
+        }
+
+        LLGL::Buffer* CreateBuffer(std::uint64_t size, long bindFlags, long cpuAccessFlags = 0, long miscFlags = 0)
+        {
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.size             = size;
+                bufferDesc.bindFlags        = bindFlags;
+                bufferDesc.cpuAccessFlags   = cpuAccessFlags;
+                bufferDesc.miscFlags        = miscFlags;
+            }
+            return renderer_->CreateBuffer(bufferDesc);
+        }
+
+        void RunBufferTransfers(const BenchmarkConfig& config, std::uint64_t size, std::vector<BenchmarkResult>& results)
+        {
+            LLGL::Buffer* gpuBuffer = CreateBuffer(size, LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst);
+
+            MeasureTransfer(
+                config, "WriteBuffer", "", size,
+                [this, gpuBuffer, size]()
+                {
+                    renderer_->WriteBuffer(*gpuBuffer, 0, srcData_.data(), size);
+                },
+                results
+            );
+
+            /* UpdateBuffer is limited to 2^16 bytes */
+            if (size <= UINT16_MAX)
+            {
+                MeasureTransfer(
+                    config, "UpdateBuffer", "", size,
+                    [this, gpuBuffer, size]()
+                    {
+                        cmdBuffer_->Begin();
+                        cmdBuffer_->UpdateBuffer(*gpuBuffer, 0, srcData_.data(), static_cast<std::uint16_t>(size));
+                        cmdBuffer_->End();
+                        cmdQueue_->Submit(*cmdBuffer_);
+                    },
+                    results
+                );
+            }
+
+            MeasureTransfer(
+                config, "ReadBuffer", "", size,
+                [this, gpuBuffer, size]()
+                {
+                    renderer_->ReadBuffer(*gpuBuffer, 0, dstData_.data(), size);
+                },
+                results
+            );
+
+            renderer_->Release(*gpuBuffer);
+
+            /* Map buffers with CPU access for writing and reading */
+            LLGL::Buffer* uploadBuffer = CreateBuffer(size, LLGL::BindFlags::CopySrc, LLGL::CPUAccessFlags::Write, LLGL::MiscFlags::DynamicUsage);
+
+            MeasureTransfer(
+                config, "MapBuffer(WriteDiscard)", "", size,
+                [this, uploadBuffer, size]()
+                {
+                    if (void* dst = renderer_->MapBuffer(*uploadBuffer, LLGL::CPUAccess::WriteDiscard))
+                    {
+                        ::memcpy(dst, srcData_.data(), static_cast<std::size_t>(size));
+                        renderer_->UnmapBuffer(*uploadBuffer);
+                    }
+                },
+                results
+            );
+
+            renderer_->Release(*uploadBuffer);
+
+            LLGL::Buffer* readbackBuffer = CreateBuffer(size, LLGL::BindFlags::CopyDst, LLGL::CPUAccessFlags::Read);
+
+            MeasureTransfer(
+                config, "MapBuffer(ReadOnly)", "", size,
+                [this, readbackBuffer, size]()
+                {
+                    if (const void* src = renderer_->MapBuffer(*readbackBuffer, LLGL::CPUAccess::ReadOnly))
+                    {
+                        ::memcpy(dstData_.data(), src, static_cast<std::size_t>(size));
+                        renderer_->UnmapBuffer(*readbackBuffer);
+                    }
+                },
+                results
+            );
+
+            renderer_->Release(*readbackBuffer);
+        }
+
+        void RunTextureTransfers(const BenchmarkConfig& config, std::uint64_t size, LLGL::Format format, std::vector<BenchmarkResult>& results)
+        {
+            const LLGL::FormatAttributes& formatAttribs = LLGL::GetFormatAttribs(format);
+            const std::uint64_t bytesPerTexel = formatAttribs.bitSize / 8;
+            if (size < bytesPerTexel)
+                return;
+
+            /* Determine 2D extent for the number of texels; sizes and texel sizes are powers of two, so the extent is exact */
+            const std::uint64_t maxTextureSize  = std::max<std::uint64_t>(1, std::min<std::uint32_t>(renderer_->GetRenderingCaps().limits.max2DTextureSize, 16384u));
+            const std::uint64_t numTexels       = size / bytesPerTexel;
+            const std::uint64_t width           = std::min(numTexels, maxTextureSize);
+            const std::uint64_t height          = numTexels / width;
+            if (height > maxTextureSize)
+                return;
+
+            const char* formatName = LLGL::ToString(format);
+
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type            = LLGL::TextureType::Texture2D;
+                textureDesc.bindFlags       = LLGL::BindFlags::Sampled | LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst;
+                textureDesc.format          = format;
+                textureDesc.extent.x        = static_cast<std::uint32_t>(width);
+                textureDesc.extent.y        = static_cast<std::uint32_t>(height);
+                textureDesc.mipLevels       = 1;
+            }
+            LLGL::Texture* texture = renderer_->CreateTexture(textureDesc);
+
+            const LLGL::TextureRegion region{ LLGL::Offset3D{}, textureDesc.extent };
+
+            LLGL::ImageView srcImageView;
+            {
+                srcImageView.format     = formatAttribs.format;
+                srcImageView.dataType   = formatAttribs.dataType;
+                srcImageView.data       = srcData_.data();
+                srcImageView.dataSize   = static_cast<std::size_t>(size);
+            }
+            MeasureTransfer(
+                config, "WriteTexture", formatName, size,
+                [this, texture, &region, &srcImageView]()
+                {
+                    renderer_->WriteTexture(*texture, region, srcImageView);
+                },
+                results
+            );
+
+            LLGL::Buffer* stagingBuffer = CreateBuffer(size, LLGL::BindFlags::CopySrc);
+            renderer_->WriteBuffer(*stagingBuffer, 0, srcData_.data(), size);
+
+            MeasureTransfer(
+                config, "CopyTextureFromBuffer", formatName, size,
+                [this, texture, &region, stagingBuffer]()
+                {
+                    cmdBuffer_->Begin();
+                    cmdBuffer_->CopyTextureFromBuffer(*texture, region, *stagingBuffer, 0);
+                    cmdBuffer_->End();
+                    cmdQueue_->Submit(*cmdBuffer_);
+                },
+                results
+            );
+
+            renderer_->Release(*stagingBuffer);
+
+            LLGL::MutableImageView dstImageView;
+            {
+                dstImageView.format     = formatAttribs.format;
+                dstImageView.dataType   = formatAttribs.dataType;
+                dstImageView.data       = dstData_.data();
+                dstImageView.dataSize   = static_cast<std::size_t>(size);
+            }
+            MeasureTransfer(
+                config, "ReadTexture", formatName, size,
+                [this, texture, &region, &dstImageView]()
+                {
+                    renderer_->ReadTexture(*texture, region, dstImageView);
+                },
+                results
+            );
+
+            renderer_->Release(*texture);
+        }
+
+        static void PrintResult(const BenchmarkResult& result)
+        {
+            LLGL::Log::Printf(
+                "%-24s %-12s size=%-10llu GB/s=%8.3f p50=%9.3f ms p90=%9.3f ms p99=%9.3f ms\n",
+                result.path.c_str(), result.format.c_str(), static_cast<unsigned long long>(result.size), result.bandwidth,
+                result.latencyP50 * 1000.0, result.latencyP90 * 1000.0, result.latencyP99 * 1000.0
+            );
+        }
+
+    private:
+
+        std::string             module_;
+        LLGL::RenderSystemPtr   renderer_;
+        LLGL::CommandQueue*     cmdQueue_   = nullptr;
+        LLGL::CommandBuffer*    cmdBuffer_  = nullptr;
+        std::vector<char>       srcData_;
+        std::vector<char>       dstData_;
+
+};
+
+static void WriteJSONResult(FILE* file, const BenchmarkResult& result)
+{
+    std::fprintf(
+        file,
+        "{ \"module\": \"%s\", \"path\": \"%s\", \"format\": \"%s\", \"size\": %llu, \"iterations\": %u, "
+        "\"gigabytesPerSecond\": %.6f, \"latencyP50\": %.9f, \"latencyP90\": %.9f, \"latencyP99\": %.9f }",
+        result.module.c_str(), result.path.c_str(), result.format.c_str(), static_cast<unsigned long long>(result.size), result.iterations,
+        result.bandwidth, result.latencyP50, result.latencyP90, result.latencyP99
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments
+    BenchmarkConfig config;
+
+    const BenchmarkCommandLine cmdLine = ParseBenchmarkCommandLine(
+        argc, argv,
+        [&config](const char* arg) -> bool
+        {
+            if (const char* value = MatchBenchmarkOption(arg, "--max-size="))
+                config.maxSize = std::max<std::uint64_t>(config.minSize, std::strtoull(value, nullptr, 10));
+            else if (const char* value = MatchBenchmarkOption(arg, "--budget="))
+                config.budgetPerSize = std::max<std::uint64_t>(1, std::strtoull(value, nullptr, 10)) * 1024ull * 1024ull;
+            else
+                return false;
+            return true;
+        }
+    );
+
+    // Run benchmarks for each module
+    std::vector<BenchmarkResult> results;
+    int exitCode = RunBenchmarkModules<BandwidthBenchmark>(cmdLine.modules, config, results);
+
+    if (!cmdLine.jsonFilename.empty())
+    {
+        if (!WriteBenchmarkJSON(cmdLine.jsonFilename, "Bandwidth", results, WriteJSONResult))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+
+// ================================================================================
@@ -0,0 +1,119 @@
+/*
+ * Test_CaptureReplay.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/CaptureReplay.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Replays a command stream capture for offline profiling.
+Usage: Test_CaptureReplay CAPTURE [MODULE...] [--loops=N] [--no-wait] [--hidden]
+If no module is specified, the capture is replayed with all available modules.
+A capture can be recorded by any application with LLGL::RenderingDebugger::SetCapture, e.g. debugger.SetCapture("Frames.llglcapture", 100).
+Shaders are embedded into the capture, so it can only be replayed with modules that accept the captured shader language.
+*/
+
+static double MedianValue(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static bool ReplayWithModule(const std::string& module, const char* filename, const LLGL::CaptureReplayDescriptor& replayDesc)
+{
+    LLGL::Report report;
+    LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(module, &report);
+    if (!renderer)
+    {
+        if (report.HasErrors())
+            LLGL::Log::Errorf("%s", report.GetText());
+        return false;
+    }
+
+    LLGL::CaptureReplayResult result;
+    LLGL::Report replayReport;
+    const bool succeeded = LLGL::ReplayCapture(*renderer, filename, replayDesc, result, &replayReport);
+
+    if (replayReport.HasErrors())
+        LLGL::Log::Errorf("%s", replayReport.GetText());
+
+    LLGL::Log::Printf("%s:\n", module.c_str());
+    if (!result.frameTimes.empty())
+    {
+        const double totalTime = std::accumulate(result.frameTimes.begin(), result.frameTimes.end(), 0.0);
+        const auto minMaxTime = std::minmax_element(result.frameTimes.begin(), result.frameTimes.end());
+        LLGL::Log::Printf(
+            "  frames=%zu avg=%8.3f ms median=%8.3f ms min=%8.3f ms max=%8.3f ms\n",
+            result.frameTimes.size(),
+            totalTime * 1000.0 / static_cast<double>(result.frameTimes.size()),
+            MedianValue(result.frameTimes) * 1000.0,
+            *minMaxTime.first * 1000.0,
+            *minMaxTime.second * 1000.0
+        );
+    }
+    LLGL::Log::Printf(
+        "  commands=%llu skipped=%llu\n",
+        static_cast<unsigned long long>(result.numCommands), static_cast<unsigned long long>(result.numSkippedCommands)
+    );
+
+    LLGL::RenderSystem::Unload(std::move(renderer));
+    return succeeded;
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments
+    const char* filename = nullptr;
+    LLGL::CaptureReplayDescriptor replayDesc;
+    std::vector<std::string> modules;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--loops=", 8) == 0)
+            replayDesc.numLoops = static_cast<std::uint32_t>(std::max(1l, std::strtol(argv[i] + 8, nullptr, 10)));
+        else if (std::strcmp(argv[i], "--no-wait") == 0)
+            replayDesc.waitIdle = false;
+        else if (std::strcmp(argv[i], "--hidden") == 0)
+            replayDesc.showWindows = false;
+        else if (filename == nullptr)
+            filename = argv[i];
+        else
+            modules.push_back(argv[i]);
+    }
+
+    if (filename == nullptr)
+    {
+        LLGL::Log::Errorf("usage: Test_CaptureReplay CAPTURE [MODULE...] [--loops=N] [--no-wait] [--hidden]\n");
+        return 1;
+    }
+
+    if (modules.empty())
+        modules = LLGL::RenderSystem::FindModules();
+
+    // Replay capture with each module
+    int exitCode = 0;
+
+    for (const std::string& module : modules)
+    {
+        if (!ReplayWithModule(module, filename, replayDesc))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+// ================================================================================
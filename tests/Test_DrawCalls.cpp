@@ -0,0 +1,515 @@
+/*
+ * Test_DrawCalls.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/Utility.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Benchmark for the CPU overhead of draw calls.
+Usage: Test_DrawCalls [MODULE...] [--draws=N] [--threads=N] [--json=FILE]
+If no module is specified, all available modules are benchmarked.
+Shaders are loaded from the Testbed, so this must run in the 'tests/' directory.
+*/
+
+enum class StateChange
+{
+    None,
+    PipelineState,
+    ResourceHeap,
+    Uniforms,
+    VertexBuffer,
+};
+
+enum class EncodingMode
+{
+    Primary,
+    Secondary,
+    MultiSubmit,
+};
+
+struct BenchmarkConfig
+{
+    std::uint32_t   numDraws    = 100000;
+    std::uint32_t   maxThreads  = 8;
+};
+
+struct BenchmarkResult
+{
+    std::string     module;
+    std::string     name;
+    std::uint32_t   numDraws        = 0;
+    std::uint32_t   changeInterval  = 0;    // Number of draws between two state changes; 0 if the state never changes
+    std::uint32_t   numThreads      = 1;
+    double          encodeTime      = 0.0;  // Seconds
+    double          submitTime      = 0.0;  // Seconds
+
+    double DrawsPerSecond() const
+    {
+        return (encodeTime > 0.0 ? static_cast<double>(numDraws) / encodeTime : 0.0);
+    }
+};
+
+static const char* ToString(StateChange change)
+{
+    switch (change)
+    {
+        case StateChange::None:             return "Draw";
+        case StateChange::PipelineState:    return "PipelineState";
+        case StateChange::ResourceHeap:     return "ResourceHeap";
+        case StateChange::Uniforms:         return "Uniforms";
+        case StateChange::VertexBuffer:     return "VertexBuffer";
+    }
+    return "";
+}
+
+static const char* ToString(EncodingMode mode)
+{
+    switch (mode)
+    {
+        case EncodingMode::Primary:     return "Primary";
+        case EncodingMode::Secondary:   return "Secondary";
+        case EncodingMode::MultiSubmit: return "MultiSubmit";
+    }
+    return "";
+}
+
+class DrawCallBenchmark
+{
+
+    public:
+
+        bool Load(const std::string& moduleName)
+        {
+            module_ = moduleName;
+
+            // Load renderer
+            LLGL::Report report;
+            renderer_ = LLGL::RenderSystem::Load(moduleName, &report);
+            if (!renderer_)
+            {
+                LLGL::Log::Errorf("failed to load render system: %s\n", moduleName.c_str());
+                if (report.HasErrors())
+                    LLGL::Log::Errorf("%s", report.GetText());
+                return false;
+            }
+
+            // Create swap-chain to render into; it is never presented
+            LLGL::SwapChainDescriptor swapChainDesc;
+            {
+                swapChainDesc.resolution = { 64, 64 };
+            }
+            swapChain_ = renderer_->CreateSwapChain(swapChainDesc);
+            cmdQueue_ = renderer_->GetCommandQueue();
+
+            return (LoadShaders() && CreateResources());
+        }
+
+        void Run(const BenchmarkConfig& config, std::vector<BenchmarkResult>& results)
+        {
+            LLGL::Log::Printf("\nrun draw call benchmarks for %s ...\n", renderer_->GetName());
+
+            // State change rates for increasing overhead
+            const std::uint32_t changeIntervals[] = { 64, 16, 4, 1 };
+            const StateChange stateChanges[] =
+            {
+                StateChange::PipelineState,
+                StateChange::ResourceHeap,
+                StateChange::Uniforms,
+                StateChange::VertexBuffer,
+            };
+
+            // Draw calls without state changes for each encoding mode
+            results.push_back(RunEncoding(config.numDraws, StateChange::None, 0, EncodingMode::Primary));
+            results.push_back(RunEncoding(config.numDraws, StateChange::None, 0, EncodingMode::Secondary));
+            results.push_back(RunEncoding(config.numDraws, StateChange::None, 0, EncodingMode::MultiSubmit));
+
+            // Draw calls with increasing state change rates
+            for (StateChange change : stateChanges)
+            {
+                for (std::uint32_t interval : changeIntervals)
+                    results.push_back(RunEncoding(config.numDraws, change, interval, EncodingMode::Primary));
+            }
+
+            // Multi-threaded encoding into secondary command buffers
+            const std::uint32_t maxThreads = std::max(1u, std::min(config.maxThreads, std::thread::hardware_concurrency()));
+            for (std::uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+                results.push_back(RunMultiThreaded(config.numDraws, numThreads));
+        }
+
+        void Release()
+        {
+            renderer_.reset();
+        }
+
+    private:
+
+        bool IsShadingLanguageSupported(LLGL::ShadingLanguage language) const
+        {
+            const auto& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            return (std::find(languages.begin(), languages.end(), language) != languages.end());
+        }
+
+        bool LoadShaders()
+        {
+            const std::string shaderPath = "Testbed/Shaders/";
+
+            LLGL::ShaderDescriptor vsDesc, fsDesc;
+
+            if (IsShadingLanguageSupported(LLGL::ShadingLanguage::HLSL))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.hlsl").c_str(), "VSMain", "vs_5_0");
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.hlsl").c_str(), "PSMain", "ps_5_0");
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::SPIRV))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.450core.vert.spv").c_str());
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.450core.frag.spv").c_str());
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::Metal))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.metal").c_str(), "VSMain", "1.1");
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.metal").c_str(), "PSMain", "1.1");
+            }
+            else
+            {
+                // GLSL is also used for backends without shader compilation, such as the Null renderer
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.330core.vert").c_str());
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.330core.frag").c_str());
+            }
+
+            vertexShader_   = renderer_->CreateShader(vsDesc);
+            fragmentShader_ = renderer_->CreateShader(fsDesc);
+
+            for (LLGL::Shader* shader : { vertexShader_, fragmentShader_ })
+            {
+                if (const LLGL::Report* report = shader->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        LLGL::Log::Errorf("%s", report->GetText());
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        bool CreateResources()
+        {
+            // Create two of each resource to switch between
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = 256;
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = { LLGL::VertexAttribute{ "position", LLGL::Format::RGBA32Float, 0, 0, sizeof(float) * 4 } };
+            }
+            LLGL::BufferDescriptor constantBufferDesc;
+            {
+                constantBufferDesc.size         = 256;
+                constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            for_range(i, 2)
+            {
+                vertexBuffers_[i]   = renderer_->CreateBuffer(vertexBufferDesc);
+                constantBuffers_[i] = renderer_->CreateBuffer(constantBufferDesc);
+            }
+
+            // Create pipeline layout with a resource heap that is not used by the shaders, but still has to be bound by the backend
+            pipelineLayout_ = renderer_->CreatePipelineLayout(LLGL::Parse("heap{cbuffer(Dummy@3):frag},float4(clearColor)"));
+
+            for_range(i, 2)
+            {
+                LLGL::ResourceViewDescriptor resourceView{ constantBuffers_[i] };
+                resourceHeaps_[i] = renderer_->CreateResourceHeap(LLGL::ResourceHeapDescriptor{ pipelineLayout_, 1 }, { resourceView });
+            }
+
+            // Create two PSOs that only differ in their rasterizer state
+            for_range(i, 2)
+            {
+                LLGL::GraphicsPipelineDescriptor psoDesc;
+                {
+                    psoDesc.pipelineLayout          = pipelineLayout_;
+                    psoDesc.renderPass              = swapChain_->GetRenderPass();
+                    psoDesc.vertexShader            = vertexShader_;
+                    psoDesc.fragmentShader          = fragmentShader_;
+                    psoDesc.rasterizer.cullMode     = (i == 0 ? LLGL::CullMode::Disabled : LLGL::CullMode::Back);
+                }
+                pipelineStates_[i] = renderer_->CreatePipelineState(psoDesc);
+                if (const LLGL::Report* report = pipelineStates_[i]->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        LLGL::Log::Errorf("%s", report->GetText());
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // Encodes draw calls and changes the specified state every 'changeInterval' draws.
+        void EncodeDraws(LLGL::CommandBuffer& cmdBuffer, std::uint32_t numDraws, StateChange change, std::uint32_t changeInterval)
+        {
+            const float colors[2][4] =
+            {
+                { 0.2f, 0.4f, 0.6f, 1.0f },
+                { 0.6f, 0.4f, 0.2f, 1.0f },
+            };
+
+            cmdBuffer.SetPipelineState(*pipelineStates_[0]);
+            cmdBuffer.SetResourceHeap(*resourceHeaps_[0]);
+            cmdBuffer.SetVertexBuffer(*vertexBuffers_[0]);
+            cmdBuffer.SetUniforms(0, colors[0], sizeof(colors[0]));
+
+            for_range(i, numDraws)
+            {
+                if (changeInterval > 0 && i > 0 && i % changeInterval == 0)
+                {
+                    const std::uint32_t index = (i / changeInterval) % 2;
+                    switch (change)
+                    {
+                        case StateChange::None:
+                            break;
+                        case StateChange::PipelineState:
+                            cmdBuffer.SetPipelineState(*pipelineStates_[index]);
+                            break;
+                        case StateChange::ResourceHeap:
+                            cmdBuffer.SetResourceHeap(*resourceHeaps_[index]);
+                            break;
+                        case StateChange::Uniforms:
+                            cmdBuffer.SetUniforms(0, colors[index], sizeof(colors[index]));
+                            break;
+                        case StateChange::VertexBuffer:
+                            cmdBuffer.SetVertexBuffer(*vertexBuffers_[index]);
+                            break;
+                    }
+                }
+                cmdBuffer.Draw(3, 0);
+            }
+        }
+
+        LLGL::CommandBuffer* CreateCommandBuffer(long flags)
+        {
+            LLGL::CommandBufferDescriptor cmdBufferDesc;
+            {
+                cmdBufferDesc.flags         = flags;
+                cmdBufferDesc.renderPass    = ((flags & LLGL::CommandBufferFlags::Secondary) != 0 ? swapChain_->GetRenderPass() : nullptr);
+            }
+            return renderer_->CreateCommandBuffer(cmdBufferDesc);
+        }
+
+        BenchmarkResult RunEncoding(std::uint32_t numDraws, StateChange change, std::uint32_t changeInterval, EncodingMode mode)
+        {
+            BenchmarkResult result;
+            {
+                result.module           = module_;
+                result.name             = std::string(ToString(change)) + "/" + ToString(mode);
+                result.numDraws         = numDraws;
+                result.changeInterval   = changeInterval;
+            }
+
+            LLGL::CommandBuffer* primaryCmdBuffer   = CreateCommandBuffer(mode == EncodingMode::MultiSubmit ? LLGL::CommandBufferFlags::MultiSubmit : 0);
+            LLGL::CommandBuffer* secondaryCmdBuffer = (mode == EncodingMode::Secondary ? CreateCommandBuffer(LLGL::CommandBufferFlags::Secondary) : nullptr);
+
+            // Measure CPU time to encode all draw calls
+            const std::uint64_t encodeStart = LLGL::Timer::Tick();
+            {
+                if (secondaryCmdBuffer != nullptr)
+                {
+                    secondaryCmdBuffer->Begin();
+                    EncodeDraws(*secondaryCmdBuffer, numDraws, change, changeInterval);
+                    secondaryCmdBuffer->End();
+                }
+                primaryCmdBuffer->Begin();
+                {
+                    primaryCmdBuffer->BeginRenderPass(*swapChain_);
+                    {
+                        primaryCmdBuffer->SetViewport(swapChain_->GetResolution());
+                        if (secondaryCmdBuffer != nullptr)
+                            primaryCmdBuffer->Execute(*secondaryCmdBuffer);
+                        else
+                            EncodeDraws(*primaryCmdBuffer, numDraws, change, changeInterval);
+                    }
+                    primaryCmdBuffer->EndRenderPass();
+                }
+                primaryCmdBuffer->End();
+            }
+            result.encodeTime = TicksToSeconds(LLGL::Timer::Tick() - encodeStart);
+
+            // Measure CPU time to submit; multi-submit command buffers are submitted several times without re-encoding
+            const std::uint32_t numSubmits = (mode == EncodingMode::MultiSubmit ? 4 : 1);
+            const std::uint64_t submitStart = LLGL::Timer::Tick();
+            {
+                for_range(i, numSubmits)
+                    cmdQueue_->Submit(*primaryCmdBuffer);
+            }
+            result.submitTime = TicksToSeconds(LLGL::Timer::Tick() - submitStart) / numSubmits;
+
+            cmdQueue_->WaitIdle();
+
+            if (secondaryCmdBuffer != nullptr)
+                renderer_->Release(*secondaryCmdBuffer);
+            renderer_->Release(*primaryCmdBuffer);
+
+            PrintResult(result);
+            return result;
+        }
+
+        BenchmarkResult RunMultiThreaded(std::uint32_t numDraws, std::uint32_t numThreads)
+        {
+            BenchmarkResult result;
+            {
+                result.module       = module_;
+                result.name         = "Draw/MultiThreaded";
+                result.numDraws     = numDraws;
+                result.numThreads   = numThreads;
+            }
+
+            std::vector<LLGL::CommandBuffer*> secondaryCmdBuffers(numThreads);
+            for_range(i, numThreads)
+                secondaryCmdBuffers[i] = CreateCommandBuffer(LLGL::CommandBufferFlags::Secondary);
+
+            LLGL::CommandBuffer* primaryCmdBuffer = CreateCommandBuffer(0);
+
+            // Measure wall time to encode all draw calls distributed across all threads
+            const std::uint64_t encodeStart = LLGL::Timer::Tick();
+            {
+                std::vector<std::thread> workers;
+                workers.reserve(numThreads);
+                for_range(i, numThreads)
+                {
+                    const std::uint32_t numThreadDraws = numDraws / numThreads + (i < numDraws % numThreads ? 1 : 0);
+                    workers.emplace_back(
+                        [this, &secondaryCmdBuffers, i, numThreadDraws]()
+                        {
+                            secondaryCmdBuffers[i]->Begin();
+                            EncodeDraws(*secondaryCmdBuffers[i], numThreadDraws, StateChange::None, 0);
+                            secondaryCmdBuffers[i]->End();
+                        }
+                    );
+                }
+                for (std::thread& worker : workers)
+                    worker.join();
+
+                primaryCmdBuffer->Begin();
+                {
+                    primaryCmdBuffer->BeginRenderPass(*swapChain_);
+                    {
+                        primaryCmdBuffer->SetViewport(swapChain_->GetResolution());
+                        for (LLGL::CommandBuffer* secondaryCmdBuffer : secondaryCmdBuffers)
+                            primaryCmdBuffer->Execute(*secondaryCmdBuffer);
+                    }
+                    primaryCmdBuffer->EndRenderPass();
+                }
+                primaryCmdBuffer->End();
+            }
+            result.encodeTime = TicksToSeconds(LLGL::Timer::Tick() - encodeStart);
+
+            const std::uint64_t submitStart = LLGL::Timer::Tick();
+            {
+                cmdQueue_->Submit(*primaryCmdBuffer);
+            }
+            result.submitTime = TicksToSeconds(LLGL::Timer::Tick() - submitStart);
+
+            cmdQueue_->WaitIdle();
+
+            for (LLGL::CommandBuffer* secondaryCmdBuffer : secondaryCmdBuffers)
+                renderer_->Release(*secondaryCmdBuffer);
+            renderer_->Release(*primaryCmdBuffer);
+
+            PrintResult(result);
+            return result;
+        }
+
+        static void PrintResult(const BenchmarkResult& result)
+        {
+            LLGL::Log::Printf(
+                "%-28s interval=%-3u threads=%-2u draws/s=%12.0f encode=%8.3f ms submit=%8.3f ms\n",
+                result.name.c_str(), result.changeInterval, result.numThreads, result.DrawsPerSecond(),
+                result.encodeTime * 1000.0, result.submitTime * 1000.0
+            );
+        }
+
+    private:
+
+        std::string                 module_;
+        LLGL::RenderSystemPtr       renderer_;
+        LLGL::SwapChain*            swapChain_          = nullptr;
+        LLGL::CommandQueue*         cmdQueue_           = nullptr;
+
+        LLGL::Shader*               vertexShader_       = nullptr;
+        LLGL::Shader*               fragmentShader_     = nullptr;
+        LLGL::PipelineLayout*       pipelineLayout_     = nullptr;
+        LLGL::PipelineState*        pipelineStates_[2]  = {};
+        LLGL::ResourceHeap*         resourceHeaps_[2]   = {};
+        LLGL::Buffer*               vertexBuffers_[2]   = {};
+        LLGL::Buffer*               constantBuffers_[2] = {};
+
+};
+
+static void WriteJSONResult(FILE* file, const BenchmarkResult& result)
+{
+    std::fprintf(
+        file,
+        "{ \"module\": \"%s\", \"name\": \"%s\", \"draws\": %u, \"changeInterval\": %u, \"threads\": %u, "
+        "\"encodeSeconds\": %.9f, \"submitSeconds\": %.9f, \"drawsPerSecond\": %.1f }",
+        result.module.c_str(), result.name.c_str(), result.numDraws, result.changeInterval, result.numThreads,
+        result.encodeTime, result.submitTime, result.DrawsPerSecond()
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments
+    BenchmarkConfig config;
+
+    const BenchmarkCommandLine cmdLine = ParseBenchmarkCommandLine(
+        argc, argv,
+        [&config](const char* arg) -> bool
+        {
+            if (const char* value = MatchBenchmarkOption(arg, "--draws="))
+                config.numDraws = static_cast<std::uint32_t>(std::max(1, std::atoi(value)));
+            else if (const char* value = MatchBenchmarkOption(arg, "--threads="))
+                config.maxThreads = static_cast<std::uint32_t>(std::max(1, std::atoi(value)));
+            else
+                return false;
+            return true;
+        }
+    );
+
+    // Run benchmarks for each module
+    std::vector<BenchmarkResult> results;
+    int exitCode = RunBenchmarkModules<DrawCallBenchmark>(cmdLine.modules, config, results);
+
+    if (!cmdLine.jsonFilename.empty())
+    {
+        if (!WriteBenchmarkJSON(cmdLine.jsonFilename, "DrawCalls", results, WriteJSONResult))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+
+// ================================================================================
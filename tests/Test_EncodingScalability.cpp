@@ -0,0 +1,504 @@
+/*
+ * Test_EncodingScalability.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/CPUProfiler.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/Utility.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Benchmark for the scalability of multi-threaded command encoding.
+Usage: Test_EncodingScalability [MODULE...] [--draws=N] [--threads=N] [--repeat=N] [--json=FILE]
+If no module is specified, all available modules are benchmarked.
+The same scene is encoded with 1 to N threads into one secondary command buffer per thread.
+Each thread encodes an equal slice of the scene, which changes its pipeline state, resource heap, vertex buffer, and uniforms regularly.
+The speedup is relative to the encoding time with a single thread. Lock contention is taken from the CPU profiler counters
+"<NAME>.Contentions" and "<NAME>.WaitTicks", which LLGL records for its internal mutexes while CPU profiling is enabled.
+Shaders are loaded from the Testbed, so this must run in the 'tests/' directory.
+*/
+
+struct BenchmarkConfig
+{
+    std::uint32_t   numDraws        = 100000;
+    std::uint32_t   maxThreads      = 0;    // Zero for the number of hardware threads
+    std::uint32_t   numRepetitions  = 10;
+};
+
+struct LockContention
+{
+    std::string     name;
+    std::int64_t    contentions = 0;
+    double          waitTime    = 0.0;  // Seconds
+};
+
+struct BenchmarkResult
+{
+    std::string                 module;
+    std::uint32_t               numDraws        = 0;
+    std::uint32_t               numThreads      = 1;
+    double                      encodeTime      = 0.0;  // Median wall time (in seconds) until all threads finished encoding
+    double                      threadTime      = 0.0;  // Median of the average time (in seconds) each thread spent encoding
+    double                      speedup         = 1.0;  // Relative to the single-threaded encoding time
+    std::vector<LockContention> locks;                  // Accumulated over all repetitions
+
+    double Efficiency() const
+    {
+        return speedup / static_cast<double>(numThreads);
+    }
+};
+
+static double MedianValue(std::vector<double>& values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static bool EndsWith(const std::string& s, const char* suffix)
+{
+    const std::size_t suffixLen = std::strlen(suffix);
+    return (s.size() >= suffixLen && s.compare(s.size() - suffixLen, suffixLen, suffix) == 0);
+}
+
+class EncodingScalabilityBenchmark
+{
+
+    public:
+
+        bool Load(const std::string& moduleName)
+        {
+            module_ = moduleName;
+
+            // Load renderer
+            LLGL::Report report;
+            renderer_ = LLGL::RenderSystem::Load(moduleName, &report);
+            if (!renderer_)
+            {
+                LLGL::Log::Errorf("failed to load render system: %s\n", moduleName.c_str());
+                if (report.HasErrors())
+                    LLGL::Log::Errorf("%s", report.GetText());
+                return false;
+            }
+
+            // Create swap-chain to render into; it is never presented
+            LLGL::SwapChainDescriptor swapChainDesc;
+            {
+                swapChainDesc.resolution = { 64, 64 };
+            }
+            swapChain_ = renderer_->CreateSwapChain(swapChainDesc);
+            cmdQueue_ = renderer_->GetCommandQueue();
+
+            return (LoadShaders() && CreateResources());
+        }
+
+        void Run(const BenchmarkConfig& config, std::vector<BenchmarkResult>& results)
+        {
+            LLGL::Log::Printf("\nrun encoding scalability benchmarks for %s ...\n", renderer_->GetName());
+
+            const std::uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            const std::uint32_t maxThreads = (config.maxThreads > 0 ? config.maxThreads : hardwareThreads);
+
+            std::vector<std::uint32_t> threadCounts;
+            for (std::uint32_t numThreads = 1; numThreads < maxThreads; numThreads *= 2)
+                threadCounts.push_back(numThreads);
+            threadCounts.push_back(maxThreads);
+
+            // Lock contention is only recorded while the CPU profiler is enabled
+            const bool wasProfilerEnabled = LLGL::CPUProfiler::IsEnabled();
+            LLGL::CPUProfiler::SetEnabled(true);
+
+            double singleThreadTime = 0.0;
+            for (std::uint32_t numThreads : threadCounts)
+            {
+                BenchmarkResult result = RunThreads(config, numThreads);
+                if (numThreads == 1)
+                    singleThreadTime = result.encodeTime;
+                result.speedup = (result.encodeTime > 0.0 ? singleThreadTime / result.encodeTime : 0.0);
+                PrintResult(result);
+                results.push_back(std::move(result));
+            }
+
+            LLGL::CPUProfiler::SetEnabled(wasProfilerEnabled);
+        }
+
+        void Release()
+        {
+            renderer_.reset();
+        }
+
+    private:
+
+        bool IsShadingLanguageSupported(LLGL::ShadingLanguage language) const
+        {
+            const auto& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            return (std::find(languages.begin(), languages.end(), language) != languages.end());
+        }
+
+        bool LoadShaders()
+        {
+            const std::string shaderPath = "Testbed/Shaders/";
+
+            LLGL::ShaderDescriptor vsDesc, fsDesc;
+
+            if (IsShadingLanguageSupported(LLGL::ShadingLanguage::HLSL))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.hlsl").c_str(), "VSMain", "vs_5_0");
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.hlsl").c_str(), "PSMain", "ps_5_0");
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::SPIRV))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.450core.vert.spv").c_str());
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.450core.frag.spv").c_str());
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::Metal))
+            {
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.metal").c_str(), "VSMain", "1.1");
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.metal").c_str(), "PSMain", "1.1");
+            }
+            else
+            {
+                // GLSL is also used for backends without shader compilation, such as the Null renderer
+                vsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.330core.vert").c_str());
+                fsDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.330core.frag").c_str());
+            }
+
+            vertexShader_   = renderer_->CreateShader(vsDesc);
+            fragmentShader_ = renderer_->CreateShader(fsDesc);
+
+            for (LLGL::Shader* shader : { vertexShader_, fragmentShader_ })
+            {
+                if (const LLGL::Report* report = shader->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        LLGL::Log::Errorf("%s", report->GetText());
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        bool CreateResources()
+        {
+            // Create two of each resource to switch between
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = 256;
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = { LLGL::VertexAttribute{ "position", LLGL::Format::RGBA32Float, 0, 0, sizeof(float) * 4 } };
+            }
+            LLGL::BufferDescriptor constantBufferDesc;
+            {
+                constantBufferDesc.size         = 256;
+                constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            for_range(i, 2)
+            {
+                vertexBuffers_[i]   = renderer_->CreateBuffer(vertexBufferDesc);
+                constantBuffers_[i] = renderer_->CreateBuffer(constantBufferDesc);
+            }
+
+            // Create pipeline layout with a resource heap that is not used by the shaders, but still has to be bound by the backend
+            pipelineLayout_ = renderer_->CreatePipelineLayout(LLGL::Parse("heap{cbuffer(Dummy@3):frag},float4(clearColor)"));
+
+            for_range(i, 2)
+            {
+                LLGL::ResourceViewDescriptor resourceView{ constantBuffers_[i] };
+                resourceHeaps_[i] = renderer_->CreateResourceHeap(LLGL::ResourceHeapDescriptor{ pipelineLayout_, 1 }, { resourceView });
+            }
+
+            // Create two PSOs that only differ in their rasterizer state
+            for_range(i, 2)
+            {
+                LLGL::GraphicsPipelineDescriptor psoDesc;
+                {
+                    psoDesc.pipelineLayout          = pipelineLayout_;
+                    psoDesc.renderPass              = swapChain_->GetRenderPass();
+                    psoDesc.vertexShader            = vertexShader_;
+                    psoDesc.fragmentShader          = fragmentShader_;
+                    psoDesc.rasterizer.cullMode     = (i == 0 ? LLGL::CullMode::Disabled : LLGL::CullMode::Back);
+                }
+                pipelineStates_[i] = renderer_->CreatePipelineState(psoDesc);
+                if (const LLGL::Report* report = pipelineStates_[i]->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        LLGL::Log::Errorf("%s", report->GetText());
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // Encodes one slice of the scene and changes a different state every few draws like a typical scene would.
+        void EncodeSlice(LLGL::CommandBuffer& cmdBuffer, std::uint32_t firstDraw, std::uint32_t numDraws)
+        {
+            const float colors[2][4] =
+            {
+                { 0.2f, 0.4f, 0.6f, 1.0f },
+                { 0.6f, 0.4f, 0.2f, 1.0f },
+            };
+
+            cmdBuffer.SetViewport(swapChain_->GetResolution());
+            cmdBuffer.SetPipelineState(*pipelineStates_[0]);
+            cmdBuffer.SetResourceHeap(*resourceHeaps_[0]);
+            cmdBuffer.SetVertexBuffer(*vertexBuffers_[0]);
+            cmdBuffer.SetUniforms(0, colors[0], sizeof(colors[0]));
+
+            for (std::uint32_t i = firstDraw, end = firstDraw + numDraws; i < end; ++i)
+            {
+                const std::uint32_t index = (i / 16) % 2;
+                if (i % 64 == 0)
+                    cmdBuffer.SetPipelineState(*pipelineStates_[index]);
+                if (i % 16 == 0)
+                    cmdBuffer.SetResourceHeap(*resourceHeaps_[index]);
+                if (i % 32 == 0)
+                    cmdBuffer.SetVertexBuffer(*vertexBuffers_[index]);
+                if (i % 4 == 0)
+                    cmdBuffer.SetUniforms(0, colors[(i / 4) % 2], sizeof(colors[0]));
+                cmdBuffer.Draw(3, 0);
+            }
+        }
+
+        LLGL::CommandBuffer* CreateCommandBuffer(long flags)
+        {
+            LLGL::CommandBufferDescriptor cmdBufferDesc;
+            {
+                cmdBufferDesc.flags         = flags;
+                cmdBufferDesc.renderPass    = ((flags & LLGL::CommandBufferFlags::Secondary) != 0 ? swapChain_->GetRenderPass() : nullptr);
+            }
+            return renderer_->CreateCommandBuffer(cmdBufferDesc);
+        }
+
+        BenchmarkResult RunThreads(const BenchmarkConfig& config, std::uint32_t numThreads)
+        {
+            BenchmarkResult result;
+            {
+                result.module       = module_;
+                result.numDraws     = config.numDraws;
+                result.numThreads   = numThreads;
+            }
+
+            std::vector<LLGL::CommandBuffer*> secondaryCmdBuffers(numThreads);
+            for_range(i, numThreads)
+                secondaryCmdBuffers[i] = CreateCommandBuffer(LLGL::CommandBufferFlags::Secondary);
+
+            LLGL::CommandBuffer* primaryCmdBuffer = CreateCommandBuffer(0);
+
+            std::vector<double> encodeTimes, threadTimes;
+            std::vector<std::uint64_t> threadEndTicks(numThreads);
+            std::vector<std::uint64_t> threadTicks(numThreads);
+
+            // Discard all profiler records from before this run
+            LLGL::DynamicVector<LLGL::CPUProfileRegion> regions;
+            LLGL::DynamicVector<LLGL::CPUProfileCounter> counters;
+            LLGL::CPUProfiler::CollectResults(regions);
+
+            for_range(repetition, config.numRepetitions + 1)
+            {
+                // Start all threads at the same time, so thread creation is not part of the measurement
+                std::atomic<bool> startSignal{ false };
+                std::vector<std::thread> workers;
+                workers.reserve(numThreads);
+
+                for_range(i, numThreads)
+                {
+                    const std::uint32_t firstDraw       = static_cast<std::uint32_t>(static_cast<std::uint64_t>(config.numDraws) * i / numThreads);
+                    const std::uint32_t numThreadDraws  = static_cast<std::uint32_t>(static_cast<std::uint64_t>(config.numDraws) * (i + 1) / numThreads) - firstDraw;
+                    workers.emplace_back(
+                        [this, &secondaryCmdBuffers, &threadEndTicks, &threadTicks, &startSignal, i, firstDraw, numThreadDraws]()
+                        {
+                            while (!startSignal.load(std::memory_order_acquire))
+                                std::this_thread::yield();
+
+                            const std::uint64_t startTick = LLGL::Timer::Tick();
+                            secondaryCmdBuffers[i]->Begin();
+                            EncodeSlice(*secondaryCmdBuffers[i], firstDraw, numThreadDraws);
+                            secondaryCmdBuffers[i]->End();
+                            threadEndTicks[i]   = LLGL::Timer::Tick();
+                            threadTicks[i]      = threadEndTicks[i] - startTick;
+                        }
+                    );
+                }
+
+                const std::uint64_t startTick = LLGL::Timer::Tick();
+                startSignal.store(true, std::memory_order_release);
+
+                for (std::thread& worker : workers)
+                    worker.join();
+
+                // First repetition is only used to warm up the command buffers
+                if (repetition > 0)
+                {
+                    const std::uint64_t endTick = *std::max_element(threadEndTicks.begin(), threadEndTicks.end());
+                    encodeTimes.push_back(TicksToSeconds(endTick - startTick));
+
+                    std::uint64_t totalThreadTicks = 0;
+                    for (std::uint64_t ticks : threadTicks)
+                        totalThreadTicks += ticks;
+                    threadTimes.push_back(TicksToSeconds(totalThreadTicks) / numThreads);
+
+                    LLGL::CPUProfiler::CollectResults(regions, &counters);
+                    AccumulateLockContention(counters, result.locks);
+                }
+                else
+                    LLGL::CPUProfiler::CollectResults(regions);
+
+                // Execute all secondary command buffers, so they can be reused by the next repetition
+                primaryCmdBuffer->Begin();
+                {
+                    primaryCmdBuffer->BeginRenderPass(*swapChain_);
+                    {
+                        for (LLGL::CommandBuffer* secondaryCmdBuffer : secondaryCmdBuffers)
+                            primaryCmdBuffer->Execute(*secondaryCmdBuffer);
+                    }
+                    primaryCmdBuffer->EndRenderPass();
+                }
+                primaryCmdBuffer->End();
+                cmdQueue_->Submit(*primaryCmdBuffer);
+                cmdQueue_->WaitIdle();
+            }
+
+            result.encodeTime = MedianValue(encodeTimes);
+            result.threadTime = MedianValue(threadTimes);
+
+            for (LLGL::CommandBuffer* secondaryCmdBuffer : secondaryCmdBuffers)
+                renderer_->Release(*secondaryCmdBuffer);
+            renderer_->Release(*primaryCmdBuffer);
+
+            return result;
+        }
+
+        // Adds all lock contention counters, i.e. "<NAME>.Contentions" and "<NAME>.WaitTicks", to the output list.
+        static void AccumulateLockContention(const LLGL::DynamicVector<LLGL::CPUProfileCounter>& counters, std::vector<LockContention>& locks)
+        {
+            for (const LLGL::CPUProfileCounter& counter : counters)
+            {
+                const std::string counterName = counter.name;
+                const bool isContentions = EndsWith(counterName, ".Contentions");
+                const bool isWaitTicks = EndsWith(counterName, ".WaitTicks");
+                if (!isContentions && !isWaitTicks)
+                    continue;
+
+                const std::string lockName = counterName.substr(0, counterName.rfind('.'));
+                auto it = std::find_if(locks.begin(), locks.end(), [&lockName](const LockContention& lock) { return (lock.name == lockName); });
+                if (it == locks.end())
+                    it = locks.insert(locks.end(), LockContention{ lockName });
+
+                if (isContentions)
+                    it->contentions += counter.value;
+                else
+                    it->waitTime += TicksToSeconds(static_cast<std::uint64_t>(counter.value));
+            }
+        }
+
+        static void PrintResult(const BenchmarkResult& result)
+        {
+            LLGL::Log::Printf(
+                "threads=%-3u encode=%8.3f ms thread=%8.3f ms speedup=%6.2f efficiency=%5.1f%%\n",
+                result.numThreads, result.encodeTime * 1000.0, result.threadTime * 1000.0, result.speedup, result.Efficiency() * 100.0
+            );
+            for (const LockContention& lock : result.locks)
+            {
+                LLGL::Log::Printf(
+                    "  lock %-32s contentions=%-8lld wait=%8.3f ms\n",
+                    lock.name.c_str(), static_cast<long long>(lock.contentions), lock.waitTime * 1000.0
+                );
+            }
+        }
+
+    private:
+
+        std::string                 module_;
+        LLGL::RenderSystemPtr       renderer_;
+        LLGL::SwapChain*            swapChain_          = nullptr;
+        LLGL::CommandQueue*         cmdQueue_           = nullptr;
+
+        LLGL::Shader*               vertexShader_       = nullptr;
+        LLGL::Shader*               fragmentShader_     = nullptr;
+        LLGL::PipelineLayout*       pipelineLayout_     = nullptr;
+        LLGL::PipelineState*        pipelineStates_[2]  = {};
+        LLGL::ResourceHeap*         resourceHeaps_[2]   = {};
+        LLGL::Buffer*               vertexBuffers_[2]   = {};
+        LLGL::Buffer*               constantBuffers_[2] = {};
+
+};
+
+static void WriteJSONResult(FILE* file, const BenchmarkResult& result)
+{
+    std::fprintf(
+        file,
+        "{ \"module\": \"%s\", \"draws\": %u, \"threads\": %u, \"encodeTime\": %.9f, \"threadTime\": %.9f, "
+        "\"speedup\": %.6f, \"efficiency\": %.6f, \"locks\": [",
+        result.module.c_str(), result.numDraws, result.numThreads, result.encodeTime, result.threadTime,
+        result.speedup, result.Efficiency()
+    );
+    for_range(i, result.locks.size())
+    {
+        const LockContention& lock = result.locks[i];
+        std::fprintf(
+            file, "%s{ \"name\": \"%s\", \"contentions\": %lld, \"waitTime\": %.9f }",
+            (i > 0 ? ", " : " "), lock.name.c_str(), static_cast<long long>(lock.contentions), lock.waitTime
+        );
+    }
+    std::fprintf(file, "%s] }", (result.locks.empty() ? "" : " "));
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments
+    BenchmarkConfig config;
+
+    const BenchmarkCommandLine cmdLine = ParseBenchmarkCommandLine(
+        argc, argv,
+        [&config](const char* arg) -> bool
+        {
+            if (const char* value = MatchBenchmarkOption(arg, "--draws="))
+                config.numDraws = static_cast<std::uint32_t>(std::max(1l, std::strtol(value, nullptr, 10)));
+            else if (const char* value = MatchBenchmarkOption(arg, "--threads="))
+                config.maxThreads = static_cast<std::uint32_t>(std::max(1l, std::strtol(value, nullptr, 10)));
+            else if (const char* value = MatchBenchmarkOption(arg, "--repeat="))
+                config.numRepetitions = static_cast<std::uint32_t>(std::max(1l, std::strtol(value, nullptr, 10)));
+            else
+                return false;
+            return true;
+        }
+    );
+
+    // Run benchmarks for each module
+    std::vector<BenchmarkResult> results;
+    int exitCode = RunBenchmarkModules<EncodingScalabilityBenchmark>(cmdLine.modules, config, results);
+
+    if (!cmdLine.jsonFilename.empty())
+    {
+        if (!WriteBenchmarkJSON(cmdLine.jsonFilename, "EncodingScalability", results, WriteJSONResult))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+
+// ================================================================================
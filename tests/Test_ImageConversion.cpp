@@ -0,0 +1,381 @@
+/*
+ * Test_ImageConversion.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/Image.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Micro-benchmark for the CPU image utility functions.
+Usage: Test_ImageConversion [--max-size=PIXELS] [--threads=N] [--min-time=MS] [--json=FILE]
+Measures the throughput in megapixels per second for ConvertImageBuffer (every uncompressed ImageFormat/DataType pair from and to RGBA8),
+CompressImageBuffer and DecompressImageBufferToRGBA8UNorm (BC1-BC5), CopyImageBufferRegion, and Image::Blit.
+Each multi-threaded function is measured for all power-of-two thread counts up to the number of hardware threads,
+so the results show for which image sizes multi-threading pays off.
+*/
+
+struct BenchmarkConfig
+{
+    std::uint32_t   minSize     = 64;
+    std::uint32_t   maxSize     = 2048;
+    unsigned        maxThreads  = 0;        // Zero for the number of hardware threads
+    double          minTime     = 0.02;     // Minimum time (in seconds) to repeat each measurement
+};
+
+struct BenchmarkResult
+{
+    std::string     operation;
+    std::string     srcFormat;
+    std::string     dstFormat;
+    std::uint32_t   size            = 0;    // Width and height of the image
+    unsigned        threads         = 1;
+    std::uint32_t   iterations      = 0;
+    double          megapixelsPerSecond = 0.0;
+};
+
+using BenchmarkFunc = std::function<void()>;
+
+static const LLGL::ImageFormat g_colorFormats[] =
+{
+    LLGL::ImageFormat::Alpha,
+    LLGL::ImageFormat::R,
+    LLGL::ImageFormat::RG,
+    LLGL::ImageFormat::RGB,
+    LLGL::ImageFormat::BGR,
+    LLGL::ImageFormat::RGBA,
+    LLGL::ImageFormat::BGRA,
+    LLGL::ImageFormat::ARGB,
+    LLGL::ImageFormat::ABGR,
+};
+
+static const LLGL::DataType g_dataTypes[] =
+{
+    LLGL::DataType::Int8,
+    LLGL::DataType::UInt8,
+    LLGL::DataType::Int16,
+    LLGL::DataType::UInt16,
+    LLGL::DataType::Int32,
+    LLGL::DataType::UInt32,
+    LLGL::DataType::Float16,
+    LLGL::DataType::Float32,
+    LLGL::DataType::Float64,
+};
+
+static const LLGL::ImageFormat g_compressedFormats[] =
+{
+    LLGL::ImageFormat::BC1,
+    LLGL::ImageFormat::BC2,
+    LLGL::ImageFormat::BC3,
+    LLGL::ImageFormat::BC4,
+    LLGL::ImageFormat::BC5,
+};
+
+static const char* ToString(LLGL::DataType dataType)
+{
+    switch (dataType)
+    {
+        case LLGL::DataType::Undefined: return "Undefined";
+        case LLGL::DataType::Int8:      return "Int8";
+        case LLGL::DataType::UInt8:     return "UInt8";
+        case LLGL::DataType::Int16:     return "Int16";
+        case LLGL::DataType::UInt16:    return "UInt16";
+        case LLGL::DataType::Int32:     return "Int32";
+        case LLGL::DataType::UInt32:    return "UInt32";
+        case LLGL::DataType::Float16:   return "Float16";
+        case LLGL::DataType::Float32:   return "Float32";
+        case LLGL::DataType::Float64:   return "Float64";
+    }
+    return "";
+}
+
+static std::string FormatName(LLGL::ImageFormat format, LLGL::DataType dataType)
+{
+    return std::string(LLGL::ToString(format)) + "/" + ToString(dataType);
+}
+
+class ImageConversionBenchmark
+{
+
+    public:
+
+        ImageConversionBenchmark(const BenchmarkConfig& config) :
+            config_ { config }
+        {
+            const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            const unsigned maxThreads = (config.maxThreads > 0 ? std::min(config.maxThreads, hardwareThreads) : hardwareThreads);
+            for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+                threadCounts_.push_back(threads);
+        }
+
+        void Run(std::vector<BenchmarkResult>& results)
+        {
+            for (std::uint32_t size = config_.minSize; size <= config_.maxSize; size *= 4)
+            {
+                LLGL::Log::Printf("\nrun image benchmarks for %ux%u pixels ...\n", size, size);
+
+                GenerateNoiseImage(size);
+                RunConversions(size, results);
+                RunCompression(size, results);
+                RunRegionCopies(size, results);
+            }
+        }
+
+    private:
+
+        // Generates the RGBA8 source image all other formats are converted from.
+        void GenerateNoiseImage(std::uint32_t size)
+        {
+            noiseImage_.resize(static_cast<std::size_t>(size) * size * 4);
+            std::uint32_t seed = 0x12345678u;
+            for (unsigned char& value : noiseImage_)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                value = static_cast<unsigned char>(seed >> 24);
+            }
+        }
+
+        LLGL::ImageView GetNoiseImageView() const
+        {
+            return LLGL::ImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, noiseImage_.data(), noiseImage_.size() };
+        }
+
+        // Repeats the function until the minimum time has elapsed and stores the throughput.
+        void Measure(
+            const char*                     operation,
+            const std::string&              srcFormat,
+            const std::string&              dstFormat,
+            std::uint32_t                   size,
+            unsigned                        threads,
+            const BenchmarkFunc&            func,
+            std::vector<BenchmarkResult>&   results)
+        {
+            const std::uint32_t minIterations = 3, maxIterations = 10000;
+
+            /* Warm up caches and page in the destination memory */
+            func();
+
+            std::uint32_t iterations = 0;
+            const std::uint64_t startTick = LLGL::Timer::Tick();
+            double elapsed = 0.0;
+
+            while (iterations < maxIterations && (iterations < minIterations || elapsed < config_.minTime))
+            {
+                func();
+                ++iterations;
+                elapsed = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+            }
+
+            BenchmarkResult result;
+            {
+                result.operation            = operation;
+                result.srcFormat            = srcFormat;
+                result.dstFormat            = dstFormat;
+                result.size                 = size;
+                result.threads              = threads;
+                result.iterations           = iterations;
+                result.megapixelsPerSecond  = (static_cast<double>(size) * size * iterations) / (elapsed * 1.0e6);
+            }
+            PrintResult(result);
+            results.push_back(result);
+        }
+
+        void RunConversions(std::uint32_t size, std::vector<BenchmarkResult>& results)
+        {
+            const std::size_t numPixels = static_cast<std::size_t>(size) * size;
+            const std::string rgba8Name = FormatName(LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8);
+
+            std::vector<char> rgba8Buffer(noiseImage_.size());
+
+            for (LLGL::ImageFormat format : g_colorFormats)
+            {
+                for (LLGL::DataType dataType : g_dataTypes)
+                {
+                    if (format == LLGL::ImageFormat::RGBA && dataType == LLGL::DataType::UInt8)
+                        continue;
+
+                    // Prepare the source image in this format outside of the measurement
+                    const std::size_t imageSize = LLGL::GetMemoryFootprint(format, dataType, numPixels);
+                    std::vector<char> imageBuffer(imageSize);
+
+                    const LLGL::MutableImageView dstImageView{ format, dataType, imageBuffer.data(), imageBuffer.size() };
+                    LLGL::ConvertImageBuffer(GetNoiseImageView(), dstImageView, LLGL_MAX_THREAD_COUNT);
+
+                    const LLGL::ImageView srcImageView{ format, dataType, imageBuffer.data(), imageBuffer.size() };
+                    const LLGL::MutableImageView rgba8ImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, rgba8Buffer.data(), rgba8Buffer.size() };
+                    const std::string formatName = FormatName(format, dataType);
+
+                    for (unsigned threads : threadCounts_)
+                    {
+                        // Conversion to RGBA8, e.g. after reading back a texture
+                        Measure(
+                            "ConvertImageBuffer", formatName, rgba8Name, size, threads,
+                            [&]() { LLGL::ConvertImageBuffer(srcImageView, rgba8ImageView, threads); },
+                            results
+                        );
+
+                        // Conversion from RGBA8, e.g. before uploading an image to a texture
+                        Measure(
+                            "ConvertImageBuffer", rgba8Name, formatName, size, threads,
+                            [&]() { LLGL::ConvertImageBuffer(GetNoiseImageView(), dstImageView, threads); },
+                            results
+                        );
+                    }
+                }
+            }
+        }
+
+        void RunCompression(std::uint32_t size, std::vector<BenchmarkResult>& results)
+        {
+            const LLGL::Extent2D extent{ size, size };
+            const std::string rgba8Name = FormatName(LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8);
+
+            for (LLGL::ImageFormat format : g_compressedFormats)
+            {
+                const LLGL::DynamicByteArray compressedImage = LLGL::CompressImageBuffer(GetNoiseImageView(), extent, format, LLGL_MAX_THREAD_COUNT);
+                if (!compressedImage)
+                    continue;
+
+                const LLGL::ImageView compressedImageView{ format, LLGL::DataType::UInt8, compressedImage.get(), compressedImage.size() };
+                const std::string formatName = LLGL::ToString(format);
+
+                for (unsigned threads : threadCounts_)
+                {
+                    Measure(
+                        "CompressImageBuffer", rgba8Name, formatName, size, threads,
+                        [&]() { LLGL::CompressImageBuffer(GetNoiseImageView(), extent, format, threads); },
+                        results
+                    );
+                    Measure(
+                        "DecompressImageBufferToRGBA8UNorm", formatName, rgba8Name, size, threads,
+                        [&]() { LLGL::DecompressImageBufferToRGBA8UNorm(compressedImageView, extent, threads); },
+                        results
+                    );
+                }
+            }
+        }
+
+        // Copies the center quarter of an image; these functions are single-threaded.
+        void RunRegionCopies(std::uint32_t size, std::vector<BenchmarkResult>& results)
+        {
+            const std::uint32_t regionSize = std::max(1u, size / 2);
+            const std::int32_t regionOffset = static_cast<std::int32_t>(size / 4);
+            const LLGL::Extent3D imageExtent{ size, size, 1 };
+            const LLGL::Extent3D regionExtent{ regionSize, regionSize, 1 };
+            const LLGL::Offset3D offset{ regionOffset, regionOffset, 0 };
+
+            const LLGL::DataType dataTypes[] = { LLGL::DataType::UInt8, LLGL::DataType::Float32 };
+
+            for (LLGL::DataType dataType : dataTypes)
+            {
+                LLGL::Image srcImage{ imageExtent, LLGL::ImageFormat::RGBA, dataType };
+                LLGL::Image dstImage{ imageExtent, LLGL::ImageFormat::RGBA, dataType };
+                LLGL::ConvertImageBuffer(GetNoiseImageView(), srcImage.GetMutableView(), LLGL_MAX_THREAD_COUNT);
+
+                const std::string formatName = FormatName(LLGL::ImageFormat::RGBA, dataType);
+
+                Measure(
+                    "CopyImageBufferRegion", formatName, formatName, regionSize, 1,
+                    [&]()
+                    {
+                        LLGL::CopyImageBufferRegion(
+                            dstImage.GetMutableView(), offset, size, size * size,
+                            srcImage.GetView(), offset, size, size * size,
+                            regionExtent
+                        );
+                    },
+                    results
+                );
+                Measure(
+                    "Image::Blit", formatName, formatName, regionSize, 1,
+                    [&]() { dstImage.Blit(offset, srcImage, offset, regionExtent); },
+                    results
+                );
+            }
+        }
+
+        static void PrintResult(const BenchmarkResult& result)
+        {
+            LLGL::Log::Printf(
+                "%-34s %-14s -> %-14s size=%-5u threads=%-3u MPix/s=%10.2f\n",
+                result.operation.c_str(), result.srcFormat.c_str(), result.dstFormat.c_str(), result.size, result.threads, result.megapixelsPerSecond
+            );
+        }
+
+    private:
+
+        BenchmarkConfig             config_;
+        std::vector<unsigned>       threadCounts_;
+        std::vector<unsigned char>  noiseImage_;
+
+};
+
+static void WriteJSONResult(FILE* file, const BenchmarkResult& result)
+{
+    std::fprintf(
+        file,
+        "{ \"operation\": \"%s\", \"srcFormat\": \"%s\", \"dstFormat\": \"%s\", \"size\": %u, \"threads\": %u, \"iterations\": %u, "
+        "\"megapixelsPerSecond\": %.6f }",
+        result.operation.c_str(), result.srcFormat.c_str(), result.dstFormat.c_str(), result.size, result.threads, result.iterations,
+        result.megapixelsPerSecond
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments; this benchmark does not use any render system modules
+    BenchmarkConfig config;
+
+    const BenchmarkCommandLine cmdLine = ParseBenchmarkCommandLine(
+        argc, argv,
+        [&config](const char* arg) -> bool
+        {
+            if (const char* value = MatchBenchmarkOption(arg, "--max-size="))
+                config.maxSize = std::max(config.minSize, static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10)));
+            else if (const char* value = MatchBenchmarkOption(arg, "--threads="))
+                config.maxThreads = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+            else if (const char* value = MatchBenchmarkOption(arg, "--min-time="))
+                config.minTime = static_cast<double>(std::strtoul(value, nullptr, 10)) / 1000.0;
+            else
+                return false;
+            return true;
+        },
+        false
+    );
+
+    // Run benchmarks
+    std::vector<BenchmarkResult> results;
+    int exitCode = 0;
+
+    ImageConversionBenchmark benchmark{ config };
+    benchmark.Run(results);
+
+    if (!cmdLine.jsonFilename.empty())
+    {
+        if (!WriteBenchmarkJSON(cmdLine.jsonFilename, "ImageConversion", results, WriteJSONResult))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+
+// ================================================================================
@@ -0,0 +1,480 @@
+/*
+ * Test_PipelineCreation.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/Utility.h>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+Benchmark for shader compilation and pipeline state creation with and without a pipeline cache.
+Usage: Test_PipelineCreation [MODULE...] [--pipelines=N] [--json=FILE]
+If no module is specified, all available modules are benchmarked.
+Each pipeline is created from its own shaders with a unique macro, so the shader compiler cannot share work between permutations.
+The same set of permutations is created in the following cache modes:
+  - NoCache:    Without pipeline cache.
+  - Cold:       With a new empty pipeline cache.
+  - InMemory:   With the same pipeline cache that was filled during the Cold round.
+  - Warm:       With a new pipeline cache that was initialized with the blob of the Cold round (see PipelineCache::GetBlob).
+*/
+
+struct BenchmarkConfig
+{
+    std::uint32_t   numPipelines    = 64;
+};
+
+enum class CacheMode
+{
+    NoCache,
+    Cold,
+    InMemory,
+    Warm,
+};
+
+// Accumulated time (in seconds) for each stage of pipeline creation.
+struct StageTimes
+{
+    double shaderCompile    = 0.0;
+    double reflection       = 0.0;
+    double pipelineLayout   = 0.0;
+    double pipelineState    = 0.0;
+
+    double Total() const
+    {
+        return (shaderCompile + reflection + pipelineLayout + pipelineState);
+    }
+};
+
+struct BenchmarkResult
+{
+    std::string     module;
+    std::string     pipelineType;   // "Graphics" or "Compute"
+    std::string     cacheMode;
+    std::uint32_t   numPipelines    = 0;
+    std::uint32_t   numFailed       = 0;
+    std::uint64_t   cacheBlobSize   = 0;    // Size of the pipeline cache blob after this round
+    StageTimes      averageTimes;           // Average times per pipeline
+};
+
+static const char* ToString(CacheMode mode)
+{
+    switch (mode)
+    {
+        case CacheMode::NoCache:    return "NoCache";
+        case CacheMode::Cold:       return "Cold";
+        case CacheMode::InMemory:   return "InMemory";
+        case CacheMode::Warm:       return "Warm";
+    }
+    return "";
+}
+
+class PipelineCreationBenchmark
+{
+
+    public:
+
+        bool Load(const std::string& moduleName)
+        {
+            module_ = moduleName;
+
+            LLGL::Report report;
+            renderer_ = LLGL::RenderSystem::Load(moduleName, &report);
+            if (!renderer_)
+            {
+                LLGL::Log::Errorf("failed to load render system: %s\n", moduleName.c_str());
+                if (report.HasErrors())
+                    LLGL::Log::Errorf("%s", report.GetText());
+                return false;
+            }
+
+            // Create swap-chain for the render pass of all graphics pipelines; it is never presented
+            LLGL::SwapChainDescriptor swapChainDesc;
+            {
+                swapChainDesc.resolution = { 64, 64 };
+            }
+            swapChain_ = renderer_->CreateSwapChain(swapChainDesc);
+
+            return SelectShaderSources();
+        }
+
+        void Run(const BenchmarkConfig& config, std::vector<BenchmarkResult>& results)
+        {
+            LLGL::Log::Printf("\nrun pipeline creation benchmarks for %s ...\n", renderer_->GetName());
+
+            RunCacheModes(config, false, results);
+
+            if (hasComputeShaders_)
+                RunCacheModes(config, true, results);
+        }
+
+        void Release()
+        {
+            renderer_.reset();
+        }
+
+    private:
+
+        // Holds all objects that were created for a single pipeline permutation.
+        struct PipelineObjects
+        {
+            LLGL::Shader*           shaders[2]      = {};
+            LLGL::PipelineLayout*   pipelineLayout  = nullptr;
+            LLGL::PipelineState*    pipelineState   = nullptr;
+        };
+
+        bool IsShadingLanguageSupported(LLGL::ShadingLanguage language) const
+        {
+            const auto& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            return (std::find(languages.begin(), languages.end(), language) != languages.end());
+        }
+
+        bool SelectShaderSources()
+        {
+            const std::string shaderPath = "Testbed/Shaders/";
+
+            hasComputeShaders_ = renderer_->GetRenderingCaps().features.hasComputeShaders;
+
+            if (IsShadingLanguageSupported(LLGL::ShadingLanguage::HLSL))
+            {
+                vsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.hlsl").c_str(), "VSMain", "vs_5_0");
+                fsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.hlsl").c_str(), "PSMain", "ps_5_0");
+                csDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Compute,  (shaderPath + "ResourceBinding.hlsl").c_str(), "CSMain", "cs_5_0");
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::SPIRV))
+            {
+                vsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.450core.vert.spv").c_str());
+                fsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.450core.frag.spv").c_str());
+                csDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Compute,  (shaderPath + "ResourceBinding.450core.comp.spv").c_str());
+            }
+            else if (IsShadingLanguageSupported(LLGL::ShadingLanguage::Metal))
+            {
+                vsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.metal").c_str(), "VSMain", "1.1");
+                fsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.metal").c_str(), "PSMain", "1.1");
+
+                // No Metal version of the compute shader available
+                hasComputeShaders_ = false;
+            }
+            else
+            {
+                // GLSL is also used for backends without shader compilation, such as the Null renderer
+                vsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (shaderPath + "ClearScreen.330core.vert").c_str());
+                fsDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (shaderPath + "ClearScreen.330core.frag").c_str());
+                if (IsShadingLanguageSupported(LLGL::ShadingLanguage::GLSL_450))
+                    csDesc_ = LLGL::ShaderDescFromFile(LLGL::ShaderType::Compute, (shaderPath + "ResourceBinding.450core.comp").c_str());
+                else
+                    hasComputeShaders_ = false;
+            }
+
+            return true;
+        }
+
+        void RunCacheModes(const BenchmarkConfig& config, bool isCompute, std::vector<BenchmarkResult>& results)
+        {
+            // Round without cache as baseline
+            results.push_back(RunRound(config, isCompute, CacheMode::NoCache, nullptr));
+
+            // Fill a new cache, then reuse it in memory, and finally restore a new cache from its blob
+            LLGL::PipelineCache* cache = renderer_->CreatePipelineCache();
+            results.push_back(RunRound(config, isCompute, CacheMode::Cold, cache));
+            results.push_back(RunRound(config, isCompute, CacheMode::InMemory, cache));
+
+            LLGL::Blob cacheBlob = cache->GetBlob();
+            renderer_->Release(*cache);
+
+            LLGL::PipelineCache* warmCache = renderer_->CreatePipelineCache(cacheBlob);
+            results.push_back(RunRound(config, isCompute, CacheMode::Warm, warmCache));
+            renderer_->Release(*warmCache);
+        }
+
+        BenchmarkResult RunRound(const BenchmarkConfig& config, bool isCompute, CacheMode mode, LLGL::PipelineCache* cache)
+        {
+            BenchmarkResult result;
+            {
+                result.module       = module_;
+                result.pipelineType = (isCompute ? "Compute" : "Graphics");
+                result.cacheMode    = ToString(mode);
+                result.numPipelines = config.numPipelines;
+            }
+
+            // Keep all objects alive until the end of the round, so the backend cannot recycle any of them
+            std::vector<PipelineObjects> pipelines(config.numPipelines);
+            StageTimes totalTimes;
+
+            for_range(i, config.numPipelines)
+            {
+                const bool succeeded =
+                (
+                    isCompute
+                        ? CreateComputePermutation(i, cache, pipelines[i], totalTimes)
+                        : CreateGraphicsPermutation(i, cache, pipelines[i], totalTimes)
+                );
+                if (!succeeded)
+                    ++result.numFailed;
+            }
+
+            for (PipelineObjects& objects : pipelines)
+                ReleasePipelineObjects(objects);
+
+            if (cache != nullptr)
+                result.cacheBlobSize = cache->GetBlob().GetSize();
+
+            if (config.numPipelines > 0)
+            {
+                const double scale = 1.0 / static_cast<double>(config.numPipelines);
+                result.averageTimes.shaderCompile   = totalTimes.shaderCompile  * scale;
+                result.averageTimes.reflection      = totalTimes.reflection     * scale;
+                result.averageTimes.pipelineLayout  = totalTimes.pipelineLayout * scale;
+                result.averageTimes.pipelineState   = totalTimes.pipelineState  * scale;
+            }
+
+            PrintResult(result);
+
+            return result;
+        }
+
+        // Creates a shader with a macro that is unique for each permutation. SPIR-V modules ignore the macro.
+        LLGL::Shader* CreatePermutationShader(const LLGL::ShaderDescriptor& baseDesc, std::uint32_t permutation)
+        {
+            const std::string permutationValue = std::to_string(permutation);
+            const LLGL::ShaderMacro defines[] =
+            {
+                LLGL::ShaderMacro{ "PERMUTATION_ID", permutationValue.c_str() },
+                LLGL::ShaderMacro{ nullptr, nullptr }
+            };
+
+            LLGL::ShaderDescriptor shaderDesc = baseDesc;
+            shaderDesc.defines = defines;
+
+            return renderer_->CreateShader(shaderDesc);
+        }
+
+        static bool HasShaderErrors(const LLGL::Shader* shader)
+        {
+            if (const LLGL::Report* report = shader->GetReport())
+            {
+                if (report->HasErrors())
+                {
+                    LLGL::Log::Errorf("%s", report->GetText());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static bool HasPipelineErrors(const LLGL::PipelineState* pipelineState)
+        {
+            if (const LLGL::Report* report = pipelineState->GetReport())
+            {
+                if (report->HasErrors())
+                {
+                    LLGL::Log::Errorf("%s", report->GetText());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns the pipeline layout descriptor from the shader reflection including its uniforms.
+        static LLGL::PipelineLayoutDescriptor GetLayoutFromReflection(const LLGL::ShaderReflection& reflection)
+        {
+            LLGL::PipelineLayoutDescriptor layoutDesc = LLGL::PipelineLayoutDesc(reflection);
+            layoutDesc.uniforms = reflection.uniforms;
+            return layoutDesc;
+        }
+
+        bool CreateGraphicsPermutation(std::uint32_t permutation, LLGL::PipelineCache* cache, PipelineObjects& outObjects, StageTimes& times)
+        {
+            // Shader compilation
+            std::uint64_t startTick = LLGL::Timer::Tick();
+            {
+                outObjects.shaders[0] = CreatePermutationShader(vsDesc_, permutation);
+                outObjects.shaders[1] = CreatePermutationShader(fsDesc_, permutation);
+            }
+            times.shaderCompile += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            if (HasShaderErrors(outObjects.shaders[0]) || HasShaderErrors(outObjects.shaders[1]))
+                return false;
+
+            // Shader reflection; only the fragment shader has resources
+            LLGL::ShaderReflection reflection;
+            startTick = LLGL::Timer::Tick();
+            const bool hasReflection = outObjects.shaders[1]->Reflect(reflection);
+            times.reflection += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            // Pipeline layout; fall back to the known layout of the shader if reflection is not supported
+            startTick = LLGL::Timer::Tick();
+            {
+                outObjects.pipelineLayout = renderer_->CreatePipelineLayout(
+                    hasReflection ? GetLayoutFromReflection(reflection) : LLGL::Parse("float4(clearColor)")
+                );
+            }
+            times.pipelineLayout += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            // Permutate the render states, so every pipeline is different
+            const LLGL::CullMode cullModes[] = { LLGL::CullMode::Disabled, LLGL::CullMode::Front, LLGL::CullMode::Back };
+            const LLGL::BlendOp srcBlendOps[] = { LLGL::BlendOp::SrcAlpha, LLGL::BlendOp::One, LLGL::BlendOp::DstColor, LLGL::BlendOp::SrcAlphaSaturate };
+
+            LLGL::GraphicsPipelineDescriptor psoDesc;
+            {
+                psoDesc.pipelineLayout                  = outObjects.pipelineLayout;
+                psoDesc.renderPass                      = swapChain_->GetRenderPass();
+                psoDesc.vertexShader                    = outObjects.shaders[0];
+                psoDesc.fragmentShader                  = outObjects.shaders[1];
+                psoDesc.rasterizer.cullMode             = cullModes[permutation % 3];
+                psoDesc.blend.targets[0].blendEnabled   = ((permutation / 3) % 2 != 0);
+                psoDesc.depth.testEnabled               = ((permutation / 6) % 2 != 0);
+                psoDesc.depth.writeEnabled              = psoDesc.depth.testEnabled;
+                psoDesc.primitiveTopology               = ((permutation / 12) % 2 != 0 ? LLGL::PrimitiveTopology::TriangleStrip : LLGL::PrimitiveTopology::TriangleList);
+                psoDesc.blend.targets[0].srcColor       = srcBlendOps[(permutation / 24) % 4];
+            }
+
+            // Native pipeline state
+            startTick = LLGL::Timer::Tick();
+            outObjects.pipelineState = renderer_->CreatePipelineState(psoDesc, cache);
+            times.pipelineState += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            return !HasPipelineErrors(outObjects.pipelineState);
+        }
+
+        bool CreateComputePermutation(std::uint32_t permutation, LLGL::PipelineCache* cache, PipelineObjects& outObjects, StageTimes& times)
+        {
+            // Shader compilation
+            std::uint64_t startTick = LLGL::Timer::Tick();
+            outObjects.shaders[0] = CreatePermutationShader(csDesc_, permutation);
+            times.shaderCompile += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            if (HasShaderErrors(outObjects.shaders[0]))
+                return false;
+
+            // Shader reflection
+            LLGL::ShaderReflection reflection;
+            startTick = LLGL::Timer::Tick();
+            const bool hasReflection = outObjects.shaders[0]->Reflect(reflection);
+            times.reflection += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            // Pipeline layout; fall back to the known layout of the shader if reflection is not supported
+            startTick = LLGL::Timer::Tick();
+            {
+                outObjects.pipelineLayout = renderer_->CreatePipelineLayout(
+                    hasReflection
+                        ? GetLayoutFromReflection(reflection)
+                        : LLGL::Parse(
+                            "buffer(inBufferA@0,inBufferB@1):comp,rwbuffer(outBufferA@2,outBufferB@4):comp,"
+                            "texture(inTextureA@2,inTextureB@4):comp,rwtexture(outTextureA@0,outTextureB@1):comp"
+                        )
+                );
+            }
+            times.pipelineLayout += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            LLGL::ComputePipelineDescriptor psoDesc;
+            {
+                psoDesc.pipelineLayout  = outObjects.pipelineLayout;
+                psoDesc.computeShader   = outObjects.shaders[0];
+            }
+
+            // Native pipeline state
+            startTick = LLGL::Timer::Tick();
+            outObjects.pipelineState = renderer_->CreatePipelineState(psoDesc, cache);
+            times.pipelineState += TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+            return !HasPipelineErrors(outObjects.pipelineState);
+        }
+
+        void ReleasePipelineObjects(PipelineObjects& objects)
+        {
+            if (objects.pipelineState != nullptr)
+                renderer_->Release(*objects.pipelineState);
+            if (objects.pipelineLayout != nullptr)
+                renderer_->Release(*objects.pipelineLayout);
+            for (LLGL::Shader* shader : objects.shaders)
+            {
+                if (shader != nullptr)
+                    renderer_->Release(*shader);
+            }
+            objects = PipelineObjects{};
+        }
+
+        static void PrintResult(const BenchmarkResult& result)
+        {
+            const StageTimes& times = result.averageTimes;
+            LLGL::Log::Printf(
+                "%-8s %-8s pipelines=%-4u failed=%-4u total=%9.3f ms compile=%9.3f ms reflect=%9.3f ms layout=%9.3f ms pso=%9.3f ms blob=%llu bytes\n",
+                result.pipelineType.c_str(), result.cacheMode.c_str(), result.numPipelines, result.numFailed,
+                times.Total() * 1000.0, times.shaderCompile * 1000.0, times.reflection * 1000.0, times.pipelineLayout * 1000.0,
+                times.pipelineState * 1000.0, static_cast<unsigned long long>(result.cacheBlobSize)
+            );
+        }
+
+    private:
+
+        std::string                 module_;
+        LLGL::RenderSystemPtr       renderer_;
+        LLGL::SwapChain*            swapChain_          = nullptr;
+        bool                        hasComputeShaders_  = false;
+        LLGL::ShaderDescriptor      vsDesc_;
+        LLGL::ShaderDescriptor      fsDesc_;
+        LLGL::ShaderDescriptor      csDesc_;
+
+};
+
+static void WriteJSONResult(FILE* file, const BenchmarkResult& result)
+{
+    const StageTimes& times = result.averageTimes;
+    std::fprintf(
+        file,
+        "{ \"module\": \"%s\", \"pipelineType\": \"%s\", \"cacheMode\": \"%s\", \"pipelines\": %u, \"failed\": %u, \"cacheBlobSize\": %llu, "
+        "\"secondsPerPipeline\": %.9f, \"shaderCompile\": %.9f, \"reflection\": %.9f, \"pipelineLayout\": %.9f, \"pipelineState\": %.9f }",
+        result.module.c_str(), result.pipelineType.c_str(), result.cacheMode.c_str(), result.numPipelines, result.numFailed,
+        static_cast<unsigned long long>(result.cacheBlobSize), times.Total(), times.shaderCompile, times.reflection,
+        times.pipelineLayout, times.pipelineState
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Parse arguments
+    BenchmarkConfig config;
+
+    const BenchmarkCommandLine cmdLine = ParseBenchmarkCommandLine(
+        argc, argv,
+        [&config](const char* arg) -> bool
+        {
+            if (const char* value = MatchBenchmarkOption(arg, "--pipelines="))
+                config.numPipelines = static_cast<std::uint32_t>(std::max(1l, std::strtol(value, nullptr, 10)));
+            else
+                return false;
+            return true;
+        }
+    );
+
+    // Run benchmarks for each module
+    std::vector<BenchmarkResult> results;
+    int exitCode = RunBenchmarkModules<PipelineCreationBenchmark>(cmdLine.modules, config, results);
+
+    if (!cmdLine.jsonFilename.empty())
+    {
+        if (!WriteBenchmarkJSON(cmdLine.jsonFilename, "PipelineCreation", results, WriteJSONResult))
+            exitCode = 1;
+    }
+
+    return exitCode;
+}
+
+
+
+
+// ================================================================================
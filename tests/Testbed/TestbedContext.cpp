@@ -10,6 +10,9 @@
 #include <LLGL/Utils/Parse.h>
 #include <Gauss/ProjectionMatrix4.h>
 #include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
 #include <fstream>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -20,6 +23,9 @@
 
 
 static constexpr const char* g_defaultOutputDir = "Output/";
+static constexpr const char* g_defaultPerfBaselineDir = "Reference/";
+static constexpr unsigned g_defaultPerfIterations = 30;
+static constexpr double g_perfMinRegression = 0.05; // Regressions below 0.05 ms are considered noise
 
 // Returns true of the specified list of (generic) arguments contains the search string
 static bool HasArgument(int argc, char* argv[], const char* search, const char** value = nullptr)
@@ -103,6 +109,33 @@ static std::string GetSanitizedOutputDir(int argc, char* argv[])
     return SanitizePath(FindOutputDir(argc, argv));
 }
 
+static unsigned FindPerfIterations(int argc, char* argv[])
+{
+    const char* value = nullptr;
+    if (HasArgument(argc, argv, "--perf", &value))
+    {
+        const int iterations = ::atoi(value);
+        return (iterations > 0 ? static_cast<unsigned>(iterations) : g_defaultPerfIterations);
+    }
+    return 0;
+}
+
+static double FindPerfThreshold(int argc, char* argv[])
+{
+    const char* value = nullptr;
+    if (HasArgument(argc, argv, "--perf-threshold", &value) && *value != '\0')
+        return ::atof(value) / 100.0;
+    return 0.2;
+}
+
+static std::string FindPerfBaselineDir(int argc, char* argv[])
+{
+    const char* value = nullptr;
+    if (HasArgument(argc, argv, "--perf-baseline", &value) && *value != '\0')
+        return SanitizePath(value);
+    return g_defaultPerfBaselineDir;
+}
+
 static void ConfigureOpenGL(RendererConfigurationOpenGL& cfg, int version)
 {
     if (version != 0)
@@ -184,6 +217,24 @@ TestbedContext::TestbedContext(const char* moduleName, int version, int argc, ch
         // Create primary command buffer
         cmdBuffer = renderer->CreateCommandBuffer(CommandBufferFlags::ImmediateSubmit);
 
+        // Create timer query to measure the GPU time of each test in performance mode
+        if (opt.perfIterations > 0)
+        {
+            perfCmdBuffer_ = renderer->CreateCommandBuffer(CommandBufferFlags::ImmediateSubmit);
+
+            const int rendererID = renderer->GetRendererID();
+            if (rendererID != RendererID::OpenGLES1 && rendererID != RendererID::OpenGLES2 && rendererID != RendererID::OpenGLES3)
+            {
+                QueryHeapDescriptor queryHeapDesc;
+                {
+                    queryHeapDesc.debugName     = "Testbed.PerfTimer";
+                    queryHeapDesc.type          = QueryType::TimeElapsed;
+                    queryHeapDesc.numQueries    = 1;
+                }
+                perfTimerQuery_ = renderer->CreateQueryHeap(queryHeapDesc);
+            }
+        }
+
         // Print renderer information
         if (opt.verbose)
             LogRendererInfo();
@@ -225,6 +276,7 @@ static const char* TestResultToStr(TestResult result)
         case TestResult::Skipped:           return "Skipped";
         case TestResult::FailedMismatch:    return "FAILED - MISMATCH";
         case TestResult::FailedErrors:      return "FAILED - ERRORS";
+        case TestResult::FailedPerformance: return "FAILED - PERFORMANCE";
         default:                            return "UNDEFINED";
     }
 }
@@ -300,13 +352,17 @@ unsigned TestbedContext::RunAllTests()
         return failures;
     }
 
-    #define RUN_TEST(TEST)                                                          \
-        if (opt.ContainsTest(#TEST))                                                \
-        {                                                                           \
-            const TestResult result = RunTest(                                      \
-                std::bind(&TestbedContext::Test##TEST, this, std::placeholders::_1) \
-            );                                                                      \
-            RecordTestResult(result, #TEST);                                        \
+    if (opt.perfIterations > 0)
+        LoadPerfBaseline();
+
+    #define RUN_TEST(TEST)                                                                          \
+        if (opt.ContainsTest(#TEST))                                                                \
+        {                                                                                           \
+            const auto callback = std::bind(&TestbedContext::Test##TEST, this, std::placeholders::_1); \
+            TestResult result = RunTest(callback);                                                  \
+            if (opt.perfIterations > 0 && result == TestResult::Passed)                             \
+                result = RunPerformanceTest(callback, #TEST);                                       \
+            RecordTestResult(result, #TEST);                                                        \
         }
 
     // Run all command buffer tests
@@ -317,11 +373,15 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( BufferWriteAndRead          );
     RUN_TEST( BufferMap                   );
     RUN_TEST( BufferFill                  );
+    RUN_TEST( BufferClear                 );
     RUN_TEST( BufferUpdate                );
     RUN_TEST( BufferCopy                  );
+    RUN_TEST( BufferCopyRegions           );
     RUN_TEST( TextureTypes                );
     RUN_TEST( TextureWriteAndRead         );
     RUN_TEST( TextureCopy                 );
+    RUN_TEST( TextureCopyRegions          );
+    RUN_TEST( TextureClear                );
     RUN_TEST( TextureToBufferCopy         );
     RUN_TEST( BufferToTextureCopy         );
     RUN_TEST( RenderTargetNoAttachments   );
@@ -348,6 +408,9 @@ unsigned TestbedContext::RunAllTests()
 
     #undef RUN_TEST
 
+    if (opt.perfIterations > 0 && opt.perfUpdate)
+        SavePerfBaseline();
+
     // Print summary
     PrintTestSummary(failures);
 
@@ -386,6 +449,22 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
     RUN_TEST( ContainerUTF8String );
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
+    RUN_TEST( ImageConversionKernels );
+    RUN_TEST( ImageCompressionBC );
+    RUN_TEST( TextureContainer );
+    RUN_TEST( PackedVertexAttribs );
+    RUN_TEST( ConstantBufferBuilder );
+    RUN_TEST( MeshOptimizer );
+    RUN_TEST( SlotAllocator );
+    RUN_TEST( LinearArena );
+    RUN_TEST( FrameGraph );
+    RUN_TEST( BufferSuballocator );
+    RUN_TEST( Float16Conversion );
+    RUN_TEST( TiledImage );
+    RUN_TEST( MipChain );
+    RUN_TEST( BitBlit );
+    RUN_TEST( ReadbackRing );
+    RUN_TEST( CPUProfiler );
 
     #undef RUN_TEST
 
@@ -414,6 +493,70 @@ TestResult TestbedContext::RunTest(const std::function<TestResult(unsigned)>& ca
     return result;
 }
 
+static double MedianValue(std::vector<double>& values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+TestResult TestbedContext::RunPerformanceTest(const std::function<TestResult(unsigned)>& callback, const char* name)
+{
+    // Measure all iterations; the preceding correctness run serves as warm-up
+    std::vector<double> cpuTimes, presentTimes, gpuTimes;
+    cpuTimes.reserve(opt.perfIterations);
+    presentTimes.reserve(opt.perfIterations);
+    gpuTimes.reserve(opt.perfIterations);
+
+    for_range(i, opt.perfIterations)
+    {
+        PerfTimings timings;
+        const TestResult result = MeasureTestIteration(callback, timings);
+        if (result != TestResult::Passed)
+            return result;
+
+        cpuTimes.push_back(timings.cpuTime);
+        presentTimes.push_back(timings.presentTime);
+        if (timings.gpuTime >= 0.0)
+            gpuTimes.push_back(timings.gpuTime);
+    }
+
+    PerfTimings median;
+    {
+        median.cpuTime      = MedianValue(cpuTimes);
+        median.presentTime  = MedianValue(presentTimes);
+        median.gpuTime      = (gpuTimes.empty() ? -1.0 : MedianValue(gpuTimes));
+    }
+    perfResults_.push_back({ name, median });
+
+    // Compare median timings against baseline
+    auto it = perfBaseline_.find(name);
+    if (it == perfBaseline_.end())
+    {
+        Log::Printf(
+            "Perf %s: CPU = %.3f ms, Present = %.3f ms, GPU = %.3f ms (no baseline)\n",
+            name, median.cpuTime, median.presentTime, median.gpuTime
+        );
+        return TestResult::Passed;
+    }
+
+    const PerfTimings& baseline = it->second;
+    Log::Printf(
+        "Perf %s: CPU = %.3f ms (%.3f ms), Present = %.3f ms (%.3f ms), GPU = %.3f ms (%.3f ms)\n",
+        name, median.cpuTime, baseline.cpuTime, median.presentTime, baseline.presentTime, median.gpuTime, baseline.gpuTime
+    );
+
+    if (IsPerfRegression(median.cpuTime, baseline.cpuTime) ||
+        IsPerfRegression(median.presentTime, baseline.presentTime) ||
+        IsPerfRegression(median.gpuTime, baseline.gpuTime))
+    {
+        // Don't fail when the baseline is being replaced anyway
+        if (!opt.perfUpdate)
+            return TestResult::FailedPerformance;
+    }
+
+    return TestResult::Passed;
+}
+
 TestResult TestbedContext::CreateBuffer(
     const BufferDescriptor& desc,
     const char*             name,
@@ -796,6 +939,10 @@ TestbedContext::Options TestbedContext::ParseOptions(int argc, char* argv[])
     opt.sanityCheck     = (HasArgument(argc, argv, "-s") || HasArgument(argc, argv, "--sanity-check"));
     opt.showTiming      = (HasArgument(argc, argv, "-t") || HasArgument(argc, argv, "--timing"));
     opt.fastTest        = (HasArgument(argc, argv, "-f") || HasArgument(argc, argv, "--fast"));
+    opt.perfIterations  = FindPerfIterations(argc, argv);
+    opt.perfThreshold   = FindPerfThreshold(argc, argv);
+    opt.perfUpdate      = HasArgument(argc, argv, "--perf-update");
+    opt.perfBaselineDir = FindPerfBaselineDir(argc, argv);
     opt.resolution      = { g_testbedWinSize[0], g_testbedWinSize[1] };
     opt.selectedTests   = FindSelectedTests(argc, argv);
     return opt;
@@ -1601,6 +1748,131 @@ void TestbedContext::RecordTestResult(TestResult result, const char* name)
         ++failures;
 }
 
+TestResult TestbedContext::MeasureTestIteration(const std::function<TestResult(unsigned)>& callback, PerfTimings& outTimings)
+{
+    TestResult result = TestResult::Continue;
+
+    outTimings.gpuTime = (perfTimerQuery_ != nullptr ? 0.0 : -1.0);
+
+    for (unsigned frame = 0; LLGL::Surface::ProcessEvents() && IsContinueTest(result); ++frame)
+    {
+        // Wrap timer query around all commands the test submits in this frame
+        if (perfTimerQuery_ != nullptr)
+        {
+            perfCmdBuffer_->Begin();
+            perfCmdBuffer_->BeginQuery(*perfTimerQuery_, 0);
+            perfCmdBuffer_->End();
+        }
+
+        const std::uint64_t t0 = Timer::Tick();
+        result = callback(frame);
+        const std::uint64_t t1 = Timer::Tick();
+
+        if (perfTimerQuery_ != nullptr)
+        {
+            perfCmdBuffer_->Begin();
+            perfCmdBuffer_->EndQuery(*perfTimerQuery_, 0);
+            perfCmdBuffer_->End();
+        }
+
+        if (result != TestResult::ContinueSkipFrame)
+            swapChain->Present();
+
+        const std::uint64_t t2 = Timer::Tick();
+
+        outTimings.cpuTime      += ToMillisecs(t0, t1);
+        outTimings.presentTime  += ToMillisecs(t1, t2);
+
+        // Wait for the GPU so the timer query is not reused before its result is available
+        if (perfTimerQuery_ != nullptr)
+        {
+            cmdQueue->WaitIdle();
+            std::uint64_t elapsedTime = 0;
+            if (cmdQueue->QueryResult(*perfTimerQuery_, 0, 1, &elapsedTime, sizeof(elapsedTime)))
+                outTimings.gpuTime += static_cast<double>(elapsedTime) / 1.0e6;
+        }
+    }
+
+    return result;
+}
+
+bool TestbedContext::IsPerfRegression(double current, double baseline) const
+{
+    if (current < 0.0 || baseline < 0.0)
+        return false;
+    return (current > baseline * (1.0 + opt.perfThreshold) && current - baseline > g_perfMinRegression);
+}
+
+std::string TestbedContext::GetPerfBaselineFilename() const
+{
+    // Baselines are stored per backend and adapter, e.g. "Reference/Perf.Vulkan.NVIDIA_GeForce_RTX_3080.txt"
+    std::string deviceName = renderer->GetRendererInfo().deviceName;
+    for (char& chr : deviceName)
+    {
+        if (!::isalnum(static_cast<unsigned char>(chr)))
+            chr = '_';
+    }
+    return opt.perfBaselineDir + "Perf." + moduleName + "." + deviceName + ".txt";
+}
+
+void TestbedContext::LoadPerfBaseline()
+{
+    const std::string filename = GetPerfBaselineFilename();
+    std::ifstream file{ filename };
+    if (!file.good())
+    {
+        Log::Printf("No performance baseline found: %s\n", filename.c_str());
+        return;
+    }
+
+    // Read one test per line: NAME CPU PRESENT GPU
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        char name[128] = {};
+        PerfTimings timings;
+        if (::sscanf(line.c_str(), "%127s %lf %lf %lf", name, &timings.cpuTime, &timings.presentTime, &timings.gpuTime) == 4)
+            perfBaseline_[name] = timings;
+    }
+
+    if (opt.verbose)
+        Log::Printf("Loaded performance baseline: %s (%zu tests)\n", filename.c_str(), perfBaseline_.size());
+}
+
+void TestbedContext::SavePerfBaseline()
+{
+    // Merge new results into the baseline, so tests that were not selected keep their previous timings
+    for (const auto& result : perfResults_)
+        perfBaseline_[result.first] = result.second;
+
+    const std::string filename = GetPerfBaselineFilename();
+    std::ofstream file{ filename };
+    if (!file.good())
+    {
+        Log::Errorf("Failed to write performance baseline: %s\n", filename.c_str());
+        return;
+    }
+
+    const RendererInfo& info = renderer->GetRendererInfo();
+    file << "# LLGL Testbed performance baseline for " << info.rendererName << " (" << info.deviceName << ")\n";
+    file << "# TEST CPU[ms] PRESENT[ms] GPU[ms]\n";
+
+    char line[256];
+    for (const auto& entry : perfBaseline_)
+    {
+        ::snprintf(
+            line, sizeof(line), "%s %.6f %.6f %.6f\n",
+            entry.first.c_str(), entry.second.cpuTime, entry.second.presentTime, entry.second.gpuTime
+        );
+        file << line;
+    }
+
+    Log::Printf("Saved performance baseline: %s\n", filename.c_str());
+}
+
 
 /*
  * Options structure
@@ -17,6 +17,8 @@
 #include <Gauss/Matrix.h>
 #include <Gauss/Vector4.h>
 #include <vector>
+#include <map>
+#include <string>
 #include <functional>
 #include <initializer_list>
 
@@ -31,6 +33,7 @@ enum class TestResult
     Skipped,            // Test was skipped due to unsupported features. Cannot be treated as error.
     FailedMismatch,     // Test failed due to mismatch between expected and given data.
     FailedErrors,       // Test failed due to interface errors.
+    FailedPerformance,  // Test failed due to a performance regression against the baseline.
 };
 
 class TestbedContext
@@ -55,6 +58,9 @@ class TestbedContext
 
         TestResult RunTest(const std::function<TestResult(unsigned)>& callback);
 
+        // Runs the test several times and compares the median timings against the performance baseline.
+        TestResult RunPerformanceTest(const std::function<TestResult(unsigned)>& callback, const char* name);
+
         TestResult CreateBuffer(
             const LLGL::BufferDescriptor&   desc,
             const char*                     name,
@@ -177,6 +183,10 @@ class TestbedContext
             bool                        sanityCheck = false; // This is 'very verbose' and dumps out all intermediate data on successful tests
             bool                        showTiming  = false;
             bool                        fastTest    = false; // Skip slow buffer/texture creations to speed up test run
+            unsigned                    perfIterations  = 0;        // Number of measured iterations per test in performance mode; 0 disables performance mode
+            double                      perfThreshold   = 0.2;      // Relative slowdown against the performance baseline that is tolerated
+            bool                        perfUpdate      = false;    // Write the measured timings as new performance baseline
+            std::string                 perfBaselineDir;
             LLGL::Extent2D              resolution;
             std::vector<std::string>    selectedTests;
 
@@ -254,6 +264,13 @@ class TestbedContext
             unsigned    count       = 0; // Number of different pixels;
         };
 
+        struct PerfTimings
+        {
+            double cpuTime      = 0.0;  // Milliseconds spent in the test callback, i.e. for encoding and submitting all commands.
+            double presentTime  = 0.0;  // Milliseconds spent in SwapChain::Present.
+            double gpuTime      = -1.0; // Milliseconds the GPU spent on all commands of the test callback. Negative if timer queries are not supported.
+        };
+
         struct SceneConstants
         {
             Gs::Matrix4f vpMatrix;
@@ -345,6 +362,16 @@ class TestbedContext
 
         void RecordTestResult(TestResult result, const char* name);
 
+        // Runs all frames of a test once and accumulates the timings of all frames.
+        TestResult MeasureTestIteration(const std::function<TestResult(unsigned)>& callback, PerfTimings& outTimings);
+
+        // Returns true if the current timing exceeds the baseline timing by more than the threshold.
+        bool IsPerfRegression(double current, double baseline) const;
+
+        std::string GetPerfBaselineFilename() const;
+        void LoadPerfBaseline();
+        void SavePerfBaseline();
+
     private:
 
         bool                    loadingShadersFailed_ = false;
@@ -352,6 +379,11 @@ class TestbedContext
         LLGL::Report            report_;
         LLGL::Log::LogHandle    reportHandle_;
 
+        LLGL::CommandBuffer*                                perfCmdBuffer_  = nullptr;
+        LLGL::QueryHeap*                                    perfTimerQuery_ = nullptr;
+        std::map<std::string, PerfTimings>                  perfBaseline_;
+        std::vector<std::pair<std::string, PerfTimings>>    perfResults_;
+
 };
 
 
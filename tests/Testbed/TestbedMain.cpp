@@ -113,6 +113,10 @@ static void PrintHelpDocs()
         "  -s, --santiy-check ................. Print some test results even on success\n"
         "  -t, --timing ....................... Print timing results\n"
         "  -v, --verbose ...................... Print more information\n"
+        "  --perf[=N] ......................... Measure CPU, present, and GPU times over N iterations per test (default 30)\n"
+        "  --perf-baseline=DIR ................ Directory of performance baselines (default Reference/)\n"
+        "  --perf-threshold=PERCENT ........... Tolerated slowdown against the performance baseline (default 20)\n"
+        "  --perf-update ...................... Write measured times as new performance baseline\n"
         "  --amd .............................. Prefer AMD device\n"
         "  --intel ............................ Prefer Intel device\n"
         "  --nvidia ........................... Prefer NVIDIA device\n"
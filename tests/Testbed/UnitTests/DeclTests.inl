@@ -23,6 +23,22 @@ DECL_RITEST( ContainerSmallVector );
 DECL_RITEST( ContainerUTF8String );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
+DECL_RITEST( ImageConversionKernels );
+DECL_RITEST( ImageCompressionBC );
+DECL_RITEST( TextureContainer );
+DECL_RITEST( PackedVertexAttribs );
+DECL_RITEST( ConstantBufferBuilder );
+DECL_RITEST( MeshOptimizer );
+DECL_RITEST( SlotAllocator );
+DECL_RITEST( LinearArena );
+DECL_RITEST( FrameGraph );
+DECL_RITEST( BufferSuballocator );
+DECL_RITEST( Float16Conversion );
+DECL_RITEST( TiledImage );
+DECL_RITEST( MipChain );
+DECL_RITEST( BitBlit );
+DECL_RITEST( ReadbackRing );
+DECL_RITEST( CPUProfiler );
 
 #undef DECL_RITEST
 
@@ -48,10 +64,14 @@ DECL_TEST( CommandBufferMultiThreading );
 DECL_TEST( BufferWriteAndRead );
 DECL_TEST( BufferMap );
 DECL_TEST( BufferFill );
+DECL_TEST( BufferClear );
 DECL_TEST( BufferUpdate );
 DECL_TEST( BufferCopy );
+DECL_TEST( BufferCopyRegions );
 DECL_TEST( BufferToTextureCopy );
 DECL_TEST( TextureCopy );
+DECL_TEST( TextureCopyRegions );
+DECL_TEST( TextureClear );
 DECL_TEST( TextureToBufferCopy );
 DECL_TEST( TextureWriteAndRead );
 DECL_TEST( TextureTypes );
@@ -0,0 +1,133 @@
+/*
+ * TestBitBlit.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <Core/ImageUtils.h>
+#include <vector>
+#include <string.h>
+
+
+DEF_RITEST( BitBlit )
+{
+    TestResult result = TestResult::Passed;
+
+    struct BlitCase
+    {
+        const char*     name;
+        Extent3D        extent;
+        std::uint32_t   bpp;
+        std::uint32_t   dstRowStride;
+        std::uint32_t   dstLayerStride;
+        std::uint32_t   srcRowStride;
+        std::uint32_t   srcLayerStride;
+    };
+
+    // Strides of 0 are clamped to the tightly packed lengths; regions of more than 1 MB are large enough to be distributed across threads
+    const BlitCase blitCases[] =
+    {
+        { "small tightly packed",       Extent3D{    5,   3, 2 },  3,    0,      0,    0,      0 },
+        { "large tightly packed",       Extent3D{ 1024, 300, 2 },  4, 4096,      0,    0,      0 },
+        { "clamped strides",            Extent3D{   17,   9, 3 }, 16,    1,      1,    0,      0 },
+        { "padded destination rows",    Extent3D{  333,  77, 3 },  4, 1344,      0,    0,      0 },
+        { "padded source rows",         Extent3D{  333,  77, 3 },  1,    0,      0,  350,      0 },
+        { "padded rows and layers",     Extent3D{   63,  31, 4 },  2,  130,   4100,  128,   4300 },
+        { "padded layers",              Extent3D{  512, 256, 4 },  4,    0, 524544,    0,      0 },
+        { "large padded rows",          Extent3D{  700, 512, 2 },  4, 2804,      0,    0,      0 },
+    };
+
+    const unsigned threadCounts[] = { 0, 4, LLGL_MAX_THREAD_COUNT };
+
+    std::uint32_t seed = 0x2468ACEu;
+
+    for (const BlitCase& blitCase : blitCases)
+    {
+        const Extent3D&     extent          = blitCase.extent;
+        const std::uint32_t rowLength       = extent.x * blitCase.bpp;
+        const std::uint32_t dstRowStride    = std::max(blitCase.dstRowStride, rowLength);
+        const std::uint32_t srcRowStride    = std::max(blitCase.srcRowStride, rowLength);
+        const std::uint32_t dstLayerStride  = std::max(blitCase.dstLayerStride, dstRowStride * extent.y);
+        const std::uint32_t srcLayerStride  = std::max(blitCase.srcLayerStride, srcRowStride * extent.y);
+        const std::size_t   dstSize         = static_cast<std::size_t>(dstLayerStride) * extent.z;
+        const std::size_t   srcSize         = static_cast<std::size_t>(srcLayerStride) * extent.z;
+
+        // Fill source with random bytes; allocate extra bytes to offset the buffers from their 16-byte alignment
+        std::vector<char> srcBuffer(srcSize + 16);
+        for (char& value : srcBuffer)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<char>(seed >> 24);
+        }
+
+        constexpr char padding = static_cast<char>(0xCD);
+
+        std::vector<char> expected(dstSize);
+        std::vector<char> dstBuffer(dstSize + 16);
+
+        for (std::size_t misalignment : { 0u, 3u })
+        {
+            char*       dst = dstBuffer.data() + misalignment;
+            const char* src = srcBuffer.data() + (misalignment * 5) % 16;
+
+            // Build expected destination; padding bytes must remain untouched
+            ::memset(expected.data(), padding, expected.size());
+            for_range(z, extent.z)
+            {
+                for_range(y, extent.y)
+                    ::memcpy(&expected[z * dstLayerStride + y * dstRowStride], src + z * srcLayerStride + y * srcRowStride, rowLength);
+            }
+
+            for (long flags : { 0L, static_cast<long>(BitBlitFlags::WriteCombined) })
+            {
+                for (unsigned threadCount : threadCounts)
+                {
+                    ::memset(dstBuffer.data(), padding, dstBuffer.size());
+                    BitBlit(
+                        extent, blitCase.bpp,
+                        dst, blitCase.dstRowStride, blitCase.dstLayerStride,
+                        src, blitCase.srcRowStride, blitCase.srcLayerStride,
+                        flags, threadCount
+                    );
+
+                    if (::memcmp(dst, expected.data(), dstSize) != 0 || (misalignment > 0 && dstBuffer[misalignment - 1] != padding) || dst[dstSize] != padding)
+                    {
+                        Log::Errorf(
+                            "Mismatch between BitBlit of %s region (%u x %u x %u, bpp = %u) and expected image with flags = 0x%lX, threads = %u, misalignment = %zu\n",
+                            blitCase.name, extent.x, extent.y, extent.z, blitCase.bpp, flags, threadCount, misalignment
+                        );
+                        result = TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+    }
+
+    // Streaming copies into write-combined memory must be equivalent to memcpy, including unaligned heads and tails
+    for (std::size_t size : { 0u, 15u, 1023u, 1024u, 4099u, 65536u + 77u })
+    {
+        std::vector<char> src(size + 16), dst(size + 32, 0);
+        for (char& value : src)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<char>(seed >> 24);
+        }
+
+        for_range(offset, 16u)
+        {
+            ::memset(dst.data(), 0, dst.size());
+            CopyToWriteCombinedMemory(dst.data() + offset, src.data() + (offset * 7) % 16, size);
+            if (::memcmp(dst.data() + offset, src.data() + (offset * 7) % 16, size) != 0 || dst[offset + size] != 0 || (offset > 0 && dst[offset - 1] != 0))
+            {
+                Log::Errorf("Mismatch between CopyToWriteCombinedMemory of %zu bytes at offset %u and expected memory\n", size, offset);
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
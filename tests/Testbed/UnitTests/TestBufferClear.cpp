@@ -0,0 +1,87 @@
+/*
+ * TestBufferClear.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+DEF_TEST( BufferClear )
+{
+    // Create buffer with initial data to detect bytes outside the cleared ranges
+    constexpr std::uint32_t bufSize         = 256;
+    constexpr std::uint8_t  initialByte     = 0xAB;
+
+    std::uint8_t bufInitial[bufSize];
+    ::memset(bufInitial, initialByte, sizeof(bufInitial));
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = bufSize;
+        bufDesc.bindFlags   = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(buf, bufDesc, "buf{size=256}", bufInitial);
+
+    // Expected elements: RGBA8UNorm can be written as 32-bit pattern, RGBA16UInt must be written as 8-byte element
+    const std::uint8_t rgba8Element[4] = { 0xFF, 0x00, 0xFF, 0x00 };
+    const std::uint16_t rgba16Element[4] = { 1, 2, 3, 4 };
+    const std::uint32_t r32Element = 7;
+
+    auto VerifyBufferRange = [&](const std::uint8_t* data, std::uint32_t begin, std::uint32_t end, const void* element, std::uint32_t elementSize, const char* name) -> bool
+    {
+        for (std::uint32_t offset = begin; offset < end; ++offset)
+        {
+            const std::uint8_t expected = (element != nullptr ? reinterpret_cast<const std::uint8_t*>(element)[(offset - begin) % elementSize] : initialByte);
+            if (data[offset] != expected)
+            {
+                Log::Errorf(
+                    "Mismatch between buffer clear feedback data (offset = %u) [0x%02X] and expected data [0x%02X] after clearing %s\n",
+                    offset, data[offset], expected, name
+                );
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Clear two sub-ranges of the buffer, one with a 32-bit pattern and one with a larger element
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->ClearBuffer(*buf, Format::RGBA8UNorm, ClearValue{ 1.0f, 0.0f, 1.0f, 0.0f }, 16, 64);
+        cmdBuffer->ClearBuffer(*buf, Format::RGBA16UInt, ClearValue{ 1.0f, 2.0f, 3.0f, 4.0f }, 96, 64);
+    }
+    cmdBuffer->End();
+
+    std::uint8_t bufFeedback[bufSize] = {};
+    renderer->ReadBuffer(*buf, 0, bufFeedback, sizeof(bufFeedback));
+
+    if (!VerifyBufferRange(bufFeedback,   0,       16, nullptr,       1,                     "sub-ranges") ||
+        !VerifyBufferRange(bufFeedback,  16,       80, rgba8Element,  sizeof(rgba8Element),  "sub-ranges") ||
+        !VerifyBufferRange(bufFeedback,  80,       96, nullptr,       1,                     "sub-ranges") ||
+        !VerifyBufferRange(bufFeedback,  96,      160, rgba16Element, sizeof(rgba16Element), "sub-ranges") ||
+        !VerifyBufferRange(bufFeedback, 160,  bufSize, nullptr,       1,                     "sub-ranges"))
+    {
+        return TestResult::FailedMismatch;
+    }
+
+    // Clear whole buffer; the non-zero offset must be ignored in this case
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->ClearBuffer(*buf, Format::R32UInt, ClearValue{ 7.0f, 0.0f, 0.0f, 0.0f }, 32, LLGL_WHOLE_SIZE);
+    }
+    cmdBuffer->End();
+
+    ::memset(bufFeedback, 0, sizeof(bufFeedback));
+    renderer->ReadBuffer(*buf, 0, bufFeedback, sizeof(bufFeedback));
+
+    if (!VerifyBufferRange(bufFeedback, 0, bufSize, &r32Element, sizeof(r32Element), "whole buffer"))
+        return TestResult::FailedMismatch;
+
+    // Delete old buffers
+    renderer->Release(*buf);
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,83 @@
+/*
+ * TestBufferCopyRegions.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+DEF_TEST( BufferCopyRegions )
+{
+    // Create source buffer with a unique value in each byte
+    constexpr std::uint32_t bufSize     = 64;
+    constexpr std::uint8_t  initialByte = 0xEE;
+
+    std::uint8_t srcInitial[bufSize];
+    for_range(i, bufSize)
+        srcInitial[i] = static_cast<std::uint8_t>(i);
+
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size         = bufSize;
+        srcBufDesc.bindFlags    = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "srcBuf{size=64,src}", srcInitial);
+
+    // Create destination buffer with initial data to detect bytes outside the copied regions
+    std::uint8_t dstInitial[bufSize];
+    ::memset(dstInitial, initialByte, sizeof(dstInitial));
+
+    BufferDescriptor dstBufDesc;
+    {
+        dstBufDesc.size         = bufSize;
+        dstBufDesc.bindFlags    = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf, dstBufDesc, "dstBuf{size=64,dst}", dstInitial);
+
+    // Copy non-contiguous regions in a different order than they appear in the source buffer
+    const BufferCopyRegion regions[] =
+    {
+        BufferCopyRegion{  0, 32,  8 },
+        BufferCopyRegion{ 16,  0, 16 },
+        BufferCopyRegion{ 48, 56,  8 },
+    };
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->CopyBufferRegions(*dstBuf, *srcBuf, static_cast<std::uint32_t>(sizeof(regions)/sizeof(regions[0])), regions);
+    }
+    cmdBuffer->End();
+
+    // Apply same regions on the CPU side
+    std::uint8_t expectedData[bufSize];
+    ::memcpy(expectedData, dstInitial, sizeof(expectedData));
+    for (const BufferCopyRegion& region : regions)
+        ::memcpy(expectedData + region.dstOffset, srcInitial + region.srcOffset, static_cast<std::size_t>(region.size));
+
+    // Read destination buffer feedback data
+    std::uint8_t dstFeedback[bufSize] = {};
+    renderer->ReadBuffer(*dstBuf, 0, dstFeedback, sizeof(dstFeedback));
+
+    if (::memcmp(dstFeedback, expectedData, sizeof(expectedData)) != 0)
+    {
+        const std::string expectedDataStr = TestbedContext::FormatByteArray(expectedData, sizeof(expectedData), 4);
+        const std::string actualDataStr = TestbedContext::FormatByteArray(dstFeedback, sizeof(dstFeedback), 4);
+        Log::Errorf(
+            "Mismatch between data of buffer %s and copy regions result:\n"
+            " -> Expected: [%s]\n"
+            " -> Actual:   [%s]\n",
+            dstBuf_Name, expectedDataStr.c_str(), actualDataStr.c_str()
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Delete old buffers
+    renderer->Release(*srcBuf);
+    renderer->Release(*dstBuf);
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,188 @@
+/*
+ * TestBufferSuballocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/BufferSuballocator.h>
+#include <vector>
+
+
+DEF_RITEST( BufferSuballocator )
+{
+    TestResult result = TestResult::Passed;
+
+    // Suballocation is independent of the backend, so use the Null renderer to create the hardware buffers
+    RenderSystemPtr nullRenderer = RenderSystem::Load("Null");
+    if (!nullRenderer)
+        return TestResult::Skipped;
+
+    constexpr std::uint64_t blockSize = 4096;
+
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName    = "BufferSuballocatorTest";
+        bufferDesc.bindFlags    = BindFlags::VertexBuffer;
+    }
+
+    {
+        BufferSuballocator suballocator{ *nullRenderer, bufferDesc, blockSize };
+
+        std::vector<BufferSlice> slices;
+        std::uint64_t allocatedSize = 0;
+
+        // Validates the specified slice against its buffer, its alignment, and all other slices in the same buffer
+        auto ValidateSlice = [&](const BufferSlice& slice, std::uint64_t size, std::uint64_t alignment) -> bool
+        {
+            if (!slice.IsValid() || slice.size != size || slice.offset % alignment != 0 || slice.offset + slice.size > slice.buffer->GetDesc().size)
+            {
+                Log::Errorf(
+                    "Mismatch between buffer slice (offset = %" PRIu64 ", size = %" PRIu64 ") and expected size (%" PRIu64 ") and alignment (%" PRIu64 ")\n",
+                    slice.offset, slice.size, size, alignment
+                );
+                result = TestResult::FailedMismatch;
+                return false;
+            }
+            for (const BufferSlice& other : slices)
+            {
+                if (other.buffer == slice.buffer && other.offset < slice.offset + slice.size && slice.offset < other.offset + other.size)
+                {
+                    Log::Errorf(
+                        "Buffer slice (offset = %" PRIu64 ", size = %" PRIu64 ") overlaps with another slice (offset = %" PRIu64 ", size = %" PRIu64 ")\n",
+                        slice.offset, slice.size, other.offset, other.size
+                    );
+                    result = TestResult::FailedMismatch;
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto ValidateStats = [&](const char* name) -> bool
+        {
+            const BufferSuballocatorStatistics stats = suballocator.GetStatistics();
+            if (stats.numSlices != slices.size() || stats.allocatedSize != allocatedSize || stats.totalSize != stats.numBlocks * blockSize)
+            {
+                Log::Errorf(
+                    "Mismatch between buffer suballocator statistics %s: slices = %u, allocated = %" PRIu64 ", total = %" PRIu64 ", blocks = %u; expected %zu, %" PRIu64 ", %" PRIu64 "\n",
+                    name, stats.numSlices, stats.allocatedSize, stats.totalSize, stats.numBlocks, slices.size(), allocatedSize, stats.numBlocks * blockSize
+                );
+                result = TestResult::FailedMismatch;
+                return false;
+            }
+            return true;
+        };
+
+        // Zero-sized slices are invalid
+        if (suballocator.Allocate(0).IsValid())
+        {
+            Log::Errorf("Allocating buffer slice of size 0 succeeded, but expected failure\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        // Allocate and free slices with mixed sizes and alignments in interleaved order; alignments are rounded up to the LCM with the minimum alignment
+        const std::uint64_t alignments[][2] =
+        {
+            {  1,  4 },
+            {  4,  4 },
+            {  6, 12 },
+            { 12, 12 },
+            { 16, 16 },
+            { 64, 64 },
+        };
+
+        std::uint32_t seed = 0x13579BDu;
+        auto NextRandom = [&seed](std::uint32_t range) -> std::uint32_t
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return (seed >> 8) % range;
+        };
+
+        for_range(i, 2000u)
+        {
+            if (slices.empty() || NextRandom(5) < 3)
+            {
+                const std::uint64_t size        = NextRandom(300) + 1;
+                const auto&         alignment   = alignments[NextRandom(6)];
+                const BufferSlice   slice       = suballocator.Allocate(size, alignment[0]);
+                if (!ValidateSlice(slice, size, alignment[1]))
+                    break;
+                slices.push_back(slice);
+                allocatedSize += size;
+            }
+            else
+            {
+                const std::size_t index = NextRandom(static_cast<std::uint32_t>(slices.size()));
+                suballocator.Free(slices[index]);
+                allocatedSize -= slices[index].size;
+                slices[index] = slices.back();
+                slices.pop_back();
+            }
+
+            if (!ValidateStats("after interleaved allocations"))
+                break;
+        }
+
+        // Free all slices; adjacent free ranges must be merged, so each block can be allocated entirely without creating new buffers
+        for (const BufferSlice& slice : slices)
+            suballocator.Free(slice);
+        slices.clear();
+        allocatedSize = 0;
+
+        if (ValidateStats("after freeing all slices"))
+        {
+            const std::uint32_t numBlocks = suballocator.GetStatistics().numBlocks;
+            for_range(i, numBlocks)
+            {
+                const BufferSlice slice = suballocator.Allocate(blockSize);
+                if (!ValidateSlice(slice, blockSize, 4))
+                    break;
+                slices.push_back(slice);
+                allocatedSize += blockSize;
+            }
+
+            if (suballocator.GetStatistics().numBlocks != numBlocks)
+            {
+                Log::Errorf("Mismatch between number of blocks after merging free ranges (%u) and expected number (%u)\n", suballocator.GetStatistics().numBlocks, numBlocks);
+                result = TestResult::FailedMismatch;
+            }
+            ValidateStats("after allocating entire blocks");
+        }
+
+        for (const BufferSlice& slice : slices)
+            suballocator.Free(slice);
+        slices.clear();
+        allocatedSize = 0;
+
+        // Slices that are larger than the block size get their own buffer
+        const BufferSlice largeSlice = suballocator.Allocate(blockSize * 2 + 6);
+        if (!largeSlice.IsValid() || largeSlice.offset != 0 || largeSlice.buffer->GetDesc().size < blockSize * 2 + 6)
+        {
+            Log::Errorf("Mismatch between large buffer slice and expected dedicated buffer\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        // Only buffers without any slices are released
+        const std::uint32_t numBlocksBeforeRelease  = suballocator.GetStatistics().numBlocks;
+        const std::uint32_t numReleased             = suballocator.ReleaseUnusedBlocks();
+        if (numReleased + 1 != numBlocksBeforeRelease || suballocator.GetStatistics().numBlocks != 1)
+        {
+            Log::Errorf("Mismatch between number of released blocks (%u) and expected number (%u)\n", numReleased, numBlocksBeforeRelease - 1);
+            result = TestResult::FailedMismatch;
+        }
+
+        suballocator.Free(largeSlice);
+        if (suballocator.ReleaseUnusedBlocks() != 1 || suballocator.GetStatistics().numBlocks != 0)
+        {
+            Log::Errorf("Mismatch between number of blocks after releasing all blocks (%u) and expected number (0)\n", suballocator.GetStatistics().numBlocks);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    RenderSystem::Unload(std::move(nullRenderer));
+
+    return result;
+}
+
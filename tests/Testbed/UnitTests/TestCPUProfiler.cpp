@@ -0,0 +1,223 @@
+/*
+ * TestCPUProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/CPUProfiler.h>
+#include <LLGL/Timer.h>
+#include <set>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+
+DEF_RITEST( CPUProfiler )
+{
+    TestResult result = TestResult::Passed;
+
+    DynamicVector<CPUProfileRegion> regions;
+    DynamicVector<CPUProfileCounter> counters;
+
+    auto FindCounter = [&counters](const char* name) -> std::int64_t
+    {
+        for (const CPUProfileCounter& counter : counters)
+        {
+            if (::strcmp(counter.name, name) == 0)
+                return counter.value;
+        }
+        return 0;
+    };
+
+    // Discard all records from previous tests, since the profiler state is global
+    const bool wasEnabled = CPUProfiler::IsEnabled();
+    CPUProfiler::SetEnabled(false);
+    CPUProfiler::CollectResults(regions);
+
+    // Nothing must be recorded while profiling is disabled
+    {
+        CPUProfiler::Scope scope{ "Disabled" };
+        CPUProfiler::RecordScope("DisabledRecord", 1, 2);
+        CPUProfiler::AddCounter("DisabledCounter");
+        if (CPUProfiler::BeginScope("DisabledBegin"))
+        {
+            Log::Errorf("CPUProfiler::BeginScope started a scope while profiling is disabled\n");
+            result = TestResult::FailedMismatch;
+            CPUProfiler::EndScope();
+        }
+    }
+    CPUProfiler::CollectResults(regions, &counters);
+    if (!regions.empty() || !counters.empty())
+    {
+        Log::Errorf("Mismatch between CPU profile results while profiling is disabled (regions = %zu, counters = %zu) and expected results (0, 0)\n", regions.size(), counters.size());
+        result = TestResult::FailedMismatch;
+    }
+
+    CPUProfiler::SetEnabled(true);
+
+    // Record nested scopes, an explicit scope, and counters on the calling thread
+    const std::uint64_t recordedTicksStart = Timer::Tick();
+    {
+        CPUProfiler::Scope outerScope{ "Outer" };
+        {
+            CPUProfiler::Scope innerScope{ "Inner1" };
+            CPUProfiler::AddCounter("Draws", 3);
+        }
+        {
+            CPUProfiler::Scope innerScope{ "Inner2" };
+            CPUProfiler::AddCounter("Draws", 4);
+            CPUProfiler::AddCounter("Bytes", 100);
+            CPUProfiler::RecordScope("Recorded", recordedTicksStart, Timer::Tick());
+        }
+    }
+    CPUProfiler::CollectResults(regions, &counters);
+
+    auto FindRegion = [&regions](const char* name) -> const CPUProfileRegion*
+    {
+        for (const CPUProfileRegion& region : regions)
+        {
+            if (::strcmp(region.name, name) == 0)
+                return &region;
+        }
+        return nullptr;
+    };
+
+    // The explicit scope is nested inside the two scopes that were open when it was recorded
+    struct ExpectedRegion
+    {
+        const char*     name;
+        std::uint32_t   depth;
+    };
+    const ExpectedRegion expectedRegions[] =
+    {
+        { "Outer",    0 },
+        { "Inner1",   1 },
+        { "Inner2",   1 },
+        { "Recorded", 2 },
+    };
+
+    if (regions.size() != sizeof(expectedRegions)/sizeof(expectedRegions[0]))
+    {
+        Log::Errorf("Mismatch between number of CPU profile regions (%zu) and expected number (4)\n", regions.size());
+        result = TestResult::FailedMismatch;
+    }
+    else
+    {
+        const std::uint32_t mainThreadID = regions[0].threadID;
+        for (const ExpectedRegion& expected : expectedRegions)
+        {
+            const CPUProfileRegion* region = FindRegion(expected.name);
+            if (region == nullptr || region->depth != expected.depth || region->threadID != mainThreadID || region->cpuTicksStart > region->cpuTicksEnd)
+            {
+                Log::Errorf("Mismatch between CPU profile region '%s' and expected depth (%u) and thread (%u)\n", expected.name, expected.depth, mainThreadID);
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        // Regions must be sorted by their start tick
+        for_range(i, regions.size() - 1)
+        {
+            if (regions[i].cpuTicksStart > regions[i + 1].cpuTicksStart)
+            {
+                Log::Errorf("CPU profile regions '%s' and '%s' are not sorted by their start tick\n", regions[i].name, regions[i + 1].name);
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        // Inner scopes must be enclosed by the outer scope and must not overlap
+        const CPUProfileRegion* outer   = FindRegion("Outer");
+        const CPUProfileRegion* inner1  = FindRegion("Inner1");
+        const CPUProfileRegion* inner2  = FindRegion("Inner2");
+        if (outer != nullptr && inner1 != nullptr && inner2 != nullptr)
+        {
+            if (inner1->cpuTicksStart < outer->cpuTicksStart || inner2->cpuTicksEnd > outer->cpuTicksEnd || inner1->cpuTicksEnd > inner2->cpuTicksStart)
+            {
+                Log::Errorf("Mismatch between nested CPU profile regions: inner regions are not enclosed by outer region or overlap\n");
+                result = TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    if (counters.size() != 2 || FindCounter("Draws") != 7 || FindCounter("Bytes") != 100)
+    {
+        Log::Errorf(
+            "Mismatch between CPU profile counters (count = %zu, Draws = %" PRId64 ", Bytes = %" PRId64 ") and expected values (2, 7, 100)\n",
+            counters.size(), FindCounter("Draws"), FindCounter("Bytes")
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Collected records must not be reported again
+    CPUProfiler::CollectResults(regions, &counters);
+    if (!regions.empty() || !counters.empty())
+    {
+        Log::Errorf("Mismatch between CPU profile results after collecting twice (regions = %zu, counters = %zu) and expected results (0, 0)\n", regions.size(), counters.size());
+        result = TestResult::FailedMismatch;
+    }
+
+    // Record scopes on multiple threads; each thread gets its own ID and its records are collected after the thread has terminated
+    {
+        constexpr std::uint32_t numThreads          = 4;
+        constexpr std::uint32_t numScopesPerThread  = 100;
+
+        std::vector<std::thread> workers;
+        for_range(i, numThreads)
+        {
+            workers.emplace_back(
+                []()
+                {
+                    for_range(j, numScopesPerThread)
+                    {
+                        CPUProfiler::Scope scope{ "Worker" };
+                        CPUProfiler::AddCounter("WorkerScopes");
+                    }
+                }
+            );
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+
+        CPUProfiler::CollectResults(regions, &counters);
+
+        std::set<std::uint32_t> threadIDs;
+        for (const CPUProfileRegion& region : regions)
+            threadIDs.insert(region.threadID);
+
+        if (regions.size() != numThreads * numScopesPerThread || threadIDs.size() != numThreads || FindCounter("WorkerScopes") != numThreads * numScopesPerThread)
+        {
+            Log::Errorf(
+                "Mismatch between CPU profile results of worker threads (regions = %zu, threads = %zu, counter = %" PRId64 ") and expected results (%u, %u, %u)\n",
+                regions.size(), threadIDs.size(), FindCounter("WorkerScopes"), numThreads * numScopesPerThread, numThreads, numThreads * numScopesPerThread
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Records that exceed the thread buffer must be dropped and counted without blocking
+    {
+        constexpr std::uint32_t numScopes = 10000;
+
+        const std::uint64_t numDroppedBefore = CPUProfiler::GetNumDroppedRecords();
+        for_range(i, numScopes)
+            CPUProfiler::Scope scope{ "Overflow" };
+
+        CPUProfiler::CollectResults(regions);
+        const std::uint64_t numDropped = CPUProfiler::GetNumDroppedRecords() - numDroppedBefore;
+
+        if (regions.empty() || regions.size() >= numScopes || regions.size() + numDropped != numScopes)
+        {
+            Log::Errorf(
+                "Mismatch between collected (%zu) and dropped (%" PRIu64 ") CPU profile records and number of recorded scopes (%u)\n",
+                regions.size(), numDropped, numScopes
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    CPUProfiler::SetEnabled(wasEnabled);
+
+    return result;
+}
+
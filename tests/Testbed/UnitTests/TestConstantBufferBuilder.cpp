@@ -0,0 +1,176 @@
+/*
+ * TestConstantBufferBuilder.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ConstantBufferBuilder.h>
+#include <vector>
+#include <string.h>
+
+
+DEF_RITEST( ConstantBufferBuilder )
+{
+    TestResult result = TestResult::Passed;
+
+    // Mixed struct with a float3 followed by a float, a float3x3, a float[3] followed by a float, and a double4
+    const UniformDescriptor uniforms[] =
+    {
+        UniformDescriptor{ "a", UniformType::Float3    },
+        UniformDescriptor{ "b", UniformType::Float1    },
+        UniformDescriptor{ "m", UniformType::Float3x3  },
+        UniformDescriptor{ "c", UniformType::Float1, 3 },
+        UniformDescriptor{ "e", UniformType::Float1    },
+        UniformDescriptor{ "d", UniformType::Double4   },
+        UniformDescriptor{ "f", UniformType::Float1    },
+    };
+
+    constexpr std::size_t numFields = sizeof(uniforms)/sizeof(uniforms[0]);
+
+    // Reference layout of a single field; strides are only compared for arrays and matrices respectively, the column size is the same for all packings
+    struct FieldLayout
+    {
+        std::uint32_t offset;
+        std::uint32_t size;
+        std::uint32_t elementStride;
+        std::uint32_t columnStride;
+    };
+
+    struct PackingLayout
+    {
+        const char*             name;
+        ConstantBufferPacking   packing;
+        std::uint32_t           size;
+        FieldLayout             fields[numFields];
+    };
+
+    const std::uint32_t columnSizes[numFields]  = { 12, 4, 12, 4, 4, 32, 4 };
+    const std::uint32_t numColumns[numFields]   = {  1, 1,  3, 1, 1,  1, 1 };
+    const std::uint32_t numElements[numFields]  = {  1, 1,  1, 3, 1,  1, 1 };
+
+    const PackingLayout referenceLayouts[] =
+    {
+        {
+            "std140", ConstantBufferPacking::Std140, 176,
+            {
+                {   0, 12,  0,  0 },    // float3 a:    vec3 is aligned like a vec4
+                {  12,  4,  0,  0 },    // float b:     fills the vec3 padding
+                {  16, 48,  0, 16 },    // float3x3 m:  each column is padded to a vec4
+                {  64, 48, 16,  0 },    // float[3] c:  array elements are padded to a vec4
+                { 112,  4,  0,  0 },    // float e:     starts after the padding of the last array element
+                { 128, 32,  0,  0 },    // double4 d:   aligned to 32 bytes
+                { 160,  4,  0,  0 },    // float f
+            }
+        },
+        {
+            "std430", ConstantBufferPacking::Std430, 160,
+            {
+                {   0, 12,  0,  0 },    // float3 a
+                {  12,  4,  0,  0 },    // float b
+                {  16, 48,  0, 16 },    // float3x3 m:  vec3 columns are still aligned to 16 bytes
+                {  64, 12,  4,  0 },    // float[3] c:  array elements are tightly packed
+                {  76,  4,  0,  0 },    // float e
+                {  96, 32,  0,  0 },    // double4 d:   aligned to 32 bytes
+                { 128,  4,  0,  0 },    // float f:     total size is rounded up to the largest alignment
+            }
+        },
+        {
+            "HLSL", ConstantBufferPacking::HLSL, 160,
+            {
+                {   0, 12,  0,  0 },    // float3 a
+                {  12,  4,  0,  0 },    // float b:     fills the same register
+                {  16, 44,  0, 16 },    // float3x3 m:  each column starts a new register, the padding of the last one is not part of the field
+                {  64, 36, 16,  0 },    // float[3] c:  each element starts a new register
+                { 100,  4,  0,  0 },    // float e:     packed into the register of the last array element
+                { 112, 32,  0,  0 },    // double4 d:   must not straddle a register boundary
+                { 144,  4,  0,  0 },    // float f
+            }
+        },
+    };
+
+    std::vector<std::uint8_t> packedData;
+
+    for (const PackingLayout& layout : referenceLayouts)
+    {
+        ConstantBufferBuilder builder{ uniforms, layout.packing };
+
+        if (builder.GetSize() != layout.size)
+        {
+            Log::Errorf("Mismatch between %s constant buffer size (%u) and expected size (%u)\n", layout.name, builder.GetSize(), layout.size);
+            result = TestResult::FailedMismatch;
+        }
+
+        const ArrayView<ConstantBufferField> fields = builder.GetFields();
+        if (fields.size() != numFields)
+        {
+            Log::Errorf("Mismatch between number of %s constant buffer fields (%zu) and expected number (%zu)\n", layout.name, fields.size(), numFields);
+            return TestResult::FailedMismatch;
+        }
+
+        for_range(i, numFields)
+        {
+            const ConstantBufferField&  field       = fields[i];
+            const FieldLayout&          expected    = layout.fields[i];
+
+            if (field.offset != expected.offset ||
+                field.size   != expected.size   ||
+                (numElements[i] > 1 && field.elementStride != expected.elementStride) ||
+                (numColumns[i]  > 1 && field.columnStride  != expected.columnStride ))
+            {
+                Log::Errorf(
+                    "Mismatch between %s constant buffer field '%s': offset = %u, size = %u, elementStride = %u, columnStride = %u; expected %u, %u, %u, %u\n",
+                    layout.name, field.name.c_str(), field.offset, field.size, field.elementStride, field.columnStride,
+                    expected.offset, expected.size, expected.elementStride, expected.columnStride
+                );
+                result = TestResult::FailedMismatch;
+            }
+
+            if (builder.FindField(uniforms[i].name) != i)
+            {
+                Log::Errorf("Mismatch between %s constant buffer field index of '%s'\n", layout.name, uniforms[i].name.c_str());
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        // Write all fields at once from a byte pattern and compare each column against the reference layout
+        packedData.resize(builder.GetPackedSize());
+        for_range(i, packedData.size())
+            packedData[i] = static_cast<std::uint8_t>(i % 251 + 1);
+
+        std::vector<std::uint8_t> buffer(builder.GetSize(), 0);
+        builder.WriteAll(buffer.data(), packedData.data());
+
+        std::uint32_t packedOffset = 0;
+        for_range(i, numFields)
+        {
+            const FieldLayout& expected = layout.fields[i];
+            for_range(element, numElements[i])
+            {
+                for_range(column, numColumns[i])
+                {
+                    const std::uint32_t dstOffset = expected.offset + element * expected.elementStride + column * expected.columnStride;
+                    if (::memcmp(buffer.data() + dstOffset, packedData.data() + packedOffset, columnSizes[i]) != 0)
+                    {
+                        Log::Errorf(
+                            "Mismatch between %s constant buffer data of field '%s' [element %u, column %u] at offset %u\n",
+                            layout.name, uniforms[i].name.c_str(), element, column, dstOffset
+                        );
+                        result = TestResult::FailedMismatch;
+                    }
+                    packedOffset += columnSizes[i];
+                }
+            }
+        }
+
+        if (packedOffset != builder.GetPackedSize())
+        {
+            Log::Errorf("Mismatch between %s packed size (%u) and expected size (%u)\n", layout.name, builder.GetPackedSize(), packedOffset);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    return result;
+}
+
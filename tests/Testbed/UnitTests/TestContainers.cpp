@@ -10,6 +10,10 @@
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/UTF8String.h>
 #include <LLGL/Container/Strings.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string>
+#include <vector>
+#include <type_traits>
 #include <locale>
 #include <codecvt>
 
@@ -227,6 +231,232 @@ DEF_RITEST( ContainerSmallVector )
     TEST_SMALL_VECTOR_EXT(iv5_4a, cmpInt16, 4);
     TEST_SMALL_VECTOR_EXT(iv5_4b, cmpInt0,  0);
 
+    // Non-trivial element type that keeps track of the number of live instances to detect leaked or double destroyed elements
+    struct NonTrivialElement
+    {
+        NonTrivialElement(int value, int* liveCounter) :
+            str         { std::to_string(value) },
+            liveCounter { liveCounter           }
+        {
+            ++(*liveCounter);
+        }
+
+        NonTrivialElement(const NonTrivialElement& rhs) :
+            str         { rhs.str         },
+            liveCounter { rhs.liveCounter }
+        {
+            ++(*liveCounter);
+        }
+
+        NonTrivialElement& operator = (const NonTrivialElement& rhs)
+        {
+            str = rhs.str;
+            return *this;
+        }
+
+        ~NonTrivialElement()
+        {
+            --(*liveCounter);
+        }
+
+        bool operator == (const NonTrivialElement& rhs) const
+        {
+            return (str == rhs.str);
+        }
+
+        std::string str;
+        int*        liveCounter;
+    };
+
+    static_assert(!std::is_trivially_copyable<NonTrivialElement>::value, "NonTrivialElement must not be trivially copyable");
+
+    auto CompareSmallVector = [](const char* name, const char* op, const auto& vec, const auto& cmp) -> TestResult
+    {
+        if (vec.size() != cmp.size())
+        {
+            Log::Errorf(
+                "Mismatch between SmallVector '%s' size (%zu) and expected size (%zu) after %s\n",
+                name, vec.size(), cmp.size(), op
+            );
+            return TestResult::FailedMismatch;
+        }
+        if (vec.capacity() < vec.size())
+        {
+            Log::Errorf(
+                "SmallVector '%s' capacity (%zu) is less than its size (%zu) after %s\n",
+                name, vec.capacity(), vec.size(), op
+            );
+            return TestResult::FailedMismatch;
+        }
+        for_range(i, cmp.size())
+        {
+            if (!(vec[i] == cmp[i]))
+            {
+                Log::Errorf("Mismatch between SmallVector '%s' and expected element [%zu] after %s\n", name, i, op);
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    auto CompareIterator = [](const char* name, const char* op, const auto& vec, const auto& iter, std::size_t expectedOffset) -> TestResult
+    {
+        const std::size_t offset = static_cast<std::size_t>(iter - vec.begin());
+        if (offset != expectedOffset)
+        {
+            Log::Errorf(
+                "Mismatch between iterator offset returned by SmallVector '%s' (%zu) and expected offset (%zu) after %s\n",
+                name, offset, expectedOffset, op
+            );
+            return TestResult::FailedMismatch;
+        }
+        return TestResult::Passed;
+    };
+
+    #define TEST_SMALL_VECTOR_OP(OP)                                            \
+        {                                                                       \
+            const TestResult result = CompareSmallVector(name, OP, vec, cmp);   \
+            if (result != TestResult::Passed)                                   \
+                return result;                                                  \
+        }
+
+    #define TEST_SMALL_VECTOR_ITER(OP, ITER, OFFSET)                                    \
+        {                                                                               \
+            const TestResult result = CompareIterator(name, OP, vec, ITER, OFFSET);     \
+            if (result != TestResult::Passed)                                           \
+                return result;                                                          \
+        }
+
+    // Applies the same growth, insert, and erase operations to a SmallVector and a std::vector and compares them after each step
+    auto TestInsertAndErase = [&CompareSmallVector, &CompareIterator](const char* name, auto& vec, auto makeValue) -> TestResult
+    {
+        using T = typename std::remove_reference<decltype(vec)>::type::value_type;
+
+        std::vector<T> cmp;
+
+        // Grow beyond local capacity one element at a time
+        for_range(i, 10)
+        {
+            vec.push_back(makeValue(static_cast<int>(i)));
+            cmp.push_back(makeValue(static_cast<int>(i)));
+        }
+        TEST_SMALL_VECTOR_OP("push_back");
+
+        // Insert single element in the middle
+        {
+            auto iter = vec.insert(vec.begin() + 3, makeValue(100));
+            cmp.insert(cmp.begin() + 3, makeValue(100));
+            TEST_SMALL_VECTOR_OP("insert(single)");
+            TEST_SMALL_VECTOR_ITER("insert(single)", iter, 3);
+        }
+
+        const std::vector<T> values = { makeValue(200), makeValue(201), makeValue(202) };
+
+        // Insert range in-place with enough capacity for the new elements
+        {
+            vec.reserve(vec.size() + values.size());
+            auto iter = vec.insert(vec.begin() + 1, values.data(), values.data() + values.size());
+            cmp.insert(cmp.begin() + 1, values.begin(), values.end());
+            TEST_SMALL_VECTOR_OP("insert(range, in-place)");
+            TEST_SMALL_VECTOR_ITER("insert(range, in-place)", iter, 1);
+        }
+
+        // Insert range that exceeds the current capacity
+        {
+            std::vector<T> largeValues;
+            for_range(i, vec.capacity())
+                largeValues.push_back(makeValue(300 + static_cast<int>(i)));
+
+            auto iter = vec.insert(vec.begin() + 5, largeValues.data(), largeValues.data() + largeValues.size());
+            cmp.insert(cmp.begin() + 5, largeValues.begin(), largeValues.end());
+            TEST_SMALL_VECTOR_OP("insert(range, realloc)");
+            TEST_SMALL_VECTOR_ITER("insert(range, realloc)", iter, 5);
+        }
+
+        // Erase single element; the returned iterator must refer to the element that followed the erased one
+        {
+            auto iter = vec.erase(vec.begin() + 2);
+            cmp.erase(cmp.begin() + 2);
+            TEST_SMALL_VECTOR_OP("erase(single)");
+            TEST_SMALL_VECTOR_ITER("erase(single)", iter, 2);
+        }
+
+        // Erase range in the middle
+        {
+            auto iter = vec.erase(vec.begin() + 1, vec.begin() + 4);
+            cmp.erase(cmp.begin() + 1, cmp.begin() + 4);
+            TEST_SMALL_VECTOR_OP("erase(range)");
+            TEST_SMALL_VECTOR_ITER("erase(range)", iter, 1);
+        }
+
+        // Erase range at the end; the returned iterator must be the new end
+        {
+            auto iter = vec.erase(vec.end() - 2, vec.end());
+            cmp.erase(cmp.end() - 2, cmp.end());
+            TEST_SMALL_VECTOR_OP("erase(tail)");
+            TEST_SMALL_VECTOR_ITER("erase(tail)", iter, vec.size());
+        }
+
+        // Erase all but one element and insert again at the front
+        {
+            auto iter = vec.erase(vec.begin(), vec.end() - 1);
+            cmp.erase(cmp.begin(), cmp.end() - 1);
+            TEST_SMALL_VECTOR_OP("erase(front)");
+            TEST_SMALL_VECTOR_ITER("erase(front)", iter, 0);
+
+            iter = vec.insert(vec.begin(), makeValue(400));
+            cmp.insert(cmp.begin(), makeValue(400));
+            TEST_SMALL_VECTOR_OP("insert(front)");
+            TEST_SMALL_VECTOR_ITER("insert(front)", iter, 0);
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_SMALL_VECTOR_INSERT_ERASE(VEC, MAKE_VALUE)                         \
+        {                                                                           \
+            const TestResult result = TestInsertAndErase(#VEC, VEC, MAKE_VALUE);    \
+            if (result != TestResult::Passed)                                       \
+                return result;                                                      \
+        }
+
+    // Test insert and erase with trivially copyable elements
+    SmallVector<int, 4> iv4_ops;
+    SmallVector<int, 0> iv0_ops;
+
+    auto MakeInt = [](int i) -> int { return i; };
+
+    TEST_SMALL_VECTOR_INSERT_ERASE(iv4_ops, MakeInt);
+    TEST_SMALL_VECTOR_INSERT_ERASE(iv0_ops, MakeInt);
+
+    // Test insert and erase with non-trivial elements and verify that all of them are destroyed eventually
+    int numLiveElements = 0;
+    {
+        SmallVector<NonTrivialElement, 4> ntv4_ops;
+        SmallVector<NonTrivialElement, 0> ntv0_ops;
+
+        auto MakeNonTrivial = [&numLiveElements](int i) -> NonTrivialElement { return NonTrivialElement{ i, &numLiveElements }; };
+
+        TEST_SMALL_VECTOR_INSERT_ERASE(ntv4_ops, MakeNonTrivial);
+        TEST_SMALL_VECTOR_INSERT_ERASE(ntv0_ops, MakeNonTrivial);
+
+        const int expectedLiveElements = static_cast<int>(ntv4_ops.size() + ntv0_ops.size());
+        if (numLiveElements != expectedLiveElements)
+        {
+            Log::Errorf(
+                "Mismatch between number of live SmallVector elements (%d) and expected number (%d)\n",
+                numLiveElements, expectedLiveElements
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    if (numLiveElements != 0)
+    {
+        Log::Errorf("Mismatch between number of live SmallVector elements (%d) after destruction and expected number (0)\n", numLiveElements);
+        return TestResult::FailedMismatch;
+    }
+
     return TestResult::Passed;
 }
 
@@ -0,0 +1,125 @@
+/*
+ * TestFloat16Conversion.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <Core/Float16Compressor.h>
+#include <vector>
+#include <string.h>
+
+
+static std::uint32_t GetFloatBits(float value)
+{
+    std::uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float MakeFloatFromBits(std::uint32_t bits)
+{
+    float value;
+    ::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+DEF_RITEST( Float16Conversion )
+{
+    TestResult result = TestResult::Passed;
+
+    // Decompress all 16-bit floats at once and compare them bit for bit against the scalar function
+    std::vector<std::uint16_t> halfValues(0x10000);
+    for_range(i, halfValues.size())
+        halfValues[i] = static_cast<std::uint16_t>(i);
+
+    std::vector<float> floatValues(halfValues.size());
+    DecompressFloat16Array(halfValues.data(), floatValues.data(), halfValues.size());
+
+    for_range(i, halfValues.size())
+    {
+        const float expected = DecompressFloat16(halfValues[i]);
+        if (GetFloatBits(floatValues[i]) != GetFloatBits(expected))
+        {
+            Log::Errorf("Mismatch between DecompressFloat16Array(0x%04X) = 0x%08X and DecompressFloat16 = 0x%08X\n", halfValues[i], GetFloatBits(floatValues[i]), GetFloatBits(expected));
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Compressing decompressed values must restore the original bit pattern of all finite values and infinities
+    for_range(i, halfValues.size())
+    {
+        const bool isNaN = ((halfValues[i] & 0x7C00) == 0x7C00 && (halfValues[i] & 0x03FF) != 0);
+        if (!isNaN && CompressFloat16(floatValues[i]) != halfValues[i])
+        {
+            Log::Errorf("Mismatch between CompressFloat16(DecompressFloat16(0x%04X)) = 0x%04X and original value\n", halfValues[i], CompressFloat16(floatValues[i]));
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Compress special values, values beyond the 16-bit range, denormals, and random bit patterns
+    std::vector<float> srcValues =
+    {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 65504.0f, -65504.0f, 65519.0f, 65520.0f, 1.0e+6f, -1.0e+6f,
+        6.1035156e-5f, 6.0e-5f, 5.9604645e-8f, 2.9802322e-8f, 1.0e-10f, -1.0e-10f,
+        MakeFloatFromBits(0x7F800000u), MakeFloatFromBits(0xFF800000u), MakeFloatFromBits(0x7FC00000u), MakeFloatFromBits(0xFFC00001u), MakeFloatFromBits(0x7F800001u),
+        MakeFloatFromBits(0x00000001u), MakeFloatFromBits(0x807FFFFFu),
+    };
+
+    std::uint32_t seed = 0x9E3779B9u;
+    for_range(i, 10000)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        srcValues.push_back(MakeFloatFromBits(seed));
+    }
+    for (float value : floatValues)
+        srcValues.push_back(value);
+
+    std::vector<std::uint16_t> dstValues(srcValues.size());
+    CompressFloat16Array(srcValues.data(), dstValues.data(), srcValues.size());
+
+    for_range(i, srcValues.size())
+    {
+        const std::uint16_t expected = CompressFloat16(srcValues[i]);
+        if (dstValues[i] != expected)
+        {
+            Log::Errorf("Mismatch between CompressFloat16Array(0x%08X) = 0x%04X and CompressFloat16 = 0x%04X\n", GetFloatBits(srcValues[i]), dstValues[i], expected);
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Unaligned ranges of all lengths must be converted entirely without touching values beyond the range, to cover the scalar tails of vectorized loops
+    for_range(offset, 8u)
+    {
+        for_range(count, 40u)
+        {
+            std::vector<std::uint16_t> dstHalf(offset + count + 1, 0xCDCD);
+            CompressFloat16Array(srcValues.data() + offset, dstHalf.data() + offset, count);
+
+            std::vector<float> dstFloat(offset + count + 1, MakeFloatFromBits(0xCDCDCDCDu));
+            DecompressFloat16Array(halfValues.data() + 0x3C00 + offset, dstFloat.data() + offset, count);
+
+            for_range(i, dstHalf.size())
+            {
+                const bool inRange = (i >= offset && i < offset + count);
+
+                const std::uint16_t expectedHalf = (inRange ? CompressFloat16(srcValues[i]) : 0xCDCD);
+                const std::uint32_t expectedFloat = (inRange ? GetFloatBits(DecompressFloat16(halfValues[0x3C00 + i])) : 0xCDCDCDCDu);
+
+                if (dstHalf[i] != expectedHalf || GetFloatBits(dstFloat[i]) != expectedFloat)
+                {
+                    Log::Errorf("Mismatch between batch Float16 conversion of %u elements at offset %u in element %zu\n", count, offset, i);
+                    result = TestResult::FailedMismatch;
+                    return result;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
@@ -0,0 +1,285 @@
+/*
+ * TestFrameGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/FrameGraph.h>
+#include <string>
+#include <vector>
+
+
+DEF_RITEST( FrameGraph )
+{
+    TestResult result = TestResult::Passed;
+
+    // Frame graph scheduling is independent of the backend, so use the Null renderer to create the hardware resources
+    RenderSystemPtr nullRenderer = RenderSystem::Load("Null");
+    if (!nullRenderer)
+        return TestResult::Skipped;
+
+    CommandBuffer* cmdBuffer = nullRenderer->CreateCommandBuffer();
+
+    TextureDescriptor colorDesc;
+    {
+        colorDesc.type      = TextureType::Texture2D;
+        colorDesc.bindFlags = BindFlags::ColorAttachment | BindFlags::Sampled;
+        colorDesc.format    = Format::RGBA8UNorm;
+        colorDesc.extent    = { 64, 64, 1 };
+        colorDesc.mipLevels = 1;
+    }
+    TextureDescriptor depthDesc;
+    {
+        depthDesc.type      = TextureType::Texture2D;
+        depthDesc.bindFlags = BindFlags::DepthStencilAttachment;
+        depthDesc.format    = Format::D32Float;
+        depthDesc.extent    = { 64, 64, 1 };
+        depthDesc.mipLevels = 1;
+    }
+    BufferDescriptor storageDesc;
+    {
+        storageDesc.size        = 256;
+        storageDesc.bindFlags   = BindFlags::Storage;
+    }
+
+    Texture* importedTexture = nullRenderer->CreateTexture(colorDesc);
+
+    constexpr std::uint32_t maxUnusedFrames = 2;
+
+    FrameGraph frameGraph{ *nullRenderer, maxUnusedFrames };
+
+    struct PassRecord
+    {
+        std::string name;
+        Texture*    textures[2];
+    };
+
+    std::vector<PassRecord> records;
+
+    const float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    // Declares the following passes; a pass is culled if none of its outputs are used (marked with *):
+    //  0: GBuffer      -> A, C (depth)
+    //  1: Lighting     A -> B
+    //  2: Unused*      A -> U
+    //  3: Compose      B -> D, X (imported), R
+    //  4: DeadChain1*  -> S
+    //  5: DeadChain2*  S -> T
+    //  6: Readback     R (side effects)
+    auto DeclareFrame = [&]() -> void
+    {
+        const FrameGraphResource texA = frameGraph.CreateTexture(colorDesc);
+        const FrameGraphResource texB = frameGraph.CreateTexture(colorDesc);
+        const FrameGraphResource texC = frameGraph.CreateTexture(depthDesc);
+        const FrameGraphResource texD = frameGraph.CreateTexture(colorDesc);
+        const FrameGraphResource texU = frameGraph.CreateTexture(colorDesc);
+        const FrameGraphResource texX = frameGraph.ImportTexture(*importedTexture);
+        const FrameGraphResource bufR = frameGraph.CreateBuffer(storageDesc);
+        const FrameGraphResource bufS = frameGraph.CreateBuffer(storageDesc);
+        const FrameGraphResource bufT = frameGraph.CreateBuffer(storageDesc);
+
+        auto AddRecordedPass = [&](FrameGraphPassDescriptor& passDesc, FrameGraphResource tex0, FrameGraphResource tex1) -> void
+        {
+            const std::string name = passDesc.name;
+            frameGraph.AddPass(
+                passDesc,
+                [&records, &frameGraph, name, tex0, tex1](CommandBuffer& /*cmdBuffer*/)
+                {
+                    records.push_back(PassRecord{ name, { frameGraph.GetTexture(tex0), frameGraph.GetTexture(tex1) } });
+                }
+            );
+        };
+
+        FrameGraphPassDescriptor gbufferPass;
+        {
+            gbufferPass.name                    = "GBuffer";
+            gbufferPass.colorAttachments[0]     = texA;
+            gbufferPass.depthStencilAttachment  = texC;
+            gbufferPass.clears                  = { AttachmentClear{ clearColor, 0 }, AttachmentClear{ 1.0f } };
+        }
+        AddRecordedPass(gbufferPass, texA, texC);
+
+        FrameGraphPassDescriptor lightingPass;
+        {
+            lightingPass.name                   = "Lighting";
+            lightingPass.reads                  = { texA };
+            lightingPass.colorAttachments[0]    = texB;
+        }
+        AddRecordedPass(lightingPass, texA, texB);
+
+        FrameGraphPassDescriptor unusedPass;
+        {
+            unusedPass.name                     = "Unused";
+            unusedPass.reads                    = { texA };
+            unusedPass.colorAttachments[0]      = texU;
+        }
+        AddRecordedPass(unusedPass, texA, texU);
+
+        FrameGraphPassDescriptor composePass;
+        {
+            composePass.name                    = "Compose";
+            composePass.reads                   = { texB };
+            composePass.writes                  = { texX, bufR };
+            composePass.colorAttachments[0]     = texD;
+        }
+        AddRecordedPass(composePass, texB, texD);
+
+        FrameGraphPassDescriptor deadChainPass1;
+        {
+            deadChainPass1.name                 = "DeadChain1";
+            deadChainPass1.writes               = { bufS };
+        }
+        AddRecordedPass(deadChainPass1, FrameGraphResource{}, FrameGraphResource{});
+
+        FrameGraphPassDescriptor deadChainPass2;
+        {
+            deadChainPass2.name                 = "DeadChain2";
+            deadChainPass2.reads                = { bufS };
+            deadChainPass2.writes               = { bufT };
+        }
+        AddRecordedPass(deadChainPass2, FrameGraphResource{}, FrameGraphResource{});
+
+        FrameGraphPassDescriptor readbackPass;
+        {
+            readbackPass.name                   = "Readback";
+            readbackPass.reads                  = { bufR };
+            readbackPass.sideEffects            = true;
+        }
+        AddRecordedPass(readbackPass, FrameGraphResource{}, FrameGraphResource{});
+    };
+
+    auto ExecuteFrame = [&]() -> void
+    {
+        records.clear();
+        cmdBuffer->Begin();
+        {
+            frameGraph.Execute(*cmdBuffer);
+        }
+        cmdBuffer->End();
+        nullRenderer->GetCommandQueue()->Submit(*cmdBuffer);
+    };
+
+    auto ValidateStats = [&result, &frameGraph](const char* name, const FrameGraphStatistics& expected) -> void
+    {
+        const FrameGraphStatistics& stats = frameGraph.GetStatistics();
+        if (stats.numPasses             != expected.numPasses               ||
+            stats.numCulledPasses       != expected.numCulledPasses         ||
+            stats.numTransientResources != expected.numTransientResources   ||
+            stats.numTextures           != expected.numTextures             ||
+            stats.numBuffers            != expected.numBuffers              ||
+            stats.numAliasingGroups     != expected.numAliasingGroups)
+        {
+            Log::Errorf(
+                "Mismatch between frame graph statistics of %s: passes = %u, culled = %u, transient = %u, textures = %u, buffers = %u, aliasing groups = %u; "
+                "expected %u, %u, %u, %u, %u, %u\n",
+                name, stats.numPasses, stats.numCulledPasses, stats.numTransientResources, stats.numTextures, stats.numBuffers, stats.numAliasingGroups,
+                expected.numPasses, expected.numCulledPasses, expected.numTransientResources, expected.numTextures, expected.numBuffers, expected.numAliasingGroups
+            );
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    // Passes 0 and 1 overlap with A, so B and C need their own textures and aliasing group; D starts after A's lifetime and reuses its texture
+    FrameGraphStatistics expectedStats;
+    {
+        expectedStats.numPasses             = 7;
+        expectedStats.numCulledPasses       = 3;
+        expectedStats.numTransientResources = 8;
+        expectedStats.numTextures           = 3;
+        expectedStats.numBuffers            = 1;
+        expectedStats.numAliasingGroups     = 2;
+    }
+
+    std::vector<PassRecord> firstFrameRecords;
+
+    for_range(frame, 2u)
+    {
+        DeclareFrame();
+        ExecuteFrame();
+
+        const char* frameName = (frame == 0 ? "first frame" : "second frame");
+        ValidateStats(frameName, expectedStats);
+
+        // Remaining passes must be recorded in declaration order
+        const char* expectedPasses[] = { "GBuffer", "Lighting", "Compose", "Readback" };
+        if (records.size() != sizeof(expectedPasses)/sizeof(expectedPasses[0]))
+        {
+            Log::Errorf("Mismatch between number of recorded passes in %s (%zu) and expected number (4)\n", frameName, records.size());
+            result = TestResult::FailedMismatch;
+            break;
+        }
+
+        for_range(i, records.size())
+        {
+            if (records[i].name != expectedPasses[i])
+            {
+                Log::Errorf("Mismatch between recorded pass %zu in %s ('%s') and expected pass ('%s')\n", i, frameName, records[i].name.c_str(), expectedPasses[i]);
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        Texture* texA = records[0].textures[0];
+        Texture* texC = records[0].textures[1];
+        Texture* texB = records[1].textures[1];
+        Texture* texD = records[2].textures[1];
+
+        if (texA == nullptr || texB == nullptr || texC == nullptr || records[1].textures[0] != texA || records[2].textures[0] != texB)
+        {
+            Log::Errorf("Mismatch between transient textures across passes in %s\n", frameName);
+            result = TestResult::FailedMismatch;
+        }
+        else if (texA == texB || texA == texC || texB == texC)
+        {
+            Log::Errorf("Transient textures with overlapping lifetimes share the same hardware texture in %s\n", frameName);
+            result = TestResult::FailedMismatch;
+        }
+        else if (texD != texA)
+        {
+            Log::Errorf("Mismatch between hardware texture of D and A with disjoint lifetimes in %s: expected the same texture\n", frameName);
+            result = TestResult::FailedMismatch;
+        }
+
+        // Hardware textures must be cached across frames
+        if (frame == 0)
+            firstFrameRecords = records;
+        else
+        {
+            for_range(i, records.size())
+            {
+                if (records[i].textures[0] != firstFrameRecords[i].textures[0] || records[i].textures[1] != firstFrameRecords[i].textures[1])
+                {
+                    Log::Errorf("Mismatch between hardware textures of pass '%s' in first and second frame\n", records[i].name.c_str());
+                    result = TestResult::FailedMismatch;
+                }
+            }
+        }
+    }
+
+    // Discarded frames must not record anything
+    DeclareFrame();
+    frameGraph.Reset();
+    ExecuteFrame();
+    if (!records.empty())
+    {
+        Log::Errorf("Mismatch between number of recorded passes after reset (%zu) and expected number (0)\n", records.size());
+        result = TestResult::FailedMismatch;
+    }
+
+    // Cached resources must be released once they have not been used for more than the maximum number of unused frames
+    for_range(frame, maxUnusedFrames)
+        ExecuteFrame();
+
+    FrameGraphStatistics emptyStats;
+    ValidateStats("empty frames", emptyStats);
+
+    frameGraph.ReleaseResources();
+    nullRenderer->Release(*importedTexture);
+    nullRenderer->Release(*cmdBuffer);
+
+    RenderSystem::Unload(std::move(nullRenderer));
+
+    return result;
+}
+
@@ -10,6 +10,7 @@
 #include <LLGL/Utils/Image.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <thread>
+#include <string.h>
 
 
 DEF_RITEST( ImageConversions )
@@ -156,4 +157,256 @@ DEF_RITEST( ImageConversions )
     return TestResult::Passed;
 }
 
+// Compares the specialized conversion kernels against the generic conversion.
+DEF_RITEST( ImageConversionKernels )
+{
+    // Use a pixel count that is not a multiple of the SIMD chunk size to cover the scalar tails as well
+    const std::size_t numPixels     = 1037;
+    const std::size_t numElements   = numPixels * 4;
+
+    // Generate source data with a simple LCG so the test is deterministic
+    std::uint32_t seed = 0x1234567u;
+    auto NextRandom = [&seed]() -> std::uint32_t
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8);
+    };
+
+    std::vector<std::uint8_t>   srcUInt8(numElements);
+    std::vector<std::uint16_t>  srcUInt16(numElements);
+    std::vector<double>         srcFloat64(numElements);
+
+    for_range(i, numElements)
+    {
+        srcUInt8[i]     = static_cast<std::uint8_t>(NextRandom());
+        srcUInt16[i]    = static_cast<std::uint16_t>(NextRandom());
+
+        // Mix arbitrary values with values that hit the normalized integer steps exactly; all values must be in the range [0, 1]
+        if (i % 2 == 0)
+            srcFloat64[i] = static_cast<double>(NextRandom() % 1001u) / 1000.0;
+        else
+            srcFloat64[i] = static_cast<double>(NextRandom() % 256u) / 255.0;
+    }
+
+    // Float64 has no kernel, so the floating-point sources are generated by the generic conversion
+    const ImageView         srcFloat64View  { ImageFormat::RGBA, DataType::Float64, srcFloat64.data(), srcFloat64.size() * sizeof(double) };
+    const DynamicByteArray  srcFloat32      = ConvertImageBuffer(srcFloat64View, ImageFormat::RGBA, DataType::Float32);
+    const DynamicByteArray  srcFloat16      = ConvertImageBuffer(srcFloat64View, ImageFormat::RGBA, DataType::Float16);
+
+    auto CompareResults = [](const char* name, unsigned threadCount, const DynamicByteArray& result, const DynamicByteArray& expected) -> TestResult
+    {
+        if (!result || !expected || result.size() != expected.size())
+        {
+            Log::Errorf(
+                "Mismatch between size of image conversion '%s' (%u bytes) and generic conversion (%u bytes)\n",
+                name, static_cast<unsigned>(result.size()), static_cast<unsigned>(expected.size())
+            );
+            return TestResult::FailedMismatch;
+        }
+        for_range(i, result.size())
+        {
+            if (result[i] != expected[i])
+            {
+                Log::Errorf(
+                    "Mismatch between image conversion '%s' (threads: %u) and generic conversion at byte offset %u: 0x%02X != 0x%02X\n",
+                    name, threadCount, static_cast<unsigned>(i),
+                    static_cast<unsigned>(static_cast<std::uint8_t>(result[i])), static_cast<unsigned>(static_cast<std::uint8_t>(expected[i]))
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    // Data type kernels are compared against a detour over Float64, which has no kernels and stores the normalized values without loss
+    auto TestDataTypeKernel = [&](const char* name, const ImageView& srcView, DataType dstDataType, unsigned threadCount) -> TestResult
+    {
+        const DynamicByteArray  result          = ConvertImageBuffer(srcView, srcView.format, dstDataType, threadCount);
+        const DynamicByteArray  intermediate    = ConvertImageBuffer(srcView, srcView.format, DataType::Float64, threadCount);
+        const ImageView         intermediateView{ srcView.format, DataType::Float64, intermediate.get(), intermediate.size() };
+        const DynamicByteArray  expected        = ConvertImageBuffer(intermediateView, srcView.format, dstDataType, threadCount);
+        return CompareResults(name, threadCount, result, expected);
+    };
+
+    // Format kernels are compared against a detour over ARGB, which has no kernels
+    auto TestFormatKernel = [&](const char* name, const ImageView& srcView, ImageFormat dstFormat, unsigned threadCount) -> TestResult
+    {
+        const DynamicByteArray  result          = ConvertImageBuffer(srcView, dstFormat, srcView.dataType, threadCount);
+        const DynamicByteArray  intermediate    = ConvertImageBuffer(srcView, ImageFormat::ARGB, srcView.dataType, threadCount);
+        const ImageView         intermediateView{ ImageFormat::ARGB, srcView.dataType, intermediate.get(), intermediate.size() };
+        const DynamicByteArray  expected        = ConvertImageBuffer(intermediateView, dstFormat, srcView.dataType, threadCount);
+        return CompareResults(name, threadCount, result, expected);
+    };
+
+    const ImageView srcUInt8View    { ImageFormat::RGBA, DataType::UInt8,   srcUInt8.data(),    srcUInt8.size()     };
+    const ImageView srcUInt16View   { ImageFormat::RGBA, DataType::UInt16,  srcUInt16.data(),   srcUInt16.size() * 2 };
+    const ImageView srcFloat16View  { ImageFormat::RGBA, DataType::Float16, srcFloat16.get(),   srcFloat16.size()   };
+    const ImageView srcFloat32View  { ImageFormat::RGBA, DataType::Float32, srcFloat32.get(),   srcFloat32.size()   };
+
+    // Reinterpret the RGBA sources as tightly packed RGB/BGR images for the RGB-to-RGBA kernels
+    const ImageView srcRGBUInt8View     { ImageFormat::RGB, DataType::UInt8,   srcUInt8.data(),   numPixels * 3     };
+    const ImageView srcBGRUInt8View     { ImageFormat::BGR, DataType::UInt8,   srcUInt8.data(),   numPixels * 3     };
+    const ImageView srcBGRAUInt8View    { ImageFormat::BGRA, DataType::UInt8,  srcUInt8.data(),   srcUInt8.size()   };
+    const ImageView srcRGBFloat32View   { ImageFormat::RGB, DataType::Float32, srcFloat32.get(),  numPixels * 3 * 4 };
+    const ImageView srcBGRFloat32View   { ImageFormat::BGR, DataType::Float32, srcFloat32.get(),  numPixels * 3 * 4 };
+
+    #define TEST_KERNEL(FUNC, NAME, SRC, DST)                                   \
+        {                                                                       \
+            const unsigned threadCounts[] = { 0, 3, LLGL_MAX_THREAD_COUNT };    \
+            for (unsigned threadCount : threadCounts)                           \
+            {                                                                   \
+                TestResult result = FUNC(NAME, SRC, DST, threadCount);          \
+                if (result != TestResult::Passed)                               \
+                    return result;                                              \
+            }                                                                   \
+        }
+
+    TEST_KERNEL(TestDataTypeKernel, "UInt8 -> Float32",     srcUInt8View,       DataType::Float32);
+    TEST_KERNEL(TestDataTypeKernel, "Float32 -> UInt8",     srcFloat32View,     DataType::UInt8);
+    TEST_KERNEL(TestDataTypeKernel, "UInt16 -> Float32",    srcUInt16View,      DataType::Float32);
+    TEST_KERNEL(TestDataTypeKernel, "Float32 -> UInt16",    srcFloat32View,     DataType::UInt16);
+    TEST_KERNEL(TestDataTypeKernel, "UInt8 -> Float16",     srcUInt8View,       DataType::Float16);
+    TEST_KERNEL(TestDataTypeKernel, "Float16 -> UInt8",     srcFloat16View,     DataType::UInt8);
+    TEST_KERNEL(TestDataTypeKernel, "Float32 -> Float16",   srcFloat32View,     DataType::Float16);
+    TEST_KERNEL(TestDataTypeKernel, "Float16 -> Float32",   srcFloat16View,     DataType::Float32);
+
+    TEST_KERNEL(TestFormatKernel,   "RGB -> RGBA (UInt8)",   srcRGBUInt8View,    ImageFormat::RGBA);
+    TEST_KERNEL(TestFormatKernel,   "BGR -> BGRA (UInt8)",   srcBGRUInt8View,    ImageFormat::BGRA);
+    TEST_KERNEL(TestFormatKernel,   "RGBA -> BGRA (UInt8)",  srcUInt8View,       ImageFormat::BGRA);
+    TEST_KERNEL(TestFormatKernel,   "BGRA -> RGBA (UInt8)",  srcBGRAUInt8View,   ImageFormat::RGBA);
+    TEST_KERNEL(TestFormatKernel,   "RGB -> RGBA (Float32)", srcRGBFloat32View,  ImageFormat::RGBA);
+    TEST_KERNEL(TestFormatKernel,   "BGR -> BGRA (Float32)", srcBGRFloat32View,  ImageFormat::BGRA);
+
+    #undef TEST_KERNEL
+
+    return TestResult::Passed;
+}
+
+// Compresses a smooth image into each BC format and compares the decompressed image against the original within a tolerance.
+DEF_RITEST( ImageCompressionBC )
+{
+    // Use an extent that is not a multiple of the block size to cover partial blocks
+    const Extent2D      extent      = { 37, 21 };
+    const std::size_t   numPixels   = extent.x * extent.y;
+
+    std::vector<std::uint8_t> srcImage(numPixels * 4);
+
+    for_range(y, extent.y)
+    {
+        for_range(x, extent.x)
+        {
+            std::uint8_t* pixel = &srcImage[(y * extent.x + x) * 4];
+            pixel[0] = static_cast<std::uint8_t>(x * 255 / (extent.x - 1));
+            pixel[1] = static_cast<std::uint8_t>(y * 255 / (extent.y - 1));
+            pixel[2] = static_cast<std::uint8_t>((x + y) * 255 / (extent.x + extent.y - 2));
+            pixel[3] = static_cast<std::uint8_t>(255 - x * 127 / (extent.x - 1));
+        }
+    }
+
+    const ImageView srcImageView{ ImageFormat::RGBA, DataType::UInt8, srcImage.data(), srcImage.size() };
+
+    auto TestRoundTrip = [&](ImageFormat format, std::size_t blockSize, unsigned numChannels, int tolerance, unsigned threadCount) -> TestResult
+    {
+        const DynamicByteArray compressed = CompressImageBuffer(srcImageView, extent, format, threadCount);
+
+        const std::size_t numBlocks = ((extent.x + 3) / 4) * ((extent.y + 3) / 4);
+        if (!compressed || compressed.size() != numBlocks * blockSize)
+        {
+            Log::Errorf(
+                "Mismatch between size of compressed image (%s) (%u bytes) and expected size (%u bytes)\n",
+                ToString(format), static_cast<unsigned>(compressed.size()), static_cast<unsigned>(numBlocks * blockSize)
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        const ImageView         compressedView{ format, DataType::UInt8, compressed.get(), compressed.size() };
+        const DynamicByteArray  decompressed = DecompressImageBufferToRGBA8UNorm(compressedView, extent, threadCount);
+
+        if (!decompressed || decompressed.size() != srcImage.size())
+        {
+            Log::Errorf(
+                "Mismatch between size of decompressed image (%s) (%u bytes) and original image (%u bytes)\n",
+                ToString(format), static_cast<unsigned>(decompressed.size()), static_cast<unsigned>(srcImage.size())
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        for_range(i, numPixels)
+        {
+            for_range(c, numChannels)
+            {
+                const int p0 = static_cast<int>(static_cast<std::uint8_t>(decompressed[i * 4 + c]));
+                const int p1 = static_cast<int>(srcImage[i * 4 + c]);
+                if (std::abs(p0 - p1) > tolerance)
+                {
+                    Log::Errorf(
+                        "Mismatch between decompressed pixel [%u,%u] (%s, threads: %u) and original pixel in channel %u: %d != %d (tolerance: %d)\n",
+                        static_cast<unsigned>(i % extent.x), static_cast<unsigned>(i / extent.x), ToString(format),
+                        threadCount, static_cast<unsigned>(c), p0, p1, tolerance
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_ROUND_TRIP(FORMAT, BLOCKSIZE, CHANNELS, TOLERANCE)                                        \
+        {                                                                                                  \
+            const unsigned threadCounts[] = { 0, LLGL_MAX_THREAD_COUNT };                                  \
+            for (unsigned threadCount : threadCounts)                                                      \
+            {                                                                                              \
+                TestResult result = TestRoundTrip(FORMAT, BLOCKSIZE, CHANNELS, TOLERANCE, threadCount);    \
+                if (result != TestResult::Passed)                                                          \
+                    return result;                                                                         \
+            }                                                                                              \
+        }
+
+    // BC1 and BC2 only store RGB and 4-bit alpha respectively, BC4 and BC5 store only the red and green channels
+    TEST_ROUND_TRIP(ImageFormat::BC1,  8, 3, 24);
+    TEST_ROUND_TRIP(ImageFormat::BC2, 16, 4, 24);
+    TEST_ROUND_TRIP(ImageFormat::BC3, 16, 4, 24);
+    TEST_ROUND_TRIP(ImageFormat::BC4,  8, 1, 4);
+    TEST_ROUND_TRIP(ImageFormat::BC5, 16, 2, 4);
+
+    #undef TEST_ROUND_TRIP
+
+    // Decode signed BC4 blocks: the first block uses the endpoints (127, -127) and the second one (-127, 127), all with palette index 0
+    const std::uint8_t signedBlocks[16] =
+    {
+        0x7F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x81, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    const ImageView         signedBlocksView{ ImageFormat::BC4, DataType::Int8, signedBlocks, sizeof(signedBlocks) };
+    const DynamicByteArray  signedDecompressed = DecompressImageBufferToRGBA8UNorm(signedBlocksView, Extent2D{ 8, 4 });
+
+    if (!signedDecompressed || signedDecompressed.size() != 8 * 4 * 4)
+    {
+        Log::Errorf("Failed to decompress signed BC4 image\n");
+        return TestResult::FailedMismatch;
+    }
+
+    for_range(y, 4)
+    {
+        for_range(x, 8)
+        {
+            // Signed values in range [-127, 127] are remapped to unsigned normalized range [0, 255]
+            const int p0 = static_cast<int>(static_cast<std::uint8_t>(signedDecompressed[(y * 8 + x) * 4]));
+            const int p1 = (x < 4 ? 255 : 0);
+            if (p0 != p1)
+            {
+                Log::Errorf(
+                    "Mismatch between decompressed signed BC4 pixel [%u,%u] (R=%d) and expected value (R=%d)\n",
+                    static_cast<unsigned>(x), static_cast<unsigned>(y), p0, p1
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    return TestResult::Passed;
+}
+
 
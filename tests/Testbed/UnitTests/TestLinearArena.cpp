@@ -0,0 +1,195 @@
+/*
+ * TestLinearArena.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <Core/LinearArena.h>
+#include <vector>
+#include <string.h>
+
+
+DEF_RITEST( LinearArena )
+{
+    TestResult result = TestResult::Passed;
+
+    struct ArenaAllocation
+    {
+        std::size_t size;
+        std::size_t alignment;
+    };
+
+    // Mixed sizes and alignments with a total size far beyond the initial block size, so the arena must grow several times
+    std::vector<ArenaAllocation> allocations;
+    for_range(i, 200u)
+    {
+        static const std::size_t alignments[] = { 1, 2, 4, 8, 16, 64, 256 };
+        const std::size_t size = (i % 17 == 0 ? 3000 : (i * 37) % 200 + 1);
+        allocations.push_back(ArenaAllocation{ size, alignments[i % 7] });
+    }
+
+    std::size_t totalSize = 0;
+    for (const ArenaAllocation& alloc : allocations)
+        totalSize += alloc.size;
+
+    LinearArena arena{ 256 };
+
+    // Allocates all entries and fills each allocation with a distinct pattern to detect overlapping memory
+    auto AllocateAll = [&](const char* name, std::vector<unsigned char*>& outPtrs) -> bool
+    {
+        outPtrs.clear();
+        for_range(i, allocations.size())
+        {
+            const ArenaAllocation& alloc = allocations[i];
+            unsigned char* ptr = static_cast<unsigned char*>(arena.Allocate(alloc.size, alloc.alignment));
+            if (ptr == nullptr || reinterpret_cast<std::uintptr_t>(ptr) % alloc.alignment != 0)
+            {
+                Log::Errorf("Mismatch between alignment of %s allocation %zu (%p) and expected alignment (%zu)\n", name, i, ptr, alloc.alignment);
+                result = TestResult::FailedMismatch;
+                return false;
+            }
+            ::memset(ptr, static_cast<int>(i % 251 + 1), alloc.size);
+            outPtrs.push_back(ptr);
+        }
+
+        for_range(i, allocations.size())
+        {
+            const unsigned char pattern = static_cast<unsigned char>(i % 251 + 1);
+            for_range(j, allocations[i].size)
+            {
+                if (outPtrs[i][j] != pattern)
+                {
+                    Log::Errorf("Mismatch between content of %s allocation %zu at byte %zu: memory overlaps with another allocation\n", name, i, j);
+                    result = TestResult::FailedMismatch;
+                    return false;
+                }
+            }
+        }
+
+        if (arena.GetSize() != totalSize)
+        {
+            Log::Errorf("Mismatch between %s arena size (%zu) and expected size (%zu)\n", name, arena.GetSize(), totalSize);
+            result = TestResult::FailedMismatch;
+            return false;
+        }
+
+        return true;
+    };
+
+    std::vector<unsigned char*> ptrs;
+    if (!AllocateAll("first frame", ptrs))
+        return result;
+
+    // After a reset, all blocks are consolidated into one that fits the high-water mark, so all allocations must be packed into a single block
+    for_range(frame, 3u)
+    {
+        arena.Reset();
+        if (arena.GetSize() != 0)
+        {
+            Log::Errorf("Mismatch between arena size after reset (%zu) and expected size (0)\n", arena.GetSize());
+            result = TestResult::FailedMismatch;
+        }
+
+        if (!AllocateAll("consolidated frame", ptrs))
+            return result;
+
+        for_range(i, ptrs.size() - 1)
+        {
+            const std::uintptr_t end        = reinterpret_cast<std::uintptr_t>(ptrs[i]) + allocations[i].size;
+            const std::uintptr_t nextAlign  = allocations[i + 1].alignment;
+            const std::uintptr_t expected   = (end + nextAlign - 1) & ~(nextAlign - 1);
+            if (reinterpret_cast<std::uintptr_t>(ptrs[i + 1]) != expected)
+            {
+                Log::Errorf("Mismatch between address of consolidated allocation %zu (%p) and expected address (0x%zX)\n", i + 1, ptrs[i + 1], static_cast<std::size_t>(expected));
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    // Allocations with large alignment in a fresh arena must be aligned as well
+    {
+        LinearArena smallArena{ 256 };
+        for (std::size_t alignment : { 512u, 4096u, 32u })
+        {
+            void* ptr = smallArena.Allocate(100, alignment);
+            if (reinterpret_cast<std::uintptr_t>(ptr) % alignment != 0)
+            {
+                Log::Errorf("Mismatch between alignment of allocation (%p) and expected alignment (%zu)\n", ptr, alignment);
+                result = TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    // Current arena of this thread must be restored in nested frames
+    {
+        LinearArena outerArena, innerArena;
+
+        LinearArena* prevOuter = outerArena.BeginFrame();
+        LinearArena* prevInner = innerArena.BeginFrame();
+
+        if (prevOuter != nullptr || prevInner != &outerArena || LinearArena::GetCurrent() != &innerArena)
+        {
+            Log::Errorf("Mismatch between current arena in nested frames\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        innerArena.EndFrame(prevInner);
+        if (LinearArena::GetCurrent() != &outerArena)
+        {
+            Log::Errorf("Mismatch between current arena after ending nested frame\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        outerArena.EndFrame(prevOuter);
+        if (LinearArena::GetCurrent() != nullptr)
+        {
+            Log::Errorf("Mismatch between current arena after ending outer frame: expected null\n");
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // ArenaAllocator must allocate from the current arena and fall back to the heap if there is none
+    {
+        using ArenaVector = std::vector<int, ArenaAllocator<int>>;
+
+        ArenaVector heapVector;
+        for_range(i, 100)
+            heapVector.push_back(static_cast<int>(i));
+
+        LinearArena* prevArena = arena.BeginFrame();
+        {
+            ArenaVector arenaVector;
+            for_range(i, 1000)
+                arenaVector.push_back(static_cast<int>(i));
+
+            if (arena.GetSize() < sizeof(int) * 1000)
+            {
+                Log::Errorf("Mismatch between arena size (%zu) and minimum size of ArenaAllocator allocations (%zu)\n", arena.GetSize(), sizeof(int) * 1000);
+                result = TestResult::FailedMismatch;
+            }
+
+            // Heap memory must be released even while an arena is current
+            heapVector.clear();
+            heapVector.shrink_to_fit();
+
+            for_range(i, 1000)
+            {
+                if (arenaVector[i] != static_cast<int>(i))
+                {
+                    Log::Errorf("Mismatch between ArenaAllocator vector element %zu (%d) and expected value\n", i, arenaVector[i]);
+                    result = TestResult::FailedMismatch;
+                    break;
+                }
+            }
+
+            // Arena memory must be safe to deallocate after the arena is no longer current
+            arena.EndFrame(prevArena);
+        }
+    }
+
+    return result;
+}
+
@@ -0,0 +1,274 @@
+/*
+ * TestMeshOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/MeshOptimizer.h>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <string.h>
+
+
+struct MeshOptimizerVertex
+{
+    float           position[3];
+    std::uint32_t   id;         // Original vertex index to validate the remapping
+};
+
+using MeshOptimizerTriangle = std::array<std::uint32_t, 3>;
+
+// Returns the triangle with its vertex IDs rotated so that the smallest comes first, which preserves the winding order
+static MeshOptimizerTriangle MakeCanonicalTriangle(std::uint32_t v0, std::uint32_t v1, std::uint32_t v2)
+{
+    if (v1 < v0 && v1 < v2)
+        return { v1, v2, v0 };
+    if (v2 < v0 && v2 < v1)
+        return { v2, v0, v1 };
+    return { v0, v1, v2 };
+}
+
+// Returns the sorted list of canonical triangles of the specified mesh in terms of original vertex IDs
+static std::vector<MeshOptimizerTriangle> GetSortedTriangles(const MeshOptimizerVertex* vertices, const std::uint32_t* indices, std::size_t numIndices)
+{
+    std::vector<MeshOptimizerTriangle> triangles;
+    triangles.reserve(numIndices / 3);
+    for (std::size_t i = 0; i + 2 < numIndices; i += 3)
+        triangles.push_back(MakeCanonicalTriangle(vertices[indices[i]].id, vertices[indices[i + 1]].id, vertices[indices[i + 2]].id));
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+DEF_RITEST( MeshOptimizer )
+{
+    TestResult result = TestResult::Passed;
+
+    // Generate a grid on a hemisphere with unreferenced vertices in between, so that the vertex fetch optimization must discard them
+    constexpr std::uint32_t gridSize = 24;
+
+    std::vector<MeshOptimizerVertex>    vertices;
+    std::vector<std::uint32_t>          gridIndices;
+    std::vector<std::uint32_t>          indices;
+
+    for_range(y, gridSize)
+    {
+        for_range(x, gridSize)
+        {
+            const float u = static_cast<float>(x) / static_cast<float>(gridSize - 1) * 2.0f - 1.0f;
+            const float v = static_cast<float>(y) / static_cast<float>(gridSize - 1) * 2.0f - 1.0f;
+            const float w = ::sqrtf(std::max(0.0f, 2.0f - u*u - v*v));
+
+            gridIndices.push_back(static_cast<std::uint32_t>(vertices.size()));
+            vertices.push_back(MeshOptimizerVertex{ { u, v, w }, static_cast<std::uint32_t>(vertices.size()) });
+
+            if ((x + y) % 7 == 0)
+                vertices.push_back(MeshOptimizerVertex{ { 100.0f, 100.0f, 100.0f }, static_cast<std::uint32_t>(vertices.size()) });
+        }
+    }
+
+    for_range(y, gridSize - 1)
+    {
+        for_range(x, gridSize - 1)
+        {
+            const std::uint32_t i0 = gridIndices[y * gridSize + x];
+            const std::uint32_t i1 = gridIndices[y * gridSize + x + 1];
+            const std::uint32_t i2 = gridIndices[(y + 1) * gridSize + x];
+            const std::uint32_t i3 = gridIndices[(y + 1) * gridSize + x + 1];
+            indices.insert(indices.end(), { i0, i1, i3, i0, i3, i2 });
+        }
+    }
+
+    const std::size_t                           numIndices          = indices.size();
+    const std::size_t                           numReferenced       = gridIndices.size();
+    const std::vector<MeshOptimizerTriangle>    originalTriangles   = GetSortedTriangles(vertices.data(), indices.data(), indices.size());
+
+    // Validates the indices and meshlets of the specified mesh against the original mesh
+    auto ValidateMesh = [&](const char* name, const MeshOptimizerMesh& mesh, std::uint32_t maxVertices, std::uint32_t maxTriangles, bool hasMeshlets) -> void
+    {
+        if (mesh.numIndices != numIndices)
+        {
+            Log::Errorf("Mismatch between number of indices of %s (%zu) and original mesh (%zu)\n", name, mesh.numIndices, numIndices);
+            result = TestResult::FailedMismatch;
+            return;
+        }
+
+        for_range(i, mesh.numIndices)
+        {
+            if (mesh.indices[i] >= mesh.numVertices)
+            {
+                Log::Errorf("Index %u of %s at position %zu is out of bounds (%zu vertices)\n", mesh.indices[i], name, i, mesh.numVertices);
+                result = TestResult::FailedMismatch;
+                return;
+            }
+        }
+
+        // Every triangle must be preserved with its winding order
+        if (GetSortedTriangles(static_cast<const MeshOptimizerVertex*>(mesh.vertices), mesh.indices, mesh.numIndices) != originalTriangles)
+        {
+            Log::Errorf("Mismatch between triangles of %s and original mesh\n", name);
+            result = TestResult::FailedMismatch;
+        }
+
+        if (!hasMeshlets)
+            return;
+
+        // Meshlets must respect their limits and reproduce the triangle list in order
+        std::size_t numMeshletTriangles = 0;
+        for (const Meshlet& meshlet : mesh.meshlets)
+        {
+            if (meshlet.numVertices == 0 || meshlet.numVertices > maxVertices || meshlet.numTriangles == 0 || meshlet.numTriangles > maxTriangles ||
+                meshlet.vertexOffset + meshlet.numVertices > mesh.meshletVertices.size() ||
+                meshlet.triangleOffset + meshlet.numTriangles * 3 > mesh.meshletTriangles.size())
+            {
+                Log::Errorf(
+                    "Meshlet of %s exceeds limits: %u vertices (max %u), %u triangles (max %u)\n",
+                    name, meshlet.numVertices, maxVertices, meshlet.numTriangles, maxTriangles
+                );
+                result = TestResult::FailedMismatch;
+                return;
+            }
+
+            const float* center = meshlet.boundingSphere;
+            const float radius = meshlet.boundingSphere[3];
+
+            for_range(i, meshlet.numTriangles * 3)
+            {
+                const std::uint8_t localIndex = mesh.meshletTriangles[meshlet.triangleOffset + i];
+                if (localIndex >= meshlet.numVertices || numMeshletTriangles * 3 + i >= mesh.numIndices)
+                {
+                    Log::Errorf("Meshlet triangle index %u of %s is out of bounds (%u vertices)\n", localIndex, name, meshlet.numVertices);
+                    result = TestResult::FailedMismatch;
+                    return;
+                }
+
+                const std::uint32_t vertexIndex = mesh.meshletVertices[meshlet.vertexOffset + localIndex];
+                if (vertexIndex != mesh.indices[numMeshletTriangles * 3 + i])
+                {
+                    Log::Errorf("Mismatch between meshlet vertex %u of %s and index %u\n", vertexIndex, name, mesh.indices[numMeshletTriangles * 3 + i]);
+                    result = TestResult::FailedMismatch;
+                    return;
+                }
+
+                // Bounding sphere must enclose all vertices of the meshlet
+                const float* position = static_cast<const MeshOptimizerVertex*>(mesh.vertices)[vertexIndex].position;
+                const float dx = position[0] - center[0], dy = position[1] - center[1], dz = position[2] - center[2];
+                if (::sqrtf(dx*dx + dy*dy + dz*dz) > radius * 1.001f + 1.0e-5f)
+                {
+                    Log::Errorf("Meshlet bounding sphere of %s does not enclose vertex %u\n", name, vertexIndex);
+                    result = TestResult::FailedMismatch;
+                    return;
+                }
+            }
+
+            numMeshletTriangles += meshlet.numTriangles;
+        }
+
+        if (numMeshletTriangles * 3 != mesh.numIndices)
+        {
+            Log::Errorf("Mismatch between number of meshlet triangles of %s (%zu) and triangles (%zu)\n", name, numMeshletTriangles, mesh.numIndices / 3);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    // Optimize vertex cache only; vertices must remain untouched
+    {
+        std::vector<std::uint32_t> cacheIndices = indices;
+        OptimizeVertexCache(cacheIndices.data(), cacheIndices.size(), vertices.size());
+
+        MeshOptimizerMesh mesh;
+        {
+            mesh.indices        = cacheIndices.data();
+            mesh.numIndices     = cacheIndices.size();
+            mesh.vertices       = vertices.data();
+            mesh.numVertices    = vertices.size();
+        }
+        ValidateMesh("vertex cache optimized mesh", mesh, 0, 0, false);
+    }
+
+    // Apply all optimizations with the default limits and with small limits, so that both limits split meshlets
+    const std::uint32_t meshletLimits[][2] =
+    {
+        {  64, 124 },
+        {   8,  64 },
+        {  64,   5 },
+        {   3,   1 },
+    };
+
+    for (const auto& limits : meshletLimits)
+    {
+        std::vector<MeshOptimizerVertex>    optVertices = vertices;
+        std::vector<std::uint32_t>          optIndices  = indices;
+
+        MeshOptimizerMesh mesh;
+        {
+            mesh.indices        = optIndices.data();
+            mesh.numIndices     = optIndices.size();
+            mesh.vertices       = optVertices.data();
+            mesh.numVertices    = optVertices.size();
+            mesh.vertexStride   = sizeof(MeshOptimizerVertex);
+            mesh.positionOffset = 0;
+        }
+
+        MeshOptimizerDescriptor optDesc;
+        {
+            optDesc.maxMeshletVertices  = limits[0];
+            optDesc.maxMeshletTriangles = limits[1];
+        }
+        OptimizeMeshes(&mesh, 1, optDesc);
+
+        // Only referenced vertices must remain and they must be a permutation of the original ones
+        if (mesh.numVertices != numReferenced)
+        {
+            Log::Errorf("Mismatch between number of optimized vertices (%zu) and referenced vertices (%zu)\n", mesh.numVertices, numReferenced);
+            result = TestResult::FailedMismatch;
+            continue;
+        }
+
+        std::vector<bool> vertexSeen(vertices.size(), false);
+        for_range(i, optVertices.size())
+        {
+            const std::uint32_t id = optVertices[i].id;
+            if (id >= vertices.size() || vertexSeen[id] || ::memcmp(optVertices[i].position, vertices[id].position, sizeof(float) * 3) != 0)
+            {
+                Log::Errorf("Invalid vertex remapping: vertex %zu refers to original vertex %u\n", i, id);
+                result = TestResult::FailedMismatch;
+                break;
+            }
+            vertexSeen[id] = true;
+
+            // Unreferenced vertices must be moved to the end
+            const bool isReferenced = (vertices[id].position[0] != 100.0f);
+            if (isReferenced != (i < mesh.numVertices))
+            {
+                Log::Errorf("Invalid vertex remapping: unreferenced vertex %u was not moved to the end\n", id);
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+
+        // Vertices must be ordered by their first reference in the index buffer
+        std::uint32_t nextVertex = 0;
+        for_range(i, mesh.numIndices)
+        {
+            if (mesh.indices[i] > nextVertex)
+            {
+                Log::Errorf("Invalid vertex fetch order: index %u at position %zu precedes vertex %u\n", mesh.indices[i], i, nextVertex);
+                result = TestResult::FailedMismatch;
+                break;
+            }
+            if (mesh.indices[i] == nextVertex)
+                ++nextVertex;
+        }
+
+        const std::string name = "optimized mesh with meshlet limits " + std::to_string(limits[0]) + "/" + std::to_string(limits[1]);
+        ValidateMesh(name.c_str(), mesh, limits[0], limits[1], true);
+    }
+
+    return result;
+}
+
@@ -0,0 +1,269 @@
+/*
+ * TestMipChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <vector>
+#include <math.h>
+#include <string.h>
+
+
+DEF_RITEST( MipChain )
+{
+    TestResult result = TestResult::Passed;
+
+    std::uint32_t seed = 0x51ED270Bu;
+    auto NextRandom = [&seed]() -> float
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+    };
+
+    // Returns the number of pixels of all layers in the specified MIP-map level
+    auto GetMipPixels = [](const Extent3D& extent, std::uint32_t mipLevel) -> std::size_t
+    {
+        return static_cast<std::size_t>(std::max(1u, extent.x >> mipLevel)) * std::max(1u, extent.y >> mipLevel) * extent.z;
+    };
+
+    auto GenerateFloatImage = [&NextRandom](const Extent3D& extent) -> std::vector<float>
+    {
+        std::vector<float> image(static_cast<std::size_t>(extent.x) * extent.y * extent.z * 4);
+        for (float& value : image)
+            value = NextRandom();
+        return image;
+    };
+
+    // Returns the float view of the specified MIP-map level within an RGBA Float32 MIP chain
+    auto GetMipLevelFloats = [&GetMipPixels](const DynamicByteArray& mipChain, const Extent3D& extent, std::uint32_t mipLevel) -> const float*
+    {
+        std::size_t offset = 0;
+        for (std::uint32_t i = 1; i < mipLevel; ++i)
+            offset += GetMipPixels(extent, i) * 4 * sizeof(float);
+        return reinterpret_cast<const float*>(mipChain.get() + offset);
+    };
+
+    // Invalid inputs and single MIP-map levels must not generate anything
+    {
+        const std::uint8_t pixel[4] = { 1, 2, 3, 4 };
+        const ImageView imageView{ ImageFormat::RGBA, DataType::UInt8, pixel, sizeof(pixel) };
+        const ImageView compressedView{ ImageFormat::BC1, DataType::UInt8, pixel, sizeof(pixel) };
+        if (GenerateMipChain(imageView, Extent3D{ 1, 1, 1 }) ||
+            GenerateMipChain(imageView, Extent3D{ 2, 2, 1 }) ||
+            GenerateMipChain(compressedView, Extent3D{ 4, 4, 1 }) ||
+            GenerateMipChain(imageView, Extent3D{ 0, 1, 1 }))
+        {
+            Log::Errorf("GenerateMipChain succeeded for invalid input, but expected failure\n");
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Box filter of even extents must average 2x2 pixels of each layer independently; array layers must not bleed into each other
+    {
+        const Extent3D extent{ 16, 8, 2 };
+        const std::vector<float> baseLevel = GenerateFloatImage(extent);
+        const ImageView imageView{ ImageFormat::RGBA, DataType::Float32, baseLevel.data(), baseLevel.size() * sizeof(float) };
+
+        DynamicByteArray mipChain = GenerateMipChain(imageView, extent);
+
+        std::size_t expectedSize = 0;
+        for (std::uint32_t mipLevel = 1; mipLevel < NumMipLevels(extent.x, extent.y); ++mipLevel)
+            expectedSize += GetMipPixels(extent, mipLevel) * 4 * sizeof(float);
+
+        if (!mipChain || mipChain.size() != expectedSize)
+        {
+            Log::Errorf("Mismatch between size of MIP chain (%zu) and expected size (%zu)\n", mipChain.size(), expectedSize);
+            return TestResult::FailedMismatch;
+        }
+
+        std::vector<float> reference = baseLevel;
+        Extent3D srcExtent = extent;
+
+        for (std::uint32_t mipLevel = 1; mipLevel < NumMipLevels(extent.x, extent.y) && result == TestResult::Passed; ++mipLevel)
+        {
+            const Extent3D dstExtent{ std::max(1u, srcExtent.x / 2), std::max(1u, srcExtent.y / 2), extent.z };
+            std::vector<float> nextReference(static_cast<std::size_t>(dstExtent.x) * dstExtent.y * dstExtent.z * 4);
+
+            const std::uint32_t stepX = srcExtent.x / dstExtent.x;
+            const std::uint32_t stepY = srcExtent.y / dstExtent.y;
+
+            for_range(z, dstExtent.z)
+            {
+                for_range(y, dstExtent.y)
+                {
+                    for_range(x, dstExtent.x)
+                    {
+                        for_range(c, 4u)
+                        {
+                            double sum = 0.0;
+                            for_range(j, stepY)
+                            {
+                                for_range(i, stepX)
+                                    sum += reference[(((z * srcExtent.y) + y * stepY + j) * srcExtent.x + x * stepX + i) * 4 + c];
+                            }
+                            nextReference[(((z * dstExtent.y) + y) * dstExtent.x + x) * 4 + c] = static_cast<float>(sum / (stepX * stepY));
+                        }
+                    }
+                }
+            }
+
+            const float* mipData = GetMipLevelFloats(mipChain, extent, mipLevel);
+            for_range(i, nextReference.size())
+            {
+                if (::fabsf(mipData[i] - nextReference[i]) > 1.0e-5f)
+                {
+                    Log::Errorf("Mismatch between box filtered MIP-map %u at component %zu (%f) and expected value (%f)\n", mipLevel, i, mipData[i], nextReference[i]);
+                    result = TestResult::FailedMismatch;
+                    break;
+                }
+            }
+
+            reference = std::move(nextReference);
+            srcExtent = dstExtent;
+        }
+
+        // Multi-threaded filtering must produce identical results
+        DynamicByteArray mipChainMT = GenerateMipChain(imageView, extent, 0, ImageFilter::Box, 0, 4);
+        if (!mipChainMT || mipChainMT.size() != mipChain.size() || ::memcmp(mipChainMT.get(), mipChain.get(), mipChain.size()) != 0)
+        {
+            Log::Errorf("Mismatch between multi-threaded and single-threaded MIP chain\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        // Limited number of MIP-map levels must only generate the requested levels
+        DynamicByteArray mipChain3 = GenerateMipChain(imageView, extent, 3);
+        const std::size_t expectedSize3 = (GetMipPixels(extent, 1) + GetMipPixels(extent, 2)) * 4 * sizeof(float);
+        if (!mipChain3 || mipChain3.size() != expectedSize3 || ::memcmp(mipChain3.get(), mipChain.get(), expectedSize3) != 0)
+        {
+            Log::Errorf("Mismatch between MIP chain with 3 levels (size = %zu) and expected size (%zu)\n", mipChain3.size(), expectedSize3);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Box filter of odd extents must preserve the mean of each layer, since each source pixel is weighted by its coverage
+    for (const Extent3D& extent : { Extent3D{ 7, 5, 2 }, Extent3D{ 9, 1, 1 }, Extent3D{ 1, 11, 1 }, Extent3D{ 13, 2, 1 } })
+    {
+        const std::vector<float> baseLevel = GenerateFloatImage(extent);
+        const ImageView imageView{ ImageFormat::RGBA, DataType::Float32, baseLevel.data(), baseLevel.size() * sizeof(float) };
+
+        DynamicByteArray mipChain = GenerateMipChain(imageView, extent);
+        if (!mipChain)
+        {
+            Log::Errorf("Failed to generate MIP chain for extent %u x %u x %u\n", extent.x, extent.y, extent.z);
+            result = TestResult::FailedMismatch;
+            continue;
+        }
+
+        auto GetLayerMean = [](const float* data, std::size_t numPixels, std::uint32_t layer, std::uint32_t c) -> double
+        {
+            double sum = 0.0;
+            for_range(i, numPixels)
+                sum += data[(layer * numPixels + i) * 4 + c];
+            return sum / static_cast<double>(numPixels);
+        };
+
+        const std::size_t basePixels = static_cast<std::size_t>(extent.x) * extent.y;
+        for (std::uint32_t mipLevel = 1; mipLevel < NumMipLevels(extent.x, extent.y); ++mipLevel)
+        {
+            const float* mipData = GetMipLevelFloats(mipChain, extent, mipLevel);
+            const std::size_t mipPixels = GetMipPixels(extent, mipLevel) / extent.z;
+            for_range(z, extent.z)
+            {
+                for_range(c, 4u)
+                {
+                    const double baseMean   = GetLayerMean(baseLevel.data(), basePixels, z, c);
+                    const double mipMean    = GetLayerMean(mipData, mipPixels, z, c);
+                    if (::fabs(baseMean - mipMean) > 1.0e-4)
+                    {
+                        Log::Errorf(
+                            "Mismatch between mean of MIP-map %u [layer %u, component %u] (%f) and base level (%f) for extent %u x %u x %u\n",
+                            mipLevel, z, c, mipMean, baseMean, extent.x, extent.y, extent.z
+                        );
+                        result = TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+    }
+
+    // Constant images must remain constant with both filters, also in sRGB color space
+    {
+        const Extent3D extent{ 12, 10, 1 };
+        const std::uint8_t color[4] = { 200, 13, 128, 255 };
+
+        std::vector<std::uint8_t> baseLevel(static_cast<std::size_t>(extent.x) * extent.y * 4);
+        for_range(i, baseLevel.size())
+            baseLevel[i] = color[i % 4];
+
+        const ImageView imageView{ ImageFormat::RGBA, DataType::UInt8, baseLevel.data(), baseLevel.size() };
+
+        for (ImageFilter filter : { ImageFilter::Box, ImageFilter::Kaiser })
+        {
+            for (long flags : { 0L, static_cast<long>(MipChainFlags::SRGB) })
+            {
+                DynamicByteArray mipChain = GenerateMipChain(imageView, extent, 0, filter, flags);
+                if (!mipChain)
+                {
+                    Log::Errorf("Failed to generate RGBA8 MIP chain\n");
+                    result = TestResult::FailedMismatch;
+                    continue;
+                }
+
+                const std::uint8_t* mipData = reinterpret_cast<const std::uint8_t*>(mipChain.get());
+                for_range(i, mipChain.size())
+                {
+                    const int delta = static_cast<int>(mipData[i]) - static_cast<int>(color[i % 4]);
+                    if (delta < -1 || delta > 1)
+                    {
+                        Log::Errorf(
+                            "Mismatch between constant MIP chain component %zu (%u) and expected value (%u) with %s filter%s\n",
+                            i, mipData[i], color[i % 4], (filter == ImageFilter::Box ? "box" : "Kaiser"), (flags != 0 ? " in sRGB" : "")
+                        );
+                        result = TestResult::FailedMismatch;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Alpha coverage must be preserved for alpha-tested images
+    {
+        const Extent3D extent{ 32, 32, 1 };
+        std::vector<float> baseLevel(static_cast<std::size_t>(extent.x) * extent.y * 4, 1.0f);
+        for_range(i, static_cast<std::size_t>(extent.x) * extent.y)
+            baseLevel[i * 4 + 3] = (NextRandom() < 0.25f ? 0.9f : 0.2f);
+
+        auto GetAlphaCoverage = [](const float* data, std::size_t numPixels) -> float
+        {
+            std::size_t count = 0;
+            for_range(i, numPixels)
+            {
+                if (data[i * 4 + 3] > 0.5f)
+                    ++count;
+            }
+            return static_cast<float>(count) / static_cast<float>(numPixels);
+        };
+
+        const float baseCoverage = GetAlphaCoverage(baseLevel.data(), baseLevel.size() / 4);
+
+        const ImageView imageView{ ImageFormat::RGBA, DataType::Float32, baseLevel.data(), baseLevel.size() * sizeof(float) };
+        DynamicByteArray mipChain = GenerateMipChain(imageView, extent, 0, ImageFilter::Box, MipChainFlags::PreserveAlphaCoverage);
+
+        // Only compare levels with enough pixels to represent the coverage
+        for (std::uint32_t mipLevel = 1; mipChain && mipLevel <= 3; ++mipLevel)
+        {
+            const float coverage = GetAlphaCoverage(GetMipLevelFloats(mipChain, extent, mipLevel), GetMipPixels(extent, mipLevel));
+            if (::fabsf(coverage - baseCoverage) > 0.1f)
+            {
+                Log::Errorf("Mismatch between alpha coverage of MIP-map %u (%f) and base level (%f)\n", mipLevel, coverage, baseCoverage);
+                result = TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    return result;
+}
+
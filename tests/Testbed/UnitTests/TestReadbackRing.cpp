@@ -0,0 +1,195 @@
+/*
+ * TestReadbackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ReadbackRing.h>
+#include <vector>
+#include <string.h>
+
+
+DEF_RITEST( ReadbackRing )
+{
+    TestResult result = TestResult::Passed;
+
+    // Readback scheduling is independent of the backend, so use the Null renderer to create the hardware resources
+    RenderSystemPtr nullRenderer = RenderSystem::Load("Null");
+    if (!nullRenderer)
+        return TestResult::Skipped;
+
+    constexpr std::uint64_t blockSize = 4096;
+
+    // Create source buffer with a known pattern
+    std::vector<std::uint8_t> bufferData(3 * blockSize);
+    for_range(i, bufferData.size())
+        bufferData[i] = static_cast<std::uint8_t>(i * 7 + (i >> 8));
+
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = bufferData.size();
+        bufferDesc.bindFlags    = BindFlags::CopySrc;
+    }
+    Buffer* srcBuffer = nullRenderer->CreateBuffer(bufferDesc, bufferData.data());
+
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = TextureType::Texture2D;
+        textureDesc.bindFlags   = BindFlags::CopySrc | BindFlags::Sampled;
+        textureDesc.format      = Format::RGBA8UNorm;
+        textureDesc.extent      = Extent3D{ 16, 8, 1 };
+        textureDesc.mipLevels   = 1;
+    }
+    Texture* srcTexture = nullRenderer->CreateTexture(textureDesc);
+
+    CommandBuffer* cmdBuffer = nullRenderer->CreateCommandBuffer();
+    CommandQueue* cmdQueue = nullRenderer->GetCommandQueue();
+
+    {
+        ReadbackRing readbackRing{ *nullRenderer, blockSize };
+
+        auto ValidateStats = [&result, &readbackRing](const char* name, std::uint32_t numBlocks, std::uint32_t numTickets) -> void
+        {
+            const ReadbackRingStatistics stats = readbackRing.GetStatistics();
+            if (stats.numBlocks != numBlocks || stats.numTickets != numTickets)
+            {
+                Log::Errorf(
+                    "Mismatch between readback ring statistics %s: blocks = %u, tickets = %u; expected %u, %u\n",
+                    name, stats.numBlocks, stats.numTickets, numBlocks, numTickets
+                );
+                result = TestResult::FailedMismatch;
+            }
+        };
+
+        // Empty readbacks are invalid
+        {
+            TextureRegion emptyRegion;
+            emptyRegion.extent = Extent3D{ 0, 4, 1 };
+            if (readbackRing.ReadBuffer(*cmdBuffer, *srcBuffer, 0, 0).IsValid() ||
+                readbackRing.ReadTexture(*cmdBuffer, *srcTexture, emptyRegion).IsValid())
+            {
+                Log::Errorf("Recording empty readback succeeded, but expected failure\n");
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        struct BufferReadback
+        {
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        // The last range is larger than the block size and gets its own readback buffer
+        const BufferReadback bufferReadbacks[] =
+        {
+            {    3,  100 },
+            { 1000, 1500 },
+            {   16, 2000 },
+            {    0, 2 * blockSize + 6 },
+        };
+
+        const Extent3D textureRegionExtent{ 9, 5, 1 };
+
+        TextureRegion textureRegion;
+        {
+            textureRegion.offset = Offset3D{ 3, 2, 0 };
+            textureRegion.extent = textureRegionExtent;
+        }
+
+        std::uint32_t numBlocksAfterFirstFrame = 0;
+
+        for_range(frame, 3u)
+        {
+            std::vector<ReadbackTicket> bufferTickets;
+
+            cmdBuffer->Begin();
+            {
+                for (const BufferReadback& readback : bufferReadbacks)
+                    bufferTickets.push_back(readbackRing.ReadBuffer(*cmdBuffer, *srcBuffer, readback.offset, readback.size));
+            }
+            const ReadbackTicket textureTicket = readbackRing.ReadTexture(*cmdBuffer, *srcTexture, textureRegion);
+            cmdBuffer->End();
+
+            // Readbacks are not available before they have been submitted
+            if (readbackRing.IsReady(textureTicket) || readbackRing.Wait(bufferTickets[0], 0))
+            {
+                Log::Errorf("Readback is ready before it has been submitted in frame %u\n", frame);
+                result = TestResult::FailedMismatch;
+            }
+
+            cmdQueue->Submit(*cmdBuffer);
+            readbackRing.Submit(*cmdQueue);
+
+            const std::uint32_t numTickets = static_cast<std::uint32_t>(bufferTickets.size() + 1);
+            if (frame == 0)
+                numBlocksAfterFirstFrame = readbackRing.GetStatistics().numBlocks;
+
+            // Blocks must be recycled once all of their tickets have been released
+            ValidateStats("after submitting readbacks", numBlocksAfterFirstFrame, numTickets);
+
+            for_range(i, bufferTickets.size())
+            {
+                const ReadbackTicket& ticket = bufferTickets[i];
+                const BufferReadback& readback = bufferReadbacks[i];
+
+                if (!readbackRing.Wait(ticket) || readbackRing.GetSize(ticket) != readback.size)
+                {
+                    Log::Errorf("Mismatch between size of buffer readback %zu (%" PRIu64 ") and expected size (%" PRIu64 ")\n", i, readbackRing.GetSize(ticket), readback.size);
+                    result = TestResult::FailedMismatch;
+                    continue;
+                }
+
+                // The first readback of each frame is read into a smaller buffer, which must only receive as many bytes as it can hold
+                const std::uint64_t readSize = (i == 0 ? readback.size / 2 : readback.size);
+                std::vector<std::uint8_t> data(static_cast<std::size_t>(readback.size), 0xCD);
+                if (!readbackRing.Read(ticket, data.data(), readSize) ||
+                    ::memcmp(data.data(), bufferData.data() + readback.offset, static_cast<std::size_t>(readSize)) != 0 ||
+                    (readSize < readback.size && data[static_cast<std::size_t>(readSize)] != 0xCD))
+                {
+                    Log::Errorf("Mismatch between buffer readback %zu (offset = %" PRIu64 ", size = %" PRIu64 ") and source buffer in frame %u\n", i, readback.offset, readback.size, frame);
+                    result = TestResult::FailedMismatch;
+                }
+            }
+
+            // Texels are not compared, since the Null renderer does not implement texture-to-buffer copies
+            std::vector<std::uint8_t> texels(textureRegionExtent.x * textureRegionExtent.y * 4, 0);
+            if (!readbackRing.IsReady(textureTicket) || readbackRing.GetSize(textureTicket) != texels.size())
+            {
+                Log::Errorf("Mismatch between size of texture readback (%" PRIu64 ") and expected size (%zu)\n", readbackRing.GetSize(textureTicket), texels.size());
+                result = TestResult::FailedMismatch;
+            }
+            else if (frame == 2)
+            {
+                // Tickets that are released without reading must still free their block
+                readbackRing.Release(textureTicket);
+            }
+            else if (!readbackRing.Read(textureTicket, texels.data(), texels.size()))
+            {
+                Log::Errorf("Failed to read texture readback in frame %u\n", frame);
+                result = TestResult::FailedMismatch;
+            }
+
+            ValidateStats("after reading all readbacks", numBlocksAfterFirstFrame, 0);
+        }
+
+        // All blocks have been signaled and have no tickets left
+        const std::uint32_t numReleased = readbackRing.ReleaseUnusedBlocks();
+        if (numReleased != numBlocksAfterFirstFrame)
+        {
+            Log::Errorf("Mismatch between number of released readback blocks (%u) and expected number (%u)\n", numReleased, numBlocksAfterFirstFrame);
+            result = TestResult::FailedMismatch;
+        }
+        ValidateStats("after releasing unused blocks", 0, 0);
+    }
+
+    nullRenderer->Release(*cmdBuffer);
+    nullRenderer->Release(*srcTexture);
+    nullRenderer->Release(*srcBuffer);
+
+    RenderSystem::Unload(std::move(nullRenderer));
+
+    return result;
+}
+
@@ -0,0 +1,263 @@
+/*
+ * TestSlotAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <Core/SlotAllocator.h>
+#include <Renderer/ContainerTypes.h>
+#include <algorithm>
+#include <vector>
+#include <string.h>
+
+
+struct SlotTestObject
+{
+    SlotTestObject(std::uint32_t id, int& numAlive) :
+        id       { id       },
+        self     { this     },
+        numAlive { numAlive }
+    {
+        ++numAlive;
+    }
+
+    virtual ~SlotTestObject()
+    {
+        --numAlive;
+    }
+
+    std::uint32_t           id;
+    const SlotTestObject*   self;       // Address at construction time to validate that objects never move
+    int&                    numAlive;
+};
+
+struct alignas(32) SlotTestObjectAligned : public SlotTestObject
+{
+    SlotTestObjectAligned(std::uint32_t id, int& numAlive) :
+        SlotTestObject { id, numAlive }
+    {
+        ::memset(payload, static_cast<int>(id & 0xFF), sizeof(payload));
+    }
+
+    unsigned char payload[40];
+};
+
+DEF_RITEST( SlotAllocator )
+{
+    TestResult result = TestResult::Passed;
+
+    std::uint32_t seed = 0x2468ACEu;
+    auto NextRandom = [&seed](std::uint32_t range) -> std::uint32_t
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % range;
+    };
+
+    // Allocate and free slots interleaved over several chunk growths; each slot is filled with a pattern of its ID to detect overlapping slots
+    {
+        constexpr std::size_t slotSize      = 24;
+        constexpr std::size_t slotAlignment = 16;
+
+        SlotAllocator allocator{ slotSize, slotAlignment };
+
+        if (allocator.GetSlotSize() < slotSize || allocator.GetSlotSize() % slotAlignment != 0 || allocator.GetSlotAlignment() != slotAlignment)
+        {
+            Log::Errorf("Mismatch between slot size (%zu) and alignment (%zu) of SlotAllocator\n", allocator.GetSlotSize(), allocator.GetSlotAlignment());
+            result = TestResult::FailedMismatch;
+        }
+
+        struct SlotEntry
+        {
+            unsigned char*  slot;
+            unsigned char   pattern;
+        };
+
+        std::vector<SlotEntry> slots;
+
+        auto ValidateSlot = [&result, &allocator](const SlotEntry& entry) -> bool
+        {
+            for_range(i, allocator.GetSlotSize())
+            {
+                if (entry.slot[i] != entry.pattern)
+                {
+                    Log::Errorf("Mismatch between content of slot %p at byte %zu: expected 0x%02X\n", entry.slot, i, entry.pattern);
+                    result = TestResult::FailedMismatch;
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        for_range(i, 4000u)
+        {
+            if (slots.empty() || NextRandom(3) != 0)
+            {
+                unsigned char* slot = static_cast<unsigned char*>(allocator.Allocate());
+                if (reinterpret_cast<std::uintptr_t>(slot) % slotAlignment != 0)
+                {
+                    Log::Errorf("Slot %p of SlotAllocator is not aligned to %zu bytes\n", slot, slotAlignment);
+                    return TestResult::FailedMismatch;
+                }
+                const unsigned char pattern = static_cast<unsigned char>(i % 251 + 1);
+                ::memset(slot, pattern, allocator.GetSlotSize());
+                slots.push_back(SlotEntry{ slot, pattern });
+            }
+            else
+            {
+                const std::size_t index = NextRandom(static_cast<std::uint32_t>(slots.size()));
+                const SlotEntry entry = slots[index];
+                if (!ValidateSlot(entry))
+                    return result;
+
+                slots[index] = slots.back();
+                slots.pop_back();
+                allocator.Free(entry.slot);
+
+                // Released slots are recycled first
+                if (NextRandom(2) == 0)
+                {
+                    void* slot = allocator.Allocate();
+                    if (slot != entry.slot)
+                    {
+                        Log::Errorf("Mismatch between recycled slot %p and released slot %p\n", slot, entry.slot);
+                        result = TestResult::FailedMismatch;
+                    }
+                    ::memset(slot, entry.pattern, allocator.GetSlotSize());
+                    slots.push_back(SlotEntry{ static_cast<unsigned char*>(slot), entry.pattern });
+                }
+            }
+
+            if (allocator.GetNumAllocatedSlots() != slots.size())
+            {
+                Log::Errorf("Mismatch between number of allocated slots (%zu) and expected number (%zu)\n", allocator.GetNumAllocatedSlots(), slots.size());
+                return TestResult::FailedMismatch;
+            }
+        }
+
+        for (const SlotEntry& entry : slots)
+        {
+            if (!ValidateSlot(entry))
+                break;
+        }
+
+        for (const SlotEntry& entry : slots)
+            allocator.Free(entry.slot);
+
+        if (allocator.GetNumAllocatedSlots() != 0)
+        {
+            Log::Errorf("Mismatch between number of allocated slots (%zu) after releasing all slots and expected number (0)\n", allocator.GetNumAllocatedSlots());
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Emplace and erase objects of two types with different slot sizes and alignments over several chunk growths
+    {
+        int numAlive = 0;
+
+        SlotObjectContainer<SlotTestObject> container;
+
+        // Reference of the container's array; erase() moves the last object to the location of the erased object
+        std::vector<SlotTestObject*> expectedObjects;
+        std::vector<std::uint32_t> expectedIDs;
+
+        auto ValidateContainer = [&]() -> bool
+        {
+            if (numAlive != static_cast<int>(expectedObjects.size()))
+            {
+                Log::Errorf("Mismatch between number of alive objects (%d) and expected number (%zu)\n", numAlive, expectedObjects.size());
+                result = TestResult::FailedMismatch;
+                return false;
+            }
+
+            std::size_t index = 0;
+            for (SlotTestObject* object : container)
+            {
+                if (index >= expectedObjects.size() || object != expectedObjects[index])
+                {
+                    Log::Errorf("Mismatch between SlotObjectContainer entry %zu (%p) and expected object\n", index, object);
+                    result = TestResult::FailedMismatch;
+                    return false;
+                }
+                if (object->self != object || object->id != expectedIDs[index])
+                {
+                    Log::Errorf("Mismatch between SlotObjectContainer entry %zu: object %p has moved or was overwritten\n", index, object);
+                    result = TestResult::FailedMismatch;
+                    return false;
+                }
+                ++index;
+            }
+
+            if (index != expectedObjects.size())
+            {
+                Log::Errorf("Mismatch between number of SlotObjectContainer entries (%zu) and expected number (%zu)\n", index, expectedObjects.size());
+                result = TestResult::FailedMismatch;
+                return false;
+            }
+
+            return true;
+        };
+
+        for_range(i, 4000u)
+        {
+            if (expectedObjects.empty() || NextRandom(3) != 0)
+            {
+                SlotTestObject* object = nullptr;
+                if (NextRandom(2) == 0)
+                    object = container.emplace<SlotTestObject>(i, numAlive);
+                else
+                    object = container.emplace<SlotTestObjectAligned>(i, numAlive);
+
+                if (reinterpret_cast<std::uintptr_t>(object) % alignof(SlotTestObjectAligned) != 0 && dynamic_cast<SlotTestObjectAligned*>(object) != nullptr)
+                {
+                    Log::Errorf("Object %p of SlotObjectContainer is not aligned to %zu bytes\n", object, alignof(SlotTestObjectAligned));
+                    return TestResult::FailedMismatch;
+                }
+
+                expectedObjects.push_back(object);
+                expectedIDs.push_back(i);
+            }
+            else
+            {
+                // Erase objects from random positions; erasing the last object must not touch any other entry
+                const std::size_t index = (NextRandom(8) == 0 ? expectedObjects.size() - 1 : NextRandom(static_cast<std::uint32_t>(expectedObjects.size())));
+                container.erase(expectedObjects[index]);
+
+                expectedObjects[index]  = expectedObjects.back();
+                expectedIDs[index]      = expectedIDs.back();
+                expectedObjects.pop_back();
+                expectedIDs.pop_back();
+            }
+
+            // Since erase() locates each object by the index in its slot header, a stale index would erase the wrong entry in a subsequent step
+            if (!ValidateContainer())
+                return result;
+        }
+
+        // Payload of aligned objects must be intact
+        for (SlotTestObject* object : container)
+        {
+            if (auto alignedObject = dynamic_cast<SlotTestObjectAligned*>(object))
+            {
+                const unsigned char pattern = static_cast<unsigned char>(object->id & 0xFF);
+                if (std::find_if(std::begin(alignedObject->payload), std::end(alignedObject->payload), [pattern](unsigned char b) { return b != pattern; }) != std::end(alignedObject->payload))
+                {
+                    Log::Errorf("Mismatch between payload of object %p and expected pattern 0x%02X\n", object, pattern);
+                    result = TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        container.clear();
+
+        if (numAlive != 0 || !container.empty())
+        {
+            Log::Errorf("Mismatch between number of alive objects (%d) after clearing SlotObjectContainer and expected number (0)\n", numAlive);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    return result;
+}
+
@@ -0,0 +1,151 @@
+/*
+ * TestTextureClear.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+
+
+DEF_TEST( TextureClear )
+{
+    const ColorRGBAub colorA{ 0x00, 0x00, 0x00, 0xFF };
+    const ColorRGBAub colorB{ 0xFF, 0x00, 0xFF, 0xFF };
+
+    const ClearValue clearValueA{ 0.0f, 0.0f, 0.0f, 1.0f };
+    const ClearValue clearValueB{ 1.0f, 0.0f, 1.0f, 1.0f };
+
+    // Clears all subresources with color A, then one MIP-map level of one array layer with color B, and reads back every subresource
+    auto ClearAndVerifyColorTexture = [this, &colorA, &colorB, &clearValueA, &clearValueB](const char* name, long bindFlags, std::uint32_t layers) -> TestResult
+    {
+        TextureDescriptor texDesc;
+        {
+            texDesc.type        = (layers > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+            texDesc.bindFlags   = bindFlags | BindFlags::CopySrc;
+            texDesc.format      = Format::RGBA8UNorm;
+            texDesc.extent      = Extent3D{ 16, 16, 1 };
+            texDesc.mipLevels   = 2;
+            texDesc.arrayLayers = layers;
+        }
+        CREATE_TEXTURE(tex, texDesc, name, nullptr);
+
+        const std::uint32_t clearedLayer    = layers / 2;
+        const std::uint32_t clearedMip      = 1;
+
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->ClearTexture(*tex, TextureSubresource{ 0, layers, 0, texDesc.mipLevels }, clearValueA);
+            cmdBuffer->ClearTexture(*tex, TextureSubresource{ clearedLayer, clearedMip }, clearValueB);
+        }
+        cmdBuffer->End();
+
+        std::vector<ColorRGBAub> outputData;
+
+        for_range(mip, texDesc.mipLevels)
+        {
+            const Extent3D mipExtent{ texDesc.extent.x >> mip, texDesc.extent.y >> mip, 1 };
+            outputData.clear();
+            outputData.resize(mipExtent.x * mipExtent.y);
+
+            for_range(layer, layers)
+            {
+                MutableImageView dstImage;
+                {
+                    dstImage.format     = ImageFormat::RGBA;
+                    dstImage.dataType   = DataType::UInt8;
+                    dstImage.data       = outputData.data();
+                    dstImage.dataSize   = sizeof(ColorRGBAub) * outputData.size();
+                }
+                renderer->ReadTexture(*tex, TextureRegion{ TextureSubresource{ layer, mip }, Offset3D{}, mipExtent }, dstImage);
+
+                const ColorRGBAub& expected = (layer == clearedLayer && mip == clearedMip ? colorB : colorA);
+                for_range(i, outputData.size())
+                {
+                    if (outputData[i] != expected)
+                    {
+                        Log::Errorf(
+                            "Mismatch between data of texture %s [MIP %u, Layer %u, Texel %zu] and clear color:\n"
+                            " -> Expected: [%02X %02X %02X %02X]\n"
+                            " -> Actual:   [%02X %02X %02X %02X]\n",
+                            name, mip, layer, i,
+                            expected.r, expected.g, expected.b, expected.a,
+                            outputData[i].r, outputData[i].g, outputData[i].b, outputData[i].a
+                        );
+                        return TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+
+        renderer->Release(*tex);
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_TEXTURE_CLEAR(NAME, BINDFLAGS, LAYERS)                                     \
+        {                                                                                   \
+            TestResult result = ClearAndVerifyColorTexture((NAME), (BINDFLAGS), (LAYERS));  \
+            if (result != TestResult::Passed)                                               \
+                return result;                                                              \
+        }
+
+    // Render target textures are cleared with render passes or native clear commands
+    TEST_TEXTURE_CLEAR("tex{2D,16wh,attachment}", BindFlags::ColorAttachment, 1);
+
+    if (caps.features.hasArrayTextures)
+        TEST_TEXTURE_CLEAR("tex{2D[3],16wh,attachment}", BindFlags::ColorAttachment, 3);
+
+    // Storage textures are cleared without render passes
+    if (caps.features.hasComputeShaders)
+        TEST_TEXTURE_CLEAR("tex{2D,16wh,storage}", BindFlags::Storage, 1);
+
+    // Clear depth texture and read back depth values
+    TextureDescriptor depthTexDesc;
+    {
+        depthTexDesc.type       = TextureType::Texture2D;
+        depthTexDesc.bindFlags  = BindFlags::DepthStencilAttachment | BindFlags::CopySrc;
+        depthTexDesc.format     = Format::D32Float;
+        depthTexDesc.extent     = Extent3D{ 16, 16, 1 };
+        depthTexDesc.mipLevels  = 1;
+    }
+    CREATE_TEXTURE(depthTex, depthTexDesc, "depthTex{2D,16wh}", nullptr);
+
+    constexpr float clearDepth = 0.25f;
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->ClearTexture(*depthTex, TextureSubresource{ 0, 0 }, ClearValue{ clearDepth });
+    }
+    cmdBuffer->End();
+
+    std::vector<float> depthData(depthTexDesc.extent.x * depthTexDesc.extent.y, -1.0f);
+
+    MutableImageView depthImage;
+    {
+        depthImage.format   = ImageFormat::Depth;
+        depthImage.dataType = DataType::Float32;
+        depthImage.data     = depthData.data();
+        depthImage.dataSize = sizeof(float) * depthData.size();
+    }
+    renderer->ReadTexture(*depthTex, TextureRegion{ Offset3D{}, depthTexDesc.extent }, depthImage);
+
+    for_range(i, depthData.size())
+    {
+        if (depthData[i] != clearDepth)
+        {
+            Log::Errorf(
+                "Mismatch between data of texture depthTex{2D,16wh} [Texel %zu] and clear depth: Expected %f, Actual %f\n",
+                i, clearDepth, depthData[i]
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    renderer->Release(*depthTex);
+
+    return TestResult::Passed;
+}
+
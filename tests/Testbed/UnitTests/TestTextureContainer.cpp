@@ -0,0 +1,239 @@
+/*
+ * TestTextureContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/TextureContainer.h>
+#include <LLGL/Blob.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <vector>
+#include <string.h>
+
+
+// Appends 32-bit words to a byte container in little endian order
+static void AppendWords(std::vector<char>& data, std::initializer_list<std::uint32_t> words)
+{
+    for (std::uint32_t word : words)
+    {
+        for_range(i, 4u)
+            data.push_back(static_cast<char>((word >> (i * 8)) & 0xFF));
+    }
+}
+
+// Overwrites a 32-bit word at the specified byte offset in little endian order
+static void PatchWord(std::vector<char>& data, std::size_t offset, std::uint32_t word)
+{
+    for_range(i, 4u)
+        data[offset + i] = static_cast<char>((word >> (i * 8)) & 0xFF);
+}
+
+static void AppendBytes(std::vector<char>& data, std::size_t size, char value)
+{
+    data.insert(data.end(), size, value);
+}
+
+// Returns the byte pattern for the image at the specified MIP-map level and array layer
+static char GetImagePattern(std::uint32_t mipLevel, std::uint32_t arrayLayer)
+{
+    return static_cast<char>(0x10 * (arrayLayer + 1) + mipLevel);
+}
+
+// Makes a DDS file with DX10 header extension for an RGBA8 2D-array texture. Each image is filled with GetImagePattern.
+static std::vector<char> MakeDDS(std::uint32_t width, std::uint32_t height, std::uint32_t mipMapCount, std::uint32_t arraySize, std::uint32_t dxgiFormat = 28)
+{
+    std::vector<char> data;
+
+    AppendWords(data, { 0x20534444u });                                     // "DDS "
+    AppendWords(data, { 124u, 0u, height, width, 0u, 0u, mipMapCount });    // size, flags, height, width, pitchOrLinearSize, depth, mipMapCount
+    AppendWords(data, { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u });      // reserved1[11]
+    AppendWords(data, { 32u, 0x4u, 0x30315844u, 0u, 0u, 0u, 0u, 0u });      // pfSize, pfFlags = DDPF_FOURCC, pfFourCC = "DX10", bit count and masks
+    AppendWords(data, { 0u, 0u, 0u, 0u, 0u });                              // caps, caps2, caps3, caps4, reserved2
+    AppendWords(data, { dxgiFormat, 3u, 0u, arraySize, 0u });               // dxgiFormat, resourceDimension = TEXTURE2D, miscFlag, arraySize, miscFlags2
+
+    /* DDS stores all MIP-map levels of one array layer contiguously; levels beyond the full chain are 1x1 */
+    for_range(arrayLayer, arraySize)
+    {
+        for_range(mipLevel, mipMapCount)
+        {
+            const std::uint32_t mipWidth  = std::max(1u, width  >> mipLevel);
+            const std::uint32_t mipHeight = std::max(1u, height >> mipLevel);
+            AppendBytes(data, mipWidth * mipHeight * 4, GetImagePattern(mipLevel, arrayLayer));
+        }
+    }
+
+    return data;
+}
+
+// Makes a KTX2 file for an RGBA8 2D-array texture with a full MIP chain. Each image is filled with GetImagePattern.
+static std::vector<char> MakeKTX2(std::uint32_t size, std::uint32_t levelCount, std::uint32_t layerCount)
+{
+    static const std::uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    std::vector<char> data(identifier, identifier + sizeof(identifier));
+
+    AppendWords(data, { 37u, 1u, size, size, 0u, layerCount, 1u, levelCount, 0u });    // vkFormat = VK_FORMAT_R8G8B8A8_UNORM, typeSize, width, height, depth, layerCount, faceCount, levelCount, supercompression
+    AppendWords(data, { 0u, 0u, 0u, 0u });                                              // dfdByteOffset, dfdByteLength, kvdByteOffset, kvdByteLength
+    AppendWords(data, { 0u, 0u, 0u, 0u });                                              // sgdByteOffset, sgdByteLength
+
+    /* Write level index, followed by the images of each level */
+    std::uint32_t offset = static_cast<std::uint32_t>(data.size()) + levelCount * 24;
+    for_range(mipLevel, levelCount)
+    {
+        const std::uint32_t mipSize     = std::max(1u, size >> mipLevel);
+        const std::uint32_t levelSize   = mipSize * mipSize * 4 * layerCount;
+        AppendWords(data, { offset, 0u, levelSize, 0u, levelSize, 0u });
+        offset += levelSize;
+    }
+
+    /* KTX2 stores all array layers of one MIP-map level contiguously */
+    for_range(mipLevel, levelCount)
+    {
+        const std::uint32_t mipSize = std::max(1u, size >> mipLevel);
+        for_range(arrayLayer, layerCount)
+            AppendBytes(data, mipSize * mipSize * 4, GetImagePattern(mipLevel, arrayLayer));
+    }
+
+    return data;
+}
+
+DEF_RITEST( TextureContainer )
+{
+    TestResult result = TestResult::Passed;
+
+    auto OpenContainer = [](TextureContainer& container, const std::vector<char>& data) -> bool
+    {
+        return container.Open(Blob::CreateCopy(data.data(), data.size()));
+    };
+
+    // Validates the texture descriptor and the content of each image view of the container
+    auto ValidateContainer = [&result](const char* name, const TextureContainer& container, TextureType type, std::uint32_t size, std::uint32_t mipLevels, std::uint32_t arrayLayers) -> void
+    {
+        const TextureDescriptor& textureDesc = container.GetTextureDesc();
+        if (textureDesc.type != type || textureDesc.extent.x != size || textureDesc.extent.y != size ||
+            textureDesc.mipLevels != mipLevels || textureDesc.arrayLayers != arrayLayers)
+        {
+            Log::Errorf(
+                "Mismatch between %s texture descriptor: type = %s, extent = %u x %u, mipLevels = %u, arrayLayers = %u; expected %s, %u x %u, %u, %u\n",
+                name, ToString(textureDesc.type), textureDesc.extent.x, textureDesc.extent.y, textureDesc.mipLevels, textureDesc.arrayLayers,
+                ToString(type), size, size, mipLevels, arrayLayers
+            );
+            result = TestResult::FailedMismatch;
+            return;
+        }
+
+        for_range(mipLevel, mipLevels)
+        {
+            const std::uint32_t mipSize = std::max(1u, size >> mipLevel);
+            for_range(arrayLayer, arrayLayers)
+            {
+                const ImageView imageView = container.GetImageView(mipLevel, arrayLayer);
+                const char* bytes = static_cast<const char*>(imageView.data);
+                const char pattern = GetImagePattern(mipLevel, arrayLayer);
+                if (bytes == nullptr || imageView.dataSize != mipSize * mipSize * 4 || bytes[0] != pattern || bytes[imageView.dataSize - 1] != pattern)
+                {
+                    Log::Errorf(
+                        "Mismatch between %s image view [MIP %u, layer %u]: dataSize = %zu, expected %u\n",
+                        name, mipLevel, arrayLayer, imageView.dataSize, mipSize * mipSize * 4
+                    );
+                    result = TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        if (container.GetImageView(mipLevels, 0).data != nullptr || container.GetImageView(0, arrayLayers).data != nullptr)
+        {
+            Log::Errorf("Mismatch between %s image view out of range: expected empty image view\n", name);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    auto ExpectOpenFailure = [&result, &OpenContainer](const char* name, const std::vector<char>& data) -> void
+    {
+        TextureContainer container;
+        if (OpenContainer(container, data) || container.IsOpen())
+        {
+            Log::Errorf("Opening %s succeeded, but expected failure\n", name);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    // Valid DDS with 2 array layers and a full MIP chain
+    {
+        TextureContainer container;
+        if (!OpenContainer(container, MakeDDS(8, 8, 4, 2)))
+        {
+            Log::Errorf("Failed to open DDS container\n");
+            return TestResult::FailedMismatch;
+        }
+        if (container.GetContainerFormat() != TextureContainerFormat::DDS)
+        {
+            Log::Errorf("Mismatch between DDS container format\n");
+            result = TestResult::FailedMismatch;
+        }
+        ValidateContainer("DDS", container, TextureType::Texture2DArray, 8, 4, 2);
+    }
+
+    // Valid KTX2 with 3 array layers and a full MIP chain
+    {
+        TextureContainer container;
+        if (!OpenContainer(container, MakeKTX2(8, 4, 3)))
+        {
+            Log::Errorf("Failed to open KTX2 container\n");
+            return TestResult::FailedMismatch;
+        }
+        if (container.GetContainerFormat() != TextureContainerFormat::KTX2)
+        {
+            Log::Errorf("Mismatch between KTX2 container format\n");
+            result = TestResult::FailedMismatch;
+        }
+        ValidateContainer("KTX2", container, TextureType::Texture2DArray, 8, 4, 3);
+    }
+
+    // DDS with more MIP-map levels than the extent allows: layers must advance over all stored levels, but only the full chain is exposed
+    {
+        TextureContainer container;
+        if (!OpenContainer(container, MakeDDS(4, 4, 6, 2)))
+        {
+            Log::Errorf("Failed to open DDS container with excess MIP-map levels\n");
+            return TestResult::FailedMismatch;
+        }
+        ValidateContainer("DDS with excess MIP-map levels", container, TextureType::Texture2DArray, 4, 3, 2);
+    }
+
+    // DDS whose data only covers the clamped MIP chain, but whose header specifies more levels
+    {
+        std::vector<char> data = MakeDDS(4, 4, 3, 2);
+        PatchWord(data, 28, 6); // mipMapCount
+        ExpectOpenFailure("DDS with missing excess MIP-map levels", data);
+    }
+
+    // Truncated files
+    {
+        std::vector<char> data = MakeDDS(8, 8, 4, 2);
+        data.pop_back();
+        ExpectOpenFailure("truncated DDS", data);
+        data.resize(100);
+        ExpectOpenFailure("DDS with truncated header", data);
+    }
+    {
+        std::vector<char> data = MakeKTX2(8, 4, 3);
+        data.pop_back();
+        ExpectOpenFailure("truncated KTX2", data);
+        data.resize(90);
+        ExpectOpenFailure("KTX2 with truncated level index", data);
+    }
+
+    // DDS whose image size overflows 64 bits: 0xFFFFFFFF^2 texels with DXGI_FORMAT_R32G32B32A32_FLOAT
+    {
+        std::vector<char> data = MakeDDS(1, 1, 1, 1, 2);
+        PatchWord(data, 12, 0xFFFFFFFFu); // height
+        PatchWord(data, 16, 0xFFFFFFFFu); // width
+        ExpectOpenFailure("DDS with overflowing image size", data);
+    }
+
+    return result;
+}
+
@@ -0,0 +1,152 @@
+/*
+ * TestTextureCopyRegions.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+
+
+DEF_TEST( TextureCopyRegions )
+{
+    // Encode texel coordinates, array layer, and MIP-map level into each color to identify misplaced texels
+    auto MakeTexelColor = [](std::uint32_t x, std::uint32_t y, std::uint32_t layer, std::uint32_t mip) -> ColorRGBAub
+    {
+        return ColorRGBAub
+        {
+            static_cast<std::uint8_t>(x),
+            static_cast<std::uint8_t>(y),
+            static_cast<std::uint8_t>(layer * 16 + mip),
+            0xFF
+        };
+    };
+
+    const std::uint32_t layers = (caps.features.hasArrayTextures ? 2 : 1);
+    const Extent3D      extent{ 8, 8, 1 };
+
+    // Create source texture with two MIP-maps and write unique colors into each subresource
+    TextureDescriptor srcTexDesc;
+    {
+        srcTexDesc.type         = (layers > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+        srcTexDesc.bindFlags    = BindFlags::CopySrc;
+        srcTexDesc.format       = Format::RGBA8UNorm;
+        srcTexDesc.extent       = extent;
+        srcTexDesc.mipLevels    = 2;
+        srcTexDesc.arrayLayers  = layers;
+    }
+    CREATE_TEXTURE(srcTex, srcTexDesc, "srcTex{2D,8wh,2mips}", nullptr);
+
+    std::vector<ColorRGBAub> imageData;
+
+    for_range(mip, srcTexDesc.mipLevels)
+    {
+        const Extent3D mipExtent{ extent.x >> mip, extent.y >> mip, 1 };
+
+        for_range(layer, layers)
+        {
+            imageData.clear();
+            for_range(y, mipExtent.y)
+            {
+                for_range(x, mipExtent.x)
+                    imageData.push_back(MakeTexelColor(x, y, layer, mip));
+            }
+
+            ImageView srcImage;
+            {
+                srcImage.format     = ImageFormat::RGBA;
+                srcImage.dataType   = DataType::UInt8;
+                srcImage.data       = imageData.data();
+                srcImage.dataSize   = sizeof(ColorRGBAub) * imageData.size();
+            }
+            renderer->WriteTexture(*srcTex, TextureRegion{ TextureSubresource{ layer, mip }, Offset3D{}, mipExtent }, srcImage);
+        }
+    }
+
+    // Create destination texture with zero-initialized image to detect texels outside the copied regions
+    std::vector<ColorRGBAub> expectedData(extent.x * extent.y, ColorRGBAub{ 0x00, 0x00, 0x00, 0x00 });
+
+    ImageView dstInitialImage;
+    {
+        dstInitialImage.format      = ImageFormat::RGBA;
+        dstInitialImage.dataType    = DataType::UInt8;
+        dstInitialImage.data        = expectedData.data();
+        dstInitialImage.dataSize    = sizeof(ColorRGBAub) * expectedData.size();
+    }
+
+    TextureDescriptor dstTexDesc;
+    {
+        dstTexDesc.type         = TextureType::Texture2D;
+        dstTexDesc.bindFlags    = BindFlags::CopyDst;
+        dstTexDesc.format       = Format::RGBA8UNorm;
+        dstTexDesc.extent       = extent;
+        dstTexDesc.mipLevels    = 1;
+    }
+    CREATE_TEXTURE(dstTex, dstTexDesc, "dstTex{2D,8wh}", &dstInitialImage);
+
+    // Copy non-overlapping regions from different MIP-maps and array layers into the destination texture
+    std::vector<TextureCopyRegion> regions;
+    regions.push_back(TextureCopyRegion{ TextureLocation{ Offset3D{ 4, 4, 0 } }, TextureLocation{ Offset3D{ 2, 1, 0 }, 0, 0 }, Extent3D{ 4, 4, 1 } });
+    regions.push_back(TextureCopyRegion{ TextureLocation{ Offset3D{ 0, 0, 0 } }, TextureLocation{ Offset3D{ 1, 0, 0 }, 0, 1 }, Extent3D{ 2, 4, 1 } });
+    if (layers > 1)
+        regions.push_back(TextureCopyRegion{ TextureLocation{ Offset3D{ 0, 4, 0 } }, TextureLocation{ Offset3D{ 5, 5, 0 }, 1, 0 }, Extent3D{ 3, 3, 1 } });
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->CopyTextureRegions(*dstTex, *srcTex, static_cast<std::uint32_t>(regions.size()), regions.data());
+    }
+    cmdBuffer->End();
+
+    // Apply same regions on the CPU side
+    for (const TextureCopyRegion& region : regions)
+    {
+        for_range(y, region.extent.y)
+        {
+            for_range(x, region.extent.x)
+            {
+                const std::uint32_t dstX = static_cast<std::uint32_t>(region.dstLocation.offset.x) + x;
+                const std::uint32_t dstY = static_cast<std::uint32_t>(region.dstLocation.offset.y) + y;
+                const std::uint32_t srcX = static_cast<std::uint32_t>(region.srcLocation.offset.x) + x;
+                const std::uint32_t srcY = static_cast<std::uint32_t>(region.srcLocation.offset.y) + y;
+                expectedData[dstY * extent.x + dstX] = MakeTexelColor(srcX, srcY, region.srcLocation.arrayLayer, region.srcLocation.mipLevel);
+            }
+        }
+    }
+
+    // Read results from destination texture
+    std::vector<ColorRGBAub> outputData(expectedData.size());
+
+    MutableImageView dstImage;
+    {
+        dstImage.format     = ImageFormat::RGBA;
+        dstImage.dataType   = DataType::UInt8;
+        dstImage.data       = outputData.data();
+        dstImage.dataSize   = sizeof(ColorRGBAub) * outputData.size();
+    }
+    renderer->ReadTexture(*dstTex, TextureRegion{ Offset3D{}, extent }, dstImage);
+
+    for_range(i, outputData.size())
+    {
+        if (outputData[i] != expectedData[i])
+        {
+            Log::Errorf(
+                "Mismatch between data of texture %s [Texel (%zu, %zu)] and copy regions result:\n"
+                " -> Expected: [%02X %02X %02X %02X]\n"
+                " -> Actual:   [%02X %02X %02X %02X]\n",
+                dstTex_Name, i % extent.x, i / extent.x,
+                expectedData[i].r, expectedData[i].g, expectedData[i].b, expectedData[i].a,
+                outputData[i].r, outputData[i].g, outputData[i].b, outputData[i].a
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Delete old resources
+    renderer->Release(*srcTex);
+    renderer->Release(*dstTex);
+
+    return TestResult::Passed;
+}
+
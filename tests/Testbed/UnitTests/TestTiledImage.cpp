@@ -0,0 +1,200 @@
+/*
+ * TestTiledImage.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/TiledImage.h>
+#include <fstream>
+#include <vector>
+#include <stdio.h>
+
+
+// Returns the reference value of the specified pixel component
+static std::uint8_t GetTiledImagePixel(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t c)
+{
+    return static_cast<std::uint8_t>(x * 7 + y * 13 + z * 101 + c * 59);
+}
+
+DEF_RITEST( TiledImage )
+{
+    TestResult result = TestResult::Passed;
+
+    // Write raw RGBA8 image with a file header into a temporary file
+    constexpr std::uint32_t fileHeaderSize = 16;
+
+    const Extent3D imageExtent{ 37, 29, 3 };
+    const char* filename = "TiledImage.Test.raw";
+
+    {
+        std::vector<char> fileData(fileHeaderSize, 'H');
+        for_range(z, imageExtent.z)
+        {
+            for_range(y, imageExtent.y)
+            {
+                for_range(x, imageExtent.x)
+                {
+                    for_range(c, 4u)
+                        fileData.push_back(static_cast<char>(GetTiledImagePixel(x, y, z, c)));
+                }
+            }
+        }
+
+        std::ofstream file{ filename, std::ios::binary };
+        if (!file.good())
+            return TestResult::Skipped;
+        file.write(fileData.data(), static_cast<std::streamsize>(fileData.size()));
+    }
+
+    // Validates the specified region of RGBA or RGB pixels against the reference image
+    auto ValidateRegion = [&result](const char* name, const std::uint8_t* pixels, const Offset3D& offset, const Extent3D& extent, std::uint32_t numComponents) -> void
+    {
+        for_range(z, extent.z)
+        {
+            for_range(y, extent.y)
+            {
+                for_range(x, extent.x)
+                {
+                    for_range(c, numComponents)
+                    {
+                        const std::uint8_t expected = GetTiledImagePixel(offset.x + x, offset.y + y, offset.z + z, c);
+                        const std::uint8_t actual   = pixels[((z * extent.y + y) * extent.x + x) * numComponents + c];
+                        if (actual != expected)
+                        {
+                            Log::Errorf("Mismatch between %s pixel (%u, %u, %u)[%u] = %u and expected value %u\n", name, x, y, z, c, actual, expected);
+                            result = TestResult::FailedMismatch;
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    {
+        TiledImage image;
+
+        // Invalid image attributes must be rejected
+        if (image.Open(filename, Extent3D{ 37, 29, 4 }, ImageFormat::RGBA, DataType::UInt8, fileHeaderSize) ||
+            image.Open(filename, imageExtent, ImageFormat::RGBA, DataType::UInt8, fileHeaderSize + 1) ||
+            image.Open(filename, imageExtent, ImageFormat::BC1, DataType::UInt8, fileHeaderSize) ||
+            image.Open(filename, Extent3D{ 1, 1, 1 }, ImageFormat::RGBA, DataType::UInt8, 1u << 20) ||
+            image.Open("TiledImage.Missing.raw", imageExtent, ImageFormat::RGBA, DataType::UInt8) ||
+            image.IsOpen())
+        {
+            Log::Errorf("Opening tiled image with invalid attributes succeeded, but expected failure\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        if (!image.Open(filename, imageExtent, ImageFormat::RGBA, DataType::UInt8, fileHeaderSize))
+        {
+            Log::Errorf("Failed to open tiled image\n");
+            ::remove(filename);
+            return TestResult::FailedErrors;
+        }
+
+        if (image.GetExtent() != imageExtent || image.GetBytesPerPixel() != 4)
+        {
+            Log::Errorf("Mismatch between tiled image attributes: extent = %u x %u x %u, bpp = %u\n", image.GetExtent().x, image.GetExtent().y, image.GetExtent().z, image.GetBytesPerPixel());
+            result = TestResult::FailedMismatch;
+        }
+
+        if (!image.IsRegionInside(Offset3D{ 0, 0, 0 }, imageExtent) ||
+            image.IsRegionInside(Offset3D{ -1, 0, 0 }, Extent3D{ 1, 1, 1 }) ||
+            image.IsRegionInside(Offset3D{ 30, 0, 0 }, Extent3D{ 8, 1, 1 }) ||
+            image.IsRegionInside(Offset3D{ 0, 0, 2 }, Extent3D{ 1, 1, 2 }))
+        {
+            Log::Errorf("Mismatch between tiled image regions and image extent\n");
+            result = TestResult::FailedMismatch;
+        }
+
+        // Read region without conversion
+        const Offset3D regionOffset{ 5, 3, 1 };
+        const Extent3D regionExtent{ 20, 17, 2 };
+        {
+            std::vector<std::uint8_t> pixels(regionExtent.x * regionExtent.y * regionExtent.z * 4, 0);
+            image.ReadPixels(regionOffset, regionExtent, MutableImageView{ ImageFormat::RGBA, DataType::UInt8, pixels.data(), pixels.size() });
+            ValidateRegion("RGBA region", pixels.data(), regionOffset, regionExtent, 4);
+        }
+
+        // Read region with conversion
+        {
+            std::vector<std::uint8_t> pixels(regionExtent.x * regionExtent.y * regionExtent.z * 3, 0);
+            image.ReadPixels(regionOffset, regionExtent, MutableImageView{ ImageFormat::RGB, DataType::UInt8, pixels.data(), pixels.size() });
+            ValidateRegion("converted RGB region", pixels.data(), regionOffset, regionExtent, 3);
+        }
+
+        // Regions outside the image and destinations that are too small must be ignored
+        {
+            std::vector<std::uint8_t> pixels(16 * 4, 0xCD);
+            image.ReadPixels(Offset3D{ 30, 0, 0 }, Extent3D{ 8, 2, 1 }, MutableImageView{ ImageFormat::RGBA, DataType::UInt8, pixels.data(), pixels.size() });
+            image.ReadPixels(Offset3D{ 0, 0, 0 }, Extent3D{ 8, 3, 1 }, MutableImageView{ ImageFormat::RGBA, DataType::UInt8, pixels.data(), pixels.size() });
+            for (std::uint8_t value : pixels)
+            {
+                if (value != 0xCD)
+                {
+                    Log::Errorf("Tiled image wrote pixels for a region outside the image or a destination that is too small\n");
+                    result = TestResult::FailedMismatch;
+                    break;
+                }
+            }
+        }
+
+        // Write texture tile by tile; use the Null renderer to store the texture in CPU memory
+        if (RenderSystemPtr nullRenderer = RenderSystem::Load("Null"))
+        {
+            auto TestWriteTexture = [&](const char* name, TextureType type, const Offset3D& srcOffset, const Extent3D& srcExtent, const Extent3D& tileExtent) -> void
+            {
+                const bool isArray = (type == TextureType::Texture2DArray);
+
+                TextureDescriptor textureDesc;
+                {
+                    textureDesc.type        = type;
+                    textureDesc.bindFlags   = BindFlags::Sampled;
+                    textureDesc.format      = Format::RGBA8UNorm;
+                    textureDesc.extent      = (isArray ? Extent3D{ srcExtent.x, srcExtent.y, 1 } : srcExtent);
+                    textureDesc.arrayLayers = (isArray ? srcExtent.z : 1);
+                    textureDesc.mipLevels   = 1;
+                }
+                Texture* texture = nullRenderer->CreateTexture(textureDesc);
+
+                TextureRegion textureRegion;
+                {
+                    textureRegion.subresource.numArrayLayers    = textureDesc.arrayLayers;
+                    textureRegion.extent                        = textureDesc.extent;
+                }
+                image.WriteTexture(*nullRenderer, *texture, textureRegion, srcOffset, tileExtent);
+
+                std::vector<std::uint8_t> pixels(srcExtent.x * srcExtent.y * srcExtent.z * 4, 0);
+                nullRenderer->ReadTexture(*texture, textureRegion, MutableImageView{ ImageFormat::RGBA, DataType::UInt8, pixels.data(), pixels.size() });
+                ValidateRegion(name, pixels.data(), srcOffset, srcExtent, 4);
+
+                nullRenderer->Release(*texture);
+            };
+
+            // Tiles of partial rows are copied into an intermediate buffer, tiles of entire rows and slices are passed directly from the mapped file
+            TestWriteTexture("3D texture with partial tiles",       TextureType::Texture3D,         regionOffset,       regionExtent,   Extent3D{ 8, 8, 1 });
+            TestWriteTexture("3D texture with single tile",         TextureType::Texture3D,         regionOffset,       regionExtent,   regionExtent);
+            TestWriteTexture("array texture with partial tiles",    TextureType::Texture2DArray,    regionOffset,       regionExtent,   Extent3D{ 7, 5, 2 });
+            TestWriteTexture("3D texture with contiguous rows",     TextureType::Texture3D,         Offset3D{ 0, 2, 0 }, Extent3D{ 37, 25, 3 }, Extent3D{ 37, 10, 1 });
+            TestWriteTexture("3D texture with contiguous slices",   TextureType::Texture3D,         Offset3D{ 0, 0, 0 }, imageExtent,   Extent3D{ 37, 29, 2 });
+
+            RenderSystem::Unload(std::move(nullRenderer));
+        }
+
+        // Moved images must keep the mapped file
+        TiledImage movedImage{ std::move(image) };
+        if (!movedImage.IsOpen() || image.IsOpen())
+        {
+            Log::Errorf("Mismatch between tiled image state after move\n");
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    ::remove(filename);
+
+    return result;
+}
+
@@ -0,0 +1,179 @@
+/*
+ * TestVertexFormat.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/VertexFormat.h>
+#include <math.h>
+
+
+DEF_RITEST( PackedVertexAttribs )
+{
+    TestResult result = TestResult::Passed;
+
+    // Test 16-bit floats against reference bit patterns
+    auto TestFloat16 = [&result](float value, std::uint16_t expected) -> void
+    {
+        const std::uint16_t packed = PackFloat16(value);
+        if (packed != expected)
+        {
+            Log::Errorf("Mismatch between PackFloat16(%f) = 0x%04X and expected 0x%04X\n", value, packed, expected);
+            result = TestResult::FailedMismatch;
+        }
+        else if (!::isinf(value) && ::fabsf(value) <= 65504.0f && UnpackFloat16(packed) != value)
+        {
+            Log::Errorf("Mismatch between UnpackFloat16(0x%04X) = %f and expected %f\n", packed, UnpackFloat16(packed), value);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    TestFloat16( 0.0f,      0x0000);
+    TestFloat16(-0.0f,      0x8000);
+    TestFloat16( 1.0f,      0x3C00);
+    TestFloat16( 0.5f,      0x3800);
+    TestFloat16(-2.0f,      0xC000);
+    TestFloat16( 65504.0f,  0x7BFF); // Largest 16-bit float
+    TestFloat16( 1.0e+6f,   0x7C00); // Beyond range becomes +infinity
+    TestFloat16(-1.0e+6f,   0xFC00); // Beyond range becomes -infinity
+
+    // Test 10:10:10:2 colors against reference bit patterns
+    auto TestRGB10A2 = [&result](float r, float g, float b, float a, std::uint32_t expected) -> void
+    {
+        const std::uint32_t packed = PackRGB10A2UNorm(r, g, b, a);
+        if (packed != expected)
+        {
+            Log::Errorf("Mismatch between PackRGB10A2UNorm(%f, %f, %f, %f) = 0x%08X and expected 0x%08X\n", r, g, b, a, packed, expected);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    TestRGB10A2(0.0f, 0.0f, 0.0f, 0.0f, 0x00000000u);
+    TestRGB10A2(1.0f, 1.0f, 1.0f, 1.0f, 0xFFFFFFFFu);
+    TestRGB10A2(1.0f, 0.0f, 0.0f, 1.0f, 0xC00003FFu);
+    TestRGB10A2(0.0f, 1.0f, 0.0f, 0.0f, 0x000FFC00u);
+    TestRGB10A2(0.0f, 0.0f, 1.0f, 0.0f, 0x3FF00000u);
+    TestRGB10A2(0.5f, 0.0f, 0.0f, 1.0f/3.0f, 0x40000200u); // 511.5 rounds to 512, 1/3 of alpha is 1
+
+    // Components beyond [0, 1] must saturate and never bleed into neighboring components
+    TestRGB10A2( 2.0f, -1.0f,  1.5f, -0.5f, 0x3FF003FFu);
+    TestRGB10A2(-3.0f,  9.0f, -0.1f,  7.0f, 0xC00FFC00u);
+
+    {
+        float color[4];
+        UnpackRGB10A2UNorm(0x40000200u, color);
+        if (color[0] != 512.0f/1023.0f || color[1] != 0.0f || color[2] != 0.0f || color[3] != 1.0f/3.0f)
+        {
+            Log::Errorf("Mismatch between UnpackRGB10A2UNorm(0x40000200) = (%f, %f, %f, %f)\n", color[0], color[1], color[2], color[3]);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Test octahedral normals against reference bit patterns and their unpacked vectors
+    auto TestOctahedral = [&result](float x, float y, float z, std::uint32_t expected, const float (&expectedNormal)[3]) -> void
+    {
+        const std::uint32_t packed = PackOctahedralNormal(x, y, z);
+        if (packed != expected)
+        {
+            Log::Errorf("Mismatch between PackOctahedralNormal(%f, %f, %f) = 0x%08X and expected 0x%08X\n", x, y, z, packed, expected);
+            result = TestResult::FailedMismatch;
+        }
+
+        float normal[3];
+        UnpackOctahedralNormal(packed, normal);
+        for_range(i, 3)
+        {
+            if (::fabsf(normal[i] - expectedNormal[i]) > 1.0e-6f)
+            {
+                Log::Errorf(
+                    "Mismatch between UnpackOctahedralNormal(0x%08X) = (%f, %f, %f) and expected (%f, %f, %f)\n",
+                    packed, normal[0], normal[1], normal[2], expectedNormal[0], expectedNormal[1], expectedNormal[2]
+                );
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    };
+
+    // Axis normals; -1 is always encoded as -32767, i.e. 0x8001
+    TestOctahedral( 1.0f,  0.0f,  0.0f, 0x00007FFFu, {  1.0f,  0.0f,  0.0f });
+    TestOctahedral(-1.0f,  0.0f,  0.0f, 0x00008001u, { -1.0f,  0.0f,  0.0f });
+    TestOctahedral( 0.0f,  1.0f,  0.0f, 0x7FFF0000u, {  0.0f,  1.0f,  0.0f });
+    TestOctahedral( 0.0f, -1.0f,  0.0f, 0x80010000u, {  0.0f, -1.0f,  0.0f });
+    TestOctahedral( 0.0f,  0.0f,  1.0f, 0x00000000u, {  0.0f,  0.0f,  1.0f });
+    TestOctahedral( 0.0f,  0.0f, -1.0f, 0x7FFF7FFFu, {  0.0f,  0.0f, -1.0f }); // Folded onto the corner (1, 1)
+
+    // Vectors don't need to be normalized, but the zero vector is encoded as (0, 0, 1)
+    TestOctahedral( 0.0f,  0.0f,  0.0f, 0x00000000u, {  0.0f,  0.0f,  1.0f });
+    TestOctahedral( 0.0f,  0.0f, -5.0f, 0x7FFF7FFFu, {  0.0f,  0.0f, -1.0f });
+
+    // SNorm edge case: -32768 (0x8000) must decode to -1 just like -32767 (0x8001)
+    const std::uint32_t snormEdgeCases[][2] =
+    {
+        { 0x00008000u, 0x00008001u }, // (-1,  0)
+        { 0x80000000u, 0x80010000u }, // ( 0, -1)
+        { 0x80008000u, 0x80018001u }, // (-1, -1)
+    };
+
+    for (const auto& edgeCase : snormEdgeCases)
+    {
+        float normalA[3], normalB[3];
+        UnpackOctahedralNormal(edgeCase[0], normalA);
+        UnpackOctahedralNormal(edgeCase[1], normalB);
+        if (normalA[0] != normalB[0] || normalA[1] != normalB[1] || normalA[2] != normalB[2])
+        {
+            Log::Errorf(
+                "Mismatch between UnpackOctahedralNormal(0x%08X) = (%f, %f, %f) and UnpackOctahedralNormal(0x%08X) = (%f, %f, %f)\n",
+                edgeCase[0], normalA[0], normalA[1], normalA[2], edgeCase[1], normalB[0], normalB[1], normalB[2]
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Round-trip normals in both hemispheres, including the lower hemisphere fold at the octahedron's edges
+    std::uint32_t seed = 0x1234567u;
+    auto NextRandom = [&seed]() -> float
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 2.0f - 1.0f;
+    };
+
+    for_range(i, 1000)
+    {
+        float x = NextRandom(), y = NextRandom(), z = NextRandom();
+        if (i % 4 == 0)
+            z = -::fabsf(z);    // Force lower hemisphere
+        else if (i % 4 == 1)
+            x = 0.0f;           // Fold of a normal on the YZ plane
+        else if (i % 4 == 2)
+            y = 0.0f;           // Fold of a normal on the XZ plane
+
+        const float length = ::sqrtf(x*x + y*y + z*z);
+        if (length < 1.0e-3f)
+            continue;
+
+        x /= length;
+        y /= length;
+        z /= length;
+
+        float normal[3];
+        UnpackOctahedralNormal(PackOctahedralNormal(x, y, z), normal);
+
+        // Precision of 16-bit octahedral normals is about 0.005 degrees, so allow an angular error of 0.05 degrees
+        const float cosAngle = normal[0]*x + normal[1]*y + normal[2]*z;
+        if (cosAngle < 0.9999996f)
+        {
+            Log::Errorf(
+                "Mismatch between octahedral normal (%f, %f, %f) and unpacked normal (%f, %f, %f)\n",
+                x, y, z, normal[0], normal[1], normal[2]
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    return result;
+}
+
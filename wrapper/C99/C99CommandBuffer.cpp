@@ -6,10 +6,11 @@
  */
 
 #include <LLGL/CommandBuffer.h>
+#include <LLGL/IndirectArguments.h>
 #include <LLGL-C/CommandBuffer.h>
-#include <LLGL/Utils/ForRange.h>
 #include "C99Internal.h"
 #include "../../sources/Core/Assertion.h"
+#include <string.h>
 
 
 // namespace LLGL {
@@ -49,6 +50,11 @@ LLGL_C_EXPORT void llglCopyBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGL
     g_CurrentCmdBuf->CopyBuffer(LLGL_REF(Buffer, dstBuffer), dstOffset, LLGL_REF(Buffer, srcBuffer), srcOffset, size);
 }
 
+LLGL_C_EXPORT void llglCopyBufferRegions(LLGLBuffer dstBuffer, LLGLBuffer srcBuffer, uint32_t numRegions, const LLGLBufferCopyRegion* regions)
+{
+    g_CurrentCmdBuf->CopyBufferRegions(LLGL_REF(Buffer, dstBuffer), LLGL_REF(Buffer, srcBuffer), numRegions, (const BufferCopyRegion*)regions);
+}
+
 LLGL_C_EXPORT void llglCopyBufferFromTexture(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, uint32_t rowStride, uint32_t layerStride)
 {
     g_CurrentCmdBuf->CopyBufferFromTexture(LLGL_REF(Buffer, dstBuffer), dstOffset, LLGL_REF(Texture, srcTexture), *(const TextureRegion*)srcRegion, rowStride, layerStride);
@@ -59,11 +65,21 @@ LLGL_C_EXPORT void llglFillBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, uint
     g_CurrentCmdBuf->FillBuffer(LLGL_REF(Buffer, dstBuffer), dstOffset, value, fillSize);
 }
 
+LLGL_C_EXPORT void llglClearBuffer(LLGLBuffer dstBuffer, LLGLFormat format, const LLGLClearValue* clearValue, uint64_t dstOffset, uint64_t clearSize)
+{
+    g_CurrentCmdBuf->ClearBuffer(LLGL_REF(Buffer, dstBuffer), (Format)format, *(const ClearValue*)clearValue, dstOffset, clearSize);
+}
+
 LLGL_C_EXPORT void llglCopyTexture(LLGLTexture dstTexture, const LLGLTextureLocation* dstLocation, LLGLTexture srcTexture, const LLGLTextureLocation* srcLocation, const LLGLExtent3D* extent)
 {
     g_CurrentCmdBuf->CopyTexture(LLGL_REF(Texture, dstTexture), *(const TextureLocation*)dstLocation, LLGL_REF(Texture, srcTexture), *(const TextureLocation*)srcLocation, *(const Extent3D*)extent);
 }
 
+LLGL_C_EXPORT void llglCopyTextureRegions(LLGLTexture dstTexture, LLGLTexture srcTexture, uint32_t numRegions, const LLGLTextureCopyRegion* regions)
+{
+    g_CurrentCmdBuf->CopyTextureRegions(LLGL_REF(Texture, dstTexture), LLGL_REF(Texture, srcTexture), numRegions, (const TextureCopyRegion*)regions);
+}
+
 LLGL_C_EXPORT void llglCopyTextureFromBuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLBuffer srcBuffer, uint64_t srcOffset, uint32_t rowStride, uint32_t layerStride)
 {
     g_CurrentCmdBuf->CopyTextureFromBuffer(LLGL_REF(Texture, dstTexture), *(const TextureRegion*)dstRegion, LLGL_REF(Buffer, srcBuffer), srcOffset, rowStride, layerStride);
@@ -74,6 +90,16 @@ LLGL_C_EXPORT void llglCopyTextureFromFramebuffer(LLGLTexture dstTexture, const
     g_CurrentCmdBuf->CopyTextureFromFramebuffer(LLGL_REF(Texture, dstTexture), *(const TextureRegion*)dstRegion, *(const Offset2D*)srcOffset);
 }
 
+LLGL_C_EXPORT void llglClearTexture(LLGLTexture texture, const LLGLTextureSubresource* subresource, const LLGLClearValue* clearValue)
+{
+    g_CurrentCmdBuf->ClearTexture(LLGL_REF(Texture, texture), *(const TextureSubresource*)subresource, *(const ClearValue*)clearValue);
+}
+
+LLGL_C_EXPORT void llglDiscardResource(LLGLResource resource)
+{
+    g_CurrentCmdBuf->DiscardResource(LLGL_REF(Resource, resource));
+}
+
 LLGL_C_EXPORT void llglGenerateMips(LLGLTexture texture)
 {
     g_CurrentCmdBuf->GenerateMips(LLGL_REF(Texture, texture));
@@ -84,6 +110,12 @@ LLGL_C_EXPORT void llglGenerateMipsRange(LLGLTexture texture, const LLGLTextureS
     g_CurrentCmdBuf->GenerateMips(LLGL_REF(Texture, texture), *(const TextureSubresource*)subresource);
 }
 
+LLGL_C_EXPORT void llglGenerateMipsBatch(uint32_t numTextures, LLGLTexture const * textures)
+{
+    /* LLGLTexture only wraps the internal pointer (see C99TypeAssertions.cpp), so the array can be passed through without conversion */
+    g_CurrentCmdBuf->GenerateMips(numTextures, reinterpret_cast<Texture* const*>(textures));
+}
+
 LLGL_C_EXPORT void llglSetViewport(const LLGLViewport* viewport)
 {
     g_CurrentCmdBuf->SetViewport(*(const Viewport*)viewport);
@@ -109,11 +141,21 @@ LLGL_C_EXPORT void llglSetVertexBuffer(LLGLBuffer buffer)
     g_CurrentCmdBuf->SetVertexBuffer(LLGL_REF(Buffer, buffer));
 }
 
+LLGL_C_EXPORT void llglSetVertexBufferExt(LLGLBuffer buffer, uint64_t offset)
+{
+    g_CurrentCmdBuf->SetVertexBuffer(LLGL_REF(Buffer, buffer), offset);
+}
+
 LLGL_C_EXPORT void llglSetVertexBufferArray(LLGLBufferArray bufferArray)
 {
     g_CurrentCmdBuf->SetVertexBufferArray(LLGL_REF(BufferArray, bufferArray));
 }
 
+LLGL_C_EXPORT void llglSetVertexBufferArrayExt(LLGLBufferArray bufferArray, const uint64_t* offsets)
+{
+    g_CurrentCmdBuf->SetVertexBufferArray(LLGL_REF(BufferArray, bufferArray), offsets);
+}
+
 LLGL_C_EXPORT void llglSetIndexBuffer(LLGLBuffer buffer)
 {
     g_CurrentCmdBuf->SetIndexBuffer(LLGL_REF(Buffer, buffer));
@@ -134,6 +176,11 @@ LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource)
     g_CurrentCmdBuf->SetResource(descriptor, LLGL_REF(Resource, resource));
 }
 
+LLGL_C_EXPORT void llglSetResourceExt(uint32_t descriptor, LLGLBuffer buffer, uint64_t offset, uint64_t size)
+{
+    g_CurrentCmdBuf->SetResource(descriptor, LLGL_REF(Buffer, buffer), offset, size);
+}
+
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags)
 {
     // deprecated
@@ -154,6 +201,11 @@ LLGL_C_EXPORT void llglEndRenderPass()
     g_CurrentCmdBuf->EndRenderPass();
 }
 
+LLGL_C_EXPORT void llglNextSubpass()
+{
+    g_CurrentCmdBuf->NextSubpass();
+}
+
 LLGL_C_EXPORT void llglClear(long flags, const LLGLClearValue* clearValue)
 {
     g_CurrentCmdBuf->Clear(flags, *(const ClearValue*)clearValue);
@@ -179,6 +231,41 @@ LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace s
     g_CurrentCmdBuf->SetStencilReference(reference, (StencilFace)stencilFace);
 }
 
+LLGL_C_EXPORT void llglSetCullMode(LLGLCullMode cullMode)
+{
+    g_CurrentCmdBuf->SetCullMode((CullMode)cullMode);
+}
+
+LLGL_C_EXPORT void llglSetDepthState(const LLGLDepthDescriptor* depthDesc)
+{
+    g_CurrentCmdBuf->SetDepthState(*(const DepthDescriptor*)depthDesc);
+}
+
+LLGL_C_EXPORT void llglSetStencilState(const LLGLStencilDescriptor* stencilDesc)
+{
+    g_CurrentCmdBuf->SetStencilState(*(const StencilDescriptor*)stencilDesc);
+}
+
+LLGL_C_EXPORT void llglSetPrimitiveTopology(LLGLPrimitiveTopology primitiveTopology)
+{
+    g_CurrentCmdBuf->SetPrimitiveTopology((PrimitiveTopology)primitiveTopology);
+}
+
+LLGL_C_EXPORT void llglSetDepthBias(const LLGLDepthBiasDescriptor* depthBiasDesc)
+{
+    g_CurrentCmdBuf->SetDepthBias(*(const DepthBiasDescriptor*)depthBiasDesc);
+}
+
+LLGL_C_EXPORT void llglSetShadingRate(const LLGLShadingRateDescriptor* shadingRateDesc)
+{
+    g_CurrentCmdBuf->SetShadingRate(*(const ShadingRateDescriptor*)shadingRateDesc);
+}
+
+LLGL_C_EXPORT void llglSetShadingRateImage(LLGLTexture texture)
+{
+    g_CurrentCmdBuf->SetShadingRateImage(LLGL_PTR(Texture, texture));
+}
+
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize)
 {
     g_CurrentCmdBuf->SetUniforms(first, data, dataSize);
@@ -204,12 +291,15 @@ LLGL_C_EXPORT void llglEndRenderCondition()
     g_CurrentCmdBuf->EndRenderCondition();
 }
 
+LLGL_C_EXPORT void llglResolveQueryData(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset)
+{
+    g_CurrentCmdBuf->ResolveQueryData(LLGL_REF(QueryHeap, queryHeap), firstQuery, numQueries, LLGL_REF(Buffer, dstBuffer), dstOffset);
+}
+
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers)
 {
-    Buffer* internalBuffers[LLGL_MAX_NUM_SO_BUFFERS];
-    for_range(i, numBuffers)
-        internalBuffers[i] = LLGL_PTR(Buffer, buffers[i]);
-    g_CurrentCmdBuf->BeginStreamOutput(numBuffers, internalBuffers);
+    /* LLGLBuffer only wraps the internal pointer (see C99TypeAssertions.cpp), so the array can be passed through without conversion */
+    g_CurrentCmdBuf->BeginStreamOutput(numBuffers, reinterpret_cast<Buffer* const*>(buffers));
 }
 
 LLGL_C_EXPORT void llglEndStreamOutput()
@@ -252,6 +342,11 @@ LLGL_C_EXPORT void llglDrawIndexedInstancedExt(uint32_t numIndices, uint32_t num
     g_CurrentCmdBuf->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+LLGL_C_EXPORT void llglMultiDrawIndexed(uint32_t numDraws, const LLGLDrawIndexedIndirectArguments* draws)
+{
+    g_CurrentCmdBuf->MultiDrawIndexed(numDraws, (const DrawIndexedIndirectArguments*)draws);
+}
+
 LLGL_C_EXPORT void llglDrawIndirect(LLGLBuffer buffer, uint64_t offset)
 {
     g_CurrentCmdBuf->DrawIndirect(LLGL_REF(Buffer, buffer), offset);
@@ -272,6 +367,26 @@ LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset
     g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
 }
 
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer argumentsBuffer, uint64_t argumentsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndirectCount(LLGL_REF(Buffer, argumentsBuffer), argumentsOffset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer argumentsBuffer, uint64_t argumentsOffset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndexedIndirectCount(LLGL_REF(Buffer, argumentsBuffer), argumentsOffset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDrawMeshTasks(uint32_t numThreadGroupsX, uint32_t numThreadGroupsY, uint32_t numThreadGroupsZ)
+{
+    g_CurrentCmdBuf->DrawMeshTasks(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+}
+
+LLGL_C_EXPORT void llglDrawMeshTasksIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawMeshTasksIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
+}
+
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
 {
     g_CurrentCmdBuf->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -302,6 +417,251 @@ LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSi
     return g_CurrentCmdBuf->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+// Reads the arguments of a command stream and keeps track of the remaining size.
+class C99CommandStreamReader
+{
+
+    public:
+
+        inline C99CommandStreamReader(const void* stream, size_t streamSize) :
+            pos_ { static_cast<const char*>(stream)              },
+            end_ { static_cast<const char*>(stream) + streamSize }
+        {
+        }
+
+        // Returns true if there are at least the specified number of bytes remaining.
+        inline bool HasRemaining(size_t size) const
+        {
+            return (static_cast<size_t>(end_ - pos_) >= size);
+        }
+
+        // Reads the next argument. Arguments are not aligned, so they are copied.
+        template <typename T>
+        inline T Read()
+        {
+            T value;
+            ::memcpy(&value, pos_, sizeof(T));
+            pos_ += sizeof(T);
+            return value;
+        }
+
+        // Returns a pointer to the next number of bytes and skips them.
+        inline const void* Skip(size_t size)
+        {
+            const char* data = pos_;
+            pos_ += size;
+            return data;
+        }
+
+        // Returns the position within the stream.
+        inline const char* GetPosition() const
+        {
+            return pos_;
+        }
+
+    private:
+
+        const char* pos_;
+        const char* end_;
+
+};
+
+// Returns the size of the arguments of the specified opcode excluding variable sized data or zero if the opcode is unknown.
+static size_t GetCommandStreamArgsSize(uint32_t opcode)
+{
+    switch (opcode)
+    {
+        case LLGLCommandStreamOpcodeSetViewport:            return sizeof(LLGLViewport);
+        case LLGLCommandStreamOpcodeSetScissor:             return sizeof(LLGLScissor);
+        case LLGLCommandStreamOpcodeSetVertexBuffer:        return sizeof(LLGLBuffer);
+        case LLGLCommandStreamOpcodeSetVertexBufferArray:   return sizeof(LLGLBufferArray);
+        case LLGLCommandStreamOpcodeSetIndexBuffer:         return sizeof(LLGLBuffer);
+        case LLGLCommandStreamOpcodeSetIndexBufferExt:      return sizeof(LLGLBuffer) + sizeof(LLGLFormat) + sizeof(uint64_t);
+        case LLGLCommandStreamOpcodeSetResourceHeap:        return sizeof(LLGLResourceHeap) + sizeof(uint32_t);
+        case LLGLCommandStreamOpcodeSetResource:            return sizeof(uint32_t) + sizeof(LLGLResource);
+        case LLGLCommandStreamOpcodeSetPipelineState:       return sizeof(LLGLPipelineState);
+        case LLGLCommandStreamOpcodeSetUniforms:            return sizeof(uint32_t) * 2;
+        case LLGLCommandStreamOpcodeBeginRenderPass:        return sizeof(LLGLRenderTarget);
+        case LLGLCommandStreamOpcodeEndRenderPass:          return 0;
+        case LLGLCommandStreamOpcodeClear:                  return sizeof(uint32_t) + sizeof(LLGLClearValue);
+        case LLGLCommandStreamOpcodeDraw:                   return sizeof(uint32_t) * 2;
+        case LLGLCommandStreamOpcodeDrawIndexed:            return sizeof(uint32_t) * 3;
+        case LLGLCommandStreamOpcodeDrawInstanced:          return sizeof(uint32_t) * 4;
+        case LLGLCommandStreamOpcodeDrawIndexedInstanced:   return sizeof(uint32_t) * 5;
+        case LLGLCommandStreamOpcodeDispatch:               return sizeof(uint32_t) * 3;
+        default:                                            return ~size_t(0);
+    }
+}
+
+LLGL_C_EXPORT size_t llglExecuteCommandStream(const void* stream, size_t streamSize)
+{
+    LLGL_ASSERT(g_CurrentCmdBuf != NULL);
+    LLGL_ASSERT(stream != NULL || streamSize == 0);
+
+    CommandBuffer* cmdBuffer = g_CurrentCmdBuf;
+    C99CommandStreamReader reader{ stream, streamSize };
+
+    while (reader.HasRemaining(sizeof(uint32_t)))
+    {
+        /* Stop at the first malformed command and return the number of bytes that have been executed */
+        const char* commandStart = reader.GetPosition();
+        const uint32_t opcode = reader.Read<uint32_t>();
+        const size_t argsSize = GetCommandStreamArgsSize(opcode);
+        if (argsSize == ~size_t(0) || !reader.HasRemaining(argsSize))
+            return static_cast<size_t>(commandStart - static_cast<const char*>(stream));
+
+        switch (opcode)
+        {
+            case LLGLCommandStreamOpcodeSetViewport:
+            {
+                const LLGLViewport viewport = reader.Read<LLGLViewport>();
+                cmdBuffer->SetViewport(*reinterpret_cast<const Viewport*>(&viewport));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetScissor:
+            {
+                const LLGLScissor scissor = reader.Read<LLGLScissor>();
+                cmdBuffer->SetScissor(*reinterpret_cast<const Scissor*>(&scissor));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetVertexBuffer:
+            {
+                const LLGLBuffer buffer = reader.Read<LLGLBuffer>();
+                cmdBuffer->SetVertexBuffer(LLGL_REF(Buffer, buffer));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetVertexBufferArray:
+            {
+                const LLGLBufferArray bufferArray = reader.Read<LLGLBufferArray>();
+                cmdBuffer->SetVertexBufferArray(LLGL_REF(BufferArray, bufferArray));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetIndexBuffer:
+            {
+                const LLGLBuffer buffer = reader.Read<LLGLBuffer>();
+                cmdBuffer->SetIndexBuffer(LLGL_REF(Buffer, buffer));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetIndexBufferExt:
+            {
+                const LLGLBuffer    buffer  = reader.Read<LLGLBuffer>();
+                const LLGLFormat    format  = reader.Read<LLGLFormat>();
+                const uint64_t      offset  = reader.Read<uint64_t>();
+                cmdBuffer->SetIndexBuffer(LLGL_REF(Buffer, buffer), (Format)format, offset);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetResourceHeap:
+            {
+                const LLGLResourceHeap  resourceHeap    = reader.Read<LLGLResourceHeap>();
+                const uint32_t          descriptorSet   = reader.Read<uint32_t>();
+                cmdBuffer->SetResourceHeap(LLGL_REF(ResourceHeap, resourceHeap), descriptorSet);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetResource:
+            {
+                const uint32_t      descriptor  = reader.Read<uint32_t>();
+                const LLGLResource  resource    = reader.Read<LLGLResource>();
+                cmdBuffer->SetResource(descriptor, LLGL_REF(Resource, resource));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetPipelineState:
+            {
+                const LLGLPipelineState pipelineState = reader.Read<LLGLPipelineState>();
+                cmdBuffer->SetPipelineState(LLGL_REF(PipelineState, pipelineState));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeSetUniforms:
+            {
+                const uint32_t first    = reader.Read<uint32_t>();
+                const uint32_t dataSize = reader.Read<uint32_t>();
+                if (dataSize > UINT16_MAX || !reader.HasRemaining(dataSize))
+                    return static_cast<size_t>(commandStart - static_cast<const char*>(stream));
+                cmdBuffer->SetUniforms(first, reader.Skip(dataSize), static_cast<uint16_t>(dataSize));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeBeginRenderPass:
+            {
+                const LLGLRenderTarget renderTarget = reader.Read<LLGLRenderTarget>();
+                cmdBuffer->BeginRenderPass(LLGL_REF(RenderTarget, renderTarget));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeEndRenderPass:
+            {
+                cmdBuffer->EndRenderPass();
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeClear:
+            {
+                const uint32_t          flags       = reader.Read<uint32_t>();
+                const LLGLClearValue    clearValue  = reader.Read<LLGLClearValue>();
+                cmdBuffer->Clear(static_cast<long>(flags), *reinterpret_cast<const ClearValue*>(&clearValue));
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDraw:
+            {
+                const uint32_t numVertices  = reader.Read<uint32_t>();
+                const uint32_t firstVertex  = reader.Read<uint32_t>();
+                cmdBuffer->Draw(numVertices, firstVertex);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndexed:
+            {
+                const uint32_t  numIndices      = reader.Read<uint32_t>();
+                const uint32_t  firstIndex      = reader.Read<uint32_t>();
+                const int32_t   vertexOffset    = reader.Read<int32_t>();
+                cmdBuffer->DrawIndexed(numIndices, firstIndex, vertexOffset);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawInstanced:
+            {
+                const uint32_t numVertices      = reader.Read<uint32_t>();
+                const uint32_t firstVertex      = reader.Read<uint32_t>();
+                const uint32_t numInstances     = reader.Read<uint32_t>();
+                const uint32_t firstInstance    = reader.Read<uint32_t>();
+                cmdBuffer->DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDrawIndexedInstanced:
+            {
+                const uint32_t  numIndices      = reader.Read<uint32_t>();
+                const uint32_t  numInstances    = reader.Read<uint32_t>();
+                const uint32_t  firstIndex      = reader.Read<uint32_t>();
+                const int32_t   vertexOffset    = reader.Read<int32_t>();
+                const uint32_t  firstInstance   = reader.Read<uint32_t>();
+                cmdBuffer->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+            }
+            break;
+
+            case LLGLCommandStreamOpcodeDispatch:
+            {
+                const uint32_t numWorkGroupsX = reader.Read<uint32_t>();
+                const uint32_t numWorkGroupsY = reader.Read<uint32_t>();
+                const uint32_t numWorkGroupsZ = reader.Read<uint32_t>();
+                cmdBuffer->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+            }
+            break;
+        }
+    }
+
+    return static_cast<size_t>(reader.GetPosition() - static_cast<const char*>(stream));
+}
+
 
 // } /namespace LLGL
 
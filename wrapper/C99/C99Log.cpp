@@ -57,6 +57,16 @@ LLGL_C_EXPORT void llglUnregisterLogCallback(LLGLLogHandle handle)
     Log::UnregisterCallback(handle);
 }
 
+LLGL_C_EXPORT void llglSetLogAsyncMode(bool enable)
+{
+    Log::SetAsyncMode(enable);
+}
+
+LLGL_C_EXPORT void llglFlushLog()
+{
+    Log::Flush();
+}
+
 
 // } /namespace LLGL
 
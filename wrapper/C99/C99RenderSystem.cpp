@@ -51,6 +51,7 @@ static void ConvertRenderSystemDesc(RenderSystemDescriptor& dst, const LLGLRende
     dst.debugger            = LLGL_PTR(RenderingDebugger, src.debugger);
     dst.rendererConfig      = src.rendererConfig;
     dst.rendererConfigSize  = src.rendererConfigSize;
+    dst.pipelineCacheFilename = src.pipelineCacheFilename;
     #ifdef LLGL_OS_ANDROID
     dst.androidApp          = src.androidApp;
     #endif
@@ -215,6 +216,57 @@ LLGL_C_EXPORT void llglReleaseCommandBuffer(LLGLCommandBuffer commandBuffer)
     LLGL_RELEASE(CommandBuffer, commandBuffer);
 }
 
+/*
+Scratch containers for descriptor conversion, one set per thread.
+Creation functions borrow these containers for the duration of a call and return them afterwards,
+so their capacity, including the capacity of the strings within, is reused and descriptor conversion does not allocate in steady state.
+*/
+struct C99DescriptorScratch
+{
+    SmallVector<VertexAttribute>            vertexAttribs;
+    std::vector<VertexAttribute>            vertexInputAttribs;
+    std::vector<VertexAttribute>            vertexOutputAttribs;
+    std::vector<FragmentAttribute>          fragmentOutputAttribs;
+    std::vector<BindingDescriptor>          heapBindings;
+    std::vector<BindingDescriptor>          bindings;
+    std::vector<StaticSamplerDescriptor>    staticSamplers;
+    std::vector<UniformDescriptor>          uniforms;
+    std::vector<Viewport>                   viewports;
+    std::vector<Scissor>                    scissors;
+    std::vector<BindingSlot>                vertexStreams;
+};
+
+static thread_local C99DescriptorScratch g_DescriptorScratch;
+
+// Moves a scratch container into a descriptor container and moves it back when this object goes out of scope.
+template <typename TContainer>
+class C99ScratchBorrow
+{
+
+    public:
+
+        C99ScratchBorrow(const C99ScratchBorrow&) = delete;
+        C99ScratchBorrow& operator = (const C99ScratchBorrow&) = delete;
+
+        inline C99ScratchBorrow(TContainer& scratch, TContainer& dst) :
+            scratch_ { scratch },
+            dst_     { dst     }
+        {
+            dst_ = std::move(scratch_);
+        }
+
+        inline ~C99ScratchBorrow()
+        {
+            scratch_ = std::move(dst_);
+        }
+
+    private:
+
+        TContainer& scratch_;
+        TContainer& dst_;
+
+};
+
 static void ConvertVertexAttrib(VertexAttribute& dst, const LLGLVertexAttribute& src)
 {
     dst.name                = src.name;
@@ -249,6 +301,7 @@ LLGL_C_EXPORT LLGLBuffer llglCreateBuffer(const LLGLBufferDescriptor* bufferDesc
     LLGL_ASSERT_PTR(bufferDesc);
     BufferDescriptor internalBufferDesc;
     SmallVector<VertexAttribute> internalVertexAttribs;
+    C99ScratchBorrow<SmallVector<VertexAttribute>> borrowVertexAttribs{ g_DescriptorScratch.vertexAttribs, internalVertexAttribs };
     ConvertBufferDesc(internalBufferDesc, internalVertexAttribs, *bufferDesc);
     return LLGLBuffer{ g_CurrentRenderSystem->CreateBuffer(internalBufferDesc, initialData) };
 }
@@ -372,11 +425,32 @@ LLGL_C_EXPORT uint32_t llglWriteResourceHeap(LLGLResourceHeap resourceHeap, uint
     return 0;
 }
 
+static void ConvertAttachmentFormatDesc(AttachmentFormatDescriptor& dst, const LLGLAttachmentFormatDescriptor& src)
+{
+    dst.format  = static_cast<Format>(src.format);
+    dst.loadOp  = static_cast<AttachmentLoadOp>(src.loadOp);
+    dst.storeOp = static_cast<AttachmentStoreOp>(src.storeOp);
+}
+
+static void ConvertRenderPassDesc(RenderPassDescriptor& dst, const LLGLRenderPassDescriptor& src)
+{
+    dst.debugName = src.debugName;
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        ConvertAttachmentFormatDesc(dst.colorAttachments[i], src.colorAttachments[i]);
+    ConvertAttachmentFormatDesc(dst.depthAttachment, src.depthAttachment);
+    ConvertAttachmentFormatDesc(dst.stencilAttachment, src.stencilAttachment);
+    dst.samples   = src.samples;
+    dst.subpasses = ArrayView<SubpassDescriptor>{ reinterpret_cast<const SubpassDescriptor*>(src.subpasses), src.numSubpasses };
+    dst.viewMask  = src.viewMask;
+}
+
 LLGL_C_EXPORT LLGLRenderPass llglCreateRenderPass(const LLGLRenderPassDescriptor* renderPassDesc)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(renderPassDesc);
-    return LLGLRenderPass{ g_CurrentRenderSystem->CreateRenderPass(*reinterpret_cast<const RenderPassDescriptor*>(renderPassDesc)) };
+    RenderPassDescriptor internalRenderPassDesc;
+    ConvertRenderPassDesc(internalRenderPassDesc, *renderPassDesc);
+    return LLGLRenderPass{ g_CurrentRenderSystem->CreateRenderPass(internalRenderPassDesc) };
 }
 
 LLGL_C_EXPORT void llglReleaseRenderPass(LLGLRenderPass renderPass)
@@ -448,6 +522,9 @@ LLGL_C_EXPORT LLGLShader llglCreateShader(const LLGLShaderDescriptor* shaderDesc
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(shaderDesc);
     ShaderDescriptor internalShaderDesc;
+    C99ScratchBorrow<std::vector<VertexAttribute>> borrowInputAttribs{ g_DescriptorScratch.vertexInputAttribs, internalShaderDesc.vertex.inputAttribs };
+    C99ScratchBorrow<std::vector<VertexAttribute>> borrowOutputAttribs{ g_DescriptorScratch.vertexOutputAttribs, internalShaderDesc.vertex.outputAttribs };
+    C99ScratchBorrow<std::vector<FragmentAttribute>> borrowFragmentAttribs{ g_DescriptorScratch.fragmentOutputAttribs, internalShaderDesc.fragment.outputAttribs };
     ConvertShaderDesc(internalShaderDesc, *shaderDesc);
     return LLGLShader{ g_CurrentRenderSystem->CreateShader(internalShaderDesc) };
 }
@@ -503,6 +580,7 @@ static void ConvertPipelineLayoutDesc(PipelineLayoutDescriptor& dst, const LLGLP
         ConvertUniformDesc(dst.uniforms[i], src.uniforms[i]);
 
     dst.barrierFlags = src.barrierFlags;
+    dst.flags        = src.flags;
 }
 
 LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayoutDescriptor* pipelineLayoutDesc)
@@ -510,6 +588,10 @@ LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayo
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(pipelineLayoutDesc);
     PipelineLayoutDescriptor internalPipelineLayoutDesc;
+    C99ScratchBorrow<std::vector<BindingDescriptor>> borrowHeapBindings{ g_DescriptorScratch.heapBindings, internalPipelineLayoutDesc.heapBindings };
+    C99ScratchBorrow<std::vector<BindingDescriptor>> borrowBindings{ g_DescriptorScratch.bindings, internalPipelineLayoutDesc.bindings };
+    C99ScratchBorrow<std::vector<StaticSamplerDescriptor>> borrowStaticSamplers{ g_DescriptorScratch.staticSamplers, internalPipelineLayoutDesc.staticSamplers };
+    C99ScratchBorrow<std::vector<UniformDescriptor>> borrowUniforms{ g_DescriptorScratch.uniforms, internalPipelineLayoutDesc.uniforms };
     ConvertPipelineLayoutDesc(internalPipelineLayoutDesc, *pipelineLayoutDesc);
     return LLGLPipelineLayout{ g_CurrentRenderSystem->CreatePipelineLayout(internalPipelineLayoutDesc) };
 }
@@ -534,13 +616,17 @@ static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const L
 {
     dst.pipelineLayout          = LLGL_PTR(PipelineLayout, src.pipelineLayout);
     dst.renderPass              = LLGL_PTR(RenderPass, src.renderPass);
+    dst.subpass                 = src.subpass;
     dst.vertexShader            = LLGL_PTR(Shader, src.vertexShader);
     dst.tessControlShader       = LLGL_PTR(Shader, src.tessControlShader);
     dst.tessEvaluationShader    = LLGL_PTR(Shader, src.tessEvaluationShader);
     dst.geometryShader          = LLGL_PTR(Shader, src.geometryShader);
+    dst.taskShader              = LLGL_PTR(Shader, src.taskShader);
+    dst.meshShader              = LLGL_PTR(Shader, src.meshShader);
     dst.fragmentShader          = LLGL_PTR(Shader, src.fragmentShader);
     dst.indexFormat             = static_cast<Format>(src.indexFormat);
     dst.primitiveTopology       = static_cast<PrimitiveTopology>(src.primitiveTopology);
+    dst.dynamicStates           = src.dynamicStates;
 
     dst.viewports.resize(src.numViewports);
     ::memcpy(dst.viewports.data(), src.viewports, src.numViewports * sizeof(LLGLViewport));
@@ -548,6 +634,10 @@ static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const L
     dst.scissors.resize(src.numScissors);
     ::memcpy(dst.scissors.data(), src.scissors, src.numScissors * sizeof(LLGLScissor));
 
+    dst.vertexStreams.resize(src.numVertexStreams);
+    for_range(i, src.numVertexStreams)
+        dst.vertexStreams[i] = BindingSlot{ src.vertexStreams[i].index, src.vertexStreams[i].set };
+
     ::memcpy(&(dst.depth), &(src.depth), sizeof(LLGLDepthDescriptor));
     ::memcpy(&(dst.stencil), &(src.stencil), sizeof(LLGLStencilDescriptor));
     ::memcpy(&(dst.rasterizer), &(src.rasterizer), sizeof(LLGLRasterizerDescriptor));
@@ -565,6 +655,9 @@ LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineStateExt(const LLGLGra
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(pipelineStateDesc);
     GraphicsPipelineDescriptor internalPipelineStateDesc;
+    C99ScratchBorrow<std::vector<Viewport>> borrowViewports{ g_DescriptorScratch.viewports, internalPipelineStateDesc.viewports };
+    C99ScratchBorrow<std::vector<Scissor>> borrowScissors{ g_DescriptorScratch.scissors, internalPipelineStateDesc.scissors };
+    C99ScratchBorrow<std::vector<BindingSlot>> borrowVertexStreams{ g_DescriptorScratch.vertexStreams, internalPipelineStateDesc.vertexStreams };
     ConvertGraphicsPipelineDesc(internalPipelineStateDesc, *pipelineStateDesc);
     return LLGLPipelineState{ g_CurrentRenderSystem->CreatePipelineState(internalPipelineStateDesc, LLGL_PTR(PipelineCache, pipelineCache)) };
 }
@@ -36,6 +36,31 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT void llglSetDebuggerValidation(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetValidation(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerValidation(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetValidation();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerBufferOverrunDetection(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetBufferOverrunDetection(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerBufferOverrunDetection(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetBufferOverrunDetection();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerCapture(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetCapture(filename, numFrames);
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
@@ -20,6 +20,21 @@ LLGL_C_EXPORT LLGLResourceType llglGetResourceType(LLGLResource resource)
     return static_cast<LLGLResourceType>(LLGL_PTR(Resource, resource)->GetResourceType());
 }
 
+LLGL_C_EXPORT bool llglSetResidencyPriority(LLGLResource resource, LLGLResidencyPriority priority)
+{
+    return LLGL_PTR(Resource, resource)->SetResidencyPriority(static_cast<ResidencyPriority>(priority));
+}
+
+LLGL_C_EXPORT bool llglEvictResource(LLGLResource resource)
+{
+    return LLGL_PTR(Resource, resource)->Evict();
+}
+
+LLGL_C_EXPORT bool llglMakeResourceResident(LLGLResource resource)
+{
+    return LLGL_PTR(Resource, resource)->MakeResident();
+}
+
 
 // } /namespace LLGL
 
@@ -20,6 +20,11 @@ LLGL_C_EXPORT void llglPresent(LLGLSwapChain swapChain)
     LLGL_PTR(SwapChain, swapChain)->Present();
 }
 
+LLGL_C_EXPORT void llglPresentWithDamage(LLGLSwapChain swapChain, uint32_t numDamageRects, const LLGLScissor* damageRects)
+{
+    LLGL_PTR(SwapChain, swapChain)->PresentWithDamage(numDamageRects, (const Scissor*)damageRects);
+}
+
 LLGL_C_EXPORT uint32_t llglGetCurrentSwapIndex(LLGLSwapChain swapChain)
 {
     return LLGL_PTR(SwapChain, swapChain)->GetCurrentSwapIndex();
@@ -50,6 +55,16 @@ LLGL_C_EXPORT bool llglSetVsyncInterval(LLGLSwapChain swapChain, uint32_t vsyncI
     return LLGL_PTR(SwapChain, swapChain)->SetVsyncInterval(vsyncInterval);
 }
 
+LLGL_C_EXPORT bool llglWaitForNextFrame(LLGLSwapChain swapChain, uint64_t timeout)
+{
+    return LLGL_PTR(SwapChain, swapChain)->WaitForNextFrame(timeout);
+}
+
+LLGL_C_EXPORT LLGLSurfaceTransform llglGetSurfaceTransform(LLGLSwapChain swapChain)
+{
+    return (LLGLSurfaceTransform)LLGL_PTR(SwapChain, swapChain)->GetSurfaceTransform();
+}
+
 LLGL_C_EXPORT bool llglSwitchFullscreen(LLGLSwapChain swapChain, bool enable)
 {
     return LLGL_PTR(SwapChain, swapChain)->SwitchFullscreen(enable);
@@ -60,6 +75,16 @@ LLGL_C_EXPORT LLGLSurface llglGetSurface(LLGLSwapChain swapChain)
     return LLGLSurface{ &(LLGL_PTR(SwapChain, swapChain)->GetSurface()) };
 }
 
+LLGL_C_EXPORT void llglDetachSurface(LLGLSwapChain swapChain)
+{
+    LLGL_PTR(SwapChain, swapChain)->DetachSurface();
+}
+
+LLGL_C_EXPORT bool llglAttachSurface(LLGLSwapChain swapChain)
+{
+    return LLGL_PTR(SwapChain, swapChain)->AttachSurface();
+}
+
 
 // } /namespace LLGL
 
@@ -51,6 +51,11 @@ LLGL_C_EXPORT void llglGetTextureSubresourceFootprint(LLGLTexture texture, uint3
     *outFootprint = *reinterpret_cast<const LLGLSubresourceFootprint*>(&internalFootprint);
 }
 
+LLGL_C_EXPORT bool llglSetTextureMinLOD(LLGLTexture texture, float minLOD)
+{
+    return LLGL_PTR(Texture, texture)->SetMinLOD(minLOD);
+}
+
 
 // } /namespace LLGL
 
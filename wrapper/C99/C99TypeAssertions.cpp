@@ -199,6 +199,20 @@ LLGL_STATIC_ASSERT_ENUM(TessellationPartition, Pow2);
 LLGL_STATIC_ASSERT_ENUM(TessellationPartition, FractionalOdd);
 LLGL_STATIC_ASSERT_ENUM(TessellationPartition, FractionalEven);
 
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate1x1);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate1x2);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate2x1);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate2x2);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate2x4);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate4x2);
+LLGL_STATIC_ASSERT_ENUM(ShadingRate, Rate4x4);
+
+LLGL_STATIC_ASSERT_ENUM(ShadingRateCombiner, Passthrough);
+LLGL_STATIC_ASSERT_ENUM(ShadingRateCombiner, Override);
+LLGL_STATIC_ASSERT_ENUM(ShadingRateCombiner, Min);
+LLGL_STATIC_ASSERT_ENUM(ShadingRateCombiner, Max);
+LLGL_STATIC_ASSERT_ENUM(ShadingRateCombiner, Sum);
+
 LLGL_STATIC_ASSERT_ENUM(RenderConditionMode, Wait);
 LLGL_STATIC_ASSERT_ENUM(RenderConditionMode, NoWait);
 LLGL_STATIC_ASSERT_ENUM(RenderConditionMode, ByRegionWait);
@@ -212,6 +226,10 @@ LLGL_STATIC_ASSERT_ENUM(StencilFace, FrontAndBack);
 LLGL_STATIC_ASSERT_ENUM(StencilFace, Front);
 LLGL_STATIC_ASSERT_ENUM(StencilFace, Back);
 
+LLGL_STATIC_ASSERT_ENUM(CommandQueueType, Graphics);
+LLGL_STATIC_ASSERT_ENUM(CommandQueueType, Compute);
+LLGL_STATIC_ASSERT_ENUM(CommandQueueType, Copy);
+
 LLGL_STATIC_ASSERT_ENUM(Format, Undefined);
 LLGL_STATIC_ASSERT_ENUM(Format, A8UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, R8UNorm);
@@ -339,6 +357,17 @@ LLGL_STATIC_ASSERT_ENUM(SystemValue, Stencil);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, VertexID);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, ViewportIndex);
 
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Default);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Immediate);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Mailbox);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Fifo);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, FifoRelaxed);
+
+LLGL_STATIC_ASSERT_ENUM(SurfaceTransform, Identity);
+LLGL_STATIC_ASSERT_ENUM(SurfaceTransform, Rotate90);
+LLGL_STATIC_ASSERT_ENUM(SurfaceTransform, Rotate180);
+LLGL_STATIC_ASSERT_ENUM(SurfaceTransform, Rotate270);
+
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture1D);
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture2D);
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture3D);
@@ -372,6 +401,8 @@ LLGL_STATIC_ASSERT_ENUM(ShaderType, TessEvaluation);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Geometry);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Fragment);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Compute);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, Task);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, Mesh);
 
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeString);
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeFile);
@@ -621,6 +652,7 @@ LLGL_STATIC_ASSERT_ENUM(WarningType, VaryingBehavior);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, Secondary);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, MultiSubmit);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, ImmediateSubmit);
+LLGL_STATIC_ASSERT_FLAG(CommandBuffer, Transient);
 
 LLGL_STATIC_ASSERT_FLAG(Clear, Color);
 LLGL_STATIC_ASSERT_FLAG(Clear, Depth);
@@ -652,6 +684,8 @@ LLGL_STATIC_ASSERT_FLAG(Barrier, StorageBuffer);
 LLGL_STATIC_ASSERT_FLAG(Barrier, StorageTexture);
 LLGL_STATIC_ASSERT_FLAG(Barrier, Storage);
 
+LLGL_STATIC_ASSERT_FLAG(PipelineLayout, RootDescriptors);
+
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, Debug);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, NoOptimization);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, OptimizationLevel1);
@@ -667,7 +701,10 @@ LLGL_STATIC_ASSERT_FLAG(Stage, TessEvaluationStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, GeometryStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, FragmentStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, ComputeStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, TaskStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, MeshStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllTessStages);
+LLGL_STATIC_ASSERT_FLAG(Stage, AllMeshStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllGraphicsStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllStages);
 
@@ -683,6 +720,7 @@ LLGL_STATIC_ASSERT_FLAG(Bind, DepthStencilAttachment);
 LLGL_STATIC_ASSERT_FLAG(Bind, CombinedSampler);
 LLGL_STATIC_ASSERT_FLAG(Bind, CopySrc);
 LLGL_STATIC_ASSERT_FLAG(Bind, CopyDst);
+LLGL_STATIC_ASSERT_FLAG(Bind, InputAttachment);
 
 LLGL_STATIC_ASSERT_FLAG(CPUAccess, Read);
 LLGL_STATIC_ASSERT_FLAG(CPUAccess, Write);
@@ -693,6 +731,17 @@ LLGL_STATIC_ASSERT_FLAG(Misc, GenerateMips);
 LLGL_STATIC_ASSERT_FLAG(Misc, NoInitialData);
 LLGL_STATIC_ASSERT_FLAG(Misc, Append);
 LLGL_STATIC_ASSERT_FLAG(Misc, Counter);
+LLGL_STATIC_ASSERT_FLAG(Misc, Transient);
+LLGL_STATIC_ASSERT_FLAG(Misc, Memoryless);
+LLGL_STATIC_ASSERT_FLAG(Misc, Sparse);
+LLGL_STATIC_ASSERT_FLAG(Misc, DirectUpload);
+LLGL_STATIC_ASSERT_FLAG(Misc, DedicatedMemory);
+
+LLGL_STATIC_ASSERT_FLAG(DynamicState, CullMode);
+LLGL_STATIC_ASSERT_FLAG(DynamicState, DepthState);
+LLGL_STATIC_ASSERT_FLAG(DynamicState, StencilState);
+LLGL_STATIC_ASSERT_FLAG(DynamicState, PrimitiveTopology);
+LLGL_STATIC_ASSERT_FLAG(DynamicState, DepthBias);
 
 
 /* ----- Structures ----- */
@@ -754,6 +803,11 @@ LLGL_STATIC_ASSERT_OFFSET(DepthBiasDescriptor, constantFactor);
 LLGL_STATIC_ASSERT_OFFSET(DepthBiasDescriptor, slopeFactor);
 LLGL_STATIC_ASSERT_OFFSET(DepthBiasDescriptor, clamp);
 
+LLGL_STATIC_ASSERT_SIZE(ShadingRateDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(ShadingRateDescriptor, rate);
+LLGL_STATIC_ASSERT_OFFSET(ShadingRateDescriptor, primitiveCombiner);
+LLGL_STATIC_ASSERT_OFFSET(ShadingRateDescriptor, imageCombiner);
+
 LLGL_STATIC_ASSERT_SIZE(RasterizerDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(RasterizerDescriptor, polygonMode);
 LLGL_STATIC_ASSERT_OFFSET(RasterizerDescriptor, cullMode);
@@ -807,6 +861,7 @@ LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, flags);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, numNativeBuffers);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, minStagingPoolSize);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, renderPass);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, queueType);
 
 LLGL_STATIC_ASSERT_SIZE(FormatAttributes);
 LLGL_STATIC_ASSERT_OFFSET(FormatAttributes, bitSize);
@@ -851,6 +906,7 @@ LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, arrayLayers);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, mipLevels);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, clearValue);
+LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, aliasingGroup);
 
 LLGL_STATIC_ASSERT_SIZE(TextureViewDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(TextureViewDescriptor, type);
@@ -874,7 +930,13 @@ LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, depthBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, stencilBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, swapBuffers);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, framesInFlight);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, presentMode);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, fullscreen);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, lowLatency);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, deferredAcquire);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, discardDepthStencil);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, preRotation);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingFeatures);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderTargets);
@@ -904,6 +966,19 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasLogicOp);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineCaching);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasConcurrentPipelineStateCreation);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectDrawingCount);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasConcurrentShaderCreation);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasConcurrentResourceCreation);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasMeshShaders);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasSparseTextures);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasInputAttachments);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasQueryResolve);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasFileStreamDecompression);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTextureMinLODClamp);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasVariableRateShading);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasShadingRateImage);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasMultiview);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingLimits);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, lineWidthRange);
@@ -930,6 +1005,10 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxColorBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxDepthBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxStencilBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxNoAttachmentSamples);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxMeshShaderWorkGroups);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, dynamicStates);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, shadingRateImageTileSize);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxMultiviewViews);
 
 LLGL_STATIC_ASSERT_SIZE(ImageView);
 LLGL_STATIC_ASSERT_OFFSET(ImageView, format);
@@ -1021,12 +1100,16 @@ LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, format);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, loadOp);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, storeOp);
 
-LLGL_STATIC_ASSERT_SIZE(RenderPassDescriptor);
+LLGL_STATIC_ASSERT_SIZE(SubpassDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(SubpassDescriptor, colorAttachmentMask);
+LLGL_STATIC_ASSERT_OFFSET(SubpassDescriptor, inputAttachmentMask);
+
 LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, colorAttachments);
 LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, depthAttachment);
 LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, stencilAttachment);
 LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, samples);
+LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, viewMask);
 
 LLGL_STATIC_ASSERT_SIZE(DisplayMode);
 LLGL_STATIC_ASSERT_OFFSET(DisplayMode, resolution);
@@ -1053,6 +1136,8 @@ LLGL_STATIC_ASSERT_OFFSET(DrawPatchIndirectArguments, firstInstance);
 
 LLGL_STATIC_ASSERT_SIZE(DispatchIndirectArguments);
 LLGL_STATIC_ASSERT_OFFSET(DispatchIndirectArguments, numThreadGroups);
+LLGL_STATIC_ASSERT_SIZE(DrawMeshTasksIndirectArguments);
+LLGL_STATIC_ASSERT_OFFSET(DrawMeshTasksIndirectArguments, numThreadGroups);
 
 LLGL_STATIC_ASSERT_SIZE(ProfileCommandQueueRecord);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, bufferWrites);
@@ -1090,6 +1175,15 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, drawCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, dispatchCommands);
 
 
+/* ----- Object handles ----- */
+
+// Arrays of object handles are passed through to the C++ interface without conversion, e.g. in llglBeginStreamOutput, llglCreateBufferArray, and llglGenerateMipsBatch
+static_assert(sizeof(LLGLBuffer) == sizeof(Buffer*), "LLGLBuffer does not match size of LLGL::Buffer*");
+static_assert(offsetof(LLGLBuffer, internal) == 0, "LLGLBuffer::internal is not the first member of LLGLBuffer");
+static_assert(sizeof(LLGLTexture) == sizeof(Texture*), "LLGLTexture does not match size of LLGL::Texture*");
+static_assert(offsetof(LLGLTexture, internal) == 0, "LLGLTexture::internal is not the first member of LLGLTexture");
+
+
 // } /namespace LLGL
 
 
@@ -301,6 +301,16 @@ LLGL_C_EXPORT void llglRemoveWindowEventListener(LLGLWindow window, int eventLis
         LLGL_PTR(Window, window)->RemoveEventListener(eventListener.get());
 }
 
+LLGL_C_EXPORT void llglSetWindowGlobalMotionBuffer(LLGLWindow window, uint32_t capacity)
+{
+    LLGL_PTR(Window, window)->SetGlobalMotionBuffer(capacity);
+}
+
+LLGL_C_EXPORT uint32_t llglReadWindowGlobalMotion(LLGLWindow window, uint32_t maxCount, LLGLOffset2D* outMotions)
+{
+    return LLGL_PTR(Window, window)->ReadGlobalMotion((Offset2D*)outMotions, maxCount);
+}
+
 LLGL_C_EXPORT void llglPostWindowQuit(LLGLWindow window)
 {
     LLGL_PTR(Window, window)->PostQuit();
@@ -51,6 +51,14 @@ namespace LLGL
             NativeLLGL.Execute(secondaryCommandBuffer.Native);
         }
 
+        public void Execute(CommandStream commandStream)
+        {
+            unsafe
+            {
+                NativeLLGL.ExecuteCommandStream(commandStream.Data, (IntPtr)commandStream.Size);
+            }
+        }
+
         public void UpdateBuffer(Buffer dstBuffer, long dstOffset, byte[] data)
         {
             unsafe
@@ -62,6 +70,17 @@ namespace LLGL
             }
         }
 
+        public void UpdateBuffer<T>(Buffer dstBuffer, long dstOffset, ReadOnlySpan<T> data) where T : unmanaged
+        {
+            unsafe
+            {
+                fixed (T* dataPtr = data)
+                {
+                    NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, dataPtr, (short)(data.Length * sizeof(T)));
+                }
+            }
+        }
+
         public unsafe void UpdateBufferUnsafe(Buffer dstBuffer, long dstOffset, void* data, int dataSize)
         {
             NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, data, (short)dataSize);
@@ -72,6 +91,17 @@ namespace LLGL
             NativeLLGL.CopyBuffer(dstBuffer.Native, dstOffset, srcBuffer.Native, srcOffset, size);
         }
 
+        public void CopyBufferRegions(Buffer dstBuffer, Buffer srcBuffer, BufferCopyRegion[] regions)
+        {
+            unsafe
+            {
+                fixed (BufferCopyRegion* regionsPtr = regions)
+                {
+                    NativeLLGL.CopyBufferRegions(dstBuffer.Native, srcBuffer.Native, regions.Length, regionsPtr);
+                }
+            }
+        }
+
         public void CopyBufferFromTexture(Buffer dstBuffer, long dstOffset, Texture srcTexture, TextureRegion srcRegion, int rowStride = 0, int layerStride = 0)
         {
             NativeLLGL.CopyBufferFromTexture(dstBuffer.Native, dstOffset, srcTexture.Native, ref srcRegion, rowStride, layerStride);
@@ -82,11 +112,28 @@ namespace LLGL
             NativeLLGL.FillBuffer(dstBuffer.Native, dstOffset, value, fillSize);
         }
 
+        public void ClearBuffer(Buffer dstBuffer, Format format, ClearValue clearValue, long dstOffset = 0, long clearSize = long.MaxValue)
+        {
+            var nativeClearValue = clearValue.Native;
+            NativeLLGL.ClearBuffer(dstBuffer.Native, format, ref nativeClearValue, dstOffset, clearSize);
+        }
+
         public void CopyTexture(Texture dstTexture, TextureLocation dstLocation, Texture srcTexture, TextureLocation srcLocation, Extent3D extent)
         {
             NativeLLGL.CopyTexture(dstTexture.Native, ref dstLocation, srcTexture.Native, ref srcLocation, ref extent);
         }
 
+        public void CopyTextureRegions(Texture dstTexture, Texture srcTexture, TextureCopyRegion[] regions)
+        {
+            unsafe
+            {
+                fixed (TextureCopyRegion* regionsPtr = regions)
+                {
+                    NativeLLGL.CopyTextureRegions(dstTexture.Native, srcTexture.Native, regions.Length, regionsPtr);
+                }
+            }
+        }
+
         public void CopyTextureFromBuffer(Texture dstTexture, TextureRegion dstRegion, Buffer srcBuffer, long srcOffset, int rowStride = 0, int layerStride = 0)
         {
             NativeLLGL.CopyTextureFromBuffer(dstTexture.Native, ref dstRegion, srcBuffer.Native, srcOffset, rowStride, layerStride);
@@ -97,6 +144,17 @@ namespace LLGL
             NativeLLGL.CopyTextureFromFramebuffer(dstTexture.Native, ref dstRegion, ref srcOffset);
         }
 
+        public void ClearTexture(Texture texture, TextureSubresource subresource, ClearValue clearValue)
+        {
+            var nativeClearValue = clearValue.Native;
+            NativeLLGL.ClearTexture(texture.Native, ref subresource, ref nativeClearValue);
+        }
+
+        public void DiscardResource(Resource resource)
+        {
+            NativeLLGL.DiscardResource(resource.NativeBase);
+        }
+
         public void GenerateMips(Texture texture)
         {
             NativeLLGL.GenerateMips(texture.Native);
@@ -107,6 +165,19 @@ namespace LLGL
             NativeLLGL.GenerateMipsRange(texture.Native, ref subresource);
         }
 
+        public void GenerateMips(Texture[] textures)
+        {
+            unsafe
+            {
+                var nativeTextures = stackalloc NativeLLGL.Texture[textures.Length];
+                for (int i = 0; i < textures.Length; ++i)
+                {
+                    nativeTextures[i] = textures[i].Native;
+                }
+                NativeLLGL.GenerateMipsBatch(textures.Length, nativeTextures);
+            }
+        }
+
         public void SetViewport(Viewport viewport)
         {
             NativeLLGL.SetViewport(ref viewport);
@@ -123,6 +194,17 @@ namespace LLGL
             }
         }
 
+        public void SetViewports(ReadOnlySpan<Viewport> viewports)
+        {
+            unsafe
+            {
+                fixed (Viewport* viewportsPtr = viewports)
+                {
+                    NativeLLGL.SetViewports(viewports.Length, viewportsPtr);
+                }
+            }
+        }
+
         public void SetScissor(Scissor scissor)
         {
             NativeLLGL.SetScissor(ref scissor);
@@ -139,16 +221,43 @@ namespace LLGL
             }
         }
 
+        public void SetScissors(ReadOnlySpan<Scissor> scissors)
+        {
+            unsafe
+            {
+                fixed (Scissor* scissorsPtr = scissors)
+                {
+                    NativeLLGL.SetScissors(scissors.Length, scissorsPtr);
+                }
+            }
+        }
+
         public void SetVertexBuffer(Buffer buffer)
         {
             NativeLLGL.SetVertexBuffer(buffer.Native);
         }
 
+        public void SetVertexBuffer(Buffer buffer, long offset)
+        {
+            NativeLLGL.SetVertexBufferExt(buffer.Native, offset);
+        }
+
         public void SetVertexBufferArray(BufferArray bufferArray)
         {
             NativeLLGL.SetVertexBufferArray(bufferArray.Native);
         }
 
+        public void SetVertexBufferArray(BufferArray bufferArray, long[] offsets)
+        {
+            unsafe
+            {
+                fixed (long* offsetsPtr = offsets)
+                {
+                    NativeLLGL.SetVertexBufferArrayExt(bufferArray.Native, offsetsPtr);
+                }
+            }
+        }
+
         public void SetIndexBuffer(Buffer buffer)
         {
             NativeLLGL.SetIndexBuffer(buffer.Native);
@@ -169,6 +278,11 @@ namespace LLGL
             NativeLLGL.SetResource(descriptor, resource.NativeBase);
         }
 
+        public void SetResource(int descriptor, Buffer buffer, long offset, long size)
+        {
+            NativeLLGL.SetResourceExt(descriptor, buffer.Native, offset, size);
+        }
+
         public void ResetResourceSlots(ResourceType resourceType, int firstSlot, int numSlots, BindFlags bindFlags, StageFlags stageFlags)
         {
             NativeLLGL.ResetResourceSlots(resourceType, firstSlot, numSlots, (int)bindFlags, (int)stageFlags);
@@ -204,6 +318,11 @@ namespace LLGL
             NativeLLGL.EndRenderPass();
         }
 
+        public void NextSubpass()
+        {
+            NativeLLGL.NextSubpass();
+        }
+
         public void Clear(ClearFlags flags, ClearValue clearValue)
         {
             var nativeClearValue = clearValue.Native;
@@ -246,6 +365,45 @@ namespace LLGL
             NativeLLGL.SetStencilReference(reference, stencilFace);
         }
 
+        public void SetCullMode(CullMode cullMode)
+        {
+            NativeLLGL.SetCullMode(cullMode);
+        }
+
+        public void SetDepthState(DepthDescriptor depthDesc)
+        {
+            var nativeDesc = depthDesc.Native;
+            NativeLLGL.SetDepthState(ref nativeDesc);
+        }
+
+        public void SetStencilState(StencilDescriptor stencilDesc)
+        {
+            var nativeDesc = stencilDesc.Native;
+            NativeLLGL.SetStencilState(ref nativeDesc);
+        }
+
+        public void SetPrimitiveTopology(PrimitiveTopology primitiveTopology)
+        {
+            NativeLLGL.SetPrimitiveTopology(primitiveTopology);
+        }
+
+        public void SetDepthBias(DepthBiasDescriptor depthBiasDesc)
+        {
+            var nativeDesc = depthBiasDesc.Native;
+            NativeLLGL.SetDepthBias(ref nativeDesc);
+        }
+
+        public void SetShadingRate(ShadingRateDescriptor shadingRateDesc)
+        {
+            var nativeDesc = shadingRateDesc.Native;
+            NativeLLGL.SetShadingRate(ref nativeDesc);
+        }
+
+        public void SetShadingRateImage(Texture texture)
+        {
+            NativeLLGL.SetShadingRateImage(texture != null ? texture.Native : new NativeLLGL.Texture());
+        }
+
         public void SetUniforms(int first, byte[] data)
         {
             unsafe
@@ -257,6 +415,17 @@ namespace LLGL
             }
         }
 
+        public void SetUniforms<T>(int first, ReadOnlySpan<T> data) where T : unmanaged
+        {
+            unsafe
+            {
+                fixed (T* dataPtr = data)
+                {
+                    NativeLLGL.SetUniforms(first, dataPtr, (short)(data.Length * sizeof(T)));
+                }
+            }
+        }
+
         public unsafe void SetUniformsUnsafe(int first, void* data, int dataSize)
         {
             NativeLLGL.SetUniforms(first, data, (short)dataSize);
@@ -282,6 +451,11 @@ namespace LLGL
             NativeLLGL.EndRenderCondition();
         }
 
+        public void ResolveQueryData(QueryHeap queryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset = 0)
+        {
+            NativeLLGL.ResolveQueryData(queryHeap.Native, firstQuery, numQueries, dstBuffer.Native, dstOffset);
+        }
+
         public void BeginStreamOutput(Buffer[] buffers)
         {
             unsafe
@@ -335,6 +509,28 @@ namespace LLGL
             NativeLLGL.DrawIndexedInstancedExt(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
         }
 
+        public void MultiDrawIndexed(DrawIndexedIndirectArguments[] draws)
+        {
+            unsafe
+            {
+                fixed (DrawIndexedIndirectArguments* drawsPtr = draws)
+                {
+                    NativeLLGL.MultiDrawIndexed(draws.Length, drawsPtr);
+                }
+            }
+        }
+
+        public void MultiDrawIndexed(ReadOnlySpan<DrawIndexedIndirectArguments> draws)
+        {
+            unsafe
+            {
+                fixed (DrawIndexedIndirectArguments* drawsPtr = draws)
+                {
+                    NativeLLGL.MultiDrawIndexed(draws.Length, drawsPtr);
+                }
+            }
+        }
+
         public void DrawIndirect(Buffer buffer, long offset)
         {
             NativeLLGL.DrawIndirect(buffer.Native, offset);
@@ -355,6 +551,26 @@ namespace LLGL
             NativeLLGL.DrawIndexedIndirectExt(buffer.Native, offset, numCommands, stride);
         }
 
+        public void DrawIndirectCount(Buffer argumentsBuffer, long argumentsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndirectCount(argumentsBuffer.Native, argumentsOffset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
+        public void DrawIndexedIndirectCount(Buffer argumentsBuffer, long argumentsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndexedIndirectCount(argumentsBuffer.Native, argumentsOffset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
+        public void DrawMeshTasks(int numThreadGroupsX, int numThreadGroupsY, int numThreadGroupsZ)
+        {
+            NativeLLGL.DrawMeshTasks(numThreadGroupsX, numThreadGroupsY, numThreadGroupsZ);
+        }
+
+        public void DrawMeshTasksIndirect(Buffer buffer, long offset, int numCommands, int stride)
+        {
+            NativeLLGL.DrawMeshTasksIndirect(buffer.Native, offset, numCommands, stride);
+        }
+
         public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
         {
             NativeLLGL.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -0,0 +1,293 @@
+/*
+ * CommandStream.cs
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace LLGL
+{
+    internal enum CommandStreamOpcode : int
+    {
+        SetViewport             = 1,
+        SetScissor              = 2,
+        SetVertexBuffer         = 3,
+        SetVertexBufferArray    = 4,
+        SetIndexBuffer          = 5,
+        SetIndexBufferExt       = 6,
+        SetResourceHeap         = 7,
+        SetResource             = 8,
+        SetPipelineState        = 9,
+        SetUniforms             = 10,
+        BeginRenderPass         = 11,
+        EndRenderPass           = 12,
+        Clear                   = 13,
+        Draw                    = 14,
+        DrawIndexed             = 15,
+        DrawInstanced           = 16,
+        DrawIndexedInstanced    = 17,
+        Dispatch                = 18,
+    }
+
+    /// <summary>
+    /// Records commands into unmanaged memory, so they can be encoded with a single call to CommandBuffer.Execute(CommandStream).
+    /// Only the native handles are recorded, so all referenced objects must be kept alive until the stream has been executed.
+    /// </summary>
+    public sealed class CommandStream : IDisposable
+    {
+        private unsafe byte* data;
+        private int capacity;
+        private int size;
+
+        public CommandStream(int initialCapacity = 4096)
+        {
+            unsafe
+            {
+                capacity = Math.Max(initialCapacity, 64);
+                data = (byte*)Marshal.AllocHGlobal(capacity);
+            }
+        }
+
+        ~CommandStream()
+        {
+            Dispose();
+        }
+
+        public void Dispose()
+        {
+            unsafe
+            {
+                if (data != null)
+                {
+                    Marshal.FreeHGlobal((IntPtr)data);
+                    data = null;
+                    capacity = 0;
+                    size = 0;
+                }
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        internal unsafe void* Data
+        {
+            get
+            {
+                return data;
+            }
+        }
+
+        /// <summary>Size (in bytes) of all recorded commands.</summary>
+        public int Size
+        {
+            get
+            {
+                return size;
+            }
+        }
+
+        /// <summary>Discards all recorded commands but keeps the allocated memory.</summary>
+        public void Reset()
+        {
+            size = 0;
+        }
+
+        public void SetViewport(Viewport viewport)
+        {
+            WriteOpcode(CommandStreamOpcode.SetViewport);
+            Write(viewport);
+        }
+
+        public void SetScissor(Scissor scissor)
+        {
+            WriteOpcode(CommandStreamOpcode.SetScissor);
+            Write(scissor);
+        }
+
+        public void SetVertexBuffer(Buffer buffer)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetVertexBuffer);
+                Write((IntPtr)buffer.Native.ptr);
+            }
+        }
+
+        public void SetVertexBufferArray(BufferArray bufferArray)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetVertexBufferArray);
+                Write((IntPtr)bufferArray.Native.ptr);
+            }
+        }
+
+        public void SetIndexBuffer(Buffer buffer)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetIndexBuffer);
+                Write((IntPtr)buffer.Native.ptr);
+            }
+        }
+
+        public void SetIndexBuffer(Buffer buffer, Format format, long offset)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetIndexBufferExt);
+                Write((IntPtr)buffer.Native.ptr);
+                Write((int)format);
+                Write(offset);
+            }
+        }
+
+        public void SetResourceHeap(ResourceHeap resourceHeap, int descriptorSet = 0)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetResourceHeap);
+                Write((IntPtr)resourceHeap.Native.ptr);
+                Write(descriptorSet);
+            }
+        }
+
+        public void SetResource(int descriptor, Resource resource)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetResource);
+                Write(descriptor);
+                Write((IntPtr)resource.NativeBase.ptr);
+            }
+        }
+
+        public void SetPipelineState(PipelineState pipelineState)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.SetPipelineState);
+                Write((IntPtr)pipelineState.Native.ptr);
+            }
+        }
+
+        public void SetUniforms<T>(int first, ReadOnlySpan<T> data) where T : unmanaged
+        {
+            unsafe
+            {
+                int dataSize = data.Length * sizeof(T);
+                WriteOpcode(CommandStreamOpcode.SetUniforms);
+                Write(first);
+                Write(dataSize);
+                Reserve(dataSize);
+                fixed (T* dataPtr = data)
+                {
+                    System.Buffer.MemoryCopy(dataPtr, this.data + size, dataSize, dataSize);
+                }
+                size += dataSize;
+            }
+        }
+
+        public void BeginRenderPass(RenderTarget renderTarget)
+        {
+            unsafe
+            {
+                WriteOpcode(CommandStreamOpcode.BeginRenderPass);
+                Write((IntPtr)renderTarget.Native.ptr);
+            }
+        }
+
+        public void EndRenderPass()
+        {
+            WriteOpcode(CommandStreamOpcode.EndRenderPass);
+        }
+
+        public void Clear(ClearFlags flags, ClearValue clearValue)
+        {
+            WriteOpcode(CommandStreamOpcode.Clear);
+            Write((int)flags);
+            Write(clearValue.Native);
+        }
+
+        public void Draw(int numVertices, int firstVertex)
+        {
+            WriteOpcode(CommandStreamOpcode.Draw);
+            Write(numVertices);
+            Write(firstVertex);
+        }
+
+        public void DrawIndexed(int numIndices, int firstIndex, int vertexOffset = 0)
+        {
+            WriteOpcode(CommandStreamOpcode.DrawIndexed);
+            Write(numIndices);
+            Write(firstIndex);
+            Write(vertexOffset);
+        }
+
+        public void DrawInstanced(int numVertices, int firstVertex, int numInstances, int firstInstance = 0)
+        {
+            WriteOpcode(CommandStreamOpcode.DrawInstanced);
+            Write(numVertices);
+            Write(firstVertex);
+            Write(numInstances);
+            Write(firstInstance);
+        }
+
+        public void DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex, int vertexOffset = 0, int firstInstance = 0)
+        {
+            WriteOpcode(CommandStreamOpcode.DrawIndexedInstanced);
+            Write(numIndices);
+            Write(numInstances);
+            Write(firstIndex);
+            Write(vertexOffset);
+            Write(firstInstance);
+        }
+
+        public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            WriteOpcode(CommandStreamOpcode.Dispatch);
+            Write(numWorkGroupsX);
+            Write(numWorkGroupsY);
+            Write(numWorkGroupsZ);
+        }
+
+        private void WriteOpcode(CommandStreamOpcode opcode)
+        {
+            Write((int)opcode);
+        }
+
+        private void Write<T>(T value) where T : unmanaged
+        {
+            unsafe
+            {
+                Reserve(sizeof(T));
+                System.Buffer.MemoryCopy(&value, data + size, sizeof(T), sizeof(T));
+                size += sizeof(T);
+            }
+        }
+
+        private void Reserve(int additionalSize)
+        {
+            unsafe
+            {
+                if (data == null)
+                {
+                    throw new ObjectDisposedException(nameof(CommandStream));
+                }
+                if (size + additionalSize > capacity)
+                {
+                    int newCapacity = Math.Max(capacity * 2, size + additionalSize);
+                    data = (byte*)Marshal.ReAllocHGlobal((IntPtr)data, (IntPtr)newCapacity);
+                    capacity = newCapacity;
+                }
+            }
+        }
+    }
+}
+
+
+
+
+// ================================================================================
@@ -53,6 +53,13 @@ namespace LLGL
         Back,
     }
 
+    public enum CommandQueueType
+    {
+        Graphics,
+        Compute,
+        Copy,
+    }
+
     public enum Format
     {
         Undefined,
@@ -523,6 +530,26 @@ namespace LLGL
         FractionalEven,
     }
 
+    public enum ShadingRate
+    {
+        Rate1x1,
+        Rate1x2,
+        Rate2x1,
+        Rate2x2,
+        Rate2x4,
+        Rate4x2,
+        Rate4x4,
+    }
+
+    public enum ShadingRateCombiner
+    {
+        Passthrough,
+        Override,
+        Min,
+        Max,
+        Sum,
+    }
+
     public enum QueryType
     {
         SamplesPassed,
@@ -645,6 +672,15 @@ namespace LLGL
         Sampler,
     }
 
+    public enum ResidencyPriority
+    {
+        Minimum,
+        Low,
+        Normal,
+        High,
+        Maximum,
+    }
+
     public enum SamplerAddressMode
     {
         Repeat,
@@ -669,6 +705,8 @@ namespace LLGL
         Geometry,
         Fragment,
         Compute,
+        Task,
+        Mesh,
     }
 
     public enum ShaderSourceType
@@ -713,6 +751,23 @@ namespace LLGL
         ViewportIndex,
     }
 
+    public enum PresentMode
+    {
+        Default,
+        Immediate,
+        Mailbox,
+        Fifo,
+        FifoRelaxed,
+    }
+
+    public enum SurfaceTransform
+    {
+        Identity,
+        Rotate90,
+        Rotate180,
+        Rotate270,
+    }
+
     public enum TextureType
     {
         Texture1D,
@@ -750,6 +805,7 @@ namespace LLGL
         Secondary       = (1 << 0),
         MultiSubmit     = (1 << 1),
         ImmediateSubmit = (1 << 2),
+        Transient       = (1 << 3),
     }
 
     [Flags]
@@ -794,6 +850,12 @@ namespace LLGL
         Storage        = (StorageBuffer | StorageTexture),
     }
 
+    [Flags]
+    public enum PipelineLayoutFlags : int
+    {
+        RootDescriptors = (1 << 0),
+    }
+
     [Flags]
     public enum ColorMaskFlags : int
     {
@@ -805,13 +867,25 @@ namespace LLGL
         All  = (R | G | B | A),
     }
 
+    [Flags]
+    public enum DynamicStateFlags : int
+    {
+        CullMode          = (1 << 0),
+        DepthState        = (1 << 1),
+        StencilState      = (1 << 2),
+        PrimitiveTopology = (1 << 3),
+        DepthBias         = (1 << 4),
+    }
+
     [Flags]
     public enum RenderSystemFlags : int
     {
-        DebugDevice  = (1 << 0),
-        PreferNVIDIA = (1 << 1),
-        PreferAMD    = (1 << 2),
-        PreferIntel  = (1 << 3),
+        DebugDevice     = (1 << 0),
+        PreferNVIDIA    = (1 << 1),
+        PreferAMD       = (1 << 2),
+        PreferIntel     = (1 << 3),
+        DeferredRelease = (1 << 4),
+        Headless        = (1 << 5),
     }
 
     [Flags]
@@ -829,6 +903,7 @@ namespace LLGL
         CombinedSampler        = (1 << 9),
         CopySrc                = (1 << 10),
         CopyDst                = (1 << 11),
+        InputAttachment        = (1 << 12),
     }
 
     [Flags]
@@ -842,12 +917,17 @@ namespace LLGL
     [Flags]
     public enum MiscFlags : int
     {
-        DynamicUsage  = (1 << 0),
-        FixedSamples  = (1 << 1),
-        GenerateMips  = (1 << 2),
-        NoInitialData = (1 << 3),
-        Append        = (1 << 4),
-        Counter       = (1 << 5),
+        DynamicUsage    = (1 << 0),
+        FixedSamples    = (1 << 1),
+        GenerateMips    = (1 << 2),
+        NoInitialData   = (1 << 3),
+        Append          = (1 << 4),
+        Counter         = (1 << 5),
+        Transient       = (1 << 6),
+        Memoryless      = (1 << 7),
+        Sparse          = (1 << 8),
+        DirectUpload    = (1 << 9),
+        DedicatedMemory = (1 << 10),
     }
 
     [Flags]
@@ -862,6 +942,7 @@ namespace LLGL
         PatchClippingOrigin = (1 << 6),
         SeparateShader      = (1 << 7),
         DefaultLibrary      = (1 << 8),
+        StripDebugInfo      = (1 << 9),
     }
 
     [Flags]
@@ -873,8 +954,11 @@ namespace LLGL
         GeometryStage       = (1 << 3),
         FragmentStage       = (1 << 4),
         ComputeStage        = (1 << 5),
+        TaskStage           = (1 << 6),
+        MeshStage           = (1 << 7),
         AllTessStages       = (TessControlStage | TessEvaluationStage),
-        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
+        AllMeshStages       = (TaskStage | MeshStage),
+        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | AllMeshStages | FragmentStage),
         AllStages           = (AllGraphicsStages | ComputeStage),
     }
 
@@ -973,6 +1057,18 @@ namespace LLGL
         public int Height { get; set; } /* = 0 */
     }
 
+    public struct SubpassDescriptor
+    {
+        public SubpassDescriptor(int colorAttachmentMask = ~0, int inputAttachmentMask = 0)
+        {
+            ColorAttachmentMask = colorAttachmentMask;
+            InputAttachmentMask = inputAttachmentMask;
+        }
+
+        public int ColorAttachmentMask { get; set; } /* = ~0 */
+        public int InputAttachmentMask { get; set; } /* = 0 */
+    }
+
     public struct QueryPipelineStatistics
     {
         public long InputAssemblyVertices { get; set; }           /* = 0 */
@@ -1091,6 +1187,20 @@ namespace LLGL
         public Extent3D           Extent { get; set; }      /* = new Extent3D() */
     }
 
+    public struct BufferCopyRegion
+    {
+        public long DstOffset { get; set; } /* = 0 */
+        public long SrcOffset { get; set; } /* = 0 */
+        public long Size { get; set; }      /* = 0 */
+    }
+
+    public struct TextureCopyRegion
+    {
+        public TextureLocation DstLocation { get; set; } /* = new TextureLocation() */
+        public TextureLocation SrcLocation { get; set; } /* = new TextureLocation() */
+        public Extent3D        Extent { get; set; }      /* = new Extent3D() */
+    }
+
     /* ----- Classes ----- */
 
     public class CommandBufferDescriptor
@@ -1100,6 +1210,7 @@ namespace LLGL
         public int                NumNativeBuffers { get; set; }   = 2;
         public long               MinStagingPoolSize { get; set; } = (0xFFFF+1);
         public RenderPass         RenderPass { get; set; }         = null;
+        public CommandQueueType   QueueType { get; set; }          = CommandQueueType.Graphics;
 
         internal NativeLLGL.CommandBufferDescriptor Native
         {
@@ -1119,6 +1230,7 @@ namespace LLGL
                     {
                         native.renderPass = RenderPass.Native;
                     }
+                    native.queueType          = QueueType;
                 }
                 return native;
             }
@@ -1144,6 +1256,25 @@ namespace LLGL
         }
     }
 
+    public class ShadingRateDescriptor
+    {
+        public ShadingRate         Rate { get; set; }              = ShadingRate.Rate1x1;
+        public ShadingRateCombiner PrimitiveCombiner { get; set; } = ShadingRateCombiner.Passthrough;
+        public ShadingRateCombiner ImageCombiner { get; set; }     = ShadingRateCombiner.Passthrough;
+
+        internal NativeLLGL.ShadingRateDescriptor Native
+        {
+            get
+            {
+                var native = new NativeLLGL.ShadingRateDescriptor();
+                native.rate              = Rate;
+                native.primitiveCombiner = PrimitiveCombiner;
+                native.imageCombiner     = ImageCombiner;
+                return native;
+            }
+        }
+    }
+
     public class ComputePipelineDescriptor
     {
         public AnsiString     DebugName { get; set; }      = null;
@@ -1177,8 +1308,11 @@ namespace LLGL
 
     public class ProfileTimeRecord
     {
-        public AnsiString Annotation { get; set; }  = "";
-        public long       ElapsedTime { get; set; } = 0;
+        public AnsiString Annotation { get; set; }      = "";
+        public long       ElapsedTime { get; set; }     = 0;
+        public long       CPUTicksStart { get; set; }   = 0;
+        public long       CPUTicksEnd { get; set; }     = 0;
+        public int        CommandBufferID { get; set; } = 0;
 
         public ProfileTimeRecord() { }
 
@@ -1198,7 +1332,10 @@ namespace LLGL
                     {
                         native.annotation = annotationPtr;
                     }
-                    native.elapsedTime = ElapsedTime;
+                    native.elapsedTime     = ElapsedTime;
+                    native.cpuTicksStart   = CPUTicksStart;
+                    native.cpuTicksEnd     = CPUTicksEnd;
+                    native.commandBufferID = CommandBufferID;
                 }
                 return native;
             }
@@ -1206,8 +1343,11 @@ namespace LLGL
             {
                 unsafe
                 {
-                    Annotation  = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
-                    ElapsedTime = value.elapsedTime;
+                    Annotation      = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    ElapsedTime     = value.elapsedTime;
+                    CPUTicksStart   = value.cpuTicksStart;
+                    CPUTicksEnd     = value.cpuTicksEnd;
+                    CommandBufferID = value.commandBufferID;
                 }
             }
         }
@@ -1344,6 +1484,19 @@ namespace LLGL
         public bool HasPipelineCaching { get; set; }           = false;
         public bool HasPipelineStatistics { get; set; }        = false;
         public bool HasRenderCondition { get; set; }           = false;
+        public bool HasConcurrentPipelineStateCreation { get; set; } = false;
+        public bool HasIndirectDrawingCount { get; set; }      = false;
+        public bool HasConcurrentShaderCreation { get; set; }  = false;
+        public bool HasConcurrentResourceCreation { get; set; } = false;
+        public bool HasMeshShaders { get; set; }               = false;
+        public bool HasSparseTextures { get; set; }            = false;
+        public bool HasInputAttachments { get; set; }          = false;
+        public bool HasQueryResolve { get; set; }              = false;
+        public bool HasFileStreamDecompression { get; set; }   = false;
+        public bool HasTextureMinLODClamp { get; set; }        = false;
+        public bool HasVariableRateShading { get; set; }       = false;
+        public bool HasShadingRateImage { get; set; }          = false;
+        public bool HasMultiview { get; set; }                 = false;
 
         public RenderingFeatures() { }
 
@@ -1383,6 +1536,19 @@ namespace LLGL
                 HasPipelineCaching           = value.hasPipelineCaching;
                 HasPipelineStatistics        = value.hasPipelineStatistics;
                 HasRenderCondition           = value.hasRenderCondition;
+                HasConcurrentPipelineStateCreation = value.hasConcurrentPipelineStateCreation;
+                HasIndirectDrawingCount      = value.hasIndirectDrawingCount;
+                HasConcurrentShaderCreation  = value.hasConcurrentShaderCreation;
+                HasConcurrentResourceCreation = value.hasConcurrentResourceCreation;
+                HasMeshShaders               = value.hasMeshShaders;
+                HasSparseTextures            = value.hasSparseTextures;
+                HasInputAttachments          = value.hasInputAttachments;
+                HasQueryResolve              = value.hasQueryResolve;
+                HasFileStreamDecompression   = value.hasFileStreamDecompression;
+                HasTextureMinLODClamp        = value.hasTextureMinLODClamp;
+                HasVariableRateShading       = value.hasVariableRateShading;
+                HasShadingRateImage          = value.hasShadingRateImage;
+                HasMultiview                 = value.hasMultiview;
             }
         }
     }
@@ -1413,6 +1579,10 @@ namespace LLGL
         public int     MaxDepthBufferSamples { get; set; }         = 0;
         public int     MaxStencilBufferSamples { get; set; }       = 0;
         public int     MaxNoAttachmentSamples { get; set; }        = 0;
+        public int[]   MaxMeshShaderWorkGroups { get; set; }       = new int[]{ 0, 0, 0 };
+        public DynamicStateFlags DynamicStates { get; set; }       = 0;
+        public int     ShadingRateImageTileSize { get; set; }      = 0;
+        public int     MaxMultiviewViews { get; set; }             = 0;
 
         public RenderingLimits() { }
 
@@ -1457,6 +1627,12 @@ namespace LLGL
                     MaxDepthBufferSamples            = value.maxDepthBufferSamples;
                     MaxStencilBufferSamples          = value.maxStencilBufferSamples;
                     MaxNoAttachmentSamples           = value.maxNoAttachmentSamples;
+                    MaxMeshShaderWorkGroups[0]       = value.maxMeshShaderWorkGroups[0];
+                    MaxMeshShaderWorkGroups[1]       = value.maxMeshShaderWorkGroups[1];
+                    MaxMeshShaderWorkGroups[2]       = value.maxMeshShaderWorkGroups[2];
+                    DynamicStates                    = (DynamicStateFlags)value.dynamicStates;
+                    ShadingRateImageTileSize         = value.shadingRateImageTileSize;
+                    MaxMultiviewViews                = value.maxMultiviewViews;
                 }
             }
         }
@@ -2167,26 +2343,38 @@ namespace LLGL
     {
         public SwapChainDescriptor() { }
 
-        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, bool fullscreen = false)
-        {
-            DebugName   = debugName;
-            Resolution  = resolution;
-            ColorBits   = colorBits;
-            DepthBits   = depthBits;
-            StencilBits = stencilBits;
-            Samples     = samples;
-            SwapBuffers = swapBuffers;
-            Fullscreen  = fullscreen;
-        }
-
-        public AnsiString DebugName { get; set; }   = null;
-        public Extent2D   Resolution { get; set; }  = new Extent2D();
-        public int        ColorBits { get; set; }   = 32;
-        public int        DepthBits { get; set; }   = 24;
-        public int        StencilBits { get; set; } = 8;
-        public int        Samples { get; set; }     = 1;
-        public int        SwapBuffers { get; set; } = 2;
-        public bool       Fullscreen { get; set; }  = false;
+        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, int framesInFlight = 0, PresentMode presentMode = PresentMode.Default, bool fullscreen = false, bool lowLatency = false, bool deferredAcquire = false, bool discardDepthStencil = false, bool preRotation = false)
+        {
+            DebugName           = debugName;
+            Resolution          = resolution;
+            ColorBits           = colorBits;
+            DepthBits           = depthBits;
+            StencilBits         = stencilBits;
+            Samples             = samples;
+            SwapBuffers         = swapBuffers;
+            FramesInFlight      = framesInFlight;
+            PresentMode         = presentMode;
+            Fullscreen          = fullscreen;
+            LowLatency          = lowLatency;
+            DeferredAcquire     = deferredAcquire;
+            DiscardDepthStencil = discardDepthStencil;
+            PreRotation         = preRotation;
+        }
+
+        public AnsiString  DebugName { get; set; }           = null;
+        public Extent2D    Resolution { get; set; }          = new Extent2D();
+        public int         ColorBits { get; set; }           = 32;
+        public int         DepthBits { get; set; }           = 24;
+        public int         StencilBits { get; set; }         = 8;
+        public int         Samples { get; set; }             = 1;
+        public int         SwapBuffers { get; set; }         = 2;
+        public int         FramesInFlight { get; set; }      = 0;
+        public PresentMode PresentMode { get; set; }         = PresentMode.Default;
+        public bool        Fullscreen { get; set; }          = false;
+        public bool        LowLatency { get; set; }          = false;
+        public bool        DeferredAcquire { get; set; }     = false;
+        public bool        DiscardDepthStencil { get; set; } = false;
+        public bool        PreRotation { get; set; }         = false;
 
         internal NativeLLGL.SwapChainDescriptor Native
         {
@@ -2199,13 +2387,19 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
-                    native.resolution  = Resolution;
-                    native.colorBits   = ColorBits;
-                    native.depthBits   = DepthBits;
-                    native.stencilBits = StencilBits;
-                    native.samples     = Samples;
-                    native.swapBuffers = SwapBuffers;
-                    native.fullscreen  = Fullscreen;
+                    native.resolution          = Resolution;
+                    native.colorBits           = ColorBits;
+                    native.depthBits           = DepthBits;
+                    native.stencilBits         = StencilBits;
+                    native.samples             = Samples;
+                    native.swapBuffers         = SwapBuffers;
+                    native.framesInFlight      = FramesInFlight;
+                    native.presentMode         = PresentMode;
+                    native.fullscreen          = Fullscreen;
+                    native.lowLatency          = LowLatency;
+                    native.deferredAcquire     = DeferredAcquire;
+                    native.discardDepthStencil = DiscardDepthStencil;
+                    native.preRotation         = PreRotation;
                 }
                 return native;
             }
@@ -2225,6 +2419,7 @@ namespace LLGL
         public int            MipLevels { get; set; }      = 0;
         public int            Samples { get; set; }        = 1;
         public ClearValue     ClearValue { get; set; }     = new ClearValue();
+        public int            AliasingGroup { get; set; }  = 0;
 
         public TextureDescriptor() { }
 
@@ -2257,6 +2452,7 @@ namespace LLGL
                     {
                         native.clearValue = ClearValue.Native;
                     }
+                    native.aliasingGroup  = AliasingGroup;
                 }
                 return native;
             }
@@ -2275,6 +2471,7 @@ namespace LLGL
                     MipLevels      = value.mipLevels;
                     Samples        = value.samples;
                     ClearValue.Native= value.clearValue;
+                    AliasingGroup  = value.aliasingGroup;
                 }
             }
         }
@@ -2892,6 +3089,7 @@ namespace LLGL
             }
         }
         public BarrierFlags              BarrierFlags { get; set; }   = 0;
+        public PipelineLayoutFlags       Flags { get; set; }          = 0;
 
         internal NativeLLGL.PipelineLayoutDescriptor Native
         {
@@ -2937,6 +3135,7 @@ namespace LLGL
                         }
                     }
                     native.barrierFlags   = (int)BarrierFlags;
+                    native.flags          = (int)Flags;
                 }
                 return native;
             }
@@ -2948,15 +3147,20 @@ namespace LLGL
         public AnsiString             DebugName { get; set; }            = null;
         public PipelineLayout         PipelineLayout { get; set; }       = null;
         public RenderPass             RenderPass { get; set; }           = null;
+        public int                    Subpass { get; set; }              = 0;
         public Shader                 VertexShader { get; set; }         = null;
         public Shader                 TessControlShader { get; set; }    = null;
         public Shader                 TessEvaluationShader { get; set; } = null;
         public Shader                 GeometryShader { get; set; }       = null;
+        public Shader                 TaskShader { get; set; }           = null;
+        public Shader                 MeshShader { get; set; }           = null;
         public Shader                 FragmentShader { get; set; }       = null;
         public Format                 IndexFormat { get; set; }          = Format.Undefined;
         public PrimitiveTopology      PrimitiveTopology { get; set; }    = PrimitiveTopology.TriangleList;
+        public DynamicStateFlags      DynamicStates { get; set; }        = 0;
         public Viewport[]             Viewports { get; set; }
         public Scissor[]              Scissors { get; set; }
+        public BindingSlot[]          VertexStreams { get; set; }
         public DepthDescriptor        Depth { get; set; }                = new DepthDescriptor();
         public StencilDescriptor      Stencil { get; set; }              = new StencilDescriptor();
         public RasterizerDescriptor   Rasterizer { get; set; }           = new RasterizerDescriptor();
@@ -2982,6 +3186,7 @@ namespace LLGL
                     {
                         native.renderPass = RenderPass.Native;
                     }
+                    native.subpass = Subpass;
                     if (VertexShader != null)
                     {
                         native.vertexShader = VertexShader.Native;
@@ -2998,12 +3203,21 @@ namespace LLGL
                     {
                         native.geometryShader = GeometryShader.Native;
                     }
+                    if (TaskShader != null)
+                    {
+                        native.taskShader = TaskShader.Native;
+                    }
+                    if (MeshShader != null)
+                    {
+                        native.meshShader = MeshShader.Native;
+                    }
                     if (FragmentShader != null)
                     {
                         native.fragmentShader = FragmentShader.Native;
                     }
                     native.indexFormat          = IndexFormat;
                     native.primitiveTopology    = PrimitiveTopology;
+                    native.dynamicStates        = (int)DynamicStates;
                     if (Viewports != null)
                     {
                         native.numViewports = (IntPtr)Viewports.Length;
@@ -3020,6 +3234,14 @@ namespace LLGL
                             native.scissors = scissorsPtr;
                         }
                     }
+                    if (VertexStreams != null)
+                    {
+                        native.numVertexStreams = (IntPtr)VertexStreams.Length;
+                        fixed (BindingSlot* vertexStreamsPtr = VertexStreams)
+                        {
+                            native.vertexStreams = vertexStreamsPtr;
+                        }
+                    }
                     if (Depth != null)
                     {
                         native.depth = Depth.Native;
@@ -3428,11 +3650,12 @@ namespace LLGL
 
         public unsafe struct CommandBufferDescriptor
         {
-            public byte*      debugName;          /* = null */
-            public int        flags;              /* = 0 */
-            public int        numNativeBuffers;   /* = 2 */
-            public long       minStagingPoolSize; /* = (0xFFFF+1) */
-            public RenderPass renderPass;         /* = null */
+            public byte*            debugName;          /* = null */
+            public int              flags;              /* = 0 */
+            public int              numNativeBuffers;   /* = 2 */
+            public long             minStagingPoolSize; /* = (0xFFFF+1) */
+            public RenderPass       renderPass;         /* = null */
+            public CommandQueueType queueType;          /* = CommandQueueType.Graphics */
         }
 
         public unsafe struct DispatchIndirectArguments
@@ -3440,6 +3663,11 @@ namespace LLGL
             public fixed int numThreadGroups[3];
         }
 
+        public unsafe struct DrawMeshTasksIndirectArguments
+        {
+            public fixed int numThreadGroups[3];
+        }
+
         public unsafe struct DepthBiasDescriptor
         {
             public float constantFactor; /* = 0.0f */
@@ -3447,6 +3675,13 @@ namespace LLGL
             public float clamp;          /* = 0.0f */
         }
 
+        public unsafe struct ShadingRateDescriptor
+        {
+            public ShadingRate         rate;              /* = ShadingRate.Rate1x1 */
+            public ShadingRateCombiner primitiveCombiner; /* = ShadingRateCombiner.Passthrough */
+            public ShadingRateCombiner imageCombiner;     /* = ShadingRateCombiner.Passthrough */
+        }
+
         public unsafe struct ComputePipelineDescriptor
         {
             public byte*          debugName;      /* = null */
@@ -3456,8 +3691,11 @@ namespace LLGL
 
         public unsafe struct ProfileTimeRecord
         {
-            public byte* annotation;  /* = "" */
-            public long  elapsedTime; /* = 0 */
+            public byte* annotation;      /* = "" */
+            public long  elapsedTime;     /* = 0 */
+            public long  cpuTicksStart;   /* = 0 */
+            public long  cpuTicksEnd;     /* = 0 */
+            public int   commandBufferID; /* = 0 */
         }
 
         public unsafe struct ProfileCommandQueueRecord
@@ -3573,6 +3811,28 @@ namespace LLGL
             public bool hasPipelineStatistics;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasRenderCondition;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasConcurrentPipelineStateCreation; /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasIndirectDrawingCount;      /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasConcurrentShaderCreation;  /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasConcurrentResourceCreation; /* = false */
+            public bool hasMeshShaders;               /* = false */
+            public bool hasSparseTextures;            /* = false */
+            public bool hasInputAttachments;          /* = false */
+            public bool hasQueryResolve;              /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasFileStreamDecompression;   /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasTextureMinLODClamp;        /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasVariableRateShading;       /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasShadingRateImage;          /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasMultiview;                 /* = false */
         }
 
         public unsafe struct RenderingLimits
@@ -3601,6 +3861,10 @@ namespace LLGL
             public int         maxDepthBufferSamples;            /* = 0 */
             public int         maxStencilBufferSamples;          /* = 0 */
             public int         maxNoAttachmentSamples;           /* = 0 */
+            public fixed int   maxMeshShaderWorkGroups[3];       /* = { 0, 0, 0 } */
+            public int         dynamicStates;                    /* = 0 */
+            public int         shadingRateImageTileSize;         /* = 0 */
+            public int         maxMultiviewViews;                /* = 0 */
         }
 
         public unsafe struct ResourceHeapDescriptor
@@ -3798,6 +4062,7 @@ namespace LLGL
             public IntPtr            rendererConfigSize; /* = 0 */
             public void*             nativeHandle;       /* = null */
             public IntPtr            nativeHandleSize;   /* = 0 */
+            public byte*             pipelineCacheFilename; /* = null */
         }
 
         public unsafe struct RenderingCapabilities
@@ -3848,15 +4113,25 @@ namespace LLGL
 
         public unsafe struct SwapChainDescriptor
         {
-            public byte*    debugName;   /* = null */
-            public Extent2D resolution;
-            public int      colorBits;   /* = 32 */
-            public int      depthBits;   /* = 24 */
-            public int      stencilBits; /* = 8 */
-            public int      samples;     /* = 1 */
-            public int      swapBuffers; /* = 2 */
+            public byte*       debugName;           /* = null */
+            public Extent2D    resolution;
+            public int         colorBits;           /* = 32 */
+            public int         depthBits;           /* = 24 */
+            public int         stencilBits;         /* = 8 */
+            public int         samples;             /* = 1 */
+            public int         swapBuffers;         /* = 2 */
+            public int         framesInFlight;      /* = 0 */
+            public PresentMode presentMode;         /* = PresentMode.Default */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     fullscreen;  /* = false */
+            public bool        fullscreen;          /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        lowLatency;          /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        deferredAcquire;     /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        discardDepthStencil; /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        preRotation;         /* = false */
         }
 
         public unsafe struct TextureDescriptor
@@ -3872,6 +4147,7 @@ namespace LLGL
             public int         mipLevels;      /* = 0 */
             public int         samples;        /* = 1 */
             public ClearValue  clearValue;
+            public int         aliasingGroup;  /* = 0 */
         }
 
         public unsafe struct VertexAttribute
@@ -3963,6 +4239,9 @@ namespace LLGL
             public AttachmentFormatDescriptor depthAttachment;
             public AttachmentFormatDescriptor stencilAttachment;
             public int                        samples;           /* = 1 */
+            public IntPtr                     numSubpasses;      /* = 0 */
+            public SubpassDescriptor*         subpasses;         /* = null */
+            public int                        viewMask;          /* = 0 */
         }
 
         public unsafe struct RenderTargetDescriptor
@@ -4031,6 +4310,7 @@ namespace LLGL
             public IntPtr                   numUniforms;
             public UniformDescriptor*       uniforms;
             public int                      barrierFlags;      /* = 0 */
+            public int                      flags;             /* = 0 */
         }
 
         public unsafe struct GraphicsPipelineDescriptor
@@ -4038,17 +4318,23 @@ namespace LLGL
             public byte*                  debugName;            /* = null */
             public PipelineLayout         pipelineLayout;       /* = null */
             public RenderPass             renderPass;           /* = null */
+            public int                    subpass;              /* = 0 */
             public Shader                 vertexShader;         /* = null */
             public Shader                 tessControlShader;    /* = null */
             public Shader                 tessEvaluationShader; /* = null */
             public Shader                 geometryShader;       /* = null */
+            public Shader                 taskShader;           /* = null */
+            public Shader                 meshShader;           /* = null */
             public Shader                 fragmentShader;       /* = null */
             public Format                 indexFormat;          /* = Format.Undefined */
             public PrimitiveTopology      primitiveTopology;    /* = PrimitiveTopology.TriangleList */
+            public int                    dynamicStates;        /* = 0 */
             public IntPtr                 numViewports;
             public Viewport*              viewports;
             public IntPtr                 numScissors;
             public Scissor*               scissors;
+            public IntPtr                 numVertexStreams;
+            public BindingSlot*           vertexStreams;
             public DepthDescriptor        depth;
             public StencilDescriptor      stencil;
             public RasterizerDescriptor   rasterizer;
@@ -4198,27 +4484,45 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCopyBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyBuffer(Buffer dstBuffer, long dstOffset, Buffer srcBuffer, long srcOffset, long size);
 
+        [DllImport(DllName, EntryPoint="llglCopyBufferRegions", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CopyBufferRegions(Buffer dstBuffer, Buffer srcBuffer, int numRegions, BufferCopyRegion* regions);
+
         [DllImport(DllName, EntryPoint="llglCopyBufferFromTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyBufferFromTexture(Buffer dstBuffer, long dstOffset, Texture srcTexture, ref TextureRegion srcRegion, int rowStride, int layerStride);
 
         [DllImport(DllName, EntryPoint="llglFillBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FillBuffer(Buffer dstBuffer, long dstOffset, int value, long fillSize);
 
+        [DllImport(DllName, EntryPoint="llglClearBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ClearBuffer(Buffer dstBuffer, Format format, ref ClearValue clearValue, long dstOffset, long clearSize);
+
         [DllImport(DllName, EntryPoint="llglCopyTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTexture(Texture dstTexture, ref TextureLocation dstLocation, Texture srcTexture, ref TextureLocation srcLocation, ref Extent3D extent);
 
+        [DllImport(DllName, EntryPoint="llglCopyTextureRegions", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CopyTextureRegions(Texture dstTexture, Texture srcTexture, int numRegions, TextureCopyRegion* regions);
+
         [DllImport(DllName, EntryPoint="llglCopyTextureFromBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTextureFromBuffer(Texture dstTexture, ref TextureRegion dstRegion, Buffer srcBuffer, long srcOffset, int rowStride, int layerStride);
 
         [DllImport(DllName, EntryPoint="llglCopyTextureFromFramebuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTextureFromFramebuffer(Texture dstTexture, ref TextureRegion dstRegion, ref Offset2D srcOffset);
 
+        [DllImport(DllName, EntryPoint="llglClearTexture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ClearTexture(Texture texture, ref TextureSubresource subresource, ref ClearValue clearValue);
+
+        [DllImport(DllName, EntryPoint="llglDiscardResource", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DiscardResource(Resource resource);
+
         [DllImport(DllName, EntryPoint="llglGenerateMips", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void GenerateMips(Texture texture);
 
         [DllImport(DllName, EntryPoint="llglGenerateMipsRange", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void GenerateMipsRange(Texture texture, ref TextureSubresource subresource);
 
+        [DllImport(DllName, EntryPoint="llglGenerateMipsBatch", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void GenerateMipsBatch(int numTextures, Texture* textures);
+
         [DllImport(DllName, EntryPoint="llglSetViewport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetViewport(ref Viewport viewport);
 
@@ -4234,9 +4538,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetVertexBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetVertexBuffer(Buffer buffer);
 
+        [DllImport(DllName, EntryPoint="llglSetVertexBufferExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetVertexBufferExt(Buffer buffer, long offset);
+
         [DllImport(DllName, EntryPoint="llglSetVertexBufferArray", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetVertexBufferArray(BufferArray bufferArray);
 
+        [DllImport(DllName, EntryPoint="llglSetVertexBufferArrayExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetVertexBufferArrayExt(BufferArray bufferArray, long* offsets);
+
         [DllImport(DllName, EntryPoint="llglSetIndexBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetIndexBuffer(Buffer buffer);
 
@@ -4249,6 +4559,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetResource", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetResource(int descriptor, Resource resource);
 
+        [DllImport(DllName, EntryPoint="llglSetResourceExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetResourceExt(int descriptor, Buffer buffer, long offset, long size);
+
         [DllImport(DllName, EntryPoint="llglResetResourceSlots", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ResetResourceSlots(ResourceType resourceType, int firstSlot, int numSlots, int bindFlags, int stageFlags);
 
@@ -4261,6 +4574,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglEndRenderPass", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void EndRenderPass();
 
+        [DllImport(DllName, EntryPoint="llglNextSubpass", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void NextSubpass();
+
         [DllImport(DllName, EntryPoint="llglClear", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Clear(int flags, ref ClearValue clearValue);
 
@@ -4276,6 +4592,27 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetStencilReference", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetStencilReference(int reference, StencilFace stencilFace);
 
+        [DllImport(DllName, EntryPoint="llglSetCullMode", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetCullMode(CullMode cullMode);
+
+        [DllImport(DllName, EntryPoint="llglSetDepthState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDepthState(ref DepthDescriptor depthDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetStencilState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetStencilState(ref StencilDescriptor stencilDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetPrimitiveTopology", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetPrimitiveTopology(PrimitiveTopology primitiveTopology);
+
+        [DllImport(DllName, EntryPoint="llglSetDepthBias", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDepthBias(ref DepthBiasDescriptor depthBiasDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetShadingRate", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetShadingRate(ref ShadingRateDescriptor shadingRateDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetShadingRateImage", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetShadingRateImage(Texture texture);
+
         [DllImport(DllName, EntryPoint="llglSetUniforms", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetUniforms(int first, void* data, short dataSize);
 
@@ -4291,6 +4628,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglEndRenderCondition", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void EndRenderCondition();
 
+        [DllImport(DllName, EntryPoint="llglResolveQueryData", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ResolveQueryData(QueryHeap queryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset);
+
         [DllImport(DllName, EntryPoint="llglBeginStreamOutput", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void BeginStreamOutput(int numBuffers, Buffer* buffers);
 
@@ -4318,6 +4658,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglDrawIndexedInstancedExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedInstancedExt(int numIndices, int numInstances, int firstIndex, int vertexOffset, int firstInstance);
 
+        [DllImport(DllName, EntryPoint="llglMultiDrawIndexed", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void MultiDrawIndexed(int numDraws, DrawIndexedIndirectArguments* draws);
+
         [DllImport(DllName, EntryPoint="llglDrawIndirect", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndirect(Buffer buffer, long offset);
 
@@ -4330,6 +4673,18 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedIndirectExt(Buffer buffer, long offset, int numCommands, int stride);
 
+        [DllImport(DllName, EntryPoint="llglDrawIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndirectCount(Buffer argumentsBuffer, long argumentsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedIndirectCount(Buffer argumentsBuffer, long argumentsOffset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDrawMeshTasks", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMeshTasks(int numThreadGroupsX, int numThreadGroupsY, int numThreadGroupsZ);
+
+        [DllImport(DllName, EntryPoint="llglDrawMeshTasksIndirect", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMeshTasksIndirect(Buffer buffer, long offset, int numCommands, int stride);
+
         [DllImport(DllName, EntryPoint="llglDispatch", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
 
@@ -4349,6 +4704,9 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetNativeHandle(void* nativeHandle, IntPtr nativeHandleSize);
 
+        [DllImport(DllName, EntryPoint="llglExecuteCommandStream", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe IntPtr ExecuteCommandStream(void* stream, IntPtr streamSize);
+
         [DllImport(DllName, EntryPoint="llglSubmitCommandBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SubmitCommandBuffer(CommandBuffer commandBuffer);
 
@@ -4429,6 +4787,12 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglUnregisterLogCallback", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void UnregisterLogCallback(IntPtr handle);
 
+        [DllImport(DllName, EntryPoint="llglSetLogAsyncMode", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetLogAsyncMode([MarshalAs(UnmanagedType.I1)] bool enable);
+
+        [DllImport(DllName, EntryPoint="llglFlushLog", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void FlushLog();
+
         [DllImport(DllName, EntryPoint="llglGetPipelineCacheBlob", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe IntPtr GetPipelineCacheBlob(PipelineCache pipelineCache, void* data, IntPtr size);
 
@@ -4463,6 +4827,23 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerValidation(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerValidation(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerBufferOverrunDetection", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerBufferOverrunDetection(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerBufferOverrunDetection", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerBufferOverrunDetection(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerCapture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerCapture(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename, int numFrames);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
@@ -4714,6 +5095,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglPresent", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Present(SwapChain swapChain);
 
+        [DllImport(DllName, EntryPoint="llglPresentWithDamage", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void PresentWithDamage(SwapChain swapChain, int numDamageRects, Scissor* damageRects);
+
         [DllImport(DllName, EntryPoint="llglGetCurrentSwapIndex", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe int GetCurrentSwapIndex(SwapChain swapChain);
 
@@ -4734,6 +5118,13 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool SetVsyncInterval(SwapChain swapChain, int vsyncInterval);
 
+        [DllImport(DllName, EntryPoint="llglWaitForNextFrame", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitForNextFrame(SwapChain swapChain, long timeout);
+
+        [DllImport(DllName, EntryPoint="llglGetSurfaceTransform", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe SurfaceTransform GetSurfaceTransform(SwapChain swapChain);
+
         [DllImport(DllName, EntryPoint="llglSwitchFullscreen", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool SwitchFullscreen(SwapChain swapChain, [MarshalAs(UnmanagedType.I1)] bool enable);
@@ -4741,6 +5132,13 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetSurface", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Surface GetSurface(SwapChain swapChain);
 
+        [DllImport(DllName, EntryPoint="llglDetachSurface", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DetachSurface(SwapChain swapChain);
+
+        [DllImport(DllName, EntryPoint="llglAttachSurface", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool AttachSurface(SwapChain swapChain);
+
         [DllImport(DllName, EntryPoint="llglGetTextureType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe TextureType GetTextureType(Texture texture);
 
@@ -4759,6 +5157,10 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetTextureSubresourceFootprint", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void GetTextureSubresourceFootprint(Texture texture, int mipLevel, ref SubresourceFootprint outFootprint);
 
+        [DllImport(DllName, EntryPoint="llglSetTextureMinLOD", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool SetTextureMinLOD(Texture texture, float minLOD);
+
         [DllImport(DllName, EntryPoint="llglTimerFrequency", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe long TimerFrequency();
 
@@ -4860,6 +5262,12 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglRemoveWindowEventListener", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void RemoveWindowEventListener(Window window, int eventListenerID);
 
+        [DllImport(DllName, EntryPoint="llglSetWindowGlobalMotionBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetWindowGlobalMotionBuffer(Window window, int capacity);
+
+        [DllImport(DllName, EntryPoint="llglReadWindowGlobalMotion", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int ReadWindowGlobalMotion(Window window, int maxCount, Offset2D* outMotions);
+
         [DllImport(DllName, EntryPoint="llglPostWindowQuit", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void PostWindowQuit(Window window);
 
@@ -17,6 +17,8 @@ namespace LLGL
         public AttachmentFormatDescriptor DepthAttachment { get; set; } = new AttachmentFormatDescriptor();
         public AttachmentFormatDescriptor StencilAttachment { get; set; } = new AttachmentFormatDescriptor();
         public int Samples { get; set; } = 1;
+        public SubpassDescriptor[] Subpasses { get; set; }
+        public int ViewMask { get; set; } = 0;
 
         internal NativeLLGL.RenderPassDescriptor Native
         {
@@ -37,6 +39,15 @@ namespace LLGL
                     native.depthAttachment = DepthAttachment.Native;
                     native.stencilAttachment = StencilAttachment.Native;
                     native.samples = Samples;
+                    if (Subpasses != null)
+                    {
+                        native.numSubpasses = (IntPtr)Subpasses.Length;
+                        fixed (SubpassDescriptor* subpassesPtr = Subpasses)
+                        {
+                            native.subpasses = subpassesPtr;
+                        }
+                    }
+                    native.viewMask = ViewMask;
                 }
                 return native;
             }
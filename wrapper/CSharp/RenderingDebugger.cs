@@ -36,6 +36,35 @@ namespace LLGL
             }
         }
 
+        public bool Validation
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerValidation(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerValidation(Native, value);
+            }
+        }
+
+        public bool BufferOverrunDetection
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerBufferOverrunDetection(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerBufferOverrunDetection(Native, value);
+            }
+        }
+
+        public void SetCapture(string filename, int numFrames = 0)
+        {
+            NativeLLGL.SetDebuggerCapture(Native, filename, numFrames);
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();
@@ -38,6 +38,17 @@ namespace LLGL
             NativeLLGL.Present(NativeSub);
         }
 
+        public void PresentWithDamage(Scissor[] damageRects)
+        {
+            unsafe
+            {
+                fixed (Scissor* damageRectsPtr = damageRects)
+                {
+                    NativeLLGL.PresentWithDamage(NativeSub, damageRects.Length, damageRectsPtr);
+                }
+            }
+        }
+
         public int CurrentSwapIndex
         {
             get
@@ -80,11 +91,34 @@ namespace LLGL
             return NativeLLGL.SetVsyncInterval(NativeSub, vsyncInterval);
         }
 
+        public bool WaitForNextFrame(long timeout = -1)
+        {
+            return NativeLLGL.WaitForNextFrame(NativeSub, timeout);
+        }
+
+        public SurfaceTransform SurfaceTransform
+        {
+            get
+            {
+                return NativeLLGL.GetSurfaceTransform(NativeSub);
+            }
+        }
+
         public bool SwitchFullscreen(bool enable)
         {
             return NativeLLGL.SwitchFullscreen(NativeSub, enable);
         }
 
+        public void DetachSurface()
+        {
+            NativeLLGL.DetachSurface(NativeSub);
+        }
+
+        public bool AttachSurface()
+        {
+            return NativeLLGL.AttachSurface(NativeSub);
+        }
+
     }
 }
 
@@ -285,6 +285,22 @@ namespace LLGL
             }
         }
 
+        public void SetGlobalMotionBuffer(int capacity)
+        {
+            NativeLLGL.SetWindowGlobalMotionBuffer(Native, capacity);
+        }
+
+        public int ReadGlobalMotion(Offset2D[] motions)
+        {
+            unsafe
+            {
+                fixed (Offset2D* motionsPtr = motions)
+                {
+                    return NativeLLGL.ReadWindowGlobalMotion(Native, (motions != null ? motions.Length : 0), motionsPtr);
+                }
+            }
+        }
+
         public bool HasQuit
         {
             get